@@ -0,0 +1,171 @@
+/*************************************************************************/
+/*  cpu_profiler.cpp                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "cpu_profiler.h"
+
+std::atomic<bool> CPUProfiler::enabled(false);
+Mutex CPUProfiler::mutex;
+LocalVector<CPUProfiler::ThreadBuffer *> CPUProfiler::buffers;
+std::atomic<uint32_t> CPUProfiler::generation(1);
+thread_local CPUProfiler::ThreadBufferOwner CPUProfiler::thread_buffer;
+
+CPUProfiler::ThreadBufferOwner::~ThreadBufferOwner() {
+	if (!buffer) {
+		return;
+	}
+	MutexLock lock(mutex);
+	if (generation == CPUProfiler::generation.load()) {
+		buffer->exited = true;
+	}
+}
+
+CPUProfiler::ThreadBuffer *CPUProfiler::_create_thread_buffer() {
+	ThreadBuffer *buffer = memnew(ThreadBuffer);
+	buffer->thread_id = Thread::get_caller_id();
+
+	MutexLock lock(mutex);
+	buffers.push_back(buffer);
+	thread_buffer.generation = generation.load();
+	return buffer;
+}
+
+CPUProfiler::ThreadBuffer *CPUProfiler::_get_thread_buffer() {
+	if (unlikely(!thread_buffer.buffer || thread_buffer.generation != generation.load(std::memory_order_relaxed))) {
+		return nullptr;
+	}
+	return thread_buffer.buffer;
+}
+
+uint64_t CPUProfiler::_begin() {
+	ThreadBuffer *buffer = _get_thread_buffer();
+	if (unlikely(!buffer)) {
+		buffer = _create_thread_buffer();
+		thread_buffer.buffer = buffer;
+	}
+	buffer->depth++;
+	return OS::get_singleton()->get_ticks_usec();
+}
+
+void CPUProfiler::_end(const char *p_name, uint64_t p_begin) {
+	ThreadBuffer *buffer = _get_thread_buffer();
+	if (unlikely(!buffer)) {
+		return; // Started before finish().
+	}
+	buffer->depth--;
+	uint64_t end = OS::get_singleton()->get_ticks_usec();
+
+	buffer->lock.lock();
+	Event &event = buffer->events[buffer->written % THREAD_BUFFER_SIZE];
+	event.name = p_name;
+	event.begin = p_begin;
+	event.end = end;
+	event.depth = buffer->depth;
+	buffer->written++;
+	buffer->lock.unlock();
+}
+
+void CPUProfiler::set_enabled(bool p_enabled) {
+	MutexLock lock(mutex);
+	if (p_enabled && !enabled.load()) {
+		// Start from an empty trace.
+		for (uint32_t i = 0; i < buffers.size(); i++) {
+			buffers[i]->lock.lock();
+			buffers[i]->read = buffers[i]->written;
+			buffers[i]->lock.unlock();
+		}
+	}
+	enabled.store(p_enabled);
+}
+
+void CPUProfiler::collect(Array &r_events) {
+	MutexLock lock(mutex);
+
+	LocalVector<Event> events;
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		ThreadBuffer *buffer = buffers[i];
+
+		// Copy the new events out under the buffer lock, so the thread can't overwrite them while they are read.
+		buffer->lock.lock();
+		if (buffer->written - buffer->read > THREAD_BUFFER_SIZE) {
+			buffer->read = buffer->written - THREAD_BUFFER_SIZE; // Wrapped around, the oldest events are lost.
+		}
+		events.resize(buffer->written - buffer->read);
+		for (uint32_t j = 0; j < events.size(); j++) {
+			events[j] = buffer->events[(buffer->read + j) % THREAD_BUFFER_SIZE];
+		}
+		buffer->read = buffer->written;
+		buffer->lock.unlock();
+
+		for (uint32_t j = 0; j < events.size(); j++) {
+			const Event &event = events[j];
+			r_events.push_back(buffer->thread_id);
+			r_events.push_back(event.name);
+			r_events.push_back(event.begin);
+			r_events.push_back(event.end);
+			r_events.push_back(event.depth);
+		}
+
+		if (buffer->exited) {
+			// Everything it recorded was collected, it won't record anything else.
+			memdelete(buffer);
+			buffers.remove(i);
+			i--;
+		}
+	}
+}
+
+String CPUProfiler::to_chrome_trace(const Array &p_events) {
+	// Complete ("X") events of the Trace Event Format, loaded by chrome://tracing and Perfetto.
+	String trace = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	for (int i = 0; i + 4 < p_events.size(); i += 5) {
+		if (i > 0) {
+			trace += ",";
+		}
+		uint64_t begin = p_events[i + 2];
+		uint64_t end = p_events[i + 3];
+		trace += "{\"name\":\"" + String(p_events[i + 1]).json_escape() + "\",\"ph\":\"X\",\"pid\":0,\"tid\":" + itos(p_events[i]) + ",\"ts\":" + itos(begin) + ",\"dur\":" + itos(end - begin) + "}";
+	}
+	trace += "]}";
+	return trace;
+}
+
+void CPUProfiler::finish() {
+	enabled.store(false);
+
+	// Other threads still holding a pointer to their buffer see the generation change and never touch it again.
+	// No thread may be inside a scope while this runs.
+	MutexLock lock(mutex);
+	generation++;
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		memdelete(buffers[i]);
+	}
+	buffers.clear();
+	thread_buffer.buffer = nullptr;
+}
@@ -0,0 +1,125 @@
+/*************************************************************************/
+/*  cpu_profiler.h                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef CPU_PROFILER_H
+#define CPU_PROFILER_H
+
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/os/spin_lock.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/array.h"
+
+#include <atomic>
+
+// Records scoped, nested CPU markers (see CPU_PROFILE_SCOPE) in a ring buffer per thread.
+// Each buffer has its own spin lock, only contended while collect() copies the new events out.
+class CPUProfiler {
+public:
+	struct Event {
+		const char *name = nullptr;
+		uint64_t begin = 0; // Microseconds, as OS::get_ticks_usec().
+		uint64_t end = 0;
+		uint32_t depth = 0;
+	};
+
+	class Scope {
+		const char *name = nullptr;
+		uint64_t begin = 0;
+
+	public:
+		_FORCE_INLINE_ Scope(const char *p_name) {
+			if (enabled.load(std::memory_order_relaxed)) {
+				name = p_name;
+				begin = _begin();
+			}
+		}
+
+		_FORCE_INLINE_ ~Scope() {
+			if (name) {
+				_end(name, begin);
+			}
+		}
+	};
+
+private:
+	enum {
+		THREAD_BUFFER_SIZE = 16384,
+	};
+
+	struct ThreadBuffer {
+		Thread::ID thread_id;
+		SpinLock lock; // Guards events and written.
+		Event events[THREAD_BUFFER_SIZE];
+		uint64_t written = 0;
+		uint64_t read = 0; // Only used by collect(), under the global mutex.
+		uint32_t depth = 0;
+		bool exited = false; // The thread is gone, the buffer is freed once collected.
+	};
+
+	// Frees the buffer of a thread when it exits (or rather, lets collect() free it after reading it).
+	struct ThreadBufferOwner {
+		ThreadBuffer *buffer = nullptr;
+		uint32_t generation = 0;
+		~ThreadBufferOwner();
+	};
+
+	static std::atomic<bool> enabled;
+	static Mutex mutex;
+	static LocalVector<ThreadBuffer *> buffers;
+	// Bumped by finish(), which frees every buffer. Threads holding a buffer of an older generation
+	// (without being able to tell it was freed) create a new one.
+	static std::atomic<uint32_t> generation;
+	static thread_local ThreadBufferOwner thread_buffer;
+
+	static ThreadBuffer *_get_thread_buffer();
+	static ThreadBuffer *_create_thread_buffer();
+	static uint64_t _begin();
+	static void _end(const char *p_name, uint64_t p_begin);
+
+public:
+	static void set_enabled(bool p_enabled);
+	static bool is_enabled() { return enabled.load(std::memory_order_relaxed); }
+
+	// Appends the events recorded since the last call, as [thread_id, name, begin, end, depth] quintuples.
+	static void collect(Array &r_events);
+	static String to_chrome_trace(const Array &p_events);
+
+	static void finish();
+};
+
+#ifdef DEBUG_ENABLED
+#define CPU_PROFILE_SCOPE(m_name) CPUProfiler::Scope _cpu_profile_scope(m_name)
+#else
+#define CPU_PROFILE_SCOPE(m_name)
+#endif
+
+#endif // CPU_PROFILER_H
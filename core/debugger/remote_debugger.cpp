@@ -31,6 +31,7 @@
 #include "remote_debugger.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/debugger/debugger_marshalls.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/script_debugger.h"
@@ -206,7 +207,7 @@ struct RemoteDebugger::ScriptsProfiler {
 			for (int i = 0; i < ScriptServer::get_language_count(); i++) {
 				ScriptServer::get_language(i)->profiling_start();
 			}
-			if (p_opts.size() == 1 && p_opts[0].get_type() == Variant::INT) {
+			if (p_opts.size() >= 1 && p_opts[0].get_type() == Variant::INT) {
 				max_frame_functions = MAX(0, int(p_opts[0]));
 			}
 		} else {
@@ -276,6 +277,7 @@ struct RemoteDebugger::ServersProfiler {
 
 	Map<StringName, ServerInfo> server_data;
 	ScriptsProfiler scripts_profiler;
+	int sample_interval = 1; // Only one frame out of this many is sent, to reduce the load on the game and the connection.
 
 	float frame_time = 0;
 	float idle_time = 0;
@@ -286,6 +288,10 @@ struct RemoteDebugger::ServersProfiler {
 		skip_profile_frame = false;
 		if (p_enable) {
 			server_data.clear(); // Clear old profiling data.
+			sample_interval = 1;
+			if (p_opts.size() >= 2 && p_opts[1].get_type() == Variant::INT) {
+				sample_interval = MAX(1, int(p_opts[1]));
+			}
 		} else {
 			_send_frame_data(true); // Send final frame.
 		}
@@ -312,6 +318,12 @@ struct RemoteDebugger::ServersProfiler {
 		idle_time = p_idle_time;
 		physics_time = p_physics_time;
 		physics_frame_time = p_physics_frame_time;
+		if (sample_interval > 1 && Engine::get_singleton()->get_process_frames() % sample_interval != 0) {
+			for (Map<StringName, ServerInfo>::Element *E = server_data.front(); E; E = E->next()) {
+				E->get().functions.clear();
+			}
+			return;
+		}
 		_send_frame_data(false);
 	}
 
@@ -370,6 +382,22 @@ struct RemoteDebugger::VisualProfiler {
 	}
 };
 
+struct RemoteDebugger::CPUTraceProfiler {
+	void toggle(bool p_enable, const Array &p_opts) {
+		CPUProfiler::set_enabled(p_enable);
+	}
+
+	void add(const Array &p_data) {}
+
+	void tick(float p_frame_time, float p_idle_time, float p_physics_time, float p_physics_frame_time) {
+		Array events;
+		CPUProfiler::collect(events);
+		if (events.size()) {
+			EngineDebugger::get_singleton()->send_message("cpu_trace:events", events);
+		}
+	}
+};
+
 struct RemoteDebugger::PerformanceProfiler {
 	Object *performance = nullptr;
 	int last_perf_time = 0;
@@ -936,6 +964,9 @@ RemoteDebugger::RemoteDebugger(Ref<RemoteDebuggerPeer> p_peer) {
 	visual_profiler = memnew(VisualProfiler);
 	_bind_profiler("visual", visual_profiler);
 
+	cpu_trace_profiler = memnew(CPUTraceProfiler);
+	_bind_profiler("cpu_trace", cpu_trace_profiler);
+
 	// Performance Profiler
 	Object *perf = Engine::get_singleton()->get_singleton_object("Performance");
 	if (perf) {
@@ -973,12 +1004,14 @@ RemoteDebugger::~RemoteDebugger() {
 	EngineDebugger::get_singleton()->unregister_profiler("servers");
 	EngineDebugger::get_singleton()->unregister_profiler("network");
 	EngineDebugger::get_singleton()->unregister_profiler("visual");
+	EngineDebugger::get_singleton()->unregister_profiler("cpu_trace");
 	if (EngineDebugger::has_profiler("performance")) {
 		EngineDebugger::get_singleton()->unregister_profiler("performance");
 	}
 	memdelete(servers_profiler);
 	memdelete(network_profiler);
 	memdelete(visual_profiler);
+	memdelete(cpu_trace_profiler);
 	if (performance_profiler) {
 		memdelete(performance_profiler);
 	}
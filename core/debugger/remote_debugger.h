@@ -53,11 +53,13 @@ private:
 	struct ServersProfiler;
 	struct ScriptsProfiler;
 	struct VisualProfiler;
+	struct CPUTraceProfiler;
 	struct PerformanceProfiler;
 
 	NetworkProfiler *network_profiler = nullptr;
 	ServersProfiler *servers_profiler = nullptr;
 	VisualProfiler *visual_profiler = nullptr;
+	CPUTraceProfiler *cpu_trace_profiler = nullptr;
 	PerformanceProfiler *performance_profiler = nullptr;
 
 	Ref<RemoteDebuggerPeer> peer;
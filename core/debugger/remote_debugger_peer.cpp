@@ -31,6 +31,7 @@
 #include "remote_debugger_peer.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/compression.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 
@@ -106,10 +107,23 @@ void RemoteDebuggerPeerTCP::_write_out() {
 			int size = 0;
 			Error err = encode_variant(var, nullptr, size);
 			ERR_CONTINUE(err != OK || size > out_buf.size() - 4); // 4 bytes separator.
-			encode_uint32(size, buf);
-			encode_variant(var, buf + 4, size);
-			out_left = size + 4;
+			out_left = 0;
 			out_pos = 0;
+			if (size >= int(COMPRESS_MIN_SIZE) && Compression::get_max_compressed_buffer_size(size, Compression::MODE_ZSTD) <= out_buf.size() - 8) {
+				encode_buf.resize(size);
+				encode_variant(var, encode_buf.ptrw(), size);
+				int compressed_size = Compression::compress(buf + 8, encode_buf.ptr(), size, Compression::MODE_ZSTD);
+				if (compressed_size > 0 && compressed_size + 4 < size) {
+					encode_uint32((compressed_size + 4) | PACKET_COMPRESSED, buf);
+					encode_uint32(size, buf + 4);
+					out_left = compressed_size + 8;
+				}
+			}
+			if (out_left == 0) {
+				encode_uint32(size, buf);
+				encode_variant(var, buf + 4, size);
+				out_left = size + 4;
+			}
 		}
 		int sent = 0;
 		tcp_client->put_partial_data(buf + out_pos, out_left, sent);
@@ -131,6 +145,8 @@ void RemoteDebuggerPeerTCP::_read_in() {
 			uint32_t size = 0;
 			int read = 0;
 			Error err = tcp_client->get_partial_data((uint8_t *)&size, 4, read);
+			in_compressed = size & PACKET_COMPRESSED;
+			size &= ~PACKET_COMPRESSED;
 			ERR_CONTINUE(read != 4 || err != OK || size > (uint32_t)in_buf.size());
 			in_left = size;
 			in_pos = 0;
@@ -140,9 +156,20 @@ void RemoteDebuggerPeerTCP::_read_in() {
 		in_left -= read;
 		in_pos += read;
 		if (in_left == 0) {
+			const uint8_t *data = buf;
+			int size = in_pos;
+			if (in_compressed) {
+				ERR_CONTINUE(in_pos < 4);
+				size = decode_uint32(buf);
+				ERR_CONTINUE_MSG(size > get_max_message_size(), "Malformed packet received, decompressed size is too large.");
+				decode_buf.resize(size);
+				int decompressed = Compression::decompress(decode_buf.ptrw(), size, buf + 4, in_pos - 4, Compression::MODE_ZSTD);
+				ERR_CONTINUE_MSG(decompressed != size, "Malformed packet received, can't decompress.");
+				data = decode_buf.ptr();
+			}
 			Variant var;
-			Error err = decode_variant(var, buf, in_pos, &read);
-			ERR_CONTINUE(read != in_pos || err != OK);
+			Error err = decode_variant(var, data, size, &read);
+			ERR_CONTINUE(read != size || err != OK);
 			ERR_CONTINUE_MSG(var.get_type() != Variant::ARRAY, "Malformed packet received, not an Array.");
 			mutex.lock();
 			in_queue.push_back(var);
@@ -56,6 +56,13 @@ public:
 
 class RemoteDebuggerPeerTCP : public RemoteDebuggerPeer {
 private:
+	// Each packet is a 32-bit size followed by an encoded Variant. Large packets are compressed
+	// with zstd, then the size has PACKET_COMPRESSED set and the data starts with the decompressed size.
+	enum {
+		PACKET_COMPRESSED = 1u << 31,
+		COMPRESS_MIN_SIZE = 1024,
+	};
+
 	Ref<StreamPeerTCP> tcp_client;
 	Mutex mutex;
 	Thread thread;
@@ -64,9 +71,12 @@ private:
 	int out_left = 0;
 	int out_pos = 0;
 	Vector<uint8_t> out_buf;
+	Vector<uint8_t> encode_buf;
 	int in_left = 0;
 	int in_pos = 0;
+	bool in_compressed = false;
 	Vector<uint8_t> in_buf;
+	Vector<uint8_t> decode_buf;
 	bool connected = false;
 	bool running = false;
 
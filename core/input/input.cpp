@@ -446,6 +446,7 @@ Vector3 Input::get_gyroscope() const {
 
 void Input::parse_input_event(const Ref<InputEvent> &p_event) {
 	_parse_input_event_impl(p_event, false);
+	OS::get_singleton()->wake_main_loop();
 }
 
 void Input::_parse_input_event_impl(const Ref<InputEvent> &p_event, bool p_is_emulated) {
@@ -833,6 +834,16 @@ void Input::accumulate_input_event(const Ref<InputEvent> &p_event) {
 		return; //event was accumulated, exit
 	}
 
+	// Drags of several fingers arrive interleaved, look for the previous drag of the same finger.
+	// Only drags are skipped, so events of a finger never move past other kinds of events.
+	if (Object::cast_to<InputEventScreenDrag>(*p_event)) {
+		for (List<Ref<InputEvent>>::Element *E = accumulated_events.back(); E && Object::cast_to<InputEventScreenDrag>(*E->get()); E = E->prev()) {
+			if (E->get()->accumulate(p_event)) {
+				return;
+			}
+		}
+	}
+
 	accumulated_events.push_back(p_event);
 }
 
@@ -725,6 +725,9 @@ Ref<InputEvent> InputEventMouseMotion::xformed_by(const Transform2D &p_xform, co
 	mm->set_relative(r);
 	mm->set_speed(s);
 
+	mm->coalesced = coalesced;
+	mm->coalesced_xform = p_xform * Transform2D(0.0, p_local_ofs) * coalesced_xform;
+
 	return mm;
 }
 
@@ -792,14 +795,34 @@ bool InputEventMouseMotion::accumulate(const Ref<InputEvent> &p_event) {
 		return false;
 	}
 
+	if (coalesced.is_empty()) {
+		coalesced.push_back(xformed_by(Transform2D())); // Copy of this event, as it was received.
+	}
+	if (motion->coalesced.is_empty()) {
+		coalesced.push_back(motion);
+	} else {
+		coalesced.append_array(motion->coalesced);
+	}
+
 	set_position(motion->get_position());
 	set_global_position(motion->get_global_position());
 	set_speed(motion->get_speed());
+	set_pressure(motion->get_pressure());
+	set_tilt(motion->get_tilt());
 	relative += motion->get_relative();
 
 	return true;
 }
 
+Array InputEventMouseMotion::get_coalesced_events() const {
+	Array events;
+	events.resize(coalesced.size());
+	for (int i = 0; i < coalesced.size(); i++) {
+		events[i] = coalesced[i]->xformed_by(coalesced_xform);
+	}
+	return events;
+}
+
 void InputEventMouseMotion::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_tilt", "tilt"), &InputEventMouseMotion::set_tilt);
 	ClassDB::bind_method(D_METHOD("get_tilt"), &InputEventMouseMotion::get_tilt);
@@ -813,6 +836,8 @@ void InputEventMouseMotion::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_speed", "speed"), &InputEventMouseMotion::set_speed);
 	ClassDB::bind_method(D_METHOD("get_speed"), &InputEventMouseMotion::get_speed);
 
+	ClassDB::bind_method(D_METHOD("get_coalesced_events"), &InputEventMouseMotion::get_coalesced_events);
+
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "tilt"), "set_tilt", "get_tilt");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "pressure"), "set_pressure", "get_pressure");
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "relative"), "set_relative", "get_relative");
@@ -1147,6 +1172,27 @@ String InputEventScreenDrag::to_string() {
 	return "InputEventScreenDrag : index=" + itos(index) + ", position=(" + String(get_position()) + "), relative=(" + String(get_relative()) + "), speed=(" + String(get_speed()) + ")";
 }
 
+bool InputEventScreenDrag::accumulate(const Ref<InputEvent> &p_event) {
+	Ref<InputEventScreenDrag> drag = p_event;
+	if (drag.is_null()) {
+		return false;
+	}
+
+	if (get_window_id() != drag->get_window_id()) {
+		return false;
+	}
+
+	if (get_index() != drag->get_index()) {
+		return false;
+	}
+
+	set_position(drag->get_position());
+	set_speed(drag->get_speed());
+	relative += drag->get_relative();
+
+	return true;
+}
+
 void InputEventScreenDrag::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_index", "index"), &InputEventScreenDrag::set_index);
 	ClassDB::bind_method(D_METHOD("get_index"), &InputEventScreenDrag::get_index);
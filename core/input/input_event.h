@@ -329,6 +329,11 @@ class InputEventMouseMotion : public InputEventMouse {
 	Vector2 relative;
 	Vector2 speed;
 
+	// Events merged into this one when input is accumulated, as they were received. They are only
+	// transformed when requested, coalesced_xform holds the transforms applied to this event since.
+	Vector<Ref<InputEventMouseMotion>> coalesced;
+	Transform2D coalesced_xform;
+
 protected:
 	static void _bind_methods();
 
@@ -350,6 +355,7 @@ public:
 	virtual String to_string() override;
 
 	virtual bool accumulate(const Ref<InputEvent> &p_event) override;
+	Array get_coalesced_events() const;
 
 	InputEventMouseMotion() {}
 };
@@ -462,6 +468,8 @@ public:
 	virtual String as_text() const override;
 	virtual String to_string() override;
 
+	virtual bool accumulate(const Ref<InputEvent> &p_event) override;
+
 	InputEventScreenDrag() {}
 };
 
@@ -30,6 +30,7 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
 #include "core/string/print_string.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, int p_block_size) {
@@ -95,6 +96,39 @@ Error FileAccessCompressed::open_after_magic(FileAccess *p_base) {
 	return OK;
 }
 
+Vector<uint8_t> FileAccessCompressed::compress_buffer(const uint8_t *p_data, uint32_t p_size, const String &p_magic, Compression::Mode p_mode, int p_block_size) {
+	// Same layout close() writes, so the result can be read back with open_after_magic().
+	ERR_FAIL_COND_V(p_block_size <= 0, Vector<uint8_t>());
+	CharString mgc = p_magic.ascii();
+	ERR_FAIL_COND_V(mgc.length() != 4, Vector<uint8_t>());
+
+	int bc = (p_size / p_block_size) + 1;
+	int header_size = 16 + bc * 4;
+
+	Vector<uint8_t> out;
+	out.resize(header_size + Compression::get_max_compressed_buffer_size(p_block_size, p_mode) * bc + 4);
+	uint8_t *w = out.ptrw();
+
+	copymem(w, mgc.get_data(), 4);
+	encode_uint32(p_mode, &w[4]);
+	encode_uint32(p_block_size, &w[8]);
+	encode_uint32(p_size, &w[12]);
+
+	int ofs = header_size;
+	for (int i = 0; i < bc; i++) {
+		int bl = i == (bc - 1) ? p_size % p_block_size : p_block_size;
+		int s = Compression::compress(&w[ofs], &p_data[i * p_block_size], bl, p_mode);
+		ERR_FAIL_COND_V(s < 0, Vector<uint8_t>());
+		encode_uint32(s, &w[16 + i * 4]);
+		ofs += s;
+	}
+
+	copymem(&w[ofs], mgc.get_data(), 4); // Magic at the end too.
+	ofs += 4;
+	out.resize(ofs);
+	return out;
+}
+
 Error FileAccessCompressed::_open(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_COND_V(p_mode_flags == READ_WRITE, ERR_UNAVAILABLE);
 
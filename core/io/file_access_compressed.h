@@ -68,6 +68,8 @@ public:
 
 	Error open_after_magic(FileAccess *p_base);
 
+	static Vector<uint8_t> compress_buffer(const uint8_t *p_data, uint32_t p_size, const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, int p_block_size = 4096);
+
 	virtual Error _open(const String &p_path, int p_mode_flags); ///< open a file
 	virtual void close(); ///< close a file
 	virtual bool is_open() const; ///< true when file is open
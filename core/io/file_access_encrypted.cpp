@@ -30,13 +30,56 @@
 
 #include "file_access_encrypted.h"
 
-#include "core/crypto/crypto_core.h"
 #include "core/os/copymem.h"
+#include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/thread_work_pool.h"
 #include "core/variant/variant.h"
 
 #include <stdio.h>
 
+void FileAccessEncrypted::DecryptJob::decrypt_chunk(uint32_t p_index, void *p_userdata) {
+	uint32_t from = p_index * DECRYPT_CHUNK_SIZE;
+	uint8_t iv[16];
+	copymem(iv, ivs + p_index * 16, 16);
+	ctx->decrypt_cfb(MIN(uint32_t(DECRYPT_CHUNK_SIZE), size - from), iv, data + from, data + from);
+}
+
+void FileAccessEncrypted::_decrypt_cfb(CryptoCore::AESContext &p_ctx, uint32_t p_size, const uint8_t p_iv[16], uint8_t *r_data) {
+	uint32_t chunks = (p_size + DECRYPT_CHUNK_SIZE - 1) / DECRYPT_CHUNK_SIZE;
+	int thread_count = OS::get_singleton()->can_use_threads() ? MIN(OS::get_singleton()->get_processor_count(), int(chunks)) : 1;
+
+	uint8_t iv[16];
+	copymem(iv, p_iv, 16);
+
+	if (thread_count < 2) {
+		p_ctx.decrypt_cfb(p_size, iv, r_data, r_data);
+		return;
+	}
+
+	// CFB decryption only depends on the ciphertext: each chunk can be decrypted on its own, using
+	// the last ciphertext block of the previous chunk as initialization vector. Those blocks are
+	// saved first since the data is decrypted in place.
+	Vector<uint8_t> ivs;
+	ivs.resize(chunks * 16);
+	uint8_t *w = ivs.ptrw();
+	copymem(w, p_iv, 16);
+	for (uint32_t i = 1; i < chunks; i++) {
+		copymem(w + i * 16, r_data + i * DECRYPT_CHUNK_SIZE - 16, 16);
+	}
+
+	DecryptJob job;
+	job.ctx = &p_ctx; // Only the key schedule is read, so the context can be shared.
+	job.data = r_data;
+	job.ivs = ivs.ptr();
+	job.size = p_size;
+
+	ThreadWorkPool work_pool;
+	work_pool.init(thread_count - 1); // The calling thread takes part in the work too.
+	work_pool.do_work(chunks, &job, &DecryptJob::decrypt_chunk, (void *)nullptr);
+	work_pool.finish();
+}
+
 Error FileAccessEncrypted::open_and_parse(FileAccess *p_base, const Vector<uint8_t> &p_key, Mode p_mode, bool p_with_magic) {
 	ERR_FAIL_COND_V_MSG(file != nullptr, ERR_ALREADY_IN_USE, "Can't open file while another file from path '" + file->get_path_absolute() + "' is open.");
 	ERR_FAIL_COND_V(p_key.size() != 32, ERR_INVALID_PARAMETER);
@@ -84,7 +127,7 @@ Error FileAccessEncrypted::open_and_parse(FileAccess *p_base, const Vector<uint8
 			CryptoCore::AESContext ctx;
 
 			ctx.set_encode_key(key.ptrw(), 256); // Due to the nature of CFB, same key schedule is used for both encryption and decryption!
-			ctx.decrypt_cfb(ds, iv, data.ptrw(), data.ptrw());
+			_decrypt_cfb(ctx, ds, iv, data.ptrw());
 		}
 
 		data.resize(length);
@@ -31,6 +31,7 @@
 #ifndef FILE_ACCESS_ENCRYPTED_H
 #define FILE_ACCESS_ENCRYPTED_H
 
+#include "core/crypto/crypto_core.h"
 #include "core/os/file_access.h"
 
 #define ENCRYPTED_HEADER_MAGIC 0x43454447
@@ -54,6 +55,21 @@ private:
 	mutable bool eofed = false;
 	bool use_magic = true;
 
+	enum {
+		DECRYPT_CHUNK_SIZE = 256 * 1024, // Larger files are decrypted on several threads, in chunks of this many bytes.
+	};
+
+	struct DecryptJob {
+		CryptoCore::AESContext *ctx = nullptr;
+		uint8_t *data = nullptr;
+		const uint8_t *ivs = nullptr; // Initialization vector of each chunk.
+		uint32_t size = 0;
+
+		void decrypt_chunk(uint32_t p_index, void *p_userdata);
+	};
+
+	static void _decrypt_cfb(CryptoCore::AESContext &p_ctx, uint32_t p_size, const uint8_t p_iv[16], uint8_t *r_data);
+
 	void _release();
 
 public:
@@ -30,6 +30,7 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/object/script_language.h"
 #include "core/version.h"
@@ -46,7 +47,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, size_t p_
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	PathMD5 pmd5(path.md5_buffer());
 	//printf("adding path %s, %lli, %lli\n", path.utf8().get_data(), pmd5.a, pmd5.b);
 
@@ -54,6 +55,7 @@ void PackedData::add_path(const String &pkg_path, const String &path, uint64_t o
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = pkg_path;
 	pf.offset = ofs;
 	pf.size = size;
@@ -234,16 +236,76 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 	}
 
 	f->close();
 	memdelete(f);
+
+	_map_pack(p_path);
 	return true;
 }
 
+void PackedSourcePCK::_map_pack(const String &p_path) {
+	if (mappings.has(p_path)) {
+		return;
+	}
+
+	FileAccess *f = FileAccess::open(p_path, FileAccess::READ);
+	if (!f) {
+		return;
+	}
+
+	const uint8_t *data = f->map_read_only();
+	if (!data) {
+		// Not supported here, files will be read through their own file handle.
+		f->close();
+		memdelete(f);
+		return;
+	}
+
+	PackMapping mapping;
+	mapping.f = f;
+	mapping.data = data;
+	mapping.size = f->get_len();
+	mappings[p_path] = mapping;
+}
+
 FileAccess *PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
-	return memnew(FileAccessPack(p_path, *p_file));
+	FileAccessPack *fp;
+	const Map<String, PackMapping>::Element *E = mappings.find(p_file->pack);
+	if (E && !p_file->encrypted && p_file->offset + p_file->size <= E->get().size) {
+		fp = memnew(FileAccessPack(p_path, *p_file, E->get().data));
+	} else {
+		fp = memnew(FileAccessPack(p_path, *p_file));
+	}
+
+	if (!p_file->compressed) {
+		return fp;
+	}
+
+	// Compressed files are stored as independently compressed blocks, so seeking only decompresses the block it lands in.
+	uint8_t magic[4] = {};
+	fp->get_buffer(magic, 4);
+	if (memcmp(magic, PACK_FILE_COMPRESSED_MAGIC, 4) != 0) {
+		memdelete(fp);
+		ERR_FAIL_V_MSG(nullptr, "Can't open compressed pack-referenced file '" + p_path + "', invalid magic.");
+	}
+
+	FileAccessCompressed *fac = memnew(FileAccessCompressed);
+	if (fac->open_after_magic(fp) != OK) {
+		memdelete(fac);
+		memdelete(fp);
+		ERR_FAIL_V_MSG(nullptr, "Can't open compressed pack-referenced file '" + p_path + "'.");
+	}
+	return fac;
+}
+
+PackedSourcePCK::~PackedSourcePCK() {
+	for (Map<String, PackMapping>::Element *E = mappings.front(); E; E = E->next()) {
+		E->get().f->close();
+		memdelete(E->get().f);
+	}
 }
 
 //////////////////////////////////////////////////////////////////
@@ -254,11 +316,14 @@ Error FileAccessPack::_open(const String &p_path, int p_mode_flags) {
 }
 
 void FileAccessPack::close() {
-	f->close();
+	if (f) {
+		f->close();
+	}
+	data = nullptr;
 }
 
 bool FileAccessPack::is_open() const {
-	return f->is_open();
+	return data || (f && f->is_open());
 }
 
 void FileAccessPack::seek(size_t p_position) {
@@ -268,7 +333,9 @@ void FileAccessPack::seek(size_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -294,6 +361,10 @@ uint8_t FileAccessPack::get_8() const {
 		return 0;
 	}
 
+	if (data) {
+		return data[pos++];
+	}
+
 	pos++;
 	return f->get_8();
 }
@@ -309,19 +380,36 @@ int FileAccessPack::get_buffer(uint8_t *p_dst, int p_length) const {
 		to_read = int64_t(pf.size) - int64_t(pos);
 	}
 
+	const uint8_t *src = data ? data + pos : nullptr;
 	pos += p_length;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (src) {
+		copymem(p_dst, src, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) {
+	if (!data || eof || pos + p_length > pf.size) {
+		return nullptr;
+	}
+
+	const uint8_t *view = data + pos;
+	pos += p_length;
+	return view;
+}
+
 void FileAccessPack::set_endian_swap(bool p_swap) {
 	FileAccess::set_endian_swap(p_swap);
-	f->set_endian_swap(p_swap);
+	if (f) {
+		f->set_endian_swap(p_swap);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -347,13 +435,21 @@ bool FileAccessPack::file_exists(const String &p_name) {
 	return false;
 }
 
-FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const uint8_t *p_mapped_pack) :
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+	off = pf.offset;
+
+	if (p_mapped_pack && !pf.encrypted) {
+		data = p_mapped_pack + pf.offset;
+		return;
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(!f, "Can't open pack-referenced file '" + String(pf.pack) + "'.");
 
 	f->seek(pf.offset);
-	off = pf.offset;
 
 	if (pf.encrypted) {
 		FileAccessEncrypted *fae = memnew(FileAccessEncrypted);
@@ -375,8 +471,6 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
 }
 
 FileAccessPack::~FileAccessPack() {
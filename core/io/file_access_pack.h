@@ -47,9 +47,15 @@ enum PackFlags {
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	PACK_FILE_COMPRESSED = 1 << 1
 };
 
+// Magic of the block-compressed stream stored for PACK_FILE_COMPRESSED files ("GCPK" in ASCII).
+#define PACK_FILE_COMPRESSED_MAGIC "GCPK"
+// Uncompressed size of each independently compressed block.
+#define PACK_COMPRESSED_BLOCK_SIZE 65536
+
 class PackSource;
 
 class PackedData {
@@ -65,6 +71,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src;
 		bool encrypted;
+		bool compressed;
 	};
 
 private:
@@ -111,7 +118,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &pkg_path, const String &path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -137,9 +144,21 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+	// Packs stay open and mapped into memory where the platform supports it, so files
+	// can be read from them without a file handle each, and viewed in place.
+	struct PackMapping {
+		FileAccess *f = nullptr;
+		const uint8_t *data = nullptr;
+		uint64_t size = 0;
+	};
+	Map<String, PackMapping> mappings;
+
+	void _map_pack(const String &p_path);
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, size_t p_offset);
 	virtual FileAccess *get_file(const String &p_path, PackedData::PackedFile *p_file);
+	virtual ~PackedSourcePCK();
 };
 
 class FileAccessPack : public FileAccess {
@@ -149,7 +168,8 @@ class FileAccessPack : public FileAccess {
 	mutable bool eof;
 	uint64_t off;
 
-	FileAccess *f;
+	FileAccess *f = nullptr;
+	const uint8_t *data = nullptr; // Start of the file in the pack mapping, used instead of f when available.
 	virtual Error _open(const String &p_path, int p_mode_flags);
 	virtual uint64_t _get_modified_time(const String &p_file) { return 0; }
 	virtual uint32_t _get_unix_permissions(const String &p_file) { return 0; }
@@ -169,6 +189,7 @@ public:
 	virtual uint8_t get_8() const;
 
 	virtual int get_buffer(uint8_t *p_dst, int p_length) const;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length);
 
 	virtual void set_endian_swap(bool p_swap);
 
@@ -181,7 +202,7 @@ public:
 
 	virtual bool file_exists(const String &p_name);
 
-	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const uint8_t *p_mapped_pack = nullptr);
 	~FileAccessPack();
 };
 
@@ -35,10 +35,21 @@
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
 #include "core/os/copymem.h"
+#include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/thread_work_pool.h"
 
 #include <stdio.h>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMAGE_SSE2_ENABLED
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define IMAGE_NEON_ENABLED
+#endif
 
 const char *Image::format_names[Image::FORMAT_MAX] = {
 	"Lum8", //luminance
@@ -462,48 +473,171 @@ int Image::get_mipmap_count() const {
 	}
 }
 
+// Large images are processed in bands of rows on a ThreadWorkPool. Small ones (icons, thumbnails)
+// stay on the calling thread, as starting the pool would cost more than the work itself.
+#define IMAGE_PARALLEL_MIN_PIXELS (512 * 512)
+#define IMAGE_PARALLEL_BAND_ROWS 32
+
+template <class F>
+struct ImageRowBandJob {
+	const F *func = nullptr;
+	uint32_t rows = 0;
+
+	void process_band(uint32_t p_band, void *p_userdata) {
+		uint32_t from = p_band * IMAGE_PARALLEL_BAND_ROWS;
+		(*func)(from, MIN(from + IMAGE_PARALLEL_BAND_ROWS, rows));
+	}
+};
+
+template <class F>
+static void _process_rows(uint32_t p_rows, uint32_t p_pixels, const F &p_func) {
+	uint32_t bands = (p_rows + IMAGE_PARALLEL_BAND_ROWS - 1) / IMAGE_PARALLEL_BAND_ROWS;
+	uint32_t thread_count = 1;
+	if (p_pixels >= IMAGE_PARALLEL_MIN_PIXELS && bands > 1 && OS::get_singleton() && OS::get_singleton()->can_use_threads()) {
+		thread_count = MIN(bands, (uint32_t)OS::get_singleton()->get_processor_count());
+	}
+
+	if (thread_count <= 1) {
+		p_func(0, p_rows);
+		return;
+	}
+
+	ImageRowBandJob<F> job;
+	job.func = &p_func;
+	job.rows = p_rows;
+
+	ThreadWorkPool work_pool;
+	work_pool.init(thread_count);
+	work_pool.do_work(bands, &job, &ImageRowBandJob<F>::process_band, (void *)nullptr);
+	work_pool.finish();
+}
+
 //using template generates perfectly optimized code due to constant expression reduction and unused variable removal present in all compilers
 template <uint32_t read_bytes, bool read_alpha, uint32_t write_bytes, bool write_alpha, bool read_gray, bool write_gray>
 static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
 	uint32_t max_bytes = MAX(read_bytes, write_bytes);
 
-	for (int y = 0; y < p_height; y++) {
-		for (int x = 0; x < p_width; x++) {
-			const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
-			uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
+	_process_rows(p_height, p_width * p_height, [&](uint32_t p_from, uint32_t p_to) {
+		for (int y = p_from; y < int(p_to); y++) {
+			for (int x = 0; x < p_width; x++) {
+				const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
+				uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
+
+				uint8_t rgba[4];
 
-			uint8_t rgba[4];
+				if (read_gray) {
+					rgba[0] = rofs[0];
+					rgba[1] = rofs[0];
+					rgba[2] = rofs[0];
+				} else {
+					for (uint32_t i = 0; i < max_bytes; i++) {
+						rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+					}
+				}
 
-			if (read_gray) {
-				rgba[0] = rofs[0];
-				rgba[1] = rofs[0];
-				rgba[2] = rofs[0];
-			} else {
-				for (uint32_t i = 0; i < max_bytes; i++) {
-					rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+				if (read_alpha || write_alpha) {
+					rgba[3] = read_alpha ? rofs[read_bytes] : 255;
 				}
-			}
 
-			if (read_alpha || write_alpha) {
-				rgba[3] = read_alpha ? rofs[read_bytes] : 255;
-			}
+				if (write_gray) {
+					//TODO: not correct grayscale, should use fixed point version of actual weights
+					wofs[0] = uint8_t((uint16_t(rofs[0]) + uint16_t(rofs[1]) + uint16_t(rofs[2])) / 3);
+				} else {
+					for (uint32_t i = 0; i < write_bytes; i++) {
+						wofs[i] = rgba[i];
+					}
+				}
 
-			if (write_gray) {
-				//TODO: not correct grayscale, should use fixed point version of actual weights
-				wofs[0] = uint8_t((uint16_t(rofs[0]) + uint16_t(rofs[1]) + uint16_t(rofs[2])) / 3);
-			} else {
-				for (uint32_t i = 0; i < write_bytes; i++) {
-					wofs[i] = rgba[i];
+				if (write_alpha) {
+					wofs[write_bytes] = rgba[3];
 				}
 			}
+		}
+	});
+}
+
+// Same results as going through get_pixel() and set_pixel(), without the per-pixel format switches.
+template <uint32_t read_channels, uint32_t write_channels>
+static void _convert_unorm8_to_float(int p_width, int p_height, const uint8_t *p_src, float *p_dst) {
+	float unorm[256];
+	for (int i = 0; i < 256; i++) {
+		unorm[i] = i / 255.0;
+	}
 
-			if (write_alpha) {
-				wofs[write_bytes] = rgba[3];
+	_process_rows(p_height, p_width * p_height, [&](uint32_t p_from, uint32_t p_to) {
+		const uint8_t *src = &p_src[p_from * p_width * read_channels];
+		float *dst = &p_dst[p_from * p_width * write_channels];
+		for (uint32_t i = (p_to - p_from) * p_width; i > 0; i--) {
+			for (uint32_t c = 0; c < write_channels; c++) {
+				dst[c] = c < read_channels ? unorm[src[c]] : (c == 3 ? 1.0f : 0.0f);
 			}
+			src += read_channels;
+			dst += write_channels;
 		}
+	});
+}
+
+template <uint32_t read_channels, uint32_t write_channels>
+static void _convert_float_to_unorm8(int p_width, int p_height, const float *p_src, uint8_t *p_dst) {
+	_process_rows(p_height, p_width * p_height, [&](uint32_t p_from, uint32_t p_to) {
+		const float *src = &p_src[p_from * p_width * read_channels];
+		uint8_t *dst = &p_dst[p_from * p_width * write_channels];
+		for (uint32_t i = (p_to - p_from) * p_width; i > 0; i--) {
+			for (uint32_t c = 0; c < write_channels; c++) {
+				float v = c < read_channels ? src[c] : (c == 3 ? 1.0f : 0.0f);
+				dst[c] = uint8_t(CLAMP(v * 255.0, 0, 255));
+			}
+			src += read_channels;
+			dst += write_channels;
+		}
+	});
+}
+
+template <uint32_t read_channels>
+static void _convert_unorm8_to_float_dispatch(int p_width, int p_height, const uint8_t *p_src, float *p_dst, uint32_t p_write_channels) {
+	switch (p_write_channels) {
+		case 1:
+			_convert_unorm8_to_float<read_channels, 1>(p_width, p_height, p_src, p_dst);
+			break;
+		case 2:
+			_convert_unorm8_to_float<read_channels, 2>(p_width, p_height, p_src, p_dst);
+			break;
+		case 3:
+			_convert_unorm8_to_float<read_channels, 3>(p_width, p_height, p_src, p_dst);
+			break;
+		case 4:
+			_convert_unorm8_to_float<read_channels, 4>(p_width, p_height, p_src, p_dst);
+			break;
 	}
 }
 
+template <uint32_t read_channels>
+static void _convert_float_to_unorm8_dispatch(int p_width, int p_height, const float *p_src, uint8_t *p_dst, uint32_t p_write_channels) {
+	switch (p_write_channels) {
+		case 1:
+			_convert_float_to_unorm8<read_channels, 1>(p_width, p_height, p_src, p_dst);
+			break;
+		case 2:
+			_convert_float_to_unorm8<read_channels, 2>(p_width, p_height, p_src, p_dst);
+			break;
+		case 3:
+			_convert_float_to_unorm8<read_channels, 3>(p_width, p_height, p_src, p_dst);
+			break;
+		case 4:
+			_convert_float_to_unorm8<read_channels, 4>(p_width, p_height, p_src, p_dst);
+			break;
+	}
+}
+
+// Channel count of the R8 to RGBA8 and RF to RGBAF formats, 0 for any other.
+static uint32_t _get_unorm8_channels(Image::Format p_format) {
+	return (p_format >= Image::FORMAT_R8 && p_format <= Image::FORMAT_RGBA8) ? uint32_t(p_format - Image::FORMAT_R8 + 1) : 0;
+}
+
+static uint32_t _get_float_channels(Image::Format p_format) {
+	return (p_format >= Image::FORMAT_RF && p_format <= Image::FORMAT_RGBAF) ? uint32_t(p_format - Image::FORMAT_RF + 1) : 0;
+}
+
 void Image::convert(Format p_new_format) {
 	if (data.size() == 0) {
 		return;
@@ -516,6 +650,56 @@ void Image::convert(Format p_new_format) {
 	if (format > FORMAT_RGBE9995 || p_new_format > FORMAT_RGBE9995) {
 		ERR_FAIL_MSG("Cannot convert to <-> from compressed formats. Use compress() and decompress() instead.");
 
+	} else if ((_get_unorm8_channels(format) && _get_float_channels(p_new_format)) || (_get_float_channels(format) && _get_unorm8_channels(p_new_format))) {
+		Image new_img(width, height, false, p_new_format);
+
+		const uint8_t *rptr = data.ptr();
+		uint8_t *wptr = new_img.data.ptrw();
+
+		if (_get_unorm8_channels(format)) {
+			uint32_t write_channels = _get_float_channels(p_new_format);
+			switch (_get_unorm8_channels(format)) {
+				case 1:
+					_convert_unorm8_to_float_dispatch<1>(width, height, rptr, reinterpret_cast<float *>(wptr), write_channels);
+					break;
+				case 2:
+					_convert_unorm8_to_float_dispatch<2>(width, height, rptr, reinterpret_cast<float *>(wptr), write_channels);
+					break;
+				case 3:
+					_convert_unorm8_to_float_dispatch<3>(width, height, rptr, reinterpret_cast<float *>(wptr), write_channels);
+					break;
+				case 4:
+					_convert_unorm8_to_float_dispatch<4>(width, height, rptr, reinterpret_cast<float *>(wptr), write_channels);
+					break;
+			}
+		} else {
+			uint32_t write_channels = _get_unorm8_channels(p_new_format);
+			switch (_get_float_channels(format)) {
+				case 1:
+					_convert_float_to_unorm8_dispatch<1>(width, height, reinterpret_cast<const float *>(rptr), wptr, write_channels);
+					break;
+				case 2:
+					_convert_float_to_unorm8_dispatch<2>(width, height, reinterpret_cast<const float *>(rptr), wptr, write_channels);
+					break;
+				case 3:
+					_convert_float_to_unorm8_dispatch<3>(width, height, reinterpret_cast<const float *>(rptr), wptr, write_channels);
+					break;
+				case 4:
+					_convert_float_to_unorm8_dispatch<4>(width, height, reinterpret_cast<const float *>(rptr), wptr, write_channels);
+					break;
+			}
+		}
+
+		bool gen_mipmaps = mipmaps;
+
+		_copy_internals_from(new_img);
+
+		if (gen_mipmaps) {
+			generate_mipmaps();
+		}
+
+		return;
+
 	} else if (format > FORMAT_RGBA8 || p_new_format > FORMAT_RGBA8) {
 		//use put/set pixel which is slower but works with non byte formats
 		Image new_img(width, height, false, p_new_format);
@@ -669,84 +853,87 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int height = p_src_height;
 	double xfac = (double)width / p_dst_width;
 	double yfac = (double)height / p_dst_height;
-	// coordinates of source points and coefficients
-	double ox, oy, dx, dy, k1, k2;
-	int ox1, oy1, ox2, oy2;
 	// destination pixel values
 	// width and height decreased by 1
 	int ymax = height - 1;
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
-		// Y coordinates
-		oy = (double)y * yfac - 0.5f;
-		oy1 = (int)oy;
-		dy = oy - (double)oy1;
+	_process_rows(p_dst_height, p_dst_width * p_dst_height, [&](uint32_t p_from, uint32_t p_to) {
+		// coordinates of source points and coefficients
+		double ox, oy, dx, dy, k1, k2;
+		int ox1, oy1, ox2, oy2;
 
-		for (uint32_t x = 0; x < p_dst_width; x++) {
-			// X coordinates
-			ox = (double)x * xfac - 0.5f;
-			ox1 = (int)ox;
-			dx = ox - (double)ox1;
+		for (uint32_t y = p_from; y < p_to; y++) {
+			// Y coordinates
+			oy = (double)y * yfac - 0.5f;
+			oy1 = (int)oy;
+			dy = oy - (double)oy1;
 
-			// initial pixel value
+			for (uint32_t x = 0; x < p_dst_width; x++) {
+				// X coordinates
+				ox = (double)x * xfac - 0.5f;
+				ox1 = (int)ox;
+				dx = ox - (double)ox1;
 
-			T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
+				// initial pixel value
 
-			double color[CC];
-			for (int i = 0; i < CC; i++) {
-				color[i] = 0;
-			}
-
-			for (int n = -1; n < 3; n++) {
-				// get Y coefficient
-				k1 = _bicubic_interp_kernel(dy - (double)n);
+				T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
 
-				oy2 = oy1 + n;
-				if (oy2 < 0) {
-					oy2 = 0;
-				}
-				if (oy2 > ymax) {
-					oy2 = ymax;
+				double color[CC];
+				for (int i = 0; i < CC; i++) {
+					color[i] = 0;
 				}
 
-				for (int m = -1; m < 3; m++) {
-					// get X coefficient
-					k2 = k1 * _bicubic_interp_kernel((double)m - dx);
+				for (int n = -1; n < 3; n++) {
+					// get Y coefficient
+					k1 = _bicubic_interp_kernel(dy - (double)n);
 
-					ox2 = ox1 + m;
-					if (ox2 < 0) {
-						ox2 = 0;
+					oy2 = oy1 + n;
+					if (oy2 < 0) {
+						oy2 = 0;
 					}
-					if (ox2 > xmax) {
-						ox2 = xmax;
+					if (oy2 > ymax) {
+						oy2 = ymax;
 					}
 
-					// get pixel of original image
-					const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+					for (int m = -1; m < 3; m++) {
+						// get X coefficient
+						k2 = k1 * _bicubic_interp_kernel((double)m - dx);
 
-					for (int i = 0; i < CC; i++) {
-						if (sizeof(T) == 2) { //half float
-							color[i] = Math::half_to_float(p[i]);
-						} else {
-							color[i] += p[i] * k2;
+						ox2 = ox1 + m;
+						if (ox2 < 0) {
+							ox2 = 0;
+						}
+						if (ox2 > xmax) {
+							ox2 = xmax;
+						}
+
+						// get pixel of original image
+						const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+
+						for (int i = 0; i < CC; i++) {
+							if (sizeof(T) == 2) { //half float
+								color[i] = Math::half_to_float(p[i]);
+							} else {
+								color[i] += p[i] * k2;
+							}
 						}
 					}
 				}
-			}
 
-			for (int i = 0; i < CC; i++) {
-				if (sizeof(T) == 1) { //byte
-					dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
-				} else if (sizeof(T) == 2) { //half float
-					dst[i] = Math::make_half_float(color[i]);
-				} else {
-					dst[i] = color[i];
+				for (int i = 0; i < CC; i++) {
+					if (sizeof(T) == 1) { //byte
+						dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
+					} else if (sizeof(T) == 2) { //half float
+						dst[i] = Math::make_half_float(color[i]);
+					} else {
+						dst[i] = color[i];
+					}
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, class T>
@@ -758,85 +945,99 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		// Add 0.5 in order to interpolate based on pixel center
-		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
-		// Calculate nearest src pixel center above current, and truncate to get y index
-		uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
-		uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
-		if (src_yofs_down >= p_src_height) {
-			src_yofs_down = p_src_height - 1;
-		}
-		// Calculate distance to pixel center of src_yofs_up
-		uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
-		src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
+	// The horizontal source offsets and weights are the same for every row.
+	Vector<uint32_t> x_ofs_table;
+	x_ofs_table.resize(p_dst_width * 3);
+	uint32_t *x_ofs_w = x_ofs_table.ptrw();
+	for (uint32_t j = 0; j < p_dst_width; j++) {
+		uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
+		uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
+		uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
+		if (src_xofs_right >= p_src_width) {
+			src_xofs_right = p_src_width - 1;
+		}
+		uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
+		src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
+
+		x_ofs_w[j * 3 + 0] = src_xofs_left * CC;
+		x_ofs_w[j * 3 + 1] = src_xofs_right * CC;
+		x_ofs_w[j * 3 + 2] = src_xofs_frac;
+	}
+	const uint32_t *x_ofs = x_ofs_table.ptr();
+
+	_process_rows(p_dst_height, p_dst_width * p_dst_height, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			// Add 0.5 in order to interpolate based on pixel center
+			uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
+			// Calculate nearest src pixel center above current, and truncate to get y index
+			uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
+			uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
+			if (src_yofs_down >= p_src_height) {
+				src_yofs_down = p_src_height - 1;
+			}
+			// Calculate distance to pixel center of src_yofs_up
+			uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
+			src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
+
+			uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
+			uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
+
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				uint32_t src_xofs_left = x_ofs[j * 3 + 0];
+				uint32_t src_xofs_right = x_ofs[j * 3 + 1];
+				uint32_t src_xofs_frac = x_ofs[j * 3 + 2];
+
+				for (uint32_t l = 0; l < CC; l++) {
+					if (sizeof(T) == 1) { //uint8
+						uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
+						uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
+
+						uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
+						interp >>= FRAC_BITS;
+						p_dst[i * p_dst_width * CC + j * CC + l] = interp;
+					} else if (sizeof(T) == 2) { //half float
 
-		uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
-		uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
+						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+						const T *src = ((const T *)p_src);
+						T *dst = ((T *)p_dst);
 
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
-			uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
-			uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
-			if (src_xofs_right >= p_src_width) {
-				src_xofs_right = p_src_width - 1;
-			}
-			uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
-			src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
+						float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
+						float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
+						float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
+						float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
 
-			src_xofs_left *= CC;
-			src_xofs_right *= CC;
+						float interp_up = p00 + (p10 - p00) * xofs_frac;
+						float interp_down = p01 + (p11 - p01) * xofs_frac;
+						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
 
-			for (uint32_t l = 0; l < CC; l++) {
-				if (sizeof(T) == 1) { //uint8
-					uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
-					uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
-
-					uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
-					interp >>= FRAC_BITS;
-					p_dst[i * p_dst_width * CC + j * CC + l] = interp;
-				} else if (sizeof(T) == 2) { //half float
-
-					float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-					float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-					const T *src = ((const T *)p_src);
-					T *dst = ((T *)p_dst);
-
-					float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
-					float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
-					float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
-					float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
-
-					float interp_up = p00 + (p10 - p00) * xofs_frac;
-					float interp_down = p01 + (p11 - p01) * xofs_frac;
-					float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
-
-					dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
-				} else if (sizeof(T) == 4) { //float
-
-					float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-					float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-					const T *src = ((const T *)p_src);
-					T *dst = ((T *)p_dst);
-
-					float p00 = src[y_ofs_up + src_xofs_left + l];
-					float p10 = src[y_ofs_up + src_xofs_right + l];
-					float p01 = src[y_ofs_down + src_xofs_left + l];
-					float p11 = src[y_ofs_down + src_xofs_right + l];
-
-					float interp_up = p00 + (p10 - p00) * xofs_frac;
-					float interp_down = p01 + (p11 - p01) * xofs_frac;
-					float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
-
-					dst[i * p_dst_width * CC + j * CC + l] = interp;
+						dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
+					} else if (sizeof(T) == 4) { //float
+
+						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+						const T *src = ((const T *)p_src);
+						T *dst = ((T *)p_dst);
+
+						float p00 = src[y_ofs_up + src_xofs_left + l];
+						float p10 = src[y_ofs_up + src_xofs_right + l];
+						float p01 = src[y_ofs_down + src_xofs_left + l];
+						float p11 = src[y_ofs_down + src_xofs_right + l];
+
+						float interp_up = p00 + (p10 - p00) * xofs_frac;
+						float interp_down = p01 + (p11 - p01) * xofs_frac;
+						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+
+						dst[i * p_dst_width * CC + j * CC + l] = interp;
+					}
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, class T>
@@ -1486,6 +1687,60 @@ bool Image::_can_modify(Format p_format) const {
 	return p_format <= FORMAT_RGBE9995;
 }
 
+// Averages 2x2 blocks of the p_up and p_down RGBA8 rows into p_dst, returns how many destination pixels were done.
+// Rounds like average_4_uint8().
+static uint32_t _average_rgba8_rows(const uint8_t *p_up, const uint8_t *p_down, uint8_t *p_dst, uint32_t p_dst_width) {
+	uint32_t x = 0;
+#if defined(IMAGE_SSE2_ENABLED)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i two = _mm_set1_epi16(2);
+	for (; x + 2 <= p_dst_width; x += 2) {
+		__m128i up = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_up + x * 8));
+		__m128i down = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_down + x * 8));
+		// Vertical sums of source columns 0, 1 and 2, 3.
+		__m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(up, zero), _mm_unpacklo_epi8(down, zero));
+		__m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(up, zero), _mm_unpackhi_epi8(down, zero));
+		__m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+		sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(p_dst + x * 4), _mm_packus_epi16(sum, zero));
+	}
+#elif defined(IMAGE_NEON_ENABLED)
+	for (; x + 2 <= p_dst_width; x += 2) {
+		uint8x16_t up = vld1q_u8(p_up + x * 8);
+		uint8x16_t down = vld1q_u8(p_down + x * 8);
+		uint16x8_t lo = vaddl_u8(vget_low_u8(up), vget_low_u8(down));
+		uint16x8_t hi = vaddl_u8(vget_high_u8(up), vget_high_u8(down));
+		uint16x8_t sum = vaddq_u16(vcombine_u16(vget_low_u16(lo), vget_low_u16(hi)), vcombine_u16(vget_high_u16(lo), vget_high_u16(hi)));
+		vst1_u8(p_dst + x * 4, vrshrn_n_u16(sum, 2));
+	}
+#endif
+	return x;
+}
+
+// Averages 2x2 blocks of the p_up and p_down RGBAF rows into p_dst, returns how many destination pixels were done.
+// Adds in the same order as average_4_float().
+static uint32_t _average_rgbaf_rows(const float *p_up, const float *p_down, float *p_dst, uint32_t p_dst_width) {
+	uint32_t x = 0;
+#if defined(IMAGE_SSE2_ENABLED)
+	const __m128 quarter = _mm_set1_ps(0.25f);
+	for (; x < p_dst_width; x++) {
+		__m128 sum = _mm_add_ps(_mm_loadu_ps(p_up + x * 8), _mm_loadu_ps(p_up + x * 8 + 4));
+		sum = _mm_add_ps(sum, _mm_loadu_ps(p_down + x * 8));
+		sum = _mm_add_ps(sum, _mm_loadu_ps(p_down + x * 8 + 4));
+		_mm_storeu_ps(p_dst + x * 4, _mm_mul_ps(sum, quarter));
+	}
+#elif defined(IMAGE_NEON_ENABLED)
+	const float32x4_t quarter = vdupq_n_f32(0.25f);
+	for (; x < p_dst_width; x++) {
+		float32x4_t sum = vaddq_f32(vld1q_f32(p_up + x * 8), vld1q_f32(p_up + x * 8 + 4));
+		sum = vaddq_f32(sum, vld1q_f32(p_down + x * 8));
+		sum = vaddq_f32(sum, vld1q_f32(p_down + x * 8 + 4));
+		vst1q_f32(p_dst + x * 4, vmulq_f32(sum, quarter));
+	}
+#endif
+	return x;
+}
+
 template <class Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
@@ -1497,27 +1752,45 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
-		const Component *rup_ptr = &p_src[i * 2 * down_step];
-		const Component *rdown_ptr = rup_ptr + down_step;
-		Component *dst_ptr = &p_dst[i * dst_w * CC];
-		uint32_t count = dst_w;
+	// The vectorized rows need both neighbors of every source pixel.
+	bool simd_rows = CC == 4 && !renormalize && p_width > 1 && p_height > 1 && (std::is_same<Component, uint8_t>::value || std::is_same<Component, float>::value);
 
-		while (count) {
-			count--;
-			for (int j = 0; j < CC; j++) {
-				average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
-			}
+	_process_rows(dst_h, dst_w * dst_h, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			const Component *rup_ptr = &p_src[i * 2 * down_step];
+			const Component *rdown_ptr = rup_ptr + down_step;
+			Component *dst_ptr = &p_dst[i * dst_w * CC];
+			uint32_t count = dst_w;
 
-			if (renormalize) {
-				renormalize_func(dst_ptr);
+			if (simd_rows) {
+				uint32_t done;
+				if (sizeof(Component) == 1) {
+					done = _average_rgba8_rows(reinterpret_cast<const uint8_t *>(rup_ptr), reinterpret_cast<const uint8_t *>(rdown_ptr), reinterpret_cast<uint8_t *>(dst_ptr), dst_w);
+				} else {
+					done = _average_rgbaf_rows(reinterpret_cast<const float *>(rup_ptr), reinterpret_cast<const float *>(rdown_ptr), reinterpret_cast<float *>(dst_ptr), dst_w);
+				}
+				count -= done;
+				dst_ptr += done * CC;
+				rup_ptr += done * right_step * 2;
+				rdown_ptr += done * right_step * 2;
 			}
 
-			dst_ptr += CC;
-			rup_ptr += right_step * 2;
-			rdown_ptr += right_step * 2;
+			while (count) {
+				count--;
+				for (int j = 0; j < CC; j++) {
+					average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+				}
+
+				if (renormalize) {
+					renormalize_func(dst_ptr);
+				}
+
+				dst_ptr += CC;
+				rup_ptr += right_step * 2;
+				rdown_ptr += right_step * 2;
+			}
 		}
-	}
+	});
 }
 
 void Image::shrink_x2() {
@@ -2720,11 +2993,11 @@ void (*Image::_image_decompress_etc1)(Image *) = nullptr;
 void (*Image::_image_decompress_etc2)(Image *) = nullptr;
 
 Vector<uint8_t> (*Image::lossy_packer)(const Ref<Image> &, float) = nullptr;
-Ref<Image> (*Image::lossy_unpacker)(const Vector<uint8_t> &) = nullptr;
+Ref<Image> (*Image::lossy_unpacker)(const uint8_t *, int) = nullptr;
 Vector<uint8_t> (*Image::lossless_packer)(const Ref<Image> &) = nullptr;
-Ref<Image> (*Image::lossless_unpacker)(const Vector<uint8_t> &) = nullptr;
+Ref<Image> (*Image::lossless_unpacker)(const uint8_t *, int) = nullptr;
 Vector<uint8_t> (*Image::basis_universal_packer)(const Ref<Image> &, Image::UsedChannels) = nullptr;
-Ref<Image> (*Image::basis_universal_unpacker)(const Vector<uint8_t> &) = nullptr;
+Ref<Image> (*Image::basis_universal_unpacker)(const uint8_t *, int) = nullptr;
 
 void Image::_set_data(const Dictionary &p_data) {
 	ERR_FAIL_COND(!p_data.has("width"));
@@ -149,11 +149,11 @@ public:
 	static void (*_image_decompress_etc2)(Image *);
 
 	static Vector<uint8_t> (*lossy_packer)(const Ref<Image> &p_image, float p_quality);
-	static Ref<Image> (*lossy_unpacker)(const Vector<uint8_t> &p_buffer);
+	static Ref<Image> (*lossy_unpacker)(const uint8_t *p_buffer, int p_size);
 	static Vector<uint8_t> (*lossless_packer)(const Ref<Image> &p_image);
-	static Ref<Image> (*lossless_unpacker)(const Vector<uint8_t> &p_buffer);
+	static Ref<Image> (*lossless_unpacker)(const uint8_t *p_buffer, int p_size);
 	static Vector<uint8_t> (*basis_universal_packer)(const Ref<Image> &p_image, UsedChannels p_channels);
-	static Ref<Image> (*basis_universal_unpacker)(const Vector<uint8_t> &p_buffer);
+	static Ref<Image> (*basis_universal_unpacker)(const uint8_t *p_buffer, int p_size);
 
 	_FORCE_INLINE_ Color _get_color_at_ofs(const uint8_t *ptr, uint32_t ofs) const;
 	_FORCE_INLINE_ void _set_color_at_ofs(uint8_t *ptr, uint32_t ofs, const Color &p_color);
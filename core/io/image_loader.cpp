@@ -30,7 +30,9 @@
 
 #include "image_loader.h"
 
+#include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/thread_work_pool.h"
 
 bool ImageFormatLoader::recognize(const String &p_extension) const {
 	List<String> extensions;
@@ -84,6 +86,55 @@ Error ImageLoader::load_image(String p_file, Ref<Image> p_image, FileAccess *p_c
 	return ERR_FILE_UNRECOGNIZED;
 }
 
+struct ImageLoadJob {
+	const String *files = nullptr;
+	Ref<Image> *images = nullptr;
+	Error *errors = nullptr;
+	bool force_linear = false;
+	float scale = 1.0;
+
+	void load(uint32_t p_index, void *p_userdata) {
+		Ref<Image> image;
+		image.instance();
+		errors[p_index] = ImageLoader::load_image(files[p_index], image, nullptr, force_linear, scale);
+		if (errors[p_index] == OK) {
+			images[p_index] = image;
+		}
+	}
+};
+
+Vector<Ref<Image>> ImageLoader::load_images(const Vector<String> &p_files, Vector<Error> *r_errors, bool p_force_linear, float p_scale) {
+	Vector<Ref<Image>> images;
+	Vector<Error> errors;
+	images.resize(p_files.size());
+	errors.resize(p_files.size());
+
+	ImageLoadJob job;
+	job.files = p_files.ptr();
+	job.images = images.ptrw();
+	job.errors = errors.ptrw();
+	job.force_linear = p_force_linear;
+	job.scale = p_scale;
+
+	const uint32_t file_count = p_files.size();
+	const uint32_t thread_count = OS::get_singleton()->can_use_threads() ? MIN(file_count, (uint32_t)OS::get_singleton()->get_processor_count()) : 1;
+	if (thread_count > 1) {
+		ThreadWorkPool work_pool;
+		work_pool.init(thread_count);
+		work_pool.do_work(file_count, &job, &ImageLoadJob::load, (void *)nullptr);
+		work_pool.finish();
+	} else {
+		for (uint32_t i = 0; i < file_count; i++) {
+			job.load(i, nullptr);
+		}
+	}
+
+	if (r_errors) {
+		*r_errors = errors;
+	}
+	return images;
+}
+
 void ImageLoader::get_recognized_extensions(List<String> *p_extensions) {
 	for (int i = 0; i < loader.size(); i++) {
 		loader[i]->get_recognized_extensions(p_extensions);
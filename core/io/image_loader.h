@@ -59,6 +59,8 @@ class ImageLoader {
 protected:
 public:
 	static Error load_image(String p_file, Ref<Image> p_image, FileAccess *p_custom = nullptr, bool p_force_linear = false, float p_scale = 1.0);
+	// Decodes the files concurrently. Files that fail to load get a null image, and their error in r_errors.
+	static Vector<Ref<Image>> load_images(const Vector<String> &p_files, Vector<Error> *r_errors = nullptr, bool p_force_linear = false, float p_scale = 1.0);
 	static void get_recognized_extensions(List<String> *p_extensions);
 	static ImageFormatLoader *recognize(const String &p_extension);
 
@@ -31,70 +31,115 @@
 #include "json.h"
 
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/variant_internal.h"
 
-const char *JSON::tk_name[TK_MAX] = {
-	"'{'",
-	"'}'",
-	"'['",
-	"']'",
-	"identifier",
-	"string",
-	"number",
-	"':'",
-	"','",
-	"EOF",
-};
+static void _append(LocalVector<char32_t> &r_buffer, const char *p_ascii) {
+	while (*p_ascii) {
+		r_buffer.push_back(*p_ascii);
+		p_ascii++;
+	}
+}
+
+static void _append(LocalVector<char32_t> &r_buffer, const String &p_string) {
+	uint32_t from = r_buffer.size();
+	r_buffer.resize(from + p_string.length());
+	memcpy(r_buffer.ptr() + from, p_string.ptr(), p_string.length() * sizeof(char32_t));
+}
 
-static String _make_indent(const String &p_indent, int p_size) {
-	String indent_text = "";
+static void _append_indent(LocalVector<char32_t> &r_buffer, const String &p_indent, int p_size) {
 	if (!p_indent.is_empty()) {
 		for (int i = 0; i < p_size; i++) {
-			indent_text += p_indent;
+			_append(r_buffer, p_indent);
 		}
 	}
-	return indent_text;
 }
 
-String JSON::_print_var(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys) {
-	String colon = ":";
-	String end_statement = "";
-
-	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+static void _append_escaped(LocalVector<char32_t> &r_buffer, const String &p_string) {
+	r_buffer.push_back('"');
+	const char32_t *c = p_string.ptr();
+	for (int i = 0; i < p_string.length(); i++) {
+		switch (c[i]) {
+			case '\\':
+				_append(r_buffer, "\\\\");
+				break;
+			case '\b':
+				_append(r_buffer, "\\b");
+				break;
+			case '\f':
+				_append(r_buffer, "\\f");
+				break;
+			case '\n':
+				_append(r_buffer, "\\n");
+				break;
+			case '\r':
+				_append(r_buffer, "\\r");
+				break;
+			case '\t':
+				_append(r_buffer, "\\t");
+				break;
+			case '\v':
+				_append(r_buffer, "\\v");
+				break;
+			case '"':
+				_append(r_buffer, "\\\"");
+				break;
+			default:
+				r_buffer.push_back(c[i]);
+		}
 	}
+	r_buffer.push_back('"');
+}
+
+// Everything is appended to a single buffer, instead of building a string per value.
+static void _print_var(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, LocalVector<char32_t> &r_buffer) {
+	bool pretty = !p_indent.is_empty();
 
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			_append(r_buffer, "null");
+			break;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			_append(r_buffer, p_var.operator bool() ? "true" : "false");
+			break;
 		case Variant::INT:
-			return itos(p_var);
+			_append(r_buffer, itos(p_var));
+			break;
 		case Variant::FLOAT:
-			return rtos(p_var);
+			_append(r_buffer, rtos(p_var));
+			break;
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
 		case Variant::PACKED_FLOAT32_ARRAY:
 		case Variant::PACKED_FLOAT64_ARRAY:
 		case Variant::PACKED_STRING_ARRAY:
 		case Variant::ARRAY: {
-			String s = "[";
-			s += end_statement;
+			r_buffer.push_back('[');
+			if (pretty) {
+				r_buffer.push_back('\n');
+			}
 			Array a = p_var;
 			for (int i = 0; i < a.size(); i++) {
 				if (i > 0) {
-					s += ",";
-					s += end_statement;
+					r_buffer.push_back(',');
+					if (pretty) {
+						r_buffer.push_back('\n');
+					}
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _print_var(a[i], p_indent, p_cur_indent + 1, p_sort_keys);
+				_append_indent(r_buffer, p_indent, p_cur_indent + 1);
+				_print_var(a[i], p_indent, p_cur_indent + 1, p_sort_keys, r_buffer);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
-			return s;
-		}
+			if (pretty) {
+				r_buffer.push_back('\n');
+			}
+			_append_indent(r_buffer, p_indent, p_cur_indent);
+			r_buffer.push_back(']');
+		} break;
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
+			r_buffer.push_back('{');
+			if (pretty) {
+				r_buffer.push_back('\n');
+			}
 			Dictionary d = p_var;
 			List<Variant> keys;
 			d.get_key_list(&keys);
@@ -105,296 +150,480 @@ String JSON::_print_var(const Variant &p_var, const String &p_indent, int p_cur_
 
 			for (List<Variant>::Element *E = keys.front(); E; E = E->next()) {
 				if (E != keys.front()) {
-					s += ",";
-					s += end_statement;
+					r_buffer.push_back(',');
+					if (pretty) {
+						r_buffer.push_back('\n');
+					}
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _print_var(String(E->get()), p_indent, p_cur_indent + 1, p_sort_keys);
-				s += colon;
-				s += _print_var(d[E->get()], p_indent, p_cur_indent + 1, p_sort_keys);
+				_append_indent(r_buffer, p_indent, p_cur_indent + 1);
+				_append_escaped(r_buffer, String(E->get()));
+				r_buffer.push_back(':');
+				if (pretty) {
+					r_buffer.push_back(' ');
+				}
+				_print_var(d[E->get()], p_indent, p_cur_indent + 1, p_sort_keys, r_buffer);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
-			return s;
-		}
+			if (pretty) {
+				r_buffer.push_back('\n');
+			}
+			_append_indent(r_buffer, p_indent, p_cur_indent);
+			r_buffer.push_back('}');
+		} break;
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			_append_escaped(r_buffer, String(p_var));
 	}
 }
 
 String JSON::print(const Variant &p_var, const String &p_indent, bool p_sort_keys) {
-	return _print_var(p_var, p_indent, 0, p_sort_keys);
+	LocalVector<char32_t> buffer;
+	_print_var(p_var, p_indent, 0, p_sort_keys, buffer);
+	return String(buffer.ptr(), buffer.size());
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
-	while (p_len > 0) {
-		switch (p_str[index]) {
-			case '\n': {
-				line++;
-				index++;
-				break;
-			}
-			case 0: {
-				r_token.type = TK_EOF;
-				return OK;
-			} break;
-			case '{': {
-				r_token.type = TK_CURLY_BRACKET_OPEN;
-				index++;
-				return OK;
-			}
-			case '}': {
-				r_token.type = TK_CURLY_BRACKET_CLOSE;
-				index++;
-				return OK;
+#define ONES_64 0x0101010101010101ULL
+
+// Non-zero if any byte of the word equals p_byte.
+static _FORCE_INLINE_ uint64_t _has_byte(uint64_t p_word, uint8_t p_byte) {
+	uint64_t x = p_word ^ (ONES_64 * p_byte);
+	return (x - ONES_64) & ~x & (ONES_64 * 0x80);
+}
+
+// Finds the first byte that ends a plain run of string characters (a quote, backslash, newline
+// or terminator), eight bytes at a time.
+static _FORCE_INLINE_ const uint8_t *_find_string_stop(const uint8_t *p_from, const uint8_t *p_end) {
+	const uint8_t *c = p_from;
+	while (p_end - c >= 8) {
+		uint64_t word;
+		memcpy(&word, c, 8);
+		if (_has_byte(word, '"') | _has_byte(word, '\\') | _has_byte(word, '\n') | _has_byte(word, 0)) {
+			break;
+		}
+		c += 8;
+	}
+	while (c < p_end && *c != '"' && *c != '\\' && *c != '\n' && *c != 0) {
+		c++;
+	}
+	return c;
+}
+
+static bool _parse_hex4(const uint8_t *p_from, uint32_t &r_value) {
+	r_value = 0;
+	for (int i = 0; i < 4; i++) {
+		uint8_t c = p_from[i];
+		uint32_t v;
+		if (c >= '0' && c <= '9') {
+			v = c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			v = c - 'a' + 10;
+		} else if (c >= 'A' && c <= 'F') {
+			v = c - 'A' + 10;
+		} else {
+			return false;
+		}
+		r_value = (r_value << 4) | v;
+	}
+	return true;
+}
+
+static _FORCE_INLINE_ bool _is_digit(uint8_t p_c) {
+	return p_c >= '0' && p_c <= '9';
+}
+
+static _FORCE_INLINE_ bool _is_letter(uint8_t p_c) {
+	return (p_c >= 'A' && p_c <= 'Z') || (p_c >= 'a' && p_c <= 'z');
+}
+
+// Reads UTF-8 directly from the source bytes and reports the contents to a handler.
+// Strings are decoded once their extent is known, and numbers without a fraction or exponent
+// are read without going through strtod.
+template <class H>
+class JSONReader {
+	enum TokenType {
+		TK_CURLY_BRACKET_OPEN,
+		TK_CURLY_BRACKET_CLOSE,
+		TK_BRACKET_OPEN,
+		TK_BRACKET_CLOSE,
+		TK_IDENTIFIER,
+		TK_STRING,
+		TK_NUMBER,
+		TK_COLON,
+		TK_COMMA,
+		TK_EOF,
+		TK_MAX
+	};
+
+	struct Token {
+		TokenType type = TK_EOF;
+		String string;
+		double number = 0.0;
+		const uint8_t *identifier = nullptr;
+		int identifier_length = 0;
+	};
+
+	const uint8_t *pos = nullptr;
+	const uint8_t *end = nullptr;
+	H &handler;
+	int &line;
+	String &err_str;
+
+	LocalVector<char> unescaped;
+
+	Error _stopped() {
+		err_str = "Parsing stopped by the handler.";
+		return ERR_SKIP;
+	}
+
+	void _append_unescaped(const uint8_t *p_from, const uint8_t *p_to) {
+		uint32_t from = unescaped.size();
+		unescaped.resize(from + (p_to - p_from));
+		memcpy(unescaped.ptr() + from, p_from, p_to - p_from);
+	}
+
+	void _append_unescaped(uint32_t p_char) {
+		if (p_char < 0x80) {
+			unescaped.push_back(p_char);
+		} else if (p_char < 0x800) {
+			unescaped.push_back(0xc0 | (p_char >> 6));
+			unescaped.push_back(0x80 | (p_char & 0x3f));
+		} else if (p_char < 0x10000) {
+			unescaped.push_back(0xe0 | (p_char >> 12));
+			unescaped.push_back(0x80 | ((p_char >> 6) & 0x3f));
+			unescaped.push_back(0x80 | (p_char & 0x3f));
+		} else {
+			unescaped.push_back(0xf0 | (p_char >> 18));
+			unescaped.push_back(0x80 | ((p_char >> 12) & 0x3f));
+			unescaped.push_back(0x80 | ((p_char >> 6) & 0x3f));
+			unescaped.push_back(0x80 | (p_char & 0x3f));
+		}
+	}
+
+	Error _read_string(String &r_string) {
+		const uint8_t *from = pos; // Bytes from here on haven't been copied to unescaped yet.
+		bool has_escapes = false;
+
+		while (true) {
+			const uint8_t *c = _find_string_stop(pos, end);
+			if (c == end || *c == 0) {
+				err_str = "Unterminated String";
+				return ERR_PARSE_ERROR;
 			}
-			case '[': {
-				r_token.type = TK_BRACKET_OPEN;
-				index++;
-				return OK;
+
+			if (*c == '\n') {
+				line++;
+				pos = c + 1;
+				continue;
 			}
-			case ']': {
-				r_token.type = TK_BRACKET_CLOSE;
-				index++;
+
+			if (*c == '"') {
+				if (has_escapes) {
+					_append_unescaped(from, c);
+					r_string.parse_utf8(unescaped.ptr(), unescaped.size());
+				} else {
+					r_string.parse_utf8((const char *)from, c - from);
+				}
+				pos = c + 1;
 				return OK;
 			}
-			case ':': {
-				r_token.type = TK_COLON;
-				index++;
-				return OK;
+
+			//escaped characters...
+			if (!has_escapes) {
+				unescaped.clear();
+				has_escapes = true;
 			}
-			case ',': {
-				r_token.type = TK_COMMA;
-				index++;
-				return OK;
+			_append_unescaped(from, c);
+			c++;
+			if (c == end || *c == 0) {
+				err_str = "Unterminated String";
+				return ERR_PARSE_ERROR;
 			}
-			case '"': {
-				index++;
-				String str;
-				while (true) {
-					if (p_str[index] == 0) {
-						r_err_str = "Unterminated String";
-						return ERR_PARSE_ERROR;
-					} else if (p_str[index] == '"') {
-						index++;
-						break;
-					} else if (p_str[index] == '\\') {
-						//escaped characters...
-						index++;
-						char32_t next = p_str[index];
-						if (next == 0) {
-							r_err_str = "Unterminated String";
-							return ERR_PARSE_ERROR;
-						}
-						char32_t res = 0;
-
-						switch (next) {
-							case 'b':
-								res = 8;
-								break;
-							case 't':
-								res = 9;
-								break;
-							case 'n':
-								res = 10;
-								break;
-							case 'f':
-								res = 12;
-								break;
-							case 'r':
-								res = 13;
-								break;
-							case 'u': {
-								// hex number
-								for (int j = 0; j < 4; j++) {
-									char32_t c = p_str[index + j + 1];
-									if (c == 0) {
-										r_err_str = "Unterminated String";
-										return ERR_PARSE_ERROR;
-									}
-									if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
-										r_err_str = "Malformed hex constant in string";
-										return ERR_PARSE_ERROR;
-									}
-									char32_t v;
-									if (c >= '0' && c <= '9') {
-										v = c - '0';
-									} else if (c >= 'a' && c <= 'f') {
-										v = c - 'a';
-										v += 10;
-									} else if (c >= 'A' && c <= 'F') {
-										v = c - 'A';
-										v += 10;
-									} else {
-										ERR_PRINT("Bug parsing hex constant.");
-										v = 0;
-									}
-
-									res <<= 4;
-									res |= v;
-								}
-								index += 4; //will add at the end anyway
-
-							} break;
-							default: {
-								res = next;
-							} break;
-						}
-
-						str += res;
 
-					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+			switch (*c) {
+				case 'b':
+					unescaped.push_back(8);
+					break;
+				case 't':
+					unescaped.push_back(9);
+					break;
+				case 'n':
+					unescaped.push_back(10);
+					break;
+				case 'f':
+					unescaped.push_back(12);
+					break;
+				case 'r':
+					unescaped.push_back(13);
+					break;
+				case 'u': {
+					uint32_t res;
+					if (end - c <= 4) {
+						err_str = "Unterminated String";
+						return ERR_PARSE_ERROR;
 					}
-					index++;
-				}
+					if (!_parse_hex4(c + 1, res)) {
+						err_str = "Malformed hex constant in string";
+						return ERR_PARSE_ERROR;
+					}
+					c += 4;
 
-				r_token.type = TK_STRING;
-				r_token.value = str;
-				return OK;
+					// Characters outside the BMP are escaped as a surrogate pair.
+					uint32_t low;
+					if (res >= 0xd800 && res <= 0xdbff && end - c > 6 && c[1] == '\\' && c[2] == 'u' && _parse_hex4(c + 3, low) && low >= 0xdc00 && low <= 0xdfff) {
+						res = 0x10000 + ((res - 0xd800) << 10) + (low - 0xdc00);
+						c += 6;
+					}
+					_append_unescaped(res);
+				} break;
+				default: {
+					unescaped.push_back(*c);
+				} break;
+			}
 
-			} break;
-			default: {
-				if (p_str[index] <= 32) {
-					index++;
-					break;
-				}
+			from = pos = c + 1;
+		}
+	}
 
-				if (p_str[index] == '-' || (p_str[index] >= '0' && p_str[index] <= '9')) {
-					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
-					r_token.type = TK_NUMBER;
-					r_token.value = number;
-					return OK;
+	double _read_number() {
+		const uint8_t *from = pos;
+		const uint8_t *c = pos;
+		bool negative = *c == '-';
+		if (negative) {
+			c++;
+		}
 
-				} else if ((p_str[index] >= 'A' && p_str[index] <= 'Z') || (p_str[index] >= 'a' && p_str[index] <= 'z')) {
-					String id;
+		uint64_t mantissa = 0;
+		int digits = 0;
+		while (c < end && _is_digit(*c)) {
+			mantissa = mantissa * 10 + (*c - '0');
+			digits++;
+			c++;
+		}
 
-					while ((p_str[index] >= 'A' && p_str[index] <= 'Z') || (p_str[index] >= 'a' && p_str[index] <= 'z')) {
-						id += p_str[index];
-						index++;
-					}
+		// Up to 15 digits are exact in a double.
+		if (digits > 0 && digits <= 15 && (c == end || (*c != '.' && *c != 'e' && *c != 'E'))) {
+			pos = c;
+			return negative ? -double(mantissa) : double(mantissa);
+		}
 
-					r_token.type = TK_IDENTIFIER;
-					r_token.value = id;
-					return OK;
-				} else {
-					r_err_str = "Unexpected character.";
-					return ERR_PARSE_ERROR;
-				}
+		if (c < end && *c == '.') {
+			c++;
+			while (c < end && _is_digit(*c)) {
+				c++;
+			}
+		}
+		if (c < end && (*c == 'e' || *c == 'E')) {
+			c++;
+			if (c < end && (*c == '+' || *c == '-')) {
+				c++;
+			}
+			while (c < end && _is_digit(*c)) {
+				c++;
 			}
 		}
+		pos = c;
+
+		CharString number;
+		number.resize(c - from + 1);
+		memcpy(number.ptrw(), from, c - from);
+		number.ptrw()[c - from] = 0;
+		return String::to_float(number.get_data());
 	}
 
-	return ERR_PARSE_ERROR;
-}
+	Error _get_token(Token &r_token) {
+		while (pos < end) {
+			switch (*pos) {
+				case '\n': {
+					line++;
+					pos++;
+					break;
+				}
+				case 0: {
+					r_token.type = TK_EOF;
+					return OK;
+				} break;
+				case '{': {
+					r_token.type = TK_CURLY_BRACKET_OPEN;
+					pos++;
+					return OK;
+				}
+				case '}': {
+					r_token.type = TK_CURLY_BRACKET_CLOSE;
+					pos++;
+					return OK;
+				}
+				case '[': {
+					r_token.type = TK_BRACKET_OPEN;
+					pos++;
+					return OK;
+				}
+				case ']': {
+					r_token.type = TK_BRACKET_CLOSE;
+					pos++;
+					return OK;
+				}
+				case ':': {
+					r_token.type = TK_COLON;
+					pos++;
+					return OK;
+				}
+				case ',': {
+					r_token.type = TK_COMMA;
+					pos++;
+					return OK;
+				}
+				case '"': {
+					pos++;
+					r_token.type = TK_STRING;
+					return _read_string(r_token.string);
+				} break;
+				default: {
+					if (*pos <= 32) {
+						pos++;
+						break;
+					}
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str) {
-	if (token.type == TK_CURLY_BRACKET_OPEN) {
-		Dictionary d;
-		Error err = _parse_object(d, p_str, index, p_len, line, r_err_str);
-		if (err) {
-			return err;
-		}
-		value = d;
-		return OK;
-	} else if (token.type == TK_BRACKET_OPEN) {
-		Array a;
-		Error err = _parse_array(a, p_str, index, p_len, line, r_err_str);
-		if (err) {
-			return err;
-		}
-		value = a;
-		return OK;
+					if (*pos == '-' || _is_digit(*pos)) {
+						r_token.type = TK_NUMBER;
+						r_token.number = _read_number();
+						return OK;
 
-	} else if (token.type == TK_IDENTIFIER) {
-		String id = token.value;
-		if (id == "true") {
-			value = true;
-		} else if (id == "false") {
-			value = false;
-		} else if (id == "null") {
-			value = Variant();
-		} else {
-			r_err_str = "Expected 'true','false' or 'null', got '" + id + "'.";
-			return ERR_PARSE_ERROR;
+					} else if (_is_letter(*pos)) {
+						r_token.type = TK_IDENTIFIER;
+						r_token.identifier = pos;
+						while (pos < end && _is_letter(*pos)) {
+							pos++;
+						}
+						r_token.identifier_length = pos - r_token.identifier;
+						return OK;
+					} else {
+						err_str = "Unexpected character.";
+						return ERR_PARSE_ERROR;
+					}
+				}
+			}
 		}
-		return OK;
 
-	} else if (token.type == TK_NUMBER) {
-		value = token.value;
-		return OK;
-	} else if (token.type == TK_STRING) {
-		value = token.value;
+		r_token.type = TK_EOF;
 		return OK;
-	} else {
-		r_err_str = "Expected value, got " + String(tk_name[token.type]) + ".";
-		return ERR_PARSE_ERROR;
 	}
-}
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str) {
-	Token token;
-	bool need_comma = false;
+	bool _is_identifier(const Token &p_token, const char *p_name, int p_length) {
+		return p_token.identifier_length == p_length && memcmp(p_token.identifier, p_name, p_length) == 0;
+	}
 
-	while (index < p_len) {
-		Error err = _get_token(p_str, index, p_len, token, line, r_err_str);
-		if (err != OK) {
-			return err;
+	Error _parse_value(Token &token) {
+		switch (token.type) {
+			case TK_CURLY_BRACKET_OPEN: {
+				return _parse_object();
+			}
+			case TK_BRACKET_OPEN: {
+				return _parse_array();
+			}
+			case TK_IDENTIFIER: {
+				Variant value;
+				if (_is_identifier(token, "true", 4)) {
+					value = true;
+				} else if (_is_identifier(token, "false", 5)) {
+					value = false;
+				} else if (!_is_identifier(token, "null", 4)) {
+					err_str = "Expected 'true','false' or 'null', got '" + String::utf8((const char *)token.identifier, token.identifier_length) + "'.";
+					return ERR_PARSE_ERROR;
+				}
+				return handler.value(value) ? OK : _stopped();
+			}
+			case TK_NUMBER: {
+				return handler.value(token.number) ? OK : _stopped();
+			}
+			case TK_STRING: {
+				return handler.value(token.string) ? OK : _stopped();
+			}
+			default: {
+				static const char *tk_name[TK_MAX] = {
+					"'{'",
+					"'}'",
+					"'['",
+					"']'",
+					"identifier",
+					"string",
+					"number",
+					"':'",
+					"','",
+					"EOF",
+				};
+				err_str = "Expected value, got " + String(tk_name[token.type]) + ".";
+				return ERR_PARSE_ERROR;
+			}
 		}
+	}
 
-		if (token.type == TK_BRACKET_CLOSE) {
-			return OK;
+	Error _parse_array() {
+		if (!handler.begin_array()) {
+			return _stopped();
 		}
 
-		if (need_comma) {
-			if (token.type != TK_COMMA) {
-				r_err_str = "Expected ','";
+		Token token;
+		bool need_comma = false;
+
+		while (true) {
+			Error err = _get_token(token);
+			if (err != OK) {
+				return err;
+			}
+
+			if (token.type == TK_EOF) {
+				err_str = "Expected ']'";
 				return ERR_PARSE_ERROR;
-			} else {
-				need_comma = false;
-				continue;
 			}
-		}
 
-		Variant v;
-		err = _parse_value(v, token, p_str, index, p_len, line, r_err_str);
-		if (err) {
-			return err;
-		}
+			if (token.type == TK_BRACKET_CLOSE) {
+				return handler.end_array() ? OK : _stopped();
+			}
 
-		array.push_back(v);
-		need_comma = true;
+			if (need_comma) {
+				if (token.type != TK_COMMA) {
+					err_str = "Expected ','";
+					return ERR_PARSE_ERROR;
+				} else {
+					need_comma = false;
+					continue;
+				}
+			}
+
+			err = _parse_value(token);
+			if (err) {
+				return err;
+			}
+
+			need_comma = true;
+		}
 	}
 
-	r_err_str = "Expected ']'";
-	return ERR_PARSE_ERROR;
-}
+	Error _parse_object() {
+		if (!handler.begin_object()) {
+			return _stopped();
+		}
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str) {
-	bool at_key = true;
-	String key;
-	Token token;
-	bool need_comma = false;
+		Token token;
+		bool need_comma = false;
 
-	while (index < p_len) {
-		if (at_key) {
-			Error err = _get_token(p_str, index, p_len, token, line, r_err_str);
+		while (true) {
+			Error err = _get_token(token);
 			if (err != OK) {
 				return err;
 			}
 
+			if (token.type == TK_EOF) {
+				err_str = "Expected '}'";
+				return ERR_PARSE_ERROR;
+			}
+
 			if (token.type == TK_CURLY_BRACKET_CLOSE) {
-				return OK;
+				return handler.end_object() ? OK : _stopped();
 			}
 
 			if (need_comma) {
 				if (token.type != TK_COMMA) {
-					r_err_str = "Expected '}' or ','";
+					err_str = "Expected '}' or ','";
 					return ERR_PARSE_ERROR;
 				} else {
 					need_comma = false;
@@ -403,62 +632,148 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 			}
 
 			if (token.type != TK_STRING) {
-				r_err_str = "Expected key";
+				err_str = "Expected key";
 				return ERR_PARSE_ERROR;
 			}
 
-			key = token.value;
-			err = _get_token(p_str, index, p_len, token, line, r_err_str);
+			if (!handler.object_key(token.string)) {
+				return _stopped();
+			}
+
+			err = _get_token(token);
 			if (err != OK) {
 				return err;
 			}
 			if (token.type != TK_COLON) {
-				r_err_str = "Expected ':'";
+				err_str = "Expected ':'";
 				return ERR_PARSE_ERROR;
 			}
-			at_key = false;
-		} else {
-			Error err = _get_token(p_str, index, p_len, token, line, r_err_str);
+
+			err = _get_token(token);
 			if (err != OK) {
 				return err;
 			}
 
-			Variant v;
-			err = _parse_value(v, token, p_str, index, p_len, line, r_err_str);
+			err = _parse_value(token);
 			if (err) {
 				return err;
 			}
-			object[key] = v;
 			need_comma = true;
-			at_key = true;
 		}
 	}
 
-	r_err_str = "Expected '}'";
-	return ERR_PARSE_ERROR;
-}
+public:
+	Error parse() {
+		Token token;
+		Error err = _get_token(token);
+		if (err) {
+			return err;
+		}
+		return _parse_value(token);
+	}
 
-Error JSON::parse(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
-	int idx = 0;
-	int len = p_json.length();
-	Token token;
-	r_err_line = 0;
-	String aux_key;
-
-	Error err = _get_token(str, idx, len, token, r_err_line, r_err_str);
-	if (err) {
-		return err;
+	JSONReader(const uint8_t *p_utf8, int p_len, H &p_handler, int &r_line, String &r_err_str) :
+			pos(p_utf8),
+			end(p_utf8 + p_len),
+			handler(p_handler),
+			line(r_line),
+			err_str(r_err_str) {
+		line = 0;
 	}
+};
+
+// Handler building the Variant returned by parse().
+class JSONVariantBuilder {
+	struct Container {
+		Variant value;
+		String key;
+	};
 
-	err = _parse_value(r_ret, token, str, idx, len, r_err_line, r_err_str);
+	LocalVector<Container> stack;
+	Variant &result;
 
-	return err;
+	_FORCE_INLINE_ void _add(const Variant &p_value) {
+		if (stack.is_empty()) {
+			result = p_value;
+			return;
+		}
+
+		Container &container = stack[stack.size() - 1];
+		if (container.value.get_type() == Variant::DICTIONARY) {
+			(*VariantInternal::get_dictionary(&container.value))[container.key] = p_value;
+		} else {
+			VariantInternal::get_array(&container.value)->push_back(p_value);
+		}
+	}
+
+	_FORCE_INLINE_ void _pop() {
+		Variant value = stack[stack.size() - 1].value;
+		stack.resize(stack.size() - 1);
+		_add(value);
+	}
+
+public:
+	bool begin_object() {
+		Container container;
+		container.value = Dictionary();
+		stack.push_back(container);
+		return true;
+	}
+
+	bool object_key(const String &p_key) {
+		stack[stack.size() - 1].key = p_key;
+		return true;
+	}
+
+	bool end_object() {
+		_pop();
+		return true;
+	}
+
+	bool begin_array() {
+		Container container;
+		container.value = Array();
+		stack.push_back(container);
+		return true;
+	}
+
+	bool end_array() {
+		_pop();
+		return true;
+	}
+
+	bool value(const Variant &p_value) {
+		_add(p_value);
+		return true;
+	}
+
+	JSONVariantBuilder(Variant &r_result) :
+			result(r_result) {}
+};
+
+Error JSON::parse(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	CharString utf8 = p_json.utf8();
+	return parse_utf8((const uint8_t *)utf8.get_data(), utf8.length(), r_ret, r_err_str, r_err_line);
+}
+
+Error JSON::parse_utf8(const uint8_t *p_utf8, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	JSONVariantBuilder builder(r_ret);
+	JSONReader<JSONVariantBuilder> reader(p_utf8, p_len, builder, r_err_line, r_err_str);
+	return reader.parse();
+}
+
+Error JSON::parse_stream(const uint8_t *p_utf8, int p_len, StreamHandler *p_handler, String &r_err_str, int &r_err_line) {
+	ERR_FAIL_NULL_V(p_handler, ERR_INVALID_PARAMETER);
+	JSONReader<StreamHandler> reader(p_utf8, p_len, *p_handler, r_err_line, r_err_str);
+	return reader.parse();
 }
 
 Error JSONParser::parse_string(const String &p_json_string) {
 	return JSON::parse(p_json_string, data, err_text, err_line);
 }
+Error JSONParser::parse_buffer(const Vector<uint8_t> &p_json_buffer) {
+	return JSON::parse_utf8(p_json_buffer.ptr(), p_json_buffer.size(), data, err_text, err_line);
+}
 String JSONParser::get_error_text() const {
 	return err_text;
 }
@@ -481,6 +796,7 @@ String JSONParser::get_string() const {
 
 void JSONParser::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("parse_string", "json_string"), &JSONParser::parse_string);
+	ClassDB::bind_method(D_METHOD("parse_buffer", "json_buffer"), &JSONParser::parse_buffer);
 	ClassDB::bind_method(D_METHOD("get_error_text"), &JSONParser::get_error_text);
 	ClassDB::bind_method(D_METHOD("get_error_line"), &JSONParser::get_error_line);
 	ClassDB::bind_method(D_METHOD("get_data"), &JSONParser::get_data);
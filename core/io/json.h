@@ -34,44 +34,25 @@
 #include "core/object/reference.h"
 #include "core/variant/variant.h"
 class JSON {
-	enum TokenType {
-		TK_CURLY_BRACKET_OPEN,
-		TK_CURLY_BRACKET_CLOSE,
-		TK_BRACKET_OPEN,
-		TK_BRACKET_CLOSE,
-		TK_IDENTIFIER,
-		TK_STRING,
-		TK_NUMBER,
-		TK_COLON,
-		TK_COMMA,
-		TK_EOF,
-		TK_MAX
-	};
-
-	enum Expecting {
-		EXPECT_OBJECT,
-		EXPECT_OBJECT_KEY,
-		EXPECT_COLON,
-		EXPECT_OBJECT_VALUE,
-	};
+public:
+	// Receives the contents of a document as it's parsed, without building Variants for its arrays
+	// and objects. Returning false from any call stops the parse with ERR_SKIP.
+	class StreamHandler {
+	public:
+		virtual bool begin_object() = 0;
+		virtual bool object_key(const String &p_key) = 0;
+		virtual bool end_object() = 0;
+		virtual bool begin_array() = 0;
+		virtual bool end_array() = 0;
+		virtual bool value(const Variant &p_value) = 0; // Null, bool, float or String.
 
-	struct Token {
-		TokenType type;
-		Variant value;
+		virtual ~StreamHandler() {}
 	};
 
-	static const char *tk_name[TK_MAX];
-
-	static String _print_var(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys);
-
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, String &r_err_str);
-
-public:
 	static String print(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true);
 	static Error parse(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static Error parse_utf8(const uint8_t *p_utf8, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static Error parse_stream(const uint8_t *p_utf8, int p_len, StreamHandler *p_handler, String &r_err_str, int &r_err_line);
 };
 
 class JSONParser : public Reference {
@@ -87,6 +68,7 @@ protected:
 
 public:
 	Error parse_string(const String &p_json_string);
+	Error parse_buffer(const Vector<uint8_t> &p_json_buffer);
 	String get_error_text() const;
 	int get_error_line() const;
 	Variant get_data() const;
@@ -33,6 +33,7 @@
 #include "core/object/reference.h"
 #include "core/os/keyboard.h"
 #include "core/string/print_string.h"
+#include "core/variant/variant_internal.h"
 
 #include <limits.h>
 #include <stdio.h>
@@ -60,6 +61,47 @@ ObjectID EncodedObjectAsID::get_object_id() const {
 #define ENCODE_FLAG_64 1 << 16
 #define ENCODE_FLAG_OBJECT_AS_ID 1 << 16
 
+// The encoded format is little endian, so arrays of 32 and 64 bit values are copied in one go,
+// and only swapped on big endian hosts.
+static void _copy_array_32(const void *p_from, void *p_to, int p_count) {
+	if (p_count == 0) {
+		return;
+	}
+	copymem(p_to, p_from, p_count * 4);
+#ifdef BIG_ENDIAN_ENABLED
+	uint32_t *ptr = (uint32_t *)p_to;
+	for (int i = 0; i < p_count; i++) {
+		ptr[i] = BSWAP32(ptr[i]);
+	}
+#endif
+}
+
+static void _copy_array_64(const void *p_from, void *p_to, int p_count) {
+	if (p_count == 0) {
+		return;
+	}
+	copymem(p_to, p_from, p_count * 8);
+#ifdef BIG_ENDIAN_ENABLED
+	uint64_t *ptr = (uint64_t *)p_to;
+	for (int i = 0; i < p_count; i++) {
+		ptr[i] = BSWAP64(ptr[i]);
+	}
+#endif
+}
+
+// Returns where to write a decoded packed array of p_count elements. When reusing containers and
+// r_variant already holds an array of this type it's resized in place, which doesn't allocate as
+// long as it's not shared and not growing.
+template <class T>
+static T *_decode_array_ptrw(Variant &r_variant, Variant::Type p_type, int p_count, bool p_reuse_containers) {
+	if (!p_reuse_containers || r_variant.get_type() != p_type) {
+		r_variant = Vector<T>();
+	}
+	Vector<T> *array = VariantGetInternalPtr<Vector<T>>::get_ptr(&r_variant);
+	array->resize(p_count);
+	return array->ptrw();
+}
+
 static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r_string) {
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
@@ -95,23 +137,12 @@ static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r
 	return OK;
 }
 
-Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects) {
+// Decodes what follows the type header.
+static Error _decode_variant_data(uint32_t p_type, Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, bool p_reuse_containers) {
 	const uint8_t *buf = p_buffer;
 	int len = p_len;
 
-	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
-
-	uint32_t type = decode_uint32(buf);
-
-	ERR_FAIL_COND_V((type & ENCODE_MASK) >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
-
-	buf += 4;
-	len -= 4;
-	if (r_len) {
-		*r_len = 4;
-	}
-
-	switch (type & ENCODE_MASK) {
+	switch (p_type & ENCODE_MASK) {
 		case Variant::NIL: {
 			r_variant = Variant();
 		} break;
@@ -124,7 +155,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			}
 		} break;
 		case Variant::INT: {
-			if (type & ENCODE_FLAG_64) {
+			if (p_type & ENCODE_FLAG_64) {
 				ERR_FAIL_COND_V(len < 8, ERR_INVALID_DATA);
 				int64_t val = decode_uint64(buf);
 				r_variant = val;
@@ -143,7 +174,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 		} break;
 		case Variant::FLOAT: {
-			if (type & ENCODE_FLAG_64) {
+			if (p_type & ENCODE_FLAG_64) {
 				ERR_FAIL_COND_V(len < 8, ERR_INVALID_DATA);
 				double val = decode_double(buf);
 				r_variant = val;
@@ -424,7 +455,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			r_variant = RID();
 		} break;
 		case Variant::OBJECT: {
-			if (type & ENCODE_FLAG_OBJECT_AS_ID) {
+			if (p_type & ENCODE_FLAG_OBJECT_AS_ID) {
 				//this _is_ allowed
 				ERR_FAIL_COND_V(len < 8, ERR_INVALID_DATA);
 				ObjectID val = ObjectID(decode_uint64(buf));
@@ -520,6 +551,10 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			}
 
 			Dictionary d;
+			if (p_reuse_containers && r_variant.get_type() == Variant::DICTIONARY) {
+				d = r_variant;
+				d.clear();
+			}
 
 			for (int i = 0; i < count; i++) {
 				Variant key, value;
@@ -562,16 +597,21 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				(*r_len) += 4;
 			}
 
+			ERR_FAIL_COND_V(count > len / 4, ERR_INVALID_DATA); // Every element has at least a header.
+
 			Array varr;
+			if (p_reuse_containers && r_variant.get_type() == Variant::ARRAY) {
+				varr = r_variant;
+			}
+			// Each element is decoded over the previous one at its index, reusing its containers too.
+			varr.resize(count);
 
 			for (int i = 0; i < count; i++) {
 				int used = 0;
-				Variant v;
-				Error err = decode_variant(v, buf, len, &used, p_allow_objects);
+				Error err = decode_variant(varr[i], buf, len, &used, p_allow_objects, p_reuse_containers);
 				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
 				buf += used;
 				len -= used;
-				varr.push_back(v);
 				if (r_len) {
 					(*r_len) += used;
 				}
@@ -589,18 +629,11 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			len -= 4;
 			ERR_FAIL_COND_V(count < 0 || count > len, ERR_INVALID_DATA);
 
-			Vector<uint8_t> data;
-
+			uint8_t *w = _decode_array_ptrw<uint8_t>(r_variant, Variant::PACKED_BYTE_ARRAY, count, p_reuse_containers);
 			if (count) {
-				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				copymem(w, buf, count);
 			}
 
-			r_variant = data;
-
 			if (r_len) {
 				if (count % 4) {
 					(*r_len) += 4 - count % 4;
@@ -617,17 +650,9 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			ERR_FAIL_MUL_OF(count, 4, ERR_INVALID_DATA);
 			ERR_FAIL_COND_V(count < 0 || count * 4 > len, ERR_INVALID_DATA);
 
-			Vector<int32_t> data;
+			int32_t *w = _decode_array_ptrw<int32_t>(r_variant, Variant::PACKED_INT32_ARRAY, count, p_reuse_containers);
+			_copy_array_32(buf, w, count);
 
-			if (count) {
-				//const int*rbuf=(const int*)buf;
-				data.resize(count);
-				int32_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_uint32(&buf[i * 4]);
-				}
-			}
-			r_variant = Variant(data);
 			if (r_len) {
 				(*r_len) += 4 + count * sizeof(int32_t);
 			}
@@ -635,23 +660,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::PACKED_INT64_ARRAY: {
 			ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
-			int64_t count = decode_uint64(buf);
+			int32_t count = decode_uint32(buf);
 			buf += 4;
 			len -= 4;
 			ERR_FAIL_MUL_OF(count, 8, ERR_INVALID_DATA);
 			ERR_FAIL_COND_V(count < 0 || count * 8 > len, ERR_INVALID_DATA);
 
-			Vector<int64_t> data;
+			int64_t *w = _decode_array_ptrw<int64_t>(r_variant, Variant::PACKED_INT64_ARRAY, count, p_reuse_containers);
+			_copy_array_64(buf, w, count);
 
-			if (count) {
-				//const int*rbuf=(const int*)buf;
-				data.resize(count);
-				int64_t *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_uint64(&buf[i * 8]);
-				}
-			}
-			r_variant = Variant(data);
 			if (r_len) {
 				(*r_len) += 4 + count * sizeof(int64_t);
 			}
@@ -665,17 +682,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			ERR_FAIL_MUL_OF(count, 4, ERR_INVALID_DATA);
 			ERR_FAIL_COND_V(count < 0 || count * 4 > len, ERR_INVALID_DATA);
 
-			Vector<float> data;
-
-			if (count) {
-				//const float*rbuf=(const float*)buf;
-				data.resize(count);
-				float *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_float(&buf[i * 4]);
-				}
-			}
-			r_variant = data;
+			float *w = _decode_array_ptrw<float>(r_variant, Variant::PACKED_FLOAT32_ARRAY, count, p_reuse_containers);
+			_copy_array_32(buf, w, count);
 
 			if (r_len) {
 				(*r_len) += 4 + count * sizeof(float);
@@ -684,23 +692,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::PACKED_FLOAT64_ARRAY: {
 			ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
-			int64_t count = decode_uint64(buf);
+			int32_t count = decode_uint32(buf);
 			buf += 4;
 			len -= 4;
 			ERR_FAIL_MUL_OF(count, 8, ERR_INVALID_DATA);
 			ERR_FAIL_COND_V(count < 0 || count * 8 > len, ERR_INVALID_DATA);
 
-			Vector<double> data;
-
-			if (count) {
-				//const double*rbuf=(const double*)buf;
-				data.resize(count);
-				double *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_double(&buf[i * 8]);
-				}
-			}
-			r_variant = data;
+			double *w = _decode_array_ptrw<double>(r_variant, Variant::PACKED_FLOAT64_ARRAY, count, p_reuse_containers);
+			_copy_array_64(buf, w, count);
 
 			if (r_len) {
 				(*r_len) += 4 + count * sizeof(double);
@@ -710,28 +709,22 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		case Variant::PACKED_STRING_ARRAY: {
 			ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 			int32_t count = decode_uint32(buf);
-
-			Vector<String> strings;
 			buf += 4;
 			len -= 4;
+			ERR_FAIL_COND_V(count < 0 || count > len / 4, ERR_INVALID_DATA); // Every string has at least its length.
 
 			if (r_len) {
 				(*r_len) += 4;
 			}
-			//printf("string count: %i\n",count);
 
+			String *w = _decode_array_ptrw<String>(r_variant, Variant::PACKED_STRING_ARRAY, count, p_reuse_containers);
 			for (int32_t i = 0; i < count; i++) {
-				String str;
-				Error err = _decode_string(buf, len, r_len, str);
+				Error err = _decode_string(buf, len, r_len, w[i]);
 				if (err) {
 					return err;
 				}
-
-				strings.push_back(str);
 			}
 
-			r_variant = strings;
-
 		} break;
 		case Variant::PACKED_VECTOR2_ARRAY: {
 			ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
@@ -741,29 +734,24 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			ERR_FAIL_MUL_OF(count, 4 * 2, ERR_INVALID_DATA);
 			ERR_FAIL_COND_V(count < 0 || count * 4 * 2 > len, ERR_INVALID_DATA);
-			Vector<Vector2> varray;
 
 			if (r_len) {
 				(*r_len) += 4;
 			}
 
-			if (count) {
-				varray.resize(count);
-				Vector2 *w = varray.ptrw();
-
-				for (int32_t i = 0; i < count; i++) {
-					w[i].x = decode_float(buf + i * 4 * 2 + 4 * 0);
-					w[i].y = decode_float(buf + i * 4 * 2 + 4 * 1);
-				}
-
-				int adv = 4 * 2 * count;
-
-				if (r_len) {
-					(*r_len) += adv;
-				}
+			Vector2 *w = _decode_array_ptrw<Vector2>(r_variant, Variant::PACKED_VECTOR2_ARRAY, count, p_reuse_containers);
+#ifdef REAL_T_IS_DOUBLE
+			for (int32_t i = 0; i < count; i++) {
+				w[i].x = decode_float(buf + i * 4 * 2 + 4 * 0);
+				w[i].y = decode_float(buf + i * 4 * 2 + 4 * 1);
 			}
+#else
+			_copy_array_32(buf, w, count * 2);
+#endif
 
-			r_variant = varray;
+			if (r_len) {
+				(*r_len) += 4 * 2 * count;
+			}
 
 		} break;
 		case Variant::PACKED_VECTOR3_ARRAY: {
@@ -775,30 +763,24 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			ERR_FAIL_MUL_OF(count, 4 * 3, ERR_INVALID_DATA);
 			ERR_FAIL_COND_V(count < 0 || count * 4 * 3 > len, ERR_INVALID_DATA);
 
-			Vector<Vector3> varray;
-
 			if (r_len) {
 				(*r_len) += 4;
 			}
 
-			if (count) {
-				varray.resize(count);
-				Vector3 *w = varray.ptrw();
-
-				for (int32_t i = 0; i < count; i++) {
-					w[i].x = decode_float(buf + i * 4 * 3 + 4 * 0);
-					w[i].y = decode_float(buf + i * 4 * 3 + 4 * 1);
-					w[i].z = decode_float(buf + i * 4 * 3 + 4 * 2);
-				}
-
-				int adv = 4 * 3 * count;
-
-				if (r_len) {
-					(*r_len) += adv;
-				}
+			Vector3 *w = _decode_array_ptrw<Vector3>(r_variant, Variant::PACKED_VECTOR3_ARRAY, count, p_reuse_containers);
+#ifdef REAL_T_IS_DOUBLE
+			for (int32_t i = 0; i < count; i++) {
+				w[i].x = decode_float(buf + i * 4 * 3 + 4 * 0);
+				w[i].y = decode_float(buf + i * 4 * 3 + 4 * 1);
+				w[i].z = decode_float(buf + i * 4 * 3 + 4 * 2);
 			}
+#else
+			_copy_array_32(buf, w, count * 3);
+#endif
 
-			r_variant = varray;
+			if (r_len) {
+				(*r_len) += 4 * 3 * count;
+			}
 
 		} break;
 		case Variant::PACKED_COLOR_ARRAY: {
@@ -810,32 +792,17 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			ERR_FAIL_MUL_OF(count, 4 * 4, ERR_INVALID_DATA);
 			ERR_FAIL_COND_V(count < 0 || count * 4 * 4 > len, ERR_INVALID_DATA);
 
-			Vector<Color> carray;
-
 			if (r_len) {
 				(*r_len) += 4;
 			}
 
-			if (count) {
-				carray.resize(count);
-				Color *w = carray.ptrw();
-
-				for (int32_t i = 0; i < count; i++) {
-					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
-					w[i].g = decode_float(buf + i * 4 * 4 + 4 * 1);
-					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
-					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
-				}
+			Color *w = _decode_array_ptrw<Color>(r_variant, Variant::PACKED_COLOR_ARRAY, count, p_reuse_containers);
+			_copy_array_32(buf, w, count * 4);
 
-				int adv = 4 * 4 * count;
-
-				if (r_len) {
-					(*r_len) += adv;
-				}
+			if (r_len) {
+				(*r_len) += 4 * 4 * count;
 			}
 
-			r_variant = carray;
-
 		} break;
 		default: {
 			ERR_FAIL_V(ERR_BUG);
@@ -845,6 +812,25 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 	return OK;
 }
 
+Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, bool p_reuse_containers) {
+	const uint8_t *buf = p_buffer;
+	int len = p_len;
+
+	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
+
+	uint32_t type = decode_uint32(buf);
+
+	ERR_FAIL_COND_V((type & ENCODE_MASK) >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+
+	buf += 4;
+	len -= 4;
+	if (r_len) {
+		*r_len = 4;
+	}
+
+	return _decode_variant_data(type, r_variant, buf, len, r_len, p_allow_objects, p_reuse_containers);
+}
+
 static void _encode_string(const String &p_string, uint8_t *&buf, int &r_len) {
 	CharString utf8 = p_string.utf8();
 
@@ -864,53 +850,10 @@ static void _encode_string(const String &p_string, uint8_t *&buf, int &r_len) {
 	}
 }
 
-Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects) {
+// Encodes what follows the type header, adding its size to r_len.
+static Error _encode_variant_data(const Variant &p_variant, uint32_t p_flags, uint8_t *r_buffer, int &r_len, bool p_full_objects) {
 	uint8_t *buf = r_buffer;
 
-	r_len = 0;
-
-	uint32_t flags = 0;
-
-	switch (p_variant.get_type()) {
-		case Variant::INT: {
-			int64_t val = p_variant;
-			if (val > (int64_t)INT_MAX || val < (int64_t)INT_MIN) {
-				flags |= ENCODE_FLAG_64;
-			}
-		} break;
-		case Variant::FLOAT: {
-			double d = p_variant;
-			float f = d;
-			if (double(f) != d) {
-				flags |= ENCODE_FLAG_64; //always encode real as double
-			}
-		} break;
-		case Variant::OBJECT: {
-			// Test for potential wrong values sent by the debugger when it breaks.
-			Object *obj = p_variant.get_validated_object();
-			if (!obj) {
-				// Object is invalid, send a nullptr  instead.
-				if (buf) {
-					encode_uint32(Variant::NIL, buf);
-				}
-				r_len += 4;
-				return OK;
-			}
-
-			if (!p_full_objects) {
-				flags |= ENCODE_FLAG_OBJECT_AS_ID;
-			}
-		} break;
-		default: {
-		} // nothing to do at this stage
-	}
-
-	if (buf) {
-		encode_uint32(p_variant.get_type() | flags, buf);
-		buf += 4;
-	}
-	r_len += 4;
-
 	switch (p_variant.get_type()) {
 		case Variant::NIL: {
 			//nothing to do
@@ -924,7 +867,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::INT: {
-			if (flags & ENCODE_FLAG_64) {
+			if (p_flags & ENCODE_FLAG_64) {
 				//64 bits
 				if (buf) {
 					encode_uint64(p_variant.operator int64_t(), buf);
@@ -940,7 +883,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			}
 		} break;
 		case Variant::FLOAT: {
-			if (flags & ENCODE_FLAG_64) {
+			if (p_flags & ENCODE_FLAG_64) {
 				if (buf) {
 					encode_double(p_variant.operator double(), buf);
 				}
@@ -1335,10 +1278,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int32_t *r = data.ptr();
-				for (int32_t i = 0; i < datalen; i++) {
-					encode_uint32(r[i], &buf[i * datasize]);
-				}
+				_copy_array_32(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1350,12 +1290,9 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			int datasize = sizeof(int64_t);
 
 			if (buf) {
-				encode_uint64(datalen, buf);
+				encode_uint32(datalen, buf);
 				buf += 4;
-				const int64_t *r = data.ptr();
-				for (int64_t i = 0; i < datalen; i++) {
-					encode_uint64(r[i], &buf[i * datasize]);
-				}
+				_copy_array_64(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1369,10 +1306,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const float *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_float(r[i], &buf[i * datasize]);
-				}
+				_copy_array_32(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1386,10 +1320,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const double *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_double(r[i], &buf[i * datasize]);
-				}
+				_copy_array_64(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1438,6 +1369,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
+#ifdef REAL_T_IS_DOUBLE
 				for (int i = 0; i < len; i++) {
 					Vector2 v = data.get(i);
 
@@ -1445,6 +1377,10 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					encode_float(v.y, &buf[4]);
 					buf += 4 * 2;
 				}
+#else
+				_copy_array_32(data.ptr(), buf, len * 2);
+				buf += 4 * 2 * len;
+#endif
 			}
 
 			r_len += 4 * 2 * len;
@@ -1462,6 +1398,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
+#ifdef REAL_T_IS_DOUBLE
 				for (int i = 0; i < len; i++) {
 					Vector3 v = data.get(i);
 
@@ -1470,6 +1407,10 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 					encode_float(v.z, &buf[8]);
 					buf += 4 * 3;
 				}
+#else
+				_copy_array_32(data.ptr(), buf, len * 3);
+				buf += 4 * 3 * len;
+#endif
 			}
 
 			r_len += 4 * 3 * len;
@@ -1487,15 +1428,8 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Color c = data.get(i);
-
-					encode_float(c.r, &buf[0]);
-					encode_float(c.g, &buf[4]);
-					encode_float(c.b, &buf[8]);
-					encode_float(c.a, &buf[12]);
-					buf += 4 * 4;
-				}
+				_copy_array_32(data.ptr(), buf, len * 4);
+				buf += 4 * 4 * len;
 			}
 
 			r_len += 4 * 4 * len;
@@ -1508,3 +1442,254 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 	return OK;
 }
+
+Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects) {
+	uint8_t *buf = r_buffer;
+
+	r_len = 0;
+
+	uint32_t flags = 0;
+
+	switch (p_variant.get_type()) {
+		case Variant::INT: {
+			int64_t val = p_variant;
+			if (val > (int64_t)INT_MAX || val < (int64_t)INT_MIN) {
+				flags |= ENCODE_FLAG_64;
+			}
+		} break;
+		case Variant::FLOAT: {
+			double d = p_variant;
+			float f = d;
+			if (double(f) != d) {
+				flags |= ENCODE_FLAG_64; //always encode real as double
+			}
+		} break;
+		case Variant::OBJECT: {
+			// Test for potential wrong values sent by the debugger when it breaks.
+			Object *obj = p_variant.get_validated_object();
+			if (!obj) {
+				// Object is invalid, send a nullptr  instead.
+				if (buf) {
+					encode_uint32(Variant::NIL, buf);
+				}
+				r_len += 4;
+				return OK;
+			}
+
+			if (!p_full_objects) {
+				flags |= ENCODE_FLAG_OBJECT_AS_ID;
+			}
+		} break;
+		default: {
+		} // nothing to do at this stage
+	}
+
+	if (buf) {
+		encode_uint32(p_variant.get_type() | flags, buf);
+		buf += 4;
+	}
+	r_len += 4;
+
+	return _encode_variant_data(p_variant, flags, buf, r_len, p_full_objects);
+}
+
+void MarshallSchema::add_field(const String &p_name, Variant::Type p_type) {
+	ERR_FAIL_INDEX(p_type, Variant::VARIANT_MAX);
+
+	Field field;
+	field.name = p_name;
+	field.type = p_type;
+	fields.push_back(field);
+}
+
+Error MarshallSchema::_encode_field(const Field &p_field, const Variant &p_value, uint8_t *r_buffer, int &r_len) {
+	uint8_t *buf = r_buffer;
+
+	switch (p_field.type) {
+		case Variant::NIL:
+		case Variant::OBJECT: {
+			return encode_variant(p_value, buf, r_len);
+		} break;
+		case Variant::BOOL: {
+			ERR_FAIL_COND_V_MSG(p_value.get_type() != Variant::BOOL, ERR_INVALID_PARAMETER, "Expected a bool for field '" + p_field.name + "'.");
+			if (buf) {
+				*buf = p_value.operator bool();
+			}
+			r_len = 1;
+		} break;
+		case Variant::INT: {
+			ERR_FAIL_COND_V_MSG(p_value.get_type() != Variant::INT && p_value.get_type() != Variant::FLOAT, ERR_INVALID_PARAMETER, "Expected a number for field '" + p_field.name + "'.");
+			r_len = encode_varint(encode_zigzag(p_value.operator int64_t()), buf);
+		} break;
+		case Variant::FLOAT: {
+			ERR_FAIL_COND_V_MSG(p_value.get_type() != Variant::INT && p_value.get_type() != Variant::FLOAT, ERR_INVALID_PARAMETER, "Expected a number for field '" + p_field.name + "'.");
+			if (buf) {
+				encode_double(p_value.operator double(), buf);
+			}
+			r_len = 8;
+		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME:
+		case Variant::NODE_PATH: {
+			ERR_FAIL_COND_V_MSG(p_value.get_type() != Variant::STRING && p_value.get_type() != Variant::STRING_NAME && p_value.get_type() != Variant::NODE_PATH, ERR_INVALID_PARAMETER, "Expected a string for field '" + p_field.name + "'.");
+			CharString utf8 = String(p_value).utf8();
+			r_len = encode_varint(utf8.length(), buf);
+			if (buf) {
+				copymem(buf + r_len, utf8.get_data(), utf8.length());
+			}
+			r_len += utf8.length();
+		} break;
+		default: {
+			ERR_FAIL_COND_V_MSG(p_value.get_type() != p_field.type, ERR_INVALID_PARAMETER, "Expected a " + Variant::get_type_name(p_field.type) + " for field '" + p_field.name + "'.");
+			r_len = 0;
+			return _encode_variant_data(p_value, 0, buf, r_len, false);
+		}
+	}
+
+	return OK;
+}
+
+Error MarshallSchema::_decode_field(const Field &p_field, const uint8_t *p_buffer, int p_len, Variant &r_value, int &r_len) {
+	const uint8_t *buf = p_buffer;
+	int len = p_len;
+
+	switch (p_field.type) {
+		case Variant::NIL:
+		case Variant::OBJECT: {
+			return decode_variant(r_value, buf, len, &r_len, false, true);
+		} break;
+		case Variant::BOOL: {
+			ERR_FAIL_COND_V(len < 1, ERR_INVALID_DATA);
+			r_value = *buf != 0;
+			r_len = 1;
+		} break;
+		case Variant::INT: {
+			uint64_t value;
+			r_len = decode_varint(buf, len, value);
+			ERR_FAIL_COND_V(r_len == 0, ERR_INVALID_DATA);
+			r_value = decode_zigzag(value);
+		} break;
+		case Variant::FLOAT: {
+			ERR_FAIL_COND_V(len < 8, ERR_INVALID_DATA);
+			r_value = decode_double(buf);
+			r_len = 8;
+		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME:
+		case Variant::NODE_PATH: {
+			uint64_t strlen;
+			int used = decode_varint(buf, len, strlen);
+			ERR_FAIL_COND_V(used == 0 || strlen > uint64_t(len - used), ERR_INVALID_DATA);
+
+			String str;
+			ERR_FAIL_COND_V(str.parse_utf8((const char *)buf + used, strlen), ERR_INVALID_DATA);
+			if (p_field.type == Variant::STRING_NAME) {
+				r_value = StringName(str);
+			} else if (p_field.type == Variant::NODE_PATH) {
+				r_value = NodePath(str);
+			} else {
+				r_value = str;
+			}
+			r_len = used + strlen;
+		} break;
+		default: {
+			r_len = 0;
+			return _decode_variant_data(p_field.type, r_value, buf, len, &r_len, false, true);
+		}
+	}
+
+	return OK;
+}
+
+Error MarshallSchema::encode(const Variant *p_values, int p_count, uint8_t *r_buffer, int &r_len) const {
+	ERR_FAIL_COND_V(p_count != fields.size(), ERR_INVALID_PARAMETER);
+
+	uint8_t *buf = r_buffer;
+	r_len = 0;
+
+	for (int i = 0; i < fields.size(); i++) {
+		int len = 0;
+		Error err = _encode_field(fields[i], p_values[i], buf, len);
+		if (err) {
+			return err;
+		}
+		r_len += len;
+		if (buf) {
+			buf += len;
+		}
+	}
+
+	return OK;
+}
+
+Error MarshallSchema::encode(const Dictionary &p_values, uint8_t *r_buffer, int &r_len) const {
+	uint8_t *buf = r_buffer;
+	r_len = 0;
+
+	for (int i = 0; i < fields.size(); i++) {
+		const Variant *value = p_values.getptr(fields[i].name);
+		ERR_FAIL_COND_V_MSG(!value, ERR_INVALID_PARAMETER, "Missing value for field '" + fields[i].name + "'.");
+
+		int len = 0;
+		Error err = _encode_field(fields[i], *value, buf, len);
+		if (err) {
+			return err;
+		}
+		r_len += len;
+		if (buf) {
+			buf += len;
+		}
+	}
+
+	return OK;
+}
+
+Error MarshallSchema::decode(const uint8_t *p_buffer, int p_len, Variant *r_values, int p_count, int *r_len) const {
+	ERR_FAIL_COND_V(p_count != fields.size(), ERR_INVALID_PARAMETER);
+
+	const uint8_t *buf = p_buffer;
+	int len = p_len;
+
+	for (int i = 0; i < fields.size(); i++) {
+		int used = 0;
+		Error err = _decode_field(fields[i], buf, len, r_values[i], used);
+		if (err) {
+			return err;
+		}
+		buf += used;
+		len -= used;
+	}
+
+	if (r_len) {
+		*r_len = p_len - len;
+	}
+
+	return OK;
+}
+
+Error MarshallSchema::decode(const uint8_t *p_buffer, int p_len, Dictionary &r_values, int *r_len) const {
+	const uint8_t *buf = p_buffer;
+	int len = p_len;
+
+	for (int i = 0; i < fields.size(); i++) {
+		Variant *value = r_values.getptr(fields[i].name);
+		if (!value) {
+			r_values[fields[i].name] = Variant();
+			value = r_values.getptr(fields[i].name);
+		}
+
+		int used = 0;
+		Error err = _decode_field(fields[i], buf, len, *value, used);
+		if (err) {
+			return err;
+		}
+		buf += used;
+		len -= used;
+	}
+
+	if (r_len) {
+		*r_len = p_len - len;
+	}
+
+	return OK;
+}
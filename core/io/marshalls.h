@@ -165,6 +165,47 @@ static inline double decode_double(const uint8_t *p_arr) {
 	return md.d;
 }
 
+// Variable length integers: 7 bits per byte, least significant first, with the high bit set on all
+// but the last byte. p_arr can be null to only get the size.
+static inline unsigned int encode_varint(uint64_t p_uint, uint8_t *p_arr) {
+	unsigned int len = 0;
+	do {
+		uint8_t byte = p_uint & 0x7F;
+		p_uint >>= 7;
+		if (p_uint) {
+			byte |= 0x80;
+		}
+		if (p_arr) {
+			p_arr[len] = byte;
+		}
+		len++;
+	} while (p_uint);
+
+	return len;
+}
+
+// Returns the number of bytes read, or 0 if the value doesn't end within p_len bytes.
+static inline unsigned int decode_varint(const uint8_t *p_arr, int p_len, uint64_t &r_uint) {
+	r_uint = 0;
+	for (int i = 0; i < p_len && i < 10; i++) {
+		r_uint |= uint64_t(p_arr[i] & 0x7F) << (i * 7);
+		if (!(p_arr[i] & 0x80)) {
+			return i + 1;
+		}
+	}
+
+	return 0;
+}
+
+// Maps signed integers to unsigned ones so that small negative values make short varints too.
+static inline uint64_t encode_zigzag(int64_t p_int) {
+	return (uint64_t(p_int) << 1) ^ uint64_t(p_int >> 63);
+}
+
+static inline int64_t decode_zigzag(uint64_t p_uint) {
+	return int64_t(p_uint >> 1) ^ -int64_t(p_uint & 1);
+}
+
 class EncodedObjectAsID : public Reference {
 	GDCLASS(EncodedObjectAsID, Reference);
 
@@ -180,7 +221,41 @@ public:
 	EncodedObjectAsID() {}
 };
 
-Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false);
+// With p_reuse_containers, arrays and dictionaries already held by r_variant (and by the elements of
+// its arrays) are decoded into instead of being replaced, so decoding the same kind of data over and
+// over doesn't allocate. Anything else holding them sees the new contents.
+Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, bool p_reuse_containers = false);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false);
 
+// A list of typed fields both ends agree on ahead of time, such as the arguments of an RPC. Values are
+// encoded in field order without type headers or keys: integers as zigzag varints, strings with a
+// varint length and no padding, other types as in encode_variant() minus the header.
+// Fields of type NIL (or OBJECT) take any Variant and are encoded with encode_variant().
+class MarshallSchema {
+public:
+	struct Field {
+		String name;
+		Variant::Type type = Variant::NIL;
+	};
+
+private:
+	Vector<Field> fields;
+
+	static Error _encode_field(const Field &p_field, const Variant &p_value, uint8_t *r_buffer, int &r_len);
+	static Error _decode_field(const Field &p_field, const uint8_t *p_buffer, int p_len, Variant &r_value, int &r_len);
+
+public:
+	void add_field(const String &p_name, Variant::Type p_type);
+	int get_field_count() const { return fields.size(); }
+	const Field &get_field(int p_index) const { return fields[p_index]; }
+
+	// r_buffer can be null to only compute r_len.
+	Error encode(const Variant *p_values, int p_count, uint8_t *r_buffer, int &r_len) const;
+	Error encode(const Dictionary &p_values, uint8_t *r_buffer, int &r_len) const;
+
+	// Decodes over the previous values, reusing their containers like decode_variant() does.
+	Error decode(const uint8_t *p_buffer, int p_len, Variant *r_values, int p_count, int *r_len = nullptr) const;
+	Error decode(const uint8_t *p_buffer, int p_len, Dictionary &r_values, int *r_len = nullptr) const;
+};
+
 #endif // MARSHALLS_H
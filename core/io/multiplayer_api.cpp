@@ -32,6 +32,9 @@
 
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
 #include "scene/main/node.h"
 
 #include <stdint.h>
@@ -40,9 +43,6 @@
 #define NAME_ID_COMPRESSION_SHIFT 5
 #define BYTE_ONLY_OR_NO_ARGS_SHIFT 6
 
-#ifdef DEBUG_ENABLED
-#include "core/os/os.h"
-#endif
 
 _FORCE_INLINE_ bool _should_call_local(MultiplayerAPI::RPCMode mode, bool is_master, bool &r_skip_rpc) {
 	switch (mode) {
@@ -103,6 +103,9 @@ void MultiplayerAPI::poll() {
 		return;
 	}
 
+	// Send the RPCs batched since the last poll, so the peer can service them right away.
+	flush_rpc_batches();
+
 	network_peer->poll();
 
 	if (!network_peer.is_valid()) { // It's possible that polling might have resulted in a disconnection, so check here.
@@ -128,6 +131,11 @@ void MultiplayerAPI::poll() {
 			break; // It's also possible that a packet or RPC caused a disconnection, so also check here.
 		}
 	}
+
+	if (network_peer.is_valid()) {
+		_update_interest();
+		_send_replication();
+	}
 }
 
 void MultiplayerAPI::clear() {
@@ -135,6 +143,10 @@ void MultiplayerAPI::clear() {
 	path_get_cache.clear();
 	path_send_cache.clear();
 	packet_cache.clear();
+	rpc_batches[0].clear();
+	rpc_batches[1].clear();
+	interest_peers.clear();
+	replication_peers.clear();
 	last_send_cache_id = 1;
 }
 
@@ -215,13 +227,15 @@ void MultiplayerAPI::_process_packet(int p_from, const uint8_t *p_packet, int p_
 	ERR_FAIL_COND_MSG(root_node == nullptr, "Multiplayer root node was not initialized. If you are using custom multiplayer, remember to set the root node via MultiplayerAPI.set_root_node before using it.");
 	ERR_FAIL_COND_MSG(p_packet_len < 1, "Invalid packet received. Size too small.");
 
-#ifdef DEBUG_ENABLED
-	_profile_bandwidth_data("in", p_packet_len);
-#endif
-
 	// Extract the `packet_type` from the LSB three bits:
 	uint8_t packet_type = p_packet[0] & 7;
 
+#ifdef DEBUG_ENABLED
+	if (packet_type != NETWORK_COMMAND_BATCH) { // Batched messages are profiled individually.
+		_profile_bandwidth_data("in", p_packet_len);
+	}
+#endif
+
 	switch (packet_type) {
 		case NETWORK_COMMAND_SIMPLIFY_PATH: {
 			_process_simplify_path(p_from, p_packet, p_packet_len);
@@ -314,6 +328,18 @@ void MultiplayerAPI::_process_packet(int p_from, const uint8_t *p_packet, int p_
 		case NETWORK_COMMAND_RAW: {
 			_process_raw(p_from, p_packet, p_packet_len);
 		} break;
+
+		case NETWORK_COMMAND_REPLICATE: {
+			_process_replicate(p_from, p_packet, p_packet_len);
+		} break;
+
+		case NETWORK_COMMAND_REPLICATE_ACK: {
+			_process_replicate_ack(p_from, p_packet, p_packet_len);
+		} break;
+
+		case NETWORK_COMMAND_BATCH: {
+			_process_batch(p_from, p_packet, p_packet_len);
+		} break;
 	}
 }
 
@@ -767,6 +793,19 @@ void MultiplayerAPI::_send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p
 		ERR_FAIL_MSG("Attempt to remote call unexisting ID: " + itos(p_to) + ".");
 	}
 
+	if (p_to <= 0 && !interest_peers.is_empty() && interest_nodes.has(p_from->get_instance_id())) {
+		// Only send to the peers the node is relevant to.
+		for (Set<int>::Element *E = connected_peers.front(); E; E = E->next()) {
+			if (p_to < 0 && E->get() == -p_to) {
+				continue; // Continue, excluded.
+			}
+			if (_is_relevant(p_from->get_instance_id(), E->get())) {
+				_send_rpc(p_from, E->get(), p_unreliable, p_set, p_name, p_arg, p_argcount);
+			}
+		}
+		return;
+	}
+
 	NodePath from_path = (root_node->get_path()).rel_path_to(p_from->get_path());
 	ERR_FAIL_COND_MSG(from_path.is_empty(), "Unable to send RPC. Relative path is empty. THIS IS LIKELY A BUG IN THE ENGINE!");
 
@@ -926,13 +965,9 @@ void MultiplayerAPI::_send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p
 	_profile_bandwidth_data("out", ofs);
 #endif
 
-	// Take chance and set transfer mode, since all send methods will use it.
-	network_peer->set_transfer_mode(p_unreliable ? NetworkedMultiplayerPeer::TRANSFER_MODE_UNRELIABLE : NetworkedMultiplayerPeer::TRANSFER_MODE_RELIABLE);
-
 	if (has_all_peers) {
 		// They all have verified paths, so send fast.
-		network_peer->set_target_peer(p_to); // To all of you.
-		network_peer->put_packet(packet_cache.ptr(), ofs); // A message with love.
+		_send_rpc_packet(p_to, p_unreliable, packet_cache.ptr(), ofs); // A message with love.
 	} else {
 		// Unreachable because the node ID is never compressed if the peers doesn't know it.
 		CRASH_COND(node_id_compression != NETWORK_NODE_ID_COMPRESSION_32);
@@ -957,19 +992,868 @@ void MultiplayerAPI::_send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p
 			Map<int, bool>::Element *F = psc->confirmed_peers.find(E->get());
 			ERR_CONTINUE(!F); // Should never happen.
 
-			network_peer->set_target_peer(E->get()); // To this one specifically.
-
+			// To this one specifically.
 			if (F->get()) {
 				// This one confirmed path, so use id.
 				encode_uint32(psc->id, &(packet_cache.write[1]));
-				network_peer->put_packet(packet_cache.ptr(), ofs);
+				_send_rpc_packet(E->get(), p_unreliable, packet_cache.ptr(), ofs);
 			} else {
 				// This one did not confirm path yet, so use entire path (sorry!).
 				encode_uint32(0x80000000 | ofs, &(packet_cache.write[1])); // Offset to path and flag.
-				network_peer->put_packet(packet_cache.ptr(), ofs + path_len);
+				_send_rpc_packet(E->get(), p_unreliable, packet_cache.ptr(), ofs + path_len);
+			}
+		}
+	}
+}
+
+// RPC batching.
+// When enabled, RPCs are queued per peer and transfer mode, and sent at the
+// next poll coalesced in packets of up to RPC_BATCH_MAX_SIZE bytes.
+// Batch format: [command] followed by messages, each being prefixed by its size
+// in 1 byte, or in 2 bytes (big endian, MSB set) when larger than 127 bytes.
+
+void MultiplayerAPI::_send_rpc_packet(int p_to, bool p_unreliable, const uint8_t *p_packet, int p_packet_len) {
+	if (rpc_batching && p_packet_len + 3 <= RPC_BATCH_MAX_SIZE) {
+		if (p_to > 0) {
+			_batch_rpc_packet(p_to, p_unreliable, p_packet, p_packet_len);
+			return;
+		}
+		for (Set<int>::Element *E = connected_peers.front(); E; E = E->next()) {
+			if (p_to < 0 && E->get() == -p_to) {
+				continue; // Continue, excluded.
 			}
+			_batch_rpc_packet(E->get(), p_unreliable, p_packet, p_packet_len);
+		}
+		return;
+	}
+
+	if (rpc_batching) {
+		// Too big to be batched, keep it ordered after the queued messages.
+		_flush_rpc_batches(p_to, p_unreliable);
+	}
+
+	network_peer->set_transfer_mode(p_unreliable ? NetworkedMultiplayerPeer::TRANSFER_MODE_UNRELIABLE : NetworkedMultiplayerPeer::TRANSFER_MODE_RELIABLE);
+	network_peer->set_target_peer(p_to);
+	network_peer->put_packet(p_packet, p_packet_len);
+}
+
+void MultiplayerAPI::_batch_rpc_packet(int p_peer, bool p_unreliable, const uint8_t *p_packet, int p_packet_len) {
+	LocalVector<uint8_t> &batch = rpc_batches[p_unreliable ? 1 : 0][p_peer];
+	const int size_len = p_packet_len > 127 ? 2 : 1;
+	if (batch.size() && batch.size() + size_len + p_packet_len > RPC_BATCH_MAX_SIZE) {
+		_flush_rpc_batch(p_peer, p_unreliable, batch);
+	}
+	if (batch.is_empty()) {
+		batch.push_back(NETWORK_COMMAND_BATCH);
+	}
+
+	uint32_t ofs = batch.size();
+	batch.resize(ofs + size_len + p_packet_len);
+	if (size_len == 2) {
+		batch[ofs++] = 0x80 | (p_packet_len >> 8);
+	}
+	batch[ofs++] = p_packet_len & 0xFF;
+	memcpy(&batch[ofs], p_packet, p_packet_len);
+}
+
+void MultiplayerAPI::_flush_rpc_batch(int p_peer, bool p_unreliable, LocalVector<uint8_t> &p_batch) {
+	if (p_batch.is_empty()) {
+		return;
+	}
+
+	network_peer->set_transfer_mode(p_unreliable ? NetworkedMultiplayerPeer::TRANSFER_MODE_UNRELIABLE : NetworkedMultiplayerPeer::TRANSFER_MODE_RELIABLE);
+	network_peer->set_target_peer(p_peer);
+
+	// A single message is sent as is, without the batch overhead.
+	const int size_len = (p_batch[1] & 0x80) ? 2 : 1;
+	const int first_len = size_len == 2 ? (((p_batch[1] & 0x7F) << 8) | p_batch[2]) : p_batch[1];
+	if (1 + size_len + first_len == (int)p_batch.size()) {
+		network_peer->put_packet(&p_batch[1 + size_len], first_len);
+	} else {
+		network_peer->put_packet(p_batch.ptr(), p_batch.size());
+	}
+	p_batch.clear();
+}
+
+void MultiplayerAPI::_flush_rpc_batches(int p_to, bool p_unreliable) {
+	Map<int, LocalVector<uint8_t>> &batches = rpc_batches[p_unreliable ? 1 : 0];
+	for (Map<int, LocalVector<uint8_t>>::Element *E = batches.front(); E; E = E->next()) {
+		if (p_to > 0 && E->key() != p_to) {
+			continue;
 		}
+		_flush_rpc_batch(E->key(), p_unreliable, E->get());
+	}
+}
+
+void MultiplayerAPI::flush_rpc_batches() {
+	if (!network_peer.is_valid() || network_peer->get_connection_status() != NetworkedMultiplayerPeer::CONNECTION_CONNECTED) {
+		return;
 	}
+	_flush_rpc_batches(0, false);
+	_flush_rpc_batches(0, true);
+}
+
+void MultiplayerAPI::_process_batch(int p_from, const uint8_t *p_packet, int p_packet_len) {
+	int ofs = 1;
+	while (ofs < p_packet_len) {
+		int len = p_packet[ofs++];
+		if (len & 0x80) {
+			ERR_FAIL_COND_MSG(ofs >= p_packet_len, "Invalid packet received. Size too small.");
+			len = ((len & 0x7F) << 8) | p_packet[ofs++];
+		}
+		ERR_FAIL_COND_MSG(len < 1 || ofs + len > p_packet_len, "Invalid packet received. Batched message size is out of bounds.");
+		ERR_FAIL_COND_MSG((p_packet[ofs] & 7) == NETWORK_COMMAND_BATCH, "Invalid packet received. Batches can't be nested.");
+
+		_process_packet(p_from, &p_packet[ofs], len);
+		ofs += len;
+
+		if (!network_peer.is_valid()) {
+			return; // A message caused a disconnection.
+		}
+	}
+}
+
+void MultiplayerAPI::set_rpc_batching(bool p_enable) {
+	if (!p_enable) {
+		flush_rpc_batches();
+	}
+	rpc_batching = p_enable;
+}
+
+bool MultiplayerAPI::is_rpc_batching() const {
+	return rpc_batching;
+}
+
+// Interest management.
+// Registered nodes are bucketed every poll in a grid of cells slightly larger
+// than the interest radius, and a budgeted amount of peers get their relevant
+// set recomputed by looking up the cells around their origin.
+
+#define INTEREST_EXIT_MARGIN 1.1
+
+static bool _get_interest_position(Node *p_node, Vector3 &r_position) {
+	Node3D *node_3d = Object::cast_to<Node3D>(p_node);
+	if (node_3d) {
+		r_position = node_3d->get_global_transform().origin;
+		return true;
+	}
+	Node2D *node_2d = Object::cast_to<Node2D>(p_node);
+	if (node_2d) {
+		const Point2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		return true;
+	}
+	return false;
+}
+
+static _FORCE_INLINE_ uint64_t _get_interest_cell_key(int p_x, int p_y, int p_z) {
+	return (uint64_t(p_x & 0x1FFFFF) << 42) | (uint64_t(p_y & 0x1FFFFF) << 21) | uint64_t(p_z & 0x1FFFFF);
+}
+
+void MultiplayerAPI::_update_peer_interest(int p_peer, InterestPeer &p_interest, const HashMap<uint64_t, LocalVector<InterestEntry>> &p_grid, float p_cell_size) {
+	Node *origin = Object::cast_to<Node>(ObjectDB::get_instance(p_interest.origin));
+	Vector3 origin_position;
+	if (!origin || !origin->is_inside_tree() || !_get_interest_position(origin, origin_position)) {
+		return;
+	}
+	p_interest.dirty = false;
+
+	// Nodes already relevant use a slightly larger radius, so they don't flicker at the edge.
+	const float enter_radius_squared = interest_radius * interest_radius;
+	const float exit_radius_squared = enter_radius_squared * INTEREST_EXIT_MARGIN * INTEREST_EXIT_MARGIN;
+
+	const int cx = Math::floor(origin_position.x / p_cell_size);
+	const int cy = Math::floor(origin_position.y / p_cell_size);
+	const int cz = Math::floor(origin_position.z / p_cell_size);
+
+	Set<ObjectID> relevant;
+	for (int x = cx - 1; x <= cx + 1; x++) {
+		for (int y = cy - 1; y <= cy + 1; y++) {
+			for (int z = cz - 1; z <= cz + 1; z++) {
+				const LocalVector<InterestEntry> *cell = p_grid.getptr(_get_interest_cell_key(x, y, z));
+				if (!cell) {
+					continue;
+				}
+				for (uint32_t i = 0; i < cell->size(); i++) {
+					const InterestEntry &entry = (*cell)[i];
+					const float limit = p_interest.relevant.has(entry.node) ? exit_radius_squared : enter_radius_squared;
+					if (origin_position.distance_squared_to(entry.position) <= limit) {
+						relevant.insert(entry.node);
+					}
+				}
+			}
+		}
+	}
+
+	List<ObjectID> exited;
+	List<ObjectID> entered;
+	for (Set<ObjectID>::Element *E = p_interest.relevant.front(); E; E = E->next()) {
+		if (!relevant.has(E->get())) {
+			exited.push_back(E->get());
+		}
+	}
+	for (Set<ObjectID>::Element *E = relevant.front(); E; E = E->next()) {
+		if (!p_interest.relevant.has(E->get())) {
+			entered.push_back(E->get());
+		}
+	}
+	p_interest.relevant = relevant;
+
+	// Signals are emitted last, as callbacks may change the interest state.
+	Map<int, ReplicationPeer>::Element *R = replication_peers.find(p_peer);
+	for (List<ObjectID>::Element *E = exited.front(); E; E = E->next()) {
+		if (R) {
+			// Send the full state again if the node becomes relevant later.
+			R->get().baselines.erase(E->get());
+		}
+		Object *node = ObjectDB::get_instance(E->get());
+		if (node) {
+			emit_signal("interest_exited", p_peer, node);
+		}
+	}
+	for (List<ObjectID>::Element *E = entered.front(); E; E = E->next()) {
+		Object *node = ObjectDB::get_instance(E->get());
+		if (node) {
+			emit_signal("interest_entered", p_peer, node);
+		}
+	}
+}
+
+void MultiplayerAPI::_update_interest() {
+	if (interest_nodes.is_empty() || interest_peers.is_empty()) {
+		return;
+	}
+
+	const float cell_size = MAX(interest_radius * INTEREST_EXIT_MARGIN, CMP_EPSILON);
+	HashMap<uint64_t, LocalVector<InterestEntry>> grid;
+	List<ObjectID> freed;
+	for (Set<ObjectID>::Element *E = interest_nodes.front(); E; E = E->next()) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(E->get()));
+		if (!node) {
+			freed.push_back(E->get());
+			continue;
+		}
+		InterestEntry entry;
+		if (!node->is_inside_tree() || !_get_interest_position(node, entry.position)) {
+			continue;
+		}
+		entry.node = E->get();
+		const uint64_t key = _get_interest_cell_key(Math::floor(entry.position.x / cell_size), Math::floor(entry.position.y / cell_size), Math::floor(entry.position.z / cell_size));
+		LocalVector<InterestEntry> *cell = grid.getptr(key);
+		if (!cell) {
+			grid[key] = LocalVector<InterestEntry>();
+			cell = grid.getptr(key);
+		}
+		cell->push_back(entry);
+	}
+
+	for (List<ObjectID>::Element *E = freed.front(); E; E = E->next()) {
+		interest_nodes.erase(E->get());
+		for (Map<int, InterestPeer>::Element *F = interest_peers.front(); F; F = F->next()) {
+			F->get().relevant.erase(E->get());
+		}
+	}
+
+	// Peers with a new origin are updated right away, the others in turns.
+	const int peer_count = interest_peers.size();
+	const int budget = interest_update_budget > 0 ? MIN(interest_update_budget, peer_count) : peer_count;
+	const int first = interest_update_cursor % peer_count;
+	LocalVector<int> to_update;
+	int index = 0;
+	for (Map<int, InterestPeer>::Element *E = interest_peers.front(); E; E = E->next(), index++) {
+		const int turn = (index - first + peer_count) % peer_count;
+		if (turn < budget || E->get().dirty) {
+			to_update.push_back(E->key());
+		}
+	}
+	interest_update_cursor = (first + budget) % peer_count;
+
+	for (uint32_t i = 0; i < to_update.size(); i++) {
+		// Looked up again, since signal callbacks may have removed the peer.
+		Map<int, InterestPeer>::Element *E = interest_peers.find(to_update[i]);
+		if (E) {
+			_update_peer_interest(E->key(), E->get(), grid, cell_size);
+		}
+	}
+}
+
+bool MultiplayerAPI::_is_relevant(ObjectID p_node, int p_peer) const {
+	if (!interest_nodes.has(p_node)) {
+		return true;
+	}
+	const Map<int, InterestPeer>::Element *E = interest_peers.find(p_peer);
+	if (!E) {
+		return true; // No origin, the peer sees everything.
+	}
+	return E->get().relevant.has(p_node);
+}
+
+void MultiplayerAPI::interest_add(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	interest_nodes.insert(p_node->get_instance_id());
+}
+
+void MultiplayerAPI::interest_remove(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	const ObjectID id = p_node->get_instance_id();
+	interest_nodes.erase(id);
+	for (Map<int, InterestPeer>::Element *E = interest_peers.front(); E; E = E->next()) {
+		E->get().relevant.erase(id);
+	}
+}
+
+void MultiplayerAPI::interest_set_peer_origin(int p_peer, Node *p_origin) {
+	if (!p_origin) {
+		interest_peers.erase(p_peer);
+		return;
+	}
+	InterestPeer &interest = interest_peers[p_peer];
+	interest.origin = p_origin->get_instance_id();
+	interest.dirty = true;
+}
+
+bool MultiplayerAPI::interest_is_relevant(Node *p_node, int p_peer) const {
+	ERR_FAIL_NULL_V(p_node, false);
+	return _is_relevant(p_node->get_instance_id(), p_peer);
+}
+
+void MultiplayerAPI::set_interest_radius(float p_radius) {
+	ERR_FAIL_COND(p_radius <= 0);
+	interest_radius = p_radius;
+}
+
+float MultiplayerAPI::get_interest_radius() const {
+	return interest_radius;
+}
+
+void MultiplayerAPI::set_interest_update_budget(int p_peers) {
+	ERR_FAIL_COND(p_peers < 0);
+	interest_update_budget = p_peers;
+}
+
+int MultiplayerAPI::get_interest_update_budget() const {
+	return interest_update_budget;
+}
+
+// Replication.
+// Properties are sent unreliably, and only when their (quantized) value differs
+// from the last value acknowledged by the receiving peer.
+// Packet format: [command][sequence:u32] followed by node blocks, each being
+// [path id:u32][property count:u8] and, for every property, [index:u8][value].
+
+static int _replication_get_component_count(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::FLOAT:
+			return 1;
+		case Variant::VECTOR2:
+			return 2;
+		case Variant::VECTOR3:
+			return 3;
+		case Variant::QUAT:
+			return 4;
+		case Variant::TRANSFORM2D:
+			return 6;
+		case Variant::TRANSFORM:
+			return 12;
+		default:
+			return 0;
+	}
+}
+
+static int _replication_get_components(const Variant &p_value, real_t *r_components) {
+	switch (p_value.get_type()) {
+		case Variant::FLOAT: {
+			r_components[0] = p_value;
+			return 1;
+		}
+		case Variant::VECTOR2: {
+			const Vector2 v = p_value;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			return 2;
+		}
+		case Variant::VECTOR3: {
+			const Vector3 v = p_value;
+			for (int i = 0; i < 3; i++) {
+				r_components[i] = v[i];
+			}
+			return 3;
+		}
+		case Variant::QUAT: {
+			const Quat q = p_value;
+			r_components[0] = q.x;
+			r_components[1] = q.y;
+			r_components[2] = q.z;
+			r_components[3] = q.w;
+			return 4;
+		}
+		case Variant::TRANSFORM2D: {
+			const Transform2D t = p_value;
+			for (int i = 0; i < 3; i++) {
+				r_components[i * 2 + 0] = t.elements[i].x;
+				r_components[i * 2 + 1] = t.elements[i].y;
+			}
+			return 6;
+		}
+		case Variant::TRANSFORM: {
+			const Transform t = p_value;
+			for (int i = 0; i < 3; i++) {
+				for (int j = 0; j < 3; j++) {
+					r_components[i * 3 + j] = t.basis.elements[i][j];
+				}
+				r_components[9 + i] = t.origin[i];
+			}
+			return 12;
+		}
+		default: {
+			return 0;
+		}
+	}
+}
+
+static Variant _replication_make_value(Variant::Type p_type, const real_t *p_components) {
+	switch (p_type) {
+		case Variant::FLOAT: {
+			return p_components[0];
+		}
+		case Variant::VECTOR2: {
+			return Vector2(p_components[0], p_components[1]);
+		}
+		case Variant::VECTOR3: {
+			return Vector3(p_components[0], p_components[1], p_components[2]);
+		}
+		case Variant::QUAT: {
+			return Quat(p_components[0], p_components[1], p_components[2], p_components[3]);
+		}
+		case Variant::TRANSFORM2D: {
+			Transform2D t;
+			for (int i = 0; i < 3; i++) {
+				t.elements[i] = Vector2(p_components[i * 2 + 0], p_components[i * 2 + 1]);
+			}
+			return t;
+		}
+		case Variant::TRANSFORM: {
+			Transform t;
+			for (int i = 0; i < 3; i++) {
+				for (int j = 0; j < 3; j++) {
+					t.basis.elements[i][j] = p_components[i * 3 + j];
+				}
+				t.origin[i] = p_components[9 + i];
+			}
+			return t;
+		}
+		default: {
+			return Variant();
+		}
+	}
+}
+
+Variant MultiplayerAPI::_replication_quantize(const Variant &p_value, ReplicationQuantization p_quantization) const {
+	if (p_quantization == REPLICATION_QUANTIZATION_NONE) {
+		return p_value;
+	}
+
+	real_t components[12];
+	const int count = _replication_get_components(p_value, components);
+	if (count == 0) {
+		return p_value; // Not a floating point type, sent as is.
+	}
+	for (int i = 0; i < count; i++) {
+		components[i] = Math::half_to_float(Math::make_half_float(components[i]));
+	}
+	return _replication_make_value(p_value.get_type(), components);
+}
+
+Error MultiplayerAPI::_replication_encode(const Variant &p_value, ReplicationQuantization p_quantization, uint8_t *r_buffer, int &r_len) {
+	if (p_quantization == REPLICATION_QUANTIZATION_HALF) {
+		real_t components[12];
+		const int count = _replication_get_components(p_value, components);
+		if (count > 0) {
+			// Type byte followed by half floats.
+			r_len = 1 + count * 2;
+			if (r_buffer) {
+				r_buffer[0] = p_value.get_type();
+				for (int i = 0; i < count; i++) {
+					encode_uint16(Math::make_half_float(components[i]), &r_buffer[1 + i * 2]);
+				}
+			}
+			return OK;
+		}
+		// Not quantizable, fall back to the full encoding.
+		if (r_buffer) {
+			r_buffer[0] = UINT8_MAX;
+			r_buffer += 1;
+		}
+		Error err = _encode_and_compress_variant(p_value, r_buffer, r_len);
+		r_len += 1;
+		return err;
+	}
+	return _encode_and_compress_variant(p_value, r_buffer, r_len);
+}
+
+Error MultiplayerAPI::_replication_decode(Variant &r_value, ReplicationQuantization p_quantization, const uint8_t *p_buffer, int p_len, int &r_len) {
+	if (p_quantization == REPLICATION_QUANTIZATION_HALF) {
+		ERR_FAIL_COND_V(p_len < 1, ERR_INVALID_DATA);
+		if (p_buffer[0] == UINT8_MAX) {
+			Error err = _decode_and_decompress_variant(r_value, p_buffer + 1, p_len - 1, &r_len);
+			r_len += 1;
+			return err;
+		}
+
+		const Variant::Type type = Variant::Type(p_buffer[0]);
+		const int count = _replication_get_component_count(type);
+		ERR_FAIL_COND_V(count == 0, ERR_INVALID_DATA);
+		r_len = 1 + count * 2;
+		ERR_FAIL_COND_V(p_len < r_len, ERR_INVALID_DATA);
+
+		real_t components[12];
+		for (int i = 0; i < count; i++) {
+			components[i] = Math::half_to_float(decode_uint16(&p_buffer[1 + i * 2]));
+		}
+		r_value = _replication_make_value(type, components);
+		return OK;
+	}
+	return _decode_and_decompress_variant(r_value, p_buffer, p_len, &r_len);
+}
+
+void MultiplayerAPI::_discard_replication_snapshot(ReplicationPeer &p_state, const ReplicationSnapshot &p_snapshot) {
+	// The snapshot was never acknowledged, so the peer may or may not have
+	// applied it. Forget the baseline of its properties to force a resend.
+	for (int i = 0; i < p_snapshot.entries.size(); i++) {
+		const ReplicationSnapshot::Entry &entry = p_snapshot.entries[i];
+		Map<ObjectID, Vector<Variant>>::Element *E = p_state.baselines.find(entry.node);
+		if (E && entry.property < E->get().size()) {
+			E->get().write[entry.property] = Variant();
+		}
+	}
+}
+
+void MultiplayerAPI::_send_replication_packet(int p_peer, ReplicationPeer &p_state, ReplicationSnapshot &p_snapshot, int p_len) {
+	p_snapshot.sequence = p_state.next_sequence++;
+	p_snapshot.time = OS::get_singleton()->get_ticks_msec();
+	encode_uint32(p_snapshot.sequence, &packet_cache.write[1]);
+
+#ifdef DEBUG_ENABLED
+	_profile_bandwidth_data("out", p_len);
+#endif
+
+	network_peer->set_target_peer(p_peer);
+	network_peer->set_transfer_mode(NetworkedMultiplayerPeer::TRANSFER_MODE_UNRELIABLE);
+	network_peer->put_packet(packet_cache.ptr(), p_len);
+
+	p_state.in_flight.push_back(p_snapshot);
+	if (p_state.in_flight.size() > REPLICATION_MAX_IN_FLIGHT) {
+		_discard_replication_snapshot(p_state, p_state.in_flight.front()->get());
+		p_state.in_flight.pop_front();
+	}
+	if (replication_bandwidth_limit > 0) {
+		p_state.budget -= p_len;
+	}
+
+	p_snapshot.entries.clear();
+}
+
+void MultiplayerAPI::_send_replication_to_peer(int p_peer, ReplicationPeer &p_state) {
+	// Expire snapshots whose acknowledgement is likely lost.
+	const uint64_t time = OS::get_singleton()->get_ticks_msec();
+	while (p_state.in_flight.size() && time - p_state.in_flight.front()->get().time > REPLICATION_SNAPSHOT_TIMEOUT_MSEC) {
+		_discard_replication_snapshot(p_state, p_state.in_flight.front()->get());
+		p_state.in_flight.pop_front();
+	}
+
+	struct Candidate {
+		Node *node = nullptr;
+		const ReplicatedNode *config = nullptr;
+		float priority = 0;
+		Vector<int> properties;
+		Vector<Variant> values;
+
+		bool operator<(const Candidate &p_other) const { return priority > p_other.priority; }
+	};
+
+	// Gather the nodes this peer is master of and which changed since the last acknowledged state.
+	const int unique_id = network_peer->get_unique_id();
+	Vector<Candidate> candidates;
+	for (Map<ObjectID, ReplicatedNode>::Element *E = replicated_nodes.front(); E; E = E->next()) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(E->key()));
+		if (!node || !node->is_inside_tree() || node->get_network_master() != unique_id || !root_node->is_a_parent_of(node) || !_is_relevant(E->key(), p_peer)) {
+			continue;
+		}
+
+		const ReplicatedNode &config = E->get();
+		Vector<Variant> &baseline = p_state.baselines[E->key()];
+		if (baseline.size() != config.properties.size()) {
+			baseline.resize(config.properties.size());
+		}
+
+		Candidate candidate;
+		for (int i = 0; i < config.properties.size(); i++) {
+			const ReplicatedProperty &property = config.properties[i];
+			const Variant value = _replication_quantize(node->get(property.name), property.quantization);
+			if (value != baseline[i]) {
+				candidate.properties.push_back(i);
+				candidate.values.push_back(value);
+			}
+		}
+		if (candidate.properties.is_empty()) {
+			continue;
+		}
+
+		// Nodes left out because of the bandwidth limit gain priority until they are sent.
+		float &priority = p_state.accumulated_priority[E->key()];
+		priority += config.priority;
+
+		candidate.node = node;
+		candidate.config = &config;
+		candidate.priority = priority;
+		candidates.push_back(candidate);
+	}
+
+	if (candidates.is_empty()) {
+		return;
+	}
+	candidates.sort();
+
+	const int header_size = 1 + 4;
+	if (packet_cache.size() < REPLICATION_MAX_PACKET_SIZE) {
+		packet_cache.resize(REPLICATION_MAX_PACKET_SIZE);
+	}
+	packet_cache.write[0] = NETWORK_COMMAND_REPLICATE;
+	int ofs = header_size;
+	ReplicationSnapshot snapshot;
+
+	for (int i = 0; i < candidates.size(); i++) {
+		if (replication_bandwidth_limit > 0 && p_state.budget - ofs <= 0) {
+			break;
+		}
+		const Candidate &candidate = candidates[i];
+
+		NodePath path = root_node->get_path().rel_path_to(candidate.node->get_path());
+		PathSentCache *psc = path_send_cache.getptr(path);
+		if (!psc) {
+			path_send_cache[path] = PathSentCache();
+			psc = path_send_cache.getptr(path);
+			psc->id = last_send_cache_id++;
+		}
+		if (!_send_confirm_path(candidate.node, path, psc, p_peer)) {
+			continue; // Sent once the peer confirms the path.
+		}
+
+		// Compute the block size first, so it's never split across packets.
+		int block_size = 4 + 1;
+		for (int j = 0; j < candidate.properties.size(); j++) {
+			int len = 0;
+			Error err = _replication_encode(candidate.values[j], candidate.config->properties[candidate.properties[j]].quantization, nullptr, len);
+			ERR_FAIL_COND(err != OK);
+			block_size += 1 + len;
+		}
+		ERR_CONTINUE_MSG(header_size + block_size > REPLICATION_MAX_PACKET_SIZE, "Replicated properties of node '" + String(path) + "' exceed the maximum packet size.");
+
+		if (ofs + block_size > REPLICATION_MAX_PACKET_SIZE) {
+			_send_replication_packet(p_peer, p_state, snapshot, ofs);
+			ofs = header_size;
+		}
+
+		ofs += encode_uint32(psc->id, &packet_cache.write[ofs]);
+		packet_cache.write[ofs++] = candidate.properties.size();
+		for (int j = 0; j < candidate.properties.size(); j++) {
+			const int property = candidate.properties[j];
+			int len = 0;
+			packet_cache.write[ofs++] = property;
+			_replication_encode(candidate.values[j], candidate.config->properties[property].quantization, &packet_cache.write[ofs], len);
+			ofs += len;
+
+			ReplicationSnapshot::Entry entry;
+			entry.node = candidate.node->get_instance_id();
+			entry.property = property;
+			entry.value = candidate.values[j];
+			snapshot.entries.push_back(entry);
+		}
+		p_state.accumulated_priority[candidate.node->get_instance_id()] = 0;
+	}
+
+	if (ofs > header_size) {
+		_send_replication_packet(p_peer, p_state, snapshot, ofs);
+	}
+}
+
+void MultiplayerAPI::_send_replication() {
+	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+	const float delta = replication_last_ticks ? (ticks - replication_last_ticks) / 1000000.0 : 0.0;
+	replication_last_ticks = ticks;
+
+	if (replicated_nodes.is_empty() || network_peer->get_connection_status() != NetworkedMultiplayerPeer::CONNECTION_CONNECTED) {
+		return;
+	}
+
+	// Forget nodes which have been freed.
+	List<ObjectID> freed;
+	for (Map<ObjectID, ReplicatedNode>::Element *E = replicated_nodes.front(); E; E = E->next()) {
+		if (!ObjectDB::get_instance(E->key())) {
+			freed.push_back(E->key());
+		}
+	}
+	for (List<ObjectID>::Element *E = freed.front(); E; E = E->next()) {
+		replicated_nodes.erase(E->get());
+		for (Map<int, ReplicationPeer>::Element *F = replication_peers.front(); F; F = F->next()) {
+			F->get().baselines.erase(E->get());
+			F->get().accumulated_priority.erase(E->get());
+		}
+	}
+
+	for (Set<int>::Element *E = connected_peers.front(); E; E = E->next()) {
+		ReplicationPeer &state = replication_peers[E->get()];
+		if (replication_bandwidth_limit > 0) {
+			// Allow bursts of up to one second worth of data.
+			state.budget = MIN(state.budget + replication_bandwidth_limit * delta, (float)replication_bandwidth_limit);
+			if (state.budget <= 0) {
+				continue;
+			}
+		}
+		_send_replication_to_peer(E->get(), state);
+	}
+}
+
+void MultiplayerAPI::_process_replicate(int p_from, const uint8_t *p_packet, int p_packet_len) {
+	ERR_FAIL_COND_MSG(p_packet_len < 5, "Invalid packet received. Size too small.");
+
+	const uint32_t sequence = decode_uint32(&p_packet[1]);
+	ReplicationPeer &state = replication_peers[p_from];
+	if (sequence <= state.last_received_sequence) {
+		return; // Older than the last applied snapshot, discard it.
+	}
+	state.last_received_sequence = sequence;
+
+	int ofs = 5;
+	while (ofs < p_packet_len) {
+		ERR_FAIL_COND_MSG(ofs + 5 > p_packet_len, "Invalid packet received. Size too small.");
+		const uint32_t node_id = decode_uint32(&p_packet[ofs]);
+		const int count = p_packet[ofs + 4];
+		ofs += 5;
+
+		Node *node = _process_get_node(p_from, p_packet, node_id & 0x7FFFFFFF, p_packet_len);
+		ERR_FAIL_COND_MSG(node == nullptr, "Invalid packet received. Requested node was not found.");
+		Map<ObjectID, ReplicatedNode>::Element *E = replicated_nodes.find(node->get_instance_id());
+		ERR_FAIL_COND_MSG(!E, "Invalid packet received. Node '" + String(node->get_path()) + "' is not configured for replication.");
+		const Vector<ReplicatedProperty> &properties = E->get().properties;
+		const bool from_master = node->get_network_master() == p_from;
+
+		for (int i = 0; i < count; i++) {
+			ERR_FAIL_COND_MSG(ofs >= p_packet_len, "Invalid packet received. Size too small.");
+			const int property = p_packet[ofs];
+			ofs += 1;
+			ERR_FAIL_INDEX_MSG(property, properties.size(), "Invalid packet received. Replicated property index out of range.");
+
+			Variant value;
+			int len = 0;
+			Error err = _replication_decode(value, properties[property].quantization, &p_packet[ofs], p_packet_len - ofs, len);
+			ERR_FAIL_COND_MSG(err != OK, "Invalid packet received. Unable to decode replicated property.");
+			ofs += len;
+
+			if (from_master) {
+				node->set(properties[property].name, value);
+			}
+		}
+		if (!from_master) {
+			ERR_PRINT("Replicated state for node '" + String(node->get_path()) + "' received from peer " + itos(p_from) + ", which is not its network master.");
+		}
+	}
+
+	uint8_t ack[5];
+	ack[0] = NETWORK_COMMAND_REPLICATE_ACK;
+	encode_uint32(sequence, &ack[1]);
+	network_peer->set_target_peer(p_from);
+	network_peer->set_transfer_mode(NetworkedMultiplayerPeer::TRANSFER_MODE_UNRELIABLE);
+	network_peer->put_packet(ack, 5);
+}
+
+void MultiplayerAPI::_process_replicate_ack(int p_from, const uint8_t *p_packet, int p_packet_len) {
+	ERR_FAIL_COND_MSG(p_packet_len < 5, "Invalid packet received. Size too small.");
+
+	const uint32_t sequence = decode_uint32(&p_packet[1]);
+	Map<int, ReplicationPeer>::Element *E = replication_peers.find(p_from);
+	if (!E) {
+		return;
+	}
+	ReplicationPeer &state = E->get();
+
+	// Snapshots older than the acknowledged one were lost or discarded by the receiver.
+	while (state.in_flight.size() && state.in_flight.front()->get().sequence <= sequence) {
+		const ReplicationSnapshot &snapshot = state.in_flight.front()->get();
+		if (snapshot.sequence < sequence) {
+			_discard_replication_snapshot(state, snapshot);
+		} else {
+			for (int i = 0; i < snapshot.entries.size(); i++) {
+				const ReplicationSnapshot::Entry &entry = snapshot.entries[i];
+				Map<ObjectID, Vector<Variant>>::Element *F = state.baselines.find(entry.node);
+				if (F && entry.property < F->get().size()) {
+					F->get().write[entry.property] = entry.value;
+				}
+			}
+		}
+		state.in_flight.pop_front();
+	}
+}
+
+void MultiplayerAPI::replication_add(Node *p_node, const StringName &p_property, ReplicationQuantization p_quantization) {
+	ERR_FAIL_NULL(p_node);
+	ReplicatedNode &config = replicated_nodes[p_node->get_instance_id()];
+	for (int i = 0; i < config.properties.size(); i++) {
+		ERR_FAIL_COND_MSG(config.properties[i].name == p_property, "Property '" + String(p_property) + "' is already replicated.");
+	}
+	ERR_FAIL_COND_MSG(config.properties.size() >= UINT8_MAX, "Too many replicated properties for a single node.");
+
+	ReplicatedProperty property;
+	property.name = p_property;
+	property.quantization = p_quantization;
+	config.properties.push_back(property);
+}
+
+void MultiplayerAPI::replication_remove(Node *p_node, const StringName &p_property) {
+	ERR_FAIL_NULL(p_node);
+	const ObjectID id = p_node->get_instance_id();
+	Map<ObjectID, ReplicatedNode>::Element *E = replicated_nodes.find(id);
+	ERR_FAIL_COND_MSG(!E, "Node is not replicated.");
+
+	Vector<ReplicatedProperty> &properties = E->get().properties;
+	for (int i = 0; i < properties.size(); i++) {
+		if (properties[i].name == p_property) {
+			properties.remove(i);
+			break;
+		}
+	}
+	if (properties.is_empty()) {
+		replicated_nodes.erase(E);
+	}
+
+	// Property indices changed, drop the per-peer state of this node.
+	for (Map<int, ReplicationPeer>::Element *F = replication_peers.front(); F; F = F->next()) {
+		F->get().baselines.erase(id);
+		F->get().accumulated_priority.erase(id);
+	}
+}
+
+void MultiplayerAPI::replication_set_priority(Node *p_node, float p_priority) {
+	ERR_FAIL_NULL(p_node);
+	Map<ObjectID, ReplicatedNode>::Element *E = replicated_nodes.find(p_node->get_instance_id());
+	ERR_FAIL_COND_MSG(!E, "Node is not replicated.");
+	E->get().priority = p_priority;
+}
+
+float MultiplayerAPI::replication_get_priority(Node *p_node) const {
+	ERR_FAIL_NULL_V(p_node, 0);
+	const Map<ObjectID, ReplicatedNode>::Element *E = replicated_nodes.find(p_node->get_instance_id());
+	ERR_FAIL_COND_V_MSG(!E, 0, "Node is not replicated.");
+	return E->get().priority;
+}
+
+void MultiplayerAPI::set_replication_bandwidth_limit(int p_bytes_per_second) {
+	ERR_FAIL_COND(p_bytes_per_second < 0);
+	replication_bandwidth_limit = p_bytes_per_second;
+}
+
+int MultiplayerAPI::get_replication_bandwidth_limit() const {
+	return replication_bandwidth_limit;
 }
 
 void MultiplayerAPI::_add_peer(int p_id) {
@@ -990,6 +1874,10 @@ void MultiplayerAPI::_del_peer(int p_id) {
 		PathSentCache *psc = path_send_cache.getptr(E->get());
 		psc->confirmed_peers.erase(p_id);
 	}
+	rpc_batches[0].erase(p_id);
+	rpc_batches[1].erase(p_id);
+	interest_peers.erase(p_id);
+	replication_peers.erase(p_id);
 	emit_signal("network_peer_disconnected", p_id);
 }
 
@@ -1140,6 +2028,9 @@ Error MultiplayerAPI::send_bytes(Vector<uint8_t> p_data, int p_to, NetworkedMult
 	ERR_FAIL_COND_V_MSG(!network_peer.is_valid(), ERR_UNCONFIGURED, "Trying to send a raw packet while no network peer is active.");
 	ERR_FAIL_COND_V_MSG(network_peer->get_connection_status() != NetworkedMultiplayerPeer::CONNECTION_CONNECTED, ERR_UNCONFIGURED, "Trying to send a raw packet via a network peer which is not connected.");
 
+	// Keep raw packets ordered after the batched RPCs.
+	flush_rpc_batches();
+
 	MAKE_ROOM(p_data.size() + 1);
 	const uint8_t *r = p_data.ptr();
 	packet_cache.write[0] = NETWORK_COMMAND_RAW;
@@ -1222,16 +2113,39 @@ void MultiplayerAPI::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_refusing_new_network_connections"), &MultiplayerAPI::is_refusing_new_network_connections);
 	ClassDB::bind_method(D_METHOD("set_allow_object_decoding", "enable"), &MultiplayerAPI::set_allow_object_decoding);
 	ClassDB::bind_method(D_METHOD("is_object_decoding_allowed"), &MultiplayerAPI::is_object_decoding_allowed);
+	ClassDB::bind_method(D_METHOD("set_rpc_batching", "enable"), &MultiplayerAPI::set_rpc_batching);
+	ClassDB::bind_method(D_METHOD("is_rpc_batching"), &MultiplayerAPI::is_rpc_batching);
+	ClassDB::bind_method(D_METHOD("flush_rpc_batches"), &MultiplayerAPI::flush_rpc_batches);
+	ClassDB::bind_method(D_METHOD("interest_add", "node"), &MultiplayerAPI::interest_add);
+	ClassDB::bind_method(D_METHOD("interest_remove", "node"), &MultiplayerAPI::interest_remove);
+	ClassDB::bind_method(D_METHOD("interest_set_peer_origin", "id", "origin"), &MultiplayerAPI::interest_set_peer_origin);
+	ClassDB::bind_method(D_METHOD("interest_is_relevant", "node", "id"), &MultiplayerAPI::interest_is_relevant);
+	ClassDB::bind_method(D_METHOD("set_interest_radius", "radius"), &MultiplayerAPI::set_interest_radius);
+	ClassDB::bind_method(D_METHOD("get_interest_radius"), &MultiplayerAPI::get_interest_radius);
+	ClassDB::bind_method(D_METHOD("set_interest_update_budget", "peers"), &MultiplayerAPI::set_interest_update_budget);
+	ClassDB::bind_method(D_METHOD("get_interest_update_budget"), &MultiplayerAPI::get_interest_update_budget);
+	ClassDB::bind_method(D_METHOD("replication_add", "node", "property", "quantization"), &MultiplayerAPI::replication_add, DEFVAL(REPLICATION_QUANTIZATION_NONE));
+	ClassDB::bind_method(D_METHOD("replication_remove", "node", "property"), &MultiplayerAPI::replication_remove);
+	ClassDB::bind_method(D_METHOD("replication_set_priority", "node", "priority"), &MultiplayerAPI::replication_set_priority);
+	ClassDB::bind_method(D_METHOD("replication_get_priority", "node"), &MultiplayerAPI::replication_get_priority);
+	ClassDB::bind_method(D_METHOD("set_replication_bandwidth_limit", "bytes_per_second"), &MultiplayerAPI::set_replication_bandwidth_limit);
+	ClassDB::bind_method(D_METHOD("get_replication_bandwidth_limit"), &MultiplayerAPI::get_replication_bandwidth_limit);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "allow_object_decoding"), "set_allow_object_decoding", "is_object_decoding_allowed");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "refuse_new_network_connections"), "set_refuse_new_network_connections", "is_refusing_new_network_connections");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "network_peer", PROPERTY_HINT_RESOURCE_TYPE, "NetworkedMultiplayerPeer", 0), "set_network_peer", "get_network_peer");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "root_node", PROPERTY_HINT_RESOURCE_TYPE, "Node", 0), "set_root_node", "get_root_node");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_radius", PROPERTY_HINT_RANGE, "0.01,10000,0.01,or_greater"), "set_interest_radius", "get_interest_radius");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "interest_update_budget", PROPERTY_HINT_RANGE, "0,256,1,or_greater"), "set_interest_update_budget", "get_interest_update_budget");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "rpc_batching"), "set_rpc_batching", "is_rpc_batching");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "replication_bandwidth_limit", PROPERTY_HINT_RANGE, "0,1048576,1,or_greater"), "set_replication_bandwidth_limit", "get_replication_bandwidth_limit");
 	ADD_PROPERTY_DEFAULT("refuse_new_network_connections", false);
 
 	ADD_SIGNAL(MethodInfo("network_peer_connected", PropertyInfo(Variant::INT, "id")));
 	ADD_SIGNAL(MethodInfo("network_peer_disconnected", PropertyInfo(Variant::INT, "id")));
 	ADD_SIGNAL(MethodInfo("network_peer_packet", PropertyInfo(Variant::INT, "id"), PropertyInfo(Variant::PACKED_BYTE_ARRAY, "packet")));
+	ADD_SIGNAL(MethodInfo("interest_entered", PropertyInfo(Variant::INT, "id"), PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
+	ADD_SIGNAL(MethodInfo("interest_exited", PropertyInfo(Variant::INT, "id"), PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
 	ADD_SIGNAL(MethodInfo("connected_to_server"));
 	ADD_SIGNAL(MethodInfo("connection_failed"));
 	ADD_SIGNAL(MethodInfo("server_disconnected"));
@@ -1243,6 +2157,9 @@ void MultiplayerAPI::_bind_methods() {
 	BIND_ENUM_CONSTANT(RPC_MODE_REMOTESYNC);
 	BIND_ENUM_CONSTANT(RPC_MODE_MASTERSYNC);
 	BIND_ENUM_CONSTANT(RPC_MODE_PUPPETSYNC);
+
+	BIND_ENUM_CONSTANT(REPLICATION_QUANTIZATION_NONE);
+	BIND_ENUM_CONSTANT(REPLICATION_QUANTIZATION_HALF);
 }
 
 MultiplayerAPI::MultiplayerAPI() {
@@ -33,10 +33,17 @@
 
 #include "core/io/networked_multiplayer_peer.h"
 #include "core/object/reference.h"
+#include "core/templates/local_vector.h"
 
 class MultiplayerAPI : public Reference {
 	GDCLASS(MultiplayerAPI, Reference);
 
+public:
+	enum ReplicationQuantization {
+		REPLICATION_QUANTIZATION_NONE,
+		REPLICATION_QUANTIZATION_HALF,
+	};
+
 private:
 	//path sent caches
 	struct PathSentCache {
@@ -64,6 +71,78 @@ private:
 	Node *root_node = nullptr;
 	bool allow_object_decoding = false;
 
+	// Replication. The configuration must be the same, and added in the same
+	// order, on every peer, as properties are referenced by index.
+	struct ReplicatedProperty {
+		StringName name;
+		ReplicationQuantization quantization = REPLICATION_QUANTIZATION_NONE;
+	};
+
+	struct ReplicatedNode {
+		Vector<ReplicatedProperty> properties;
+		float priority = 1.0;
+	};
+
+	// Values sent in a packet, promoted to the peer baseline once acknowledged.
+	struct ReplicationSnapshot {
+		struct Entry {
+			ObjectID node;
+			int property = 0;
+			Variant value;
+		};
+
+		uint32_t sequence = 0;
+		uint64_t time = 0;
+		Vector<Entry> entries;
+	};
+
+	struct ReplicationPeer {
+		uint32_t next_sequence = 1;
+		uint32_t last_received_sequence = 0;
+		float budget = 0;
+		Map<ObjectID, Vector<Variant>> baselines;
+		Map<ObjectID, float> accumulated_priority;
+		List<ReplicationSnapshot> in_flight;
+	};
+
+	enum {
+		REPLICATION_MAX_PACKET_SIZE = 1200,
+		REPLICATION_MAX_IN_FLIGHT = 64,
+		REPLICATION_SNAPSHOT_TIMEOUT_MSEC = 1000,
+	};
+
+	// Outgoing RPC batches, per transfer mode (reliable, unreliable) and peer.
+	enum {
+		RPC_BATCH_MAX_SIZE = 1200,
+	};
+
+	bool rpc_batching = false;
+	Map<int, LocalVector<uint8_t>> rpc_batches[2];
+
+	// Interest management. Nodes registered with interest_add() are only sent
+	// to the peers whose origin is within interest_radius of them.
+	struct InterestPeer {
+		ObjectID origin;
+		bool dirty = true;
+		Set<ObjectID> relevant;
+	};
+
+	struct InterestEntry {
+		ObjectID node;
+		Vector3 position;
+	};
+
+	Set<ObjectID> interest_nodes;
+	Map<int, InterestPeer> interest_peers;
+	float interest_radius = 100.0;
+	int interest_update_budget = 16;
+	int interest_update_cursor = 0;
+
+	Map<ObjectID, ReplicatedNode> replicated_nodes;
+	Map<int, ReplicationPeer> replication_peers;
+	int replication_bandwidth_limit = 0;
+	uint64_t replication_last_ticks = 0;
+
 protected:
 	static void _bind_methods();
 
@@ -74,9 +153,28 @@ protected:
 	void _process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
 	void _process_rset(Node *p_node, const uint16_t p_rpc_property_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
 	void _process_raw(int p_from, const uint8_t *p_packet, int p_packet_len);
+	void _process_batch(int p_from, const uint8_t *p_packet, int p_packet_len);
+	void _process_replicate(int p_from, const uint8_t *p_packet, int p_packet_len);
+	void _process_replicate_ack(int p_from, const uint8_t *p_packet, int p_packet_len);
 
 	void _send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p_set, const StringName &p_name, const Variant **p_arg, int p_argcount);
 	bool _send_confirm_path(Node *p_node, NodePath p_path, PathSentCache *psc, int p_target);
+	void _send_rpc_packet(int p_to, bool p_unreliable, const uint8_t *p_packet, int p_packet_len);
+	void _batch_rpc_packet(int p_peer, bool p_unreliable, const uint8_t *p_packet, int p_packet_len);
+	void _flush_rpc_batch(int p_peer, bool p_unreliable, LocalVector<uint8_t> &p_batch);
+	void _flush_rpc_batches(int p_to, bool p_unreliable);
+	void _update_interest();
+	void _update_peer_interest(int p_peer, InterestPeer &p_interest, const HashMap<uint64_t, LocalVector<InterestEntry>> &p_grid, float p_cell_size);
+	bool _is_relevant(ObjectID p_node, int p_peer) const;
+
+	void _send_replication();
+	void _send_replication_to_peer(int p_peer, ReplicationPeer &p_state);
+	void _send_replication_packet(int p_peer, ReplicationPeer &p_state, ReplicationSnapshot &p_snapshot, int p_len);
+	void _discard_replication_snapshot(ReplicationPeer &p_state, const ReplicationSnapshot &p_snapshot);
+
+	Variant _replication_quantize(const Variant &p_value, ReplicationQuantization p_quantization) const;
+	Error _replication_encode(const Variant &p_value, ReplicationQuantization p_quantization, uint8_t *r_buffer, int &r_len);
+	Error _replication_decode(Variant &r_value, ReplicationQuantization p_quantization, const uint8_t *p_buffer, int p_len, int &r_len);
 
 	Error _encode_and_compress_variant(const Variant &p_variant, uint8_t *p_buffer, int &r_len);
 	Error _decode_and_decompress_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len);
@@ -88,6 +186,9 @@ public:
 		NETWORK_COMMAND_SIMPLIFY_PATH,
 		NETWORK_COMMAND_CONFIRM_PATH,
 		NETWORK_COMMAND_RAW,
+		NETWORK_COMMAND_REPLICATE,
+		NETWORK_COMMAND_REPLICATE_ACK,
+		NETWORK_COMMAND_BATCH,
 	};
 
 	enum NetworkNodeIdCompression {
@@ -141,10 +242,31 @@ public:
 	void set_allow_object_decoding(bool p_enable);
 	bool is_object_decoding_allowed() const;
 
+	void set_rpc_batching(bool p_enable);
+	bool is_rpc_batching() const;
+	void flush_rpc_batches();
+
+	void interest_add(Node *p_node);
+	void interest_remove(Node *p_node);
+	void interest_set_peer_origin(int p_peer, Node *p_origin);
+	bool interest_is_relevant(Node *p_node, int p_peer) const;
+	void set_interest_radius(float p_radius);
+	float get_interest_radius() const;
+	void set_interest_update_budget(int p_peers);
+	int get_interest_update_budget() const;
+
+	void replication_add(Node *p_node, const StringName &p_property, ReplicationQuantization p_quantization = REPLICATION_QUANTIZATION_NONE);
+	void replication_remove(Node *p_node, const StringName &p_property);
+	void replication_set_priority(Node *p_node, float p_priority);
+	float replication_get_priority(Node *p_node) const;
+	void set_replication_bandwidth_limit(int p_bytes_per_second);
+	int get_replication_bandwidth_limit() const;
+
 	MultiplayerAPI();
 	~MultiplayerAPI();
 };
 
 VARIANT_ENUM_CAST(MultiplayerAPI::RPCMode);
+VARIANT_ENUM_CAST(MultiplayerAPI::ReplicationQuantization);
 
 #endif // MULTIPLAYER_API_H
@@ -77,4 +77,30 @@ public:
 	virtual Error leave_multicast_group(const IP_Address &p_multi_address, String p_if_name) = 0;
 };
 
+// Readiness notification for many sockets with a single system call
+// (epoll, kqueue or poll depending on the platform).
+class NetSocketPoller : public Reference {
+protected:
+	static NetSocketPoller *(*_create)();
+
+public:
+	static NetSocketPoller *create();
+
+	struct Event {
+		uint64_t id = 0;
+		bool readable = false;
+		bool writable = false;
+		bool error = false; // Hang up or socket error, reading will report it.
+	};
+
+	// Registers the socket under the given id, or updates its poll type if the id is already registered.
+	virtual Error add(const Ref<NetSocket> &p_socket, NetSocket::PollType p_type, uint64_t p_id) = 0;
+	virtual void remove(uint64_t p_id) = 0;
+	virtual bool has(uint64_t p_id) const = 0;
+	virtual int get_count() const = 0;
+	// Fills up to p_max_events events and returns their count, or -1 on failure.
+	// A negative timeout (in milliseconds) blocks until an event is available.
+	virtual int wait(Event *r_events, int p_max_events, int p_timeout) = 0;
+};
+
 #endif // NET_SOCKET_H
@@ -59,10 +59,7 @@ Error PacketPeer::get_packet_buffer(Vector<uint8_t> &r_buffer) {
 		return OK;
 	}
 
-	uint8_t *w = r_buffer.ptrw();
-	for (int i = 0; i < buffer_size; i++) {
-		w[i] = buffer[i];
-	}
+	copymem(r_buffer.ptrw(), buffer, buffer_size);
 
 	return OK;
 }
@@ -97,6 +97,10 @@ int PacketPeerUDP::get_available_packet_count() const {
 }
 
 Error PacketPeerUDP::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
+	// Release the previous packet, it might still be referenced in the ring buffer.
+	rb.advance_read(pending_release);
+	pending_release = 0;
+
 	Error err = _poll();
 	if (err != OK) {
 		return err;
@@ -111,9 +115,16 @@ Error PacketPeerUDP::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 	packet_ip.set_ipv6(ipv6);
 	rb.read((uint8_t *)&packet_port, 4, true);
 	rb.read((uint8_t *)&size, 4, true);
-	rb.read(packet_buffer, size, true);
+	const uint8_t *view = rb.peek_contiguous(size);
+	if (view) {
+		// Return the packet in place, without copying it.
+		pending_release = size;
+		*r_buffer = view;
+	} else {
+		rb.read(packet_buffer, size, true);
+		*r_buffer = packet_buffer;
+	}
 	--queue_count;
-	*r_buffer = packet_buffer;
 	r_buffer_size = size;
 	return OK;
 }
@@ -237,6 +248,8 @@ Error PacketPeerUDP::connect_to_host(const IP_Address &p_host, int p_port) {
 
 	// Flush any packet we might still have in queue.
 	rb.clear();
+	queue_count = 0;
+	pending_release = 0;
 	return OK;
 }
 
@@ -253,7 +266,9 @@ void PacketPeerUDP::close() {
 		_sock->close();
 	}
 	rb.resize(16);
+	rb.clear();
 	queue_count = 0;
+	pending_release = 0;
 	connected = false;
 }
 
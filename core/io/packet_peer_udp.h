@@ -51,6 +51,7 @@ protected:
 	IP_Address packet_ip;
 	int packet_port = 0;
 	int queue_count = 0;
+	int pending_release = 0; // Size of the last packet, returned in place from the ring buffer.
 
 	IP_Address peer_addr;
 	int peer_port = 0;
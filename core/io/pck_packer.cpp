@@ -31,6 +31,7 @@
 #include "pck_packer.h"
 
 #include "core/crypto/crypto_core.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/os/file_access.h"
@@ -48,7 +49,7 @@ static int _get_pad(int p_alignment, int p_n) {
 
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(0), DEFVAL(String()), DEFVAL(false));
-	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt", "compress"), &PCKPacker::add_file, DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
 
@@ -110,7 +111,7 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	return OK;
 }
 
-Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt) {
+Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt, bool p_compress) {
 	FileAccess *f = FileAccess::open(p_src, FileAccess::READ);
 	if (!f) {
 		return ERR_FILE_CANT_OPEN;
@@ -133,6 +134,18 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	}
 	pf.encrypted = p_encrypt;
 
+	if (p_compress) {
+		// Compressed up front, the directory written by flush() needs the stored size.
+		pf.compressed_data = FileAccessCompressed::compress_buffer(data.ptr(), data.size(), PACK_FILE_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_COMPRESSED_BLOCK_SIZE);
+		if (pf.compressed_data.is_empty()) {
+			f->close();
+			memdelete(f);
+			ERR_FAIL_V_MSG(ERR_CANT_CREATE, "Can't compress file '" + p_src + "'.");
+		}
+		pf.compressed = true;
+		pf.size = pf.compressed_data.size();
+	}
+
 	uint64_t _size = pf.size;
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
@@ -198,6 +211,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -221,7 +237,6 @@ Error PCKPacker::flush(bool p_verbose) {
 
 	int count = 0;
 	for (int i = 0; i < files.size(); i++) {
-		FileAccess *src = FileAccess::open(files[i].src_path, FileAccess::READ);
 		uint64_t to_write = files[i].size;
 
 		fae = nullptr;
@@ -235,10 +250,17 @@ Error PCKPacker::flush(bool p_verbose) {
 			ftmp = fae;
 		}
 
-		while (to_write > 0) {
-			int read = src->get_buffer(buf, MIN(to_write, buf_max));
-			ftmp->store_buffer(buf, read);
-			to_write -= read;
+		if (files[i].compressed) {
+			ftmp->store_buffer(files[i].compressed_data.ptr(), to_write);
+		} else {
+			FileAccess *src = FileAccess::open(files[i].src_path, FileAccess::READ);
+			while (to_write > 0) {
+				int read = src->get_buffer(buf, MIN(to_write, buf_max));
+				ftmp->store_buffer(buf, read);
+				to_write -= read;
+			}
+			src->close();
+			memdelete(src);
 		}
 
 		if (fae) {
@@ -251,8 +273,6 @@ Error PCKPacker::flush(bool p_verbose) {
 			file->store_8(Math::rand() % 256);
 		}
 
-		src->close();
-		memdelete(src);
 		count += 1;
 		const int file_num = files.size();
 		if (p_verbose && (file_num > 0)) {
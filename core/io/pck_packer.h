@@ -53,13 +53,15 @@ class PCKPacker : public Reference {
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
+		Vector<uint8_t> compressed_data;
 	};
 	Vector<File> files;
 
 public:
 	Error pck_start(const String &p_file, int p_alignment = 0, const String &p_key = String(), bool p_encrypt_directory = false);
-	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false);
+	Error add_file(const String &p_file, const String &p_src, bool p_encrypt = false, bool p_compress = false);
 	Error flush(bool p_verbose = false);
 
 	PCKPacker() {}
@@ -110,9 +110,14 @@ StringName ResourceLoaderBinary::_get_string() {
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
 		String s;
-		s.parse_utf8(&str_buf[0]);
+		const uint8_t *view = f->get_buffer_view(len);
+		if (view) {
+			s.parse_utf8((const char *)view, len);
+		} else {
+			f->get_buffer((uint8_t *)&str_buf[0], len);
+			s.parse_utf8(&str_buf[0]);
+		}
 		return s;
 	}
 
@@ -801,9 +806,14 @@ String ResourceLoaderBinary::get_unicode_string() {
 	if (len == 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
-	s.parse_utf8(&str_buf[0]);
+	const uint8_t *view = f->get_buffer_view(len);
+	if (view) {
+		s.parse_utf8((const char *)view, len);
+	} else {
+		f->get_buffer((uint8_t *)&str_buf[0], len);
+		s.parse_utf8(&str_buf[0]);
+	}
 	return s;
 }
 
@@ -828,6 +838,8 @@ void ResourceLoaderBinary::open(FileAccess *p_f) {
 	error = OK;
 
 	f = p_f;
+	// Mostly read front to back, only skipping ahead to the resource offsets.
+	f->set_access_pattern(FileAccess::ACCESS_PATTERN_SEQUENTIAL);
 	uint8_t header[4];
 	f->get_buffer(header, 4);
 	if (header[0] == 'R' && header[1] == 'S' && header[2] == 'C' && header[3] == 'C') {
@@ -919,6 +931,11 @@ void ResourceLoaderBinary::open(FileAccess *p_f) {
 		f->close();
 		ERR_FAIL_MSG("Premature end of file (EOF): " + local_path + ".");
 	}
+
+	if (internal_resources.size()) {
+		// Everything from the first resource on is read next, have it in memory by the time the dependencies are loaded.
+		f->prefetch(internal_resources[0].offset, 0);
+	}
 }
 
 String ResourceLoaderBinary::recognize(FileAccess *p_f) {
@@ -179,6 +179,7 @@ void ResourceFormatLoader::_bind_methods() {
 ///////////////////////////////////
 
 RES ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	MEMORY_TAG_SCOPE(TAG_RESOURCE);
 	bool found = false;
 
 	// Try all loaders and pick the first match for the type hint
@@ -208,12 +209,7 @@ RES ResourceLoader::_load(const String &p_path, const String &p_original_path, c
 
 void ResourceLoader::_thread_load_function(void *p_userdata) {
 	ThreadLoadTask &load_task = *(ThreadLoadTask *)p_userdata;
-	load_task.loader_id = Thread::get_caller_id();
 
-	if (load_task.semaphore) {
-		//this is an actual thread, so wait for Ok fom semaphore
-		thread_load_semaphore->wait(); //wait until its ok to start loading
-	}
 	load_task.resource = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_task.error, load_task.use_sub_threads, &load_task.progress);
 
 	load_task.progress = 1.0; //it was fully loaded at this point, so force progress to 1.0
@@ -225,15 +221,7 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		load_task.status = THREAD_LOAD_LOADED;
 	}
 	if (load_task.semaphore) {
-		if (load_task.start_next && thread_waiting_count > 0) {
-			thread_waiting_count--;
-			//thread loading count remains constant, this ends but another one begins
-			thread_load_semaphore->post();
-		} else {
-			thread_loading_count--; //no threads waiting, just reduce loading count
-		}
-
-		print_lt("END: load count: " + itos(thread_loading_count) + " / wait count: " + itos(thread_waiting_count) + " / suspended count: " + itos(thread_suspended_count) + " / active: " + itos(thread_loading_count - thread_suspended_count));
+		print_lt("END: " + load_task.local_path + " / queued: " + itos(thread_load_queue.size()));
 
 		for (int i = 0; i < load_task.poll_requests; i++) {
 			load_task.semaphore->post();
@@ -267,6 +255,43 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 	thread_load_mutex->unlock();
 }
 
+void ResourceLoader::_thread_load_worker(void *p_userdata) {
+	while (true) {
+		thread_load_semaphore->wait();
+
+		thread_load_mutex->lock();
+		if (thread_load_exit) {
+			thread_load_mutex->unlock();
+			break;
+		}
+		if (thread_load_queue.is_empty()) {
+			// Already picked up by a thread waiting on it in load_threaded_get().
+			thread_load_mutex->unlock();
+			continue;
+		}
+
+		ThreadLoadTask *load_task = thread_load_queue.front()->get();
+		thread_load_queue.pop_front();
+		load_task->queue_element = nullptr;
+		load_task->loader_id = Thread::get_caller_id();
+		thread_load_mutex->unlock();
+
+		_thread_load_function(load_task);
+	}
+}
+
+void ResourceLoader::_thread_load_start_workers() {
+	// Called with thread_load_mutex locked. Workers are only created once something is requested.
+	if (thread_load_workers) {
+		return;
+	}
+	thread_load_exit = false;
+	thread_load_workers = memnew_arr(Thread, thread_load_max);
+	for (int i = 0; i < thread_load_max; i++) {
+		thread_load_workers[i].start(_thread_load_worker, nullptr, Thread::get_role_settings(Thread::ROLE_LOADER));
+	}
+}
+
 Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode, const String &p_source_resource) {
 	String local_path;
 	if (p_path.is_rel_path()) {
@@ -354,18 +379,18 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 	if (load_task.resource.is_null()) { //needs  to be loaded in thread
 
 		load_task.semaphore = memnew(Semaphore);
-		if (thread_loading_count < thread_load_max) {
-			thread_loading_count++;
-			thread_load_semaphore->post(); //we have free threads, so allow one
+
+		// Dependencies go first in the queue, so the resources waiting on them are unblocked as soon as possible.
+		if (p_source_resource != String()) {
+			load_task.queue_element = thread_load_queue.push_front(&load_task);
 		} else {
-			thread_waiting_count++;
+			load_task.queue_element = thread_load_queue.push_back(&load_task);
 		}
 
-		print_lt("REQUEST: load count: " + itos(thread_loading_count) + " / wait count: " + itos(thread_waiting_count) + " / suspended count: " + itos(thread_suspended_count) + " / active: " + itos(thread_loading_count - thread_suspended_count));
+		print_lt("REQUEST: " + local_path + " / queued: " + itos(thread_load_queue.size()));
 
-		load_task.thread = memnew(Thread);
-		load_task.thread->start(_thread_load_function, &thread_load_tasks[local_path]);
-		load_task.loader_id = load_task.thread->get_id();
+		_thread_load_start_workers();
+		thread_load_semaphore->post();
 	}
 
 	thread_load_mutex->unlock();
@@ -373,28 +398,31 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 	return OK;
 }
 
-float ResourceLoader::_dependency_get_progress(const String &p_path) {
-	if (thread_load_tasks.has(p_path)) {
-		ThreadLoadTask &load_task = thread_load_tasks[p_path];
-		int dep_count = load_task.sub_tasks.size();
-		if (dep_count > 0) {
-			float dep_progress = 0;
-			for (Set<String>::Element *E = load_task.sub_tasks.front(); E; E = E->next()) {
-				dep_progress += _dependency_get_progress(E->get());
-			}
-			dep_progress /= float(dep_count);
-			dep_progress *= 0.5;
-			dep_progress += load_task.progress * 0.5;
-			return dep_progress;
-		} else {
-			return load_task.progress;
-		}
+void ResourceLoader::_dependency_add_progress(const String &p_path, Set<String> &r_visited, float &r_progress) {
+	r_visited.insert(p_path);
 
-	} else {
-		return 1.0; //assume finished loading it so it no longer exists
+	ThreadLoadTask *load_task = thread_load_tasks.getptr(p_path);
+	if (!load_task) {
+		r_progress += 1.0; //assume finished loading it so it no longer exists
+		return;
+	}
+
+	r_progress += load_task->progress;
+	for (Set<String>::Element *E = load_task->sub_tasks.front(); E; E = E->next()) {
+		if (!r_visited.has(E->get())) {
+			_dependency_add_progress(E->get(), r_visited, r_progress);
+		}
 	}
 }
 
+float ResourceLoader::_dependency_get_progress(const String &p_path) {
+	// Each resource in the dependency graph weighs the same, and is counted once even if shared by several others.
+	Set<String> visited;
+	float progress = 0;
+	_dependency_add_progress(p_path, visited, progress);
+	return progress / float(visited.size());
+}
+
 ResourceLoader::ThreadLoadStatus ResourceLoader::load_threaded_get_status(const String &p_path, float *r_progress) {
 	String local_path;
 	if (p_path.is_rel_path()) {
@@ -439,39 +467,38 @@ RES ResourceLoader::load_threaded_get(const String &p_path, Error *r_error) {
 
 	ThreadLoadTask &load_task = thread_load_tasks[local_path];
 
-	//semaphore still exists, meaning its still loading, request poll
+	//semaphore still exists, meaning its still loading
 	Semaphore *semaphore = load_task.semaphore;
 	if (semaphore) {
-		load_task.poll_requests++;
+		if (load_task.queue_element) {
+			// No worker picked it up yet, so load it here rather than blocking this thread
+			// (which may itself be a worker) on the queue.
+			thread_load_queue.erase(load_task.queue_element);
+			load_task.queue_element = nullptr;
+			load_task.loader_id = Thread::get_caller_id();
 
-		{
-			// As we got a semaphore, this means we are going to have to wait
-			// until the sub-resource is done loading
-			//
-			// As this thread will become 'blocked' we should "echange" its
-			// active status with a waiting one, to ensure load continues.
-			//
-			// This ensures loading is never blocked and that is also within
-			// the maximum number of active threads.
-
-			if (thread_waiting_count > 0) {
-				thread_waiting_count--;
-				thread_loading_count++;
-				thread_load_semaphore->post();
-
-				load_task.start_next = false; //do not start next since we are doing it here
-			}
+			print_lt("GET (load here): " + local_path + " / queued: " + itos(thread_load_queue.size()));
 
-			thread_suspended_count++;
+			thread_load_mutex->unlock();
+			_thread_load_function(&load_task);
+			thread_load_mutex->lock();
+		} else {
+			if (load_task.loader_id == Thread::get_caller_id()) {
+				thread_load_mutex->unlock();
+				if (r_error) {
+					*r_error = ERR_INVALID_PARAMETER;
+				}
+				ERR_FAIL_V_MSG(RES(), "Attempted to wait for resource '" + local_path + "' from the thread loading it, cyclic reference?");
+			}
 
-			print_lt("GET: load count: " + itos(thread_loading_count) + " / wait count: " + itos(thread_waiting_count) + " / suspended count: " + itos(thread_suspended_count) + " / active: " + itos(thread_loading_count - thread_suspended_count));
-		}
+			load_task.poll_requests++;
 
-		thread_load_mutex->unlock();
-		semaphore->wait();
-		thread_load_mutex->lock();
+			print_lt("GET (wait): " + local_path + " / queued: " + itos(thread_load_queue.size()));
 
-		thread_suspended_count--;
+			thread_load_mutex->unlock();
+			semaphore->wait();
+			thread_load_mutex->lock();
+		}
 
 		if (!thread_load_tasks.has(local_path)) { //may have been erased during unlock and this was always an invalid call
 			thread_load_mutex->unlock();
@@ -490,10 +517,6 @@ RES ResourceLoader::load_threaded_get(const String &p_path, Error *r_error) {
 	load_task.requests--;
 
 	if (load_task.requests == 0) {
-		if (load_task.thread) { //thread may not have been used
-			load_task.thread->wait_to_finish();
-			memdelete(load_task.thread);
-		}
 		thread_load_tasks.erase(local_path);
 	}
 
@@ -574,6 +597,24 @@ RES ResourceLoader::load(const String &p_path, const String &p_type_hint, Resour
 		return load_threaded_get(p_path, r_error);
 
 	} else {
+		if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
+			// Join a threaded load of the same resource instead of loading it a second time.
+			thread_load_mutex->lock();
+			const ThreadLoadTask *load_task = thread_load_tasks.getptr(local_path);
+			if (load_task && (load_task->semaphore || load_task->status != THREAD_LOAD_IN_PROGRESS)) {
+				Error err = load_threaded_request(p_path, p_type_hint);
+				thread_load_mutex->unlock();
+				if (err != OK) {
+					if (r_error) {
+						*r_error = err;
+					}
+					return RES();
+				}
+				return load_threaded_get(p_path, r_error);
+			}
+			thread_load_mutex->unlock();
+		}
+
 		bool xl_remapped = false;
 		String path = _path_remap(local_path, &xl_remapped);
 
@@ -1095,13 +1136,24 @@ void ResourceLoader::remove_custom_loaders() {
 void ResourceLoader::initialize() {
 	thread_load_mutex = memnew(Mutex);
 	thread_load_max = OS::get_singleton()->get_processor_count();
-	thread_loading_count = 0;
-	thread_waiting_count = 0;
-	thread_suspended_count = 0;
 	thread_load_semaphore = memnew(Semaphore);
 }
 
 void ResourceLoader::finalize() {
+	if (thread_load_workers) {
+		thread_load_mutex->lock();
+		thread_load_exit = true;
+		thread_load_mutex->unlock();
+		for (int i = 0; i < thread_load_max; i++) {
+			thread_load_semaphore->post();
+		}
+		for (int i = 0; i < thread_load_max; i++) {
+			thread_load_workers[i].wait_to_finish();
+		}
+		memdelete_arr(thread_load_workers);
+		thread_load_workers = nullptr;
+	}
+
 	memdelete(thread_load_mutex);
 	memdelete(thread_load_semaphore);
 }
@@ -1117,12 +1169,11 @@ bool ResourceLoader::timestamp_on_load = false;
 
 Mutex *ResourceLoader::thread_load_mutex = nullptr;
 HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
+List<ResourceLoader::ThreadLoadTask *> ResourceLoader::thread_load_queue;
 Semaphore *ResourceLoader::thread_load_semaphore = nullptr;
-
-int ResourceLoader::thread_loading_count = 0;
-int ResourceLoader::thread_waiting_count = 0;
-int ResourceLoader::thread_suspended_count = 0;
+Thread *ResourceLoader::thread_load_workers = nullptr;
 int ResourceLoader::thread_load_max = 0;
+bool ResourceLoader::thread_load_exit = false;
 
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
@@ -113,7 +113,6 @@ private:
 	static Ref<ResourceFormatLoader> _find_custom_resource_format_loader(String path);
 
 	struct ThreadLoadTask {
-		Thread *thread = nullptr;
 		Thread::ID loader_id = 0;
 		Semaphore *semaphore = nullptr;
 		String local_path;
@@ -126,21 +125,24 @@ private:
 		RES resource;
 		bool xl_remapped = false;
 		bool use_sub_threads = false;
-		bool start_next = true;
 		int requests = 0;
 		int poll_requests = 0;
 		Set<String> sub_tasks;
+		List<ThreadLoadTask *>::Element *queue_element = nullptr; // Set while waiting for a worker.
 	};
 
 	static void _thread_load_function(void *p_userdata);
+	static void _thread_load_worker(void *p_userdata);
+	static void _thread_load_start_workers();
 	static Mutex *thread_load_mutex;
 	static HashMap<String, ThreadLoadTask> thread_load_tasks;
+	static List<ThreadLoadTask *> thread_load_queue;
 	static Semaphore *thread_load_semaphore;
-	static int thread_waiting_count;
-	static int thread_loading_count;
-	static int thread_suspended_count;
+	static Thread *thread_load_workers;
 	static int thread_load_max;
+	static bool thread_load_exit;
 
+	static void _dependency_add_progress(const String &p_path, Set<String> &r_visited, float &r_progress);
 	static float _dependency_get_progress(const String &p_path);
 
 public:
@@ -78,6 +78,7 @@ public:
 
 	// Poll functions (wait or check for writable, readable)
 	Error poll(NetSocket::PollType p_type, int timeout = 0);
+	Ref<NetSocket> get_socket() const { return _sock; } // For registration with a NetSocketPoller.
 
 	// Read/Write from StreamPeer
 	Error put_data(const uint8_t *p_data, int p_bytes) override;
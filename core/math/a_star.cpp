@@ -69,9 +69,12 @@ void AStar::add_point(int p_id, const Vector3 &p_pos, real_t p_weight_scale) {
 		pt->closed_pass = 0;
 		pt->enabled = true;
 		points.set(p_id, pt);
+		_cluster_add_point(pt);
 	} else {
+		_cluster_remove_point(found_pt);
 		found_pt->pos = p_pos;
 		found_pt->weight_scale = p_weight_scale;
+		_cluster_add_point(found_pt);
 	}
 }
 
@@ -88,7 +91,9 @@ void AStar::set_point_position(int p_id, const Vector3 &p_pos) {
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND(!p_exists);
 
+	_cluster_remove_point(p);
 	p->pos = p_pos;
+	_cluster_add_point(p);
 }
 
 real_t AStar::get_point_weight_scale(int p_id) const {
@@ -106,6 +111,7 @@ void AStar::set_point_weight_scale(int p_id, real_t p_weight_scale) {
 	ERR_FAIL_COND(p_weight_scale < 1);
 
 	p->weight_scale = p_weight_scale;
+	_cluster_set_dirty(p->cluster);
 }
 
 void AStar::remove_point(int p_id) {
@@ -113,6 +119,8 @@ void AStar::remove_point(int p_id) {
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND(!p_exists);
 
+	_cluster_remove_point(p);
+
 	for (OAHashMap<int, Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
 		Segment s(p_id, (*it.key));
 		segments.erase(s);
@@ -170,6 +178,9 @@ void AStar::connect_points(int p_id, int p_with_id, bool bidirectional) {
 	}
 
 	segments.insert(s);
+
+	_cluster_set_dirty(a->cluster);
+	_cluster_set_dirty(b->cluster);
 }
 
 void AStar::disconnect_points(int p_id, int p_with_id, bool bidirectional) {
@@ -209,6 +220,9 @@ void AStar::disconnect_points(int p_id, int p_with_id, bool bidirectional) {
 		if (s.direction != Segment::NONE) {
 			segments.insert(s);
 		}
+
+		_cluster_set_dirty(a->cluster);
+		_cluster_set_dirty(b->cluster);
 	}
 }
 
@@ -255,6 +269,8 @@ void AStar::clear() {
 	}
 	segments.clear();
 	points.clear();
+	clusters.clear();
+	dirty_clusters.clear();
 }
 
 int AStar::get_point_count() const {
@@ -387,6 +403,483 @@ bool AStar::_solve(Point *begin_point, Point *end_point) {
 	return found_route;
 }
 
+void AStar::_cluster_set_dirty(Cluster *p_cluster) {
+	if (!p_cluster || p_cluster->dirty) {
+		return;
+	}
+	p_cluster->dirty = true;
+	dirty_clusters.push_back(p_cluster);
+}
+
+void AStar::_cluster_set_point_dirty(Point *p_point) {
+	if (!hierarchical) {
+		return;
+	}
+
+	// The entrances of the neighbouring clusters depend on this point too.
+	_cluster_set_dirty(p_point->cluster);
+	for (OAHashMap<int, Point *>::Iterator it = p_point->neighbours.iter(); it.valid; it = p_point->neighbours.next_iter(it)) {
+		_cluster_set_dirty((*it.value)->cluster);
+	}
+	for (OAHashMap<int, Point *>::Iterator it = p_point->unlinked_neighbours.iter(); it.valid; it = p_point->unlinked_neighbours.next_iter(it)) {
+		_cluster_set_dirty((*it.value)->cluster);
+	}
+}
+
+void AStar::_cluster_add_point(Point *p_point) {
+	if (!hierarchical) {
+		return;
+	}
+
+	Vector3 cell = (p_point->pos / cluster_size).floor();
+	Cluster *cluster = &clusters[Vector3i(cell.x, cell.y, cell.z)];
+
+	p_point->cluster = cluster;
+	p_point->cluster_index = cluster->points.size();
+	cluster->points.push_back(p_point);
+
+	_cluster_set_point_dirty(p_point);
+}
+
+void AStar::_cluster_remove_point(Point *p_point) {
+	Cluster *cluster = p_point->cluster;
+	if (!cluster) {
+		return;
+	}
+
+	_cluster_set_point_dirty(p_point);
+
+	cluster->points.remove_unordered(p_point->cluster_index);
+	if (p_point->cluster_index < cluster->points.size()) {
+		cluster->points[p_point->cluster_index]->cluster_index = p_point->cluster_index;
+	}
+	if (p_point->entrance) {
+		cluster->entrances.erase(p_point);
+	}
+
+	p_point->cluster = nullptr;
+	p_point->entrance = false;
+	p_point->abstract_edges.clear();
+}
+
+void AStar::_clusters_build() {
+	for (OAHashMap<int, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		_cluster_add_point(*(it.value));
+	}
+}
+
+void AStar::_clusters_clear() {
+	for (OAHashMap<int, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		Point *p = *(it.value);
+		p->cluster = nullptr;
+		p->entrance = false;
+		p->abstract_edges.clear();
+	}
+	clusters.clear();
+	dirty_clusters.clear();
+}
+
+template <class T>
+bool AStar::_solve_in_cluster(T *p_cost, Point *p_begin, Point *p_end) {
+	// A* limited to the points of the cluster of the begin point.
+	// Without an end point it explores the whole cluster (Dijkstra) to find the cost to every point.
+	pass++;
+
+	Cluster *cluster = p_begin->cluster;
+	bool found_route = false;
+
+	Vector<Point *> open_list;
+	SortArray<Point *, SortPoints> sorter;
+
+	p_begin->g_score = 0;
+	p_begin->f_score = p_end ? p_cost->_estimate_cost(p_begin->id, p_end->id) : 0;
+	p_begin->open_pass = pass;
+	open_list.push_back(p_begin);
+
+	while (!open_list.is_empty()) {
+		Point *p = open_list[0];
+
+		if (p == p_end) {
+			found_route = true;
+			break;
+		}
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptrw());
+		open_list.remove(open_list.size() - 1);
+		p->closed_pass = pass;
+
+		for (OAHashMap<int, Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
+			Point *e = *(it.value);
+
+			if (e->cluster != cluster || !e->enabled || e->closed_pass == pass) {
+				continue;
+			}
+
+			real_t tentative_g_score = p->g_score + p_cost->_compute_cost(p->id, e->id) * e->weight_scale;
+
+			bool new_point = false;
+
+			if (e->open_pass != pass) {
+				e->open_pass = pass;
+				open_list.push_back(e);
+				new_point = true;
+			} else if (tentative_g_score >= e->g_score) {
+				continue;
+			}
+
+			e->prev_point = p;
+			e->g_score = tentative_g_score;
+			e->f_score = e->g_score + (p_end ? p_cost->_estimate_cost(e->id, p_end->id) : 0);
+
+			if (new_point) {
+				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptrw());
+			} else {
+				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptrw());
+			}
+		}
+	}
+
+	return p_end ? found_route : true;
+}
+
+template <class T>
+void AStar::_clusters_update(T *p_cost) {
+	// Only the clusters affected by changes since the last search are rebuilt.
+	for (uint32_t i = 0; i < dirty_clusters.size(); i++) {
+		Cluster *cluster = dirty_clusters[i];
+		cluster->dirty = false;
+
+		for (uint32_t j = 0; j < cluster->entrances.size(); j++) {
+			cluster->entrances[j]->entrance = false;
+			cluster->entrances[j]->abstract_edges.clear();
+		}
+		cluster->entrances.clear();
+
+		for (uint32_t j = 0; j < cluster->points.size(); j++) {
+			Point *p = cluster->points[j];
+			if (!p->enabled) {
+				continue;
+			}
+
+			for (OAHashMap<int, Point *>::Iterator it = p->neighbours.iter(); it.valid && !p->entrance; it = p->neighbours.next_iter(it)) {
+				p->entrance = (*it.value)->cluster != cluster && (*it.value)->enabled;
+			}
+			for (OAHashMap<int, Point *>::Iterator it = p->unlinked_neighbours.iter(); it.valid && !p->entrance; it = p->unlinked_neighbours.next_iter(it)) {
+				p->entrance = (*it.value)->cluster != cluster && (*it.value)->enabled;
+			}
+
+			if (p->entrance) {
+				cluster->entrances.push_back(p);
+			}
+		}
+
+		for (uint32_t j = 0; j < cluster->entrances.size(); j++) {
+			Point *from = cluster->entrances[j];
+			_solve_in_cluster(p_cost, from, nullptr);
+
+			for (uint32_t k = 0; k < cluster->entrances.size(); k++) {
+				Point *to = cluster->entrances[k];
+				if (to != from && to->closed_pass == pass) {
+					AbstractEdge edge;
+					edge.to = to;
+					edge.cost = to->g_score;
+					from->abstract_edges.push_back(edge);
+				}
+			}
+		}
+	}
+
+	dirty_clusters.clear();
+}
+
+template <class T>
+bool AStar::_solve_hierarchical(T *p_cost, Point *p_begin, Point *p_end, LocalVector<Point *> &r_route) {
+	// HPA* like search: the graph is split in clusters, and the search runs over the entrances of
+	// the clusters using the precomputed routes between them. The resulting route is then refined
+	// with searches limited to a single cluster. The route may be slightly longer than the optimal one.
+	if (!p_end->enabled) {
+		return false;
+	}
+
+	_clusters_update(p_cost);
+
+	Cluster *end_cluster = p_end->cluster;
+
+	// Cost from the begin point to the entrances of its cluster.
+	LocalVector<AbstractEdge> begin_edges;
+	_solve_in_cluster(p_cost, p_begin, nullptr);
+	for (uint32_t i = 0; i < p_begin->cluster->entrances.size(); i++) {
+		Point *e = p_begin->cluster->entrances[i];
+		if (e->closed_pass == pass) {
+			AbstractEdge edge;
+			edge.to = e;
+			edge.cost = e->g_score;
+			begin_edges.push_back(edge);
+		}
+	}
+
+	// Cost from the entrances of the end cluster to the end point, negative if unreachable.
+	LocalVector<real_t> end_costs;
+	end_costs.resize(end_cluster->entrances.size());
+	for (uint32_t i = 0; i < end_cluster->entrances.size(); i++) {
+		Point *e = end_cluster->entrances[i];
+		if (e == p_end) {
+			end_costs[i] = 0;
+		} else {
+			end_costs[i] = _solve_in_cluster(p_cost, e, p_end) ? p_end->g_score : -1;
+		}
+	}
+
+	// Search over the abstract graph.
+	pass++;
+
+	Vector<Point *> open_list;
+	SortArray<Point *, SortPoints> sorter;
+	LocalVector<AbstractEdge> candidates;
+
+	for (uint32_t i = 0; i < begin_edges.size(); i++) {
+		Point *e = begin_edges[i].to;
+		e->prev_point = nullptr;
+		e->g_score = begin_edges[i].cost;
+		e->f_score = e->g_score + p_cost->_estimate_cost(e->id, p_end->id);
+		e->open_pass = pass;
+		open_list.push_back(e);
+		sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptrw());
+	}
+
+	Point *best_exit = nullptr;
+	real_t best_cost = 0;
+
+	while (!open_list.is_empty()) {
+		Point *p = open_list[0];
+
+		if (best_exit && p->f_score >= best_cost) {
+			break; // No better route can be found.
+		}
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptrw());
+		open_list.remove(open_list.size() - 1);
+		p->closed_pass = pass;
+
+		if (p->cluster == end_cluster) {
+			int64_t idx = end_cluster->entrances.find(p);
+			if (idx >= 0 && end_costs[idx] >= 0 && (!best_exit || p->g_score + end_costs[idx] < best_cost)) {
+				best_exit = p;
+				best_cost = p->g_score + end_costs[idx];
+			}
+		}
+
+		candidates.clear();
+		for (uint32_t i = 0; i < p->abstract_edges.size(); i++) {
+			candidates.push_back(p->abstract_edges[i]);
+		}
+		for (OAHashMap<int, Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
+			Point *e = *(it.value);
+			if (e->cluster != p->cluster && e->enabled) {
+				AbstractEdge edge;
+				edge.to = e;
+				edge.cost = p_cost->_compute_cost(p->id, e->id) * e->weight_scale;
+				candidates.push_back(edge);
+			}
+		}
+
+		for (uint32_t i = 0; i < candidates.size(); i++) {
+			Point *e = candidates[i].to;
+
+			if (e->closed_pass == pass) {
+				continue;
+			}
+
+			real_t tentative_g_score = p->g_score + candidates[i].cost;
+
+			bool new_point = false;
+
+			if (e->open_pass != pass) {
+				e->open_pass = pass;
+				open_list.push_back(e);
+				new_point = true;
+			} else if (tentative_g_score >= e->g_score) {
+				continue;
+			}
+
+			e->prev_point = p;
+			e->g_score = tentative_g_score;
+			e->f_score = e->g_score + p_cost->_estimate_cost(e->id, p_end->id);
+
+			if (new_point) {
+				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptrw());
+			} else {
+				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptrw());
+			}
+		}
+	}
+
+	if (!best_exit) {
+		return false;
+	}
+
+	LocalVector<Point *> abstract_route;
+	for (Point *p = best_exit; p; p = p->prev_point) {
+		abstract_route.push_back(p);
+	}
+	abstract_route.invert();
+	abstract_route.push_back(p_end);
+
+	// Refine the abstract route into the full one.
+	r_route.clear();
+	r_route.push_back(p_begin);
+
+	LocalVector<Point *> segment;
+	Point *from = p_begin;
+	for (uint32_t i = 0; i < abstract_route.size(); i++) {
+		Point *to = abstract_route[i];
+		if (to == from) {
+			continue;
+		}
+
+		if (to->cluster != from->cluster) {
+			r_route.push_back(to); // Connected directly.
+		} else {
+			bool found_route = _solve_in_cluster(p_cost, from, to);
+			ERR_FAIL_COND_V(!found_route, false);
+
+			segment.clear();
+			for (Point *p = to; p != from; p = p->prev_point) {
+				segment.push_back(p);
+			}
+			for (int64_t j = int64_t(segment.size()) - 1; j >= 0; j--) {
+				r_route.push_back(segment[j]);
+			}
+		}
+		from = to;
+	}
+
+	return true;
+}
+
+struct AStar::SearchScratch {
+	struct Node {
+		const Point *point = nullptr;
+		uint32_t prev = 0;
+		real_t g_score = 0;
+		bool closed = false;
+	};
+
+	struct OpenEntry {
+		real_t f_score = 0;
+		real_t g_score = 0;
+		uint32_t node = 0;
+	};
+
+	struct SortOpenEntries {
+		_FORCE_INLINE_ bool operator()(const OpenEntry &A, const OpenEntry &B) const {
+			if (A.f_score > B.f_score) {
+				return true;
+			} else if (A.f_score < B.f_score) {
+				return false;
+			} else {
+				return A.g_score < B.g_score;
+			}
+		}
+	};
+
+	LocalVector<Node> nodes;
+	OAHashMap<int, uint32_t> node_ids;
+	LocalVector<OpenEntry> open_list;
+};
+
+template <class T>
+bool AStar::_solve_concurrent(const T *p_cost, const Point *p_begin, const Point *p_end, LocalVector<const Point *> &r_route) const {
+	if (!p_end->enabled) {
+		return false;
+	}
+
+	// Search state lives out of the points, reused between the searches of the same thread.
+	static thread_local SearchScratch scratch;
+	scratch.nodes.clear();
+	scratch.node_ids.clear();
+	scratch.open_list.clear();
+
+	T *cost = const_cast<T *>(p_cost);
+	SortArray<SearchScratch::OpenEntry, SearchScratch::SortOpenEntries> sorter;
+
+	SearchScratch::Node begin_node;
+	begin_node.point = p_begin;
+	scratch.nodes.push_back(begin_node);
+	scratch.node_ids.set(p_begin->id, 0);
+
+	SearchScratch::OpenEntry begin_entry;
+	begin_entry.f_score = cost->_estimate_cost(p_begin->id, p_end->id);
+	scratch.open_list.push_back(begin_entry);
+
+	int64_t end_node = -1;
+
+	while (!scratch.open_list.is_empty()) {
+		SearchScratch::OpenEntry entry = scratch.open_list[0];
+		sorter.pop_heap(0, scratch.open_list.size(), scratch.open_list.ptr());
+		scratch.open_list.resize(scratch.open_list.size() - 1);
+
+		SearchScratch::Node &node = scratch.nodes[entry.node];
+		if (node.closed || entry.g_score > node.g_score) {
+			continue; // Outdated entry, the point was reached through a better route meanwhile.
+		}
+		if (node.point == p_end) {
+			end_node = entry.node;
+			break;
+		}
+		node.closed = true;
+
+		const Point *p = node.point;
+		real_t g_score = node.g_score;
+
+		for (OAHashMap<int, Point *>::Iterator it = p->neighbours.iter(); it.valid; it = p->neighbours.next_iter(it)) {
+			const Point *e = *(it.value);
+
+			if (!e->enabled) {
+				continue;
+			}
+
+			real_t tentative_g_score = g_score + cost->_compute_cost(p->id, e->id) * e->weight_scale;
+
+			uint32_t e_node;
+			if (scratch.node_ids.lookup(e->id, e_node)) {
+				if (scratch.nodes[e_node].closed || tentative_g_score >= scratch.nodes[e_node].g_score) {
+					continue;
+				}
+			} else {
+				e_node = scratch.nodes.size();
+				SearchScratch::Node new_node;
+				new_node.point = e;
+				scratch.nodes.push_back(new_node);
+				scratch.node_ids.set(e->id, e_node);
+			}
+
+			scratch.nodes[e_node].prev = entry.node;
+			scratch.nodes[e_node].g_score = tentative_g_score;
+
+			SearchScratch::OpenEntry e_entry;
+			e_entry.node = e_node;
+			e_entry.g_score = tentative_g_score;
+			e_entry.f_score = tentative_g_score + cost->_estimate_cost(e->id, p_end->id);
+			scratch.open_list.push_back(e_entry);
+			sorter.push_heap(0, scratch.open_list.size() - 1, 0, e_entry, scratch.open_list.ptr());
+		}
+	}
+
+	if (end_node < 0) {
+		return false;
+	}
+
+	r_route.clear();
+	for (uint32_t n = end_node; n != 0; n = scratch.nodes[n].prev) {
+		r_route.push_back(scratch.nodes[n].point);
+	}
+	r_route.push_back(p_begin);
+	r_route.invert();
+
+	return true;
+}
+
 real_t AStar::_estimate_cost(int p_from_id, int p_to_id) {
 	if (get_script_instance() && get_script_instance()->has_method(SceneStringNames::get_singleton()->_estimate_cost)) {
 		return get_script_instance()->call(SceneStringNames::get_singleton()->_estimate_cost, p_from_id, p_to_id);
@@ -434,6 +927,21 @@ Vector<Vector3> AStar::get_point_path(int p_from_id, int p_to_id) {
 		return ret;
 	}
 
+	if (hierarchical && a->cluster != b->cluster) {
+		LocalVector<Point *> route;
+		if (!_solve_hierarchical(this, a, b, route)) {
+			return Vector<Vector3>();
+		}
+
+		Vector<Vector3> path;
+		path.resize(route.size());
+		Vector3 *w = path.ptrw();
+		for (uint32_t i = 0; i < route.size(); i++) {
+			w[i] = route[i]->pos;
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -483,6 +991,21 @@ Vector<int> AStar::get_id_path(int p_from_id, int p_to_id) {
 		return ret;
 	}
 
+	if (hierarchical && a->cluster != b->cluster) {
+		LocalVector<Point *> route;
+		if (!_solve_hierarchical(this, a, b, route)) {
+			return Vector<int>();
+		}
+
+		Vector<int> path;
+		path.resize(route.size());
+		int *w = path.ptrw();
+		for (uint32_t i = 0; i < route.size(); i++) {
+			w[i] = route[i]->id;
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -517,12 +1040,69 @@ Vector<int> AStar::get_id_path(int p_from_id, int p_to_id) {
 	return path;
 }
 
+Vector<Vector3> AStar::get_point_path_concurrent(int p_from_id, int p_to_id) const {
+	Point *a;
+	bool from_exists = points.lookup(p_from_id, a);
+	ERR_FAIL_COND_V(!from_exists, Vector<Vector3>());
+
+	Point *b;
+	bool to_exists = points.lookup(p_to_id, b);
+	ERR_FAIL_COND_V(!to_exists, Vector<Vector3>());
+
+	LocalVector<const Point *> route;
+	if (a == b) {
+		route.push_back(a);
+	} else if (!_solve_concurrent(this, a, b, route)) {
+		return Vector<Vector3>();
+	}
+
+	Vector<Vector3> path;
+	path.resize(route.size());
+	Vector3 *w = path.ptrw();
+	for (uint32_t i = 0; i < route.size(); i++) {
+		w[i] = route[i]->pos;
+	}
+
+	return path;
+}
+
+Vector<int> AStar::get_id_path_concurrent(int p_from_id, int p_to_id) const {
+	Point *a;
+	bool from_exists = points.lookup(p_from_id, a);
+	ERR_FAIL_COND_V(!from_exists, Vector<int>());
+
+	Point *b;
+	bool to_exists = points.lookup(p_to_id, b);
+	ERR_FAIL_COND_V(!to_exists, Vector<int>());
+
+	LocalVector<const Point *> route;
+	if (a == b) {
+		route.push_back(a);
+	} else if (!_solve_concurrent(this, a, b, route)) {
+		return Vector<int>();
+	}
+
+	Vector<int> path;
+	path.resize(route.size());
+	int *w = path.ptrw();
+	for (uint32_t i = 0; i < route.size(); i++) {
+		w[i] = route[i]->id;
+	}
+
+	return path;
+}
+
 void AStar::set_point_disabled(int p_id, bool p_disabled) {
 	Point *p;
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND(!p_exists);
 
+	if (p->enabled == !p_disabled) {
+		return;
+	}
+
 	p->enabled = !p_disabled;
+	_cluster_set_point_dirty(p);
 }
 
 bool AStar::is_point_disabled(int p_id) const {
@@ -533,6 +1113,40 @@ bool AStar::is_point_disabled(int p_id) const {
 	return !p->enabled;
 }
 
+void AStar::set_hierarchical(bool p_enable) {
+	if (hierarchical == p_enable) {
+		return;
+	}
+
+	hierarchical = p_enable;
+	if (hierarchical) {
+		_clusters_build();
+	} else {
+		_clusters_clear();
+	}
+}
+
+bool AStar::is_hierarchical() const {
+	return hierarchical;
+}
+
+void AStar::set_cluster_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "Cluster size must be greater than 0.");
+	if (cluster_size == p_size) {
+		return;
+	}
+
+	cluster_size = p_size;
+	if (hierarchical) {
+		_clusters_clear();
+		_clusters_build();
+	}
+}
+
+real_t AStar::get_cluster_size() const {
+	return cluster_size;
+}
+
 void AStar::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_available_point_id"), &AStar::get_available_point_id);
 	ClassDB::bind_method(D_METHOD("add_point", "id", "position", "weight_scale"), &AStar::add_point, DEFVAL(1.0));
@@ -560,6 +1174,11 @@ void AStar::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar::get_closest_position_in_segment);
 
+	ClassDB::bind_method(D_METHOD("set_hierarchical", "enable"), &AStar::set_hierarchical);
+	ClassDB::bind_method(D_METHOD("is_hierarchical"), &AStar::is_hierarchical);
+	ClassDB::bind_method(D_METHOD("set_cluster_size", "size"), &AStar::set_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_cluster_size"), &AStar::get_cluster_size);
+
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStar::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStar::get_id_path);
 
@@ -659,6 +1278,22 @@ Vector2 AStar2D::get_closest_position_in_segment(const Vector2 &p_point) const {
 	return Vector2(p.x, p.y);
 }
 
+void AStar2D::set_hierarchical(bool p_enable) {
+	astar.set_hierarchical(p_enable);
+}
+
+bool AStar2D::is_hierarchical() const {
+	return astar.is_hierarchical();
+}
+
+void AStar2D::set_cluster_size(real_t p_size) {
+	astar.set_cluster_size(p_size);
+}
+
+real_t AStar2D::get_cluster_size() const {
+	return astar.get_cluster_size();
+}
+
 real_t AStar2D::_estimate_cost(int p_from_id, int p_to_id) {
 	if (get_script_instance() && get_script_instance()->has_method(SceneStringNames::get_singleton()->_estimate_cost)) {
 		return get_script_instance()->call(SceneStringNames::get_singleton()->_estimate_cost, p_from_id, p_to_id);
@@ -706,6 +1341,21 @@ Vector<Vector2> AStar2D::get_point_path(int p_from_id, int p_to_id) {
 		return ret;
 	}
 
+	if (astar.hierarchical && a->cluster != b->cluster) {
+		LocalVector<AStar::Point *> route;
+		if (!astar._solve_hierarchical(this, a, b, route)) {
+			return Vector<Vector2>();
+		}
+
+		Vector<Vector2> path;
+		path.resize(route.size());
+		Vector2 *w = path.ptrw();
+		for (uint32_t i = 0; i < route.size(); i++) {
+			w[i] = Vector2(route[i]->pos.x, route[i]->pos.y);
+		}
+		return path;
+	}
+
 	AStar::Point *begin_point = a;
 	AStar::Point *end_point = b;
 
@@ -755,6 +1405,21 @@ Vector<int> AStar2D::get_id_path(int p_from_id, int p_to_id) {
 		return ret;
 	}
 
+	if (astar.hierarchical && a->cluster != b->cluster) {
+		LocalVector<AStar::Point *> route;
+		if (!astar._solve_hierarchical(this, a, b, route)) {
+			return Vector<int>();
+		}
+
+		Vector<int> path;
+		path.resize(route.size());
+		int *w = path.ptrw();
+		for (uint32_t i = 0; i < route.size(); i++) {
+			w[i] = route[i]->id;
+		}
+		return path;
+	}
+
 	AStar::Point *begin_point = a;
 	AStar::Point *end_point = b;
 
@@ -789,6 +1454,58 @@ Vector<int> AStar2D::get_id_path(int p_from_id, int p_to_id) {
 	return path;
 }
 
+Vector<Vector2> AStar2D::get_point_path_concurrent(int p_from_id, int p_to_id) const {
+	AStar::Point *a;
+	bool from_exists = astar.points.lookup(p_from_id, a);
+	ERR_FAIL_COND_V(!from_exists, Vector<Vector2>());
+
+	AStar::Point *b;
+	bool to_exists = astar.points.lookup(p_to_id, b);
+	ERR_FAIL_COND_V(!to_exists, Vector<Vector2>());
+
+	LocalVector<const AStar::Point *> route;
+	if (a == b) {
+		route.push_back(a);
+	} else if (!astar._solve_concurrent(this, a, b, route)) {
+		return Vector<Vector2>();
+	}
+
+	Vector<Vector2> path;
+	path.resize(route.size());
+	Vector2 *w = path.ptrw();
+	for (uint32_t i = 0; i < route.size(); i++) {
+		w[i] = Vector2(route[i]->pos.x, route[i]->pos.y);
+	}
+
+	return path;
+}
+
+Vector<int> AStar2D::get_id_path_concurrent(int p_from_id, int p_to_id) const {
+	AStar::Point *a;
+	bool from_exists = astar.points.lookup(p_from_id, a);
+	ERR_FAIL_COND_V(!from_exists, Vector<int>());
+
+	AStar::Point *b;
+	bool to_exists = astar.points.lookup(p_to_id, b);
+	ERR_FAIL_COND_V(!to_exists, Vector<int>());
+
+	LocalVector<const AStar::Point *> route;
+	if (a == b) {
+		route.push_back(a);
+	} else if (!astar._solve_concurrent(this, a, b, route)) {
+		return Vector<int>();
+	}
+
+	Vector<int> path;
+	path.resize(route.size());
+	int *w = path.ptrw();
+	for (uint32_t i = 0; i < route.size(); i++) {
+		w[i] = route[i]->id;
+	}
+
+	return path;
+}
+
 bool AStar2D::_solve(AStar::Point *begin_point, AStar::Point *end_point) {
 	astar.pass++;
 
@@ -878,6 +1595,11 @@ void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar2D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar2D::get_closest_position_in_segment);
 
+	ClassDB::bind_method(D_METHOD("set_hierarchical", "enable"), &AStar2D::set_hierarchical);
+	ClassDB::bind_method(D_METHOD("is_hierarchical"), &AStar2D::is_hierarchical);
+	ClassDB::bind_method(D_METHOD("set_cluster_size", "size"), &AStar2D::set_cluster_size);
+	ClassDB::bind_method(D_METHOD("get_cluster_size"), &AStar2D::get_cluster_size);
+
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStar2D::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStar2D::get_id_path);
 
@@ -31,7 +31,10 @@
 #ifndef A_STAR_H
 #define A_STAR_H
 
+#include "core/math/vector3i.h"
 #include "core/object/reference.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/map.h"
 #include "core/templates/oa_hash_map.h"
 
 /**
@@ -44,6 +47,14 @@ class AStar : public Reference {
 	GDCLASS(AStar, Reference);
 	friend class AStar2D;
 
+	struct Point;
+	struct Cluster;
+
+	struct AbstractEdge {
+		Point *to = nullptr;
+		real_t cost = 0;
+	};
+
 	struct Point {
 		Point() {}
 
@@ -61,6 +72,18 @@ class AStar : public Reference {
 		real_t f_score = 0;
 		uint64_t open_pass = 0;
 		uint64_t closed_pass = 0;
+
+		// Used for hierarchical pathfinding.
+		Cluster *cluster = nullptr;
+		uint32_t cluster_index = 0;
+		bool entrance = false;
+		LocalVector<AbstractEdge> abstract_edges; // Precomputed routes to the other entrances of the cluster.
+	};
+
+	struct Cluster {
+		LocalVector<Point *> points;
+		LocalVector<Point *> entrances; // Points connected to points of other clusters.
+		bool dirty = false;
 	};
 
 	struct SortPoints {
@@ -114,8 +137,31 @@ class AStar : public Reference {
 	OAHashMap<int, Point *> points;
 	Set<Segment> segments;
 
+	bool hierarchical = false;
+	real_t cluster_size = 16;
+	Map<Vector3i, Cluster> clusters;
+	LocalVector<Cluster *> dirty_clusters;
+
+	struct SearchScratch;
+
 	bool _solve(Point *begin_point, Point *end_point);
 
+	void _cluster_add_point(Point *p_point);
+	void _cluster_remove_point(Point *p_point);
+	void _cluster_set_dirty(Cluster *p_cluster);
+	void _cluster_set_point_dirty(Point *p_point);
+	void _clusters_build();
+	void _clusters_clear();
+
+	template <class T>
+	void _clusters_update(T *p_cost);
+	template <class T>
+	bool _solve_in_cluster(T *p_cost, Point *p_begin, Point *p_end);
+	template <class T>
+	bool _solve_hierarchical(T *p_cost, Point *p_begin, Point *p_end, LocalVector<Point *> &r_route);
+	template <class T>
+	bool _solve_concurrent(const T *p_cost, const Point *p_begin, const Point *p_end, LocalVector<const Point *> &r_route) const;
+
 protected:
 	static void _bind_methods();
 
@@ -150,15 +196,27 @@ public:
 	int get_closest_point(const Vector3 &p_point, bool p_include_disabled = false) const;
 	Vector3 get_closest_position_in_segment(const Vector3 &p_point) const;
 
+	void set_hierarchical(bool p_enable);
+	bool is_hierarchical() const;
+	void set_cluster_size(real_t p_size);
+	real_t get_cluster_size() const;
+
 	Vector<Vector3> get_point_path(int p_from_id, int p_to_id);
 	Vector<int> get_id_path(int p_from_id, int p_to_id);
 
+	// Thread-safe variants, the search state is kept on the calling thread so several threads
+	// can search the same graph at once, as long as it's not modified meanwhile.
+	// They always run a flat search, and the cost functions must be safe to call from threads.
+	Vector<Vector3> get_point_path_concurrent(int p_from_id, int p_to_id) const;
+	Vector<int> get_id_path_concurrent(int p_from_id, int p_to_id) const;
+
 	AStar() {}
 	~AStar();
 };
 
 class AStar2D : public Reference {
 	GDCLASS(AStar2D, Reference);
+	friend class AStar;
 	AStar astar;
 
 	bool _solve(AStar::Point *begin_point, AStar::Point *end_point);
@@ -197,9 +255,17 @@ public:
 	int get_closest_point(const Vector2 &p_point, bool p_include_disabled = false) const;
 	Vector2 get_closest_position_in_segment(const Vector2 &p_point) const;
 
+	void set_hierarchical(bool p_enable);
+	bool is_hierarchical() const;
+	void set_cluster_size(real_t p_size);
+	real_t get_cluster_size() const;
+
 	Vector<Vector2> get_point_path(int p_from_id, int p_to_id);
 	Vector<int> get_id_path(int p_from_id, int p_to_id);
 
+	Vector<Vector2> get_point_path_concurrent(int p_from_id, int p_to_id) const;
+	Vector<int> get_id_path_concurrent(int p_from_id, int p_to_id) const;
+
 	AStar2D() {}
 	~AStar2D() {}
 };
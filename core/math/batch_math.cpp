@@ -0,0 +1,257 @@
+/*************************************************************************/
+/*  batch_math.cpp                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "batch_math.h"
+
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BATCH_MATH_SSE2_ENABLED
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BATCH_MATH_NEON_ENABLED
+#endif
+#endif
+
+#if defined(BATCH_MATH_SSE2_ENABLED) || defined(BATCH_MATH_NEON_ENABLED)
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be three packed floats.");
+static_assert(sizeof(Transform) == 12 * sizeof(float), "Transform must be twelve packed floats.");
+#endif
+
+template <bool USE_ORIGIN>
+static void _xform(const Basis &p_basis, const Vector3 &p_origin, const Vector3 *p_src, Vector3 *p_dst, int p_count) {
+	int i = 0;
+
+#if defined(BATCH_MATH_SSE2_ENABLED)
+	const float *src = (const float *)p_src;
+	float *dst = (float *)p_dst;
+
+	const __m128 m00 = _mm_set1_ps(p_basis.elements[0][0]);
+	const __m128 m01 = _mm_set1_ps(p_basis.elements[0][1]);
+	const __m128 m02 = _mm_set1_ps(p_basis.elements[0][2]);
+	const __m128 m10 = _mm_set1_ps(p_basis.elements[1][0]);
+	const __m128 m11 = _mm_set1_ps(p_basis.elements[1][1]);
+	const __m128 m12 = _mm_set1_ps(p_basis.elements[1][2]);
+	const __m128 m20 = _mm_set1_ps(p_basis.elements[2][0]);
+	const __m128 m21 = _mm_set1_ps(p_basis.elements[2][1]);
+	const __m128 m22 = _mm_set1_ps(p_basis.elements[2][2]);
+	const __m128 ox = _mm_set1_ps(p_origin.x);
+	const __m128 oy = _mm_set1_ps(p_origin.y);
+	const __m128 oz = _mm_set1_ps(p_origin.z);
+
+	for (; i + 4 <= p_count; i += 4) {
+		// Four vectors are three registers: x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3.
+		const __m128 a = _mm_loadu_ps(src + i * 3);
+		const __m128 b = _mm_loadu_ps(src + i * 3 + 4);
+		const __m128 c = _mm_loadu_ps(src + i * 3 + 8);
+
+		const __m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 0, 2)), _MM_SHUFFLE(3, 0, 3, 0));
+		const __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+
+		__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_mul_ps(m02, z));
+		__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m12, z));
+		__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_mul_ps(m22, z));
+		if (USE_ORIGIN) {
+			rx = _mm_add_ps(rx, ox);
+			ry = _mm_add_ps(ry, oy);
+			rz = _mm_add_ps(rz, oz);
+		}
+
+		_mm_storeu_ps(dst + i * 3, _mm_shuffle_ps(_mm_shuffle_ps(rx, ry, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(dst + i * 3 + 4, _mm_shuffle_ps(_mm_shuffle_ps(ry, rz, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(rx, ry, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(dst + i * 3 + 8, _mm_shuffle_ps(_mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+#elif defined(BATCH_MATH_NEON_ENABLED)
+	const float *src = (const float *)p_src;
+	float *dst = (float *)p_dst;
+
+	for (; i + 4 <= p_count; i += 4) {
+		const float32x4x3_t v = vld3q_f32(src + i * 3);
+		float32x4x3_t r;
+		for (int j = 0; j < 3; j++) {
+			r.val[j] = vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], p_basis.elements[j][0]), vmulq_n_f32(v.val[1], p_basis.elements[j][1])), vmulq_n_f32(v.val[2], p_basis.elements[j][2]));
+			if (USE_ORIGIN) {
+				r.val[j] = vaddq_f32(r.val[j], vdupq_n_f32(p_origin[j]));
+			}
+		}
+		vst3q_f32(dst + i * 3, r);
+	}
+#endif
+
+	for (; i < p_count; i++) {
+		if (USE_ORIGIN) {
+			p_dst[i] = Vector3(p_basis[0].dot(p_src[i]) + p_origin.x, p_basis[1].dot(p_src[i]) + p_origin.y, p_basis[2].dot(p_src[i]) + p_origin.z);
+		} else {
+			p_dst[i] = p_basis.xform(p_src[i]);
+		}
+	}
+}
+
+void BatchMath::xform(const Transform &p_xform, const Vector3 *p_src, Vector3 *p_dst, int p_count) {
+	_xform<true>(p_xform.basis, p_xform.origin, p_src, p_dst, p_count);
+}
+
+void BatchMath::basis_xform(const Basis &p_basis, const Vector3 *p_src, Vector3 *p_dst, int p_count) {
+	_xform<false>(p_basis, Vector3(), p_src, p_dst, p_count);
+}
+
+// Computes p_a * p_b into p_dst, any of which may alias. Basis rows are handled a register each;
+// their fourth lane spills into the next row, which is stored over it right after.
+static _FORCE_INLINE_ void _multiply(const Transform &p_a, const Transform &p_b, Transform &p_dst) {
+#if defined(BATCH_MATH_SSE2_ENABLED) || defined(BATCH_MATH_NEON_ENABLED)
+	const float *a = (const float *)&p_a;
+	const float *b = (const float *)&p_b;
+	float *dst = (float *)&p_dst;
+
+	const Vector3 origin = p_a.xform(p_b.origin);
+
+#if defined(BATCH_MATH_SSE2_ENABLED)
+	const __m128 b0 = _mm_loadu_ps(b);
+	const __m128 b1 = _mm_loadu_ps(b + 3);
+	const __m128 b2 = _mm_loadu_ps(b + 6);
+	const __m128 r0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[0]), b0), _mm_mul_ps(_mm_set1_ps(a[1]), b1)), _mm_mul_ps(_mm_set1_ps(a[2]), b2));
+	const __m128 r1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[3]), b0), _mm_mul_ps(_mm_set1_ps(a[4]), b1)), _mm_mul_ps(_mm_set1_ps(a[5]), b2));
+	const __m128 r2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[6]), b0), _mm_mul_ps(_mm_set1_ps(a[7]), b1)), _mm_mul_ps(_mm_set1_ps(a[8]), b2));
+	_mm_storeu_ps(dst, r0);
+	_mm_storeu_ps(dst + 3, r1);
+	_mm_storeu_ps(dst + 6, r2);
+#else
+	const float32x4_t b0 = vld1q_f32(b);
+	const float32x4_t b1 = vld1q_f32(b + 3);
+	const float32x4_t b2 = vld1q_f32(b + 6);
+	const float32x4_t r0 = vaddq_f32(vaddq_f32(vmulq_n_f32(b0, a[0]), vmulq_n_f32(b1, a[1])), vmulq_n_f32(b2, a[2]));
+	const float32x4_t r1 = vaddq_f32(vaddq_f32(vmulq_n_f32(b0, a[3]), vmulq_n_f32(b1, a[4])), vmulq_n_f32(b2, a[5]));
+	const float32x4_t r2 = vaddq_f32(vaddq_f32(vmulq_n_f32(b0, a[6]), vmulq_n_f32(b1, a[7])), vmulq_n_f32(b2, a[8]));
+	vst1q_f32(dst, r0);
+	vst1q_f32(dst + 3, r1);
+	vst1q_f32(dst + 6, r2);
+#endif
+
+	p_dst.origin = origin;
+#else
+	p_dst = p_a * p_b;
+#endif
+}
+
+void BatchMath::multiply(const Transform &p_xform, const Transform *p_src, Transform *p_dst, int p_count) {
+	for (int i = 0; i < p_count; i++) {
+		_multiply(p_xform, p_src[i], p_dst[i]);
+	}
+}
+
+void BatchMath::multiply(const Transform *p_a, const Transform *p_b, Transform *p_dst, int p_count) {
+	for (int i = 0; i < p_count; i++) {
+		_multiply(p_a[i], p_b[i], p_dst[i]);
+	}
+}
+
+AABB BatchMath::get_aabb(const Vector3 *p_points, int p_count) {
+	if (p_count <= 0) {
+		return AABB();
+	}
+
+	Vector3 min = p_points[0];
+	Vector3 max = p_points[0];
+	int i = 0;
+
+#if defined(BATCH_MATH_SSE2_ENABLED) || defined(BATCH_MATH_NEON_ENABLED)
+	if (p_count >= 4) {
+		// Reduced in the interleaved layout, each lane always holds the same axis.
+		const float *src = (const float *)p_points;
+		float lane_min[12];
+		float lane_max[12];
+
+#if defined(BATCH_MATH_SSE2_ENABLED)
+		__m128 min_a = _mm_loadu_ps(src);
+		__m128 min_b = _mm_loadu_ps(src + 4);
+		__m128 min_c = _mm_loadu_ps(src + 8);
+		__m128 max_a = min_a;
+		__m128 max_b = min_b;
+		__m128 max_c = min_c;
+		for (i = 4; i + 4 <= p_count; i += 4) {
+			const __m128 a = _mm_loadu_ps(src + i * 3);
+			const __m128 b = _mm_loadu_ps(src + i * 3 + 4);
+			const __m128 c = _mm_loadu_ps(src + i * 3 + 8);
+			min_a = _mm_min_ps(min_a, a);
+			min_b = _mm_min_ps(min_b, b);
+			min_c = _mm_min_ps(min_c, c);
+			max_a = _mm_max_ps(max_a, a);
+			max_b = _mm_max_ps(max_b, b);
+			max_c = _mm_max_ps(max_c, c);
+		}
+		_mm_storeu_ps(lane_min, min_a);
+		_mm_storeu_ps(lane_min + 4, min_b);
+		_mm_storeu_ps(lane_min + 8, min_c);
+		_mm_storeu_ps(lane_max, max_a);
+		_mm_storeu_ps(lane_max + 4, max_b);
+		_mm_storeu_ps(lane_max + 8, max_c);
+#else
+		float32x4_t min_a = vld1q_f32(src);
+		float32x4_t min_b = vld1q_f32(src + 4);
+		float32x4_t min_c = vld1q_f32(src + 8);
+		float32x4_t max_a = min_a;
+		float32x4_t max_b = min_b;
+		float32x4_t max_c = min_c;
+		for (i = 4; i + 4 <= p_count; i += 4) {
+			const float32x4_t a = vld1q_f32(src + i * 3);
+			const float32x4_t b = vld1q_f32(src + i * 3 + 4);
+			const float32x4_t c = vld1q_f32(src + i * 3 + 8);
+			min_a = vminq_f32(min_a, a);
+			min_b = vminq_f32(min_b, b);
+			min_c = vminq_f32(min_c, c);
+			max_a = vmaxq_f32(max_a, a);
+			max_b = vmaxq_f32(max_b, b);
+			max_c = vmaxq_f32(max_c, c);
+		}
+		vst1q_f32(lane_min, min_a);
+		vst1q_f32(lane_min + 4, min_b);
+		vst1q_f32(lane_min + 8, min_c);
+		vst1q_f32(lane_max, max_a);
+		vst1q_f32(lane_max + 4, max_b);
+		vst1q_f32(lane_max + 8, max_c);
+#endif
+
+		for (int j = 0; j < 12; j++) {
+			min[j % 3] = MIN(min[j % 3], lane_min[j]);
+			max[j % 3] = MAX(max[j % 3], lane_max[j]);
+		}
+	}
+#endif
+
+	for (; i < p_count; i++) {
+		for (int j = 0; j < 3; j++) {
+			min[j] = MIN(min[j], p_points[i][j]);
+			max[j] = MAX(max[j], p_points[i][j]);
+		}
+	}
+
+	return AABB(min, max - min);
+}
@@ -0,0 +1,56 @@
+/*************************************************************************/
+/*  batch_math.h                                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BATCH_MATH_H
+#define BATCH_MATH_H
+
+#include "core/math/aabb.h"
+#include "core/math/transform.h"
+
+// Kernels applying the same math to whole arrays of vectors and transforms. They process four
+// vectors per SSE2/NEON register when available (single precision builds only), and give the
+// same results as the equivalent per-element loops. Destinations may alias the sources.
+class BatchMath {
+public:
+	// p_dst[i] = p_xform.xform(p_src[i])
+	static void xform(const Transform &p_xform, const Vector3 *p_src, Vector3 *p_dst, int p_count);
+	// p_dst[i] = p_basis.xform(p_src[i]), for normals and directions.
+	static void basis_xform(const Basis &p_basis, const Vector3 *p_src, Vector3 *p_dst, int p_count);
+
+	// p_dst[i] = p_xform * p_src[i]
+	static void multiply(const Transform &p_xform, const Transform *p_src, Transform *p_dst, int p_count);
+	// p_dst[i] = p_a[i] * p_b[i]
+	static void multiply(const Transform *p_a, const Transform *p_b, Transform *p_dst, int p_count);
+
+	// Smallest AABB enclosing all the points, or an empty AABB when there are none.
+	static AABB get_aabb(const Vector3 *p_points, int p_count);
+};
+
+#endif // BATCH_MATH_H
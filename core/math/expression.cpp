@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/reference.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 static bool _is_number(char32_t c) {
@@ -1157,228 +1158,401 @@ bool Expression::_compile_expression() {
 	return false;
 }
 
-bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, String &r_error_str) {
+Expression::Address Expression::_add_constant(const Variant &p_value) {
+	Address address;
+	address.type = Address::TYPE_CONSTANT;
+	address.index = constants.size();
+	constants.push_back(p_value);
+	return address;
+}
+
+static bool _is_foldable(Variant::Type p_type) {
+	// Constants are shared between executions, so only values that can't be modified through a copy are folded.
+	switch (p_type) {
+		case Variant::OBJECT:
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::DICTIONARY:
+		case Variant::ARRAY:
+			return false;
+		default:
+			return p_type < Variant::PACKED_BYTE_ARRAY;
+	}
+}
+
+Expression::Address Expression::_add_instruction(const Instruction &p_instruction, const LocalVector<Address> &p_arguments) {
+	bool constant = true;
+	for (uint32_t i = 0; i < p_arguments.size(); i++) {
+		if (p_arguments[i].type != Address::TYPE_CONSTANT) {
+			constant = false;
+			break;
+		}
+	}
+
+	bool pure = p_instruction.opcode == OPCODE_OPERATOR || p_instruction.opcode == OPCODE_INDEX || p_instruction.opcode == OPCODE_NAMED_INDEX || p_instruction.opcode == OPCODE_CONSTRUCT;
+	if (p_instruction.opcode == OPCODE_CALL_BUILTIN) {
+		pure = Variant::get_utility_function_type(p_instruction.name) == Variant::UTILITY_FUNC_TYPE_MATH;
+	}
+
+	Instruction instruction = p_instruction;
+	instruction.argument_offset = program_arguments.size();
+	instruction.argument_count = p_arguments.size();
+	for (uint32_t i = 0; i < p_arguments.size(); i++) {
+		program_arguments.push_back(p_arguments[i]);
+	}
+	max_argument_count = MAX(max_argument_count, instruction.argument_count);
+
+	if (constant && pure) {
+		// Evaluate it now. Errors are left for execution to report.
+		Variant value;
+		LocalVector<const Variant *> argument_pointers;
+		argument_pointers.resize(MAX(instruction.argument_count, 1));
+
+		ExecutionState state;
+		state.registers = &value;
+		state.argument_pointers = argument_pointers.ptr();
+		instruction.target = 0;
+		if (!_run_instruction(instruction, state) && _is_foldable(value.get_type())) {
+			program_arguments.resize(instruction.argument_offset);
+			return _add_constant(value);
+		}
+	}
+
+	instruction.target = register_count++;
+	program.push_back(instruction);
+
+	Address address;
+	address.type = Address::TYPE_REGISTER;
+	address.index = instruction.target;
+	return address;
+}
+
+Expression::Address Expression::_compile(ENode *p_node) {
+	Address address;
+	Instruction instruction;
+	LocalVector<Address> arguments;
+
 	switch (p_node->type) {
-		case Expression::ENode::TYPE_INPUT: {
-			const Expression::InputNode *in = static_cast<const Expression::InputNode *>(p_node);
-			if (in->index < 0 || in->index >= p_inputs.size()) {
-				r_error_str = vformat(RTR("Invalid input %i (not passed) in expression"), in->index);
-				return true;
+		case ENode::TYPE_INPUT: {
+			address.type = Address::TYPE_INPUT;
+			address.index = static_cast<const InputNode *>(p_node)->index;
+			return address;
+		}
+		case ENode::TYPE_CONSTANT: {
+			return _add_constant(static_cast<const ConstantNode *>(p_node)->value);
+		}
+		case ENode::TYPE_SELF: {
+			address.type = Address::TYPE_SELF;
+			return address;
+		}
+		case ENode::TYPE_OPERATOR: {
+			const OperatorNode *op = static_cast<const OperatorNode *>(p_node);
+			instruction.opcode = OPCODE_OPERATOR;
+			instruction.op = op->op;
+			arguments.push_back(_compile(op->nodes[0]));
+			if (op->nodes[1]) {
+				arguments.push_back(_compile(op->nodes[1]));
 			}
-			r_ret = p_inputs[in->index];
 		} break;
-		case Expression::ENode::TYPE_CONSTANT: {
-			const Expression::ConstantNode *c = static_cast<const Expression::ConstantNode *>(p_node);
-			r_ret = c->value;
-
+		case ENode::TYPE_INDEX: {
+			const IndexNode *index = static_cast<const IndexNode *>(p_node);
+			instruction.opcode = OPCODE_INDEX;
+			arguments.push_back(_compile(index->base));
+			arguments.push_back(_compile(index->index));
 		} break;
-		case Expression::ENode::TYPE_SELF: {
-			if (!p_instance) {
-				r_error_str = RTR("self can't be used because instance is null (not passed)");
-				return true;
+		case ENode::TYPE_NAMED_INDEX: {
+			const NamedIndexNode *index = static_cast<const NamedIndexNode *>(p_node);
+			instruction.opcode = OPCODE_NAMED_INDEX;
+			instruction.name = index->name;
+			arguments.push_back(_compile(index->base));
+		} break;
+		case ENode::TYPE_ARRAY: {
+			const ArrayNode *array = static_cast<const ArrayNode *>(p_node);
+			instruction.opcode = OPCODE_ARRAY;
+			for (int i = 0; i < array->array.size(); i++) {
+				arguments.push_back(_compile(array->array[i]));
 			}
-			r_ret = p_instance;
 		} break;
-		case Expression::ENode::TYPE_OPERATOR: {
-			const Expression::OperatorNode *op = static_cast<const Expression::OperatorNode *>(p_node);
-
-			Variant a;
-			bool ret = _execute(p_inputs, p_instance, op->nodes[0], a, r_error_str);
-			if (ret) {
-				return true;
+		case ENode::TYPE_DICTIONARY: {
+			const DictionaryNode *dictionary = static_cast<const DictionaryNode *>(p_node);
+			instruction.opcode = OPCODE_DICTIONARY;
+			for (int i = 0; i < dictionary->dict.size(); i++) {
+				arguments.push_back(_compile(dictionary->dict[i]));
+			}
+		} break;
+		case ENode::TYPE_CONSTRUCTOR: {
+			const ConstructorNode *constructor = static_cast<const ConstructorNode *>(p_node);
+			instruction.opcode = OPCODE_CONSTRUCT;
+			instruction.data_type = constructor->data_type;
+			for (int i = 0; i < constructor->arguments.size(); i++) {
+				arguments.push_back(_compile(constructor->arguments[i]));
+			}
+		} break;
+		case ENode::TYPE_BUILTIN_FUNC: {
+			const BuiltinFuncNode *bifunc = static_cast<const BuiltinFuncNode *>(p_node);
+			instruction.opcode = OPCODE_CALL_BUILTIN;
+			instruction.name = bifunc->func;
+			for (int i = 0; i < bifunc->arguments.size(); i++) {
+				arguments.push_back(_compile(bifunc->arguments[i]));
+			}
+		} break;
+		case ENode::TYPE_CALL: {
+			const CallNode *call = static_cast<const CallNode *>(p_node);
+			instruction.opcode = OPCODE_CALL;
+			instruction.name = call->method;
+			arguments.push_back(_compile(call->base));
+			for (int i = 0; i < call->arguments.size(); i++) {
+				arguments.push_back(_compile(call->arguments[i]));
 			}
+		} break;
+	}
 
-			Variant b;
+	return _add_instruction(instruction, arguments);
+}
 
-			if (op->nodes[1]) {
-				ret = _execute(p_inputs, p_instance, op->nodes[1], b, r_error_str);
-				if (ret) {
-					return true;
-				}
+const Variant *Expression::_get_operand(const Address &p_address, ExecutionState &p_state) const {
+	switch (p_address.type) {
+		case Address::TYPE_REGISTER:
+			return &p_state.registers[p_address.index];
+		case Address::TYPE_CONSTANT:
+			return &constants[p_address.index];
+		case Address::TYPE_INPUT:
+			if (unlikely(!p_state.inputs || p_address.index >= p_state.inputs->size())) {
+				p_state.error = vformat(RTR("Invalid input %i (not passed) in expression"), p_address.index);
+				return nullptr;
 			}
-
-			bool valid = true;
-			Variant::evaluate(op->op, a, b, r_ret, valid);
-			if (!valid) {
-				r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
-				return true;
+			return &(*p_state.inputs)[p_address.index];
+		case Address::TYPE_SELF:
+			if (unlikely(!p_state.self)) {
+				p_state.error = RTR("self can't be used because instance is null (not passed)");
 			}
+			return p_state.self;
+	}
+	return nullptr;
+}
 
-		} break;
-		case Expression::ENode::TYPE_INDEX: {
-			const Expression::IndexNode *index = static_cast<const Expression::IndexNode *>(p_node);
+// Integer and float operations that can't fail are done inline when both operands have the same type.
+static _FORCE_INLINE_ bool _evaluate_typed(Variant::Operator p_op, const Variant &p_a, const Variant &p_b, Variant &r_ret) {
+	if (p_a.get_type() != p_b.get_type()) {
+		return false;
+	}
 
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, r_error_str);
-			if (ret) {
+	if (p_a.get_type() == Variant::INT) {
+		int64_t a = *VariantInternal::get_int(&p_a);
+		int64_t b = *VariantInternal::get_int(&p_b);
+		switch (p_op) {
+			case Variant::OP_ADD:
+				r_ret = a + b;
 				return true;
-			}
+			case Variant::OP_SUBTRACT:
+				r_ret = a - b;
+				return true;
+			case Variant::OP_MULTIPLY:
+				r_ret = a * b;
+				return true;
+			case Variant::OP_EQUAL:
+				r_ret = a == b;
+				return true;
+			case Variant::OP_NOT_EQUAL:
+				r_ret = a != b;
+				return true;
+			case Variant::OP_LESS:
+				r_ret = a < b;
+				return true;
+			case Variant::OP_LESS_EQUAL:
+				r_ret = a <= b;
+				return true;
+			case Variant::OP_GREATER:
+				r_ret = a > b;
+				return true;
+			case Variant::OP_GREATER_EQUAL:
+				r_ret = a >= b;
+				return true;
+			default:
+				return false; // Division and modulo need to check for zero.
+		}
+	} else if (p_a.get_type() == Variant::FLOAT) {
+		double a = *VariantInternal::get_float(&p_a);
+		double b = *VariantInternal::get_float(&p_b);
+		switch (p_op) {
+			case Variant::OP_ADD:
+				r_ret = a + b;
+				return true;
+			case Variant::OP_SUBTRACT:
+				r_ret = a - b;
+				return true;
+			case Variant::OP_MULTIPLY:
+				r_ret = a * b;
+				return true;
+			case Variant::OP_DIVIDE:
+				r_ret = a / b;
+				return true;
+			case Variant::OP_EQUAL:
+				r_ret = a == b;
+				return true;
+			case Variant::OP_NOT_EQUAL:
+				r_ret = a != b;
+				return true;
+			case Variant::OP_LESS:
+				r_ret = a < b;
+				return true;
+			case Variant::OP_LESS_EQUAL:
+				r_ret = a <= b;
+				return true;
+			case Variant::OP_GREATER:
+				r_ret = a > b;
+				return true;
+			case Variant::OP_GREATER_EQUAL:
+				r_ret = a >= b;
+				return true;
+			default:
+				return false;
+		}
+	}
 
-			Variant idx;
+	return false;
+}
 
-			ret = _execute(p_inputs, p_instance, index->index, idx, r_error_str);
-			if (ret) {
-				return true;
+bool Expression::_run_instruction(const Instruction &p_instruction, ExecutionState &p_state) const {
+	Variant &r_ret = p_state.registers[p_instruction.target];
+	const Address *arguments = &program_arguments[p_instruction.argument_offset];
+	const Variant **argp = p_state.argument_pointers;
+
+	for (int i = 0; i < p_instruction.argument_count; i++) {
+		argp[i] = _get_operand(arguments[i], p_state);
+		if (!argp[i]) {
+			return true;
+		}
+	}
+
+	switch (p_instruction.opcode) {
+		case OPCODE_OPERATOR: {
+			static const Variant nil;
+			const Variant &a = *argp[0];
+			const Variant &b = p_instruction.argument_count > 1 ? *argp[1] : nil;
+
+			if (_evaluate_typed(p_instruction.op, a, b, r_ret)) {
+				break;
 			}
 
-			bool valid;
-			r_ret = base.get(idx, &valid);
+			bool valid = true;
+			Variant::evaluate(p_instruction.op, a, b, r_ret, valid);
 			if (!valid) {
-				r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(idx.get_type()), Variant::get_type_name(base.get_type()));
+				p_state.error = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(p_instruction.op), Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type()));
 				return true;
 			}
-
 		} break;
-		case Expression::ENode::TYPE_NAMED_INDEX: {
-			const Expression::NamedIndexNode *index = static_cast<const Expression::NamedIndexNode *>(p_node);
-
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, index->base, base, r_error_str);
-			if (ret) {
+		case OPCODE_INDEX: {
+			bool valid;
+			r_ret = argp[0]->get(*argp[1], &valid);
+			if (!valid) {
+				p_state.error = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(argp[1]->get_type()), Variant::get_type_name(argp[0]->get_type()));
 				return true;
 			}
-
+		} break;
+		case OPCODE_NAMED_INDEX: {
 			bool valid;
-			r_ret = base.get_named(index->name, valid);
+			r_ret = argp[0]->get_named(p_instruction.name, valid);
 			if (!valid) {
-				r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(base.get_type()));
+				p_state.error = vformat(RTR("Invalid named index '%s' for base type %s"), String(p_instruction.name), Variant::get_type_name(argp[0]->get_type()));
 				return true;
 			}
-
 		} break;
-		case Expression::ENode::TYPE_ARRAY: {
-			const Expression::ArrayNode *array = static_cast<const Expression::ArrayNode *>(p_node);
-
+		case OPCODE_ARRAY: {
 			Array arr;
-			arr.resize(array->array.size());
-			for (int i = 0; i < array->array.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, array->array[i], value, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-				arr[i] = value;
+			arr.resize(p_instruction.argument_count);
+			for (int i = 0; i < p_instruction.argument_count; i++) {
+				arr[i] = *argp[i];
 			}
-
 			r_ret = arr;
-
 		} break;
-		case Expression::ENode::TYPE_DICTIONARY: {
-			const Expression::DictionaryNode *dictionary = static_cast<const Expression::DictionaryNode *>(p_node);
-
+		case OPCODE_DICTIONARY: {
 			Dictionary d;
-			for (int i = 0; i < dictionary->dict.size(); i += 2) {
-				Variant key;
-				bool ret = _execute(p_inputs, p_instance, dictionary->dict[i + 0], key, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-
-				Variant value;
-				ret = _execute(p_inputs, p_instance, dictionary->dict[i + 1], value, r_error_str);
-				if (ret) {
-					return true;
-				}
-
-				d[key] = value;
+			for (int i = 0; i < p_instruction.argument_count; i += 2) {
+				d[*argp[i + 0]] = *argp[i + 1];
 			}
-
 			r_ret = d;
 		} break;
-		case Expression::ENode::TYPE_CONSTRUCTOR: {
-			const Expression::ConstructorNode *constructor = static_cast<const Expression::ConstructorNode *>(p_node);
-
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(constructor->arguments.size());
-			argp.resize(constructor->arguments.size());
-
-			for (int i = 0; i < constructor->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, constructor->arguments[i], value, r_error_str);
-
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
-
+		case OPCODE_CONSTRUCT: {
 			Callable::CallError ce;
-			Variant::construct(constructor->data_type, r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
-
+			Variant::construct(p_instruction.data_type, r_ret, argp, p_instruction.argument_count, ce);
 			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
+				p_state.error = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(p_instruction.data_type));
 				return true;
 			}
-
 		} break;
-		case Expression::ENode::TYPE_BUILTIN_FUNC: {
-			const Expression::BuiltinFuncNode *bifunc = static_cast<const Expression::BuiltinFuncNode *>(p_node);
-
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(bifunc->arguments.size());
-			argp.resize(bifunc->arguments.size());
-
-			for (int i = 0; i < bifunc->arguments.size(); i++) {
-				Variant value;
-				bool ret = _execute(p_inputs, p_instance, bifunc->arguments[i], value, r_error_str);
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
-
+		case OPCODE_CALL_BUILTIN: {
 			r_ret = Variant(); //may not return anything
 			Callable::CallError ce;
-			Variant::call_utility_function(bifunc->func, &r_ret, (const Variant **)argp.ptr(), argp.size(), ce);
+			Variant::call_utility_function(p_instruction.name, &r_ret, argp, p_instruction.argument_count, ce);
 			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = "Builtin Call Failed. " + Variant::get_call_error_text(bifunc->func, (const Variant **)argp.ptr(), argp.size(), ce);
+				p_state.error = "Builtin Call Failed. " + Variant::get_call_error_text(p_instruction.name, argp, p_instruction.argument_count, ce);
 				return true;
 			}
-
 		} break;
-		case Expression::ENode::TYPE_CALL: {
-			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
-
-			Variant base;
-			bool ret = _execute(p_inputs, p_instance, call->base, base, r_error_str);
+		case OPCODE_CALL: {
+			// Methods may modify their base, so only registers are called in place.
+			Variant base_copy;
+			Variant *base;
+			if (arguments[0].type == Address::TYPE_REGISTER) {
+				base = &p_state.registers[arguments[0].index];
+			} else {
+				base_copy = *argp[0];
+				base = &base_copy;
+			}
 
-			if (ret) {
+			Callable::CallError ce;
+			base->call(p_instruction.name, argp + 1, p_instruction.argument_count - 1, r_ret, ce);
+			if (ce.error != Callable::CallError::CALL_OK) {
+				p_state.error = vformat(RTR("On call to '%s':"), String(p_instruction.name));
 				return true;
 			}
+		} break;
+	}
 
-			Vector<Variant> arr;
-			Vector<const Variant *> argp;
-			arr.resize(call->arguments.size());
-			argp.resize(call->arguments.size());
+	return false;
+}
 
-			for (int i = 0; i < call->arguments.size(); i++) {
-				Variant value;
-				ret = _execute(p_inputs, p_instance, call->arguments[i], value, r_error_str);
+bool Expression::_run_program(const Array &p_inputs, Object *p_instance, Variant &r_ret, String &r_error_str) const {
+	Variant self;
+	ExecutionState state;
+	state.inputs = &p_inputs;
+	if (p_instance) {
+		self = p_instance;
+		state.self = &self;
+	}
 
-				if (ret) {
-					return true;
-				}
-				arr.write[i] = value;
-				argp.write[i] = &arr[i];
-			}
+	state.registers = (Variant *)alloca(sizeof(Variant) * MAX(register_count, 1));
+	for (int i = 0; i < register_count; i++) {
+		memnew_placement(&state.registers[i], Variant);
+	}
+	state.argument_pointers = (const Variant **)alloca(sizeof(const Variant *) * MAX(max_argument_count, 1));
 
-			Callable::CallError ce;
-			base.call(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
+	bool error = false;
+	for (uint32_t i = 0; i < program.size(); i++) {
+		if (_run_instruction(program[i], state)) {
+			error = true;
+			break;
+		}
+	}
 
-			if (ce.error != Callable::CallError::CALL_OK) {
-				r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
-				return true;
-			}
+	if (error) {
+		r_error_str = state.error;
+	} else {
+		const Variant *ret = _get_operand(result, state);
+		if (ret) {
+			r_ret = *ret;
+		} else {
+			r_error_str = state.error;
+			error = true;
+		}
+	}
 
-		} break;
+	for (int i = 0; i < register_count; i++) {
+		state.registers[i].~Variant();
 	}
-	return false;
+
+	return error;
 }
 
 Error Expression::parse(const String &p_expression, const Vector<String> &p_input_names) {
@@ -1388,6 +1562,13 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 		root = nullptr;
 	}
 
+	program.clear();
+	program_arguments.clear();
+	constants.clear();
+	result = Address();
+	register_count = 0;
+	max_argument_count = 0;
+
 	error_str = String();
 	error_set = false;
 	str_ofs = 0;
@@ -1405,20 +1586,30 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 		return ERR_INVALID_PARAMETER;
 	}
 
+	// Only the program is needed from now on.
+	result = _compile(root);
+	root = nullptr;
+	if (nodes) {
+		memdelete(nodes);
+	}
+	nodes = nullptr;
+
 	return OK;
 }
 
 Variant Expression::execute(Array p_inputs, Object *p_base, bool p_show_error) {
 	ERR_FAIL_COND_V_MSG(error_set, Variant(), "There was previously a parse error: " + error_str + ".");
 
-	execution_error = false;
 	Variant output;
 	String error_txt;
-	bool err = _execute(p_inputs, p_base, root, output, error_txt);
+	bool err = _run_program(p_inputs, p_base, output, error_txt);
+	execution_error = err;
 	if (err) {
-		execution_error = true;
-		error_str = error_txt;
-		ERR_FAIL_COND_V_MSG(p_show_error, Variant(), error_str);
+		{
+			MutexLock lock(execution_error_mutex);
+			error_str = error_txt;
+		}
+		ERR_FAIL_COND_V_MSG(p_show_error, Variant(), error_txt);
 	}
 
 	return output;
@@ -1429,6 +1620,7 @@ bool Expression::has_execute_failed() const {
 }
 
 String Expression::get_error_text() const {
+	MutexLock lock(execution_error_mutex);
 	return error_str;
 }
 
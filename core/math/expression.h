@@ -32,6 +32,10 @@
 #define EXPRESSION_H
 
 #include "core/object/reference.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+
+#include <atomic>
 
 class Expression : public Reference {
 	GDCLASS(Expression, Reference);
@@ -255,8 +259,67 @@ private:
 
 	Vector<String> input_names;
 
-	bool execution_error = false;
-	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, String &r_error_str);
+	// The parsed tree is compiled to a flat program. Instructions read their operands from registers, constants
+	// or inputs and write their result to a register, so executing only touches a register file on the stack and
+	// the same expression can be executed from several threads at once. Operators, indexing, constructors and math
+	// functions on constants are folded when compiling.
+	enum Opcode {
+		OPCODE_OPERATOR,
+		OPCODE_INDEX,
+		OPCODE_NAMED_INDEX,
+		OPCODE_ARRAY,
+		OPCODE_DICTIONARY,
+		OPCODE_CONSTRUCT,
+		OPCODE_CALL_BUILTIN,
+		OPCODE_CALL,
+	};
+
+	struct Address {
+		enum Type {
+			TYPE_REGISTER,
+			TYPE_CONSTANT,
+			TYPE_INPUT,
+			TYPE_SELF,
+		};
+
+		Type type = TYPE_CONSTANT;
+		int index = 0;
+	};
+
+	struct Instruction {
+		Opcode opcode = OPCODE_OPERATOR;
+		Variant::Operator op = Variant::OP_ADD;
+		Variant::Type data_type = Variant::NIL;
+		StringName name; // Named index, function or method.
+		int target = 0;
+		int argument_offset = 0; // Into program_arguments, index and call bases come first.
+		int argument_count = 0;
+	};
+
+	struct ExecutionState {
+		Variant *registers = nullptr;
+		const Array *inputs = nullptr;
+		const Variant *self = nullptr;
+		const Variant **argument_pointers = nullptr;
+		String error;
+	};
+
+	LocalVector<Instruction> program;
+	LocalVector<Address> program_arguments;
+	LocalVector<Variant> constants;
+	Address result;
+	int register_count = 0;
+	int max_argument_count = 0;
+
+	Address _compile(ENode *p_node);
+	Address _add_constant(const Variant &p_value);
+	Address _add_instruction(const Instruction &p_instruction, const LocalVector<Address> &p_arguments);
+	_FORCE_INLINE_ const Variant *_get_operand(const Address &p_address, ExecutionState &p_state) const;
+	bool _run_instruction(const Instruction &p_instruction, ExecutionState &p_state) const;
+	bool _run_program(const Array &p_inputs, Object *p_instance, Variant &r_ret, String &r_error_str) const;
+
+	std::atomic<bool> execution_error = { false };
+	Mutex execution_error_mutex;
 
 protected:
 	static void _bind_methods();
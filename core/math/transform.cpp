@@ -30,6 +30,7 @@
 
 #include "transform.h"
 
+#include "core/math/batch_math.h"
 #include "core/math/math_funcs.h"
 #include "core/os/copymem.h"
 #include "core/string/print_string.h"
@@ -191,6 +192,13 @@ Transform Transform::operator*(const Transform &p_transform) const {
 	return t;
 }
 
+Vector<Vector3> Transform::xform(const Vector<Vector3> &p_array) const {
+	Vector<Vector3> array;
+	array.resize(p_array.size());
+	BatchMath::xform(*this, p_array.ptr(), array.ptrw(), p_array.size());
+	return array;
+}
+
 Transform::operator String() const {
 	return basis.operator String() + " - " + origin.operator String();
 }
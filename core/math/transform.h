@@ -83,7 +83,7 @@ public:
 	_FORCE_INLINE_ AABB xform(const AABB &p_aabb) const;
 	_FORCE_INLINE_ AABB xform_inv(const AABB &p_aabb) const;
 
-	_FORCE_INLINE_ Vector<Vector3> xform(const Vector<Vector3> &p_array) const;
+	Vector<Vector3> xform(const Vector<Vector3> &p_array) const;
 	_FORCE_INLINE_ Vector<Vector3> xform_inv(const Vector<Vector3> &p_array) const;
 
 	void operator*=(const Transform &p_transform);
@@ -203,19 +203,6 @@ _FORCE_INLINE_ AABB Transform::xform_inv(const AABB &p_aabb) const {
 	return ret;
 }
 
-Vector<Vector3> Transform::xform(const Vector<Vector3> &p_array) const {
-	Vector<Vector3> array;
-	array.resize(p_array.size());
-
-	const Vector3 *r = p_array.ptr();
-	Vector3 *w = array.ptrw();
-
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
-	}
-	return array;
-}
-
 Vector<Vector3> Transform::xform_inv(const Vector<Vector3> &p_array) const {
 	Vector<Vector3> array;
 	array.resize(p_array.size());
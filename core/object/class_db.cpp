@@ -238,7 +238,7 @@ ClassDB::APIType ClassDB::get_current_api() {
 	return current_api;
 }
 
-HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
+ClassDB::ClassMap ClassDB::classes;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
 
@@ -1190,6 +1190,49 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 	return false;
 }
 
+MethodBind *ClassDB::get_property_getter_method(StringName p_class, const StringName &p_property) {
+	OBJTYPE_RLOCK;
+
+	// Same lookup order as get_property(), but only returns the getter when a plain call to it
+	// is all get_property() would do.
+	ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg->index < 0 ? psg->_getptr : nullptr;
+		}
+
+		if (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property)) {
+			return nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
+MethodBind *ClassDB::get_property_setter_method(StringName p_class, const StringName &p_property, int *r_index) {
+	OBJTYPE_RLOCK;
+
+	// Same lookup as set_property(). Returns null if set_property() would not call a bound method,
+	// in which case callers must go through it.
+	ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			if (r_index) {
+				*r_index = psg->index;
+			}
+			return psg->setter ? psg->_setptr : nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -1318,7 +1361,8 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const c
 	ERR_FAIL_COND_V(!p_bind, nullptr);
 	p_bind->set_name(mdname);
 
-	String instance_type = p_bind->get_instance_class();
+	// Kept as a StringName, converting to String and back would intern it again for every bound method.
+	StringName instance_type = p_bind->get_instance_class();
 
 #ifdef DEBUG_ENABLED
 
@@ -115,10 +115,10 @@ public:
 		ClassInfo *inherits_ptr = nullptr;
 		void *class_ptr = nullptr;
 
-		HashMap<StringName, MethodBind *> method_map;
-		HashMap<StringName, int> constant_map;
+		FlatHashMap<StringName, MethodBind *> method_map;
+		FlatHashMap<StringName, int> constant_map;
 		HashMap<StringName, List<StringName>> enum_map;
-		HashMap<StringName, MethodInfo> signal_map;
+		FlatHashMap<StringName, MethodInfo> signal_map;
 		List<PropertyInfo> property_list;
 		HashMap<StringName, PropertyInfo> property_map;
 #ifdef DEBUG_METHODS_ENABLED
@@ -129,7 +129,7 @@ public:
 		Map<StringName, MethodInfo> virtual_methods_map;
 		StringName category;
 #endif
-		HashMap<StringName, PropertySetGet> property_setget;
+		FlatHashMap<StringName, PropertySetGet> property_setget;
 
 		StringName inherits;
 		StringName name;
@@ -146,8 +146,13 @@ public:
 		return memnew(T);
 	}
 
+	// Sized for the engine's classes from the start, so registration doesn't keep rehashing it
+	// and lookups don't walk long bucket chains. ClassInfo addresses must stay stable (see inherits_ptr),
+	// which rules out FlatHashMap here.
+	typedef HashMap<StringName, ClassInfo, HashMapHasherDefault, HashMapComparatorDefault<StringName>, 10, 1> ClassMap;
+
 	static RWLock lock;
-	static HashMap<StringName, ClassInfo> classes;
+	static ClassMap classes;
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -311,7 +316,7 @@ public:
 		bind->set_name(p_name);
 		bind->set_default_arguments(p_default_args);
 
-		String instance_type = bind->get_instance_class();
+		StringName instance_type = bind->get_instance_class();
 
 		ClassInfo *type = classes.getptr(instance_type);
 		if (!type) {
@@ -322,7 +327,7 @@ public:
 		if (type->method_map.has(p_name)) {
 			memdelete(bind);
 			// overloading not supported
-			ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
+			ERR_FAIL_V_MSG(nullptr, "Method already bound: " + String(instance_type) + "::" + p_name + ".");
 		}
 		type->method_map[p_name] = bind;
 #ifdef DEBUG_METHODS_ENABLED
@@ -352,6 +357,8 @@ public:
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(StringName p_class, const StringName &p_property);
 	static StringName get_property_getter(StringName p_class, const StringName &p_property);
+	static MethodBind *get_property_getter_method(StringName p_class, const StringName &p_property);
+	static MethodBind *get_property_setter_method(StringName p_class, const StringName &p_property, int *r_index = nullptr);
 
 	static bool has_method(StringName p_class, StringName p_method, bool p_no_inheritance = false);
 	static void set_method_flags(StringName p_class, StringName p_method, int p_flags);
@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
 
 MessageQueue *MessageQueue::singleton = nullptr;
 
@@ -40,6 +41,71 @@ MessageQueue *MessageQueue::get_singleton() {
 	return singleton;
 }
 
+MessageQueue::Message *MessageQueue::_alloc_message(uint32_t p_room_needed) {
+	Page *page = &pages[pages.size() - 1];
+	if (page->end + p_room_needed > page->size) {
+		Page new_page;
+		new_page.size = MAX(buffer_size, p_room_needed);
+		new_page.data = memnew_arr(uint8_t, new_page.size);
+		pages.push_back(new_page);
+		page = &pages[pages.size() - 1];
+	}
+
+	uint8_t *ptr = &page->data[page->end];
+	page->end += p_room_needed;
+	buffer_end += p_room_needed;
+
+	// Deferred calls from other threads (loaders, requests, previews) need the main loop to run.
+	OS::get_singleton()->wake_main_loop();
+
+	return memnew_placement(ptr, Message);
+}
+
+uint32_t MessageQueue::_get_message_size(const Message *p_message) {
+	switch (p_message->type & FLAG_MASK) {
+		case TYPE_NOTIFICATION:
+			return sizeof(Message);
+		case TYPE_NATIVE_CALL:
+			return sizeof(Message) + sizeof(NativeCall);
+		default:
+			return sizeof(Message) + sizeof(Variant) * p_message->args;
+	}
+}
+
+Object *MessageQueue::_get_message_target(const Message *p_message) {
+	if ((p_message->type & FLAG_MASK) == TYPE_NATIVE_CALL) {
+		const NativeCall *native = (const NativeCall *)(p_message + 1);
+		return ObjectDB::get_instance(native->object);
+	}
+	return p_message->callable.get_object();
+}
+
+MessageQueue::UniqueCall MessageQueue::_get_unique_call(const Message *p_message) {
+	UniqueCall unique;
+	if ((p_message->type & FLAG_MASK) == TYPE_NATIVE_CALL) {
+		const NativeCall *native = (const NativeCall *)(p_message + 1);
+		unique.object = native->object;
+		unique.func = native->func;
+		unique.data[0] = native->data[0];
+		unique.data[1] = native->data[1];
+	} else {
+		unique.object = p_message->callable.get_object_id();
+		unique.method = p_message->callable.get_method();
+	}
+	return unique;
+}
+
+void MessageQueue::_free_message(Message *p_message) {
+	int type = p_message->type & FLAG_MASK;
+	if (type == TYPE_CALL || type == TYPE_SET) {
+		Variant *args = (Variant *)(p_message + 1);
+		for (int i = 0; i < p_message->args; i++) {
+			args[i].~Variant();
+		}
+	}
+	p_message->~Message();
+}
+
 Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callable(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
@@ -62,28 +128,12 @@ Error MessageQueue::push_call(ObjectID p_id, const StringName &p_method, VARIANT
 Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
 	_THREAD_SAFE_METHOD_
 
-	uint8_t room_needed = sizeof(Message) + sizeof(Variant);
-
-	if ((buffer_end + room_needed) >= buffer_size) {
-		String type;
-		if (ObjectDB::get_instance(p_id)) {
-			type = ObjectDB::get_instance(p_id)->get_class();
-		}
-		print_line("Failed set: " + type + ":" + p_prop + " target ID: " + itos(p_id));
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
-	}
-
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = _alloc_message(sizeof(Message) + sizeof(Variant));
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
 	msg->type = TYPE_SET;
 
-	buffer_end += sizeof(Message);
-
-	Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-	buffer_end += sizeof(Variant);
-	*v = p_value;
+	memnew_placement(msg + 1, Variant(p_value));
 
 	return OK;
 }
@@ -93,23 +143,13 @@ Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
 
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
 
-	uint8_t room_needed = sizeof(Message);
-
-	if ((buffer_end + room_needed) >= buffer_size) {
-		print_line("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id));
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
-	}
-
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	Message *msg = _alloc_message(sizeof(Message));
 
 	msg->type = TYPE_NOTIFICATION;
 	msg->callable = Callable(p_id, CoreStringNames::get_singleton()->notification); //name is meaningless but callable needs it
 	//msg->target;
 	msg->notification = p_notification;
 
-	buffer_end += sizeof(Message);
-
 	return OK;
 }
 
@@ -125,18 +165,70 @@ Error MessageQueue::push_set(Object *p_object, const StringName &p_prop, const V
 	return push_set(p_object->get_instance_id(), p_prop, p_value);
 }
 
-Error MessageQueue::push_callable(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+Error MessageQueue::push_unique_call(ObjectID p_id, const StringName &p_method) {
+	_THREAD_SAFE_METHOD_
+
+	UniqueCall unique;
+	unique.object = p_id;
+	unique.method = p_method;
+	if (pending_unique.has(unique)) {
+		return OK;
+	}
+	pending_unique.set(unique, true);
+
+	Message *msg = _alloc_message(sizeof(Message));
+	msg->args = 0;
+	msg->callable = Callable(p_id, p_method);
+	msg->type = TYPE_CALL | FLAG_UNIQUE;
+
+	return OK;
+}
+
+Error MessageQueue::push_unique_call(Object *p_object, const StringName &p_method) {
+	return push_unique_call(p_object->get_instance_id(), p_method);
+}
+
+Error MessageQueue::push_native_call(ObjectID p_id, NativeCallFunc p_func, const void *p_data, uint32_t p_data_size, bool p_unique) {
 	_THREAD_SAFE_METHOD_
 
-	int room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+	ERR_FAIL_NULL_V(p_func, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(p_data_size > NATIVE_CALL_DATA_MAX, ERR_INVALID_PARAMETER);
+
+	UniqueCall unique;
+	if (p_unique) {
+		unique.object = p_id;
+		unique.func = p_func;
+		if (p_data_size) {
+			memcpy(unique.data, p_data, p_data_size);
+		}
+		if (pending_unique.has(unique)) {
+			return OK;
+		}
+		pending_unique.set(unique, true);
+	}
+
+	Message *msg = _alloc_message(sizeof(Message) + sizeof(NativeCall));
+	msg->args = 0;
+	msg->type = TYPE_NATIVE_CALL;
+	if (p_unique) {
+		msg->type |= FLAG_UNIQUE;
+	}
 
-	if ((buffer_end + room_needed) >= buffer_size) {
-		print_line("Failed method: " + p_callable);
-		statistics();
-		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
+	NativeCall *native = memnew_placement(msg + 1, NativeCall);
+	native->object = p_id;
+	native->func = p_func;
+	memset(native->data, 0, sizeof(native->data));
+	if (p_data_size) {
+		memcpy(native->data, p_data, p_data_size);
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
+	return OK;
+}
+
+Error MessageQueue::push_callable(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	_THREAD_SAFE_METHOD_
+
+	Message *msg = _alloc_message(sizeof(Message) + sizeof(Variant) * p_argcount);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
@@ -144,12 +236,9 @@ Error MessageQueue::push_callable(const Callable &p_callable, const Variant **p_
 		msg->type |= FLAG_SHOW_ERROR;
 	}
 
-	buffer_end += sizeof(Message);
-
+	Variant *args = (Variant *)(msg + 1);
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-		buffer_end += sizeof(Variant);
-		*v = *p_args[i];
+		memnew_placement(&args[i], Variant(*p_args[i]));
 	}
 
 	return OK;
@@ -174,58 +263,63 @@ void MessageQueue::statistics() {
 	Map<StringName, int> set_count;
 	Map<int, int> notify_count;
 	Map<Callable, int> call_count;
+	int native_count = 0;
 	int null_count = 0;
 
-	uint32_t read_pos = 0;
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
+	for (uint32_t i = 0; i < pages.size(); i++) {
+		uint32_t read_pos = 0;
+		while (read_pos < pages[i].end) {
+			Message *message = (Message *)&pages[i].data[read_pos];
 
-		Object *target = message->callable.get_object();
+			Object *target = _get_message_target(message);
 
-		if (target != nullptr) {
-			switch (message->type & FLAG_MASK) {
-				case TYPE_CALL: {
-					if (!call_count.has(message->callable)) {
-						call_count[message->callable] = 0;
-					}
+			if (target != nullptr) {
+				switch (message->type & FLAG_MASK) {
+					case TYPE_CALL: {
+						if (!call_count.has(message->callable)) {
+							call_count[message->callable] = 0;
+						}
 
-					call_count[message->callable]++;
+						call_count[message->callable]++;
 
-				} break;
-				case TYPE_NOTIFICATION: {
-					if (!notify_count.has(message->notification)) {
-						notify_count[message->notification] = 0;
-					}
+					} break;
+					case TYPE_NOTIFICATION: {
+						if (!notify_count.has(message->notification)) {
+							notify_count[message->notification] = 0;
+						}
 
-					notify_count[message->notification]++;
+						notify_count[message->notification]++;
 
-				} break;
-				case TYPE_SET: {
-					StringName t = message->callable.get_method();
-					if (!set_count.has(t)) {
-						set_count[t] = 0;
-					}
+					} break;
+					case TYPE_SET: {
+						StringName t = message->callable.get_method();
+						if (!set_count.has(t)) {
+							set_count[t] = 0;
+						}
 
-					set_count[t]++;
+						set_count[t]++;
 
-				} break;
-			}
+					} break;
+					case TYPE_NATIVE_CALL: {
+						native_count++;
+					} break;
+				}
 
-		} else {
-			//object was deleted
-			print_line("Object was deleted while awaiting a callback");
+			} else {
+				//object was deleted
+				print_line("Object was deleted while awaiting a callback");
 
-			null_count++;
-		}
+				null_count++;
+			}
 
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+			read_pos += _get_message_size(message);
 		}
 	}
 
 	print_line("TOTAL BYTES: " + itos(buffer_end));
+	print_line("TOTAL PAGES: " + itos(pages.size()));
 	print_line("NULL count: " + itos(null_count));
+	print_line("NATIVE CALL count: " + itos(native_count));
 
 	for (Map<StringName, int>::Element *E = set_count.front(); E; E = E->next()) {
 		print_line("SET " + E->key() + ": " + itos(E->get()));
@@ -266,6 +360,7 @@ void MessageQueue::flush() {
 		buffer_max_used = buffer_end;
 	}
 
+	uint32_t page_index = 0;
 	uint32_t read_pos = 0;
 
 	//using reverse locking strategy
@@ -277,22 +372,31 @@ void MessageQueue::flush() {
 	}
 	flushing = true;
 
-	while (read_pos < buffer_end) {
+	while (true) {
 		//lock on each iteration, so a call can re-add itself to the message queue
 
-		Message *message = (Message *)&buffer[read_pos];
-
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
+		if (read_pos >= pages[page_index].end) {
+			if (page_index + 1 >= pages.size()) {
+				break;
+			}
+			page_index++;
+			read_pos = 0;
+			continue;
 		}
 
+		Message *message = (Message *)&pages[page_index].data[read_pos];
+
 		//pre-advance so this function is reentrant
-		read_pos += advance;
+		read_pos += _get_message_size(message);
+
+		if (message->type & FLAG_UNIQUE) {
+			// Allow the call to queue itself again.
+			pending_unique.erase(_get_unique_call(message));
+		}
 
 		_THREAD_SAFE_UNLOCK_
 
-		Object *target = message->callable.get_object();
+		Object *target = _get_message_target(message);
 
 		if (target != nullptr) {
 			switch (message->type & FLAG_MASK) {
@@ -315,21 +419,26 @@ void MessageQueue::flush() {
 					target->set(message->callable.get_method(), *arg);
 
 				} break;
-			}
-		}
+				case TYPE_NATIVE_CALL: {
+					const NativeCall *native = (const NativeCall *)(message + 1);
+					native->func(target, native->data);
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int i = 0; i < message->args; i++) {
-				args[i].~Variant();
+				} break;
 			}
 		}
 
-		message->~Message();
+		_free_message(message);
 
 		_THREAD_SAFE_LOCK_
 	}
 
+	// Keep the first page around, release the ones that were added when it filled up.
+	for (uint32_t i = 1; i < pages.size(); i++) {
+		memdelete_arr(pages[i].data);
+	}
+	pages.resize(1);
+	pages[0].end = 0;
+
 	buffer_end = 0; // reset buffer
 	flushing = false;
 	_THREAD_SAFE_UNLOCK_
@@ -346,29 +455,23 @@ MessageQueue::MessageQueue() {
 	buffer_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
 	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/message_queue/max_size_kb", PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_kb", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater"));
 	buffer_size *= 1024;
-	buffer = memnew_arr(uint8_t, buffer_size);
+
+	Page page;
+	page.size = buffer_size;
+	page.data = memnew_arr(uint8_t, buffer_size);
+	pages.push_back(page);
 }
 
 MessageQueue::~MessageQueue() {
-	uint32_t read_pos = 0;
-
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
-		Variant *args = (Variant *)(message + 1);
-		int argc = message->args;
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			for (int i = 0; i < argc; i++) {
-				args[i].~Variant();
-			}
-		}
-		message->~Message();
-
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+	for (uint32_t i = 0; i < pages.size(); i++) {
+		uint32_t read_pos = 0;
+		while (read_pos < pages[i].end) {
+			Message *message = (Message *)&pages[i].data[read_pos];
+			read_pos += _get_message_size(message);
+			_free_message(message);
 		}
+		memdelete_arr(pages[i].data);
 	}
 
 	singleton = nullptr;
-	memdelete_arr(buffer);
 }
@@ -33,6 +33,8 @@
 
 #include "core/object/class_db.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/flat_hash_map.h"
+#include "core/templates/local_vector.h"
 
 class MessageQueue {
 	_THREAD_SAFE_CLASS_
@@ -45,11 +47,21 @@ class MessageQueue {
 		TYPE_CALL,
 		TYPE_NOTIFICATION,
 		TYPE_SET,
+		TYPE_NATIVE_CALL,
+		FLAG_UNIQUE = 1 << 13,
 		FLAG_SHOW_ERROR = 1 << 14,
-		FLAG_MASK = FLAG_SHOW_ERROR - 1
+		FLAG_MASK = FLAG_UNIQUE - 1
 
 	};
 
+public:
+	typedef void (*NativeCallFunc)(Object *p_object, const void *p_data);
+
+private:
+	enum {
+		NATIVE_CALL_DATA_MAX = 16
+	};
+
 	struct Message {
 		Callable callable;
 		int16_t type;
@@ -59,11 +71,56 @@ class MessageQueue {
 		};
 	};
 
-	uint8_t *buffer;
+	// Follows a TYPE_NATIVE_CALL message, the callable of which is left empty.
+	struct NativeCall {
+		ObjectID object;
+		NativeCallFunc func;
+		uint64_t data[NATIVE_CALL_DATA_MAX / sizeof(uint64_t)];
+	};
+
+	struct UniqueCall {
+		ObjectID object;
+		StringName method;
+		NativeCallFunc func = nullptr;
+		uint64_t data[NATIVE_CALL_DATA_MAX / sizeof(uint64_t)] = {};
+
+		bool operator==(const UniqueCall &p_other) const {
+			return object == p_other.object && method == p_other.method && func == p_other.func && data[0] == p_other.data[0] && data[1] == p_other.data[1];
+		}
+	};
+
+	struct UniqueCallHasher {
+		static _FORCE_INLINE_ uint32_t hash(const UniqueCall &p_call) {
+			uint64_t h = hash_djb2_one_64((uint64_t)p_call.object);
+			h = hash_djb2_one_64(p_call.method.hash(), h);
+			h = hash_djb2_one_64((uint64_t)p_call.func, h);
+			h = hash_djb2_one_64(p_call.data[0], h);
+			h = hash_djb2_one_64(p_call.data[1], h);
+			return (uint32_t)(h ^ (h >> 32));
+		}
+	};
+
+	// Messages are never moved once written, so they can be read while the
+	// calls they trigger push new ones. The first page is kept between flushes,
+	// overflow pages are freed once flushed.
+	struct Page {
+		uint8_t *data = nullptr;
+		uint32_t size = 0;
+		uint32_t end = 0;
+	};
+
+	LocalVector<Page> pages;
 	uint32_t buffer_end = 0;
 	uint32_t buffer_max_used = 0;
 	uint32_t buffer_size;
 
+	FlatHashMap<UniqueCall, bool, UniqueCallHasher> pending_unique;
+
+	Message *_alloc_message(uint32_t p_room_needed);
+	static uint32_t _get_message_size(const Message *p_message);
+	static Object *_get_message_target(const Message *p_message);
+	static UniqueCall _get_unique_call(const Message *p_message);
+	static void _free_message(Message *p_message);
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
 	static MessageQueue *singleton;
@@ -84,6 +141,29 @@ public:
 	Error push_notification(Object *p_object, int p_notification);
 	Error push_set(Object *p_object, const StringName &p_prop, const Variant &p_value);
 
+	// Argument-less call that is skipped if the same call is already queued and not yet flushed.
+	Error push_unique_call(ObjectID p_id, const StringName &p_method);
+	Error push_unique_call(Object *p_object, const StringName &p_method);
+
+	// Calls p_func with the object and a copy of p_data, without going through Variant.
+	Error push_native_call(ObjectID p_id, NativeCallFunc p_func, const void *p_data, uint32_t p_data_size, bool p_unique = false);
+
+	template <class T>
+	Error push_callp(T *p_object, void (T::*p_method)(), bool p_unique = false) {
+		static_assert(sizeof(p_method) <= NATIVE_CALL_DATA_MAX, "Method pointer too big for a native deferred call.");
+		NativeCallFunc func = [](Object *p_obj, const void *p_data) {
+			void (T::*method)();
+			memcpy(&method, p_data, sizeof(method));
+			(static_cast<T *>(p_obj)->*method)();
+		};
+		return push_native_call(p_object->get_instance_id(), func, &p_method, sizeof(p_method), p_unique);
+	}
+
+	template <class T>
+	Error push_unique_callp(T *p_object, void (T::*p_method)()) {
+		return push_callp(p_object, p_method, true);
+	}
+
 	void statistics();
 	void flush();
 
@@ -38,6 +38,7 @@
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "core/string/translation.h"
+#include "core/variant/variant_internal.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -977,6 +978,31 @@ Variant Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::C
 	return Variant();
 }
 
+bool Object::_signal_ptrcall(MethodBind *p_method, Object *p_target, const Variant **p_args, int p_argcount) {
+	if (p_method->get_argument_count() != p_argcount) {
+		return false;
+	}
+
+	const void **argptrs = (const void **)alloca(sizeof(void *) * MAX(p_argcount, 1));
+	for (int i = 0; i < p_argcount; i++) {
+		Variant::Type type = p_method->get_argument_type(i);
+		if (type == Variant::NIL) {
+			// Variant argument, passed as is.
+			argptrs[i] = p_args[i];
+		} else if (type != Variant::OBJECT && p_args[i]->get_type() == type) {
+			argptrs[i] = VariantInternal::get_opaque_pointer(p_args[i]);
+		} else {
+			// Needs a conversion, or a class check and freed instance check for objects.
+			return false;
+		}
+	}
+
+	_emitting = true;
+	p_method->ptrcall(p_target, argptrs, nullptr);
+	_emitting = false;
+	return true;
+}
+
 Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
@@ -998,7 +1024,8 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 	//copy on write will ensure that disconnecting the signal or even deleting the object will not affect the signal calling.
 	//this happens automatically and will not change the performance of calling.
 	//awesome, isn't it?
-	VMap<Callable, SignalData::Slot> slot_map = s->slot_map;
+	//keep the copy const, as non-const access would trigger the actual copy.
+	const VMap<Callable, SignalData::Slot> slot_map = s->slot_map;
 
 	int ssize = slot_map.size();
 
@@ -1009,7 +1036,8 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 	Error err = OK;
 
 	for (int i = 0; i < ssize; i++) {
-		const Connection &c = slot_map.getv(i).conn;
+		const SignalData::Slot &slot = slot_map.getv(i);
+		const Connection &c = slot.conn;
 
 		Object *target = c.callable.get_object();
 		if (!target) {
@@ -1037,6 +1065,8 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 
 		if (c.flags & CONNECT_DEFERRED) {
 			MessageQueue::get_singleton()->push_callable(c.callable, args, argc, true);
+		} else if (slot.method_bind && !target->get_script_instance() && _signal_ptrcall(slot.method_bind, target, args, argc)) {
+			// Called directly, skipping the method lookup and the Variant conversion of arguments.
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
@@ -1301,6 +1331,13 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, co
 	if (p_flags & CONNECT_REFERENCE_COUNTED) {
 		slot.reference_count = 1;
 	}
+	if (!target.is_custom() && !(p_flags & CONNECT_DEFERRED)) {
+		// The native class of an object never changes, so the bind stays valid as long as the connection.
+		MethodBind *mb = ClassDB::get_method(target_object->get_class_name(), target.get_method());
+		if (mb && !mb->is_vararg() && !mb->has_return()) {
+			slot.method_bind = mb;
+		}
+	}
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*target.get_base_comparator()] = slot;
@@ -1308,6 +1345,11 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, co
 	return OK;
 }
 
+bool Object::has_connections(const StringName &p_signal) const {
+	const SignalData *s = signal_map.getptr(p_signal);
+	return s && s->slot_map.size() > 0;
+}
+
 bool Object::is_connected(const StringName &p_signal, const Callable &p_callable) const {
 	ERR_FAIL_COND_V(p_callable.is_null(), false);
 	const SignalData *s = signal_map.getptr(p_signal);
@@ -1819,61 +1861,97 @@ void postinitialize_handler(Object *p_object) {
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func) {
-	spin_lock.lock();
-
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
-
-			count--;
+	// Not synchronized with objects being created or freed concurrently, like
+	// the lookups themselves; call from a point where that can't happen.
+	uint32_t max = slot_max.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < max; i++) {
+		ObjectSlot *object_slot = _get_slot(i);
+		if (object_slot && object_slot->validator.load(std::memory_order_acquire)) {
+			p_func(object_slot->object.load(std::memory_order_relaxed));
 		}
 	}
-	spin_lock.unlock();
 }
 
 void Object::get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const {
 }
 
-SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::slot_pages[OBJECTDB_SLOT_PAGE_COUNT] = {};
+SpinLock ObjectDB::page_lock;
+ObjectDB::FreeList ObjectDB::free_lists[OBJECTDB_SHARD_COUNT];
+std::atomic<uint32_t> ObjectDB::slot_count = { 0 };
+std::atomic<uint32_t> ObjectDB::slot_max = { 0 };
+std::atomic<uint64_t> ObjectDB::validator_counter = { 0 };
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	return slot_count.load(std::memory_order_relaxed);
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
-	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+uint32_t ObjectDB::_get_thread_shard() {
+	static std::atomic<uint32_t> next_shard = { 0 };
+	static thread_local uint32_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % OBJECTDB_SHARD_COUNT;
+	return shard;
+}
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_reference = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+uint32_t ObjectDB::_alloc_slot() {
+	// Reuse a slot freed on this thread's shard first, then any other shard,
+	// and only grow the table when no freed slot is left.
+	uint32_t shard = _get_thread_shard();
+	for (uint32_t i = 0; i < OBJECTDB_SHARD_COUNT; i++) {
+		FreeList &free_list = free_lists[(shard + i) % OBJECTDB_SHARD_COUNT];
+		if (free_list.count.load(std::memory_order_relaxed) == 0) {
+			continue;
+		}
+		free_list.lock.lock();
+		if (free_list.count.load(std::memory_order_relaxed) > 0) {
+			uint32_t slot = free_list.head;
+			free_list.head = _get_slot(slot)->next_free;
+			free_list.count.fetch_sub(1, std::memory_order_relaxed);
+			free_list.lock.unlock();
+			return slot;
+		}
+		free_list.lock.unlock();
+	}
+
+	uint32_t slot = slot_max.fetch_add(1, std::memory_order_acq_rel);
+	CRASH_COND(slot >= (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+
+	uint32_t page = slot >> OBJECTDB_SLOT_PAGE_BITS;
+	if (unlikely(!slot_pages[page].load(std::memory_order_acquire))) {
+		page_lock.lock();
+		if (!slot_pages[page].load(std::memory_order_relaxed)) {
+			ObjectSlot *slots = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_SLOT_PAGE_SIZE);
+			for (uint32_t i = 0; i < OBJECTDB_SLOT_PAGE_SIZE; i++) {
+				memnew_placement(&slots[i], ObjectSlot);
+				slots[i].validator.store(0, std::memory_order_relaxed);
+				slots[i].object.store(nullptr, std::memory_order_relaxed);
+				slots[i].next_free = 0;
+				slots[i].is_reference = false;
+			}
+			slot_pages[page].store(slots, std::memory_order_release);
 		}
-		slot_max = new_slot_max;
+		page_lock.unlock();
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
-		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
-	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_reference = p_object->is_reference();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
-	}
-	object_slots[slot].validator = validator_counter;
+	return slot;
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	uint32_t slot = _alloc_slot();
+	ObjectSlot *object_slot = _get_slot(slot);
 
-	uint64_t id = validator_counter;
+	ERR_FAIL_COND_V(object_slot->object.load(std::memory_order_relaxed) != nullptr, ObjectID());
+
+	uint64_t validator;
+	do {
+		validator = (validator_counter.fetch_add(1, std::memory_order_relaxed) + 1) & OBJECTDB_VALIDATOR_MASK;
+	} while (unlikely(validator == 0));
+
+	object_slot->is_reference = p_object->is_reference();
+	object_slot->object.store(p_object, std::memory_order_relaxed);
+	// Publishing the validator last makes the slot visible to get_instance().
+	object_slot->validator.store(validator, std::memory_order_release);
+
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -1881,9 +1959,7 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
-
-	spin_lock.unlock();
+	slot_count.fetch_add(1, std::memory_order_relaxed);
 
 	return ObjectID(id);
 }
@@ -1891,34 +1967,32 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
-
-	spin_lock.lock();
+	ObjectSlot *object_slot = _get_slot(slot);
 
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
-	}
+	ERR_FAIL_COND(object_slot->object.load(std::memory_order_relaxed) != p_object);
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+		ERR_FAIL_COND(object_slot->validator.load(std::memory_order_relaxed) != validator);
 	}
 
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_reference = false;
-	object_slots[slot].object = nullptr;
+	object_slot->validator.store(0, std::memory_order_release);
+	object_slot->is_reference = false;
+	object_slot->object.store(nullptr, std::memory_order_release);
+
+	//decrease slot count
+	slot_count.fetch_sub(1, std::memory_order_relaxed);
 
-	spin_lock.unlock();
+	//set the free slot properly
+	FreeList &free_list = free_lists[_get_thread_shard()];
+	free_list.lock.lock();
+	object_slot->next_free = free_list.head;
+	free_list.head = slot;
+	free_list.count.fetch_add(1, std::memory_order_relaxed);
+	free_list.lock.unlock();
 }
 
 void ObjectDB::setup() {
@@ -1926,9 +2000,7 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
-	if (slot_count > 0) {
-		spin_lock.lock();
-
+	if (slot_count.load() > 0) {
 		WARN_PRINT("ObjectDB instances leaked at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
@@ -1938,9 +2010,10 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, max = slot_max.load(); i < max; i++) {
+				ObjectSlot *object_slot = _get_slot(i);
+				if (object_slot && object_slot->validator.load()) {
+					Object *obj = object_slot->object.load();
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -1950,18 +2023,23 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_VALIDATOR_BITS) | (object_slots[i].is_reference ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | (uint64_t(object_slot->validator.load()) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slot->is_reference ? OBJECTDB_REFERENCE_BIT : 0);
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + itos(id) + extra_info);
-
-					count--;
 				}
 			}
 			print_line("Hint: Leaked instances typically happen when nodes are removed from the scene tree (with `remove_child()`) but not freed (with `free()` or `queue_free()`).");
 		}
-		spin_lock.unlock();
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < OBJECTDB_SLOT_PAGE_COUNT; i++) {
+		ObjectSlot *slots = slot_pages[i].exchange(nullptr);
+		if (slots) {
+			memfree(slots);
+		}
+	}
+	for (uint32_t i = 0; i < OBJECTDB_SHARD_COUNT; i++) {
+		free_lists[i].head = 0;
+		free_lists[i].count.store(0);
 	}
+	slot_max.store(0);
 }
@@ -34,6 +34,7 @@
 #include "core/object/object_id.h"
 #include "core/os/rw_lock.h"
 #include "core/os/spin_lock.h"
+#include "core/templates/flat_hash_map.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/list.h"
 #include "core/templates/map.h"
@@ -400,6 +401,7 @@ public:                                                                 \
                                                                         \
 private:
 
+class MethodBind;
 class ScriptInstance;
 
 class Object {
@@ -441,13 +443,15 @@ private:
 			int reference_count = 0;
 			Connection conn;
 			List<Connection>::Element *cE = nullptr;
+			// Native method of the target, resolved on connect for the ptrcall fast path.
+			MethodBind *method_bind = nullptr;
 		};
 
 		MethodInfo user;
 		VMap<Callable, Slot> slot_map;
 	};
 
-	HashMap<StringName, SignalData> signal_map;
+	FlatHashMap<StringName, SignalData> signal_map;
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
@@ -473,6 +477,7 @@ private:
 	void _add_user_signal(const String &p_name, const Array &p_args = Array());
 	bool _has_user_signal(const StringName &p_name) const;
 	Variant _emit_signal(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	bool _signal_ptrcall(MethodBind *p_method, Object *p_target, const Variant **p_args, int p_argcount);
 	Array _get_signal_list() const;
 	Array _get_signal_connection_list(const String &p_signal) const;
 	Array _get_incoming_connections() const;
@@ -681,6 +686,7 @@ public:
 	Error connect(const StringName &p_signal, const Callable &p_callable, const Vector<Variant> &p_binds = Vector<Variant>(), uint32_t p_flags = 0);
 	void disconnect(const StringName &p_signal, const Callable &p_callable);
 	bool is_connected(const StringName &p_signal, const Callable &p_callable) const;
+	bool has_connections(const StringName &p_signal) const; // Lets emitters skip building arguments nobody receives.
 
 	void call_deferred(const StringName &p_method, VARIANT_ARG_LIST);
 	void set_deferred(const StringName &p_property, const Variant &p_value);
@@ -736,18 +742,44 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
-	struct ObjectSlot { //128 bits per slot
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_reference : 1;
-		Object *object;
+#define OBJECTDB_SLOT_PAGE_BITS 12
+#define OBJECTDB_SLOT_PAGE_SIZE (1 << OBJECTDB_SLOT_PAGE_BITS)
+#define OBJECTDB_SLOT_PAGE_MASK (OBJECTDB_SLOT_PAGE_SIZE - 1)
+#define OBJECTDB_SLOT_PAGE_COUNT (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_PAGE_BITS))
+#define OBJECTDB_SHARD_COUNT 8
+
+	struct ObjectSlot {
+		std::atomic<uint64_t> validator; // Zero while the slot is free.
+		std::atomic<Object *> object;
+		uint32_t next_free; // Guarded by the lock of the shard whose free list holds the slot.
+		bool is_reference;
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	// Slots live in fixed-size pages that are never moved or freed before
+	// cleanup(), so get_instance() can validate an ID without taking a lock.
+	static std::atomic<ObjectSlot *> slot_pages[OBJECTDB_SLOT_PAGE_COUNT];
+	static SpinLock page_lock;
+
+	// Freed slots are kept in per-thread-group free lists, so threads creating
+	// and freeing objects at the same time rarely contend on the same lock.
+	struct FreeList {
+		SpinLock lock;
+		uint32_t head = 0;
+		std::atomic<uint32_t> count = { 0 };
+	};
+	static FreeList free_lists[OBJECTDB_SHARD_COUNT];
+
+	static std::atomic<uint32_t> slot_count;
+	static std::atomic<uint32_t> slot_max; // Slots handed out so far, free or not.
+	static std::atomic<uint64_t> validator_counter;
+
+	_ALWAYS_INLINE_ static ObjectSlot *_get_slot(uint32_t p_slot) {
+		ObjectSlot *page = slot_pages[p_slot >> OBJECTDB_SLOT_PAGE_BITS].load(std::memory_order_acquire);
+		return page ? &page[p_slot & OBJECTDB_SLOT_PAGE_MASK] : nullptr;
+	}
+
+	static uint32_t _get_thread_shard();
+	static uint32_t _alloc_slot();
 
 	friend class Object;
 	friend void unregister_core_types();
@@ -766,20 +798,25 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); //this should never happen unless RID is corrupted
+		ERR_FAIL_COND_V(slot >= slot_max.load(std::memory_order_acquire), nullptr); //this should never happen unless RID is corrupted
 
-		spin_lock.lock();
+		ObjectSlot *object_slot = _get_slot(slot);
+		if (unlikely(!object_slot)) {
+			return nullptr;
+		}
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely(object_slot->validator.load(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot->object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed and reused while reading it.
+		if (unlikely(object_slot->validator.load(std::memory_order_acquire) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -30,8 +30,181 @@
 
 #include "undo_redo.h"
 
+#include "core/io/marshalls.h"
 #include "core/io/resource.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
+
+// Packed arrays with fewer elements than this are always stored whole.
+#define MIN_DELTA_ELEMENTS 1024
+
+template <class T>
+static bool _make_array_delta(const Vector<T> &p_from, const Vector<T> &p_to, Vector<uint8_t> &r_delta) {
+	int size = p_from.size();
+	if (size != p_to.size() || size < MIN_DELTA_ELEMENTS) {
+		return false;
+	}
+
+	// Runs of elements that differ, each stored as offset, count and the elements of p_from.
+	const T *from = p_from.ptr();
+	const T *to = p_to.ptr();
+	uint32_t max_size = size * sizeof(T) / 2; // Not worth it past this.
+	LocalVector<uint8_t> delta;
+
+	int i = 0;
+	while (i < size) {
+		if (memcmp(&from[i], &to[i], sizeof(T)) == 0) {
+			i++;
+			continue;
+		}
+		int begin = i;
+		while (i < size && memcmp(&from[i], &to[i], sizeof(T)) != 0) {
+			i++;
+		}
+
+		uint32_t ofs = delta.size();
+		uint32_t bytes = (i - begin) * sizeof(T);
+		if (ofs + 8 + bytes > max_size) {
+			return false;
+		}
+		delta.resize(ofs + 8 + bytes);
+		encode_uint32(begin, &delta[ofs]);
+		encode_uint32(i - begin, &delta[ofs + 4]);
+		memcpy(&delta[ofs + 8], &from[begin], bytes);
+	}
+
+	r_delta.resize(delta.size());
+	if (delta.size()) {
+		memcpy(r_delta.ptrw(), delta.ptr(), delta.size());
+	}
+	return true;
+}
+
+template <class T>
+static Vector<T> _apply_array_delta(const Vector<T> &p_to, const Vector<uint8_t> &p_delta) {
+	Vector<T> result = p_to;
+	T *w = result.ptrw();
+	const uint8_t *r = p_delta.ptr();
+
+	int ofs = 0;
+	while (ofs + 8 <= p_delta.size()) {
+		uint32_t begin = decode_uint32(&r[ofs]);
+		uint32_t count = decode_uint32(&r[ofs + 4]);
+		ERR_FAIL_COND_V(begin + count > (uint32_t)result.size() || ofs + 8 + count * sizeof(T) > (uint32_t)p_delta.size(), p_to);
+		memcpy(&w[begin], &r[ofs + 8], count * sizeof(T));
+		ofs += 8 + count * sizeof(T);
+	}
+	return result;
+}
+
+static bool _make_delta(const Variant &p_from, const Variant &p_to, Vector<uint8_t> &r_delta) {
+	if (p_from.get_type() != p_to.get_type()) {
+		return false;
+	}
+
+	switch (p_from.get_type()) {
+		case Variant::PACKED_BYTE_ARRAY:
+			return _make_array_delta<uint8_t>(p_from, p_to, r_delta);
+		case Variant::PACKED_INT32_ARRAY:
+			return _make_array_delta<int32_t>(p_from, p_to, r_delta);
+		case Variant::PACKED_INT64_ARRAY:
+			return _make_array_delta<int64_t>(p_from, p_to, r_delta);
+		case Variant::PACKED_FLOAT32_ARRAY:
+			return _make_array_delta<float>(p_from, p_to, r_delta);
+		case Variant::PACKED_FLOAT64_ARRAY:
+			return _make_array_delta<double>(p_from, p_to, r_delta);
+		case Variant::PACKED_VECTOR2_ARRAY:
+			return _make_array_delta<Vector2>(p_from, p_to, r_delta);
+		case Variant::PACKED_VECTOR3_ARRAY:
+			return _make_array_delta<Vector3>(p_from, p_to, r_delta);
+		case Variant::PACKED_COLOR_ARRAY:
+			return _make_array_delta<Color>(p_from, p_to, r_delta);
+		default:
+			return false;
+	}
+}
+
+static Variant _apply_delta(const Variant &p_to, const Vector<uint8_t> &p_delta) {
+	switch (p_to.get_type()) {
+		case Variant::PACKED_BYTE_ARRAY:
+			return _apply_array_delta<uint8_t>(p_to, p_delta);
+		case Variant::PACKED_INT32_ARRAY:
+			return _apply_array_delta<int32_t>(p_to, p_delta);
+		case Variant::PACKED_INT64_ARRAY:
+			return _apply_array_delta<int64_t>(p_to, p_delta);
+		case Variant::PACKED_FLOAT32_ARRAY:
+			return _apply_array_delta<float>(p_to, p_delta);
+		case Variant::PACKED_FLOAT64_ARRAY:
+			return _apply_array_delta<double>(p_to, p_delta);
+		case Variant::PACKED_VECTOR2_ARRAY:
+			return _apply_array_delta<Vector2>(p_to, p_delta);
+		case Variant::PACKED_VECTOR3_ARRAY:
+			return _apply_array_delta<Vector3>(p_to, p_delta);
+		case Variant::PACKED_COLOR_ARRAY:
+			return _apply_array_delta<Color>(p_to, p_delta);
+		default:
+			ERR_FAIL_V(p_to);
+	}
+}
+
+// Rough size of what a value keeps alive, arrays shared with other operations are counted for each.
+static uint64_t _get_variant_memory(const Variant &p_variant) {
+	uint64_t size = sizeof(Variant);
+
+	switch (p_variant.get_type()) {
+		case Variant::STRING: {
+			size += String(p_variant).length() * sizeof(char32_t);
+		} break;
+		case Variant::ARRAY: {
+			Array array = p_variant;
+			for (int i = 0; i < array.size(); i++) {
+				size += _get_variant_memory(array[i]);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary dict = p_variant;
+			List<Variant> keys;
+			dict.get_key_list(&keys);
+			for (List<Variant>::Element *E = keys.front(); E; E = E->next()) {
+				size += _get_variant_memory(E->get()) + _get_variant_memory(dict[E->get()]);
+			}
+		} break;
+		case Variant::PACKED_BYTE_ARRAY: {
+			size += PackedByteArray(p_variant).size();
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			size += PackedInt32Array(p_variant).size() * sizeof(int32_t);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			size += PackedInt64Array(p_variant).size() * sizeof(int64_t);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			size += PackedFloat32Array(p_variant).size() * sizeof(float);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			size += PackedFloat64Array(p_variant).size() * sizeof(double);
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			PackedStringArray strings = p_variant;
+			for (int i = 0; i < strings.size(); i++) {
+				size += sizeof(String) + strings[i].length() * sizeof(char32_t);
+			}
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			size += PackedVector2Array(p_variant).size() * sizeof(Vector2);
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			size += PackedVector3Array(p_variant).size() * sizeof(Vector3);
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			size += PackedColorArray(p_variant).size() * sizeof(Color);
+		} break;
+		default: {
+		}
+	}
+
+	return size;
+}
 
 void UndoRedo::_discard_redo() {
 	if (current_action == actions.size() - 1) {
@@ -48,6 +221,7 @@ void UndoRedo::_discard_redo() {
 			}
 		}
 		//ERASE do data
+		history_memory -= actions[i].memory;
 	}
 
 	actions.resize(current_action + 1);
@@ -174,6 +348,18 @@ void UndoRedo::add_do_property(Object *p_object, const StringName &p_property, c
 	do_op.type = Operation::TYPE_PROPERTY;
 	do_op.name = p_property;
 	do_op.args[0] = p_value;
+
+	if (merging && merge_mode == MERGE_ALL) {
+		// Only the last value set while merging is needed, e.g. for the many steps of a drag.
+		for (List<Operation>::Element *E = actions.write[current_action + 1].do_ops.front(); E; E = E->next()) {
+			Operation &op = E->get();
+			if (op.type == Operation::TYPE_PROPERTY && op.object == do_op.object && op.name == p_property) {
+				op.args[0] = p_value;
+				return;
+			}
+		}
+	}
+
 	actions.write[current_action + 1].do_ops.push_back(do_op);
 }
 
@@ -196,6 +382,17 @@ void UndoRedo::add_undo_property(Object *p_object, const StringName &p_property,
 	undo_op.type = Operation::TYPE_PROPERTY;
 	undo_op.name = p_property;
 	undo_op.args[0] = p_value;
+
+	if (merging && merge_mode == MERGE_ALL) {
+		// The value from before the first merged action is the one to restore.
+		for (const List<Operation>::Element *E = actions[current_action + 1].undo_ops.front(); E; E = E->next()) {
+			const Operation &op = E->get();
+			if (op.type == Operation::TYPE_PROPERTY && op.object == undo_op.object && op.name == p_property) {
+				return;
+			}
+		}
+	}
+
 	actions.write[current_action + 1].undo_ops.push_back(undo_op);
 }
 
@@ -249,12 +446,63 @@ void UndoRedo::_pop_history_tail() {
 		}
 	}
 
+	history_memory -= actions[0].memory;
 	actions.remove(0);
 	if (current_action >= 0) {
 		current_action--;
 	}
 }
 
+void UndoRedo::_compact_action(Action &p_action) {
+	for (List<Operation>::Element *E = p_action.undo_ops.front(); E; E = E->next()) {
+		Operation &undo_op = E->get();
+		if (undo_op.type != Operation::TYPE_PROPERTY) {
+			continue;
+		}
+
+		const Operation *do_op = nullptr;
+		for (List<Operation>::Element *F = p_action.do_ops.back(); F; F = F->prev()) {
+			const Operation &op = F->get();
+			if (op.type == Operation::TYPE_PROPERTY && op.object == undo_op.object && op.name == undo_op.name) {
+				do_op = &op;
+				break;
+			}
+		}
+		if (!do_op) {
+			continue;
+		}
+
+		// Rebase on the current "do" value, it may have been replaced while merging.
+		Variant value = undo_op.delta.is_empty() ? undo_op.args[0] : _apply_delta(undo_op.args[0], undo_op.delta);
+		Vector<uint8_t> delta;
+		if (_make_delta(value, do_op->args[0], delta)) {
+			undo_op.args[0] = do_op->args[0];
+			undo_op.delta = delta;
+		} else {
+			undo_op.args[0] = value;
+			undo_op.delta.clear();
+		}
+	}
+}
+
+uint64_t UndoRedo::_get_action_memory(const Action &p_action) const {
+	uint64_t memory = sizeof(Action) + p_action.name.length() * sizeof(char32_t);
+	const List<Operation> *lists[2] = { &p_action.do_ops, &p_action.undo_ops };
+	for (int i = 0; i < 2; i++) {
+		for (const List<Operation>::Element *E = lists[i]->front(); E; E = E->next()) {
+			const Operation &op = E->get();
+			memory += sizeof(Operation) + op.delta.size();
+			// With a delta, args[0] is shared with the "do" operation.
+			for (int j = op.delta.is_empty() ? 0 : 1; j < VARIANT_ARG_MAX; j++) {
+				if (op.args[j].get_type() != Variant::NIL) {
+					memory += _get_variant_memory(op.args[j]);
+				}
+			}
+		}
+	}
+	return memory;
+}
+
 bool UndoRedo::is_committing_action() const {
 	return committing > 0;
 }
@@ -271,10 +519,21 @@ void UndoRedo::commit_action(bool p_execute) {
 		merging = false;
 	}
 
+	Action &action = actions.write[actions.size() - 1];
+	_compact_action(action);
+	history_memory -= action.memory;
+	action.memory = _get_action_memory(action);
+	history_memory += action.memory;
+
 	committing++;
 	_redo(p_execute); // perform action
 	committing--;
 
+	// Drop the oldest actions past the memory limit, the one just committed is always kept.
+	while (max_memory > 0 && history_memory > max_memory && actions.size() > 1) {
+		_pop_history_tail();
+	}
+
 	if (callback && actions.size() > 0) {
 		callback(callback_ud, actions[actions.size() - 1].name);
 	}
@@ -322,7 +581,8 @@ void UndoRedo::_process_operation_list(List<Operation>::Element *E) {
 				}
 			} break;
 			case Operation::TYPE_PROPERTY: {
-				obj->set(op.name, op.args[0]);
+				Variant value = op.delta.is_empty() ? op.args[0] : _apply_delta(op.args[0], op.delta);
+				obj->set(op.name, value);
 #ifdef TOOLS_ENABLED
 				Resource *res = Object::cast_to<Resource>(obj);
 				if (res) {
@@ -330,7 +590,7 @@ void UndoRedo::_process_operation_list(List<Operation>::Element *E) {
 				}
 #endif
 				if (property_callback) {
-					property_callback(prop_callback_ud, obj, op.name, op.args[0]);
+					property_callback(prop_callback_ud, obj, op.name, value);
 				}
 			} break;
 			case Operation::TYPE_REFERENCE: {
@@ -409,6 +669,18 @@ uint64_t UndoRedo::get_version() const {
 	return version;
 }
 
+void UndoRedo::set_max_memory(uint64_t p_bytes) {
+	max_memory = p_bytes; // Applied on the next commit.
+}
+
+uint64_t UndoRedo::get_max_memory() const {
+	return max_memory;
+}
+
+uint64_t UndoRedo::get_history_memory() const {
+	return history_memory;
+}
+
 void UndoRedo::set_commit_notify_callback(CommitNotifyCallback p_callback, void *p_ud) {
 	callback = p_callback;
 	callback_ud = p_ud;
@@ -540,9 +812,14 @@ void UndoRedo::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("has_undo"), &UndoRedo::has_undo);
 	ClassDB::bind_method(D_METHOD("has_redo"), &UndoRedo::has_redo);
 	ClassDB::bind_method(D_METHOD("get_version"), &UndoRedo::get_version);
+	ClassDB::bind_method(D_METHOD("set_max_memory", "bytes"), &UndoRedo::set_max_memory);
+	ClassDB::bind_method(D_METHOD("get_max_memory"), &UndoRedo::get_max_memory);
+	ClassDB::bind_method(D_METHOD("get_history_memory"), &UndoRedo::get_history_memory);
 	ClassDB::bind_method(D_METHOD("redo"), &UndoRedo::redo);
 	ClassDB::bind_method(D_METHOD("undo"), &UndoRedo::undo);
 
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_memory"), "set_max_memory", "get_max_memory");
+
 	ADD_SIGNAL(MethodInfo("version_changed"));
 
 	BIND_ENUM_CONSTANT(MERGE_DISABLE);
@@ -65,6 +65,9 @@ private:
 		ObjectID object;
 		StringName name;
 		Variant args[VARIANT_ARG_MAX];
+		// Undo properties of large packed arrays only keep the runs that differ from the "do" value,
+		// which is then stored in args[0].
+		Vector<uint8_t> delta;
 	};
 
 	struct Action {
@@ -72,6 +75,7 @@ private:
 		List<Operation> do_ops;
 		List<Operation> undo_ops;
 		uint64_t last_tick;
+		uint64_t memory = 0;
 	};
 
 	Vector<Action> actions;
@@ -80,7 +84,11 @@ private:
 	MergeMode merge_mode = MERGE_DISABLE;
 	bool merging = false;
 	uint64_t version = 1;
+	uint64_t max_memory = 0;
+	uint64_t history_memory = 0;
 
+	void _compact_action(Action &p_action);
+	uint64_t _get_action_memory(const Action &p_action) const;
 	void _pop_history_tail();
 	void _process_operation_list(List<Operation>::Element *E);
 	void _discard_redo();
@@ -126,6 +134,10 @@ public:
 
 	uint64_t get_version() const;
 
+	void set_max_memory(uint64_t p_bytes);
+	uint64_t get_max_memory() const;
+	uint64_t get_history_memory() const;
+
 	void set_commit_notify_callback(CommitNotifyCallback p_callback, void *p_ud);
 
 	void set_method_notify_callback(MethodNotifyCallback p_method_callback, void *p_ud);
@@ -67,6 +67,7 @@ protected:
 
 private:
 	static bool backup_save;
+	static int read_buffer_size;
 
 	AccessType _access_type = ACCESS_FILESYSTEM;
 	static CreateFunc create_func[ACCESS_MAX]; /** default file access creation function for a platform */
@@ -87,6 +88,12 @@ public:
 		WRITE_READ = 7,
 	};
 
+	enum AccessPattern {
+		ACCESS_PATTERN_NORMAL,
+		ACCESS_PATTERN_SEQUENTIAL,
+		ACCESS_PATTERN_RANDOM,
+	};
+
 	virtual void close() = 0; ///< close a file
 	virtual bool is_open() const = 0; ///< true when file is open
 
@@ -110,6 +117,10 @@ public:
 	virtual real_t get_real() const;
 
 	virtual int get_buffer(uint8_t *p_dst, int p_length) const; ///< get an array of bytes
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) { return nullptr; } ///< get the next bytes in place and skip them, if the file is backed by memory that outlives it, otherwise nullptr (use get_buffer instead)
+	virtual const uint8_t *map_read_only() { return nullptr; } ///< map the whole file into memory until it's closed, or nullptr if unsupported
+	virtual void set_access_pattern(AccessPattern p_pattern) {} ///< hint how the file will be read, so the OS can tune its read-ahead
+	virtual void prefetch(uint64_t p_position, uint64_t p_length) {} ///< hint that a range (to the end if p_length is 0) will be read soon, so the OS can start reading it in the background
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -160,6 +171,9 @@ public:
 	static void set_backup_save(bool p_enable) { backup_save = p_enable; };
 	static bool is_backup_save_enabled() { return backup_save; };
 
+	static void set_read_buffer_size(int p_size) { read_buffer_size = p_size; } ///< size of the read buffer of files opened from now on, 0 for the platform default
+	static int get_read_buffer_size() { return read_buffer_size; }
+
 	static String get_md5(const String &p_file);
 	static String get_sha256(const String &p_file);
 	static String get_multiple_md5(const Vector<String> &p_file);
@@ -62,6 +62,12 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 uint64_t Memory::mem_usage = 0;
 uint64_t Memory::max_usage = 0;
+uint64_t Memory::tag_usage[TAG_MAX] = {};
+uint64_t Memory::alloc_total = 0;
+thread_local Memory::Tag Memory::current_tag = TAG_OTHER;
+
+// In debug builds the PAD_ALIGN header holds the allocation size followed by its tag.
+#define MEMORY_HEADER_TAG(m_header) (((uint64_t *)(m_header))[1])
 #endif
 
 uint64_t Memory::alloc_count = 0;
@@ -86,6 +92,10 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		uint8_t *s8 = (uint8_t *)mem;
 
 #ifdef DEBUG_ENABLED
+		MEMORY_HEADER_TAG(mem) = current_tag;
+		atomic_add(&tag_usage[current_tag], p_bytes);
+		atomic_increment(&alloc_total);
+
 		atomic_add(&mem_usage, p_bytes);
 		atomic_exchange_if_greater(&max_usage, mem_usage);
 #endif
@@ -113,10 +123,13 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 		uint64_t *s = (uint64_t *)mem;
 
 #ifdef DEBUG_ENABLED
+		uint64_t tag = MEMORY_HEADER_TAG(mem);
 		if (p_bytes > *s) {
+			atomic_add(&tag_usage[tag], p_bytes - *s);
 			atomic_add(&mem_usage, p_bytes - *s);
 			atomic_exchange_if_greater(&max_usage, mem_usage);
 		} else {
+			atomic_sub(&tag_usage[tag], *s - p_bytes);
 			atomic_sub(&mem_usage, *s - p_bytes);
 		}
 #endif
@@ -163,6 +176,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)mem;
+		atomic_sub(&tag_usage[MEMORY_HEADER_TAG(mem)], *s);
 		atomic_sub(&mem_usage, *s);
 #endif
 
@@ -192,6 +206,37 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+void Memory::set_current_tag(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+	current_tag = p_tag;
+#endif
+}
+
+Memory::Tag Memory::get_current_tag() {
+#ifdef DEBUG_ENABLED
+	return current_tag;
+#else
+	return TAG_OTHER;
+#endif
+}
+
+uint64_t Memory::get_tag_usage(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+	return tag_usage[p_tag];
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_alloc_total() {
+#ifdef DEBUG_ENABLED
+	return alloc_total;
+#else
+	return 0;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
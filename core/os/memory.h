@@ -42,9 +42,27 @@
 
 class Memory {
 	Memory();
+
+public:
+	// Subsystem an allocation is attributed to, see MEMORY_TAG_SCOPE.
+	enum Tag {
+		TAG_OTHER,
+		TAG_RENDERING,
+		TAG_PHYSICS,
+		TAG_SCRIPT,
+		TAG_RESOURCE,
+		TAG_AUDIO,
+		TAG_GUI,
+		TAG_MAX
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static uint64_t mem_usage;
 	static uint64_t max_usage;
+	static uint64_t tag_usage[TAG_MAX];
+	static uint64_t alloc_total;
+	static thread_local Tag current_tag;
 #endif
 
 	static uint64_t alloc_count;
@@ -57,11 +75,37 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	// Tag accounting is only done in debug builds, where every allocation carries a header.
+	static void set_current_tag(Tag p_tag);
+	static Tag get_current_tag();
+	static uint64_t get_tag_usage(Tag p_tag);
+	static uint64_t get_alloc_total();
+};
+
+class MemoryTagScope {
+	Memory::Tag prev_tag;
+
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) {
+		prev_tag = Memory::get_current_tag();
+		Memory::set_current_tag(p_tag);
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+		Memory::set_current_tag(prev_tag);
+	}
 };
 
+#ifdef DEBUG_ENABLED
+#define MEMORY_TAG_SCOPE(m_tag) MemoryTagScope _memory_tag_scope(Memory::m_tag)
+#else
+#define MEMORY_TAG_SCOPE(m_tag)
+#endif
+
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_memory, size_t p_bytes) { return Memory::realloc_static(p_memory, p_bytes, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
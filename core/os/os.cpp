@@ -143,6 +143,24 @@ int OS::get_low_processor_usage_mode_sleep_usec() const {
 	return low_processor_usage_mode_sleep_usec;
 }
 
+void OS::set_low_processor_usage_mode_idle_sleep_usec(int p_usec) {
+	low_processor_usage_mode_idle_sleep_usec = p_usec;
+}
+
+int OS::get_low_processor_usage_mode_idle_sleep_usec() const {
+	return low_processor_usage_mode_idle_sleep_usec;
+}
+
+void OS::wake_main_loop() {
+	if (low_processor_usage_mode_idle_sleep_usec == 0) {
+		return;
+	}
+	wake_requested = true;
+	if (idle_waiting) {
+		idle_semaphore.post();
+	}
+}
+
 String OS::get_executable_path() const {
 	return _execpath;
 }
@@ -469,7 +487,35 @@ void OS::close_midi_inputs() {
 	}
 }
 
-void OS::add_frame_delay(bool p_can_draw) {
+void OS::add_frame_delay(bool p_can_draw, bool p_idle) {
+	// In low processor usage mode, once nothing changed for a few frames, wait until something wakes
+	// the main loop up (input, deferred calls from threads) instead of iterating. Timers and polled
+	// sources, like network connections, are only checked every idle sleep.
+	if (p_idle && is_in_low_processor_usage_mode() && low_processor_usage_mode_idle_sleep_usec > 0) {
+		idle_frames++;
+	} else {
+		idle_frames = 0;
+	}
+
+	if (idle_frames > IDLE_FRAMES_BEFORE_WAIT) {
+#ifdef NO_THREADS
+		delay_usec(low_processor_usage_mode_idle_sleep_usec);
+#else
+		idle_waiting = true;
+		if (!wake_requested) {
+			idle_semaphore.wait_usec(low_processor_usage_mode_idle_sleep_usec);
+		}
+		idle_waiting = false;
+		while (idle_semaphore.try_wait()) {
+			// Posted after the wait was over.
+		}
+#endif
+		wake_requested = false;
+		target_ticks = get_ticks_usec();
+		return;
+	}
+	wake_requested = false;
+
 	const uint32_t frame_delay = Engine::get_singleton()->get_frame_delay();
 	if (frame_delay) {
 		// Add fixed frame delay to decrease CPU/GPU usage. This doesn't take
@@ -35,13 +35,19 @@
 #include "core/io/image.h"
 #include "core/io/logger.h"
 #include "core/os/main_loop.h"
+#include "core/os/semaphore.h"
 #include "core/string/ustring.h"
 #include "core/templates/list.h"
 #include "core/templates/vector.h"
 
 #include <stdarg.h>
+#include <atomic>
 
 class OS {
+	enum {
+		IDLE_FRAMES_BEFORE_WAIT = 2,
+	};
+
 	static OS *singleton;
 	static uint64_t target_ticks;
 	String _execpath;
@@ -49,6 +55,11 @@ class OS {
 	bool _keep_screen_on = true; // set default value to true, because this had been true before godot 2.0.
 	bool low_processor_usage_mode = false;
 	int low_processor_usage_mode_sleep_usec = 10000;
+	int low_processor_usage_mode_idle_sleep_usec = 0;
+	uint32_t idle_frames = 0;
+	std::atomic<bool> idle_waiting = { false };
+	std::atomic<bool> wake_requested = { false };
+	Semaphore idle_semaphore;
 	bool _verbose_stdout = false;
 	bool _debug_stdout = false;
 	String _local_clipboard;
@@ -127,6 +138,11 @@ public:
 	virtual bool is_in_low_processor_usage_mode() const;
 	virtual void set_low_processor_usage_mode_sleep_usec(int p_usec);
 	virtual int get_low_processor_usage_mode_sleep_usec() const;
+	virtual void set_low_processor_usage_mode_idle_sleep_usec(int p_usec);
+	virtual int get_low_processor_usage_mode_idle_sleep_usec() const;
+
+	// Wakes up the main loop if it's waiting for events while idle. Can be called from any thread.
+	void wake_main_loop();
 
 	virtual String get_executable_path() const;
 	virtual Error execute(const String &p_path, const List<String> &p_arguments, String *r_pipe = nullptr, int *r_exitcode = nullptr, bool read_stderr = false, Mutex *p_pipe_mutex = nullptr) = 0;
@@ -213,7 +229,8 @@ public:
 	virtual double get_unix_time() const;
 
 	virtual void delay_usec(uint32_t p_usec) const = 0;
-	virtual void add_frame_delay(bool p_can_draw);
+	// p_idle is true when the frame could have been drawn, but nothing changed.
+	virtual void add_frame_delay(bool p_can_draw, bool p_idle = false);
 
 	virtual uint64_t get_ticks_usec() const = 0;
 	uint32_t get_ticks_msec() const;
@@ -68,6 +68,16 @@ public:
 		}
 		return false;
 	}
+
+	// Returns false if it timed out.
+	_ALWAYS_INLINE_ bool wait_usec(uint64_t p_usec) const {
+		std::unique_lock<decltype(mutex_)> lock(mutex_);
+		if (!condition_.wait_for(lock, std::chrono::microseconds(p_usec), [this] { return count_ > 0; })) {
+			return false;
+		}
+		--count_;
+		return true;
+	}
 };
 
 #else
@@ -30,12 +30,14 @@
 
 #include "thread.h"
 
+#include "core/config/project_settings.h"
 #include "core/object/script_language.h"
 
 #if !defined(NO_THREADS)
 
 Error (*Thread::set_name_func)(const String &) = nullptr;
 void (*Thread::set_priority_func)(Thread::Priority) = nullptr;
+Error (*Thread::set_cores_func)(Thread::Cores) = nullptr;
 void (*Thread::init_func)() = nullptr;
 void (*Thread::term_func)() = nullptr;
 
@@ -43,15 +45,52 @@ Thread::ID Thread::main_thread_id = 1;
 Thread::ID Thread::last_thread_id = 1;
 thread_local Thread::ID Thread::caller_id = 1;
 
+Thread::Settings Thread::role_settings[ROLE_MAX];
+
 void Thread::_set_platform_funcs(
 		Error (*p_set_name_func)(const String &),
 		void (*p_set_priority_func)(Thread::Priority),
 		void (*p_init_func)(),
-		void (*p_term_func)()) {
-	Thread::set_name_func = p_set_name_func;
-	Thread::set_priority_func = p_set_priority_func;
-	Thread::init_func = p_init_func;
-	Thread::term_func = p_term_func;
+		void (*p_term_func)(),
+		Error (*p_set_cores_func)(Thread::Cores)) {
+	if (p_set_name_func) {
+		Thread::set_name_func = p_set_name_func;
+	}
+	if (p_set_priority_func) {
+		Thread::set_priority_func = p_set_priority_func;
+	}
+	if (p_init_func) {
+		Thread::init_func = p_init_func;
+	}
+	if (p_term_func) {
+		Thread::term_func = p_term_func;
+	}
+	if (p_set_cores_func) {
+		Thread::set_cores_func = p_set_cores_func;
+	}
+}
+
+void Thread::load_role_settings() {
+	static const char *role_names[ROLE_MAX] = { "audio", "render", "physics", "loader", "worker" };
+	// Audio glitches when it's preempted, loading can always wait a bit.
+	static const Priority default_priorities[ROLE_MAX] = { PRIORITY_HIGH, PRIORITY_NORMAL, PRIORITY_NORMAL, PRIORITY_LOW, PRIORITY_NORMAL };
+
+	for (int i = 0; i < ROLE_MAX; i++) {
+		String prefix = String("threading/roles/") + role_names[i];
+
+		String priority_setting = prefix + "/priority";
+		role_settings[i].priority = Priority(int(GLOBAL_DEF(priority_setting, default_priorities[i])));
+		ProjectSettings::get_singleton()->set_custom_property_info(priority_setting, PropertyInfo(Variant::INT, priority_setting, PROPERTY_HINT_ENUM, "Low,Normal,High"));
+
+		String cores_setting = prefix + "/cores";
+		role_settings[i].cores = Cores(int(GLOBAL_DEF(cores_setting, CORES_ANY)));
+		ProjectSettings::get_singleton()->set_custom_property_info(cores_setting, PropertyInfo(Variant::INT, cores_setting, PROPERTY_HINT_ENUM, "Any,Performance,Efficiency"));
+	}
+}
+
+Thread::Settings Thread::get_role_settings(Role p_role) {
+	ERR_FAIL_INDEX_V(p_role, ROLE_MAX, Settings());
+	return role_settings[p_role];
 }
 
 void Thread::callback(Thread *p_self, const Settings &p_settings, Callback p_callback, void *p_userdata) {
@@ -59,6 +98,9 @@ void Thread::callback(Thread *p_self, const Settings &p_settings, Callback p_cal
 	if (set_priority_func) {
 		set_priority_func(p_settings.priority);
 	}
+	if (set_cores_func && p_settings.cores != CORES_ANY) {
+		set_cores_func(p_settings.cores);
+	}
 	if (init_func) {
 		init_func();
 	}
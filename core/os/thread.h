@@ -51,8 +51,26 @@ public:
 		PRIORITY_HIGH
 	};
 
+	// On processors with cores of different performance (big.LITTLE), which ones a thread may run on.
+	enum Cores {
+		CORES_ANY,
+		CORES_PERFORMANCE,
+		CORES_EFFICIENCY,
+	};
+
+	// Engine threads are started with the settings of their role, set in the project settings (threading/roles).
+	enum Role {
+		ROLE_AUDIO,
+		ROLE_RENDER,
+		ROLE_PHYSICS,
+		ROLE_LOADER,
+		ROLE_WORKER,
+		ROLE_MAX
+	};
+
 	struct Settings {
 		Priority priority;
+		Cores cores = CORES_ANY;
 		Settings() { priority = PRIORITY_NORMAL; }
 	};
 
@@ -71,16 +89,21 @@ private:
 
 	static Error (*set_name_func)(const String &);
 	static void (*set_priority_func)(Thread::Priority);
+	static Error (*set_cores_func)(Thread::Cores);
 	static void (*init_func)();
 	static void (*term_func)();
+
+	static Settings role_settings[ROLE_MAX];
 #endif
 
 public:
+	// Functions passed as nullptr keep the ones set before, so platforms can add to the generic ones.
 	static void _set_platform_funcs(
 			Error (*p_set_name_func)(const String &),
 			void (*p_set_priority_func)(Thread::Priority),
 			void (*p_init_func)() = nullptr,
-			void (*p_term_func)() = nullptr);
+			void (*p_term_func)() = nullptr,
+			Error (*p_set_cores_func)(Thread::Cores) = nullptr);
 
 #if !defined(NO_THREADS)
 	_FORCE_INLINE_ ID get_id() const { return id; }
@@ -91,6 +114,10 @@ public:
 
 	static Error set_name(const String &p_name);
 
+	// Reads the role settings from the project settings, threads started before use the defaults.
+	static void load_role_settings();
+	static Settings get_role_settings(Role p_role);
+
 	void start(Thread::Callback p_callback, void *p_user, const Settings &p_settings = Settings());
 	bool is_started() const;
 	///< waits until thread is finished, and deallocates it.
@@ -106,6 +133,9 @@ public:
 
 	static Error set_name(const String &p_name) { return ERR_UNAVAILABLE; }
 
+	static void load_role_settings() {}
+	static Settings get_role_settings(Role p_role) { return Settings(); }
+
 	void start(Thread::Callback p_callback, void *p_user, const Settings &p_settings = Settings()) {}
 	bool is_started() const { return false; }
 	void wait_to_finish() {}
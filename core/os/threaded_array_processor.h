@@ -74,13 +74,20 @@ void thread_process_array(uint32_t p_elements, C *p_instance, M p_method, U p_us
 	data.elements = p_elements;
 	data.process(data.index); //process first, let threads increment for next
 
-	int thread_count = OS::get_singleton()->get_processor_count();
-	Thread *threads = memnew_arr(Thread, thread_count);
+	// The calling thread takes part in the processing, so one thread less is needed.
+	int thread_count = MIN(OS::get_singleton()->get_processor_count() - 1, (int)p_elements - 1);
+	Thread *threads = thread_count > 0 ? memnew_arr(Thread, thread_count) : nullptr;
 
 	for (int i = 0; i < thread_count; i++) {
 		threads[i].start(process_array_thread<ThreadArrayProcessData<C, U>>, &data);
 	}
 
+	process_array_thread<ThreadArrayProcessData<C, U>>(&data);
+
+	if (threads == nullptr) {
+		return;
+	}
+
 	for (int i = 0; i < thread_count; i++) {
 		threads[i].wait_to_finish();
 	}
@@ -37,6 +37,7 @@
 #include "core/crypto/aes_context.h"
 #include "core/crypto/crypto.h"
 #include "core/crypto/hashing_context.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/input/input.h"
 #include "core/input/input_map.h"
 #include "core/io/config_file.h"
@@ -315,6 +316,8 @@ void unregister_core_types() {
 
 	ResourceLoader::finalize();
 
+	CPUProfiler::finish();
+
 	ClassDB::cleanup_defaults();
 	ObjectDB::cleanup();
 
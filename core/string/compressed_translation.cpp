@@ -177,6 +177,7 @@ void PHashTranslation::generate(const Ref<Translation> &p_from) {
 	}
 
 	ERR_FAIL_COND(btindex != bucket_table_size);
+	_clear_message_cache();
 	set_locale(p_from->get_locale());
 
 #endif
@@ -196,6 +197,7 @@ bool PHashTranslation::_set(const StringName &p_name, const Variant &p_value) {
 		return false;
 	}
 
+	_clear_message_cache();
 	return true;
 }
 
@@ -214,9 +216,26 @@ bool PHashTranslation::_get(const StringName &p_name, Variant &r_ret) const {
 	return true;
 }
 
+void PHashTranslation::_clear_message_cache() {
+	MutexLock lock(message_cache_mutex);
+	message_cache.clear();
+	_messages_changed();
+}
+
 StringName PHashTranslation::get_message(const StringName &p_src_text, const StringName &p_context) const {
 	// p_context passed in is ignore. The use of context is not yet supported in PHashTranslation.
 
+	MutexLock lock(message_cache_mutex);
+
+	const StringName *cached = message_cache.getptr(p_src_text);
+	if (cached) {
+		return *cached;
+	}
+
+	return *message_cache.insert(p_src_text, _lookup_message(p_src_text));
+}
+
+StringName PHashTranslation::_lookup_message(const StringName &p_src_text) const {
 	int htsize = hash_table.size();
 
 	if (htsize == 0) {
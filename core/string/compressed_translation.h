@@ -32,6 +32,7 @@
 #define COMPRESSED_TRANSLATION_H
 
 #include "core/string/translation.h"
+#include "core/templates/lru.h"
 
 class PHashTranslation : public Translation {
 	GDCLASS(PHashTranslation, Translation);
@@ -60,6 +61,18 @@ class PHashTranslation : public Translation {
 		Elem elem[1];
 	};
 
+	enum {
+		MESSAGE_CACHE_SIZE = 1024,
+	};
+
+	// Recently looked up messages, so the most used ones aren't hashed and decompressed on every
+	// access. Misses are kept too (as an empty StringName).
+	mutable Mutex message_cache_mutex;
+	mutable LRUCache<StringName, StringName> message_cache;
+
+	StringName _lookup_message(const StringName &p_src_text) const;
+	void _clear_message_cache();
+
 	_FORCE_INLINE_ uint32_t hash(uint32_t d, const char *p_str) const {
 		if (d == 0) {
 			d = 0x1000193;
@@ -83,7 +96,7 @@ public:
 	virtual StringName get_plural_message(const StringName &p_src_text, const StringName &p_plural_text, int p_n, const StringName &p_context = "") const override;
 	void generate(const Ref<Translation> &p_from);
 
-	PHashTranslation() {}
+	PHashTranslation() { message_cache.set_capacity(MESSAGE_CACHE_SIZE); }
 };
 
 #endif // COMPRESSED_TRANSLATION_H
@@ -39,66 +39,142 @@ StaticCString StaticCString::create(const char *p_ptr) {
 	return scs;
 }
 
-StringName::_Data *StringName::_table[STRING_TABLE_LEN];
+StringName::_Shard StringName::_shards[STRING_TABLE_SHARDS];
 
-StringName _scs_create(const char *p_chr) {
-	return (p_chr[0] ? StringName(StaticCString::create(p_chr)) : StringName());
+StringName _scs_create(const char *p_chr, bool p_static) {
+	return (p_chr[0] ? StringName(StaticCString::create(p_chr), p_static) : StringName());
 }
 
 bool StringName::configured = false;
-Mutex StringName::mutex;
 
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
-		_table[i] = nullptr;
+	for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+		_Shard &shard = _shards[i];
+		shard.buckets = memnew_arr(_Data *, STRING_TABLE_SHARD_MIN_BUCKETS);
+		for (int j = 0; j < STRING_TABLE_SHARD_MIN_BUCKETS; j++) {
+			shard.buckets[j] = nullptr;
+		}
+		shard.bucket_mask = STRING_TABLE_SHARD_MIN_BUCKETS - 1;
+		shard.count = 0;
 	}
 	configured = true;
 }
 
 void StringName::cleanup() {
-	MutexLock lock(mutex);
-
 	int lost_strings = 0;
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
-		while (_table[i]) {
-			_Data *d = _table[i];
-			lost_strings++;
-			if (OS::get_singleton()->is_stdout_verbose()) {
-				if (d->cname) {
-					print_line("Orphan StringName: " + String(d->cname));
-				} else {
-					print_line("Orphan StringName: " + String(d->name));
+	for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+		_Shard &shard = _shards[i];
+		MutexLock lock(shard.mutex);
+
+		for (uint32_t j = 0; j <= shard.bucket_mask; j++) {
+			while (shard.buckets[j]) {
+				_Data *d = shard.buckets[j];
+				// Names only kept alive by SNAME() caches are expected to be around at exit.
+				if (d->static_count != d->refcount.get()) {
+					lost_strings++;
+					if (OS::get_singleton()->is_stdout_verbose()) {
+						if (d->cname) {
+							print_line("Orphan StringName: " + String(d->cname));
+						} else {
+							print_line("Orphan StringName: " + String(d->name));
+						}
+					}
 				}
-			}
 
-			_table[i] = _table[i]->next;
-			memdelete(d);
+				shard.buckets[j] = shard.buckets[j]->next;
+				memdelete(d);
+			}
 		}
+
+		memdelete_arr(shard.buckets);
+		shard.buckets = nullptr;
+		shard.bucket_mask = 0;
+		shard.count = 0;
 	}
+	configured = false;
+
 	if (lost_strings) {
 		print_verbose("StringName: " + itos(lost_strings) + " unclaimed string names at exit.");
 	}
 }
 
+template <class T>
+StringName::_Data *StringName::_find_in_shard(const _Shard &p_shard, uint32_t p_hash, const T &p_name) {
+	_Data *d = p_shard.buckets[p_hash & p_shard.bucket_mask];
+
+	while (d) {
+		// compare hash first
+		if (d->hash == p_hash && d->get_name() == p_name) {
+			return d;
+		}
+		d = d->next;
+	}
+
+	return nullptr;
+}
+
+void StringName::_insert_in_shard(_Shard &p_shard, _Data *p_data) {
+	p_shard.count++;
+
+	if (p_shard.count > (p_shard.bucket_mask + 1) * 2) {
+		// Keep chains short by doubling the buckets of this shard.
+		uint32_t new_mask = (p_shard.bucket_mask << 1) | 1;
+		_Data **new_buckets = memnew_arr(_Data *, new_mask + 1);
+		for (uint32_t i = 0; i <= new_mask; i++) {
+			new_buckets[i] = nullptr;
+		}
+
+		for (uint32_t i = 0; i <= p_shard.bucket_mask; i++) {
+			_Data *d = p_shard.buckets[i];
+			while (d) {
+				_Data *next = d->next;
+				uint32_t idx = d->hash & new_mask;
+				d->prev = nullptr;
+				d->next = new_buckets[idx];
+				if (new_buckets[idx]) {
+					new_buckets[idx]->prev = d;
+				}
+				new_buckets[idx] = d;
+				d = next;
+			}
+		}
+
+		memdelete_arr(p_shard.buckets);
+		p_shard.buckets = new_buckets;
+		p_shard.bucket_mask = new_mask;
+	}
+
+	uint32_t idx = p_data->hash & p_shard.bucket_mask;
+	p_data->next = p_shard.buckets[idx];
+	p_data->prev = nullptr;
+	if (p_shard.buckets[idx]) {
+		p_shard.buckets[idx]->prev = p_data;
+	}
+	p_shard.buckets[idx] = p_data;
+}
+
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		_Shard &shard = _get_shard(_data->hash);
+		MutexLock lock(shard.mutex);
 
 		if (_data->prev) {
 			_data->prev->next = _data->next;
 		} else {
-			if (_table[_data->idx] != _data) {
+			uint32_t idx = _data->hash & shard.bucket_mask;
+			if (shard.buckets[idx] != _data) {
 				ERR_PRINT("BUG!");
 			}
-			_table[_data->idx] = _data->next;
+			shard.buckets[idx] = _data->next;
 		}
 
 		if (_data->next) {
 			_data->next->prev = _data->prev;
 		}
+		shard.count--;
 		memdelete(_data);
 	}
 
@@ -162,21 +238,12 @@ StringName::StringName(const char *p_name) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
+	_Shard &shard = _get_shard(hash);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_data = _table[idx];
+	MutexLock lock(shard.mutex);
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find_in_shard(shard, hash, p_name);
 
 	if (_data) {
 		if (_data->refcount.ref()) {
@@ -189,42 +256,30 @@ StringName::StringName(const char *p_name) {
 	_data->name = p_name;
 	_data->refcount.init();
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert_in_shard(shard, _data);
 }
 
-StringName::StringName(const StaticCString &p_static_string) {
+StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 	_data = nullptr;
 
 	ERR_FAIL_COND(!configured);
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
+	_Shard &shard = _get_shard(hash);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(shard.mutex);
 
-	_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_static_string.ptr) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find_in_shard(shard, hash, p_static_string.ptr);
 
 	if (_data) {
 		if (_data->refcount.ref()) {
 			// exists
+			if (p_static) {
+				_data->static_count++;
+			}
 			return;
 		}
 	}
@@ -232,15 +287,10 @@ StringName::StringName(const StaticCString &p_static_string) {
 	_data = memnew(_Data);
 
 	_data->refcount.init();
+	_data->static_count = p_static ? 1 : 0;
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = p_static_string.ptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert_in_shard(shard, _data);
 }
 
 StringName::StringName(const String &p_name) {
@@ -252,19 +302,12 @@ StringName::StringName(const String &p_name) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	_Shard &shard = _get_shard(hash);
 
-	_data = _table[idx];
+	MutexLock lock(shard.mutex);
 
-	while (_data) {
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_data = _find_in_shard(shard, hash, p_name);
 
 	if (_data) {
 		if (_data->refcount.ref()) {
@@ -277,14 +320,8 @@ StringName::StringName(const String &p_name) {
 	_data->name = p_name;
 	_data->refcount.init();
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert_in_shard(shard, _data);
 }
 
 StringName StringName::search(const char *p_name) {
@@ -295,20 +332,12 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	_Shard &shard = _get_shard(hash);
 
-	_Data *_data = _table[idx];
+	MutexLock lock(shard.mutex);
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _find_in_shard(shard, hash, p_name);
 
 	if (_data && _data->refcount.ref()) {
 		return StringName(_data);
@@ -325,21 +354,12 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
+	_Shard &shard = _get_shard(hash);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(shard.mutex);
 
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _find_in_shard(shard, hash, p_name);
 
 	if (_data && _data->refcount.ref()) {
 		return StringName(_data);
@@ -351,21 +371,12 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name == "", StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
+	_Shard &shard = _get_shard(hash);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(shard.mutex);
 
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && p_name == _data->get_name()) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _find_in_shard(shard, hash, p_name);
 
 	if (_data && _data->refcount.ref()) {
 		return StringName(_data);
@@ -374,10 +385,6 @@ StringName StringName::search(const String &p_name) {
 	return StringName(); //does not exist
 }
 
-StringName::~StringName() {
-	unref();
-}
-
 bool operator==(const String &p_name, const StringName &p_string_name) {
 	return p_name == p_string_name.operator String();
 }
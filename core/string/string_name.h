@@ -44,25 +44,43 @@ struct StaticCString {
 
 class StringName {
 	enum {
-		STRING_TABLE_BITS = 12,
-		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_SHARD_BITS = 6,
+		STRING_TABLE_SHARDS = 1 << STRING_TABLE_SHARD_BITS,
+		STRING_TABLE_SHARD_MIN_BUCKETS = 64
 	};
 
 	struct _Data {
 		SafeRefCount refcount;
+		uint32_t static_count = 0; // References held by SNAME() caches, guarded by the shard mutex.
 		const char *cname = nullptr;
 		String name;
 
 		String get_name() const { return cname ? String(cname) : name; }
-		int idx = 0;
 		uint32_t hash = 0;
 		_Data *prev = nullptr;
 		_Data *next = nullptr;
 		_Data() {}
 	};
 
-	static _Data *_table[STRING_TABLE_LEN];
+	// The intern table is split in shards picked by the upper hash bits, each
+	// with its own lock and a bucket array that grows with its contents, so
+	// threads interning unrelated names don't all wait on the same mutex.
+	struct _Shard {
+		Mutex mutex;
+		_Data **buckets = nullptr;
+		uint32_t bucket_mask = 0;
+		uint32_t count = 0;
+	};
+
+	static _Shard _shards[STRING_TABLE_SHARDS];
+
+	static _FORCE_INLINE_ _Shard &_get_shard(uint32_t p_hash) {
+		return _shards[p_hash >> (32 - STRING_TABLE_SHARD_BITS)];
+	}
+
+	template <class T>
+	static _Data *_find_in_shard(const _Shard &p_shard, uint32_t p_hash, const T &p_name);
+	static void _insert_in_shard(_Shard &p_shard, _Data *p_data);
 
 	_Data *_data = nullptr;
 
@@ -75,7 +93,6 @@ class StringName {
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
-	static Mutex mutex;
 	static void setup();
 	static void cleanup();
 	static bool configured;
@@ -149,9 +166,13 @@ public:
 	StringName(const char *p_name);
 	StringName(const StringName &p_name);
 	StringName(const String &p_name);
-	StringName(const StaticCString &p_static_string);
+	StringName(const StaticCString &p_static_string, bool p_static = false);
 	StringName() {}
-	~StringName();
+	~StringName() {
+		if (likely(configured) && _data) {
+			unref();
+		}
+	}
 };
 
 bool operator==(const String &p_name, const StringName &p_string_name);
@@ -159,6 +180,17 @@ bool operator!=(const String &p_name, const StringName &p_string_name);
 bool operator==(const char *p_name, const StringName &p_string_name);
 bool operator!=(const char *p_name, const StringName &p_string_name);
 
-StringName _scs_create(const char *p_chr);
+StringName _scs_create(const char *p_chr, bool p_static = false);
+
+/*
+ * Interns a string literal once per call site and returns a cached reference,
+ * for hot paths that would otherwise hash and look up the literal every call:
+ *
+ *   get_theme_color(SNAME("font_color"));
+ *
+ * The cached names are plain function-local statics, so they outlive
+ * StringName::cleanup() and are not reported as leaked.
+ */
+#define SNAME(m_arg) ([]() -> const StringName & { static StringName sname = _scs_create(m_arg, true); return sname; })()
 
 #endif // STRING_NAME_H
@@ -799,6 +799,8 @@ static const char *locale_renames[][2] = {
 
 ///////////////////////////////////////////////
 
+std::atomic<uint32_t> Translation::revision = { 1 };
+
 Dictionary Translation::_get_messages() const {
 	Dictionary d;
 	for (const Map<StringName, StringName>::Element *E = translation_map.front(); E; E = E->next()) {
@@ -825,6 +827,7 @@ void Translation::_set_messages(const Dictionary &p_messages) {
 	for (auto E = keys.front(); E; E = E->next()) {
 		translation_map[E->get()] = p_messages[E->get()];
 	}
+	_messages_changed();
 }
 
 void Translation::set_locale(const String &p_locale) {
@@ -839,6 +842,7 @@ void Translation::set_locale(const String &p_locale) {
 	} else {
 		locale = univ_locale;
 	}
+	_messages_changed();
 
 	if (OS::get_singleton()->get_main_loop()) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_TRANSLATION_CHANGED);
@@ -847,12 +851,14 @@ void Translation::set_locale(const String &p_locale) {
 
 void Translation::add_message(const StringName &p_src_text, const StringName &p_xlated_text, const StringName &p_context) {
 	translation_map[p_src_text] = p_xlated_text;
+	_messages_changed();
 }
 
 void Translation::add_plural_message(const StringName &p_src_text, const Vector<String> &p_plural_xlated_texts, const StringName &p_context) {
 	WARN_PRINT("Translation class doesn't handle plural messages. Calling add_plural_message() on a Translation instance is probably a mistake. \nUse a derived Translation class that handles plurals, such as TranslationPO class");
 	ERR_FAIL_COND_MSG(p_plural_xlated_texts.is_empty(), "Parameter vector p_plural_xlated_texts passed in is empty.");
 	translation_map[p_src_text] = p_plural_xlated_texts[0];
+	_messages_changed();
 }
 
 StringName Translation::get_message(const StringName &p_src_text, const StringName &p_context) const {
@@ -879,6 +885,7 @@ void Translation::erase_message(const StringName &p_src_text, const StringName &
 	}
 
 	translation_map.erase(p_src_text);
+	_messages_changed();
 }
 
 void Translation::get_message_list(List<StringName> *r_messages) const {
@@ -972,6 +979,7 @@ void TranslationServer::set_locale(const String &p_locale) {
 	} else {
 		locale = univ_locale;
 	}
+	Translation::_messages_changed();
 
 	if (OS::get_singleton()->get_main_loop()) {
 		OS::get_singleton()->get_main_loop()->notification(MainLoop::NOTIFICATION_TRANSLATION_CHANGED);
@@ -1032,10 +1040,12 @@ Vector<String> TranslationServer::get_all_locale_names() {
 
 void TranslationServer::add_translation(const Ref<Translation> &p_translation) {
 	translations.insert(p_translation);
+	Translation::_messages_changed();
 }
 
 void TranslationServer::remove_translation(const Ref<Translation> &p_translation) {
 	translations.erase(p_translation);
+	Translation::_messages_changed();
 }
 
 Ref<Translation> TranslationServer::get_translation_object(const String &p_locale) {
@@ -1064,6 +1074,7 @@ Ref<Translation> TranslationServer::get_translation_object(const String &p_local
 
 void TranslationServer::clear() {
 	translations.clear();
+	Translation::_messages_changed();
 }
 
 StringName TranslationServer::translate(const StringName &p_message, const StringName &p_context) const {
@@ -1075,6 +1086,57 @@ StringName TranslationServer::translate(const StringName &p_message, const Strin
 
 	ERR_FAIL_COND_V_MSG(locale.length() < 2, p_message, "Could not translate message as configured locale '" + locale + "' is invalid.");
 
+	if (p_context != StringName()) {
+		return _translate_uncached(p_message, p_context);
+	}
+
+	MutexLock lock(translate_cache_mutex);
+
+	uint32_t revision = Translation::get_revision();
+	if (translate_cache_revision != revision) {
+		translate_cache.clear();
+		translate_cache_revision = revision;
+		_fill_translate_cache();
+	}
+
+	const StringName *cached = translate_cache.getptr(p_message);
+	if (cached) {
+		return *cached;
+	}
+
+	StringName res = _translate_uncached(p_message, p_context);
+	if (translate_cache.size() >= TRANSLATE_CACHE_MAX) {
+		translate_cache.clear();
+	}
+	translate_cache.set(p_message, res);
+	return res;
+}
+
+void TranslationServer::_fill_translate_cache() const {
+	String lang = get_language_code(locale);
+	String fallback_lang = fallback.length() >= 2 ? get_language_code(fallback) : String();
+
+	List<StringName> messages;
+	for (const Set<Ref<Translation>>::Element *E = translations.front(); E; E = E->next()) {
+		const Ref<Translation> &t = E->get();
+		ERR_CONTINUE(t.is_null());
+		String l = get_language_code(t->get_locale());
+		if (l == lang || l == fallback_lang) {
+			// Catalogs that only keep hashes of their messages (like PHashTranslation) list nothing,
+			// their messages get cached as they are looked up instead.
+			t->get_message_list(&messages);
+		}
+	}
+
+	translate_cache.reserve(MIN(messages.size(), int(TRANSLATE_CACHE_MAX)));
+	for (const List<StringName>::Element *E = messages.front(); E && translate_cache.size() < TRANSLATE_CACHE_MAX; E = E->next()) {
+		if (!translate_cache.has(E->get())) {
+			translate_cache.set(E->get(), _translate_uncached(E->get(), StringName()));
+		}
+	}
+}
+
+StringName TranslationServer::_translate_uncached(const StringName &p_message, const StringName &p_context) const {
 	StringName res = _get_message_from_translations(p_message, p_context, locale, false);
 
 	if (!res && fallback.length() >= 2) {
@@ -1199,6 +1261,7 @@ void TranslationServer::setup() {
 		set_locale(OS::get_singleton()->get_locale());
 	}
 	fallback = GLOBAL_DEF("locale/fallback", "en");
+	Translation::_messages_changed();
 #ifdef TOOLS_ENABLED
 	{
 		String options = "";
@@ -1322,3 +1385,9 @@ TranslationServer::TranslationServer() {
 		locale_name_map.insert(locale_list[i], String::utf8(locale_names[i]));
 	}
 }
+
+TranslationServer::~TranslationServer() {
+	if (singleton == this) {
+		singleton = nullptr;
+	}
+}
@@ -32,12 +32,18 @@
 #define TRANSLATION_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/flat_hash_map.h"
+
+#include <atomic>
 
 class Translation : public Resource {
 	GDCLASS(Translation, Resource);
 	OBJ_SAVE_TYPE(Translation);
 	RES_BASE_EXTENSION("translation");
 
+	friend class TranslationServer;
+
 	String locale = "en";
 	Map<StringName, StringName> translation_map;
 
@@ -45,10 +51,18 @@ class Translation : public Resource {
 	virtual Dictionary _get_messages() const;
 	virtual void _set_messages(const Dictionary &p_messages);
 
+	static std::atomic<uint32_t> revision;
+
 protected:
 	static void _bind_methods();
 
+	// Must be called whenever the messages (or the locale) of any translation change,
+	// so TranslationServer knows its cached lookups are out of date.
+	static void _messages_changed() { revision++; }
+
 public:
+	static uint32_t get_revision() { return revision; }
+
 	void set_locale(const String &p_locale);
 	_FORCE_INLINE_ String get_locale() const { return locale; }
 
@@ -80,6 +94,19 @@ class TranslationServer : public Object {
 	static TranslationServer *singleton;
 	bool _load_translations(const String &p_from);
 
+	enum {
+		TRANSLATE_CACHE_MAX = 65536, // The cache is emptied when it grows past this, in case every lookup is for a new string.
+	};
+
+	// Results of translate() without context for the current locale and fallback. Filled with every
+	// message of the matching catalogs the first time something is translated after a change, then
+	// with each lookup (translated or not) for messages the catalogs can't list.
+	mutable Mutex translate_cache_mutex;
+	mutable FlatHashMap<StringName, StringName> translate_cache;
+	mutable uint32_t translate_cache_revision = 0;
+
+	void _fill_translate_cache() const;
+	StringName _translate_uncached(const StringName &p_message, const StringName &p_context) const;
 	StringName _get_message_from_translations(const StringName &p_message, const StringName &p_context, const String &p_locale, bool plural, const String &p_message_plural = "", int p_n = 0) const;
 
 	static void _bind_methods();
@@ -126,6 +153,7 @@ public:
 	void load_translations();
 
 	TranslationServer();
+	~TranslationServer();
 };
 
 #endif // TRANSLATION_H
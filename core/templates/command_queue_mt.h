@@ -422,6 +422,7 @@ class CommandQueueMT {
 		return ret;
 	}
 
+	// When p_lock is false, the caller must already hold the lock.
 	bool flush_one(bool p_lock = true) {
 		if (p_lock) {
 			lock();
@@ -455,13 +456,12 @@ class CommandQueueMT {
 
 		read_ptr_and_epoch = (read_ptr << 1) | (read_ptr_and_epoch & 1);
 
-		if (p_lock) {
-			unlock();
-		}
+		// The command stays marked as in use, so its memory can't be reused
+		// while it runs. Don't hold the lock meanwhile, other threads may
+		// want to push.
+		unlock();
 		cmd->call();
-		if (p_lock) {
-			lock();
-		}
+		lock();
 
 		cmd->post();
 		cmd->~CommandBase();
@@ -506,7 +506,11 @@ public:
 	void flush_all() {
 		//ERR_FAIL_COND(sync);
 		lock();
-		while (flush_one(false)) {
+		// Only flush what was pushed so far. As the lock is released while
+		// commands run, other threads can keep pushing, and they should not
+		// be able to keep this flush going forever.
+		uint32_t flush_until = write_ptr_and_epoch;
+		while (read_ptr_and_epoch != flush_until && flush_one(false)) {
 		}
 		unlock();
 	}
@@ -0,0 +1,472 @@
+/*************************************************************************/
+/*  flat_hash_map.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "core/error/error_macros.h"
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/list.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FLAT_HASH_MAP_SSE2_ENABLED
+#endif
+
+/**
+ * @class FlatHashMap
+ *
+ * Open addressing hash map with the same interface as HashMap, intended for
+ * hot lookup tables that are read far more often than they are modified.
+ *
+ * Keys and values are stored inline in a single slot array, next to an array
+ * of one byte control codes (empty, deleted, or the low 7 bits of the hash).
+ * Lookups compare 16 control bytes at a time (with SSE2 when available),
+ * so a miss or a hit usually touches just one group of control bytes plus the
+ * matching slot, instead of walking a chain of separately allocated elements.
+ *
+ * Unlike HashMap, inserting or erasing may move other elements around in
+ * memory (on rehash), so pointers returned by getptr() or next() are only
+ * valid until the map is next modified.
+ */
+
+template <class TKey, class TData, class Hasher = HashMapHasherDefault, class Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashMap {
+public:
+	struct Pair {
+		TKey key;
+		TData data;
+
+		Pair() {}
+		Pair(const TKey &p_key, const TData &p_data) :
+				key(p_key),
+				data(p_data) {
+		}
+	};
+
+private:
+	enum : int8_t {
+		CTRL_EMPTY = -128,
+		CTRL_DELETED = -2,
+	};
+
+	static const uint32_t GROUP_WIDTH = 16;
+	static const uint32_t MIN_CAPACITY = 16;
+
+	// Control bytes are followed by GROUP_WIDTH mirrored copies of the first
+	// ones, so a group can always be loaded without wrapping around.
+	int8_t *ctrl = nullptr;
+	Pair *slots = nullptr;
+	uint32_t capacity = 0;
+	uint32_t elements = 0;
+	uint32_t deleted = 0;
+
+	static _FORCE_INLINE_ uint32_t _hash(const TKey &p_key) {
+		uint32_t h = Hasher::hash(p_key);
+		// Spread the bits, as many of the default hashers leave the upper ones mostly unused.
+		h ^= h >> 16;
+		h *= 0x85ebca6b;
+		h ^= h >> 13;
+		h *= 0xc2b2ae35;
+		h ^= h >> 16;
+		return h;
+	}
+
+	static _FORCE_INLINE_ int8_t _h2(uint32_t p_hash) {
+		return int8_t(p_hash & 0x7F);
+	}
+
+	static _FORCE_INLINE_ uint32_t _lowest_bit(uint32_t p_mask) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctz(p_mask);
+#else
+		uint32_t bit = 0;
+		while (!(p_mask & 1)) {
+			p_mask >>= 1;
+			bit++;
+		}
+		return bit;
+#endif
+	}
+
+	struct Group {
+#ifdef FLAT_HASH_MAP_SSE2_ENABLED
+		__m128i bytes;
+
+		explicit _FORCE_INLINE_ Group(const int8_t *p_ctrl) {
+			bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+		}
+
+		_FORCE_INLINE_ uint32_t match(int8_t p_h2) const {
+			return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_h2), bytes)));
+		}
+
+		// Empty and deleted are the only negative control codes.
+		_FORCE_INLINE_ uint32_t match_available() const {
+			return uint32_t(_mm_movemask_epi8(bytes));
+		}
+#else
+		const int8_t *bytes;
+
+		explicit _FORCE_INLINE_ Group(const int8_t *p_ctrl) {
+			bytes = p_ctrl;
+		}
+
+		_FORCE_INLINE_ uint32_t match(int8_t p_h2) const {
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+				mask |= uint32_t(bytes[i] == p_h2) << i;
+			}
+			return mask;
+		}
+
+		_FORCE_INLINE_ uint32_t match_available() const {
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+				mask |= uint32_t(bytes[i] < 0) << i;
+			}
+			return mask;
+		}
+#endif
+		_FORCE_INLINE_ uint32_t match_empty() const {
+			return match(CTRL_EMPTY);
+		}
+	};
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_index, int8_t p_value) {
+		ctrl[p_index] = p_value;
+		if (p_index < GROUP_WIDTH) {
+			ctrl[capacity + p_index] = p_value;
+		}
+	}
+
+	_FORCE_INLINE_ bool _is_full(uint32_t p_index) const {
+		return ctrl[p_index] >= 0;
+	}
+
+	int32_t _find(const TKey &p_key, uint32_t p_hash) const {
+		if (unlikely(!elements)) {
+			return -1;
+		}
+
+		const uint32_t mask = capacity - 1;
+		const int8_t h2 = _h2(p_hash);
+		uint32_t pos = (p_hash >> 7) & mask;
+		uint32_t stride = 0;
+
+		while (true) {
+			Group g(ctrl + pos);
+			uint32_t matches = g.match(h2);
+			while (matches) {
+				uint32_t index = (pos + _lowest_bit(matches)) & mask;
+				if (Comparator::compare(slots[index].key, p_key)) {
+					return index;
+				}
+				matches &= matches - 1;
+			}
+			if (g.match_empty()) {
+				return -1;
+			}
+			// Triangular probing visits every group when capacity is a power of two.
+			stride += GROUP_WIDTH;
+			pos = (pos + stride) & mask;
+		}
+	}
+
+	uint32_t _find_available(uint32_t p_hash) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = (p_hash >> 7) & mask;
+		uint32_t stride = 0;
+
+		while (true) {
+			uint32_t available = Group(ctrl + pos).match_available();
+			if (available) {
+				return (pos + _lowest_bit(available)) & mask;
+			}
+			stride += GROUP_WIDTH;
+			pos = (pos + stride) & mask;
+		}
+	}
+
+	void _allocate(uint32_t p_capacity) {
+		capacity = p_capacity;
+		slots = (Pair *)Memory::alloc_static(sizeof(Pair) * capacity + capacity + GROUP_WIDTH);
+		ctrl = (int8_t *)(slots + capacity);
+		memset(ctrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+		elements = 0;
+		deleted = 0;
+	}
+
+	void _resize(uint32_t p_capacity) {
+		int8_t *old_ctrl = ctrl;
+		Pair *old_slots = slots;
+		uint32_t old_capacity = capacity;
+
+		_allocate(p_capacity);
+
+		if (!old_slots) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (old_ctrl[i] < 0) {
+				continue;
+			}
+			uint32_t hash = _hash(old_slots[i].key);
+			uint32_t index = _find_available(hash);
+			// Pairs are relocated bitwise, like the rest of the engine's containers do.
+			memcpy((void *)&slots[index], (const void *)&old_slots[i], sizeof(Pair));
+			_set_ctrl(index, _h2(hash));
+			elements++;
+		}
+
+		Memory::free_static(old_slots);
+	}
+
+	// Keep at least one empty control byte per probe sequence by limiting the
+	// load (live plus deleted slots) to 7/8.
+	_FORCE_INLINE_ void _reserve_one() {
+		if (unlikely(!capacity)) {
+			_allocate(MIN_CAPACITY);
+			return;
+		}
+		if ((elements + deleted + 1) * 8 > capacity * 7) {
+			// Mostly tombstones, rehash at the same size to clean them up.
+			_resize((elements + 1) * 16 > capacity * 7 ? capacity * 2 : capacity);
+		}
+	}
+
+	Pair *_insert_new(const TKey &p_key, const TData &p_data, uint32_t p_hash) {
+		_reserve_one();
+
+		uint32_t slot = _find_available(p_hash);
+		if (ctrl[slot] == CTRL_DELETED) {
+			deleted--;
+		}
+		memnew_placement(&slots[slot], Pair(p_key, p_data));
+		_set_ctrl(slot, _h2(p_hash));
+		elements++;
+		return &slots[slot];
+	}
+
+	void _copy_from(const FlatHashMap &p_other) {
+		if (!p_other.elements) {
+			return;
+		}
+		capacity = p_other.capacity;
+		slots = (Pair *)Memory::alloc_static(sizeof(Pair) * capacity + capacity + GROUP_WIDTH);
+		ctrl = (int8_t *)(slots + capacity);
+		memcpy(ctrl, p_other.ctrl, capacity + GROUP_WIDTH);
+		for (uint32_t i = 0; i < capacity; i++) {
+			if (_is_full(i)) {
+				memnew_placement(&slots[i], Pair(p_other.slots[i]));
+			}
+		}
+		elements = p_other.elements;
+		deleted = p_other.deleted;
+	}
+
+public:
+	void set(const TKey &p_key, const TData &p_data) {
+		uint32_t hash = _hash(p_key);
+		int32_t index = _find(p_key, hash);
+		if (index >= 0) {
+			slots[index].data = p_data;
+		} else {
+			_insert_new(p_key, p_data, hash);
+		}
+	}
+
+	void set(const Pair &p_pair) {
+		set(p_pair.key, p_pair.data);
+	}
+
+	bool has(const TKey &p_key) const {
+		return _find(p_key, _hash(p_key)) >= 0;
+	}
+
+	/**
+	 * Get a key from data, return a const reference.
+	 * WARNING: this doesn't check errors, use either getptr and check nullptr, or check
+	 * first with has(key)
+	 */
+	const TData &get(const TKey &p_key) const {
+		const TData *res = getptr(p_key);
+		CRASH_COND_MSG(!res, "Map key not found.");
+		return *res;
+	}
+
+	TData &get(const TKey &p_key) {
+		TData *res = getptr(p_key);
+		CRASH_COND_MSG(!res, "Map key not found.");
+		return *res;
+	}
+
+	_FORCE_INLINE_ TData *getptr(const TKey &p_key) {
+		int32_t index = _find(p_key, _hash(p_key));
+		return index >= 0 ? &slots[index].data : nullptr;
+	}
+
+	_FORCE_INLINE_ const TData *getptr(const TKey &p_key) const {
+		int32_t index = _find(p_key, _hash(p_key));
+		return index >= 0 ? &slots[index].data : nullptr;
+	}
+
+	bool erase(const TKey &p_key) {
+		// The key may live inside the map (e.g. erase(*next(nullptr))), so locate the slot before destroying anything.
+		int32_t index = _find(p_key, _hash(p_key));
+		if (index < 0) {
+			return false;
+		}
+
+		slots[index].~Pair();
+		elements--;
+
+		if (elements == 0) {
+			// Nothing left to probe past, forget the tombstones.
+			memset(ctrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+			deleted = 0;
+		} else {
+			_set_ctrl(index, CTRL_DELETED);
+			deleted++;
+		}
+		return true;
+	}
+
+	inline const TData &operator[](const TKey &p_key) const { //constref
+		return get(p_key);
+	}
+
+	inline TData &operator[](const TKey &p_key) { //assignment
+		uint32_t hash = _hash(p_key);
+		int32_t index = _find(p_key, hash);
+		if (index >= 0) {
+			return slots[index].data;
+		}
+		return _insert_new(p_key, TData(), hash)->data;
+	}
+
+	/**
+	 * Same as HashMap::next: pass nullptr to get the first key, then the
+	 * previous key to get the following one. Returns nullptr at the end.
+	 * Iteration is a linear walk over the slot array; passing a pointer
+	 * obtained from this map avoids hashing the key again.
+	 */
+	const TKey *next(const TKey *p_key) const {
+		if (unlikely(!elements)) {
+			return nullptr;
+		}
+
+		uint32_t from = 0;
+		if (p_key) {
+			uintptr_t offset = uintptr_t(p_key) - uintptr_t(slots);
+			if (uintptr_t(p_key) >= uintptr_t(slots) && offset < sizeof(Pair) * capacity && offset % sizeof(Pair) == 0) {
+				from = uint32_t(offset / sizeof(Pair)) + 1;
+			} else {
+				int32_t index = _find(*p_key, _hash(*p_key));
+				if (index < 0) {
+					return nullptr;
+				}
+				from = index + 1;
+			}
+		}
+
+		for (uint32_t i = from; i < capacity; i++) {
+			if (_is_full(i)) {
+				return &slots[i].key;
+			}
+		}
+		return nullptr;
+	}
+
+	inline unsigned int size() const {
+		return elements;
+	}
+
+	inline bool is_empty() const {
+		return elements == 0;
+	}
+
+	void reserve(uint32_t p_elements) {
+		uint32_t new_capacity = capacity ? capacity : MIN_CAPACITY;
+		while (p_elements * 8 > new_capacity * 7) {
+			new_capacity *= 2;
+		}
+		if (new_capacity > capacity) {
+			_resize(new_capacity);
+		}
+	}
+
+	void clear() {
+		if (!slots) {
+			return;
+		}
+		for (uint32_t i = 0; i < capacity; i++) {
+			if (_is_full(i)) {
+				slots[i].~Pair();
+			}
+		}
+		Memory::free_static(slots);
+		slots = nullptr;
+		ctrl = nullptr;
+		capacity = 0;
+		elements = 0;
+		deleted = 0;
+	}
+
+	void get_key_list(List<TKey> *r_keys) const {
+		for (uint32_t i = 0; i < capacity; i++) {
+			if (_is_full(i)) {
+				r_keys->push_back(slots[i].key);
+			}
+		}
+	}
+
+	void operator=(const FlatHashMap &p_other) {
+		if (this == &p_other) {
+			return;
+		}
+		clear();
+		_copy_from(p_other);
+	}
+
+	FlatHashMap(const FlatHashMap &p_other) {
+		_copy_from(p_other);
+	}
+
+	FlatHashMap() {}
+
+	~FlatHashMap() {
+		clear();
+	}
+};
+
+#endif // FLAT_HASH_MAP_H
@@ -0,0 +1,141 @@
+/*************************************************************************/
+/*  frame_arena.cpp                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "frame_arena.h"
+
+#include "core/error/error_macros.h"
+#include "core/os/copymem.h"
+
+void FrameArena::_add_chunk(size_t p_min_size) {
+	size_t size = MAX(size_t(MIN_CHUNK_SIZE), chunk ? chunk->size * 2 : 0);
+	size = MAX(size, p_min_size);
+
+	Chunk *new_chunk = (Chunk *)memalloc(CHUNK_HEADER_SIZE + size);
+	CRASH_COND_MSG(!new_chunk, "Out of memory");
+	memnew_placement(new_chunk, Chunk);
+	new_chunk->prev = chunk;
+	new_chunk->size = size;
+	chunk = new_chunk;
+	total_size += size;
+}
+
+void FrameArena::_free_chunks() {
+	while (chunk) {
+		Chunk *prev = chunk->prev;
+		memfree(chunk);
+		chunk = prev;
+	}
+	total_size = 0;
+}
+
+void FrameArena::_rewind() {
+	last_block = nullptr;
+	if (chunk->prev || total_size > MAX_RETAINED_SIZE) {
+		// Replace the chunks with a single one big enough for the whole round.
+		size_t size = MIN(total_size, size_t(MAX_RETAINED_SIZE));
+		_free_chunks();
+		_add_chunk(size);
+	} else {
+		chunk->used = 0;
+	}
+}
+
+void *FrameArena::alloc(size_t p_bytes) {
+	size_t block_size = _get_block_size(p_bytes);
+	if (unlikely(!chunk || chunk->used + block_size > chunk->size)) {
+		_add_chunk(block_size);
+	}
+
+	uint8_t *block = _get_chunk_data(chunk) + chunk->used;
+	*(uint64_t *)block = p_bytes;
+	chunk->used += block_size;
+	live_blocks++;
+	last_block = block;
+
+	return block + BLOCK_HEADER_SIZE;
+}
+
+void *FrameArena::realloc(void *p_memory, size_t p_bytes) {
+	if (p_memory == nullptr) {
+		return alloc(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free(p_memory);
+		return nullptr;
+	}
+
+	uint8_t *block = (uint8_t *)p_memory - BLOCK_HEADER_SIZE;
+	uint64_t old_bytes = *(uint64_t *)block;
+
+	if (block == last_block) {
+		size_t offset = block - _get_chunk_data(chunk);
+		if (offset + _get_block_size(p_bytes) <= chunk->size) {
+			chunk->used = offset + _get_block_size(p_bytes);
+			*(uint64_t *)block = p_bytes;
+			return p_memory;
+		}
+	} else if (_get_block_size(p_bytes) <= _get_block_size(old_bytes)) {
+		*(uint64_t *)block = p_bytes;
+		return p_memory;
+	}
+
+	void *new_memory = alloc(p_bytes);
+	copymem(new_memory, p_memory, MIN(old_bytes, uint64_t(p_bytes)));
+	free(p_memory);
+	return new_memory;
+}
+
+void FrameArena::free(void *p_memory) {
+	ERR_FAIL_COND(p_memory == nullptr);
+	ERR_FAIL_COND_MSG(live_blocks == 0, "Freeing memory that was not allocated from this thread's FrameArena.");
+
+	uint8_t *block = (uint8_t *)p_memory - BLOCK_HEADER_SIZE;
+	if (block == last_block) {
+		chunk->used = block - _get_chunk_data(chunk);
+		last_block = nullptr;
+	}
+
+	live_blocks--;
+	if (live_blocks == 0) {
+		_rewind();
+	}
+}
+
+FrameArena &FrameArena::get_thread_arena() {
+	static thread_local FrameArena thread_arena;
+	return thread_arena;
+}
+
+FrameArena::~FrameArena() {
+	if (live_blocks) {
+		ERR_PRINT("FrameArena blocks are still in use at thread exit.");
+	}
+	_free_chunks();
+}
@@ -0,0 +1,89 @@
+/*************************************************************************/
+/*  frame_arena.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/os/memory.h"
+#include "core/typedefs.h"
+
+// Linear allocator for transient data, such as the temporaries built while culling or drawing a frame.
+// Every thread has its own arena, so blocks must be freed on the thread that allocated them.
+// Blocks are carved out of a chunk one after another and only reclaimed together: once the last live
+// block is freed the arena rewinds, merging any overflow chunks so the next frame needs no malloc at all.
+class FrameArena {
+	struct Chunk {
+		Chunk *prev = nullptr;
+		size_t size = 0;
+		size_t used = 0;
+	};
+
+	enum {
+		ALIGN = 16,
+		CHUNK_HEADER_SIZE = (sizeof(Chunk) + ALIGN - 1) & ~(ALIGN - 1),
+		BLOCK_HEADER_SIZE = ALIGN, // Holds the block size, needed by realloc().
+		MIN_CHUNK_SIZE = 64 * 1024,
+		MAX_RETAINED_SIZE = 4 * 1024 * 1024,
+	};
+
+	Chunk *chunk = nullptr;
+	size_t total_size = 0;
+	uint32_t live_blocks = 0;
+	uint8_t *last_block = nullptr; // The most recent block can be grown or released in place.
+
+	_FORCE_INLINE_ static uint8_t *_get_chunk_data(Chunk *p_chunk) { return (uint8_t *)p_chunk + CHUNK_HEADER_SIZE; }
+	_FORCE_INLINE_ static size_t _get_block_size(size_t p_bytes) { return BLOCK_HEADER_SIZE + ((p_bytes + ALIGN - 1) & ~size_t(ALIGN - 1)); }
+
+	void _add_chunk(size_t p_min_size);
+	void _free_chunks();
+	void _rewind();
+
+public:
+	void *alloc(size_t p_bytes);
+	void *realloc(void *p_memory, size_t p_bytes);
+	void free(void *p_memory);
+
+	uint32_t get_live_blocks() const { return live_blocks; }
+	size_t get_capacity() const { return total_size; }
+
+	static FrameArena &get_thread_arena();
+
+	~FrameArena();
+};
+
+// Allocator for Map, List, Set and LocalVector that takes its memory from the calling thread's FrameArena.
+class FrameArenaAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return FrameArena::get_thread_arena().alloc(p_memory); }
+	_FORCE_INLINE_ static void *realloc(void *p_memory, size_t p_bytes) { return FrameArena::get_thread_arena().realloc(p_memory, p_bytes); }
+	_FORCE_INLINE_ static void free(void *p_ptr) { FrameArena::get_thread_arena().free(p_ptr); }
+};
+
+#endif // FRAME_ARENA_H
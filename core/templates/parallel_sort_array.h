@@ -0,0 +1,124 @@
+/*************************************************************************/
+/*  parallel_sort_array.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef PARALLEL_SORT_ARRAY_H
+#define PARALLEL_SORT_ARRAY_H
+
+#include "core/os/os.h"
+#include "core/templates/sort_array.h"
+#include "core/templates/thread_work_pool.h"
+
+// Sorts large arrays on a temporary thread pool. Chunks are sorted in parallel, then merged in
+// pairs, each round of merges also running in parallel. Arrays too small to be worth the threads
+// are sorted on the calling thread. The comparator is called from several threads at once.
+template <class T, class Comparator = _DefaultComparator<T>, bool Validate = SORT_ARRAY_VALIDATE_ENABLED>
+class ParallelSortArray {
+	typedef SortArray<T, Comparator, Validate> Sorter;
+
+	struct Job {
+		Sorter sorter;
+		T *array = nullptr;
+		T *src = nullptr;
+		T *dst = nullptr;
+		int64_t len = 0;
+		int64_t width = 0; // Chunk size while sorting, then size of the runs being merged.
+		bool stable = false;
+
+		void sort_chunk(uint32_t p_index, void *p_userdata) {
+			int64_t first = p_index * width;
+			int64_t last = MIN(first + width, len);
+			if (stable) {
+				sorter.stable_sort_range(first, last, array, dst);
+			} else {
+				sorter.sort_range(first, last, array);
+			}
+		}
+
+		void merge_runs(uint32_t p_index, void *p_userdata) {
+			int64_t first = p_index * width * 2;
+			sorter.merge(src, first, MIN(first + width, len), MIN(first + width * 2, len), dst);
+		}
+	};
+
+public:
+	enum {
+		MIN_ELEMENTS_PER_THREAD = 16384,
+	};
+
+	Comparator compare;
+
+	void sort(T *p_array, int p_len, bool p_stable = false) const {
+		int thread_count = OS::get_singleton()->can_use_threads() ? OS::get_singleton()->get_processor_count() : 1;
+		int chunks = MIN(thread_count, p_len / MIN_ELEMENTS_PER_THREAD);
+
+		Job job;
+		job.sorter.compare = compare;
+
+		if (chunks < 2) {
+			if (p_stable) {
+				job.sorter.stable_sort(p_array, p_len);
+			} else {
+				job.sorter.sort(p_array, p_len);
+			}
+			return;
+		}
+
+		T *buffer = memnew_arr(T, p_len);
+		job.array = p_array;
+		job.len = p_len;
+		job.width = (p_len + chunks - 1) / chunks;
+		job.stable = p_stable;
+		job.dst = buffer;
+
+		ThreadWorkPool work_pool;
+		work_pool.init(chunks - 1); // The calling thread takes part in the work too.
+		work_pool.do_work(chunks, &job, &Job::sort_chunk, (void *)nullptr);
+
+		// Merging is stable, so it keeps the order of the stable chunk sorts.
+		job.src = p_array;
+		job.dst = buffer;
+		while (job.width < job.len) {
+			uint32_t pairs = (job.len + job.width * 2 - 1) / (job.width * 2);
+			work_pool.do_work(pairs, &job, &Job::merge_runs, (void *)nullptr);
+			SWAP(job.src, job.dst);
+			job.width *= 2;
+		}
+		work_pool.finish();
+
+		if (job.src != p_array) {
+			for (int i = 0; i < p_len; i++) {
+				p_array[i] = job.src[i];
+			}
+		}
+		memdelete_arr(buffer);
+	}
+};
+
+#endif // PARALLEL_SORT_ARRAY_H
@@ -0,0 +1,161 @@
+/*************************************************************************/
+/*  small_vector.h                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "core/error/error_macros.h"
+#include "core/os/copymem.h"
+#include "core/os/memory.h"
+
+// Non-COW vector that keeps up to N elements inline and only moves to the heap past that.
+// Meant for short-lived temporaries in hot engine code, where Vector would pay for an allocation
+// and atomic reference counting. Like LocalVector, elements are relocated with a plain memory copy.
+template <class T, uint32_t N, class U = uint32_t>
+class SmallVector {
+	static_assert(N > 0, "SmallVector needs room for at least one inline element.");
+
+	U count = 0;
+	U capacity = N;
+	T *data = (T *)inline_data;
+	alignas(T) uint8_t inline_data[N * sizeof(T)];
+
+	_FORCE_INLINE_ bool _is_inline() const { return data == (const T *)inline_data; }
+
+	void _grow(U p_capacity) {
+		if (_is_inline()) {
+			T *heap = (T *)memalloc(p_capacity * sizeof(T));
+			CRASH_COND_MSG(!heap, "Out of memory");
+			copymem(heap, data, count * sizeof(T));
+			data = heap;
+		} else {
+			data = (T *)memrealloc(data, p_capacity * sizeof(T));
+			CRASH_COND_MSG(!data, "Out of memory");
+		}
+		capacity = p_capacity;
+	}
+
+public:
+	_FORCE_INLINE_ T *ptr() { return data; }
+	_FORCE_INLINE_ const T *ptr() const { return data; }
+
+	_FORCE_INLINE_ U size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ U get_capacity() const { return capacity; }
+	_FORCE_INLINE_ bool is_on_heap() const { return !_is_inline(); }
+
+	_FORCE_INLINE_ void push_back(const T &p_elem) {
+		if (unlikely(count == capacity)) {
+			_grow(capacity << 1);
+		}
+		memnew_placement(&data[count++], T(p_elem));
+	}
+
+	void reserve(U p_size) {
+		if (p_size > capacity) {
+			_grow(nearest_power_of_2_templated(p_size));
+		}
+	}
+
+	void resize(U p_size) {
+		if (p_size < count) {
+			if (!__has_trivial_destructor(T)) {
+				for (U i = p_size; i < count; i++) {
+					data[i].~T();
+				}
+			}
+			count = p_size;
+		} else if (p_size > count) {
+			reserve(p_size);
+			if (!__has_trivial_constructor(T)) {
+				for (U i = count; i < p_size; i++) {
+					memnew_placement(&data[i], T);
+				}
+			}
+			count = p_size;
+		}
+	}
+
+	void remove_unordered(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		count--;
+		if (count > p_index) {
+			data[p_index] = data[count];
+		}
+		if (!__has_trivial_destructor(T)) {
+			data[count].~T();
+		}
+	}
+
+	_FORCE_INLINE_ void clear() { resize(0); }
+	void reset() {
+		clear();
+		if (!_is_inline()) {
+			memfree(data);
+			data = (T *)inline_data;
+			capacity = N;
+		}
+	}
+
+	_FORCE_INLINE_ const T &operator[](U p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+	_FORCE_INLINE_ T &operator[](U p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	_FORCE_INLINE_ SmallVector() {}
+	SmallVector(const SmallVector &p_from) {
+		reserve(p_from.count);
+		for (U i = 0; i < p_from.count; i++) {
+			memnew_placement(&data[i], T(p_from.data[i]));
+		}
+		count = p_from.count;
+	}
+	SmallVector &operator=(const SmallVector &p_from) {
+		if (this != &p_from) {
+			clear();
+			reserve(p_from.count);
+			for (U i = 0; i < p_from.count; i++) {
+				memnew_placement(&data[i], T(p_from.data[i]));
+			}
+			count = p_from.count;
+		}
+		return *this;
+	}
+
+	_FORCE_INLINE_ ~SmallVector() {
+		reset();
+	}
+};
+
+#endif // SMALL_VECTOR_H
@@ -32,6 +32,7 @@
 #define SORT_ARRAY_H
 
 #include "core/error/error_macros.h"
+#include "core/os/memory.h"
 #include "core/typedefs.h"
 
 #define ERR_BAD_COMPARE(cond)                                         \
@@ -309,6 +310,60 @@ public:
 		sort_range(0, p_len, p_array);
 	}
 
+	// Merges the sorted ranges [p_first, p_middle) and [p_middle, p_last) of p_src into the same
+	// range of p_dst. Ties are taken from the first range, so equal elements keep their order.
+	inline void merge(const T *p_src, int p_first, int p_middle, int p_last, T *p_dst) const {
+		int a = p_first;
+		int b = p_middle;
+		int out = p_first;
+		while (a < p_middle && b < p_last) {
+			if (compare(p_src[b], p_src[a])) {
+				p_dst[out++] = p_src[b++];
+			} else {
+				p_dst[out++] = p_src[a++];
+			}
+		}
+		while (a < p_middle) {
+			p_dst[out++] = p_src[a++];
+		}
+		while (b < p_last) {
+			p_dst[out++] = p_src[b++];
+		}
+	}
+
+	// Merge sort keeping equal elements in their original order. p_buffer is scratch space indexed
+	// like p_array, only its [p_first, p_last) range is used.
+	inline void stable_sort_range(int p_first, int p_last, T *p_array, T *p_buffer) const {
+		for (int i = p_first; i < p_last; i += INTROSORT_THRESHOLD) {
+			insertion_sort(i, MIN(i + INTROSORT_THRESHOLD, p_last), p_array);
+		}
+
+		T *src = p_array;
+		T *dst = p_buffer;
+		for (int64_t width = INTROSORT_THRESHOLD; width < p_last - p_first; width *= 2) {
+			for (int64_t i = p_first; i < p_last; i += width * 2) {
+				merge(src, i, MIN(i + width, (int64_t)p_last), MIN(i + width * 2, (int64_t)p_last), dst);
+			}
+			SWAP(src, dst);
+		}
+
+		if (src != p_array) {
+			for (int i = p_first; i < p_last; i++) {
+				p_array[i] = src[i];
+			}
+		}
+	}
+
+	inline void stable_sort(T *p_array, int p_len) const {
+		if (p_len <= INTROSORT_THRESHOLD) {
+			insertion_sort(0, p_len, p_array);
+			return;
+		}
+		T *buffer = memnew_arr(T, p_len);
+		stable_sort_range(0, p_len, p_array, buffer);
+		memdelete_arr(buffer);
+	}
+
 	inline void nth_element(int p_first, int p_last, int p_nth, T *p_array) const {
 		if (p_first == p_last || p_nth == p_last) {
 			return;
@@ -32,6 +32,8 @@
 
 #include "core/os/os.h"
 
+thread_local bool ThreadWorkPool::in_work = false;
+
 void ThreadWorkPool::_thread_function(void *p_user) {
 	ThreadData *thread = static_cast<ThreadData *>(p_user);
 	while (true) {
@@ -39,12 +41,14 @@ void ThreadWorkPool::_thread_function(void *p_user) {
 		if (thread->exit.load()) {
 			break;
 		}
+		in_work = true;
 		thread->work->work();
+		in_work = false;
 		thread->completed.post();
 	}
 }
 
-void ThreadWorkPool::init(int p_thread_count) {
+void ThreadWorkPool::init(int p_thread_count, Thread::Role p_role) {
 	ERR_FAIL_COND(threads != nullptr);
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_processor_count();
@@ -53,9 +57,10 @@ void ThreadWorkPool::init(int p_thread_count) {
 	thread_count = p_thread_count;
 	threads = memnew_arr(ThreadData, thread_count);
 
+	Thread::Settings settings = Thread::get_role_settings(p_role);
 	for (uint32_t i = 0; i < thread_count; i++) {
 		threads[i].exit.store(false);
-		threads[i].thread.start(&ThreadWorkPool::_thread_function, &threads[i]);
+		threads[i].thread.start(&ThreadWorkPool::_thread_function, &threads[i], settings);
 	}
 }
 
@@ -32,6 +32,7 @@
 #define THREAD_WORK_POOL_H
 
 #include "core/os/memory.h"
+#include "core/os/mutex.h"
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
 
@@ -74,9 +75,20 @@ class ThreadWorkPool {
 	ThreadData *threads = nullptr;
 	uint32_t thread_count = 0;
 	BaseWork *current_work = nullptr;
+	Mutex work_mutex; // Serializes do_work() calls made from different threads.
+
+	// Set while the thread runs a work function (of any pool), work issued from there runs inline.
+	static thread_local bool in_work;
 
 	static void _thread_function(void *p_user);
 
+	template <class C, class M, class U>
+	static void _do_work_inline(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
+		for (uint32_t i = 0; i < p_elements; i++) {
+			(p_instance->*p_method)(i, p_userdata);
+		}
+	}
+
 public:
 	template <class C, class M, class U>
 	void begin_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
@@ -121,12 +133,31 @@ public:
 
 	template <class C, class M, class U>
 	void do_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
+		if (in_work) {
+			// Nested work, issued from within a work function. The pool threads are busy (and
+			// waiting for them here could deadlock), so just process it on the calling thread.
+			_do_work_inline(p_elements, p_instance, p_method, p_userdata);
+			return;
+		}
+
+		MutexLock lock(work_mutex);
+		ERR_FAIL_COND(!threads); //never initialized
+		if (current_work != nullptr) {
+			// Work started with begin_work() is still in flight, don't wait for it.
+			_do_work_inline(p_elements, p_instance, p_method, p_userdata);
+			return;
+		}
+
 		begin_work(p_elements, p_instance, p_method, p_userdata);
+		// Help consume the elements instead of sitting idle until the pool threads are done.
+		in_work = true;
+		current_work->work();
+		in_work = false;
 		end_work();
 	}
 
 	_FORCE_INLINE_ int get_thread_count() const { return thread_count; }
-	void init(int p_thread_count = -1);
+	void init(int p_thread_count = -1, Thread::Role p_role = Thread::ROLE_WORKER);
 	void finish();
 	~ThreadWorkPool();
 };
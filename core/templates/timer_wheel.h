@@ -0,0 +1,281 @@
+/*************************************************************************/
+/*  timer_wheel.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include "core/error/error_macros.h"
+#include "core/typedefs.h"
+
+// Hierarchical timing wheel, for large amounts of timers that mostly just wait.
+// Elements are kept in slots by deadline (in ticks): the first level has one slot per tick,
+// and each level above covers SLOTS times the span of the one below. Advancing only visits
+// occupied slots, and upper slots are cascaded down as time reaches them, so an element is
+// moved at most once per level before it expires. Expired elements are queued until popped,
+// so they can be restarted or removed from the expiration callbacks.
+template <class T>
+class TimerWheel {
+public:
+	enum {
+		SLOT_BITS = 6,
+		SLOTS = 1 << SLOT_BITS,
+		LEVELS = 7,
+	};
+
+	class Element {
+		friend class TimerWheel<T>;
+
+		TimerWheel<T> *_wheel = nullptr;
+		Element **_list = nullptr;
+		Element *_next = nullptr;
+		Element *_prev = nullptr;
+		T *_self;
+		uint64_t _deadline = 0;
+
+	public:
+		_FORCE_INLINE_ bool in_wheel() const { return _wheel; }
+		_FORCE_INLINE_ void remove_from_wheel() {
+			if (_wheel) {
+				_wheel->remove(this);
+			}
+		}
+		_FORCE_INLINE_ uint64_t get_deadline() const { return _deadline; }
+		_FORCE_INLINE_ T *self() const { return _self; }
+
+		_FORCE_INLINE_ Element(T *p_self) {
+			_self = p_self;
+		}
+
+		_FORCE_INLINE_ ~Element() {
+			remove_from_wheel();
+		}
+	};
+
+private:
+	Element *slots[LEVELS][SLOTS] = {};
+	uint64_t occupied[LEVELS] = {}; // One bit per non-empty slot.
+	Element *expired = nullptr;
+	Element *expired_last = nullptr;
+	uint64_t time = 0;
+	uint32_t count = 0;
+
+	static _FORCE_INLINE_ uint32_t _lowest_bit(uint64_t p_mask) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctzll(p_mask);
+#else
+		uint32_t bit = 0;
+		while (!(p_mask & 1)) {
+			p_mask >>= 1;
+			bit++;
+		}
+		return bit;
+#endif
+	}
+
+	void _place(Element *p_element) {
+		// The level is given by the highest slot digit where the deadline differs from the current time,
+		// past deadlines expire on the next advance.
+		uint64_t deadline = MAX(p_element->_deadline, time);
+		uint64_t diff = deadline ^ time;
+
+		int level = 0;
+		uint32_t slot;
+		if (diff >> (LEVELS * SLOT_BITS)) {
+			// Too far ahead, wait in the top level slot reached last and get placed again from there.
+			level = LEVELS - 1;
+			slot = ((time >> (level * SLOT_BITS)) - 1) & (SLOTS - 1);
+		} else {
+			while (diff >> ((level + 1) * SLOT_BITS)) {
+				level++;
+			}
+			slot = (deadline >> (level * SLOT_BITS)) & (SLOTS - 1);
+		}
+
+		Element **list = &slots[level][slot];
+		p_element->_list = list;
+		p_element->_prev = nullptr;
+		p_element->_next = *list;
+		if (*list) {
+			(*list)->_prev = p_element;
+		}
+		*list = p_element;
+		occupied[level] |= uint64_t(1) << slot;
+	}
+
+	Element *_take_slot(int p_level, uint32_t p_slot) {
+		Element *first = slots[p_level][p_slot];
+		slots[p_level][p_slot] = nullptr;
+		occupied[p_level] &= ~(uint64_t(1) << p_slot);
+		return first;
+	}
+
+	void _expire_slot(uint32_t p_slot) {
+		Element *e = _take_slot(0, p_slot);
+		while (e) {
+			Element *next = e->_next;
+			e->_list = &expired;
+			e->_next = nullptr;
+			e->_prev = expired_last;
+			if (expired_last) {
+				expired_last->_next = e;
+			} else {
+				expired = e;
+			}
+			expired_last = e;
+			e = next;
+		}
+	}
+
+	void _cascade(int p_level, uint32_t p_slot) {
+		Element *e = _take_slot(p_level, p_slot);
+		while (e) {
+			Element *next = e->_next;
+			_place(e);
+			e = next;
+		}
+	}
+
+public:
+	// Elements already in a wheel are moved to the new deadline.
+	void insert(Element *p_element, uint64_t p_deadline) {
+		p_element->remove_from_wheel();
+
+		p_element->_wheel = this;
+		p_element->_deadline = p_deadline;
+		_place(p_element);
+		count++;
+	}
+
+	void remove(Element *p_element) {
+		ERR_FAIL_COND(p_element->_wheel != this);
+
+		if (p_element->_prev) {
+			p_element->_prev->_next = p_element->_next;
+		} else {
+			*p_element->_list = p_element->_next;
+		}
+		if (p_element->_next) {
+			p_element->_next->_prev = p_element->_prev;
+		}
+
+		if (p_element->_list == &expired) {
+			if (expired_last == p_element) {
+				expired_last = p_element->_prev;
+			}
+		} else if (!*p_element->_list) {
+			uint32_t index = p_element->_list - &slots[0][0];
+			occupied[index / SLOTS] &= ~(uint64_t(1) << (index % SLOTS));
+		}
+
+		p_element->_wheel = nullptr;
+		p_element->_list = nullptr;
+		p_element->_next = nullptr;
+		p_element->_prev = nullptr;
+		count--;
+	}
+
+	// Moves time forward, queueing every element with a deadline up to p_time as expired.
+	void advance(uint64_t p_time) {
+		if (p_time < time) {
+			return;
+		}
+
+		while (true) {
+			uint64_t block_end = time | (SLOTS - 1);
+			uint64_t to = MIN(p_time, block_end);
+
+			uint64_t mask = occupied[0] >> (time & (SLOTS - 1));
+			mask &= (uint64_t(2) << ((to - time) & (SLOTS - 1))) - 1;
+			while (mask) {
+				uint32_t bit = _lowest_bit(mask);
+				mask &= mask - 1;
+				_expire_slot((time & (SLOTS - 1)) + bit);
+			}
+
+			if (p_time <= block_end) {
+				time = p_time;
+				return;
+			}
+
+			// The first level is empty now, skip to where the lowest occupied level cascades next.
+			int level = 1;
+			while (level < LEVELS && !occupied[level]) {
+				level++;
+			}
+			uint64_t next = level < LEVELS ? (time | ((uint64_t(1) << (level * SLOT_BITS)) - 1)) + 1 : p_time + 1;
+			if (next > p_time) {
+				time = p_time;
+				return;
+			}
+
+			time = next;
+			for (; level < LEVELS; level++) {
+				uint32_t slot = (time >> (level * SLOT_BITS)) & (SLOTS - 1);
+				_cascade(level, slot);
+				if (slot != 0) {
+					break;
+				}
+			}
+		}
+	}
+
+	// Returns the next expired element, removing it from the wheel, or null when there are none left.
+	T *pop_expired() {
+		Element *e = expired;
+		if (!e) {
+			return nullptr;
+		}
+		remove(e);
+		return e->_self;
+	}
+
+	_FORCE_INLINE_ bool has_expired() const { return expired != nullptr; }
+	_FORCE_INLINE_ uint64_t get_time() const { return time; }
+	_FORCE_INLINE_ uint32_t size() const { return count; }
+
+	void clear() {
+		for (int i = 0; i < LEVELS; i++) {
+			for (int j = 0; j < SLOTS; j++) {
+				while (slots[i][j]) {
+					remove(slots[i][j]);
+				}
+			}
+		}
+		while (expired) {
+			remove(expired);
+		}
+	}
+
+	~TimerWheel() {
+		clear();
+	}
+};
+
+#endif // TIMER_WHEEL_H
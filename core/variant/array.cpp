@@ -34,6 +34,7 @@
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
 #include "core/templates/hashfuncs.h"
+#include "core/templates/parallel_sort_array.h"
 #include "core/templates/vector.h"
 #include "core/variant/callable.h"
 #include "core/variant/variant.h"
@@ -199,7 +200,22 @@ void Array::append_array(const Array &p_array) {
 }
 
 Error Array::resize(int p_new_size) {
-	return _p->array.resize(p_new_size);
+	int old_size = _p->array.size();
+	Error err = _p->array.resize(p_new_size);
+	if (err != OK) {
+		return err;
+	}
+
+	// Arrays typed with a built-in type are filled with its default value, so they never hold null elements.
+	Variant::Type type = _p->typed.type;
+	if (type != Variant::NIL && type != Variant::OBJECT) {
+		Variant *w = _p->array.ptrw();
+		for (int i = old_size; i < p_new_size; i++) {
+			Callable::CallError ce;
+			Variant::construct(type, w[i], nullptr, 0, ce);
+		}
+	}
+	return OK;
 }
 
 void Array::insert(int p_pos, const Variant &p_value) {
@@ -368,7 +384,8 @@ struct _ArrayVariantSort {
 };
 
 void Array::sort() {
-	_p->array.sort_custom<_ArrayVariantSort>();
+	ParallelSortArray<Variant, _ArrayVariantSort> sorter;
+	sorter.sort(_p->array.ptrw(), _p->array.size());
 }
 
 struct _ArrayVariantSortCustom {
@@ -386,6 +403,7 @@ struct _ArrayVariantSortCustom {
 };
 
 void Array::sort_custom(Callable p_callable) {
+	// Script callables can't be called from several threads, so this one is always serial.
 	SortArray<Variant, _ArrayVariantSortCustom, true> avs;
 	avs.compare.func = p_callable;
 	avs.sort(_p->array.ptrw(), _p->array.size());
@@ -542,6 +560,22 @@ void Array::set_typed(uint32_t p_type, const StringName &p_class_name, const Var
 	_p->typed.where = "TypedArray";
 }
 
+bool Array::is_typed() const {
+	return _p->typed.type != Variant::NIL;
+}
+
+uint32_t Array::get_typed_builtin() const {
+	return _p->typed.type;
+}
+
+StringName Array::get_typed_class_name() const {
+	return _p->typed.class_name;
+}
+
+Variant Array::get_typed_script() const {
+	return _p->typed.script;
+}
+
 Array::Array(const Array &p_from) {
 	_p = nullptr;
 	_ref(p_from);
@@ -36,6 +36,7 @@
 #include "core/io/resource.h"
 #include "core/math/math_funcs.h"
 #include "core/string/print_string.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 #include "scene/gui/control.h"
 #include "scene/main/node.h"
@@ -2142,11 +2143,68 @@ inline DA _convert_array(const SA &p_array) {
 	return da;
 }
 
+// Element types that typed arrays convert to packed arrays without going through Variant conversions.
+template <class T>
+struct _TypedArrayElement {
+	static const Variant::Type type = Variant::NIL;
+	static T get(const Variant &p_variant) { return T(); }
+};
+
+#define TYPED_ARRAY_ELEMENT(m_type, m_variant_type, m_getter)                                          \
+	template <>                                                                                        \
+	struct _TypedArrayElement<m_type> {                                                                \
+		static const Variant::Type type = m_variant_type;                                              \
+		static m_type get(const Variant &p_variant) { return *VariantInternal::m_getter(&p_variant); } \
+	};
+
+TYPED_ARRAY_ELEMENT(uint8_t, Variant::INT, get_int)
+TYPED_ARRAY_ELEMENT(int32_t, Variant::INT, get_int)
+TYPED_ARRAY_ELEMENT(int64_t, Variant::INT, get_int)
+TYPED_ARRAY_ELEMENT(float, Variant::FLOAT, get_float)
+TYPED_ARRAY_ELEMENT(double, Variant::FLOAT, get_float)
+TYPED_ARRAY_ELEMENT(String, Variant::STRING, get_string)
+TYPED_ARRAY_ELEMENT(Vector2, Variant::VECTOR2, get_vector2)
+TYPED_ARRAY_ELEMENT(Vector3, Variant::VECTOR3, get_vector3)
+TYPED_ARRAY_ELEMENT(Color, Variant::COLOR, get_color)
+
+#undef TYPED_ARRAY_ELEMENT
+
+template <class DA>
+inline bool _convert_typed_array(const Array &p_array, DA &r_array) {
+	return false;
+}
+
+template <class T>
+inline bool _convert_typed_array(const Array &p_array, Vector<T> &r_array) {
+	const Variant::Type type = _TypedArrayElement<T>::type;
+	if (type == Variant::NIL || p_array.get_typed_builtin() != uint32_t(type)) {
+		return false;
+	}
+
+	int size = p_array.size();
+	r_array.resize(size);
+	T *w = r_array.ptrw();
+	for (int i = 0; i < size; i++) {
+		const Variant &element = p_array[i];
+		if (unlikely(element.get_type() != type)) {
+			// Elements written by reference aren't validated, convert them one by one instead.
+			return false;
+		}
+		w[i] = _TypedArrayElement<T>::get(element);
+	}
+	return true;
+}
+
 template <class DA>
 inline DA _convert_array_from_variant(const Variant &p_variant) {
 	switch (p_variant.get_type()) {
 		case Variant::ARRAY: {
-			return _convert_array<DA, Array>(p_variant.operator Array());
+			const Array array = p_variant.operator Array();
+			DA da;
+			if (_convert_typed_array(array, da)) {
+				return da;
+			}
+			return _convert_array<DA, Array>(array);
 		}
 		case Variant::PACKED_BYTE_ARRAY: {
 			return _convert_array<DA, Vector<uint8_t>>(p_variant.operator Vector<uint8_t>());
@@ -34,10 +34,12 @@
 #include "core/crypto/crypto_core.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
+#include "core/math/batch_math.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
+#include "core/templates/parallel_sort_array.h"
 
 typedef void (*VariantFunc)(Variant &r_ret, Variant &p_self, const Variant **p_args);
 typedef void (*VariantConstructFunc)(Variant &r_ret, const Variant **p_args);
@@ -126,6 +128,11 @@ static _FORCE_INLINE_ void vc_change_return_type(R (*method)(P...), Variant *v)
 	VariantTypeAdjust<R>::adjust(v);
 }
 
+template <class... P>
+static _FORCE_INLINE_ void vc_change_return_type(void (*method)(P...), Variant *v) {
+	VariantInternal::clear(v);
+}
+
 template <class R, class T, class... P>
 static _FORCE_INLINE_ int vc_get_argument_count(R (T::*method)(P...)) {
 	return sizeof...(P);
@@ -199,6 +206,11 @@ static _FORCE_INLINE_ Variant::Type vc_get_return_type(R (*method)(P...)) {
 	return GetTypeInfo<R>::VARIANT_TYPE;
 }
 
+template <class... P>
+static _FORCE_INLINE_ Variant::Type vc_get_return_type(void (*method)(P...)) {
+	return Variant::NIL;
+}
+
 template <class R, class T, class... P>
 static _FORCE_INLINE_ bool vc_has_return_type(R (T::*method)(P...)) {
 	return true;
@@ -218,6 +230,16 @@ static _FORCE_INLINE_ bool vc_has_return_type(void (T::*method)(P...) const) {
 	return false;
 }
 
+template <class R, class... P>
+static _FORCE_INLINE_ bool vc_has_return_type(R (*method)(P...)) {
+	return true;
+}
+
+template <class... P>
+static _FORCE_INLINE_ bool vc_has_return_type(void (*method)(P...)) {
+	return false;
+}
+
 template <class R, class T, class... P>
 static _FORCE_INLINE_ bool vc_is_const(R (T::*method)(P...)) {
 	return false;
@@ -237,6 +259,17 @@ static _FORCE_INLINE_ bool vc_is_const(void (T::*method)(P...) const) {
 	return true;
 }
 
+// Bound functions returning a value only read the instance, the ones without one are called to modify it.
+template <class R, class... P>
+static _FORCE_INLINE_ bool vc_is_const(R (*method)(P...)) {
+	return true;
+}
+
+template <class... P>
+static _FORCE_INLINE_ bool vc_is_const(void (*method)(P...)) {
+	return false;
+}
+
 template <class R, class T, class... P>
 static _FORCE_INLINE_ Variant::Type vc_get_base_type(R (T::*method)(P...)) {
 	return GetTypeInfo<T>::VARIANT_TYPE;
@@ -299,42 +332,67 @@ static _FORCE_INLINE_ void vc_ptrcall(R (*method)(T *, P...), void *p_base, cons
 	call_with_ptr_args_static_retc<T, R, P...>(reinterpret_cast<T *>(p_base), method, p_args, r_ret);
 }
 
-#define FUNCTION_CLASS(m_class, m_method_name, m_method_ptr)                                                                                                          \
-	struct Method_##m_class##_##m_method_name {                                                                                                                       \
-		static void call(Variant *base, const Variant **p_args, int p_argcount, Variant &r_ret, const Vector<Variant> &p_defvals, Callable::CallError &r_error) {     \
-			call_with_variant_args_retc_static_helper_dv(VariantGetInternalPtr<m_class>::get_ptr(base), m_method_ptr, p_args, p_argcount, r_ret, p_defvals, r_error); \
-		}                                                                                                                                                             \
-		static void validated_call(Variant *base, const Variant **p_args, int p_argcount, Variant *r_ret) {                                                           \
-			vc_change_return_type(m_method_ptr, r_ret);                                                                                                               \
-			call_with_validated_variant_args_static_retc(base, m_method_ptr, p_args, r_ret);                                                                          \
-		}                                                                                                                                                             \
-		static void ptrcall(void *p_base, const void **p_args, void *r_ret, int p_argcount) {                                                                         \
-			vc_ptrcall(m_method_ptr, p_base, p_args, r_ret);                                                                                                          \
-		}                                                                                                                                                             \
-		static int get_argument_count() {                                                                                                                             \
-			return vc_get_argument_count(m_method_ptr);                                                                                                               \
-		}                                                                                                                                                             \
-		static Variant::Type get_argument_type(int p_arg) {                                                                                                           \
-			return vc_get_argument_type(m_method_ptr, p_arg);                                                                                                         \
-		}                                                                                                                                                             \
-		static Variant::Type get_return_type() {                                                                                                                      \
-			return vc_get_return_type(m_method_ptr);                                                                                                                  \
-		}                                                                                                                                                             \
-		static bool has_return_type() {                                                                                                                               \
-			return true;                                                                                                                                              \
-		}                                                                                                                                                             \
-		static bool is_const() {                                                                                                                                      \
-			return true;                                                                                                                                              \
-		}                                                                                                                                                             \
-		static bool is_vararg() {                                                                                                                                     \
-			return false;                                                                                                                                             \
-		}                                                                                                                                                             \
-		static Variant::Type get_base_type() {                                                                                                                        \
-			return GetTypeInfo<m_class>::VARIANT_TYPE;                                                                                                                \
-		}                                                                                                                                                             \
-		static StringName get_name() {                                                                                                                                \
-			return #m_method_name;                                                                                                                                    \
-		}                                                                                                                                                             \
+template <class T, class... P>
+static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, const void **p_args, void *r_ret) {
+	call_with_ptr_args_static<T, P...>(reinterpret_cast<T *>(p_base), method, p_args);
+}
+
+template <class R, class T, class... P>
+static _FORCE_INLINE_ void vc_function_call(R (*method)(T *, P...), Variant *base, const Variant **p_args, int p_argcount, Variant &r_ret, const Vector<Variant> &p_defvals, Callable::CallError &r_error) {
+	call_with_variant_args_retc_static_helper_dv(VariantGetInternalPtr<T>::get_ptr(base), method, p_args, p_argcount, r_ret, p_defvals, r_error);
+}
+
+template <class T, class... P>
+static _FORCE_INLINE_ void vc_function_call(void (*method)(T *, P...), Variant *base, const Variant **p_args, int p_argcount, Variant &r_ret, const Vector<Variant> &p_defvals, Callable::CallError &r_error) {
+	call_with_variant_args_static_helper_dv(VariantGetInternalPtr<T>::get_ptr(base), method, p_args, p_argcount, p_defvals, r_error);
+}
+
+template <class R, class T, class... P>
+static _FORCE_INLINE_ void vc_validated_call(R (*method)(T *, P...), Variant *base, const Variant **p_args, Variant *r_ret) {
+	call_with_validated_variant_args_static_retc(base, method, p_args, r_ret);
+}
+
+template <class T, class... P>
+static _FORCE_INLINE_ void vc_validated_call(void (*method)(T *, P...), Variant *base, const Variant **p_args, Variant *r_ret) {
+	call_with_validated_variant_args_static(base, method, p_args);
+}
+
+#define FUNCTION_CLASS(m_class, m_method_name, m_method_ptr)                                                                                                      \
+	struct Method_##m_class##_##m_method_name {                                                                                                                   \
+		static void call(Variant *base, const Variant **p_args, int p_argcount, Variant &r_ret, const Vector<Variant> &p_defvals, Callable::CallError &r_error) { \
+			vc_function_call(m_method_ptr, base, p_args, p_argcount, r_ret, p_defvals, r_error);                                                                  \
+		}                                                                                                                                                         \
+		static void validated_call(Variant *base, const Variant **p_args, int p_argcount, Variant *r_ret) {                                                       \
+			vc_change_return_type(m_method_ptr, r_ret);                                                                                                           \
+			vc_validated_call(m_method_ptr, base, p_args, r_ret);                                                                                                 \
+		}                                                                                                                                                         \
+		static void ptrcall(void *p_base, const void **p_args, void *r_ret, int p_argcount) {                                                                     \
+			vc_ptrcall(m_method_ptr, p_base, p_args, r_ret);                                                                                                      \
+		}                                                                                                                                                         \
+		static int get_argument_count() {                                                                                                                         \
+			return vc_get_argument_count(m_method_ptr);                                                                                                           \
+		}                                                                                                                                                         \
+		static Variant::Type get_argument_type(int p_arg) {                                                                                                       \
+			return vc_get_argument_type(m_method_ptr, p_arg);                                                                                                     \
+		}                                                                                                                                                         \
+		static Variant::Type get_return_type() {                                                                                                                  \
+			return vc_get_return_type(m_method_ptr);                                                                                                              \
+		}                                                                                                                                                         \
+		static bool has_return_type() {                                                                                                                           \
+			return vc_has_return_type(m_method_ptr);                                                                                                              \
+		}                                                                                                                                                         \
+		static bool is_const() {                                                                                                                                  \
+			return vc_is_const(m_method_ptr);                                                                                                                     \
+		}                                                                                                                                                         \
+		static bool is_vararg() {                                                                                                                                 \
+			return false;                                                                                                                                         \
+		}                                                                                                                                                         \
+		static Variant::Type get_base_type() {                                                                                                                    \
+			return GetTypeInfo<m_class>::VARIANT_TYPE;                                                                                                            \
+		}                                                                                                                                                         \
+		static StringName get_name() {                                                                                                                            \
+			return #m_method_name;                                                                                                                                \
+		}                                                                                                                                                         \
 	};
 
 #define VARARG_CLASS(m_class, m_method_name, m_method_ptr, m_has_return, m_return_type)                                                                           \
@@ -490,6 +548,16 @@ struct _VariantCall {
 		return s;
 	}
 
+	static AABB func_PackedVector3Array_get_aabb(PackedVector3Array *p_instance) {
+		return BatchMath::get_aabb(p_instance->ptr(), p_instance->size());
+	}
+
+	template <class T>
+	static void func_Packed_sort(Vector<T> *p_instance) {
+		ParallelSortArray<T> sorter;
+		sorter.sort(p_instance->ptrw(), p_instance->size());
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->call(p_args, p_argcount, r_ret, r_error);
@@ -1322,7 +1390,7 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedByteArray, has, sarray("value"), varray());
 	bind_method(PackedByteArray, invert, sarray(), varray());
 	bind_method(PackedByteArray, subarray, sarray("from", "to"), varray());
-	bind_method(PackedByteArray, sort, sarray(), varray());
+	bind_function(PackedByteArray, sort, _VariantCall::func_Packed_sort<uint8_t>, sarray(), varray());
 	bind_method(PackedByteArray, duplicate, sarray(), varray());
 
 	bind_function(PackedByteArray, get_string_from_ascii, _VariantCall::func_PackedByteArray_get_string_from_ascii, sarray(), varray());
@@ -1349,7 +1417,7 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedInt32Array, invert, sarray(), varray());
 	bind_method(PackedInt32Array, subarray, sarray("from", "to"), varray());
 	bind_method(PackedInt32Array, to_byte_array, sarray(), varray());
-	bind_method(PackedInt32Array, sort, sarray(), varray());
+	bind_function(PackedInt32Array, sort, _VariantCall::func_Packed_sort<int32_t>, sarray(), varray());
 	bind_method(PackedInt32Array, duplicate, sarray(), varray());
 
 	/* Int64 Array */
@@ -1367,7 +1435,7 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedInt64Array, invert, sarray(), varray());
 	bind_method(PackedInt64Array, subarray, sarray("from", "to"), varray());
 	bind_method(PackedInt64Array, to_byte_array, sarray(), varray());
-	bind_method(PackedInt64Array, sort, sarray(), varray());
+	bind_function(PackedInt64Array, sort, _VariantCall::func_Packed_sort<int64_t>, sarray(), varray());
 	bind_method(PackedInt64Array, duplicate, sarray(), varray());
 
 	/* Float32 Array */
@@ -1385,7 +1453,7 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, invert, sarray(), varray());
 	bind_method(PackedFloat32Array, subarray, sarray("from", "to"), varray());
 	bind_method(PackedFloat32Array, to_byte_array, sarray(), varray());
-	bind_method(PackedFloat32Array, sort, sarray(), varray());
+	bind_function(PackedFloat32Array, sort, _VariantCall::func_Packed_sort<float>, sarray(), varray());
 	bind_method(PackedFloat32Array, duplicate, sarray(), varray());
 
 	/* Float64 Array */
@@ -1403,7 +1471,7 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat64Array, invert, sarray(), varray());
 	bind_method(PackedFloat64Array, subarray, sarray("from", "to"), varray());
 	bind_method(PackedFloat64Array, to_byte_array, sarray(), varray());
-	bind_method(PackedFloat64Array, sort, sarray(), varray());
+	bind_function(PackedFloat64Array, sort, _VariantCall::func_Packed_sort<double>, sarray(), varray());
 	bind_method(PackedFloat64Array, duplicate, sarray(), varray());
 
 	/* String Array */
@@ -1421,7 +1489,7 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedStringArray, invert, sarray(), varray());
 	bind_method(PackedStringArray, subarray, sarray("from", "to"), varray());
 	bind_method(PackedStringArray, to_byte_array, sarray(), varray());
-	bind_method(PackedStringArray, sort, sarray(), varray());
+	bind_function(PackedStringArray, sort, _VariantCall::func_Packed_sort<String>, sarray(), varray());
 	bind_method(PackedStringArray, duplicate, sarray(), varray());
 
 	/* Vector2 Array */
@@ -1439,7 +1507,7 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector2Array, invert, sarray(), varray());
 	bind_method(PackedVector2Array, subarray, sarray("from", "to"), varray());
 	bind_method(PackedVector2Array, to_byte_array, sarray(), varray());
-	bind_method(PackedVector2Array, sort, sarray(), varray());
+	bind_function(PackedVector2Array, sort, _VariantCall::func_Packed_sort<Vector2>, sarray(), varray());
 	bind_method(PackedVector2Array, duplicate, sarray(), varray());
 
 	/* Vector3 Array */
@@ -1457,8 +1525,9 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector3Array, invert, sarray(), varray());
 	bind_method(PackedVector3Array, subarray, sarray("from", "to"), varray());
 	bind_method(PackedVector3Array, to_byte_array, sarray(), varray());
-	bind_method(PackedVector3Array, sort, sarray(), varray());
+	bind_function(PackedVector3Array, sort, _VariantCall::func_Packed_sort<Vector3>, sarray(), varray());
 	bind_method(PackedVector3Array, duplicate, sarray(), varray());
+	bind_function(PackedVector3Array, get_aabb, _VariantCall::func_PackedVector3Array_get_aabb, sarray(), varray());
 
 	/* Color Array */
 
@@ -1475,7 +1544,7 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedColorArray, invert, sarray(), varray());
 	bind_method(PackedColorArray, subarray, sarray("from", "to"), varray());
 	bind_method(PackedColorArray, to_byte_array, sarray(), varray());
-	bind_method(PackedColorArray, sort, sarray(), varray());
+	bind_function(PackedColorArray, sort, _VariantCall::func_Packed_sort<Color>, sarray(), varray());
 	bind_method(PackedColorArray, duplicate, sarray(), varray());
 
 	/* Register constants */
@@ -34,40 +34,56 @@
 #include "core/io/resource_loader.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/templates/local_vector.h"
 
-char32_t VariantParser::StreamFile::get_char() {
-	return f->get_8();
+char32_t VariantParser::Stream::_refill() {
+	if (eof) {
+		return 0;
+	}
+
+	readahead_pointer = 0;
+	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
+	if (readahead_filled == 0) {
+		// Like files, EOF is reported once a read past the end was attempted.
+		eof = true;
+		return 0;
+	}
+
+	return readahead_buffer[readahead_pointer++];
 }
 
-bool VariantParser::StreamFile::is_utf8() const {
-	return true;
+bool VariantParser::Stream::is_eof() const {
+	return eof;
 }
 
-bool VariantParser::StreamFile::is_eof() const {
-	return f->eof_reached();
+uint32_t VariantParser::StreamFile::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	// Read the bytes into the end of the buffer, then widen them from the front.
+	uint8_t *bytes = (uint8_t *)(p_buffer + p_num_chars) - p_num_chars;
+	uint64_t read = f->get_buffer(bytes, p_num_chars);
+	for (uint64_t i = 0; i < read; i++) {
+		p_buffer[i] = bytes[i];
+	}
+	return read;
 }
 
-char32_t VariantParser::StreamString::get_char() {
-	if (pos > s.length()) {
-		return 0;
-	} else if (pos == s.length()) {
-		// You need to try to read again when you have reached the end for EOF to be reported,
-		// so this works the same as files (like StreamFile does)
-		pos++;
-		return 0;
-	} else {
-		return s[pos++];
+bool VariantParser::StreamFile::is_utf8() const {
+	return true;
+}
+
+uint32_t VariantParser::StreamString::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	uint32_t available = MAX(s.length() - pos, 0);
+	uint32_t read = MIN(available, p_num_chars);
+	if (read) {
+		memcpy(p_buffer, s.ptr() + pos, read * sizeof(char32_t));
+		pos += read;
 	}
+	return read;
 }
 
 bool VariantParser::StreamString::is_utf8() const {
 	return false;
 }
 
-bool VariantParser::StreamString::is_eof() const {
-	return pos > s.length();
-}
-
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 const char *VariantParser::tk_name[TK_MAX] = {
@@ -440,6 +456,26 @@ Error VariantParser::_parse_enginecfg(Stream *p_stream, Vector<String> &strings,
 	}
 }
 
+static char32_t _get_non_space_char(VariantParser::Stream *p_stream, int &line) {
+	while (true) {
+		char32_t c;
+		if (p_stream->saved) {
+			c = p_stream->saved;
+			p_stream->saved = 0;
+		} else {
+			c = p_stream->get_char();
+		}
+
+		if (c == '\n') {
+			line++;
+		} else if (c > 32 || c == 0) {
+			return c;
+		}
+	}
+}
+
+// Numbers are read straight from the stream, instead of going through tokens, as this parses
+// every Packed*Array of numbers.
 template <class T>
 Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
 	Token token;
@@ -449,32 +485,57 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	LocalVector<T> values;
+	char number[64];
+
 	bool first = true;
 	while (true) {
+		char32_t c = _get_non_space_char(p_stream, line);
 		if (!first) {
-			get_token(p_stream, token, line, r_err_str);
-			if (token.type == TK_COMMA) {
-				//do none
-			} else if (token.type == TK_PARENTHESIS_CLOSE) {
+			if (c == ',') {
+				c = _get_non_space_char(p_stream, line);
+			} else if (c == ')') {
 				break;
 			} else {
 				r_err_str = "Expected ',' or ')' in constructor";
 				return ERR_PARSE_ERROR;
 			}
 		}
-		get_token(p_stream, token, line, r_err_str);
 
-		if (first && token.type == TK_PARENTHESIS_CLOSE) {
+		if (first && c == ')') {
 			break;
-		} else if (token.type != TK_NUMBER) {
+		} else if (c != '-' && (c < '0' || c > '9')) {
 			r_err_str = "Expected float in constructor";
 			return ERR_PARSE_ERROR;
 		}
 
-		r_construct.push_back(token.value);
+		uint32_t length = 0;
+		bool is_float = false;
+		while (c == '-' || c == '+' || c == '.' || c == 'e' || (c >= '0' && c <= '9')) {
+			if (length == sizeof(number) - 1) {
+				r_err_str = "Number too long in constructor";
+				return ERR_PARSE_ERROR;
+			}
+			is_float = is_float || c == '.' || c == 'e';
+			number[length++] = c;
+			c = p_stream->get_char();
+		}
+		number[length] = 0;
+		p_stream->saved = c;
+
+		if (is_float) {
+			values.push_back(String::to_float(number));
+		} else {
+			values.push_back(String::to_int(number, length));
+		}
 		first = false;
 	}
 
+	r_construct.resize(values.size());
+	if (values.size()) {
+		memcpy(r_construct.ptrw(), values.ptr(), values.size() * sizeof(T));
+	}
+
 	return OK;
 }
 
@@ -876,17 +937,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
 			Vector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
@@ -894,17 +945,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -912,17 +953,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -930,17 +961,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -948,17 +969,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
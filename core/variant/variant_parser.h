@@ -37,34 +37,63 @@
 
 class VariantParser {
 public:
+	// Characters are read ahead in blocks, so getting one is usually just a buffer read instead of
+	// a virtual call (and a file read). Streams whose source is also accessed directly must disable
+	// readahead, as the source position goes past what was parsed.
 	struct Stream {
-		virtual char32_t get_char() = 0;
-		virtual bool is_utf8() const = 0;
-		virtual bool is_eof() const = 0;
+	private:
+		enum {
+			READAHEAD_SIZE = 2048,
+		};
+
+		char32_t readahead_buffer[READAHEAD_SIZE];
+		uint32_t readahead_pointer = 0;
+		uint32_t readahead_filled = 0;
+		bool eof = false;
+
+		char32_t _refill();
+
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
 
+	public:
+		bool readahead_enabled = true;
 		char32_t saved = 0;
 
+		_FORCE_INLINE_ char32_t get_char() {
+			if (likely(readahead_pointer < readahead_filled)) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _refill();
+		}
+		virtual bool is_utf8() const = 0;
+		bool is_eof() const;
+
 		Stream() {}
 		virtual ~Stream() {}
 	};
 
 	struct StreamFile : public Stream {
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars);
+
+	public:
 		FileAccess *f = nullptr;
 
-		virtual char32_t get_char();
 		virtual bool is_utf8() const;
-		virtual bool is_eof() const;
 
 		StreamFile() {}
 	};
 
 	struct StreamString : public Stream {
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars);
+
+	public:
 		String s;
 		int pos = 0;
 
-		virtual char32_t get_char();
 		virtual bool is_utf8() const;
-		virtual bool is_eof() const;
 
 		StreamString() {}
 	};
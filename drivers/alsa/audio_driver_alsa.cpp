@@ -153,7 +153,7 @@ Error AudioDriverALSA::init() {
 
 	Error err = init_device();
 	if (err == OK) {
-		thread.start(AudioDriverALSA::thread_func, this);
+		thread.start(AudioDriverALSA::thread_func, this, Thread::get_role_settings(Thread::ROLE_AUDIO));
 	}
 
 	return err;
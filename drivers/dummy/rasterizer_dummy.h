@@ -73,6 +73,8 @@ public:
 	void directional_shadow_atlas_set_size(int p_size, bool p_16_bits = false) override {}
 	int get_directional_light_shadow_size(RID p_light_intance) override { return 0; }
 	void set_directional_shadow_count(int p_count) override {}
+	uint64_t get_directional_shadow_version() const override { return 0; }
+	uint64_t get_shadow_memory_usage() const override { return 0; }
 
 	/* SDFGI UPDATE */
 
@@ -549,6 +551,7 @@ public:
 	void particles_set_fractional_delta(RID p_particles, bool p_enable) override {}
 	void particles_set_subemitter(RID p_particles, RID p_subemitter_particles) override {}
 	void particles_set_view_axis(RID p_particles, const Vector3 &p_axis) override {}
+	void particles_set_view_screen_size(RID p_particles, float p_size) override {}
 	void particles_set_collision_base_size(RID p_particles, float p_size) override {}
 	void particles_restart(RID p_particles) override {}
 
@@ -571,6 +574,7 @@ public:
 	void particles_remove_collision(RID p_particles, RID p_instance) override {}
 
 	void update_particles() override {}
+	void update_particles_sort() override {}
 
 	/* PARTICLES COLLISION */
 
@@ -647,7 +651,7 @@ public:
 	void render_info_end_capture() override {}
 	int get_captured_render_info(RS::RenderInfo p_info) override { return 0; }
 
-	int get_render_info(RS::RenderInfo p_info) override { return 0; }
+	uint64_t get_render_info(RS::RenderInfo p_info) override { return 0; }
 	String get_video_adapter_name() const override { return String(); }
 	String get_video_adapter_vendor() const override { return String(); }
 
@@ -687,6 +691,7 @@ public:
 
 	void draw_window_margins(int *p_margins, RID *p_margin_textures) override {}
 
+	int get_render_info(RS::RenderInfo p_info) const override { return 0; }
 	bool free(RID p_rid) override { return true; }
 	void update() override {}
 
@@ -36,7 +36,7 @@
 class ImageLoaderPNG : public ImageFormatLoader {
 private:
 	static Vector<uint8_t> lossless_pack_png(const Ref<Image> &p_image);
-	static Ref<Image> lossless_unpack_png(const Vector<uint8_t> &p_data);
+	static Ref<Image> lossless_unpack_png(const uint8_t *p_data, int p_size);
 	static Ref<Image> load_mem_png(const uint8_t *p_png, int p_size);
 
 public:
@@ -287,7 +287,7 @@ Error AudioDriverPulseAudio::init() {
 
 	Error err = init_device();
 	if (err == OK) {
-		thread.start(AudioDriverPulseAudio::thread_func, this);
+		thread.start(AudioDriverPulseAudio::thread_func, this, Thread::get_role_settings(Thread::ROLE_AUDIO));
 	}
 
 	return OK;
@@ -41,6 +41,7 @@
 #include <errno.h>
 
 #if defined(UNIX_ENABLED)
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -62,6 +63,13 @@
 #include <sys/ioctl.h>
 #endif
 
+// A FileAccess is never shared between threads, so the stream lock taken by every stdio call is pure overhead.
+#if defined(__GLIBC__)
+#define FREAD_UNLOCKED fread_unlocked
+#else
+#define FREAD_UNLOCKED fread
+#endif
+
 void FileAccessUnix::check_errors() const {
 	ERR_FAIL_COND_MSG(!f, "File must be opened before use.");
 
@@ -143,6 +151,10 @@ Error FileAccessUnix::_open(const String &p_path, int p_mode_flags) {
 #endif
 	}
 
+	if (p_mode_flags == READ && get_read_buffer_size() > 0) {
+		setvbuf(f, nullptr, _IOFBF, get_read_buffer_size());
+	}
+
 	last_error = OK;
 	flags = p_mode_flags;
 	return OK;
@@ -153,6 +165,14 @@ void FileAccessUnix::close() {
 		return;
 	}
 
+#if defined(UNIX_ENABLED)
+	if (mapped) {
+		munmap(mapped, mapped_size);
+		mapped = nullptr;
+		mapped_size = 0;
+	}
+#endif
+
 	fclose(f);
 	f = nullptr;
 
@@ -229,23 +249,140 @@ bool FileAccessUnix::eof_reached() const {
 	return last_error == ERR_FILE_EOF;
 }
 
+void FileAccessUnix::_read(void *p_dst, size_t p_length) const {
+	if (FREAD_UNLOCKED(p_dst, 1, p_length, f) < p_length) {
+		check_errors();
+	}
+}
+
 uint8_t FileAccessUnix::get_8() const {
 	ERR_FAIL_COND_V_MSG(!f, 0, "File must be opened before use.");
+#if defined(UNIX_ENABLED)
+	int b = getc_unlocked(f);
+	if (b == EOF) {
+		check_errors();
+		b = '\0';
+	}
+	return b;
+#else
 	uint8_t b;
 	if (fread(&b, 1, 1, f) == 0) {
 		check_errors();
 		b = '\0';
 	}
 	return b;
+#endif
+}
+
+// The multi-byte getters read in a single call, instead of the per byte virtual calls of the base class.
+
+uint16_t FileAccessUnix::get_16() const {
+	ERR_FAIL_COND_V_MSG(!f, 0, "File must be opened before use.");
+	uint16_t res = 0;
+	_read(&res, sizeof(res));
+#ifdef BIG_ENDIAN_ENABLED
+	if (!endian_swap) {
+#else
+	if (endian_swap) {
+#endif
+		res = BSWAP16(res);
+	}
+	return res;
+}
+
+uint32_t FileAccessUnix::get_32() const {
+	ERR_FAIL_COND_V_MSG(!f, 0, "File must be opened before use.");
+	uint32_t res = 0;
+	_read(&res, sizeof(res));
+#ifdef BIG_ENDIAN_ENABLED
+	if (!endian_swap) {
+#else
+	if (endian_swap) {
+#endif
+		res = BSWAP32(res);
+	}
+	return res;
+}
+
+uint64_t FileAccessUnix::get_64() const {
+	ERR_FAIL_COND_V_MSG(!f, 0, "File must be opened before use.");
+	uint64_t res = 0;
+	_read(&res, sizeof(res));
+#ifdef BIG_ENDIAN_ENABLED
+	if (!endian_swap) {
+#else
+	if (endian_swap) {
+#endif
+		res = BSWAP64(res);
+	}
+	return res;
 }
 
 int FileAccessUnix::get_buffer(uint8_t *p_dst, int p_length) const {
 	ERR_FAIL_COND_V_MSG(!f, -1, "File must be opened before use.");
-	int read = fread(p_dst, 1, p_length, f);
+	int read = FREAD_UNLOCKED(p_dst, 1, p_length, f);
 	check_errors();
 	return read;
 };
 
+const uint8_t *FileAccessUnix::map_read_only() {
+	ERR_FAIL_COND_V_MSG(!f, nullptr, "File must be opened before use.");
+
+#if defined(UNIX_ENABLED)
+	if (mapped) {
+		return (const uint8_t *)mapped;
+	}
+	if (flags != READ) {
+		return nullptr;
+	}
+
+	size_t len = get_len();
+	if (len == 0) {
+		return nullptr;
+	}
+
+	void *ptr = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (ptr == MAP_FAILED) {
+		// Not fatal, e.g. no address space left on 32-bit platforms. Callers fall back to reading.
+		return nullptr;
+	}
+	mapped = ptr;
+	mapped_size = len;
+	return (const uint8_t *)mapped;
+#else
+	return nullptr;
+#endif
+}
+
+void FileAccessUnix::set_access_pattern(AccessPattern p_pattern) {
+	ERR_FAIL_COND_MSG(!f, "File must be opened before use.");
+
+#if defined(UNIX_ENABLED) && defined(POSIX_FADV_SEQUENTIAL)
+	int advice = POSIX_FADV_NORMAL;
+	switch (p_pattern) {
+		case ACCESS_PATTERN_NORMAL: {
+			advice = POSIX_FADV_NORMAL;
+		} break;
+		case ACCESS_PATTERN_SEQUENTIAL: {
+			advice = POSIX_FADV_SEQUENTIAL; // Larger read-ahead window.
+		} break;
+		case ACCESS_PATTERN_RANDOM: {
+			advice = POSIX_FADV_RANDOM; // No read-ahead.
+		} break;
+	}
+	posix_fadvise(fileno(f), 0, 0, advice);
+#endif
+}
+
+void FileAccessUnix::prefetch(uint64_t p_position, uint64_t p_length) {
+	ERR_FAIL_COND_MSG(!f, "File must be opened before use.");
+
+#if defined(UNIX_ENABLED) && defined(POSIX_FADV_WILLNEED)
+	// Starts reading into the page cache and returns right away.
+	posix_fadvise(fileno(f), p_position, p_length, POSIX_FADV_WILLNEED);
+#endif
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -44,7 +44,10 @@ class FileAccessUnix : public FileAccess {
 	FILE *f = nullptr;
 	int flags = 0;
 	void check_errors() const;
+	void _read(void *p_dst, size_t p_length) const;
 	mutable Error last_error = OK;
+	void *mapped = nullptr;
+	size_t mapped_size = 0;
 	String save_path;
 	String path;
 	String path_src;
@@ -69,7 +72,13 @@ public:
 	virtual bool eof_reached() const; ///< reading passed EOF
 
 	virtual uint8_t get_8() const; ///< get a byte
+	virtual uint16_t get_16() const; ///< get 16 bits uint
+	virtual uint32_t get_32() const; ///< get 32 bits uint
+	virtual uint64_t get_64() const; ///< get 64 bits uint
 	virtual int get_buffer(uint8_t *p_dst, int p_length) const;
+	virtual const uint8_t *map_read_only();
+	virtual void set_access_pattern(AccessPattern p_pattern);
+	virtual void prefetch(uint64_t p_position, uint64_t p_length);
 
 	virtual Error get_error() const; ///< get last error
 
@@ -157,6 +157,7 @@ void NetSocketPosix::make_default() {
 	}
 #endif
 	_create = _create_func;
+	NetSocketPollerPosix::make_default();
 }
 
 void NetSocketPosix::cleanup() {
@@ -744,4 +745,228 @@ Error NetSocketPosix::join_multicast_group(const IP_Address &p_multi_address, St
 Error NetSocketPosix::leave_multicast_group(const IP_Address &p_multi_address, String p_if_name) {
 	return _change_multicast_group(p_multi_address, p_if_name, false);
 }
+
+NetSocketPoller *NetSocketPollerPosix::_create_func() {
+	return memnew(NetSocketPollerPosix);
+}
+
+void NetSocketPollerPosix::make_default() {
+	_create = _create_func;
+}
+
+Error NetSocketPollerPosix::add(const Ref<NetSocket> &p_socket, NetSocket::PollType p_type, uint64_t p_id) {
+	ERR_FAIL_COND_V(p_socket.is_null() || !p_socket->is_open(), ERR_INVALID_PARAMETER);
+
+	SOCKET_TYPE fd = static_cast<const NetSocketPosix *>(p_socket.ptr())->_sock;
+	Map<uint64_t, Entry>::Element *E = _entries.find(p_id);
+	if (E && E->get().fd != fd) {
+		// Same id, different socket.
+		remove(p_id);
+		E = nullptr;
+	}
+
+#if defined(NET_SOCKET_POLLER_EPOLL)
+	ERR_FAIL_COND_V(_queue == -1, ERR_UNCONFIGURED);
+	struct epoll_event ev;
+	ev.events = 0;
+	if (p_type != NetSocket::POLL_TYPE_OUT) {
+		ev.events |= EPOLLIN | EPOLLRDHUP;
+	}
+	if (p_type != NetSocket::POLL_TYPE_IN) {
+		ev.events |= EPOLLOUT;
+	}
+	ev.data.u64 = p_id;
+	if (epoll_ctl(_queue, E ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &ev) != 0) {
+		ERR_FAIL_V_MSG(FAILED, "Unable to register socket for polling.");
+	}
+#elif defined(NET_SOCKET_POLLER_KQUEUE)
+	ERR_FAIL_COND_V(_queue == -1, ERR_UNCONFIGURED);
+	bool had_read = E && E->get().type != NetSocket::POLL_TYPE_OUT;
+	bool had_write = E && E->get().type != NetSocket::POLL_TYPE_IN;
+	bool want_read = p_type != NetSocket::POLL_TYPE_OUT;
+	bool want_write = p_type != NetSocket::POLL_TYPE_IN;
+	struct kevent changes[2];
+	int count = 0;
+	if (want_read != had_read) {
+		EV_SET(&changes[count++], fd, EVFILT_READ, want_read ? EV_ADD : EV_DELETE, 0, 0, 0);
+	}
+	if (want_write != had_write) {
+		EV_SET(&changes[count++], fd, EVFILT_WRITE, want_write ? EV_ADD : EV_DELETE, 0, 0, 0);
+	}
+	if (count && kevent(_queue, changes, count, nullptr, 0, nullptr) == -1) {
+		ERR_FAIL_V_MSG(FAILED, "Unable to register socket for polling.");
+	}
+	_fd_ids[fd] = p_id;
+#endif
+
+	Entry &entry = E ? E->get() : _entries[p_id];
+	entry.socket = p_socket;
+	entry.fd = fd;
+	entry.type = p_type;
+	return OK;
+}
+
+void NetSocketPollerPosix::remove(uint64_t p_id) {
+	Map<uint64_t, Entry>::Element *E = _entries.find(p_id);
+	if (!E) {
+		return;
+	}
+
+#if defined(NET_SOCKET_POLLER_EPOLL) || defined(NET_SOCKET_POLLER_KQUEUE)
+	const Entry &entry = E->get();
+	// Closing a socket already unregisters it, and its descriptor might have been reused since.
+	bool registered = entry.socket->is_open() && static_cast<const NetSocketPosix *>(entry.socket.ptr())->_sock == entry.fd;
+#if defined(NET_SOCKET_POLLER_EPOLL)
+	if (registered) {
+		struct epoll_event ev; // Ignored, but required by old kernels.
+		epoll_ctl(_queue, EPOLL_CTL_DEL, entry.fd, &ev);
+	}
+#else
+	if (registered) {
+		struct kevent changes[2];
+		int count = 0;
+		if (entry.type != NetSocket::POLL_TYPE_OUT) {
+			EV_SET(&changes[count++], entry.fd, EVFILT_READ, EV_DELETE, 0, 0, 0);
+		}
+		if (entry.type != NetSocket::POLL_TYPE_IN) {
+			EV_SET(&changes[count++], entry.fd, EVFILT_WRITE, EV_DELETE, 0, 0, 0);
+		}
+		kevent(_queue, changes, count, nullptr, 0, nullptr);
+	}
+	const uint64_t *id = _fd_ids.getptr(entry.fd);
+	if (id && *id == p_id) {
+		_fd_ids.erase(entry.fd);
+	}
+#endif
+#endif
+
+	_entries.erase(E);
+}
+
+bool NetSocketPollerPosix::has(uint64_t p_id) const {
+	return _entries.has(p_id);
+}
+
+int NetSocketPollerPosix::get_count() const {
+	return _entries.size();
+}
+
+int NetSocketPollerPosix::wait(Event *r_events, int p_max_events, int p_timeout) {
+	ERR_FAIL_COND_V(!r_events || p_max_events <= 0, -1);
+
+#if defined(NET_SOCKET_POLLER_EPOLL)
+	ERR_FAIL_COND_V(_queue == -1, -1);
+	if (_queue_events.size() < (uint32_t)p_max_events) {
+		_queue_events.resize(p_max_events);
+	}
+	int ret = epoll_wait(_queue, _queue_events.ptr(), p_max_events, p_timeout);
+	if (ret < 0) {
+		return errno == EINTR ? 0 : -1;
+	}
+	for (int i = 0; i < ret; i++) {
+		const struct epoll_event &ev = _queue_events[i];
+		Event &out = r_events[i];
+		out.id = ev.data.u64;
+		out.error = ev.events & (EPOLLERR | EPOLLHUP);
+		out.readable = out.error || (ev.events & (EPOLLIN | EPOLLRDHUP));
+		out.writable = ev.events & EPOLLOUT;
+	}
+	return ret;
+
+#elif defined(NET_SOCKET_POLLER_KQUEUE)
+	ERR_FAIL_COND_V(_queue == -1, -1);
+	if (_queue_events.size() < (uint32_t)p_max_events) {
+		_queue_events.resize(p_max_events);
+	}
+	struct timespec timeout = { p_timeout / 1000, (p_timeout % 1000) * 1000000 };
+	int ret = kevent(_queue, nullptr, 0, _queue_events.ptr(), p_max_events, p_timeout < 0 ? nullptr : &timeout);
+	if (ret < 0) {
+		return errno == EINTR ? 0 : -1;
+	}
+	int count = 0;
+	for (int i = 0; i < ret; i++) {
+		const struct kevent &ev = _queue_events[i];
+		const uint64_t *id = _fd_ids.getptr((int)ev.ident);
+		if (!id) {
+			continue;
+		}
+		// Read and write readiness are reported separately, the caller will see the same id twice.
+		Event &out = r_events[count++];
+		out.id = *id;
+		out.error = ev.flags & (EV_EOF | EV_ERROR);
+		out.readable = out.error || ev.filter == EVFILT_READ;
+		out.writable = ev.filter == EVFILT_WRITE;
+	}
+	return count;
+
+#else
+	// No readiness queue, build the descriptor list for a single poll call instead.
+	_fds.clear();
+	_fd_ids.clear();
+	for (Map<uint64_t, Entry>::Element *E = _entries.front(); E; E = E->next()) {
+		const Entry &entry = E->get();
+		if (!entry.socket->is_open()) {
+			continue;
+		}
+		POLLFD_TYPE pfd;
+		pfd.fd = entry.fd;
+		pfd.events = 0;
+		pfd.revents = 0;
+		if (entry.type != NetSocket::POLL_TYPE_OUT) {
+			pfd.events |= POLLIN;
+		}
+		if (entry.type != NetSocket::POLL_TYPE_IN) {
+			pfd.events |= POLLOUT;
+		}
+		_fds.push_back(pfd);
+		_fd_ids.push_back(E->key());
+	}
+	if (_fds.is_empty()) {
+		return 0;
+	}
+#if defined(WINDOWS_ENABLED)
+	int ret = WSAPoll(_fds.ptr(), _fds.size(), p_timeout);
+	if (ret == SOCKET_ERROR) {
+		return -1;
+	}
+#else
+	int ret = ::poll(_fds.ptr(), _fds.size(), p_timeout);
+	if (ret < 0) {
+		return errno == EINTR ? 0 : -1;
+	}
+#endif
+	int count = 0;
+	for (uint32_t i = 0; i < _fds.size() && count < p_max_events && ret > 0; i++) {
+		const POLLFD_TYPE &pfd = _fds[i];
+		if (!pfd.revents) {
+			continue;
+		}
+		ret--;
+		Event &out = r_events[count++];
+		out.id = _fd_ids[i];
+		out.error = pfd.revents & (POLLERR | POLLHUP | POLLNVAL);
+		out.readable = out.error || (pfd.revents & POLLIN);
+		out.writable = pfd.revents & POLLOUT;
+	}
+	return count;
+#endif
+}
+
+NetSocketPollerPosix::NetSocketPollerPosix() {
+#if defined(NET_SOCKET_POLLER_EPOLL)
+	_queue = epoll_create1(EPOLL_CLOEXEC);
+	ERR_FAIL_COND_MSG(_queue == -1, "Unable to create epoll instance.");
+#elif defined(NET_SOCKET_POLLER_KQUEUE)
+	_queue = kqueue();
+	ERR_FAIL_COND_MSG(_queue == -1, "Unable to create kqueue instance.");
+#endif
+}
+
+NetSocketPollerPosix::~NetSocketPollerPosix() {
+#if defined(NET_SOCKET_POLLER_EPOLL) || defined(NET_SOCKET_POLLER_KQUEUE)
+	if (_queue != -1) {
+		::close(_queue);
+	}
+#endif
+}
 #endif
@@ -32,6 +32,9 @@
 #define NET_SOCKET_UNIX_H
 
 #include "core/io/net_socket.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/map.h"
 
 #if defined(WINDOWS_ENABLED)
 #include <winsock2.h>
@@ -44,7 +47,22 @@
 
 #endif
 
+#if defined(__linux__) && !defined(JAVASCRIPT_ENABLED)
+#define NET_SOCKET_POLLER_EPOLL
+#include <sys/epoll.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__DragonFly__)
+#define NET_SOCKET_POLLER_KQUEUE
+#include <sys/event.h>
+#elif defined(WINDOWS_ENABLED)
+#define POLLFD_TYPE WSAPOLLFD
+#else
+#include <poll.h>
+#define POLLFD_TYPE struct pollfd
+#endif
+
 class NetSocketPosix : public NetSocket {
+	friend class NetSocketPollerPosix;
+
 private:
 	SOCKET_TYPE _sock; // NOLINT - the default value is defined in the .cpp
 	IP::Type _ip_type = IP::TYPE_NONE;
@@ -101,4 +119,41 @@ public:
 	~NetSocketPosix();
 };
 
+class NetSocketPollerPosix : public NetSocketPoller {
+	struct Entry {
+		Ref<NetSocket> socket;
+		SOCKET_TYPE fd;
+		NetSocket::PollType type = NetSocket::POLL_TYPE_IN;
+	};
+
+	Map<uint64_t, Entry> _entries;
+
+#if defined(NET_SOCKET_POLLER_EPOLL)
+	int _queue = -1;
+	LocalVector<struct epoll_event> _queue_events;
+#elif defined(NET_SOCKET_POLLER_KQUEUE)
+	int _queue = -1;
+	LocalVector<struct kevent> _queue_events;
+	HashMap<int, uint64_t> _fd_ids; // kevent user data is not wide enough for ids on every platform.
+#else
+	LocalVector<POLLFD_TYPE> _fds;
+	LocalVector<uint64_t> _fd_ids;
+#endif
+
+protected:
+	static NetSocketPoller *_create_func();
+
+public:
+	static void make_default();
+
+	virtual Error add(const Ref<NetSocket> &p_socket, NetSocket::PollType p_type, uint64_t p_id);
+	virtual void remove(uint64_t p_id);
+	virtual bool has(uint64_t p_id) const;
+	virtual int get_count() const;
+	virtual int wait(Event *r_events, int p_max_events, int p_timeout);
+
+	NetSocketPollerPosix();
+	~NetSocketPollerPosix();
+};
+
 #endif
@@ -35,6 +35,16 @@
 #include "core/os/thread.h"
 #include "core/string/ustring.h"
 
+#if defined(__linux__)
+#include <sched.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <pthread/qos.h>
+#endif
+
 static Error set_name(const String &p_name) {
 #ifdef PTHREAD_NO_RENAME
 	return ERR_UNAVAILABLE;
@@ -65,8 +75,97 @@ static Error set_name(const String &p_name) {
 #endif // PTHREAD_NO_RENAME
 }
 
+static void set_priority(Thread::Priority p_priority) {
+#if defined(__linux__)
+	// Nice values are per thread on Linux. Raising the priority needs CAP_SYS_NICE on desktops, so
+	// it silently stays normal there. Android lets apps go up to the audio priority.
+	int nice_value = 0;
+	if (p_priority == Thread::PRIORITY_LOW) {
+		nice_value = 10;
+	} else if (p_priority == Thread::PRIORITY_HIGH) {
+#ifdef ANDROID_ENABLED
+		nice_value = -16; // THREAD_PRIORITY_AUDIO.
+#else
+		nice_value = -10;
+#endif
+	}
+	setpriority(PRIO_PROCESS, syscall(SYS_gettid), nice_value);
+#elif defined(__APPLE__)
+	qos_class_t qos_class = QOS_CLASS_DEFAULT;
+	if (p_priority == Thread::PRIORITY_LOW) {
+		qos_class = QOS_CLASS_UTILITY; // Also keeps it on the efficiency cores of Apple Silicon.
+	} else if (p_priority == Thread::PRIORITY_HIGH) {
+		qos_class = QOS_CLASS_USER_INTERACTIVE;
+	}
+	pthread_set_qos_class_self_np(qos_class, 0);
+#endif
+}
+
+#if defined(__linux__)
+struct CoreSets {
+	cpu_set_t performance;
+	cpu_set_t efficiency;
+	bool heterogeneous = false;
+};
+
+// Efficiency cores are the ones with the lowest maximum frequency, performance cores all others.
+static CoreSets find_core_sets() {
+	CoreSets sets;
+	CPU_ZERO(&sets.performance);
+	CPU_ZERO(&sets.efficiency);
+
+	int core_count = MIN(sysconf(_SC_NPROCESSORS_CONF), CPU_SETSIZE);
+	uint64_t lowest = UINT64_MAX;
+	uint64_t highest = 0;
+	uint64_t *max_freqs = (uint64_t *)alloca(sizeof(uint64_t) * core_count);
+	for (int i = 0; i < core_count; i++) {
+		char path[128];
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", i);
+		FILE *f = fopen(path, "r");
+		unsigned long long freq = 0;
+		if (f) {
+			if (fscanf(f, "%llu", &freq) != 1) {
+				freq = 0;
+			}
+			fclose(f);
+		}
+		if (freq == 0) {
+			return sets; // Unknown, treat all cores the same.
+		}
+		max_freqs[i] = freq;
+		lowest = MIN(lowest, (uint64_t)freq);
+		highest = MAX(highest, (uint64_t)freq);
+	}
+
+	if (core_count == 0 || lowest == highest) {
+		return sets;
+	}
+
+	for (int i = 0; i < core_count; i++) {
+		CPU_SET(i, max_freqs[i] == lowest ? &sets.efficiency : &sets.performance);
+	}
+	sets.heterogeneous = true;
+	return sets;
+}
+#endif
+
+static Error set_cores(Thread::Cores p_cores) {
+#if defined(__linux__)
+	static const CoreSets core_sets = find_core_sets();
+	if (!core_sets.heterogeneous) {
+		return ERR_UNAVAILABLE;
+	}
+
+	const cpu_set_t *set = p_cores == Thread::CORES_EFFICIENCY ? &core_sets.efficiency : &core_sets.performance;
+	return sched_setaffinity(0, sizeof(cpu_set_t), set) == 0 ? OK : ERR_UNAVAILABLE;
+#else
+	// Apple platforms don't allow affinity, their scheduler picks the cores from the QoS class.
+	return ERR_UNAVAILABLE;
+#endif
+}
+
 void init_thread_posix() {
-	Thread::_set_platform_funcs(&set_name, nullptr);
+	Thread::_set_platform_funcs(&set_name, &set_priority, nullptr, nullptr, &set_cores);
 }
 
 #endif
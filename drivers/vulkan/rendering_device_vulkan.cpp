@@ -31,6 +31,7 @@
 #include "rendering_device_vulkan.h"
 
 #include "core/config/project_settings.h"
+#include "core/os/dir_access.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
 #include "core/templates/hashfuncs.h"
@@ -1377,9 +1378,15 @@ Error RenderingDeviceVulkan::_buffer_allocate(Buffer *p_buffer, uint32_t p_size,
 	bufferInfo.flags = 0;
 	bufferInfo.size = p_size;
 	bufferInfo.usage = p_usage;
-	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-	bufferInfo.queueFamilyIndexCount = 0;
-	bufferInfo.pQueueFamilyIndices = nullptr;
+	if (shared_queue_family_count > 1) {
+		bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		bufferInfo.queueFamilyIndexCount = shared_queue_family_count;
+		bufferInfo.pQueueFamilyIndices = shared_queue_families;
+	} else {
+		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		bufferInfo.queueFamilyIndexCount = 0;
+		bufferInfo.pQueueFamilyIndices = nullptr;
+	}
 
 	VmaAllocationCreateInfo allocInfo;
 	allocInfo.flags = 0;
@@ -1398,13 +1405,63 @@ Error RenderingDeviceVulkan::_buffer_allocate(Buffer *p_buffer, uint32_t p_size,
 	p_buffer->buffer_info.range = p_size;
 	p_buffer->usage = p_usage;
 
+	buffer_memory += p_size;
+
+	return OK;
+}
+
+Error RenderingDeviceVulkan::_buffer_allocate_persistent_region(Buffer *p_buffer) {
+	VkBufferCreateInfo bufferInfo;
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.pNext = nullptr;
+	bufferInfo.flags = 0;
+	bufferInfo.size = p_buffer->size;
+	bufferInfo.usage = p_buffer->usage;
+	if (shared_queue_family_count > 1) {
+		bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		bufferInfo.queueFamilyIndexCount = shared_queue_family_count;
+		bufferInfo.pQueueFamilyIndices = shared_queue_families;
+	} else {
+		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		bufferInfo.queueFamilyIndexCount = 0;
+		bufferInfo.pQueueFamilyIndices = nullptr;
+	}
+
+	VmaAllocationCreateInfo allocInfo;
+	allocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+	allocInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+	allocInfo.requiredFlags = 0;
+	allocInfo.preferredFlags = 0;
+	allocInfo.memoryTypeBits = 0;
+	allocInfo.pool = nullptr;
+	allocInfo.pUserData = nullptr;
+
+	PersistentBufferRegion region;
+	VmaAllocationInfo region_info;
+	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &region.buffer, &region.allocation, &region_info);
+	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "Can't create persistent mapped buffer of size: " + itos(p_buffer->size) + ", error " + itos(err) + ".");
+	region.mapped = (uint8_t *)region_info.pMappedData;
+	region.frame_used = frames_drawn;
+
+	p_buffer->persistent_regions.push_back(region);
+
 	return OK;
 }
 
 Error RenderingDeviceVulkan::_buffer_free(Buffer *p_buffer) {
 	ERR_FAIL_COND_V(p_buffer->size == 0, ERR_INVALID_PARAMETER);
 
-	vmaDestroyBuffer(allocator, p_buffer->buffer, p_buffer->allocation);
+	if (p_buffer->persistent_regions.size()) {
+		//the current region is mirrored in the buffer, so it is destroyed here too
+		for (uint32_t i = 0; i < p_buffer->persistent_regions.size(); i++) {
+			vmaDestroyBuffer(allocator, p_buffer->persistent_regions[i].buffer, p_buffer->persistent_regions[i].allocation);
+		}
+		p_buffer->persistent_regions.clear();
+	} else {
+		vmaDestroyBuffer(allocator, p_buffer->buffer, p_buffer->allocation);
+	}
+	buffer_memory -= p_buffer->size;
+
 	p_buffer->buffer = VK_NULL_HANDLE;
 	p_buffer->allocation = nullptr;
 	p_buffer->size = 0;
@@ -1577,6 +1634,41 @@ Error RenderingDeviceVulkan::_staging_buffer_allocate(uint32_t p_amount, uint32_
 	return OK;
 }
 
+Error RenderingDeviceVulkan::_buffer_update_persistent(Buffer *p_buffer, size_t p_offset, const uint8_t *p_data, size_t p_data_size) {
+	if (p_offset == 0) {
+		//discard, move to a region the GPU is no longer reading from
+		uint32_t region_count = p_buffer->persistent_regions.size();
+		uint32_t found = region_count;
+		for (uint32_t i = 1; i <= region_count; i++) {
+			uint32_t idx = (p_buffer->persistent_region_current + i) % region_count;
+			if (p_buffer->persistent_regions[idx].frame_used + frame_count <= frames_drawn) {
+				found = idx;
+				break;
+			}
+		}
+
+		if (found == region_count) {
+			//all in use, add a new one
+			Error err = _buffer_allocate_persistent_region(p_buffer);
+			ERR_FAIL_COND_V(err != OK, err);
+		}
+
+		PersistentBufferRegion &region = p_buffer->persistent_regions[found];
+		region.frame_used = frames_drawn;
+		p_buffer->persistent_region_current = found;
+		p_buffer->buffer = region.buffer;
+		p_buffer->allocation = region.allocation;
+		p_buffer->buffer_info.buffer = region.buffer;
+	}
+
+	PersistentBufferRegion &region = p_buffer->persistent_regions[p_buffer->persistent_region_current];
+	region.frame_used = frames_drawn;
+	memcpy(region.mapped + p_offset, p_data, p_data_size);
+	vmaFlushAllocation(allocator, region.allocation, p_offset, p_data_size); //does nothing if memory is coherent
+
+	return OK;
+}
+
 Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, const uint8_t *p_data, size_t p_data_size, bool p_use_draw_command_buffer, uint32_t p_required_align) {
 	//submitting may get chunked for various reasons, so convert this to a task
 	size_t to_submit = p_data_size;
@@ -1693,6 +1785,16 @@ void RenderingDeviceVulkan::_buffer_memory_barrier(VkBuffer buffer, uint64_t p_f
 RID RenderingDeviceVulkan::texture_create(const TextureFormat &p_format, const TextureView &p_view, const Vector<Vector<uint8_t>> &p_data) {
 	_THREAD_SAFE_METHOD_
 
+	return _texture_create(p_format, p_view, p_data, false);
+}
+
+RID RenderingDeviceVulkan::texture_create_async(const TextureFormat &p_format, const TextureView &p_view, const Vector<Vector<uint8_t>> &p_data) {
+	_THREAD_SAFE_METHOD_
+
+	return _texture_create(p_format, p_view, p_data, async_upload_enabled && p_data.size());
+}
+
+RID RenderingDeviceVulkan::_texture_create(const TextureFormat &p_format, const TextureView &p_view, const Vector<Vector<uint8_t>> &p_data, bool p_async) {
 	VkImageCreateInfo image_create_info;
 	image_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
 	image_create_info.pNext = nullptr;
@@ -1809,9 +1911,15 @@ RID RenderingDeviceVulkan::texture_create(const TextureFormat &p_format, const T
 		image_create_info.usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 	}
 
-	image_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-	image_create_info.queueFamilyIndexCount = 0;
-	image_create_info.pQueueFamilyIndices = nullptr;
+	if (shared_queue_family_count > 1) {
+		image_create_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		image_create_info.queueFamilyIndexCount = shared_queue_family_count;
+		image_create_info.pQueueFamilyIndices = shared_queue_families;
+	} else {
+		image_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		image_create_info.queueFamilyIndexCount = 0;
+		image_create_info.pQueueFamilyIndices = nullptr;
+	}
 	image_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
 	uint32_t required_mipmaps = get_image_required_mipmaps(image_create_info.extent.width, image_create_info.extent.height, image_create_info.extent.depth);
@@ -2004,8 +2112,8 @@ RID RenderingDeviceVulkan::texture_create(const TextureFormat &p_format, const T
 		ERR_FAIL_V_MSG(RID(), "vkCreateImageView failed with error " + itos(err) + ".");
 	}
 
-	//barrier to set layout
-	{
+	//barrier to set layout, async uploads set it on the transfer queue
+	if (!p_async) {
 		VkImageMemoryBarrier image_memory_barrier;
 		image_memory_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 		image_memory_barrier.pNext = nullptr;
@@ -2025,9 +2133,17 @@ RID RenderingDeviceVulkan::texture_create(const TextureFormat &p_format, const T
 		vkCmdPipelineBarrier(frames[frame].setup_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &image_memory_barrier);
 	}
 
+	_get_texture_memory_counter(texture.usage_flags) += texture.allocation_info.size;
+
 	RID id = texture_owner.make_rid(texture);
 
-	if (p_data.size()) {
+	if (p_async) {
+		Error upload_err = _texture_upload_async(id, p_data);
+		if (upload_err != OK) {
+			_free_internal(id);
+			ERR_FAIL_V_MSG(RID(), "Could not upload texture data on the transfer queue.");
+		}
+	} else if (p_data.size()) {
 		for (uint32_t i = 0; i < image_create_info.arrayLayers; i++) {
 			texture_update(id, i, p_data[i]);
 		}
@@ -2515,6 +2631,104 @@ Error RenderingDeviceVulkan::texture_update(RID p_texture, uint32_t p_layer, con
 	return OK;
 }
 
+Error RenderingDeviceVulkan::_texture_upload_async(RID p_texture, const Vector<Vector<uint8_t>> &p_data) {
+	Texture *texture = texture_owner.getornull(p_texture);
+	ERR_FAIL_COND_V(!texture, ERR_INVALID_PARAMETER);
+
+	uint32_t required_align = get_compressed_image_format_block_byte_size(texture->format);
+	if (required_align == 1) {
+		required_align = get_image_format_pixel_size(texture->format);
+	}
+	if ((required_align % 4) != 0) { //alignment rules are really strange
+		required_align *= 4;
+	}
+
+	//every layer and mipmap is copied from its own aligned offset of a single staging buffer
+	LocalVector<VkBufferImageCopy> copies;
+	LocalVector<const uint8_t *> sources;
+	LocalVector<uint32_t> source_sizes;
+	uint32_t staging_size = 0;
+
+	for (int i = 0; i < p_data.size(); i++) {
+		uint32_t mipmap_offset = 0;
+		uint32_t logic_width = texture->width;
+		uint32_t logic_height = texture->height;
+
+		for (uint32_t mm_i = 0; mm_i < texture->mipmaps; mm_i++) {
+			uint32_t width, height, depth;
+			uint32_t image_total = get_image_format_required_size(texture->format, texture->width, texture->height, texture->depth, mm_i + 1, &width, &height, &depth);
+
+			uint32_t align_remainder = staging_size % required_align;
+			if (align_remainder != 0) {
+				staging_size += required_align - align_remainder;
+			}
+
+			VkBufferImageCopy buffer_image_copy;
+			buffer_image_copy.bufferOffset = staging_size;
+			buffer_image_copy.bufferRowLength = 0; //tightly packed
+			buffer_image_copy.bufferImageHeight = 0; //tightly packed
+			buffer_image_copy.imageSubresource.aspectMask = texture->read_aspect_mask;
+			buffer_image_copy.imageSubresource.mipLevel = mm_i;
+			buffer_image_copy.imageSubresource.baseArrayLayer = i;
+			buffer_image_copy.imageSubresource.layerCount = 1;
+			buffer_image_copy.imageOffset.x = 0;
+			buffer_image_copy.imageOffset.y = 0;
+			buffer_image_copy.imageOffset.z = 0;
+			buffer_image_copy.imageExtent.width = logic_width;
+			buffer_image_copy.imageExtent.height = logic_height;
+			buffer_image_copy.imageExtent.depth = depth;
+			copies.push_back(buffer_image_copy);
+
+			sources.push_back(p_data[i].ptr() + mipmap_offset);
+			source_sizes.push_back(image_total - mipmap_offset);
+			staging_size += image_total - mipmap_offset;
+
+			mipmap_offset = image_total;
+			logic_width = MAX(1u, logic_width >> 1);
+			logic_height = MAX(1u, logic_height >> 1);
+		}
+	}
+
+	PendingUpload upload;
+	uint8_t *staging_ptr;
+	Error err = _upload_begin(staging_size, upload, staging_ptr);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	for (uint32_t i = 0; i < copies.size(); i++) {
+		memcpy(staging_ptr + copies[i].bufferOffset, sources[i], source_sizes[i]);
+	}
+
+	VkImageMemoryBarrier image_memory_barrier;
+	image_memory_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	image_memory_barrier.pNext = nullptr;
+	image_memory_barrier.srcAccessMask = 0;
+	image_memory_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	image_memory_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	image_memory_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	image_memory_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	image_memory_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	image_memory_barrier.image = texture->image;
+	image_memory_barrier.subresourceRange.aspectMask = texture->barrier_aspect_mask;
+	image_memory_barrier.subresourceRange.baseMipLevel = 0;
+	image_memory_barrier.subresourceRange.levelCount = texture->mipmaps;
+	image_memory_barrier.subresourceRange.baseArrayLayer = 0;
+	image_memory_barrier.subresourceRange.layerCount = texture->layers;
+
+	vkCmdPipelineBarrier(upload.command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &image_memory_barrier);
+
+	vkCmdCopyBufferToImage(upload.command_buffer, upload.staging_buffer, texture->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copies.size(), copies.ptr());
+
+	//the transfer queue can't name shader stages, the semaphore the graphics queue waits on makes the data visible
+	image_memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	image_memory_barrier.dstAccessMask = 0;
+	image_memory_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	image_memory_barrier.newLayout = texture->layout;
+
+	vkCmdPipelineBarrier(upload.command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &image_memory_barrier);
+
+	return _upload_submit(p_texture, upload);
+}
+
 Vector<uint8_t> RenderingDeviceVulkan::_texture_get_data_from_image(Texture *tex, VkImage p_image, VmaAllocation p_allocation, uint32_t p_layer, bool p_2d) {
 	uint32_t width, height, depth;
 	uint32_t image_size = get_image_format_required_size(tex->format, tex->width, tex->height, p_2d ? 1 : tex->depth, tex->mipmaps, &width, &height, &depth);
@@ -4618,6 +4832,27 @@ RID RenderingDeviceVulkan::storage_buffer_create(uint32_t p_size_bytes, const Ve
 	if (p_usage & STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT) {
 		flags |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
 	}
+
+	if (p_usage & STORAGE_BUFFER_USAGE_PERSISTENT_MAPPED) {
+		buffer.size = p_size_bytes;
+		buffer.usage = flags;
+		Error err = _buffer_allocate_persistent_region(&buffer);
+		ERR_FAIL_COND_V(err != OK, RID());
+		PersistentBufferRegion &region = buffer.persistent_regions[0];
+		region.frame_used = 0; //never used by the GPU yet
+		buffer.buffer = region.buffer;
+		buffer.allocation = region.allocation;
+		buffer.buffer_info.buffer = region.buffer;
+		buffer.buffer_info.offset = 0;
+		buffer.buffer_info.range = p_size_bytes;
+
+		if (p_data.size()) {
+			memcpy(region.mapped, p_data.ptr(), p_data.size());
+			vmaFlushAllocation(allocator, region.allocation, 0, p_data.size());
+		}
+		return storage_buffer_owner.make_rid(buffer);
+	}
+
 	Error err = _buffer_allocate(&buffer, p_size_bytes, flags, VMA_MEMORY_USAGE_GPU_ONLY);
 	ERR_FAIL_COND_V(err != OK, RID());
 
@@ -5257,6 +5492,11 @@ Error RenderingDeviceVulkan::buffer_update(RID p_buffer, uint32_t p_offset, uint
 	ERR_FAIL_COND_V_MSG(p_offset + p_size > buffer->size, ERR_INVALID_PARAMETER,
 			"Attempted to write buffer (" + itos((p_offset + p_size) - buffer->size) + " bytes) past the end.");
 
+	if (buffer->persistent_regions.size()) {
+		//written from the host, submitting the frame makes it visible so no copy or barrier is needed
+		return _buffer_update_persistent(buffer, p_offset, (const uint8_t *)p_data, p_size);
+	}
+
 	// no barrier should be needed here
 	// _buffer_memory_barrier(buffer->buffer, p_offset, p_size, dst_stage_mask, VK_PIPELINE_STAGE_TRANSFER_BIT, dst_access, VK_ACCESS_TRANSFER_WRITE_BIT, true);
 
@@ -5280,6 +5520,53 @@ Error RenderingDeviceVulkan::buffer_update(RID p_buffer, uint32_t p_offset, uint
 	return err;
 }
 
+Error RenderingDeviceVulkan::buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data) {
+	_THREAD_SAFE_METHOD_
+
+	VkPipelineStageFlags dst_stage_mask = 0;
+	VkAccessFlags dst_access = 0;
+	Buffer *buffer = _get_buffer_from_owner(p_buffer, dst_stage_mask, dst_access, BARRIER_MASK_ALL);
+	if (!buffer) {
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Buffer argument is not a valid buffer of any type.");
+	}
+
+	ERR_FAIL_COND_V_MSG(p_offset + p_size > buffer->size, ERR_INVALID_PARAMETER,
+			"Attempted to write buffer (" + itos((p_offset + p_size) - buffer->size) + " bytes) past the end.");
+
+	if (buffer->persistent_regions.size()) {
+		//written from the host, nothing to upload
+		return _buffer_update_persistent(buffer, p_offset, (const uint8_t *)p_data, p_size);
+	}
+
+	if (!async_upload_enabled) {
+		//same as passing the data on creation, copied by the setup command buffer
+		ERR_FAIL_COND_V_MSG(draw_list, ERR_INVALID_PARAMETER,
+				"Updating buffers is forbidden during creation of a draw list");
+		ERR_FAIL_COND_V_MSG(compute_list, ERR_INVALID_PARAMETER,
+				"Updating buffers is forbidden during creation of a compute list");
+
+		Error err = _buffer_update(buffer, p_offset, (const uint8_t *)p_data, p_size);
+		ERR_FAIL_COND_V(err != OK, err);
+		_buffer_memory_barrier(buffer->buffer, p_offset, p_size, VK_PIPELINE_STAGE_TRANSFER_BIT, dst_stage_mask ? dst_stage_mask : uint32_t(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT), VK_ACCESS_TRANSFER_WRITE_BIT, dst_access, false);
+		return OK;
+	}
+
+	PendingUpload upload;
+	uint8_t *staging_ptr;
+	Error err = _upload_begin(p_size, upload, staging_ptr);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	memcpy(staging_ptr, p_data, p_size);
+
+	VkBufferCopy region;
+	region.srcOffset = 0;
+	region.dstOffset = p_offset;
+	region.size = p_size;
+	vkCmdCopyBuffer(upload.command_buffer, upload.staging_buffer, buffer->buffer, 1, &region);
+
+	return _upload_submit(p_buffer, upload);
+}
+
 Error RenderingDeviceVulkan::buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier) {
 	_THREAD_SAFE_METHOD_
 
@@ -5373,7 +5660,27 @@ Vector<uint8_t> RenderingDeviceVulkan::buffer_get_data(RID p_buffer) {
 /**** RENDER PIPELINE ****/
 /*************************/
 
-RID RenderingDeviceVulkan::render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, int p_dynamic_state_flags) {
+// Fills r_info for p_constants. r_entries and r_data hold what it points to, so they must outlive the pipeline creation.
+static void _fill_specialization_info(const Vector<RenderingDevice::PipelineSpecializationConstant> &p_constants, Vector<VkSpecializationMapEntry> &r_entries, Vector<uint32_t> &r_data, VkSpecializationInfo &r_info) {
+	r_entries.resize(p_constants.size());
+	r_data.resize(p_constants.size());
+	for (int i = 0; i < p_constants.size(); i++) {
+		const RenderingDevice::PipelineSpecializationConstant &constant = p_constants[i];
+		VkSpecializationMapEntry &entry = r_entries.write[i];
+		entry.constantID = constant.constant_id;
+		entry.offset = i * sizeof(uint32_t);
+		entry.size = sizeof(uint32_t);
+		// Booleans are 32 bits in SPIR-V.
+		r_data.write[i] = constant.type == RenderingDevice::PIPELINE_SPECIALIZATION_CONSTANT_TYPE_BOOL ? VkBool32(constant.bool_value) : constant.int_value;
+	}
+
+	r_info.mapEntryCount = r_entries.size();
+	r_info.pMapEntries = r_entries.ptr();
+	r_info.dataSize = r_data.size() * sizeof(uint32_t);
+	r_info.pData = r_data.ptr();
+}
+
+RID RenderingDeviceVulkan::render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, int p_dynamic_state_flags, const Vector<PipelineSpecializationConstant> &p_specialization_constants) {
 	_THREAD_SAFE_METHOD_
 
 	//needs a shader
@@ -5674,8 +5981,19 @@ RID RenderingDeviceVulkan::render_pipeline_create(RID p_shader, FramebufferForma
 	graphics_pipeline_create_info.pNext = nullptr;
 	graphics_pipeline_create_info.flags = 0;
 
-	graphics_pipeline_create_info.stageCount = shader->pipeline_stages.size();
-	graphics_pipeline_create_info.pStages = shader->pipeline_stages.ptr();
+	Vector<VkPipelineShaderStageCreateInfo> pipeline_stages = shader->pipeline_stages;
+	Vector<VkSpecializationMapEntry> specialization_entries;
+	Vector<uint32_t> specialization_data;
+	VkSpecializationInfo specialization_info;
+	if (p_specialization_constants.size()) {
+		_fill_specialization_info(p_specialization_constants, specialization_entries, specialization_data, specialization_info);
+		for (int i = 0; i < pipeline_stages.size(); i++) {
+			pipeline_stages.write[i].pSpecializationInfo = &specialization_info;
+		}
+	}
+
+	graphics_pipeline_create_info.stageCount = pipeline_stages.size();
+	graphics_pipeline_create_info.pStages = pipeline_stages.ptr();
 	graphics_pipeline_create_info.pVertexInputState = &pipeline_vertex_input_state_create_info;
 	graphics_pipeline_create_info.pInputAssemblyState = &input_assembly_create_info;
 	graphics_pipeline_create_info.pTessellationState = &tessellation_create_info;
@@ -5693,8 +6011,9 @@ RID RenderingDeviceVulkan::render_pipeline_create(RID p_shader, FramebufferForma
 	graphics_pipeline_create_info.basePipelineIndex = 0;
 
 	RenderPipeline pipeline;
-	VkResult err = vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &graphics_pipeline_create_info, nullptr, &pipeline.pipeline);
+	VkResult err = vkCreateGraphicsPipelines(device, pipeline_cache, 1, &graphics_pipeline_create_info, nullptr, &pipeline.pipeline);
 	ERR_FAIL_COND_V_MSG(err, RID(), "vkCreateGraphicsPipelines failed with error " + itos(err) + ".");
+	pipeline_cache_dirty = true;
 
 	pipeline.set_formats = shader->set_formats;
 	pipeline.push_constant_stages = shader->push_constant.push_constants_vk_stage;
@@ -5743,7 +6062,7 @@ bool RenderingDeviceVulkan::render_pipeline_is_valid(RID p_pipeline) {
 /**** COMPUTE PIPELINE ****/
 /**************************/
 
-RID RenderingDeviceVulkan::compute_pipeline_create(RID p_shader) {
+RID RenderingDeviceVulkan::compute_pipeline_create(RID p_shader, const Vector<PipelineSpecializationConstant> &p_specialization_constants) {
 	_THREAD_SAFE_METHOD_
 
 	//needs a shader
@@ -5761,13 +6080,22 @@ RID RenderingDeviceVulkan::compute_pipeline_create(RID p_shader) {
 	compute_pipeline_create_info.flags = 0;
 
 	compute_pipeline_create_info.stage = shader->pipeline_stages[0];
+
+	Vector<VkSpecializationMapEntry> specialization_entries;
+	Vector<uint32_t> specialization_data;
+	VkSpecializationInfo specialization_info;
+	if (p_specialization_constants.size()) {
+		_fill_specialization_info(p_specialization_constants, specialization_entries, specialization_data, specialization_info);
+		compute_pipeline_create_info.stage.pSpecializationInfo = &specialization_info;
+	}
 	compute_pipeline_create_info.layout = shader->pipeline_layout;
 	compute_pipeline_create_info.basePipelineHandle = VK_NULL_HANDLE;
 	compute_pipeline_create_info.basePipelineIndex = 0;
 
 	ComputePipeline pipeline;
-	VkResult err = vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &compute_pipeline_create_info, nullptr, &pipeline.pipeline);
+	VkResult err = vkCreateComputePipelines(device, pipeline_cache, 1, &compute_pipeline_create_info, nullptr, &pipeline.pipeline);
 	ERR_FAIL_COND_V_MSG(err, RID(), "vkCreateComputePipelines failed with error " + itos(err) + ".");
+	pipeline_cache_dirty = true;
 
 	pipeline.set_formats = shader->set_formats;
 	pipeline.push_constant_stages = shader->push_constant.push_constants_vk_stage;
@@ -5806,6 +6134,13 @@ int RenderingDeviceVulkan::screen_get_height(DisplayServer::WindowID p_screen) c
 	return context->window_get_height(p_screen);
 }
 
+int RenderingDeviceVulkan::screen_get_pre_rotation(DisplayServer::WindowID p_screen) const {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND_V_MSG(local_device.is_valid(), 0, "Local devices have no screen");
+
+	return context->window_get_pre_rotation(p_screen);
+}
+
 RenderingDevice::FramebufferFormatID RenderingDeviceVulkan::screen_get_framebuffer_format() const {
 	_THREAD_SAFE_METHOD_
 	ERR_FAIL_COND_V_MSG(local_device.is_valid(), INVALID_ID, "Local devices have no screen");
@@ -6234,23 +6569,31 @@ Error RenderingDeviceVulkan::draw_list_begin_split(RID p_framebuffer, uint32_t p
 
 			VkResult res = vkCreateCommandPool(device, &cmd_pool_info, nullptr, &split_draw_list_allocators.write[i].command_pool);
 			ERR_FAIL_COND_V_MSG(res, ERR_CANT_CREATE, "vkCreateCommandPool failed with error " + itos(res) + ".");
+		}
+	}
 
-			for (int j = 0; j < frame_count; j++) {
-				VkCommandBuffer command_buffer;
+	// Command buffers from previous passes of this frame were already recorded into the frame
+	// command buffer with vkCmdExecuteCommands, so they can't be reset until the frame is submitted.
+	uint32_t pass = frames[frame].split_draw_list_passes;
+	uint32_t buffer_index = pass * frame_count + frame;
 
-				VkCommandBufferAllocateInfo cmdbuf;
-				//no command buffer exists, create it.
-				cmdbuf.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-				cmdbuf.pNext = nullptr;
-				cmdbuf.commandPool = split_draw_list_allocators[i].command_pool;
-				cmdbuf.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
-				cmdbuf.commandBufferCount = 1;
+	for (uint32_t i = 0; i < p_splits; i++) {
+		SplitDrawListAllocator &allocator = split_draw_list_allocators.write[i];
+		while (allocator.command_buffers.size() <= buffer_index) {
+			VkCommandBuffer command_buffer;
 
-				VkResult err = vkAllocateCommandBuffers(device, &cmdbuf, &command_buffer);
-				ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vkAllocateCommandBuffers failed with error " + itos(err) + ".");
+			VkCommandBufferAllocateInfo cmdbuf;
+			//no command buffer exists, create it.
+			cmdbuf.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			cmdbuf.pNext = nullptr;
+			cmdbuf.commandPool = allocator.command_pool;
+			cmdbuf.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+			cmdbuf.commandBufferCount = 1;
 
-				split_draw_list_allocators.write[i].command_buffers.push_back(command_buffer);
-			}
+			VkResult err = vkAllocateCommandBuffers(device, &cmdbuf, &command_buffer);
+			ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vkAllocateCommandBuffers failed with error " + itos(err) + ".");
+
+			allocator.command_buffers.push_back(command_buffer);
 		}
 	}
 
@@ -6270,10 +6613,11 @@ Error RenderingDeviceVulkan::draw_list_begin_split(RID p_framebuffer, uint32_t p
 	draw_list = memnew_arr(DrawList, p_splits);
 	draw_list_count = p_splits;
 	draw_list_split = true;
+	frames[frame].split_draw_list_passes++;
 
 	for (uint32_t i = 0; i < p_splits; i++) {
 		//take a command buffer and initialize it
-		VkCommandBuffer command_buffer = split_draw_list_allocators[i].command_buffers[frame];
+		VkCommandBuffer command_buffer = split_draw_list_allocators[i].command_buffers[buffer_index];
 
 		VkCommandBufferInheritanceInfo inheritance_info;
 		inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
@@ -6288,7 +6632,7 @@ Error RenderingDeviceVulkan::draw_list_begin_split(RID p_framebuffer, uint32_t p
 		VkCommandBufferBeginInfo cmdbuf_begin;
 		cmdbuf_begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 		cmdbuf_begin.pNext = nullptr;
-		cmdbuf_begin.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+		cmdbuf_begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
 		cmdbuf_begin.pInheritanceInfo = &inheritance_info;
 
 		VkResult res = vkResetCommandBuffer(command_buffer, 0);
@@ -6466,12 +6810,11 @@ void RenderingDeviceVulkan::draw_list_bind_uniform_set(DrawListID p_list, RID p_
 	if (mst_count) {
 		Texture **mst_textures = const_cast<UniformSet *>(uniform_set)->mutable_storage_textures.ptrw();
 		for (uint32_t i = 0; i < mst_count; i++) {
-			if (mst_textures[i]->used_in_frame != frames_drawn) {
-				mst_textures[i]->used_in_frame = frames_drawn;
-				mst_textures[i]->used_in_transfer = false;
-				mst_textures[i]->used_in_compute = false;
+			if (draw_list_split) {
+				dl->split_mutable_storage_textures.push_back(mst_textures[i]);
+			} else {
+				_draw_list_use_mutable_storage_texture(mst_textures[i]);
 			}
-			mst_textures[i]->used_in_raster = true;
 		}
 	}
 
@@ -6491,6 +6834,15 @@ void RenderingDeviceVulkan::draw_list_bind_uniform_set(DrawListID p_list, RID p_
 #endif
 }
 
+void RenderingDeviceVulkan::_draw_list_use_mutable_storage_texture(Texture *p_texture) {
+	if (p_texture->used_in_frame != frames_drawn) {
+		p_texture->used_in_frame = frames_drawn;
+		p_texture->used_in_transfer = false;
+		p_texture->used_in_compute = false;
+	}
+	p_texture->used_in_raster = true;
+}
+
 void RenderingDeviceVulkan::draw_list_bind_vertex_array(DrawListID p_list, RID p_vertex_array) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 	ERR_FAIL_COND(!dl);
@@ -6678,6 +7030,92 @@ void RenderingDeviceVulkan::draw_list_draw(DrawListID p_list, bool p_use_indices
 	}
 }
 
+void RenderingDeviceVulkan::draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawList *dl = _get_draw_list_ptr(p_list);
+	ERR_FAIL_COND(!dl);
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.active, "Submitted Draw Lists can no longer be modified.");
+#endif
+
+	Buffer *buffer = storage_buffer_owner.getornull(p_buffer);
+	ERR_FAIL_COND(!buffer);
+
+	ERR_FAIL_COND_MSG(!(buffer->usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT), "Buffer provided was not created to do indirect draws.");
+
+	if (p_draw_count == 0) {
+		return;
+	}
+
+	// VkDrawIndexedIndirectCommand is 5 uint32s, VkDrawIndirectCommand is 4.
+	uint32_t command_size = p_use_indices ? 20 : 16;
+	if (p_stride == 0) {
+		p_stride = command_size;
+	}
+
+	ERR_FAIL_COND_MSG(p_offset % 4 != 0, "Offset provided (" + itos(p_offset) + ") must be a multiple of 4.");
+	ERR_FAIL_COND_MSG(p_stride % 4 != 0 || p_stride < command_size, "Stride provided (" + itos(p_stride) + ") must be a multiple of 4 and at least the size of a draw command (" + itos(command_size) + ").");
+	ERR_FAIL_COND_MSG(p_draw_count > limits.maxDrawIndirectCount, "Draw count (" + itos(p_draw_count) + ") is larger than the maximum supported by the hardware (" + itos(limits.maxDrawIndirectCount) + ").");
+	ERR_FAIL_COND_MSG(uint64_t(p_offset) + uint64_t(p_stride) * (p_draw_count - 1) + command_size > buffer->size, "Draw commands requested go past the end of the buffer.");
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.pipeline_active,
+			"No render pipeline was set before attempting to draw.");
+	if (dl->validation.pipeline_vertex_format != INVALID_ID) {
+		//pipeline uses vertices, validate format
+		ERR_FAIL_COND_MSG(dl->validation.vertex_format == INVALID_ID,
+				"No vertex array was bound, and render pipeline expects vertices.");
+		//make sure format is right
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format != dl->validation.vertex_format,
+				"The vertex format used to create the pipeline does not match the vertex format bound.");
+	}
+
+	if (dl->validation.pipeline_push_constant_size > 0) {
+		//using push constants, check that they were supplied
+		ERR_FAIL_COND_MSG(!dl->validation.pipeline_push_constant_supplied,
+				"The shader in this pipeline requires a push constant to be set before drawing, but it's not present.");
+	}
+
+	if (p_use_indices) {
+		ERR_FAIL_COND_MSG(!dl->validation.index_array_size,
+				"Draw command requested indices, but no index buffer was set.");
+
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_uses_restart_indices != dl->validation.index_buffer_uses_restart_indices,
+				"The usage of restart indices in index buffer does not match the render primitive in the pipeline.");
+	}
+#endif
+
+	//Bind descriptor sets
+
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; //nothing expected by this pipeline
+		}
+#ifdef DEBUG_ENABLED
+		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
+			if (dl->state.sets[i].uniform_set_format == 0) {
+				ERR_FAIL_MSG("Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline");
+			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
+				UniformSet *us = uniform_set_owner.getornull(dl->state.sets[i].uniform_set);
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			} else {
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + ", which was was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			}
+		}
+#endif
+		if (!dl->state.sets[i].bound) {
+			//All good, see if this requires re-binding
+			vkCmdBindDescriptorSets(dl->command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, dl->state.pipeline_layout, i, 1, &dl->state.sets[i].descriptor_set, 0, nullptr);
+			dl->state.sets[i].bound = true;
+		}
+	}
+
+	if (p_use_indices) {
+		vkCmdDrawIndexedIndirect(dl->command_buffer, buffer->buffer, p_offset, p_draw_count, p_stride);
+	} else {
+		vkCmdDrawIndirect(dl->command_buffer, buffer->buffer, p_offset, p_draw_count, p_stride);
+	}
+}
+
 void RenderingDeviceVulkan::draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 
@@ -6728,6 +7166,10 @@ void RenderingDeviceVulkan::draw_list_end(uint32_t p_post_barrier) {
 		for (uint32_t i = 0; i < draw_list_count; i++) {
 			vkEndCommandBuffer(draw_list[i].command_buffer);
 			command_buffers[i] = draw_list[i].command_buffer;
+
+			for (uint32_t j = 0; j < draw_list[i].split_mutable_storage_textures.size(); j++) {
+				_draw_list_use_mutable_storage_texture(draw_list[i].split_mutable_storage_textures[j]);
+			}
 		}
 
 		vkCmdExecuteCommands(frames[frame].draw_command_buffer, draw_list_count, command_buffers);
@@ -6840,12 +7282,17 @@ void RenderingDeviceVulkan::draw_list_end(uint32_t p_post_barrier) {
 /**** COMPUTE LISTS ****/
 /***********************/
 
-RenderingDevice::ComputeListID RenderingDeviceVulkan::compute_list_begin(bool p_allow_draw_overlap) {
+RenderingDevice::ComputeListID RenderingDeviceVulkan::compute_list_begin(bool p_allow_draw_overlap, bool p_async) {
 	ERR_FAIL_COND_V_MSG(!p_allow_draw_overlap && draw_list != nullptr, INVALID_ID, "Only one draw list can be active at the same time.");
 	ERR_FAIL_COND_V_MSG(compute_list != nullptr, INVALID_ID, "Only one draw/compute list can be active at the same time.");
 
 	compute_list = memnew(ComputeList);
-	compute_list->command_buffer = frames[frame].draw_command_buffer;
+	if (p_async && async_compute_segment == ASYNC_COMPUTE_SEGMENT_FORKED) {
+		compute_list->command_buffer = frames[frame].async_compute_command_buffer;
+		compute_list->state.async = true;
+	} else {
+		compute_list->command_buffer = frames[frame].draw_command_buffer;
+	}
 	compute_list->state.allow_draw_overlap = p_allow_draw_overlap;
 
 	return ID_TYPE_COMPUTE_LIST;
@@ -7046,6 +7493,10 @@ void RenderingDeviceVulkan::compute_list_bind_uniform_set(ComputeListID p_list,
 	}
 
 	if (texture_barrier_count) {
+		if (cl->state.async) {
+			//the compute queue has no raster stages, draw work before the fork is already ordered by the fork semaphore
+			src_stage_flags &= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+		}
 		if (src_stage_flags == 0) {
 			src_stage_flags = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
 		}
@@ -7175,7 +7626,7 @@ void RenderingDeviceVulkan::compute_list_dispatch_indirect(ComputeListID p_list,
 	Buffer *buffer = storage_buffer_owner.getornull(p_buffer);
 	ERR_FAIL_COND(!buffer);
 
-	ERR_FAIL_COND_MSG(!(buffer->usage & STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT), "Buffer provided was not created to do indirect dispatch.");
+	ERR_FAIL_COND_MSG(!(buffer->usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT), "Buffer provided was not created to do indirect dispatch.");
 
 	ERR_FAIL_COND_MSG(p_offset + 12 > buffer->size, "Offset provided (+12) is past the end of buffer.");
 
@@ -7224,6 +7675,19 @@ void RenderingDeviceVulkan::compute_list_dispatch_indirect(ComputeListID p_list,
 }
 
 void RenderingDeviceVulkan::compute_list_add_barrier(ComputeListID p_list) {
+	ERR_FAIL_COND(p_list != ID_TYPE_COMPUTE_LIST);
+	ERR_FAIL_COND(!compute_list);
+
+	if (compute_list->state.async) {
+		VkMemoryBarrier mem_barrier;
+		mem_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		mem_barrier.pNext = nullptr;
+		mem_barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		mem_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(compute_list->command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &mem_barrier, 0, nullptr, 0, nullptr);
+		return;
+	}
+
 #ifdef FORCE_FULL_BARRIER
 	_full_barrier(true);
 #else
@@ -7249,6 +7713,12 @@ void RenderingDeviceVulkan::compute_list_end(uint32_t p_post_barrier) {
 		access_flags |= VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT;
 	}
 
+	if (compute_list->state.async) {
+		//raster work that reads the results is ordered by the join semaphore instead
+		barrier_flags &= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+		access_flags &= ~(VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
+	}
+
 	if (barrier_flags == 0) {
 		barrier_flags = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
 	}
@@ -7359,6 +7829,224 @@ void RenderingDeviceVulkan::full_barrier() {
 	_full_barrier(true);
 }
 
+/***********************/
+/**** ASYNC COMPUTE ****/
+/***********************/
+
+bool RenderingDeviceVulkan::has_async_compute() const {
+	return async_compute_enabled;
+}
+
+void RenderingDeviceVulkan::_async_compute_next_segment() {
+	//close the draw work recorded so far and continue in the next segment, the context submits each one with its own synchronization
+	vkEndCommandBuffer(frames[frame].draw_command_buffer);
+
+	if (async_compute_segment == ASYNC_COMPUTE_SEGMENT_BEFORE_FORK) {
+		context->mark_async_compute_fork();
+	} else {
+		context->mark_async_compute_join();
+	}
+	async_compute_segment = AsyncComputeSegment(async_compute_segment + 1);
+
+	VkCommandBufferBeginInfo cmdbuf_begin;
+	cmdbuf_begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	cmdbuf_begin.pNext = nullptr;
+	cmdbuf_begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	cmdbuf_begin.pInheritanceInfo = nullptr;
+
+	frames[frame].draw_command_buffer = frames[frame].draw_command_buffer_segments[async_compute_segment];
+	VkResult err = vkBeginCommandBuffer(frames[frame].draw_command_buffer, &cmdbuf_begin);
+	ERR_FAIL_COND_MSG(err, "vkBeginCommandBuffer failed with error " + itos(err) + ".");
+	context->append_command_buffer(frames[frame].draw_command_buffer);
+}
+
+bool RenderingDeviceVulkan::async_compute_fork() {
+	_THREAD_SAFE_METHOD_
+
+	if (!async_compute_enabled || async_compute_segment != ASYNC_COMPUTE_SEGMENT_BEFORE_FORK) {
+		return false;
+	}
+	ERR_FAIL_COND_V_MSG(draw_list != nullptr || compute_list != nullptr, false, "Async compute can't be forked while a draw or compute list is active.");
+
+	VkCommandBufferBeginInfo cmdbuf_begin;
+	cmdbuf_begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	cmdbuf_begin.pNext = nullptr;
+	cmdbuf_begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	cmdbuf_begin.pInheritanceInfo = nullptr;
+
+	VkResult err = vkBeginCommandBuffer(frames[frame].async_compute_command_buffer, &cmdbuf_begin);
+	ERR_FAIL_COND_V_MSG(err, false, "vkBeginCommandBuffer failed with error " + itos(err) + ".");
+
+	_async_compute_next_segment();
+	return true;
+}
+
+void RenderingDeviceVulkan::async_compute_join() {
+	_THREAD_SAFE_METHOD_
+
+	if (async_compute_segment != ASYNC_COMPUTE_SEGMENT_FORKED) {
+		return;
+	}
+	ERR_FAIL_COND_MSG(draw_list != nullptr || compute_list != nullptr, "Async compute can't be joined while a draw or compute list is active.");
+
+	vkEndCommandBuffer(frames[frame].async_compute_command_buffer);
+	context->set_async_compute_buffer(frames[frame].async_compute_command_buffer);
+
+	_async_compute_next_segment();
+}
+
+bool RenderingDeviceVulkan::has_async_upload() const {
+	return async_upload_enabled;
+}
+
+Error RenderingDeviceVulkan::_upload_begin(uint32_t p_staging_size, PendingUpload &r_upload, uint8_t *&r_staging_ptr) {
+	VkBufferCreateInfo bufferInfo;
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.pNext = nullptr;
+	bufferInfo.flags = 0;
+	bufferInfo.size = MAX(p_staging_size, 1u);
+	bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	bufferInfo.queueFamilyIndexCount = 0;
+	bufferInfo.pQueueFamilyIndices = nullptr;
+
+	VmaAllocationCreateInfo allocInfo;
+	allocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+	allocInfo.usage = VMA_MEMORY_USAGE_CPU_ONLY;
+	allocInfo.requiredFlags = 0;
+	allocInfo.preferredFlags = 0;
+	allocInfo.memoryTypeBits = 0;
+	allocInfo.pool = nullptr;
+	allocInfo.pUserData = nullptr;
+
+	VmaAllocationInfo allocation_info;
+	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &r_upload.staging_buffer, &r_upload.staging_allocation, &allocation_info);
+	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vmaCreateBuffer failed with error " + itos(err) + ".");
+	r_staging_ptr = (uint8_t *)allocation_info.pMappedData;
+
+	VkCommandBufferAllocateInfo cmdbuf;
+	cmdbuf.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	cmdbuf.pNext = nullptr;
+	cmdbuf.commandPool = transfer_command_pool;
+	cmdbuf.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	cmdbuf.commandBufferCount = 1;
+
+	err = vkAllocateCommandBuffers(device, &cmdbuf, &r_upload.command_buffer);
+	if (err) {
+		_upload_discard(r_upload);
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "vkAllocateCommandBuffers failed with error " + itos(err) + ".");
+	}
+
+	VkCommandBufferBeginInfo cmdbuf_begin;
+	cmdbuf_begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	cmdbuf_begin.pNext = nullptr;
+	cmdbuf_begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	cmdbuf_begin.pInheritanceInfo = nullptr;
+
+	err = vkBeginCommandBuffer(r_upload.command_buffer, &cmdbuf_begin);
+	if (err) {
+		_upload_discard(r_upload);
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "vkBeginCommandBuffer failed with error " + itos(err) + ".");
+	}
+
+	return OK;
+}
+
+Error RenderingDeviceVulkan::_upload_submit(RID p_resource, PendingUpload &p_upload) {
+	VkResult err = vkEndCommandBuffer(p_upload.command_buffer);
+	if (err) {
+		_upload_discard(p_upload);
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "vkEndCommandBuffer failed with error " + itos(err) + ".");
+	}
+
+	VkFenceCreateInfo fence_create_info;
+	fence_create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+	fence_create_info.pNext = nullptr;
+	fence_create_info.flags = 0;
+
+	err = vkCreateFence(device, &fence_create_info, nullptr, &p_upload.fence);
+	if (err) {
+		_upload_discard(p_upload);
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "vkCreateFence failed with error " + itos(err) + ".");
+	}
+
+	Error submit_err = context->submit_transfer_buffer(p_upload.command_buffer, p_upload.fence);
+	if (submit_err != OK) {
+		_upload_discard(p_upload);
+		ERR_FAIL_V(submit_err);
+	}
+
+	p_upload.resource = p_resource;
+	pending_uploads.push_back(p_upload);
+	return OK;
+}
+
+void RenderingDeviceVulkan::_upload_discard(PendingUpload &p_upload) {
+	if (p_upload.fence != VK_NULL_HANDLE) {
+		vkDestroyFence(device, p_upload.fence, nullptr);
+	}
+	if (p_upload.command_buffer != VK_NULL_HANDLE) {
+		vkFreeCommandBuffers(device, transfer_command_pool, 1, &p_upload.command_buffer);
+	}
+	if (p_upload.staging_buffer != VK_NULL_HANDLE) {
+		vmaDestroyBuffer(allocator, p_upload.staging_buffer, p_upload.staging_allocation);
+	}
+}
+
+void RenderingDeviceVulkan::_free_finished_uploads() {
+	for (List<PendingUpload>::Element *E = pending_uploads.front(); E;) {
+		List<PendingUpload>::Element *N = E->next();
+		if (E->get().waiters == 0 && vkGetFenceStatus(device, E->get().fence) == VK_SUCCESS) {
+			_upload_discard(E->get());
+			pending_uploads.erase(E);
+		}
+		E = N;
+	}
+}
+
+bool RenderingDeviceVulkan::upload_is_finished(RID p_resource) {
+	_THREAD_SAFE_METHOD_
+
+	for (List<PendingUpload>::Element *E = pending_uploads.front(); E; E = E->next()) {
+		if (E->get().resource == p_resource && vkGetFenceStatus(device, E->get().fence) != VK_SUCCESS) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void RenderingDeviceVulkan::upload_wait(RID p_resource) {
+	//the fences are waited on without holding the lock, so other threads can keep using the device
+	_THREAD_SAFE_LOCK_
+
+	LocalVector<List<PendingUpload>::Element *> waiting;
+	LocalVector<VkFence> fences;
+	for (List<PendingUpload>::Element *E = pending_uploads.front(); E; E = E->next()) {
+		if (E->get().resource == p_resource) {
+			E->get().waiters++;
+			waiting.push_back(E);
+			fences.push_back(E->get().fence);
+		}
+	}
+
+	_THREAD_SAFE_UNLOCK_
+
+	if (fences.size() == 0) {
+		return;
+	}
+
+	vkWaitForFences(device, fences.size(), fences.ptr(), VK_TRUE, UINT64_MAX);
+
+	_THREAD_SAFE_LOCK_
+
+	for (uint32_t i = 0; i < waiting.size(); i++) {
+		waiting[i]->get().waiters--;
+	}
+	_free_finished_uploads();
+
+	_THREAD_SAFE_UNLOCK_
+}
+
 #if 0
 void RenderingDeviceVulkan::draw_list_render_secondary_to_framebuffer(ID p_framebuffer, ID *p_draw_lists, uint32_t p_draw_list_count, InitialAction p_initial_action, FinalAction p_final_action, const Vector<Variant> &p_clear_colors) {
 	VkCommandBuffer frame_cmdbuf = frames[frame].frame_buffer;
@@ -7482,6 +8170,7 @@ void RenderingDeviceVulkan::_free_internal(RID p_id) {
 void RenderingDeviceVulkan::free(RID p_id) {
 	_THREAD_SAFE_METHOD_
 
+	upload_wait(p_id); //the transfer queue may still be writing to it
 	_free_dependencies(p_id); //recursively erase dependencies first, to avoid potential API problems
 	_free_internal(p_id);
 }
@@ -7571,6 +8260,10 @@ void RenderingDeviceVulkan::_finalize_command_bufers() {
 		ERR_PRINT("Found open compute list at the end of the frame, this should never happen (further compute will likely not work).");
 	}
 
+	if (async_compute_segment == ASYNC_COMPUTE_SEGMENT_FORKED) {
+		async_compute_join();
+	}
+
 	{ //complete the setup buffer (that needs to be processed before anything else)
 		vkEndCommandBuffer(frames[frame].setup_command_buffer);
 		vkEndCommandBuffer(frames[frame].draw_command_buffer);
@@ -7580,6 +8273,10 @@ void RenderingDeviceVulkan::_finalize_command_bufers() {
 void RenderingDeviceVulkan::_begin_frame() {
 	//erase pending resources
 	_free_pending_resources(frame);
+	_free_finished_uploads();
+
+	//budget is fetched from the driver once per frame
+	vmaSetCurrentFrameIndex(allocator, uint32_t(frames_drawn));
 
 	//create setup command buffer and set as the setup buffer
 
@@ -7593,6 +8290,9 @@ void RenderingDeviceVulkan::_begin_frame() {
 		VkResult err = vkResetCommandBuffer(frames[frame].setup_command_buffer, 0);
 		ERR_FAIL_COND_MSG(err, "vkResetCommandBuffer failed with error " + itos(err) + ".");
 
+		frames[frame].draw_command_buffer = frames[frame].draw_command_buffer_segments[ASYNC_COMPUTE_SEGMENT_BEFORE_FORK];
+		async_compute_segment = ASYNC_COMPUTE_SEGMENT_BEFORE_FORK;
+
 		err = vkBeginCommandBuffer(frames[frame].setup_command_buffer, &cmdbuf_begin);
 		ERR_FAIL_COND_MSG(err, "vkBeginCommandBuffer failed with error " + itos(err) + ".");
 		err = vkBeginCommandBuffer(frames[frame].draw_command_buffer, &cmdbuf_begin);
@@ -7622,6 +8322,7 @@ void RenderingDeviceVulkan::_begin_frame() {
 	frames[frame].timestamp_result_count = frames[frame].timestamp_count;
 	frames[frame].timestamp_count = 0;
 	frames[frame].index = Engine::get_singleton()->get_frames_drawn();
+	frames[frame].split_draw_list_passes = 0;
 }
 
 void RenderingDeviceVulkan::swap_buffers() {
@@ -7750,6 +8451,7 @@ void RenderingDeviceVulkan::_free_pending_resources(int p_frame) {
 		if (texture->owner.is_null()) {
 			//actually owns the image and the allocation too
 			vmaDestroyImage(allocator, texture->image, texture->allocation);
+			_get_texture_memory_counter(texture->usage_flags) -= texture->allocation_info.size;
 		}
 		frames[p_frame].textures_to_dispose_of.pop_front();
 	}
@@ -7772,10 +8474,48 @@ uint32_t RenderingDeviceVulkan::get_frame_delay() const {
 	return frame_count;
 }
 
-uint64_t RenderingDeviceVulkan::get_memory_usage() const {
-	VmaStats stats;
-	vmaCalculateStats(allocator, &stats);
-	return stats.total.usedBytes;
+uint64_t &RenderingDeviceVulkan::_get_texture_memory_counter(uint32_t p_usage_flags) {
+	if (p_usage_flags & (TEXTURE_USAGE_COLOR_ATTACHMENT_BIT | TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | TEXTURE_USAGE_STORAGE_BIT)) {
+		return render_texture_memory;
+	}
+	return texture_memory;
+}
+
+uint64_t RenderingDeviceVulkan::get_memory_usage(MemoryType p_type) const {
+	switch (p_type) {
+		case MEMORY_TEXTURES:
+			return texture_memory;
+		case MEMORY_RENDER_TEXTURES:
+			return render_texture_memory;
+		case MEMORY_BUFFERS:
+			return buffer_memory;
+		case MEMORY_TOTAL: {
+			VmaStats stats;
+			vmaCalculateStats(allocator, &stats);
+			return stats.total.usedBytes;
+		}
+	}
+	return 0;
+}
+
+uint64_t RenderingDeviceVulkan::get_memory_budget() const {
+	if (!memory_budget_supported) {
+		return 0;
+	}
+
+	//only device local heaps matter, on integrated GPUs that is usually all of them
+	const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+	vmaGetMemoryProperties(allocator, &memory_properties);
+	VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+	vmaGetBudget(allocator, budgets);
+
+	uint64_t budget = 0;
+	for (uint32_t i = 0; i < memory_properties->memoryHeapCount; i++) {
+		if (memory_properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+			budget += budgets[i].budget;
+		}
+	}
+	return budget;
 }
 
 void RenderingDeviceVulkan::_flush(bool p_current_frame) {
@@ -7786,6 +8526,13 @@ void RenderingDeviceVulkan::_flush(bool p_current_frame) {
 	if (p_current_frame) {
 		vkEndCommandBuffer(frames[frame].setup_command_buffer);
 		vkEndCommandBuffer(frames[frame].draw_command_buffer);
+
+		if (async_compute_segment == ASYNC_COMPUTE_SEGMENT_FORKED) {
+			//submitted along with the rest, async compute lists begun after this run in order with draw lists
+			vkEndCommandBuffer(frames[frame].async_compute_command_buffer);
+			context->set_async_compute_buffer(frames[frame].async_compute_command_buffer);
+			async_compute_segment = ASYNC_COMPUTE_SEGMENT_JOINED;
+		}
 	}
 
 	if (local_device.is_valid()) {
@@ -7833,6 +8580,93 @@ void RenderingDeviceVulkan::_flush(bool p_current_frame) {
 	}
 }
 
+void RenderingDeviceVulkan::_load_pipeline_cache() {
+	Vector<uint8_t> cache_data;
+
+	if (GLOBAL_DEF("rendering/vulkan/pipeline_cache/enable", true)) {
+		pipeline_cache_path = "user://vulkan/pipelines." + get_device_pipeline_cache_uuid() + ".cache";
+
+		if (FileAccess::exists(pipeline_cache_path)) {
+			cache_data = FileAccess::get_file_as_array(pipeline_cache_path);
+		}
+
+		// Validate the header ourselves, as not all drivers cope well with data from another device or driver version.
+		if (!cache_data.is_empty()) {
+			// Layout of a VK_PIPELINE_CACHE_HEADER_VERSION_ONE header, as defined by the specification.
+			struct PipelineCacheHeader {
+				uint32_t header_size;
+				uint32_t header_version;
+				uint32_t vendor_id;
+				uint32_t device_id;
+				uint8_t uuid[VK_UUID_SIZE];
+			};
+
+			VkPhysicalDeviceProperties props = context->get_device_properties();
+			PipelineCacheHeader header;
+			bool valid = cache_data.size() >= (int)sizeof(PipelineCacheHeader);
+			if (valid) {
+				memcpy(&header, cache_data.ptr(), sizeof(PipelineCacheHeader));
+				valid = header.header_size >= sizeof(PipelineCacheHeader) &&
+						header.header_version == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+						header.vendor_id == props.vendorID &&
+						header.device_id == props.deviceID &&
+						memcmp(header.uuid, props.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+			}
+			if (!valid) {
+				WARN_PRINT("Pipeline cache at '" + pipeline_cache_path + "' does not match the current device, it will be rebuilt.");
+				cache_data.clear();
+			}
+		}
+	}
+
+	VkPipelineCacheCreateInfo cache_info;
+	cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	cache_info.pNext = nullptr;
+	cache_info.flags = 0;
+	cache_info.initialDataSize = cache_data.size();
+	cache_info.pInitialData = cache_data.ptr();
+
+	VkResult err = vkCreatePipelineCache(device, &cache_info, nullptr, &pipeline_cache);
+	if (err && !cache_data.is_empty()) {
+		// Retry without the saved data.
+		cache_info.initialDataSize = 0;
+		cache_info.pInitialData = nullptr;
+		err = vkCreatePipelineCache(device, &cache_info, nullptr, &pipeline_cache);
+	}
+
+	if (err) {
+		pipeline_cache = VK_NULL_HANDLE;
+		pipeline_cache_path = String();
+		ERR_FAIL_MSG("vkCreatePipelineCache failed with error " + itos(err) + ".");
+	}
+
+	pipeline_cache_dirty = false;
+}
+
+void RenderingDeviceVulkan::_save_pipeline_cache() {
+	if (pipeline_cache == VK_NULL_HANDLE || pipeline_cache_path.is_empty() || !pipeline_cache_dirty) {
+		return;
+	}
+
+	size_t data_size = 0;
+	VkResult err = vkGetPipelineCacheData(device, pipeline_cache, &data_size, nullptr);
+	ERR_FAIL_COND_MSG(err, "vkGetPipelineCacheData failed with error " + itos(err) + ".");
+
+	Vector<uint8_t> cache_data;
+	cache_data.resize(data_size);
+	err = vkGetPipelineCacheData(device, pipeline_cache, &data_size, cache_data.ptrw());
+	ERR_FAIL_COND_MSG(err, "vkGetPipelineCacheData failed with error " + itos(err) + ".");
+
+	DirAccessRef da = DirAccess::create(DirAccess::ACCESS_USERDATA);
+	da->make_dir_recursive(pipeline_cache_path.get_base_dir());
+
+	FileAccessRef f = FileAccess::open(pipeline_cache_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(!f, "Can't save pipeline cache to '" + pipeline_cache_path + "'.");
+	f->store_buffer(cache_data.ptr(), data_size);
+
+	pipeline_cache_dirty = false;
+}
+
 void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_device) {
 	context = p_context;
 	device = p_context->get_device();
@@ -7846,15 +8680,47 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 	limits = p_context->get_device_limits();
 	max_timestamp_query_elements = 256;
 
+	async_compute_enabled = !p_local_device && p_context->has_async_compute_queue() && GLOBAL_DEF("rendering/vulkan/async_compute/enable", true);
+	async_upload_enabled = !p_local_device && p_context->has_transfer_queue() && GLOBAL_DEF("rendering/vulkan/async_upload/enable", true);
+	shared_queue_families[0] = p_context->get_graphics_queue();
+	if (async_compute_enabled) {
+		shared_queue_families[shared_queue_family_count++] = p_context->get_compute_queue();
+	}
+	if (async_upload_enabled) {
+		shared_queue_families[shared_queue_family_count++] = p_context->get_transfer_queue();
+	}
+
 	{ //initialize allocator
 
 		VmaAllocatorCreateInfo allocatorInfo;
 		memset(&allocatorInfo, 0, sizeof(VmaAllocatorCreateInfo));
 		allocatorInfo.physicalDevice = p_context->get_physical_device();
 		allocatorInfo.device = device;
+		if (p_context->is_memory_budget_supported()) {
+			//lets VMA query the budget the driver gives this process (VK_EXT_memory_budget)
+			allocatorInfo.instance = p_context->get_instance();
+			allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+			memory_budget_supported = true;
+		}
 		vmaCreateAllocator(&allocatorInfo, &allocator);
 	}
 
+	if (async_upload_enabled) {
+		//command buffers for uploads are allocated from here and freed once their fence is signaled
+		VkCommandPoolCreateInfo cmd_pool_info;
+		cmd_pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		cmd_pool_info.pNext = nullptr;
+		cmd_pool_info.queueFamilyIndex = p_context->get_transfer_queue();
+		cmd_pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+		VkResult res = vkCreateCommandPool(device, &cmd_pool_info, nullptr, &transfer_command_pool);
+		if (res) {
+			ERR_PRINT("vkCreateCommandPool failed with error " + itos(res) + ", uploads will use the graphics queue.");
+			async_upload_enabled = false;
+			shared_queue_family_count--;
+		}
+	}
+
 	frames = memnew_arr(Frame, frame_count);
 	frame = 0;
 	//create setup and frame buffers
@@ -7887,6 +8753,33 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 
 			err = vkAllocateCommandBuffers(device, &cmdbuf, &frames[i].draw_command_buffer);
 			ERR_CONTINUE_MSG(err, "vkAllocateCommandBuffers failed with error " + itos(err) + ".");
+			frames[i].draw_command_buffer_segments[ASYNC_COMPUTE_SEGMENT_BEFORE_FORK] = frames[i].draw_command_buffer;
+		}
+
+		if (async_compute_enabled) { //extra draw segments, and the async compute command buffer from a pool in the compute family
+			VkCommandBufferAllocateInfo cmdbuf;
+			cmdbuf.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			cmdbuf.pNext = nullptr;
+			cmdbuf.commandPool = frames[i].command_pool;
+			cmdbuf.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			cmdbuf.commandBufferCount = ASYNC_COMPUTE_SEGMENT_MAX - 1;
+
+			VkResult err = vkAllocateCommandBuffers(device, &cmdbuf, &frames[i].draw_command_buffer_segments[ASYNC_COMPUTE_SEGMENT_FORKED]);
+			ERR_CONTINUE_MSG(err, "vkAllocateCommandBuffers failed with error " + itos(err) + ".");
+
+			VkCommandPoolCreateInfo cmd_pool_info;
+			cmd_pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			cmd_pool_info.pNext = nullptr;
+			cmd_pool_info.queueFamilyIndex = p_context->get_compute_queue();
+			cmd_pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+			err = vkCreateCommandPool(device, &cmd_pool_info, nullptr, &frames[i].compute_command_pool);
+			ERR_CONTINUE_MSG(err, "vkCreateCommandPool failed with error " + itos(err) + ".");
+
+			cmdbuf.commandPool = frames[i].compute_command_pool;
+			cmdbuf.commandBufferCount = 1;
+			err = vkAllocateCommandBuffers(device, &cmdbuf, &frames[i].async_compute_command_buffer);
+			ERR_CONTINUE_MSG(err, "vkAllocateCommandBuffers failed with error " + itos(err) + ".");
 		}
 
 		{
@@ -7959,6 +8852,10 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 
 	max_descriptors_per_pool = GLOBAL_DEF("rendering/vulkan/descriptor_pools/max_descriptors_per_pool", 64);
 
+	if (!p_local_device) {
+		_load_pipeline_cache();
+	}
+
 	//check to make sure DescriptorPoolKey is good
 	static_assert(sizeof(uint64_t) * 3 >= UNIFORM_TYPE_MAX * sizeof(uint16_t));
 
@@ -8156,6 +9053,8 @@ int RenderingDeviceVulkan::limit_get(Limit p_limit) {
 			return limits.maxComputeWorkGroupSize[1];
 		case LIMIT_MAX_COMPUTE_WORKGROUP_SIZE_Z:
 			return limits.maxComputeWorkGroupSize[2];
+		case LIMIT_MAX_DRAW_INDIRECT_COUNT:
+			return limits.maxDrawIndirectCount;
 
 		default:
 			ERR_FAIL_V(0);
@@ -8169,8 +9068,23 @@ void RenderingDeviceVulkan::finalize() {
 
 	_flush(false);
 
+	//the device is idle after flushing, so every upload is done
+	for (List<PendingUpload>::Element *E = pending_uploads.front(); E; E = E->next()) {
+		_upload_discard(E->get());
+	}
+	pending_uploads.clear();
+	if (transfer_command_pool != VK_NULL_HANDLE) {
+		vkDestroyCommandPool(device, transfer_command_pool, nullptr);
+	}
+
 	_free_rids(render_pipeline_owner, "Pipeline");
 	_free_rids(compute_pipeline_owner, "Compute");
+
+	if (pipeline_cache != VK_NULL_HANDLE) {
+		_save_pipeline_cache();
+		vkDestroyPipelineCache(device, pipeline_cache, nullptr);
+		pipeline_cache = VK_NULL_HANDLE;
+	}
 	_free_rids(uniform_set_owner, "UniformSet");
 	_free_rids(texture_buffer_owner, "TextureBuffer");
 	_free_rids(storage_buffer_owner, "StorageBuffer");
@@ -8209,6 +9123,9 @@ void RenderingDeviceVulkan::finalize() {
 		int f = (frame + i) % frame_count;
 		_free_pending_resources(f);
 		vkDestroyCommandPool(device, frames[i].command_pool, nullptr);
+		if (frames[i].compute_command_pool != VK_NULL_HANDLE) {
+			vkDestroyCommandPool(device, frames[i].compute_command_pool, nullptr);
+		}
 		vkDestroyQueryPool(device, frames[i].timestamp_pool, nullptr);
 		memdelete_arr(frames[i].timestamp_names);
 		memdelete_arr(frames[i].timestamp_cpu_values);
@@ -204,19 +204,36 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	Error _staging_buffer_allocate(uint32_t p_amount, uint32_t p_required_align, uint32_t &r_alloc_offset, uint32_t &r_alloc_size, bool p_can_segment = true, bool p_on_draw_command_buffer = false);
 	Error _insert_staging_block();
 
+	// Persistent mapped buffers keep a ring of host visible
+	// regions. Each discarding update moves to a region
+	// the GPU is done with (or allocates a new one), so
+	// the ring grows to the amount of updates per frame
+	// times the frames in flight, then stays there.
+
+	struct PersistentBufferRegion {
+		VkBuffer buffer = VK_NULL_HANDLE;
+		VmaAllocation allocation = nullptr;
+		uint8_t *mapped = nullptr;
+		uint64_t frame_used = 0;
+	};
+
 	struct Buffer {
 		uint32_t size = 0;
 		uint32_t usage = 0;
 		VkBuffer buffer = VK_NULL_HANDLE;
 		VmaAllocation allocation = nullptr;
 		VkDescriptorBufferInfo buffer_info; //used for binding
+		LocalVector<PersistentBufferRegion> persistent_regions; //only for persistent mapped buffers, the current one is mirrored above
+		uint32_t persistent_region_current = 0;
 		Buffer() {
 		}
 	};
 
 	Error _buffer_allocate(Buffer *p_buffer, uint32_t p_size, uint32_t p_usage, VmaMemoryUsage p_mapping);
+	Error _buffer_allocate_persistent_region(Buffer *p_buffer);
 	Error _buffer_free(Buffer *p_buffer);
 	Error _buffer_update(Buffer *p_buffer, size_t p_offset, const uint8_t *p_data, size_t p_data_size, bool p_use_draw_command_buffer = false, uint32_t p_required_align = 32);
+	Error _buffer_update_persistent(Buffer *p_buffer, size_t p_offset, const uint8_t *p_data, size_t p_data_size);
 
 	void _full_barrier(bool p_sync_with_draw);
 	void _memory_barrier(VkPipelineStageFlags p_src_stage_mask, VkPipelineStageFlags p_dst_stage_mask, VkAccessFlags p_src_access, VkAccessFlags p_dst_sccess, bool p_sync_with_draw);
@@ -698,6 +715,18 @@ class RenderingDeviceVulkan : public RenderingDevice {
 
 	RID_Owner<ComputePipeline, true> compute_pipeline_owner;
 
+	// Pipelines are created through a pipeline cache that is
+	// saved to user:// when the device is finalized, so
+	// pipelines compiled in a previous run don't need to be
+	// compiled by the driver again.
+
+	VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+	String pipeline_cache_path;
+	bool pipeline_cache_dirty = false;
+
+	void _load_pipeline_cache();
+	void _save_pipeline_cache();
+
 	/*******************/
 	/**** DRAW LIST ****/
 	/*******************/
@@ -712,10 +741,13 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	// implemented internally using secondary command
 	// buffers. As they can be created in threads,
 	// each needs it's own command pool.
+	// Several split passes can be recorded in the same
+	// frame (depth, opaque, alpha, shadows...), so each
+	// pass of each frame gets its own command buffer.
 
 	struct SplitDrawListAllocator {
 		VkCommandPool command_pool = VK_NULL_HANDLE;
-		Vector<VkCommandBuffer> command_buffers; //one for each frame
+		LocalVector<VkCommandBuffer> command_buffers; //indexed by pass * frame_count + frame
 	};
 
 	Vector<SplitDrawListAllocator> split_draw_list_allocators;
@@ -743,6 +775,10 @@ class RenderingDeviceVulkan : public RenderingDevice {
 			uint32_t pipeline_push_constant_stages = 0;
 		} state;
 
+		// Split lists are recorded from several threads, so the mutable storage textures they
+		// use are only marked as used in draw_list_end().
+		LocalVector<Texture *> split_mutable_storage_textures;
+
 #ifdef DEBUG_ENABLED
 		struct Validation {
 			bool active = true; // Means command buffer was not closed, so you can keep adding things.
@@ -793,6 +829,7 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	Error _draw_list_setup_framebuffer(Framebuffer *p_framebuffer, InitialAction p_initial_color_action, FinalAction p_final_color_action, InitialAction p_initial_depth_action, FinalAction p_final_depth_action, VkFramebuffer *r_framebuffer, VkRenderPass *r_render_pass);
 	Error _draw_list_render_pass_begin(Framebuffer *framebuffer, InitialAction p_initial_color_action, FinalAction p_final_color_action, InitialAction p_initial_depth_action, FinalAction p_final_depth_action, const Vector<Color> &p_clear_colors, float p_clear_depth, uint32_t p_clear_stencil, Point2i viewport_offset, Point2i viewport_size, VkFramebuffer vkframebuffer, VkRenderPass render_pass, VkCommandBuffer command_buffer, VkSubpassContents subpass_contents, const Vector<RID> &p_storage_textures);
 	_FORCE_INLINE_ DrawList *_get_draw_list_ptr(DrawListID p_id);
+	void _draw_list_use_mutable_storage_texture(Texture *p_texture);
 	Buffer *_get_buffer_from_owner(RID p_buffer, VkPipelineStageFlags &dst_stage_mask, VkAccessFlags &dst_access, uint32_t p_post_barrier);
 
 	/**********************/
@@ -820,6 +857,7 @@ class RenderingDeviceVulkan : public RenderingDevice {
 			VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
 			uint32_t pipeline_push_constant_stages = 0;
 			bool allow_draw_overlap;
+			bool async = false; // Recorded for the async compute queue.
 		} state;
 
 #ifdef DEBUG_ENABLED
@@ -859,6 +897,13 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	// nature of the GPU. They will get deleted
 	// when the frame is cycled.
 
+	enum AsyncComputeSegment {
+		ASYNC_COMPUTE_SEGMENT_BEFORE_FORK,
+		ASYNC_COMPUTE_SEGMENT_FORKED,
+		ASYNC_COMPUTE_SEGMENT_JOINED,
+		ASYNC_COMPUTE_SEGMENT_MAX
+	};
+
 	struct Frame {
 		//list in usage order, from last to free to first to free
 		List<Buffer> buffers_to_dispose_of;
@@ -875,6 +920,11 @@ class RenderingDeviceVulkan : public RenderingDevice {
 		VkCommandBuffer setup_command_buffer = VK_NULL_HANDLE; //used at the beginning of every frame for set-up
 		VkCommandBuffer draw_command_buffer = VK_NULL_HANDLE; //used at the beginning of every frame for set-up
 
+		//with async compute, draw work is split at the fork and at the join, draw_command_buffer is the segment being recorded
+		VkCommandBuffer draw_command_buffer_segments[ASYNC_COMPUTE_SEGMENT_MAX] = {};
+		VkCommandPool compute_command_pool = VK_NULL_HANDLE;
+		VkCommandBuffer async_compute_command_buffer = VK_NULL_HANDLE;
+
 		struct Timestamp {
 			String description;
 			uint64_t value = 0;
@@ -890,10 +940,47 @@ class RenderingDeviceVulkan : public RenderingDevice {
 		uint64_t *timestamp_result_values = nullptr;
 		uint32_t timestamp_result_count = 0;
 		uint64_t index = 0;
+
+		uint32_t split_draw_list_passes = 0; //split draw lists begun in this frame
 	};
 
 	uint32_t max_timestamp_query_elements = 0;
 
+	bool async_compute_enabled = false;
+	uint32_t shared_queue_families[3] = { 0, 0, 0 }; //graphics, compute and transfer when used, resources are shared by all of them
+	uint32_t shared_queue_family_count = 1;
+	AsyncComputeSegment async_compute_segment = ASYNC_COMPUTE_SEGMENT_BEFORE_FORK;
+	void _async_compute_next_segment();
+
+	/**********************/
+	/**** ASYNC UPLOAD ****/
+	/**********************/
+
+	// Uploads recorded into their own command buffer and submitted to the transfer queue right away,
+	// each with a fence so other threads can wait for them. The graphics queue waits for all
+	// uploads submitted before each of its submissions (see VulkanContext::submit_transfer_buffer).
+
+	struct PendingUpload {
+		RID resource;
+		VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+		VkFence fence = VK_NULL_HANDLE;
+		VkBuffer staging_buffer = VK_NULL_HANDLE;
+		VmaAllocation staging_allocation = nullptr;
+		uint32_t waiters = 0; //threads waiting on the fence, it can't be destroyed until they are done
+	};
+
+	bool async_upload_enabled = false;
+	VkCommandPool transfer_command_pool = VK_NULL_HANDLE;
+	List<PendingUpload> pending_uploads;
+
+	Error _upload_begin(uint32_t p_staging_size, PendingUpload &r_upload, uint8_t *&r_staging_ptr);
+	Error _upload_submit(RID p_resource, PendingUpload &p_upload);
+	void _upload_discard(PendingUpload &p_upload);
+	Error _texture_upload_async(RID p_texture, const Vector<Vector<uint8_t>> &p_data);
+	void _free_finished_uploads();
+
+	RID _texture_create(const TextureFormat &p_format, const TextureView &p_view, const Vector<Vector<uint8_t>> &p_data, bool p_async);
+
 	Frame *frames = nullptr; //frames available, for main device they are cycled (usually 3), for local devices only 1
 	int frame = 0; //current frame
 	int frame_count = 0; //total amount of frames
@@ -904,6 +991,13 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	void _free_pending_resources(int p_frame);
 
 	VmaAllocator allocator = nullptr;
+	bool memory_budget_supported = false;
+
+	uint64_t texture_memory = 0;
+	uint64_t render_texture_memory = 0;
+	uint64_t buffer_memory = 0;
+
+	uint64_t &_get_texture_memory_counter(uint32_t p_usage_flags);
 
 	VulkanContext *context = nullptr;
 
@@ -920,6 +1014,7 @@ class RenderingDeviceVulkan : public RenderingDevice {
 
 public:
 	virtual RID texture_create(const TextureFormat &p_format, const TextureView &p_view, const Vector<Vector<uint8_t>> &p_data = Vector<Vector<uint8_t>>());
+	virtual RID texture_create_async(const TextureFormat &p_format, const TextureView &p_view, const Vector<Vector<uint8_t>> &p_data);
 	virtual RID texture_create_shared(const TextureView &p_view, RID p_with_texture);
 
 	virtual RID texture_create_shared_from_slice(const TextureView &p_view, RID p_with_texture, uint32_t p_layer, uint32_t p_mipmap, TextureSliceType p_slice_type = TEXTURE_SLICE_2D);
@@ -986,6 +1081,7 @@ public:
 	virtual bool uniform_set_is_valid(RID p_uniform_set);
 
 	virtual Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, uint32_t p_post_barrier = BARRIER_MASK_ALL); //works for any buffer
+	virtual Error buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data);
 	virtual Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier = BARRIER_MASK_ALL);
 	virtual Vector<uint8_t> buffer_get_data(RID p_buffer);
 
@@ -993,14 +1089,14 @@ public:
 	/**** RENDER PIPELINE ****/
 	/*************************/
 
-	virtual RID render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, int p_dynamic_state_flags = 0);
+	virtual RID render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, int p_dynamic_state_flags = 0, const Vector<PipelineSpecializationConstant> &p_specialization_constants = Vector<PipelineSpecializationConstant>());
 	virtual bool render_pipeline_is_valid(RID p_pipeline);
 
 	/**************************/
 	/**** COMPUTE PIPELINE ****/
 	/**************************/
 
-	virtual RID compute_pipeline_create(RID p_shader);
+	virtual RID compute_pipeline_create(RID p_shader, const Vector<PipelineSpecializationConstant> &p_specialization_constants = Vector<PipelineSpecializationConstant>());
 	virtual bool compute_pipeline_is_valid(RID p_pipeline);
 
 	/****************/
@@ -1009,6 +1105,7 @@ public:
 
 	virtual int screen_get_width(DisplayServer::WindowID p_screen = 0) const;
 	virtual int screen_get_height(DisplayServer::WindowID p_screen = 0) const;
+	virtual int screen_get_pre_rotation(DisplayServer::WindowID p_screen = 0) const;
 	virtual FramebufferFormatID screen_get_framebuffer_format() const;
 
 	/********************/
@@ -1028,6 +1125,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size);
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0);
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0);
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect);
 	virtual void draw_list_disable_scissor(DrawListID p_list);
@@ -1038,7 +1136,7 @@ public:
 	/**** COMPUTE LISTS ****/
 	/***********************/
 
-	virtual ComputeListID compute_list_begin(bool p_allow_draw_overlap = false);
+	virtual ComputeListID compute_list_begin(bool p_allow_draw_overlap = false, bool p_async = false);
 	virtual void compute_list_bind_compute_pipeline(ComputeListID p_list, RID p_compute_pipeline);
 	virtual void compute_list_bind_uniform_set(ComputeListID p_list, RID p_uniform_set, uint32_t p_index);
 	virtual void compute_list_set_push_constant(ComputeListID p_list, const void *p_data, uint32_t p_data_size);
@@ -1052,6 +1150,14 @@ public:
 	virtual void barrier(uint32_t p_from = BARRIER_MASK_ALL, uint32_t p_to = BARRIER_MASK_ALL);
 	virtual void full_barrier();
 
+	virtual bool has_async_compute() const;
+	virtual bool async_compute_fork();
+	virtual void async_compute_join();
+
+	virtual bool has_async_upload() const;
+	virtual bool upload_is_finished(RID p_resource);
+	virtual void upload_wait(RID p_resource);
+
 	/**************/
 	/**** FREE ****/
 	/**************/
@@ -1088,7 +1194,8 @@ public:
 
 	virtual RenderingDevice *create_local_device();
 
-	virtual uint64_t get_memory_usage() const;
+	virtual uint64_t get_memory_usage(MemoryType p_type) const;
+	virtual uint64_t get_memory_budget() const;
 
 	virtual void set_resource_name(RID p_id, const String p_name);
 
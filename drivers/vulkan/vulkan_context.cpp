@@ -240,6 +240,7 @@ Error VulkanContext::_initialize_extensions() {
 	enabled_extension_count = 0;
 	enabled_layer_count = 0;
 	enabled_debug_utils = false;
+	enabled_physical_device_properties2 = false;
 	/* Look for instance extensions */
 	VkBool32 surfaceExtFound = 0;
 	VkBool32 platformSurfaceExtFound = 0;
@@ -274,6 +275,11 @@ Error VulkanContext::_initialize_extensions() {
 				extension_names[enabled_extension_count++] = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
 				enabled_debug_utils = true;
 			}
+			if (!strcmp(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, instance_extensions[i].extensionName)) {
+				// Needed by VK_EXT_memory_budget on Vulkan 1.0 instances.
+				extension_names[enabled_extension_count++] = VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME;
+				enabled_physical_device_properties2 = true;
+			}
 			if (enabled_extension_count >= MAX_EXTENSIONS) {
 				free(instance_extensions);
 				ERR_FAIL_V_MSG(ERR_BUG, "Enabled extension count reaches MAX_EXTENSIONS, BUG");
@@ -388,6 +394,7 @@ Error VulkanContext::_create_physical_device() {
 	uint32_t device_extension_count = 0;
 	VkBool32 swapchainExtFound = 0;
 	enabled_extension_count = 0;
+	enabled_memory_budget = false;
 	memset(extension_names, 0, sizeof(extension_names));
 
 	/* Get identifier properties */
@@ -440,6 +447,10 @@ Error VulkanContext::_create_physical_device() {
 				swapchainExtFound = 1;
 				extension_names[enabled_extension_count++] = VK_KHR_SWAPCHAIN_EXTENSION_NAME;
 			}
+			if (!strcmp(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, device_extensions[i].extensionName) && enabled_physical_device_properties2) {
+				extension_names[enabled_extension_count++] = VK_EXT_MEMORY_BUDGET_EXTENSION_NAME;
+				enabled_memory_budget = true;
+			}
 			if (enabled_extension_count >= MAX_EXTENSIONS) {
 				free(device_extensions);
 				ERR_FAIL_V_MSG(ERR_BUG, "Enabled extension count reaches MAX_EXTENSIONS, BUG");
@@ -567,7 +578,7 @@ Error VulkanContext::_create_physical_device() {
 Error VulkanContext::_create_device() {
 	VkResult err;
 	float queue_priorities[1] = { 0.0 };
-	VkDeviceQueueCreateInfo queues[2];
+	VkDeviceQueueCreateInfo queues[4];
 	queues[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 	queues[0].pNext = nullptr;
 	queues[0].queueFamilyIndex = graphics_queue_family_index;
@@ -597,6 +608,26 @@ Error VulkanContext::_create_device() {
 		queues[1].flags = 0;
 		sdevice.queueCreateInfoCount = 2;
 	}
+	if (separate_compute_queue) {
+		VkDeviceQueueCreateInfo &compute_queue_info = queues[sdevice.queueCreateInfoCount];
+		compute_queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+		compute_queue_info.pNext = nullptr;
+		compute_queue_info.queueFamilyIndex = compute_queue_family_index;
+		compute_queue_info.queueCount = 1;
+		compute_queue_info.pQueuePriorities = queue_priorities;
+		compute_queue_info.flags = 0;
+		sdevice.queueCreateInfoCount++;
+	}
+	if (separate_transfer_queue) {
+		VkDeviceQueueCreateInfo &transfer_queue_info = queues[sdevice.queueCreateInfoCount];
+		transfer_queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+		transfer_queue_info.pNext = nullptr;
+		transfer_queue_info.queueFamilyIndex = transfer_queue_family_index;
+		transfer_queue_info.queueCount = 1;
+		transfer_queue_info.pQueuePriorities = queue_priorities;
+		transfer_queue_info.flags = 0;
+		sdevice.queueCreateInfoCount++;
+	}
 	err = vkCreateDevice(gpu, &sdevice, nullptr, &device);
 	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 
@@ -649,6 +680,27 @@ Error VulkanContext::_initialize_queues(VkSurfaceKHR surface) {
 	present_queue_family_index = presentQueueFamilyIndex;
 	separate_present_queue = (graphics_queue_family_index != present_queue_family_index);
 
+	// Look for a compute family that does not do graphics, work submitted there can run
+	// on the GPU at the same time as raster work on the graphics queue.
+	separate_compute_queue = false;
+	for (uint32_t i = 0; i < queue_family_count; i++) {
+		if ((queue_props[i].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0 && (queue_props[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0) {
+			compute_queue_family_index = i;
+			separate_compute_queue = i != present_queue_family_index;
+			break;
+		}
+	}
+
+	// Same for a transfer only family (usually a DMA engine), uploads there don't take time from the graphics queue.
+	separate_transfer_queue = false;
+	for (uint32_t i = 0; i < queue_family_count; i++) {
+		if ((queue_props[i].queueFlags & VK_QUEUE_TRANSFER_BIT) != 0 && (queue_props[i].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0) {
+			transfer_queue_family_index = i;
+			separate_transfer_queue = i != present_queue_family_index;
+			break;
+		}
+	}
+
 	_create_device();
 
 	static PFN_vkGetDeviceProcAddr g_gdpa = nullptr;
@@ -679,6 +731,14 @@ Error VulkanContext::_initialize_queues(VkSurfaceKHR surface) {
 		vkGetDeviceQueue(device, present_queue_family_index, 0, &present_queue);
 	}
 
+	if (separate_compute_queue) {
+		vkGetDeviceQueue(device, compute_queue_family_index, 0, &compute_queue);
+	}
+
+	if (separate_transfer_queue) {
+		vkGetDeviceQueue(device, transfer_queue_family_index, 0, &transfer_queue);
+	}
+
 	// Get the list of VkFormat's that are supported:
 	uint32_t formatCount;
 	VkResult err = fpGetPhysicalDeviceSurfaceFormatsKHR(gpu, surface, &formatCount, nullptr);
@@ -746,6 +806,14 @@ Error VulkanContext::_create_semaphores() {
 			err = vkCreateSemaphore(device, &semaphoreCreateInfo, nullptr, &image_ownership_semaphores[i]);
 			ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 		}
+
+		if (separate_compute_queue) {
+			err = vkCreateSemaphore(device, &semaphoreCreateInfo, nullptr, &compute_fork_semaphores[i]);
+			ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
+
+			err = vkCreateSemaphore(device, &semaphoreCreateInfo, nullptr, &compute_complete_semaphores[i]);
+			ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
+		}
 	}
 	frame_index = 0;
 
@@ -794,6 +862,11 @@ int VulkanContext::window_get_height(DisplayServer::WindowID p_window) {
 	return windows[p_window].height;
 }
 
+int VulkanContext::window_get_pre_rotation(DisplayServer::WindowID p_window) {
+	ERR_FAIL_COND_V(!windows.has(p_window), 0);
+	return windows[p_window].pre_rotation;
+}
+
 VkRenderPass VulkanContext::window_get_render_pass(DisplayServer::WindowID p_window) {
 	ERR_FAIL_COND_V(!windows.has(p_window), VK_NULL_HANDLE);
 	Window *w = &windows[p_window];
@@ -853,6 +926,28 @@ Error VulkanContext::_update_swap_chain(Window *window) {
 	err = fpGetPhysicalDeviceSurfaceCapabilitiesKHR(gpu, window->surface, &surfCapabilities);
 	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 
+	// When the display is rotated (mobile devices in landscape), create the swapchain in the display's
+	// native orientation and rotate in the final blit, so the compositor doesn't need a rotation pass.
+	window->pre_rotation = 0;
+	if (surfCapabilities.currentExtent.width != 0xFFFFFFFF) {
+		switch (surfCapabilities.currentTransform) {
+			case VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR:
+				window->pre_rotation = 90;
+				break;
+			case VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR:
+				window->pre_rotation = 180;
+				break;
+			case VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR:
+				window->pre_rotation = 270;
+				break;
+			default:
+				break;
+		}
+		if (window->pre_rotation == 90 || window->pre_rotation == 270) {
+			SWAP(surfCapabilities.currentExtent.width, surfCapabilities.currentExtent.height);
+		}
+	}
+
 	uint32_t presentModeCount;
 	err = fpGetPhysicalDeviceSurfacePresentModesKHR(gpu, window->surface, &presentModeCount, nullptr);
 	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
@@ -953,7 +1048,7 @@ Error VulkanContext::_update_swap_chain(Window *window) {
 	}
 
 	VkSurfaceTransformFlagsKHR preTransform;
-	if (surfCapabilities.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR) {
+	if (window->pre_rotation == 0 && (surfCapabilities.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR)) {
 		preTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
 	} else {
 		preTransform = surfCapabilities.currentTransform;
@@ -1001,6 +1096,18 @@ Error VulkanContext::_update_swap_chain(Window *window) {
 	err = fpCreateSwapchainKHR(device, &swapchain_ci, nullptr, &window->swapchain);
 	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 
+	// Pacing only makes sense when presents are throttled to the display.
+	window->refresh_duration = 0;
+	window->swap_interval = 1;
+	window->prev_desired_present_time = 0;
+	window->frames_early = 0;
+	if (VK_GOOGLE_display_timing_enabled && swapchainPresentMode == VK_PRESENT_MODE_FIFO_KHR) {
+		VkRefreshCycleDurationGOOGLE refresh_cycle;
+		if (fpGetRefreshCycleDurationGOOGLE(device, window->swapchain, &refresh_cycle) == VK_SUCCESS) {
+			window->refresh_duration = refresh_cycle.refreshDuration;
+		}
+	}
+
 	uint32_t sp_image_count;
 	err = fpGetSwapchainImagesKHR(device, window->swapchain, &sp_image_count, nullptr);
 	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
@@ -1207,10 +1314,186 @@ void VulkanContext::append_command_buffer(const VkCommandBuffer &pCommandBuffer)
 	command_buffer_count++;
 }
 
+void VulkanContext::set_async_compute_buffer(const VkCommandBuffer &pCommandBuffer) {
+	ERR_FAIL_COND(!separate_compute_queue);
+	async_compute_command_buffer = pCommandBuffer;
+}
+
+void VulkanContext::mark_async_compute_fork() {
+	// Command buffers appended from now on may run at the same time as async compute.
+	async_compute_fork_index = command_buffer_count;
+}
+
+void VulkanContext::mark_async_compute_join() {
+	// Command buffers appended from now on wait until async compute is done.
+	async_compute_join_index = command_buffer_count;
+}
+
+Error VulkanContext::submit_transfer_buffer(const VkCommandBuffer &pCommandBuffer, VkFence p_fence) {
+	ERR_FAIL_COND_V(!separate_transfer_queue, ERR_UNAVAILABLE);
+
+	MutexLock lock(transfer_mutex);
+
+	VkSemaphore semaphore;
+	if (transfer_semaphores_free.size()) {
+		semaphore = transfer_semaphores_free[transfer_semaphores_free.size() - 1];
+		transfer_semaphores_free.resize(transfer_semaphores_free.size() - 1);
+	} else {
+		VkSemaphoreCreateInfo semaphore_create_info = {
+			/*sType*/ VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+			/*pNext*/ nullptr,
+			/*flags*/ 0,
+		};
+		VkResult err = vkCreateSemaphore(device, &semaphore_create_info, nullptr, &semaphore);
+		ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
+	}
+
+	VkSubmitInfo submit_info;
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext = nullptr;
+	submit_info.waitSemaphoreCount = 0;
+	submit_info.pWaitSemaphores = nullptr;
+	submit_info.pWaitDstStageMask = nullptr;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &pCommandBuffer;
+	submit_info.signalSemaphoreCount = 1;
+	submit_info.pSignalSemaphores = &semaphore;
+	VkResult err = vkQueueSubmit(transfer_queue, 1, &submit_info, p_fence);
+	if (err) {
+		transfer_semaphores_free.push_back(semaphore);
+		ERR_FAIL_V(ERR_CANT_CREATE);
+	}
+
+	transfer_wait_semaphores.push_back(semaphore);
+	return OK;
+}
+
+Error VulkanContext::_submit_command_buffers(const VkSemaphore *p_wait_semaphore, VkPipelineStageFlags p_wait_stage, const VkSemaphore *p_signal_semaphore, VkFence p_fence) {
+	//no setup command, submit from the first draw command
+	uint32_t first = command_buffer_queue[0] == nullptr ? 1 : 0;
+	const VkCommandBuffer *commands = command_buffer_queue.ptr();
+
+	VkSubmitInfo submit_info;
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext = nullptr;
+
+	//uploads done on the transfer queue must finish before anything submitted here uses them
+	MutexLock lock(transfer_mutex);
+	Vector<VkSemaphore> transfer_waits = transfer_wait_semaphores;
+	transfer_semaphores_in_flight[frame_index].append_array(transfer_wait_semaphores);
+	transfer_wait_semaphores.clear();
+	uint32_t transfer_wait_count = transfer_waits.size();
+
+	Vector<VkSemaphore> first_wait_semaphores;
+	Vector<VkPipelineStageFlags> first_wait_stages;
+	if (p_wait_semaphore) {
+		first_wait_semaphores.push_back(*p_wait_semaphore);
+		first_wait_stages.push_back(p_wait_stage);
+	}
+	for (uint32_t i = 0; i < transfer_wait_count; i++) {
+		first_wait_semaphores.push_back(transfer_waits[i]);
+		first_wait_stages.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+	}
+
+	if (async_compute_command_buffer == VK_NULL_HANDLE) {
+		submit_info.waitSemaphoreCount = first_wait_semaphores.size();
+		submit_info.pWaitSemaphores = first_wait_semaphores.ptr();
+		submit_info.pWaitDstStageMask = first_wait_stages.ptr();
+		submit_info.commandBufferCount = command_buffer_count - first;
+		submit_info.pCommandBuffers = commands + first;
+		submit_info.signalSemaphoreCount = p_signal_semaphore ? 1 : 0;
+		submit_info.pSignalSemaphores = p_signal_semaphore;
+		VkResult err = vkQueueSubmit(graphics_queue, 1, &submit_info, p_fence);
+		ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
+		return OK;
+	}
+
+	uint32_t fork = async_compute_fork_index < 0 ? 1 : async_compute_fork_index;
+	uint32_t join = async_compute_join_index < 0 ? command_buffer_count : async_compute_join_index;
+	fork = MAX(fork, first);
+	join = MAX(join, fork);
+
+	// Graphics work before the fork signals the compute queue, work between fork and join overlaps with it.
+	VkSubmitInfo graphics_submits[2];
+	graphics_submits[0] = submit_info;
+	graphics_submits[0].waitSemaphoreCount = transfer_wait_count;
+	graphics_submits[0].pWaitSemaphores = transfer_wait_count ? transfer_waits.ptr() : nullptr;
+	graphics_submits[0].pWaitDstStageMask = transfer_wait_count ? first_wait_stages.ptr() + (p_wait_semaphore ? 1 : 0) : nullptr;
+	graphics_submits[0].commandBufferCount = fork - first;
+	graphics_submits[0].pCommandBuffers = commands + first;
+	graphics_submits[0].signalSemaphoreCount = 1;
+	graphics_submits[0].pSignalSemaphores = &compute_fork_semaphores[frame_index];
+
+	graphics_submits[1] = graphics_submits[0];
+	graphics_submits[1].waitSemaphoreCount = 0;
+	graphics_submits[1].pWaitSemaphores = nullptr;
+	graphics_submits[1].pWaitDstStageMask = nullptr;
+	graphics_submits[1].commandBufferCount = join - fork;
+	graphics_submits[1].pCommandBuffers = commands + fork;
+	graphics_submits[1].signalSemaphoreCount = 0;
+	graphics_submits[1].pSignalSemaphores = nullptr;
+
+	VkResult err = vkQueueSubmit(graphics_queue, join > fork ? 2 : 1, graphics_submits, VK_NULL_HANDLE);
+	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
+
+	VkPipelineStageFlags compute_wait_stage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+	submit_info.waitSemaphoreCount = 1;
+	submit_info.pWaitSemaphores = &compute_fork_semaphores[frame_index];
+	submit_info.pWaitDstStageMask = &compute_wait_stage;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &async_compute_command_buffer;
+	submit_info.signalSemaphoreCount = 1;
+	submit_info.pSignalSemaphores = &compute_complete_semaphores[frame_index];
+	err = vkQueueSubmit(compute_queue, 1, &submit_info, VK_NULL_HANDLE);
+	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
+
+	// Everything after the join waits for async compute, the fence then also covers the compute queue.
+	VkSemaphore wait_semaphores[2] = { compute_complete_semaphores[frame_index], VK_NULL_HANDLE };
+	VkPipelineStageFlags wait_stages[2] = { VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, p_wait_stage };
+	submit_info.waitSemaphoreCount = 1;
+	if (p_wait_semaphore) {
+		wait_semaphores[1] = *p_wait_semaphore;
+		submit_info.waitSemaphoreCount++;
+	}
+	submit_info.pWaitSemaphores = wait_semaphores;
+	submit_info.pWaitDstStageMask = wait_stages;
+	submit_info.commandBufferCount = command_buffer_count - join;
+	submit_info.pCommandBuffers = commands + join;
+	submit_info.signalSemaphoreCount = p_signal_semaphore ? 1 : 0;
+	submit_info.pSignalSemaphores = p_signal_semaphore;
+	err = vkQueueSubmit(graphics_queue, 1, &submit_info, p_fence);
+	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
+
+	async_compute_command_buffer = VK_NULL_HANDLE;
+	async_compute_fork_index = -1;
+	async_compute_join_index = -1;
+
+	return OK;
+}
+
 void VulkanContext::flush(bool p_flush_setup, bool p_flush_pending) {
 	// ensure everything else pending is executed
 	vkDeviceWaitIdle(device);
 
+	{
+		//the device is idle, so uploads are done and their semaphores can be dropped instead of waited on
+		MutexLock lock(transfer_mutex);
+		for (int i = 0; i < transfer_wait_semaphores.size(); i++) {
+			vkDestroySemaphore(device, transfer_wait_semaphores[i], nullptr);
+		}
+		transfer_wait_semaphores.clear();
+	}
+
+	if (p_flush_setup && p_flush_pending && async_compute_command_buffer) {
+		//async compute needs the same fork and join ordering as a regular frame
+		Error err = _submit_command_buffers(nullptr, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, nullptr, VK_NULL_HANDLE);
+		command_buffer_queue.write[0] = nullptr;
+		command_buffer_count = 1;
+		ERR_FAIL_COND(err != OK);
+		vkDeviceWaitIdle(device);
+		return;
+	}
+
 	//flush the pending setup buffer
 
 	if (p_flush_setup && command_buffer_queue[0]) {
@@ -1263,6 +1546,13 @@ Error VulkanContext::prepare_buffers() {
 	vkWaitForFences(device, 1, &fences[frame_index], VK_TRUE, UINT64_MAX);
 	vkResetFences(device, 1, &fences[frame_index]);
 
+	{
+		//the frame waited on these, so they are unsignaled and can be reused
+		MutexLock lock(transfer_mutex);
+		transfer_semaphores_free.append_array(transfer_semaphores_in_flight[frame_index]);
+		transfer_semaphores_in_flight[frame_index].clear();
+	}
+
 	for (Map<int, Window>::Element *E = windows.front(); E; E = E->next()) {
 		Window *w = &E->get();
 
@@ -1298,6 +1588,63 @@ Error VulkanContext::prepare_buffers() {
 	return OK;
 }
 
+VkPresentTimeGOOGLE VulkanContext::_pace_present(Window *p_window) {
+	VkPresentTimeGOOGLE present_time;
+	present_time.presentID = p_window->next_present_id++;
+	present_time.desiredPresentTime = 0; // Present as soon as possible.
+
+	if (p_window->refresh_duration == 0) {
+		return present_time;
+	}
+
+	// Frames are presented every swap_interval refreshes, so they are shown for the same time even
+	// when rendering can't keep up with the display. Missing a present makes the interval longer,
+	// frames that are consistently ready a refresh early make it shorter again.
+	uint32_t timing_count = 0;
+	fpGetPastPresentationTimingGOOGLE(device, p_window->swapchain, &timing_count, nullptr);
+	if (timing_count > 0) {
+		Vector<VkPastPresentationTimingGOOGLE> timings;
+		timings.resize(timing_count);
+		fpGetPastPresentationTimingGOOGLE(device, p_window->swapchain, &timing_count, timings.ptrw());
+
+		bool late = false;
+		for (uint32_t i = 0; i < timing_count; i++) {
+			const VkPastPresentationTimingGOOGLE &timing = timings[i];
+			if (timing.desiredPresentTime != 0 && timing.actualPresentTime > timing.desiredPresentTime + p_window->refresh_duration / 2) {
+				late = true;
+			} else if (timing.presentMargin > p_window->refresh_duration) {
+				p_window->frames_early++;
+			} else {
+				p_window->frames_early = 0;
+			}
+		}
+
+		const VkPastPresentationTimingGOOGLE &last = timings[timing_count - 1];
+		if (late) {
+			p_window->swap_interval = MIN(p_window->swap_interval + 1, (uint32_t)FRAME_PACING_MAX_SWAP_INTERVAL);
+			p_window->frames_early = 0;
+		} else if (p_window->frames_early >= FRAME_PACING_EARLY_FRAMES && p_window->swap_interval > 1) {
+			p_window->swap_interval--;
+			p_window->frames_early = 0;
+			late = true; // Anchor again with the new interval.
+		}
+
+		if (late || p_window->prev_desired_present_time == 0) {
+			// Continue from when the last frame was actually shown.
+			uint64_t frames_since = present_time.presentID - last.presentID - 1;
+			p_window->prev_desired_present_time = last.actualPresentTime + frames_since * p_window->refresh_duration * p_window->swap_interval;
+		}
+	}
+
+	if (p_window->prev_desired_present_time == 0) {
+		return present_time; // No timing known yet.
+	}
+
+	present_time.desiredPresentTime = p_window->prev_desired_present_time + p_window->refresh_duration * p_window->swap_interval;
+	p_window->prev_desired_present_time = present_time.desiredPresentTime;
+	return present_time;
+}
+
 Error VulkanContext::swap_buffers() {
 	if (!queues_initialized) {
 		return OK;
@@ -1306,55 +1653,23 @@ Error VulkanContext::swap_buffers() {
 	//	print_line("swapbuffers?");
 	VkResult err;
 
-#if 0
-	if (VK_GOOGLE_display_timing_enabled) {
-		// Look at what happened to previous presents, and make appropriate
-		// adjustments in timing:
-		DemoUpdateTargetIPD(demo);
-
-		// Note: a real application would position its geometry to that it's in
-		// the correct locatoin for when the next image is presented.  It might
-		// also wait, so that there's less latency between any input and when
-		// the next image is rendered/presented.  This demo program is so
-		// simple that it doesn't do either of those.
-	}
-#endif
 	// Wait for the image acquired semaphore to be signaled to ensure
 	// that the image won't be rendered to until the presentation
 	// engine has fully released ownership to the application, and it is
 	// okay to render to the image.
 
-	const VkCommandBuffer *commands_ptr = nullptr;
-	uint32_t commands_to_submit = 0;
+	Error submit_err = _submit_command_buffers(&image_acquired_semaphores[frame_index], VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, &draw_complete_semaphores[frame_index], fences[frame_index]);
 
-	if (command_buffer_queue[0] == nullptr) {
-		//no setup command, but commands to submit, submit from the first and skip command
-		if (command_buffer_count > 1) {
-			commands_ptr = command_buffer_queue.ptr() + 1;
-			commands_to_submit = command_buffer_count - 1;
-		}
-	} else {
-		commands_ptr = command_buffer_queue.ptr();
-		commands_to_submit = command_buffer_count;
-	}
+	command_buffer_queue.write[0] = nullptr;
+	command_buffer_count = 1;
+
+	ERR_FAIL_COND_V(submit_err != OK, ERR_CANT_CREATE);
 
 	VkPipelineStageFlags pipe_stage_flags;
 	VkSubmitInfo submit_info;
 	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 	submit_info.pNext = nullptr;
 	submit_info.pWaitDstStageMask = &pipe_stage_flags;
-	pipe_stage_flags = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-	submit_info.waitSemaphoreCount = 1;
-	submit_info.pWaitSemaphores = &image_acquired_semaphores[frame_index];
-	submit_info.commandBufferCount = commands_to_submit;
-	submit_info.pCommandBuffers = commands_ptr;
-	submit_info.signalSemaphoreCount = 1;
-	submit_info.pSignalSemaphores = &draw_complete_semaphores[frame_index];
-	err = vkQueueSubmit(graphics_queue, 1, &submit_info, fences[frame_index]);
-	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
-
-	command_buffer_queue.write[0] = nullptr;
-	command_buffer_count = 1;
 
 	if (separate_present_queue) {
 		// If we are using separate queues, change image ownership to the
@@ -1446,42 +1761,22 @@ Error VulkanContext::swap_buffers() {
 	}
 #endif
 
-#if 0
+	VkPresentTimesInfoGOOGLE present_times_info;
 	if (VK_GOOGLE_display_timing_enabled) {
-		VkPresentTimeGOOGLE ptime;
-		if (prev_desired_present_time == 0) {
-			// This must be the first present for this swapchain.
-			//
-			// We don't know where we are relative to the presentation engine's
-			// display's refresh cycle.  We also don't know how long rendering
-			// takes.  Let's make a grossly-simplified assumption that the
-			// desiredPresentTime should be half way between now and
-			// now+target_IPD.  We will adjust over time.
-			uint64_t curtime = getTimeInNanoseconds();
-			if (curtime == 0) {
-				// Since we didn't find out the current time, don't give a
-				// desiredPresentTime:
-				ptime.desiredPresentTime = 0;
-			} else {
-				ptime.desiredPresentTime = curtime + (target_IPD >> 1);
+		VkPresentTimeGOOGLE *present_times = (VkPresentTimeGOOGLE *)alloca(sizeof(VkPresentTimeGOOGLE) * windows.size());
+		uint32_t present_count = 0;
+		for (Map<int, Window>::Element *E = windows.front(); E; E = E->next()) {
+			if (E->get().swapchain != VK_NULL_HANDLE) {
+				present_times[present_count++] = _pace_present(&E->get());
 			}
-		} else {
-			ptime.desiredPresentTime = (prev_desired_present_time + target_IPD);
 		}
-		ptime.presentID = next_present_id++;
-		prev_desired_present_time = ptime.desiredPresentTime;
 
-		VkPresentTimesInfoGOOGLE present_time = {
-			/*sType*/ VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE,
-			/*pNext*/ present.pNext,
-			/*swapchainCount*/ present.swapchainCount,
-			/*pTimes*/ &ptime,
-		};
-		if (VK_GOOGLE_display_timing_enabled) {
-			present.pNext = &present_time;
-		}
+		present_times_info.sType = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE;
+		present_times_info.pNext = present.pNext;
+		present_times_info.swapchainCount = present_count;
+		present_times_info.pTimes = present_times;
+		present.pNext = &present_times_info;
 	}
-#endif
 	static int total_frames = 0;
 	total_frames++;
 	//	print_line("current buffer:  " + itos(current_buffer));
@@ -1526,6 +1821,30 @@ uint32_t VulkanContext::get_graphics_queue() const {
 	return graphics_queue_family_index;
 }
 
+uint32_t VulkanContext::get_compute_queue() const {
+	return compute_queue_family_index;
+}
+
+bool VulkanContext::has_async_compute_queue() const {
+	return separate_compute_queue;
+}
+
+uint32_t VulkanContext::get_transfer_queue() const {
+	return transfer_queue_family_index;
+}
+
+bool VulkanContext::has_transfer_queue() const {
+	return separate_transfer_queue;
+}
+
+VkInstance VulkanContext::get_instance() const {
+	return inst;
+}
+
+bool VulkanContext::is_memory_budget_supported() const {
+	return enabled_memory_budget;
+}
+
 VkFormat VulkanContext::get_screen_format() const {
 	return format;
 }
@@ -1534,6 +1853,10 @@ VkPhysicalDeviceLimits VulkanContext::get_device_limits() const {
 	return gpu_props.limits;
 }
 
+VkPhysicalDeviceProperties VulkanContext::get_device_properties() const {
+	return gpu_props;
+}
+
 RID VulkanContext::local_device_create() {
 	LocalDevice ld;
 
@@ -1704,6 +2027,19 @@ VulkanContext::~VulkanContext() {
 			if (separate_present_queue) {
 				vkDestroySemaphore(device, image_ownership_semaphores[i], nullptr);
 			}
+			if (separate_compute_queue) {
+				vkDestroySemaphore(device, compute_fork_semaphores[i], nullptr);
+				vkDestroySemaphore(device, compute_complete_semaphores[i], nullptr);
+			}
+			for (int j = 0; j < transfer_semaphores_in_flight[i].size(); j++) {
+				vkDestroySemaphore(device, transfer_semaphores_in_flight[i][j], nullptr);
+			}
+		}
+		for (int i = 0; i < transfer_wait_semaphores.size(); i++) {
+			vkDestroySemaphore(device, transfer_wait_semaphores[i], nullptr);
+		}
+		for (int i = 0; i < transfer_semaphores_free.size(); i++) {
+			vkDestroySemaphore(device, transfer_semaphores_free[i], nullptr);
 		}
 		if (inst_initialized && use_validation_layers) {
 			DestroyDebugUtilsMessengerEXT(inst, dbg_messenger, nullptr);
@@ -71,6 +71,23 @@ class VulkanContext {
 	bool separate_present_queue = false;
 	VkQueue graphics_queue = VK_NULL_HANDLE;
 	VkQueue present_queue = VK_NULL_HANDLE;
+
+	// Async compute queue, only used when the device exposes a compute family without graphics.
+	uint32_t compute_queue_family_index = 0;
+	bool separate_compute_queue = false;
+	VkQueue compute_queue = VK_NULL_HANDLE;
+	VkSemaphore compute_fork_semaphores[FRAME_LAG];
+	VkSemaphore compute_complete_semaphores[FRAME_LAG];
+
+	// Transfer queue for asynchronous uploads, only used when the device exposes a transfer only family.
+	// Each upload signals a semaphore, the next graphics submission waits for all of them.
+	uint32_t transfer_queue_family_index = 0;
+	bool separate_transfer_queue = false;
+	VkQueue transfer_queue = VK_NULL_HANDLE;
+	Mutex transfer_mutex;
+	Vector<VkSemaphore> transfer_wait_semaphores; // Signaled by uploads, not waited on yet.
+	Vector<VkSemaphore> transfer_semaphores_in_flight[FRAME_LAG]; // Waited on by the frame's submission.
+	Vector<VkSemaphore> transfer_semaphores_free;
 	VkColorSpaceKHR color_space;
 	VkFormat format;
 	VkSemaphore image_acquired_semaphores[FRAME_LAG];
@@ -98,6 +115,19 @@ class VulkanContext {
 		int height = 0;
 		VkCommandPool present_cmd_pool = VK_NULL_HANDLE; // For separate present queue.
 		VkRenderPass render_pass = VK_NULL_HANDLE;
+		int pre_rotation = 0; // Degrees the final blit rotates by, width and height are the swapchain's.
+
+		// Frame pacing with VK_GOOGLE_display_timing, see _pace_present().
+		uint64_t refresh_duration = 0; // Zero when not pacing.
+		uint32_t swap_interval = 1;
+		uint32_t next_present_id = 1;
+		uint64_t prev_desired_present_time = 0;
+		uint32_t frames_early = 0;
+	};
+
+	enum {
+		FRAME_PACING_MAX_SWAP_INTERVAL = 4,
+		FRAME_PACING_EARLY_FRAMES = 60, // Consecutive frames ready a refresh early before presenting more often.
 	};
 
 	struct LocalDevice {
@@ -118,6 +148,12 @@ class VulkanContext {
 	Vector<VkCommandBuffer> command_buffer_queue;
 	int command_buffer_count = 1;
 
+	// Command buffer submitted to the compute queue, along with the positions in command_buffer_queue
+	// where it may start (fork) and where graphics work has to wait for it to finish (join).
+	VkCommandBuffer async_compute_command_buffer = VK_NULL_HANDLE;
+	int async_compute_fork_index = -1;
+	int async_compute_join_index = -1;
+
 	// Extensions.
 
 	bool VK_KHR_incremental_present_enabled = true;
@@ -125,6 +161,8 @@ class VulkanContext {
 	uint32_t enabled_extension_count = 0;
 	const char *extension_names[MAX_EXTENSIONS];
 	bool enabled_debug_utils = false;
+	bool enabled_physical_device_properties2 = false;
+	bool enabled_memory_budget = false;
 
 	uint32_t enabled_layer_count = 0;
 	const char *enabled_layers[MAX_LAYERS];
@@ -169,10 +207,13 @@ class VulkanContext {
 	Error _clean_up_swap_chain(Window *window);
 
 	Error _update_swap_chain(Window *window);
+	VkPresentTimeGOOGLE _pace_present(Window *p_window);
 
 	Error _create_swap_chain();
 	Error _create_semaphores();
 
+	Error _submit_command_buffers(const VkSemaphore *p_wait_semaphore, VkPipelineStageFlags p_wait_stage, const VkSemaphore *p_signal_semaphore, VkFence p_fence);
+
 protected:
 	virtual const char *_get_platform_surface_extension() const = 0;
 
@@ -190,10 +231,17 @@ public:
 	VkPhysicalDevice get_physical_device();
 	int get_swapchain_image_count() const;
 	uint32_t get_graphics_queue() const;
+	uint32_t get_compute_queue() const;
+	bool has_async_compute_queue() const;
+	uint32_t get_transfer_queue() const;
+	bool has_transfer_queue() const;
+	VkInstance get_instance() const;
+	bool is_memory_budget_supported() const;
 
 	void window_resize(DisplayServer::WindowID p_window_id, int p_width, int p_height);
 	int window_get_width(DisplayServer::WindowID p_window = 0);
 	int window_get_height(DisplayServer::WindowID p_window = 0);
+	int window_get_pre_rotation(DisplayServer::WindowID p_window = 0);
 	void window_destroy(DisplayServer::WindowID p_window_id);
 	VkFramebuffer window_get_framebuffer(DisplayServer::WindowID p_window = 0);
 	VkRenderPass window_get_render_pass(DisplayServer::WindowID p_window = 0);
@@ -206,9 +254,14 @@ public:
 
 	VkFormat get_screen_format() const;
 	VkPhysicalDeviceLimits get_device_limits() const;
+	VkPhysicalDeviceProperties get_device_properties() const;
 
 	void set_setup_buffer(const VkCommandBuffer &pCommandBuffer);
 	void append_command_buffer(const VkCommandBuffer &pCommandBuffer);
+	void set_async_compute_buffer(const VkCommandBuffer &pCommandBuffer);
+	void mark_async_compute_fork();
+	void mark_async_compute_join();
+	Error submit_transfer_buffer(const VkCommandBuffer &pCommandBuffer, VkFence p_fence);
 	void resize_notify();
 	void flush(bool p_flush_setup = false, bool p_flush_pending = false);
 	Error prepare_buffers();
@@ -292,7 +292,15 @@ Error AudioDriverWASAPI::audio_device_init(AudioDeviceWASAPI *p_device, bool p_c
 		pwfex->nAvgBytesPerSec = pwfex->nSamplesPerSec * pwfex->nChannels * (pwfex->wBitsPerSample / 8);
 	}
 
-	hr = p_device->audio_client->Initialize(AUDCLNT_SHAREMODE_SHARED, streamflags, p_capture ? REFTIMES_PER_SEC : 0, 0, pwfex, nullptr);
+	// Ask for a render buffer matching the requested output latency, the
+	// system raises it to the minimum the audio engine supports.
+	REFERENCE_TIME buffer_duration = REFTIMES_PER_SEC;
+	if (!p_capture) {
+		int latency = GLOBAL_GET("audio/output_latency");
+		buffer_duration = REFERENCE_TIME(latency) * (REFTIMES_PER_SEC / 1000);
+	}
+
+	hr = p_device->audio_client->Initialize(AUDCLNT_SHAREMODE_SHARED, streamflags, buffer_duration, 0, pwfex, nullptr);
 	ERR_FAIL_COND_V_MSG(hr != S_OK, ERR_CANT_OPEN, "WASAPI: Initialize failed with error 0x" + String::num_uint64(hr, 16) + ".");
 
 	if (p_capture) {
@@ -332,7 +340,7 @@ Error AudioDriverWASAPI::init_render_device(bool reinit) {
 	HRESULT hr = audio_output.audio_client->GetBufferSize(&max_frames);
 	ERR_FAIL_COND_V(hr != S_OK, ERR_CANT_OPEN);
 
-	// Due to WASAPI Shared Mode we have no control of the buffer size
+	// In WASAPI Shared Mode the requested buffer duration is only a hint
 	buffer_frames = max_frames;
 
 	// Sample rate is independent of channels (ref: https://stackoverflow.com/questions/11048825/audio-sample-frequency-rely-on-channels)
@@ -397,7 +405,7 @@ Error AudioDriverWASAPI::init() {
 	exit_thread = false;
 	thread_exited = false;
 
-	thread.start(thread_func, this);
+	thread.start(thread_func, this, Thread::get_role_settings(Thread::ROLE_AUDIO));
 
 	return OK;
 }
@@ -42,8 +42,11 @@ class FileAccessWindows : public FileAccess {
 	FILE *f = nullptr;
 	int flags = 0;
 	void check_errors() const;
+	void _read(void *p_dst, size_t p_length) const;
 	mutable int prev_op = 0;
 	mutable Error last_error = OK;
+	void *mapping = nullptr; // HANDLE of the file mapping object.
+	void *mapped = nullptr;
 	String path;
 	String path_src;
 	String save_path;
@@ -64,7 +67,11 @@ public:
 	virtual bool eof_reached() const; ///< reading passed EOF
 
 	virtual uint8_t get_8() const; ///< get a byte
+	virtual uint16_t get_16() const; ///< get 16 bits uint
+	virtual uint32_t get_32() const; ///< get 32 bits uint
+	virtual uint64_t get_64() const; ///< get 64 bits uint
 	virtual int get_buffer(uint8_t *p_dst, int p_length) const;
+	virtual const uint8_t *map_read_only();
 
 	virtual Error get_error() const; ///< get last error
 
@@ -284,7 +284,7 @@ void EditorDebuggerNode::_notification(int p_what) {
 	if (remote_scene_tree_timeout < 0) {
 		remote_scene_tree_timeout = EditorSettings::get_singleton()->get("debugger/remote_scene_tree_refresh_interval");
 		if (remote_scene_tree->is_visible_in_tree()) {
-			get_current_debugger()->request_remote_tree();
+			get_current_debugger()->request_remote_tree(true);
 		}
 	}
 
@@ -293,7 +293,7 @@ void EditorDebuggerNode::_notification(int p_what) {
 	if (inspect_edited_object_timeout < 0) {
 		inspect_edited_object_timeout = EditorSettings::get_singleton()->get("debugger/remote_inspect_refresh_interval");
 		if (EditorDebuggerRemoteObject *obj = get_inspected_remote_object()) {
-			get_current_debugger()->request_remote_object(obj->remote_object_id);
+			get_current_debugger()->request_remote_object(obj->remote_object_id, true);
 		}
 	}
 
@@ -730,6 +730,7 @@ EditorProfiler::EditorProfiler() {
 	hover_metric = -1;
 
 	EDITOR_DEF("debugger/profiler_frame_max_functions", 64);
+	EDITOR_DEF("debugger/profiler_frame_sample_interval", 1);
 
 	frame_delay = memnew(Timer);
 	frame_delay->set_wait_time(0.1);
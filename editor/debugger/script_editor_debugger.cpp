@@ -31,6 +31,7 @@
 #include "script_editor_debugger.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/debugger/debugger_marshalls.h"
 #include "core/debugger/remote_debugger.h"
 #include "core/io/marshalls.h"
@@ -201,6 +202,16 @@ void ScriptEditorDebugger::_file_selected(const String &p_file) {
 				file->store_csv_line(profiler_data[i]);
 			}
 		} break;
+		case SAVE_CPU_TRACE: {
+			Error err;
+			FileAccessRef file = FileAccess::open(p_file, FileAccess::WRITE, &err);
+
+			if (err != OK) {
+				ERR_PRINT("Failed to open " + p_file);
+				return;
+			}
+			file->store_string(CPUProfiler::to_chrome_trace(cpu_trace_events));
+		} break;
 		case SAVE_VRAM_CSV: {
 			Error err;
 			FileAccessRef file = FileAccess::open(p_file, FileAccess::WRITE, &err);
@@ -234,8 +245,12 @@ void ScriptEditorDebugger::_file_selected(const String &p_file) {
 	}
 }
 
-void ScriptEditorDebugger::request_remote_tree() {
-	_put_msg("scene:request_scene_tree", Array());
+void ScriptEditorDebugger::request_remote_tree(bool p_if_changed) {
+	Array msg;
+	if (p_if_changed && remote_tree_hash) {
+		msg.push_back(remote_tree_hash); // The game doesn't answer if its tree still has this hash.
+	}
+	_put_msg("scene:request_scene_tree", msg);
 }
 
 const SceneDebuggerTree *ScriptEditorDebugger::get_remote_tree() {
@@ -250,10 +265,13 @@ void ScriptEditorDebugger::update_remote_object(ObjectID p_obj_id, const String
 	_put_msg("scene:set_object_property", msg);
 }
 
-void ScriptEditorDebugger::request_remote_object(ObjectID p_obj_id) {
+void ScriptEditorDebugger::request_remote_object(ObjectID p_obj_id, bool p_if_changed) {
 	ERR_FAIL_COND(p_obj_id.is_null());
 	Array msg;
 	msg.push_back(p_obj_id);
+	if (p_if_changed && remote_object_hash && remote_object_hash_id == p_obj_id) {
+		msg.push_back(remote_object_hash);
+	}
 	_put_msg("scene:inspect_object", msg);
 }
 
@@ -328,6 +346,7 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, const Array &p_da
 		clicked_ctrl->set_text(p_data[0]);
 		clicked_ctrl_type->set_text(p_data[1]);
 	} else if (p_msg == "scene:scene_tree") {
+		remote_tree_hash = p_data.hash();
 		scene_tree->nodes.clear();
 		scene_tree->deserialize(p_data);
 		emit_signal("remote_tree_updated");
@@ -335,6 +354,8 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, const Array &p_da
 	} else if (p_msg == "scene:inspect_object") {
 		ObjectID id = inspector->add_object(p_data);
 		if (id.is_valid()) {
+			remote_object_hash = p_data.hash();
+			remote_object_hash_id = id;
 			emit_signal("remote_object_updated", id);
 		}
 	} else if (p_msg == "memory:usage") {
@@ -429,6 +450,14 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, const Array &p_da
 		}
 		performance_profiler->add_profile_frame(frame_data);
 
+	} else if (p_msg == "cpu_trace:events") {
+		// Keep the last ~1M events (5 values each) recorded by the scoped CPU markers.
+		const int max_values = 5 * 1024 * 1024;
+		if (cpu_trace_events.size() + p_data.size() > max_values) {
+			cpu_trace_events = cpu_trace_events.slice(max_values / 2, cpu_trace_events.size() - 1);
+		}
+		cpu_trace_events.append_array(p_data);
+
 	} else if (p_msg == "visual:profile_frame") {
 		DebuggerMarshalls::VisualProfilerFrame frame;
 		frame.deserialize(p_data);
@@ -903,6 +932,9 @@ void ScriptEditorDebugger::stop() {
 	breaked = false;
 	can_debug = false;
 	remote_pid = 0;
+	remote_tree_hash = 0;
+	remote_object_hash = 0;
+	remote_object_hash_id = ObjectID();
 	_clear_execution();
 
 	inspector->clear_cache();
@@ -940,9 +972,18 @@ void ScriptEditorDebugger::_profiler_activate(bool p_enable, int p_type) {
 				Array opts;
 				int max_funcs = EditorSettings::get_singleton()->get("debugger/profiler_frame_max_functions");
 				opts.push_back(CLAMP(max_funcs, 16, 512));
+				int sample_interval = EditorSettings::get_singleton()->get("debugger/profiler_frame_sample_interval");
+				opts.push_back(CLAMP(sample_interval, 1, 60));
 				data.push_back(opts);
+				cpu_trace_events.clear();
 			}
 			_put_msg("profiler:servers", data);
+			{
+				// Record the engine's CPU markers together with the script and servers profiler.
+				Array cpu_trace_data;
+				cpu_trace_data.push_back(p_enable);
+				_put_msg("profiler:cpu_trace", cpu_trace_data);
+			}
 			break;
 		default:
 			ERR_FAIL_MSG("Invalid profiler type");
@@ -973,10 +1014,20 @@ void ScriptEditorDebugger::_stack_dump_frame_selected() {
 void ScriptEditorDebugger::_export_csv() {
 	file_dialog->set_file_mode(EditorFileDialog::FILE_MODE_SAVE_FILE);
 	file_dialog->set_access(EditorFileDialog::ACCESS_FILESYSTEM);
+	file_dialog->clear_filters();
 	file_dialog_purpose = SAVE_MONITORS_CSV;
 	file_dialog->popup_file_dialog();
 }
 
+void ScriptEditorDebugger::_export_cpu_trace() {
+	file_dialog->set_file_mode(EditorFileDialog::FILE_MODE_SAVE_FILE);
+	file_dialog->set_access(EditorFileDialog::ACCESS_FILESYSTEM);
+	file_dialog->clear_filters();
+	file_dialog->add_filter("*.json; " + TTR("Chrome Trace / Perfetto"));
+	file_dialog_purpose = SAVE_CPU_TRACE;
+	file_dialog->popup_file_dialog();
+}
+
 String ScriptEditorDebugger::get_var_value(const String &p_var) const {
 	if (!breaked) {
 		return String();
@@ -1422,7 +1473,7 @@ void ScriptEditorDebugger::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("live_debug_restore_node"), &ScriptEditorDebugger::live_debug_restore_node);
 	ClassDB::bind_method(D_METHOD("live_debug_duplicate_node"), &ScriptEditorDebugger::live_debug_duplicate_node);
 	ClassDB::bind_method(D_METHOD("live_debug_reparent_node"), &ScriptEditorDebugger::live_debug_reparent_node);
-	ClassDB::bind_method(D_METHOD("request_remote_object", "id"), &ScriptEditorDebugger::request_remote_object);
+	ClassDB::bind_method(D_METHOD("request_remote_object", "id", "if_changed"), &ScriptEditorDebugger::request_remote_object, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("update_remote_object", "id", "property", "value"), &ScriptEditorDebugger::update_remote_object);
 
 	ADD_SIGNAL(MethodInfo("started"));
@@ -1746,6 +1797,11 @@ ScriptEditorDebugger::ScriptEditorDebugger(EditorNode *p_editor) {
 		export_csv->connect("pressed", callable_mp(this, &ScriptEditorDebugger::_export_csv));
 		buttons->add_child(export_csv);
 
+		export_cpu_trace = memnew(Button(TTR("Export CPU trace")));
+		export_cpu_trace->set_tooltip(TTR("Save the engine CPU markers recorded while the profiler was running, for chrome://tracing or Perfetto."));
+		export_cpu_trace->connect("pressed", callable_mp(this, &ScriptEditorDebugger::_export_cpu_trace));
+		buttons->add_child(export_cpu_trace);
+
 		misc->add_child(buttons);
 	}
 
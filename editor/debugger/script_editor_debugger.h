@@ -82,6 +82,9 @@ private:
 	Button *le_set;
 	Button *le_clear;
 	Button *export_csv;
+	Button *export_cpu_trace;
+
+	Array cpu_trace_events;
 
 	VBoxContainer *errors_tab;
 	Tree *error_tree;
@@ -92,6 +95,7 @@ private:
 	enum FileDialogPurpose {
 		SAVE_MONITORS_CSV,
 		SAVE_VRAM_CSV,
+		SAVE_CPU_TRACE,
 	};
 	FileDialogPurpose file_dialog_purpose;
 
@@ -125,6 +129,9 @@ private:
 	Tree *stack_dump;
 	EditorDebuggerInspector *inspector;
 	SceneDebuggerTree *scene_tree;
+	uint32_t remote_tree_hash = 0; // Hash of the last received tree and inspected object, to skip unchanged updates.
+	uint32_t remote_object_hash = 0;
+	ObjectID remote_object_hash_id;
 
 	Ref<RemoteDebuggerPeer> peer;
 
@@ -191,6 +198,7 @@ private:
 
 	void _put_msg(String p_message, Array p_data);
 	void _export_csv();
+	void _export_cpu_trace();
 
 	void _clear_execution();
 	void _stop_and_notify();
@@ -200,14 +208,14 @@ protected:
 	static void _bind_methods();
 
 public:
-	void request_remote_object(ObjectID p_obj_id);
+	void request_remote_object(ObjectID p_obj_id, bool p_if_changed = false);
 	void update_remote_object(ObjectID p_obj_id, const String &p_prop, const Variant &p_value);
 	Object *get_remote_object(ObjectID p_id);
 
 	// Needed by _live_edit_set, buttons state.
 	void set_editor_remote_tree(const Tree *p_tree) { editor_remote_tree = p_tree; }
 
-	void request_remote_tree();
+	void request_remote_tree(bool p_if_changed = false);
 	const SceneDebuggerTree *get_remote_tree();
 
 	void start(Ref<RemoteDebuggerPeer> p_peer);
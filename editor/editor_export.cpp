@@ -33,14 +33,17 @@
 #include "core/config/project_settings.h"
 #include "core/crypto/crypto_core.h"
 #include "core/io/config_file.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/io/zip_io.h"
 #include "core/object/script_language.h"
 #include "core/os/dir_access.h"
 #include "core/os/file_access.h"
+#include "core/templates/thread_work_pool.h"
 #include "core/version.h"
 #include "editor/editor_file_system.h"
 #include "editor/plugins/script_editor_plugin.h"
@@ -300,68 +303,261 @@ void EditorExportPlatform::gen_debug_flags(Vector<String> &r_flags, int p_flags)
 	}
 }
 
-Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_path, const Vector<uint8_t> &p_data, int p_file, int p_total, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key) {
-	PackData *pd = (PackData *)p_userdata;
+// Checks that a cached file is complete: magic at both ends, the expected settings and
+// uncompressed size, a block table matching the file size, and blocks that all decompress.
+static bool _is_valid_pack_cache_file(const Vector<uint8_t> &p_data, uint32_t p_size) {
+	if (p_data.size() < 20) {
+		return false;
+	}
 
-	SavedData sd;
-	sd.path_utf8 = p_path.utf8();
-	sd.ofs = pd->f->get_position();
-	sd.size = p_data.size();
-	sd.encrypted = false;
+	const uint8_t *r = p_data.ptr();
+	CharString magic = String(PACK_FILE_COMPRESSED_MAGIC).ascii();
+	if (memcmp(r, magic.get_data(), 4) != 0 || memcmp(&r[p_data.size() - 4], magic.get_data(), 4) != 0) {
+		return false;
+	}
+	if (decode_uint32(&r[4]) != Compression::MODE_ZSTD || decode_uint32(&r[8]) != PACK_COMPRESSED_BLOCK_SIZE || decode_uint32(&r[12]) != p_size) {
+		return false;
+	}
 
-	for (int i = 0; i < p_enc_in_filters.size(); ++i) {
-		if (p_path.matchn(p_enc_in_filters[i]) || p_path.replace("res://", "").matchn(p_enc_in_filters[i])) {
-			sd.encrypted = true;
-			break;
+	uint32_t block_count = (p_size / PACK_COMPRESSED_BLOCK_SIZE) + 1;
+	uint64_t ofs = 16 + uint64_t(block_count) * 4;
+	if (ofs + 4 > uint64_t(p_data.size())) {
+		return false;
+	}
+
+	Vector<uint8_t> block;
+	block.resize(PACK_COMPRESSED_BLOCK_SIZE);
+	for (uint32_t i = 0; i < block_count; i++) {
+		uint32_t compressed_size = decode_uint32(&r[16 + i * 4]);
+		if (ofs + compressed_size + 4 > uint64_t(p_data.size())) {
+			return false;
+		}
+		int expected = i == block_count - 1 ? int(p_size % PACK_COMPRESSED_BLOCK_SIZE) : int(PACK_COMPRESSED_BLOCK_SIZE);
+		if (Compression::decompress(block.ptrw(), PACK_COMPRESSED_BLOCK_SIZE, &r[ofs], compressed_size, Compression::MODE_ZSTD) != expected) {
+			return false;
 		}
+		ofs += compressed_size;
 	}
 
-	for (int i = 0; i < p_enc_ex_filters.size(); ++i) {
-		if (p_path.matchn(p_enc_ex_filters[i]) || p_path.replace("res://", "").matchn(p_enc_ex_filters[i])) {
-			sd.encrypted = false;
-			break;
+	return ofs + 4 == uint64_t(p_data.size());
+}
+
+void EditorExportPlatform::PackData::hash_pending_file(uint32_t p_index, void *p_userdata) {
+	PendingFile &pf = pending.write[p_index];
+	CryptoCore::md5(pf.data.ptr(), pf.data.size(), pf.md5);
+}
+
+void EditorExportPlatform::PackData::process_pending_file(uint32_t p_index, void *p_userdata) {
+	PendingFile &pf = pending.write[p_index];
+
+	if (!pf.compressed || pf.duplicate_of >= 0) {
+		return;
+	}
+
+	if (pf.cache_file != String()) {
+		// The cache file name holds the hash of the source and the compression settings.
+		pf.cache_file = pf.cache_file.plus_file(String::hex_encode_buffer(pf.md5, 16) + "-" + itos(Compression::zstd_level) + "-" + itos(PACK_COMPRESSED_BLOCK_SIZE) + ".zst");
+		if (FileAccess::exists(pf.cache_file)) {
+			pf.compressed_data = FileAccess::get_file_as_array(pf.cache_file);
+			if (_is_valid_pack_cache_file(pf.compressed_data, pf.data.size())) {
+				return;
+			}
 		}
 	}
 
-	FileAccessEncrypted *fae = nullptr;
-	FileAccess *ftmp = pd->f;
+	pf.compressed_data = FileAccessCompressed::compress_buffer(pf.data.ptr(), pf.data.size(), PACK_FILE_COMPRESSED_MAGIC, Compression::MODE_ZSTD, PACK_COMPRESSED_BLOCK_SIZE);
 
-	if (sd.encrypted) {
-		fae = memnew(FileAccessEncrypted);
-		ERR_FAIL_COND_V(!fae, ERR_SKIP);
+	if (pf.cache_file != String() && !pf.compressed_data.is_empty()) {
+		// Write next to the final name and rename, so an interrupted export never leaves a partial cache file.
+		String tmp_file = pf.cache_file + ".tmp";
+		FileAccess *f = FileAccess::open(tmp_file, FileAccess::WRITE);
+		if (f) {
+			f->store_buffer(pf.compressed_data.ptr(), pf.compressed_data.size());
+			bool stored = f->get_error() == OK;
+			memdelete(f);
 
-		Error err = fae->open_and_parse(ftmp, p_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
-		ERR_FAIL_COND_V(err != OK, ERR_SKIP);
-		ftmp = fae;
+			DirAccessRef da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+			if (!stored || da->rename(tmp_file, pf.cache_file) != OK) {
+				da->remove(tmp_file);
+			}
+		}
 	}
+}
 
-	// Store file content.
-	ftmp->store_buffer(p_data.ptr(), p_data.size());
+Error EditorExportPlatform::_flush_pack_files(PackData *pd) {
+	const uint32_t pending_count = pd->pending.size();
+	if (pending_count == 0) {
+		return OK;
+	}
 
-	if (fae) {
-		fae->release();
-		memdelete(fae);
+	const uint32_t thread_count = OS::get_singleton()->can_use_threads() ? MIN(pending_count, (uint32_t)OS::get_singleton()->get_processor_count()) : 1;
+	ThreadWorkPool work_pool;
+	if (thread_count > 1) {
+		work_pool.init(thread_count);
+		work_pool.do_work(pending_count, pd, &PackData::hash_pending_file, (void *)nullptr);
+	} else {
+		for (uint32_t i = 0; i < pending_count; i++) {
+			pd->hash_pending_file(i, nullptr);
+		}
+	}
+
+	// Files with the same content would be compressed into the same cache file by two threads at once,
+	// only compress the first one and let the others share its data.
+	HashMap<String, int> compressed_by_md5;
+	for (uint32_t i = 0; i < pending_count; i++) {
+		PendingFile &pf = pd->pending.write[i];
+		if (!pf.compressed) {
+			continue;
+		}
+		String md5 = String::hex_encode_buffer(pf.md5, 16);
+		const int *first = compressed_by_md5.getptr(md5);
+		if (first) {
+			pf.duplicate_of = *first;
+		} else {
+			compressed_by_md5[md5] = i;
+		}
+	}
+
+	if (thread_count > 1) {
+		work_pool.do_work(pending_count, pd, &PackData::process_pending_file, (void *)nullptr);
+		work_pool.finish();
+	} else {
+		for (uint32_t i = 0; i < pending_count; i++) {
+			pd->process_pending_file(i, nullptr);
+		}
 	}
 
-	int pad = _get_pad(PCK_PADDING, pd->f->get_position());
-	for (int i = 0; i < pad; i++) {
-		pd->f->store_8(Math::rand() % 256);
+	for (uint32_t i = 0; i < pending_count; i++) {
+		PendingFile &pf = pd->pending.write[i];
+		if (pf.duplicate_of >= 0) {
+			const PendingFile &original = pd->pending[pf.duplicate_of];
+			pf.compressed_data = original.compressed_data;
+			pf.cache_file = original.cache_file;
+		}
 	}
 
-	// Store MD5 of original file.
-	{
-		unsigned char hash[16];
-		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
+	Error err = OK;
+	for (uint32_t p = 0; p < pending_count && err == OK; p++) {
+		const PendingFile &pf = pd->pending[p];
+
+		SavedData sd;
+		sd.path_utf8 = pf.path.utf8();
+		sd.ofs = pd->f->get_position();
+		sd.size = pf.data.size();
+		sd.encrypted = false;
+		sd.compressed = pf.compressed;
+
+		if (sd.compressed) {
+			ERR_FAIL_COND_V(pf.compressed_data.is_empty(), ERR_SKIP);
+			sd.size = pf.compressed_data.size();
+			if (pf.cache_file != String()) {
+				pd->used_cache_files.insert(pf.cache_file.get_file());
+			}
+		}
+
+		for (int i = 0; i < pf.enc_in_filters.size(); ++i) {
+			if (pf.path.matchn(pf.enc_in_filters[i]) || pf.path.replace("res://", "").matchn(pf.enc_in_filters[i])) {
+				sd.encrypted = true;
+				break;
+			}
+		}
+
+		for (int i = 0; i < pf.enc_ex_filters.size(); ++i) {
+			if (pf.path.matchn(pf.enc_ex_filters[i]) || pf.path.replace("res://", "").matchn(pf.enc_ex_filters[i])) {
+				sd.encrypted = false;
+				break;
+			}
+		}
+
+		FileAccessEncrypted *fae = nullptr;
+		FileAccess *ftmp = pd->f;
+
+		if (sd.encrypted) {
+			fae = memnew(FileAccessEncrypted);
+			ERR_FAIL_COND_V(!fae, ERR_SKIP);
+
+			Error enc_err = fae->open_and_parse(ftmp, pf.key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+			ERR_FAIL_COND_V(enc_err != OK, ERR_SKIP);
+			ftmp = fae;
+		}
+
+		// Store file content.
+		if (sd.compressed) {
+			ftmp->store_buffer(pf.compressed_data.ptr(), pf.compressed_data.size());
+		} else {
+			ftmp->store_buffer(pf.data.ptr(), pf.data.size());
+		}
+
+		if (fae) {
+			fae->release();
+			memdelete(fae);
+		}
+
+		int pad = _get_pad(PCK_PADDING, pd->f->get_position());
+		for (int i = 0; i < pad; i++) {
+			pd->f->store_8(Math::rand() % 256);
+		}
+
+		// Store MD5 of original file.
 		sd.md5.resize(16);
 		for (int i = 0; i < 16; i++) {
-			sd.md5.write[i] = hash[i];
+			sd.md5.write[i] = pf.md5[i];
+		}
+
+		pd->file_ofs.push_back(sd);
+
+		if (pd->ep->step(TTR("Storing File:") + " " + pf.path, 2 + pf.file * 100 / pf.total, false)) {
+			err = ERR_SKIP;
 		}
 	}
 
-	pd->file_ofs.push_back(sd);
+	pd->pending.clear();
+	pd->pending_size = 0;
 
-	if (pd->ep->step(TTR("Storing File:") + " " + p_path, 2 + p_file * 100 / p_total, false)) {
-		return ERR_SKIP;
+	return err;
+}
+
+void EditorExportPlatform::_prune_pack_cache(const PackData &p_pack_data) {
+	// Only keep what this export used, so the cache doesn't grow with every change.
+	DirAccessRef da = DirAccess::open(p_pack_data.cache_dir);
+	if (!da) {
+		return;
+	}
+
+	List<String> stale;
+	da->list_dir_begin();
+	String file = da->get_next();
+	while (file != String()) {
+		if (!da->current_is_dir() && ((file.ends_with(".zst") && !p_pack_data.used_cache_files.has(file)) || file.ends_with(".zst.tmp"))) {
+			stale.push_back(file);
+		}
+		file = da->get_next();
+	}
+	da->list_dir_end();
+
+	for (List<String>::Element *E = stale.front(); E; E = E->next()) {
+		da->remove(E->get());
+	}
+}
+
+Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_path, const Vector<uint8_t> &p_data, int p_file, int p_total, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key) {
+	PackData *pd = (PackData *)p_userdata;
+
+	PendingFile pf;
+	pf.path = p_path;
+	pf.data = p_data;
+	pf.file = p_file;
+	pf.total = p_total;
+	pf.enc_in_filters = p_enc_in_filters;
+	pf.enc_ex_filters = p_enc_ex_filters;
+	pf.key = p_key;
+	pf.compressed = pd->compress && !pd->compress_excluded_extensions.has(p_path.get_extension().to_lower());
+	pf.cache_file = pd->cache_dir;
+	pd->pending.push_back(pf);
+	pd->pending_size += p_data.size();
+
+	if (pd->pending.size() >= PackData::MAX_PENDING_FILES || pd->pending_size >= PackData::MAX_PENDING_SIZE) {
+		return _flush_pack_files(pd);
 	}
 
 	return OK;
@@ -1040,8 +1236,25 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, c
 	pd.ep = &ep;
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
+	pd.compress = GLOBAL_GET("editor/compress_pck_files_on_export");
+	Vector<String> compress_excluded = GLOBAL_GET("editor/compress_pck_files_excluded_extensions");
+	for (int i = 0; i < compress_excluded.size(); i++) {
+		pd.compress_excluded_extensions.insert(compress_excluded[i].to_lower());
+	}
+	if (pd.compress) {
+		pd.cache_dir = EditorSettings::get_singleton()->get_cache_dir().plus_file("export_cache");
+		if (da->make_dir_recursive(pd.cache_dir) != OK) {
+			pd.cache_dir = String();
+		}
+	}
 
 	Error err = export_project_files(p_preset, _save_pack_file, &pd, _add_shared_object);
+	if (err == OK) {
+		err = _flush_pack_files(&pd);
+	}
+	if (err == OK && pd.cache_dir != String()) {
+		_prune_pack_cache(pd);
+	}
 
 	memdelete(ftmp); //close tmp file
 
@@ -1167,6 +1380,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, c
 		if (pd.file_ofs[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (pd.file_ofs[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -1641,6 +1857,15 @@ EditorExport::EditorExport() {
 
 	_export_presets_updated = "export_presets_updated";
 
+	GLOBAL_DEF("editor/compress_pck_files_on_export", false);
+	Vector<String> compress_excluded;
+	compress_excluded.push_back("oggstr");
+	compress_excluded.push_back("mp3str");
+	compress_excluded.push_back("ogv");
+	compress_excluded.push_back("webm");
+	compress_excluded.push_back("stex");
+	GLOBAL_DEF("editor/compress_pck_files_excluded_extensions", compress_excluded);
+
 	singleton = this;
 	set_process(true);
 }
@@ -172,6 +172,7 @@ private:
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
 		CharString path_utf8;
 
@@ -180,11 +181,45 @@ private:
 		}
 	};
 
+	// Files are hashed and compressed in parallel batches, then written in order. Compressed
+	// contents are kept in a cache keyed by the hash of the source, so unchanged files are not
+	// compressed again on the next export.
+	struct PendingFile {
+		String path;
+		Vector<uint8_t> data;
+		int file = 0;
+		int total = 0;
+		Vector<String> enc_in_filters;
+		Vector<String> enc_ex_filters;
+		Vector<uint8_t> key;
+
+		bool compressed = false;
+		Vector<uint8_t> compressed_data;
+		uint8_t md5[16] = {};
+		String cache_file; // The cache directory until processed, then the file in it.
+		int duplicate_of = -1; // Earlier pending file with the same content, whose compressed data is reused.
+	};
+
 	struct PackData {
+		enum {
+			MAX_PENDING_FILES = 256,
+			MAX_PENDING_SIZE = 64 * 1024 * 1024,
+		};
+
 		FileAccess *f = nullptr;
 		Vector<SavedData> file_ofs;
 		EditorProgress *ep = nullptr;
 		Vector<SharedObject> *so_files = nullptr;
+		bool compress = false;
+		Set<String> compress_excluded_extensions;
+
+		Vector<PendingFile> pending;
+		uint64_t pending_size = 0;
+		String cache_dir; // Empty when the compression cache is not used.
+		Set<String> used_cache_files;
+
+		void hash_pending_file(uint32_t p_index, void *p_userdata);
+		void process_pending_file(uint32_t p_index, void *p_userdata);
 	};
 
 	struct ZipData {
@@ -201,6 +236,8 @@ private:
 	void _export_find_dependencies(const String &p_path, Set<String> &p_paths);
 
 	void gen_debug_flags(Vector<String> &r_flags, int p_flags);
+	static Error _flush_pack_files(PackData *p_pack_data);
+	static void _prune_pack_cache(const PackData &p_pack_data);
 	static Error _save_pack_file(void *p_userdata, const String &p_path, const Vector<uint8_t> &p_data, int p_file, int p_total, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key);
 	static Error _save_zip_file(void *p_userdata, const String &p_path, const Vector<uint8_t> &p_data, int p_file, int p_total, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key);
 
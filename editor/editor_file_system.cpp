@@ -36,6 +36,7 @@
 #include "core/io/resource_saver.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
+#include "core/templates/thread_work_pool.h"
 #include "core/variant/variant_parser.h"
 #include "editor_node.h"
 #include "editor_resource_preview.h"
@@ -291,8 +292,11 @@ void EditorFileSystem::_scan_filesystem() {
 
 	DirAccess *d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 	d->change_dir("res://");
+	import_tests.clear();
 	_scan_new_dir(new_filesystem, d, sp);
 
+	_process_import_tests();
+
 	file_cache.clear(); //clear caches, no longer needed
 
 	memdelete(d);
@@ -488,6 +492,19 @@ bool EditorFileSystem::_update_scan_actions() {
 	Vector<String> reimports;
 	Vector<String> reloads;
 
+	// Run the full reimport tests (which hash the source files) up front, in parallel.
+	Vector<ImportTest> full_tests;
+	for (List<ItemAction>::Element *E = scan_actions.front(); E; E = E->next()) {
+		if (E->get().action == ItemAction::ACTION_FILE_TEST_REIMPORT) {
+			ImportTest test;
+			test.path = E->get().dir->get_path().plus_file(E->get().file);
+			test.only_imported_files = false;
+			full_tests.push_back(test);
+		}
+	}
+	_run_import_tests(full_tests);
+	int full_test_idx = 0;
+
 	for (List<ItemAction>::Element *E = scan_actions.front(); E; E = E->next()) {
 		ItemAction &ia = E->get();
 
@@ -544,10 +561,11 @@ bool EditorFileSystem::_update_scan_actions() {
 
 			} break;
 			case ItemAction::ACTION_FILE_TEST_REIMPORT: {
+				bool reimport = full_tests[full_test_idx++].reimport;
 				int idx = ia.dir->find_file_index(ia.file);
 				ERR_CONTINUE(idx == -1);
 				String full_path = ia.dir->get_file_path(idx);
-				if (_test_for_reimport(full_path, false)) {
+				if (reimport) {
 					//must reimport
 					reimports.push_back(full_path);
 					reimports.append_array(_get_dependencies(full_path));
@@ -645,6 +663,57 @@ EditorFileSystem::ScanProgress EditorFileSystem::ScanProgress::get_sub(int p_cur
 	return sp;
 }
 
+void EditorFileSystem::_run_import_test(uint32_t p_index, ImportTest *p_tests) {
+	ImportTest &test = p_tests[p_index];
+	test.reimport = _test_for_reimport(test.path, test.only_imported_files);
+}
+
+void EditorFileSystem::_run_import_tests(Vector<ImportTest> &p_tests) {
+	if (p_tests.size() < 64) {
+		for (int i = 0; i < p_tests.size(); i++) {
+			_run_import_test(i, p_tests.ptrw());
+		}
+		return;
+	}
+
+	ThreadWorkPool work_pool;
+	work_pool.init(MIN(p_tests.size(), OS::get_singleton()->get_processor_count()));
+	work_pool.do_work(p_tests.size(), this, &EditorFileSystem::_run_import_test, p_tests.ptrw());
+	work_pool.finish();
+}
+
+void EditorFileSystem::_process_import_tests() {
+	_run_import_tests(import_tests);
+
+	for (int i = 0; i < import_tests.size(); i++) {
+		const ImportTest &test = import_tests[i];
+		if (!test.reimport) {
+			continue;
+		}
+
+		EditorFileSystemDirectory::FileInfo *fi = test.file_info;
+		if (fi) {
+			// Found by _scan_new_dir(), reset it as if it was missing from the cache.
+			fi->type = ResourceFormatImporter::get_singleton()->get_resource_type(test.path);
+			fi->import_group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(test.path);
+			fi->script_class_name = _get_global_script_class(fi->type, test.path, &fi->script_class_extends, &fi->script_class_icon_path);
+			fi->modified_time = 0;
+			fi->import_modified_time = 0;
+			fi->import_valid = ResourceLoader::is_import_valid(test.path);
+		}
+
+		if (!test.action_queued) {
+			ItemAction ia;
+			ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+			ia.dir = test.dir;
+			ia.file = test.path.get_file();
+			scan_actions.push_back(ia);
+		}
+	}
+
+	import_tests.clear();
+}
+
 void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess *da, const ScanProgress &p_progress) {
 	List<String> dirs;
 	List<String> files;
@@ -748,7 +817,8 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess
 				import_mt = FileAccess::get_modified_time(path + ".import");
 			}
 
-			if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt && !_test_for_reimport(path, true)) {
+			if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt) {
+				// The cached info is used as is, unless the import test run after the scan fails.
 				fi->type = fc->type;
 				fi->deps = fc->deps;
 				fi->modified_time = fc->modification_time;
@@ -760,14 +830,22 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess
 				fi->script_class_extends = fc->script_class_extends;
 				fi->script_class_icon_path = fc->script_class_icon_path;
 
+				ImportTest test;
+				test.path = path;
+				test.dir = p_dir;
+				test.file_info = fi;
+
 				if (revalidate_import_files && !ResourceFormatImporter::get_singleton()->are_import_settings_valid(path)) {
 					ItemAction ia;
 					ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
 					ia.dir = p_dir;
 					ia.file = E->get();
 					scan_actions.push_back(ia);
+					test.action_queued = true;
 				}
 
+				import_tests.push_back(test);
+
 				if (fc->type == String()) {
 					fi->type = ResourceLoader::get_resource_type(path);
 					fi->import_group_file = ResourceLoader::get_import_group_file(path);
@@ -977,8 +1055,11 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const
 				uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
 				if (import_mt != p_dir->files[i]->import_modified_time) {
 					reimport = true;
-				} else if (_test_for_reimport(path, true)) {
-					reimport = true;
+				} else {
+					ImportTest test;
+					test.path = path;
+					test.dir = p_dir;
+					import_tests.push_back(test); // Action queued by _process_import_tests() if it fails.
 				}
 			}
 
@@ -1039,7 +1120,9 @@ void EditorFileSystem::_thread_func_sources(void *_userdata) {
 		sp.progress = &pr;
 		sp.hi = 1;
 		sp.low = 0;
+		efs->import_tests.clear();
 		efs->_scan_fs_changes(efs->filesystem, sp);
+		efs->_process_import_tests();
 	}
 	efs->scanning_changes_done = true;
 }
@@ -1067,7 +1150,9 @@ void EditorFileSystem::scan_changes() {
 			sp.hi = 1;
 			sp.low = 0;
 			scan_total = 0;
+			import_tests.clear();
 			_scan_fs_changes(filesystem, sp);
+			_process_import_tests();
 			if (_update_scan_actions()) {
 				emit_signal("filesystem_changed");
 			}
@@ -1704,6 +1789,7 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 		}
 
 	} else {
+		MutexLock lock(reimport_mutex);
 		late_added_files.insert(p_file); //imported files do not call update_file(), but just in case..
 	}
 
@@ -1751,7 +1837,21 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant metadata;
-	Error err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &metadata);
+	String source_md5 = FileAccess::get_md5(p_file);
+	String cache_key;
+	if (import_cache_path != String() && importer->get_save_extension() != String()) {
+		cache_key = _get_import_cache_key(source_md5, importer, opts, params);
+	}
+
+	Error err = OK;
+	bool store_in_cache = false;
+	if (cache_key != String() && _import_cache_fetch(cache_key, base_path, &import_variants, &metadata)) {
+		// Reused the files imported on another checkout or machine.
+	} else {
+		err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &metadata);
+		// Files generated outside of the imported folder depend on the source path, so they can't be shared.
+		store_in_cache = cache_key != String() && err == OK && gen_files.is_empty();
+	}
 
 	if (err != OK) {
 		ERR_PRINT("Error importing '" + p_file + "'.");
@@ -1847,13 +1947,17 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 	FileAccess *md5s = FileAccess::open(base_path + ".md5", FileAccess::WRITE);
 	ERR_FAIL_COND_MSG(!md5s, "Cannot open MD5 file '" + base_path + ".md5'.");
 
-	md5s->store_line("source_md5=\"" + FileAccess::get_md5(p_file) + "\"");
+	md5s->store_line("source_md5=\"" + source_md5 + "\"");
 	if (dest_paths.size()) {
 		md5s->store_line("dest_md5=\"" + FileAccess::get_multiple_md5(dest_paths) + "\"\n");
 	}
 	md5s->close();
 	memdelete(md5s);
 
+	if (store_in_cache) {
+		_import_cache_store(cache_key, base_path, importer, import_variants, metadata);
+	}
+
 	//update modified times, to avoid reimport
 	fs->files[cpos]->modified_time = FileAccess::get_modified_time(p_file);
 	fs->files[cpos]->import_modified_time = FileAccess::get_modified_time(p_file + ".import");
@@ -1893,6 +1997,152 @@ void EditorFileSystem::_find_group_files(EditorFileSystemDirectory *efd, Map<Str
 	}
 }
 
+String EditorFileSystem::_get_import_cache_key(const String &p_source_md5, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const Map<StringName, Variant> &p_params) const {
+	String key = p_importer->get_importer_name() + "\n" + itos(p_importer->get_format_version()) + "\n" + p_importer->get_import_settings_string() + "\n" + p_source_md5 + "\n";
+
+	// Options in the order given by the importer, like in the .import file.
+	for (const List<ResourceImporter::ImportOption>::Element *E = p_options.front(); E; E = E->next()) {
+		String name = E->get().option.name;
+		String value;
+		VariantWriter::write_to_string(p_params[name], value);
+		key += name + "=" + value + "\n";
+	}
+
+	return key.md5_text();
+}
+
+static String _get_import_cache_entry_path(const String &p_cache_path, const String &p_key) {
+	return p_cache_path.plus_file(p_key.substr(0, 2)).plus_file(p_key);
+}
+
+static bool _copy_import_cache_file(const String &p_from, const String &p_to) {
+	Vector<uint8_t> data = FileAccess::get_file_as_array(p_from);
+	if (data.is_empty()) {
+		return false;
+	}
+
+	FileAccess *f = FileAccess::open(p_to, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(!f, false, "Cannot open file '" + p_to + "'.");
+	f->store_buffer(data.ptr(), data.size());
+	bool ok = f->get_error() == OK;
+	f->close();
+	memdelete(f);
+	return ok;
+}
+
+static void _remove_import_cache_dir(const String &p_path) {
+	DirAccessRef da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (da->change_dir(p_path) == OK) {
+		da->erase_contents_recursive();
+		da->remove(p_path);
+	}
+}
+
+bool EditorFileSystem::_import_cache_fetch(const String &p_key, const String &p_base_path, List<String> *r_import_variants, Variant *r_metadata) const {
+	String entry_path = _get_import_cache_entry_path(import_cache_path, p_key);
+
+	// Entries are only moved into place once complete, with their manifest. Anything without one is a miss.
+	Ref<ConfigFile> manifest;
+	manifest.instance();
+	if (manifest->load(entry_path.plus_file("manifest.cfg")) != OK) {
+		return false;
+	}
+
+	Vector<String> suffixes = manifest->get_value("import", "files", Vector<String>());
+	if (suffixes.is_empty()) {
+		return false;
+	}
+
+	for (int i = 0; i < suffixes.size(); i++) {
+		if (!_copy_import_cache_file(entry_path.plus_file("data" + suffixes[i]), p_base_path + suffixes[i])) {
+			return false;
+		}
+	}
+
+	Vector<String> variants = manifest->get_value("import", "variants", Vector<String>());
+	for (int i = 0; i < variants.size(); i++) {
+		r_import_variants->push_back(variants[i]);
+	}
+	*r_metadata = manifest->get_value("import", "metadata", Variant());
+
+	return true;
+}
+
+void EditorFileSystem::_import_cache_store(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, const List<String> &p_import_variants, const Variant &p_metadata) const {
+	String entry_path = _get_import_cache_entry_path(import_cache_path, p_key);
+	if (FileAccess::exists(entry_path.plus_file("manifest.cfg"))) {
+		return; // Already stored, entries are never overwritten.
+	}
+
+	// The cache may be shared by several editors, fill a directory of our own and rename it into place once complete.
+	String tmp_path = entry_path + "." + itos(OS::get_singleton()->get_process_id()) + "-" + itos(Thread::get_caller_id()) + ".tmp";
+
+	DirAccessRef da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (da->make_dir_recursive(tmp_path) != OK) {
+		WARN_PRINT("Cannot create import cache directory '" + tmp_path + "'.");
+		return;
+	}
+
+	Vector<String> suffixes;
+	Vector<String> variants;
+	if (p_import_variants.size()) {
+		for (const List<String>::Element *E = p_import_variants.front(); E; E = E->next()) {
+			suffixes.push_back("." + E->get() + "." + p_importer->get_save_extension());
+			variants.push_back(E->get());
+		}
+	} else {
+		suffixes.push_back("." + p_importer->get_save_extension());
+	}
+
+	for (int i = 0; i < suffixes.size(); i++) {
+		if (!_copy_import_cache_file(p_base_path + suffixes[i], tmp_path.plus_file("data" + suffixes[i]))) {
+			_remove_import_cache_dir(tmp_path);
+			return;
+		}
+	}
+
+	Ref<ConfigFile> manifest;
+	manifest.instance();
+	manifest->set_value("import", "files", suffixes);
+	manifest->set_value("import", "variants", variants);
+	if (p_metadata != Variant()) {
+		manifest->set_value("import", "metadata", p_metadata);
+	}
+	if (manifest->save(tmp_path.plus_file("manifest.cfg")) != OK) {
+		_remove_import_cache_dir(tmp_path);
+		return;
+	}
+
+	if (da->dir_exists(entry_path) && !FileAccess::exists(entry_path.plus_file("manifest.cfg"))) {
+		_remove_import_cache_dir(entry_path); // Left incomplete by an older editor version.
+	}
+	if (da->rename(tmp_path, entry_path) != OK) {
+		// Someone else stored the same entry first.
+		_remove_import_cache_dir(tmp_path);
+	}
+}
+
+String EditorFileSystem::_get_file_importer(const String &p_file) const {
+	// Same lookup as _reimport_file(), an importer set in the .import file wins over the extension.
+	if (FileAccess::exists(p_file + ".import")) {
+		Ref<ConfigFile> cf;
+		cf.instance();
+		if (cf->load(p_file + ".import") == OK && cf->has_section_key("remap", "importer")) {
+			String importer_name = cf->get_value("remap", "importer");
+			if (ResourceFormatImporter::get_singleton()->get_importer_by_name(importer_name).is_valid()) {
+				return importer_name;
+			}
+		}
+	}
+
+	Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_extension(p_file.get_extension());
+	return importer.is_valid() ? importer->get_importer_name() : String();
+}
+
+void EditorFileSystem::_reimport_thread(uint32_t p_index, ImportThreadData *p_import_data) {
+	_reimport_file(p_import_data->reimport_files[p_import_data->reimport_from + p_index].path);
+}
+
 void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	{
 		// Ensure that ProjectSettings::IMPORTED_FILES_PATH exists.
@@ -1908,6 +2158,7 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	}
 
 	importing = true;
+	import_cache_path = EditorSettings::get_singleton()->get("filesystem/import/shared_cache_path");
 	EditorProgress pr("reimport", TTR("(Re)Importing Assets"), p_files.size());
 
 	Vector<ImportFile> files;
@@ -1928,6 +2179,9 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 			//it's a regular file
 			ImportFile ifile;
 			ifile.path = p_files[i];
+			ifile.importer = _get_file_importer(p_files[i]);
+			Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(ifile.importer);
+			ifile.threaded = importer.is_valid() && importer->can_import_threaded();
 			ifile.order = ResourceFormatImporter::get_singleton()->get_import_order(p_files[i]);
 			files.push_back(ifile);
 		}
@@ -1942,9 +2196,54 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	files.sort();
 
+	bool use_multiple_threads = import_use_multiple_threads && OS::get_singleton()->get_processor_count() > 1;
+
+	int from = 0;
 	for (int i = 0; i < files.size(); i++) {
-		pr.step(files[i].path.get_file(), i);
-		_reimport_file(files[i].path);
+		if (!use_multiple_threads || !files[i].threaded) {
+			pr.step(files[i].path.get_file(), i);
+			_reimport_file(files[i].path);
+			from = i + 1;
+			continue;
+		}
+
+		// Batch consecutive files that use the same thread-safe importer.
+		if (i + 1 < files.size() && files[i + 1].threaded && files[i + 1].importer == files[from].importer) {
+			continue;
+		}
+
+		int count = i - from + 1;
+		if (count == 1) {
+			pr.step(files[i].path.get_file(), i);
+			_reimport_file(files[i].path);
+		} else {
+			ImportThreadData tdata;
+			tdata.reimport_files = files.ptr();
+			tdata.reimport_from = from;
+
+			ThreadWorkPool work_pool;
+			work_pool.init(MIN(count, OS::get_singleton()->get_processor_count()));
+			work_pool.begin_work(count, this, &EditorFileSystem::_reimport_thread, &tdata);
+
+			// Keep the progress dialog updated while the pool runs the imports.
+			int last_index = -1;
+			while (true) {
+				int current_index = MIN(int(work_pool.get_work_index()), count);
+				if (current_index != last_index) {
+					int step = from + MAX(current_index - 1, 0);
+					pr.step(files[step].path.get_file(), step);
+					last_index = current_index;
+				}
+				if (current_index == count) {
+					break;
+				}
+				OS::get_singleton()->delay_usec(1000);
+			}
+
+			work_pool.end_work();
+			work_pool.finish();
+		}
+		from = i + 1;
 	}
 
 	//reimport groups
@@ -2068,6 +2367,7 @@ void EditorFileSystem::_update_extensions() {
 EditorFileSystem::EditorFileSystem() {
 	ResourceLoader::import = _resource_import;
 	reimport_on_missing_imported_files = GLOBAL_DEF("editor/reimport_missing_imported_files", true);
+	import_use_multiple_threads = GLOBAL_DEF("editor/import/use_multiple_threads", true);
 
 	singleton = this;
 	filesystem = memnew(EditorFileSystemDirectory); //like, empty
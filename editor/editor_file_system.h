@@ -31,7 +31,9 @@
 #ifndef EDITOR_FILE_SYSTEM_H
 #define EDITOR_FILE_SYSTEM_H
 
+#include "core/io/resource_importer.h"
 #include "core/os/dir_access.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/set.h"
@@ -207,18 +209,55 @@ class EditorFileSystem : public Node {
 
 	bool _test_for_reimport(const String &p_path, bool p_only_imported_files);
 
+	// Each reimport test opens and parses a .import file (and hashes the source file when
+	// only_imported_files is false), so scans collect them and run them in parallel afterwards.
+	struct ImportTest {
+		String path;
+		EditorFileSystemDirectory *dir = nullptr;
+		EditorFileSystemDirectory::FileInfo *file_info = nullptr;
+		bool only_imported_files = true;
+		bool action_queued = false;
+		bool reimport = false;
+	};
+
+	Vector<ImportTest> import_tests;
+
+	void _run_import_test(uint32_t p_index, ImportTest *p_tests);
+	void _run_import_tests(Vector<ImportTest> &p_tests);
+	void _process_import_tests();
+
 	bool reimport_on_missing_imported_files;
 
 	Vector<String> _get_dependencies(const String &p_path);
 
 	struct ImportFile {
 		String path;
+		String importer;
+		bool threaded = false;
 		int order = 0;
 		bool operator<(const ImportFile &p_if) const {
-			return order < p_if.order;
+			return order == p_if.order ? importer < p_if.importer : order < p_if.order;
 		}
 	};
 
+	struct ImportThreadData {
+		const ImportFile *reimport_files = nullptr;
+		int reimport_from = 0;
+	};
+
+	Mutex reimport_mutex;
+	bool import_use_multiple_threads = true;
+
+	String _get_file_importer(const String &p_file) const;
+	void _reimport_thread(uint32_t p_index, ImportThreadData *p_import_data);
+
+	// Shared import cache, imported files are stored by a hash of their source file, importer and options.
+	String import_cache_path;
+
+	String _get_import_cache_key(const String &p_source_md5, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const Map<StringName, Variant> &p_params) const;
+	bool _import_cache_fetch(const String &p_key, const String &p_base_path, List<String> *r_import_variants, Variant *r_metadata) const;
+	void _import_cache_store(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, const List<String> &p_import_variants, const Variant &p_metadata) const;
+
 	void _scan_script_classes(EditorFileSystemDirectory *p_dir);
 	volatile bool update_script_classes_queued;
 	void _queue_update_script_classes();
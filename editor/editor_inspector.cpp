@@ -1386,9 +1386,14 @@ void EditorInspectorSection::unfold() {
 
 	_test_unfold();
 
+	bool was_unfolded = object->editor_is_section_unfolded(section);
 	object->editor_set_section_unfold(section, true);
 	vbox->show();
 	update();
+
+	if (!was_unfolded) {
+		emit_signal("unfolded");
+	}
 }
 
 void EditorInspectorSection::fold() {
@@ -1411,6 +1416,8 @@ void EditorInspectorSection::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("unfold"), &EditorInspectorSection::unfold);
 	ClassDB::bind_method(D_METHOD("fold"), &EditorInspectorSection::fold);
 	ClassDB::bind_method(D_METHOD("_gui_input"), &EditorInspectorSection::_gui_input);
+
+	ADD_SIGNAL(MethodInfo("unfolded"));
 }
 
 EditorInspectorSection::EditorInspectorSection() {
@@ -1637,18 +1644,17 @@ void EditorInspector::update_tree() {
 	String group_base;
 	String subgroup;
 	String subgroup_base;
-	VBoxContainer *category_vbox = nullptr;
+	category_vbox = nullptr;
 
 	List<PropertyInfo> plist;
 	object->get_property_list(&plist, true);
-	_update_script_class_properties(*object, plist);
 
-	HashMap<String, VBoxContainer *> item_path;
-	Map<VBoxContainer *, EditorInspectorSection *> section_map;
+	property_list_hash = _get_property_list_hash(plist);
+	_update_script_class_properties(*object, plist);
 
 	item_path[""] = main_vbox;
-
-	Color sscolor = get_theme_color("prop_subsection", "Editor");
+	tree_plugins = valid_plugins;
+	tree_draw_red = draw_red;
 
 	for (List<Ref<EditorInspectorPlugin>>::Element *E = valid_plugins.front(); E; E = E->next()) {
 		Ref<EditorInspectorPlugin> ped = E->get();
@@ -1835,202 +1841,243 @@ void EditorInspector::update_tree() {
 			main_vbox->add_child(category_vbox);
 		}
 
-		VBoxContainer *current_vbox = main_vbox;
+		_add_property_editors(p, path, name, current_selected, current_focusable);
+	}
 
-		{
-			String acc_path = "";
-			int level = 1;
-			for (int i = 0; i < path.get_slice_count("/"); i++) {
-				String path_name = path.get_slice("/", i);
-				if (i > 0) {
-					acc_path += "/";
-				}
-				acc_path += path_name;
-				if (!item_path.has(acc_path)) {
-					EditorInspectorSection *section = memnew(EditorInspectorSection);
-					current_vbox->add_child(section);
-					sections.push_back(section);
-
-					if (capitalize_paths) {
-						path_name = path_name.capitalize();
-					}
+	for (List<Ref<EditorInspectorPlugin>>::Element *E = valid_plugins.front(); E; E = E->next()) {
+		Ref<EditorInspectorPlugin> ped = E->get();
+		ped->parse_end();
+		_parse_added_editors(main_vbox, ped);
+	}
+
+	//see if this property exists and should be kept
+}
 
-					Color c = sscolor;
-					c.a /= level;
-					section->setup(acc_path, path_name, object, c, use_folding);
+void EditorInspector::_add_property_editors(const PropertyInfo &p_property, const String &p_path, const String &p_name, const StringName &p_selected, int p_focusable) {
+	const PropertyInfo &p = p_property;
+	VBoxContainer *current_vbox = main_vbox;
 
-					VBoxContainer *vb = section->get_vbox();
-					item_path[acc_path] = vb;
-					section_map[vb] = section;
+	{
+		String acc_path = "";
+		int level = 1;
+		for (int i = 0; i < p_path.get_slice_count("/"); i++) {
+			String path_name = p_path.get_slice("/", i);
+			if (i > 0) {
+				acc_path += "/";
+			}
+			acc_path += path_name;
+			if (!item_path.has(acc_path)) {
+				EditorInspectorSection *section = memnew(EditorInspectorSection);
+				current_vbox->add_child(section);
+				sections.push_back(section);
+
+				if (capitalize_paths) {
+					path_name = path_name.capitalize();
 				}
-				current_vbox = item_path[acc_path];
-				level = (MIN(level + 1, 4));
+
+				Color c = get_theme_color("prop_subsection", "Editor");
+				c.a /= level;
+				section->setup(acc_path, path_name, object, c, use_folding);
+				section->connect("unfolded", callable_mp(this, &EditorInspector::_section_unfolded), varray(acc_path));
+
+				item_path[acc_path] = section->get_vbox();
 			}
+			current_vbox = item_path[acc_path];
+			level = (MIN(level + 1, 4));
 
-			if (current_vbox == main_vbox) {
-				//do not add directly to the main vbox, given it has no spacing
-				if (category_vbox == nullptr) {
-					category_vbox = memnew(VBoxContainer);
-				}
-				current_vbox = category_vbox;
+			if (use_folding && acc_path != "" && !object->editor_is_section_unfolded(acc_path)) {
+				// Nothing inside a folded section is visible, create its editors when it's unfolded.
+				DeferredProperty deferred;
+				deferred.info = p;
+				deferred.path = p_path;
+				deferred.name = p_name;
+				deferred_properties[acc_path].push_back(deferred);
+				return;
 			}
 		}
 
-		bool checkable = false;
-		bool checked = false;
-		if (p.usage & PROPERTY_USAGE_CHECKABLE) {
-			checkable = true;
-			checked = p.usage & PROPERTY_USAGE_CHECKED;
+		if (current_vbox == main_vbox) {
+			//do not add directly to the main vbox, given it has no spacing
+			if (category_vbox == nullptr) {
+				category_vbox = memnew(VBoxContainer);
+			}
+			current_vbox = category_vbox;
 		}
+	}
 
-		if (p.usage & PROPERTY_USAGE_RESTART_IF_CHANGED) {
-			restart_request_props.insert(p.name);
-		}
+	bool checkable = false;
+	bool checked = false;
+	if (p.usage & PROPERTY_USAGE_CHECKABLE) {
+		checkable = true;
+		checked = p.usage & PROPERTY_USAGE_CHECKED;
+	}
 
-		String doc_hint;
+	if (p.usage & PROPERTY_USAGE_RESTART_IF_CHANGED) {
+		restart_request_props.insert(p.name);
+	}
 
-		if (use_doc_hints) {
-			StringName classname = object->get_class_name();
-			if (object_class != String()) {
-				classname = object_class;
-			}
-			StringName propname = property_prefix + p.name;
-			String descr;
-			bool found = false;
+	String doc_hint;
 
-			Map<StringName, Map<StringName, String>>::Element *E = descr_cache.find(classname);
-			if (E) {
-				Map<StringName, String>::Element *F = E->get().find(propname);
-				if (F) {
-					found = true;
-					descr = F->get();
-				}
+	if (use_doc_hints) {
+		StringName classname = object->get_class_name();
+		if (object_class != String()) {
+			classname = object_class;
+		}
+		StringName propname = property_prefix + p.name;
+		String descr;
+		bool found = false;
+
+		Map<StringName, Map<StringName, String>>::Element *E = descr_cache.find(classname);
+		if (E) {
+			Map<StringName, String>::Element *F = E->get().find(propname);
+			if (F) {
+				found = true;
+				descr = F->get();
 			}
+		}
 
-			if (!found) {
-				DocTools *dd = EditorHelp::get_doc_data();
-				Map<String, DocData::ClassDoc>::Element *F = dd->class_list.find(classname);
-				while (F && descr == String()) {
-					for (int i = 0; i < F->get().properties.size(); i++) {
-						if (F->get().properties[i].name == propname.operator String()) {
-							descr = DTR(F->get().properties[i].description);
-							break;
-						}
+		if (!found) {
+			DocTools *dd = EditorHelp::get_doc_data();
+			Map<String, DocData::ClassDoc>::Element *F = dd->class_list.find(classname);
+			while (F && descr == String()) {
+				for (int i = 0; i < F->get().properties.size(); i++) {
+					if (F->get().properties[i].name == propname.operator String()) {
+						descr = DTR(F->get().properties[i].description);
+						break;
 					}
+				}
 
-					Vector<String> slices = propname.operator String().split("/");
-					if (slices.size() == 2 && slices[0].begins_with("custom_")) {
-						// Likely a theme property.
-						for (int i = 0; i < F->get().theme_properties.size(); i++) {
-							if (F->get().theme_properties[i].name == slices[1]) {
-								descr = DTR(F->get().theme_properties[i].description);
-								break;
-							}
+				Vector<String> slices = propname.operator String().split("/");
+				if (slices.size() == 2 && slices[0].begins_with("custom_")) {
+					// Likely a theme property.
+					for (int i = 0; i < F->get().theme_properties.size(); i++) {
+						if (F->get().theme_properties[i].name == slices[1]) {
+							descr = DTR(F->get().theme_properties[i].description);
+							break;
 						}
 					}
+				}
 
-					if (!F->get().inherits.is_empty()) {
-						F = dd->class_list.find(F->get().inherits);
-					} else {
-						break;
-					}
+				if (!F->get().inherits.is_empty()) {
+					F = dd->class_list.find(F->get().inherits);
+				} else {
+					break;
 				}
-				descr_cache[classname][propname] = descr;
 			}
-
-			doc_hint = descr;
+			descr_cache[classname][propname] = descr;
 		}
 
-		for (List<Ref<EditorInspectorPlugin>>::Element *E = valid_plugins.front(); E; E = E->next()) {
-			Ref<EditorInspectorPlugin> ped = E->get();
-			bool exclusive = ped->parse_property(object, p.type, p.name, p.hint, p.hint_string, p.usage, wide_editors);
-
-			List<EditorInspectorPlugin::AddedEditor> editors = ped->added_editors; //make a copy, since plugins may be used again in a sub-inspector
-			ped->added_editors.clear();
+		doc_hint = descr;
+	}
 
-			for (List<EditorInspectorPlugin::AddedEditor>::Element *F = editors.front(); F; F = F->next()) {
-				EditorProperty *ep = Object::cast_to<EditorProperty>(F->get().property_editor);
+	for (List<Ref<EditorInspectorPlugin>>::Element *E = tree_plugins.front(); E; E = E->next()) {
+		Ref<EditorInspectorPlugin> ped = E->get();
+		bool exclusive = ped->parse_property(object, p.type, p.name, p.hint, p.hint_string, p.usage, wide_editors);
 
-				if (ep) {
-					//set all this before the control gets the ENTER_TREE notification
-					ep->object = object;
+		List<EditorInspectorPlugin::AddedEditor> editors = ped->added_editors; //make a copy, since plugins may be used again in a sub-inspector
+		ped->added_editors.clear();
 
-					if (F->get().properties.size()) {
-						if (F->get().properties.size() == 1) {
-							//since it's one, associate:
-							ep->property = F->get().properties[0];
-							ep->property_usage = p.usage;
-							//and set label?
-						}
+		for (List<EditorInspectorPlugin::AddedEditor>::Element *F = editors.front(); F; F = F->next()) {
+			EditorProperty *ep = Object::cast_to<EditorProperty>(F->get().property_editor);
 
-						if (F->get().label != String()) {
-							ep->set_label(F->get().label);
-						} else {
-							//use existin one
-							ep->set_label(name);
-						}
-						for (int i = 0; i < F->get().properties.size(); i++) {
-							String prop = F->get().properties[i];
+			if (ep) {
+				//set all this before the control gets the ENTER_TREE notification
+				ep->object = object;
 
-							if (!editor_property_map.has(prop)) {
-								editor_property_map[prop] = List<EditorProperty *>();
-							}
-							editor_property_map[prop].push_back(ep);
-						}
+				if (F->get().properties.size()) {
+					if (F->get().properties.size() == 1) {
+						//since it's one, associate:
+						ep->property = F->get().properties[0];
+						ep->property_usage = p.usage;
+						//and set label?
 					}
-					ep->set_draw_red(draw_red);
-					ep->set_use_folding(use_folding);
-					ep->set_checkable(checkable);
-					ep->set_checked(checked);
-					ep->set_keying(keying);
-
-					ep->set_read_only(read_only);
-					ep->set_deletable(deletable_properties);
-				}
-
-				current_vbox->add_child(F->get().property_editor);
 
-				if (ep) {
-					ep->connect("property_changed", callable_mp(this, &EditorInspector::_property_changed));
-					if (p.usage & PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED) {
-						ep->connect("property_changed", callable_mp(this, &EditorInspector::_property_changed_update_all), varray(), CONNECT_DEFERRED);
-					}
-					ep->connect("property_keyed", callable_mp(this, &EditorInspector::_property_keyed));
-					ep->connect("property_deleted", callable_mp(this, &EditorInspector::_property_deleted), varray(), CONNECT_DEFERRED);
-					ep->connect("property_keyed_with_value", callable_mp(this, &EditorInspector::_property_keyed_with_value));
-					ep->connect("property_checked", callable_mp(this, &EditorInspector::_property_checked));
-					ep->connect("selected", callable_mp(this, &EditorInspector::_property_selected));
-					ep->connect("multiple_properties_changed", callable_mp(this, &EditorInspector::_multiple_properties_changed));
-					ep->connect("resource_selected", callable_mp(this, &EditorInspector::_resource_selected), varray(), CONNECT_DEFERRED);
-					ep->connect("object_id_selected", callable_mp(this, &EditorInspector::_object_id_selected), varray(), CONNECT_DEFERRED);
-					if (doc_hint != String()) {
-						ep->set_tooltip(property_prefix + p.name + "::" + doc_hint);
+					if (F->get().label != String()) {
+						ep->set_label(F->get().label);
 					} else {
-						ep->set_tooltip(property_prefix + p.name);
+						//use existin one
+						ep->set_label(p_name);
 					}
-					ep->update_property();
-					ep->update_reload_status();
-					ep->update_cache();
+					for (int i = 0; i < F->get().properties.size(); i++) {
+						String prop = F->get().properties[i];
 
-					if (current_selected && ep->property == current_selected) {
-						ep->select(current_focusable);
+						if (!editor_property_map.has(prop)) {
+							editor_property_map[prop] = List<EditorProperty *>();
+						}
+						editor_property_map[prop].push_back(ep);
 					}
 				}
+				ep->set_draw_red(tree_draw_red);
+				ep->set_use_folding(use_folding);
+				ep->set_checkable(checkable);
+				ep->set_checked(checked);
+				ep->set_keying(keying);
+
+				ep->set_read_only(read_only);
+				ep->set_deletable(deletable_properties);
 			}
 
-			if (exclusive) {
-				break;
+			current_vbox->add_child(F->get().property_editor);
+
+			if (ep) {
+				ep->connect("property_changed", callable_mp(this, &EditorInspector::_property_changed));
+				if (p.usage & PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED) {
+					ep->connect("property_changed", callable_mp(this, &EditorInspector::_property_changed_update_all), varray(), CONNECT_DEFERRED);
+				}
+				ep->connect("property_keyed", callable_mp(this, &EditorInspector::_property_keyed));
+				ep->connect("property_deleted", callable_mp(this, &EditorInspector::_property_deleted), varray(), CONNECT_DEFERRED);
+				ep->connect("property_keyed_with_value", callable_mp(this, &EditorInspector::_property_keyed_with_value));
+				ep->connect("property_checked", callable_mp(this, &EditorInspector::_property_checked));
+				ep->connect("selected", callable_mp(this, &EditorInspector::_property_selected));
+				ep->connect("multiple_properties_changed", callable_mp(this, &EditorInspector::_multiple_properties_changed));
+				ep->connect("resource_selected", callable_mp(this, &EditorInspector::_resource_selected), varray(), CONNECT_DEFERRED);
+				ep->connect("object_id_selected", callable_mp(this, &EditorInspector::_object_id_selected), varray(), CONNECT_DEFERRED);
+				if (doc_hint != String()) {
+					ep->set_tooltip(property_prefix + p.name + "::" + doc_hint);
+				} else {
+					ep->set_tooltip(property_prefix + p.name);
+				}
+				ep->update_property();
+				ep->update_reload_status();
+				ep->update_cache();
+
+				if (p_selected && ep->property == p_selected) {
+					ep->select(p_focusable);
+				}
 			}
 		}
+
+		if (exclusive) {
+			break;
+		}
 	}
+}
 
-	for (List<Ref<EditorInspectorPlugin>>::Element *E = valid_plugins.front(); E; E = E->next()) {
-		Ref<EditorInspectorPlugin> ped = E->get();
-		ped->parse_end();
-		_parse_added_editors(main_vbox, ped);
+void EditorInspector::_section_unfolded(const String &p_section) {
+	if (!object || !deferred_properties.has(p_section)) {
+		return;
 	}
 
-	//see if this property exists and should be kept
+	List<DeferredProperty> deferred = deferred_properties[p_section];
+	deferred_properties.erase(p_section);
+
+	for (List<DeferredProperty>::Element *E = deferred.front(); E; E = E->next()) {
+		_add_property_editors(E->get().info, E->get().path, E->get().name, property_selected, property_focusable);
+	}
+}
+
+uint32_t EditorInspector::_get_property_list_hash(const List<PropertyInfo> &p_list) {
+	uint32_t hash = hash_djb2_one_32(p_list.size());
+	for (const List<PropertyInfo>::Element *E = p_list.front(); E; E = E->next()) {
+		const PropertyInfo &pi = E->get();
+		hash = hash_djb2_one_32(pi.name.hash(), hash);
+		hash = hash_djb2_one_32(pi.type, hash);
+		hash = hash_djb2_one_32(pi.hint, hash);
+		hash = hash_djb2_one_32(pi.hint_string.hash(), hash);
+		hash = hash_djb2_one_32(pi.usage, hash);
+		hash = hash_djb2_one_32(pi.class_name.hash(), hash);
+	}
+	return hash;
 }
 
 void EditorInspector::update_property(const String &p_prop) {
@@ -2055,6 +2102,11 @@ void EditorInspector::_clear() {
 	sections.clear();
 	pending.clear();
 	restart_request_props.clear();
+	item_path.clear();
+	category_vbox = nullptr;
+	tree_plugins.clear();
+	deferred_properties.clear();
+	property_list_hash = 0;
 }
 
 Object *EditorInspector::get_edited_object() {
@@ -2478,7 +2530,23 @@ void EditorInspector::_notification(int p_what) {
 		changing++;
 
 		if (update_tree_pending) {
-			update_tree();
+			List<PropertyInfo> plist;
+			if (object) {
+				object->get_property_list(&plist, true);
+			}
+
+			if (object && property_list_hash != 0 && _get_property_list_hash(plist) == property_list_hash) {
+				// Same properties, only values changed, update the existing editors in place.
+				for (Map<StringName, List<EditorProperty *>>::Element *F = editor_property_map.front(); F; F = F->next()) {
+					for (List<EditorProperty *>::Element *E = F->get().front(); E; E = E->next()) {
+						E->get()->update_property();
+						E->get()->update_reload_status();
+						E->get()->update_cache();
+					}
+				}
+			} else {
+				update_tree();
+			}
 			update_tree_pending = false;
 			pending.clear();
 
@@ -2636,6 +2704,9 @@ void EditorInspector::_bind_methods() {
 EditorInspector::EditorInspector() {
 	object = nullptr;
 	undo_redo = nullptr;
+	category_vbox = nullptr;
+	tree_draw_red = false;
+	property_list_hash = 0;
 	main_vbox = memnew(VBoxContainer);
 	main_vbox->set_h_size_flags(SIZE_EXPAND_FILL);
 	main_vbox->add_theme_constant_override("separation", 0);
@@ -276,6 +276,20 @@ class EditorInspector : public ScrollContainer {
 	List<EditorInspectorSection *> sections;
 	Set<StringName> pending;
 
+	// Properties of folded sections get their editors when the section is unfolded.
+	struct DeferredProperty {
+		PropertyInfo info;
+		String path;
+		String name;
+	};
+
+	HashMap<String, VBoxContainer *> item_path;
+	VBoxContainer *category_vbox;
+	List<Ref<EditorInspectorPlugin>> tree_plugins;
+	bool tree_draw_red;
+	Map<String, List<DeferredProperty>> deferred_properties; // By section path.
+	uint32_t property_list_hash; // Refreshes keep the editors when the property list didn't change.
+
 	void _clear();
 	Object *object;
 
@@ -333,6 +347,10 @@ class EditorInspector : public ScrollContainer {
 	void _changed_callback();
 	void _edit_request_change(Object *p_object, const String &p_prop);
 
+	void _add_property_editors(const PropertyInfo &p_property, const String &p_path, const String &p_name, const StringName &p_selected, int p_focusable);
+	void _section_unfolded(const String &p_section);
+	static uint32_t _get_property_list_hash(const List<PropertyInfo> &p_list);
+
 	void _filter_changed(const String &p_text);
 	void _parse_added_editors(VBoxContainer *current_vbox, Ref<EditorInspectorPlugin> ped);
 
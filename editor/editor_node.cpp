@@ -549,6 +549,7 @@ void EditorNode::_notification(int p_what) {
 			Engine::get_singleton()->set_editor_hint(true);
 
 			OS::get_singleton()->set_low_processor_usage_mode_sleep_usec(int(EDITOR_GET("interface/editor/low_processor_mode_sleep_usec")));
+			editor_data.get_undo_redo().set_max_memory(uint64_t(int(EDITOR_GET("interface/editor/undo_history_max_memory_mb"))) * 1024 * 1024);
 			get_tree()->get_root()->set_as_audio_listener(false);
 			get_tree()->get_root()->set_as_audio_listener_2d(false);
 			get_tree()->get_root()->set_snap_2d_transforms_to_pixel(false);
@@ -617,6 +618,7 @@ void EditorNode::_notification(int p_what) {
 		} break;
 
 		case EditorSettings::NOTIFICATION_EDITOR_SETTINGS_CHANGED: {
+			editor_data.get_undo_redo().set_max_memory(uint64_t(int(EDITOR_GET("interface/editor/undo_history_max_memory_mb"))) * 1024 * 1024);
 			scene_tabs->set_tab_close_display_policy((bool(EDITOR_GET("interface/scene_tabs/always_show_close_button")) ? Tabs::CLOSE_BUTTON_SHOW_ALWAYS : Tabs::CLOSE_BUTTON_SHOW_ACTIVE_ONLY));
 			theme = create_editor_theme(theme_base->get_theme());
 
@@ -775,6 +777,27 @@ void EditorNode::_fs_changed() {
 	_mark_unsaved_scenes();
 
 	// FIXME: Move this to a cleaner location, it's hacky to do this is _fs_changed.
+	if (bake_lighting_defer.size() && !EditorFileSystem::get_singleton()->is_scanning()) {
+		Vector<String> scenes = bake_lighting_defer;
+		// Notifications may come during the bake.
+		bake_lighting_defer.clear();
+
+		int failed = 0;
+		for (int i = 0; i < scenes.size(); i++) {
+			if (_bake_scene_lighting(scenes[i]) != OK) {
+				failed++;
+			}
+		}
+		if (failed) {
+			ERR_PRINT(vformat("Lighting bake failed for %d of %d scenes.", failed, scenes.size()));
+			OS::get_singleton()->set_exit_code(EXIT_FAILURE);
+		}
+		if (export_defer.preset == "") {
+			_exit_editor();
+			return;
+		}
+	}
+
 	String export_error;
 	if (export_defer.preset != "" && !EditorFileSystem::get_singleton()->is_scanning()) {
 		String preset_name = export_defer.preset;
@@ -3689,9 +3712,18 @@ void EditorNode::notify_all_debug_sessions_exited() {
 }
 
 void EditorNode::add_io_error(const String &p_error) {
+	if (Thread::get_caller_id() != Thread::get_main_id()) {
+		// Thread-safe importers may report errors from the reimport worker threads.
+		MessageQueue::get_singleton()->push_callable(callable_mp(singleton, &EditorNode::_add_io_error_deferred), p_error);
+		return;
+	}
 	_load_error_notify(singleton, p_error);
 }
 
+void EditorNode::_add_io_error_deferred(const String &p_error) {
+	_load_error_notify(this, p_error);
+}
+
 void EditorNode::_load_error_notify(void *p_ud, const String &p_text) {
 	EditorNode *en = (EditorNode *)p_ud;
 	en->load_errors->add_image(en->gui_base->get_theme_icon("Error", "EditorIcons"));
@@ -4045,6 +4077,96 @@ Error EditorNode::export_preset(const String &p_preset, const String &p_path, bo
 	return OK;
 }
 
+Error EditorNode::bake_lighting(const Vector<String> &p_scenes) {
+	bake_lighting_defer = p_scenes;
+	cmdline_export_mode = true;
+	return OK;
+}
+
+void EditorNode::_find_lighting_to_bake(Node *p_node, Node *p_root, List<Node *> &r_lightmaps, List<Node *> &r_probes) {
+	// Nodes of instanced scenes are baked and saved with their own scene.
+	if (p_node != p_root && p_node->get_owner() != p_root) {
+		return;
+	}
+
+	if (Object::cast_to<BakedLightmap>(p_node)) {
+		r_lightmaps.push_back(p_node);
+	} else if (Object::cast_to<GIProbe>(p_node)) {
+		r_probes.push_back(p_node);
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_find_lighting_to_bake(p_node->get_child(i), p_root, r_lightmaps, r_probes);
+	}
+}
+
+Error EditorNode::_bake_scene_lighting(const String &p_path) {
+	Ref<PackedScene> scene = ResourceLoader::load(p_path, "PackedScene");
+	if (scene.is_null()) {
+		ERR_PRINT(vformat("Can't load scene to bake lighting: %s.", p_path));
+		return ERR_CANT_OPEN;
+	}
+
+	Node *root = scene->instance(PackedScene::GEN_EDIT_STATE_MAIN);
+	ERR_FAIL_COND_V(!root, ERR_CANT_CREATE);
+	add_child(root); // Baking uses global transforms.
+
+	List<Node *> lightmaps;
+	List<Node *> probes;
+	_find_lighting_to_bake(root, root, lightmaps, probes);
+
+	print_line(vformat("Baking lighting for %s: %d lightmaps, %d GI probes.", p_path, lightmaps.size(), probes.size()));
+
+	Error err = OK;
+
+	for (List<Node *>::Element *E = probes.front(); E; E = E->next()) {
+		GIProbe *probe = Object::cast_to<GIProbe>(E->get());
+		probe->bake();
+		Ref<GIProbeData> probe_data = probe->get_probe_data();
+		if (probe_data.is_null()) {
+			ERR_PRINT(vformat("Failed baking GI probe '%s' in %s.", probe->get_name(), p_path));
+			err = FAILED;
+		} else if (probe_data->get_path().is_resource_file()) {
+			ResourceSaver::save(probe_data->get_path(), probe_data); // Data not embedded in the scene.
+		}
+	}
+
+	for (List<Node *>::Element *E = lightmaps.front(); E; E = E->next()) {
+		BakedLightmap *lightmap = Object::cast_to<BakedLightmap>(E->get());
+		Node *from = lightmap == root ? lightmap : lightmap->get_parent();
+
+		BakedLightmap::BakeError bake_err = lightmap->bake(from, "", BakedLightmapEditorPlugin::bake_func_step);
+		if (bake_err == BakedLightmap::BAKE_ERROR_NO_SAVE_PATH) {
+			// Same default as the editor, named after the scene.
+			String image_path = p_path.get_basename() + (lightmaps.size() > 1 ? "." + String(lightmap->get_name()) : String()) + ".lmbake";
+			bake_err = lightmap->bake(from, image_path, BakedLightmapEditorPlugin::bake_func_step);
+		}
+		BakedLightmapEditorPlugin::bake_func_end();
+
+		if (bake_err != BakedLightmap::BAKE_ERROR_OK) {
+			ERR_PRINT(vformat("Failed baking lightmap '%s' in %s, error %d.", lightmap->get_name(), p_path, int(bake_err)));
+			err = FAILED;
+		}
+	}
+
+	if (err == OK && (lightmaps.size() || probes.size())) {
+		Ref<PackedScene> packed;
+		packed.instance();
+		err = packed->pack(root);
+		if (err == OK) {
+			err = ResourceSaver::save(p_path, packed);
+		}
+		if (err != OK) {
+			ERR_PRINT(vformat("Can't save baked scene %s.", p_path));
+		}
+	}
+
+	remove_child(root);
+	memdelete(root);
+
+	return err;
+}
+
 void EditorNode::show_accept(const String &p_text, const String &p_title) {
 	current_option = -1;
 	accept->get_ok_button()->set_text(p_title);
@@ -516,6 +516,7 @@ private:
 	void _unhandled_input(const Ref<InputEvent> &p_event);
 
 	static void _load_error_notify(void *p_ud, const String &p_text);
+	void _add_io_error_deferred(const String &p_error);
 
 	bool has_main_screen() const { return true; }
 
@@ -564,6 +565,11 @@ private:
 		bool pack_only = false;
 	} export_defer;
 
+	Vector<String> bake_lighting_defer; // Scenes to bake from the command line, before exporting.
+
+	static void _find_lighting_to_bake(Node *p_node, Node *p_root, List<Node *> &r_lightmaps, List<Node *> &r_probes);
+	Error _bake_scene_lighting(const String &p_path);
+
 	bool cmdline_export_mode;
 
 	static EditorNode *singleton;
@@ -794,6 +800,7 @@ public:
 	void _copy_warning(const String &p_str);
 
 	Error export_preset(const String &p_preset, const String &p_path, bool p_debug, bool p_pack_only);
+	Error bake_lighting(const Vector<String> &p_scenes);
 
 	static void register_editor_types();
 	static void unregister_editor_types();
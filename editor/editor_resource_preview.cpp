@@ -34,7 +34,9 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/message_queue.h"
+#include "core/os/dir_access.h"
 #include "core/os/file_access.h"
+#include "core/os/os.h"
 #include "editor_node.h"
 #include "editor_scale.h"
 #include "editor_settings.h"
@@ -81,12 +83,21 @@ bool EditorResourcePreviewGenerator::can_generate_small_preview() const {
 	return false;
 }
 
+bool EditorResourcePreviewGenerator::can_generate_in_parallel() const {
+	if (get_script_instance() && get_script_instance()->has_method("can_generate_in_parallel")) {
+		return get_script_instance()->call("can_generate_in_parallel");
+	}
+
+	return false;
+}
+
 void EditorResourcePreviewGenerator::_bind_methods() {
 	ClassDB::add_virtual_method(get_class_static(), MethodInfo(Variant::BOOL, "handles", PropertyInfo(Variant::STRING, "type")));
 	ClassDB::add_virtual_method(get_class_static(), MethodInfo(CLASS_INFO(Texture2D), "generate", PropertyInfo(Variant::OBJECT, "from", PROPERTY_HINT_RESOURCE_TYPE, "Resource"), PropertyInfo(Variant::VECTOR2, "size")));
 	ClassDB::add_virtual_method(get_class_static(), MethodInfo(CLASS_INFO(Texture2D), "generate_from_path", PropertyInfo(Variant::STRING, "path", PROPERTY_HINT_FILE), PropertyInfo(Variant::VECTOR2, "size")));
 	ClassDB::add_virtual_method(get_class_static(), MethodInfo(Variant::BOOL, "generate_small_preview_automatically"));
 	ClassDB::add_virtual_method(get_class_static(), MethodInfo(Variant::BOOL, "can_generate_small_preview"));
+	ClassDB::add_virtual_method(get_class_static(), MethodInfo(Variant::BOOL, "can_generate_in_parallel"));
 }
 
 EditorResourcePreviewGenerator::EditorResourcePreviewGenerator() {
@@ -184,146 +195,175 @@ void EditorResourcePreview::_generate_preview(Ref<ImageTexture> &r_texture, Ref<
 		break;
 	}
 
-	if (!p_item.resource.is_valid()) {
+	if (!p_item.resource.is_valid() && cache_base != String()) {
 		// cache the preview in case it's a resource on disk
 		if (r_texture.is_valid()) {
 			//wow it generated a preview... save cache
-			bool has_small_texture = r_small_texture.is_valid();
+			DirAccess *da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+			da->make_dir_recursive(cache_base.get_base_dir());
+			memdelete(da);
+
 			ResourceSaver::save(cache_base + ".png", r_texture);
-			if (has_small_texture) {
+			if (r_small_texture.is_valid()) {
 				ResourceSaver::save(cache_base + "_small.png", r_small_texture);
 			}
-			FileAccess *f = FileAccess::open(cache_base + ".txt", FileAccess::WRITE);
-			ERR_FAIL_COND_MSG(!f, "Cannot create file '" + cache_base + ".txt'. Check user write permissions.");
-			f->store_line(itos(thumbnail_size));
-			f->store_line(itos(has_small_texture));
-			f->store_line(itos(FileAccess::get_modified_time(p_item.path)));
-			f->store_line(FileAccess::get_md5(p_item.path));
-			f->close();
+		}
+	}
+}
+
+bool EditorResourcePreview::_load_thumbnails(const String &p_thumbnail_base, Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture) {
+	if (!FileAccess::exists(p_thumbnail_base + ".png")) {
+		return false;
+	}
+
+	Ref<Image> img;
+	img.instance();
+	if (img->load(p_thumbnail_base + ".png") != OK) {
+		return false;
+	}
+
+	Ref<Image> small_img;
+	if (FileAccess::exists(p_thumbnail_base + "_small.png")) {
+		small_img.instance();
+		if (small_img->load(p_thumbnail_base + "_small.png") != OK) {
+			return false;
+		}
+	}
+
+	r_texture.instance();
+	r_texture->create_from_image(img);
+	if (small_img.is_valid()) {
+		r_small_texture.instance();
+		r_small_texture->create_from_image(small_img);
+	}
+	return true;
+}
+
+bool EditorResourcePreview::_can_generate_in_parallel(const QueueItem &p_item) const {
+	if (p_item.resource.is_valid()) {
+		return false;
+	}
+
+	String type = ResourceLoader::get_resource_type(p_item.path);
+	if (type == "") {
+		return false;
+	}
+
+	for (int i = 0; i < preview_generators.size(); i++) {
+		if (preview_generators[i]->handles(type)) {
+			return preview_generators[i]->can_generate_in_parallel();
+		}
+	}
+	return true; // No preview, nothing to generate.
+}
+
+void EditorResourcePreview::_process_item(const QueueItem &p_item) {
+	preview_mutex.lock();
+
+	if (cache.has(p_item.path)) {
+		//already has it because someone loaded it, just let it know it's ready
+		String path = p_item.path;
+		if (p_item.resource.is_valid()) {
+			path += ":" + itos(cache[p_item.path].last_hash); //keep last hash (see description of what this is in condition below)
+		}
+
+		_preview_ready(path, cache[p_item.path].preview, cache[p_item.path].small_preview, p_item.id, p_item.function, p_item.userdata);
+
+		preview_mutex.unlock();
+		return;
+	}
+
+	preview_mutex.unlock();
+
+	Ref<ImageTexture> texture;
+	Ref<ImageTexture> small_texture;
+
+	if (p_item.resource.is_valid()) {
+		_generate_preview(texture, small_texture, p_item, String());
+
+		//adding hash to the end of path (should be ID:<objid>:<hash>) because of 5 argument limit to call_deferred
+		_preview_ready(p_item.path + ":" + itos(p_item.resource->hash_edited_version()), texture, small_texture, p_item.id, p_item.function, p_item.userdata);
+		return;
+	}
+
+	int thumbnail_size = EditorSettings::get_singleton()->get("filesystem/file_dialog/thumbnail_size");
+	thumbnail_size *= EDSCALE;
+
+	// Each path remembers the md5 of its file, the thumbnails are stored by md5 and size in the
+	// editor cache, so files with the same contents share them (also between projects).
+	String temp_path = EditorSettings::get_singleton()->get_cache_dir();
+	String file = temp_path.plus_file("resthumb-" + ProjectSettings::get_singleton()->globalize_path(p_item.path).md5_text() + ".txt");
+	uint64_t modtime = FileAccess::get_modified_time(p_item.path);
+	String md5;
+
+	FileAccess *f = FileAccess::open(file, FileAccess::READ);
+	if (f) {
+		uint64_t last_modtime = f->get_line().to_int();
+		String last_md5 = f->get_line();
+		memdelete(f);
+
+		if (last_modtime == modtime) {
+			md5 = last_md5;
+		}
+	}
+
+	if (md5 == String()) {
+		md5 = FileAccess::get_md5(p_item.path);
+
+		f = FileAccess::open(file, FileAccess::WRITE);
+		if (!f) {
+			// Not returning as this would leave the item without a preview, it's just not cached.
+			ERR_PRINT("Cannot create file '" + file + "'. Check user write permissions.");
+		} else {
+			f->store_line(itos(modtime));
+			f->store_line(md5);
 			memdelete(f);
 		}
 	}
+
+	String thumbnail_base;
+	if (md5 != String()) {
+		thumbnail_base = temp_path.plus_file("resthumbs").plus_file(md5 + "-" + itos(thumbnail_size));
+	}
+
+	if (thumbnail_base == String() || !_load_thumbnails(thumbnail_base, texture, small_texture)) {
+		_generate_preview(texture, small_texture, p_item, thumbnail_base);
+	}
+
+	_preview_ready(p_item.path, texture, small_texture, p_item.id, p_item.function, p_item.userdata);
+}
+
+void EditorResourcePreview::_process_item_job(uint32_t p_index, const QueueItem *p_items) {
+	_process_item(p_items[p_index]);
 }
 
 void EditorResourcePreview::_thread() {
 	exited = false;
 	while (!exit) {
 		preview_sem.wait();
-		preview_mutex.lock();
 
-		if (queue.size()) {
-			QueueItem item = queue.front()->get();
+		Vector<QueueItem> items;
+		preview_mutex.lock();
+		while (queue.size() && items.size() < MAX_BATCH_ITEMS) {
+			items.push_back(queue.front()->get());
 			queue.pop_front();
+		}
+		preview_mutex.unlock();
 
-			if (cache.has(item.path)) {
-				//already has it because someone loaded it, just let it know it's ready
-				String path = item.path;
-				if (item.resource.is_valid()) {
-					path += ":" + itos(cache[item.path].last_hash); //keep last hash (see description of what this is in condition below)
-				}
-
-				_preview_ready(path, cache[item.path].preview, cache[item.path].small_preview, item.id, item.function, item.userdata);
-
-				preview_mutex.unlock();
+		// Previews that don't need the renderer (e.g. images or audio) are generated in parallel.
+		Vector<QueueItem> parallel_items;
+		for (int i = 0; i < items.size(); i++) {
+			if (items.size() > 1 && _can_generate_in_parallel(items[i])) {
+				parallel_items.push_back(items[i]);
 			} else {
-				preview_mutex.unlock();
-
-				Ref<ImageTexture> texture;
-				Ref<ImageTexture> small_texture;
-
-				int thumbnail_size = EditorSettings::get_singleton()->get("filesystem/file_dialog/thumbnail_size");
-				thumbnail_size *= EDSCALE;
-
-				if (item.resource.is_valid()) {
-					_generate_preview(texture, small_texture, item, String());
-
-					//adding hash to the end of path (should be ID:<objid>:<hash>) because of 5 argument limit to call_deferred
-					_preview_ready(item.path + ":" + itos(item.resource->hash_edited_version()), texture, small_texture, item.id, item.function, item.userdata);
-
-				} else {
-					String temp_path = EditorSettings::get_singleton()->get_cache_dir();
-					String cache_base = ProjectSettings::get_singleton()->globalize_path(item.path).md5_text();
-					cache_base = temp_path.plus_file("resthumb-" + cache_base);
-
-					//does not have it, try to load a cached thumbnail
-
-					String file = cache_base + ".txt";
-					FileAccess *f = FileAccess::open(file, FileAccess::READ);
-					if (!f) {
-						// No cache found, generate
-						_generate_preview(texture, small_texture, item, cache_base);
-					} else {
-						uint64_t modtime = FileAccess::get_modified_time(item.path);
-						int tsize = f->get_line().to_int();
-						bool has_small_texture = f->get_line().to_int();
-						uint64_t last_modtime = f->get_line().to_int();
-
-						bool cache_valid = true;
-
-						if (tsize != thumbnail_size) {
-							cache_valid = false;
-							memdelete(f);
-						} else if (last_modtime != modtime) {
-							String last_md5 = f->get_line();
-							String md5 = FileAccess::get_md5(item.path);
-							memdelete(f);
-
-							if (last_md5 != md5) {
-								cache_valid = false;
-
-							} else {
-								//update modified time
-
-								f = FileAccess::open(file, FileAccess::WRITE);
-								if (!f) {
-									// Not returning as this would leave the thread hanging and would require
-									// some proper cleanup/disabling of resource preview generation.
-									ERR_PRINT("Cannot create file '" + file + "'. Check user write permissions.");
-								} else {
-									f->store_line(itos(thumbnail_size));
-									f->store_line(itos(has_small_texture));
-									f->store_line(itos(modtime));
-									f->store_line(md5);
-									memdelete(f);
-								}
-							}
-						} else {
-							memdelete(f);
-						}
-
-						if (cache_valid) {
-							Ref<Image> img;
-							img.instance();
-							Ref<Image> small_img;
-							small_img.instance();
-
-							if (img->load(cache_base + ".png") != OK) {
-								cache_valid = false;
-							} else {
-								texture.instance();
-								texture->create_from_image(img);
-
-								if (has_small_texture) {
-									if (small_img->load(cache_base + "_small.png") != OK) {
-										cache_valid = false;
-									} else {
-										small_texture.instance();
-										small_texture->create_from_image(small_img);
-									}
-								}
-							}
-						}
-
-						if (!cache_valid) {
-							_generate_preview(texture, small_texture, item, cache_base);
-						}
-					}
-					_preview_ready(item.path, texture, small_texture, item.id, item.function, item.userdata);
-				}
+				_process_item(items[i]);
 			}
+		}
 
-		} else {
-			preview_mutex.unlock();
+		if (parallel_items.size() > 1) {
+			work_pool.do_work(parallel_items.size(), this, &EditorResourcePreview::_process_item_job, parallel_items.ptr());
+		} else if (parallel_items.size() == 1) {
+			_process_item(parallel_items[0]);
 		}
 	}
 	exited = true;
@@ -425,6 +465,7 @@ void EditorResourcePreview::check_for_invalidation(const String &p_path) {
 
 void EditorResourcePreview::start() {
 	ERR_FAIL_COND_MSG(thread.is_started(), "Thread already started.");
+	work_pool.init(OS::get_singleton()->can_use_threads() ? OS::get_singleton()->get_processor_count() : 1);
 	thread.start(_thread_func, this);
 }
 
@@ -437,6 +478,7 @@ void EditorResourcePreview::stop() {
 			RenderingServer::get_singleton()->sync(); //sync pending stuff, as thread may be blocked on visual server
 		}
 		thread.wait_to_finish();
+		work_pool.finish();
 	}
 }
 
@@ -33,6 +33,7 @@
 
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/templates/thread_work_pool.h"
 #include "scene/main/node.h"
 #include "scene/resources/texture.h"
 
@@ -49,6 +50,7 @@ public:
 
 	virtual bool generate_small_preview_automatically() const;
 	virtual bool can_generate_small_preview() const;
+	virtual bool can_generate_in_parallel() const;
 
 	EditorResourcePreviewGenerator();
 };
@@ -66,11 +68,16 @@ class EditorResourcePreview : public Node {
 		Variant userdata;
 	};
 
+	enum {
+		MAX_BATCH_ITEMS = 64, // Queued items taken at once by the preview thread.
+	};
+
 	List<QueueItem> queue;
 
 	Mutex preview_mutex;
 	Semaphore preview_sem;
 	Thread thread;
+	ThreadWorkPool work_pool;
 	volatile bool exit;
 	volatile bool exited;
 
@@ -88,6 +95,10 @@ class EditorResourcePreview : public Node {
 
 	void _preview_ready(const String &p_str, const Ref<Texture2D> &p_texture, const Ref<Texture2D> &p_small_texture, ObjectID id, const StringName &p_func, const Variant &p_ud);
 	void _generate_preview(Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture, const QueueItem &p_item, const String &cache_base);
+	bool _load_thumbnails(const String &p_thumbnail_base, Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture);
+	bool _can_generate_in_parallel(const QueueItem &p_item) const;
+	void _process_item(const QueueItem &p_item);
+	void _process_item_job(uint32_t p_index, const QueueItem *p_items);
 
 	static void _thread_func(void *ud);
 	void _thread();
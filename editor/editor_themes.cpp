@@ -31,6 +31,9 @@
 #include "editor_themes.h"
 
 #include "core/io/resource_loader.h"
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#include "core/version.h"
 #include "editor_fonts.h"
 #include "editor_icons.gen.h"
 #include "editor_scale.h"
@@ -106,22 +109,140 @@ static Ref<Texture2D> flip_icon(Ref<Texture2D> p_texture, bool p_flip_y = false,
 }
 
 #ifdef MODULE_SVG_ENABLED
-static Ref<ImageTexture> editor_generate_icon(int p_index, bool p_convert_color, float p_scale = EDSCALE, float p_saturation = 1.0) {
-	Ref<ImageTexture> icon = memnew(ImageTexture);
+struct EditorIconRequest {
+	int index = 0;
+	float scale = 1.0;
+	float saturation = 1.0;
+	bool convert_color = false;
+};
+
+#define EDITOR_ICONS_CACHE_MAGIC 0x43494445 // "EDIC"
+#define EDITOR_ICONS_CACHE_KEEP 4 // A full icon set and a thumbnail set, for two themes.
+
+// Generated icons are cached in the editor cache folder, in a file named after everything they
+// depend on, so later launches with the same settings load them instead of rasterizing every SVG.
+static String editor_get_icons_cache_path(const Vector<EditorIconRequest> &p_requests, const Dictionary &p_convert_colors) {
+	static uint32_t sources_hash = 0;
+	if (sources_hash == 0) {
+		sources_hash = hash_djb2_one_32(editor_icons_count);
+		for (int i = 0; i < editor_icons_count; i++) {
+			sources_hash = hash_djb2_one_32(hash_djb2(editor_icons_sources[i]), sources_hash);
+		}
+	}
+
+	String key = String(VERSION_FULL_BUILD) + "|" + itos(sources_hash);
+	for (int i = 0; i < p_requests.size(); i++) {
+		const EditorIconRequest &request = p_requests[i];
+		key += vformat("|%d,%f,%f,%d", request.index, request.scale, request.saturation, request.convert_color);
+	}
+	List<Variant> colors;
+	p_convert_colors.get_key_list(&colors);
+	for (List<Variant>::Element *E = colors.front(); E; E = E->next()) {
+		key += "|" + Color(E->get()).to_html() + ">" + Color(p_convert_colors[E->get()]).to_html();
+	}
+
+	return EditorSettings::get_singleton()->get_cache_dir().plus_file("editor_icons_" + key.md5_text() + ".cache");
+}
+
+static bool editor_load_icons_cache(const String &p_path, const Vector<EditorIconRequest> &p_requests, Vector<Ref<Image>> &r_images) {
+	FileAccessRef f = FileAccess::open(p_path, FileAccess::READ);
+	if (!f || f->get_32() != EDITOR_ICONS_CACHE_MAGIC || f->get_32() != (uint32_t)p_requests.size()) {
+		return false;
+	}
+
+	r_images.resize(p_requests.size());
+	for (int i = 0; i < p_requests.size(); i++) {
+		uint32_t width = f->get_32();
+		uint32_t height = f->get_32();
+		uint32_t format = f->get_32();
+		bool mipmaps = f->get_8();
+		uint32_t size = f->get_32();
+		// Check the header before allocating anything, the file may be truncated or corrupt.
+		if (f->eof_reached() || width == 0 || width > Image::MAX_WIDTH || height == 0 || height > Image::MAX_HEIGHT || format >= Image::FORMAT_MAX) {
+			return false;
+		}
+		if (size != uint32_t(Image::get_image_data_size(width, height, Image::Format(format), mipmaps))) {
+			return false;
+		}
+		Vector<uint8_t> data;
+		data.resize(size);
+		if (f->get_buffer(data.ptrw(), size) != int(size)) {
+			return false;
+		}
+		r_images.write[i].instance();
+		r_images.write[i]->create(width, height, mipmaps, Image::Format(format), data);
+	}
+	return true;
+}
+
+static void editor_save_icons_cache(const String &p_path, const Vector<Ref<Image>> &p_images) {
+	FileAccessRef f = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(!f, "Can't save the editor icons cache to: " + p_path);
+
+	f->store_32(EDITOR_ICONS_CACHE_MAGIC);
+	f->store_32(p_images.size());
+	for (int i = 0; i < p_images.size(); i++) {
+		const Ref<Image> &img = p_images[i];
+		Vector<uint8_t> data = img->get_data();
+		f->store_32(img->get_width());
+		f->store_32(img->get_height());
+		f->store_32(img->get_format());
+		f->store_8(img->has_mipmaps());
+		f->store_32(data.size());
+		f->store_buffer(data.ptr(), data.size());
+	}
+}
+
+struct EditorIconsCacheFile {
+	String name;
+	uint64_t modified_time = 0;
+
+	bool operator<(const EditorIconsCacheFile &p_other) const {
+		return modified_time > p_other.modified_time; // Newest first.
+	}
+};
+
+// Every change of theme, scale or saturation writes a new cache file, only keep the most recent ones.
+static void editor_prune_icons_caches() {
+	const String cache_dir = EditorSettings::get_singleton()->get_cache_dir();
+	DirAccessRef da = DirAccess::open(cache_dir);
+	if (!da) {
+		return;
+	}
+
+	Vector<EditorIconsCacheFile> caches;
+	da->list_dir_begin();
+	String file = da->get_next();
+	while (file != String()) {
+		if (!da->current_is_dir() && file.begins_with("editor_icons_") && file.ends_with(".cache")) {
+			EditorIconsCacheFile cache;
+			cache.name = file;
+			cache.modified_time = FileAccess::get_modified_time(cache_dir.plus_file(file));
+			caches.push_back(cache);
+		}
+		file = da->get_next();
+	}
+	da->list_dir_end();
+
+	caches.sort();
+	for (int i = EDITOR_ICONS_CACHE_KEEP; i < caches.size(); i++) {
+		da->remove(caches[i].name);
+	}
+}
+
+static Ref<Image> editor_rasterize_icon(const EditorIconRequest &p_request) {
 	Ref<Image> img = memnew(Image);
 
 	// Upsample icon generation only if the editor scale isn't an integer multiplier.
 	// Generating upsampled icons is slower, and the benefit is hardly visible
 	// with integer editor scales.
-	const bool upsample = !Math::is_equal_approx(Math::round(p_scale), p_scale);
-	ImageLoaderSVG::create_image_from_string(img, editor_icons_sources[p_index], p_scale, upsample, p_convert_color);
+	const bool upsample = !Math::is_equal_approx(Math::round(p_request.scale), p_request.scale);
+	ImageLoaderSVG::create_image_from_string(img, editor_icons_sources[p_request.index], p_request.scale, upsample, p_request.convert_color);
 
-	if (p_saturation != 1.0) {
-		img->adjust_bcs(1.0, 1.0, p_saturation);
+	if (p_request.saturation != 1.0) {
+		img->adjust_bcs(1.0, 1.0, p_request.saturation);
 	}
-	icon->create_from_image(img); // in this case filter really helps
-
-	return icon;
+	return img;
 }
 #endif
 
@@ -236,7 +357,7 @@ void editor_register_and_generate_icons(Ref<Theme> p_theme, bool p_dark_theme =
 	dark_icon_color_dictionary[Color::html("#45ff8b")] = success_color;
 	dark_icon_color_dictionary[Color::html("#dbab09")] = warning_color;
 
-	ImageLoaderSVG::set_convert_colors(&dark_icon_color_dictionary);
+	Vector<EditorIconRequest> requests;
 
 	// Generate icons.
 	if (!p_only_thumbs) {
@@ -253,10 +374,12 @@ void editor_register_and_generate_icons(Ref<Theme> p_theme, bool p_dark_theme =
 				saturation = 1.0;
 			}
 
-			const int is_exception = exceptions.has(editor_icons_names[i]);
-			const Ref<ImageTexture> icon = editor_generate_icon(i, !is_exception, icon_scale, saturation);
-
-			p_theme->set_icon(editor_icons_names[i], "EditorIcons", icon);
+			EditorIconRequest request;
+			request.index = i;
+			request.scale = icon_scale;
+			request.saturation = saturation;
+			request.convert_color = !exceptions.has(editor_icons_names[i]);
+			requests.push_back(request);
 		}
 	}
 
@@ -267,23 +390,45 @@ void editor_register_and_generate_icons(Ref<Theme> p_theme, bool p_dark_theme =
 		const float scale = (float)p_thumb_size / 64.0 * EDSCALE;
 		for (int i = 0; i < editor_bg_thumbs_count; i++) {
 			const int index = editor_bg_thumbs_indices[i];
-			const int is_exception = exceptions.has(editor_icons_names[index]);
-			const Ref<ImageTexture> icon = editor_generate_icon(index, !p_dark_theme && !is_exception, scale, force_filter);
-
-			p_theme->set_icon(editor_icons_names[index], "EditorIcons", icon);
+			EditorIconRequest request;
+			request.index = index;
+			request.scale = scale;
+			request.saturation = force_filter;
+			request.convert_color = !p_dark_theme && !exceptions.has(editor_icons_names[index]);
+			requests.push_back(request);
 		}
 	} else {
 		const float scale = (float)p_thumb_size / 32.0 * EDSCALE;
 		for (int i = 0; i < editor_md_thumbs_count; i++) {
 			const int index = editor_md_thumbs_indices[i];
-			const bool is_exception = exceptions.has(editor_icons_names[index]);
-			const Ref<ImageTexture> icon = editor_generate_icon(index, !p_dark_theme && !is_exception, scale, force_filter);
+			EditorIconRequest request;
+			request.index = index;
+			request.scale = scale;
+			request.saturation = force_filter;
+			request.convert_color = !p_dark_theme && !exceptions.has(editor_icons_names[index]);
+			requests.push_back(request);
+		}
+	}
 
-			p_theme->set_icon(editor_icons_names[index], "EditorIcons", icon);
+	const String cache_path = editor_get_icons_cache_path(requests, dark_icon_color_dictionary);
+	Vector<Ref<Image>> images;
+	if (!editor_load_icons_cache(cache_path, requests, images)) {
+		ImageLoaderSVG::set_convert_colors(&dark_icon_color_dictionary);
+		images.resize(requests.size());
+		for (int i = 0; i < requests.size(); i++) {
+			images.write[i] = editor_rasterize_icon(requests[i]);
 		}
+		ImageLoaderSVG::set_convert_colors(nullptr);
+
+		editor_save_icons_cache(cache_path, images);
+		editor_prune_icons_caches();
 	}
 
-	ImageLoaderSVG::set_convert_colors(nullptr);
+	for (int i = 0; i < requests.size(); i++) {
+		Ref<ImageTexture> icon = memnew(ImageTexture);
+		icon->create_from_image(images[i]); // in this case filter really helps
+		p_theme->set_icon(editor_icons_names[requests[i].index], "EditorIcons", icon);
+	}
 #else
 	WARN_PRINT("SVG support disabled, editor icons won't be rendered.");
 #endif
@@ -31,7 +31,9 @@
 #include "find_in_files.h"
 
 #include "core/os/dir_access.h"
+#include "core/os/file_access.h"
 #include "core/os/os.h"
+#include "core/templates/thread_work_pool.h"
 #include "editor_node.h"
 #include "editor_scale.h"
 #include "scene/gui/box_container.h"
@@ -85,6 +87,51 @@ static bool find_next(const String &line, String pattern, int from, bool match_c
 	}
 }
 
+static _FORCE_INLINE_ uint8_t ascii_lower(uint8_t c) {
+	return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+// Byte search on raw UTF-8 to rule out files and lines before decoding them. Without matching case,
+// only ASCII letters are folded (the pattern must be ASCII), like findn() does for them.
+static bool contains_bytes(const uint8_t *p_data, int p_size, const char *p_pattern, int p_length, bool p_match_case) {
+	if (p_length == 0) {
+		return true;
+	}
+
+	const uint8_t *pattern = (const uint8_t *)p_pattern;
+
+	if (p_match_case) {
+		const uint8_t *from = p_data;
+		const uint8_t *last = p_data + p_size - p_length;
+		while (from <= last) {
+			const uint8_t *found = (const uint8_t *)memchr(from, pattern[0], last - from + 1);
+			if (!found) {
+				return false;
+			}
+			if (memcmp(found + 1, pattern + 1, p_length - 1) == 0) {
+				return true;
+			}
+			from = found + 1;
+		}
+		return false;
+	}
+
+	uint8_t first = ascii_lower(pattern[0]);
+	for (int i = 0; i <= p_size - p_length; i++) {
+		if (ascii_lower(p_data[i]) != first) {
+			continue;
+		}
+		int j = 1;
+		while (j < p_length && ascii_lower(p_data[i + j]) == ascii_lower(pattern[j])) {
+			j++;
+		}
+		if (j == p_length) {
+			return true;
+		}
+	}
+	return false;
+}
+
 //--------------------------------------------------------------------------------
 
 void FindInFiles::set_search_text(String p_pattern) {
@@ -125,15 +172,27 @@ void FindInFiles::start() {
 		return;
 	}
 
+	stop();
+
 	// Init search
 	_current_dir = "";
 	PackedStringArray init_folder;
 	init_folder.push_back(_root_dir);
 	_folders_stack.clear();
 	_folders_stack.push_back(init_folder);
+	_files_to_scan.clear();
 
 	_initial_files_count = 0;
 
+	_pattern_utf8 = _pattern.utf8();
+	_pattern_ascii = true;
+	for (int i = 0; i < _pattern.length(); i++) {
+		if (_pattern[i] > 127) {
+			_pattern_ascii = false;
+			break;
+		}
+	}
+
 	_searching = true;
 	set_process(true);
 }
@@ -142,20 +201,104 @@ void FindInFiles::stop() {
 	_searching = false;
 	_current_dir = "";
 	set_process(false);
+
+	if (_search_thread.is_started()) {
+		_abort.store(true);
+		_search_thread.wait_to_finish();
+	}
+
+	MutexLock lock(_results_mutex);
+	_results.clear();
 }
 
-void FindInFiles::_process() {
-	// This part can be moved to a thread if needed
+FindInFiles::~FindInFiles() {
+	if (_search_thread.is_started()) {
+		_abort.store(true);
+		_search_thread.wait_to_finish();
+	}
+}
 
+void FindInFiles::_process() {
 	OS &os = *OS::get_singleton();
 	float time_before = os.get_ticks_msec();
-	while (is_processing()) {
+	while (is_processing() && !_search_thread.is_started()) {
 		_iterate();
 		float elapsed = (os.get_ticks_msec() - time_before);
 		if (elapsed > 1000.0 / 120.0) {
 			break;
 		}
 	}
+
+	if (_search_thread.is_started()) {
+		_emit_results();
+	}
+}
+
+void FindInFiles::_emit_results() {
+	OS &os = *OS::get_singleton();
+	float time_before = os.get_ticks_msec();
+
+	while (true) {
+		Result result;
+		{
+			MutexLock lock(_results_mutex);
+			if (_results.is_empty()) {
+				if (_search_done.load()) {
+					break;
+				}
+				return;
+			}
+			result = _results.front()->get();
+			_results.pop_front();
+		}
+
+		emit_signal(SIGNAL_RESULT_FOUND, result.path, result.line_number, result.begin, result.end, result.line);
+
+		float elapsed = (os.get_ticks_msec() - time_before);
+		if (elapsed > 1000.0 / 120.0) {
+			return;
+		}
+	}
+
+	// All files searched and all results emitted.
+	_search_thread.wait_to_finish();
+	_finish_search();
+}
+
+void FindInFiles::_finish_search() {
+	print_verbose("Search complete");
+	set_process(false);
+	_current_dir = "";
+	_searching = false;
+	emit_signal(SIGNAL_FINISHED);
+}
+
+void FindInFiles::_search_thread_func(void *p_userdata) {
+	FindInFiles *fif = (FindInFiles *)p_userdata;
+
+	ThreadWorkPool work_pool;
+	work_pool.init(OS::get_singleton()->get_processor_count());
+	work_pool.do_work(fif->_files_to_scan.size(), fif, &FindInFiles::_scan_file_job, (void *)nullptr);
+	work_pool.finish();
+
+	fif->_search_done.store(true);
+}
+
+void FindInFiles::_scan_file_job(uint32_t p_index, void *p_userdata) {
+	if (!_abort.load()) {
+		Vector<Result> results;
+		_scan_file(_files_to_scan[p_index], results);
+
+		if (results.size()) {
+			// Results of a file are kept together, files can finish in any order.
+			MutexLock lock(_results_mutex);
+			for (int i = 0; i < results.size(); i++) {
+				_results.push_back(results[i]);
+			}
+		}
+	}
+
+	_files_scanned.fetch_add(1);
 }
 
 void FindInFiles::_iterate() {
@@ -184,30 +327,23 @@ void FindInFiles::_iterate() {
 			_current_dir = _current_dir.get_base_dir();
 
 			if (_folders_stack.size() == 0) {
-				// All folders scanned
+				// All folders scanned, then scan files
 				_initial_files_count = _files_to_scan.size();
+				_files_scanned.store(0);
+				_search_done.store(false);
+				_abort.store(false);
+				_search_thread.start(_search_thread_func, this);
 			}
 		}
 
-	} else if (_files_to_scan.size() != 0) {
-		// Then scan files
-
-		String fpath = _files_to_scan[_files_to_scan.size() - 1];
-		pop_back(_files_to_scan);
-		_scan_file(fpath);
-
 	} else {
-		print_verbose("Search complete");
-		set_process(false);
-		_current_dir = "";
-		_searching = false;
-		emit_signal(SIGNAL_FINISHED);
+		_finish_search();
 	}
 }
 
 float FindInFiles::get_progress() const {
 	if (_initial_files_count != 0) {
-		return static_cast<float>(_initial_files_count - _files_to_scan.size()) / static_cast<float>(_initial_files_count);
+		return static_cast<float>(_files_scanned.load()) / static_cast<float>(_initial_files_count);
 	}
 	return 0;
 }
@@ -248,30 +384,56 @@ void FindInFiles::_scan_dir(String path, PackedStringArray &out_folders) {
 	}
 }
 
-void FindInFiles::_scan_file(String fpath) {
-	FileAccessRef f = FileAccess::open(fpath, FileAccess::READ);
-	if (!f) {
+void FindInFiles::_scan_file(const String &fpath, Vector<Result> &r_results) const {
+	Error err;
+	Vector<uint8_t> data = FileAccess::get_file_as_array(fpath, &err);
+	if (err != OK) {
 		print_verbose(String("Cannot open file ") + fpath);
 		return;
 	}
 
+	// Most files don't contain the pattern at all, only decode the lines that may.
+	bool prefilter = _match_case || _pattern_ascii;
+	const uint8_t *r = data.ptr();
+	if (prefilter && !contains_bytes(r, data.size(), _pattern_utf8.get_data(), _pattern_utf8.length(), _match_case)) {
+		return;
+	}
+
 	int line_number = 0;
+	int from = 0;
 
-	while (!f->eof_reached()) {
+	// Lines are split like FileAccess::get_line() does.
+	while (from < data.size()) {
 		// line number starts at 1
 		++line_number;
 
-		int begin = 0;
-		int end = 0;
+		int to = from;
+		while (to < data.size() && r[to] != '\n' && r[to] != '\0') {
+			to++;
+		}
 
-		String line = f->get_line();
+		if (!prefilter || contains_bytes(&r[from], to - from, _pattern_utf8.get_data(), _pattern_utf8.length(), _match_case)) {
+			String line = String::utf8((const char *)&r[from], to - from);
+			if (line.find("\r") != -1) {
+				line = line.replace("\r", "");
+			}
 
-		while (find_next(line, _pattern, end, _match_case, _whole_words, begin, end)) {
-			emit_signal(SIGNAL_RESULT_FOUND, fpath, line_number, begin, end, line);
+			int begin = 0;
+			int end = 0;
+
+			while (find_next(line, _pattern, end, _match_case, _whole_words, begin, end)) {
+				Result result;
+				result.path = fpath;
+				result.line_number = line_number;
+				result.begin = begin;
+				result.end = end;
+				result.line = line;
+				r_results.push_back(result);
+			}
 		}
-	}
 
-	f->close();
+		from = to + 1;
+	}
 }
 
 void FindInFiles::_bind_methods() {
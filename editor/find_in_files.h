@@ -31,9 +31,13 @@
 #ifndef FIND_IN_FILES_H
 #define FIND_IN_FILES_H
 
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "core/templates/hash_map.h"
 #include "scene/gui/dialogs.h"
 
+#include <atomic>
+
 // Performs the actual search
 class FindInFiles : public Node {
 	GDCLASS(FindInFiles, Node);
@@ -59,16 +63,30 @@ public:
 	bool is_searching() const { return _searching; }
 	float get_progress() const;
 
+	~FindInFiles();
+
 protected:
 	void _notification(int p_notification);
 
 	static void _bind_methods();
 
 private:
+	struct Result {
+		String path;
+		int line_number = 0;
+		int begin = 0;
+		int end = 0;
+		String line;
+	};
+
 	void _process();
 	void _iterate();
 	void _scan_dir(String path, PackedStringArray &out_folders);
-	void _scan_file(String fpath);
+	void _scan_file(const String &fpath, Vector<Result> &r_results) const;
+	void _scan_file_job(uint32_t p_index, void *p_userdata);
+	static void _search_thread_func(void *p_userdata);
+	void _emit_results();
+	void _finish_search();
 
 	// Config
 	String _pattern;
@@ -83,6 +101,16 @@ private:
 	Vector<PackedStringArray> _folders_stack;
 	Vector<String> _files_to_scan;
 	int _initial_files_count = 0;
+
+	// Files are searched on a thread once the folders are listed, results are emitted from the main thread.
+	CharString _pattern_utf8;
+	bool _pattern_ascii = true;
+	Thread _search_thread;
+	Mutex _results_mutex;
+	List<Result> _results;
+	std::atomic<uint32_t> _files_scanned = { 0 };
+	std::atomic<bool> _search_done = { false };
+	std::atomic<bool> _abort = { false };
 };
 
 class LineEdit;
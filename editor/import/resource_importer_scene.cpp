@@ -895,6 +895,23 @@ void ResourceImporterScene::_optimize_animations(Node *scene, float p_max_lin_er
 	}
 }
 
+void ResourceImporterScene::_compress_animations(Node *scene) {
+	if (!scene->has_node(String("AnimationPlayer"))) {
+		return;
+	}
+	Node *n = scene->get_node(String("AnimationPlayer"));
+	ERR_FAIL_COND(!n);
+	AnimationPlayer *anim = Object::cast_to<AnimationPlayer>(n);
+	ERR_FAIL_COND(!anim);
+
+	List<StringName> anim_names;
+	anim->get_animation_list(&anim_names);
+	for (List<StringName>::Element *E = anim_names.front(); E; E = E->next()) {
+		Ref<Animation> a = anim->get_animation(E->get());
+		a->compress();
+	}
+}
+
 static String _make_extname(const String &p_str) {
 	String ext_name = p_str.replace(".", "_");
 	ext_name = ext_name.replace(":", "_");
@@ -1129,7 +1146,11 @@ void ResourceImporterScene::get_import_options(List<ImportOption> *r_options, in
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/ensure_tangents"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "meshes/storage", PROPERTY_HINT_ENUM, "Built-In,Files (.mesh),Files (.tres)"), meshes_out ? 1 : 0));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/generate_lods"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/optimize_indices"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/compress_uv"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/generate_clusters"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/create_shadow_meshes"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/precompute_convex_decomposition"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "meshes/light_baking", PROPERTY_HINT_ENUM, "Disabled,Enable,Gen Lightmaps", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), 0));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/lightmap_texel_size", PROPERTY_HINT_RANGE, "0.001,100,0.001"), 0.1));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "skins/use_named_skins"), true));
@@ -1144,6 +1165,7 @@ void ResourceImporterScene::get_import_options(List<ImportOption> *r_options, in
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "animation/optimizer/max_angular_error"), 0.01));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "animation/optimizer/max_angle"), 22));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "animation/optimizer/remove_unused_tracks"), true));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "animation/compression/enabled"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "animation/clips/amount", PROPERTY_HINT_RANGE, "0,256,1", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), 0));
 	for (int i = 0; i < 256; i++) {
 		r_options->push_back(ImportOption(PropertyInfo(Variant::STRING, "animation/clip_" + itos(i + 1) + "/name"), ""));
@@ -1222,7 +1244,7 @@ Ref<Animation> ResourceImporterScene::import_animation_from_other_importer(Edito
 	return importer->import_animation(p_path, p_flags, p_bake_fps);
 }
 
-void ResourceImporterScene::_generate_meshes(Node *p_node, bool p_generate_lods, bool p_create_shadow_meshes) {
+void ResourceImporterScene::_generate_meshes(Node *p_node, bool p_generate_lods, bool p_optimize_indices, bool p_compress_uv, bool p_generate_clusters, bool p_create_shadow_meshes) {
 	EditorSceneImporterMeshNode3D *src_mesh_node = Object::cast_to<EditorSceneImporterMeshNode3D>(p_node);
 	if (src_mesh_node) {
 		//is mesh
@@ -1238,6 +1260,15 @@ void ResourceImporterScene::_generate_meshes(Node *p_node, bool p_generate_lods,
 				if (p_generate_lods) {
 					src_mesh_node->get_mesh()->generate_lods();
 				}
+				if (p_optimize_indices) {
+					src_mesh_node->get_mesh()->optimize_indices();
+				}
+				if (p_generate_clusters) {
+					src_mesh_node->get_mesh()->generate_clusters();
+				}
+				if (p_compress_uv) {
+					src_mesh_node->get_mesh()->compress_uvs();
+				}
 				if (p_create_shadow_meshes) {
 					src_mesh_node->get_mesh()->create_shadow_mesh();
 				}
@@ -1257,9 +1288,21 @@ void ResourceImporterScene::_generate_meshes(Node *p_node, bool p_generate_lods,
 	}
 
 	for (int i = 0; i < p_node->get_child_count(); i++) {
-		_generate_meshes(p_node->get_child(i), p_generate_lods, p_create_shadow_meshes);
+		_generate_meshes(p_node->get_child(i), p_generate_lods, p_optimize_indices, p_compress_uv, p_generate_clusters, p_create_shadow_meshes);
 	}
 }
+
+void ResourceImporterScene::_collect_meshes(Node *p_node, Set<Ref<Mesh>> &r_meshes) {
+	MeshInstance3D *mesh_node = Object::cast_to<MeshInstance3D>(p_node);
+	if (mesh_node && mesh_node->get_mesh().is_valid()) {
+		r_meshes.insert(mesh_node->get_mesh());
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_collect_meshes(p_node->get_child(i), r_meshes);
+	}
+}
+
 Error ResourceImporterScene::import(const String &p_source_file, const String &p_save_path, const Map<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files, Variant *r_metadata) {
 	const String &src_path = p_source_file;
 
@@ -1353,9 +1396,23 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	}
 
 	bool gen_lods = bool(p_options["meshes/generate_lods"]);
+	bool optimize_indices = bool(p_options["meshes/optimize_indices"]);
+	bool compress_uv = bool(p_options["meshes/compress_uv"]);
+	bool generate_clusters = bool(p_options["meshes/generate_clusters"]);
 	bool create_shadow_meshes = bool(p_options["meshes/create_shadow_meshes"]);
 
-	_generate_meshes(scene, gen_lods, create_shadow_meshes);
+	_generate_meshes(scene, gen_lods, optimize_indices, compress_uv, generate_clusters, create_shadow_meshes);
+
+	if (bool(p_options["meshes/precompute_convex_decomposition"]) && Mesh::convex_composition_function) {
+		// Saved with the meshes, so convex collisions created later (and the convcol suffixes below) don't decompose again.
+		Set<Ref<Mesh>> meshes;
+		_collect_meshes(scene, meshes);
+		Vector<Ref<Mesh>> mesh_list;
+		for (Set<Ref<Mesh>>::Element *E = meshes.front(); E; E = E->next()) {
+			mesh_list.push_back(E->get());
+		}
+		Mesh::precompute_convex_decompositions(mesh_list);
+	}
 
 	err = OK;
 
@@ -1399,6 +1456,10 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 		_filter_tracks(scene, animation_filter);
 	}
 
+	if (bool(p_options["animation/compression/enabled"])) {
+		_compress_animations(scene);
+	}
+
 	bool external_animations = int(p_options["animation/storage"]) == 1 || int(p_options["animation/storage"]) == 2;
 	bool external_animations_as_text = int(p_options["animation/storage"]) == 2;
 	bool keep_custom_tracks = p_options["animation/keep_custom_tracks"];
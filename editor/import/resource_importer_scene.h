@@ -121,7 +121,8 @@ class ResourceImporterScene : public ResourceImporter {
 	};
 
 	void _replace_owner(Node *p_node, Node *p_scene, Node *p_new_owner);
-	void _generate_meshes(Node *p_node, bool p_generate_lods, bool p_create_shadow_meshes);
+	void _generate_meshes(Node *p_node, bool p_generate_lods, bool p_optimize_indices, bool p_compress_uv, bool p_generate_clusters, bool p_create_shadow_meshes);
+	void _collect_meshes(Node *p_node, Set<Ref<Mesh>> &r_meshes);
 
 public:
 	static ResourceImporterScene *get_singleton() { return singleton; }
@@ -155,6 +156,7 @@ public:
 	void _filter_anim_tracks(Ref<Animation> anim, Set<String> &keep);
 	void _filter_tracks(Node *scene, const String &p_text);
 	void _optimize_animations(Node *scene, float p_max_lin_error, float p_max_ang_error, float p_max_angle);
+	void _compress_animations(Node *scene);
 
 	virtual Error import(const String &p_source_file, const String &p_save_path, const Map<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) override;
 
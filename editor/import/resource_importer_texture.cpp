@@ -32,6 +32,9 @@
 
 #include "core/io/config_file.h"
 #include "core/io/image_loader.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/thread_work_pool.h"
 #include "core/version.h"
 #include "editor/editor_file_system.h"
 #include "editor/editor_node.h"
@@ -380,6 +383,11 @@ void ResourceImporterTexture::_save_stex(const Ref<Image> &p_image, const String
 	memdelete(f);
 }
 
+void ResourceImporterTexture::_save_vram_variant(uint32_t p_index, const VRAMSaveData *p_data) {
+	const VRAMVariant &variant = p_data->variants[p_index];
+	_save_stex(p_data->image, p_data->save_path + "." + variant.name + ".stex", COMPRESS_VRAM_COMPRESSED, p_data->lossy_quality, variant.compression, p_data->mipmaps, p_data->streamable, p_data->detect_3d, p_data->detect_roughness, p_data->detect_normal, p_data->force_normal, p_data->srgb_friendly, variant.force_po2, p_data->limit_mipmap, p_data->normal, p_data->roughness_channel);
+}
+
 Error ResourceImporterTexture::import(const String &p_source_file, const String &p_save_path, const Map<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files, Variant *r_metadata) {
 	CompressMode compress_mode = CompressMode(int(p_options["compress/mode"]));
 	float lossy = p_options["compress/lossy_quality"];
@@ -517,29 +525,70 @@ Error ResourceImporterTexture::import(const String &p_source_file, const String
 			}
 		}
 
+		LocalVector<VRAMVariant> variants;
+
 		if (can_bptc || can_s3tc) {
-			_save_stex(image, p_save_path + ".s3tc.stex", compress_mode, lossy, can_bptc ? Image::COMPRESS_BPTC : Image::COMPRESS_S3TC, mipmaps, stream, detect_3d, detect_roughness, detect_normal, force_normal, srgb_friendly_pack, false, mipmap_limit, normal_image, roughness_channel);
-			r_platform_variants->push_back("s3tc");
-			formats_imported.push_back("s3tc");
+			VRAMVariant variant;
+			variant.name = "s3tc";
+			variant.compression = can_bptc ? Image::COMPRESS_BPTC : Image::COMPRESS_S3TC;
+			variants.push_back(variant);
 			ok_on_pc = true;
 		}
 
 		if (ProjectSettings::get_singleton()->get("rendering/vram_compression/import_etc2")) {
-			_save_stex(image, p_save_path + ".etc2.stex", compress_mode, lossy, Image::COMPRESS_ETC2, mipmaps, stream, detect_3d, detect_roughness, detect_normal, force_normal, srgb_friendly_pack, true, mipmap_limit, normal_image, roughness_channel);
-			r_platform_variants->push_back("etc2");
-			formats_imported.push_back("etc2");
+			VRAMVariant variant;
+			variant.name = "etc2";
+			variant.compression = Image::COMPRESS_ETC2;
+			variant.force_po2 = true;
+			variants.push_back(variant);
 		}
 
 		if (ProjectSettings::get_singleton()->get("rendering/vram_compression/import_etc")) {
-			_save_stex(image, p_save_path + ".etc.stex", compress_mode, lossy, Image::COMPRESS_ETC, mipmaps, stream, detect_3d, detect_roughness, detect_normal, force_normal, srgb_friendly_pack, true, mipmap_limit, normal_image, roughness_channel);
-			r_platform_variants->push_back("etc");
-			formats_imported.push_back("etc");
+			VRAMVariant variant;
+			variant.name = "etc";
+			variant.compression = Image::COMPRESS_ETC;
+			variant.force_po2 = true;
+			variants.push_back(variant);
 		}
 
 		if (ProjectSettings::get_singleton()->get("rendering/vram_compression/import_pvrtc")) {
-			_save_stex(image, p_save_path + ".pvrtc.stex", compress_mode, lossy, Image::COMPRESS_PVRTC1_4, mipmaps, stream, detect_3d, detect_roughness, detect_normal, force_normal, srgb_friendly_pack, true, mipmap_limit, normal_image, roughness_channel);
-			r_platform_variants->push_back("pvrtc");
-			formats_imported.push_back("pvrtc");
+			VRAMVariant variant;
+			variant.name = "pvrtc";
+			variant.compression = Image::COMPRESS_PVRTC1_4;
+			variant.force_po2 = true;
+			variants.push_back(variant);
+		}
+
+		VRAMSaveData save_data;
+		save_data.image = image;
+		save_data.save_path = p_save_path;
+		save_data.variants = variants.ptr();
+		save_data.lossy_quality = lossy;
+		save_data.mipmaps = mipmaps;
+		save_data.streamable = stream;
+		save_data.detect_3d = detect_3d;
+		save_data.detect_roughness = detect_roughness;
+		save_data.detect_normal = detect_normal;
+		save_data.force_normal = force_normal;
+		save_data.srgb_friendly = srgb_friendly_pack;
+		save_data.limit_mipmap = mipmap_limit;
+		save_data.normal = normal_image;
+		save_data.roughness_channel = roughness_channel;
+
+		if (variants.size() > 1 && OS::get_singleton()->can_use_threads()) {
+			ThreadWorkPool work_pool;
+			work_pool.init(variants.size());
+			work_pool.do_work(variants.size(), this, &ResourceImporterTexture::_save_vram_variant, (const VRAMSaveData *)&save_data);
+			work_pool.finish();
+		} else {
+			for (uint32_t i = 0; i < variants.size(); i++) {
+				_save_vram_variant(i, &save_data);
+			}
+		}
+
+		for (uint32_t i = 0; i < variants.size(); i++) {
+			r_platform_variants->push_back(variants[i].name);
+			formats_imported.push_back(variants[i].name);
 		}
 
 		if (!ok_on_pc) {
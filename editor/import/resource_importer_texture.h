@@ -76,6 +76,32 @@ protected:
 
 	void _save_stex(const Ref<Image> &p_image, const String &p_to_path, CompressMode p_compress_mode, float p_lossy_quality, Image::CompressMode p_vram_compression, bool p_mipmaps, bool p_streamable, bool p_detect_3d, bool p_detect_srgb, bool p_detect_normal, bool p_force_normal, bool p_srgb_friendly, bool p_force_po2_for_compressed, uint32_t p_limit_mipmap, const Ref<Image> &p_normal, Image::RoughnessChannel p_roughness_channel);
 
+	// VRAM compressed textures are saved once per platform format, the formats are compressed in parallel.
+	struct VRAMVariant {
+		String name;
+		Image::CompressMode compression = Image::COMPRESS_S3TC;
+		bool force_po2 = false;
+	};
+
+	struct VRAMSaveData {
+		Ref<Image> image;
+		String save_path;
+		const VRAMVariant *variants = nullptr;
+		float lossy_quality = 0.0;
+		bool mipmaps = false;
+		bool streamable = false;
+		bool detect_3d = false;
+		bool detect_roughness = false;
+		bool detect_normal = false;
+		bool force_normal = false;
+		bool srgb_friendly = false;
+		uint32_t limit_mipmap = 0;
+		Ref<Image> normal;
+		Image::RoughnessChannel roughness_channel = Image::ROUGHNESS_CHANNEL_R;
+	};
+
+	void _save_vram_variant(uint32_t p_index, const VRAMSaveData *p_data);
+
 public:
 	static void save_to_stex_format(FileAccess *f, const Ref<Image> &p_image, CompressMode p_compress_mode, Image::UsedChannels p_channels, Image::CompressMode p_compress_format, float p_lossy_quality);
 
@@ -100,6 +126,8 @@ public:
 
 	virtual Error import(const String &p_source_file, const String &p_save_path, const Map<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) override;
 
+	virtual bool can_import_threaded() const override { return true; }
+
 	void update_imports();
 
 	virtual bool are_import_settings_valid(const String &p_path) const override;
@@ -163,7 +163,7 @@ void EditorSceneImporterMesh::generate_lods() {
 
 		int min_indices = 10;
 		int index_target = indices.size() / 2;
-		print_line("Total indices: " + itos(indices.size()));
+		print_verbose("Total indices: " + itos(indices.size()));
 		float mesh_scale = SurfaceTool::simplify_scale_func((const float *)vertices_ptr, vertex_count, sizeof(Vector3));
 		const float target_error = 1e-3f;
 		float abs_target_error = target_error / mesh_scale;
@@ -190,10 +190,10 @@ void EditorSceneImporterMesh::generate_lods() {
 						lod.distance = error * mesh_scale;
 						abs_target_error = lod.distance;
 						if (Math::is_equal_approx(abs_target_error, 0.0f)) {
-							return;
+							break;
 						}
 						lod.indices = sloppy_new_indices;
-						print_line("Lod " + itos(surfaces.write[i].lods.size()) + " shoot for " + itos(index_target / 3) + " triangles, got " + itos(new_len / 3) + " triangles. Distance " + rtos(lod.distance) + ". Use simplify sloppy.");
+						print_verbose("Lod " + itos(surfaces.write[i].lods.size()) + " shoot for " + itos(index_target / 3) + " triangles, got " + itos(new_len / 3) + " triangles. Distance " + rtos(lod.distance) + ". Use simplify sloppy.");
 						surfaces.write[i].lods.push_back(lod);
 						index_target /= 2;
 					}
@@ -205,16 +205,104 @@ void EditorSceneImporterMesh::generate_lods() {
 			lod.distance = error * mesh_scale;
 			abs_target_error = lod.distance;
 			if (Math::is_equal_approx(abs_target_error, 0.0f)) {
-				return;
+				break; // No further simplification possible, move on to the next surface.
 			}
 			lod.indices = new_indices;
-			print_line("Lod " + itos(surfaces.write[i].lods.size()) + " shoot for " + itos(index_target / 3) + " triangles, got " + itos(new_len / 3) + " triangles. Distance " + rtos(lod.distance));
+			print_verbose("Lod " + itos(surfaces.write[i].lods.size()) + " shoot for " + itos(index_target / 3) + " triangles, got " + itos(new_len / 3) + " triangles. Distance " + rtos(lod.distance));
 			surfaces.write[i].lods.push_back(lod);
 			index_target /= 2;
 		}
 	}
 }
 
+void EditorSceneImporterMesh::optimize_indices() {
+	if (!SurfaceTool::optimize_vertex_cache_func) {
+		return;
+	}
+
+	for (int i = 0; i < surfaces.size(); i++) {
+		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
+		}
+
+		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
+		Vector<int> indices = surfaces[i].arrays[RS::ARRAY_INDEX];
+		if (indices.size() == 0 || indices.size() % 3 != 0) {
+			continue;
+		}
+		uint32_t vertex_count = vertices.size();
+
+		//vertex cache first, then reorder clusters of triangles to reduce overdraw, allowing a slightly worse cache hit rate
+		Vector<int> cache_indices;
+		cache_indices.resize(indices.size());
+		SurfaceTool::optimize_vertex_cache_func((unsigned int *)cache_indices.ptrw(), (const unsigned int *)indices.ptr(), indices.size(), vertex_count);
+
+		if (SurfaceTool::optimize_overdraw_func) {
+			const float overdraw_threshold = 1.05;
+			SurfaceTool::optimize_overdraw_func((unsigned int *)indices.ptrw(), (const unsigned int *)cache_indices.ptr(), cache_indices.size(), (const float *)vertices.ptr(), vertex_count, sizeof(Vector3), overdraw_threshold);
+			surfaces.write[i].arrays[RS::ARRAY_INDEX] = indices;
+		} else {
+			surfaces.write[i].arrays[RS::ARRAY_INDEX] = cache_indices;
+		}
+
+		for (int j = 0; j < surfaces[i].lods.size(); j++) {
+			Vector<int> lod_indices = surfaces[i].lods[j].indices;
+			Vector<int> new_indices;
+			new_indices.resize(lod_indices.size());
+			SurfaceTool::optimize_vertex_cache_func((unsigned int *)new_indices.ptrw(), (const unsigned int *)lod_indices.ptr(), lod_indices.size(), vertex_count);
+			surfaces.write[i].lods.write[j].indices = new_indices;
+		}
+	}
+}
+
+void EditorSceneImporterMesh::compress_uvs() {
+	for (int i = 0; i < surfaces.size(); i++) {
+		Vector<Vector2> uvs = surfaces[i].arrays[RS::ARRAY_TEX_UV];
+		if (uvs.size() == 0) {
+			continue;
+		}
+
+		//half floats keep enough precision only close to the unit range, leave tiled UVs as they are
+		bool in_range = true;
+		for (int j = 0; j < uvs.size() && in_range; j++) {
+			in_range = ABS(uvs[j].x) <= 1.0 && ABS(uvs[j].y) <= 1.0;
+		}
+		if (in_range) {
+			surfaces.write[i].flags |= Mesh::ARRAY_FLAG_COMPRESS_TEX_UV;
+		}
+	}
+}
+
+void EditorSceneImporterMesh::generate_clusters() {
+	if (!SurfaceTool::build_clusters_func) {
+		return;
+	}
+
+	const int min_triangles = 4096; // Smaller surfaces are not worth culling in parts.
+
+	for (int i = 0; i < surfaces.size(); i++) {
+		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
+		}
+		//clusters are culled with their imported bounds, so deformed meshes can't use them
+		if (surfaces[i].blend_shape_data.size() || surfaces[i].arrays[RS::ARRAY_BONES].get_type() != Variant::NIL) {
+			continue;
+		}
+
+		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
+		Vector<int> indices = surfaces[i].arrays[RS::ARRAY_INDEX];
+		if (indices.size() < min_triangles * 3 || indices.size() % 3 != 0) {
+			continue;
+		}
+
+		Vector<uint8_t> cluster_data = SurfaceTool::build_clusters_func(indices, vertices);
+		if (cluster_data.size()) {
+			surfaces.write[i].arrays[RS::ARRAY_INDEX] = indices;
+			surfaces.write[i].cluster_data = cluster_data;
+		}
+	}
+}
+
 bool EditorSceneImporterMesh::has_mesh() const {
 	return mesh.is_valid();
 }
@@ -242,7 +330,14 @@ Ref<ArrayMesh> EditorSceneImporterMesh::get_mesh() {
 				}
 			}
 
-			mesh->add_surface_from_arrays(surfaces[i].primitive, surfaces[i].arrays, bs_data, lods);
+			if (surfaces[i].cluster_data.size()) {
+				RS::SurfaceData sd;
+				Error err = RS::get_singleton()->mesh_create_surface_data_from_arrays(&sd, RS::PrimitiveType(surfaces[i].primitive), surfaces[i].arrays, bs_data, lods, surfaces[i].flags);
+				ERR_CONTINUE(err != OK);
+				mesh->add_surface(sd.format, Mesh::PrimitiveType(sd.primitive), sd.vertex_data, sd.attribute_data, sd.skin_data, sd.vertex_count, sd.index_data, sd.index_count, sd.aabb, sd.blend_shape_data, sd.bone_aabbs, sd.lods, surfaces[i].cluster_data);
+			} else {
+				mesh->add_surface_from_arrays(surfaces[i].primitive, surfaces[i].arrays, bs_data, lods, surfaces[i].flags);
+			}
 			if (surfaces[i].material.is_valid()) {
 				mesh->surface_set_material(mesh->get_surface_count() - 1, surfaces[i].material);
 			}
@@ -356,6 +451,8 @@ void EditorSceneImporterMesh::create_shadow_mesh() {
 		}
 
 		shadow_mesh->add_surface(surfaces[i].primitive, new_surface, Array(), lods, Ref<Material>(), surfaces[i].name);
+		//same triangles in the same order, so the clusters still apply
+		shadow_mesh->surfaces.write[shadow_mesh->surfaces.size() - 1].cluster_data = surfaces[i].cluster_data;
 	}
 }
 
@@ -54,6 +54,8 @@ class EditorSceneImporterMesh : public Resource {
 		Vector<LOD> lods;
 		Ref<Material> material;
 		String name;
+		uint32_t flags = 0;
+		Vector<uint8_t> cluster_data;
 	};
 	Vector<Surface> surfaces;
 	Vector<String> blend_shapes;
@@ -90,6 +92,9 @@ public:
 	Ref<Material> get_surface_material(int p_surface) const;
 
 	void generate_lods();
+	void optimize_indices();
+	void compress_uvs();
+	void generate_clusters();
 
 	void create_shadow_mesh();
 	Ref<EditorSceneImporterMesh> get_shadow_mesh() const;
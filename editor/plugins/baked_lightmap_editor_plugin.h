@@ -46,8 +46,6 @@ class BakedLightmapEditorPlugin : public EditorPlugin {
 
 	EditorFileDialog *file_dialog;
 	static EditorProgress *tmp_progress;
-	static bool bake_func_step(float p_progress, const String &p_description, void *, bool p_refresh);
-	static void bake_func_end();
 
 	void _bake_select_file(const String &p_file);
 	void _bake();
@@ -56,6 +54,9 @@ protected:
 	static void _bind_methods();
 
 public:
+	static bool bake_func_step(float p_progress, const String &p_description, void *, bool p_refresh);
+	static void bake_func_end();
+
 	virtual String get_name() const override { return "BakedLightmap"; }
 	bool has_main_screen() const override { return false; }
 	virtual void edit(Object *p_object) override;
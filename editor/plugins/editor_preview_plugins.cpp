@@ -190,6 +190,10 @@ bool EditorImagePreviewPlugin::generate_small_preview_automatically() const {
 	return true;
 }
 
+bool EditorImagePreviewPlugin::can_generate_in_parallel() const {
+	return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////
 bool EditorBitmapPreviewPlugin::handles(const String &p_type) const {
@@ -254,6 +258,10 @@ bool EditorBitmapPreviewPlugin::generate_small_preview_automatically() const {
 	return true;
 }
 
+bool EditorBitmapPreviewPlugin::can_generate_in_parallel() const {
+	return true;
+}
+
 EditorBitmapPreviewPlugin::EditorBitmapPreviewPlugin() {
 }
 
@@ -596,6 +604,10 @@ bool EditorAudioStreamPreviewPlugin::handles(const String &p_type) const {
 	return ClassDB::is_parent_class(p_type, "AudioStream");
 }
 
+bool EditorAudioStreamPreviewPlugin::can_generate_in_parallel() const {
+	return true;
+}
+
 Ref<Texture2D> EditorAudioStreamPreviewPlugin::generate(const RES &p_from, const Size2 &p_size) const {
 	Ref<AudioStream> stream = p_from;
 	ERR_FAIL_COND_V(stream.is_null(), Ref<Texture2D>());
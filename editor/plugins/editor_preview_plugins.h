@@ -52,6 +52,7 @@ class EditorImagePreviewPlugin : public EditorResourcePreviewGenerator {
 public:
 	virtual bool handles(const String &p_type) const override;
 	virtual bool generate_small_preview_automatically() const override;
+	virtual bool can_generate_in_parallel() const override;
 	virtual Ref<Texture2D> generate(const RES &p_from, const Size2 &p_size) const override;
 
 	EditorImagePreviewPlugin();
@@ -63,6 +64,7 @@ class EditorBitmapPreviewPlugin : public EditorResourcePreviewGenerator {
 public:
 	virtual bool handles(const String &p_type) const override;
 	virtual bool generate_small_preview_automatically() const override;
+	virtual bool can_generate_in_parallel() const override;
 	virtual Ref<Texture2D> generate(const RES &p_from, const Size2 &p_size) const override;
 
 	EditorBitmapPreviewPlugin();
@@ -117,6 +119,7 @@ public:
 class EditorAudioStreamPreviewPlugin : public EditorResourcePreviewGenerator {
 public:
 	virtual bool handles(const String &p_type) const;
+	virtual bool can_generate_in_parallel() const;
 	virtual Ref<Texture2D> generate(const RES &p_from, const Size2 &p_size) const;
 
 	EditorAudioStreamPreviewPlugin();
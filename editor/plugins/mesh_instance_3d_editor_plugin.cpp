@@ -193,31 +193,9 @@ void MeshInstance3DEditor::_menu_option(int p_option) {
 				return;
 			}
 
-			Vector<Ref<Shape3D>> shapes = mesh->convex_decompose();
-
-			if (!shapes.size()) {
-				err_dialog->set_text(TTR("Couldn't create any collision shapes."));
-				err_dialog->popup_centered();
-				return;
-			}
-			UndoRedo *ur = EditorNode::get_singleton()->get_undo_redo();
-
-			ur->create_action(TTR("Create Multiple Convex Shapes"));
-
-			for (int i = 0; i < shapes.size(); i++) {
-				CollisionShape3D *cshape = memnew(CollisionShape3D);
-				cshape->set_shape(shapes[i]);
-				cshape->set_transform(node->get_transform());
-
-				Node *owner = node->get_owner();
-
-				ur->add_do_method(node->get_parent(), "add_child", cshape);
-				ur->add_do_method(node->get_parent(), "move_child", cshape, node->get_index() + 1);
-				ur->add_do_method(cshape, "set_owner", owner);
-				ur->add_do_reference(cshape);
-				ur->add_undo_method(node->get_parent(), "remove_child", cshape);
-			}
-			ur->commit_action();
+			// Decomposing large meshes can take minutes, don't block the editor.
+			convex_decomposition_node = node->get_instance_id();
+			mesh->convex_decompose_async(callable_mp(this, &MeshInstance3DEditor::_create_convex_collision_shapes));
 
 		} break;
 
@@ -309,6 +287,38 @@ struct MeshInstance3DEditorEdgeSort {
 	}
 };
 
+void MeshInstance3DEditor::_create_convex_collision_shapes(const Array &p_shapes) {
+	MeshInstance3D *mesh_node = Object::cast_to<MeshInstance3D>(ObjectDB::get_instance(convex_decomposition_node));
+	convex_decomposition_node = ObjectID();
+	if (!mesh_node || !mesh_node->is_inside_tree()) {
+		return; // Removed while decomposing.
+	}
+
+	if (p_shapes.is_empty()) {
+		err_dialog->set_text(TTR("Couldn't create any collision shapes."));
+		err_dialog->popup_centered();
+		return;
+	}
+	UndoRedo *ur = EditorNode::get_singleton()->get_undo_redo();
+
+	ur->create_action(TTR("Create Multiple Convex Shapes"));
+
+	for (int i = 0; i < p_shapes.size(); i++) {
+		CollisionShape3D *cshape = memnew(CollisionShape3D);
+		cshape->set_shape(p_shapes[i]);
+		cshape->set_transform(mesh_node->get_transform());
+
+		Node *owner = mesh_node->get_owner();
+
+		ur->add_do_method(mesh_node->get_parent(), "add_child", cshape);
+		ur->add_do_method(mesh_node->get_parent(), "move_child", cshape, mesh_node->get_index() + 1);
+		ur->add_do_method(cshape, "set_owner", owner);
+		ur->add_do_reference(cshape);
+		ur->add_undo_method(mesh_node->get_parent(), "remove_child", cshape);
+	}
+	ur->commit_action();
+}
+
 void MeshInstance3DEditor::_create_uv_lines(int p_layer) {
 	Ref<Mesh> mesh = node->get_mesh();
 	ERR_FAIL_COND(!mesh.is_valid());
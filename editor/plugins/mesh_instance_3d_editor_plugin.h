@@ -64,8 +64,11 @@ class MeshInstance3DEditor : public Control {
 	Control *debug_uv;
 	Vector<Vector2> uv_lines;
 
+	ObjectID convex_decomposition_node;
+
 	void _menu_option(int p_option);
 	void _create_outline_mesh();
+	void _create_convex_collision_shapes(const Array &p_shapes);
 
 	void _create_uv_lines(int p_layer);
 	friend class MeshInstance3DEditorPlugin;
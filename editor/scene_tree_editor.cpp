@@ -156,28 +156,35 @@ void SceneTreeEditor::_toggle_visible(Node *p_node) {
 	}
 }
 
-bool SceneTreeEditor::_add_nodes(Node *p_node, TreeItem *p_parent, bool p_scroll_to_selected) {
+bool SceneTreeEditor::_is_node_shown(Node *p_node) {
+	// only owned nodes are editable, since nodes can create their own (manually owned) child nodes,
+	// which the editor needs not to know about.
+
+	if (!display_foreign && p_node->get_owner() != get_scene_node() && p_node != get_scene_node()) {
+		return (show_enabled_subscene || can_open_instance) && p_node->get_owner() && (get_scene_node()->is_editable_instance(p_node->get_owner()));
+	}
+	return true;
+}
+
+bool SceneTreeEditor::_add_nodes(Node *p_node, TreeItem *p_parent, bool p_scroll_to_selected, int p_index) {
 	if (!p_node) {
 		return false;
 	}
 
-	// only owned nodes are editable, since nodes can create their own (manually owned) child nodes,
-	// which the editor needs not to know about.
+	if (!_is_node_shown(p_node)) {
+		return false;
+	}
 
 	bool part_of_subscene = false;
 
 	if (!display_foreign && p_node->get_owner() != get_scene_node() && p_node != get_scene_node()) {
-		if ((show_enabled_subscene || can_open_instance) && p_node->get_owner() && (get_scene_node()->is_editable_instance(p_node->get_owner()))) {
-			part_of_subscene = true;
-			//allow
-		} else {
-			return false;
-		}
+		part_of_subscene = true;
 	} else {
 		part_of_subscene = p_node != get_scene_node() && get_scene_node()->get_scene_inherited_state().is_valid() && get_scene_node()->get_scene_inherited_state()->find_node_by_path(get_scene_node()->get_path_to(p_node)) >= 0;
 	}
 
-	TreeItem *item = tree->create_item(p_parent);
+	TreeItem *item = tree->create_item(p_parent, p_index);
+	node_items[p_node->get_instance_id()] = item;
 
 	item->set_text(0, p_node->get_name());
 	if (can_rename && !part_of_subscene) {
@@ -410,10 +417,21 @@ bool SceneTreeEditor::_add_nodes(Node *p_node, TreeItem *p_parent, bool p_scroll
 
 	bool keep = (filter.is_subsequence_ofi(String(p_node->get_name())));
 
-	for (int i = 0; i < p_node->get_child_count(); i++) {
-		bool child_keep = _add_nodes(p_node->get_child(i), item, p_scroll_to_selected);
+	if (item->is_collapsed() && filter.is_empty()) {
+		// Nothing below a folded item is visible, build its children when it's unfolded (see _populate_item()).
+		for (int i = 0; i < p_node->get_child_count(); i++) {
+			if (_is_node_shown(p_node->get_child(i))) {
+				TreeItem *placeholder = tree->create_item(item);
+				placeholder->set_selectable(0, false);
+				break;
+			}
+		}
+	} else {
+		for (int i = 0; i < p_node->get_child_count(); i++) {
+			bool child_keep = _add_nodes(p_node->get_child(i), item, p_scroll_to_selected);
 
-		keep = keep || child_keep;
+			keep = keep || child_keep;
+		}
 	}
 
 	if (valid_types.size()) {
@@ -439,6 +457,7 @@ bool SceneTreeEditor::_add_nodes(Node *p_node, TreeItem *p_parent, bool p_scroll
 				editor_selection->remove_node(n);
 			}
 		}
+		node_items.erase(p_node->get_instance_id());
 		memdelete(item);
 		return false;
 	} else {
@@ -454,7 +473,7 @@ void SceneTreeEditor::_node_visibility_changed(Node *p_node) {
 		return;
 	}
 
-	TreeItem *item = _find(tree->get_root(), p_node->get_path());
+	TreeItem *item = _get_item(p_node);
 
 	if (!item) {
 		return;
@@ -521,15 +540,162 @@ void SceneTreeEditor::_node_removed(Node *p_node) {
 		selected = nullptr;
 		emit_signal("node_selected");
 	}
+
+	if (tree_dirty || !filter.is_empty()) {
+		return;
+	}
+
+	// Children leave the tree before their parent, so only a placeholder can be left below the item.
+	TreeItem **item = node_items.getptr(p_node->get_instance_id());
+	if (item) {
+		memdelete(*item);
+		node_items.erase(p_node->get_instance_id());
+	}
+}
+
+void SceneTreeEditor::_node_added(Node *p_node) {
+	if (tree_dirty || !filter.is_empty()) {
+		return;
+	}
+
+	// The owner is usually set after the node is added, so the item is created in _test_update_tree().
+	if (get_scene_node() && get_scene_node()->is_a_parent_of(p_node)) {
+		added_nodes.push_back(p_node->get_instance_id());
+	}
 }
 
 void SceneTreeEditor::_node_renamed(Node *p_node) {
 	emit_signal("node_renamed");
 
-	if (!tree_dirty) {
+	if (tree_dirty) {
+		return;
+	}
+
+	if (!filter.is_empty() || marked.has(p_node)) {
+		// The name may change whether the node passes the filter, or its "connecting" label.
 		MessageQueue::get_singleton()->push_call(this, "_update_tree");
 		tree_dirty = true;
+		return;
+	}
+
+	TreeItem *item = _get_item(p_node);
+	if (item) {
+		item->set_text(0, p_node->get_name());
+		_update_item_paths(item, item->get_metadata(0), p_node->get_path());
+	}
+}
+
+void SceneTreeEditor::_update_item_paths(TreeItem *p_item, const String &p_from, const String &p_to) {
+	if (p_item->get_metadata(0).get_type() == Variant::NODE_PATH) {
+		String path = p_item->get_metadata(0);
+		if (path.begins_with(p_from)) {
+			p_item->set_metadata(0, NodePath(p_to + path.substr(p_from.length(), path.length())));
+		}
+	}
+
+	TreeItem *child = p_item->get_children();
+	while (child) {
+		_update_item_paths(child, p_from, p_to);
+		child = child->get_next();
+	}
+}
+
+bool SceneTreeEditor::_populate_item(TreeItem *p_item) {
+	TreeItem *placeholder = p_item->get_children();
+	if (!placeholder || placeholder->get_metadata(0).get_type() != Variant::NIL) {
+		return false;
+	}
+	memdelete(placeholder);
+
+	Node *n = get_node(p_item->get_metadata(0));
+	ERR_FAIL_COND_V(!n, false);
+
+	bool was_updating = updating_tree;
+	updating_tree = true;
+	for (int i = 0; i < n->get_child_count(); i++) {
+		_add_nodes(n->get_child(i), p_item);
+	}
+	updating_tree = was_updating;
+
+	return true;
+}
+
+TreeItem *SceneTreeEditor::_get_item(Node *p_node, bool p_populate) {
+	TreeItem **item = node_items.getptr(p_node->get_instance_id());
+	if (item) {
+		return *item;
+	}
+
+	if (!p_populate || p_node == get_scene_node() || !p_node->get_parent()) {
+		return nullptr;
+	}
+
+	// The node may be below a folded item whose children were not created yet.
+	TreeItem *parent_item = _get_item(p_node->get_parent(), true);
+	if (!parent_item || !_populate_item(parent_item)) {
+		return nullptr;
+	}
+
+	item = node_items.getptr(p_node->get_instance_id());
+	return item ? *item : nullptr;
+}
+
+bool SceneTreeEditor::_add_pending_nodes() {
+	bool added = false;
+
+	updating_tree = true;
+	for (List<ObjectID>::Element *E = added_nodes.front(); E; E = E->next()) {
+		Node *n = Object::cast_to<Node>(ObjectDB::get_instance(E->get()));
+		if (!n || !n->is_inside_tree() || !n->get_parent() || node_items.has(E->get())) {
+			continue;
+		}
+
+		TreeItem **parent_item_ptr = node_items.getptr(n->get_parent()->get_instance_id());
+		if (!parent_item_ptr) {
+			continue; // Parent not displayed, or not built yet.
+		}
+
+		TreeItem *parent_item = *parent_item_ptr;
+		TreeItem *first = parent_item->get_children();
+		if (first && first->get_metadata(0).get_type() == Variant::NIL) {
+			continue; // Built when the parent is unfolded.
+		}
+
+		int index = 0;
+		Node *parent = n->get_parent();
+		for (int i = 0; i < n->get_index(); i++) {
+			if (node_items.has(parent->get_child(i)->get_instance_id())) {
+				index++;
+			}
+		}
+
+		added = _add_nodes(n, parent_item, false, index) || added;
+	}
+	updating_tree = false;
+
+	added_nodes.clear();
+	return added;
+}
+
+bool SceneTreeEditor::_is_tree_in_sync(Node *p_node, TreeItem *p_item) {
+	TreeItem *next = p_item->get_children();
+	if (next && next->get_metadata(0).get_type() == Variant::NIL) {
+		return true; // Not built yet.
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		Node *child = p_node->get_child(i);
+		TreeItem **item = node_items.getptr(child->get_instance_id());
+		if (!item) {
+			continue;
+		}
+		if (*item != next || !_is_tree_in_sync(child, next)) {
+			return false;
+		}
+		next = next->get_next();
 	}
+
+	return next == nullptr;
 }
 
 void SceneTreeEditor::_update_tree(bool p_scroll_to_selected) {
@@ -540,6 +706,8 @@ void SceneTreeEditor::_update_tree(bool p_scroll_to_selected) {
 
 	updating_tree = true;
 	tree->clear();
+	node_items.clear();
+	added_nodes.clear();
 	if (get_scene_node()) {
 		_add_nodes(get_scene_node(), nullptr, p_scroll_to_selected);
 		last_hash = hash_djb2_one_64(0);
@@ -578,9 +746,19 @@ void SceneTreeEditor::_test_update_tree() {
 	}
 	//test hash
 	if (hash == last_hash) {
+		added_nodes.clear();
 		return; // did not change
 	}
 
+	// Renamed and removed nodes are updated as they change and added ones here, rebuild only if something else moved.
+	if (filter.is_empty() && get_scene_node() && tree->get_root()) {
+		_add_pending_nodes();
+		if (_is_tree_in_sync(get_scene_node(), tree->get_root())) {
+			last_hash = hash;
+			return;
+		}
+	}
+
 	MessageQueue::get_singleton()->push_call(this, "_update_tree");
 	tree_dirty = true;
 }
@@ -655,6 +833,7 @@ void SceneTreeEditor::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
 			get_tree()->connect("tree_changed", callable_mp(this, &SceneTreeEditor::_tree_changed));
+			get_tree()->connect("node_added", callable_mp(this, &SceneTreeEditor::_node_added));
 			get_tree()->connect("node_removed", callable_mp(this, &SceneTreeEditor::_node_removed));
 			get_tree()->connect("node_renamed", callable_mp(this, &SceneTreeEditor::_node_renamed));
 			get_tree()->connect("node_configuration_warning_changed", callable_mp(this, &SceneTreeEditor::_warning_changed));
@@ -665,6 +844,7 @@ void SceneTreeEditor::_notification(int p_what) {
 		} break;
 		case NOTIFICATION_EXIT_TREE: {
 			get_tree()->disconnect("tree_changed", callable_mp(this, &SceneTreeEditor::_tree_changed));
+			get_tree()->disconnect("node_added", callable_mp(this, &SceneTreeEditor::_node_added));
 			get_tree()->disconnect("node_removed", callable_mp(this, &SceneTreeEditor::_node_removed));
 			get_tree()->disconnect("node_renamed", callable_mp(this, &SceneTreeEditor::_node_renamed));
 			tree->disconnect("item_collapsed", callable_mp(this, &SceneTreeEditor::_cell_collapsed));
@@ -676,28 +856,6 @@ void SceneTreeEditor::_notification(int p_what) {
 	}
 }
 
-TreeItem *SceneTreeEditor::_find(TreeItem *p_node, const NodePath &p_path) {
-	if (!p_node) {
-		return nullptr;
-	}
-
-	NodePath np = p_node->get_metadata(0);
-	if (np == p_path) {
-		return p_node;
-	}
-
-	TreeItem *children = p_node->get_children();
-	while (children) {
-		TreeItem *n = _find(children, p_path);
-		if (n) {
-			return n;
-		}
-		children = children->get_next();
-	}
-
-	return nullptr;
-}
-
 void SceneTreeEditor::set_selected(Node *p_node, bool p_emit_selected) {
 	ERR_FAIL_COND(blocked > 0);
 
@@ -712,7 +870,7 @@ void SceneTreeEditor::set_selected(Node *p_node, bool p_emit_selected) {
 		return;
 	}
 
-	TreeItem *item = p_node ? _find(tree->get_root(), p_node->get_path()) : nullptr;
+	TreeItem *item = p_node ? _get_item(p_node, true) : nullptr;
 
 	if (item) {
 		// make visible when it's collapsed
@@ -744,7 +902,7 @@ void SceneTreeEditor::_rename_node(ObjectID p_node, const String &p_name) {
 	ERR_FAIL_COND(!o);
 	Node *n = Object::cast_to<Node>(o);
 	ERR_FAIL_COND(!n);
-	TreeItem *item = _find(tree->get_root(), n->get_path());
+	TreeItem *item = _get_item(n, true);
 	ERR_FAIL_COND(!item);
 
 	n->set_name(p_name);
@@ -893,9 +1051,6 @@ void SceneTreeEditor::_cell_collapsed(Object *p_obj) {
 	if (updating_tree) {
 		return;
 	}
-	if (!can_rename) {
-		return;
-	}
 
 	TreeItem *ti = Object::cast_to<TreeItem>(p_obj);
 	if (!ti) {
@@ -903,6 +1058,13 @@ void SceneTreeEditor::_cell_collapsed(Object *p_obj) {
 	}
 
 	bool collapsed = ti->is_collapsed();
+	if (!collapsed) {
+		_populate_item(ti);
+	}
+
+	if (!can_rename) {
+		return;
+	}
 
 	NodePath np = ti->get_metadata(0);
 
@@ -32,6 +32,7 @@
 #define SCENE_TREE_EDITOR_H
 
 #include "core/object/undo_redo.h"
+#include "core/templates/hash_map.h"
 #include "editor_data.h"
 #include "editor_settings.h"
 #include "scene/gui/button.h"
@@ -71,14 +72,25 @@ class SceneTreeEditor : public Control {
 
 	void _compute_hash(Node *p_node, uint64_t &hash);
 
-	bool _add_nodes(Node *p_node, TreeItem *p_parent, bool p_scroll_to_selected = false);
+	// Items of the displayed nodes. Children of folded items are only created when they are unfolded,
+	// until then the item holds a single placeholder child so it can still be expanded.
+	HashMap<ObjectID, TreeItem *> node_items;
+	List<ObjectID> added_nodes;
+
+	bool _is_node_shown(Node *p_node);
+	bool _add_nodes(Node *p_node, TreeItem *p_parent, bool p_scroll_to_selected = false, int p_index = -1);
+	bool _populate_item(TreeItem *p_item);
+	TreeItem *_get_item(Node *p_node, bool p_populate = false);
+	void _update_item_paths(TreeItem *p_item, const String &p_from, const String &p_to);
+	bool _add_pending_nodes();
+	bool _is_tree_in_sync(Node *p_node, TreeItem *p_item);
 	void _test_update_tree();
 	void _update_tree(bool p_scroll_to_selected = false);
 	void _tree_changed();
+	void _node_added(Node *p_node);
 	void _node_removed(Node *p_node);
 	void _node_renamed(Node *p_node);
 
-	TreeItem *_find(TreeItem *p_node, const NodePath &p_path);
 	void _notification(int p_what);
 	void _selected_changed();
 	void _deselect_items();
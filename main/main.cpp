@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/crypto/crypto.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
 #include "core/input/input_map.h"
@@ -62,9 +63,12 @@
 #include "scene/main/window.h"
 #include "scene/register_scene_types.h"
 #include "scene/resources/packed_scene.h"
+#include "scene/resources/texture.h"
+#include "servers/audio/audio_driver_dummy.h"
 #include "servers/audio_server.h"
 #include "servers/camera_server.h"
 #include "servers/display_server.h"
+#include "servers/display_server_headless.h"
 #include "servers/navigation_server_2d.h"
 #include "servers/navigation_server_3d.h"
 #include "servers/physics_server_2d.h"
@@ -169,6 +173,7 @@ static int frame_delay = 0;
 static bool disable_render_loop = false;
 static int fixed_fps = -1;
 static bool print_fps = false;
+static String startup_trace_path;
 
 bool profile_gpu = false;
 
@@ -293,6 +298,7 @@ void Main::print_help(const char *p_binary) {
 	}
 	OS::get_singleton()->print("].\n");
 
+	OS::get_singleton()->print("  --headless                                   Enable headless mode (--display-driver headless --audio-driver Dummy). Nothing is drawn, no audio is mixed and textures are loaded without their image data. Useful for servers and with --script.\n");
 	OS::get_singleton()->print("  --display-driver <driver>                    Display driver (and rendering driver) [");
 	for (int i = 0; i < DisplayServer::get_create_function_count(); i++) {
 		if (i > 0) {
@@ -358,6 +364,9 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --disable-crash-handler                      Disable crash handler when supported by the platform code.\n");
 	OS::get_singleton()->print("  --fixed-fps <fps>                            Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	OS::get_singleton()->print("  --print-fps                                  Print the frames per second to the stdout.\n");
+#ifdef DEBUG_ENABLED
+	OS::get_singleton()->print("  --startup-trace <file>                       Print the time taken by each startup phase and save a Chrome trace of the startup, up to the first frame, to the given file.\n");
+#endif
 	OS::get_singleton()->print("  --profile-gpu                                Show a simple profile of the tasks that took more time during frame rendering.\n");
 	OS::get_singleton()->print("\n");
 
@@ -369,6 +378,7 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("                                               <path> should be absolute or relative to the project directory, and include the filename for the binary (e.g. 'builds/game.exe'). The target directory should exist.\n");
 	OS::get_singleton()->print("  --export-debug <preset> <path>               Same as --export, but using the debug template.\n");
 	OS::get_singleton()->print("  --export-pack <preset> <path>                Same as --export, but only export the game pack for the given preset. The <path> extension determines whether it will be in PCK or ZIP format.\n");
+	OS::get_singleton()->print("  --bake-lighting <scene>                      Bake the lightmaps and GI probes of the given scene and save it, then quit. Can be repeated to bake several scenes, and combined with --export.\n");
 	OS::get_singleton()->print("  --doctool <path>                             Dump the engine API reference to the given <path> in XML format, merging if existing files are found.\n");
 	OS::get_singleton()->print("  --no-docbase                                 Disallow dumping the base types (used with --doctool).\n");
 	OS::get_singleton()->print("  --build-solutions                            Build the scripting solutions (e.g. for C# projects). Implies --editor and requires a valid project to edit.\n");
@@ -506,12 +516,26 @@ int Main::test_entrypoint(int argc, char *argv[], bool &tests_need_run) {
 Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_phase) {
 	OS::get_singleton()->initialize();
 
+	// Checked before parsing the command line, so core registration is traced too.
+	for (int i = 0; i < argc; i++) {
+		if (strcmp(argv[i], "--startup-trace") == 0) {
+			CPUProfiler::set_enabled(true);
+		}
+	}
+	CPU_PROFILE_SCOPE("Main::setup");
+
 	engine = memnew(Engine);
 
 	MAIN_PRINT("Main: Initialize CORE");
 
-	register_core_types();
-	register_core_driver_types();
+	{
+		CPU_PROFILE_SCOPE("register_core_types");
+		register_core_types();
+		register_core_driver_types();
+	}
+
+	// After the platform display servers, so it's never picked by default.
+	DisplayServerHeadless::register_headless_driver();
 
 	MAIN_PRINT("Main: Initialize Globals");
 
@@ -668,6 +692,11 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				goto error;
 			}
 
+		} else if (I->get() == "--headless") { // enable headless mode (no audio, no rendering)
+
+			audio_driver = "Dummy";
+			display_driver = "headless";
+
 		} else if (I->get() == "--display-driver") { // force video driver
 
 			if (I->next()) {
@@ -885,7 +914,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			main_args.push_back(I->get());
 #endif
 		} else if (I->get() == "--export" || I->get() == "--export-debug" ||
-				   I->get() == "--export-pack") { // Export project
+				   I->get() == "--export-pack" || I->get() == "--bake-lighting") { // Export project, bake lighting
 
 			editor = true;
 			main_args.push_back(I->get());
@@ -1007,6 +1036,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			}
 		} else if (I->get() == "--print-fps") {
 			print_fps = true;
+		} else if (I->get() == "--startup-trace") {
+			if (I->next()) {
+				startup_trace_path = I->next()->get();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing startup trace file argument, aborting.\n");
+				goto error;
+			}
 		} else if (I->get() == "--profile-gpu") {
 			profile_gpu = true;
 		} else if (I->get() == "--disable-crash-handler") {
@@ -1394,6 +1431,15 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 					"application/run/low_processor_mode_sleep_usec",
 					PROPERTY_HINT_RANGE,
 					"0,33200,1,or_greater")); // No negative numbers
+	Thread::load_role_settings();
+
+	OS::get_singleton()->set_low_processor_usage_mode_idle_sleep_usec(
+			GLOBAL_DEF("application/run/low_processor_mode_idle_sleep_usec", 0));
+	ProjectSettings::get_singleton()->set_custom_property_info("application/run/low_processor_mode_idle_sleep_usec",
+			PropertyInfo(Variant::INT,
+					"application/run/low_processor_mode_idle_sleep_usec",
+					PROPERTY_HINT_RANGE,
+					"0,1000000,1,or_greater"));
 
 	GLOBAL_DEF("display/window/ios/hide_home_indicator", true);
 	GLOBAL_DEF("input_devices/pointing/ios/touch_delay", 0.150);
@@ -1462,6 +1508,8 @@ error:
 }
 
 Error Main::setup2(Thread::ID p_main_tid_override) {
+	CPU_PROFILE_SCOPE("Main::setup2");
+
 	preregister_module_types();
 	preregister_server_types();
 
@@ -1550,6 +1598,9 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 				if (i == display_driver_idx) {
 					continue; //don't try the same twice
 				}
+				if (String(DisplayServer::get_create_function_name(i)) == "headless") {
+					continue; // only used when requested
+				}
 				display_server = DisplayServer::create(i, rendering_driver, window_mode, window_flags, window_size, err);
 				if (err == OK && display_server != nullptr) {
 					break;
@@ -1578,12 +1629,27 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 		rendering_server->set_print_gpu_profile(true);
 	}
 
+	if (GLOBAL_DEF("debug/settings/profiler/gpu_pass_timings", false)) {
+		rendering_server->set_frame_pass_timing_enabled(true);
+	}
+
+	rendering_server->set_physics_interpolation_enabled(GLOBAL_DEF("physics/common/physics_interpolation", false));
+
 	OS::get_singleton()->initialize_joypads();
 
 	/* Initialize Audio Driver */
 
+	bool headless = String(display_server->get_name()) == "headless";
+	if (headless && String(AudioDriverManager::get_driver(audio_driver_idx)->get_name()) == "Dummy") {
+		// Nothing is going to be heard, don't wake up a thread to mix it.
+		AudioDriverManager::get_dummy_driver()->set_use_threads(false);
+	}
+
 	AudioDriverManager::initialize(audio_driver_idx);
 
+	// Nothing is drawn, so there is no point in keeping the texture data around.
+	StreamTexture2D::set_load_image_data(!headless);
+
 	print_line(" "); //add a blank line for readability
 
 	if (init_use_custom_pos) {
@@ -1626,7 +1692,10 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 		DisplayServer::get_singleton()->enable_for_stealing_focus(allow_focus_steal_pid);
 	}
 
-	register_server_types();
+	{
+		CPU_PROFILE_SCOPE("register_server_types");
+		register_server_types();
+	}
 
 	MAIN_PRINT("Main: Load Boot Image");
 
@@ -1723,18 +1792,24 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 
 	MAIN_PRINT("Main: Load Translations and Remaps");
 
-	translation_server->setup(); //register translations, load them, etc.
-	if (locale != "") {
-		translation_server->set_locale(locale);
-	}
-	translation_server->load_translations();
-	ResourceLoader::load_translation_remaps(); //load remaps for resources
+	{
+		CPU_PROFILE_SCOPE("Load translations");
+		translation_server->setup(); //register translations, load them, etc.
+		if (locale != "") {
+			translation_server->set_locale(locale);
+		}
+		translation_server->load_translations();
+		ResourceLoader::load_translation_remaps(); //load remaps for resources
 
-	ResourceLoader::load_path_remaps();
+		ResourceLoader::load_path_remaps();
+	}
 
 	MAIN_PRINT("Main: Load Scene Types");
 
-	register_scene_types();
+	{
+		CPU_PROFILE_SCOPE("register_scene_types");
+		register_scene_types();
+	}
 
 	GLOBAL_DEF("display/mouse_cursor/custom_image", String());
 	GLOBAL_DEF("display/mouse_cursor/custom_image_hotspot", Vector2());
@@ -1754,7 +1829,10 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 	}
 #ifdef TOOLS_ENABLED
 	ClassDB::set_current_api(ClassDB::API_EDITOR);
-	EditorNode::register_editor_types();
+	{
+		CPU_PROFILE_SCOPE("register_editor_types");
+		EditorNode::register_editor_types();
+	}
 
 	ClassDB::set_current_api(ClassDB::API_CORE);
 
@@ -1762,19 +1840,28 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 
 	MAIN_PRINT("Main: Load Modules, Physics, Drivers, Scripts");
 
-	register_platform_apis();
-	register_module_types();
+	{
+		CPU_PROFILE_SCOPE("register_module_types");
+		register_platform_apis();
+		register_module_types();
+	}
 
 	camera_server = CameraServer::create();
 
-	initialize_physics();
-	initialize_navigation_server();
+	{
+		CPU_PROFILE_SCOPE("Initialize physics and navigation");
+		initialize_physics();
+		initialize_navigation_server();
+	}
 	register_server_singletons();
 
 	register_driver_types();
 
-	// This loads global classes, so it must happen before custom loaders and savers are registered
-	ScriptServer::init_languages();
+	{
+		CPU_PROFILE_SCOPE("Initialize script languages");
+		// This loads global classes, so it must happen before custom loaders and savers are registered
+		ScriptServer::init_languages();
+	}
 
 	audio_server->load_default_bus_layout();
 
@@ -1810,6 +1897,8 @@ static MainTimerSync main_timer_sync;
 bool Main::start() {
 	ERR_FAIL_COND_V(!_start_success, false);
 
+	CPU_PROFILE_SCOPE("Main::start");
+
 	bool hasicon = false;
 	String doc_tool;
 	List<String> removal_docs;
@@ -1823,6 +1912,7 @@ bool Main::start() {
 	String _export_preset;
 	bool export_debug = false;
 	bool export_pack_only = false;
+	Vector<String> bake_lighting_scenes;
 #endif
 
 	main_timer_sync.init(OS::get_singleton()->get_ticks_usec());
@@ -1881,6 +1971,9 @@ bool Main::start() {
 				editor = true;
 				_export_preset = args[i + 1];
 				export_pack_only = true;
+			} else if (args[i] == "--bake-lighting") {
+				editor = true; //needs editor
+				bake_lighting_scenes.push_back(args[i + 1]);
 #endif
 			} else {
 				// The parameter does not match anything known, don't skip the next argument
@@ -2068,8 +2161,11 @@ bool Main::start() {
 		ResourceLoader::add_custom_loaders();
 		ResourceSaver::add_custom_savers();
 
+		bool main_scene_preloading = false;
 		if (!project_manager && !editor) { // game
 			if (game_path != "" || script != "") {
+				CPU_PROFILE_SCOPE("Load autoloads");
+
 				//autoload
 				Map<StringName, ProjectSettings::AutoloadInfo> autoloads = ProjectSettings::get_singleton()->get_autoload_list();
 
@@ -2127,6 +2223,13 @@ bool Main::start() {
 				for (List<Node *>::Element *E = to_add.front(); E; E = E->next()) {
 					sml->get_root()->add_child(E->get());
 				}
+
+				// Only once the autoloads are done: loading them registers the script language globals
+				// (and may load the same scripts) that a loader thread compiling the main scene would use.
+				// The main scene then loads on a thread while the root window is configured.
+				if (game_path.begins_with("res://")) {
+					main_scene_preloading = ResourceLoader::load_threaded_request(game_path, "PackedScene") == OK;
+				}
 			}
 		}
 
@@ -2136,6 +2239,10 @@ bool Main::start() {
 			editor_node = memnew(EditorNode);
 			sml->get_root()->add_child(editor_node);
 
+			if (bake_lighting_scenes.size()) {
+				editor_node->bake_lighting(bake_lighting_scenes);
+				game_path = ""; // Do not load anything.
+			}
 			if (_export_preset != "") {
 				editor_node->export_preset(_export_preset, positional_arg, export_debug, export_pack_only);
 				game_path = ""; // Do not load anything.
@@ -2301,8 +2408,16 @@ bool Main::start() {
 			Crypto::load_default_certificates(GLOBAL_DEF("network/ssl/certificate_bundle_override", ""));
 
 			if (game_path != "") {
+				CPU_PROFILE_SCOPE("Load main scene");
+
 				Node *scene = nullptr;
-				Ref<PackedScene> scenedata = ResourceLoader::load(local_game_path);
+				Ref<PackedScene> scenedata;
+				if (main_scene_preloading) {
+					scenedata = ResourceLoader::load_threaded_get(game_path);
+				}
+				if (scenedata.is_null()) {
+					scenedata = ResourceLoader::load(local_game_path);
+				}
 				if (scenedata.is_valid()) {
 					scene = scenedata->instance();
 				}
@@ -2396,16 +2511,47 @@ bool Main::is_iterating() {
 	return iterating > 0;
 }
 
+// Prints the time taken by each startup phase and saves the markers recorded
+// since setup(), up to the end of the first frame, as a Chrome trace.
+static void _save_startup_trace(const String &p_path) {
+	Array events;
+	CPUProfiler::collect(events);
+	if (!EngineDebugger::is_profiling("cpu_trace")) {
+		CPUProfiler::set_enabled(false);
+	}
+
+	for (int i = 0; i + 4 < events.size(); i += 5) {
+		uint64_t begin = events[i + 2];
+		uint64_t end = events[i + 3];
+		int depth = events[i + 4];
+		if (depth <= 1) {
+			print_line(vformat("Startup: %s%s: %.1f ms", String("  ").repeat(depth), events[i + 1], (end - begin) / 1000.0));
+		}
+	}
+
+	FileAccessRef f = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(!f, "Can't save startup trace to: " + p_path);
+	f->store_string(CPUProfiler::to_chrome_trace(events));
+}
+
 // For performance metrics.
 static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
+static uint64_t frame_alloc_total = 0;
 
 bool Main::iteration() {
 	//for now do not error on this
 	//ERR_FAIL_COND_V(iterating, false);
 
+	if (!startup_trace_path.is_empty() && Engine::get_singleton()->get_process_frames() > 0) {
+		_save_startup_trace(startup_trace_path);
+		startup_trace_path = String();
+	}
+
 	iterating++;
 
+	CPU_PROFILE_SCOPE("Main::iteration");
+
 	uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -2443,8 +2589,13 @@ bool Main::iteration() {
 	Engine::get_singleton()->_in_physics = true;
 
 	for (int iters = 0; iters < advance.physics_steps; ++iters) {
+		CPU_PROFILE_SCOPE("Main::physics_step");
+
 		uint64_t physics_begin = OS::get_singleton()->get_ticks_usec();
 
+		// Transforms set from now on belong to the new tick, interpolated from the ones of the previous tick.
+		RenderingServer::get_singleton()->tick();
+
 		PhysicsServer3D::get_singleton()->sync();
 		PhysicsServer3D::get_singleton()->flush_queries();
 
@@ -2484,12 +2635,16 @@ bool Main::iteration() {
 
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
 
+	bool idle = false;
 	if (DisplayServer::get_singleton()->can_any_window_draw() &&
 			RenderingServer::get_singleton()->is_render_loop_enabled()) {
 		if ((!force_redraw_requested) && OS::get_singleton()->is_in_low_processor_usage_mode()) {
 			if (RenderingServer::get_singleton()->has_changed()) {
 				RenderingServer::get_singleton()->draw(true, scaled_step); // flush visual commands
 				Engine::get_singleton()->frames_drawn++;
+			} else {
+				// Only worth waiting for events if the display server wakes us up when they arrive.
+				idle = DisplayServer::get_singleton()->has_feature(DisplayServer::FEATURE_WAIT_FOR_EVENTS);
 			}
 		} else {
 			RenderingServer::get_singleton()->draw(true, scaled_step); // flush visual commands
@@ -2527,6 +2682,8 @@ bool Main::iteration() {
 		Engine::get_singleton()->_fps = frames;
 		performance->set_process_time(USEC_TO_SEC(process_max));
 		performance->set_physics_process_time(USEC_TO_SEC(physics_process_max));
+		performance->set_frame_allocations(frames ? float(Memory::get_alloc_total() - frame_alloc_total) / frames : 0);
+		frame_alloc_total = Memory::get_alloc_total();
 		process_max = 0;
 		physics_process_max = 0;
 
@@ -2540,7 +2697,7 @@ bool Main::iteration() {
 		return exit;
 	}
 
-	OS::get_singleton()->add_frame_delay(DisplayServer::get_singleton()->window_can_draw());
+	OS::get_singleton()->add_frame_delay(DisplayServer::get_singleton()->window_can_draw(), idle);
 
 #ifdef TOOLS_ENABLED
 	if (auto_build_solutions) {
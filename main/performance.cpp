@@ -66,6 +66,7 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDER_SHADER_CHANGES_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_SURFACE_CHANGES_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_DRAW_CALLS_IN_FRAME);
+	BIND_ENUM_CONSTANT(RENDER_OCCLUDED_OBJECTS_IN_FRAME);
 	BIND_ENUM_CONSTANT(RENDER_VIDEO_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDER_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDER_VERTEX_MEM_USED);
@@ -77,6 +78,30 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(TIME_GPU_FRAME);
+	BIND_ENUM_CONSTANT(TIME_GPU_SHADOWS);
+	BIND_ENUM_CONSTANT(TIME_GPU_DEPTH_PREPASS);
+	BIND_ENUM_CONSTANT(TIME_GPU_GI);
+	BIND_ENUM_CONSTANT(TIME_GPU_SSAO);
+	BIND_ENUM_CONSTANT(TIME_GPU_OPAQUE);
+	BIND_ENUM_CONSTANT(TIME_GPU_SKY);
+	BIND_ENUM_CONSTANT(TIME_GPU_SSR);
+	BIND_ENUM_CONSTANT(TIME_GPU_TRANSPARENT);
+	BIND_ENUM_CONSTANT(TIME_GPU_SDFGI);
+	BIND_ENUM_CONSTANT(TIME_GPU_VOLUMETRIC_FOG);
+	BIND_ENUM_CONSTANT(TIME_GPU_TONEMAP);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_PER_FRAME);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPT);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCE);
+	BIND_ENUM_CONSTANT(MEMORY_AUDIO);
+	BIND_ENUM_CONSTANT(MEMORY_GUI);
+	BIND_ENUM_CONSTANT(RENDER_2D_DRAW_CALLS_IN_FRAME);
+	BIND_ENUM_CONSTANT(RENDER_2D_BATCHED_RECTS_IN_FRAME);
+	BIND_ENUM_CONSTANT(RENDER_TARGET_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDER_SHADOW_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDER_VIDEO_MEM_BUDGET);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -109,6 +134,7 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"raster/shader_changes",
 		"raster/surface_changes",
 		"raster/draw_calls",
+		"raster/objects_occluded",
 		"video/video_mem",
 		"video/texture_mem",
 		"video/vertex_mem",
@@ -120,6 +146,30 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/output_latency",
+		"gpu/frame",
+		"gpu/shadows",
+		"gpu/depth_prepass",
+		"gpu/gi",
+		"gpu/ssao",
+		"gpu/opaque",
+		"gpu/sky",
+		"gpu/ssr",
+		"gpu/transparent",
+		"gpu/sdfgi",
+		"gpu/volumetric_fog",
+		"gpu/tonemap",
+		"memory/allocations_per_frame",
+		"memory/rendering",
+		"memory/physics",
+		"memory/script",
+		"memory/resources",
+		"memory/audio",
+		"memory/gui",
+		"raster/2d_draw_calls",
+		"raster/2d_batched_rects",
+		"video/render_target_mem",
+		"video/shadow_mem",
+		"video/video_mem_budget",
 
 	};
 
@@ -160,6 +210,8 @@ float Performance::get_monitor(Monitor p_monitor) const {
 			return RS::get_singleton()->get_render_info(RS::INFO_SURFACE_CHANGES_IN_FRAME);
 		case RENDER_DRAW_CALLS_IN_FRAME:
 			return RS::get_singleton()->get_render_info(RS::INFO_DRAW_CALLS_IN_FRAME);
+		case RENDER_OCCLUDED_OBJECTS_IN_FRAME:
+			return RS::get_singleton()->get_render_info(RS::INFO_OCCLUDED_OBJECTS_IN_FRAME);
 		case RENDER_VIDEO_MEM_USED:
 			return RS::get_singleton()->get_render_info(RS::INFO_VIDEO_MEM_USED);
 		case RENDER_TEXTURE_MEM_USED:
@@ -182,6 +234,54 @@ float Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case TIME_GPU_FRAME:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_TOTAL) / 1000.0;
+		case TIME_GPU_SHADOWS:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_SHADOWS) / 1000.0;
+		case TIME_GPU_DEPTH_PREPASS:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_DEPTH_PREPASS) / 1000.0;
+		case TIME_GPU_GI:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_GI) / 1000.0;
+		case TIME_GPU_SSAO:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_SSAO) / 1000.0;
+		case TIME_GPU_OPAQUE:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_OPAQUE) / 1000.0;
+		case TIME_GPU_SKY:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_SKY) / 1000.0;
+		case TIME_GPU_SSR:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_SSR) / 1000.0;
+		case TIME_GPU_TRANSPARENT:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_TRANSPARENT) / 1000.0;
+		case TIME_GPU_SDFGI:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_SDFGI) / 1000.0;
+		case TIME_GPU_VOLUMETRIC_FOG:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_VOLUMETRIC_FOG) / 1000.0;
+		case TIME_GPU_TONEMAP:
+			return RS::get_singleton()->get_frame_pass_gpu_time(RS::FRAME_PASS_TONEMAP) / 1000.0;
+		case MEMORY_ALLOCATIONS_PER_FRAME:
+			return _frame_allocations;
+		case MEMORY_RENDERING:
+			return Memory::get_tag_usage(Memory::TAG_RENDERING);
+		case MEMORY_PHYSICS:
+			return Memory::get_tag_usage(Memory::TAG_PHYSICS);
+		case MEMORY_SCRIPT:
+			return Memory::get_tag_usage(Memory::TAG_SCRIPT);
+		case MEMORY_RESOURCE:
+			return Memory::get_tag_usage(Memory::TAG_RESOURCE);
+		case MEMORY_AUDIO:
+			return Memory::get_tag_usage(Memory::TAG_AUDIO);
+		case MEMORY_GUI:
+			return Memory::get_tag_usage(Memory::TAG_GUI);
+		case RENDER_2D_DRAW_CALLS_IN_FRAME:
+			return RS::get_singleton()->get_render_info(RS::INFO_2D_DRAW_CALLS_IN_FRAME);
+		case RENDER_2D_BATCHED_RECTS_IN_FRAME:
+			return RS::get_singleton()->get_render_info(RS::INFO_2D_BATCHED_RECTS_IN_FRAME);
+		case RENDER_TARGET_MEM_USED:
+			return RS::get_singleton()->get_render_info(RS::INFO_RENDER_TARGET_MEM_USED);
+		case RENDER_SHADOW_MEM_USED:
+			return RS::get_singleton()->get_render_info(RS::INFO_SHADOW_MEM_USED);
+		case RENDER_VIDEO_MEM_BUDGET:
+			return RS::get_singleton()->get_render_info(RS::INFO_VIDEO_MEM_BUDGET);
 
 		default: {
 		}
@@ -210,6 +310,7 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_MEMORY,
 		MONITOR_TYPE_MEMORY,
 		MONITOR_TYPE_MEMORY,
@@ -221,6 +322,30 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
@@ -235,6 +360,10 @@ void Performance::set_physics_process_time(float p_pt) {
 	_physics_process_time = p_pt;
 }
 
+void Performance::set_frame_allocations(float p_allocations) {
+	_frame_allocations = p_allocations;
+}
+
 void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args) {
 	ERR_FAIL_COND_MSG(has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' already exists.");
 	_monitor_map.insert(p_id, MonitorCall(p_callable, p_args));
@@ -281,6 +410,7 @@ uint64_t Performance::get_monitor_modification_time() {
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
+	_frame_allocations = 0;
 	_monitor_modification_time = 0;
 	singleton = this;
 }
@@ -47,6 +47,7 @@ class Performance : public Object {
 
 	float _process_time;
 	float _physics_process_time;
+	float _frame_allocations;
 
 	class MonitorCall {
 		Callable _callable;
@@ -79,6 +80,7 @@ public:
 		RENDER_SHADER_CHANGES_IN_FRAME,
 		RENDER_SURFACE_CHANGES_IN_FRAME,
 		RENDER_DRAW_CALLS_IN_FRAME,
+		RENDER_OCCLUDED_OBJECTS_IN_FRAME,
 		RENDER_VIDEO_MEM_USED,
 		RENDER_TEXTURE_MEM_USED,
 		RENDER_VERTEX_MEM_USED,
@@ -91,6 +93,30 @@ public:
 		PHYSICS_3D_ISLAND_COUNT,
 		//physics
 		AUDIO_OUTPUT_LATENCY,
+		TIME_GPU_FRAME,
+		TIME_GPU_SHADOWS,
+		TIME_GPU_DEPTH_PREPASS,
+		TIME_GPU_GI,
+		TIME_GPU_SSAO,
+		TIME_GPU_OPAQUE,
+		TIME_GPU_SKY,
+		TIME_GPU_SSR,
+		TIME_GPU_TRANSPARENT,
+		TIME_GPU_SDFGI,
+		TIME_GPU_VOLUMETRIC_FOG,
+		TIME_GPU_TONEMAP,
+		MEMORY_ALLOCATIONS_PER_FRAME,
+		MEMORY_RENDERING,
+		MEMORY_PHYSICS,
+		MEMORY_SCRIPT,
+		MEMORY_RESOURCE,
+		MEMORY_AUDIO,
+		MEMORY_GUI,
+		RENDER_2D_DRAW_CALLS_IN_FRAME,
+		RENDER_2D_BATCHED_RECTS_IN_FRAME,
+		RENDER_TARGET_MEM_USED,
+		RENDER_SHADOW_MEM_USED,
+		RENDER_VIDEO_MEM_BUDGET,
 		MONITOR_MAX
 	};
 
@@ -107,6 +133,7 @@ public:
 
 	void set_process_time(float p_pt);
 	void set_physics_process_time(float p_pt);
+	void set_frame_allocations(float p_allocations);
 
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args);
 	void remove_custom_monitor(const StringName &p_id);
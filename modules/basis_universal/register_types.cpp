@@ -31,6 +31,8 @@
 #include "register_types.h"
 
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/thread_work_pool.h"
 #include "servers/rendering_server.h"
 #include "texture_basisu.h"
 
@@ -52,6 +54,29 @@ enum BasisDecompressFormat {
 
 basist::etc1_global_selector_codebook *sel_codebook = nullptr;
 
+// Mipmap levels are transcoded in parallel when the image is big enough, each thread with its own transcoder state.
+struct BasisTranscodeJob {
+	enum {
+		MIN_PARALLEL_BLOCKS = 4096,
+	};
+
+	const basist::basisu_transcoder *transcoder = nullptr;
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	basist::transcoder_texture_format format = basist::transcoder_texture_format::cTFRGBA32;
+	uint8_t *dst = nullptr;
+	const uint32_t *level_offsets = nullptr;
+	const uint32_t *level_blocks = nullptr;
+	bool *failed = nullptr;
+
+	void transcode_level(uint32_t p_level, void *p_userdata) {
+		basist::basisu_transcoder_state state;
+		if (!transcoder->transcode_image_level(data, size, 0, p_level, dst + level_offsets[p_level], level_blocks[p_level], format, 0, 0, &state)) {
+			failed[p_level] = true;
+		}
+	}
+};
+
 #ifdef TOOLS_ENABLED
 static Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::UsedChannels p_channels) {
 	Vector<uint8_t> budata;
@@ -150,12 +175,11 @@ static Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::
 }
 #endif // TOOLS_ENABLED
 
-static Ref<Image> basis_universal_unpacker(const Vector<uint8_t> &p_buffer) {
+static Ref<Image> basis_universal_unpacker(const uint8_t *p_buffer, int p_size) {
 	Ref<Image> image;
 
-	const uint8_t *r = p_buffer.ptr();
-	const uint8_t *ptr = r;
-	int size = p_buffer.size();
+	const uint8_t *ptr = p_buffer;
+	int size = p_size;
 
 	basist::transcoder_texture_format format = basist::transcoder_texture_format::cTFTotalTextureFormats;
 	Image::Format imgfmt = Image::FORMAT_MAX;
@@ -239,25 +263,54 @@ static Ref<Image> basis_universal_unpacker(const Vector<uint8_t> &p_buffer) {
 
 	{
 		uint8_t *w = gpudata.ptrw();
-		uint8_t *dst = w;
-		for (int i = 0; i < gpudata.size(); i++) {
-			dst[i] = 0x00;
-		}
+		zeromem(w, gpudata.size());
 
-		int ofs = 0;
-		tr.start_transcoding(ptr, size);
+		LocalVector<uint32_t> level_offsets;
+		LocalVector<uint32_t> level_blocks;
+		LocalVector<bool> failed;
+		level_offsets.resize(info.m_total_levels);
+		level_blocks.resize(info.m_total_levels);
+		failed.resize(info.m_total_levels);
+
+		uint32_t ofs = 0;
 		for (uint32_t i = 0; i < info.m_total_levels; i++) {
 			basist::basisu_image_level_info level;
 			tr.get_image_level_info(ptr, size, level, 0, i);
+			level_offsets[i] = ofs;
+			level_blocks[i] = level.m_total_blocks;
+			failed[i] = false;
+			ofs += level.m_total_blocks * block_size;
+		}
 
-			bool ret = tr.transcode_image_level(ptr, size, 0, i, dst + ofs, level.m_total_blocks - i, format);
-			if (!ret) {
+		tr.start_transcoding(ptr, size);
+
+		BasisTranscodeJob job;
+		job.transcoder = &tr;
+		job.data = ptr;
+		job.size = size;
+		job.format = format;
+		job.dst = w;
+		job.level_offsets = level_offsets.ptr();
+		job.level_blocks = level_blocks.ptr();
+		job.failed = failed.ptr();
+
+		if (info.m_total_levels > 1 && info.m_total_blocks >= BasisTranscodeJob::MIN_PARALLEL_BLOCKS && OS::get_singleton()->can_use_threads()) {
+			ThreadWorkPool work_pool;
+			work_pool.init(MIN(info.m_total_levels, (uint32_t)OS::get_singleton()->get_processor_count()));
+			work_pool.do_work(info.m_total_levels, &job, &BasisTranscodeJob::transcode_level, (void *)nullptr);
+			work_pool.finish();
+		} else {
+			for (uint32_t i = 0; i < info.m_total_levels; i++) {
+				job.transcode_level(i, nullptr);
+			}
+		}
+
+		for (uint32_t i = 0; i < info.m_total_levels; i++) {
+			if (failed[i]) {
 				printf("failed! on level %i\n", i);
 				break;
-			};
-
-			ofs += level.m_total_blocks * block_size;
-		};
+			}
+		}
 	};
 
 	image.instance();
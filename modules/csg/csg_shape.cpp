@@ -128,13 +128,17 @@ float CSGShape3D::get_snap() const {
 	return snap;
 }
 
-void CSGShape3D::_make_dirty() {
+void CSGShape3D::_make_dirty(bool p_shape_changed) {
+	if (p_shape_changed) {
+		shape_dirty = true;
+	}
+
 	if (!is_inside_tree()) {
 		return;
 	}
 
 	if (parent) {
-		parent->_make_dirty();
+		parent->_make_dirty(false);
 	} else if (!dirty) {
 		call_deferred("_update_shape");
 	}
@@ -142,81 +146,222 @@ void CSGShape3D::_make_dirty() {
 	dirty = true;
 }
 
-CSGBrush *CSGShape3D::_get_brush() {
-	if (dirty) {
-		if (brush) {
-			memdelete(brush);
+int CSGShape3D::_collect_brush_jobs(BrushUpdate &r_update, uint32_t p_depth) {
+	int index = r_update.jobs.size();
+	r_update.jobs.push_back(BrushJob());
+
+	if (shape_dirty) {
+		if (shape_brush) {
+			memdelete(shape_brush);
 		}
-		brush = nullptr;
+		shape_brush = _build_brush();
+		shape_dirty = false;
+	}
 
-		CSGBrush *n = _build_brush();
+	r_update.jobs[index].shape = get_instance_id();
+	r_update.jobs[index].snap = snap;
+	if (shape_brush) {
+		r_update.jobs[index].shape_brush = memnew(CSGBrush);
+		r_update.jobs[index].shape_brush->copy_from(*shape_brush, Transform());
+	}
 
-		for (int i = 0; i < get_child_count(); i++) {
-			CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
-			if (!child) {
-				continue;
-			}
-			if (!child->is_visible_in_tree()) {
-				continue;
-			}
+	for (int i = 0; i < get_child_count(); i++) {
+		CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+		if (!child) {
+			continue;
+		}
+		if (!child->is_visible_in_tree()) {
+			continue;
+		}
+
+		BrushOperand operand;
+		operand.xform = child->get_transform();
+		operand.operation = child->get_operation();
 
-			CSGBrush *n2 = child->_get_brush();
-			if (!n2) {
+		if (child->dirty) {
+			operand.job = child->_collect_brush_jobs(r_update, p_depth + 1);
+		} else {
+			if (!child->brush) {
 				continue;
 			}
-			if (!n) {
-				n = memnew(CSGBrush);
+			operand.brush = memnew(CSGBrush);
+			operand.brush->copy_from(*child->brush, operand.xform);
+		}
 
-				n->copy_from(*n2, child->get_transform());
+		r_update.jobs[index].operands.push_back(operand);
+	}
 
-			} else {
-				CSGBrush *nn = memnew(CSGBrush);
-				CSGBrush *nn2 = memnew(CSGBrush);
-				nn2->copy_from(*n2, child->get_transform());
-
-				CSGBrushOperation bop;
-
-				switch (child->get_operation()) {
-					case CSGShape3D::OPERATION_UNION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_INTERSECTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_SUBTRACTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_SUBSTRACTION, *n, *nn2, *nn, snap);
-						break;
-				}
-				memdelete(n);
-				memdelete(nn2);
-				n = nn;
+	if (r_update.levels.size() <= p_depth) {
+		r_update.levels.resize(p_depth + 1);
+	}
+	r_update.levels[p_depth].push_back(index);
+
+	dirty = false;
+
+	return index;
+}
+
+void CSGShape3D::_process_brush_job(uint32_t p_index, BrushUpdate *p_update) {
+	BrushJob &job = p_update->jobs[p_update->levels[p_update->current_level][p_index]];
+
+	CSGBrush *n = job.shape_brush;
+	job.shape_brush = nullptr;
+
+	for (uint32_t i = 0; i < job.operands.size(); i++) {
+		BrushOperand &operand = job.operands[i];
+
+		CSGBrush *n2 = operand.brush;
+		operand.brush = nullptr;
+		if (operand.job != -1) {
+			const CSGBrush *child_brush = p_update->jobs[operand.job].result;
+			if (child_brush) {
+				n2 = memnew(CSGBrush);
+				n2->copy_from(*child_brush, operand.xform);
 			}
 		}
+		if (!n2) {
+			continue;
+		}
 
-		if (n) {
-			AABB aabb;
-			for (int i = 0; i < n->faces.size(); i++) {
-				for (int j = 0; j < 3; j++) {
-					if (i == 0 && j == 0) {
-						aabb.position = n->faces[i].vertices[j];
-					} else {
-						aabb.expand_to(n->faces[i].vertices[j]);
-					}
+		if (!n) {
+			n = n2;
+			continue;
+		}
+
+		CSGBrush *nn = memnew(CSGBrush);
+		CSGBrushOperation bop;
+
+		switch (operand.operation) {
+			case CSGShape3D::OPERATION_UNION:
+				bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *n2, *nn, job.snap);
+				break;
+			case CSGShape3D::OPERATION_INTERSECTION:
+				bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *n2, *nn, job.snap);
+				break;
+			case CSGShape3D::OPERATION_SUBTRACTION:
+				bop.merge_brushes(CSGBrushOperation::OPERATION_SUBSTRACTION, *n, *n2, *nn, job.snap);
+				break;
+		}
+		memdelete(n);
+		memdelete(n2);
+		n = nn;
+	}
+
+	AABB aabb;
+	if (n) {
+		for (int i = 0; i < n->faces.size(); i++) {
+			for (int j = 0; j < 3; j++) {
+				if (i == 0 && j == 0) {
+					aabb.position = n->faces[i].vertices[j];
+				} else {
+					aabb.expand_to(n->faces[i].vertices[j]);
 				}
 			}
-			node_aabb = aabb;
+		}
+	}
+
+	job.result = n;
+	job.aabb = aabb;
+}
+
+void CSGShape3D::_process_brush_update(BrushUpdate &p_update, bool p_threaded) {
+	// Deepest first, the jobs of a level need the results of their children.
+	for (int i = int(p_update.levels.size()) - 1; i >= 0; i--) {
+		p_update.current_level = i;
+		uint32_t count = p_update.levels[i].size();
+		if (p_threaded && count > 1) {
+			get_tree()->do_threaded_work(count, this, &CSGShape3D::_process_brush_job, &p_update);
 		} else {
-			node_aabb = AABB();
+			for (uint32_t j = 0; j < count; j++) {
+				_process_brush_job(j, &p_update);
+			}
+		}
+	}
+}
+
+void CSGShape3D::_apply_brush_update(BrushUpdate &p_update) {
+	for (uint32_t i = 0; i < p_update.jobs.size(); i++) {
+		BrushJob &job = p_update.jobs[i];
+		CSGShape3D *shape = Object::cast_to<CSGShape3D>(ObjectDB::get_instance(job.shape));
+		if (!shape) {
+			continue; // Freed while updating asynchronously, the result is freed below.
+		}
+
+		// If the shape changed since the jobs were collected it's dirty again, the result is still used until the next update.
+		if (shape->brush) {
+			memdelete(shape->brush);
+		}
+		shape->brush = job.result;
+		shape->node_aabb = job.aabb;
+		job.result = nullptr;
+	}
+
+	_clear_brush_update(p_update);
+}
+
+void CSGShape3D::_clear_brush_update(BrushUpdate &p_update) {
+	for (uint32_t i = 0; i < p_update.jobs.size(); i++) {
+		BrushJob &job = p_update.jobs[i];
+		if (job.shape_brush) {
+			memdelete(job.shape_brush);
+		}
+		if (job.result) {
+			memdelete(job.result);
+		}
+		for (uint32_t j = 0; j < job.operands.size(); j++) {
+			if (job.operands[j].brush) {
+				memdelete(job.operands[j].brush);
+			}
 		}
+	}
+	p_update.jobs.clear();
+	p_update.levels.clear();
+}
 
-		brush = n;
+CSGBrush *CSGShape3D::_get_brush() {
+	if (dirty) {
+		CSGShape3D *root = this;
+		while (root->parent) {
+			root = root->parent;
+		}
+		root->_finish_async_update();
 
-		dirty = false;
+		BrushUpdate update;
+		_collect_brush_jobs(update, 0);
+		_process_brush_update(update, is_inside_tree());
+		_apply_brush_update(update);
 	}
 
 	return brush;
 }
 
+void CSGShape3D::_async_update_thread_func(void *p_userdata) {
+	CSGShape3D *shape = static_cast<CSGShape3D *>(p_userdata);
+	// The process thread pool is only used from the main thread.
+	shape->_process_brush_update(shape->async_brush_update, false);
+	shape->call_deferred("_async_update_finished");
+}
+
+void CSGShape3D::_async_update_finished() {
+	if (!async_update_thread.is_started()) {
+		return; // Already finished by a synchronous update.
+	}
+
+	_finish_async_update();
+	_update_mesh();
+
+	if (dirty) {
+		_update_shape(); // Changed while updating.
+	}
+}
+
+void CSGShape3D::_finish_async_update() {
+	if (async_update_thread.is_started()) {
+		async_update_thread.wait_to_finish();
+		_apply_brush_update(async_brush_update);
+	}
+}
+
 int CSGShape3D::mikktGetNumFaces(const SMikkTSpaceContext *pContext) {
 	ShapeUpdateSurface &surface = *((ShapeUpdateSurface *)pContext->m_pUserData);
 
@@ -276,10 +421,27 @@ void CSGShape3D::_update_shape() {
 		return;
 	}
 
+	if (async_update && is_inside_tree()) {
+		if (async_update_thread.is_started()) {
+			return; // Started again once done, if still dirty.
+		}
+		if (dirty) {
+			// The current mesh is kept until the new one is ready.
+			_collect_brush_jobs(async_brush_update, 0);
+			async_update_thread.start(_async_update_thread_func, this);
+			return;
+		}
+	}
+
+	_get_brush();
+	_update_mesh();
+}
+
+void CSGShape3D::_update_mesh() {
 	set_base(RID());
 	root_mesh.unref(); //byebye root mesh
 
-	CSGBrush *n = _get_brush();
+	CSGBrush *n = brush;
 	ERR_FAIL_COND_MSG(!n, "Cannot get CSGBrush.");
 
 	OAHashMap<Vector3, Vector3> vec_map;
@@ -516,19 +678,21 @@ void CSGShape3D::_notification(int p_what) {
 
 	if (p_what == NOTIFICATION_LOCAL_TRANSFORM_CHANGED) {
 		if (parent) {
-			parent->_make_dirty();
+			parent->_make_dirty(false);
 		}
 	}
 
 	if (p_what == NOTIFICATION_VISIBILITY_CHANGED) {
 		if (parent) {
-			parent->_make_dirty();
+			parent->_make_dirty(false);
 		}
 	}
 
 	if (p_what == NOTIFICATION_EXIT_TREE) {
+		_finish_async_update();
+
 		if (parent) {
-			parent->_make_dirty();
+			parent->_make_dirty(false);
 		}
 		parent = nullptr;
 
@@ -560,9 +724,17 @@ bool CSGShape3D::is_calculating_tangents() const {
 	return calculate_tangents;
 }
 
+void CSGShape3D::set_async_update(bool p_enable) {
+	async_update = p_enable;
+}
+
+bool CSGShape3D::is_async_update_enabled() const {
+	return async_update;
+}
+
 void CSGShape3D::_validate_property(PropertyInfo &property) const {
 	bool is_collision_prefixed = property.name.begins_with("collision_");
-	if ((is_collision_prefixed || property.name.begins_with("use_collision")) && is_inside_tree() && !is_root_shape()) {
+	if ((is_collision_prefixed || property.name.begins_with("use_collision") || property.name == "async_update") && is_inside_tree() && !is_root_shape()) {
 		//hide collision if not root
 		property.usage = PROPERTY_USAGE_NOEDITOR;
 	} else if (is_collision_prefixed && !bool(get("use_collision"))) {
@@ -584,6 +756,7 @@ Array CSGShape3D::get_meshes() const {
 
 void CSGShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_update_shape"), &CSGShape3D::_update_shape);
+	ClassDB::bind_method(D_METHOD("_async_update_finished"), &CSGShape3D::_async_update_finished);
 	ClassDB::bind_method(D_METHOD("is_root_shape"), &CSGShape3D::is_root_shape);
 
 	ClassDB::bind_method(D_METHOD("set_operation", "operation"), &CSGShape3D::set_operation);
@@ -610,11 +783,15 @@ void CSGShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_calculate_tangents", "enabled"), &CSGShape3D::set_calculate_tangents);
 	ClassDB::bind_method(D_METHOD("is_calculating_tangents"), &CSGShape3D::is_calculating_tangents);
 
+	ClassDB::bind_method(D_METHOD("set_async_update", "enable"), &CSGShape3D::set_async_update);
+	ClassDB::bind_method(D_METHOD("is_async_update_enabled"), &CSGShape3D::is_async_update_enabled);
+
 	ClassDB::bind_method(D_METHOD("get_meshes"), &CSGShape3D::get_meshes);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "operation", PROPERTY_HINT_ENUM, "Union,Intersection,Subtraction"), "set_operation", "get_operation");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "snap", PROPERTY_HINT_RANGE, "0.0001,1,0.001"), "set_snap", "get_snap");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "calculate_tangents"), "set_calculate_tangents", "is_calculating_tangents");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "async_update"), "set_async_update", "is_async_update_enabled");
 
 	ADD_GROUP("Collision", "collision_");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_collision"), "set_use_collision", "is_using_collision");
@@ -631,10 +808,19 @@ CSGShape3D::CSGShape3D() {
 }
 
 CSGShape3D::~CSGShape3D() {
+	if (async_update_thread.is_started()) {
+		async_update_thread.wait_to_finish();
+	}
+	_clear_brush_update(async_brush_update);
+
 	if (brush) {
 		memdelete(brush);
 		brush = nullptr;
 	}
+	if (shape_brush) {
+		memdelete(shape_brush);
+		shape_brush = nullptr;
+	}
 }
 
 //////////////////////////////////
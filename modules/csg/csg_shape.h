@@ -33,6 +33,8 @@
 
 #define CSGJS_HEADER_ONLY
 
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "csg.h"
 #include "scene/3d/visual_instance_3d.h"
 #include "scene/resources/concave_polygon_shape_3d.h"
@@ -53,13 +55,43 @@ private:
 	Operation operation = OPERATION_UNION;
 	CSGShape3D *parent = nullptr;
 
-	CSGBrush *brush = nullptr;
+	CSGBrush *brush = nullptr; // This shape combined with its children, kept until any of them changes.
+	CSGBrush *shape_brush = nullptr; // This shape alone, kept until its own parameters change.
 
 	AABB node_aabb;
 
 	bool dirty = false;
+	bool shape_dirty = true;
 	float snap = 0.001;
 
+	// Dirty shapes are rebuilt as jobs working on copies of the brushes, so they don't touch the nodes.
+	// A job only depends on the jobs of its children, so the jobs of each depth run in parallel.
+	struct BrushOperand {
+		CSGBrush *brush = nullptr; // Up to date child brush, already transformed.
+		int job = -1; // Or the job rebuilding the child.
+		Transform xform;
+		Operation operation = OPERATION_UNION;
+	};
+
+	struct BrushJob {
+		ObjectID shape;
+		CSGBrush *shape_brush = nullptr;
+		LocalVector<BrushOperand> operands;
+		float snap = 0.001;
+		CSGBrush *result = nullptr;
+		AABB aabb;
+	};
+
+	struct BrushUpdate {
+		LocalVector<BrushJob> jobs;
+		LocalVector<LocalVector<uint32_t>> levels; // Jobs by depth in the tree.
+		uint32_t current_level = 0;
+	};
+
+	bool async_update = false;
+	BrushUpdate async_brush_update;
+	Thread async_update_thread;
+
 	bool use_collision = false;
 	uint32_t collision_layer = 1;
 	uint32_t collision_mask = 1;
@@ -102,12 +134,23 @@ private:
 	static void mikktSetTSpaceDefault(const SMikkTSpaceContext *pContext, const float fvTangent[], const float fvBiTangent[], const float fMagS, const float fMagT,
 			const tbool bIsOrientationPreserving, const int iFace, const int iVert);
 
+	int _collect_brush_jobs(BrushUpdate &r_update, uint32_t p_depth);
+	void _process_brush_job(uint32_t p_index, BrushUpdate *p_update);
+	void _process_brush_update(BrushUpdate &p_update, bool p_threaded);
+	void _apply_brush_update(BrushUpdate &p_update);
+	static void _clear_brush_update(BrushUpdate &p_update);
+
+	static void _async_update_thread_func(void *p_userdata);
+	void _async_update_finished();
+	void _finish_async_update();
+
 	void _update_shape();
+	void _update_mesh();
 
 protected:
 	void _notification(int p_what);
 	virtual CSGBrush *_build_brush() = 0;
-	void _make_dirty();
+	void _make_dirty(bool p_shape_changed = true);
 
 	static void _bind_methods();
 
@@ -148,6 +191,9 @@ public:
 	void set_calculate_tangents(bool p_calculate_tangents);
 	bool is_calculating_tangents() const;
 
+	void set_async_update(bool p_enable);
+	bool is_async_update_enabled() const;
+
 	bool is_root_shape() const;
 	CSGShape3D();
 	~CSGShape3D();
@@ -113,6 +113,7 @@ Error NetworkedMultiplayerENet::create_server(int p_port, int p_max_clients, int
 	refuse_connections = false;
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
+	_start_thread();
 	return OK;
 }
 
@@ -204,6 +205,7 @@ Error NetworkedMultiplayerENet::create_client(const String &p_address, int p_por
 	active = true;
 	server = false;
 	refuse_connections = false;
+	_start_thread();
 
 	return OK;
 }
@@ -213,6 +215,15 @@ void NetworkedMultiplayerENet::poll() {
 
 	_pop_current_packet();
 
+	if (thread_running) {
+		_dispatch_thread_events();
+		return;
+	}
+
+	_service();
+}
+
+void NetworkedMultiplayerENet::_service() {
 	ENetEvent event;
 	/* Keep servicing until there are no available events left in queue. */
 	while (true) {
@@ -256,9 +267,8 @@ void NetworkedMultiplayerENet::poll() {
 
 				peer_map[*new_id] = event.peer;
 
-				connection_status = CONNECTION_CONNECTED; // If connecting, this means it connected to something!
-
-				emit_signal("peer_connected", *new_id);
+				// If connecting, this means it connected to something!
+				_notify(THREAD_EVENT_PEER_CONNECTED, *new_id);
 
 				if (server) {
 					// Do not notify other peers when server_relay is disabled.
@@ -283,7 +293,7 @@ void NetworkedMultiplayerENet::poll() {
 						enet_peer_send(E->get(), SYSCH_CONFIG, packet);
 					}
 				} else {
-					emit_signal("connection_succeeded");
+					_notify(THREAD_EVENT_CONNECTION_SUCCEEDED);
 				}
 
 			} break;
@@ -294,7 +304,7 @@ void NetworkedMultiplayerENet::poll() {
 
 				if (!id) {
 					if (!server) {
-						emit_signal("connection_failed");
+						_notify(THREAD_EVENT_CONNECTION_FAILED);
 					}
 					// Never fully connected.
 					break;
@@ -302,8 +312,7 @@ void NetworkedMultiplayerENet::poll() {
 
 				if (!server) {
 					// Client just disconnected from server.
-					emit_signal("server_disconnected");
-					close_connection();
+					_notify(THREAD_EVENT_SERVER_DISCONNECTED);
 					return;
 				} else if (server_relay) {
 					// Server just received a client disconnect and is in relay mode, notify everyone else.
@@ -319,7 +328,7 @@ void NetworkedMultiplayerENet::poll() {
 					}
 				}
 
-				emit_signal("peer_disconnected", *id);
+				_notify(THREAD_EVENT_PEER_DISCONNECTED, *id);
 				peer_map.erase(*id);
 				memdelete(id);
 			} break;
@@ -337,12 +346,12 @@ void NetworkedMultiplayerENet::poll() {
 					switch (msg) {
 						case SYSMSG_ADD_PEER: {
 							peer_map[id] = nullptr;
-							emit_signal("peer_connected", id);
+							_notify(THREAD_EVENT_PEER_CONNECTED, id);
 
 						} break;
 						case SYSMSG_REMOVE_PEER: {
 							peer_map.erase(id);
-							emit_signal("peer_disconnected", id);
+							_notify(THREAD_EVENT_PEER_DISCONNECTED, id);
 						} break;
 					}
 
@@ -369,14 +378,14 @@ void NetworkedMultiplayerENet::poll() {
 
 						if (target == 1) {
 							// To myself and only myself
-							incoming_packets.push_back(packet);
+							_receive_packet(packet);
 						} else if (!server_relay) {
 							// No other destination is allowed when server is not relaying
 							continue;
 						} else if (target == 0) {
 							// Re-send to everyone but sender :|
 
-							incoming_packets.push_back(packet);
+							_receive_packet(packet);
 							// And make copies for sending
 							for (Map<int, ENetPeer *>::Element *E = peer_map.front(); E; E = E->next()) {
 								if (uint32_t(E->key()) == source) { // Do not resend to self
@@ -404,7 +413,7 @@ void NetworkedMultiplayerENet::poll() {
 
 							if (-target != 1) {
 								// Server is not excluded
-								incoming_packets.push_back(packet);
+								_receive_packet(packet);
 							} else {
 								// Server is excluded, erase packet
 								enet_packet_destroy(packet.packet);
@@ -416,7 +425,7 @@ void NetworkedMultiplayerENet::poll() {
 							enet_peer_send(peer_map[target], event.channelID, packet.packet);
 						}
 					} else {
-						incoming_packets.push_back(packet);
+						_receive_packet(packet);
 					}
 
 					// Destroy packet later
@@ -441,6 +450,7 @@ bool NetworkedMultiplayerENet::is_server() const {
 void NetworkedMultiplayerENet::close_connection(uint32_t wait_usec) {
 	ERR_FAIL_COND_MSG(!active, "The multiplayer instance isn't currently active.");
 
+	_stop_thread();
 	_pop_current_packet();
 
 	bool peers_disconnected = false;
@@ -472,9 +482,16 @@ void NetworkedMultiplayerENet::close_connection(uint32_t wait_usec) {
 void NetworkedMultiplayerENet::disconnect_peer(int p_peer, bool now) {
 	ERR_FAIL_COND_MSG(!active, "The multiplayer instance isn't currently active.");
 	ERR_FAIL_COND_MSG(!is_server(), "Can't disconnect a peer when not acting as a server.");
-	ERR_FAIL_COND_MSG(!peer_map.has(p_peer), vformat("Peer ID %d not found in the list of peers.", p_peer));
 
-	if (now) {
+	{
+		MutexLock lock(host_mutex);
+		ERR_FAIL_COND_MSG(!peer_map.has(p_peer), vformat("Peer ID %d not found in the list of peers.", p_peer));
+
+		if (!now) {
+			enet_peer_disconnect_later(peer_map[p_peer], 0);
+			return;
+		}
+
 		int *id = (int *)peer_map[p_peer]->data;
 		enet_peer_disconnect_now(peer_map[p_peer], 0);
 
@@ -497,11 +514,11 @@ void NetworkedMultiplayerENet::disconnect_peer(int p_peer, bool now) {
 			memdelete(id);
 		}
 
-		emit_signal("peer_disconnected", p_peer);
 		peer_map.erase(p_peer);
-	} else {
-		enet_peer_disconnect_later(peer_map[p_peer], 0);
 	}
+
+	// Emitted without holding the host lock, so handlers can call back into the peer.
+	emit_signal("peer_disconnected", p_peer);
 }
 
 int NetworkedMultiplayerENet::get_available_packet_count() const {
@@ -552,49 +569,207 @@ Error NetworkedMultiplayerENet::put_packet(const uint8_t *p_buffer, int p_buffer
 		channel = transfer_channel;
 	}
 
-	Map<int, ENetPeer *>::Element *E = nullptr;
-
-	if (target_peer != 0) {
-		E = peer_map.find(ABS(target_peer));
-		ERR_FAIL_COND_V_MSG(!E, ERR_INVALID_PARAMETER, vformat("Invalid target peer: %d", target_peer));
-	}
-
 	ENetPacket *packet = enet_packet_create(nullptr, p_buffer_size + 8, packet_flags);
 	encode_uint32(unique_id, &packet->data[0]); // Source ID
 	encode_uint32(target_peer, &packet->data[4]); // Dest ID
 	copymem(&packet->data[8], p_buffer, p_buffer_size);
 
+	if (thread_running) {
+		// Sent by the network thread, the target is validated there.
+		OutgoingPacket outgoing;
+		outgoing.packet = packet;
+		outgoing.target = target_peer;
+		outgoing.channel = channel;
+
+		MutexLock lock(queue_mutex);
+		outgoing_packets.push_back(outgoing);
+		return OK;
+	}
+
+	Error err = _send_packet(packet, target_peer, channel);
+	if (err == OK) {
+		enet_host_flush(host);
+	}
+	return err;
+}
+
+Error NetworkedMultiplayerENet::_send_packet(ENetPacket *p_packet, int p_target, int p_channel) {
+	Map<int, ENetPeer *>::Element *E = nullptr;
+
+	if (p_target != 0) {
+		E = peer_map.find(ABS(p_target));
+		if (!E) {
+			enet_packet_destroy(p_packet);
+			ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, vformat("Invalid target peer: %d", p_target));
+		}
+	}
+
 	if (server) {
-		if (target_peer == 0) {
-			enet_host_broadcast(host, channel, packet);
-		} else if (target_peer < 0) {
+		if (p_target == 0) {
+			enet_host_broadcast(host, p_channel, p_packet);
+		} else if (p_target < 0) {
 			// Send to all but one
 			// and make copies for sending
 
-			int exclude = -target_peer;
+			int exclude = -p_target;
 
 			for (Map<int, ENetPeer *>::Element *F = peer_map.front(); F; F = F->next()) {
 				if (F->key() == exclude) { // Exclude packet
 					continue;
 				}
 
-				ENetPacket *packet2 = enet_packet_create(packet->data, packet->dataLength, packet_flags);
+				ENetPacket *packet2 = enet_packet_create(p_packet->data, p_packet->dataLength, p_packet->flags);
 
-				enet_peer_send(F->get(), channel, packet2);
+				enet_peer_send(F->get(), p_channel, packet2);
 			}
 
-			enet_packet_destroy(packet); // Original packet no longer needed
+			enet_packet_destroy(p_packet); // Original packet no longer needed
 		} else {
-			enet_peer_send(E->get(), channel, packet);
+			enet_peer_send(E->get(), p_channel, p_packet);
 		}
 	} else {
-		ERR_FAIL_COND_V(!peer_map.has(1), ERR_BUG);
-		enet_peer_send(peer_map[1], channel, packet); // Send to server for broadcast
+		if (!peer_map.has(1)) {
+			enet_packet_destroy(p_packet);
+			ERR_FAIL_V(ERR_BUG);
+		}
+		enet_peer_send(peer_map[1], p_channel, p_packet); // Send to server for broadcast
+	}
+
+	return OK;
+}
+
+void NetworkedMultiplayerENet::_notify(ThreadEventType p_type, int p_id) {
+	if (thread_running) {
+		ThreadEvent event;
+		event.type = p_type;
+		event.id = p_id;
+
+		MutexLock lock(queue_mutex);
+		thread_events.push_back(event);
+		return;
+	}
+	_dispatch(p_type, p_id);
+}
+
+void NetworkedMultiplayerENet::_dispatch(ThreadEventType p_type, int p_id) {
+	switch (p_type) {
+		case THREAD_EVENT_PEER_CONNECTED: {
+			connection_status = CONNECTION_CONNECTED;
+			emit_signal("peer_connected", p_id);
+		} break;
+		case THREAD_EVENT_PEER_DISCONNECTED: {
+			emit_signal("peer_disconnected", p_id);
+		} break;
+		case THREAD_EVENT_CONNECTION_SUCCEEDED: {
+			emit_signal("connection_succeeded");
+		} break;
+		case THREAD_EVENT_CONNECTION_FAILED: {
+			emit_signal("connection_failed");
+		} break;
+		case THREAD_EVENT_SERVER_DISCONNECTED: {
+			emit_signal("server_disconnected");
+			close_connection();
+		} break;
+		case THREAD_EVENT_PACKET: {
+			// Queued directly by _receive_packet().
+		} break;
+	}
+}
+
+void NetworkedMultiplayerENet::_receive_packet(const Packet &p_packet) {
+	if (thread_running) {
+		ThreadEvent event;
+		event.type = THREAD_EVENT_PACKET;
+		event.packet = p_packet;
+
+		MutexLock lock(queue_mutex);
+		thread_events.push_back(event);
+		return;
+	}
+	incoming_packets.push_back(p_packet);
+}
+
+void NetworkedMultiplayerENet::_thread_func(void *p_userdata) {
+	NetworkedMultiplayerENet *enet = (NetworkedMultiplayerENet *)p_userdata;
+
+	while (enet->thread_running) {
+		{
+			MutexLock lock(enet->host_mutex);
+			enet->_flush_outgoing_packets();
+			enet->_service();
+		}
+		OS::get_singleton()->delay_usec(enet->thread_poll_usec);
+	}
+}
+
+void NetworkedMultiplayerENet::_start_thread() {
+	if (!threaded) {
+		return;
+	}
+	thread_running = true;
+	thread.start(_thread_func, this);
+}
+
+void NetworkedMultiplayerENet::_stop_thread() {
+	if (!thread_running) {
+		return;
+	}
+	thread_running = false;
+	thread.wait_to_finish();
+
+	// Drop whatever was left in the queues.
+	for (List<OutgoingPacket>::Element *E = outgoing_packets.front(); E; E = E->next()) {
+		enet_packet_destroy(E->get().packet);
+	}
+	outgoing_packets.clear();
+	for (List<ThreadEvent>::Element *E = thread_events.front(); E; E = E->next()) {
+		if (E->get().type == THREAD_EVENT_PACKET) {
+			enet_packet_destroy(E->get().packet.packet);
+		}
+	}
+	thread_events.clear();
+}
+
+void NetworkedMultiplayerENet::_flush_outgoing_packets() {
+	List<OutgoingPacket> to_send;
+	{
+		MutexLock lock(queue_mutex);
+		to_send = outgoing_packets;
+		outgoing_packets.clear();
+	}
+	if (to_send.is_empty()) {
+		return;
 	}
 
+	for (List<OutgoingPacket>::Element *E = to_send.front(); E; E = E->next()) {
+		_send_packet(E->get().packet, E->get().target, E->get().channel);
+	}
 	enet_host_flush(host);
+}
 
-	return OK;
+void NetworkedMultiplayerENet::_dispatch_thread_events() {
+	List<ThreadEvent> events;
+	{
+		MutexLock lock(queue_mutex);
+		events = thread_events;
+		thread_events.clear();
+	}
+
+	for (List<ThreadEvent>::Element *E = events.front(); E; E = E->next()) {
+		const ThreadEvent &event = E->get();
+		if (!active) {
+			// Closed while dispatching a previous event.
+			if (event.type == THREAD_EVENT_PACKET) {
+				enet_packet_destroy(event.packet.packet);
+			}
+			continue;
+		}
+		if (event.type == THREAD_EVENT_PACKET) {
+			incoming_packets.push_back(event.packet);
+		} else {
+			_dispatch(event.type, event.id);
+		}
+	}
 }
 
 int NetworkedMultiplayerENet::get_max_packet_size() const {
@@ -641,6 +816,7 @@ int NetworkedMultiplayerENet::get_unique_id() const {
 }
 
 void NetworkedMultiplayerENet::set_refuse_new_connections(bool p_enable) {
+	MutexLock lock(host_mutex);
 	refuse_connections = p_enable;
 #ifdef GODOT_ENET
 	if (active) {
@@ -759,6 +935,7 @@ void NetworkedMultiplayerENet::enet_compressor_destroy(void *context) {
 }
 
 IP_Address NetworkedMultiplayerENet::get_peer_address(int p_peer_id) const {
+	MutexLock lock(host_mutex);
 	ERR_FAIL_COND_V_MSG(!peer_map.has(p_peer_id), IP_Address(), vformat("Peer ID %d not found in the list of peers.", p_peer_id));
 	ERR_FAIL_COND_V_MSG(!is_server() && p_peer_id != 1, IP_Address(), "Can't get the address of peers other than the server (ID -1) when acting as a client.");
 	ERR_FAIL_COND_V_MSG(peer_map[p_peer_id] == nullptr, IP_Address(), vformat("Peer ID %d found in the list of peers, but is null.", p_peer_id));
@@ -774,6 +951,7 @@ IP_Address NetworkedMultiplayerENet::get_peer_address(int p_peer_id) const {
 }
 
 int NetworkedMultiplayerENet::get_peer_port(int p_peer_id) const {
+	MutexLock lock(host_mutex);
 	ERR_FAIL_COND_V_MSG(!peer_map.has(p_peer_id), 0, vformat("Peer ID %d not found in the list of peers.", p_peer_id));
 	ERR_FAIL_COND_V_MSG(!is_server() && p_peer_id != 1, 0, "Can't get the address of peers other than the server (ID -1) when acting as a client.");
 	ERR_FAIL_COND_V_MSG(peer_map[p_peer_id] == nullptr, 0, vformat("Peer ID %d found in the list of peers, but is null.", p_peer_id));
@@ -818,6 +996,24 @@ void NetworkedMultiplayerENet::set_server_relay_enabled(bool p_enabled) {
 	server_relay = p_enabled;
 }
 
+void NetworkedMultiplayerENet::set_threaded(bool p_threaded) {
+	ERR_FAIL_COND_MSG(active, "The threaded mode can't be changed while the multiplayer instance is active.");
+	threaded = p_threaded;
+}
+
+bool NetworkedMultiplayerENet::is_threaded() const {
+	return threaded;
+}
+
+void NetworkedMultiplayerENet::set_thread_poll_usec(int p_usec) {
+	ERR_FAIL_COND(p_usec < 0);
+	thread_poll_usec = p_usec;
+}
+
+int NetworkedMultiplayerENet::get_thread_poll_usec() const {
+	return thread_poll_usec;
+}
+
 bool NetworkedMultiplayerENet::is_server_relay_enabled() const {
 	return server_relay;
 }
@@ -849,12 +1045,18 @@ void NetworkedMultiplayerENet::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_always_ordered"), &NetworkedMultiplayerENet::is_always_ordered);
 	ClassDB::bind_method(D_METHOD("set_server_relay_enabled", "enabled"), &NetworkedMultiplayerENet::set_server_relay_enabled);
 	ClassDB::bind_method(D_METHOD("is_server_relay_enabled"), &NetworkedMultiplayerENet::is_server_relay_enabled);
+	ClassDB::bind_method(D_METHOD("set_threaded", "enabled"), &NetworkedMultiplayerENet::set_threaded);
+	ClassDB::bind_method(D_METHOD("is_threaded"), &NetworkedMultiplayerENet::is_threaded);
+	ClassDB::bind_method(D_METHOD("set_thread_poll_usec", "usec"), &NetworkedMultiplayerENet::set_thread_poll_usec);
+	ClassDB::bind_method(D_METHOD("get_thread_poll_usec"), &NetworkedMultiplayerENet::get_thread_poll_usec);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "compression_mode", PROPERTY_HINT_ENUM, "None,Range Coder,FastLZ,ZLib,ZStd"), "set_compression_mode", "get_compression_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "transfer_channel"), "set_transfer_channel", "get_transfer_channel");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "channel_count"), "set_channel_count", "get_channel_count");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "always_ordered"), "set_always_ordered", "is_always_ordered");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "threaded"), "set_threaded", "is_threaded");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "thread_poll_usec", PROPERTY_HINT_RANGE, "0,100000,1"), "set_thread_poll_usec", "get_thread_poll_usec");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "dtls_verify"), "set_dtls_verify_enabled", "is_dtls_verify_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_dtls"), "set_dtls_enabled", "is_dtls_enabled");
 
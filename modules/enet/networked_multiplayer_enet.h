@@ -34,9 +34,13 @@
 #include "core/crypto/crypto.h"
 #include "core/io/compression.h"
 #include "core/io/networked_multiplayer_peer.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
 
 #include <enet/enet.h>
 
+#include <atomic>
+
 class NetworkedMultiplayerENet : public NetworkedMultiplayerPeer {
 	GDCLASS(NetworkedMultiplayerENet, NetworkedMultiplayerPeer);
 
@@ -96,6 +100,51 @@ private:
 
 	Packet current_packet;
 
+	// Threaded servicing. The thread owns the host: it services it (which
+	// includes compression and DTLS), relays and sends the queued packets.
+	// poll() then only dispatches the events it queued, in order.
+	enum ThreadEventType {
+		THREAD_EVENT_PEER_CONNECTED,
+		THREAD_EVENT_PEER_DISCONNECTED,
+		THREAD_EVENT_CONNECTION_SUCCEEDED,
+		THREAD_EVENT_CONNECTION_FAILED,
+		THREAD_EVENT_SERVER_DISCONNECTED,
+		THREAD_EVENT_PACKET,
+	};
+
+	struct ThreadEvent {
+		ThreadEventType type = THREAD_EVENT_PACKET;
+		int id = 0;
+		Packet packet;
+	};
+
+	struct OutgoingPacket {
+		ENetPacket *packet = nullptr;
+		int target = 0;
+		int channel = 0;
+	};
+
+	bool threaded = false;
+	int thread_poll_usec = 1000;
+	Thread thread;
+	std::atomic<bool> thread_running = { false };
+	mutable Mutex host_mutex; // Guards the host and the peer map.
+	Mutex queue_mutex; // Guards the queues below.
+	List<ThreadEvent> thread_events;
+	List<OutgoingPacket> outgoing_packets;
+
+	static void _thread_func(void *p_userdata);
+	void _start_thread();
+	void _stop_thread();
+	void _flush_outgoing_packets();
+	void _dispatch_thread_events();
+
+	void _service();
+	void _notify(ThreadEventType p_type, int p_id = 0);
+	void _dispatch(ThreadEventType p_type, int p_id);
+	void _receive_packet(const Packet &p_packet);
+	Error _send_packet(ENetPacket *p_packet, int p_target, int p_channel);
+
 	uint32_t _gen_unique_id() const;
 	void _pop_current_packet();
 
@@ -165,6 +214,10 @@ public:
 	bool is_always_ordered() const;
 	void set_server_relay_enabled(bool p_enabled);
 	bool is_server_relay_enabled() const;
+	void set_threaded(bool p_threaded);
+	bool is_threaded() const;
+	void set_thread_poll_usec(int p_usec);
+	int get_thread_poll_usec() const;
 
 	NetworkedMultiplayerENet();
 	~NetworkedMultiplayerENet();
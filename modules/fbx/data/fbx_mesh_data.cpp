@@ -108,8 +108,8 @@ typedef int DataIndex;
 
 struct SurfaceData {
 	Ref<SurfaceTool> surface_tool;
-	OrderedHashMap<Vertex, int> lookup_table; // proposed fix is to replace lookup_table[vertex_id] to give the position of the vertices_map[int] index.
-	LocalVector<Vertex> vertices_map; // this must be ordered the same as insertion <-- slow to do find() operation.
+	LocalVector<int> lookup_table; // Position of each mesh vertex in vertices_map, -1 if the surface doesn't use it.
+	LocalVector<Vertex> vertices_map; // this must be ordered the same as insertion
 	Ref<Material> material;
 	HashMap<PolygonId, Vector<DataIndex>> surface_polygon_vertex;
 	Array morphs;
@@ -227,6 +227,10 @@ EditorSceneImporterMeshNode3D *FBXMeshData::create_fbx_mesh(const ImportState &s
 				SurfaceData sd;
 				sd.surface_tool.instance();
 				sd.surface_tool->begin(Mesh::PRIMITIVE_TRIANGLES);
+				sd.lookup_table.resize(vertex_count);
+				for (int i = 0; i < vertex_count; i += 1) {
+					sd.lookup_table[i] = -1;
+				}
 
 				if (surface_id < 0) {
 					// nothing to do
@@ -263,14 +267,13 @@ EditorSceneImporterMeshNode3D *FBXMeshData::create_fbx_mesh(const ImportState &s
 
 			const int vertex = get_vertex_from_polygon_vertex(polygon_indices, polygon_vertex);
 
+			ERR_FAIL_INDEX_V_MSG(vertex, vertex_count, nullptr, "The FBX file is corrupted, the polygon vertex is out of range.");
+
 			// The vertex position in the surface
-			// Uses a lookup table for speed with large scenes
-			bool has_polygon_vertex_index = surface_data->lookup_table.has(vertex);
-			int surface_polygon_vertex_index = -1;
+			// Uses a lookup table indexed by vertex for speed with large scenes
+			int surface_polygon_vertex_index = surface_data->lookup_table[vertex];
 
-			if (has_polygon_vertex_index) {
-				surface_polygon_vertex_index = surface_data->lookup_table[vertex];
-			} else {
+			if (surface_polygon_vertex_index == -1) {
 				surface_polygon_vertex_index = surface_data->vertices_map.size();
 				surface_data->lookup_table[vertex] = surface_polygon_vertex_index;
 				surface_data->vertices_map.push_back(vertex);
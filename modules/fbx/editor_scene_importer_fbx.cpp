@@ -37,6 +37,9 @@
 #include "tools/import_utils.h"
 
 #include "core/io/image_loader.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/thread_work_pool.h"
 #include "editor/editor_log.h"
 #include "editor/editor_node.h"
 #include "editor/import/resource_importer_scene.h"
@@ -57,6 +60,31 @@
 
 #include <string>
 
+// Meshes are converted in parallel before the node tree is built. Requests sharing the same
+// mesh data (instanced geometry) are converted serially, in node order, within the same job.
+struct FBXMeshConversion {
+	struct Request {
+		Ref<FBXNode> fbx_node;
+		const FBXDocParser::MeshGeometry *mesh_geometry = nullptr;
+		Ref<FBXMeshData> mesh_data;
+		EditorSceneImporterMeshNode3D *mesh_node = nullptr;
+	};
+
+	const ImportState *state = nullptr;
+	bool use_compression = false;
+	LocalVector<Request> requests;
+	LocalVector<LocalVector<uint32_t>> groups; // Request indices, per mesh data.
+
+	void convert_group(uint32_t p_index, void *p_userdata) {
+		const LocalVector<uint32_t> &group = groups[p_index];
+		for (uint32_t i = 0; i < group.size(); i++) {
+			Request &request = requests[group[i]];
+			request.mesh_data->mesh_node = request.fbx_node;
+			request.mesh_node = request.mesh_data->create_fbx_mesh(*state, request.mesh_geometry, request.fbx_node->fbx_model, use_compression);
+		}
+	}
+};
+
 void EditorSceneImporterFBX::get_extensions(List<String> *r_extensions) const {
 	// register FBX as the one and only format for FBX importing
 	const String import_setting_string = "filesystem/import/fbx/";
@@ -595,12 +623,18 @@ Node3D *EditorSceneImporterFBX::_generate_scene(
 
 	// build godot node tree
 	if (state.fbx_node_list.size() > 0) {
+		// Gather the meshes to convert, the node tree uses the last mesh of each node.
+		FBXMeshConversion conversion;
+		conversion.state = &state;
+		conversion.use_compression = (p_flags & IMPORT_USE_COMPRESSION) != 0;
+		LocalVector<int> node_last_request;
+		Map<uint64_t, uint32_t> mesh_groups;
+
 		for (List<Ref<FBXNode>>::Element *node_element = state.fbx_node_list.front();
 				node_element;
 				node_element = node_element->next()) {
 			Ref<FBXNode> fbx_node = node_element->get();
-			EditorSceneImporterMeshNode3D *mesh_node = nullptr;
-			Ref<FBXMeshData> mesh_data_precached;
+			int last_request = -1;
 
 			// check for valid geometry
 			if (fbx_node->fbx_model == nullptr) {
@@ -616,6 +650,7 @@ Node3D *EditorSceneImporterFBX::_generate_scene(
 					const FBXDocParser::MeshGeometry *mesh_geometry = dynamic_cast<const FBXDocParser::MeshGeometry *>(mesh);
 					if (mesh_geometry) {
 						uint64_t mesh_id = mesh_geometry->ID();
+						Ref<FBXMeshData> mesh_data_precached;
 
 						// this data will pre-exist if vertex weight information is found
 						if (state.renderer_mesh_data.has(mesh_id)) {
@@ -625,10 +660,19 @@ Node3D *EditorSceneImporterFBX::_generate_scene(
 							state.renderer_mesh_data.insert(mesh_id, mesh_data_precached);
 						}
 
-						mesh_data_precached->mesh_node = fbx_node;
+						FBXMeshConversion::Request request;
+						request.fbx_node = fbx_node;
+						request.mesh_geometry = mesh_geometry;
+						request.mesh_data = mesh_data_precached;
+						last_request = conversion.requests.size();
+						conversion.requests.push_back(request);
+
+						if (!mesh_groups.has(mesh_id)) {
+							mesh_groups.insert(mesh_id, conversion.groups.size());
+							conversion.groups.push_back(LocalVector<uint32_t>());
+						}
+						conversion.groups[mesh_groups[mesh_id]].push_back(last_request);
 
-						// mesh node, mesh id
-						mesh_node = mesh_data_precached->create_fbx_mesh(state, mesh_geometry, fbx_node->fbx_model, (p_flags & IMPORT_USE_COMPRESSION) != 0);
 						if (!state.MeshNodes.has(mesh_id)) {
 							state.MeshNodes.insert(mesh_id, fbx_node);
 						}
@@ -641,6 +685,37 @@ Node3D *EditorSceneImporterFBX::_generate_scene(
 				}
 			}
 
+			node_last_request.push_back(last_request);
+		}
+
+		// mesh node, mesh id
+		const uint32_t group_count = conversion.groups.size();
+		const uint32_t thread_count = OS::get_singleton()->can_use_threads() ? MIN(group_count, (uint32_t)OS::get_singleton()->get_processor_count()) : 1;
+		if (thread_count > 1) {
+			ThreadWorkPool work_pool;
+			work_pool.init(thread_count);
+			work_pool.do_work(group_count, &conversion, &FBXMeshConversion::convert_group, (void *)nullptr);
+			work_pool.finish();
+		} else {
+			for (uint32_t i = 0; i < group_count; i++) {
+				conversion.convert_group(i, nullptr);
+			}
+		}
+
+		uint32_t node_index = 0;
+		for (List<Ref<FBXNode>>::Element *node_element = state.fbx_node_list.front();
+				node_element;
+				node_element = node_element->next(), node_index++) {
+			Ref<FBXNode> fbx_node = node_element->get();
+			EditorSceneImporterMeshNode3D *mesh_node = nullptr;
+			Ref<FBXMeshData> mesh_data_precached;
+
+			if (node_last_request[node_index] != -1) {
+				const FBXMeshConversion::Request &request = conversion.requests[node_last_request[node_index]];
+				mesh_node = request.mesh_node;
+				mesh_data_precached = request.mesh_data;
+			}
+
 			Ref<FBXSkeleton> node_skeleton = fbx_node->skeleton_node;
 
 			if (node_skeleton.is_valid()) {
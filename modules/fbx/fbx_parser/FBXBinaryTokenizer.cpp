@@ -77,7 +77,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ByteSwapper.h"
 #include "FBXTokenizer.h"
+#include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/thread_work_pool.h"
 
 #include <stdint.h>
 
@@ -350,9 +353,18 @@ void ReadData(const char *&sbegin_out, const char *&send_out, const char *input,
 }
 
 // ------------------------------------------------------------------------------------------------
-bool ReadScope(TokenList &output_tokens, const char *input, const char *&cursor, const char *end, bool const is64bits) {
+// at the end of each nested block, there is a NUL record to indicate
+// that the sub-scope exists (i.e. to distinguish between P: and P : {})
+// this NUL record is 13 bytes long on 32 bit version and 25 bytes long on 64 bit.
+size_t SentinelBlockLength(bool const is64bits) {
+	return is64bits ? (sizeof(uint64_t) * 3 + 1) : (sizeof(uint32_t) * 3 + 1);
+}
+
+// ------------------------------------------------------------------------------------------------
+// reads the key and properties of a scope, leaves the cursor at its nested scopes (if any)
+bool ReadScopeHeader(TokenList &output_tokens, const char *input, const char *&cursor, const char *end, bool const is64bits, uint64_t &end_offset) {
 	// the first word contains the offset at which this block ends
-	const uint64_t end_offset = is64bits ? ReadDoubleWord(input, cursor, end) : ReadWord(input, cursor, end);
+	end_offset = is64bits ? ReadDoubleWord(input, cursor, end) : ReadWord(input, cursor, end);
 
 	// we may get 0 if reading reached the end of the file -
 	// fbx files have a mysterious extra footer which I don't know
@@ -396,10 +408,17 @@ bool ReadScope(TokenList &output_tokens, const char *input, const char *&cursor,
 		TokenizeError("property length not reached, something is wrong", input, cursor);
 	}
 
-	// at the end of each nested block, there is a NUL record to indicate
-	// that the sub-scope exists (i.e. to distinguish between P: and P : {})
-	// this NUL record is 13 bytes long on 32 bit version and 25 bytes long on 64 bit.
-	const size_t sentinel_block_length = is64bits ? (sizeof(uint64_t) * 3 + 1) : (sizeof(uint32_t) * 3 + 1);
+	return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ReadScope(TokenList &output_tokens, const char *input, const char *&cursor, const char *end, bool const is64bits) {
+	uint64_t end_offset = 0;
+	if (!ReadScopeHeader(output_tokens, input, cursor, end, is64bits, end_offset)) {
+		return false;
+	}
+
+	const size_t sentinel_block_length = SentinelBlockLength(is64bits);
 
 	if (Offset(input, cursor) < end_offset) {
 		if (end_offset - Offset(input, cursor) < sentinel_block_length) {
@@ -428,6 +447,119 @@ bool ReadScope(TokenList &output_tokens, const char *input, const char *&cursor,
 
 	return true;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Top level scopes are tokenized in parallel. Big ones (like Objects, which holds almost all of
+// the file) have their children split into several ranges. Each range gets its own token list,
+// the lists are concatenated in file order afterwards so the output matches the serial version.
+struct TokenizeRange {
+	TokenList tokens;
+	const char *begin = nullptr;
+	uint64_t range_end = 0; // Offset where the scopes of this range stop, 0 if this range only holds tokens.
+	uint64_t limit = 0; // Offset scopes may not read past.
+};
+
+struct BinaryTokenizer {
+	enum {
+		MIN_SPLIT_SCOPE_SIZE = 1 << 20, // Scopes bigger than this have their children tokenized in parallel.
+		RANGE_SIZE = 1 << 16, // Children are grouped in ranges of about this many bytes.
+	};
+
+	const char *input = nullptr;
+	bool is64bits = false;
+	LocalVector<TokenizeRange> ranges;
+
+	void add_scopes(const char *p_begin, uint64_t p_range_end, uint64_t p_limit) {
+		TokenizeRange range;
+		range.begin = p_begin;
+		range.range_end = p_range_end;
+		range.limit = p_limit;
+		ranges.push_back(range);
+	}
+
+	// Groups the children of a scope, reading only their end offsets to jump from one to the next.
+	void add_children(const char *p_cursor, uint64_t p_children_end) {
+		const char *range_begin = p_cursor;
+		while (Offset(input, p_cursor) < p_children_end) {
+			const char *peek = p_cursor;
+			const uint64_t child_end = is64bits ? ReadDoubleWord(input, peek, input + p_children_end) : ReadWord(input, peek, input + p_children_end);
+			if (child_end <= Offset(input, p_cursor) || child_end > p_children_end) {
+				// Broken (or footer) offset, leave the rest to a single range which will report it.
+				break;
+			}
+			p_cursor = input + child_end;
+			if (Offset(range_begin, p_cursor) >= RANGE_SIZE) {
+				add_scopes(range_begin, Offset(input, p_cursor), p_children_end);
+				range_begin = p_cursor;
+			}
+		}
+		if (Offset(input, range_begin) < p_children_end) {
+			add_scopes(range_begin, p_children_end, p_children_end);
+		}
+	}
+
+	void split(const char *p_cursor, const char *p_end) {
+		const size_t sentinel_block_length = SentinelBlockLength(is64bits);
+
+		while (p_cursor < p_end) {
+			const char *peek = p_cursor;
+			uint64_t end_offset = is64bits ? ReadDoubleWord(input, peek, p_end) : ReadWord(input, peek, p_end);
+			if (!end_offset || end_offset > Offset(input, p_end) || end_offset <= Offset(input, p_cursor)) {
+				// Footer or broken offset, tokenized as in the serial version (reading stops or errors there).
+				add_scopes(p_cursor, Offset(input, p_end), Offset(input, p_end));
+				return;
+			}
+
+			if (end_offset - Offset(input, p_cursor) < MIN_SPLIT_SCOPE_SIZE) {
+				add_scopes(p_cursor, end_offset, Offset(input, p_end));
+				p_cursor = input + end_offset;
+				continue;
+			}
+
+			// Read the header of the big scope here, then split its children.
+			TokenizeRange header;
+			const char *cursor = p_cursor;
+			ReadScopeHeader(header.tokens, input, cursor, p_end, is64bits, end_offset);
+			if (Offset(input, cursor) >= end_offset || end_offset - Offset(input, cursor) < sentinel_block_length) {
+				// No children, let the serial reader handle (and validate) it.
+				for (size_t i = 0; i < header.tokens.size(); i++) {
+					delete header.tokens[i];
+				}
+				add_scopes(p_cursor, end_offset, Offset(input, p_end));
+				p_cursor = input + end_offset;
+				continue;
+			}
+
+			header.tokens.push_back(new_Token(cursor, cursor + 1, TokenType_OPEN_BRACKET, Offset(input, cursor)));
+			ranges.push_back(header);
+
+			const uint64_t children_end = end_offset - sentinel_block_length;
+			add_children(cursor, children_end);
+
+			cursor = input + children_end;
+			TokenizeRange footer;
+			footer.tokens.push_back(new_Token(cursor, cursor + 1, TokenType_CLOSE_BRACKET, Offset(input, cursor)));
+			ranges.push_back(footer);
+
+			for (unsigned int i = 0; i < sentinel_block_length; ++i) {
+				if (cursor[i] != '\0') {
+					TokenizeError("failed to read nested block sentinel, expected all bytes to be 0", input, cursor);
+				}
+			}
+			p_cursor = input + end_offset;
+		}
+	}
+
+	void tokenize_range(uint32_t p_index, void *p_userdata) {
+		TokenizeRange &range = ranges[p_index];
+		const char *cursor = range.begin;
+		while (range.range_end && Offset(input, cursor) < range.range_end) {
+			if (!ReadScope(range.tokens, input, cursor, input + range.limit, is64bits)) {
+				break;
+			}
+		}
+	}
+};
 } // anonymous namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -458,10 +590,33 @@ void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length)
 	//ASSIMP_LOG_DEBUG_F("FBX version: ", version);
 	const bool is64bits = version >= 7500;
 	const char *end = input + length;
-	while (cursor < end) {
-		if (!ReadScope(output_tokens, input, cursor, input + length, is64bits)) {
-			break;
+
+	BinaryTokenizer tokenizer;
+	tokenizer.input = input;
+	tokenizer.is64bits = is64bits;
+	tokenizer.split(cursor, end);
+
+	const uint32_t range_count = tokenizer.ranges.size();
+	const uint32_t thread_count = OS::get_singleton()->can_use_threads() ? MIN(range_count, (uint32_t)OS::get_singleton()->get_processor_count()) : 1;
+	if (thread_count > 1) {
+		ThreadWorkPool work_pool;
+		work_pool.init(thread_count);
+		work_pool.do_work(range_count, &tokenizer, &BinaryTokenizer::tokenize_range, (void *)nullptr);
+		work_pool.finish();
+	} else {
+		for (uint32_t i = 0; i < range_count; i++) {
+			tokenizer.tokenize_range(i, nullptr);
 		}
 	}
+
+	size_t token_count = output_tokens.size();
+	for (uint32_t i = 0; i < range_count; i++) {
+		token_count += tokenizer.ranges[i].tokens.size();
+	}
+	output_tokens.reserve(token_count);
+	for (uint32_t i = 0; i < range_count; i++) {
+		const TokenList &tokens = tokenizer.ranges[i].tokens;
+		output_tokens.insert(output_tokens.end(), tokens.begin(), tokens.end());
+	}
 }
 } // namespace FBXDocParser
@@ -67,6 +67,36 @@ void GDAPI godot_method_bind_ptrcall(godot_method_bind *p_method_bind, godot_obj
 	mb->ptrcall(o, p_args, p_ret);
 }
 
+void GDAPI godot_method_bind_ptrcall_batch(const godot_method_bind_ptrcall_record *p_calls, int p_count) {
+	ERR_FAIL_COND(p_count > 0 && !p_calls);
+	for (int i = 0; i < p_count; i++) {
+		const godot_method_bind_ptrcall_record &call = p_calls[i];
+		((MethodBind *)call.method_bind)->ptrcall((Object *)call.instance, call.args, call.ret);
+	}
+}
+
+void GDAPI godot_method_bind_ptrcall_strided(godot_method_bind *p_method_bind, godot_object **p_instances, int p_count, const void *p_args, int p_args_stride, void *r_rets, int p_rets_stride) {
+	MethodBind *mb = (MethodBind *)p_method_bind;
+	ERR_FAIL_NULL(mb);
+	ERR_FAIL_COND(p_count > 0 && !p_instances);
+	ERR_FAIL_COND_MSG(mb->get_argument_count() > 1, "Strided calls only support methods taking at most one argument.");
+	ERR_FAIL_COND(mb->get_argument_count() == 1 && !p_args);
+	ERR_FAIL_COND(mb->has_return() && !r_rets);
+
+	const uint8_t *arg = (const uint8_t *)p_args;
+	uint8_t *ret = (uint8_t *)r_rets;
+	for (int i = 0; i < p_count; i++) {
+		const void *args[1] = { arg };
+		mb->ptrcall((Object *)p_instances[i], args, ret);
+		if (arg) {
+			arg += p_args_stride;
+		}
+		if (ret) {
+			ret += p_rets_stride;
+		}
+	}
+}
+
 godot_variant GDAPI godot_method_bind_call(godot_method_bind *p_method_bind, godot_object *p_instance, const godot_variant **p_args, const int p_arg_count, godot_variant_call_error *p_call_error) {
 	MethodBind *mb = (MethodBind *)p_method_bind;
 	Object *o = (Object *)p_instance;
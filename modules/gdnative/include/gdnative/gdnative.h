@@ -209,6 +209,25 @@ typedef struct {
 godot_method_bind GDAPI *godot_method_bind_get_method(const char *p_classname, const char *p_methodname);
 void GDAPI godot_method_bind_ptrcall(godot_method_bind *p_method_bind, godot_object *p_instance, const void **p_args, void *p_ret);
 godot_variant GDAPI godot_method_bind_call(godot_method_bind *p_method_bind, godot_object *p_instance, const godot_variant **p_args, const int p_arg_count, godot_variant_call_error *p_call_error);
+
+// Batched calls, to make many calls with a single crossing of the API boundary.
+
+typedef struct {
+	godot_method_bind *method_bind;
+	godot_object *instance;
+	const void **args;
+	void *ret;
+} godot_method_bind_ptrcall_record;
+
+// Same as calling godot_method_bind_ptrcall() on each record, in order.
+void GDAPI godot_method_bind_ptrcall_batch(const godot_method_bind_ptrcall_record *p_calls, int p_count);
+// Calls a method taking at most one argument on many instances, e.g. a
+// setter or getter such as Node3D's set_transform() or get_transform().
+// The argument of call i is read at p_args + i * p_args_stride and its
+// return value written to r_rets + i * p_rets_stride. p_args and r_rets may
+// be NULL when the method takes no argument or returns nothing.
+void GDAPI godot_method_bind_ptrcall_strided(godot_method_bind *p_method_bind, godot_object **p_instances, int p_count, const void *p_args, int p_args_stride, void *r_rets, int p_rets_stride);
+
 ////// Script API
 
 typedef struct godot_gdnative_api_version {
@@ -115,10 +115,12 @@
 
 GdNavigationServer::GdNavigationServer() :
 		NavigationServer3D() {
+	agent_work_pool.init();
 }
 
 GdNavigationServer::~GdNavigationServer() {
 	flush_queries();
+	agent_work_pool.finish();
 }
 
 void GdNavigationServer::add_command(SetCommand *command) const {
@@ -207,6 +209,21 @@ Vector<Vector3> GdNavigationServer::map_get_path(RID p_map, Vector3 p_origin, Ve
 	return map->get_path(p_origin, p_destination, p_optimize);
 }
 
+Array GdNavigationServer::map_get_paths(RID p_map, const Vector<Vector3> &p_origins, const Vector<Vector3> &p_destinations, bool p_optimize) const {
+	const NavMap *map = map_owner.getornull(p_map);
+	ERR_FAIL_COND_V(map == nullptr, Array());
+	ERR_FAIL_COND_V(p_origins.size() != p_destinations.size(), Array());
+
+	Vector<Vector<Vector3>> paths = map->get_paths(p_origins, p_destinations, p_optimize);
+
+	Array ret;
+	ret.resize(paths.size());
+	for (int i = 0; i < paths.size(); i++) {
+		ret[i] = paths[i];
+	}
+	return ret;
+}
+
 Vector3 GdNavigationServer::map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	const NavMap *map = map_owner.getornull(p_map);
 	ERR_FAIL_COND_V(map == nullptr, Vector3());
@@ -492,7 +509,7 @@ void GdNavigationServer::process(real_t p_delta_time) {
 	MutexLock lock(operations_mutex);
 	for (int i(0); i < active_maps.size(); i++) {
 		active_maps[i]->sync();
-		active_maps[i]->step(p_delta_time);
+		active_maps[i]->step(p_delta_time, agent_work_pool);
 		active_maps[i]->dispatch_callbacks();
 	}
 }
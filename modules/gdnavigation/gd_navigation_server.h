@@ -33,6 +33,7 @@
 
 #include "core/templates/rid.h"
 #include "core/templates/rid_owner.h"
+#include "core/templates/thread_work_pool.h"
 #include "servers/navigation_server_3d.h"
 
 #include "nav_map.h"
@@ -71,6 +72,8 @@ class GdNavigationServer : public NavigationServer3D {
 	Mutex commands_mutex;
 	/// Mutex used to make any operation threadsafe.
 	Mutex operations_mutex;
+	/// Pool used to step the agents avoidance of the active maps.
+	ThreadWorkPool agent_work_pool;
 
 	std::vector<SetCommand *> commands;
 
@@ -101,6 +104,7 @@ public:
 	virtual real_t map_get_edge_connection_margin(RID p_map) const;
 
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize) const;
+	virtual Array map_get_paths(RID p_map, const Vector<Vector3> &p_origins, const Vector<Vector3> &p_destinations, bool p_optimize) const;
 
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const;
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const;
@@ -42,6 +42,43 @@
 
 #define USE_ENTRY_POINT
 
+// Search buffers kept around between path queries, one set per thread so
+// queries can run concurrently.
+struct PathQueryScratch {
+	std::vector<gd::NavigationPoly> navigation_polys;
+	/// Index in `navigation_polys` of each map polygon, -1 when not visited yet.
+	LocalVector<int> polygon_navigation_ids;
+	LocalVector<uint32_t> open_list;
+};
+
+static thread_local PathQueryScratch path_query_scratch;
+
+struct ClosestPolygonQuery {
+	Vector3 point;
+	const gd::Polygon *closest_polygon = nullptr;
+	Vector3 closest_point;
+	Vector3 closest_normal;
+	real_t closest_distance = 1e20;
+
+	_FORCE_INLINE_ bool operator()(void *p_data) {
+		const gd::Polygon *p = (const gd::Polygon *)p_data;
+
+		// For each point cast a face and check the distance to the point
+		for (size_t point_id = 2; point_id < p->points.size(); point_id++) {
+			const Face3 f(p->points[point_id - 2].pos, p->points[point_id - 1].pos, p->points[point_id].pos);
+			const Vector3 inters = f.get_closest_point_to(point);
+			const real_t d = inters.distance_to(point);
+			if (d < closest_distance) {
+				closest_polygon = p;
+				closest_point = inters;
+				closest_normal = f.get_plane().normal;
+				closest_distance = d;
+			}
+		}
+		return false;
+	}
+};
+
 void NavMap::set_up(Vector3 p_up) {
 	up = p_up;
 	regenerate_polygons = true;
@@ -70,38 +107,44 @@ gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
-Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize) const {
-	const gd::Polygon *begin_poly = nullptr;
-	const gd::Polygon *end_poly = nullptr;
-	Vector3 begin_point;
-	Vector3 end_point;
-	float begin_d = 1e20;
-	float end_d = 1e20;
+const gd::Polygon *NavMap::_get_closest_polygon(const Vector3 &p_point, Vector3 &r_closest_point, Vector3 *r_normal) const {
+	if (polygon_bvh.is_empty()) {
+		return nullptr;
+	}
 
-	// Find the initial poly and the end poly on this map.
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
+	ClosestPolygonQuery query;
+	query.point = p_point;
 
-		// For each point cast a face and check the distance between the origin/destination
-		for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
-			Face3 f(p.points[point_id - 2].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			Vector3 spoint = f.get_closest_point_to(p_origin);
-			float dpoint = spoint.distance_to(p_origin);
-			if (dpoint < begin_d) {
-				begin_d = dpoint;
-				begin_poly = &p;
-				begin_point = spoint;
-			}
+	// Grow the search box until the closest polygon found is inside it, at
+	// that point no polygon outside the box can be closer.
+	real_t radius = polygon_search_radius;
+	for (int i = 0; i < 32; i++) {
+		const AABB search_aabb(p_point - Vector3(radius, radius, radius), Vector3(radius, radius, radius) * 2.0);
+		polygon_bvh.aabb_query(search_aabb, query);
 
-			spoint = f.get_closest_point_to(p_destination);
-			dpoint = spoint.distance_to(p_destination);
-			if (dpoint < end_d) {
-				end_d = dpoint;
-				end_poly = &p;
-				end_point = spoint;
-			}
+		if (query.closest_polygon && query.closest_distance <= radius) {
+			break;
 		}
+		if (search_aabb.encloses(polygons_aabb)) {
+			break;
+		}
+		radius *= 4.0;
+	}
+
+	r_closest_point = query.closest_point;
+	if (r_normal) {
+		*r_normal = query.closest_normal;
 	}
+	return query.closest_polygon;
+}
+
+Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize) const {
+	// Find the initial poly and the end poly on this map.
+	Vector3 begin_point;
+	Vector3 end_point;
+	const gd::Polygon *begin_poly = _get_closest_polygon(p_origin, begin_point);
+	const gd::Polygon *end_poly = _get_closest_polygon(p_destination, end_point);
+	float end_d = 1e20;
 
 	if (!begin_poly || !end_poly) {
 		// No path
@@ -116,15 +159,23 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		return path;
 	}
 
-	std::vector<gd::NavigationPoly> navigation_polys;
-	navigation_polys.reserve(polygons.size() * 0.75);
+	PathQueryScratch &scratch = path_query_scratch;
+	std::vector<gd::NavigationPoly> &navigation_polys = scratch.navigation_polys;
+	LocalVector<int> &polygon_navigation_ids = scratch.polygon_navigation_ids;
+	LocalVector<uint32_t> &open_list = scratch.open_list;
+
+	navigation_polys.clear();
+	open_list.clear();
+	for (uint32_t i = polygon_navigation_ids.size(); i < polygons.size(); i++) {
+		polygon_navigation_ids.push_back(-1);
+	}
 
 	// The elements indices in the `navigation_polys`.
 	int least_cost_id(-1);
-	List<uint32_t> open_list;
 	bool found_route = false;
 
 	navigation_polys.push_back(gd::NavigationPoly(begin_poly));
+	polygon_navigation_ids[begin_poly - polygons.data()] = 0;
 	{
 		least_cost_id = 0;
 		gd::NavigationPoly *least_cost_poly = &navigation_polys[least_cost_id];
@@ -161,12 +212,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 				const float new_distance = least_cost_poly->poly->center.distance_to(edge.other_polygon->center) + least_cost_poly->traveled_distance;
 #endif
 
-				auto it = std::find(
-						navigation_polys.begin(),
-						navigation_polys.end(),
-						gd::NavigationPoly(edge.other_polygon));
+				const int other_id = polygon_navigation_ids[edge.other_polygon - polygons.data()];
 
-				if (it != navigation_polys.end()) {
+				if (other_id != -1) {
+					gd::NavigationPoly *it = &navigation_polys[other_id];
 					// Oh this was visited already, can we win the cost?
 					if (it->traveled_distance > new_distance) {
 						it->prev_navigation_poly_id = least_cost_id;
@@ -183,6 +232,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 					gd::NavigationPoly *np = &navigation_polys[navigation_polys.size() - 1];
 
 					np->self_id = navigation_polys.size() - 1;
+					polygon_navigation_ids[edge.other_polygon - polygons.data()] = np->self_id;
 					np->prev_navigation_poly_id = least_cost_id;
 					np->back_navigation_edge = edge.other_edge;
 					np->traveled_distance = new_distance;
@@ -221,9 +271,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			}
 
 			// Reset open and navigation_polys
-			gd::NavigationPoly np = navigation_polys[0];
-			navigation_polys.clear();
-			navigation_polys.push_back(np);
+			for (size_t i = 1; i < navigation_polys.size(); i++) {
+				polygon_navigation_ids[navigation_polys[i].poly - polygons.data()] = -1;
+			}
+			navigation_polys.erase(navigation_polys.begin() + 1, navigation_polys.end());
 			open_list.clear();
 			open_list.push_back(0);
 
@@ -236,8 +287,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		least_cost_id = -1;
 		float least_cost = 1e30;
 
-		for (auto element = open_list.front(); element != nullptr; element = element->next()) {
-			gd::NavigationPoly *np = &navigation_polys[element->get()];
+		for (uint32_t i = 0; i < open_list.size(); i++) {
+			gd::NavigationPoly *np = &navigation_polys[open_list[i]];
 			float cost = np->traveled_distance;
 #ifdef USE_ENTRY_POINT
 			cost += np->entry.distance_to(end_point);
@@ -269,6 +320,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		}
 	}
 
+	// Leave the lookup clean for the next query.
+	for (size_t i = 0; i < navigation_polys.size(); i++) {
+		polygon_navigation_ids[navigation_polys[i].poly - polygons.data()] = -1;
+	}
+
 	if (found_route) {
 		Vector<Vector3> path;
 		if (p_optimize) {
@@ -383,6 +439,39 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	return Vector<Vector3>();
 }
 
+struct PathQueries {
+	const NavMap *map = nullptr;
+	const Vector3 *origins = nullptr;
+	const Vector3 *destinations = nullptr;
+	Vector<Vector3> *paths = nullptr;
+	bool optimize = false;
+
+	void query(uint32_t p_index, void *p_userdata) {
+		paths[p_index] = map->get_path(origins[p_index], destinations[p_index], optimize);
+	}
+};
+
+Vector<Vector<Vector3>> NavMap::get_paths(const Vector<Vector3> &p_origins, const Vector<Vector3> &p_destinations, bool p_optimize) const {
+	ERR_FAIL_COND_V(p_origins.size() != p_destinations.size(), Vector<Vector<Vector3>>());
+
+	Vector<Vector<Vector3>> paths;
+	paths.resize(p_origins.size());
+	if (paths.size() == 0) {
+		return paths;
+	}
+
+	PathQueries queries;
+	queries.map = this;
+	queries.origins = p_origins.ptr();
+	queries.destinations = p_destinations.ptr();
+	queries.paths = paths.ptrw();
+	queries.optimize = p_optimize;
+
+	thread_process_array(paths.size(), &queries, &PathQueries::query, (void *)nullptr);
+
+	return paths;
+}
+
 Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	bool use_collision = p_use_collision;
 	Vector3 closest_point;
@@ -434,82 +523,25 @@ Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector
 }
 
 Vector3 NavMap::get_closest_point(const Vector3 &p_point) const {
-	// TODO this is really not optimal, please redesign the API to directly return all this data
-
 	Vector3 closest_point;
-	real_t closest_point_d = 1e20;
-
-	// Find the initial poly and the end poly on this map.
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
-
-		// For each point cast a face and check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[point_id - 2].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t d = inters.distance_to(p_point);
-			if (d < closest_point_d) {
-				closest_point = inters;
-				closest_point_d = d;
-			}
-		}
-	}
-
+	_get_closest_polygon(p_point, closest_point);
 	return closest_point;
 }
 
 Vector3 NavMap::get_closest_point_normal(const Vector3 &p_point) const {
-	// TODO this is really not optimal, please redesign the API to directly return all this data
-
 	Vector3 closest_point;
 	Vector3 closest_point_normal;
-	real_t closest_point_d = 1e20;
-
-	// Find the initial poly and the end poly on this map.
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
-
-		// For each point cast a face and check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[point_id - 2].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t d = inters.distance_to(p_point);
-			if (d < closest_point_d) {
-				closest_point = inters;
-				closest_point_normal = f.get_plane().normal;
-				closest_point_d = d;
-			}
-		}
-	}
-
+	_get_closest_polygon(p_point, closest_point, &closest_point_normal);
 	return closest_point_normal;
 }
 
 RID NavMap::get_closest_point_owner(const Vector3 &p_point) const {
-	// TODO this is really not optimal, please redesign the API to directly return all this data
-
 	Vector3 closest_point;
-	RID closest_point_owner;
-	real_t closest_point_d = 1e20;
-
-	// Find the initial poly and the end poly on this map.
-	for (size_t i(0); i < polygons.size(); i++) {
-		const gd::Polygon &p = polygons[i];
-
-		// For each point cast a face and check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[point_id - 2].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t d = inters.distance_to(p_point);
-			if (d < closest_point_d) {
-				closest_point = inters;
-				closest_point_owner = p.owner->get_self();
-				closest_point_d = d;
-			}
-		}
+	const gd::Polygon *closest_polygon = _get_closest_polygon(p_point, closest_point);
+	if (!closest_polygon) {
+		return RID();
 	}
-
-	return closest_point_owner;
+	return closest_polygon->owner->get_self();
 }
 
 void NavMap::add_region(NavRegion *p_region) {
@@ -634,6 +666,32 @@ void NavMap::sync() {
 			}
 		}
 
+		// Index the polygons for the closest polygon queries.
+		polygon_bvh.clear();
+		polygons_aabb = AABB();
+		real_t extent_sum = 0.0;
+		for (size_t poly_id(0); poly_id < polygons.size(); poly_id++) {
+			const gd::Polygon &poly(polygons[poly_id]);
+			if (poly.points.size() == 0) {
+				continue;
+			}
+
+			AABB poly_aabb(poly.points[0].pos, Vector3());
+			for (size_t p(1); p < poly.points.size(); p++) {
+				poly_aabb.expand_to(poly.points[p].pos);
+			}
+			polygon_bvh.insert(poly_aabb, &polygons[poly_id]);
+
+			if (poly_id == 0) {
+				polygons_aabb = poly_aabb;
+			} else {
+				polygons_aabb.merge_with(poly_aabb);
+			}
+			extent_sum += poly_aabb.get_longest_axis_size();
+		}
+		polygon_bvh.optimize_top_down();
+		polygon_search_radius = polygons.size() ? MAX(cell_size, extent_sum / polygons.size()) : cell_size;
+
 		// Takes all the free edges.
 		std::vector<gd::FreeEdge> free_edges;
 		free_edges.reserve(connections.size());
@@ -724,19 +782,28 @@ void NavMap::sync() {
 	agents_dirty = false;
 }
 
-void NavMap::compute_single_step(uint32_t index, RvoAgent **agent) {
-	(*(agent + index))->get_agent()->computeNeighbors(&rvo);
-	(*(agent + index))->get_agent()->computeNewVelocity(deltatime);
+// Number of agents stepped by a single job. Each agent is cheap to step, so
+// batching keeps the per-job scheduling overhead small compared to the work.
+#define AGENT_STEP_BATCH_SIZE 64
+
+void NavMap::compute_agent_batch(uint32_t p_batch, void *p_userdata) {
+	const uint32_t from = p_batch * AGENT_STEP_BATCH_SIZE;
+	const uint32_t to = MIN(from + AGENT_STEP_BATCH_SIZE, (uint32_t)controlled_agents.size());
+	for (uint32_t i = from; i < to; i++) {
+		RVO::Agent *agent = controlled_agents[i]->get_agent();
+		agent->computeNeighbors(&rvo);
+		agent->computeNewVelocity(deltatime);
+	}
 }
 
-void NavMap::step(real_t p_deltatime) {
+void NavMap::step(real_t p_deltatime, ThreadWorkPool &p_work_pool) {
 	deltatime = p_deltatime;
 	if (controlled_agents.size() > 0) {
-		thread_process_array(
-				controlled_agents.size(),
-				this,
-				&NavMap::compute_single_step,
-				controlled_agents.data());
+		// The agents only read the KdTree and the other agents' current state, and write
+		// their own new velocity, so they can be stepped in parallel. The callbacks are
+		// dispatched afterwards from the calling thread.
+		const uint32_t batch_count = (controlled_agents.size() + AGENT_STEP_BATCH_SIZE - 1) / AGENT_STEP_BATCH_SIZE;
+		p_work_pool.do_work(batch_count, this, &NavMap::compute_agent_batch, nullptr);
 	}
 }
 
@@ -33,7 +33,9 @@
 
 #include "nav_rid.h"
 
+#include "core/math/dynamic_bvh.h"
 #include "core/math/math_defs.h"
+#include "core/templates/thread_work_pool.h"
 #include "nav_utils.h"
 #include <KdTree.h>
 
@@ -64,6 +66,12 @@ class NavMap : public NavRid {
 	/// Map polygons
 	std::vector<gd::Polygon> polygons;
 
+	/// Spatial index of the map polygons, used to find the closest polygon
+	/// to a point. Queries don't modify the tree.
+	mutable DynamicBVH polygon_bvh;
+	AABB polygons_aabb;
+	real_t polygon_search_radius = 1.0;
+
 	/// Rvo world
 	RVO::KdTree rvo;
 
@@ -103,6 +111,7 @@ public:
 	gd::PointKey get_point_key(const Vector3 &p_pos) const;
 
 	Vector<Vector3> get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize) const;
+	Vector<Vector<Vector3>> get_paths(const Vector<Vector3> &p_origins, const Vector<Vector3> &p_destinations, bool p_optimize) const;
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
 	Vector3 get_closest_point_normal(const Vector3 &p_point) const;
@@ -129,11 +138,12 @@ public:
 	}
 
 	void sync();
-	void step(real_t p_deltatime);
+	void step(real_t p_deltatime, ThreadWorkPool &p_work_pool);
 	void dispatch_callbacks();
 
 private:
-	void compute_single_step(uint32_t index, RvoAgent **agent);
+	const gd::Polygon *_get_closest_polygon(const Vector3 &p_point, Vector3 &r_closest_point, Vector3 *r_normal = nullptr) const;
+	void compute_agent_batch(uint32_t p_batch, void *p_userdata);
 	void clip_path(const std::vector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly) const;
 };
 
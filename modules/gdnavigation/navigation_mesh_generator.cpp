@@ -34,6 +34,7 @@
 
 #include "core/math/quick_hull.h"
 #include "core/os/thread.h"
+#include "core/templates/thread_work_pool.h"
 #include "scene/3d/collision_shape_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/physics_body_3d.h"
@@ -300,6 +301,330 @@ void NavigationMeshGenerator::_convert_detail_mesh_to_native_navigation_mesh(con
 	}
 }
 
+void NavigationMeshGenerator::_setup_recast_config(const Ref<NavigationMesh> &p_nav_mesh, rcConfig &r_cfg) {
+	r_cfg.cs = p_nav_mesh->get_cell_size();
+	r_cfg.ch = p_nav_mesh->get_cell_height();
+	r_cfg.walkableSlopeAngle = p_nav_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_nav_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_nav_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_nav_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_nav_mesh->get_edge_max_length() / p_nav_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_nav_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_nav_mesh->get_region_min_size() * p_nav_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_nav_mesh->get_region_merge_size() * p_nav_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_nav_mesh->get_verts_per_poly();
+	r_cfg.detailSampleDist = p_nav_mesh->get_detail_sample_distance() < 0.9f ? 0 : p_nav_mesh->get_cell_size() * p_nav_mesh->get_detail_sample_distance();
+	r_cfg.detailSampleMaxError = p_nav_mesh->get_cell_height() * p_nav_mesh->get_detail_sample_max_error();
+}
+
+uint32_t NavigationMeshGenerator::_hash_tile_triangles(const float *p_vertices, const LocalVector<int> &p_indices) {
+	uint32_t hash = hash_djb2_one_32(p_indices.size());
+	for (uint32_t i = 0; i < p_indices.size(); i++) {
+		const float *v = &p_vertices[p_indices[i] * 3];
+		hash = hash_djb2_one_float(v[0], hash);
+		hash = hash_djb2_one_float(v[1], hash);
+		hash = hash_djb2_one_float(v[2], hash);
+	}
+	return hash;
+}
+
+bool NavigationMeshGenerator::_build_recast_navigation_tile(const Ref<NavigationMesh> &p_nav_mesh, const rcConfig &p_base_cfg, const Vector2i &p_tile, const Vector<float> &p_vertices, const LocalVector<int> &p_indices, BakedTile &r_tile) {
+	struct RecastData {
+		rcHeightfield *hf = nullptr;
+		rcCompactHeightfield *chf = nullptr;
+		rcContourSet *cset = nullptr;
+		rcPolyMesh *poly_mesh = nullptr;
+		rcPolyMeshDetail *detail_mesh = nullptr;
+
+		~RecastData() {
+			rcFreeHeightField(hf);
+			rcFreeCompactHeightfield(chf);
+			rcFreeContourSet(cset);
+			rcFreePolyMesh(poly_mesh);
+			rcFreePolyMeshDetail(detail_mesh);
+		}
+	} rd;
+
+	rcContext ctx;
+
+	const float *verts = p_vertices.ptr();
+	const int nverts = p_vertices.size() / 3;
+	const int *tris = p_indices.ptr();
+	const int ntris = p_indices.size() / 3;
+
+	rcConfig cfg = p_base_cfg;
+
+	// Tiles are laid out from the origin, so a tile keeps its bounds when
+	// geometry elsewhere changes. The border overlaps the neighboring tiles.
+	const float tile_width = cfg.tileSize * cfg.cs;
+	const float border = cfg.borderSize * cfg.cs;
+
+	cfg.bmin[0] = p_tile.x * tile_width - border;
+	cfg.bmin[2] = p_tile.y * tile_width - border;
+	cfg.bmax[0] = (p_tile.x + 1) * tile_width + border;
+	cfg.bmax[2] = (p_tile.y + 1) * tile_width + border;
+
+	// Only use the triangles touching the tile for the vertical bounds, so
+	// the result only depends on them.
+	cfg.bmin[1] = verts[tris[0] * 3 + 1];
+	cfg.bmax[1] = cfg.bmin[1];
+	for (int i = 1; i < ntris * 3; i++) {
+		const float y = verts[tris[i] * 3 + 1];
+		cfg.bmin[1] = MIN(cfg.bmin[1], y);
+		cfg.bmax[1] = MAX(cfg.bmax[1], y);
+	}
+
+	rd.hf = rcAllocHeightfield();
+	ERR_FAIL_COND_V(!rd.hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *rd.hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch), false);
+
+	{
+		LocalVector<unsigned char> tri_areas;
+		tri_areas.resize(ntris);
+		memset(tri_areas.ptr(), 0, ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptr());
+
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *rd.hf, cfg.walkableClimb), false);
+	}
+
+	if (p_nav_mesh->get_filter_low_hanging_obstacles()) {
+		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *rd.hf);
+	}
+	if (p_nav_mesh->get_filter_ledge_spans()) {
+		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *rd.hf);
+	}
+	if (p_nav_mesh->get_filter_walkable_low_height_spans()) {
+		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *rd.hf);
+	}
+
+	rd.chf = rcAllocCompactHeightfield();
+	ERR_FAIL_COND_V(!rd.chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *rd.hf, *rd.chf), false);
+
+	rcFreeHeightField(rd.hf);
+	rd.hf = nullptr;
+
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *rd.chf), false);
+
+	if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *rd.chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *rd.chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
+	} else if (p_nav_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *rd.chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
+	} else {
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *rd.chf, cfg.borderSize, cfg.minRegionArea), false);
+	}
+
+	rd.cset = rcAllocContourSet();
+	ERR_FAIL_COND_V(!rd.cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *rd.chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *rd.cset), false);
+
+	if (rd.cset->nconts == 0) {
+		// Nothing walkable in this tile.
+		return true;
+	}
+
+	rd.poly_mesh = rcAllocPolyMesh();
+	ERR_FAIL_COND_V(!rd.poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *rd.cset, cfg.maxVertsPerPoly, *rd.poly_mesh), false);
+
+	rd.detail_mesh = rcAllocPolyMeshDetail();
+	ERR_FAIL_COND_V(!rd.detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *rd.poly_mesh, *rd.chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *rd.detail_mesh), false);
+
+	const rcPolyMeshDetail *detail_mesh = rd.detail_mesh;
+
+	r_tile.vertices.resize(detail_mesh->nverts);
+	for (int i = 0; i < detail_mesh->nverts; i++) {
+		const float *v = &detail_mesh->verts[i * 3];
+		r_tile.vertices.write[i] = Vector3(v[0], v[1], v[2]);
+	}
+
+	for (int i = 0; i < detail_mesh->nmeshes; i++) {
+		const unsigned int *m = &detail_mesh->meshes[i * 4];
+		const unsigned int bverts = m[0];
+		const unsigned int btris = m[2];
+		const unsigned int ntris_detail = m[3];
+		const unsigned char *tris_detail = &detail_mesh->tris[btris * 4];
+		for (unsigned int j = 0; j < ntris_detail; j++) {
+			Vector<int> nav_indices;
+			nav_indices.resize(3);
+			// Polygon order in recast is opposite than godot's
+			nav_indices.write[0] = ((int)(bverts + tris_detail[j * 4 + 0]));
+			nav_indices.write[1] = ((int)(bverts + tris_detail[j * 4 + 2]));
+			nav_indices.write[2] = ((int)(bverts + tris_detail[j * 4 + 1]));
+			r_tile.polygons.push_back(nav_indices);
+		}
+	}
+
+	return true;
+}
+
+void NavigationMeshGenerator::TileBakeJobs::bake_tile(uint32_t p_index, void *p_userdata) {
+	if (_build_recast_navigation_tile(nav_mesh, *config, tiles[p_index], *vertices, *tile_indices[p_index], results[p_index])) {
+		results[p_index].hash = hashes[p_index];
+	}
+}
+
+void NavigationMeshGenerator::_build_recast_navigation_mesh_tiled(
+		Ref<NavigationMesh> p_nav_mesh,
+#ifdef TOOLS_ENABLED
+		EditorProgress *ep,
+#endif
+		const Vector<float> &p_vertices,
+		const Vector<int> &p_indices) {
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Setting up Configuration..."), 1);
+	}
+#endif
+
+	rcConfig cfg;
+	memset(&cfg, 0, sizeof(cfg));
+	_setup_recast_config(p_nav_mesh, cfg);
+	cfg.tileSize = p_nav_mesh->get_tile_size();
+	cfg.borderSize = cfg.walkableRadius + 3;
+	cfg.width = cfg.tileSize + cfg.borderSize * 2;
+	cfg.height = cfg.width;
+
+	uint32_t config_hash = hash_djb2_buffer((const uint8_t *)&cfg, sizeof(cfg));
+	config_hash = hash_djb2_one_32(p_nav_mesh->get_sample_partition_type(), config_hash);
+	config_hash = hash_djb2_one_32(p_nav_mesh->get_filter_low_hanging_obstacles(), config_hash);
+	config_hash = hash_djb2_one_32(p_nav_mesh->get_filter_ledge_spans(), config_hash);
+	config_hash = hash_djb2_one_32(p_nav_mesh->get_filter_walkable_low_height_spans(), config_hash);
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Splitting geometry into tiles..."), 2);
+	}
+#endif
+
+	const float tile_width = cfg.tileSize * cfg.cs;
+	const float border = cfg.borderSize * cfg.cs;
+
+	const float *verts = p_vertices.ptr();
+	const int *tris = p_indices.ptr();
+	const int ntris = p_indices.size() / 3;
+
+	Map<Vector2i, LocalVector<int>> tile_triangles;
+
+	for (int i = 0; i < ntris; i++) {
+		const int *t = &tris[i * 3];
+		float min_x = verts[t[0] * 3 + 0];
+		float max_x = min_x;
+		float min_z = verts[t[0] * 3 + 2];
+		float max_z = min_z;
+		for (int j = 1; j < 3; j++) {
+			min_x = MIN(min_x, verts[t[j] * 3 + 0]);
+			max_x = MAX(max_x, verts[t[j] * 3 + 0]);
+			min_z = MIN(min_z, verts[t[j] * 3 + 2]);
+			max_z = MAX(max_z, verts[t[j] * 3 + 2]);
+		}
+
+		const int from_x = (int)Math::floor((min_x - border) / tile_width);
+		const int to_x = (int)Math::floor((max_x + border) / tile_width);
+		const int from_z = (int)Math::floor((min_z - border) / tile_width);
+		const int to_z = (int)Math::floor((max_z + border) / tile_width);
+
+		for (int z = from_z; z <= to_z; z++) {
+			for (int x = from_x; x <= to_x; x++) {
+				LocalVector<int> &indices = tile_triangles[Vector2i(x, z)];
+				indices.push_back(t[0]);
+				indices.push_back(t[1]);
+				indices.push_back(t[2]);
+			}
+		}
+	}
+
+	TileCache cache;
+	{
+		MutexLock lock(tile_cache_mutex);
+
+		// Forget about navigation meshes that no longer exist.
+		Map<ObjectID, TileCache>::Element *E = tile_cache.front();
+		while (E) {
+			Map<ObjectID, TileCache>::Element *N = E->next();
+			if (!ObjectDB::get_instance(E->key())) {
+				tile_cache.erase(E);
+			}
+			E = N;
+		}
+
+		E = tile_cache.find(p_nav_mesh->get_instance_id());
+		if (E && E->get().config_hash == config_hash) {
+			cache = E->get();
+		}
+	}
+
+	TileCache new_cache;
+	new_cache.config_hash = config_hash;
+
+	TileBakeJobs jobs;
+	jobs.nav_mesh = p_nav_mesh;
+	jobs.config = &cfg;
+	jobs.vertices = &p_vertices;
+
+	for (Map<Vector2i, LocalVector<int>>::Element *E = tile_triangles.front(); E; E = E->next()) {
+		uint32_t hash = _hash_tile_triangles(verts, E->get());
+		Map<Vector2i, BakedTile>::Element *C = cache.tiles.find(E->key());
+		if (C && C->get().hash == hash) {
+			new_cache.tiles[E->key()] = C->get();
+			continue;
+		}
+		jobs.tiles.push_back(E->key());
+		jobs.tile_indices.push_back(&E->get());
+		jobs.hashes.push_back(hash);
+	}
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(vformat(TTR("Baking %d of %d tiles..."), jobs.tiles.size(), tile_triangles.size()), 3);
+	}
+#endif
+
+	jobs.results.resize(jobs.tiles.size());
+
+	if (jobs.tiles.size() > 1) {
+		ThreadWorkPool work_pool;
+		work_pool.init();
+		work_pool.do_work(jobs.tiles.size(), &jobs, &TileBakeJobs::bake_tile, nullptr);
+		work_pool.finish();
+	} else if (jobs.tiles.size() == 1) {
+		jobs.bake_tile(0, nullptr);
+	}
+
+	for (uint32_t i = 0; i < jobs.tiles.size(); i++) {
+		new_cache.tiles[jobs.tiles[i]] = jobs.results[i];
+	}
+
+#ifdef TOOLS_ENABLED
+	if (ep) {
+		ep->step(TTR("Converting to native navigation mesh..."), 10);
+	}
+#endif
+
+	Vector<Vector3> nav_vertices;
+
+	for (Map<Vector2i, BakedTile>::Element *E = new_cache.tiles.front(); E; E = E->next()) {
+		const BakedTile &tile = E->get();
+		const int offset = nav_vertices.size();
+
+		nav_vertices.append_array(tile.vertices);
+		for (int i = 0; i < tile.polygons.size(); i++) {
+			Vector<int> polygon = tile.polygons[i];
+			for (int j = 0; j < polygon.size(); j++) {
+				polygon.write[j] += offset;
+			}
+			p_nav_mesh->add_polygon(polygon);
+		}
+	}
+
+	p_nav_mesh->set_vertices(nav_vertices);
+
+	MutexLock lock(tile_cache_mutex);
+	tile_cache[p_nav_mesh->get_instance_id()] = new_cache;
+}
+
 void NavigationMeshGenerator::_build_recast_navigation_mesh(
 		Ref<NavigationMesh> p_nav_mesh,
 #ifdef TOOLS_ENABLED
@@ -330,20 +655,7 @@ void NavigationMeshGenerator::_build_recast_navigation_mesh(
 
 	rcConfig cfg;
 	memset(&cfg, 0, sizeof(cfg));
-
-	cfg.cs = p_nav_mesh->get_cell_size();
-	cfg.ch = p_nav_mesh->get_cell_height();
-	cfg.walkableSlopeAngle = p_nav_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_nav_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_nav_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_nav_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_nav_mesh->get_edge_max_length() / p_nav_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_nav_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_nav_mesh->get_region_min_size() * p_nav_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_nav_mesh->get_region_merge_size() * p_nav_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_nav_mesh->get_verts_per_poly();
-	cfg.detailSampleDist = p_nav_mesh->get_detail_sample_distance() < 0.9f ? 0 : p_nav_mesh->get_cell_size() * p_nav_mesh->get_detail_sample_distance();
-	cfg.detailSampleMaxError = p_nav_mesh->get_cell_height() * p_nav_mesh->get_detail_sample_max_error();
+	_setup_recast_config(p_nav_mesh, cfg);
 
 	cfg.bmin[0] = bmin[0];
 	cfg.bmin[1] = bmin[1];
@@ -521,7 +833,15 @@ void NavigationMeshGenerator::bake(Ref<NavigationMesh> p_nav_mesh, Node *p_node)
 		_parse_geometry(navmesh_xform, E->get(), vertices, indices, geometry_type, collision_mask, recurse_children);
 	}
 
-	if (vertices.size() > 0 && indices.size() > 0) {
+	if (vertices.size() > 0 && indices.size() > 0 && p_nav_mesh->get_tile_size() > 0) {
+		_build_recast_navigation_mesh_tiled(
+				p_nav_mesh,
+#ifdef TOOLS_ENABLED
+				ep,
+#endif
+				vertices,
+				indices);
+	} else if (vertices.size() > 0 && indices.size() > 0) {
 		rcHeightfield *hf = nullptr;
 		rcCompactHeightfield *chf = nullptr;
 		rcContourSet *cset = nullptr;
@@ -33,6 +33,9 @@
 
 #ifndef _3D_DISABLED
 
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/map.h"
 #include "scene/3d/navigation_region_3d.h"
 
 #include <Recast.h>
@@ -46,6 +49,34 @@ class NavigationMeshGenerator : public Object {
 
 	static NavigationMeshGenerator *singleton;
 
+	struct BakedTile {
+		uint32_t hash = 0;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	struct TileCache {
+		uint32_t config_hash = 0;
+		Map<Vector2i, BakedTile> tiles;
+	};
+
+	struct TileBakeJobs {
+		Ref<NavigationMesh> nav_mesh;
+		const rcConfig *config = nullptr;
+		const Vector<float> *vertices = nullptr;
+		LocalVector<Vector2i> tiles;
+		LocalVector<const LocalVector<int> *> tile_indices;
+		LocalVector<uint32_t> hashes;
+		LocalVector<BakedTile> results;
+
+		void bake_tile(uint32_t p_index, void *p_userdata);
+	};
+
+	// Results of the last tiled bake of each navigation mesh, so only tiles
+	// with changed source geometry are baked again.
+	Mutex tile_cache_mutex;
+	Map<ObjectID, TileCache> tile_cache;
+
 protected:
 	static void _bind_methods();
 
@@ -54,6 +85,17 @@ protected:
 	static void _add_faces(const PackedVector3Array &p_faces, const Transform &p_xform, Vector<float> &p_verticies, Vector<int> &p_indices);
 	static void _parse_geometry(Transform p_accumulated_transform, Node *p_node, Vector<float> &p_verticies, Vector<int> &p_indices, int p_generate_from, uint32_t p_collision_mask, bool p_recurse_children);
 
+	static void _setup_recast_config(const Ref<NavigationMesh> &p_nav_mesh, rcConfig &r_cfg);
+	static uint32_t _hash_tile_triangles(const float *p_vertices, const LocalVector<int> &p_indices);
+	static bool _build_recast_navigation_tile(const Ref<NavigationMesh> &p_nav_mesh, const rcConfig &p_base_cfg, const Vector2i &p_tile, const Vector<float> &p_vertices, const LocalVector<int> &p_indices, BakedTile &r_tile);
+	void _build_recast_navigation_mesh_tiled(
+			Ref<NavigationMesh> p_nav_mesh,
+#ifdef TOOLS_ENABLED
+			EditorProgress *ep,
+#endif
+			const Vector<float> &p_vertices,
+			const Vector<int> &p_indices);
+
 	static void _convert_detail_mesh_to_native_navigation_mesh(const rcPolyMeshDetail *p_detail_mesh, Ref<NavigationMesh> p_nav_mesh);
 	static void _build_recast_navigation_mesh(
 			Ref<NavigationMesh> p_nav_mesh,
@@ -1003,6 +1003,7 @@ void GDScriptAnalyzer::resolve_for(GDScriptParser::ForNode *p_for) {
 			GDScriptParser::IdentifierNode *callee = static_cast<GDScriptParser::IdentifierNode *>(call->callee);
 			if (callee->name == "range") {
 				list_resolved = true;
+				bool all_is_numeric = false;
 				if (call->arguments.size() < 1) {
 					push_error(R"*(Invalid call for "range()" function. Expected at least 1 argument, none given.)*", call->callee);
 				} else if (call->arguments.size() > 3) {
@@ -1010,6 +1011,7 @@ void GDScriptAnalyzer::resolve_for(GDScriptParser::ForNode *p_for) {
 				} else {
 					// Now we can optimize it.
 					bool all_is_constant = true;
+					all_is_numeric = true;
 					Vector<Variant> args;
 					args.resize(call->arguments.size());
 					for (int i = 0; i < call->arguments.size(); i++) {
@@ -1022,6 +1024,9 @@ void GDScriptAnalyzer::resolve_for(GDScriptParser::ForNode *p_for) {
 						}
 
 						GDScriptParser::DataType arg_type = call->arguments[i]->get_datatype();
+						if (!arg_type.is_hard_type() || arg_type.kind != GDScriptParser::DataType::BUILTIN || (arg_type.builtin_type != Variant::INT && arg_type.builtin_type != Variant::FLOAT)) {
+							all_is_numeric = false;
+						}
 						if (!arg_type.is_variant()) {
 							if (arg_type.kind != GDScriptParser::DataType::BUILTIN) {
 								all_is_constant = false;
@@ -1059,6 +1064,25 @@ void GDScriptAnalyzer::resolve_for(GDScriptParser::ForNode *p_for) {
 					list_type.type_source = GDScriptParser::DataType::ANNOTATED_EXPLICIT;
 					list_type.kind = GDScriptParser::DataType::BUILTIN;
 					list_type.builtin_type = Variant::ARRAY;
+					if (all_is_numeric) {
+						// Arguments are only known at runtime, but the compiler can still build int, Vector2i
+						// or Vector3i bounds from them instead of calling range().
+						switch (call->arguments.size()) {
+							case 1:
+								list_type.builtin_type = Variant::INT;
+								break;
+							case 2:
+								list_type.builtin_type = Variant::VECTOR2I;
+								break;
+							case 3:
+								// A zero step is an error in range(), but would make the bounds iterate zero times.
+								// Only use them when the step is known not to be zero.
+								if (call->arguments[2]->is_constant && int(call->arguments[2]->reduced_value) != 0) {
+									list_type.builtin_type = Variant::VECTOR3I;
+								}
+								break;
+						}
+					}
 					p_for->list->set_datatype(list_type);
 				}
 			}
@@ -1069,8 +1093,20 @@ void GDScriptAnalyzer::resolve_for(GDScriptParser::ForNode *p_for) {
 		resolve_node(p_for->list);
 	}
 
+	// Iterating over an int, Vector2i or Vector3i (which is what range() is turned into) always gives ints,
+	// so the iterator is typed and the operations using it can be specialized.
+	GDScriptParser::DataType list_type = p_for->list->get_datatype();
+	if (p_for->variable && list_type.is_hard_type() && list_type.kind == GDScriptParser::DataType::BUILTIN) {
+		if (list_type.builtin_type == Variant::INT || list_type.builtin_type == Variant::VECTOR2I || list_type.builtin_type == Variant::VECTOR3I) {
+			GDScriptParser::DataType iterator_type;
+			iterator_type.type_source = GDScriptParser::DataType::ANNOTATED_INFERRED;
+			iterator_type.kind = GDScriptParser::DataType::BUILTIN;
+			iterator_type.builtin_type = Variant::INT;
+			p_for->variable->set_datatype(iterator_type);
+		}
+	}
+
 	// TODO: If list is a typed array, the variable should be an element.
-	// Also applicable for constant range() (so variable is int or float).
 
 	resolve_suite(p_for->loop);
 	p_for->set_datatype(p_for->loop->get_datatype());
@@ -3403,7 +3439,54 @@ Ref<GDScriptParserRef> GDScriptAnalyzer::get_parser_for(const String &p_path) {
 	return ref;
 }
 
+static void _add_global_class_dependency(const StringName &p_name, Set<String> &r_paths) {
+	if (!ScriptServer::is_global_class(p_name)) {
+		return;
+	}
+	String path = ScriptServer::get_global_class_path(p_name);
+	if (path.get_extension() == "gd") {
+		r_paths.insert(path);
+	}
+}
+
+static void _get_class_dependency_paths(const GDScriptParser::ClassNode *p_class, Set<String> &r_paths) {
+	if (!p_class->extends_path.is_empty()) {
+		if (p_class->extends_path.get_extension() == "gd") {
+			r_paths.insert(p_class->extends_path);
+		}
+	} else if (!p_class->extends.is_empty()) {
+		_add_global_class_dependency(p_class->extends[0], r_paths);
+	}
+
+	for (int i = 0; i < p_class->members.size(); i++) {
+		if (p_class->members[i].type == GDScriptParser::ClassNode::Member::CLASS) {
+			_get_class_dependency_paths(p_class->members[i].m_class, r_paths);
+		}
+	}
+}
+
+void GDScriptAnalyzer::get_dependency_paths(const GDScriptParser *p_parser, Set<String> &r_paths) {
+	// Only what can be known from the tree alone: explicit base paths and global class names
+	// used as base or in type hints. Anything else is still loaded on demand by the analyzer.
+	if (p_parser->head == nullptr) {
+		return;
+	}
+	_get_class_dependency_paths(p_parser->head, r_paths);
+	for (const Set<StringName>::Element *E = p_parser->referenced_types.front(); E; E = E->next()) {
+		_add_global_class_dependency(E->get(), r_paths);
+	}
+	r_paths.erase(p_parser->script_path);
+}
+
+void GDScriptAnalyzer::prefetch_dependencies() {
+	if (!prefetched_parsers.is_empty() || parser->for_completion || parser->script_path.is_empty()) {
+		return;
+	}
+	GDScriptCache::prefetch_parsers(parser, prefetched_parsers);
+}
+
 Error GDScriptAnalyzer::resolve_inheritance() {
+	prefetch_dependencies();
 	return resolve_inheritance(parser->head);
 }
 
@@ -3434,6 +3517,7 @@ Error GDScriptAnalyzer::resolve_program() {
 
 Error GDScriptAnalyzer::analyze() {
 	parser->errors.clear();
+	prefetch_dependencies();
 	Error err = resolve_inheritance(parser->head);
 	if (err) {
 		return err;
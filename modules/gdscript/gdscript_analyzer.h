@@ -40,6 +40,7 @@
 class GDScriptAnalyzer {
 	GDScriptParser *parser = nullptr;
 	HashMap<String, Ref<GDScriptParserRef>> depended_parsers;
+	Vector<Ref<GDScriptParserRef>> prefetched_parsers;
 
 	const GDScriptParser::EnumNode *current_enum = nullptr;
 
@@ -108,6 +109,7 @@ class GDScriptAnalyzer {
 	void mark_node_unsafe(const GDScriptParser::Node *p_node);
 	bool class_exists(const StringName &p_class);
 	Ref<GDScriptParserRef> get_parser_for(const String &p_path);
+	void prefetch_dependencies();
 #ifdef DEBUG_ENABLED
 	bool is_shadowing(GDScriptParser::IdentifierNode *p_local, const String &p_context);
 #endif
@@ -118,6 +120,8 @@ public:
 	Error resolve_body();
 	Error analyze();
 
+	static void get_dependency_paths(const GDScriptParser *p_parser, Set<String> &r_paths);
+
 	GDScriptAnalyzer(GDScriptParser *p_parser);
 
 	static void cleanup();
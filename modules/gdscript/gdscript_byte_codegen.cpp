@@ -319,6 +319,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_methods_count = 0;
 	}
 
+	if (member_cache_count) {
+		function->_member_caches_ptr = memnew_arr(GDScriptFunction::MemberCache, member_cache_count);
+		function->_member_caches_count = member_cache_count;
+	} else {
+		function->_member_caches_ptr = nullptr;
+		function->_member_caches_count = 0;
+	}
+
 	if (debug_stack) {
 		function->stack_debug = stack_debug;
 	}
@@ -367,7 +375,121 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	append(p_operator);
 }
 
+static GDScriptFunction::Opcode _get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_type) {
+	if (p_type == Variant::INT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_INT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_INT;
+			case Variant::OP_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_EQUAL_INT;
+			case Variant::OP_NOT_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_INT;
+			case Variant::OP_LESS:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_INT;
+			case Variant::OP_LESS_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_INT;
+			case Variant::OP_GREATER:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_INT;
+			case Variant::OP_GREATER_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_INT;
+			default:
+				break; // Division and modulo need to check for zero, use the validated evaluator.
+		}
+	} else if (p_type == Variant::FLOAT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_FLOAT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_FLOAT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_FLOAT;
+			case Variant::OP_DIVIDE:
+				return GDScriptFunction::OPCODE_OPERATOR_DIVIDE_FLOAT;
+			case Variant::OP_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_EQUAL_FLOAT;
+			case Variant::OP_NOT_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_FLOAT;
+			case Variant::OP_LESS:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT;
+			case Variant::OP_LESS_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_FLOAT;
+			case Variant::OP_GREATER:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_FLOAT;
+			case Variant::OP_GREATER_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_FLOAT;
+			default:
+				break;
+		}
+	}
+	return GDScriptFunction::OPCODE_END;
+}
+
+static GDScriptFunction::Opcode _get_fused_jump_opcode(int p_comparison_opcode) {
+	switch (p_comparison_opcode) {
+		case GDScriptFunction::OPCODE_OPERATOR_EQUAL_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_EQUAL_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_LESS_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_LESS_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_GREATER_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_GREATER_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_INT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT;
+		case GDScriptFunction::OPCODE_OPERATOR_EQUAL_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_EQUAL_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_LESS_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_GREATER_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_GREATER_FLOAT;
+		case GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_FLOAT:
+			return GDScriptFunction::OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT;
+		default:
+			return GDScriptFunction::OPCODE_END;
+	}
+}
+
+void GDScriptByteCodeGenerator::append_jump_if_not(const Address &p_condition) {
+	// If the condition was just computed by a typed comparison, jump on the comparison directly instead of storing it first.
+	// The caller appends the jump target in both cases.
+	if (p_condition.mode == Address::TEMPORARY && last_typed_comparison >= 0 && last_typed_comparison + 4 == opcodes.size() && opcodes[last_typed_comparison + 3] == address_of(p_condition)) {
+		GDScriptFunction::Opcode fused_opcode = _get_fused_jump_opcode(opcodes[last_typed_comparison] & GDScriptFunction::INSTR_MASK);
+		opcodes.write[last_typed_comparison] = (fused_opcode & GDScriptFunction::INSTR_MASK) | (2 << GDScriptFunction::INSTR_BITS);
+		opcodes.resize(opcodes.size() - 1); // Remove the target of the comparison.
+		last_typed_comparison = -1;
+		return;
+	}
+
+	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
+	append(p_condition);
+}
+
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
+	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand) && p_left_operand.type.builtin_type == p_right_operand.type.builtin_type) {
+		// Common numeric operators are evaluated in place, without calling into Variant.
+		GDScriptFunction::Opcode typed_opcode = _get_typed_operator_opcode(p_operator, p_left_operand.type.builtin_type);
+		if (typed_opcode != GDScriptFunction::OPCODE_END) {
+			if (p_target.mode == Address::TEMPORARY && _get_fused_jump_opcode(typed_opcode) != GDScriptFunction::OPCODE_END) {
+				last_typed_comparison = opcodes.size();
+			}
+			append(typed_opcode, 3);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			return;
+		}
+	}
+
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand)) {
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
@@ -403,15 +525,13 @@ void GDScriptByteCodeGenerator::write_type_test_builtin(const Address &p_target,
 }
 
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_left_operand);
+	append_jump_if_not(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_right_operand);
+	append_jump_if_not(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -467,8 +587,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -580,6 +699,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append(get_member_cache_pos(p_source, p_name));
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -705,6 +825,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(get_member_cache_pos(p_base, p_function_name));
 }
 
 void GDScriptByteCodeGenerator::write_super_call(const Address &p_target, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -726,6 +847,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(get_member_cache_pos(p_base, p_function_name));
 }
 
 void GDScriptByteCodeGenerator::write_call_gdscript_utility(const Address &p_target, GDScriptUtilityFunctions::FunctionPtr p_function, const Vector<Address> &p_arguments) {
@@ -897,6 +1019,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(-1); // No inline cache, self always has a script instance.
 }
 
 void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -908,6 +1031,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(-1); // No inline cache, self always has a script instance.
 }
 
 void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_target, const Address &p_base, const StringName &p_function_name, const Vector<Address> &p_arguments) {
@@ -919,6 +1043,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(p_target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(-1); // No inline cache, the base is a script instance.
 }
 
 void GDScriptByteCodeGenerator::write_construct(const Address &p_target, Variant::Type p_type, const Vector<Address> &p_arguments) {
@@ -997,8 +1122,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1184,8 +1308,7 @@ void GDScriptByteCodeGenerator::start_while_condition() {
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append(GDScriptFunction::OPCODE_JUMP_IF_NOT, 1);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
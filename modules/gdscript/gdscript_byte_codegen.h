@@ -33,6 +33,7 @@
 
 #include "gdscript_codegen.h"
 
+#include "core/core_string_names.h"
 #include "gdscript_function.h"
 #include "gdscript_utility_functions.h"
 
@@ -55,9 +56,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_temporaries = 0;
 	int current_locals = 0;
 	int current_line = 0;
+	int last_typed_comparison = -1; // Position of the last typed comparison into a temporary, to fuse it with a following conditional jump.
 	int stack_max = 0;
 	int instr_args_max = 0;
 	int ptrcall_max = 0;
+	int member_cache_count = 0;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
@@ -271,6 +274,18 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		return pos;
 	}
 
+	int get_member_cache_pos(const Address &p_base, const StringName &p_name) {
+		// Only accesses that may land on a native object get an inline cache: self and script typed
+		// values always have a script instance, and "free" must go through Object::call().
+		if (p_base.mode == Address::SELF || p_name == CoreStringNames::get_singleton()->_free) {
+			return -1;
+		}
+		if (p_base.type.has_type && (p_base.type.kind == GDScriptDataType::SCRIPT || p_base.type.kind == GDScriptDataType::GDSCRIPT || (p_base.type.kind == GDScriptDataType::BUILTIN && p_base.type.builtin_type != Variant::OBJECT))) {
+			return -1;
+		}
+		return member_cache_count++;
+	}
+
 	void alloc_stack(int p_level) {
 		if (p_level >= stack_max)
 			stack_max = p_level + 1;
@@ -314,6 +329,8 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		return -1; // Unreachable.
 	}
 
+	void append_jump_if_not(const Address &p_condition);
+
 	void append(GDScriptFunction::Opcode p_code, int p_argument_count) {
 		opcodes.push_back((p_code & GDScriptFunction::INSTR_MASK) | (p_argument_count << GDScriptFunction::INSTR_BITS));
 		instr_args_max = MAX(instr_args_max, p_argument_count);
@@ -31,6 +31,8 @@
 #include "gdscript_cache.h"
 
 #include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "core/templates/thread_work_pool.h"
 #include "core/templates/vector.h"
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
@@ -48,6 +50,15 @@ GDScriptParser *GDScriptParserRef::get_parser() const {
 	return parser;
 }
 
+Error GDScriptParserRef::_parse() {
+	MutexLock lock(parse_mutex);
+	if (status == EMPTY) {
+		parse_result = parser->parse(GDScriptCache::get_source_code(path), path, false);
+		status = PARSED;
+	}
+	return parse_result;
+}
+
 Error GDScriptParserRef::raise_status(Status p_new_status) {
 	ERR_FAIL_COND_V(parser == nullptr, ERR_INVALID_DATA);
 
@@ -56,8 +67,7 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 	while (p_new_status > status) {
 		switch (status) {
 			case EMPTY:
-				result = parser->parse(GDScriptCache::get_source_code(path), path, false);
-				status = PARSED;
+				result = _parse();
 				break;
 			case PARSED: {
 				analyzer = memnew(GDScriptAnalyzer(parser));
@@ -145,6 +155,69 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 	return ref;
 }
 
+void GDScriptCache::_parse_prefetched(uint32_t p_index, Ref<GDScriptParserRef> *p_parsers) {
+	p_parsers[p_index]->_parse();
+}
+
+void GDScriptCache::prefetch_parsers(const GDScriptParser *p_parser, Vector<Ref<GDScriptParserRef>> &r_parsers) {
+	// Reading and parsing sources doesn't depend on other scripts, so the dependencies
+	// known from the tree are parsed in parallel, one wave per depth level. Analysis stays
+	// sequential and then finds these parsers ready in the map.
+	MutexLock lock(singleton->lock);
+
+	Set<String> visited;
+	visited.insert(p_parser->get_script_path());
+	Set<String> pending;
+	GDScriptAnalyzer::get_dependency_paths(p_parser, pending);
+
+	// Make sure lazily filled tables are initialized before parsing off the main thread.
+	GDScriptParser::get_builtin_type(StringName());
+
+	while (!pending.is_empty()) {
+		Vector<Ref<GDScriptParserRef>> wave;
+		for (const Set<String>::Element *E = pending.front(); E; E = E->next()) {
+			const String &path = E->get();
+			if (visited.has(path)) {
+				continue;
+			}
+			visited.insert(path);
+
+			Ref<GDScriptParserRef> ref;
+			if (singleton->parser_map.has(path)) {
+				ref = Ref<GDScriptParserRef>(singleton->parser_map[path]);
+			} else {
+				if (!FileAccess::exists(path)) {
+					continue;
+				}
+				ref.instance();
+				ref->parser = memnew(GDScriptParser);
+				ref->path = path;
+				singleton->parser_map[path] = ref.ptr();
+			}
+			r_parsers.push_back(ref);
+			if (ref->status == GDScriptParserRef::EMPTY && ref->parser != nullptr) {
+				wave.push_back(ref);
+			}
+		}
+
+		if (wave.size() == 1) {
+			wave.write[0]->_parse();
+		} else if (wave.size() > 1) {
+			ThreadWorkPool work_pool;
+			work_pool.init(MIN(wave.size(), OS::get_singleton()->get_processor_count()));
+			work_pool.do_work(wave.size(), singleton, &GDScriptCache::_parse_prefetched, wave.ptrw());
+			work_pool.finish();
+		}
+
+		pending.clear();
+		for (int i = 0; i < wave.size(); i++) {
+			if (wave[i]->parse_result == OK) {
+				GDScriptAnalyzer::get_dependency_paths(wave[i]->parser, pending);
+			}
+		}
+	}
+}
+
 String GDScriptCache::get_source_code(const String &p_path) {
 	Vector<uint8_t> source_file;
 	Error err;
@@ -56,6 +56,12 @@ private:
 	Status status = EMPTY;
 	String path;
 
+	// Guards the EMPTY -> PARSED step, which may run on a prefetch worker thread.
+	Mutex parse_mutex;
+	Error parse_result = OK;
+
+	Error _parse();
+
 	friend class GDScriptCache;
 
 public:
@@ -83,8 +89,11 @@ class GDScriptCache {
 	Mutex lock;
 	static void remove_script(const String &p_path);
 
+	void _parse_prefetched(uint32_t p_index, Ref<GDScriptParserRef> *p_parsers);
+
 public:
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
+	static void prefetch_parsers(const GDScriptParser *p_parser, Vector<Ref<GDScriptParserRef>> &r_parsers);
 	static String get_source_code(const String &p_path);
 	static Ref<GDScript> get_shallow_script(const String &p_path, const String &p_owner = String());
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String());
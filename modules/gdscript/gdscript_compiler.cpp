@@ -162,6 +162,18 @@ GDScriptDataType GDScriptCompiler::_gdtype_from_datatype(const GDScriptParser::D
 	return result;
 }
 
+static bool _is_builtin_address(const GDScriptCodeGenerator::Address &p_address) {
+	return p_address.type.has_type && p_address.type.kind == GDScriptDataType::BUILTIN;
+}
+
+static GDScriptDataType _gdtype_from_builtin(Variant::Type p_type) {
+	GDScriptDataType type;
+	type.has_type = true;
+	type.kind = GDScriptDataType::BUILTIN;
+	type.builtin_type = p_type;
+	return type;
+}
+
 static bool _is_exact_type(const PropertyInfo &p_par_type, const GDScriptDataType &p_arg_type) {
 	if (!p_arg_type.has_type) {
 		return false;
@@ -691,6 +703,13 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 				return GDScriptCodeGenerator::Address();
 			}
 
+			if (_is_builtin_address(operand)) {
+				Variant::Type result_type = Variant::get_operator_return_type(unary->variant_op, operand.type.builtin_type, Variant::NIL);
+				if (result_type != Variant::NIL) {
+					result.type = _gdtype_from_builtin(result_type);
+				}
+			}
+
 			gen->write_unary_operator(result, unary->variant_op, operand);
 
 			if (operand.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
@@ -759,6 +778,14 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 					GDScriptCodeGenerator::Address left_operand = _parse_expression(codegen, r_error, binary->left_operand);
 					GDScriptCodeGenerator::Address right_operand = _parse_expression(codegen, r_error, binary->right_operand);
 
+					if (_is_builtin_address(left_operand) && _is_builtin_address(right_operand)) {
+						// The result type is known too, so operators using it can be specialized as well.
+						Variant::Type result_type = Variant::get_operator_return_type(binary->variant_op, left_operand.type.builtin_type, right_operand.type.builtin_type);
+						if (result_type != Variant::NIL) {
+							result.type = _gdtype_from_builtin(result_type);
+						}
+					}
+
 					gen->write_binary_operator(result, binary->variant_op, left_operand, right_operand);
 
 					if (right_operand.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
@@ -1601,9 +1628,36 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype()));
 
-				GDScriptCodeGenerator::Address list = _parse_expression(codegen, error, for_n->list);
-				if (error) {
-					return error;
+				GDScriptCodeGenerator::Address list;
+
+				GDScriptParser::DataType list_type = for_n->list->get_datatype();
+				bool is_range_bounds = !for_n->list->is_constant && for_n->list->type == GDScriptParser::Node::CALL && list_type.kind == GDScriptParser::DataType::BUILTIN && (list_type.builtin_type == Variant::INT || list_type.builtin_type == Variant::VECTOR2I || list_type.builtin_type == Variant::VECTOR3I);
+				if (is_range_bounds) {
+					// Non-constant range() call with numeric arguments, build the bounds instead of allocating the array (see GDScriptAnalyzer::resolve_for()).
+					const GDScriptParser::CallNode *call = static_cast<const GDScriptParser::CallNode *>(for_n->list);
+
+					list = codegen.add_temporary(_gdtype_from_datatype(list_type));
+
+					Vector<GDScriptCodeGenerator::Address> arguments;
+					for (int j = 0; j < call->arguments.size(); j++) {
+						arguments.push_back(_parse_expression(codegen, error, call->arguments[j]));
+						if (error) {
+							return error;
+						}
+					}
+
+					gen->write_construct(list, list_type.builtin_type, arguments);
+
+					for (int j = arguments.size() - 1; j >= 0; j--) {
+						if (arguments[j].mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+							gen->pop_temporary();
+						}
+					}
+				} else {
+					list = _parse_expression(codegen, error, for_n->list);
+					if (error) {
+						return error;
+					}
 				}
 
 				gen->write_for_assignment(iterator, list);
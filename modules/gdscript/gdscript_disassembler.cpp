@@ -106,6 +106,28 @@ static String _disassemble_address(const GDScript *p_script, const GDScriptFunct
 
 void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 #define DADDR(m_ip) (_disassemble_address(_script, *this, _code_ptr[ip + m_ip]))
+#define DISASSEMBLE_OPERATOR_TYPED(m_name, m_op, m_type) \
+	case OPCODE_OPERATOR_##m_name##_##m_type: {          \
+		text += "typed operator ";                       \
+		text += DADDR(3);                                \
+		text += " = ";                                   \
+		text += DADDR(1);                                \
+		text += " " #m_op " ";                           \
+		text += DADDR(2);                                \
+		text += " (" #m_type ")";                        \
+		incr += 4;                                       \
+	} break
+
+#define DISASSEMBLE_JUMP_IF_NOT_TYPED(m_name, m_op, m_type) \
+	case OPCODE_JUMP_IF_NOT_##m_name##_##m_type: {          \
+		text += "jump-if-not ";                             \
+		text += DADDR(1);                                   \
+		text += " " #m_op " ";                              \
+		text += DADDR(2);                                   \
+		text += " (" #m_type ") to ";                       \
+		text += itos(_code_ptr[ip + 3]);                    \
+		incr = 4;                                           \
+	} break
 
 	for (int ip = 0; ip < _code_size;) {
 		StringBuilder text;
@@ -146,6 +168,25 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			DISASSEMBLE_OPERATOR_TYPED(ADD, +, INT);
+			DISASSEMBLE_OPERATOR_TYPED(SUBTRACT, -, INT);
+			DISASSEMBLE_OPERATOR_TYPED(MULTIPLY, *, INT);
+			DISASSEMBLE_OPERATOR_TYPED(EQUAL, ==, INT);
+			DISASSEMBLE_OPERATOR_TYPED(NOT_EQUAL, !=, INT);
+			DISASSEMBLE_OPERATOR_TYPED(LESS, <, INT);
+			DISASSEMBLE_OPERATOR_TYPED(LESS_EQUAL, <=, INT);
+			DISASSEMBLE_OPERATOR_TYPED(GREATER, >, INT);
+			DISASSEMBLE_OPERATOR_TYPED(GREATER_EQUAL, >=, INT);
+			DISASSEMBLE_OPERATOR_TYPED(ADD, +, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(SUBTRACT, -, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(MULTIPLY, *, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(DIVIDE, /, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(EQUAL, ==, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(NOT_EQUAL, !=, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(LESS, <, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(LESS_EQUAL, <=, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(GREATER, >, FLOAT);
+			DISASSEMBLE_OPERATOR_TYPED(GREATER_EQUAL, >=, FLOAT);
 			case OPCODE_EXTENDS_TEST: {
 				text += "is object ";
 				text += DADDR(3);
@@ -258,7 +299,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -474,7 +515,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
@@ -709,6 +750,18 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr = 3;
 			} break;
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(EQUAL, ==, INT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(NOT_EQUAL, !=, INT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(LESS, <, INT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(LESS_EQUAL, <=, INT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(GREATER, >, INT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(GREATER_EQUAL, >=, INT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(EQUAL, ==, FLOAT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(NOT_EQUAL, !=, FLOAT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(LESS, <, FLOAT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(LESS_EQUAL, <=, FLOAT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(GREATER, >, FLOAT);
+			DISASSEMBLE_JUMP_IF_NOT_TYPED(GREATER_EQUAL, >=, FLOAT);
 			case OPCODE_JUMP_TO_DEF_ARGUMENT: {
 				text += "jump-to-default-argument ";
 
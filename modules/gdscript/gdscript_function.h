@@ -33,6 +33,7 @@
 
 #include "core/object/reference.h"
 #include "core/object/script_language.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
@@ -161,6 +162,25 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
+		OPCODE_OPERATOR_MULTIPLY_INT,
+		OPCODE_OPERATOR_EQUAL_INT,
+		OPCODE_OPERATOR_NOT_EQUAL_INT,
+		OPCODE_OPERATOR_LESS_INT,
+		OPCODE_OPERATOR_LESS_EQUAL_INT,
+		OPCODE_OPERATOR_GREATER_INT,
+		OPCODE_OPERATOR_GREATER_EQUAL_INT,
+		OPCODE_OPERATOR_ADD_FLOAT,
+		OPCODE_OPERATOR_SUBTRACT_FLOAT,
+		OPCODE_OPERATOR_MULTIPLY_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_FLOAT,
+		OPCODE_OPERATOR_EQUAL_FLOAT,
+		OPCODE_OPERATOR_NOT_EQUAL_FLOAT,
+		OPCODE_OPERATOR_LESS_FLOAT,
+		OPCODE_OPERATOR_LESS_EQUAL_FLOAT,
+		OPCODE_OPERATOR_GREATER_FLOAT,
+		OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,
 		OPCODE_EXTENDS_TEST,
 		OPCODE_IS_BUILTIN,
 		OPCODE_SET_KEYED,
@@ -239,6 +259,18 @@ public:
 		OPCODE_JUMP,
 		OPCODE_JUMP_IF,
 		OPCODE_JUMP_IF_NOT,
+		OPCODE_JUMP_IF_NOT_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_LESS_INT,
+		OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_GREATER_INT,
+		OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_LESS_FLOAT,
+		OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_GREATER_FLOAT,
+		OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT,
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_RETURN,
 		OPCODE_ITERATE_BEGIN,
@@ -316,6 +348,14 @@ public:
 		StringName identifier;
 	};
 
+	// Monomorphic inline cache of a by-name call or property get, keyed on the receiver's class.
+	// Only used for objects without a script instance, so the answer depends on the class alone.
+	struct MemberCache {
+		SpinLock lock;
+		StringName class_name;
+		MethodBind *method = nullptr;
+	};
+
 private:
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
@@ -353,6 +393,8 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	int _methods_count = 0;
 	MethodBind **_methods_ptr = nullptr;
+	int _member_caches_count = 0;
+	MemberCache *_member_caches_ptr = nullptr;
 	const int *_code_ptr = nullptr;
 	int _code_size = 0;
 	int _argument_count = 0;
@@ -158,6 +158,7 @@ void GDScriptParser::clear() {
 	_is_tool = false;
 	for_completion = false;
 	errors.clear();
+	referenced_types.clear();
 	multiline_stack.clear();
 }
 
@@ -2660,6 +2661,7 @@ GDScriptParser::TypeNode *GDScriptParser::parse_type(bool p_allow_void) {
 	IdentifierNode *type_element = parse_identifier();
 
 	type->type_chain.push_back(type_element);
+	referenced_types.insert(type_element->name);
 
 	int chain_index = 1;
 	while (match(GDScriptTokenizer::Token::PERIOD)) {
@@ -155,6 +155,41 @@ static String _get_var_type(const Variant *p_var) {
 }
 #endif // DEBUG_ENABLED
 
+// Looks up a by-name call or property get on a native object through the inline cache of the
+// call site. Returns null if the access has to go through the generic Variant path instead.
+static _FORCE_INLINE_ MethodBind *_get_cached_member(GDScriptFunction::MemberCache &r_cache, const Variant *p_base, const StringName &p_name, bool p_getter, Object *&r_object) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return nullptr;
+	}
+#ifdef DEBUG_ENABLED
+	Object *obj = p_base->get_validated_object();
+#else
+	Object *obj = p_base->operator Object *();
+#endif
+	if (!obj || obj->get_script_instance()) {
+		return nullptr;
+	}
+	r_object = obj;
+
+	const StringName &class_name = obj->get_class_name();
+	r_cache.lock.lock();
+	if (likely(r_cache.class_name == class_name)) {
+		MethodBind *method = r_cache.method;
+		r_cache.lock.unlock();
+		return method;
+	}
+	r_cache.lock.unlock();
+
+	// Also cache failed lookups, so other receivers of the same class skip straight to the generic path.
+	MethodBind *method = p_getter ? ClassDB::get_property_getter_method(class_name, p_name) : ClassDB::get_method(class_name, p_name);
+
+	r_cache.lock.lock();
+	r_cache.class_name = class_name;
+	r_cache.method = method;
+	r_cache.lock.unlock();
+	return method;
+}
+
 String GDScriptFunction::_get_call_error(const Callable::CallError &p_err, const String &p_where, const Variant **argptrs) const {
 	String err_text;
 
@@ -189,6 +224,25 @@ String GDScriptFunction::_get_call_error(const Callable::CallError &p_err, const
 	static const void *switch_table_ops[] = {        \
 		&&OPCODE_OPERATOR,                           \
 		&&OPCODE_OPERATOR_VALIDATED,                 \
+		&&OPCODE_OPERATOR_ADD_INT,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,              \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,              \
+		&&OPCODE_OPERATOR_EQUAL_INT,                 \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,             \
+		&&OPCODE_OPERATOR_LESS_INT,                  \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,            \
+		&&OPCODE_OPERATOR_GREATER_INT,               \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,         \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                 \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,            \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,            \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,              \
+		&&OPCODE_OPERATOR_EQUAL_FLOAT,               \
+		&&OPCODE_OPERATOR_NOT_EQUAL_FLOAT,           \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,          \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,             \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,       \
 		&&OPCODE_EXTENDS_TEST,                       \
 		&&OPCODE_IS_BUILTIN,                         \
 		&&OPCODE_SET_KEYED,                          \
@@ -266,6 +320,18 @@ String GDScriptFunction::_get_call_error(const Callable::CallError &p_err, const
 		&&OPCODE_JUMP,                               \
 		&&OPCODE_JUMP_IF,                            \
 		&&OPCODE_JUMP_IF_NOT,                        \
+		&&OPCODE_JUMP_IF_NOT_EQUAL_INT,              \
+		&&OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT,          \
+		&&OPCODE_JUMP_IF_NOT_LESS_INT,               \
+		&&OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT,         \
+		&&OPCODE_JUMP_IF_NOT_GREATER_INT,            \
+		&&OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT,      \
+		&&OPCODE_JUMP_IF_NOT_EQUAL_FLOAT,            \
+		&&OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT,        \
+		&&OPCODE_JUMP_IF_NOT_LESS_FLOAT,             \
+		&&OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT,       \
+		&&OPCODE_JUMP_IF_NOT_GREATER_FLOAT,          \
+		&&OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT,    \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,               \
 		&&OPCODE_RETURN,                             \
 		&&OPCODE_ITERATE_BEGIN,                      \
@@ -376,6 +442,7 @@ String GDScriptFunction::_get_call_error(const Callable::CallError &p_err, const
 
 Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state) {
 	OPCODES_TABLE;
+	MEMORY_TAG_SCOPE(TAG_SCRIPT);
 
 	if (!_code_ptr) {
 		return Variant();
@@ -608,6 +675,41 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_TYPED(m_name, m_op, m_type, m_ret_type)                                                \
+	OPCODE(OPCODE_OPERATOR_##m_name##_##m_type) {                                                              \
+		CHECK_SPACE(4);                                                                                        \
+		GET_INSTRUCTION_ARG(a, 0);                                                                             \
+		GET_INSTRUCTION_ARG(b, 1);                                                                             \
+		GET_INSTRUCTION_ARG(dst, 2);                                                                           \
+		const auto result = (*VariantInternal::OP_GET_##m_type(a)) m_op(*VariantInternal::OP_GET_##m_type(b)); \
+		if (dst->get_type() != Variant::m_ret_type) {                                                          \
+			VariantInternal::initialize(dst, Variant::m_ret_type);                                             \
+		}                                                                                                      \
+		*VariantInternal::OP_GET_##m_ret_type(dst) = result;                                                   \
+		ip += 4;                                                                                               \
+	}                                                                                                          \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_TYPED(ADD, +, INT, INT);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, -, INT, INT);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, *, INT, INT);
+			OPCODE_OPERATOR_TYPED(EQUAL, ==, INT, BOOL);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL, !=, INT, BOOL);
+			OPCODE_OPERATOR_TYPED(LESS, <, INT, BOOL);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL, <=, INT, BOOL);
+			OPCODE_OPERATOR_TYPED(GREATER, >, INT, BOOL);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL, >=, INT, BOOL);
+			OPCODE_OPERATOR_TYPED(ADD, +, FLOAT, FLOAT);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, -, FLOAT, FLOAT);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, *, FLOAT, FLOAT);
+			OPCODE_OPERATOR_TYPED(DIVIDE, /, FLOAT, FLOAT);
+			OPCODE_OPERATOR_TYPED(EQUAL, ==, FLOAT, BOOL);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL, !=, FLOAT, BOOL);
+			OPCODE_OPERATOR_TYPED(LESS, <, FLOAT, BOOL);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL, <=, FLOAT, BOOL);
+			OPCODE_OPERATOR_TYPED(GREATER, >, FLOAT, BOOL);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL, >=, FLOAT, BOOL);
+
 			OPCODE(OPCODE_EXTENDS_TEST) {
 				CHECK_SPACE(4);
 
@@ -926,7 +1028,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_INSTRUCTION_ARG(src, 0);
 				GET_INSTRUCTION_ARG(dst, 1);
@@ -936,13 +1038,19 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx >= _member_caches_count);
+				Object *getter_obj = nullptr;
+				MethodBind *getter = cache_idx < 0 ? nullptr : _get_cached_member(_member_caches_ptr[cache_idx], src, *index, true, getter_obj);
+
+				bool valid = true;
+				Callable::CallError getter_err;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				Variant ret = getter ? getter->call(getter_obj, nullptr, 0, getter_err) : src->get_named(*index, valid);
 
 #else
-				*dst = src->get_named(*index, valid);
+				*dst = getter ? getter->call(getter_obj, nullptr, 0, getter_err) : src->get_named(*index, valid);
 #endif
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -955,7 +1063,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1340,7 +1448,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_CALL_ASYNC)
 			OPCODE(OPCODE_CALL_RETURN)
 			OPCODE(OPCODE_CALL) {
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 				bool call_ret = (_code_ptr[ip] & INSTR_MASK) != OPCODE_CALL;
 #ifdef DEBUG_ENABLED
 				bool call_async = (_code_ptr[ip] & INSTR_MASK) == OPCODE_CALL_ASYNC;
@@ -1358,6 +1466,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx >= _member_caches_count);
+				Object *base_obj = nullptr;
+				MethodBind *method = cache_idx < 0 ? nullptr : _get_cached_member(_member_caches_ptr[cache_idx], base, *methodname, false, base_obj);
+
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
 
@@ -1369,7 +1482,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->call(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					if (method) {
+						*ret = method->call(base_obj, (const Variant **)argptrs, argc, err);
+					} else {
+						base->call(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
 #ifdef DEBUG_ENABLED
 					if (!call_async && ret->get_type() == Variant::OBJECT) {
 						// Check if getting a function state without await.
@@ -1386,6 +1503,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
+				} else if (method) {
+					method->call(base_obj, (const Variant **)argptrs, argc, err);
 				} else {
 					Variant ret;
 					base->call(*methodname, (const Variant **)argptrs, argc, ret, err);
@@ -1429,7 +1548,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2047,6 +2166,34 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_JUMP_IF_NOT_TYPED(m_name, m_op, m_type)                                              \
+	OPCODE(OPCODE_JUMP_IF_NOT_##m_name##_##m_type) {                                                \
+		CHECK_SPACE(4);                                                                             \
+		GET_INSTRUCTION_ARG(a, 0);                                                                  \
+		GET_INSTRUCTION_ARG(b, 1);                                                                  \
+		if (!((*VariantInternal::OP_GET_##m_type(a)) m_op(*VariantInternal::OP_GET_##m_type(b)))) { \
+			int to = _code_ptr[ip + 3];                                                             \
+			GD_ERR_BREAK(to < 0 || to > _code_size);                                                \
+			ip = to;                                                                                \
+		} else {                                                                                    \
+			ip += 4;                                                                                \
+		}                                                                                           \
+	}                                                                                               \
+	DISPATCH_OPCODE
+
+			OPCODE_JUMP_IF_NOT_TYPED(EQUAL, ==, INT);
+			OPCODE_JUMP_IF_NOT_TYPED(NOT_EQUAL, !=, INT);
+			OPCODE_JUMP_IF_NOT_TYPED(LESS, <, INT);
+			OPCODE_JUMP_IF_NOT_TYPED(LESS_EQUAL, <=, INT);
+			OPCODE_JUMP_IF_NOT_TYPED(GREATER, >, INT);
+			OPCODE_JUMP_IF_NOT_TYPED(GREATER_EQUAL, >=, INT);
+			OPCODE_JUMP_IF_NOT_TYPED(EQUAL, ==, FLOAT);
+			OPCODE_JUMP_IF_NOT_TYPED(NOT_EQUAL, !=, FLOAT);
+			OPCODE_JUMP_IF_NOT_TYPED(LESS, <, FLOAT);
+			OPCODE_JUMP_IF_NOT_TYPED(LESS_EQUAL, <=, FLOAT);
+			OPCODE_JUMP_IF_NOT_TYPED(GREATER, >, FLOAT);
+			OPCODE_JUMP_IF_NOT_TYPED(GREATER_EQUAL, >=, FLOAT);
+
 			OPCODE(OPCODE_JUMP_TO_DEF_ARGUMENT) {
 				CHECK_SPACE(2);
 				ip = _default_arg_ptr[defarg];
@@ -40,6 +40,26 @@
 GDScriptLanguageProtocol *GDScriptLanguageProtocol::singleton = nullptr;
 
 Error GDScriptLanguageProtocol::LSPeer::handle_data() {
+	// Read every message that arrived since the last poll before processing any of them,
+	// so the ones already made stale by the messages after them can be dropped.
+	Vector<String> messages;
+	Error err = OK;
+	while (err == OK) {
+		String msg;
+		err = read_message(msg);
+		if (err == OK) {
+			messages.push_back(msg);
+		}
+	}
+
+	Vector<String> outputs = GDScriptLanguageProtocol::get_singleton()->process_messages(messages);
+	for (int i = 0; i < outputs.size(); i++) {
+		res_queue.push_back(outputs[i].utf8());
+	}
+	return err;
+}
+
+Error GDScriptLanguageProtocol::LSPeer::read_message(String &r_message) {
 	int read = 0;
 	// Read headers
 	if (!has_header) {
@@ -87,18 +107,11 @@ Error GDScriptLanguageProtocol::LSPeer::handle_data() {
 		}
 
 		// Parse data
-		String msg;
-		msg.parse_utf8((const char *)req_buf, req_pos);
+		r_message.parse_utf8((const char *)req_buf, req_pos);
 
 		// Reset to read again
 		req_pos = 0;
 		has_header = false;
-
-		// Response
-		String output = GDScriptLanguageProtocol::get_singleton()->process_message(msg);
-		if (!output.is_empty()) {
-			res_queue.push_back(output.utf8());
-		}
 	}
 	return OK;
 }
@@ -148,6 +161,77 @@ String GDScriptLanguageProtocol::process_message(const String &p_text) {
 	}
 }
 
+Vector<String> GDScriptLanguageProtocol::process_messages(const Vector<String> &p_messages) {
+	Vector<String> outputs;
+	if (p_messages.size() == 1) {
+		String output = process_message(p_messages[0]);
+		if (!output.is_empty()) {
+			outputs.push_back(output);
+		}
+		return outputs;
+	}
+
+	// Documents are synced in full, so only the last change of a document in the batch needs to be parsed,
+	// and the requests queued before it were made against content that doesn't exist anymore.
+	Vector<Variant> actions;
+	actions.resize(p_messages.size());
+	Array cancelled_ids;
+	Map<String, int> last_changes;
+	for (int i = 0; i < p_messages.size(); i++) {
+		String err_message;
+		int err_line;
+		if (JSON::parse(p_messages[i], actions.write[i], err_message, err_line) != OK || actions[i].get_type() != Variant::DICTIONARY) {
+			continue;
+		}
+		Dictionary action = actions[i];
+		String method = action.get("method", "");
+		Dictionary params = action.get("params", Dictionary());
+		if (method == "$/cancelRequest") {
+			cancelled_ids.push_back(params.get("id", Variant()));
+		} else if (method == "textDocument/didChange") {
+			Dictionary document = params.get("textDocument", Dictionary());
+			last_changes[document.get("uri", "")] = i;
+		}
+	}
+
+	for (int i = 0; i < p_messages.size(); i++) {
+		if (actions[i].get_type() != Variant::DICTIONARY) {
+			String output = process_message(p_messages[i]);
+			if (!output.is_empty()) {
+				outputs.push_back(output);
+			}
+			continue;
+		}
+
+		Dictionary action = actions[i];
+		String method = action.get("method", "");
+		Dictionary params = action.get("params", Dictionary());
+		Dictionary document = params.get("textDocument", Dictionary());
+		const Map<String, int>::Element *last_change = last_changes.find(document.get("uri", ""));
+		bool is_request = action.has("id");
+
+		Variant ret;
+		if (is_request && cancelled_ids.has(action["id"])) {
+			ret = make_response_error(RequestCancelled, "Request cancelled", action["id"]);
+		} else if (last_change && last_change->get() > i && method.begins_with("textDocument/")) {
+			if (is_request) {
+				ret = make_response_error(ContentModified, "Content modified", action["id"]);
+			} else if (method == "textDocument/didChange") {
+				continue; // Superseded by a later change.
+			} else {
+				ret = process_action(action, true);
+			}
+		} else {
+			ret = process_action(action, true);
+		}
+
+		if (ret.get_type() != Variant::NIL) {
+			outputs.push_back(format_output(JSON::print(ret)));
+		}
+	}
+	return outputs;
+}
+
 String GDScriptLanguageProtocol::format_output(const String &p_text) {
 	String header = "Content-Length: ";
 	CharString charstr = p_text.utf8();
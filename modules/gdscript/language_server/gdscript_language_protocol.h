@@ -58,6 +58,7 @@ private:
 		int res_sent = 0;
 
 		Error handle_data();
+		Error read_message(String &r_message);
 		Error send_data();
 	};
 
@@ -80,6 +81,7 @@ private:
 	void on_client_disconnected(const int &p_client_id);
 
 	String process_message(const String &p_text);
+	Vector<String> process_messages(const Vector<String> &p_messages);
 	String format_output(const String &p_text);
 
 	bool _initialized = false;
@@ -70,6 +70,8 @@ void GDScriptWorkspace::remove_cache_parser(const String &p_path) {
 		memdelete(script->get());
 		scripts.erase(p_path);
 	}
+	parsed_contents.erase(p_path);
+	symbol_index.erase(p_path);
 }
 
 const lsp::DocumentSymbol *GDScriptWorkspace::get_native_symbol(const String &p_class, const String &p_member) const {
@@ -172,9 +174,8 @@ Array GDScriptWorkspace::symbol(const Dictionary &p_params) {
 	String query = p_params["query"];
 	Array arr;
 	if (!query.is_empty()) {
-		for (Map<String, ExtendGDScriptParser *>::Element *E = scripts.front(); E; E = E->next()) {
-			Vector<lsp::DocumentedSymbolInformation> script_symbols;
-			E->get()->get_symbols().symbol_tree_as_list(E->key(), script_symbols);
+		for (const Map<String, Vector<lsp::DocumentedSymbolInformation>>::Element *E = symbol_index.front(); E; E = E->next()) {
+			const Vector<lsp::DocumentedSymbolInformation> &script_symbols = E->get();
 			for (int i = 0; i < script_symbols.size(); ++i) {
 				if (query.is_subsequence_ofi(script_symbols[i].name)) {
 					arr.push_back(script_symbols[i].to_json());
@@ -316,6 +317,13 @@ Error GDScriptWorkspace::initialize() {
 }
 
 Error GDScriptWorkspace::parse_script(const String &p_path, const String &p_content) {
+	const Map<String, String>::Element *last_content = parsed_contents.find(p_path);
+	if (last_content && last_content->get() == p_content && parse_results.has(p_path)) {
+		// Unchanged, e.g. saved or reopened without edits.
+		publish_diagnostics(p_path);
+		return scripts.has(p_path) && scripts[p_path] == parse_results[p_path] ? OK : ERR_PARSE_ERROR;
+	}
+
 	ExtendGDScriptParser *parser = memnew(ExtendGDScriptParser);
 	Error err = parser->parse(p_content, p_path);
 	Map<String, ExtendGDScriptParser *>::Element *last_parser = parse_results.find(p_path);
@@ -326,12 +334,16 @@ Error GDScriptWorkspace::parse_script(const String &p_path, const String &p_cont
 		parse_results[p_path] = parser;
 		scripts[p_path] = parser;
 
+		Vector<lsp::DocumentedSymbolInformation> &script_symbols = symbol_index[p_path];
+		parser->get_symbols().symbol_tree_as_list(p_path, script_symbols);
+
 	} else {
 		if (last_parser && last_script && last_parser->get() != last_script->get()) {
 			memdelete(last_parser->get());
 		}
 		parse_results[p_path] = parser;
 	}
+	parsed_contents[p_path] = p_content;
 
 	publish_diagnostics(p_path);
 
@@ -66,6 +66,8 @@ public:
 
 	Map<String, ExtendGDScriptParser *> scripts;
 	Map<String, ExtendGDScriptParser *> parse_results;
+	Map<String, String> parsed_contents; // Last content parsed for each script, re-sending it doesn't parse again.
+	Map<String, Vector<lsp::DocumentedSymbolInformation>> symbol_index; // Flattened symbols of each script in `scripts`.
 	HashMap<StringName, ClassMembers> native_members;
 
 public:
@@ -0,0 +1,391 @@
+/*************************************************************************/
+/*  test_gdscript_vm.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_GDSCRIPT_VM_H
+#define TEST_GDSCRIPT_VM_H
+
+#include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
+#include "core/object/reference.h"
+#include "core/object/script_language.h"
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+
+#include "tests/test_macros.h"
+
+// Runs the same code with typed and untyped variables. The typed version goes through the
+// specialized opcodes, the untyped one through the generic Variant paths, both must agree.
+
+namespace TestGDScriptVM {
+
+static Ref<Reference> _make_script_object(const String &p_source) {
+	Ref<Script> script = Object::cast_to<Script>(ClassDB::instance("GDScript"));
+	script->set_source_code(p_source);
+	if (script->reload() != OK) {
+		return Ref<Reference>();
+	}
+
+	Ref<Reference> object = memnew(Reference);
+	object->set_script(script);
+	return object;
+}
+
+static void _check_same_results(const Array &p_typed, const Array &p_untyped) {
+	REQUIRE(p_typed.size() == p_untyped.size());
+	for (int i = 0; i < p_typed.size(); i++) {
+		// hash_compare() also checks the type, and considers NaNs equal.
+		CHECK_MESSAGE(
+				p_typed[i].hash_compare(p_untyped[i]),
+				vformat("Result %d differs: %s (typed) and %s (untyped).", i, p_typed[i], p_untyped[i]));
+	}
+}
+
+TEST_CASE("[GDScript] Typed operators and range loops match the generic path") {
+	if (!ClassDB::class_exists("GDScript")) {
+		return;
+	}
+
+	Ref<Reference> object = _make_script_object(
+			"extends Reference\n"
+			"\n"
+			"func typed_math(a: int, b: int, x: float, y: float) -> Array:\n"
+			"\tvar r := []\n"
+			"\tr.append(a + b)\n"
+			"\tr.append(a - b)\n"
+			"\tr.append(a * b)\n"
+			"\tr.append(a * 2 + b - 1)\n"
+			"\tr.append(a / b)\n"
+			"\tr.append(a % b)\n"
+			"\tr.append(x + y)\n"
+			"\tr.append(x - y)\n"
+			"\tr.append(x * y)\n"
+			"\tr.append(x / y)\n"
+			"\tr.append(x * 0.5 + y)\n"
+			"\tr.append([a == b, a != b, a < b, a <= b, a > b, a >= b])\n"
+			"\tr.append([x == y, x != y, x < y, x <= y, x > y, x >= y])\n"
+			"\treturn r\n"
+			"\n"
+			"func untyped_math(a, b, x, y):\n"
+			"\tvar r = []\n"
+			"\tr.append(a + b)\n"
+			"\tr.append(a - b)\n"
+			"\tr.append(a * b)\n"
+			"\tr.append(a * 2 + b - 1)\n"
+			"\tr.append(a / b)\n"
+			"\tr.append(a % b)\n"
+			"\tr.append(x + y)\n"
+			"\tr.append(x - y)\n"
+			"\tr.append(x * y)\n"
+			"\tr.append(x / y)\n"
+			"\tr.append(x * 0.5 + y)\n"
+			"\tr.append([a == b, a != b, a < b, a <= b, a > b, a >= b])\n"
+			"\tr.append([x == y, x != y, x < y, x <= y, x > y, x >= y])\n"
+			"\treturn r\n"
+			"\n"
+			"func typed_loops(n: int, from: int, to: int, step: int) -> Array:\n"
+			"\tvar r := []\n"
+			"\tfor i in range(n):\n"
+			"\t\tr.append(i * 3 + 1)\n"
+			"\tfor i in range(from, to):\n"
+			"\t\tr.append(i)\n"
+			"\tfor i in range(to, from, step):\n"
+			"\t\tr.append(i)\n"
+			"\tfor i in range(to, from, -2):\n"
+			"\t\tr.append(i)\n"
+			"\tfor i in n:\n"
+			"\t\tr.append(i - n)\n"
+			"\treturn r\n"
+			"\n"
+			"func untyped_loops(n, from, to, step):\n"
+			"\tvar r = []\n"
+			"\tfor i in range(n):\n"
+			"\t\tr.append(i * 3 + 1)\n"
+			"\tfor i in range(from, to):\n"
+			"\t\tr.append(i)\n"
+			"\tfor i in range(to, from, step):\n"
+			"\t\tr.append(i)\n"
+			"\tfor i in range(to, from, -2):\n"
+			"\t\tr.append(i)\n"
+			"\tfor i in n:\n"
+			"\t\tr.append(i - n)\n"
+			"\treturn r\n");
+	REQUIRE(object.is_valid());
+
+	const int int_args[][2] = { { 7, 3 }, { -7, 3 }, { 3, 3 }, { 0, -5 }, { 1000000, 1000000 } };
+	const double float_args[][2] = { { 1.5, 0.25 }, { -2.0, 3.0 }, { 4.0, 4.0 }, { 0.0, -0.0 }, { 1.0, Math_NAN } };
+	for (int i = 0; i < 5; i++) {
+		for (int j = 0; j < 5; j++) {
+			Variant a = int_args[i][0];
+			Variant b = int_args[i][1];
+			Variant x = float_args[j][0];
+			Variant y = float_args[j][1];
+			_check_same_results(object->call("typed_math", a, b, x, y), object->call("untyped_math", a, b, x, y));
+		}
+	}
+
+	const int loop_args[][4] = { { 5, 2, 6, -1 }, { 0, 3, 3, -2 }, { 3, -4, 4, -3 }, { -2, 5, 1, -1 } };
+	for (int i = 0; i < 4; i++) {
+		Variant n = loop_args[i][0];
+		Variant from = loop_args[i][1];
+		Variant to = loop_args[i][2];
+		Variant step = loop_args[i][3];
+		_check_same_results(object->call("typed_loops", n, from, to, step), object->call("untyped_loops", n, from, to, step));
+	}
+}
+
+TEST_CASE("[GDScript] Fused comparison jumps match the generic path") {
+	if (!ClassDB::class_exists("GDScript")) {
+		return;
+	}
+
+	Ref<Reference> object = _make_script_object(
+			"extends Reference\n"
+			"\n"
+			"func typed_branches(a: int, b: int, x: float, y: float) -> Array:\n"
+			"\tvar i := -3\n"
+			"\tvar r := []\n"
+			"\tif a < b:\n"
+			"\t\tr.append(\"a<b\")\n"
+			"\tif a <= b:\n"
+			"\t\tr.append(\"a<=b\")\n"
+			"\tif a > b:\n"
+			"\t\tr.append(\"a>b\")\n"
+			"\telif a == b:\n"
+			"\t\tr.append(\"a==b\")\n"
+			"\tif a != b:\n"
+			"\t\tr.append(\"a!=b\")\n"
+			"\tif a >= b:\n"
+			"\t\tr.append(\"a>=b\")\n"
+			"\tif x < y:\n"
+			"\t\tr.append(\"x<y\")\n"
+			"\tif x <= y:\n"
+			"\t\tr.append(\"x<=y\")\n"
+			"\tif x > y:\n"
+			"\t\tr.append(\"x>y\")\n"
+			"\tif x >= y:\n"
+			"\t\tr.append(\"x>=y\")\n"
+			"\tif x == y:\n"
+			"\t\tr.append(\"x==y\")\n"
+			"\tif x != y:\n"
+			"\t\tr.append(\"x!=y\")\n"
+			"\tr.append(\"t\" if x <= y else \"f\")\n"
+			"\tif a > 0 and x < y:\n"
+			"\t\tr.append(\"and\")\n"
+			"\tvar count = 0\n"
+			"\twhile i < a:\n"
+			"\t\tcount += 1\n"
+			"\t\ti += 1\n"
+			"\tr.append(count)\n"
+			"\treturn r\n"
+			"\n"
+			"func untyped_branches(a, b, x, y):\n"
+			"\tvar i = -3\n"
+			"\tvar r = []\n"
+			"\tif a < b:\n"
+			"\t\tr.append(\"a<b\")\n"
+			"\tif a <= b:\n"
+			"\t\tr.append(\"a<=b\")\n"
+			"\tif a > b:\n"
+			"\t\tr.append(\"a>b\")\n"
+			"\telif a == b:\n"
+			"\t\tr.append(\"a==b\")\n"
+			"\tif a != b:\n"
+			"\t\tr.append(\"a!=b\")\n"
+			"\tif a >= b:\n"
+			"\t\tr.append(\"a>=b\")\n"
+			"\tif x < y:\n"
+			"\t\tr.append(\"x<y\")\n"
+			"\tif x <= y:\n"
+			"\t\tr.append(\"x<=y\")\n"
+			"\tif x > y:\n"
+			"\t\tr.append(\"x>y\")\n"
+			"\tif x >= y:\n"
+			"\t\tr.append(\"x>=y\")\n"
+			"\tif x == y:\n"
+			"\t\tr.append(\"x==y\")\n"
+			"\tif x != y:\n"
+			"\t\tr.append(\"x!=y\")\n"
+			"\tr.append(\"t\" if x <= y else \"f\")\n"
+			"\tif a > 0 and x < y:\n"
+			"\t\tr.append(\"and\")\n"
+			"\tvar count = 0\n"
+			"\twhile i < a:\n"
+			"\t\tcount += 1\n"
+			"\t\ti += 1\n"
+			"\tr.append(count)\n"
+			"\treturn r\n");
+	REQUIRE(object.is_valid());
+
+	// NaN makes every comparison but != false, a fused jump must still be taken for them.
+	const int int_args[][2] = { { 2, 5 }, { 5, 2 }, { 4, 4 }, { -3, 0 } };
+	const double float_args[][2] = { { 0.5, 1.5 }, { 1.5, 0.5 }, { 2.0, 2.0 }, { Math_NAN, 1.0 }, { 1.0, Math_NAN } };
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 5; j++) {
+			Variant a = int_args[i][0];
+			Variant b = int_args[i][1];
+			Variant x = float_args[j][0];
+			Variant y = float_args[j][1];
+			_check_same_results(object->call("typed_branches", a, b, x, y), object->call("untyped_branches", a, b, x, y));
+		}
+	}
+}
+
+static void _write_script(const String &p_path, const String &p_source) {
+	FileAccessRef f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f);
+	f->store_string(p_source);
+}
+
+TEST_CASE("[GDScript] Scripts with prefetched dependencies match the generic path") {
+	if (!ClassDB::class_exists("GDScript")) {
+		return;
+	}
+
+	// A chain of two bases, parsed in two waves before the derived script is analyzed.
+	const String base_path = OS::get_singleton()->get_cache_path().plus_file("gdscript_vm_base.gd");
+	const String middle_path = OS::get_singleton()->get_cache_path().plus_file("gdscript_vm_middle.gd");
+	const String derived_path = OS::get_singleton()->get_cache_path().plus_file("gdscript_vm_derived.gd");
+	_write_script(base_path,
+			"extends Reference\n"
+			"\n"
+			"func scale(v: int) -> int:\n"
+			"\treturn v * 3\n");
+	_write_script(middle_path,
+			"extends \"" + base_path + "\"\n"
+			"\n"
+			"var offset := 2\n"
+			"\n"
+			"func shift(v):\n"
+			"\treturn v + offset\n");
+	_write_script(derived_path,
+			"extends \"" + middle_path + "\"\n"
+			"\n"
+			"func typed_run(n: int) -> Array:\n"
+			"\tvar r := []\n"
+			"\tfor i in range(n):\n"
+			"\t\tr.append(shift(scale(i)))\n"
+			"\treturn r\n"
+			"\n"
+			"func untyped_run(n):\n"
+			"\tvar r = []\n"
+			"\tfor i in range(n):\n"
+			"\t\tr.append(shift(scale(i)))\n"
+			"\treturn r\n");
+
+	Ref<Script> script = ResourceLoader::load(derived_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	// Loaded with their dependencies, the sources are no longer needed.
+	DirAccess::remove_file_or_error(base_path);
+	DirAccess::remove_file_or_error(middle_path);
+	DirAccess::remove_file_or_error(derived_path);
+	REQUIRE(script.is_valid());
+	REQUIRE(script->can_instance());
+
+	Ref<Reference> object = memnew(Reference);
+	object->set_script(script);
+
+	Array typed = object->call("typed_run", 4);
+	_check_same_results(typed, object->call("untyped_run", 4));
+	REQUIRE(typed.size() == 4);
+	CHECK(int(typed[0]) == 2);
+	CHECK(int(typed[3]) == 11);
+}
+
+TEST_CASE("[GDScript] Inline caches match the typed path for changing receivers") {
+	if (!ClassDB::class_exists("GDScript")) {
+		return;
+	}
+
+	Ref<Reference> object = _make_script_object(
+			"extends Reference\n"
+			"\n"
+			"func typed_members(list: Array) -> Array:\n"
+			"\tvar r := []\n"
+			"\tfor o in list:\n"
+			"\t\tvar n: Node = o\n"
+			"\t\tr.append(n.get_class())\n"
+			"\t\tr.append(n.name)\n"
+			"\t\tr.append(n.get_child_count())\n"
+			"\treturn r\n"
+			"\n"
+			"func untyped_members(list):\n"
+			"\tvar r = []\n"
+			"\tfor o in list:\n"
+			"\t\tr.append(o.get_class())\n"
+			"\t\tr.append(o.name)\n"
+			"\t\tr.append(o.get_child_count())\n"
+			"\treturn r\n");
+	REQUIRE(object.is_valid());
+
+	Ref<Script> node_script = Object::cast_to<Script>(ClassDB::instance("GDScript"));
+	node_script->set_source_code(
+			"extends Node\n"
+			"\n"
+			"var extra = 1\n");
+	REQUIRE(node_script->reload() == OK);
+
+	// Alternate classes at the same call sites, so the caches keep missing, and mix in a scripted
+	// node, which bypasses them.
+	Node *node = memnew(Node);
+	node->set_name("Plain");
+	Node2D *node_2d = memnew(Node2D);
+	node_2d->set_name("Canvas");
+	node_2d->add_child(memnew(Node));
+	Node *scripted = memnew(Node);
+	scripted->set_name("Scripted");
+	scripted->set_script(node_script);
+
+	Array list;
+	list.push_back(node);
+	list.push_back(node_2d);
+	list.push_back(node);
+	list.push_back(scripted);
+	list.push_back(node_2d);
+	list.push_back(node_2d);
+
+	Array typed = object->call("typed_members", list);
+	_check_same_results(typed, object->call("untyped_members", list));
+	// Run the untyped version again, now with warm caches.
+	_check_same_results(typed, object->call("untyped_members", list));
+	REQUIRE(typed.size() == 18);
+	CHECK(String(typed[3]) == "Node2D");
+	CHECK(String(typed[4]) == "Canvas");
+	CHECK(int(typed[5]) == 1);
+	CHECK(String(typed[10]) == "Scripted");
+
+	memdelete(node);
+	memdelete(node_2d);
+	memdelete(scripted);
+}
+
+} // namespace TestGDScriptVM
+
+#endif // TEST_GDSCRIPT_VM_H
@@ -30,12 +30,97 @@
 
 #include "register_types.h"
 
+#include "core/config/project_settings.h"
+#include "core/io/marshalls.h"
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#include "core/os/mutex.h"
 #include "servers/rendering/rendering_device.h"
 
 #include <SPIRV/GlslangToSpv.h>
 #include <StandAlone/ResourceLimits.h>
 #include <glslang/Include/Types.h>
 #include <glslang/Public/ShaderLang.h>
+#include <glslang/build_info.h>
+
+// Bump when the compile options below change, so stale SPIR-V is not reused.
+#define SHADER_CACHE_VERSION 1
+#define SPIRV_MAGIC_NUMBER 0x07230203
+#define SHADER_CACHE_MAX_SIZE (256 << 20) // Older entries are removed on startup beyond this.
+
+static String shader_cache_dir;
+static Mutex shader_cache_mutex;
+
+static String _get_shader_cache_path(RenderingDevice::ShaderStage p_stage, const String &p_source_code, RenderingDevice::ShaderLanguage p_language) {
+	String key = itos(SHADER_CACHE_VERSION) + ":" + itos(GLSLANG_VERSION_MAJOR) + "." + itos(GLSLANG_VERSION_MINOR) + "." + itos(GLSLANG_VERSION_PATCH);
+	key += ":" + itos(p_stage) + ":" + itos(p_language) + ":" + p_source_code;
+	return shader_cache_dir.plus_file(key.sha256_text() + ".spv");
+}
+
+static Vector<uint8_t> _get_cached_shader_glsl(RenderingDevice::ShaderStage p_stage, const String &p_source_code, RenderingDevice::ShaderLanguage p_language) {
+	Vector<uint8_t> ret;
+
+	if (shader_cache_dir == String()) {
+		return ret;
+	}
+
+	FileAccess *f = FileAccess::open(_get_shader_cache_path(p_stage, p_source_code, p_language), FileAccess::READ);
+	if (!f) {
+		return ret;
+	}
+
+	uint64_t len = f->get_len();
+	if (len >= sizeof(uint32_t) && len % sizeof(uint32_t) == 0 && len <= INT32_MAX) {
+		ret.resize(len);
+		if (f->get_buffer(ret.ptrw(), int(len)) != int(len) || decode_uint32(ret.ptr()) != SPIRV_MAGIC_NUMBER) {
+			// Truncated or corrupt, compile again and overwrite it.
+			ret.clear();
+		}
+	}
+	f->close();
+	memdelete(f);
+
+	return ret;
+}
+
+static void _store_cached_shader_glsl(RenderingDevice::ShaderStage p_stage, const String &p_source_code, RenderingDevice::ShaderLanguage p_language, const Vector<uint8_t> &p_spirv) {
+	String path = _get_shader_cache_path(p_stage, p_source_code, p_language);
+	String tmp_path = path + ".tmp";
+
+	// Shader versions are compiled from worker threads, write one file at a time
+	// and move it into place so readers never see a partial file.
+	MutexLock lock(shader_cache_mutex);
+
+	DirAccess *da = DirAccess::create_for_path(shader_cache_dir);
+	if (!da) {
+		return;
+	}
+	if (!da->dir_exists(shader_cache_dir) && da->make_dir_recursive(shader_cache_dir) != OK) {
+		WARN_PRINT_ONCE("Can't create shader cache directory '" + shader_cache_dir + "', SPIR-V will not be cached.");
+		memdelete(da);
+		return;
+	}
+
+	FileAccess *f = FileAccess::open(tmp_path, FileAccess::WRITE);
+	if (!f) {
+		memdelete(da);
+		return;
+	}
+	f->store_buffer(p_spirv.ptr(), p_spirv.size());
+	bool ok = f->get_error() == OK;
+	f->close();
+	memdelete(f);
+
+	if (ok) {
+		if (da->file_exists(path)) {
+			da->remove(path);
+		}
+		da->rename(tmp_path, path);
+	} else {
+		da->remove(tmp_path);
+	}
+	memdelete(da);
+}
 
 static Vector<uint8_t> _compile_shader_glsl(RenderingDevice::ShaderStage p_stage, const String &p_source_code, RenderingDevice::ShaderLanguage p_language, String *r_error) {
 	Vector<uint8_t> ret;
@@ -124,11 +209,78 @@ static Vector<uint8_t> _compile_shader_glsl(RenderingDevice::ShaderStage p_stage
 	return ret;
 }
 
+struct ShaderCacheFile {
+	String name;
+	uint64_t modified_time = 0;
+	uint64_t size = 0;
+
+	bool operator<(const ShaderCacheFile &p_other) const {
+		return modified_time > p_other.modified_time; // Newest first.
+	}
+};
+
+static void _prune_shader_cache() {
+	DirAccessRef da = DirAccess::open(shader_cache_dir);
+	if (!da) {
+		return;
+	}
+
+	Vector<ShaderCacheFile> files;
+	da->list_dir_begin();
+	String file = da->get_next();
+	while (file != String()) {
+		if (!da->current_is_dir()) {
+			String path = shader_cache_dir.plus_file(file);
+			if (file.ends_with(".spv")) {
+				ShaderCacheFile cache_file;
+				cache_file.name = file;
+				cache_file.modified_time = FileAccess::get_modified_time(path);
+				FileAccessRef f = FileAccess::open(path, FileAccess::READ);
+				if (f) {
+					cache_file.size = f->get_len();
+				}
+				files.push_back(cache_file);
+			} else if (file.ends_with(".spv.tmp")) {
+				// Left over from an interrupted write, sorts last and is always removed.
+				ShaderCacheFile cache_file;
+				cache_file.name = file;
+				files.push_back(cache_file);
+			}
+		}
+		file = da->get_next();
+	}
+	da->list_dir_end();
+
+	// Old engine versions and edited shaders leave entries behind that are never read
+	// again, keep the most recently written ones within the size limit.
+	files.sort();
+	uint64_t total_size = 0;
+	for (int i = 0; i < files.size(); i++) {
+		total_size += files[i].size;
+		if (files[i].modified_time == 0 || total_size > SHADER_CACHE_MAX_SIZE) {
+			da->remove(files[i].name);
+		}
+	}
+}
+
+static void _setup_shader_cache() {
+	if (GLOBAL_DEF("rendering/shader_compiler/shader_cache/enabled", true)) {
+		shader_cache_dir = "user://shader_cache/spirv";
+		_prune_shader_cache();
+	}
+}
+
 void preregister_glslang_types() {
 	// initialize in case it's not initialized. This is done once per thread
 	// and it's safe to call multiple times
 	glslang::InitializeProcess();
 	RenderingDevice::shader_set_compile_function(_compile_shader_glsl);
+
+	_setup_shader_cache();
+	if (shader_cache_dir != String()) {
+		RenderingDevice::shader_set_cache_function(_get_cached_shader_glsl);
+		RenderingDevice::shader_set_cache_store_function(_store_cached_shader_glsl);
+	}
 }
 
 void register_glslang_types() {
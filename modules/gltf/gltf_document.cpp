@@ -52,6 +52,8 @@
 #include "core/io/json.h"
 #include "core/math/disjoint_set.h"
 #include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "core/templates/thread_work_pool.h"
 #include "core/variant/typed_array.h"
 #include "core/version.h"
 #include "core/version_hash.gen.h"
@@ -771,6 +773,9 @@ Error GLTFDocument::_parse_buffers(Ref<GLTFState> state, const String &p_base_pa
 				int byteLength = buffer["byteLength"];
 				ERR_FAIL_COND_V(byteLength < buffer_data.size(), ERR_PARSE_ERROR);
 				state->buffers.push_back(buffer_data);
+			} else {
+				// No data, e.g. the fallback of compressed buffer views. Keeps the indices of the following buffers.
+				state->buffers.push_back(Vector<uint8_t>());
 			}
 		}
 	}
@@ -837,6 +842,14 @@ Error GLTFDocument::_parse_buffer_views(Ref<GLTFState> state) {
 			buffer_view->indices = target == GLTFDocument::ELEMENT_ARRAY_BUFFER;
 		}
 
+		if (d.has("extensions")) {
+			const Dictionary &extensions = d["extensions"];
+			if (extensions.has("EXT_meshopt_compression")) {
+				const Error err = _decode_meshopt_buffer_view(state, extensions["EXT_meshopt_compression"], buffer_view);
+				ERR_FAIL_COND_V(err != OK, err);
+			}
+		}
+
 		state->buffer_views.push_back(buffer_view);
 	}
 
@@ -845,6 +858,58 @@ Error GLTFDocument::_parse_buffer_views(Ref<GLTFState> state) {
 	return OK;
 }
 
+Error GLTFDocument::_decode_meshopt_buffer_view(Ref<GLTFState> state, const Dictionary &p_compression, Ref<GLTFBufferView> r_buffer_view) {
+	// Ref: https://github.com/KhronosGroup/glTF/tree/master/extensions/2.0/Vendor/EXT_meshopt_compression
+	ERR_FAIL_COND_V_MSG(ArrayMesh::decode_vertex_buffer_func == nullptr, ERR_UNAVAILABLE, "glTF: EXT_meshopt_compression needs the meshoptimizer module.");
+
+	ERR_FAIL_COND_V(!p_compression.has("buffer") || !p_compression.has("byteLength") || !p_compression.has("byteStride") || !p_compression.has("count") || !p_compression.has("mode"), ERR_PARSE_ERROR);
+	const GLTFBufferIndex bi = p_compression["buffer"];
+	const int byte_offset = p_compression.has("byteOffset") ? int(p_compression["byteOffset"]) : 0;
+	const int byte_length = p_compression["byteLength"];
+	const int byte_stride = p_compression["byteStride"];
+	const int count = p_compression["count"];
+	const String mode = p_compression["mode"];
+	const String filter = p_compression.has("filter") ? String(p_compression["filter"]) : String("NONE");
+
+	ERR_FAIL_INDEX_V(bi, state->buffers.size(), ERR_PARAMETER_RANGE_ERROR);
+	ERR_FAIL_COND_V(byte_offset < 0 || byte_length < 0 || byte_offset + byte_length > state->buffers[bi].size(), ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(byte_stride <= 0 || count < 0, ERR_FILE_CORRUPT);
+	const uint8_t *src = state->buffers[bi].ptr() + byte_offset;
+
+	Vector<uint8_t> decoded;
+	decoded.resize(count * byte_stride);
+
+	int res;
+	if (mode == "ATTRIBUTES") {
+		res = ArrayMesh::decode_vertex_buffer_func(decoded.ptrw(), count, byte_stride, src, byte_length);
+	} else if (mode == "TRIANGLES") {
+		res = ArrayMesh::decode_index_buffer_func(decoded.ptrw(), count, byte_stride, src, byte_length);
+	} else if (mode == "INDICES") {
+		res = ArrayMesh::decode_index_sequence_func(decoded.ptrw(), count, byte_stride, src, byte_length);
+	} else {
+		ERR_FAIL_V_MSG(ERR_PARSE_ERROR, "glTF: Unknown EXT_meshopt_compression mode: " + mode + ".");
+	}
+	ERR_FAIL_COND_V_MSG(res != 0, ERR_FILE_CORRUPT, "glTF: Couldn't decode EXT_meshopt_compression buffer view.");
+
+	if (filter == "OCTAHEDRAL") {
+		ArrayMesh::decode_filter_oct_func(decoded.ptrw(), count, byte_stride);
+	} else if (filter == "QUATERNION") {
+		ArrayMesh::decode_filter_quat_func(decoded.ptrw(), count, byte_stride);
+	} else if (filter == "EXPONENTIAL") {
+		ArrayMesh::decode_filter_exp_func(decoded.ptrw(), count, byte_stride);
+	} else {
+		ERR_FAIL_COND_V_MSG(filter != "NONE", ERR_PARSE_ERROR, "glTF: Unknown EXT_meshopt_compression filter: " + filter + ".");
+	}
+
+	// The view now points at the decoded data, instead of its uncompressed fallback.
+	r_buffer_view->buffer = state->buffers.size();
+	r_buffer_view->byte_offset = 0;
+	r_buffer_view->byte_length = decoded.size();
+	state->buffers.push_back(decoded);
+
+	return OK;
+}
+
 Error GLTFDocument::_encode_accessors(Ref<GLTFState> state) {
 	Array accessors;
 	for (GLTFAccessorIndex i = 0; i < state->accessors.size(); i++) {
@@ -2416,378 +2481,422 @@ Error GLTFDocument::_serialize_meshes(Ref<GLTFState> state) {
 	return OK;
 }
 
-Error GLTFDocument::_parse_meshes(Ref<GLTFState> state) {
-	if (!state->json.has("meshes")) {
-		return OK;
-	}
-
-	Array meshes = state->json["meshes"];
-	for (GLTFMeshIndex i = 0; i < meshes.size(); i++) {
-		print_verbose("glTF: Parsing mesh: " + itos(i));
-		Dictionary d = meshes[i];
-
-		Ref<GLTFMesh> mesh;
-		mesh.instance();
-		bool has_vertex_color = false;
-
-		ERR_FAIL_COND_V(!d.has("primitives"), ERR_PARSE_ERROR);
-
-		Array primitives = d["primitives"];
-		const Dictionary &extras = d.has("extras") ? (Dictionary)d["extras"] : Dictionary();
-		Ref<EditorSceneImporterMesh> import_mesh;
-		import_mesh.instance();
-		for (int j = 0; j < primitives.size(); j++) {
-			Dictionary p = primitives[j];
-
-			Array array;
-			array.resize(Mesh::ARRAY_MAX);
-
-			ERR_FAIL_COND_V(!p.has("attributes"), ERR_PARSE_ERROR);
+Error GLTFDocument::_parse_mesh(Ref<GLTFState> state, const Dictionary &d, ParsedMesh &r_mesh) {
+	// Only reads the state, so meshes can be parsed in parallel. Materials are shared, they are assigned afterwards.
+	Ref<GLTFMesh> mesh;
+	mesh.instance();
+	bool has_vertex_color = false;
 
-			Dictionary a = p["attributes"];
+	ERR_FAIL_COND_V(!d.has("primitives"), ERR_PARSE_ERROR);
 
-			Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
-			if (p.has("mode")) {
-				const int mode = p["mode"];
-				ERR_FAIL_INDEX_V(mode, 7, ERR_FILE_CORRUPT);
-				static const Mesh::PrimitiveType primitives2[7] = {
-					Mesh::PRIMITIVE_POINTS,
-					Mesh::PRIMITIVE_LINES,
-					Mesh::PRIMITIVE_LINES, //loop not supported, should ce converted
-					Mesh::PRIMITIVE_LINES,
-					Mesh::PRIMITIVE_TRIANGLES,
-					Mesh::PRIMITIVE_TRIANGLE_STRIP,
-					Mesh::PRIMITIVE_TRIANGLES, //fan not supported, should be converted
+	const Array primitives = d["primitives"];
+	const Dictionary &extras = d.has("extras") ? (Dictionary)d["extras"] : Dictionary();
+	Ref<EditorSceneImporterMesh> import_mesh;
+	import_mesh.instance();
+	for (int j = 0; j < primitives.size(); j++) {
+		const Dictionary &p = primitives[j];
+
+		Array array;
+		array.resize(Mesh::ARRAY_MAX);
+
+		ERR_FAIL_COND_V(!p.has("attributes"), ERR_PARSE_ERROR);
+
+		const Dictionary &a = p["attributes"];
+
+		Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
+		if (p.has("mode")) {
+			const int mode = p["mode"];
+			ERR_FAIL_INDEX_V(mode, 7, ERR_FILE_CORRUPT);
+			static const Mesh::PrimitiveType primitives2[7] = {
+				Mesh::PRIMITIVE_POINTS,
+				Mesh::PRIMITIVE_LINES,
+				Mesh::PRIMITIVE_LINES, //loop not supported, should ce converted
+				Mesh::PRIMITIVE_LINES,
+				Mesh::PRIMITIVE_TRIANGLES,
+				Mesh::PRIMITIVE_TRIANGLE_STRIP,
+				Mesh::PRIMITIVE_TRIANGLES, //fan not supported, should be converted
 #ifndef _MSC_VER
 #warning line loop and triangle fan are not supported and need to be converted to lines and triangles
 #endif
 
-				};
-
-				primitive = primitives2[mode];
-			}
-
-			ERR_FAIL_COND_V(!a.has("POSITION"), ERR_PARSE_ERROR);
-			if (a.has("POSITION")) {
-				array[Mesh::ARRAY_VERTEX] = _decode_accessor_as_vec3(state, a["POSITION"], true);
-			}
-			if (a.has("NORMAL")) {
-				array[Mesh::ARRAY_NORMAL] = _decode_accessor_as_vec3(state, a["NORMAL"], true);
-			}
-			if (a.has("TANGENT")) {
-				array[Mesh::ARRAY_TANGENT] = _decode_accessor_as_floats(state, a["TANGENT"], true);
-			}
-			if (a.has("TEXCOORD_0")) {
-				array[Mesh::ARRAY_TEX_UV] = _decode_accessor_as_vec2(state, a["TEXCOORD_0"], true);
-			}
-			if (a.has("TEXCOORD_1")) {
-				array[Mesh::ARRAY_TEX_UV2] = _decode_accessor_as_vec2(state, a["TEXCOORD_1"], true);
-			}
-			if (a.has("COLOR_0")) {
-				array[Mesh::ARRAY_COLOR] = _decode_accessor_as_color(state, a["COLOR_0"], true);
-				has_vertex_color = true;
-			}
-			if (a.has("JOINTS_0") && !a.has("JOINTS_1")) {
-				array[Mesh::ARRAY_BONES] = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
-			} else if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-				PackedInt32Array joints_0 = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
-				PackedInt32Array joints_1 = _decode_accessor_as_ints(state, a["JOINTS_1"], true);
-				ERR_FAIL_COND_V(joints_0.size() != joints_0.size(), ERR_INVALID_DATA);
-				int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
-				int32_t vertex_count = joints_0.size() / JOINT_GROUP_SIZE;
-				Vector<int> joints;
-				joints.resize(vertex_count * weight_8_count);
-				for (int32_t vertex_i = 0; vertex_i < vertex_count; vertex_i++) {
-					joints.write[vertex_i * weight_8_count + 0] = joints_0[vertex_i * JOINT_GROUP_SIZE + 0];
-					joints.write[vertex_i * weight_8_count + 1] = joints_0[vertex_i * JOINT_GROUP_SIZE + 1];
-					joints.write[vertex_i * weight_8_count + 2] = joints_0[vertex_i * JOINT_GROUP_SIZE + 2];
-					joints.write[vertex_i * weight_8_count + 3] = joints_0[vertex_i * JOINT_GROUP_SIZE + 3];
-					joints.write[vertex_i * weight_8_count + 4] = joints_1[vertex_i * JOINT_GROUP_SIZE + 0];
-					joints.write[vertex_i * weight_8_count + 5] = joints_1[vertex_i * JOINT_GROUP_SIZE + 1];
-					joints.write[vertex_i * weight_8_count + 6] = joints_1[vertex_i * JOINT_GROUP_SIZE + 2];
-					joints.write[vertex_i * weight_8_count + 7] = joints_1[vertex_i * JOINT_GROUP_SIZE + 3];
-				}
-				array[Mesh::ARRAY_BONES] = joints;
-			}
-			if (a.has("WEIGHTS_0") && !a.has("WEIGHTS_1")) {
-				Vector<float> weights = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
-				{ //gltf does not seem to normalize the weights for some reason..
-					int wc = weights.size();
-					float *w = weights.ptrw();
-
-					for (int k = 0; k < wc; k += 4) {
-						float total = 0.0;
-						total += w[k + 0];
-						total += w[k + 1];
-						total += w[k + 2];
-						total += w[k + 3];
-						if (total > 0.0) {
-							w[k + 0] /= total;
-							w[k + 1] /= total;
-							w[k + 2] /= total;
-							w[k + 3] /= total;
-						}
+			};
+
+			primitive = primitives2[mode];
+		}
+
+		ERR_FAIL_COND_V(!a.has("POSITION"), ERR_PARSE_ERROR);
+		if (a.has("POSITION")) {
+			array[Mesh::ARRAY_VERTEX] = _decode_accessor_as_vec3(state, a["POSITION"], true);
+		}
+		if (a.has("NORMAL")) {
+			array[Mesh::ARRAY_NORMAL] = _decode_accessor_as_vec3(state, a["NORMAL"], true);
+		}
+		if (a.has("TANGENT")) {
+			array[Mesh::ARRAY_TANGENT] = _decode_accessor_as_floats(state, a["TANGENT"], true);
+		}
+		if (a.has("TEXCOORD_0")) {
+			array[Mesh::ARRAY_TEX_UV] = _decode_accessor_as_vec2(state, a["TEXCOORD_0"], true);
+		}
+		if (a.has("TEXCOORD_1")) {
+			array[Mesh::ARRAY_TEX_UV2] = _decode_accessor_as_vec2(state, a["TEXCOORD_1"], true);
+		}
+		if (a.has("COLOR_0")) {
+			array[Mesh::ARRAY_COLOR] = _decode_accessor_as_color(state, a["COLOR_0"], true);
+			has_vertex_color = true;
+		}
+		if (a.has("JOINTS_0") && !a.has("JOINTS_1")) {
+			array[Mesh::ARRAY_BONES] = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
+		} else if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+			PackedInt32Array joints_0 = _decode_accessor_as_ints(state, a["JOINTS_0"], true);
+			PackedInt32Array joints_1 = _decode_accessor_as_ints(state, a["JOINTS_1"], true);
+			ERR_FAIL_COND_V(joints_0.size() != joints_0.size(), ERR_INVALID_DATA);
+			int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
+			int32_t vertex_count = joints_0.size() / JOINT_GROUP_SIZE;
+			Vector<int> joints;
+			joints.resize(vertex_count * weight_8_count);
+			for (int32_t vertex_i = 0; vertex_i < vertex_count; vertex_i++) {
+				joints.write[vertex_i * weight_8_count + 0] = joints_0[vertex_i * JOINT_GROUP_SIZE + 0];
+				joints.write[vertex_i * weight_8_count + 1] = joints_0[vertex_i * JOINT_GROUP_SIZE + 1];
+				joints.write[vertex_i * weight_8_count + 2] = joints_0[vertex_i * JOINT_GROUP_SIZE + 2];
+				joints.write[vertex_i * weight_8_count + 3] = joints_0[vertex_i * JOINT_GROUP_SIZE + 3];
+				joints.write[vertex_i * weight_8_count + 4] = joints_1[vertex_i * JOINT_GROUP_SIZE + 0];
+				joints.write[vertex_i * weight_8_count + 5] = joints_1[vertex_i * JOINT_GROUP_SIZE + 1];
+				joints.write[vertex_i * weight_8_count + 6] = joints_1[vertex_i * JOINT_GROUP_SIZE + 2];
+				joints.write[vertex_i * weight_8_count + 7] = joints_1[vertex_i * JOINT_GROUP_SIZE + 3];
+			}
+			array[Mesh::ARRAY_BONES] = joints;
+		}
+		if (a.has("WEIGHTS_0") && !a.has("WEIGHTS_1")) {
+			Vector<float> weights = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
+			{ //gltf does not seem to normalize the weights for some reason..
+				int wc = weights.size();
+				float *w = weights.ptrw();
+
+				for (int k = 0; k < wc; k += 4) {
+					float total = 0.0;
+					total += w[k + 0];
+					total += w[k + 1];
+					total += w[k + 2];
+					total += w[k + 3];
+					if (total > 0.0) {
+						w[k + 0] /= total;
+						w[k + 1] /= total;
+						w[k + 2] /= total;
+						w[k + 3] /= total;
 					}
 				}
-				array[Mesh::ARRAY_WEIGHTS] = weights;
-			} else if (a.has("WEIGHTS_0") && a.has("WEIGHTS_1")) {
-				Vector<float> weights_0 = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
-				Vector<float> weights_1 = _decode_accessor_as_floats(state, a["WEIGHTS_1"], true);
-				Vector<float> weights;
-				ERR_FAIL_COND_V(weights_0.size() != weights_1.size(), ERR_INVALID_DATA);
-				int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
-				int32_t vertex_count = weights_0.size() / JOINT_GROUP_SIZE;
-				weights.resize(vertex_count * weight_8_count);
-				for (int32_t vertex_i = 0; vertex_i < vertex_count; vertex_i++) {
-					weights.write[vertex_i * weight_8_count + 0] = weights_0[vertex_i * JOINT_GROUP_SIZE + 0];
-					weights.write[vertex_i * weight_8_count + 1] = weights_0[vertex_i * JOINT_GROUP_SIZE + 1];
-					weights.write[vertex_i * weight_8_count + 2] = weights_0[vertex_i * JOINT_GROUP_SIZE + 2];
-					weights.write[vertex_i * weight_8_count + 3] = weights_0[vertex_i * JOINT_GROUP_SIZE + 3];
-					weights.write[vertex_i * weight_8_count + 4] = weights_1[vertex_i * JOINT_GROUP_SIZE + 0];
-					weights.write[vertex_i * weight_8_count + 5] = weights_1[vertex_i * JOINT_GROUP_SIZE + 1];
-					weights.write[vertex_i * weight_8_count + 6] = weights_1[vertex_i * JOINT_GROUP_SIZE + 2];
-					weights.write[vertex_i * weight_8_count + 7] = weights_1[vertex_i * JOINT_GROUP_SIZE + 3];
-				}
-				{ //gltf does not seem to normalize the weights for some reason..
-					int wc = weights.size();
-					float *w = weights.ptrw();
-
-					for (int k = 0; k < wc; k += weight_8_count) {
-						float total = 0.0;
-						total += w[k + 0];
-						total += w[k + 1];
-						total += w[k + 2];
-						total += w[k + 3];
-						total += w[k + 4];
-						total += w[k + 5];
-						total += w[k + 6];
-						total += w[k + 7];
-						if (total > 0.0) {
-							w[k + 0] /= total;
-							w[k + 1] /= total;
-							w[k + 2] /= total;
-							w[k + 3] /= total;
-							w[k + 4] /= total;
-							w[k + 5] /= total;
-							w[k + 6] /= total;
-							w[k + 7] /= total;
-						}
+			}
+			array[Mesh::ARRAY_WEIGHTS] = weights;
+		} else if (a.has("WEIGHTS_0") && a.has("WEIGHTS_1")) {
+			Vector<float> weights_0 = _decode_accessor_as_floats(state, a["WEIGHTS_0"], true);
+			Vector<float> weights_1 = _decode_accessor_as_floats(state, a["WEIGHTS_1"], true);
+			Vector<float> weights;
+			ERR_FAIL_COND_V(weights_0.size() != weights_1.size(), ERR_INVALID_DATA);
+			int32_t weight_8_count = JOINT_GROUP_SIZE * 2;
+			int32_t vertex_count = weights_0.size() / JOINT_GROUP_SIZE;
+			weights.resize(vertex_count * weight_8_count);
+			for (int32_t vertex_i = 0; vertex_i < vertex_count; vertex_i++) {
+				weights.write[vertex_i * weight_8_count + 0] = weights_0[vertex_i * JOINT_GROUP_SIZE + 0];
+				weights.write[vertex_i * weight_8_count + 1] = weights_0[vertex_i * JOINT_GROUP_SIZE + 1];
+				weights.write[vertex_i * weight_8_count + 2] = weights_0[vertex_i * JOINT_GROUP_SIZE + 2];
+				weights.write[vertex_i * weight_8_count + 3] = weights_0[vertex_i * JOINT_GROUP_SIZE + 3];
+				weights.write[vertex_i * weight_8_count + 4] = weights_1[vertex_i * JOINT_GROUP_SIZE + 0];
+				weights.write[vertex_i * weight_8_count + 5] = weights_1[vertex_i * JOINT_GROUP_SIZE + 1];
+				weights.write[vertex_i * weight_8_count + 6] = weights_1[vertex_i * JOINT_GROUP_SIZE + 2];
+				weights.write[vertex_i * weight_8_count + 7] = weights_1[vertex_i * JOINT_GROUP_SIZE + 3];
+			}
+			{ //gltf does not seem to normalize the weights for some reason..
+				int wc = weights.size();
+				float *w = weights.ptrw();
+
+				for (int k = 0; k < wc; k += weight_8_count) {
+					float total = 0.0;
+					total += w[k + 0];
+					total += w[k + 1];
+					total += w[k + 2];
+					total += w[k + 3];
+					total += w[k + 4];
+					total += w[k + 5];
+					total += w[k + 6];
+					total += w[k + 7];
+					if (total > 0.0) {
+						w[k + 0] /= total;
+						w[k + 1] /= total;
+						w[k + 2] /= total;
+						w[k + 3] /= total;
+						w[k + 4] /= total;
+						w[k + 5] /= total;
+						w[k + 6] /= total;
+						w[k + 7] /= total;
 					}
 				}
-				array[Mesh::ARRAY_WEIGHTS] = weights;
 			}
+			array[Mesh::ARRAY_WEIGHTS] = weights;
+		}
 
-			if (p.has("indices")) {
-				Vector<int> indices = _decode_accessor_as_ints(state, p["indices"], false);
+		if (p.has("indices")) {
+			Vector<int> indices = _decode_accessor_as_ints(state, p["indices"], false);
 
-				if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
-					//swap around indices, convert ccw to cw for front face
+			if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
+				//swap around indices, convert ccw to cw for front face
 
-					const int is = indices.size();
-					int *w = indices.ptrw();
-					for (int k = 0; k < is; k += 3) {
-						SWAP(w[k + 1], w[k + 2]);
-					}
+				const int is = indices.size();
+				int *w = indices.ptrw();
+				for (int k = 0; k < is; k += 3) {
+					SWAP(w[k + 1], w[k + 2]);
 				}
-				array[Mesh::ARRAY_INDEX] = indices;
-
-			} else if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
-				//generate indices because they need to be swapped for CW/CCW
-				const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
-				ERR_FAIL_COND_V(vertices.size() == 0, ERR_PARSE_ERROR);
-				Vector<int> indices;
-				const int vs = vertices.size();
-				indices.resize(vs);
-				{
-					int *w = indices.ptrw();
-					for (int k = 0; k < vs; k += 3) {
-						w[k] = k;
-						w[k + 1] = k + 2;
-						w[k + 2] = k + 1;
-					}
+			}
+			array[Mesh::ARRAY_INDEX] = indices;
+
+		} else if (primitive == Mesh::PRIMITIVE_TRIANGLES) {
+			//generate indices because they need to be swapped for CW/CCW
+			const Vector<Vector3> &vertices = array[Mesh::ARRAY_VERTEX];
+			ERR_FAIL_COND_V(vertices.size() == 0, ERR_PARSE_ERROR);
+			Vector<int> indices;
+			const int vs = vertices.size();
+			indices.resize(vs);
+			{
+				int *w = indices.ptrw();
+				for (int k = 0; k < vs; k += 3) {
+					w[k] = k;
+					w[k + 1] = k + 2;
+					w[k + 2] = k + 1;
 				}
-				array[Mesh::ARRAY_INDEX] = indices;
 			}
+			array[Mesh::ARRAY_INDEX] = indices;
+		}
 
-			bool generate_tangents = (primitive == Mesh::PRIMITIVE_TRIANGLES && !a.has("TANGENT") && a.has("TEXCOORD_0") && a.has("NORMAL"));
+		bool generate_tangents = (primitive == Mesh::PRIMITIVE_TRIANGLES && !a.has("TANGENT") && a.has("TEXCOORD_0") && a.has("NORMAL"));
 
-			if (generate_tangents) {
-				//must generate mikktspace tangents.. ergh..
-				Ref<SurfaceTool> st;
-				st.instance();
-				if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-					st->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
-				}
-				st->create_from_triangle_arrays(array);
-				st->generate_tangents();
-				array = st->commit_to_arrays();
+		if (generate_tangents) {
+			//must generate mikktspace tangents.. ergh..
+			Ref<SurfaceTool> st;
+			st.instance();
+			if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+				st->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
 			}
+			st->create_from_triangle_arrays(array);
+			st->generate_tangents();
+			array = st->commit_to_arrays();
+		}
 
-			Array morphs;
-			//blend shapes
-			if (p.has("targets")) {
-				print_verbose("glTF: Mesh has targets");
-				const Array &targets = p["targets"];
-
-				//ideally BLEND_SHAPE_MODE_RELATIVE since gltf2 stores in displacement
-				//but it could require a larger refactor?
-				import_mesh->set_blend_shape_mode(Mesh::BLEND_SHAPE_MODE_NORMALIZED);
-
-				if (j == 0) {
-					const Array &target_names = extras.has("targetNames") ? (Array)extras["targetNames"] : Array();
-					for (int k = 0; k < targets.size(); k++) {
-						const String name = k < target_names.size() ? (String)target_names[k] : String("morph_") + itos(k);
-						import_mesh->add_blend_shape(name);
-					}
-				}
+		Array morphs;
+		//blend shapes
+		if (p.has("targets")) {
+			print_verbose("glTF: Mesh has targets");
+			const Array &targets = p["targets"];
+
+			//ideally BLEND_SHAPE_MODE_RELATIVE since gltf2 stores in displacement
+			//but it could require a larger refactor?
+			import_mesh->set_blend_shape_mode(Mesh::BLEND_SHAPE_MODE_NORMALIZED);
 
+			if (j == 0) {
+				const Array &target_names = extras.has("targetNames") ? (Array)extras["targetNames"] : Array();
 				for (int k = 0; k < targets.size(); k++) {
-					const Dictionary &t = targets[k];
+					const String name = k < target_names.size() ? (String)target_names[k] : String("morph_") + itos(k);
+					import_mesh->add_blend_shape(name);
+				}
+			}
 
-					Array array_copy;
-					array_copy.resize(Mesh::ARRAY_MAX);
+			for (int k = 0; k < targets.size(); k++) {
+				const Dictionary &t = targets[k];
 
-					for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
-						array_copy[l] = array[l];
-					}
+				Array array_copy;
+				array_copy.resize(Mesh::ARRAY_MAX);
 
-					array_copy[Mesh::ARRAY_INDEX] = Variant();
+				for (int l = 0; l < Mesh::ARRAY_MAX; l++) {
+					array_copy[l] = array[l];
+				}
 
-					if (t.has("POSITION")) {
-						Vector<Vector3> varr = _decode_accessor_as_vec3(state, t["POSITION"], true);
-						const Vector<Vector3> src_varr = array[Mesh::ARRAY_VERTEX];
-						const int size = src_varr.size();
-						ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
-						{
-							const int max_idx = varr.size();
-							varr.resize(size);
-
-							Vector3 *w_varr = varr.ptrw();
-							const Vector3 *r_varr = varr.ptr();
-							const Vector3 *r_src_varr = src_varr.ptr();
-							for (int l = 0; l < size; l++) {
-								if (l < max_idx) {
-									w_varr[l] = r_varr[l] + r_src_varr[l];
-								} else {
-									w_varr[l] = r_src_varr[l];
-								}
+				array_copy[Mesh::ARRAY_INDEX] = Variant();
+
+				if (t.has("POSITION")) {
+					Vector<Vector3> varr = _decode_accessor_as_vec3(state, t["POSITION"], true);
+					const Vector<Vector3> src_varr = array[Mesh::ARRAY_VERTEX];
+					const int size = src_varr.size();
+					ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
+					{
+						const int max_idx = varr.size();
+						varr.resize(size);
+
+						Vector3 *w_varr = varr.ptrw();
+						const Vector3 *r_varr = varr.ptr();
+						const Vector3 *r_src_varr = src_varr.ptr();
+						for (int l = 0; l < size; l++) {
+							if (l < max_idx) {
+								w_varr[l] = r_varr[l] + r_src_varr[l];
+							} else {
+								w_varr[l] = r_src_varr[l];
 							}
 						}
-						array_copy[Mesh::ARRAY_VERTEX] = varr;
 					}
-					if (t.has("NORMAL")) {
-						Vector<Vector3> narr = _decode_accessor_as_vec3(state, t["NORMAL"], true);
-						const Vector<Vector3> src_narr = array[Mesh::ARRAY_NORMAL];
-						int size = src_narr.size();
-						ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
-						{
-							int max_idx = narr.size();
-							narr.resize(size);
-
-							Vector3 *w_narr = narr.ptrw();
-							const Vector3 *r_narr = narr.ptr();
-							const Vector3 *r_src_narr = src_narr.ptr();
-							for (int l = 0; l < size; l++) {
-								if (l < max_idx) {
-									w_narr[l] = r_narr[l] + r_src_narr[l];
-								} else {
-									w_narr[l] = r_src_narr[l];
-								}
+					array_copy[Mesh::ARRAY_VERTEX] = varr;
+				}
+				if (t.has("NORMAL")) {
+					Vector<Vector3> narr = _decode_accessor_as_vec3(state, t["NORMAL"], true);
+					const Vector<Vector3> src_narr = array[Mesh::ARRAY_NORMAL];
+					int size = src_narr.size();
+					ERR_FAIL_COND_V(size == 0, ERR_PARSE_ERROR);
+					{
+						int max_idx = narr.size();
+						narr.resize(size);
+
+						Vector3 *w_narr = narr.ptrw();
+						const Vector3 *r_narr = narr.ptr();
+						const Vector3 *r_src_narr = src_narr.ptr();
+						for (int l = 0; l < size; l++) {
+							if (l < max_idx) {
+								w_narr[l] = r_narr[l] + r_src_narr[l];
+							} else {
+								w_narr[l] = r_src_narr[l];
 							}
 						}
-						array_copy[Mesh::ARRAY_NORMAL] = narr;
 					}
-					if (t.has("TANGENT")) {
-						const Vector<Vector3> tangents_v3 = _decode_accessor_as_vec3(state, t["TANGENT"], true);
-						const Vector<float> src_tangents = array[Mesh::ARRAY_TANGENT];
-						ERR_FAIL_COND_V(src_tangents.size() == 0, ERR_PARSE_ERROR);
+					array_copy[Mesh::ARRAY_NORMAL] = narr;
+				}
+				if (t.has("TANGENT")) {
+					const Vector<Vector3> tangents_v3 = _decode_accessor_as_vec3(state, t["TANGENT"], true);
+					const Vector<float> src_tangents = array[Mesh::ARRAY_TANGENT];
+					ERR_FAIL_COND_V(src_tangents.size() == 0, ERR_PARSE_ERROR);
 
-						Vector<float> tangents_v4;
+					Vector<float> tangents_v4;
 
-						{
-							int max_idx = tangents_v3.size();
-
-							int size4 = src_tangents.size();
-							tangents_v4.resize(size4);
-							float *w4 = tangents_v4.ptrw();
-
-							const Vector3 *r3 = tangents_v3.ptr();
-							const float *r4 = src_tangents.ptr();
-
-							for (int l = 0; l < size4 / 4; l++) {
-								if (l < max_idx) {
-									w4[l * 4 + 0] = r3[l].x + r4[l * 4 + 0];
-									w4[l * 4 + 1] = r3[l].y + r4[l * 4 + 1];
-									w4[l * 4 + 2] = r3[l].z + r4[l * 4 + 2];
-								} else {
-									w4[l * 4 + 0] = r4[l * 4 + 0];
-									w4[l * 4 + 1] = r4[l * 4 + 1];
-									w4[l * 4 + 2] = r4[l * 4 + 2];
-								}
-								w4[l * 4 + 3] = r4[l * 4 + 3]; //copy flip value
+					{
+						int max_idx = tangents_v3.size();
+
+						int size4 = src_tangents.size();
+						tangents_v4.resize(size4);
+						float *w4 = tangents_v4.ptrw();
+
+						const Vector3 *r3 = tangents_v3.ptr();
+						const float *r4 = src_tangents.ptr();
+
+						for (int l = 0; l < size4 / 4; l++) {
+							if (l < max_idx) {
+								w4[l * 4 + 0] = r3[l].x + r4[l * 4 + 0];
+								w4[l * 4 + 1] = r3[l].y + r4[l * 4 + 1];
+								w4[l * 4 + 2] = r3[l].z + r4[l * 4 + 2];
+							} else {
+								w4[l * 4 + 0] = r4[l * 4 + 0];
+								w4[l * 4 + 1] = r4[l * 4 + 1];
+								w4[l * 4 + 2] = r4[l * 4 + 2];
 							}
+							w4[l * 4 + 3] = r4[l * 4 + 3]; //copy flip value
 						}
-
-						array_copy[Mesh::ARRAY_TANGENT] = tangents_v4;
 					}
 
-					if (generate_tangents) {
-						Ref<SurfaceTool> st;
-						st.instance();
-						if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
-							st->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
-						}
-						st->create_from_triangle_arrays(array_copy);
-						st->deindex();
-						st->generate_tangents();
-						array_copy = st->commit_to_arrays();
-					}
+					array_copy[Mesh::ARRAY_TANGENT] = tangents_v4;
+				}
 
-					morphs.push_back(array_copy);
+				if (generate_tangents) {
+					Ref<SurfaceTool> st;
+					st.instance();
+					if (a.has("JOINTS_0") && a.has("JOINTS_1")) {
+						st->set_skin_weight_count(SurfaceTool::SKIN_8_WEIGHTS);
+					}
+					st->create_from_triangle_arrays(array_copy);
+					st->deindex();
+					st->generate_tangents();
+					array_copy = st->commit_to_arrays();
 				}
+
+				morphs.push_back(array_copy);
 			}
+		}
 
-			//just add it
+		ParsedSurface surface;
+		surface.primitive = primitive;
+		surface.arrays = array;
+		surface.morphs = morphs;
+		if (p.has("material")) {
+			surface.material = p["material"];
+			ERR_FAIL_INDEX_V(surface.material, state->materials.size(), ERR_FILE_CORRUPT);
+		}
+		surface.has_vertex_color = has_vertex_color;
+		r_mesh.surfaces.push_back(surface);
+	}
+
+	Vector<float> blend_weights;
+	blend_weights.resize(import_mesh->get_blend_shape_count());
+	for (int32_t weight_i = 0; weight_i < blend_weights.size(); weight_i++) {
+		blend_weights.write[weight_i] = 0.0f;
+	}
+
+	if (d.has("weights")) {
+		const Array &weights = d["weights"];
+		for (int j = 0; j < weights.size(); j++) {
+			if (j >= blend_weights.size()) {
+				break;
+			}
+			blend_weights.write[j] = weights[j];
+		}
+		mesh->set_blend_weights(blend_weights);
+	}
+	mesh->set_mesh(import_mesh);
+
+	r_mesh.mesh = mesh;
+	r_mesh.import_mesh = import_mesh;
+	return OK;
+
+}
+
+void GLTFDocument::_parse_mesh_job(uint32_t p_index, MeshParseJob *p_job) {
+	print_verbose("glTF: Parsing mesh: " + itos(p_index));
+	const Array &meshes = p_job->meshes;
+	const Dictionary &d = meshes[p_index];
+	ParsedMesh &parsed = p_job->parsed.write[p_index];
+	parsed.error = _parse_mesh(p_job->state, d, parsed);
+}
+
+Error GLTFDocument::_parse_meshes(Ref<GLTFState> state) {
+	if (!state->json.has("meshes")) {
+		return OK;
+	}
+
+	MeshParseJob job;
+	job.state = state;
+	job.meshes = state->json["meshes"];
+	job.parsed.resize(job.meshes.size());
+
+	// Decoding the accessors and generating tangents dominates big imports, and each mesh is independent.
+	int thread_count = OS::get_singleton()->can_use_threads() ? MIN(job.meshes.size(), OS::get_singleton()->get_processor_count()) : 1;
+	if (thread_count > 1) {
+		ThreadWorkPool work_pool;
+		work_pool.init(thread_count);
+		work_pool.do_work(job.meshes.size(), this, &GLTFDocument::_parse_mesh_job, &job);
+		work_pool.finish();
+	} else {
+		for (int i = 0; i < job.meshes.size(); i++) {
+			_parse_mesh_job(i, &job);
+		}
+	}
+
+	for (GLTFMeshIndex i = 0; i < job.parsed.size(); i++) {
+		ParsedMesh &parsed = job.parsed.write[i];
+		ERR_FAIL_COND_V(parsed.error != OK, parsed.error);
+
+		for (int j = 0; j < parsed.surfaces.size(); j++) {
+			const ParsedSurface &surface = parsed.surfaces[j];
 
 			Ref<BaseMaterial3D> mat;
-			if (p.has("material")) {
-				const int material = p["material"];
-				ERR_FAIL_INDEX_V(material, state->materials.size(), ERR_FILE_CORRUPT);
-				Ref<BaseMaterial3D> mat3d = state->materials[material];
-				if (has_vertex_color) {
+			if (surface.material != -1) {
+				Ref<BaseMaterial3D> mat3d = state->materials[surface.material];
+				if (surface.has_vertex_color) {
 					mat3d->set_flag(BaseMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
 				}
 				mat = mat3d;
 
-			} else if (has_vertex_color) {
+			} else if (surface.has_vertex_color) {
 				Ref<StandardMaterial3D> mat3d;
 				mat3d.instance();
 				mat3d->set_flag(BaseMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR, true);
 				mat = mat3d;
 			}
 
-			import_mesh->add_surface(primitive, array, morphs, Dictionary(), mat);
-		}
-
-		Vector<float> blend_weights;
-		blend_weights.resize(import_mesh->get_blend_shape_count());
-		for (int32_t weight_i = 0; weight_i < blend_weights.size(); weight_i++) {
-			blend_weights.write[weight_i] = 0.0f;
-		}
-
-		if (d.has("weights")) {
-			const Array &weights = d["weights"];
-			for (int j = 0; j < weights.size(); j++) {
-				if (j >= blend_weights.size()) {
-					break;
-				}
-				blend_weights.write[j] = weights[j];
-			}
-			mesh->set_blend_weights(blend_weights);
+			parsed.import_mesh->add_surface(surface.primitive, surface.arrays, surface.morphs, Dictionary(), mat);
 		}
-		mesh->set_mesh(import_mesh);
 
-		state->meshes.push_back(mesh);
+		state->meshes.push_back(parsed.mesh);
 	}
 
 	print_verbose("glTF: Total meshes: " + itos(state->meshes.size()));
@@ -2872,6 +2981,9 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_pat
 
 	// Ref: https://github.com/KhronosGroup/glTF/blob/master/specification/2.0/README.md#images
 
+	// The buffers are gathered here, then decoded in parallel, as decoding big PNGs dominates the time spent.
+	ImageDecodeJob job;
+
 	const Array &images = state->json["images"];
 	for (int i = 0; i < images.size(); i++) {
 		const Dictionary &d = images[i];
@@ -2973,34 +3085,47 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_pat
 			data_size = bv->byte_length;
 		}
 
-		Ref<Image> img;
-
-		if (mimetype == "image/png") { // Load buffer as PNG.
+		if (mimetype == "image/png") {
 			ERR_FAIL_COND_V(Image::_png_mem_loader_func == nullptr, ERR_UNAVAILABLE);
-			img = Image::_png_mem_loader_func(data_ptr, data_size);
-		} else if (mimetype == "image/jpeg") { // Loader buffer as JPEG.
+		} else if (mimetype == "image/jpeg") {
 			ERR_FAIL_COND_V(Image::_jpg_mem_loader_func == nullptr, ERR_UNAVAILABLE);
-			img = Image::_jpg_mem_loader_func(data_ptr, data_size);
 		} else {
-			// We can land here if we got an URI with base64-encoded data with application/* MIME type,
-			// and the optional mimeType property was not defined to tell us how to handle this data (or was invalid).
-			// So let's try PNG first, then JPEG.
-			ERR_FAIL_COND_V(Image::_png_mem_loader_func == nullptr, ERR_UNAVAILABLE);
-			img = Image::_png_mem_loader_func(data_ptr, data_size);
-			if (img.is_null()) {
-				ERR_FAIL_COND_V(Image::_jpg_mem_loader_func == nullptr, ERR_UNAVAILABLE);
-				img = Image::_jpg_mem_loader_func(data_ptr, data_size);
-			}
+			ERR_FAIL_COND_V(Image::_png_mem_loader_func == nullptr || Image::_jpg_mem_loader_func == nullptr, ERR_UNAVAILABLE);
 		}
 
-		ERR_FAIL_COND_V_MSG(img.is_null(), ERR_FILE_CORRUPT,
-				vformat("glTF: Couldn't load image index '%d' with its given mimetype: %s.", i, mimetype));
+		ImageDecode decode;
+		decode.index = state->images.size();
+		decode.mimetype = mimetype;
+		decode.data = data; // Keeps embedded and external data alive, buffer views point into the state.
+		decode.data_ptr = data_ptr;
+		decode.data_size = data_size;
+		job.images.push_back(decode);
+
+		state->images.push_back(Ref<Texture2D>()); // Replaced once decoded.
+	}
+
+	int thread_count = OS::get_singleton()->can_use_threads() ? MIN(job.images.size(), OS::get_singleton()->get_processor_count()) : 1;
+	if (thread_count > 1) {
+		ThreadWorkPool work_pool;
+		work_pool.init(thread_count);
+		work_pool.do_work(job.images.size(), this, &GLTFDocument::_decode_image_job, &job);
+		work_pool.finish();
+	} else {
+		for (int i = 0; i < job.images.size(); i++) {
+			_decode_image_job(i, &job);
+		}
+	}
+
+	for (int i = 0; i < job.images.size(); i++) {
+		const ImageDecode &decode = job.images[i];
+		ERR_FAIL_COND_V_MSG(decode.image.is_null(), ERR_FILE_CORRUPT,
+				vformat("glTF: Couldn't load image index '%d' with its given mimetype: %s.", decode.index, decode.mimetype));
 
 		Ref<ImageTexture> t;
 		t.instance();
-		t->create_from_image(img);
+		t->create_from_image(decode.image);
 
-		state->images.push_back(t);
+		state->images.write[decode.index] = t;
 	}
 
 	print_verbose("glTF: Total images: " + itos(state->images.size()));
@@ -3008,6 +3133,24 @@ Error GLTFDocument::_parse_images(Ref<GLTFState> state, const String &p_base_pat
 	return OK;
 }
 
+void GLTFDocument::_decode_image_job(uint32_t p_index, ImageDecodeJob *p_job) {
+	ImageDecode &decode = p_job->images.write[p_index];
+
+	if (decode.mimetype == "image/png") { // Load buffer as PNG.
+		decode.image = Image::_png_mem_loader_func(decode.data_ptr, decode.data_size);
+	} else if (decode.mimetype == "image/jpeg") { // Loader buffer as JPEG.
+		decode.image = Image::_jpg_mem_loader_func(decode.data_ptr, decode.data_size);
+	} else {
+		// We can land here if we got an URI with base64-encoded data with application/* MIME type,
+		// and the optional mimeType property was not defined to tell us how to handle this data (or was invalid).
+		// So let's try PNG first, then JPEG.
+		decode.image = Image::_png_mem_loader_func(decode.data_ptr, decode.data_size);
+		if (decode.image.is_null()) {
+			decode.image = Image::_jpg_mem_loader_func(decode.data_ptr, decode.data_size);
+		}
+	}
+}
+
 Error GLTFDocument::_serialize_textures(Ref<GLTFState> state) {
 	if (!state->textures.size()) {
 		return OK;
@@ -5369,6 +5512,18 @@ void GLTFDocument::_convert_mesh_to_gltf(Node *p_scene_parent, Ref<GLTFState> st
 }
 
 void GLTFDocument::_generate_scene_node(Ref<GLTFState> state, Node *scene_parent, Node3D *scene_root, const GLTFNodeIndex node_index) {
+	Node3D *current_node = _create_scene_node(state, scene_parent, scene_root, node_index);
+	if (!current_node) {
+		return;
+	}
+
+	Ref<GLTFNode> gltf_node = state->nodes[node_index];
+	for (int i = 0; i < gltf_node->children.size(); ++i) {
+		_generate_scene_node(state, current_node, scene_root, gltf_node->children[i]);
+	}
+}
+
+Node3D *GLTFDocument::_create_scene_node(Ref<GLTFState> state, Node *scene_parent, Node3D *scene_root, const GLTFNodeIndex node_index) {
 	Ref<GLTFNode> gltf_node = state->nodes[node_index];
 
 	Node3D *current_node = nullptr;
@@ -5380,7 +5535,7 @@ void GLTFDocument::_generate_scene_node(Ref<GLTFState> state, Node *scene_parent
 		Skeleton3D *skeleton = state->skeletons[gltf_node->skeleton]->godot_skeleton;
 
 		if (active_skeleton != skeleton) {
-			ERR_FAIL_COND_MSG(active_skeleton != nullptr, "glTF: Generating scene detected direct parented Skeletons");
+			ERR_FAIL_COND_V_MSG(active_skeleton != nullptr, nullptr, "glTF: Generating scene detected direct parented Skeletons");
 
 			// Add it to the scene if it has not already been added
 			if (skeleton->get_parent() == nullptr) {
@@ -5432,9 +5587,7 @@ void GLTFDocument::_generate_scene_node(Ref<GLTFState> state, Node *scene_parent
 
 	state->scene_nodes.insert(node_index, current_node);
 
-	for (int i = 0; i < gltf_node->children.size(); ++i) {
-		_generate_scene_node(state, current_node, scene_root, gltf_node->children[i]);
-	}
+	return current_node;
 }
 
 template <class T>
@@ -45,6 +45,8 @@
 #include "scene/resources/material.h"
 #include "scene/resources/texture.h"
 
+class GLTFBufferView;
+class GLTFMesh;
 class GLTFState;
 class GLTFSkin;
 class GLTFNode;
@@ -176,6 +178,7 @@ private:
 	void _compute_node_heights(Ref<GLTFState> state);
 	Error _parse_buffers(Ref<GLTFState> state, const String &p_base_path);
 	Error _parse_buffer_views(Ref<GLTFState> state);
+	Error _decode_meshopt_buffer_view(Ref<GLTFState> state, const Dictionary &p_compression, Ref<GLTFBufferView> r_buffer_view);
 	GLTFType _get_type_from_str(const String &p_string);
 	Error _parse_accessors(Ref<GLTFState> state);
 	Error _decode_buffer_view(Ref<GLTFState> state, double *dst,
@@ -216,10 +219,49 @@ private:
 	Vector<Transform> _decode_accessor_as_xform(Ref<GLTFState> state,
 			const GLTFAccessorIndex p_accessor,
 			const bool p_for_vertex);
+
+	struct ParsedSurface {
+		Mesh::PrimitiveType primitive = Mesh::PRIMITIVE_TRIANGLES;
+		Array arrays;
+		Array morphs;
+		int material = -1;
+		bool has_vertex_color = false;
+	};
+
+	struct ParsedMesh {
+		Ref<GLTFMesh> mesh;
+		Ref<EditorSceneImporterMesh> import_mesh;
+		Vector<ParsedSurface> surfaces;
+		Error error = OK;
+	};
+
+	struct MeshParseJob {
+		Ref<GLTFState> state;
+		Array meshes;
+		Vector<ParsedMesh> parsed;
+	};
+
+	Error _parse_mesh(Ref<GLTFState> state, const Dictionary &d, ParsedMesh &r_mesh);
+	void _parse_mesh_job(uint32_t p_index, MeshParseJob *p_job);
 	Error _parse_meshes(Ref<GLTFState> state);
 	Error _serialize_textures(Ref<GLTFState> state);
 	Error _serialize_images(Ref<GLTFState> state, const String &p_path);
 	Error _serialize_lights(Ref<GLTFState> state);
+
+	struct ImageDecode {
+		int index = 0;
+		String mimetype;
+		Vector<uint8_t> data;
+		const uint8_t *data_ptr = nullptr;
+		int data_size = 0;
+		Ref<Image> image;
+	};
+
+	struct ImageDecodeJob {
+		Vector<ImageDecode> images;
+	};
+
+	void _decode_image_job(uint32_t p_index, ImageDecodeJob *p_job);
 	Error _parse_images(Ref<GLTFState> state, const String &p_base_path);
 	Error _parse_textures(Ref<GLTFState> state);
 	Error _parse_materials(Ref<GLTFState> state);
@@ -364,6 +406,10 @@ public:
 	void _generate_scene_node(Ref<GLTFState> state, Node *scene_parent,
 			Node3D *scene_root,
 			const GLTFNodeIndex node_index);
+	// Creates a single node, without its children, and returns the parent for them.
+	Node3D *_create_scene_node(Ref<GLTFState> state, Node *scene_parent,
+			Node3D *scene_root,
+			const GLTFNodeIndex node_index);
 	void _import_animation(Ref<GLTFState> state, AnimationPlayer *ap,
 			const GLTFAnimationIndex index, const int bake_fps);
 	GLTFMeshIndex _convert_mesh_instance(Ref<GLTFState> state,
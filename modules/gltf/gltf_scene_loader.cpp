@@ -0,0 +1,194 @@
+/*************************************************************************/
+/*  gltf_scene_loader.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#include "gltf_scene_loader.h"
+
+#include "core/os/os.h"
+#include "gltf_state.h"
+
+void GLTFSceneLoader::_parse_thread(void *p_userdata) {
+	GLTFSceneLoader *loader = (GLTFSceneLoader *)p_userdata;
+	loader->parse_error = loader->document->parse(loader->state, loader->path);
+	loader->parsed = true;
+}
+
+Error GLTFSceneLoader::load(const String &p_path, uint32_t p_flags, int p_bake_fps) {
+	ERR_FAIL_COND_V_MSG(status == STATUS_PARSING || status == STATUS_BUILDING, ERR_BUSY, "A glTF scene is already being loaded.");
+	_clear();
+
+	document.instance();
+	state.instance();
+	state->use_named_skin_binds = p_flags & EditorSceneImporter::IMPORT_USE_NAMED_SKIN_BINDS;
+	path = p_path;
+	bake_fps = p_bake_fps;
+
+	parsed = false;
+	parse_error = OK;
+	status = STATUS_PARSING;
+	thread.start(_parse_thread, this);
+	return OK;
+}
+
+void GLTFSceneLoader::_build_step() {
+	if (pending_nodes.size()) {
+		PendingNode pending = pending_nodes[pending_nodes.size() - 1];
+		pending_nodes.resize(pending_nodes.size() - 1);
+
+		Node3D *node = document->_create_scene_node(state, pending.parent, root, pending.index);
+		built_nodes++;
+		if (node) {
+			Ref<GLTFNode> gltf_node = state->nodes[pending.index];
+			const Vector<int> children = gltf_node->get_children();
+			for (int i = children.size() - 1; i >= 0; i--) {
+				PendingNode child;
+				child.index = children[i];
+				child.parent = node;
+				pending_nodes.push_back(child);
+			}
+		}
+		return;
+	}
+
+	if (!mesh_instances_processed) {
+		document->_process_mesh_instances(state, root);
+		mesh_instances_processed = true;
+		return;
+	}
+
+	if (imported_animations < state->animations.size()) {
+		if (!animation_player) {
+			animation_player = memnew(AnimationPlayer);
+			root->add_child(animation_player);
+			animation_player->set_owner(root);
+		}
+		document->_import_animation(state, animation_player, imported_animations, bake_fps);
+		imported_animations++;
+		return;
+	}
+
+	status = STATUS_LOADED;
+}
+
+GLTFSceneLoader::Status GLTFSceneLoader::poll(int p_usec_budget) {
+	if (status == STATUS_PARSING) {
+		if (!parsed) {
+			return status;
+		}
+		thread.wait_to_finish();
+
+		if (parse_error != OK) {
+			status = STATUS_FAILED;
+			return status;
+		}
+
+		root = memnew(Node3D);
+		for (int i = state->root_nodes.size() - 1; i >= 0; i--) {
+			PendingNode pending;
+			pending.index = state->root_nodes[i];
+			pending.parent = root;
+			pending_nodes.push_back(pending);
+		}
+		status = STATUS_BUILDING;
+	}
+
+	if (status == STATUS_BUILDING) {
+		// Always make progress, even with a budget too small for a single step.
+		const uint64_t end = OS::get_singleton()->get_ticks_usec() + p_usec_budget;
+		do {
+			_build_step();
+		} while (status == STATUS_BUILDING && OS::get_singleton()->get_ticks_usec() < end);
+	}
+
+	return status;
+}
+
+float GLTFSceneLoader::get_progress() const {
+	switch (status) {
+		case STATUS_IDLE:
+		case STATUS_PARSING:
+		case STATUS_FAILED: {
+			return 0.0;
+		}
+		case STATUS_BUILDING: {
+			// Parsing is counted as the first half.
+			const int steps = state->nodes.size() + 1 + state->animations.size();
+			const int done = built_nodes + (mesh_instances_processed ? 1 : 0) + imported_animations;
+			return 0.5 + 0.5 * done / MAX(steps, 1);
+		}
+		case STATUS_LOADED: {
+			return 1.0;
+		}
+	}
+	return 0.0;
+}
+
+Node *GLTFSceneLoader::take_scene() {
+	ERR_FAIL_COND_V_MSG(status != STATUS_LOADED, nullptr, "The glTF scene is not loaded yet.");
+	Node *scene = root;
+	root = nullptr;
+	status = STATUS_IDLE;
+	return scene;
+}
+
+void GLTFSceneLoader::_clear() {
+	if (thread.is_started()) {
+		thread.wait_to_finish();
+	}
+	if (root) {
+		memdelete(root);
+		root = nullptr;
+	}
+	pending_nodes.clear();
+	built_nodes = 0;
+	mesh_instances_processed = false;
+	animation_player = nullptr;
+	imported_animations = 0;
+	status = STATUS_IDLE;
+}
+
+void GLTFSceneLoader::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("load", "path", "flags", "bake_fps"), &GLTFSceneLoader::load, DEFVAL(0), DEFVAL(30));
+	ClassDB::bind_method(D_METHOD("poll", "usec_budget"), &GLTFSceneLoader::poll, DEFVAL(2000));
+	ClassDB::bind_method(D_METHOD("get_status"), &GLTFSceneLoader::get_status);
+	ClassDB::bind_method(D_METHOD("get_progress"), &GLTFSceneLoader::get_progress);
+	ClassDB::bind_method(D_METHOD("get_state"), &GLTFSceneLoader::get_state);
+	ClassDB::bind_method(D_METHOD("take_scene"), &GLTFSceneLoader::take_scene);
+
+	BIND_ENUM_CONSTANT(STATUS_IDLE);
+	BIND_ENUM_CONSTANT(STATUS_PARSING);
+	BIND_ENUM_CONSTANT(STATUS_BUILDING);
+	BIND_ENUM_CONSTANT(STATUS_LOADED);
+	BIND_ENUM_CONSTANT(STATUS_FAILED);
+}
+
+GLTFSceneLoader::~GLTFSceneLoader() {
+	_clear();
+}
@@ -0,0 +1,98 @@
+/*************************************************************************/
+/*  gltf_scene_loader.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef GLTF_SCENE_LOADER_H
+#define GLTF_SCENE_LOADER_H
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "gltf_document.h"
+
+class GLTFState;
+
+// Loads a glTF scene without stalling the caller. The file is parsed on a thread, then poll() builds the
+// nodes on the calling thread, spending at most the given time per call so it can be spread over frames.
+class GLTFSceneLoader : public Reference {
+	GDCLASS(GLTFSceneLoader, Reference);
+
+public:
+	enum Status {
+		STATUS_IDLE,
+		STATUS_PARSING,
+		STATUS_BUILDING,
+		STATUS_LOADED,
+		STATUS_FAILED,
+	};
+
+private:
+	struct PendingNode {
+		GLTFNodeIndex index = -1;
+		Node *parent = nullptr;
+	};
+
+	Ref<GLTFDocument> document;
+	Ref<GLTFState> state;
+	String path;
+	int bake_fps = 30;
+
+	Thread thread;
+	volatile bool parsed = false;
+	Error parse_error = OK;
+	Status status = STATUS_IDLE;
+
+	Node3D *root = nullptr;
+	LocalVector<PendingNode> pending_nodes; // Stack, so nodes are created depth first like the importer does.
+	int built_nodes = 0;
+	bool mesh_instances_processed = false;
+	AnimationPlayer *animation_player = nullptr;
+	int imported_animations = 0;
+
+	static void _parse_thread(void *p_userdata);
+	void _build_step();
+	void _clear();
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error load(const String &p_path, uint32_t p_flags = 0, int p_bake_fps = 30);
+	Status poll(int p_usec_budget = 2000);
+	Status get_status() const { return status; }
+	float get_progress() const;
+	Ref<GLTFState> get_state() const { return state; }
+	Node *take_scene();
+
+	~GLTFSceneLoader();
+};
+
+VARIANT_ENUM_CAST(GLTFSceneLoader::Status);
+
+#endif // GLTF_SCENE_LOADER_H
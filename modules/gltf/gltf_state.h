@@ -52,6 +52,7 @@ class GLTFState : public Resource {
 	GDCLASS(GLTFState, Resource);
 	friend class GLTFDocument;
 	friend class PackedSceneGLTF;
+	friend class GLTFSceneLoader;
 
 	Dictionary json;
 	int major_version = 0;
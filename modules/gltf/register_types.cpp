@@ -41,6 +41,7 @@
 #include "gltf_light.h"
 #include "gltf_mesh.h"
 #include "gltf_node.h"
+#include "gltf_scene_loader.h"
 #include "gltf_skeleton.h"
 #include "gltf_skin.h"
 #include "gltf_spec_gloss.h"
@@ -81,6 +82,7 @@ void register_gltf_types() {
 	ClassDB::register_class<GLTFState>();
 	ClassDB::register_class<GLTFDocument>();
 	ClassDB::register_class<PackedSceneGLTF>();
+	ClassDB::register_class<GLTFSceneLoader>();
 #endif
 }
 
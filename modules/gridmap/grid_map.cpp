@@ -298,6 +298,14 @@ void GridMap::set_cell_item(const Vector3i &p_position, int p_item, int p_rot) {
 			RenderingServer::get_singleton()->instance_set_base(g->collision_debug_instance, g->collision_debug);
 		}
 
+		if (_is_streaming()) {
+			// Built by _update_streaming() within the per-frame budget.
+			g->active = false;
+			if (streaming_range.has(octantkey)) {
+				streaming_pending.push_back(octantkey);
+			}
+		}
+
 		octant_map[octantkey] = g;
 
 		if (is_inside_world()) {
@@ -388,54 +396,45 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		return false;
 	}
 
-	//erase body shapes
-	PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
-
-	//erase body shapes debug
-	if (g.collision_debug.is_valid()) {
-		RS::get_singleton()->mesh_clear(g.collision_debug);
-	}
-
-	//erase navigation
-	for (Map<IndexKey, Octant::NavMesh>::Element *E = g.navmesh_ids.front(); E; E = E->next()) {
-		NavigationServer3D::get_singleton()->free(E->get().region);
-	}
-	g.navmesh_ids.clear();
-
-	//erase multimeshes
-
-	for (int i = 0; i < g.multimesh_instances.size(); i++) {
-		RS::get_singleton()->free(g.multimesh_instances[i].instance);
-		RS::get_singleton()->free(g.multimesh_instances[i].multimesh);
+	if (!g.active && g.cells.size()) {
+		// Streamed out, its resources were already freed.
+		return false;
 	}
-	g.multimesh_instances.clear();
 
 	if (g.cells.size() == 0) {
 		//octant no longer needed
+		_octant_free_resources(g);
 		_octant_clean_up(p_key);
 		return true;
 	}
 
-	Vector<Vector3> col_debug;
+	OctantBuild build;
+	build.key = p_key;
+	_octant_build(build);
+	_octant_apply(build);
+
+	return false;
+}
+
+void GridMap::_octant_build(OctantBuild &r_build) const {
+	const Octant &g = *octant_map[r_build.key];
+	Vector3 ofs = _get_offset();
 
 	/*
 	 * foreach item in this octant,
-	 * set item's multimesh's instance count to number of cells which have this item
-	 * and set said multimesh bounding box to one containing all cells which have this item
+	 * fill the item's multimesh buffer with the transforms of the cells which have this item
 	 */
 
-	Map<int, List<Pair<Transform, IndexKey>>> multimesh_items;
-
 	for (Set<IndexKey>::Element *E = g.cells.front(); E; E = E->next()) {
-		ERR_CONTINUE(!cell_map.has(E->get()));
-		const Cell &c = cell_map[E->get()];
+		const Map<IndexKey, Cell>::Element *C = cell_map.find(E->get());
+		ERR_CONTINUE(!C);
+		const Cell &c = C->get();
 
 		if (!mesh_library.is_valid() || !mesh_library->has_item(c.item)) {
 			continue;
 		}
 
 		Vector3 cellpos = Vector3(E->get().x, E->get().y, E->get().z);
-		Vector3 ofs = _get_offset();
 
 		Transform xform;
 
@@ -444,86 +443,68 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
 		if (baked_meshes.size() == 0) {
 			if (mesh_library->get_item_mesh(c.item).is_valid()) {
-				if (!multimesh_items.has(c.item)) {
-					multimesh_items[c.item] = List<Pair<Transform, IndexKey>>();
+				OctantBuild::Multimesh &mm = r_build.multimeshes[c.item];
+#ifdef TOOLS_ENABLED
+				Octant::MultimeshInstance::Item it;
+				it.index = mm.buffer.size() / 12;
+				it.transform = xform;
+				it.key = E->get();
+				mm.items.push_back(it);
+#endif
+				int from = mm.buffer.size();
+				mm.buffer.resize(from + 12);
+				float *w = mm.buffer.ptrw() + from;
+				for (int i = 0; i < 3; i++) {
+					w[i * 4 + 0] = xform.basis.elements[i][0];
+					w[i * 4 + 1] = xform.basis.elements[i][1];
+					w[i * 4 + 2] = xform.basis.elements[i][2];
+					w[i * 4 + 3] = xform.origin[i];
 				}
-
-				Pair<Transform, IndexKey> p;
-				p.first = xform;
-				p.second = E->get();
-				multimesh_items[c.item].push_back(p);
 			}
 		}
 
 		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
-		// add the item's shape at given xform to octant's static_body
 		for (int i = 0; i < shapes.size(); i++) {
-			// add the item's shape
 			if (!shapes[i].shape.is_valid()) {
 				continue;
 			}
-			PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shapes[i].shape->get_rid(), xform * shapes[i].local_transform);
-			if (g.collision_debug.is_valid()) {
-				shapes.write[i].shape->add_vertices_to_array(col_debug, xform * shapes[i].local_transform);
-			}
+			MeshLibrary::ShapeData shape;
+			shape.shape = shapes[i].shape;
+			shape.local_transform = xform * shapes[i].local_transform;
+			r_build.shapes.push_back(shape);
 		}
 
-		// add the item's navmesh at given xform to GridMap's Navigation ancestor
 		Ref<NavigationMesh> navmesh = mesh_library->get_item_navmesh(c.item);
 		if (navmesh.is_valid()) {
 			Octant::NavMesh nm;
+			nm.navmesh = navmesh;
 			nm.xform = xform * mesh_library->get_item_navmesh_transform(c.item);
-
-			if (navigation) {
-				RID region = NavigationServer3D::get_singleton()->region_create();
-				NavigationServer3D::get_singleton()->region_set_navmesh(region, navmesh);
-				NavigationServer3D::get_singleton()->region_set_transform(region, navigation->get_global_transform() * nm.xform);
-				NavigationServer3D::get_singleton()->region_set_map(region, navigation->get_rid());
-				nm.region = region;
-			}
-			g.navmesh_ids[E->get()] = nm;
+			r_build.navmeshes[E->get()] = nm;
 		}
 	}
+}
 
-	//update multimeshes, only if not baked
-	if (baked_meshes.size() == 0) {
-		for (Map<int, List<Pair<Transform, IndexKey>>>::Element *E = multimesh_items.front(); E; E = E->next()) {
-			Octant::MultimeshInstance mmi;
-
-			RID mm = RS::get_singleton()->multimesh_create();
-			RS::get_singleton()->multimesh_allocate_data(mm, E->get().size(), RS::MULTIMESH_TRANSFORM_3D);
-			RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E->key())->get_rid());
-
-			int idx = 0;
-			for (List<Pair<Transform, IndexKey>>::Element *F = E->get().front(); F; F = F->next()) {
-				RS::get_singleton()->multimesh_instance_set_transform(mm, idx, F->get().first);
-#ifdef TOOLS_ENABLED
-
-				Octant::MultimeshInstance::Item it;
-				it.index = idx;
-				it.transform = F->get().first;
-				it.key = F->get().second;
-				mmi.items.push_back(it);
-#endif
-
-				idx++;
-			}
-
-			RID instance = RS::get_singleton()->instance_create();
-			RS::get_singleton()->instance_set_base(instance, mm);
-
-			if (is_inside_tree()) {
-				RS::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
-				RS::get_singleton()->instance_set_transform(instance, get_global_transform());
-			}
+void GridMap::_octant_build_job(uint32_t p_index, OctantBuild *p_builds) {
+	_octant_build(p_builds[p_index]);
+}
 
-			mmi.multimesh = mm;
-			mmi.instance = instance;
+void GridMap::_octant_apply(OctantBuild &p_build) {
+	Octant &g = *octant_map[p_build.key];
 
-			g.multimesh_instances.push_back(mmi);
+	// add the items' shapes to octant's static_body
+	PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
+	Vector<Vector3> col_debug;
+	for (int i = 0; i < p_build.shapes.size(); i++) {
+		Ref<Shape3D> shape = p_build.shapes[i].shape;
+		PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shape->get_rid(), p_build.shapes[i].local_transform);
+		if (g.collision_debug.is_valid()) {
+			shape->add_vertices_to_array(col_debug, p_build.shapes[i].local_transform);
 		}
 	}
 
+	if (g.collision_debug.is_valid()) {
+		RS::get_singleton()->mesh_clear(g.collision_debug);
+	}
 	if (col_debug.size()) {
 		Array arr;
 		arr.resize(RS::ARRAY_MAX);
@@ -536,9 +517,108 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 		}
 	}
 
+	// Keep the navigation regions of cells whose navmesh didn't change, recreate the others.
+	for (Map<IndexKey, Octant::NavMesh>::Element *E = g.navmesh_ids.front(); E; E = E->next()) {
+		if (!E->get().region.is_valid()) {
+			continue;
+		}
+		Map<IndexKey, Octant::NavMesh>::Element *F = p_build.navmeshes.find(E->key());
+		if (F && F->get().navmesh == E->get().navmesh && F->get().xform == E->get().xform) {
+			F->get().region = E->get().region;
+		} else {
+			NavigationServer3D::get_singleton()->free(E->get().region);
+		}
+	}
+	g.navmesh_ids = p_build.navmeshes;
+	if (navigation) {
+		for (Map<IndexKey, Octant::NavMesh>::Element *E = g.navmesh_ids.front(); E; E = E->next()) {
+			if (E->get().region.is_valid()) {
+				continue;
+			}
+			RID region = NavigationServer3D::get_singleton()->region_create();
+			NavigationServer3D::get_singleton()->region_set_navmesh(region, E->get().navmesh);
+			NavigationServer3D::get_singleton()->region_set_transform(region, navigation->get_global_transform() * E->get().xform);
+			NavigationServer3D::get_singleton()->region_set_map(region, navigation->get_rid());
+			E->get().region = region;
+		}
+	}
+
+	// Reuse the multimeshes of items still in the octant, their whole buffer is replaced at once.
+	Vector<Octant::MultimeshInstance> multimesh_instances;
+	for (int i = 0; i < g.multimesh_instances.size(); i++) {
+		const Octant::MultimeshInstance &mmi = g.multimesh_instances[i];
+		if (p_build.multimeshes.has(mmi.item)) {
+			multimesh_instances.push_back(mmi);
+		} else {
+			RS::get_singleton()->free(mmi.instance);
+			RS::get_singleton()->free(mmi.multimesh);
+		}
+	}
+
+	for (Map<int, OctantBuild::Multimesh>::Element *E = p_build.multimeshes.front(); E; E = E->next()) {
+		int index = -1;
+		for (int i = 0; i < multimesh_instances.size(); i++) {
+			if (multimesh_instances[i].item == E->key()) {
+				index = i;
+				break;
+			}
+		}
+
+		int instance_count = E->get().buffer.size() / 12;
+		if (index == -1) {
+			Octant::MultimeshInstance mmi;
+			mmi.item = E->key();
+			mmi.instance_count = instance_count;
+			mmi.multimesh = RS::get_singleton()->multimesh_create();
+			RS::get_singleton()->multimesh_allocate_data(mmi.multimesh, instance_count, RS::MULTIMESH_TRANSFORM_3D);
+			RS::get_singleton()->multimesh_set_mesh(mmi.multimesh, mesh_library->get_item_mesh(E->key())->get_rid());
+
+			mmi.instance = RS::get_singleton()->instance_create();
+			RS::get_singleton()->instance_set_base(mmi.instance, mmi.multimesh);
+			if (is_inside_tree()) {
+				RS::get_singleton()->instance_set_scenario(mmi.instance, get_world_3d()->get_scenario());
+				RS::get_singleton()->instance_set_transform(mmi.instance, get_global_transform());
+			}
+
+			index = multimesh_instances.size();
+			multimesh_instances.push_back(mmi);
+		} else if (multimesh_instances[index].instance_count != instance_count) {
+			multimesh_instances.write[index].instance_count = instance_count;
+			RS::get_singleton()->multimesh_allocate_data(multimesh_instances[index].multimesh, instance_count, RS::MULTIMESH_TRANSFORM_3D);
+		}
+
+		RS::get_singleton()->multimesh_set_buffer(multimesh_instances[index].multimesh, E->get().buffer);
+#ifdef TOOLS_ENABLED
+		multimesh_instances.write[index].items = E->get().items;
+#endif
+	}
+	g.multimesh_instances = multimesh_instances;
+
 	g.dirty = false;
+}
 
-	return false;
+void GridMap::_octant_free_resources(Octant &p_octant) {
+	//erase body shapes
+	PhysicsServer3D::get_singleton()->body_clear_shapes(p_octant.static_body);
+
+	//erase body shapes debug
+	if (p_octant.collision_debug.is_valid()) {
+		RS::get_singleton()->mesh_clear(p_octant.collision_debug);
+	}
+
+	//erase navigation
+	for (Map<IndexKey, Octant::NavMesh>::Element *E = p_octant.navmesh_ids.front(); E; E = E->next()) {
+		NavigationServer3D::get_singleton()->free(E->get().region);
+	}
+	p_octant.navmesh_ids.clear();
+
+	//erase multimeshes
+
+	for (int i = 0; i < p_octant.multimesh_instances.size(); i++) {
+		RS::get_singleton()->free(p_octant.multimesh_instances[i].instance);
+		RS::get_singleton()->free(p_octant.multimesh_instances[i].multimesh);
+	}
+	p_octant.multimesh_instances.clear();
 }
 
 void GridMap::_reset_physic_bodies_collision_filters() {
@@ -668,6 +748,7 @@ void GridMap::_notification(int p_what) {
 			}
 
 			last_transform = new_xform;
+			streaming_dirty = true;
 
 			for (int i = 0; i < baked_meshes.size(); i++) {
 				RS::get_singleton()->instance_set_transform(baked_meshes[i].instance, get_global_transform());
@@ -692,6 +773,9 @@ void GridMap::_notification(int p_what) {
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			_update_visibility();
 		} break;
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			_update_streaming();
+		} break;
 	}
 }
 
@@ -740,6 +824,7 @@ void GridMap::_clear_internal() {
 
 	octant_map.clear();
 	cell_map.clear();
+	streaming_pending.clear();
 }
 
 void GridMap::clear() {
@@ -757,11 +842,34 @@ void GridMap::_update_octants_callback() {
 	}
 
 	List<OctantKey> to_delete;
+	LocalVector<OctantBuild> builds;
 	for (Map<OctantKey, Octant *>::Element *E = octant_map.front(); E; E = E->next()) {
-		if (_octant_update(E->key())) {
-			to_delete.push_back(E->key());
+		const Octant &g = *E->get();
+		if (!g.dirty || (!g.active && g.cells.size())) {
+			continue;
+		}
+		if (g.cells.size() == 0) {
+			if (_octant_update(E->key())) {
+				to_delete.push_back(E->key());
+			}
+			continue;
+		}
+		builds.push_back(OctantBuild());
+		builds[builds.size() - 1].key = E->key();
+	}
+
+	// Building only reads the cells and the mesh library, so several octants are built at once.
+	// Applying touches the servers and stays on this thread.
+	if (builds.size() > 1 && is_inside_tree()) {
+		get_tree()->do_threaded_work(builds.size(), this, &GridMap::_octant_build_job, builds.ptr());
+	} else {
+		for (uint32_t i = 0; i < builds.size(); i++) {
+			_octant_build(builds[i]);
 		}
 	}
+	for (uint32_t i = 0; i < builds.size(); i++) {
+		_octant_apply(builds[i]);
+	}
 
 	while (to_delete.front()) {
 		octant_map.erase(to_delete.front()->get());
@@ -820,6 +928,19 @@ void GridMap::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_used_cells"), &GridMap::get_used_cells);
 
+	ClassDB::bind_method(D_METHOD("set_streaming_enabled", "enabled"), &GridMap::set_streaming_enabled);
+	ClassDB::bind_method(D_METHOD("is_streaming_enabled"), &GridMap::is_streaming_enabled);
+	ClassDB::bind_method(D_METHOD("set_streaming_focus", "focus"), &GridMap::set_streaming_focus);
+	ClassDB::bind_method(D_METHOD("get_streaming_focus"), &GridMap::get_streaming_focus);
+	ClassDB::bind_method(D_METHOD("set_streaming_radius", "radius"), &GridMap::set_streaming_radius);
+	ClassDB::bind_method(D_METHOD("get_streaming_radius"), &GridMap::get_streaming_radius);
+	ClassDB::bind_method(D_METHOD("set_streaming_octants_per_frame", "count"), &GridMap::set_streaming_octants_per_frame);
+	ClassDB::bind_method(D_METHOD("get_streaming_octants_per_frame"), &GridMap::get_streaming_octants_per_frame);
+
+	ClassDB::bind_method(D_METHOD("get_octant_data", "octant"), &GridMap::get_octant_data);
+	ClassDB::bind_method(D_METHOD("set_octant_data", "octant", "data"), &GridMap::set_octant_data);
+	ClassDB::bind_method(D_METHOD("erase_octant", "octant"), &GridMap::erase_octant);
+
 	ClassDB::bind_method(D_METHOD("get_meshes"), &GridMap::get_meshes);
 	ClassDB::bind_method(D_METHOD("get_bake_meshes"), &GridMap::get_bake_meshes);
 	ClassDB::bind_method(D_METHOD("get_bake_mesh_instance", "idx"), &GridMap::get_bake_mesh_instance);
@@ -838,10 +959,17 @@ void GridMap::_bind_methods() {
 	ADD_GROUP("Collision", "collision_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_layer", PROPERTY_HINT_LAYERS_3D_PHYSICS), "set_collision_layer", "get_collision_layer");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_mask", PROPERTY_HINT_LAYERS_3D_PHYSICS), "set_collision_mask", "get_collision_mask");
+	ADD_GROUP("Streaming", "streaming_");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "streaming_enabled"), "set_streaming_enabled", "is_streaming_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::VECTOR3, "streaming_focus"), "set_streaming_focus", "get_streaming_focus");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "streaming_radius", PROPERTY_HINT_RANGE, "0,4096,0.1,or_greater"), "set_streaming_radius", "get_streaming_radius");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "streaming_octants_per_frame", PROPERTY_HINT_RANGE, "1,256,1,or_greater"), "set_streaming_octants_per_frame", "get_streaming_octants_per_frame");
 
 	BIND_CONSTANT(INVALID_CELL_ITEM);
 
 	ADD_SIGNAL(MethodInfo("cell_size_changed", PropertyInfo(Variant::VECTOR3, "cell_size")));
+	ADD_SIGNAL(MethodInfo("octant_entered_streaming_range", PropertyInfo(Variant::VECTOR3I, "octant")));
+	ADD_SIGNAL(MethodInfo("octant_exited_streaming_range", PropertyInfo(Variant::VECTOR3I, "octant")));
 }
 
 void GridMap::set_clip(bool p_enabled, bool p_clip_above, int p_floor, Vector3::Axis p_axis) {
@@ -887,6 +1015,265 @@ Array GridMap::get_used_cells() const {
 	return a;
 }
 
+AABB GridMap::_octant_get_aabb(const OctantKey &p_key) const {
+	// Cells are assigned to octants by truncating division, so octant 0 spans
+	// both sides of the origin on each axis.
+	const int keys[3] = { p_key.x, p_key.y, p_key.z };
+	Vector3 from;
+	Vector3 to;
+	for (int i = 0; i < 3; i++) {
+		int first = keys[i] > 0 ? keys[i] * octant_size : keys[i] * octant_size - octant_size + 1;
+		int last = keys[i] < 0 ? keys[i] * octant_size : keys[i] * octant_size + octant_size - 1;
+		from[i] = first * cell_size[i];
+		to[i] = (last + 1) * cell_size[i];
+	}
+	return AABB(from, to - from);
+}
+
+float GridMap::_octant_get_distance(const OctantKey &p_key, const Vector3 &p_point) const {
+	AABB aabb = _octant_get_aabb(p_key);
+	Vector3 end = aabb.position + aabb.size;
+	Vector3 d;
+	for (int i = 0; i < 3; i++) {
+		d[i] = MAX(MAX(aabb.position[i] - p_point[i], p_point[i] - end[i]), 0);
+	}
+	return d.length();
+}
+
+Vector3 GridMap::_get_streaming_local_focus() const {
+	if (!is_inside_tree()) {
+		return streaming_focus;
+	}
+	return get_global_transform().affine_inverse().xform(streaming_focus);
+}
+
+void GridMap::_octant_stream_out(const OctantKey &p_key) {
+	Octant &g = *octant_map[p_key];
+	if (!g.active) {
+		return;
+	}
+	_octant_free_resources(g);
+	g.active = false;
+	g.dirty = true;
+}
+
+void GridMap::_update_streaming_range() {
+	streaming_dirty = false;
+
+	Vector3 focus = _get_streaming_local_focus();
+	Vector3 radius(streaming_radius, streaming_radius, streaming_radius);
+	Vector3i from = world_to_map(focus - radius);
+	Vector3i to = world_to_map(focus + radius);
+
+	Set<OctantKey> range;
+	for (int x = from.x / octant_size; x <= to.x / octant_size; x++) {
+		for (int y = from.y / octant_size; y <= to.y / octant_size; y++) {
+			for (int z = from.z / octant_size; z <= to.z / octant_size; z++) {
+				OctantKey ok;
+				ok.x = x;
+				ok.y = y;
+				ok.z = z;
+				if (_octant_get_distance(ok, focus) <= streaming_radius) {
+					range.insert(ok);
+				}
+			}
+		}
+	}
+
+	List<OctantKey> exited;
+	for (Set<OctantKey>::Element *E = streaming_range.front(); E; E = E->next()) {
+		if (!range.has(E->get())) {
+			exited.push_back(E->get());
+		}
+	}
+	List<OctantKey> entered;
+	for (Set<OctantKey>::Element *E = range.front(); E; E = E->next()) {
+		if (!streaming_range.has(E->get())) {
+			entered.push_back(E->get());
+		}
+	}
+
+	// Update the range before emitting, so octants created from the signal
+	// callbacks are queued for building right away.
+	streaming_range = range;
+
+	for (List<OctantKey>::Element *E = exited.front(); E; E = E->next()) {
+		if (octant_map.has(E->get())) {
+			_octant_stream_out(E->get());
+		}
+	}
+	for (List<OctantKey>::Element *E = entered.front(); E; E = E->next()) {
+		if (octant_map.has(E->get()) && !octant_map[E->get()]->active) {
+			streaming_pending.push_back(E->get());
+		}
+	}
+
+	for (List<OctantKey>::Element *E = exited.front(); E; E = E->next()) {
+		emit_signal("octant_exited_streaming_range", Vector3i(E->get().x, E->get().y, E->get().z));
+	}
+	for (List<OctantKey>::Element *E = entered.front(); E; E = E->next()) {
+		emit_signal("octant_entered_streaming_range", Vector3i(E->get().x, E->get().y, E->get().z));
+	}
+}
+
+void GridMap::_update_streaming() {
+	if (!_is_streaming()) {
+		return;
+	}
+
+	if (streaming_dirty) {
+		_update_streaming_range();
+	}
+
+	if (streaming_pending.is_empty()) {
+		return;
+	}
+
+	// Build the closest pending octants first, a few per frame.
+	Vector3 focus = _get_streaming_local_focus();
+	bool built = false;
+	for (int i = 0; i < streaming_octants_per_frame && !streaming_pending.is_empty(); i++) {
+		List<OctantKey>::Element *closest = streaming_pending.front();
+		float closest_distance = _octant_get_distance(closest->get(), focus);
+		for (List<OctantKey>::Element *E = closest->next(); E; E = E->next()) {
+			float distance = _octant_get_distance(E->get(), focus);
+			if (distance < closest_distance) {
+				closest = E;
+				closest_distance = distance;
+			}
+		}
+
+		OctantKey key = closest->get();
+		streaming_pending.erase(closest);
+
+		if (!octant_map.has(key) || !streaming_range.has(key)) {
+			continue;
+		}
+
+		Octant *g = octant_map[key];
+		if (g->active) {
+			continue;
+		}
+		g->active = true;
+		g->dirty = true;
+		if (_octant_update(key)) {
+			octant_map.erase(key);
+			memdelete(g);
+		}
+		built = true;
+	}
+
+	if (built) {
+		_update_visibility();
+	}
+}
+
+void GridMap::set_streaming_enabled(bool p_enabled) {
+	if (streaming == p_enabled) {
+		return;
+	}
+
+	streaming = p_enabled;
+	streaming_range.clear();
+	streaming_dirty = true;
+	// Recreate so existing octants start out streamed out (or built, when disabling).
+	_recreate_octant_data();
+	set_process_internal(_is_streaming());
+}
+
+bool GridMap::is_streaming_enabled() const {
+	return streaming;
+}
+
+void GridMap::set_streaming_focus(const Vector3 &p_focus) {
+	if (streaming_focus == p_focus) {
+		return;
+	}
+	streaming_focus = p_focus;
+	streaming_dirty = true;
+}
+
+Vector3 GridMap::get_streaming_focus() const {
+	return streaming_focus;
+}
+
+void GridMap::set_streaming_radius(float p_radius) {
+	ERR_FAIL_COND(p_radius < 0);
+	streaming_radius = p_radius;
+	streaming_dirty = true;
+}
+
+float GridMap::get_streaming_radius() const {
+	return streaming_radius;
+}
+
+void GridMap::set_streaming_octants_per_frame(int p_count) {
+	ERR_FAIL_COND(p_count < 1);
+	streaming_octants_per_frame = p_count;
+}
+
+int GridMap::get_streaming_octants_per_frame() const {
+	return streaming_octants_per_frame;
+}
+
+Vector<int> GridMap::get_octant_data(const Vector3i &p_octant) const {
+	OctantKey ok;
+	ok.x = p_octant.x;
+	ok.y = p_octant.y;
+	ok.z = p_octant.z;
+
+	Vector<int> cells;
+	if (!octant_map.has(ok)) {
+		return cells;
+	}
+
+	// Same encoding as the "data" property.
+	const Octant &g = *octant_map[ok];
+	cells.resize(g.cells.size() * 3);
+	int *w = cells.ptrw();
+	int i = 0;
+	for (Set<IndexKey>::Element *E = g.cells.front(); E; E = E->next(), i++) {
+		encode_uint64(E->get().key, (uint8_t *)&w[i * 3]);
+		encode_uint32(cell_map[E->get()].cell, (uint8_t *)&w[i * 3 + 2]);
+	}
+	return cells;
+}
+
+void GridMap::set_octant_data(const Vector3i &p_octant, const Vector<int> &p_data) {
+	ERR_FAIL_COND(p_data.size() % 3);
+
+	erase_octant(p_octant);
+
+	const int *r = p_data.ptr();
+	for (int i = 0; i < p_data.size() / 3; i++) {
+		IndexKey ik;
+		ik.key = decode_uint64((const uint8_t *)&r[i * 3]);
+		Cell cell;
+		cell.cell = decode_uint32((const uint8_t *)&r[i * 3 + 2]);
+		ERR_CONTINUE_MSG(ik.x / octant_size != p_octant.x || ik.y / octant_size != p_octant.y || ik.z / octant_size != p_octant.z, "Cell does not belong to the given octant.");
+		set_cell_item(Vector3i(ik), cell.item, cell.rot);
+	}
+}
+
+void GridMap::erase_octant(const Vector3i &p_octant) {
+	OctantKey ok;
+	ok.x = p_octant.x;
+	ok.y = p_octant.y;
+	ok.z = p_octant.z;
+
+	if (!octant_map.has(ok)) {
+		return;
+	}
+
+	Vector<IndexKey> keys;
+	for (Set<IndexKey>::Element *E = octant_map[ok]->cells.front(); E; E = E->next()) {
+		keys.push_back(E->get());
+	}
+	for (int i = 0; i < keys.size(); i++) {
+		set_cell_item(Vector3i(keys[i]), INVALID_CELL_ITEM);
+	}
+}
+
 Array GridMap::get_meshes() {
 	if (mesh_library.is_null()) {
 		return Array();
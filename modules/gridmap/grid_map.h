@@ -31,6 +31,7 @@
 #ifndef GRID_MAP_H
 #define GRID_MAP_H
 
+#include "core/config/engine.h"
 #include "scene/3d/navigation_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/mesh_library.h"
@@ -90,12 +91,15 @@ class GridMap : public Node3D {
 	struct Octant {
 		struct NavMesh {
 			RID region;
+			Ref<NavigationMesh> navmesh;
 			Transform xform;
 		};
 
 		struct MultimeshInstance {
 			RID instance;
 			RID multimesh;
+			int item = 0;
+			int instance_count = 0;
 			struct Item {
 				int index = 0;
 				Transform transform;
@@ -111,6 +115,7 @@ class GridMap : public Node3D {
 		RID collision_debug_instance;
 
 		bool dirty = false;
+		bool active = true; // False while streamed out; cells are kept, but nothing is built.
 		RID static_body;
 		Map<IndexKey, NavMesh> navmesh_ids;
 	};
@@ -160,6 +165,27 @@ class GridMap : public Node3D {
 	Map<OctantKey, Octant *> octant_map;
 	Map<IndexKey, Cell> cell_map;
 
+	bool streaming = false;
+	bool streaming_dirty = false;
+	Vector3 streaming_focus;
+	float streaming_radius = 64.0;
+	int streaming_octants_per_frame = 8;
+	Set<OctantKey> streaming_range;
+	List<OctantKey> streaming_pending;
+
+	// Everything an octant update needs from the cells, gathered without touching the servers.
+	struct OctantBuild {
+		struct Multimesh {
+			Vector<float> buffer; // 12 floats per instance, as RS::MULTIMESH_TRANSFORM_3D expects.
+			Vector<Octant::MultimeshInstance::Item> items;
+		};
+
+		OctantKey key;
+		Map<int, Multimesh> multimeshes;
+		Vector<MeshLibrary::ShapeData> shapes; // Transforms are relative to the GridMap.
+		Map<IndexKey, Octant::NavMesh> navmeshes;
+	};
+
 	void _recreate_octant_data();
 
 	struct BakeLight {
@@ -177,10 +203,25 @@ class GridMap : public Node3D {
 	void _octant_enter_world(const OctantKey &p_key);
 	void _octant_exit_world(const OctantKey &p_key);
 	bool _octant_update(const OctantKey &p_key);
+	void _octant_build(OctantBuild &r_build) const;
+	void _octant_build_job(uint32_t p_index, OctantBuild *p_builds);
+	void _octant_apply(OctantBuild &p_build);
 	void _octant_clean_up(const OctantKey &p_key);
 	void _octant_transform(const OctantKey &p_key);
+	void _octant_free_resources(Octant &p_octant);
 	bool awaiting_update = false;
 
+	_FORCE_INLINE_ bool _is_streaming() const {
+		return streaming && !Engine::get_singleton()->is_editor_hint();
+	}
+
+	AABB _octant_get_aabb(const OctantKey &p_key) const;
+	float _octant_get_distance(const OctantKey &p_key, const Vector3 &p_point) const;
+	Vector3 _get_streaming_local_focus() const;
+	void _octant_stream_out(const OctantKey &p_key);
+	void _update_streaming_range();
+	void _update_streaming();
+
 	void _queue_octants_dirty();
 	void _update_octants_callback();
 
@@ -253,6 +294,22 @@ public:
 
 	Array get_used_cells() const;
 
+	void set_streaming_enabled(bool p_enabled);
+	bool is_streaming_enabled() const;
+
+	void set_streaming_focus(const Vector3 &p_focus);
+	Vector3 get_streaming_focus() const;
+
+	void set_streaming_radius(float p_radius);
+	float get_streaming_radius() const;
+
+	void set_streaming_octants_per_frame(int p_count);
+	int get_streaming_octants_per_frame() const;
+
+	Vector<int> get_octant_data(const Vector3i &p_octant) const;
+	void set_octant_data(const Vector3i &p_octant, const Vector<int> &p_data);
+	void erase_octant(const Vector3i &p_octant);
+
 	Array get_meshes();
 
 	void clear_baked_meshes();
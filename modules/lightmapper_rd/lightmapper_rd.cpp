@@ -628,6 +628,16 @@ void LightmapperRD::_raster_geometry(RenderingDevice *rd, Size2i atlas_size, int
 	}
 }
 
+void LightmapperRD::_denoise_thread_func(void *p_userdata) {
+	DenoiseThreadData *data = (DenoiseThreadData *)p_userdata;
+	for (int i = 0; i < data->images.size(); i++) {
+		Ref<Image> denoised = data->denoiser->denoise_image(data->images[i]);
+		if (denoised != data->images[i]) {
+			data->denoised.write[i] = denoised;
+		}
+	}
+}
+
 LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_denoiser, int p_bounces, float p_bias, int p_max_texture_size, bool p_bake_sh, GenerateProbes p_generate_probes, const Ref<Image> &p_environment_panorama, const Basis &p_environment_transform, BakeStepFunc p_step_function, void *p_bake_userdata) {
 	if (p_step_function) {
 		p_step_function(0.0, TTR("Begin Bake"), p_bake_userdata, true);
@@ -1132,18 +1142,50 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 
 		RID light_uniform_set = rd->uniform_set_create(uniforms, compute_shader_primary, 1);
 
-		RD::ComputeListID compute_list = rd->compute_list_begin();
-		rd->compute_list_bind_compute_pipeline(compute_list, compute_shader_primary_pipeline);
-		rd->compute_list_bind_uniform_set(compute_list, compute_base_uniform_set, 0);
-		rd->compute_list_bind_uniform_set(compute_list, light_uniform_set, 1);
-
-		for (int i = 0; i < atlas_slices; i++) {
-			push_constant.atlas_slice = i;
-			rd->compute_list_set_push_constant(compute_list, &push_constant, sizeof(PushConstant));
-			rd->compute_list_dispatch(compute_list, group_size.x, group_size.y, group_size.z);
-			//no barrier, let them run all together
+		//traced in regions like the bounces, submitting each one so large atlases with many lights don't hit driver timeouts
+		int max_region_size = nearest_power_of_2_templated(int(GLOBAL_GET("rendering/gpu_lightmapper/performance/region_size")));
+		int x_regions = (atlas_size.width - 1) / max_region_size + 1;
+		int y_regions = (atlas_size.height - 1) / max_region_size + 1;
+		int count = 0;
+
+		for (int s = 0; s < atlas_slices; s++) {
+			push_constant.atlas_slice = s;
+
+			for (int i = 0; i < x_regions; i++) {
+				for (int j = 0; j < y_regions; j++) {
+					int x = i * max_region_size;
+					int y = j * max_region_size;
+					int w = MIN((i + 1) * max_region_size, atlas_size.width) - x;
+					int h = MIN((j + 1) * max_region_size, atlas_size.height) - y;
+
+					push_constant.region_ofs[0] = x;
+					push_constant.region_ofs[1] = y;
+
+					Vector3i region_group_size((w - 1) / 8 + 1, (h - 1) / 8 + 1, 1);
+
+					RD::ComputeListID compute_list = rd->compute_list_begin();
+					rd->compute_list_bind_compute_pipeline(compute_list, compute_shader_primary_pipeline);
+					rd->compute_list_bind_uniform_set(compute_list, compute_base_uniform_set, 0);
+					rd->compute_list_bind_uniform_set(compute_list, light_uniform_set, 1);
+					rd->compute_list_set_push_constant(compute_list, &push_constant, sizeof(PushConstant));
+					rd->compute_list_dispatch(compute_list, region_group_size.x, region_group_size.y, region_group_size.z);
+					rd->compute_list_end(); //done
+					rd->submit();
+					rd->sync();
+
+					count++;
+					if (p_step_function) {
+						int total = atlas_slices * x_regions * y_regions;
+						int percent = count * 100 / total;
+						float p = float(count) / total * 0.1;
+						p_step_function(0.5 + p, vformat(TTR("Plot direct lighting %d%%"), percent), p_bake_userdata, false);
+					}
+				}
+			}
 		}
-		rd->compute_list_end(); //done
+
+		push_constant.region_ofs[0] = 0;
+		push_constant.region_ofs[1] = 0;
 	}
 
 #ifdef DEBUG_TEXTURES
@@ -1301,6 +1343,31 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 		}
 	}
 
+	/* DENOISE (START) */
+
+	//the denoiser runs on the CPU, so it works on the final lightmaps in a thread while the GPU bakes the light probes
+	DenoiseThreadData denoise_data;
+	Thread denoise_thread;
+
+	if (p_use_denoiser) {
+		if (p_step_function) {
+			p_step_function(0.7, TTR("Denoising"), p_bake_userdata, true);
+		}
+
+		denoise_data.denoiser = LightmapDenoiser::create();
+		if (denoise_data.denoiser.is_valid()) {
+			for (int i = 0; i < atlas_slices * (p_bake_sh ? 4 : 1); i++) {
+				Vector<uint8_t> s = rd->texture_get_data(light_accum_tex, i);
+				Ref<Image> img;
+				img.instance();
+				img->create(atlas_size.width, atlas_size.height, false, Image::FORMAT_RGBAH, s);
+				denoise_data.images.push_back(img);
+			}
+			denoise_data.denoised.resize(denoise_data.images.size());
+			denoise_thread.start(_denoise_thread_func, &denoise_data);
+		}
+	}
+
 	/* LIGHPROBES */
 
 	RID light_probe_buffer;
@@ -1309,7 +1376,7 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 		light_probe_buffer = rd->storage_buffer_create(sizeof(float) * 4 * 9 * probe_positions.size());
 
 		if (p_step_function) {
-			p_step_function(0.7, TTR("Baking lightprobes"), p_bake_userdata, true);
+			p_step_function(0.7, denoise_data.images.size() ? TTR("Baking lightprobes and denoising") : TTR("Baking lightprobes"), p_bake_userdata, true);
 		}
 
 		Vector<RD::Uniform> uniforms;
@@ -1408,37 +1475,34 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 	}
 #endif
 
-	/* DENOISE */
+	/* DENOISE (FINISH) */
 
-	if (p_use_denoiser) {
+	if (denoise_data.images.size()) {
 		if (p_step_function) {
 			p_step_function(0.8, TTR("Denoising"), p_bake_userdata, true);
 		}
 
-		Ref<LightmapDenoiser> denoiser = LightmapDenoiser::create();
-		if (denoiser.is_valid()) {
-			for (int i = 0; i < atlas_slices * (p_bake_sh ? 4 : 1); i++) {
-				Vector<uint8_t> s = rd->texture_get_data(light_accum_tex, i);
-				Ref<Image> img;
-				img.instance();
-				img->create(atlas_size.width, atlas_size.height, false, Image::FORMAT_RGBAH, s);
+		denoise_thread.wait_to_finish();
 
-				Ref<Image> denoised = denoiser->denoise_image(img);
-				if (denoised != img) {
-					denoised->convert(Image::FORMAT_RGBAH);
-					Vector<uint8_t> ds = denoised->get_data();
-					denoised.unref(); //avoid copy on write
-					{ //restore alpha
-						uint32_t count = s.size() / 2; //uint16s
-						const uint16_t *src = (const uint16_t *)s.ptr();
-						uint16_t *dst = (uint16_t *)ds.ptrw();
-						for (uint32_t j = 0; j < count; j += 4) {
-							dst[j + 3] = src[j + 3];
-						}
-					}
-					rd->texture_update(light_accum_tex, i, ds);
+		for (int i = 0; i < denoise_data.images.size(); i++) {
+			Ref<Image> denoised = denoise_data.denoised[i];
+			if (denoised.is_null()) {
+				continue;
+			}
+			denoise_data.denoised.write[i].unref();
+			Vector<uint8_t> s = denoise_data.images[i]->get_data();
+			denoised->convert(Image::FORMAT_RGBAH);
+			Vector<uint8_t> ds = denoised->get_data();
+			denoised.unref(); //avoid copy on write
+			{ //restore alpha
+				uint32_t count = s.size() / 2; //uint16s
+				const uint16_t *src = (const uint16_t *)s.ptr();
+				uint16_t *dst = (uint16_t *)ds.ptrw();
+				for (uint32_t j = 0; j < count; j += 4) {
+					dst[j + 3] = src[j + 3];
 				}
 			}
+			rd->texture_update(light_accum_tex, i, ds);
 		}
 	}
 
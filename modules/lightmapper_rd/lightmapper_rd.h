@@ -31,6 +31,7 @@
 #ifndef LIGHTMAPPER_RD_H
 #define LIGHTMAPPER_RD_H
 
+#include "core/os/thread.h"
 #include "core/templates/local_vector.h"
 #include "scene/3d/lightmapper.h"
 #include "scene/resources/mesh.h"
@@ -230,6 +231,14 @@ class LightmapperRD : public Lightmapper {
 	Vector<Ref<Image>> bake_textures;
 	Vector<Color> probe_values;
 
+	struct DenoiseThreadData {
+		Ref<LightmapDenoiser> denoiser;
+		Vector<Ref<Image>> images;
+		Vector<Ref<Image>> denoised; // Null where the denoiser returned the image unchanged.
+	};
+
+	static void _denoise_thread_func(void *p_userdata);
+
 	BakeError _blit_meshes_into_atlas(int p_max_texture_size, Vector<Ref<Image>> &albedo_images, Vector<Ref<Image>> &emission_images, AABB &bounds, Size2i &atlas_size, int &atlas_slices, BakeStepFunc p_step_function, void *p_bake_userdata);
 	void _create_acceleration_structures(RenderingDevice *rd, Size2i atlas_size, int atlas_slices, AABB &bounds, int grid_size, Vector<Probe> &probe_positions, GenerateProbes p_generate_probes, Vector<int> &slice_triangle_count, Vector<int> &slice_seam_count, RID &vertex_buffer, RID &triangle_buffer, RID &box_buffer, RID &lights_buffer, RID &triangle_cell_indices_buffer, RID &probe_positions_buffer, RID &grid_texture, RID &grid_texture_sdf, RID &seams_buffer, BakeStepFunc p_step_function, void *p_bake_userdata);
 	void _raster_geometry(RenderingDevice *rd, Size2i atlas_size, int atlas_slices, int grid_size, AABB bounds, float p_bias, Vector<int> slice_triangle_count, RID position_tex, RID unocclude_tex, RID normal_tex, RID raster_depth_buffer, RID rasterize_shader, RID raster_base_uniform);
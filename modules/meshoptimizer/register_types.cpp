@@ -29,19 +29,91 @@
 /*************************************************************************/
 
 #include "register_types.h"
+#include "scene/resources/mesh.h"
 #include "scene/resources/surface_tool.h"
 #include "thirdparty/meshoptimizer/meshoptimizer.h"
 
+static Vector<uint8_t> _build_clusters(Vector<int> &r_indices, const Vector<Vector3> &p_vertices) {
+	const size_t max_vertices = 64;
+	const size_t max_triangles = 124;
+
+	size_t index_count = r_indices.size();
+	size_t vertex_count = p_vertices.size();
+	const float *vertex_positions = (const float *)p_vertices.ptr();
+
+	Vector<meshopt_Meshlet> meshlets;
+	meshlets.resize(meshopt_buildMeshletsBound(index_count, max_vertices, max_triangles));
+	size_t meshlet_count = meshopt_buildMeshlets(meshlets.ptrw(), (const unsigned int *)r_indices.ptr(), index_count, vertex_count, max_vertices, max_triangles);
+
+	Vector<uint8_t> cluster_data;
+	cluster_data.resize(meshlet_count * sizeof(RS::SurfaceData::Cluster));
+	RS::SurfaceData::Cluster *clusters = (RS::SurfaceData::Cluster *)cluster_data.ptrw();
+
+	//write the triangles of each meshlet back as a contiguous range of the index array
+	Vector<int> indices;
+	indices.resize(index_count);
+	int *iw = indices.ptrw();
+	uint32_t index_offset = 0;
+
+	for (size_t i = 0; i < meshlet_count; i++) {
+		const meshopt_Meshlet &meshlet = meshlets[i];
+		meshopt_Bounds bounds = meshopt_computeMeshletBounds(&meshlet, vertex_positions, vertex_count, sizeof(Vector3));
+
+		RS::SurfaceData::Cluster &cluster = clusters[i];
+		for (int j = 0; j < 3; j++) {
+			cluster.sphere[j] = bounds.center[j];
+			cluster.cone[j] = bounds.cone_axis[j];
+		}
+		cluster.sphere[3] = bounds.radius;
+		cluster.cone[3] = bounds.cone_cutoff;
+		cluster.index_offset = index_offset;
+		cluster.index_count = meshlet.triangle_count * 3;
+		cluster.pad[0] = 0;
+		cluster.pad[1] = 0;
+
+		ERR_FAIL_COND_V(index_offset + cluster.index_count > index_count, Vector<uint8_t>());
+		for (uint32_t j = 0; j < meshlet.triangle_count; j++) {
+			for (int k = 0; k < 3; k++) {
+				iw[index_offset++] = meshlet.vertices[meshlet.indices[j][k]];
+			}
+		}
+	}
+
+	ERR_FAIL_COND_V(index_offset != index_count, Vector<uint8_t>());
+	r_indices = indices;
+	return cluster_data;
+}
+
 void register_meshoptimizer_types() {
 	SurfaceTool::optimize_vertex_cache_func = meshopt_optimizeVertexCache;
+	SurfaceTool::optimize_overdraw_func = meshopt_optimizeOverdraw;
 	SurfaceTool::simplify_func = meshopt_simplify;
 	SurfaceTool::simplify_scale_func = meshopt_simplifyScale;
 	SurfaceTool::simplify_sloppy_func = meshopt_simplifySloppy;
+	SurfaceTool::build_clusters_func = _build_clusters;
+	ArrayMesh::encode_index_buffer_func = meshopt_encodeIndexBuffer;
+	ArrayMesh::encode_index_buffer_bound_func = meshopt_encodeIndexBufferBound;
+	ArrayMesh::decode_index_buffer_func = meshopt_decodeIndexBuffer;
+	ArrayMesh::decode_index_sequence_func = meshopt_decodeIndexSequence;
+	ArrayMesh::decode_vertex_buffer_func = meshopt_decodeVertexBuffer;
+	ArrayMesh::decode_filter_oct_func = meshopt_decodeFilterOct;
+	ArrayMesh::decode_filter_quat_func = meshopt_decodeFilterQuat;
+	ArrayMesh::decode_filter_exp_func = meshopt_decodeFilterExp;
 }
 
 void unregister_meshoptimizer_types() {
 	SurfaceTool::optimize_vertex_cache_func = nullptr;
+	SurfaceTool::optimize_overdraw_func = nullptr;
 	SurfaceTool::simplify_func = nullptr;
 	SurfaceTool::simplify_scale_func = nullptr;
 	SurfaceTool::simplify_sloppy_func = nullptr;
+	SurfaceTool::build_clusters_func = nullptr;
+	ArrayMesh::encode_index_buffer_func = nullptr;
+	ArrayMesh::encode_index_buffer_bound_func = nullptr;
+	ArrayMesh::decode_index_buffer_func = nullptr;
+	ArrayMesh::decode_index_sequence_func = nullptr;
+	ArrayMesh::decode_vertex_buffer_func = nullptr;
+	ArrayMesh::decode_filter_oct_func = nullptr;
+	ArrayMesh::decode_filter_quat_func = nullptr;
+	ArrayMesh::decode_filter_exp_func = nullptr;
 }
@@ -40,9 +40,15 @@
 void AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	ERR_FAIL_COND(!active);
 
+	if (!prefetch.mix(p_buffer, p_frames)) {
+		active = false;
+	}
+}
+
+int AudioStreamPlaybackMP3::_decode(AudioFrame *p_buffer, int p_frames) {
 	int todo = p_frames;
 
-	while (todo && active) {
+	while (todo) {
 		mp3dec_frame_info_t frame_info;
 		mp3d_sample_t *buf_frame = nullptr;
 
@@ -57,18 +63,15 @@ void AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		else {
 			//EOF
 			if (mp3_stream->loop) {
-				seek(mp3_stream->loop_offset);
+				_seek_decoder(mp3_stream->loop_offset);
 				loops++;
 			} else {
-				//fill remainder with silence
-				for (int i = p_frames - todo; i < p_frames; i++) {
-					p_buffer[i] = AudioFrame(0, 0);
-				}
-				active = false;
-				todo = 0;
+				break;
 			}
 		}
 	}
+
+	return p_frames - todo;
 }
 
 float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
@@ -84,6 +87,7 @@ void AudioStreamPlaybackMP3::start(float p_from_pos) {
 
 void AudioStreamPlaybackMP3::stop() {
 	active = false;
+	prefetch.stop();
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
@@ -95,13 +99,15 @@ int AudioStreamPlaybackMP3::get_loop_count() const {
 }
 
 float AudioStreamPlaybackMP3::get_playback_position() const {
-	return float(frames_mixed) / mp3_stream->sample_rate;
+	int64_t frame = int64_t(frames_mixed) - prefetch.get_buffered_frames();
+	if (frame < 0) {
+		// The prefetched frames go across the loop point.
+		frame += int64_t((mp3_stream->length - mp3_stream->loop_offset) * mp3_stream->sample_rate);
+	}
+	return float(frame) / mp3_stream->sample_rate;
 }
 
-void AudioStreamPlaybackMP3::seek(float p_time) {
-	if (!active)
-		return;
-
+void AudioStreamPlaybackMP3::_seek_decoder(float p_time) {
 	if (p_time >= mp3_stream->get_length()) {
 		p_time = 0;
 	}
@@ -110,7 +116,19 @@ void AudioStreamPlaybackMP3::seek(float p_time) {
 	mp3dec_ex_seek(mp3d, frames_mixed * mp3_stream->channels);
 }
 
+void AudioStreamPlaybackMP3::seek(float p_time) {
+	if (!active)
+		return;
+
+	prefetch.lock();
+	_seek_decoder(p_time);
+	prefetch.clear();
+	prefetch.unlock();
+}
+
 AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
+	prefetch.finish();
+
 	if (mp3d) {
 		mp3dec_ex_close(mp3d);
 		memfree(mp3d);
@@ -139,6 +157,9 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instance_playback() {
 		ERR_FAIL_COND_V(errorcode, Ref<AudioStreamPlaybackMP3>());
 	}
 
+	// Half a second ahead is plenty to hide the decoding from the audio thread.
+	mp3s->prefetch.init(&AudioStreamPlaybackMP3::_decode_func, mp3s.ptr(), sample_rate / 2);
+
 	return mp3s;
 }
 
@@ -33,6 +33,7 @@
 
 #include "core/io/resource_loader.h"
 #include "servers/audio/audio_stream.h"
+#include "servers/audio/audio_stream_prefetch.h"
 
 #include "minimp3_ex.h"
 
@@ -42,13 +43,18 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 	GDCLASS(AudioStreamPlaybackMP3, AudioStreamPlaybackResampled);
 
 	mp3dec_ex_t *mp3d = nullptr;
-	uint32_t frames_mixed = 0;
+	uint32_t frames_mixed = 0; // Decoder position, ahead of the playback by the prefetched frames.
 	bool active = false;
 	int loops = 0;
 
 	friend class AudioStreamMP3;
 
 	Ref<AudioStreamMP3> mp3_stream;
+	AudioStreamPrefetch prefetch;
+
+	void _seek_decoder(float p_time);
+	int _decode(AudioFrame *p_buffer, int p_frames);
+	static int _decode_func(void *p_self, AudioFrame *p_buffer, int p_frames) { return reinterpret_cast<AudioStreamPlaybackMP3 *>(p_self)->_decode(p_buffer, p_frames); }
 
 protected:
 	virtual void _mix_internal(AudioFrame *p_buffer, int p_frames) override;
@@ -90,7 +96,7 @@ protected:
 
 public:
 	void set_loop(bool p_enable);
-	bool has_loop() const;
+	virtual bool has_loop() const override;
 
 	void set_loop_offset(float p_seconds);
 	float get_loop_offset() const;
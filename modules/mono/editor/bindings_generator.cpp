@@ -2752,7 +2752,7 @@ bool BindingsGenerator::_populate_object_type_interfaces() {
 
 		// Populate signals
 
-		const HashMap<StringName, MethodInfo> &signal_map = class_info->signal_map;
+		const FlatHashMap<StringName, MethodInfo> &signal_map = class_info->signal_map;
 		const StringName *k = nullptr;
 
 		while ((k = signal_map.next(k))) {
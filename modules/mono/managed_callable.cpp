@@ -31,6 +31,7 @@
 #include "managed_callable.h"
 
 #include "csharp_script.h"
+#include "mono_gd/gd_mono_class.h"
 #include "mono_gd/gd_mono_marshal.h"
 #include "mono_gd/gd_mono_utils.h"
 
@@ -115,9 +116,15 @@ void ManagedCallable::call(const Variant **p_arguments, int p_argcount, Variant
 
 void ManagedCallable::set_delegate(MonoDelegate *p_delegate) {
 	delegate_handle = MonoGCHandleData::new_strong_handle((MonoObject *)p_delegate);
-	MonoMethod *delegate_invoke_raw = mono_get_delegate_invoke(mono_object_get_class((MonoObject *)p_delegate));
+	MonoClass *delegate_class_raw = mono_object_get_class((MonoObject *)p_delegate);
+	MonoMethod *delegate_invoke_raw = mono_get_delegate_invoke(delegate_class_raw);
 	const StringName &delegate_invoke_name = CSharpLanguage::get_singleton()->get_string_names().delegate_invoke_method_name;
-	delegate_invoke = memnew(GDMonoMethod(delegate_invoke_name, delegate_invoke_raw)); // TODO: Use pooling for this GDMonoMethod instances
+
+	// Callables of the same delegate type share the Invoke method cached by its class,
+	// instead of each one building (and leaking) its own.
+	GDMonoClass *delegate_class = GDMono::get_singleton()->get_class(delegate_class_raw);
+	ERR_FAIL_NULL(delegate_class);
+	delegate_invoke = delegate_class->get_method(delegate_invoke_raw, delegate_invoke_name);
 }
 
 ManagedCallable::ManagedCallable(MonoDelegate *p_delegate) {
@@ -1222,7 +1222,48 @@ Variant mono_object_to_variant(MonoObject *p_obj) {
 		return Variant();
 	}
 
-	ManagedType type = ManagedType::from_class(mono_object_get_class(p_obj));
+	MonoClass *raw_class = mono_object_get_class(p_obj);
+
+	// Boxed primitives and structs are the most common arguments of calls and emitted signals.
+	// Unbox them directly instead of resolving their GDMonoClass, which searches the loaded assemblies.
+	if (raw_class == CACHED_CLASS_RAW(bool)) {
+		return (bool)unbox<MonoBoolean>(p_obj);
+	}
+	if (raw_class == CACHED_CLASS_RAW(int32_t)) {
+		return unbox<int32_t>(p_obj);
+	}
+	if (raw_class == CACHED_CLASS_RAW(int64_t)) {
+		return unbox<int64_t>(p_obj);
+	}
+	if (raw_class == CACHED_CLASS_RAW(float)) {
+		return unbox<float>(p_obj);
+	}
+	if (raw_class == CACHED_CLASS_RAW(double)) {
+		return unbox<double>(p_obj);
+	}
+
+#define RETURN_IF_STRUCT(m_struct)                                                      \
+	if (raw_class == CACHED_CLASS_RAW(m_struct)) {                                      \
+		return MARSHALLED_IN(m_struct, unbox_addr<GDMonoMarshal::M_##m_struct>(p_obj)); \
+	}
+
+	RETURN_IF_STRUCT(Vector2);
+	RETURN_IF_STRUCT(Vector2i);
+	RETURN_IF_STRUCT(Rect2);
+	RETURN_IF_STRUCT(Rect2i);
+	RETURN_IF_STRUCT(Transform2D);
+	RETURN_IF_STRUCT(Vector3);
+	RETURN_IF_STRUCT(Vector3i);
+	RETURN_IF_STRUCT(Basis);
+	RETURN_IF_STRUCT(Quat);
+	RETURN_IF_STRUCT(Transform);
+	RETURN_IF_STRUCT(AABB);
+	RETURN_IF_STRUCT(Color);
+	RETURN_IF_STRUCT(Plane);
+
+#undef RETURN_IF_STRUCT
+
+	ManagedType type = ManagedType::from_class(raw_class);
 
 	return mono_object_to_variant_impl(p_obj, type);
 }
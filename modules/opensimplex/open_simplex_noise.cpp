@@ -31,6 +31,7 @@
 #include "open_simplex_noise.h"
 
 #include "core/core_string_names.h"
+#include "core/templates/thread_work_pool.h"
 
 OpenSimplexNoise::OpenSimplexNoise() {
 	_init_seeds();
@@ -96,53 +97,146 @@ void OpenSimplexNoise::set_lacunarity(float p_lacunarity) {
 	emit_changed();
 }
 
-Ref<Image> OpenSimplexNoise::get_image(int p_width, int p_height) const {
-	Vector<uint8_t> data;
-	data.resize(p_width * p_height);
-
-	uint8_t *wd8 = data.ptrw();
+void OpenSimplexNoise::_generate_grid_rows(int p_from, int p_to, const GridData &p_grid) const {
+	for (int row = p_from; row < p_to; row++) {
+		float *values = p_grid.values + row * p_grid.width;
+		for (int i = 0; i < p_grid.width; i++) {
+			values[i] = 0.0;
+		}
 
-	for (int i = 0; i < p_height; i++) {
-		for (int j = 0; j < p_width; j++) {
-			float v = get_noise_2d(j, i);
-			v = v * 0.5 + 0.5; // Normalize [0..1]
-			wd8[(i * p_width + j)] = uint8_t(CLAMP(v * 255.0, 0, 255));
+		for (int octave = 0; octave < p_grid.octave_count; octave++) {
+			const osn_context *context = &contexts[octave];
+			float frequency = p_grid.frequency[octave];
+			float amplitude = p_grid.amplitude[octave];
+
+			switch (p_grid.type) {
+				case GRID_2D: {
+					float y = (p_grid.from.y + row) * frequency;
+					for (int i = 0; i < p_grid.width; i++) {
+						values[i] += open_simplex_noise2(context, (p_grid.from.x + i) * frequency, y) * amplitude;
+					}
+				} break;
+				case GRID_3D: {
+					float y = (p_grid.from.y + row % p_grid.height) * frequency;
+					float z = (p_grid.from.z + row / p_grid.height) * frequency;
+					for (int i = 0; i < p_grid.width; i++) {
+						values[i] += open_simplex_noise3(context, (p_grid.from.x + i) * frequency, y, z) * amplitude;
+					}
+				} break;
+				case GRID_SEAMLESS: {
+					float radius = p_grid.width / Math_TAU;
+					float angle = Math_TAU * row / p_grid.width;
+					float z = radius * Math::sin(angle) * frequency;
+					float w = radius * Math::cos(angle) * frequency;
+					for (int i = 0; i < p_grid.width; i++) {
+						angle = Math_TAU * i / p_grid.width;
+						values[i] += open_simplex_noise4(context, radius * Math::sin(angle) * frequency, radius * Math::cos(angle) * frequency, z, w) * amplitude;
+					}
+				} break;
+			}
 		}
 	}
+}
 
-	Ref<Image> image = memnew(Image(p_width, p_height, false, Image::FORMAT_L8, data));
-	return image;
+void OpenSimplexNoise::_generate_grid_job(uint32_t p_job, GridData *p_grid) const {
+	int from = p_job * ROWS_PER_JOB;
+	_generate_grid_rows(from, MIN(from + int(ROWS_PER_JOB), p_grid->rows), *p_grid);
 }
 
-Ref<Image> OpenSimplexNoise::get_seamless_image(int p_size) const {
+void OpenSimplexNoise::_generate_grid(GridData &p_grid) const {
+	// Same octave scales as get_noise_*d(), gathered upfront.
+	p_grid.octave_count = octaves;
+	float frequency = 1.0 / period;
+	float amplitude = 1.0;
+	float max = 0.0;
+	for (int i = 0; i < octaves; i++) {
+		p_grid.frequency[i] = frequency;
+		p_grid.amplitude[i] = amplitude;
+		max += amplitude;
+		frequency *= lacunarity;
+		amplitude *= persistence;
+	}
+	for (int i = 0; i < octaves; i++) {
+		p_grid.amplitude[i] /= max;
+	}
+
+	if (p_grid.rows > ROWS_PER_JOB && p_grid.rows * p_grid.width >= MIN_THREADED_SAMPLES) {
+		ThreadWorkPool work_pool;
+		work_pool.init();
+		work_pool.do_work((p_grid.rows + ROWS_PER_JOB - 1) / ROWS_PER_JOB, this, &OpenSimplexNoise::_generate_grid_job, &p_grid);
+		work_pool.finish();
+	} else {
+		_generate_grid_rows(0, p_grid.rows, p_grid);
+	}
+}
+
+Ref<Image> OpenSimplexNoise::_grid_to_image(const Vector<float> &p_values, int p_width, int p_height) const {
 	Vector<uint8_t> data;
-	data.resize(p_size * p_size);
+	data.resize(p_width * p_height);
 
 	uint8_t *wd8 = data.ptrw();
+	const float *values = p_values.ptr();
 
-	for (int i = 0; i < p_size; i++) {
-		for (int j = 0; j < p_size; j++) {
-			float ii = (float)i / (float)p_size;
-			float jj = (float)j / (float)p_size;
+	for (int i = 0; i < p_width * p_height; i++) {
+		float v = values[i] * 0.5 + 0.5; // Normalize [0..1]
+		wd8[i] = uint8_t(CLAMP(v * 255.0, 0, 255));
+	}
 
-			ii *= Math_TAU;
-			jj *= Math_TAU;
+	Ref<Image> image = memnew(Image(p_width, p_height, false, Image::FORMAT_L8, data));
+	return image;
+}
 
-			float radius = p_size / Math_TAU;
+Vector<float> OpenSimplexNoise::get_noise_2d_grid(const Vector2 &p_from, int p_width, int p_height) const {
+	Vector<float> values;
+	ERR_FAIL_COND_V(p_width < 0 || p_height < 0, values);
+	values.resize(p_width * p_height);
+
+	GridData grid;
+	grid.type = GRID_2D;
+	grid.from = Vector3(p_from.x, p_from.y, 0);
+	grid.width = p_width;
+	grid.height = p_height;
+	grid.rows = p_height;
+	grid.values = values.ptrw();
+	_generate_grid(grid);
+
+	return values;
+}
 
-			float x = radius * Math::sin(jj);
-			float y = radius * Math::cos(jj);
-			float z = radius * Math::sin(ii);
-			float w = radius * Math::cos(ii);
-			float v = get_noise_4d(x, y, z, w);
+Vector<float> OpenSimplexNoise::get_noise_3d_grid(const Vector3 &p_from, int p_width, int p_height, int p_depth) const {
+	Vector<float> values;
+	ERR_FAIL_COND_V(p_width < 0 || p_height < 0 || p_depth < 0, values);
+	values.resize(p_width * p_height * p_depth);
+
+	GridData grid;
+	grid.type = GRID_3D;
+	grid.from = p_from;
+	grid.width = p_width;
+	grid.height = p_height;
+	grid.rows = p_height * p_depth;
+	grid.values = values.ptrw();
+	_generate_grid(grid);
+
+	return values;
+}
 
-			v = v * 0.5 + 0.5; // Normalize [0..1]
-			wd8[(i * p_size + j)] = uint8_t(CLAMP(v * 255.0, 0, 255));
-		}
-	}
+Ref<Image> OpenSimplexNoise::get_image(int p_width, int p_height) const {
+	return _grid_to_image(get_noise_2d_grid(Vector2(), p_width, p_height), p_width, p_height);
+}
 
-	Ref<Image> image = memnew(Image(p_size, p_size, false, Image::FORMAT_L8, data));
-	return image;
+Ref<Image> OpenSimplexNoise::get_seamless_image(int p_size) const {
+	Vector<float> values;
+	values.resize(p_size * p_size);
+
+	GridData grid;
+	grid.type = GRID_SEAMLESS;
+	grid.width = p_size;
+	grid.height = p_size;
+	grid.rows = p_size;
+	grid.values = values.ptrw();
+	_generate_grid(grid);
+
+	return _grid_to_image(values, p_size, p_size);
 }
 
 void OpenSimplexNoise::_bind_methods() {
@@ -164,6 +258,9 @@ void OpenSimplexNoise::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_image", "width", "height"), &OpenSimplexNoise::get_image);
 	ClassDB::bind_method(D_METHOD("get_seamless_image", "size"), &OpenSimplexNoise::get_seamless_image);
 
+	ClassDB::bind_method(D_METHOD("get_noise_2d_grid", "from", "width", "height"), &OpenSimplexNoise::get_noise_2d_grid);
+	ClassDB::bind_method(D_METHOD("get_noise_3d_grid", "from", "width", "height", "depth"), &OpenSimplexNoise::get_noise_3d_grid);
+
 	ClassDB::bind_method(D_METHOD("get_noise_1d", "x"), &OpenSimplexNoise::get_noise_1d);
 	ClassDB::bind_method(D_METHOD("get_noise_2d", "x", "y"), &OpenSimplexNoise::get_noise_2d);
 	ClassDB::bind_method(D_METHOD("get_noise_3d", "x", "y", "z"), &OpenSimplexNoise::get_noise_3d);
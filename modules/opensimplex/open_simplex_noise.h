@@ -54,6 +54,36 @@ class OpenSimplexNoise : public Resource {
 	float period = 64.0; // Distance above which we start to see similarities. The higher, the longer "hills" will be on a terrain.
 	float lacunarity = 2.0; // Controls period change across octaves. 2 is usually a good value to address all detail levels.
 
+	enum GridType {
+		GRID_2D,
+		GRID_3D,
+		GRID_SEAMLESS, // 4D noise, with the rows and columns wrapped around two circles.
+	};
+
+	enum {
+		ROWS_PER_JOB = 16,
+		MIN_THREADED_SAMPLES = 64 * 64, // Smaller grids are generated on the calling thread.
+	};
+
+	// Grids are generated a row and an octave at a time, so the octave's context stays hot and the scale of
+	// each octave is computed once per grid instead of once per sample.
+	struct GridData {
+		GridType type = GRID_2D;
+		Vector3 from;
+		int width = 0;
+		int height = 0;
+		int rows = 0; // Height times depth.
+		int octave_count = 0;
+		float frequency[MAX_OCTAVES];
+		float amplitude[MAX_OCTAVES]; // Already divided by the sum of all amplitudes.
+		float *values = nullptr;
+	};
+
+	void _generate_grid(GridData &p_grid) const;
+	void _generate_grid_job(uint32_t p_job, GridData *p_grid) const;
+	void _generate_grid_rows(int p_from, int p_to, const GridData &p_grid) const;
+	Ref<Image> _grid_to_image(const Vector<float> &p_values, int p_width, int p_height) const;
+
 public:
 	OpenSimplexNoise();
 	~OpenSimplexNoise();
@@ -78,6 +108,10 @@ public:
 	Ref<Image> get_image(int p_width, int p_height) const;
 	Ref<Image> get_seamless_image(int p_size) const;
 
+	// Samples at integer steps from the given position, X varying fastest, then Y, then Z.
+	Vector<float> get_noise_2d_grid(const Vector2 &p_from, int p_width, int p_height) const;
+	Vector<float> get_noise_3d_grid(const Vector3 &p_from, int p_width, int p_height, int p_depth) const;
+
 	float get_noise_1d(float x) const;
 	float get_noise_2d(float x, float y) const;
 	float get_noise_3d(float x, float y, float z) const;
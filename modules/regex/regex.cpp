@@ -43,6 +43,30 @@ static void _regex_free(void *ptr, void *user) {
 	memfree(ptr);
 }
 
+// JIT compiled patterns run on a stack that can't be shared between threads, so each thread
+// lazily gets its own. Without one, PCRE2 uses 32 KiB of the machine stack, which is too little
+// for some patterns.
+struct RegExJITStack {
+	pcre2_jit_stack_32 *stack = nullptr;
+	bool created = false;
+
+	pcre2_jit_stack_32 *get() {
+		if (!created) {
+			stack = pcre2_jit_stack_create_32(32 * 1024, 1024 * 1024, nullptr);
+			created = true;
+		}
+		return stack;
+	}
+
+	~RegExJITStack() {
+		if (stack) {
+			pcre2_jit_stack_free_32(stack);
+		}
+	}
+};
+
+static thread_local RegExJITStack jit_stack;
+
 int RegExMatch::_find(const Variant &p_name) const {
 	if (p_name.is_num()) {
 		int i = (int)p_name;
@@ -159,11 +183,62 @@ void RegEx::_pattern_info(uint32_t what, void *where) const {
 	pcre2_pattern_info_32((pcre2_code_32 *)code, what, where);
 }
 
+void *RegEx::_create_match_context() const {
+	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
+	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	if (jit) {
+		pcre2_jit_stack_assign_32(mctx, nullptr, jit_stack.get());
+	}
+	return mctx;
+}
+
+Ref<RegExMatch> RegEx::_create_match(const String &p_subject, void *p_match_data) const {
+	pcre2_match_data_32 *match = (pcre2_match_data_32 *)p_match_data;
+
+	Ref<RegExMatch> result = memnew(RegExMatch);
+
+	uint32_t size = pcre2_get_ovector_count_32(match);
+	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
+
+	result->data.resize(size);
+
+	for (uint32_t i = 0; i < size; i++) {
+		result->data.write[i].start = ovector[i * 2];
+		result->data.write[i].end = ovector[i * 2 + 1];
+	}
+
+	result->subject = p_subject;
+
+	uint32_t count;
+	const char32_t *table;
+	uint32_t entry_size;
+
+	_pattern_info(PCRE2_INFO_NAMECOUNT, &count);
+	_pattern_info(PCRE2_INFO_NAMETABLE, &table);
+	_pattern_info(PCRE2_INFO_NAMEENTRYSIZE, &entry_size);
+
+	for (uint32_t i = 0; i < count; i++) {
+		char32_t id = table[i * entry_size];
+		if (result->data[id].start == -1) {
+			continue;
+		}
+		String name = &table[i * entry_size + 1];
+		if (result->names.has(name)) {
+			continue;
+		}
+
+		result->names.insert(name, id);
+	}
+
+	return result;
+}
+
 void RegEx::clear() {
 	if (code) {
 		pcre2_code_free_32((pcre2_code_32 *)code);
 		code = nullptr;
 	}
+	jit = false;
 }
 
 Error RegEx::compile(const String &p_pattern) {
@@ -189,14 +264,17 @@ Error RegEx::compile(const String &p_pattern) {
 		ERR_PRINT(message.utf8());
 		return FAILED;
 	}
+
+	// Fails when PCRE2 was built without JIT support or for an unsupported architecture,
+	// matching then falls back to the interpreter.
+	jit = pcre2_jit_compile_32((pcre2_code_32 *)code, PCRE2_JIT_COMPLETE) == 0;
+
 	return OK;
 }
 
 Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end) const {
 	ERR_FAIL_COND_V(!is_valid(), nullptr);
 
-	Ref<RegExMatch> result = memnew(RegExMatch);
-
 	int length = p_subject.length();
 	if (p_end >= 0 && p_end < length) {
 		length = p_end;
@@ -204,71 +282,101 @@ Ref<RegExMatch> RegEx::search(const String &p_subject, int p_offset, int p_end)
 
 	pcre2_code_32 *c = (pcre2_code_32 *)code;
 	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_match_context_32 *mctx = (pcre2_match_context_32 *)_create_match_context();
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
 	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
 
 	int res = pcre2_match_32(c, s, length, p_offset, 0, match, mctx);
 
-	if (res < 0) {
-		pcre2_match_data_free_32(match);
-		pcre2_match_context_free_32(mctx);
+	Ref<RegExMatch> result;
+	if (res >= 0) {
+		result = _create_match(p_subject, match);
+	}
+
+	pcre2_match_data_free_32(match);
+	pcre2_match_context_free_32(mctx);
+
+	return result;
+}
 
-		return nullptr;
+Array RegEx::search_all(const String &p_subject, int p_offset, int p_end) const {
+	Array result;
+
+	ERR_FAIL_COND_V(!is_valid(), result);
+
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
 	}
 
-	uint32_t size = pcre2_get_ovector_count_32(match);
-	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
+	// The match context and data are shared by all the matches.
+	pcre2_code_32 *c = (pcre2_code_32 *)code;
+	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
+	pcre2_match_context_32 *mctx = (pcre2_match_context_32 *)_create_match_context();
+	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
-	result->data.resize(size);
+	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
 
-	for (uint32_t i = 0; i < size; i++) {
-		result->data.write[i].start = ovector[i * 2];
-		result->data.write[i].end = ovector[i * 2 + 1];
+	int last_end = -1;
+	int offset = p_offset;
+	while (pcre2_match_32(c, s, length, offset, 0, match, mctx) >= 0) {
+		int end = ovector[1];
+		if (last_end == end) {
+			break;
+		}
+		result.push_back(_create_match(p_subject, match));
+		last_end = end;
+		offset = end;
 	}
 
 	pcre2_match_data_free_32(match);
 	pcre2_match_context_free_32(mctx);
 
-	result->subject = p_subject;
-
-	uint32_t count;
-	const char32_t *table;
-	uint32_t entry_size;
+	return result;
+}
 
-	_pattern_info(PCRE2_INFO_NAMECOUNT, &count);
-	_pattern_info(PCRE2_INFO_NAMETABLE, &table);
-	_pattern_info(PCRE2_INFO_NAMEENTRYSIZE, &entry_size);
+PackedInt32Array RegEx::search_all_offsets(const String &p_subject, int p_offset, int p_end) const {
+	PackedInt32Array result;
 
-	for (uint32_t i = 0; i < count; i++) {
-		char32_t id = table[i * entry_size];
-		if (result->data[id].start == -1) {
-			continue;
-		}
-		String name = &table[i * entry_size + 1];
-		if (result->names.has(name)) {
-			continue;
-		}
+	ERR_FAIL_COND_V(!is_valid(), result);
 
-		result->names.insert(name, id);
+	int length = p_subject.length();
+	if (p_end >= 0 && p_end < length) {
+		length = p_end;
 	}
 
-	return result;
-}
+	pcre2_code_32 *c = (pcre2_code_32 *)code;
+	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
+	pcre2_match_context_32 *mctx = (pcre2_match_context_32 *)_create_match_context();
+	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 
-Array RegEx::search_all(const String &p_subject, int p_offset, int p_end) const {
+	pcre2_match_data_32 *match = pcre2_match_data_create_from_pattern_32(c, gctx);
+	uint32_t size = pcre2_get_ovector_count_32(match);
+	PCRE2_SIZE *ovector = pcre2_get_ovector_pointer_32(match);
+
+	// Same iteration as search_all(), but only the group offsets are kept, without a RegExMatch per result.
 	int last_end = -1;
-	Array result;
-	Ref<RegExMatch> match = search(p_subject, p_offset, p_end);
-	while (match.is_valid()) {
-		if (last_end == match->get_end(0)) {
+	int offset = p_offset;
+	while (pcre2_match_32(c, s, length, offset, 0, match, mctx) >= 0) {
+		int end = ovector[1];
+		if (last_end == end) {
 			break;
 		}
-		result.push_back(match);
-		last_end = match->get_end(0);
-		match = search(p_subject, match->get_end(0), p_end);
+		int from = result.size();
+		result.resize(from + size * 2);
+		int32_t *w = result.ptrw() + from;
+		for (uint32_t i = 0; i < size * 2; i++) {
+			w[i] = ovector[i];
+		}
+		last_end = end;
+		offset = end;
 	}
+
+	pcre2_match_data_free_32(match);
+	pcre2_match_context_free_32(mctx);
+
 	return result;
 }
 
@@ -297,7 +405,7 @@ String RegEx::sub(const String &p_subject, const String &p_replacement, bool p_a
 
 	pcre2_code_32 *c = (pcre2_code_32 *)code;
 	pcre2_general_context_32 *gctx = (pcre2_general_context_32 *)general_ctx;
-	pcre2_match_context_32 *mctx = pcre2_match_context_create_32(gctx);
+	pcre2_match_context_32 *mctx = (pcre2_match_context_32 *)_create_match_context();
 	PCRE2_SPTR32 s = (PCRE2_SPTR32)p_subject.get_data();
 	PCRE2_SPTR32 r = (PCRE2_SPTR32)p_replacement.get_data();
 	PCRE2_UCHAR32 *o = (PCRE2_UCHAR32 *)output.ptrw();
@@ -384,6 +492,7 @@ void RegEx::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("compile", "pattern"), &RegEx::compile);
 	ClassDB::bind_method(D_METHOD("search", "subject", "offset", "end"), &RegEx::search, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("search_all", "subject", "offset", "end"), &RegEx::search_all, DEFVAL(0), DEFVAL(-1));
+	ClassDB::bind_method(D_METHOD("search_all_offsets", "subject", "offset", "end"), &RegEx::search_all_offsets, DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("sub", "subject", "replacement", "all", "offset", "end"), &RegEx::sub, DEFVAL(false), DEFVAL(0), DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("is_valid"), &RegEx::is_valid);
 	ClassDB::bind_method(D_METHOD("get_pattern"), &RegEx::get_pattern);
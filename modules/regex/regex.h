@@ -73,9 +73,12 @@ class RegEx : public Reference {
 
 	void *general_ctx;
 	void *code = nullptr;
+	bool jit = false;
 	String pattern;
 
 	void _pattern_info(uint32_t what, void *where) const;
+	void *_create_match_context() const;
+	Ref<RegExMatch> _create_match(const String &p_subject, void *p_match_data) const;
 
 protected:
 	static void _bind_methods();
@@ -86,6 +89,7 @@ public:
 
 	Ref<RegExMatch> search(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	Array search_all(const String &p_subject, int p_offset = 0, int p_end = -1) const;
+	PackedInt32Array search_all_offsets(const String &p_subject, int p_offset = 0, int p_end = -1) const;
 	String sub(const String &p_subject, const String &p_replacement, bool p_all = false, int p_offset = 0, int p_end = -1) const;
 
 	bool is_valid() const;
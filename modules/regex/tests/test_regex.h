@@ -101,6 +101,29 @@ TEST_CASE("[RegEx] Searching") {
 	CHECK(re.search_all(s).size() == 0);
 }
 
+TEST_CASE("[RegEx] Searching offsets") {
+	const String s = "d01, d03, x3f";
+
+	RegEx re("(d)?([0-9a-f]{2})");
+	REQUIRE(re.is_valid());
+
+	const PackedInt32Array offsets = re.search_all_offsets(s);
+	const Array all_results = re.search_all(s);
+	REQUIRE(all_results.size() == 3);
+	REQUIRE(offsets.size() == 3 * 3 * 2);
+	for (int i = 0; i < all_results.size(); i++) {
+		Ref<RegExMatch> match = all_results[i];
+		for (int j = 0; j < 3; j++) {
+			CHECK(offsets[(i * 3 + j) * 2] == match->get_start(j));
+			CHECK(offsets[(i * 3 + j) * 2 + 1] == match->get_end(j));
+		}
+	}
+	CHECK_MESSAGE(offsets[(2 * 3 + 1) * 2] == -1, "Unmatched groups are reported as -1.");
+
+	CHECK(re.search_all_offsets(s, 0, 3).size() == 3 * 2);
+	CHECK(re.search_all_offsets("d").size() == 0);
+}
+
 TEST_CASE("[RegEx] Substitution") {
 	String s = "Double all the vowels.";
 
@@ -116,6 +139,7 @@ TEST_CASE("[RegEx] Uninitialized use") {
 	ERR_PRINT_OFF;
 	CHECK(re.search(s) == nullptr);
 	CHECK(re.search_all(s).size() == 0);
+	CHECK(re.search_all_offsets(s).size() == 0);
 	CHECK(re.sub(s, "") == "");
 	CHECK(re.get_group_count() == 0);
 	CHECK(re.get_names().size() == 0);
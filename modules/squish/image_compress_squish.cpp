@@ -30,8 +30,33 @@
 
 #include "image_compress_squish.h"
 
+#include "core/os/os.h"
+#include "core/templates/thread_work_pool.h"
+
 #include <squish.h>
 
+// Block rows compressed by each job, images are split in bands so large mipmaps use all cores.
+#define SQUISH_BAND_BLOCK_ROWS 16
+
+struct SquishCompressJob {
+	struct Band {
+		int src_ofs = 0;
+		int dst_ofs = 0;
+		int width = 0;
+		int height = 0;
+	};
+
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	int flags = 0;
+	Vector<Band> bands;
+
+	void compress_band(uint32_t p_index, void *p_userdata) {
+		const Band &band = bands[p_index];
+		squish::CompressImage(&src[band.src_ofs], band.width, band.height, &dst[band.dst_ofs], flags);
+	}
+};
+
 void image_decompress_squish(Image *p_image) {
 	int w = p_image->get_width();
 	int h = p_image->get_height();
@@ -137,8 +162,10 @@ void image_compress_squish(Image *p_image, float p_lossy_quality, Image::UsedCha
 		data.resize(target_size);
 		int shift = Image::get_format_pixel_rshift(target_format);
 
-		const uint8_t *rb = p_image->get_data().ptr();
-		uint8_t *wb = data.ptrw();
+		SquishCompressJob job;
+		job.src = p_image->get_data().ptr();
+		job.dst = data.ptrw();
+		job.flags = squish_comp;
 
 		int dst_ofs = 0;
 
@@ -147,12 +174,34 @@ void image_compress_squish(Image *p_image, float p_lossy_quality, Image::UsedCha
 			int bh = h % 4 != 0 ? h + (4 - h % 4) : h;
 
 			int src_ofs = p_image->get_mipmap_offset(i);
-			squish::CompressImage(&rb[src_ofs], w, h, &wb[dst_ofs], squish_comp);
+			int band_dst_size = (MAX(4, bw) * 4 * SQUISH_BAND_BLOCK_ROWS) >> shift;
+
+			for (int y = 0, band = 0; y < h; y += 4 * SQUISH_BAND_BLOCK_ROWS, band++) {
+				SquishCompressJob::Band b;
+				b.src_ofs = src_ofs + y * w * 4;
+				b.dst_ofs = dst_ofs + band * band_dst_size;
+				b.width = w;
+				b.height = MIN(h - y, 4 * SQUISH_BAND_BLOCK_ROWS);
+				job.bands.push_back(b);
+			}
+
 			dst_ofs += (MAX(4, bw) * MAX(4, bh)) >> shift;
 			w = MAX(w / 2, 1);
 			h = MAX(h / 2, 1);
 		}
 
+		int thread_count = OS::get_singleton()->can_use_threads() ? MIN(job.bands.size(), OS::get_singleton()->get_processor_count()) : 1;
+		if (thread_count > 1) {
+			ThreadWorkPool work_pool;
+			work_pool.init(thread_count);
+			work_pool.do_work(job.bands.size(), &job, &SquishCompressJob::compress_band, (void *)nullptr);
+			work_pool.finish();
+		} else {
+			for (int i = 0; i < job.bands.size(); i++) {
+				job.compress_band(i, nullptr);
+			}
+		}
+
 		p_image->create(p_image->get_width(), p_image->get_height(), p_image->has_mipmaps(), target_format, data);
 	}
 }
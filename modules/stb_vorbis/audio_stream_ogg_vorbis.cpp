@@ -35,11 +35,17 @@
 void AudioStreamPlaybackOGGVorbis::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	ERR_FAIL_COND(!active);
 
+	if (!prefetch.mix(p_buffer, p_frames)) {
+		active = false;
+	}
+}
+
+int AudioStreamPlaybackOGGVorbis::_decode(AudioFrame *p_buffer, int p_frames) {
 	int todo = p_frames;
 
 	int start_buffer = 0;
 
-	while (todo && active) {
+	while (todo) {
 		float *buffer = (float *)p_buffer;
 		if (start_buffer > 0) {
 			buffer = (buffer + start_buffer * 2);
@@ -59,19 +65,17 @@ void AudioStreamPlaybackOGGVorbis::_mix_internal(AudioFrame *p_buffer, int p_fra
 			bool is_not_empty = mixed > 0 || stb_vorbis_stream_length_in_samples(ogg_stream) > 0;
 			if (vorbis_stream->loop && is_not_empty) {
 				//loop
-				seek(vorbis_stream->loop_offset);
+				_seek_decoder(vorbis_stream->loop_offset);
 				loops++;
 				// we still have buffer to fill, start from this element in the next iteration.
 				start_buffer = p_frames - todo;
 			} else {
-				for (int i = p_frames - todo; i < p_frames; i++) {
-					p_buffer[i] = AudioFrame(0, 0);
-				}
-				active = false;
-				todo = 0;
+				break;
 			}
 		}
 	}
+
+	return p_frames - todo;
 }
 
 float AudioStreamPlaybackOGGVorbis::get_stream_sampling_rate() {
@@ -87,6 +91,7 @@ void AudioStreamPlaybackOGGVorbis::start(float p_from_pos) {
 
 void AudioStreamPlaybackOGGVorbis::stop() {
 	active = false;
+	prefetch.stop();
 }
 
 bool AudioStreamPlaybackOGGVorbis::is_playing() const {
@@ -98,14 +103,15 @@ int AudioStreamPlaybackOGGVorbis::get_loop_count() const {
 }
 
 float AudioStreamPlaybackOGGVorbis::get_playback_position() const {
-	return float(frames_mixed) / vorbis_stream->sample_rate;
-}
-
-void AudioStreamPlaybackOGGVorbis::seek(float p_time) {
-	if (!active) {
-		return;
+	int64_t frame = int64_t(frames_mixed) - prefetch.get_buffered_frames();
+	if (frame < 0) {
+		// The prefetched frames go across the loop point.
+		frame += int64_t((vorbis_stream->length - vorbis_stream->loop_offset) * vorbis_stream->sample_rate);
 	}
+	return float(frame) / vorbis_stream->sample_rate;
+}
 
+void AudioStreamPlaybackOGGVorbis::_seek_decoder(float p_time) {
 	if (p_time >= vorbis_stream->get_length()) {
 		p_time = 0;
 	}
@@ -114,7 +120,20 @@ void AudioStreamPlaybackOGGVorbis::seek(float p_time) {
 	stb_vorbis_seek(ogg_stream, frames_mixed);
 }
 
+void AudioStreamPlaybackOGGVorbis::seek(float p_time) {
+	if (!active) {
+		return;
+	}
+
+	prefetch.lock();
+	_seek_decoder(p_time);
+	prefetch.clear();
+	prefetch.unlock();
+}
+
 AudioStreamPlaybackOGGVorbis::~AudioStreamPlaybackOGGVorbis() {
+	prefetch.finish();
+
 	if (ogg_alloc.alloc_buffer) {
 		stb_vorbis_close(ogg_stream);
 		memfree(ogg_alloc.alloc_buffer);
@@ -144,6 +163,9 @@ Ref<AudioStreamPlayback> AudioStreamOGGVorbis::instance_playback() {
 		ERR_FAIL_COND_V(!ovs->ogg_stream, Ref<AudioStreamPlaybackOGGVorbis>());
 	}
 
+	// Half a second ahead is plenty to hide the decoding from the audio thread.
+	ovs->prefetch.init(&AudioStreamPlaybackOGGVorbis::_decode_func, ovs.ptr(), sample_rate / 2);
+
 	return ovs;
 }
 
@@ -148,6 +148,7 @@ void TextServerAdvanced::free(RID p_rid) {
 		FontDataAdvanced *fd = font_owner.getornull(p_rid);
 		font_owner.free(p_rid);
 		memdelete(fd);
+		shape_run_cache.clear();
 	} else if (shaped_owner.owns(p_rid)) {
 		ShapedTextDataAdvanced *sd = shaped_owner.getornull(p_rid);
 		shaped_owner.free(p_rid);
@@ -612,6 +613,7 @@ void TextServerAdvanced::font_set_spacing_space(RID p_font, int p_value) {
 	_THREAD_SAFE_METHOD_
 	FontDataAdvanced *fd = font_owner.getornull(p_font);
 	ERR_FAIL_COND(!fd);
+	shape_run_cache.clear();
 	fd->set_spacing_space(p_value);
 }
 
@@ -626,6 +628,7 @@ void TextServerAdvanced::font_set_spacing_glyph(RID p_font, int p_value) {
 	_THREAD_SAFE_METHOD_
 	FontDataAdvanced *fd = font_owner.getornull(p_font);
 	ERR_FAIL_COND(!fd);
+	shape_run_cache.clear();
 	fd->set_spacing_glyph(p_value);
 }
 
@@ -633,6 +636,7 @@ void TextServerAdvanced::font_set_antialiased(RID p_font, bool p_antialiased) {
 	_THREAD_SAFE_METHOD_
 	FontDataAdvanced *fd = font_owner.getornull(p_font);
 	ERR_FAIL_COND(!fd);
+	shape_run_cache.clear();
 	fd->set_antialiased(p_antialiased);
 }
 
@@ -661,6 +665,7 @@ void TextServerAdvanced::font_set_variation(RID p_font, const String &p_name, do
 	_THREAD_SAFE_METHOD_
 	FontDataAdvanced *fd = font_owner.getornull(p_font);
 	ERR_FAIL_COND(!fd);
+	shape_run_cache.clear();
 	fd->set_variation(p_name, p_value);
 }
 
@@ -675,6 +680,7 @@ void TextServerAdvanced::font_set_distance_field_hint(RID p_font, bool p_distanc
 	_THREAD_SAFE_METHOD_
 	FontDataAdvanced *fd = font_owner.getornull(p_font);
 	ERR_FAIL_COND(!fd);
+	shape_run_cache.clear();
 	fd->set_distance_field_hint(p_distance_field);
 }
 
@@ -689,6 +695,7 @@ void TextServerAdvanced::font_set_hinting(RID p_font, TextServer::Hinting p_hint
 	_THREAD_SAFE_METHOD_
 	FontDataAdvanced *fd = font_owner.getornull(p_font);
 	ERR_FAIL_COND(!fd);
+	shape_run_cache.clear();
 	fd->set_hinting(p_hinting);
 }
 
@@ -703,6 +710,7 @@ void TextServerAdvanced::font_set_force_autohinter(RID p_font, bool p_enabeld) {
 	_THREAD_SAFE_METHOD_
 	FontDataAdvanced *fd = font_owner.getornull(p_font);
 	ERR_FAIL_COND(!fd);
+	shape_run_cache.clear();
 	fd->set_force_autohinter(p_enabeld);
 }
 
@@ -877,6 +885,7 @@ void TextServerAdvanced::font_set_oversampling(float p_oversampling) {
 	_THREAD_SAFE_METHOD_
 	if (oversampling != p_oversampling) {
 		oversampling = p_oversampling;
+		shape_run_cache.clear();
 		List<RID> fonts;
 		font_owner.get_owned_list(&fonts);
 		for (List<RID>::Element *E = fonts.front(); E; E = E->next()) {
@@ -1951,6 +1960,130 @@ TextServer::Glyph TextServerAdvanced::_shape_single_glyph(ShapedTextDataAdvanced
 	return gl;
 }
 
+bool TextServerAdvanced::ShapeRunKey::operator==(const ShapeRunKey &p_key) const {
+	if (run_offset != p_key.run_offset || run_length != p_key.run_length || font_size != p_key.font_size || script != p_key.script || direction != p_key.direction || flags != p_key.flags) {
+		return false;
+	}
+	if (fonts.size() != p_key.fonts.size() || features.size() != p_key.features.size()) {
+		return false;
+	}
+	for (int i = 0; i < fonts.size(); i++) {
+		if (fonts[i] != p_key.fonts[i]) {
+			return false;
+		}
+	}
+	for (int i = 0; i < features.size(); i++) {
+		if (features[i] != p_key.features[i]) {
+			return false;
+		}
+	}
+	return text == p_key.text && language == p_key.language;
+}
+
+uint32_t TextServerAdvanced::ShapeRunKeyHasher::hash(const ShapeRunKey &p_key) {
+	uint32_t h = p_key.text.hash();
+	h = hash_djb2_one_32(p_key.run_offset, h);
+	h = hash_djb2_one_32(p_key.run_length, h);
+	h = hash_djb2_one_32(p_key.font_size, h);
+	h = hash_djb2_one_32(p_key.script, h);
+	h = hash_djb2_one_32(p_key.direction, h);
+	h = hash_djb2_one_32(p_key.flags, h);
+	h = hash_djb2_one_32(p_key.language.hash(), h);
+	for (int i = 0; i < p_key.fonts.size(); i++) {
+		h = hash_djb2_one_64(p_key.fonts[i].get_id(), h);
+	}
+	for (int i = 0; i < p_key.features.size(); i++) {
+		h = hash_djb2_one_64(p_key.features[i], h);
+	}
+	return h;
+}
+
+void TextServerAdvanced::_shape_run_cached(ShapedTextDataAdvanced *p_sd, int32_t p_start, int32_t p_end, hb_script_t p_script, hb_direction_t p_direction, const Vector<RID> &p_fonts, int p_span) {
+	if (p_end - p_start > SHAPE_RUN_CACHE_MAX_LENGTH) {
+		// Long runs (e.g. paragraphs) are unlikely to repeat, don't let them evict the short ones.
+		_shape_run(p_sd, p_start, p_end, p_script, p_direction, p_fonts, p_span, 0);
+		return;
+	}
+
+	const ShapedTextDataAdvanced::Span &span = p_sd->spans[p_span];
+
+	// HarfBuzz only looks at a few characters of context around the run, and the text boundaries
+	// (BOT/EOT flags) are implied by the context being shorter than SHAPE_RUN_CONTEXT.
+	int32_t context_start = MAX(0, p_start - SHAPE_RUN_CONTEXT);
+	int32_t context_end = MIN(p_sd->text.length(), p_end + SHAPE_RUN_CONTEXT);
+
+	ShapeRunKey key;
+	key.text = p_sd->text.substr(context_start, context_end - context_start);
+	key.run_offset = p_start - context_start;
+	key.run_length = p_end - p_start;
+	key.fonts = p_fonts;
+	key.font_size = span.font_size;
+	for (const Variant *ftr = span.features.next(nullptr); ftr != nullptr; ftr = span.features.next(ftr)) {
+		uint32_t tag = *ftr;
+		int64_t value = (double)span.features[*ftr];
+		key.features.push_back(((uint64_t)tag << 32) | (uint32_t)value);
+	}
+	key.language = span.language;
+	key.script = p_script;
+	key.direction = p_direction;
+	key.flags = (p_sd->orientation == ORIENTATION_VERTICAL ? 1 : 0) | (p_sd->preserve_control ? 2 : 0) | (p_sd->preserve_invalid ? 4 : 0);
+
+	const ShapeRunResult *cached = shape_run_cache.getptr(key);
+	if (cached) {
+		const Glyph *gl = cached->glyphs.ptr();
+		for (int i = 0; i < cached->glyphs.size(); i++) {
+			Glyph g = gl[i];
+			g.start += p_start;
+			g.end += p_start;
+			p_sd->glyphs.push_back(g);
+		}
+		p_sd->ascent = MAX(p_sd->ascent, cached->ascent);
+		p_sd->descent = MAX(p_sd->descent, cached->descent);
+		p_sd->upos = MAX(p_sd->upos, cached->upos);
+		p_sd->uthk = MAX(p_sd->uthk, cached->uthk);
+		p_sd->width += cached->width;
+		return;
+	}
+
+	// Shape with run local metrics, so they can be stored and merged back.
+	float ascent = p_sd->ascent;
+	float descent = p_sd->descent;
+	float upos = p_sd->upos;
+	float uthk = p_sd->uthk;
+	float width = p_sd->width;
+	int glyph_start = p_sd->glyphs.size();
+	p_sd->ascent = 0.f;
+	p_sd->descent = 0.f;
+	p_sd->upos = 0.f;
+	p_sd->uthk = 0.f;
+	p_sd->width = 0.f;
+
+	_shape_run(p_sd, p_start, p_end, p_script, p_direction, p_fonts, p_span, 0);
+
+	ShapeRunResult result;
+	result.ascent = p_sd->ascent;
+	result.descent = p_sd->descent;
+	result.upos = p_sd->upos;
+	result.uthk = p_sd->uthk;
+	result.width = p_sd->width;
+	result.glyphs.resize(p_sd->glyphs.size() - glyph_start);
+	Glyph *w = result.glyphs.ptrw();
+	const Glyph *gl = p_sd->glyphs.ptr();
+	for (int i = 0; i < result.glyphs.size(); i++) {
+		w[i] = gl[glyph_start + i];
+		w[i].start -= p_start;
+		w[i].end -= p_start;
+	}
+
+	p_sd->ascent = MAX(ascent, result.ascent);
+	p_sd->descent = MAX(descent, result.descent);
+	p_sd->upos = MAX(upos, result.upos);
+	p_sd->uthk = MAX(uthk, result.uthk);
+	p_sd->width = width + result.width;
+
+	shape_run_cache.insert(key, result);
+}
+
 void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int32_t p_start, int32_t p_end, hb_script_t p_script, hb_direction_t p_direction, Vector<RID> p_fonts, int p_span, int p_fb_index) {
 	FontDataAdvanced *fd = nullptr;
 	if (p_fb_index < p_fonts.size()) {
@@ -2325,7 +2458,7 @@ bool TextServerAdvanced::shaped_text_shape(RID p_shaped) {
 									fonts.push_back(sd->spans[k].fonts[l]);
 								}
 							}
-							_shape_run(sd, MAX(sd->spans[k].start, script_run_start), MIN(sd->spans[k].end, script_run_end), sd->script_iter->script_ranges[j].script, bidi_run_direction, fonts, k, 0);
+							_shape_run_cached(sd, MAX(sd->spans[k].start, script_run_start), MIN(sd->spans[k].end, script_run_end), sd->script_iter->script_ranges[j].script, bidi_run_direction, fonts, k);
 						}
 					}
 				}
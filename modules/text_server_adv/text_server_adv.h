@@ -38,6 +38,7 @@
 
 #include "servers/text_server.h"
 
+#include "core/templates/lru.h"
 #include "core/templates/rid_owner.h"
 #include "scene/resources/texture.h"
 #include "script_iterator.h"
@@ -92,9 +93,47 @@ class TextServerAdvanced : public TextServer {
 	mutable RID_PtrOwner<FontDataAdvanced> font_owner;
 	mutable RID_PtrOwner<ShapedTextDataAdvanced> shaped_owner;
 
+	/* Shaped run cache, shared by all shaped texts. */
+	enum {
+		SHAPE_RUN_CACHE_SIZE = 4096,
+		SHAPE_RUN_CACHE_MAX_LENGTH = 256,
+		SHAPE_RUN_CONTEXT = 5, // Same as HarfBuzz's HB_BUFFER_MAX_CONTEXT_LENGTH.
+	};
+
+	struct ShapeRunKey {
+		String text; // Run with up to SHAPE_RUN_CONTEXT characters of context on both sides.
+		int32_t run_offset = 0;
+		int32_t run_length = 0;
+		Vector<RID> fonts;
+		int font_size = 0;
+		Vector<uint64_t> features;
+		String language;
+		hb_script_t script = HB_SCRIPT_INVALID;
+		hb_direction_t direction = HB_DIRECTION_INVALID;
+		uint32_t flags = 0;
+
+		bool operator==(const ShapeRunKey &p_key) const;
+	};
+
+	struct ShapeRunKeyHasher {
+		static uint32_t hash(const ShapeRunKey &p_key);
+	};
+
+	struct ShapeRunResult {
+		Vector<Glyph> glyphs; // Ranges are relative to the run start.
+		float ascent = 0.f;
+		float descent = 0.f;
+		float width = 0.f;
+		float upos = 0.f;
+		float uthk = 0.f;
+	};
+
+	LRUCache<ShapeRunKey, ShapeRunResult, ShapeRunKeyHasher> shape_run_cache = LRUCache<ShapeRunKey, ShapeRunResult, ShapeRunKeyHasher>(SHAPE_RUN_CACHE_SIZE);
+
 	int _convert_pos(const ShapedTextDataAdvanced *p_sd, int p_pos) const;
 	int _convert_pos_inv(const ShapedTextDataAdvanced *p_sd, int p_pos) const;
 	void _shape_run(ShapedTextDataAdvanced *p_sd, int32_t p_start, int32_t p_end, hb_script_t p_script, hb_direction_t p_direction, Vector<RID> p_fonts, int p_span, int p_fb_index);
+	void _shape_run_cached(ShapedTextDataAdvanced *p_sd, int32_t p_start, int32_t p_end, hb_script_t p_script, hb_direction_t p_direction, const Vector<RID> &p_fonts, int p_span);
 	TextServer::Glyph _shape_single_glyph(ShapedTextDataAdvanced *p_sd, char32_t p_char, hb_script_t p_script, hb_direction_t p_direction, RID p_font, int p_font_size);
 
 protected:
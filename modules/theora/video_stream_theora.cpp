@@ -88,20 +88,20 @@ void VideoStreamPlaybackTheora::video_write() {
 	int pitch = 4;
 	frame_data.resize(size.x * size.y * pitch);
 	{
-		uint8_t *w = frame_data.ptrw();
-		char *dst = (char *)w;
+		ConvertData data;
+		for (int i = 0; i < 3; i++) {
+			data.yuv[i] = yuv[i];
+		}
+		data.dst = frame_data.ptrw();
 
 		//uv_offset=(ti.pic_x/2)+(yuv[1].stride)*(ti.pic_y/2);
 
-		if (px_fmt == TH_PF_444) {
-			yuv444_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
-
-		} else if (px_fmt == TH_PF_422) {
-			yuv422_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
-
-		} else if (px_fmt == TH_PF_420) {
-			yuv420_2_rgb8888((uint8_t *)dst, (uint8_t *)yuv[0].data, (uint8_t *)yuv[1].data, (uint8_t *)yuv[2].data, size.x, size.y, yuv[0].stride, yuv[1].stride, size.x << 2);
-		};
+		const int job_count = (size.y + CONVERT_ROWS_PER_JOB - 1) / CONVERT_ROWS_PER_JOB;
+		if (job_count > 1 && convert_pool.get_thread_count() > 0) {
+			convert_pool.do_work(job_count, this, &VideoStreamPlaybackTheora::_convert_job, (const ConvertData *)&data);
+		} else {
+			_convert_rows(0, size.y, data);
+		}
 
 		format = Image::FORMAT_RGBA8;
 	}
@@ -113,6 +113,31 @@ void VideoStreamPlaybackTheora::video_write() {
 	frames_pending = 1;
 }
 
+void VideoStreamPlaybackTheora::_convert_rows(int p_from, int p_to, const ConvertData &p_data) {
+	const th_img_plane *yuv = p_data.yuv;
+	uint8_t *dst = p_data.dst + p_from * (size.x << 2);
+	uint8_t *y = (uint8_t *)yuv[0].data + p_from * yuv[0].stride;
+	// Chroma planes have half the rows in 4:2:0.
+	const int uv_from = px_fmt == TH_PF_420 ? p_from / 2 : p_from;
+	uint8_t *u = (uint8_t *)yuv[1].data + uv_from * yuv[1].stride;
+	uint8_t *v = (uint8_t *)yuv[2].data + uv_from * yuv[2].stride;
+
+	if (px_fmt == TH_PF_444) {
+		yuv444_2_rgb8888(dst, y, u, v, size.x, p_to - p_from, yuv[0].stride, yuv[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_422) {
+		yuv422_2_rgb8888(dst, y, u, v, size.x, p_to - p_from, yuv[0].stride, yuv[1].stride, size.x << 2);
+
+	} else if (px_fmt == TH_PF_420) {
+		yuv420_2_rgb8888(dst, y, u, v, size.x, p_to - p_from, yuv[0].stride, yuv[1].stride, size.x << 2);
+	};
+}
+
+void VideoStreamPlaybackTheora::_convert_job(uint32_t p_job, const ConvertData *p_data) {
+	const int from = p_job * CONVERT_ROWS_PER_JOB;
+	_convert_rows(from, MIN(from + int(CONVERT_ROWS_PER_JOB), size.y), *p_data);
+}
+
 void VideoStreamPlaybackTheora::clear() {
 	if (!file) {
 		return;
@@ -647,6 +672,12 @@ void VideoStreamPlaybackTheora::_streaming_thread(void *ud) {
 VideoStreamPlaybackTheora::VideoStreamPlaybackTheora() {
 	texture = Ref<ImageTexture>(memnew(ImageTexture));
 
+	// The calling thread converts rows too.
+	const int convert_threads = MIN(int(MAX_CONVERT_THREADS), OS::get_singleton()->get_processor_count() - 1);
+	if (OS::get_singleton()->can_use_threads() && convert_threads > 0) {
+		convert_pool.init(convert_threads);
+	}
+
 #ifdef THEORA_USE_THREAD_STREAMING
 	int rb_power = nearest_shift(RB_SIZE_KB * 1024);
 	ring_buffer.resize(rb_power);
@@ -663,6 +694,10 @@ VideoStreamPlaybackTheora::~VideoStreamPlaybackTheora() {
 #endif
 	clear();
 
+	if (convert_pool.get_thread_count() > 0) {
+		convert_pool.finish();
+	}
+
 	if (file) {
 		memdelete(file);
 	}
@@ -36,6 +36,7 @@
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
 #include "core/templates/ring_buffer.h"
+#include "core/templates/thread_work_pool.h"
 #include "scene/resources/video_stream.h"
 #include "servers/audio_server.h"
 
@@ -60,9 +61,24 @@ class VideoStreamPlaybackTheora : public VideoStreamPlayback {
 	int audio_frames_wrote = 0;
 	Point2i size;
 
+	enum {
+		CONVERT_ROWS_PER_JOB = 64, // Must stay even, 4:2:0 frames are converted two rows at a time.
+		MAX_CONVERT_THREADS = 4,
+	};
+
+	struct ConvertData {
+		th_ycbcr_buffer yuv;
+		uint8_t *dst = nullptr;
+	};
+
+	// Big frames are converted from YUV in bands of rows on this pool, it's kept for the whole playback.
+	ThreadWorkPool convert_pool;
+
 	int buffer_data();
 	int queue_page(ogg_page *page);
 	void video_write();
+	void _convert_rows(int p_from, int p_to, const ConvertData &p_data);
+	void _convert_job(uint32_t p_job, const ConvertData *p_data);
 	float get_time() const;
 
 	bool theora_eos = false;
@@ -722,10 +722,34 @@ public:
 	VisualScriptFunctionCall *node;
 	VisualScriptInstance *instance;
 
+	// Method resolved for the last class called, so consecutive steps on objects of the same class
+	// skip the ClassDB lookup.
+	StringName cached_class;
+	MethodBind *cached_method = nullptr;
+
 	//virtual int get_working_memory_size() const { return 0; }
 	//virtual bool is_output_port_unsequenced(int p_idx) const { return false; }
 	//virtual bool get_output_port_unsequenced(int p_idx,Variant* r_value,Variant* p_working_mem,String &r_error) const { return true; }
 
+	_FORCE_INLINE_ Variant call_object(Object *p_base, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+		if (p_base->get_script_instance()) {
+			// Scripts can override or add methods.
+			return p_base->call(function, p_args, p_argcount, r_error);
+		}
+
+		const StringName &class_name = p_base->get_class_name();
+		if (class_name != cached_class) {
+			cached_class = class_name;
+			cached_method = ClassDB::get_method(class_name, function);
+		}
+		if (!cached_method) {
+			return p_base->call(function, p_args, p_argcount, r_error);
+		}
+
+		r_error.error = Callable::CallError::CALL_OK;
+		return cached_method->call(p_base, p_args, p_argcount, r_error);
+	}
+
 	_FORCE_INLINE_ bool call_rpc(Object *p_base, const Variant **p_args, int p_argcount) {
 		if (!p_base) {
 			return false;
@@ -763,9 +787,9 @@ public:
 				if (rpc_mode) {
 					call_rpc(object, p_inputs, input_args);
 				} else if (returns) {
-					*p_outputs[0] = object->call(function, p_inputs, input_args, r_error);
+					*p_outputs[0] = call_object(object, p_inputs, input_args, r_error);
 				} else {
-					object->call(function, p_inputs, input_args, r_error);
+					call_object(object, p_inputs, input_args, r_error);
 				}
 			} break;
 			case VisualScriptFunctionCall::CALL_MODE_NODE_PATH: {
@@ -786,9 +810,9 @@ public:
 				if (rpc_mode) {
 					call_rpc(node, p_inputs, input_args);
 				} else if (returns) {
-					*p_outputs[0] = another->call(function, p_inputs, input_args, r_error);
+					*p_outputs[0] = call_object(another, p_inputs, input_args, r_error);
 				} else {
-					another->call(function, p_inputs, input_args, r_error);
+					call_object(another, p_inputs, input_args, r_error);
 				}
 
 			} break;
@@ -837,9 +861,9 @@ public:
 				if (rpc_mode) {
 					call_rpc(object, p_inputs, input_args);
 				} else if (returns) {
-					*p_outputs[0] = object->call(function, p_inputs, input_args, r_error);
+					*p_outputs[0] = call_object(object, p_inputs, input_args, r_error);
 				} else {
-					object->call(function, p_inputs, input_args, r_error);
+					call_object(object, p_inputs, input_args, r_error);
 				}
 			} break;
 		}
@@ -74,10 +74,10 @@ static Vector<uint8_t> _webp_lossy_pack(const Ref<Image> &p_image, float p_quali
 	return dst;
 }
 
-static Ref<Image> _webp_lossy_unpack(const Vector<uint8_t> &p_buffer) {
-	int size = p_buffer.size() - 4;
+static Ref<Image> _webp_lossy_unpack(const uint8_t *p_buffer, int p_size) {
+	int size = p_size - 4;
 	ERR_FAIL_COND_V(size <= 0, Ref<Image>());
-	const uint8_t *r = p_buffer.ptr();
+	const uint8_t *r = p_buffer;
 
 	ERR_FAIL_COND_V(r[0] != 'W' || r[1] != 'E' || r[2] != 'B' || r[3] != 'P', Ref<Image>());
 	WebPBitstreamFeatures features;
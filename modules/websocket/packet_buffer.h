@@ -44,6 +44,12 @@ private:
 
 	RingBuffer<_Packet> _packets;
 	RingBuffer<uint8_t> _payload;
+	int _pending_release = 0;
+
+	void _release_payload() {
+		_payload.advance_read(_pending_release);
+		_pending_release = 0;
+	}
 
 public:
 	Error write_packet(const uint8_t *p_payload, uint32_t p_size, const T *p_info) {
@@ -79,6 +85,7 @@ public:
 	}
 
 	Error read_packet(uint8_t *r_payload, int p_bytes, T *r_info, int &r_read) {
+		_release_payload();
 		ERR_FAIL_COND_V(_packets.data_left() < 1, ERR_UNAVAILABLE);
 		_Packet p;
 		_packets.read(&p, 1);
@@ -91,11 +98,36 @@ public:
 		return OK;
 	}
 
+	// Like read_packet, but the payload is returned in place when it's
+	// contiguous in the buffer, and only copied to r_payload otherwise.
+	// It stays valid until the next read.
+	Error read_packet_in_place(const uint8_t **r_view, uint8_t *r_payload, int p_bytes, T *r_info, int &r_read) {
+		_release_payload();
+		ERR_FAIL_COND_V(_packets.data_left() < 1, ERR_UNAVAILABLE);
+		_Packet p;
+		_packets.read(&p, 1);
+		ERR_FAIL_COND_V(_payload.data_left() < (int)p.size, ERR_BUG);
+
+		r_read = p.size;
+		copymem(r_info, &p.info, sizeof(T));
+		const uint8_t *view = _payload.peek_contiguous(p.size);
+		if (view) {
+			_pending_release = p.size;
+			*r_view = view;
+		} else {
+			ERR_FAIL_COND_V(p_bytes < (int)p.size, ERR_OUT_OF_MEMORY);
+			_payload.read(r_payload, p.size);
+			*r_view = r_payload;
+		}
+		return OK;
+	}
+
 	void discard_payload(int p_size) {
 		_packets.decrease_write(p_size);
 	}
 
 	void resize(int p_pkt_shift, int p_buf_shift) {
+		_release_payload();
 		_packets.resize(p_pkt_shift);
 		_payload.resize(p_buf_shift);
 	}
@@ -105,6 +137,7 @@ public:
 	}
 
 	void clear() {
+		_pending_release = 0;
 		_payload.resize(0);
 		_packets.resize(0);
 	}
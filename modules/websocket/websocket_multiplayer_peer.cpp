@@ -73,9 +73,21 @@ void WebSocketMultiplayerPeer::_clear() {
 	_incoming_packets.clear();
 }
 
+void WebSocketMultiplayerPeer::set_compression_enabled(bool p_enabled) {
+	_compression = p_enabled;
+}
+
+bool WebSocketMultiplayerPeer::is_compression_enabled() const {
+	return _compression;
+}
+
 void WebSocketMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_buffers", "input_buffer_size_kb", "input_max_packets", "output_buffer_size_kb", "output_max_packets"), &WebSocketMultiplayerPeer::set_buffers);
 	ClassDB::bind_method(D_METHOD("get_peer", "peer_id"), &WebSocketMultiplayerPeer::get_peer);
+	ClassDB::bind_method(D_METHOD("set_compression_enabled", "enabled"), &WebSocketMultiplayerPeer::set_compression_enabled);
+	ClassDB::bind_method(D_METHOD("is_compression_enabled"), &WebSocketMultiplayerPeer::is_compression_enabled);
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compression_enabled"), "set_compression_enabled", "is_compression_enabled");
 
 	ADD_SIGNAL(MethodInfo("peer_packet", PropertyInfo(Variant::INT, "peer_source")));
 }
@@ -66,6 +66,7 @@ protected:
 	Packet _current_packet;
 
 	bool _is_multiplayer = false;
+	bool _compression = false;
 	int _target_peer = 0;
 	int _peer_id = 0;
 	int _refusing = false;
@@ -96,6 +97,9 @@ public:
 	virtual Error set_buffers(int p_in_buffer, int p_in_packets, int p_out_buffer, int p_out_packets) = 0;
 	virtual Ref<WebSocketPeer> get_peer(int p_peer_id) const = 0;
 
+	void set_compression_enabled(bool p_enabled);
+	bool is_compression_enabled() const;
+
 	void _process_multiplayer(Ref<WebSocketPeer> p_peer, uint32_t p_peer_id);
 	void _clear();
 
@@ -89,6 +89,7 @@ void WSLClient::_do_handshake() {
 				data->tcp = _tcp;
 				data->is_server = false;
 				data->id = 1;
+				data->deflate = _deflate;
 				_peer->make_context(data, _in_buf_size, _in_pkt_size, _out_buf_size, _out_pkt_size);
 				_peer->set_no_delay(true);
 				_on_connect(protocol);
@@ -135,6 +136,13 @@ bool WSLClient::_verify_headers(String &r_protocol) {
 	_WSL_CHECK_NC("sec-websocket-accept", WSLPeer::compute_key_response(_key));
 #undef _WSL_CHECK_NC
 #undef _WSL_CHECK
+	_deflate = false;
+	if (headers.has("sec-websocket-extensions")) {
+		// The only extension we offer.
+		String extension = headers["sec-websocket-extensions"].get_slice(";", 0).strip_edges().to_lower();
+		ERR_FAIL_COND_V_MSG(!_compression || extension != "permessage-deflate", false, "Server accepted an extension which wasn't offered: " + extension + ".");
+		_deflate = true;
+	}
 	if (_protocols.size() == 0) {
 		// We didn't request a custom protocol
 		ERR_FAIL_COND_V(headers.has("sec-websocket-protocol"), false);
@@ -209,6 +217,9 @@ Error WSLClient::connect_to_host(String p_host, String p_path, uint16_t p_port,
 		}
 		request += "\r\n";
 	}
+	if (_compression) {
+		request += "Sec-WebSocket-Extensions: " + String(WSLPeer::DEFLATE_EXTENSION) + "\r\n";
+	}
 	for (int i = 0; i < p_custom_headers.size(); i++) {
 		request += p_custom_headers[i] + "\r\n";
 	}
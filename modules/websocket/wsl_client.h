@@ -65,6 +65,7 @@ private:
 	String _host;
 	Vector<String> _protocols;
 	bool _use_ssl = false;
+	bool _deflate = false; // The server accepted permessage-deflate.
 
 	void _do_handshake();
 	bool _verify_headers(String &r_protocol);
@@ -39,6 +39,10 @@
 #include "core/math/random_number_generator.h"
 #include "core/os/os.h"
 
+#include <zlib.h>
+
+const char *WSLPeer::DEFLATE_EXTENSION = "permessage-deflate; server_no_context_takeover; client_no_context_takeover";
+
 String WSLPeer::generate_key() {
 	// Random key
 	RandomNumberGenerator rng;
@@ -69,6 +73,14 @@ void WSLPeer::_wsl_destroy(struct PeerData **p_data) {
 		return;
 	}
 	wslay_event_context_free(data->ctx);
+	if (data->deflate_stream) {
+		deflateEnd(data->deflate_stream);
+		memdelete(data->deflate_stream);
+	}
+	if (data->inflate_stream) {
+		inflateEnd(data->inflate_stream);
+		memdelete(data->inflate_stream);
+	}
 	memdelete(data);
 	*p_data = nullptr;
 }
@@ -196,10 +208,98 @@ Error WSLPeer::parse_message(const wslay_event_on_msg_recv_arg *arg) {
 		// Ping or pong
 		return ERR_SKIP;
 	}
+	if (arg->rsv & WSLAY_RSV1_BIT) {
+		_is_string_message = is_string;
+		Error err = _inflate(arg->msg, arg->msg_length);
+		if (err != OK) {
+			wslay_event_queue_close(_data->ctx, WSLAY_CODE_INVALID_FRAME_PAYLOAD_DATA, nullptr, 0);
+			ERR_FAIL_V_MSG(err, "Failed to decompress WebSocket message.");
+		}
+		return OK;
+	}
 	_in_buffer.write_packet(arg->msg, arg->msg_length, &is_string);
 	return OK;
 }
 
+Error WSLPeer::_deflate(const uint8_t *p_buffer, int p_buffer_size) {
+	z_stream *strm = _data->deflate_stream;
+	if (!strm) {
+		strm = memnew(z_stream);
+		strm->zalloc = Z_NULL;
+		strm->zfree = Z_NULL;
+		strm->opaque = Z_NULL;
+		// Raw deflate, as required by RFC 7692.
+		ERR_FAIL_COND_V(deflateInit2(strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK, FAILED);
+		_data->deflate_stream = strm;
+	} else {
+		deflateReset(strm); // No context takeover, every message is compressed on its own.
+	}
+
+	// The sync flush marker may not be accounted for in the bound.
+	_deflate_buffer.resize(deflateBound(strm, p_buffer_size) + 16);
+	strm->next_in = (Bytef *)p_buffer;
+	strm->avail_in = p_buffer_size;
+	strm->next_out = _deflate_buffer.ptrw();
+	strm->avail_out = _deflate_buffer.size();
+	int ret = deflate(strm, Z_SYNC_FLUSH);
+	ERR_FAIL_COND_V(ret != Z_OK || strm->avail_in > 0 || strm->avail_out == 0, FAILED);
+
+	// The empty block ending the flush (00 00 FF FF) is left out of the message.
+	int size = _deflate_buffer.size() - strm->avail_out;
+	ERR_FAIL_COND_V(size < 4, FAILED);
+	_deflate_buffer.resize(size - 4);
+	return OK;
+}
+
+Error WSLPeer::_inflate(const uint8_t *p_buffer, int p_buffer_size) {
+	z_stream *strm = _data->inflate_stream;
+	if (!strm) {
+		strm = memnew(z_stream);
+		strm->zalloc = Z_NULL;
+		strm->zfree = Z_NULL;
+		strm->opaque = Z_NULL;
+		strm->next_in = Z_NULL;
+		strm->avail_in = 0;
+		ERR_FAIL_COND_V(inflateInit2(strm, -MAX_WBITS) != Z_OK, FAILED);
+		_data->inflate_stream = strm;
+	} else {
+		inflateReset(strm);
+	}
+
+	// Decompressed messages are bound by the input buffer, like uncompressed ones.
+	const int max_size = _packet_buffer.size();
+	static const uint8_t tail[4] = { 0x00, 0x00, 0xff, 0xff };
+	const uint8_t *inputs[2] = { p_buffer, tail };
+	const int input_sizes[2] = { p_buffer_size, 4 };
+
+	int out = 0;
+	_deflate_buffer.resize(MIN(MAX(p_buffer_size * 4, 4096), max_size));
+	bool done = false;
+	for (int i = 0; i < 2 && !done; i++) {
+		strm->next_in = (Bytef *)inputs[i];
+		strm->avail_in = input_sizes[i];
+		do {
+			if (out == _deflate_buffer.size()) {
+				ERR_FAIL_COND_V_MSG(out >= max_size, ERR_OUT_OF_MEMORY, "Decompressed WebSocket message is larger than the input buffer.");
+				_deflate_buffer.resize(MIN(out * 2, max_size));
+			}
+			strm->next_out = _deflate_buffer.ptrw() + out;
+			strm->avail_out = _deflate_buffer.size() - out;
+			int ret = inflate(strm, Z_SYNC_FLUSH);
+			out = _deflate_buffer.size() - strm->avail_out;
+			if (ret == Z_STREAM_END) {
+				done = true;
+				break;
+			}
+			ERR_FAIL_COND_V(ret != Z_OK && ret != Z_BUF_ERROR, ERR_INVALID_DATA);
+		} while (strm->avail_in > 0 || strm->avail_out == 0);
+	}
+
+	uint8_t is_string = _is_string_message;
+	_in_buffer.write_packet(_deflate_buffer.ptr(), out, &is_string);
+	return OK;
+}
+
 void WSLPeer::make_context(PeerData *p_data, unsigned int p_in_buf_size, unsigned int p_in_pkt_size, unsigned int p_out_buf_size, unsigned int p_out_pkt_size) {
 	ERR_FAIL_COND(_data != nullptr);
 	ERR_FAIL_COND(p_data == nullptr);
@@ -217,6 +317,9 @@ void WSLPeer::make_context(PeerData *p_data, unsigned int p_in_buf_size, unsigne
 		wslay_event_context_client_init(&(_data->ctx), &wsl_callbacks, _data);
 	}
 	wslay_event_config_set_max_recv_msg_length(_data->ctx, (1ULL << p_in_buf_size));
+	if (_data->deflate) {
+		wslay_event_config_set_allowed_rsv_bits(_data->ctx, WSLAY_RSV1_BIT);
+	}
 }
 
 void WSLPeer::set_write_mode(WriteMode p_mode) {
@@ -227,6 +330,17 @@ WSLPeer::WriteMode WSLPeer::get_write_mode() const {
 	return write_mode;
 }
 
+bool WSLPeer::has_pending_io() const {
+	if (!_data) {
+		return false;
+	}
+	if (wslay_event_want_write(_data->ctx)) {
+		return true;
+	}
+	// The SSL layer may hold decrypted data while the socket itself is not readable.
+	return _data->conn.ptr() != _data->tcp.ptr() && _data->conn->get_available_bytes() > 0;
+}
+
 void WSLPeer::poll() {
 	if (!_data) {
 		return;
@@ -245,7 +359,14 @@ Error WSLPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size) {
 	msg.msg = p_buffer;
 	msg.msg_length = p_buffer_size;
 
-	wslay_event_queue_msg(_data->ctx, &msg);
+	uint8_t rsv = WSLAY_RSV_NONE;
+	if (_data->deflate && p_buffer_size >= DEFLATE_MIN_SIZE && _deflate(p_buffer, p_buffer_size) == OK && _deflate_buffer.size() < p_buffer_size) {
+		msg.msg = _deflate_buffer.ptr();
+		msg.msg_length = _deflate_buffer.size();
+		rsv = WSLAY_RSV1_BIT;
+	}
+
+	wslay_event_queue_msg_ex(_data->ctx, &msg, rsv);
 	if (wslay_event_send(_data->ctx) < 0) {
 		close_now();
 		return FAILED;
@@ -263,10 +384,9 @@ Error WSLPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 	}
 
 	int read = 0;
-	uint8_t *rw = _packet_buffer.ptrw();
-	_in_buffer.read_packet(rw, _packet_buffer.size(), &_is_string, read);
+	Error err = _in_buffer.read_packet_in_place(r_buffer, _packet_buffer.ptrw(), _packet_buffer.size(), &_is_string, read);
+	ERR_FAIL_COND_V(err != OK, err);
 
-	*r_buffer = rw;
 	r_buffer_size = read;
 
 	return OK;
@@ -59,21 +59,35 @@ public:
 		Ref<StreamPeerTCP> tcp;
 		int id = 1;
 		wslay_event_context_ptr ctx = nullptr;
+		bool deflate = false; // permessage-deflate was negotiated, without context takeover either way.
+		struct z_stream_s *deflate_stream = nullptr;
+		struct z_stream_s *inflate_stream = nullptr;
 	};
 
+	static const char *DEFLATE_EXTENSION;
+
 	static String compute_key_response(String p_key);
 	static String generate_key();
 
 private:
+	enum {
+		DEFLATE_MIN_SIZE = 256, // Smaller messages are sent uncompressed.
+	};
+
 	static bool _wsl_poll(struct PeerData *p_data);
 	static void _wsl_destroy(struct PeerData **p_data);
 
+	Error _deflate(const uint8_t *p_buffer, int p_buffer_size);
+	Error _inflate(const uint8_t *p_buffer, int p_buffer_size);
+
 	struct PeerData *_data = nullptr;
 	uint8_t _is_string = 0;
+	uint8_t _is_string_message = 0; // Of the message being decompressed.
 	// Our packet info is just a boolean (is_string), using uint8_t for it.
 	PacketBuffer<uint8_t> _in_buffer;
 
 	Vector<uint8_t> _packet_buffer;
+	Vector<uint8_t> _deflate_buffer; // Compressed outgoing or decompressed incoming message.
 
 	WriteMode write_mode = WRITE_MODE_BINARY;
 
@@ -101,6 +115,7 @@ public:
 	void make_context(PeerData *p_data, unsigned int p_in_buf_size, unsigned int p_in_pkt_size, unsigned int p_out_buf_size, unsigned int p_out_pkt_size);
 	Error parse_message(const wslay_event_on_msg_recv_arg *arg);
 	void invalidate();
+	bool has_pending_io() const;
 
 	WSLPeer();
 	~WSLPeer();
@@ -34,7 +34,7 @@
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
 
-bool WSLServer::PendingPeer::_parse_request(const Vector<String> p_protocols) {
+bool WSLServer::PendingPeer::_parse_request(const Vector<String> p_protocols, bool p_deflate) {
 	Vector<String> psa = String((char *)req_buf).split("\r\n");
 	int len = psa.size();
 	ERR_FAIL_COND_V_MSG(len < 4, false, "Not enough response headers, got: " + itos(len) + ", expected >= 4.");
@@ -69,6 +69,23 @@ bool WSLServer::PendingPeer::_parse_request(const Vector<String> p_protocols) {
 #undef _WSL_CHECK_EX
 #undef _WSL_CHECK
 	key = headers["sec-websocket-key"];
+	if (p_deflate && headers.has("sec-websocket-extensions")) {
+		// Accept the first permessage-deflate offer we can honor. Any window size works for
+		// decompressing, but compressing with a smaller window than ours isn't supported.
+		Vector<String> offers = headers["sec-websocket-extensions"].split(",");
+		for (int i = 0; i < offers.size() && !deflate; i++) {
+			Vector<String> params = offers[i].split(";");
+			if (params[0].strip_edges().to_lower() != "permessage-deflate") {
+				continue;
+			}
+			deflate = true;
+			for (int j = 1; j < params.size(); j++) {
+				if (params[j].strip_edges().to_lower().begins_with("server_max_window_bits")) {
+					deflate = false;
+				}
+			}
+		}
+	}
 	if (headers.has("sec-websocket-protocol")) {
 		Vector<String> protos = headers["sec-websocket-protocol"].split(",");
 		for (int i = 0; i < protos.size(); i++) {
@@ -95,7 +112,7 @@ bool WSLServer::PendingPeer::_parse_request(const Vector<String> p_protocols) {
 	return true;
 }
 
-Error WSLServer::PendingPeer::do_handshake(const Vector<String> p_protocols) {
+Error WSLServer::PendingPeer::do_handshake(const Vector<String> p_protocols, bool p_deflate) {
 	if (OS::get_singleton()->get_ticks_msec() - time > WSL_SERVER_TIMEOUT) {
 		return ERR_TIMEOUT;
 	}
@@ -125,7 +142,7 @@ Error WSLServer::PendingPeer::do_handshake(const Vector<String> p_protocols) {
 			int l = req_pos;
 			if (l > 3 && r[l] == '\n' && r[l - 1] == '\r' && r[l - 2] == '\n' && r[l - 3] == '\r') {
 				r[l - 3] = '\0';
-				if (!_parse_request(p_protocols)) {
+				if (!_parse_request(p_protocols, p_deflate)) {
 					return FAILED;
 				}
 				String s = "HTTP/1.1 101 Switching Protocols\r\n";
@@ -135,6 +152,9 @@ Error WSLServer::PendingPeer::do_handshake(const Vector<String> p_protocols) {
 				if (protocol != "") {
 					s += "Sec-WebSocket-Protocol: " + protocol + "\r\n";
 				}
+				if (deflate) {
+					s += "Sec-WebSocket-Extensions: " + String(WSLPeer::DEFLATE_EXTENSION) + "\r\n";
+				}
 				s += "\r\n";
 				response = s.utf8();
 				has_request = true;
@@ -167,20 +187,43 @@ Error WSLServer::listen(int p_port, const Vector<String> p_protocols, bool gd_mp
 	for (int i = 0; i < p_protocols.size(); i++) {
 		pw[i] = p_protocols[i].strip_edges();
 	}
+	_poller = Ref<NetSocketPoller>(NetSocketPoller::create());
 	return _server->listen(p_port, bind_ip);
 }
 
+void WSLServer::_update_ready_peers() {
+	_ready_peers.clear();
+	if (_poller.is_null() || _poller->get_count() == 0) {
+		return;
+	}
+	// Sockets stay ready until drained, so a single wait large enough for every peer is enough.
+	if (_poller_events.size() < (uint32_t)_poller->get_count()) {
+		_poller_events.resize(_poller->get_count());
+	}
+	int count = _poller->wait(_poller_events.ptr(), _poller_events.size(), 0);
+	for (int i = 0; i < count; i++) {
+		_ready_peers.insert((int)_poller_events[i].id);
+	}
+}
+
 void WSLServer::poll() {
+	_update_ready_peers();
+
 	List<int> remove_ids;
 	for (Map<int, Ref<WebSocketPeer>>::Element *E = _peer_map.front(); E; E = E->next()) {
 		Ref<WSLPeer> peer = (WSLPeer *)E->get().ptr();
-		peer->poll();
+		if (_poller.is_null() || !_poller->has(E->key()) || _ready_peers.has(E->key()) || peer->has_pending_io()) {
+			peer->poll();
+		}
 		if (!peer->is_connected_to_host()) {
 			_on_disconnect(E->key(), peer->close_code != -1);
 			remove_ids.push_back(E->key());
 		}
 	}
 	for (List<int>::Element *E = remove_ids.front(); E; E = E->next()) {
+		if (_poller.is_valid()) {
+			_poller->remove(E->get());
+		}
 		_peer_map.erase(E->get());
 	}
 	remove_ids.clear();
@@ -188,7 +231,7 @@ void WSLServer::poll() {
 	List<Ref<PendingPeer>> remove_peers;
 	for (List<Ref<PendingPeer>>::Element *E = _pending.front(); E; E = E->next()) {
 		Ref<PendingPeer> ppeer = E->get();
-		Error err = ppeer->do_handshake(_protocols);
+		Error err = ppeer->do_handshake(_protocols, _compression);
 		if (err == ERR_BUSY) {
 			continue;
 		} else if (err != OK) {
@@ -204,12 +247,17 @@ void WSLServer::poll() {
 		data->tcp = ppeer->tcp;
 		data->is_server = true;
 		data->id = id;
+		data->deflate = ppeer->deflate;
 
 		Ref<WSLPeer> ws_peer = memnew(WSLPeer);
 		ws_peer->make_context(data, _in_buf_size, _in_pkt_size, _out_buf_size, _out_pkt_size);
 		ws_peer->set_no_delay(true);
 
 		_peer_map[id] = ws_peer;
+		if (_poller.is_valid()) {
+			// Without registration the peer is simply polled every frame.
+			_poller->add(ppeer->tcp->get_socket(), NetSocket::POLL_TYPE_IN, id);
+		}
 		remove_peers.push_back(ppeer);
 		_on_connect(id, ppeer->protocol);
 	}
@@ -261,6 +309,8 @@ void WSLServer::stop() {
 	_pending.clear();
 	_peer_map.clear();
 	_protocols.clear();
+	_poller.unref();
+	_ready_peers.clear();
 }
 
 bool WSLServer::has_peer(int p_id) const {
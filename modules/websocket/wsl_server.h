@@ -39,6 +39,8 @@
 #include "core/io/stream_peer_ssl.h"
 #include "core/io/stream_peer_tcp.h"
 #include "core/io/tcp_server.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/set.h"
 
 #define WSL_SERVER_TIMEOUT 1000
 
@@ -48,7 +50,7 @@ class WSLServer : public WebSocketServer {
 private:
 	class PendingPeer : public Reference {
 	private:
-		bool _parse_request(const Vector<String> p_protocols);
+		bool _parse_request(const Vector<String> p_protocols, bool p_deflate);
 
 	public:
 		Ref<StreamPeerTCP> tcp;
@@ -60,11 +62,12 @@ private:
 		int req_pos = 0;
 		String key;
 		String protocol;
+		bool deflate = false;
 		bool has_request = false;
 		CharString response;
 		int response_sent = 0;
 
-		Error do_handshake(const Vector<String> p_protocols);
+		Error do_handshake(const Vector<String> p_protocols, bool p_deflate);
 	};
 
 	int _in_buf_size = DEF_BUF_SHIFT;
@@ -76,6 +79,13 @@ private:
 	Ref<TCP_Server> _server;
 	Vector<String> _protocols;
 
+	// Connected peers are only serviced when their socket reports activity, or they have buffered data.
+	Ref<NetSocketPoller> _poller;
+	LocalVector<NetSocketPoller::Event> _poller_events;
+	Set<int> _ready_peers;
+
+	void _update_ready_peers();
+
 public:
 	Error set_buffers(int p_in_buffer, int p_in_packets, int p_out_buffer, int p_out_packets);
 	Error listen(int p_port, const Vector<String> p_protocols = Vector<String>(), bool gd_mp_api = false);
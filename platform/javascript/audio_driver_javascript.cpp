@@ -267,7 +267,7 @@ int AudioDriverJavaScript::WorkletNode::create(int p_buffer_size, int p_channels
 
 void AudioDriverJavaScript::WorkletNode::start(float *p_out_buf, int p_out_buf_size, float *p_in_buf, int p_in_buf_size) {
 	godot_audio_worklet_start(p_in_buf, p_in_buf_size, p_out_buf, p_out_buf_size, state);
-	thread.start(_audio_thread_func, this);
+	thread.start(_audio_thread_func, this, Thread::get_role_settings(Thread::ROLE_AUDIO));
 }
 
 void AudioDriverJavaScript::WorkletNode::lock() {
@@ -169,6 +169,10 @@ const Engine = (function () {
 		wasmExt = String(override);
 	};
 
+	Engine.prototype.setPreloadCacheEnabled = function (enabled) {
+		preloader.setCacheEnabled(enabled);
+	};
+
 	Engine.prototype.setUnloadAfterInit = function (enabled) {
 		unloadAfterInit = enabled;
 	};
@@ -260,6 +264,7 @@ const Engine = (function () {
 	Engine.prototype['start'] = Engine.prototype.start;
 	Engine.prototype['startGame'] = Engine.prototype.startGame;
 	Engine.prototype['setWebAssemblyFilenameExtension'] = Engine.prototype.setWebAssemblyFilenameExtension;
+	Engine.prototype['setPreloadCacheEnabled'] = Engine.prototype.setPreloadCacheEnabled;
 	Engine.prototype['setUnloadAfterInit'] = Engine.prototype.setUnloadAfterInit;
 	Engine.prototype['setCanvas'] = Engine.prototype.setCanvas;
 	Engine.prototype['setCanvasResizedOnStart'] = Engine.prototype.setCanvasResizedOnStart;
@@ -98,15 +98,112 @@ const Preloader = /** @constructor */ function () { // eslint-disable-line no-un
 		});
 	};
 
+	// Persistent cache of preloaded files, so returning players don't download the main pack again.
+	// Entries are stored in IndexedDB with the ETag/Last-Modified the server reported, and reused
+	// only while a HEAD request still reports the same.
+	const CACHE_DB_NAME = 'godot-preload-cache';
+	const CACHE_STORE_NAME = 'files';
+	let cacheEnabled = false;
+
+	this.setCacheEnabled = function (enabled) {
+		cacheEnabled = enabled;
+	};
+
+	const openCache = function () {
+		return new Promise(function (resolve, reject) {
+			if (typeof indexedDB === 'undefined') {
+				reject(new Error('IndexedDB is not available'));
+				return;
+			}
+			const req = indexedDB.open(CACHE_DB_NAME, 1);
+			req.onupgradeneeded = function () {
+				req.result.createObjectStore(CACHE_STORE_NAME);
+			};
+			req.onsuccess = function () {
+				resolve(req.result);
+			};
+			req.onerror = function () {
+				reject(req.error);
+			};
+		});
+	};
+
+	const cacheRequest = function (db, mode, op) {
+		return new Promise(function (resolve, reject) {
+			const req = op(db.transaction(CACHE_STORE_NAME, mode).objectStore(CACHE_STORE_NAME));
+			req.onsuccess = function () {
+				resolve(req.result);
+			};
+			req.onerror = function () {
+				reject(req.error);
+			};
+		});
+	};
+
+	const fetchFileVersion = function (file) {
+		return fetch(file, { method: 'HEAD', cache: 'no-cache' }).then(function (response) {
+			const etag = response.headers.get('ETag');
+			const modified = response.headers.get('Last-Modified');
+			if (!response.ok || (!etag && !modified)) {
+				return null; // Can't tell when the file changes, don't cache it.
+			}
+			return `${etag}|${modified}|${response.headers.get('Content-Length')}`;
+		}, function () {
+			return null;
+		});
+	};
+
+	const loadCached = function (file) {
+		let db = null;
+		let version = null;
+		return Promise.all([
+			openCache().catch(function () {
+				return null;
+			}),
+			fetchFileVersion(file),
+		]).then(function (results) {
+			db = results[0];
+			version = results[1];
+			if (!db || !version) {
+				return null;
+			}
+			return cacheRequest(db, 'readonly', function (store) {
+				return store.get(file);
+			}).catch(function () {
+				return null;
+			});
+		}).then(function (entry) {
+			if (entry && entry.version === version) {
+				const size = entry.buffer.byteLength;
+				loadingFiles[file] = { total: size, loaded: size, final: true };
+				return entry.buffer;
+			}
+			return new Promise(function (resolve, reject) {
+				loadXHR(resolve, reject, file, loadingFiles, DOWNLOAD_ATTEMPTS_MAX);
+			}).then(function (xhr) {
+				if (db && version) {
+					// Storing can fail when over quota, the file is simply downloaded again next time.
+					cacheRequest(db, 'readwrite', function (store) {
+						return store.put({ version: version, buffer: xhr.response }, file);
+					}).catch(function () {});
+				}
+				return xhr.response;
+			});
+		});
+	};
+
 	this.preloadedFiles = [];
 	this.preload = function (pathOrBuffer, destPath) {
 		let buffer = null;
 		if (typeof pathOrBuffer === 'string') {
 			const me = this;
-			return this.loadPromise(pathOrBuffer).then(function (xhr) {
+			const load = cacheEnabled ? loadCached(pathOrBuffer) : this.loadPromise(pathOrBuffer).then(function (xhr) {
+				return xhr.response;
+			});
+			return load.then(function (response) {
 				me.preloadedFiles.push({
 					path: destPath || pathOrBuffer,
-					buffer: xhr.response,
+					buffer: response,
 				});
 				return Promise.resolve();
 			});
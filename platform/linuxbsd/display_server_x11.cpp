@@ -121,6 +121,7 @@ bool DisplayServerX11::has_feature(Feature p_feature) const {
 		case FEATURE_ICON:
 		case FEATURE_NATIVE_ICON:
 		case FEATURE_SWAP_BUFFERS:
+		case FEATURE_WAIT_FOR_EVENTS:
 			return true;
 		default: {
 		}
@@ -2724,6 +2725,10 @@ void DisplayServerX11::_poll_events() {
 
 				polled_events.push_back(ev);
 			}
+
+			if (polled_events.size()) {
+				OS::get_singleton()->wake_main_loop();
+			}
 		}
 	}
 }
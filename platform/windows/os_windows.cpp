@@ -36,6 +36,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/script_debugger.h"
 #include "core/io/marshalls.h"
+#include "core/os/thread.h"
 #include "core/version_generated.gen.h"
 #include "drivers/windows/dir_access_windows.h"
 #include "drivers/windows/file_access_windows.h"
@@ -169,9 +170,21 @@ void OS_Windows::initialize_debugging() {
 	SetConsoleCtrlHandler(HandlerRoutine, TRUE);
 }
 
+static void _set_thread_priority(Thread::Priority p_priority) {
+	int priority = THREAD_PRIORITY_NORMAL;
+	if (p_priority == Thread::PRIORITY_LOW) {
+		priority = THREAD_PRIORITY_BELOW_NORMAL;
+	} else if (p_priority == Thread::PRIORITY_HIGH) {
+		priority = THREAD_PRIORITY_HIGHEST;
+	}
+	SetThreadPriority(GetCurrentThread(), priority);
+}
+
 void OS_Windows::initialize() {
 	crash_handler.initialize();
 
+	Thread::_set_platform_funcs(nullptr, &_set_thread_priority);
+
 	//RedirectIOToConsole();
 
 	FileAccess::make_default<FileAccessWindows>(FileAccess::ACCESS_RESOURCES);
@@ -33,6 +33,7 @@
 #include "core/config/engine.h"
 #include "scene/2d/area_2d.h"
 #include "scene/main/window.h"
+#include "servers/audio/audio_mix_kernels.h"
 
 void AudioStreamPlayer2D::_mix_audio() {
 	if (!stream_playback.is_valid() || !active ||
@@ -96,10 +97,7 @@ void AudioStreamPlayer2D::_mix_audio() {
 
 			AudioFrame *target = AudioServer::get_singleton()->thread_get_channel_mix_buffer(current.bus_index, 0);
 
-			for (int j = 0; j < buffer_size; j++) {
-				target[j] += buffer[j] * vol;
-				vol += vol_inc;
-			}
+			AudioMixKernels::mix_ramp(target, buffer, buffer_size, vol, vol_inc);
 
 		} else {
 			AudioFrame *targets[4];
@@ -118,12 +116,8 @@ void AudioStreamPlayer2D::_mix_audio() {
 				continue;
 			}
 
-			for (int j = 0; j < buffer_size; j++) {
-				AudioFrame frame = buffer[j] * vol;
-				for (int k = 0; k < cc; k++) {
-					targets[k][j] += frame;
-				}
-				vol += vol_inc;
+			for (int k = 0; k < cc; k++) {
+				AudioMixKernels::mix_ramp(targets[k], buffer, buffer_size, vol, vol_inc);
 			}
 		}
 
@@ -352,10 +346,8 @@ float AudioStreamPlayer2D::get_playback_position() {
 }
 
 void AudioStreamPlayer2D::set_bus(const StringName &p_bus) {
-	//if audio is active, must lock this
-	AudioServer::get_singleton()->lock();
+	// Only read when computing the outputs, no need to lock the audio thread.
 	bus = p_bus;
-	AudioServer::get_singleton()->unlock();
 }
 
 StringName AudioStreamPlayer2D::get_bus() const {
@@ -588,11 +588,13 @@ void CPUParticles2D::_particles_process(float p_delta) {
 	p_delta *= speed_scale;
 
 	int pcount = particles.size();
-	Particle *w = particles.ptrw();
 
-	Particle *parray = w;
+	ProcessData data;
+	data.particles = particles.ptrw();
+	data.delta = p_delta;
+	data.prev_time = time;
+	data.random_seed = Math::rand();
 
-	float prev_time = time;
 	time += p_delta;
 	if (time > lifetime) {
 		time = Math::fmod(time, lifetime);
@@ -603,24 +605,48 @@ void CPUParticles2D::_particles_process(float p_delta) {
 		}
 	}
 
-	Transform2D emission_xform;
-	Transform2D velocity_xform;
 	if (!local_coords) {
-		emission_xform = get_global_transform();
-		velocity_xform = emission_xform;
-		velocity_xform[2] = Vector2();
+		data.emission_xform = get_global_transform();
+		data.velocity_xform = data.emission_xform;
+		data.velocity_xform[2] = Vector2();
 	}
 
-	float system_phase = time / lifetime;
+	data.system_phase = time / lifetime;
 
-	for (int i = 0; i < pcount; i++) {
+	// Curves bake and gradients sort themselves lazily, do it here so the particles can be processed in parallel.
+	for (int i = 0; i < PARAM_MAX; i++) {
+		if (curve_parameters[i].is_valid()) {
+			curve_parameters[i]->interpolate_baked(0.0);
+		}
+	}
+	if (color_ramp.is_valid()) {
+		color_ramp->get_color_at_offset(0.0);
+	}
+
+	if (pcount > PARTICLES_PER_JOB && is_inside_tree()) {
+		get_tree()->do_threaded_work((pcount + PARTICLES_PER_JOB - 1) / PARTICLES_PER_JOB, this, &CPUParticles2D::_particles_process_job, &data);
+	} else {
+		_particles_process_range(0, pcount, data);
+	}
+}
+
+void CPUParticles2D::_particles_process_job(uint32_t p_job, const ProcessData *p_data) {
+	int from = p_job * PARTICLES_PER_JOB;
+	_particles_process_range(from, MIN(from + int(PARTICLES_PER_JOB), particles.size()), *p_data);
+}
+
+void CPUParticles2D::_particles_process_range(int p_from, int p_to, const ProcessData &p_data) {
+	int pcount = particles.size();
+	Particle *parray = p_data.particles;
+
+	for (int i = p_from; i < p_to; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
 			continue;
 		}
 
-		float local_delta = p_delta;
+		float local_delta = p_data.delta;
 
 		// The phase is a ratio between 0 (birth) and 1 (end of life) for each particle.
 		// While we use time in tests later on, for randomness we use the phase as done in the
@@ -629,7 +655,7 @@ void CPUParticles2D::_particles_process(float p_delta) {
 
 		if (randomness_ratio > 0.0) {
 			uint32_t seed = cycle;
-			if (restart_phase >= system_phase) {
+			if (restart_phase >= p_data.system_phase) {
 				seed -= uint32_t(1);
 			}
 			seed *= uint32_t(pcount);
@@ -642,10 +668,10 @@ void CPUParticles2D::_particles_process(float p_delta) {
 		float restart_time = restart_phase * lifetime;
 		bool restart = false;
 
-		if (time > prev_time) {
+		if (time > p_data.prev_time) {
 			// restart_time >= prev_time is used so particles emit in the first frame they are processed
 
-			if (restart_time >= prev_time && restart_time < time) {
+			if (restart_time >= p_data.prev_time && restart_time < time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = time - restart_time;
@@ -653,7 +679,7 @@ void CPUParticles2D::_particles_process(float p_delta) {
 			}
 
 		} else if (local_delta > 0.0) {
-			if (restart_time >= prev_time) {
+			if (restart_time >= p_data.prev_time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = lifetime - restart_time + time;
@@ -682,29 +708,31 @@ void CPUParticles2D::_particles_process(float p_delta) {
 
 			/*float tex_linear_velocity = 0;
 			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
-				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->interpolate(0);
+				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->interpolate_baked(0);
 			}*/
 
 			float tex_angle = 0.0;
 			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_angle = curve_parameters[PARAM_ANGLE]->interpolate(tv);
+				tex_angle = curve_parameters[PARAM_ANGLE]->interpolate_baked(tv);
 			}
 
 			float tex_anim_offset = 0.0;
 			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate(tv);
+				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate_baked(tv);
 			}
 
-			p.seed = Math::rand();
+			// Seeded per particle instead of using the global generator, which is not thread safe.
+			p.seed = idhash(p_data.random_seed + uint32_t(i));
+			uint32_t rng = idhash(p.seed);
 
-			p.angle_rand = Math::randf();
-			p.scale_rand = Math::randf();
-			p.hue_rot_rand = Math::randf();
-			p.anim_offset_rand = Math::randf();
+			p.angle_rand = rand_from_seed(rng);
+			p.scale_rand = rand_from_seed(rng);
+			p.hue_rot_rand = rand_from_seed(rng);
+			p.anim_offset_rand = rand_from_seed(rng);
 
-			float angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg2rad((Math::randf() * 2.0 - 1.0) * spread);
+			float angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg2rad((rand_from_seed(rng) * 2.0 - 1.0) * spread);
 			Vector2 rot = Vector2(Math::cos(angle1_rad), Math::sin(angle1_rad));
-			p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(Math::randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
+			p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(rand_from_seed(rng)), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
 
 			float base_angle = (parameters[PARAM_ANGLE] + tex_angle) * Math::lerp(1.0f, p.angle_rand, randomness[PARAM_ANGLE]);
 			p.rotation = Math::deg2rad(base_angle);
@@ -715,7 +743,7 @@ void CPUParticles2D::_particles_process(float p_delta) {
 			p.custom[3] = 0.0;
 			p.transform = Transform2D();
 			p.time = 0;
-			p.lifetime = lifetime * (1.0 - Math::randf() * lifetime_randomness);
+			p.lifetime = lifetime * (1.0 - rand_from_seed(rng) * lifetime_randomness);
 			p.base_color = Color(1, 1, 1, 1);
 
 			switch (emission_shape) {
@@ -723,12 +751,12 @@ void CPUParticles2D::_particles_process(float p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					float s = Math::randf(), t = Math_TAU * Math::randf();
+					float s = rand_from_seed(rng), t = Math_TAU * rand_from_seed(rng);
 					float radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform[2] = Vector2(Math::cos(t), Math::sin(t)) * radius;
 				} break;
 				case EMISSION_SHAPE_RECTANGLE: {
-					p.transform[2] = Vector2(Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0) * emission_rect_extents;
+					p.transform[2] = Vector2(rand_from_seed(rng) * 2.0 - 1.0, rand_from_seed(rng) * 2.0 - 1.0) * emission_rect_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -737,7 +765,7 @@ void CPUParticles2D::_particles_process(float p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = idhash(rng) % uint32_t(pc);
 
 					p.transform[2] = emission_points.get(random_idx);
 
@@ -759,8 +787,8 @@ void CPUParticles2D::_particles_process(float p_delta) {
 			}
 
 			if (!local_coords) {
-				p.velocity = velocity_xform.xform(p.velocity);
-				p.transform = emission_xform * p.transform;
+				p.velocity = p_data.velocity_xform.xform(p.velocity);
+				p.transform = p_data.emission_xform * p.transform;
 			}
 
 		} else if (!p.active) {
@@ -777,51 +805,51 @@ void CPUParticles2D::_particles_process(float p_delta) {
 
 			float tex_linear_velocity = 0.0;
 			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
-				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->interpolate(tv);
+				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->interpolate_baked(tv);
 			}
 
 			float tex_orbit_velocity = 0.0;
 			if (curve_parameters[PARAM_ORBIT_VELOCITY].is_valid()) {
-				tex_orbit_velocity = curve_parameters[PARAM_ORBIT_VELOCITY]->interpolate(tv);
+				tex_orbit_velocity = curve_parameters[PARAM_ORBIT_VELOCITY]->interpolate_baked(tv);
 			}
 
 			float tex_angular_velocity = 0.0;
 			if (curve_parameters[PARAM_ANGULAR_VELOCITY].is_valid()) {
-				tex_angular_velocity = curve_parameters[PARAM_ANGULAR_VELOCITY]->interpolate(tv);
+				tex_angular_velocity = curve_parameters[PARAM_ANGULAR_VELOCITY]->interpolate_baked(tv);
 			}
 
 			float tex_linear_accel = 0.0;
 			if (curve_parameters[PARAM_LINEAR_ACCEL].is_valid()) {
-				tex_linear_accel = curve_parameters[PARAM_LINEAR_ACCEL]->interpolate(tv);
+				tex_linear_accel = curve_parameters[PARAM_LINEAR_ACCEL]->interpolate_baked(tv);
 			}
 
 			float tex_tangential_accel = 0.0;
 			if (curve_parameters[PARAM_TANGENTIAL_ACCEL].is_valid()) {
-				tex_tangential_accel = curve_parameters[PARAM_TANGENTIAL_ACCEL]->interpolate(tv);
+				tex_tangential_accel = curve_parameters[PARAM_TANGENTIAL_ACCEL]->interpolate_baked(tv);
 			}
 
 			float tex_radial_accel = 0.0;
 			if (curve_parameters[PARAM_RADIAL_ACCEL].is_valid()) {
-				tex_radial_accel = curve_parameters[PARAM_RADIAL_ACCEL]->interpolate(tv);
+				tex_radial_accel = curve_parameters[PARAM_RADIAL_ACCEL]->interpolate_baked(tv);
 			}
 
 			float tex_damping = 0.0;
 			if (curve_parameters[PARAM_DAMPING].is_valid()) {
-				tex_damping = curve_parameters[PARAM_DAMPING]->interpolate(tv);
+				tex_damping = curve_parameters[PARAM_DAMPING]->interpolate_baked(tv);
 			}
 
 			float tex_angle = 0.0;
 			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_angle = curve_parameters[PARAM_ANGLE]->interpolate(tv);
+				tex_angle = curve_parameters[PARAM_ANGLE]->interpolate_baked(tv);
 			}
 			float tex_anim_speed = 0.0;
 			if (curve_parameters[PARAM_ANIM_SPEED].is_valid()) {
-				tex_anim_speed = curve_parameters[PARAM_ANIM_SPEED]->interpolate(tv);
+				tex_anim_speed = curve_parameters[PARAM_ANIM_SPEED]->interpolate_baked(tv);
 			}
 
 			float tex_anim_offset = 0.0;
 			if (curve_parameters[PARAM_ANIM_OFFSET].is_valid()) {
-				tex_anim_offset = curve_parameters[PARAM_ANIM_OFFSET]->interpolate(tv);
+				tex_anim_offset = curve_parameters[PARAM_ANIM_OFFSET]->interpolate_baked(tv);
 			}
 
 			Vector2 force = gravity;
@@ -830,7 +858,7 @@ void CPUParticles2D::_particles_process(float p_delta) {
 			//apply linear acceleration
 			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * (parameters[PARAM_LINEAR_ACCEL] + tex_linear_accel) * Math::lerp(1.0f, rand_from_seed(alt_seed), randomness[PARAM_LINEAR_ACCEL]) : Vector2();
 			//apply radial acceleration
-			Vector2 org = emission_xform[2];
+			Vector2 org = p_data.emission_xform[2];
 			Vector2 diff = pos - org;
 			force += diff.length() > 0.0 ? diff.normalized() * (parameters[PARAM_RADIAL_ACCEL] + tex_radial_accel) * Math::lerp(1.0f, rand_from_seed(alt_seed), randomness[PARAM_RADIAL_ACCEL]) : Vector2();
 			//apply tangential acceleration;
@@ -873,12 +901,12 @@ void CPUParticles2D::_particles_process(float p_delta) {
 
 		float tex_scale = 1.0;
 		if (curve_parameters[PARAM_SCALE].is_valid()) {
-			tex_scale = curve_parameters[PARAM_SCALE]->interpolate(tv);
+			tex_scale = curve_parameters[PARAM_SCALE]->interpolate_baked(tv);
 		}
 
 		float tex_hue_variation = 0.0;
 		if (curve_parameters[PARAM_HUE_VARIATION].is_valid()) {
-			tex_hue_variation = curve_parameters[PARAM_HUE_VARIATION]->interpolate(tv);
+			tex_hue_variation = curve_parameters[PARAM_HUE_VARIATION]->interpolate_baked(tv);
 		}
 
 		float hue_rot_angle = (parameters[PARAM_HUE_VARIATION] + tex_hue_variation) * Math_TAU * Math::lerp(1.0f, p.hue_rot_rand * 2.0f - 1.0f, randomness[PARAM_HUE_VARIATION]);
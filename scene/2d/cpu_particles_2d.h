@@ -172,7 +172,23 @@ private:
 	Vector2 gravity = Vector2(0, 98);
 
 	void _update_internal();
+	struct ProcessData {
+		Particle *particles = nullptr;
+		float delta = 0.0;
+		float prev_time = 0.0;
+		float system_phase = 0.0;
+		uint32_t random_seed = 0;
+		Transform2D emission_xform;
+		Transform2D velocity_xform;
+	};
+
+	enum {
+		PARTICLES_PER_JOB = 1024, // Larger emitters are processed on the scene tree's thread pool, in jobs of this many particles.
+	};
+
 	void _particles_process(float p_delta);
+	void _particles_process_job(uint32_t p_job, const ProcessData *p_data);
+	void _particles_process_range(int p_from, int p_to, const ProcessData &p_data);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
@@ -34,6 +34,7 @@
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 #include "scene/2d/area_2d.h"
+#include "scene/resources/rectangle_shape_2d.h"
 #include "servers/navigation_server_2d.h"
 #include "servers/physics_server_2d.h"
 
@@ -303,6 +304,139 @@ void TileMap::_add_shape(int &shape_idx, const Quadrant &p_q, const Ref<Shape2D>
 	shape_idx++;
 }
 
+void TileMap::_bake_tile(LocalVector<BakedBatch> &r_batches, RID p_canvas_item, const Ref<Texture2D> &p_texture, const Rect2 &p_rect, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose) {
+	// Only the last batch can be extended, so tiles are still drawn in cell order.
+	BakedBatch *batch = nullptr;
+	if (!r_batches.is_empty() && r_batches[r_batches.size() - 1].canvas_item == p_canvas_item && r_batches[r_batches.size() - 1].texture == p_texture->get_rid()) {
+		batch = &r_batches[r_batches.size() - 1];
+	}
+	if (!batch) {
+		r_batches.push_back(BakedBatch());
+		batch = &r_batches[r_batches.size() - 1];
+		batch->canvas_item = p_canvas_item;
+		batch->texture = p_texture->get_rid();
+	}
+
+	Vector2 texel = Vector2(1, 1) / p_texture->get_size();
+	Vector2 uv_from = p_src_rect.position * texel;
+	Vector2 uv_to = (p_src_rect.position + p_src_rect.size) * texel;
+
+	// Negative rect sizes (flipped tiles) mirror the quad, same as draw_rect_region().
+	Vector2 to = p_rect.position + p_rect.size;
+	batch->points.push_back(p_rect.position);
+	batch->points.push_back(Vector2(to.x, p_rect.position.y));
+	batch->points.push_back(to);
+	batch->points.push_back(Vector2(p_rect.position.x, to.y));
+
+	batch->uvs.push_back(uv_from);
+	batch->uvs.push_back(p_transpose ? Vector2(uv_from.x, uv_to.y) : Vector2(uv_to.x, uv_from.y));
+	batch->uvs.push_back(uv_to);
+	batch->uvs.push_back(p_transpose ? Vector2(uv_to.x, uv_from.y) : Vector2(uv_from.x, uv_to.y));
+
+	for (int i = 0; i < 4; i++) {
+		batch->colors.push_back(p_modulate);
+	}
+}
+
+void TileMap::_flush_baked_batches(LocalVector<BakedBatch> &r_batches) {
+	for (uint32_t i = 0; i < r_batches.size(); i++) {
+		const BakedBatch &batch = r_batches[i];
+		int point_count = batch.points.size();
+
+		Vector<Vector2> points;
+		points.resize(point_count);
+		memcpy(points.ptrw(), batch.points.ptr(), point_count * sizeof(Vector2));
+		Vector<Vector2> uvs;
+		uvs.resize(point_count);
+		memcpy(uvs.ptrw(), batch.uvs.ptr(), point_count * sizeof(Vector2));
+		Vector<Color> colors;
+		colors.resize(point_count);
+		memcpy(colors.ptrw(), batch.colors.ptr(), point_count * sizeof(Color));
+
+		Vector<int> indices;
+		indices.resize(point_count / 4 * 6);
+		int *iw = indices.ptrw();
+		for (int j = 0; j < point_count / 4; j++) {
+			static const int quad_indices[6] = { 0, 1, 2, 0, 2, 3 };
+			for (int k = 0; k < 6; k++) {
+				iw[j * 6 + k] = j * 4 + quad_indices[k];
+			}
+		}
+
+		RS::get_singleton()->canvas_item_add_triangle_array(batch.canvas_item, indices, points, colors, uvs, Vector<int>(), Vector<float>(), batch.texture);
+	}
+	r_batches.clear();
+}
+
+bool TileMap::_get_mergeable_rect(const Ref<Shape2D> &p_shape, const TileSet::ShapeData &p_shape_data, const Transform2D &p_xform, Rect2 &r_rect) const {
+	Ref<RectangleShape2D> rect_shape = p_shape;
+	if (rect_shape.is_null() || p_shape_data.one_way_collision) {
+		return false;
+	}
+
+	// Only axis aligned rectangles stay rectangles once transformed (flips and transposes included).
+	bool axis_aligned = (p_xform.elements[0].y == 0 && p_xform.elements[1].x == 0) || (p_xform.elements[0].x == 0 && p_xform.elements[1].y == 0);
+	if (!axis_aligned) {
+		return false;
+	}
+
+	Vector2 size = rect_shape->get_size();
+	r_rect = p_xform.xform(Rect2(-size / 2, size));
+	return true;
+}
+
+void TileMap::_add_merged_rects(int &shape_idx, Quadrant &p_q, LocalVector<MergeRect> &r_rects) {
+	if (r_rects.is_empty()) {
+		return;
+	}
+
+	// Greedy merge: first join horizontal runs of tiles with the same height,
+	// then stack runs of the same width on top of each other.
+	// Only cells of the same tile are merged, so the shape metadata (the top-left cell) still leads to
+	// the tile that was hit.
+	LocalVector<MergeRect> runs;
+	r_rects.sort_custom<MergeRect::RowSort>();
+	for (uint32_t i = 0; i < r_rects.size(); i++) {
+		const Rect2 &rect = r_rects[i].rect;
+		if (!runs.is_empty()) {
+			Rect2 &last = runs[runs.size() - 1].rect;
+			if (runs[runs.size() - 1].has_same_tile(r_rects[i]) && Math::is_equal_approx(last.position.y, rect.position.y) && Math::is_equal_approx(last.size.y, rect.size.y) && Math::is_equal_approx(last.position.x + last.size.x, rect.position.x)) {
+				last.size.x += rect.size.x;
+				continue;
+			}
+		}
+		runs.push_back(r_rects[i]);
+	}
+
+	r_rects.clear();
+	runs.sort_custom<MergeRect::ColumnSort>();
+	for (uint32_t i = 0; i < runs.size(); i++) {
+		const Rect2 &rect = runs[i].rect;
+		if (!r_rects.is_empty()) {
+			Rect2 &last = r_rects[r_rects.size() - 1].rect;
+			if (r_rects[r_rects.size() - 1].has_same_tile(runs[i]) && Math::is_equal_approx(last.position.x, rect.position.x) && Math::is_equal_approx(last.size.x, rect.size.x) && Math::is_equal_approx(last.position.y + last.size.y, rect.position.y)) {
+				last.size.y += rect.size.y;
+				continue;
+			}
+		}
+		r_rects.push_back(runs[i]);
+	}
+
+	TileSet::ShapeData shape_data;
+	for (uint32_t i = 0; i < r_rects.size(); i++) {
+		Ref<RectangleShape2D> shape;
+		shape.instance();
+		shape->set_size(r_rects[i].rect.size);
+		p_q.merged_shapes.push_back(shape);
+
+		Transform2D xform;
+		xform.set_origin(r_rects[i].rect.position + r_rects[i].rect.size / 2);
+		// The metadata of a merged shape is the cell of its top-left tile.
+		_add_shape(shape_idx, p_q, shape, shape_data, xform, r_rects[i].cell);
+	}
+	r_rects.clear();
+}
+
 void TileMap::update_dirty_quadrants() {
 	if (!pending_update) {
 		return;
@@ -363,6 +497,9 @@ void TileMap::update_dirty_quadrants() {
 			RS::get_singleton()->free(E->get().id);
 		}
 		q.occluder_instances.clear();
+		q.merged_shapes.clear();
+		LocalVector<BakedBatch> baked_batches;
+		LocalVector<MergeRect> merge_rects;
 		Ref<ShaderMaterial> prev_material;
 		int prev_z_index = 0;
 		RID prev_canvas_item;
@@ -530,10 +667,18 @@ void TileMap::update_dirty_quadrants() {
 			Color self_modulate = get_self_modulate();
 			modulate = Color(modulate.r * self_modulate.r, modulate.g * self_modulate.g,
 					modulate.b * self_modulate.b, modulate.a * self_modulate.a);
-			if (r == Rect2()) {
-				tex->draw_rect(canvas_item, rect, false, modulate, c.transpose);
+			// Triangle arrays can't clamp UVs to the tile region, so clipped regions are drawn as rects.
+			bool bake = bake_quadrants && !Object::cast_to<AtlasTexture>(*tex) && !Object::cast_to<MeshTexture>(*tex) && !(clip_uv && r != Rect2());
+			if (bake) {
+				_bake_tile(baked_batches, canvas_item, tex, rect, r == Rect2() ? Rect2(Vector2(), tex->get_size()) : r, modulate, c.transpose);
 			} else {
-				tex->draw_rect_region(canvas_item, rect, r, modulate, c.transpose, clip_uv);
+				// Draw the tiles baked so far first, to keep the drawing order.
+				_flush_baked_batches(baked_batches);
+				if (r == Rect2()) {
+					tex->draw_rect(canvas_item, rect, false, modulate, c.transpose);
+				} else {
+					tex->draw_rect_region(canvas_item, rect, r, modulate, c.transpose, clip_uv);
+				}
 			}
 
 			Vector<TileSet::ShapeData> shapes = tile_set->tile_get_shapes(c.id);
@@ -556,7 +701,15 @@ void TileMap::update_dirty_quadrants() {
 							shape->draw(debug_canvas_item, debug_collision_color);
 						}
 
-						if (shape->has_meta("decomposed")) {
+						Rect2 merge_rect;
+						if (collision_merge_rects && _get_mergeable_rect(shape, shapes[j], xform, merge_rect)) {
+							MergeRect mr;
+							mr.rect = merge_rect;
+							mr.cell = Vector2(E->key().x, E->key().y);
+							mr.tile = c.id;
+							mr.autotile_coord = Vector2(c.autotile_coord_x, c.autotile_coord_y);
+							merge_rects.push_back(mr);
+						} else if (shape->has_meta("decomposed")) {
 							Array _shapes = shape->get_meta("decomposed");
 							for (int k = 0; k < _shapes.size(); k++) {
 								Ref<ConvexPolygonShape2D> convex = _shapes[k];
@@ -678,6 +831,9 @@ void TileMap::update_dirty_quadrants() {
 			}
 		}
 
+		_flush_baked_batches(baked_batches);
+		_add_merged_rects(shape_idx, q, merge_rects);
+
 		dirty_quadrant_list.remove(dirty_quadrant_list.first());
 		quadrant_order_dirty = true;
 	}
@@ -1688,6 +1844,34 @@ bool TileMap::get_clip_uv() const {
 	return clip_uv;
 }
 
+void TileMap::set_bake_quadrants(bool p_enable) {
+	if (bake_quadrants == p_enable) {
+		return;
+	}
+
+	_clear_quadrants();
+	bake_quadrants = p_enable;
+	_recreate_quadrants();
+}
+
+bool TileMap::get_bake_quadrants() const {
+	return bake_quadrants;
+}
+
+void TileMap::set_collision_merge_rects(bool p_enable) {
+	if (collision_merge_rects == p_enable) {
+		return;
+	}
+
+	_clear_quadrants();
+	collision_merge_rects = p_enable;
+	_recreate_quadrants();
+}
+
+bool TileMap::get_collision_merge_rects() const {
+	return collision_merge_rects;
+}
+
 void TileMap::set_texture_filter(TextureFilter p_texture_filter) {
 	CanvasItem::set_texture_filter(p_texture_filter);
 	for (Map<PosKey, Quadrant>::Element *F = quadrant_map.front(); F; F = F->next()) {
@@ -1751,6 +1935,12 @@ void TileMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_clip_uv", "enable"), &TileMap::set_clip_uv);
 	ClassDB::bind_method(D_METHOD("get_clip_uv"), &TileMap::get_clip_uv);
 
+	ClassDB::bind_method(D_METHOD("set_bake_quadrants", "enable"), &TileMap::set_bake_quadrants);
+	ClassDB::bind_method(D_METHOD("get_bake_quadrants"), &TileMap::get_bake_quadrants);
+
+	ClassDB::bind_method(D_METHOD("set_collision_merge_rects", "enable"), &TileMap::set_collision_merge_rects);
+	ClassDB::bind_method(D_METHOD("get_collision_merge_rects"), &TileMap::get_collision_merge_rects);
+
 	ClassDB::bind_method(D_METHOD("set_y_sort_enabled", "enable"), &TileMap::set_y_sort_enabled);
 	ClassDB::bind_method(D_METHOD("is_y_sort_enabled"), &TileMap::is_y_sort_enabled);
 
@@ -1830,10 +2020,12 @@ void TileMap::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compatibility_mode"), "set_compatibility_mode", "is_compatibility_mode_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "centered_textures"), "set_centered_textures", "is_centered_textures_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "cell_clip_uv"), "set_clip_uv", "get_clip_uv");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "bake_quadrants"), "set_bake_quadrants", "get_bake_quadrants");
 
 	ADD_GROUP("Collision", "collision_");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_use_parent", PROPERTY_HINT_NONE, ""), "set_collision_use_parent", "get_collision_use_parent");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_use_kinematic", PROPERTY_HINT_NONE, ""), "set_collision_use_kinematic", "get_collision_use_kinematic");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_merge_rects", PROPERTY_HINT_NONE, ""), "set_collision_merge_rects", "get_collision_merge_rects");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "collision_friction", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_collision_friction", "get_collision_friction");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "collision_bounce", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_collision_bounce", "get_collision_bounce");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_layer", PROPERTY_HINT_LAYERS_2D_PHYSICS), "set_collision_layer", "get_collision_layer");
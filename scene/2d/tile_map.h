@@ -31,6 +31,7 @@
 #ifndef TILE_MAP_H
 #define TILE_MAP_H
 
+#include "core/templates/local_vector.h"
 #include "core/templates/self_list.h"
 #include "core/templates/vset.h"
 #include "scene/2d/navigation_2d.h"
@@ -148,12 +149,16 @@ private:
 
 		VSet<PosKey> cells;
 
+		// Shapes created by merging tile rectangles, kept alive while the quadrant uses them.
+		Vector<Ref<Shape2D>> merged_shapes;
+
 		void operator=(const Quadrant &q) {
 			pos = q.pos;
 			canvas_items = q.canvas_items;
 			body = q.body;
 			shape_owner_id = q.shape_owner_id;
 			cells = q.cells;
+			merged_shapes = q.merged_shapes;
 			navpoly_ids = q.navpoly_ids;
 			occluder_instances = q.occluder_instances;
 		}
@@ -164,6 +169,7 @@ private:
 			body = q.body;
 			shape_owner_id = q.shape_owner_id;
 			cells = q.cells;
+			merged_shapes = q.merged_shapes;
 			occluder_instances = q.occluder_instances;
 			navpoly_ids = q.navpoly_ids;
 		}
@@ -173,6 +179,38 @@ private:
 
 	Map<PosKey, Quadrant> quadrant_map;
 
+	// Tiles of a quadrant sharing a canvas item and a texture, baked into a single triangle array.
+	struct BakedBatch {
+		RID canvas_item;
+		RID texture;
+		LocalVector<Vector2> points;
+		LocalVector<Vector2> uvs;
+		LocalVector<Color> colors;
+	};
+
+	struct MergeRect {
+		Rect2 rect;
+		Vector2 cell;
+		int tile = TileMap::INVALID_CELL;
+		Vector2 autotile_coord;
+
+		_FORCE_INLINE_ bool has_same_tile(const MergeRect &p_other) const {
+			return tile == p_other.tile && autotile_coord == p_other.autotile_coord;
+		}
+
+		struct RowSort {
+			_FORCE_INLINE_ bool operator()(const MergeRect &p_a, const MergeRect &p_b) const {
+				return p_a.rect.position.y == p_b.rect.position.y ? p_a.rect.position.x < p_b.rect.position.x : p_a.rect.position.y < p_b.rect.position.y;
+			}
+		};
+
+		struct ColumnSort {
+			_FORCE_INLINE_ bool operator()(const MergeRect &p_a, const MergeRect &p_b) const {
+				return p_a.rect.position.x == p_b.rect.position.x ? p_a.rect.position.y < p_b.rect.position.y : p_a.rect.position.x < p_b.rect.position.x;
+			}
+		};
+	};
+
 	SelfList<Quadrant>::List dirty_quadrant_list;
 
 	bool pending_update = false;
@@ -186,6 +224,8 @@ private:
 	bool compatibility_mode = false;
 	bool centered_textures = false;
 	bool clip_uv = false;
+	bool bake_quadrants = false;
+	bool collision_merge_rects = false;
 	float fp_adjust = 0.00001;
 	float friction = 1.0;
 	float bounce = 0.0;
@@ -201,6 +241,11 @@ private:
 
 	void _add_shape(int &shape_idx, const Quadrant &p_q, const Ref<Shape2D> &p_shape, const TileSet::ShapeData &p_shape_data, const Transform2D &p_xform, const Vector2 &p_metadata);
 
+	void _bake_tile(LocalVector<BakedBatch> &r_batches, RID p_canvas_item, const Ref<Texture2D> &p_texture, const Rect2 &p_rect, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose);
+	void _flush_baked_batches(LocalVector<BakedBatch> &r_batches);
+	bool _get_mergeable_rect(const Ref<Shape2D> &p_shape, const TileSet::ShapeData &p_shape_data, const Transform2D &p_xform, Rect2 &r_rect) const;
+	void _add_merged_rects(int &shape_idx, Quadrant &p_q, LocalVector<MergeRect> &r_rects);
+
 	Map<PosKey, Quadrant>::Element *_create_quadrant(const PosKey &p_qk);
 	void _erase_quadrant(Map<PosKey, Quadrant>::Element *Q);
 	void _make_quadrant_dirty(Map<PosKey, Quadrant>::Element *Q, bool update = true);
@@ -338,6 +383,12 @@ public:
 	void set_clip_uv(bool p_enable);
 	bool get_clip_uv() const;
 
+	void set_bake_quadrants(bool p_enable);
+	bool get_bake_quadrants() const;
+
+	void set_collision_merge_rects(bool p_enable);
+	bool get_collision_merge_rects() const;
+
 	String get_configuration_warning() const override;
 
 	virtual void set_texture_filter(CanvasItem::TextureFilter p_texture_filter) override;
@@ -35,6 +35,7 @@
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/listener_3d.h"
 #include "scene/main/window.h"
+#include "servers/audio/audio_mix_kernels.h"
 
 // Based on "A Novel Multichannel Panning Method for Standard and Arbitrary Loudspeaker Configurations" by Ramy Sadek and Chris Kyriakakis (2004)
 // Speaker-Placement Correction Amplitude Panning (SPCAP)
@@ -159,19 +160,44 @@ void AudioStreamPlayer3D::_mix_audio() {
 		buffer_size = MIN(buffer_size, 128);
 	}
 
-	// Mix if we're not paused or we're fading out
-	if ((output_count > 0 || out_of_range_mode == OUT_OF_RANGE_MIX)) {
-		float output_pitch_scale = 0.0;
-		if (output_count) {
-			//used for doppler, not realistic but good enough
-			for (int i = 0; i < output_count; i++) {
-				output_pitch_scale += outputs[i].pitch_scale;
+	float output_pitch_scale = 0.0;
+	if (output_count) {
+		//used for doppler, not realistic but good enough
+		for (int i = 0; i < output_count; i++) {
+			output_pitch_scale += outputs[i].pitch_scale;
+		}
+		output_pitch_scale /= float(output_count);
+	} else {
+		output_pitch_scale = 1.0;
+	}
+
+	bool fade_in = stream_paused_fade_in;
+	bool fade_out = stream_paused_fade_out;
+
+	if (voice.virtualized) {
+		if (voice_virtualized || started) {
+			// Only keep track of where the stream would be.
+			if (!voice_virtualized) {
+				virtual_position = stream_playback->get_playback_position();
+				voice_virtualized = true;
 			}
-			output_pitch_scale /= float(output_count);
-		} else {
-			output_pitch_scale = 1.0;
+			_advance_virtual_position(buffer_size, pitch_scale * output_pitch_scale);
+			prev_output_count = 0;
+			output_ready = false;
+			return;
 		}
+		// Fade out over this mix, the position is taken once it's done.
+		fade_out = true;
+	} else if (voice_virtualized) {
+		voice_virtualized = false;
+		if (!started) {
+			stream_playback->seek(virtual_position);
+		}
+		fade_in = true;
+	}
 
+	// Mix if we're not paused or we're fading out
+	if ((output_count > 0 || out_of_range_mode == OUT_OF_RANGE_MIX)) {
 		stream_playback->mix(buffer, pitch_scale * output_pitch_scale, buffer_size);
 	}
 
@@ -208,8 +234,8 @@ void AudioStreamPlayer3D::_mix_audio() {
 		int buffers = AudioServer::get_singleton()->get_channel_count();
 
 		for (int k = 0; k < buffers; k++) {
-			AudioFrame target_volume = stream_paused_fade_out ? AudioFrame(0.f, 0.f) : current.vol[k];
-			AudioFrame vol_prev = stream_paused_fade_in ? AudioFrame(0.f, 0.f) : prev_outputs[i].vol[k];
+			AudioFrame target_volume = fade_out ? AudioFrame(0.f, 0.f) : current.vol[k];
+			AudioFrame vol_prev = fade_in ? AudioFrame(0.f, 0.f) : prev_outputs[i].vol[k];
 			AudioFrame vol_inc = (target_volume - vol_prev) / float(buffer_size);
 			AudioFrame vol = vol_prev;
 
@@ -269,15 +295,10 @@ void AudioStreamPlayer3D::_mix_audio() {
 					AudioFrame rvol_inc = (current.reverb_vol[k] - prev_outputs[i].reverb_vol[k]) / float(buffer_size);
 					AudioFrame rvol = prev_outputs[i].reverb_vol[k];
 
-					for (int j = 0; j < buffer_size; j++) {
-						rtarget[j] += buffer[j] * rvol;
-						rvol += rvol_inc;
-					}
+					AudioMixKernels::mix_ramp(rtarget, buffer, buffer_size, rvol, rvol_inc);
 				} else {
 					AudioFrame rvol = current.reverb_vol[k];
-					for (int j = 0; j < buffer_size; j++) {
-						rtarget[j] += buffer[j] * rvol;
-					}
+					AudioMixKernels::mix(rtarget, buffer, buffer_size, rvol);
 				}
 			}
 		}
@@ -287,6 +308,11 @@ void AudioStreamPlayer3D::_mix_audio() {
 
 	prev_output_count = output_count;
 
+	if (voice.virtualized) {
+		voice_virtualized = true;
+		virtual_position = stream_playback->get_playback_position();
+	}
+
 	//stream is no longer active, disable this.
 	if (!stream_playback->is_playing()) {
 		active = false;
@@ -297,6 +323,22 @@ void AudioStreamPlayer3D::_mix_audio() {
 	stream_paused_fade_out = false;
 }
 
+void AudioStreamPlayer3D::_advance_virtual_position(int p_frames, float p_pitch_scale) {
+	virtual_position += p_frames * p_pitch_scale * AudioServer::get_singleton()->get_global_rate_scale() / AudioServer::get_singleton()->get_mix_rate();
+
+	float length = stream->get_length();
+	if (length <= 0.0 || virtual_position < length) {
+		return;
+	}
+
+	if (stream->has_loop()) {
+		virtual_position = Math::fmod(virtual_position, length);
+	} else {
+		stream_playback->stop();
+		active = false;
+	}
+}
+
 float AudioStreamPlayer3D::_get_attenuation_db(float p_distance) const {
 	float att = 0;
 	switch (attenuation_model) {
@@ -331,6 +373,7 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 	if (p_what == NOTIFICATION_ENTER_TREE) {
 		velocity_tracker->reset(get_global_transform().origin);
 		AudioServer::get_singleton()->add_callback(_mix_audios, this);
+		AudioServer::get_singleton()->voice_add(&voice);
 		if (autoplay && !Engine::get_singleton()->is_editor_hint()) {
 			play();
 		}
@@ -338,6 +381,7 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 
 	if (p_what == NOTIFICATION_EXIT_TREE) {
 		AudioServer::get_singleton()->remove_callback(_mix_audios, this);
+		AudioServer::get_singleton()->voice_remove(&voice);
 	}
 
 	if (p_what == NOTIFICATION_PAUSED) {
@@ -598,6 +642,18 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 
 			output_count = new_output_count;
 			output_ready = true;
+
+			// What the voice manager sorts and culls voices by.
+			float audibility = 0.0;
+			for (int i = 0; i < new_output_count; i++) {
+				for (int k = 0; k < 4; k++) {
+					audibility = MAX(audibility, MAX(outputs[i].vol[k].l, outputs[i].vol[k].r));
+					audibility = MAX(audibility, MAX(outputs[i].reverb_vol[k].l, outputs[i].reverb_vol[k].r));
+				}
+			}
+			voice.audibility = audibility;
+			voice.bus_index = new_output_count > 0 ? outputs[0].bus_index : bus_index;
+			voice.priority = priority;
 		}
 
 		//start playing if requested
@@ -607,6 +663,8 @@ void AudioStreamPlayer3D::_notification(int p_what) {
 			setplay = -1;
 		}
 
+		voice.playing = active;
+
 		//stop playing if no longer active
 		if (!active) {
 			set_physics_process_internal(false);
@@ -676,6 +734,14 @@ float AudioStreamPlayer3D::get_pitch_scale() const {
 	return pitch_scale;
 }
 
+void AudioStreamPlayer3D::set_priority(int p_priority) {
+	priority = p_priority;
+}
+
+int AudioStreamPlayer3D::get_priority() const {
+	return priority;
+}
+
 void AudioStreamPlayer3D::play(float p_from_pos) {
 	if (!is_playing()) {
 		// Reset the prev_output_count if the stream is stopped
@@ -699,6 +765,7 @@ void AudioStreamPlayer3D::seek(float p_seconds) {
 void AudioStreamPlayer3D::stop() {
 	if (stream_playback.is_valid()) {
 		active = false;
+		voice.playing = false;
 		set_physics_process_internal(false);
 		setplay = -1;
 	}
@@ -717,6 +784,9 @@ float AudioStreamPlayer3D::get_playback_position() {
 		if (setseek >= 0.0) {
 			return setseek;
 		}
+		if (voice_virtualized) {
+			return virtual_position;
+		}
 		return stream_playback->get_playback_position();
 	}
 
@@ -724,10 +794,8 @@ float AudioStreamPlayer3D::get_playback_position() {
 }
 
 void AudioStreamPlayer3D::set_bus(const StringName &p_bus) {
-	//if audio is active, must lock this
-	AudioServer::get_singleton()->lock();
+	// Only read when computing the outputs, no need to lock the audio thread.
 	bus = p_bus;
-	AudioServer::get_singleton()->unlock();
 }
 
 StringName AudioStreamPlayer3D::get_bus() const {
@@ -910,6 +978,9 @@ void AudioStreamPlayer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_pitch_scale", "pitch_scale"), &AudioStreamPlayer3D::set_pitch_scale);
 	ClassDB::bind_method(D_METHOD("get_pitch_scale"), &AudioStreamPlayer3D::get_pitch_scale);
 
+	ClassDB::bind_method(D_METHOD("set_priority", "priority"), &AudioStreamPlayer3D::set_priority);
+	ClassDB::bind_method(D_METHOD("get_priority"), &AudioStreamPlayer3D::get_priority);
+
 	ClassDB::bind_method(D_METHOD("play", "from_position"), &AudioStreamPlayer3D::play, DEFVAL(0.0));
 	ClassDB::bind_method(D_METHOD("seek", "to_position"), &AudioStreamPlayer3D::seek);
 	ClassDB::bind_method(D_METHOD("stop"), &AudioStreamPlayer3D::stop);
@@ -974,6 +1045,7 @@ void AudioStreamPlayer3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "out_of_range_mode", PROPERTY_HINT_ENUM, "Mix,Pause"), "set_out_of_range_mode", "get_out_of_range_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "bus", PROPERTY_HINT_ENUM, ""), "set_bus", "get_bus");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "area_mask", PROPERTY_HINT_LAYERS_2D_PHYSICS), "set_area_mask", "get_area_mask");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "priority"), "set_priority", "get_priority");
 	ADD_GROUP("Emission Angle", "emission_angle");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "emission_angle_enabled"), "set_emission_angle_enabled", "is_emission_angle_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "emission_angle_degrees", PROPERTY_HINT_RANGE, "0.1,90,0.1"), "set_emission_angle", "get_emission_angle");
@@ -106,6 +106,13 @@ private:
 	bool stream_paused_fade_out = false;
 	StringName bus;
 
+	// Voice management, the playback isn't decoded while virtualized.
+	AudioServer::Voice voice;
+	int priority = 0;
+	bool voice_virtualized = false;
+	float virtual_position = 0.0;
+	void _advance_virtual_position(int p_frames, float p_pitch_scale);
+
 	static void _calc_output_vol(const Vector3 &source_dir, real_t tightness, Output &output);
 	void _mix_audio();
 	static void _mix_audios(void *self) { reinterpret_cast<AudioStreamPlayer3D *>(self)->_mix_audio(); }
@@ -154,6 +161,9 @@ public:
 	void set_pitch_scale(float p_pitch_scale);
 	float get_pitch_scale() const;
 
+	void set_priority(int p_priority);
+	int get_priority() const;
+
 	void play(float p_from_pos = 0.0);
 	void seek(float p_seconds);
 	void stop();
@@ -113,6 +113,8 @@ void Camera3D::_notification(int p_what) {
 				viewport->_camera_set(this);
 			}
 
+			RenderingServer::get_singleton()->camera_set_transform(camera, get_camera_transform());
+			RenderingServer::get_singleton()->camera_reset_physics_interpolation(camera);
 		} break;
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 			_request_camera_update();
@@ -120,6 +122,10 @@ void Camera3D::_notification(int p_what) {
 				velocity_tracker->update_position(get_global_transform().origin);
 			}
 		} break;
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			RenderingServer::get_singleton()->camera_set_transform(camera, get_camera_transform());
+			RenderingServer::get_singleton()->camera_reset_physics_interpolation(camera);
+		} break;
 		case NOTIFICATION_EXIT_WORLD: {
 			if (!get_tree()->is_node_being_edited(this)) {
 				if (is_current()) {
@@ -458,6 +464,15 @@ Camera3D::DopplerTracking Camera3D::get_doppler_tracking() const {
 	return doppler_tracking;
 }
 
+void Camera3D::set_physics_interpolated(bool p_interpolated) {
+	physics_interpolated = p_interpolated;
+	RenderingServer::get_singleton()->camera_set_interpolated(camera, p_interpolated);
+}
+
+bool Camera3D::is_physics_interpolated() const {
+	return physics_interpolated;
+}
+
 void Camera3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("project_ray_normal", "screen_point"), &Camera3D::project_ray_normal);
 	ClassDB::bind_method(D_METHOD("project_local_ray_normal", "screen_point"), &Camera3D::project_local_ray_normal);
@@ -499,6 +514,8 @@ void Camera3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_keep_aspect_mode"), &Camera3D::get_keep_aspect_mode);
 	ClassDB::bind_method(D_METHOD("set_doppler_tracking", "mode"), &Camera3D::set_doppler_tracking);
 	ClassDB::bind_method(D_METHOD("get_doppler_tracking"), &Camera3D::get_doppler_tracking);
+	ClassDB::bind_method(D_METHOD("set_physics_interpolated", "interpolated"), &Camera3D::set_physics_interpolated);
+	ClassDB::bind_method(D_METHOD("is_physics_interpolated"), &Camera3D::is_physics_interpolated);
 	ClassDB::bind_method(D_METHOD("get_frustum"), &Camera3D::get_frustum);
 	ClassDB::bind_method(D_METHOD("get_camera_rid"), &Camera3D::get_camera);
 
@@ -516,6 +533,7 @@ void Camera3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "doppler_tracking", PROPERTY_HINT_ENUM, "Disabled,Idle,Physics"), "set_doppler_tracking", "get_doppler_tracking");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "projection", PROPERTY_HINT_ENUM, "Perspective,Orthogonal,Frustum"), "set_projection", "get_projection");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "current"), "set_current", "is_current");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "physics_interpolated"), "set_physics_interpolated", "is_physics_interpolated");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fov", PROPERTY_HINT_RANGE, "1,179,0.1"), "set_fov", "get_fov");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "size", PROPERTY_HINT_RANGE, "0.1,16384,0.01"), "set_size", "get_size");
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "frustum_offset"), "set_frustum_offset", "get_frustum_offset");
@@ -91,6 +91,8 @@ private:
 	DopplerTracking doppler_tracking = DOPPLER_TRACKING_DISABLED;
 	Ref<VelocityTracker3D> velocity_tracker;
 
+	bool physics_interpolated = true;
+
 protected:
 	void _update_camera();
 	virtual void _request_camera_update();
@@ -172,6 +174,9 @@ public:
 	void set_doppler_tracking(DopplerTracking p_tracking);
 	DopplerTracking get_doppler_tracking() const;
 
+	void set_physics_interpolated(bool p_interpolated);
+	bool is_physics_interpolated() const;
+
 	Vector3 get_doppler_tracked_velocity() const;
 
 	Camera3D();
@@ -30,6 +30,8 @@
 
 #include "cpu_particles_3d.h"
 
+#include "core/math/batch_math.h"
+
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/gpu_particles_3d.h"
 #include "scene/resources/particles_material.h"
@@ -564,11 +566,13 @@ void CPUParticles3D::_particles_process(float p_delta) {
 	p_delta *= speed_scale;
 
 	int pcount = particles.size();
-	Particle *w = particles.ptrw();
 
-	Particle *parray = w;
+	ProcessData data;
+	data.particles = particles.ptrw();
+	data.delta = p_delta;
+	data.prev_time = time;
+	data.random_seed = Math::rand();
 
-	float prev_time = time;
 	time += p_delta;
 	if (time > lifetime) {
 		time = Math::fmod(time, lifetime);
@@ -579,23 +583,47 @@ void CPUParticles3D::_particles_process(float p_delta) {
 		}
 	}
 
-	Transform emission_xform;
-	Basis velocity_xform;
 	if (!local_coords) {
-		emission_xform = get_global_transform();
-		velocity_xform = emission_xform.basis;
+		data.emission_xform = get_global_transform();
+		data.velocity_xform = data.emission_xform.basis;
+	}
+
+	data.system_phase = time / lifetime;
+
+	// Curves bake and gradients sort themselves lazily, do it here so the particles can be processed in parallel.
+	for (int i = 0; i < PARAM_MAX; i++) {
+		if (curve_parameters[i].is_valid()) {
+			curve_parameters[i]->interpolate_baked(0.0);
+		}
+	}
+	if (color_ramp.is_valid()) {
+		color_ramp->get_color_at_offset(0.0);
 	}
 
-	float system_phase = time / lifetime;
+	if (pcount > PARTICLES_PER_JOB && is_inside_tree()) {
+		get_tree()->do_threaded_work((pcount + PARTICLES_PER_JOB - 1) / PARTICLES_PER_JOB, this, &CPUParticles3D::_particles_process_job, &data);
+	} else {
+		_particles_process_range(0, pcount, data);
+	}
+}
+
+void CPUParticles3D::_particles_process_job(uint32_t p_job, const ProcessData *p_data) {
+	int from = p_job * PARTICLES_PER_JOB;
+	_particles_process_range(from, MIN(from + int(PARTICLES_PER_JOB), particles.size()), *p_data);
+}
 
-	for (int i = 0; i < pcount; i++) {
+void CPUParticles3D::_particles_process_range(int p_from, int p_to, const ProcessData &p_data) {
+	int pcount = particles.size();
+	Particle *parray = p_data.particles;
+
+	for (int i = p_from; i < p_to; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
 			continue;
 		}
 
-		float local_delta = p_delta;
+		float local_delta = p_data.delta;
 
 		// The phase is a ratio between 0 (birth) and 1 (end of life) for each particle.
 		// While we use time in tests later on, for randomness we use the phase as done in the
@@ -604,7 +632,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 
 		if (randomness_ratio > 0.0) {
 			uint32_t seed = cycle;
-			if (restart_phase >= system_phase) {
+			if (restart_phase >= p_data.system_phase) {
 				seed -= uint32_t(1);
 			}
 			seed *= uint32_t(pcount);
@@ -617,10 +645,10 @@ void CPUParticles3D::_particles_process(float p_delta) {
 		float restart_time = restart_phase * lifetime;
 		bool restart = false;
 
-		if (time > prev_time) {
+		if (time > p_data.prev_time) {
 			// restart_time >= prev_time is used so particles emit in the first frame they are processed
 
-			if (restart_time >= prev_time && restart_time < time) {
+			if (restart_time >= p_data.prev_time && restart_time < time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = time - restart_time;
@@ -628,7 +656,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 			}
 
 		} else if (local_delta > 0.0) {
-			if (restart_time >= prev_time) {
+			if (restart_time >= p_data.prev_time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = lifetime - restart_time + time;
@@ -662,36 +690,38 @@ void CPUParticles3D::_particles_process(float p_delta) {
 
 			float tex_angle = 0.0;
 			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_angle = curve_parameters[PARAM_ANGLE]->interpolate(tv);
+				tex_angle = curve_parameters[PARAM_ANGLE]->interpolate_baked(tv);
 			}
 
 			float tex_anim_offset = 0.0;
 			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate(tv);
+				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate_baked(tv);
 			}
 
-			p.seed = Math::rand();
+			// Seeded per particle instead of using the global generator, which is not thread safe.
+			p.seed = idhash(p_data.random_seed + uint32_t(i));
+			uint32_t rng = idhash(p.seed);
 
-			p.angle_rand = Math::randf();
-			p.scale_rand = Math::randf();
-			p.hue_rot_rand = Math::randf();
-			p.anim_offset_rand = Math::randf();
+			p.angle_rand = rand_from_seed(rng);
+			p.scale_rand = rand_from_seed(rng);
+			p.hue_rot_rand = rand_from_seed(rng);
+			p.anim_offset_rand = rand_from_seed(rng);
 
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
-				float angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg2rad((Math::randf() * 2.0 - 1.0) * spread);
+				float angle1_rad = Math::atan2(direction.y, direction.x) + Math::deg2rad((rand_from_seed(rng) * 2.0 - 1.0) * spread);
 				Vector3 rot = Vector3(Math::cos(angle1_rad), Math::sin(angle1_rad), 0.0);
-				p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(Math::randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
+				p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(rand_from_seed(rng)), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
 			} else {
 				//initiate velocity spread in 3D
-				float angle1_rad = Math::atan2(direction.x, direction.z) + Math::deg2rad((Math::randf() * 2.0 - 1.0) * spread);
-				float angle2_rad = Math::atan2(direction.y, Math::abs(direction.z)) + Math::deg2rad((Math::randf() * 2.0 - 1.0) * (1.0 - flatness) * spread);
+				float angle1_rad = Math::atan2(direction.x, direction.z) + Math::deg2rad((rand_from_seed(rng) * 2.0 - 1.0) * spread);
+				float angle2_rad = Math::atan2(direction.y, Math::abs(direction.z)) + Math::deg2rad((rand_from_seed(rng) * 2.0 - 1.0) * (1.0 - flatness) * spread);
 
 				Vector3 direction_xz = Vector3(Math::sin(angle1_rad), 0, Math::cos(angle1_rad));
 				Vector3 direction_yz = Vector3(0, Math::sin(angle2_rad), Math::cos(angle2_rad));
 				direction_yz.z = direction_yz.z / MAX(0.0001, Math::sqrt(ABS(direction_yz.z))); //better uniform distribution
 				Vector3 direction = Vector3(direction_xz.x * direction_yz.z, direction_yz.y, direction_xz.z * direction_yz.z);
 				direction.normalize();
-				p.velocity = direction * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(Math::randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
+				p.velocity = direction * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(rand_from_seed(rng)), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
 			}
 
 			float base_angle = (parameters[PARAM_ANGLE] + tex_angle) * Math::lerp(1.0f, p.angle_rand, randomness[PARAM_ANGLE]);
@@ -700,7 +730,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 			p.custom[2] = (parameters[PARAM_ANIM_OFFSET] + tex_anim_offset) * Math::lerp(1.0f, p.anim_offset_rand, randomness[PARAM_ANIM_OFFSET]); //animation offset (0-1)
 			p.transform = Transform();
 			p.time = 0;
-			p.lifetime = lifetime * (1.0 - Math::randf() * lifetime_randomness);
+			p.lifetime = lifetime * (1.0 - rand_from_seed(rng) * lifetime_randomness);
 			p.base_color = Color(1, 1, 1, 1);
 
 			switch (emission_shape) {
@@ -708,13 +738,13 @@ void CPUParticles3D::_particles_process(float p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					real_t s = 2.0 * Math::randf() - 1.0;
-					real_t t = Math_TAU * Math::randf();
+					real_t s = 2.0 * rand_from_seed(rng) - 1.0;
+					real_t t = Math_TAU * rand_from_seed(rng);
 					real_t radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s);
 				} break;
 				case EMISSION_SHAPE_BOX: {
-					p.transform.origin = Vector3(Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0) * emission_box_extents;
+					p.transform.origin = Vector3(rand_from_seed(rng) * 2.0 - 1.0, rand_from_seed(rng) * 2.0 - 1.0, rand_from_seed(rng) * 2.0 - 1.0) * emission_box_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -723,7 +753,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = idhash(rng) % uint32_t(pc);
 
 					p.transform.origin = emission_points.get(random_idx);
 
@@ -761,8 +791,8 @@ void CPUParticles3D::_particles_process(float p_delta) {
 			}
 
 			if (!local_coords) {
-				p.velocity = velocity_xform.xform(p.velocity);
-				p.transform = emission_xform * p.transform;
+				p.velocity = p_data.velocity_xform.xform(p.velocity);
+				p.transform = p_data.emission_xform * p.transform;
 			}
 
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
@@ -784,53 +814,53 @@ void CPUParticles3D::_particles_process(float p_delta) {
 
 			float tex_linear_velocity = 0.0;
 			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
-				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->interpolate(tv);
+				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->interpolate_baked(tv);
 			}
 
 			float tex_orbit_velocity = 0.0;
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
 				if (curve_parameters[PARAM_ORBIT_VELOCITY].is_valid()) {
-					tex_orbit_velocity = curve_parameters[PARAM_ORBIT_VELOCITY]->interpolate(tv);
+					tex_orbit_velocity = curve_parameters[PARAM_ORBIT_VELOCITY]->interpolate_baked(tv);
 				}
 			}
 
 			float tex_angular_velocity = 0.0;
 			if (curve_parameters[PARAM_ANGULAR_VELOCITY].is_valid()) {
-				tex_angular_velocity = curve_parameters[PARAM_ANGULAR_VELOCITY]->interpolate(tv);
+				tex_angular_velocity = curve_parameters[PARAM_ANGULAR_VELOCITY]->interpolate_baked(tv);
 			}
 
 			float tex_linear_accel = 0.0;
 			if (curve_parameters[PARAM_LINEAR_ACCEL].is_valid()) {
-				tex_linear_accel = curve_parameters[PARAM_LINEAR_ACCEL]->interpolate(tv);
+				tex_linear_accel = curve_parameters[PARAM_LINEAR_ACCEL]->interpolate_baked(tv);
 			}
 
 			float tex_tangential_accel = 0.0;
 			if (curve_parameters[PARAM_TANGENTIAL_ACCEL].is_valid()) {
-				tex_tangential_accel = curve_parameters[PARAM_TANGENTIAL_ACCEL]->interpolate(tv);
+				tex_tangential_accel = curve_parameters[PARAM_TANGENTIAL_ACCEL]->interpolate_baked(tv);
 			}
 
 			float tex_radial_accel = 0.0;
 			if (curve_parameters[PARAM_RADIAL_ACCEL].is_valid()) {
-				tex_radial_accel = curve_parameters[PARAM_RADIAL_ACCEL]->interpolate(tv);
+				tex_radial_accel = curve_parameters[PARAM_RADIAL_ACCEL]->interpolate_baked(tv);
 			}
 
 			float tex_damping = 0.0;
 			if (curve_parameters[PARAM_DAMPING].is_valid()) {
-				tex_damping = curve_parameters[PARAM_DAMPING]->interpolate(tv);
+				tex_damping = curve_parameters[PARAM_DAMPING]->interpolate_baked(tv);
 			}
 
 			float tex_angle = 0.0;
 			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_angle = curve_parameters[PARAM_ANGLE]->interpolate(tv);
+				tex_angle = curve_parameters[PARAM_ANGLE]->interpolate_baked(tv);
 			}
 			float tex_anim_speed = 0.0;
 			if (curve_parameters[PARAM_ANIM_SPEED].is_valid()) {
-				tex_anim_speed = curve_parameters[PARAM_ANIM_SPEED]->interpolate(tv);
+				tex_anim_speed = curve_parameters[PARAM_ANIM_SPEED]->interpolate_baked(tv);
 			}
 
 			float tex_anim_offset = 0.0;
 			if (curve_parameters[PARAM_ANIM_OFFSET].is_valid()) {
-				tex_anim_offset = curve_parameters[PARAM_ANIM_OFFSET]->interpolate(tv);
+				tex_anim_offset = curve_parameters[PARAM_ANIM_OFFSET]->interpolate_baked(tv);
 			}
 
 			Vector3 force = gravity;
@@ -841,7 +871,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 			//apply linear acceleration
 			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * (parameters[PARAM_LINEAR_ACCEL] + tex_linear_accel) * Math::lerp(1.0f, rand_from_seed(alt_seed), randomness[PARAM_LINEAR_ACCEL]) : Vector3();
 			//apply radial acceleration
-			Vector3 org = emission_xform.origin;
+			Vector3 org = p_data.emission_xform.origin;
 			Vector3 diff = position - org;
 			force += diff.length() > 0.0 ? diff.normalized() * (parameters[PARAM_RADIAL_ACCEL] + tex_radial_accel) * Math::lerp(1.0f, rand_from_seed(alt_seed), randomness[PARAM_RADIAL_ACCEL]) : Vector3();
 			//apply tangential acceleration;
@@ -892,12 +922,12 @@ void CPUParticles3D::_particles_process(float p_delta) {
 
 		float tex_scale = 1.0;
 		if (curve_parameters[PARAM_SCALE].is_valid()) {
-			tex_scale = curve_parameters[PARAM_SCALE]->interpolate(tv);
+			tex_scale = curve_parameters[PARAM_SCALE]->interpolate_baked(tv);
 		}
 
 		float tex_hue_variation = 0.0;
 		if (curve_parameters[PARAM_HUE_VARIATION].is_valid()) {
-			tex_hue_variation = curve_parameters[PARAM_HUE_VARIATION]->interpolate(tv);
+			tex_hue_variation = curve_parameters[PARAM_HUE_VARIATION]->interpolate_baked(tv);
 		}
 
 		float hue_rot_angle = (parameters[PARAM_HUE_VARIATION] + tex_hue_variation) * Math_TAU * Math::lerp(1.0f, p.hue_rot_rand * 2.0f - 1.0f, randomness[PARAM_HUE_VARIATION]);
@@ -1031,14 +1061,19 @@ void CPUParticles3D::_update_particle_data_buffer() {
 		}
 	}
 
+	if (!local_coords) {
+		// Brought back to local space in a batch, in draw order.
+		particle_xforms.resize(pc);
+		for (int i = 0; i < pc; i++) {
+			particle_xforms[i] = r[order ? order[i] : i].transform;
+		}
+		BatchMath::multiply(inv_emission_transform, particle_xforms.ptr(), particle_xforms.ptr(), pc);
+	}
+
 	for (int i = 0; i < pc; i++) {
 		int idx = order ? order[i] : i;
 
-		Transform t = r[idx].transform;
-
-		if (!local_coords) {
-			t = inv_emission_transform * t;
-		}
+		const Transform &t = local_coords ? r[idx].transform : particle_xforms[i];
 
 		if (r[idx].active) {
 			ptr[0] = t.basis.elements[0][0];
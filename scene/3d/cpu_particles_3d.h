@@ -31,6 +31,7 @@
 #ifndef CPU_PARTICLES_H
 #define CPU_PARTICLES_H
 
+#include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
 #include "scene/3d/visual_instance_3d.h"
 
@@ -108,6 +109,7 @@ private:
 	Vector<Particle> particles;
 	Vector<float> particle_data;
 	Vector<int> particle_order;
+	LocalVector<Transform> particle_xforms;
 
 	struct SortLifetime {
 		const Particle *particles = nullptr;
@@ -173,7 +175,23 @@ private:
 	Vector3 gravity = Vector3(0, -9.8, 0);
 
 	void _update_internal();
+	struct ProcessData {
+		Particle *particles = nullptr;
+		float delta = 0.0;
+		float prev_time = 0.0;
+		float system_phase = 0.0;
+		uint32_t random_seed = 0;
+		Transform emission_xform;
+		Basis velocity_xform;
+	};
+
+	enum {
+		PARTICLES_PER_JOB = 1024, // Larger emitters are processed on the scene tree's thread pool, in jobs of this many particles.
+	};
+
 	void _particles_process(float p_delta);
+	void _particles_process_job(uint32_t p_job, const ProcessData *p_data);
+	void _particles_process_range(int p_from, int p_to, const ProcessData &p_data);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
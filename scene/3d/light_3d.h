@@ -147,6 +147,7 @@ public:
 		SHADOW_ORTHOGONAL,
 		SHADOW_PARALLEL_2_SPLITS,
 		SHADOW_PARALLEL_4_SPLITS,
+		SHADOW_CLIPMAP,
 	};
 
 	enum ShadowDepthRange {
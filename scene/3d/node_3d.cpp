@@ -95,18 +95,20 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	/*
-	if (data.dirty&DIRTY_GLOBAL)
+	// Once propagated, the subtree stays dirty and queued for notification until the
+	// next flush, unless a global transform is read, which also cleans this node.
+	if ((data.dirty & DIRTY_GLOBAL) && data.propagated_flush == get_tree()->xform_flush_count) {
 		return; //already dirty
-	*/
+	}
 
 	data.children_lock++;
 
-	for (List<Node3D *>::Element *E = data.children.front(); E; E = E->next()) {
-		if (E->get()->data.top_level_active) {
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		Node3D *c = data.children[i];
+		if (c->data.top_level_active) {
 			continue; //don't propagate to a top_level
 		}
-		E->get()->_propagate_transform_changed(p_origin);
+		c->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
 	if ((data.gizmo.is_valid() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
@@ -116,6 +118,7 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		get_tree()->xform_change_list.add(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL;
+	data.propagated_flush = get_tree()->xform_flush_count;
 
 	data.children_lock--;
 }
@@ -131,9 +134,10 @@ void Node3D::_notification(int p_what) {
 			}
 
 			if (data.parent) {
-				data.C = data.parent->data.children.push_back(this);
+				data.index_in_parent = data.parent->data.children.size();
+				data.parent->data.children.push_back(this);
 			} else {
-				data.C = nullptr;
+				data.index_in_parent = -1;
 			}
 
 			if (data.top_level && !Engine::get_singleton()->is_editor_hint()) {
@@ -145,6 +149,7 @@ void Node3D::_notification(int p_what) {
 			}
 
 			data.dirty |= DIRTY_GLOBAL; //global is always dirty upon entering a scene
+			data.propagated_flush = get_tree()->xform_flush_count - 1; //not queued for notification yet
 			_notify_dirty();
 
 			notification(NOTIFICATION_ENTER_WORLD);
@@ -155,11 +160,15 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
-			if (data.C) {
-				data.parent->data.children.erase(data.C);
+			if (data.index_in_parent >= 0) {
+				LocalVector<Node3D *> &siblings = data.parent->data.children;
+				Node3D *last = siblings[siblings.size() - 1];
+				siblings[data.index_in_parent] = last;
+				last->data.index_in_parent = data.index_in_parent;
+				siblings.resize(siblings.size() - 1);
 			}
 			data.parent = nullptr;
-			data.C = nullptr;
+			data.index_in_parent = -1;
 			data.top_level_active = false;
 		} break;
 		case NOTIFICATION_ENTER_WORLD: {
@@ -494,8 +503,8 @@ void Node3D::_propagate_visibility_changed() {
 	}
 #endif
 
-	for (List<Node3D *>::Element *E = data.children.front(); E; E = E->next()) {
-		Node3D *c = E->get();
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		Node3D *c = data.children[i];
 		if (!c || !c->data.visible) {
 			continue;
 		}
@@ -692,6 +701,13 @@ void Node3D::force_update_transform() {
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
 
+void Node3D::reset_physics_interpolation() {
+	if (!is_inside_tree()) {
+		return; // Entering the world resets it anyway.
+	}
+	propagate_notification(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
+}
+
 void Node3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_transform", "local"), &Node3D::set_transform);
 	ClassDB::bind_method(D_METHOD("get_transform"), &Node3D::get_transform);
@@ -714,6 +730,7 @@ void Node3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_world_3d"), &Node3D::get_world_3d);
 
 	ClassDB::bind_method(D_METHOD("force_update_transform"), &Node3D::force_update_transform);
+	ClassDB::bind_method(D_METHOD("reset_physics_interpolation"), &Node3D::reset_physics_interpolation);
 
 	ClassDB::bind_method(D_METHOD("_update_gizmo"), &Node3D::_update_gizmo);
 
@@ -757,6 +774,7 @@ void Node3D::_bind_methods() {
 	BIND_CONSTANT(NOTIFICATION_ENTER_WORLD);
 	BIND_CONSTANT(NOTIFICATION_EXIT_WORLD);
 	BIND_CONSTANT(NOTIFICATION_VISIBILITY_CHANGED);
+	BIND_CONSTANT(NOTIFICATION_RESET_PHYSICS_INTERPOLATION);
 
 	//ADD_PROPERTY( PropertyInfo(Variant::TRANSFORM,"transform/global",PROPERTY_HINT_NONE, "", PROPERTY_USAGE_EDITOR ), "set_global_transform", "get_global_transform") ;
 	ADD_GROUP("Transform", "");
@@ -77,8 +77,9 @@ class Node3D : public Node {
 
 		int children_lock = 0;
 		Node3D *parent = nullptr;
-		List<Node3D *> children;
-		List<Node3D *>::Element *C = nullptr;
+		LocalVector<Node3D *> children; // Unordered, children swap places when one is removed.
+		int index_in_parent = -1;
+		uint32_t propagated_flush = 0; // SceneTree flush count when the transform change was last propagated.
 
 		bool ignore_notification = false;
 		bool notify_local_transform = false;
@@ -116,6 +117,7 @@ public:
 		NOTIFICATION_EXIT_WORLD = 42,
 		NOTIFICATION_VISIBILITY_CHANGED = 43,
 		NOTIFICATION_LOCAL_TRANSFORM_CHANGED = 44,
+		NOTIFICATION_RESET_PHYSICS_INTERPOLATION = 46,
 	};
 
 	Node3D *get_parent_spatial() const;
@@ -195,6 +197,7 @@ public:
 	bool is_visible_in_tree() const;
 
 	void force_update_transform();
+	void reset_physics_interpolation();
 
 	Node3D();
 };
@@ -32,12 +32,17 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/math/batch_math.h"
 #include "core/object/message_queue.h"
 #include "core/variant/type_info.h"
 #include "scene/3d/physics_body_3d.h"
+#include "scene/main/scene_tree.h"
 #include "scene/resources/surface_tool.h"
 #include "scene/scene_string_names.h"
 
+SelfList<Skeleton3D>::List Skeleton3D::dirty_pose_list;
+SpinLock Skeleton3D::dirty_pose_lock;
+
 void SkinReference::_skin_changed() {
 	if (skeleton_node) {
 		skeleton_node->_make_dirty();
@@ -223,71 +228,122 @@ void Skeleton3D::_update_process_order() {
 	process_order_dirty = false;
 }
 
-void Skeleton3D::_notification(int p_what) {
-	switch (p_what) {
-		case NOTIFICATION_UPDATE_SKELETON: {
-			RenderingServer *rs = RenderingServer::get_singleton();
-			Bone *bonesptr = bones.ptrw();
-			int len = bones.size();
+void Skeleton3D::_update_global_poses() {
+	Bone *bonesptr = bones.ptrw();
+	int len = bones.size();
 
-			_update_process_order();
+	_update_process_order();
 
-			const int *order = process_order.ptr();
+	const int *order = process_order.ptr();
 
-			for (int i = 0; i < len; i++) {
-				Bone &b = bonesptr[order[i]];
+	for (int i = 0; i < len; i++) {
+		Bone &b = bonesptr[order[i]];
 
-				if (b.global_pose_override_amount >= 0.999) {
-					b.pose_global = b.global_pose_override;
+		if (b.global_pose_override_amount >= 0.999) {
+			b.pose_global = b.global_pose_override;
+		} else {
+			if (b.disable_rest) {
+				if (b.enabled) {
+					Transform pose = b.pose;
+					if (b.custom_pose_enable) {
+						pose = b.custom_pose * pose;
+					}
+					if (b.parent >= 0) {
+						b.pose_global = bonesptr[b.parent].pose_global * pose;
+					} else {
+						b.pose_global = pose;
+					}
 				} else {
-					if (b.disable_rest) {
-						if (b.enabled) {
-							Transform pose = b.pose;
-							if (b.custom_pose_enable) {
-								pose = b.custom_pose * pose;
-							}
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * pose;
-							} else {
-								b.pose_global = pose;
-							}
-						} else {
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global;
-							} else {
-								b.pose_global = Transform();
-							}
-						}
-
+					if (b.parent >= 0) {
+						b.pose_global = bonesptr[b.parent].pose_global;
 					} else {
-						if (b.enabled) {
-							Transform pose = b.pose;
-							if (b.custom_pose_enable) {
-								pose = b.custom_pose * pose;
-							}
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * (b.rest * pose);
-							} else {
-								b.pose_global = b.rest * pose;
-							}
-						} else {
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * b.rest;
-							} else {
-								b.pose_global = b.rest;
-							}
-						}
+						b.pose_global = Transform();
 					}
+				}
 
-					if (b.global_pose_override_amount >= CMP_EPSILON) {
-						b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+			} else {
+				if (b.enabled) {
+					Transform pose = b.pose;
+					if (b.custom_pose_enable) {
+						pose = b.custom_pose * pose;
+					}
+					if (b.parent >= 0) {
+						b.pose_global = bonesptr[b.parent].pose_global * (b.rest * pose);
+					} else {
+						b.pose_global = b.rest * pose;
+					}
+				} else {
+					if (b.parent >= 0) {
+						b.pose_global = bonesptr[b.parent].pose_global * b.rest;
+					} else {
+						b.pose_global = b.rest;
 					}
 				}
+			}
+
+			if (b.global_pose_override_amount >= CMP_EPSILON) {
+				b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+			}
+		}
+
+		if (b.global_pose_override_reset) {
+			b.global_pose_override_amount = 0.0;
+		}
+	}
+
+	global_poses_updated = true;
+}
+
+void Skeleton3D::_update_global_poses_job(uint32_t p_index, Skeleton3D *const *p_skeletons) {
+	p_skeletons[p_index]->_update_global_poses();
+}
+
+void Skeleton3D::_update_dirty_global_poses() {
+	LocalVector<Skeleton3D *> skeletons;
+
+	dirty_pose_lock.lock();
+	while (dirty_pose_list.first()) {
+		Skeleton3D *skeleton = dirty_pose_list.first()->self();
+		dirty_pose_list.remove(&skeleton->dirty_pose_item);
+		skeletons.push_back(skeleton);
+	}
+	dirty_pose_lock.unlock();
+
+	// Each skeleton only touches its own bones, so they can be computed side by side.
+	SceneTree *tree = SceneTree::get_singleton();
+	if (skeletons.size() > 1 && tree) {
+		tree->do_threaded_work(skeletons.size(), skeletons[0], &Skeleton3D::_update_global_poses_job, skeletons.ptr());
+	} else {
+		for (uint32_t i = 0; i < skeletons.size(); i++) {
+			skeletons[i]->_update_global_poses();
+		}
+	}
+}
+
+void Skeleton3D::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_UPDATE_SKELETON: {
+			RenderingServer *rs = RenderingServer::get_singleton();
 
-				if (b.global_pose_override_reset) {
-					b.global_pose_override_amount = 0.0;
+			if (!global_poses_updated) {
+				if (dirty_pose_item.in_list() && Thread::get_caller_id() == Thread::get_main_id()) {
+					_update_dirty_global_poses();
+				} else {
+					dirty_pose_lock.lock();
+					if (dirty_pose_item.in_list()) {
+						dirty_pose_list.remove(&dirty_pose_item);
+					}
+					dirty_pose_lock.unlock();
+					_update_global_poses();
 				}
+			}
+			global_poses_updated = false;
 
+			Bone *bonesptr = bones.ptrw();
+			int len = bones.size();
+
+			for (int i = 0; i < len; i++) {
+				Bone &b = bonesptr[i];
 				for (List<ObjectID>::Element *E = b.nodes_bound.front(); E; E = E->next()) {
 					Object *obj = ObjectDB::get_instance(E->get());
 					ERR_CONTINUE(!obj);
@@ -308,6 +364,12 @@ void Skeleton3D::_notification(int p_what) {
 					E->get()->bind_count = bind_count;
 					E->get()->skin_bone_indices.resize(bind_count);
 					E->get()->skin_bone_indices_ptrs = E->get()->skin_bone_indices.ptrw();
+					// Freshly allocated bone data is zeroed on the server.
+					E->get()->bind_transforms.resize(bind_count);
+					Transform *bind_transforms = E->get()->bind_transforms.ptrw();
+					for (uint32_t i = 0; i < bind_count; i++) {
+						bind_transforms[i] = Transform(Basis(0, 0, 0, 0, 0, 0, 0, 0, 0), Vector3());
+					}
 				}
 
 				if (E->get()->skeleton_version != version) {
@@ -346,10 +408,25 @@ void Skeleton3D::_notification(int p_what) {
 					E->get()->skeleton_version = version;
 				}
 
+				// Gathered so the bind transforms are multiplied in a batch.
+				bind_globals.resize(bind_count);
+				bind_poses.resize(bind_count);
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->get()->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+					bind_globals[i] = bone_index < (uint32_t)len ? bonesptr[bone_index].pose_global : Transform();
+					bind_poses[i] = skin->get_bind_pose(i);
+				}
+				BatchMath::multiply(bind_globals.ptr(), bind_poses.ptr(), bind_globals.ptr(), bind_count);
+
+				Transform *bind_transforms = E->get()->bind_transforms.ptrw();
+				for (uint32_t i = 0; i < bind_count; i++) {
+					ERR_CONTINUE(E->get()->skin_bone_indices_ptrs[i] >= (uint32_t)len);
+					const Transform &xform = bind_globals[i];
+					if (xform == bind_transforms[i]) {
+						continue;
+					}
+					bind_transforms[i] = xform;
+					rs->skeleton_bone_set_transform(skeleton, i, xform);
 				}
 			}
 
@@ -597,10 +674,19 @@ Transform Skeleton3D::get_bone_custom_pose(int p_bone) const {
 }
 
 void Skeleton3D::_make_dirty() {
+	// Poses computed ahead of the notification by a batch are stale now.
+	global_poses_updated = false;
+
 	if (dirty) {
 		return;
 	}
 
+	dirty_pose_lock.lock();
+	if (!dirty_pose_item.in_list()) {
+		dirty_pose_list.add(&dirty_pose_item);
+	}
+	dirty_pose_lock.unlock();
+
 	MessageQueue::get_singleton()->push_notification(this, NOTIFICATION_UPDATE_SKELETON);
 	dirty = true;
 }
@@ -926,10 +1012,17 @@ void Skeleton3D::_bind_methods() {
 	BIND_CONSTANT(NOTIFICATION_UPDATE_SKELETON);
 }
 
-Skeleton3D::Skeleton3D() {
+Skeleton3D::Skeleton3D() :
+		dirty_pose_item(this) {
 }
 
 Skeleton3D::~Skeleton3D() {
+	dirty_pose_lock.lock();
+	if (dirty_pose_item.in_list()) {
+		dirty_pose_list.remove(&dirty_pose_item);
+	}
+	dirty_pose_lock.unlock();
+
 	//some skins may remain bound
 	for (Set<SkinReference *>::Element *E = skin_bindings.front(); E; E = E->next()) {
 		E->get()->skeleton_node = nullptr;
@@ -31,7 +31,10 @@
 #ifndef SKELETON_3D_H
 #define SKELETON_3D_H
 
+#include "core/os/spin_lock.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
+#include "core/templates/self_list.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/skin.h"
 
@@ -54,6 +57,7 @@ class SkinReference : public Reference {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs;
+	Vector<Transform> bind_transforms; // Last transforms sent to the server, to skip unchanged bones.
 	void _skin_changed();
 
 protected:
@@ -100,6 +104,8 @@ private:
 	};
 
 	Set<SkinReference *> skin_bindings;
+	LocalVector<Transform> bind_globals; // Scratch for the skin updates, a skin at a time.
+	LocalVector<Transform> bind_poses;
 
 	void _skin_changed();
 
@@ -113,6 +119,17 @@ private:
 
 	uint64_t version = 1;
 
+	// Skeletons waiting for NOTIFICATION_UPDATE_SKELETON. The first one to be
+	// notified computes the global poses of all of them in parallel.
+	static SelfList<Skeleton3D>::List dirty_pose_list;
+	static SpinLock dirty_pose_lock;
+	SelfList<Skeleton3D> dirty_pose_item;
+	bool global_poses_updated = false;
+
+	void _update_global_poses();
+	void _update_global_poses_job(uint32_t p_index, Skeleton3D *const *p_skeletons);
+	static void _update_dirty_global_poses();
+
 	// bind helpers
 	Array _get_bound_child_nodes_to_bone(int p_bone) const {
 		Array bound;
@@ -48,20 +48,19 @@ void SoftBodyRenderingServerHandler::prepare(RID p_mesh, int p_surface) {
 
 	mesh = p_mesh;
 	surface = p_surface;
-#ifndef _MSC_VER
-#warning Softbody is not working, needs to be redone considering that these functions no longer exist
-#endif
-#if 0
-	const uint32_t surface_format = RS::get_singleton()->mesh_surface_get_format(mesh, surface);
-	const int surface_vertex_len = RS::get_singleton()->mesh_surface_get_array_len(mesh, p_surface);
-	const int surface_index_len = RS::get_singleton()->mesh_surface_get_array_index_len(mesh, p_surface);
+
+	// Only the vertex stream (positions, normals and tangents) is kept, it's the GPU vertex buffer
+	// as is, so the physics server writes its final layout and committing is a single region update.
+	RS::SurfaceData surface_data = RS::get_singleton()->mesh_get_surface(mesh, surface);
 	uint32_t surface_offsets[RS::ARRAY_MAX];
+	uint32_t attrib_stride;
+	uint32_t skin_stride;
+	RS::get_singleton()->mesh_surface_make_offsets_from_format(surface_data.format, surface_data.vertex_count, surface_data.index_count, surface_offsets, stride, attrib_stride, skin_stride);
 
-	buffer = RS::get_singleton()->mesh_surface_get_array(mesh, surface);
-	stride = RS::get_singleton()->mesh_surface_make_offsets_from_format(surface_format, surface_vertex_len, surface_index_len, surface_offsets);
+	buffer = surface_data.vertex_data;
 	offset_vertices = surface_offsets[RS::ARRAY_VERTEX];
 	offset_normal = surface_offsets[RS::ARRAY_NORMAL];
-#endif
+	has_normal = surface_data.format & RS::ARRAY_FORMAT_NORMAL;
 }
 
 void SoftBodyRenderingServerHandler::clear() {
@@ -81,7 +80,9 @@ void SoftBodyRenderingServerHandler::close() {
 }
 
 void SoftBodyRenderingServerHandler::commit_changes() {
-	RS::get_singleton()->mesh_surface_update_region(mesh, surface, 0, buffer);
+	if (buffer.size()) {
+		RS::get_singleton()->mesh_surface_update_region(mesh, surface, 0, buffer);
+	}
 }
 
 void SoftBodyRenderingServerHandler::set_vertex(int p_vertex_id, const void *p_vector3) {
@@ -89,7 +90,17 @@ void SoftBodyRenderingServerHandler::set_vertex(int p_vertex_id, const void *p_v
 }
 
 void SoftBodyRenderingServerHandler::set_normal(int p_vertex_id, const void *p_vector3) {
-	copymem(&write_buffer[p_vertex_id * stride + offset_normal], p_vector3, sizeof(float) * 3);
+	if (!has_normal) {
+		return;
+	}
+
+	// Packed the same way as RenderingServer::_surface_set_data().
+	const float *normal = (const float *)p_vector3;
+	uint32_t value = 0;
+	value |= CLAMP(int((normal[0] * 0.5 + 0.5) * 1023.0), 0, 1023);
+	value |= CLAMP(int((normal[1] * 0.5 + 0.5) * 1023.0), 0, 1023) << 10;
+	value |= CLAMP(int((normal[2] * 0.5 + 0.5) * 1023.0), 0, 1023) << 20;
+	copymem(&write_buffer[p_vertex_id * stride + offset_normal], &value, sizeof(uint32_t));
 }
 
 void SoftBodyRenderingServerHandler::set_aabb(const AABB &p_aabb) {
@@ -44,6 +44,7 @@ class SoftBodyRenderingServerHandler {
 	uint32_t stride = 0;
 	uint32_t offset_vertices = 0;
 	uint32_t offset_normal = 0;
+	bool has_normal = false;
 
 	uint8_t *write_buffer = nullptr;
 
@@ -0,0 +1,458 @@
+/*************************************************************************/
+/*  vertex_animation.cpp                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "vertex_animation.h"
+
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/3d/skeleton_3d.h"
+#include "scene/animation/animation_player.h"
+
+bool VertexAnimation::_set(const StringName &p_name, const Variant &p_value) {
+	String name = p_name;
+	if (name == "clip_count") {
+		set_clip_count(p_value);
+		return true;
+	} else if (name.begins_with("clip/")) {
+		int index = name.get_slicec('/', 1).to_int();
+		String what = name.get_slicec('/', 2);
+		ERR_FAIL_INDEX_V(index, clips.size(), false);
+		if (what == "name") {
+			clips.write[index].name = p_value;
+			return true;
+		} else if (what == "frame_offset") {
+			clips.write[index].frame_offset = p_value;
+			return true;
+		} else if (what == "frame_count") {
+			clips.write[index].frame_count = p_value;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool VertexAnimation::_get(const StringName &p_name, Variant &r_ret) const {
+	String name = p_name;
+	if (name == "clip_count") {
+		r_ret = get_clip_count();
+		return true;
+	} else if (name.begins_with("clip/")) {
+		int index = name.get_slicec('/', 1).to_int();
+		String what = name.get_slicec('/', 2);
+		ERR_FAIL_INDEX_V(index, clips.size(), false);
+		if (what == "name") {
+			r_ret = get_clip_name(index);
+			return true;
+		} else if (what == "frame_offset") {
+			r_ret = get_clip_frame_offset(index);
+			return true;
+		} else if (what == "frame_count") {
+			r_ret = get_clip_frame_count(index);
+			return true;
+		}
+	}
+	return false;
+}
+
+void VertexAnimation::_get_property_list(List<PropertyInfo> *p_list) const {
+	p_list->push_back(PropertyInfo(Variant::INT, "clip_count", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"));
+	for (int i = 0; i < clips.size(); i++) {
+		p_list->push_back(PropertyInfo(Variant::STRING_NAME, "clip/" + itos(i) + "/name"));
+		p_list->push_back(PropertyInfo(Variant::INT, "clip/" + itos(i) + "/frame_offset", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"));
+		p_list->push_back(PropertyInfo(Variant::INT, "clip/" + itos(i) + "/frame_count", PROPERTY_HINT_RANGE, "1,65536,1,or_greater"));
+	}
+}
+
+Error VertexAnimation::bake(Node *p_mesh_instance, Node *p_animation_player, const Vector<String> &p_animations, float p_fps) {
+	MeshInstance3D *mesh_instance = Object::cast_to<MeshInstance3D>(p_mesh_instance);
+	AnimationPlayer *player = Object::cast_to<AnimationPlayer>(p_animation_player);
+	ERR_FAIL_NULL_V(mesh_instance, ERR_INVALID_PARAMETER);
+	ERR_FAIL_NULL_V(player, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(p_fps <= 0.0, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(p_animations.is_empty(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(!mesh_instance->is_inside_tree(), ERR_UNCONFIGURED, "The MeshInstance3D must be inside the scene tree to bake its animations.");
+
+	Ref<Mesh> source = mesh_instance->get_mesh();
+	ERR_FAIL_COND_V(source.is_null(), ERR_INVALID_PARAMETER);
+
+	Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(mesh_instance->get_node_or_null(mesh_instance->get_skeleton_path()));
+	ERR_FAIL_COND_V_MSG(!skeleton, ERR_INVALID_PARAMETER, "The MeshInstance3D is not bound to a Skeleton3D.");
+
+	// Without an explicit skin, bind the bones the same way the mesh instance does.
+	Ref<Skin> skin = mesh_instance->get_skin();
+	Ref<SkinReference> skin_ref;
+	if (skin.is_null()) {
+		skin_ref = skeleton->register_skin(Ref<Skin>());
+		ERR_FAIL_COND_V(skin_ref.is_null(), ERR_CANT_CREATE);
+		skin = skin_ref->get_skin();
+	}
+
+	int bind_count = skin->get_bind_count();
+	Vector<int> bind_bones;
+	bind_bones.resize(bind_count);
+	for (int i = 0; i < bind_count; i++) {
+		int bone = skin->get_bind_name(i) != StringName() ? skeleton->find_bone(skin->get_bind_name(i)) : skin->get_bind_bone(i);
+		if (bone >= skeleton->get_bone_count()) {
+			bone = -1;
+		}
+		bind_bones.write[i] = bone;
+	}
+
+	struct SurfaceData {
+		Array arrays;
+		Vector<Vector3> vertices;
+		Vector<Vector3> normals;
+		Vector<int> bones;
+		Vector<float> weights;
+		int bones_per_vertex = 4;
+		int vertex_base = 0;
+	};
+
+	Vector<SurfaceData> surfaces;
+	int total_vertices = 0;
+	for (int i = 0; i < source->get_surface_count(); i++) {
+		SurfaceData sd;
+		sd.arrays = source->surface_get_arrays(i);
+		sd.vertices = sd.arrays[Mesh::ARRAY_VERTEX];
+		sd.normals = sd.arrays[Mesh::ARRAY_NORMAL];
+		sd.bones = sd.arrays[Mesh::ARRAY_BONES];
+		sd.weights = sd.arrays[Mesh::ARRAY_WEIGHTS];
+		sd.bones_per_vertex = (source->surface_get_format(i) & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS) ? 8 : 4;
+		sd.vertex_base = total_vertices;
+		total_vertices += sd.vertices.size();
+		surfaces.push_back(sd);
+	}
+	ERR_FAIL_COND_V(total_vertices == 0, ERR_INVALID_DATA);
+
+	Vector<Clip> new_clips;
+	int total_frames = 0;
+	for (int i = 0; i < p_animations.size(); i++) {
+		ERR_FAIL_COND_V_MSG(!player->has_animation(p_animations[i]), ERR_INVALID_PARAMETER, "AnimationPlayer has no animation named '" + p_animations[i] + "'.");
+		Ref<Animation> animation = player->get_animation(p_animations[i]);
+
+		Clip clip;
+		clip.name = p_animations[i];
+		clip.frame_offset = total_frames;
+		clip.frame_count = MAX(1, int(Math::ceil(animation->get_length() * p_fps)));
+		total_frames += clip.frame_count;
+		new_clips.push_back(clip);
+	}
+
+	int64_t texel_count = int64_t(total_frames) * total_vertices;
+	ERR_FAIL_COND_V_MSG(texel_count > int64_t(TEXTURE_WIDTH) * TEXTURE_MAX_HEIGHT, ERR_OUT_OF_MEMORY, "Too many frames or vertices to bake, reduce the FPS or the amount of animations.");
+	int width = MIN(int(texel_count), int(TEXTURE_WIDTH));
+	int height = int((texel_count + width - 1) / width);
+
+	Vector<uint8_t> position_data;
+	position_data.resize(width * height * 4 * sizeof(float));
+	zeromem(position_data.ptrw(), position_data.size());
+	Vector<uint8_t> normal_data = position_data;
+	float *positions = (float *)position_data.ptrw();
+	float *normals = (float *)normal_data.ptrw();
+
+	String previous_animation = player->get_assigned_animation();
+	if (player->is_playing()) {
+		player->stop(false);
+	}
+
+	Vector<Transform> bind_transforms;
+	bind_transforms.resize(bind_count);
+	AABB aabb;
+	bool first_vertex = true;
+
+	for (int c = 0; c < new_clips.size(); c++) {
+		player->set_assigned_animation(new_clips[c].name);
+
+		for (int f = 0; f < new_clips[c].frame_count; f++) {
+			player->seek(f / p_fps, true);
+
+			for (int i = 0; i < bind_count; i++) {
+				bind_transforms.write[i] = bind_bones[i] >= 0 ? skeleton->get_bone_global_pose(bind_bones[i]) * skin->get_bind_pose(i) : Transform();
+			}
+
+			int frame = new_clips[c].frame_offset + f;
+			for (int s = 0; s < surfaces.size(); s++) {
+				const SurfaceData &sd = surfaces[s];
+				int count = sd.vertices.size();
+				bool skinned = sd.bones.size() >= count * sd.bones_per_vertex && sd.weights.size() >= count * sd.bones_per_vertex;
+
+				for (int v = 0; v < count; v++) {
+					Vector3 vertex = sd.vertices[v];
+					Vector3 normal = v < sd.normals.size() ? sd.normals[v] : Vector3(0, 1, 0);
+
+					if (skinned) {
+						Vector3 skinned_vertex;
+						Vector3 skinned_normal;
+						for (int k = 0; k < sd.bones_per_vertex; k++) {
+							float weight = sd.weights[v * sd.bones_per_vertex + k];
+							int bind = sd.bones[v * sd.bones_per_vertex + k];
+							if (weight == 0.0 || bind < 0 || bind >= bind_count) {
+								continue;
+							}
+							skinned_vertex += bind_transforms[bind].xform(vertex) * weight;
+							skinned_normal += bind_transforms[bind].basis.xform(normal) * weight;
+						}
+						vertex = skinned_vertex;
+						normal = skinned_normal.normalized();
+					}
+
+					if (first_vertex) {
+						aabb.position = vertex;
+						first_vertex = false;
+					} else {
+						aabb.expand_to(vertex);
+					}
+
+					int ofs = (frame * total_vertices + sd.vertex_base + v) * 4;
+					positions[ofs + 0] = vertex.x;
+					positions[ofs + 1] = vertex.y;
+					positions[ofs + 2] = vertex.z;
+					positions[ofs + 3] = 1.0;
+					normals[ofs + 0] = normal.x;
+					normals[ofs + 1] = normal.y;
+					normals[ofs + 2] = normal.z;
+					normals[ofs + 3] = 0.0;
+				}
+			}
+		}
+	}
+
+	if (previous_animation != String()) {
+		player->set_assigned_animation(previous_animation);
+		player->seek(0, true);
+	}
+
+	// The baked mesh carries no skinning data, UV2.x holds the vertex index into the textures.
+	Ref<ArrayMesh> baked_mesh;
+	baked_mesh.instance();
+	for (int s = 0; s < surfaces.size(); s++) {
+		Array arrays = surfaces[s].arrays;
+		arrays[Mesh::ARRAY_BONES] = Variant();
+		arrays[Mesh::ARRAY_WEIGHTS] = Variant();
+
+		Vector<Vector2> uv2;
+		uv2.resize(surfaces[s].vertices.size());
+		for (int v = 0; v < uv2.size(); v++) {
+			uv2.write[v] = Vector2(surfaces[s].vertex_base + v, 0);
+		}
+		arrays[Mesh::ARRAY_TEX_UV2] = uv2;
+
+		baked_mesh->add_surface_from_arrays(source->surface_get_primitive_type(s), arrays);
+		baked_mesh->surface_set_material(s, source->surface_get_material(s));
+	}
+	baked_mesh->set_custom_aabb(aabb);
+
+	Ref<Image> position_image;
+	position_image.instance();
+	position_image->create(width, height, false, Image::FORMAT_RGBAF, position_data);
+	position_texture.instance();
+	position_texture->create_from_image(position_image);
+
+	Ref<Image> normal_image;
+	normal_image.instance();
+	normal_image->create(width, height, false, Image::FORMAT_RGBAF, normal_data);
+	normal_texture.instance();
+	normal_texture->create_from_image(normal_image);
+
+	mesh = baked_mesh;
+	clips = new_clips;
+	vertex_count = total_vertices;
+	fps = p_fps;
+
+	notify_property_list_changed();
+	emit_changed();
+
+	return OK;
+}
+
+void VertexAnimation::set_mesh(const Ref<ArrayMesh> &p_mesh) {
+	mesh = p_mesh;
+	emit_changed();
+}
+
+Ref<ArrayMesh> VertexAnimation::get_mesh() const {
+	return mesh;
+}
+
+void VertexAnimation::set_position_texture(const Ref<ImageTexture> &p_texture) {
+	position_texture = p_texture;
+	emit_changed();
+}
+
+Ref<ImageTexture> VertexAnimation::get_position_texture() const {
+	return position_texture;
+}
+
+void VertexAnimation::set_normal_texture(const Ref<ImageTexture> &p_texture) {
+	normal_texture = p_texture;
+	emit_changed();
+}
+
+Ref<ImageTexture> VertexAnimation::get_normal_texture() const {
+	return normal_texture;
+}
+
+void VertexAnimation::set_vertex_count(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	vertex_count = p_count;
+	emit_changed();
+}
+
+int VertexAnimation::get_vertex_count() const {
+	return vertex_count;
+}
+
+void VertexAnimation::set_fps(float p_fps) {
+	ERR_FAIL_COND(p_fps <= 0.0);
+	fps = p_fps;
+	emit_changed();
+}
+
+float VertexAnimation::get_fps() const {
+	return fps;
+}
+
+void VertexAnimation::set_clip_count(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	clips.resize(p_count);
+	notify_property_list_changed();
+	emit_changed();
+}
+
+int VertexAnimation::get_clip_count() const {
+	return clips.size();
+}
+
+int VertexAnimation::find_clip(const StringName &p_name) const {
+	for (int i = 0; i < clips.size(); i++) {
+		if (clips[i].name == p_name) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+StringName VertexAnimation::get_clip_name(int p_clip) const {
+	ERR_FAIL_INDEX_V(p_clip, clips.size(), StringName());
+	return clips[p_clip].name;
+}
+
+int VertexAnimation::get_clip_frame_offset(int p_clip) const {
+	ERR_FAIL_INDEX_V(p_clip, clips.size(), 0);
+	return clips[p_clip].frame_offset;
+}
+
+int VertexAnimation::get_clip_frame_count(int p_clip) const {
+	ERR_FAIL_INDEX_V(p_clip, clips.size(), 0);
+	return clips[p_clip].frame_count;
+}
+
+Color VertexAnimation::get_instance_custom_data(int p_clip, float p_time_offset, float p_speed) const {
+	ERR_FAIL_INDEX_V(p_clip, clips.size(), Color());
+	return Color(clips[p_clip].frame_offset, clips[p_clip].frame_count, p_time_offset, p_speed);
+}
+
+String VertexAnimation::get_shader_code() {
+	String code = "shader_type spatial;\n\n";
+	code += "uniform sampler2D position_texture;\n";
+	code += "uniform sampler2D normal_texture;\n";
+	code += "uniform int vertex_count;\n";
+	code += "uniform float fps = 30.0;\n\n";
+
+	code += "ivec2 vertex_animation_texel(int p_index) {\n";
+	code += "\treturn ivec2(p_index % " + itos(TEXTURE_WIDTH) + ", p_index / " + itos(TEXTURE_WIDTH) + ");\n";
+	code += "}\n\n";
+
+	code += "void vertex() {\n";
+	code += "\t// INSTANCE_CUSTOM holds the first frame of the clip, its frame count, a time offset and the playback speed.\n";
+	code += "\tfloat frame_count = max(INSTANCE_CUSTOM.y, 1.0);\n";
+	code += "\tfloat frame = mod((TIME * INSTANCE_CUSTOM.w + INSTANCE_CUSTOM.z) * fps, frame_count);\n";
+	code += "\tint frame_a = int(floor(frame));\n";
+	code += "\tint frame_b = int(mod(float(frame_a + 1), frame_count));\n";
+	code += "\tfloat blend = fract(frame);\n";
+	code += "\tint clip_offset = int(INSTANCE_CUSTOM.x);\n";
+	code += "\tint index_a = (clip_offset + frame_a) * vertex_count + int(UV2.x);\n";
+	code += "\tint index_b = (clip_offset + frame_b) * vertex_count + int(UV2.x);\n";
+	code += "\tVERTEX = mix(texelFetch(position_texture, vertex_animation_texel(index_a), 0).xyz, texelFetch(position_texture, vertex_animation_texel(index_b), 0).xyz, blend);\n";
+	code += "\tNORMAL = normalize(mix(texelFetch(normal_texture, vertex_animation_texel(index_a), 0).xyz, texelFetch(normal_texture, vertex_animation_texel(index_b), 0).xyz, blend));\n";
+	code += "}\n";
+
+	return code;
+}
+
+Ref<ShaderMaterial> VertexAnimation::create_material() const {
+	Ref<Shader> shader;
+	shader.instance();
+	shader->set_code(get_shader_code());
+
+	Ref<ShaderMaterial> material;
+	material.instance();
+	material->set_shader(shader);
+	material->set_shader_param("position_texture", position_texture);
+	material->set_shader_param("normal_texture", normal_texture);
+	material->set_shader_param("vertex_count", vertex_count);
+	material->set_shader_param("fps", fps);
+
+	return material;
+}
+
+void VertexAnimation::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("bake", "mesh_instance", "animation_player", "animations", "fps"), &VertexAnimation::bake, DEFVAL(30.0));
+
+	ClassDB::bind_method(D_METHOD("set_mesh", "mesh"), &VertexAnimation::set_mesh);
+	ClassDB::bind_method(D_METHOD("get_mesh"), &VertexAnimation::get_mesh);
+
+	ClassDB::bind_method(D_METHOD("set_position_texture", "texture"), &VertexAnimation::set_position_texture);
+	ClassDB::bind_method(D_METHOD("get_position_texture"), &VertexAnimation::get_position_texture);
+
+	ClassDB::bind_method(D_METHOD("set_normal_texture", "texture"), &VertexAnimation::set_normal_texture);
+	ClassDB::bind_method(D_METHOD("get_normal_texture"), &VertexAnimation::get_normal_texture);
+
+	ClassDB::bind_method(D_METHOD("set_vertex_count", "count"), &VertexAnimation::set_vertex_count);
+	ClassDB::bind_method(D_METHOD("get_vertex_count"), &VertexAnimation::get_vertex_count);
+
+	ClassDB::bind_method(D_METHOD("set_fps", "fps"), &VertexAnimation::set_fps);
+	ClassDB::bind_method(D_METHOD("get_fps"), &VertexAnimation::get_fps);
+
+	ClassDB::bind_method(D_METHOD("set_clip_count", "count"), &VertexAnimation::set_clip_count);
+	ClassDB::bind_method(D_METHOD("get_clip_count"), &VertexAnimation::get_clip_count);
+	ClassDB::bind_method(D_METHOD("find_clip", "name"), &VertexAnimation::find_clip);
+	ClassDB::bind_method(D_METHOD("get_clip_name", "clip"), &VertexAnimation::get_clip_name);
+	ClassDB::bind_method(D_METHOD("get_clip_frame_offset", "clip"), &VertexAnimation::get_clip_frame_offset);
+	ClassDB::bind_method(D_METHOD("get_clip_frame_count", "clip"), &VertexAnimation::get_clip_frame_count);
+
+	ClassDB::bind_method(D_METHOD("get_instance_custom_data", "clip", "time_offset", "speed"), &VertexAnimation::get_instance_custom_data, DEFVAL(0.0), DEFVAL(1.0));
+	ClassDB::bind_method(D_METHOD("create_material"), &VertexAnimation::create_material);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "mesh", PROPERTY_HINT_RESOURCE_TYPE, "ArrayMesh"), "set_mesh", "get_mesh");
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "position_texture", PROPERTY_HINT_RESOURCE_TYPE, "ImageTexture"), "set_position_texture", "get_position_texture");
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "normal_texture", PROPERTY_HINT_RESOURCE_TYPE, "ImageTexture"), "set_normal_texture", "get_normal_texture");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "vertex_count", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"), "set_vertex_count", "get_vertex_count");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fps", PROPERTY_HINT_RANGE, "1,120,0.1,or_greater"), "set_fps", "get_fps");
+}
@@ -0,0 +1,102 @@
+/*************************************************************************/
+/*  vertex_animation.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef VERTEX_ANIMATION_H
+#define VERTEX_ANIMATION_H
+
+#include "core/io/resource.h"
+#include "scene/resources/material.h"
+#include "scene/resources/mesh.h"
+#include "scene/resources/texture.h"
+
+// Skinned animations baked into textures, so large crowds can be drawn with
+// a single MultiMesh and no per-character Skeleton3D or AnimationPlayer.
+class VertexAnimation : public Resource {
+	GDCLASS(VertexAnimation, Resource);
+	RES_BASE_EXTENSION("vtxanim");
+
+	struct Clip {
+		StringName name;
+		int frame_offset = 0;
+		int frame_count = 0;
+	};
+
+	Vector<Clip> clips;
+
+	Ref<ArrayMesh> mesh;
+	Ref<ImageTexture> position_texture;
+	Ref<ImageTexture> normal_texture;
+	int vertex_count = 0;
+	float fps = 30.0;
+
+protected:
+	bool _set(const StringName &p_name, const Variant &p_value);
+	bool _get(const StringName &p_name, Variant &r_ret) const;
+	void _get_property_list(List<PropertyInfo> *p_list) const;
+
+	static void _bind_methods();
+
+public:
+	enum {
+		TEXTURE_WIDTH = 4096,
+		TEXTURE_MAX_HEIGHT = 16384,
+	};
+
+	Error bake(Node *p_mesh_instance, Node *p_animation_player, const Vector<String> &p_animations, float p_fps = 30.0);
+
+	void set_mesh(const Ref<ArrayMesh> &p_mesh);
+	Ref<ArrayMesh> get_mesh() const;
+
+	void set_position_texture(const Ref<ImageTexture> &p_texture);
+	Ref<ImageTexture> get_position_texture() const;
+
+	void set_normal_texture(const Ref<ImageTexture> &p_texture);
+	Ref<ImageTexture> get_normal_texture() const;
+
+	void set_vertex_count(int p_count);
+	int get_vertex_count() const;
+
+	void set_fps(float p_fps);
+	float get_fps() const;
+
+	void set_clip_count(int p_count);
+	int get_clip_count() const;
+	int find_clip(const StringName &p_name) const;
+	StringName get_clip_name(int p_clip) const;
+	int get_clip_frame_offset(int p_clip) const;
+	int get_clip_frame_count(int p_clip) const;
+
+	Color get_instance_custom_data(int p_clip, float p_time_offset = 0.0, float p_speed = 1.0) const;
+
+	static String get_shader_code();
+	Ref<ShaderMaterial> create_material() const;
+};
+
+#endif // VERTEX_ANIMATION_H
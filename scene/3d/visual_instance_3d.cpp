@@ -57,6 +57,8 @@ void VisualInstance3D::_notification(int p_what) {
 			*/
 			ERR_FAIL_COND(get_world_3d().is_null());
 			RenderingServer::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
+			RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+			RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
 			_update_visibility();
 
 		} break;
@@ -73,6 +75,10 @@ void VisualInstance3D::_notification(int p_what) {
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			_update_visibility();
 		} break;
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+			RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
+		} break;
 	}
 }
 
@@ -93,6 +99,15 @@ uint32_t VisualInstance3D::get_layer_mask() const {
 	return layers;
 }
 
+void VisualInstance3D::set_physics_interpolated(bool p_interpolated) {
+	physics_interpolated = p_interpolated;
+	RenderingServer::get_singleton()->instance_set_interpolated(instance, p_interpolated);
+}
+
+bool VisualInstance3D::is_physics_interpolated() const {
+	return physics_interpolated;
+}
+
 void VisualInstance3D::set_layer_mask_bit(int p_layer, bool p_enable) {
 	ERR_FAIL_INDEX(p_layer, 32);
 	if (p_enable) {
@@ -116,10 +131,13 @@ void VisualInstance3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_layer_mask"), &VisualInstance3D::get_layer_mask);
 	ClassDB::bind_method(D_METHOD("set_layer_mask_bit", "layer", "enabled"), &VisualInstance3D::set_layer_mask_bit);
 	ClassDB::bind_method(D_METHOD("get_layer_mask_bit", "layer"), &VisualInstance3D::get_layer_mask_bit);
+	ClassDB::bind_method(D_METHOD("set_physics_interpolated", "interpolated"), &VisualInstance3D::set_physics_interpolated);
+	ClassDB::bind_method(D_METHOD("is_physics_interpolated"), &VisualInstance3D::is_physics_interpolated);
 
 	ClassDB::bind_method(D_METHOD("get_transformed_aabb"), &VisualInstance3D::get_transformed_aabb);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "layers", PROPERTY_HINT_LAYERS_3D_RENDER), "set_layer_mask", "get_layer_mask");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "physics_interpolated"), "set_physics_interpolated", "is_physics_interpolated");
 }
 
 void VisualInstance3D::set_base(const RID &p_base) {
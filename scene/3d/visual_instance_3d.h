@@ -43,6 +43,7 @@ class VisualInstance3D : public Node3D {
 	RID base;
 	RID instance;
 	uint32_t layers = 1;
+	bool physics_interpolated = true;
 
 	RID _get_visual_instance_rid() const;
 
@@ -75,6 +76,9 @@ public:
 	void set_layer_mask_bit(int p_layer, bool p_enable);
 	bool get_layer_mask_bit(int p_layer) const;
 
+	void set_physics_interpolated(bool p_interpolated);
+	bool is_physics_interpolated() const;
+
 	VisualInstance3D();
 	~VisualInstance3D();
 };
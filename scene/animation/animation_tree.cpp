@@ -687,10 +687,16 @@ bool AnimationTree::_update_caches(AnimationPlayer *player) {
 	}
 
 	state.track_map.clear();
+	track_cache_list.clear();
+	animation_bindings.clear();
 
 	K = nullptr;
 	int idx = 0;
 	while ((K = track_cache.next(K))) {
+		TrackCache *tc = track_cache[*K];
+		tc->blend_idx = idx;
+		tc->root_motion = root_motion_track == *K;
+		track_cache_list.push_back(tc);
 		state.track_map[*K] = idx;
 		idx++;
 	}
@@ -710,9 +716,36 @@ void AnimationTree::_clear_caches() {
 	playing_caches.clear();
 
 	track_cache.clear();
+	track_cache_list.clear();
+	animation_bindings.clear();
 	cache_valid = false;
 }
 
+const AnimationTree::AnimationTrackBinding &AnimationTree::_get_animation_binding(const Ref<Animation> &p_animation) {
+	AnimationTrackBinding &binding = animation_bindings[p_animation->get_instance_id()];
+
+	// Paths are shared with the animation while it's not edited, so this
+	// check is mostly pointer comparisons.
+	int track_count = p_animation->get_track_count();
+	bool valid = int(binding.tracks.size()) == track_count;
+	for (int i = 0; valid && i < track_count; i++) {
+		valid = binding.paths[i] == p_animation->track_get_path(i);
+	}
+
+	if (!valid) {
+		binding.paths.resize(track_count);
+		binding.tracks.resize(track_count);
+		for (int i = 0; i < track_count; i++) {
+			NodePath path = p_animation->track_get_path(i);
+			TrackCache **tc = track_cache.getptr(path);
+			binding.paths.write[i] = path;
+			binding.tracks[i] = tc ? *tc : nullptr;
+		}
+	}
+
+	return binding;
+}
+
 void AnimationTree::_process_graph(float p_delta) {
 	_update_properties(); //if properties need updating, update them
 
@@ -820,20 +853,17 @@ void AnimationTree::_process_graph(float p_delta) {
 			float weight = as.blend;
 			bool seeked = as.seeked;
 
-			for (int i = 0; i < a->get_track_count(); i++) {
-				NodePath path = a->track_get_path(i);
+			const AnimationTrackBinding &binding = _get_animation_binding(a);
 
-				ERR_CONTINUE(!track_cache.has(path));
+			for (int i = 0; i < a->get_track_count(); i++) {
+				TrackCache *track = binding.tracks[i];
+				ERR_CONTINUE(!track);
 
-				TrackCache *track = track_cache[path];
 				if (track->type != a->track_get_type(i)) {
 					continue; //may happen should not
 				}
 
-				track->root_motion = root_motion_track == path;
-
-				ERR_CONTINUE(!state.track_map.has(path));
-				int blend_idx = state.track_map[path];
+				int blend_idx = track->blend_idx;
 
 				ERR_CONTINUE(blend_idx < 0 || blend_idx >= state.track_count);
 
@@ -1180,9 +1210,8 @@ void AnimationTree::_process_graph(float p_delta) {
 
 	{
 		// finally, set the tracks
-		const NodePath *K = nullptr;
-		while ((K = track_cache.next(K))) {
-			TrackCache *track = track_cache[*K];
+		for (uint32_t i = 0; i < track_cache_list.size(); i++) {
+			TrackCache *track = track_cache_list[i];
 			if (track->process_pass != process_pass) {
 				continue; //not processed, ignore
 			}
@@ -1317,6 +1346,11 @@ String AnimationTree::get_configuration_warning() const {
 
 void AnimationTree::set_root_motion_track(const NodePath &p_track) {
 	root_motion_track = p_track;
+
+	const NodePath *K = nullptr;
+	while ((K = track_cache.next(K))) {
+		track_cache[*K]->root_motion = root_motion_track == *K;
+	}
 }
 
 NodePath AnimationTree::get_root_motion_track() const {
@@ -174,6 +174,7 @@ private:
 		bool root_motion = false;
 		uint64_t setup_pass = 0;
 		uint64_t process_pass = 0;
+		int blend_idx = -1; // Index in the track blends of the animation nodes.
 		Animation::TrackType type = Animation::TrackType::TYPE_ANIMATION;
 		Object *object = nullptr;
 		ObjectID object_id;
@@ -234,8 +235,20 @@ private:
 	};
 
 	HashMap<NodePath, TrackCache *> track_cache;
+	LocalVector<TrackCache *> track_cache_list;
 	Set<TrackCache *> playing_caches;
 
+	// The track cache each track of an animation resolves to, so paths are
+	// not looked up for every track on every frame. Rebuilt when the tracks
+	// of the animation or the caches change.
+	struct AnimationTrackBinding {
+		Vector<NodePath> paths;
+		LocalVector<TrackCache *> tracks;
+	};
+
+	Map<ObjectID, AnimationTrackBinding> animation_bindings;
+	const AnimationTrackBinding &_get_animation_binding(const Ref<Animation> &p_animation);
+
 	Ref<AnimationNode> root;
 
 	AnimationProcessMode process_mode = ANIMATION_PROCESS_IDLE;
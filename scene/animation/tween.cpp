@@ -663,6 +663,176 @@ bool Tween::_apply_tween_value(InterpolateData &p_data, Variant &value) {
 	return true;
 }
 
+static int _get_value_components(const Variant &p_value, real_t *r_components) {
+	switch (p_value.get_type()) {
+		case Variant::FLOAT: {
+			r_components[0] = p_value;
+			return 1;
+		}
+		case Variant::VECTOR2: {
+			Vector2 v = p_value;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			return 2;
+		}
+		case Variant::RECT2: {
+			Rect2 r = p_value;
+			r_components[0] = r.position.x;
+			r_components[1] = r.position.y;
+			r_components[2] = r.size.x;
+			r_components[3] = r.size.y;
+			return 4;
+		}
+		case Variant::VECTOR3: {
+			Vector3 v = p_value;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			r_components[2] = v.z;
+			return 3;
+		}
+		case Variant::TRANSFORM2D: {
+			Transform2D t = p_value;
+			for (int i = 0; i < 3; i++) {
+				r_components[i * 2 + 0] = t.elements[i].x;
+				r_components[i * 2 + 1] = t.elements[i].y;
+			}
+			return 6;
+		}
+		case Variant::QUAT: {
+			Quat q = p_value;
+			r_components[0] = q.x;
+			r_components[1] = q.y;
+			r_components[2] = q.z;
+			r_components[3] = q.w;
+			return 4;
+		}
+		case Variant::AABB: {
+			AABB a = p_value;
+			for (int i = 0; i < 3; i++) {
+				r_components[i] = a.position[i];
+				r_components[i + 3] = a.size[i];
+			}
+			return 6;
+		}
+		case Variant::BASIS: {
+			Basis b = p_value;
+			for (int i = 0; i < 9; i++) {
+				r_components[i] = b.elements[i / 3][i % 3];
+			}
+			return 9;
+		}
+		case Variant::TRANSFORM: {
+			Transform t = p_value;
+			for (int i = 0; i < 9; i++) {
+				r_components[i] = t.basis.elements[i / 3][i % 3];
+			}
+			for (int i = 0; i < 3; i++) {
+				r_components[i + 9] = t.origin[i];
+			}
+			return 12;
+		}
+		case Variant::COLOR: {
+			Color c = p_value;
+			r_components[0] = c.r;
+			r_components[1] = c.g;
+			r_components[2] = c.b;
+			r_components[3] = c.a;
+			return 4;
+		}
+		default: {
+			return 0;
+		}
+	}
+}
+
+void Tween::_compile_interpolate_data(InterpolateData &p_data, Object *p_object) {
+	p_data.components = _get_value_components(p_data.initial_val, p_data.initial_components);
+	if (p_data.components == 0 || _get_value_components(p_data.delta_val, p_data.delta_components) != p_data.components) {
+		p_data.components = 0;
+		return;
+	}
+
+	// Setters and methods are only called directly when they take exactly the interpolated type.
+	// Anything else, like nested properties, keeps going through the object with a Variant.
+	MethodBind *method = nullptr;
+	int index = -1;
+	if (p_data.type == INTER_PROPERTY) {
+		if (p_data.key.size() == 1) {
+			method = ClassDB::get_property_setter_method(p_object->get_class_name(), p_data.key[0], &index);
+		}
+	} else {
+		method = ClassDB::get_method(p_object->get_class_name(), p_data.key[0]);
+	}
+
+	int argument_count = index >= 0 ? 2 : 1;
+	if (method && !method->is_vararg() && !method->has_return() && method->get_argument_count() == argument_count && method->get_argument_type(argument_count - 1) == p_data.initial_val.get_type()) {
+		p_data.setter = method;
+		p_data.setter_index = index;
+	}
+}
+
+template <class T>
+void Tween::_apply_compiled(InterpolateData &p_data, Object *p_object, const T &p_value, Variant *r_value) {
+	if (r_value) {
+		*r_value = p_value;
+	}
+
+	// Scripts can override both properties and methods, so they take the regular path.
+	if (!p_data.setter || p_object->get_script_instance()) {
+		Variant value = p_value;
+		_apply_tween_value(p_data, value);
+		return;
+	}
+
+	if (p_data.setter_index >= 0) {
+		int64_t index = p_data.setter_index;
+		const void *args[2] = { &index, &p_value };
+		p_data.setter->ptrcall(p_object, args, nullptr);
+	} else {
+		const void *args[1] = { &p_value };
+		p_data.setter->ptrcall(p_object, args, nullptr);
+	}
+}
+
+void Tween::_apply_compiled_value(InterpolateData &p_data, Object *p_object, const real_t *p_components, Variant *r_value) {
+	const real_t *c = p_components;
+	switch (p_data.initial_val.get_type()) {
+		case Variant::FLOAT: {
+			// Float arguments are passed as doubles.
+			_apply_compiled(p_data, p_object, double(c[0]), r_value);
+		} break;
+		case Variant::VECTOR2: {
+			_apply_compiled(p_data, p_object, Vector2(c[0], c[1]), r_value);
+		} break;
+		case Variant::RECT2: {
+			_apply_compiled(p_data, p_object, Rect2(c[0], c[1], c[2], c[3]), r_value);
+		} break;
+		case Variant::VECTOR3: {
+			_apply_compiled(p_data, p_object, Vector3(c[0], c[1], c[2]), r_value);
+		} break;
+		case Variant::TRANSFORM2D: {
+			_apply_compiled(p_data, p_object, Transform2D(c[0], c[1], c[2], c[3], c[4], c[5]), r_value);
+		} break;
+		case Variant::QUAT: {
+			_apply_compiled(p_data, p_object, Quat(c[0], c[1], c[2], c[3]), r_value);
+		} break;
+		case Variant::AABB: {
+			_apply_compiled(p_data, p_object, AABB(Vector3(c[0], c[1], c[2]), Vector3(c[3], c[4], c[5])), r_value);
+		} break;
+		case Variant::BASIS: {
+			_apply_compiled(p_data, p_object, Basis(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8]), r_value);
+		} break;
+		case Variant::TRANSFORM: {
+			_apply_compiled(p_data, p_object, Transform(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8], c[9], c[10], c[11]), r_value);
+		} break;
+		case Variant::COLOR: {
+			_apply_compiled(p_data, p_object, Color(c[0], c[1], c[2], c[3]), r_value);
+		} break;
+		default: {
+		}
+	}
+}
+
 void Tween::_tween_process(float p_delta) {
 	// Process all of the pending commands
 	_process_pending_commands();
@@ -728,7 +898,7 @@ void Tween::_tween_process(float p_delta) {
 		} else if (prev_delaying) {
 			// We can apply the tween's value to the data and emit that the tween has started
 			_apply_tween_value(data, data.initial_val);
-			emit_signal("tween_started", object, NodePath(Vector<StringName>(), data.key, false));
+			emit_signal("tween_started", object, data.path);
 		}
 
 		// Are we at the end of the tween?
@@ -778,13 +948,29 @@ void Tween::_tween_process(float p_delta) {
 					object->call(data.key[0], (const Variant **)arg, data.args, error);
 				}
 			}
+		} else if (data.components > 0) {
+			// The easing equations are linear in the initial and delta values, so one weight serves every component
+			real_t weight = _run_equation(data.trans_type, data.ease_type, data.elapsed - data.delay, 0.0, 1.0, data.duration);
+			real_t components[12];
+			for (int i = 0; i < data.components; i++) {
+				components[i] = data.initial_components[i] + data.delta_components[i] * weight;
+			}
+
+			// Only build the resulting Variant when someone listens to the steps
+			if (has_connections("tween_step")) {
+				Variant result;
+				_apply_compiled_value(data, object, components, &result);
+				emit_signal("tween_step", object, data.path, data.elapsed, result);
+			} else {
+				_apply_compiled_value(data, object, components, nullptr);
+			}
 		} else {
 			// We can apply the value directly
 			Variant result = _run_equation(data);
 			_apply_tween_value(data, result);
 
 			// Emit that the tween has taken a step
-			emit_signal("tween_step", object, NodePath(Vector<StringName>(), data.key, false), data.elapsed, result);
+			emit_signal("tween_step", object, data.path, data.elapsed, result);
 		}
 
 		// Is the tween now finished?
@@ -795,7 +981,7 @@ void Tween::_tween_process(float p_delta) {
 
 			// Mark the tween as completed and emit the signal
 			data.elapsed = 0;
-			emit_signal("tween_completed", object, NodePath(Vector<StringName>(), data.key, false));
+			emit_signal("tween_completed", object, data.path);
 
 			// If we are not repeating the tween, remove it
 			if (!repeat) {
@@ -1038,6 +1224,14 @@ void Tween::_remove_by_uid(int uid) {
 void Tween::_push_interpolate_data(InterpolateData &p_data) {
 	pending_update++;
 
+	p_data.path = NodePath(Vector<StringName>(), p_data.key, false);
+	if (p_data.type == INTER_PROPERTY || p_data.type == INTER_METHOD) {
+		Object *object = ObjectDB::get_instance(p_data.id);
+		if (object) {
+			_compile_interpolate_data(p_data, object);
+		}
+	}
+
 	// Add the new interpolation
 	p_data.uid = ++uid;
 	interpolates.push_back(p_data);
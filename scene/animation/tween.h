@@ -99,6 +99,15 @@ private:
 		int args = 0;
 		Variant arg[5];
 		int uid = 0;
+		NodePath path; // The key, as passed to the signals.
+
+		// Interpolations between fixed values of real_t based types are compiled: values are kept as components
+		// that share one eased weight, and native setters and methods are called without going through Variants.
+		int components = 0;
+		real_t initial_components[12];
+		real_t delta_components[12];
+		MethodBind *setter = nullptr;
+		int setter_index = -1;
 	};
 
 	String autoplay;
@@ -130,6 +139,10 @@ private:
 	Variant _run_equation(InterpolateData &p_data);
 	bool _calc_delta_val(const Variant &p_initial_val, const Variant &p_final_val, Variant &p_delta_val);
 	bool _apply_tween_value(InterpolateData &p_data, Variant &value);
+	void _compile_interpolate_data(InterpolateData &p_data, Object *p_object);
+	void _apply_compiled_value(InterpolateData &p_data, Object *p_object, const real_t *p_components, Variant *r_value);
+	template <class T>
+	void _apply_compiled(InterpolateData &p_data, Object *p_object, const T &p_value, Variant *r_value);
 
 	void _tween_process(float p_delta);
 	void _remove_by_uid(int uid);
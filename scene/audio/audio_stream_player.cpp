@@ -31,9 +31,10 @@
 #include "audio_stream_player.h"
 
 #include "core/config/engine.h"
+#include "servers/audio/audio_mix_kernels.h"
 
 void AudioStreamPlayer::_mix_to_bus(const AudioFrame *p_frames, int p_amount) {
-	int bus_index = AudioServer::get_singleton()->thread_find_bus_index(bus);
+	int bus_index = AudioServer::get_singleton()->thread_find_bus_index(mix_bus);
 
 	AudioFrame *targets[4] = { nullptr, nullptr, nullptr, nullptr };
 
@@ -59,9 +60,7 @@ void AudioStreamPlayer::_mix_to_bus(const AudioFrame *p_frames, int p_amount) {
 		if (!targets[c]) {
 			break;
 		}
-		for (int i = 0; i < p_amount; i++) {
-			targets[c][i] += p_frames[i];
-		}
+		AudioMixKernels::mix(targets[c], p_frames, p_amount, AudioFrame(1.0, 1.0));
 	}
 }
 
@@ -82,10 +81,7 @@ void AudioStreamPlayer::_mix_internal(bool p_fadeout) {
 	float vol = Math::db2linear(mix_volume_db);
 	float vol_inc = (Math::db2linear(target_volume) - vol) / float(buffer_size);
 
-	for (int i = 0; i < buffer_size; i++) {
-		buffer[i] *= vol;
-		vol += vol_inc;
-	}
+	AudioMixKernels::scale_ramp(buffer, buffer_size, vol, vol_inc);
 
 	//set volume for next mix
 	mix_volume_db = target_volume;
@@ -136,6 +132,7 @@ void AudioStreamPlayer::_mix_audio() {
 
 void AudioStreamPlayer::_notification(int p_what) {
 	if (p_what == NOTIFICATION_ENTER_TREE) {
+		mix_bus = bus;
 		AudioServer::get_singleton()->add_callback(_mix_audios, this);
 		if (autoplay && !Engine::get_singleton()->is_editor_hint()) {
 			play();
@@ -152,6 +149,7 @@ void AudioStreamPlayer::_notification(int p_what) {
 
 	if (p_what == NOTIFICATION_EXIT_TREE) {
 		AudioServer::get_singleton()->remove_callback(_mix_audios, this);
+		AudioServer::get_singleton()->cancel_commands(this);
 	}
 
 	if (p_what == NOTIFICATION_PAUSED) {
@@ -183,10 +181,7 @@ void AudioStreamPlayer::set_stream(Ref<AudioStream> p_stream) {
 		float vol = Math::db2linear(mix_volume_db);
 		float vol_inc = (Math::db2linear(target_volume) - vol) / float(buffer_size);
 
-		for (int i = 0; i < buffer_size; i++) {
-			buffer[i] *= vol;
-			vol += vol_inc;
-		}
+		AudioMixKernels::scale_ramp(buffer, buffer_size, vol, vol_inc);
 
 		use_fadeout = true;
 	}
@@ -277,10 +272,11 @@ float AudioStreamPlayer::get_playback_position() {
 }
 
 void AudioStreamPlayer::set_bus(const StringName &p_bus) {
-	//if audio is active, must lock this
-	AudioServer::get_singleton()->lock();
 	bus = p_bus;
-	AudioServer::get_singleton()->unlock();
+	if (is_inside_tree()) {
+		// Being mixed, let the audio thread pick it up without blocking it.
+		AudioServer::get_singleton()->push_command(_set_mix_bus, this, p_bus);
+	}
 }
 
 StringName AudioStreamPlayer::get_bus() const {
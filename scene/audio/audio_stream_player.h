@@ -63,12 +63,14 @@ private:
 	bool stream_paused = false;
 	bool stream_paused_fade = false;
 	StringName bus;
+	StringName mix_bus; // Copy of bus used by the audio thread.
 
 	MixTarget mix_target = MIX_TARGET_STEREO;
 
 	void _mix_internal(bool p_fadeout);
 	void _mix_audio();
 	static void _mix_audios(void *self) { reinterpret_cast<AudioStreamPlayer *>(self)->_mix_audio(); }
+	static void _set_mix_bus(void *self, const Variant &p_bus) { reinterpret_cast<AudioStreamPlayer *>(self)->mix_bus = p_bus; }
 
 	void _set_playing(bool p_enable);
 	bool _is_active() const;
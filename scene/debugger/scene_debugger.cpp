@@ -70,7 +70,7 @@ Error SceneDebugger::parse_message(void *p_user, const String &p_msg, const Arra
 
 	r_captured = true;
 	if (p_msg == "request_scene_tree") { // Scene tree
-		live_editor->_send_tree();
+		live_editor->_send_tree(p_args.size() > 0 ? uint32_t(p_args[0]) : 0);
 
 	} else if (p_msg == "save_node") { // Save node.
 		ERR_FAIL_COND_V(p_args.size() < 2, ERR_INVALID_DATA);
@@ -79,7 +79,7 @@ Error SceneDebugger::parse_message(void *p_user, const String &p_msg, const Arra
 	} else if (p_msg == "inspect_object") { // Object Inspect
 		ERR_FAIL_COND_V(p_args.size() < 1, ERR_INVALID_DATA);
 		ObjectID id = p_args[0];
-		_send_object_id(id);
+		_send_object_id(id, 1 << 20, p_args.size() > 1 ? uint32_t(p_args[1]) : 0);
 
 	} else if (p_msg == "override_camera_2D:set") { // Camera
 		ERR_FAIL_COND_V(p_args.size() < 1, ERR_INVALID_DATA);
@@ -194,7 +194,7 @@ void SceneDebugger::_save_node(ObjectID id, const String &p_path) {
 	ResourceSaver::save(p_path, ps);
 }
 
-void SceneDebugger::_send_object_id(ObjectID p_id, int p_max_size) {
+void SceneDebugger::_send_object_id(ObjectID p_id, int p_max_size, uint32_t p_known_hash) {
 	SceneDebuggerObject obj(p_id);
 	if (obj.id.is_null()) {
 		return;
@@ -202,6 +202,9 @@ void SceneDebugger::_send_object_id(ObjectID p_id, int p_max_size) {
 
 	Array arr;
 	obj.serialize(arr);
+	if (p_known_hash && arr.hash() == p_known_hash) {
+		return; // The editor already has this state.
+	}
 	EngineDebugger::get_singleton()->send_message("scene:inspect_object", arr);
 }
 
@@ -480,7 +483,7 @@ LiveEditor *LiveEditor::get_singleton() {
 	return singleton;
 }
 
-void LiveEditor::_send_tree() {
+void LiveEditor::_send_tree(uint32_t p_known_hash) {
 	SceneTree *scene_tree = SceneTree::get_singleton();
 	if (!scene_tree) {
 		return;
@@ -490,6 +493,9 @@ void LiveEditor::_send_tree() {
 	// Encoded as a flat list depth fist.
 	SceneDebuggerTree tree(scene_tree->root);
 	tree.serialize(arr);
+	if (p_known_hash && arr.hash() == p_known_hash) {
+		return; // The editor already has this tree, don't make it rebuild the whole view.
+	}
 	EngineDebugger::get_singleton()->send_message("scene:scene_tree", arr);
 }
 
@@ -47,7 +47,7 @@ public:
 private:
 	static void _save_node(ObjectID id, const String &p_path);
 	static void _set_object_property(ObjectID p_id, const String &p_property, const Variant &p_value);
-	static void _send_object_id(ObjectID p_id, int p_max_size = 1 << 20);
+	static void _send_object_id(ObjectID p_id, int p_max_size = 1 << 20, uint32_t p_known_hash = 0);
 
 public:
 	static Error parse_message(void *p_user, const String &p_msg, const Array &p_args, bool &r_captured);
@@ -112,7 +112,7 @@ private:
 	Map<String, Set<Node *>> live_scene_edit_cache;
 	Map<Node *, Map<ObjectID, Node *>> live_edit_remove_list;
 
-	void _send_tree();
+	void _send_tree(uint32_t p_known_hash = 0);
 
 	void _node_path_func(const NodePath &p_path, int p_id);
 	void _res_path_func(const String &p_path, int p_id);
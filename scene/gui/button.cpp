@@ -42,7 +42,7 @@ Size2 Button::get_minimum_size() const {
 	if (!expand_icon) {
 		Ref<Texture2D> _icon;
 		if (icon.is_null() && has_theme_icon("icon")) {
-			_icon = Control::get_theme_icon("icon");
+			_icon = Control::get_theme_icon(SNAME("icon"));
 		} else {
 			_icon = icon;
 		}
@@ -51,12 +51,12 @@ Size2 Button::get_minimum_size() const {
 			minsize.height = MAX(minsize.height, _icon->get_height());
 			minsize.width += _icon->get_width();
 			if (xl_text != "") {
-				minsize.width += get_theme_constant("hseparation");
+				minsize.width += get_theme_constant(SNAME("hseparation"));
 			}
 		}
 	}
 
-	return get_theme_stylebox("normal")->get_minimum_size() + minsize;
+	return get_theme_stylebox(SNAME("normal"))->get_minimum_size() + minsize;
 }
 
 void Button::_set_internal_margin(Side p_side, float p_value) {
@@ -87,43 +87,43 @@ void Button::_notification(int p_what) {
 			Color color;
 			Color color_icon(1, 1, 1, 1);
 
-			Ref<StyleBox> style = get_theme_stylebox("normal");
+			Ref<StyleBox> style = get_theme_stylebox(SNAME("normal"));
 			bool rtl = is_layout_rtl();
 
 			switch (get_draw_mode()) {
 				case DRAW_NORMAL: {
 					if (rtl && has_theme_stylebox("normal_mirrored")) {
-						style = get_theme_stylebox("normal_mirrored");
+						style = get_theme_stylebox(SNAME("normal_mirrored"));
 					} else {
-						style = get_theme_stylebox("normal");
+						style = get_theme_stylebox(SNAME("normal"));
 					}
 
 					if (!flat) {
 						style->draw(ci, Rect2(Point2(0, 0), size));
 					}
-					color = get_theme_color("font_color");
+					color = get_theme_color(SNAME("font_color"));
 					if (has_theme_color("icon_normal_color")) {
-						color_icon = get_theme_color("icon_normal_color");
+						color_icon = get_theme_color(SNAME("icon_normal_color"));
 					}
 				} break;
 				case DRAW_HOVER_PRESSED: {
 					if (has_theme_stylebox("hover_pressed") && has_theme_stylebox_override("hover_pressed")) {
 						if (rtl && has_theme_stylebox("hover_pressed_mirrored")) {
-							style = get_theme_stylebox("hover_pressed_mirrored");
+							style = get_theme_stylebox(SNAME("hover_pressed_mirrored"));
 						} else {
-							style = get_theme_stylebox("hover_pressed");
+							style = get_theme_stylebox(SNAME("hover_pressed"));
 						}
 
 						if (!flat) {
 							style->draw(ci, Rect2(Point2(0, 0), size));
 						}
 						if (has_theme_color("font_hover_pressed_color")) {
-							color = get_theme_color("font_hover_pressed_color");
+							color = get_theme_color(SNAME("font_hover_pressed_color"));
 						} else {
-							color = get_theme_color("font_color");
+							color = get_theme_color(SNAME("font_color"));
 						}
 						if (has_theme_color("icon_hover_pressed_color")) {
-							color_icon = get_theme_color("icon_hover_pressed_color");
+							color_icon = get_theme_color(SNAME("icon_hover_pressed_color"));
 						}
 
 						break;
@@ -132,66 +132,66 @@ void Button::_notification(int p_what) {
 				}
 				case DRAW_PRESSED: {
 					if (rtl && has_theme_stylebox("pressed_mirrored")) {
-						style = get_theme_stylebox("pressed_mirrored");
+						style = get_theme_stylebox(SNAME("pressed_mirrored"));
 					} else {
-						style = get_theme_stylebox("pressed");
+						style = get_theme_stylebox(SNAME("pressed"));
 					}
 
 					if (!flat) {
 						style->draw(ci, Rect2(Point2(0, 0), size));
 					}
 					if (has_theme_color("font_pressed_color")) {
-						color = get_theme_color("font_pressed_color");
+						color = get_theme_color(SNAME("font_pressed_color"));
 					} else {
-						color = get_theme_color("font_color");
+						color = get_theme_color(SNAME("font_color"));
 					}
 					if (has_theme_color("icon_pressed_color")) {
-						color_icon = get_theme_color("icon_pressed_color");
+						color_icon = get_theme_color(SNAME("icon_pressed_color"));
 					}
 
 				} break;
 				case DRAW_HOVER: {
 					if (rtl && has_theme_stylebox("hover_mirrored")) {
-						style = get_theme_stylebox("hover_mirrored");
+						style = get_theme_stylebox(SNAME("hover_mirrored"));
 					} else {
-						style = get_theme_stylebox("hover");
+						style = get_theme_stylebox(SNAME("hover"));
 					}
 
 					if (!flat) {
 						style->draw(ci, Rect2(Point2(0, 0), size));
 					}
-					color = get_theme_color("font_hover_color");
+					color = get_theme_color(SNAME("font_hover_color"));
 					if (has_theme_color("icon_hover_color")) {
-						color_icon = get_theme_color("icon_hover_color");
+						color_icon = get_theme_color(SNAME("icon_hover_color"));
 					}
 
 				} break;
 				case DRAW_DISABLED: {
 					if (rtl && has_theme_stylebox("disabled_mirrored")) {
-						style = get_theme_stylebox("disabled_mirrored");
+						style = get_theme_stylebox(SNAME("disabled_mirrored"));
 					} else {
-						style = get_theme_stylebox("disabled");
+						style = get_theme_stylebox(SNAME("disabled"));
 					}
 
 					if (!flat) {
 						style->draw(ci, Rect2(Point2(0, 0), size));
 					}
-					color = get_theme_color("font_disabled_color");
+					color = get_theme_color(SNAME("font_disabled_color"));
 					if (has_theme_color("icon_disabled_color")) {
-						color_icon = get_theme_color("icon_disabled_color");
+						color_icon = get_theme_color(SNAME("icon_disabled_color"));
 					}
 
 				} break;
 			}
 
 			if (has_focus()) {
-				Ref<StyleBox> style2 = get_theme_stylebox("focus");
+				Ref<StyleBox> style2 = get_theme_stylebox(SNAME("focus"));
 				style2->draw(ci, Rect2(Point2(), size));
 			}
 
 			Ref<Texture2D> _icon;
 			if (icon.is_null() && has_theme_icon("icon")) {
-				_icon = Control::get_theme_icon("icon");
+				_icon = Control::get_theme_icon(SNAME("icon"));
 			} else {
 				_icon = icon;
 			}
@@ -206,17 +206,17 @@ void Button::_notification(int p_what) {
 				float icon_ofs_region = 0.0;
 				if (rtl) {
 					if (_internal_margin[SIDE_RIGHT] > 0) {
-						icon_ofs_region = _internal_margin[SIDE_RIGHT] + get_theme_constant("hseparation");
+						icon_ofs_region = _internal_margin[SIDE_RIGHT] + get_theme_constant(SNAME("hseparation"));
 					}
 				} else {
 					if (_internal_margin[SIDE_LEFT] > 0) {
-						icon_ofs_region = _internal_margin[SIDE_LEFT] + get_theme_constant("hseparation");
+						icon_ofs_region = _internal_margin[SIDE_LEFT] + get_theme_constant(SNAME("hseparation"));
 					}
 				}
 
 				if (expand_icon) {
 					Size2 _size = get_size() - style->get_offset() * 2;
-					_size.width -= get_theme_constant("hseparation") + icon_ofs_region;
+					_size.width -= get_theme_constant(SNAME("hseparation")) + icon_ofs_region;
 					if (!clip_text) {
 						_size.width -= text_buf->get_size().width;
 					}
@@ -242,17 +242,17 @@ void Button::_notification(int p_what) {
 				}
 			}
 
-			Point2 icon_ofs = !_icon.is_null() ? Point2(icon_region.size.width + get_theme_constant("hseparation"), 0) : Point2();
+			Point2 icon_ofs = !_icon.is_null() ? Point2(icon_region.size.width + get_theme_constant(SNAME("hseparation")), 0) : Point2();
 			int text_clip = size.width - style->get_minimum_size().width - icon_ofs.width;
 			text_buf->set_width(clip_text ? text_clip : -1);
 
 			int text_width = clip_text ? MIN(text_clip, text_buf->get_size().x) : text_buf->get_size().x;
 
 			if (_internal_margin[SIDE_LEFT] > 0) {
-				text_clip -= _internal_margin[SIDE_LEFT] + get_theme_constant("hseparation");
+				text_clip -= _internal_margin[SIDE_LEFT] + get_theme_constant(SNAME("hseparation"));
 			}
 			if (_internal_margin[SIDE_RIGHT] > 0) {
-				text_clip -= _internal_margin[SIDE_RIGHT] + get_theme_constant("hseparation");
+				text_clip -= _internal_margin[SIDE_RIGHT] + get_theme_constant(SNAME("hseparation"));
 			}
 
 			Point2 text_ofs = (size - style->get_minimum_size() - icon_ofs - text_buf->get_size() - Point2(_internal_margin[SIDE_RIGHT] - _internal_margin[SIDE_LEFT], 0)) / 2.0;
@@ -261,13 +261,13 @@ void Button::_notification(int p_what) {
 				case ALIGN_LEFT: {
 					if (rtl) {
 						if (_internal_margin[SIDE_RIGHT] > 0) {
-							text_ofs.x = size.x - style->get_margin(SIDE_RIGHT) - text_width - _internal_margin[SIDE_RIGHT] - get_theme_constant("hseparation");
+							text_ofs.x = size.x - style->get_margin(SIDE_RIGHT) - text_width - _internal_margin[SIDE_RIGHT] - get_theme_constant(SNAME("hseparation"));
 						} else {
 							text_ofs.x = size.x - style->get_margin(SIDE_RIGHT) - text_width;
 						}
 					} else {
 						if (_internal_margin[SIDE_LEFT] > 0) {
-							text_ofs.x = style->get_margin(SIDE_LEFT) + icon_ofs.x + _internal_margin[SIDE_LEFT] + get_theme_constant("hseparation");
+							text_ofs.x = style->get_margin(SIDE_LEFT) + icon_ofs.x + _internal_margin[SIDE_LEFT] + get_theme_constant(SNAME("hseparation"));
 						} else {
 							text_ofs.x = style->get_margin(SIDE_LEFT) + icon_ofs.x;
 						}
@@ -284,13 +284,13 @@ void Button::_notification(int p_what) {
 				case ALIGN_RIGHT: {
 					if (rtl) {
 						if (_internal_margin[SIDE_LEFT] > 0) {
-							text_ofs.x = style->get_margin(SIDE_LEFT) + icon_ofs.x + _internal_margin[SIDE_LEFT] + get_theme_constant("hseparation");
+							text_ofs.x = style->get_margin(SIDE_LEFT) + icon_ofs.x + _internal_margin[SIDE_LEFT] + get_theme_constant(SNAME("hseparation"));
 						} else {
 							text_ofs.x = style->get_margin(SIDE_LEFT) + icon_ofs.x;
 						}
 					} else {
 						if (_internal_margin[SIDE_RIGHT] > 0) {
-							text_ofs.x = size.x - style->get_margin(SIDE_RIGHT) - text_width - _internal_margin[SIDE_RIGHT] - get_theme_constant("hseparation");
+							text_ofs.x = size.x - style->get_margin(SIDE_RIGHT) - text_width - _internal_margin[SIDE_RIGHT] - get_theme_constant(SNAME("hseparation"));
 						} else {
 							text_ofs.x = size.x - style->get_margin(SIDE_RIGHT) - text_width;
 						}
@@ -303,8 +303,8 @@ void Button::_notification(int p_what) {
 				text_ofs.x -= icon_ofs.x;
 			}
 
-			Color font_outline_color = get_theme_color("font_outline_color");
-			int outline_size = get_theme_constant("outline_size");
+			Color font_outline_color = get_theme_color(SNAME("font_outline_color"));
+			int outline_size = get_theme_constant(SNAME("outline_size"));
 			if (outline_size > 0 && font_outline_color.a > 0) {
 				text_buf->draw_outline(ci, text_ofs, outline_size, font_outline_color);
 			}
@@ -319,8 +319,8 @@ void Button::_notification(int p_what) {
 }
 
 void Button::_shape() {
-	Ref<Font> font = get_theme_font("font");
-	int font_size = get_theme_font_size("font_size");
+	Ref<Font> font = get_theme_font(SNAME("font"));
+	int font_size = get_theme_font_size(SNAME("font_size"));
 
 	text_buf->clear();
 	if (text_direction == Control::TEXT_DIRECTION_INHERITED) {
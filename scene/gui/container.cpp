@@ -30,8 +30,11 @@
 
 #include "container.h"
 #include "core/object/message_queue.h"
+#include "scene/main/scene_tree.h"
 #include "scene/scene_string_names.h"
 
+LocalVector<ObjectID> Container::sort_queue;
+
 void Container::_child_minsize_changed() {
 	//Size2 ms = get_combined_minimum_size();
 	//if (ms.width > get_size().width || ms.height > get_size().height) {
@@ -87,6 +90,12 @@ void Container::_sort_children() {
 		return;
 	}
 
+	if (!is_visible_in_tree()) {
+		// Sorted again once visible, see NOTIFICATION_VISIBILITY_CHANGED.
+		pending_sort = false;
+		return;
+	}
+
 	notification(NOTIFICATION_SORT_CHILDREN);
 	emit_signal(SceneStringNames::get_singleton()->sort_children);
 	pending_sort = false;
@@ -135,10 +144,39 @@ void Container::queue_sort() {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
+	if (sort_queue.is_empty()) {
+		MessageQueue::get_singleton()->push_native_call(get_tree()->get_instance_id(), &Container::_flush_sort_queue, nullptr, 0, true);
+	}
+	sort_queue.push_back(get_instance_id());
 	pending_sort = true;
 }
 
+void Container::_flush_sort_queue(Object *p_tree, const void *p_data) {
+	LocalVector<SortQueueEntry> entries;
+	entries.resize(sort_queue.size());
+	for (uint32_t i = 0; i < sort_queue.size(); i++) {
+		entries[i].id = sort_queue[i];
+		Node *n = Object::cast_to<Node>(ObjectDB::get_instance(sort_queue[i]));
+		for (; n; n = n->get_parent()) {
+			entries[i].depth++;
+		}
+	}
+	// Containers queued from here on are sorted by the next flush.
+	sort_queue.clear();
+
+	// Sorting a parent resizes its children, which queues their own sort. Doing parents
+	// first lets those children sort only once, with their final size.
+	entries.sort();
+
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		// Resolve again, a previous sort may have freed it.
+		Container *container = Object::cast_to<Container>(ObjectDB::get_instance(entries[i].id));
+		if (container && container->pending_sort) {
+			container->_sort_children();
+		}
+	}
+}
+
 void Container::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
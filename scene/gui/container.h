@@ -40,6 +40,17 @@ class Container : public Control {
 	void _sort_children();
 	void _child_minsize_changed();
 
+	struct SortQueueEntry {
+		ObjectID id;
+		int depth = 0;
+
+		bool operator<(const SortQueueEntry &p_other) const { return depth < p_other.depth; }
+	};
+
+	// Containers waiting for a sort, flushed together so that parents are sorted before their children.
+	static LocalVector<ObjectID> sort_queue;
+	static void _flush_sort_queue(Object *p_tree, const void *p_data);
+
 protected:
 	void queue_sort();
 	virtual void add_child_notify(Node *p_child) override;
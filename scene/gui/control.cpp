@@ -494,6 +494,7 @@ void Control::_update_canvas_item_transform() {
 }
 
 void Control::_notification(int p_notification) {
+	MEMORY_TAG_SCOPE(TAG_GUI);
 	switch (p_notification) {
 		case NOTIFICATION_ENTER_TREE: {
 		} break;
@@ -2420,7 +2421,7 @@ void Control::minimum_size_changed() {
 
 	data.updating_last_minimum_size = true;
 
-	MessageQueue::get_singleton()->push_call(this, "_update_minimum_size");
+	MessageQueue::get_singleton()->push_callp(this, &Control::_update_minimum_size);
 }
 
 int Control::get_v_size_flags() const {
@@ -207,6 +207,10 @@ private:
 
 		CanvasItem *parent_canvas_item = nullptr;
 
+		// Native _gui_input of the class, looked up once by the viewport. Null when the class has none.
+		MethodBind *gui_input_method = nullptr;
+		bool gui_input_method_cached = false;
+
 		NodePath focus_neighbor[4];
 		NodePath focus_next;
 		NodePath focus_prev;
@@ -48,6 +48,14 @@ void ItemList::_shape(int p_idx) {
 	} else {
 		item.text_buf->set_flags(TextServer::BREAK_NONE);
 	}
+	item.text_dirty = false;
+}
+
+void ItemList::_queue_shape(int p_idx) {
+	// Shaping is deferred to the layout pass, so consecutive changes to an item
+	// (or adding many items at once) only shape each text once.
+	items.write[p_idx].text_dirty = true;
+	shape_changed = true;
 }
 
 int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bool p_selectable) {
@@ -66,8 +74,6 @@ int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bo
 	items.push_back(item);
 	int item_id = items.size() - 1;
 
-	_shape(items.size() - 1);
-
 	update();
 	shape_changed = true;
 	return item_id;
@@ -98,7 +104,7 @@ void ItemList::set_item_text(int p_idx, const String &p_text) {
 	ERR_FAIL_INDEX(p_idx, items.size());
 
 	items.write[p_idx].text = p_text;
-	_shape(p_idx);
+	_queue_shape(p_idx);
 	update();
 	shape_changed = true;
 }
@@ -113,7 +119,7 @@ void ItemList::set_item_text_direction(int p_idx, Control::TextDirection p_text_
 	ERR_FAIL_COND((int)p_text_direction < -1 || (int)p_text_direction > 3);
 	if (items[p_idx].text_direction != p_text_direction) {
 		items.write[p_idx].text_direction = p_text_direction;
-		_shape(p_idx);
+		_queue_shape(p_idx);
 		update();
 	}
 }
@@ -126,7 +132,7 @@ Control::TextDirection ItemList::get_item_text_direction(int p_idx) const {
 void ItemList::clear_item_opentype_features(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, items.size());
 	items.write[p_idx].opentype_features.clear();
-	_shape(p_idx);
+	_queue_shape(p_idx);
 	update();
 }
 
@@ -135,7 +141,7 @@ void ItemList::set_item_opentype_feature(int p_idx, const String &p_name, int p_
 	int32_t tag = TS->name_to_tag(p_name);
 	if (!items[p_idx].opentype_features.has(tag) || (int)items[p_idx].opentype_features[tag] != p_value) {
 		items.write[p_idx].opentype_features[tag] = p_value;
-		_shape(p_idx);
+		_queue_shape(p_idx);
 		update();
 	}
 }
@@ -153,7 +159,7 @@ void ItemList::set_item_language(int p_idx, const String &p_language) {
 	ERR_FAIL_INDEX(p_idx, items.size());
 	if (items[p_idx].language != p_language) {
 		items.write[p_idx].language = p_language;
-		_shape(p_idx);
+		_queue_shape(p_idx);
 		update();
 	}
 }
@@ -855,7 +861,7 @@ void ItemList::_notification(int p_what) {
 
 	if ((p_what == NOTIFICATION_LAYOUT_DIRECTION_CHANGED) || (p_what == NOTIFICATION_TRANSLATION_CHANGED) || (p_what == NOTIFICATION_THEME_CHANGED)) {
 		for (int i = 0; i < items.size(); i++) {
-			_shape(i);
+			items.write[i].text_dirty = true;
 		}
 		shape_changed = true;
 		update();
@@ -905,6 +911,10 @@ void ItemList::_notification(int p_what) {
 
 			//1- compute item minimum sizes
 			for (int i = 0; i < items.size(); i++) {
+				if (items[i].text_dirty) {
+					_shape(i);
+				}
+
 				Size2 minsize;
 				if (items[i].icon.is_valid()) {
 					if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
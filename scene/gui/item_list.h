@@ -58,6 +58,7 @@ private:
 		Ref<Texture2D> tag_icon;
 		String text;
 		Ref<TextParagraph> text_buf;
+		bool text_dirty = true; // Shaped on the next layout pass.
 		Dictionary opentype_features;
 		String language;
 		TextDirection text_direction = TEXT_DIRECTION_AUTO;
@@ -124,6 +125,7 @@ private:
 	void _scroll_changed(double);
 	void _gui_input(const Ref<InputEvent> &p_event);
 	void _shape(int p_idx);
+	void _queue_shape(int p_idx);
 
 protected:
 	void _notification(int p_what);
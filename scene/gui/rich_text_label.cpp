@@ -367,8 +367,10 @@ void RichTextLabel::_resize_line(ItemFrame *p_frame, int p_line, const Ref<Font>
 
 	if (p_line > 0) {
 		l.offset.y = p_frame->lines[p_line - 1].offset.y + p_frame->lines[p_line - 1].text_buf->get_size().y;
+		l.char_offset = p_frame->lines[p_line - 1].char_offset + p_frame->lines[p_line - 1].char_count;
 	} else {
 		l.offset.y = 0;
+		l.char_offset = 0;
 	}
 }
 
@@ -1101,15 +1103,7 @@ void RichTextLabel::_find_click(ItemFrame *p_frame, const Point2i &p_click, Item
 	int vofs = vscroll->get_value();
 
 	// Search for the first line.
-	int from_line = 0;
-
-	//TODO, change to binary search ?
-	while (from_line < main->lines.size()) {
-		if (main->lines[from_line].offset.y + main->lines[from_line].text_buf->get_size().y >= vofs) {
-			break;
-		}
-		from_line++;
-	}
+	int from_line = _find_first_line(0, main->lines.size(), vofs);
 
 	if (from_line >= main->lines.size()) {
 		return;
@@ -1385,15 +1379,7 @@ void RichTextLabel::_notification(int p_what) {
 			float vofs = vscroll->get_value();
 
 			// Search for the first line.
-			int from_line = 0;
-
-			//TODO, change to binary search ?
-			while (from_line < main->lines.size()) {
-				if (main->lines[from_line].offset.y + main->lines[from_line].text_buf->get_size().y >= vofs) {
-					break;
-				}
-				from_line++;
-			}
+			int from_line = _find_first_line(0, main->lines.size(), vofs);
 
 			if (from_line >= main->lines.size()) {
 				break; //nothing to draw
@@ -2106,7 +2092,12 @@ void RichTextLabel::_validate_line_caches(ItemFrame *p_frame) {
 	Ref<Font> base_font = get_theme_font("normal_font");
 	int base_font_size = get_theme_font_size("normal_font_size");
 
-	int total_chars = (p_frame->first_invalid_line == 0) ? 0 : (p_frame->lines[p_frame->first_invalid_line].char_offset + p_frame->lines[p_frame->first_invalid_line].char_count);
+	// Lines before the first invalid one keep their shape, but may still need a new width and offset.
+	for (int i = p_frame->first_resized_line; i < p_frame->first_invalid_line; i++) {
+		_resize_line(p_frame, i, base_font, base_font_size, text_rect.get_size().width - scroll_w);
+	}
+
+	int total_chars = (p_frame->first_invalid_line == 0) ? 0 : (p_frame->lines[p_frame->first_invalid_line - 1].char_offset + p_frame->lines[p_frame->first_invalid_line - 1].char_count);
 	for (int i = p_frame->first_invalid_line; i < p_frame->lines.size(); i++) {
 		_shape_line(p_frame, i, base_font, base_font_size, text_rect.get_size().width - scroll_w, &total_chars);
 	}
@@ -2132,6 +2123,21 @@ void RichTextLabel::_validate_line_caches(ItemFrame *p_frame) {
 	}
 }
 
+int RichTextLabel::_find_first_line(int p_from, int p_to, int p_vofs) const {
+	// Line offsets are monotonic, so the first visible line can be found with a binary search.
+	int l = p_from;
+	int r = p_to;
+	while (l < r) {
+		int m = (l + r) / 2;
+		if (main->lines[m].offset.y + main->lines[m].text_buf->get_size().y >= p_vofs) {
+			r = m;
+		} else {
+			l = m + 1;
+		}
+	}
+	return l;
+}
+
 void RichTextLabel::_invalidate_current_line(ItemFrame *p_frame) {
 	if (p_frame->lines.size() - 1 <= p_frame->first_invalid_line) {
 		p_frame->first_invalid_line = p_frame->lines.size() - 1;
@@ -2167,7 +2173,8 @@ void RichTextLabel::add_text(const String &p_text) {
 				//append text condition!
 				ItemText *ti = static_cast<ItemText *>(current->subitems.back()->get());
 				ti->text += line;
-				_invalidate_current_line(main);
+				current_char_ofs += line.length();
+				_invalidate_current_line(current_frame);
 
 			} else {
 				//append item condition
@@ -2329,7 +2336,16 @@ bool RichTextLabel::remove_line(const int p_line) {
 		main->lines.write[0].from = main;
 	}
 
-	main->first_invalid_line = 0; // p_line ???
+	// Lines after the removed one keep their shape, only their offsets have to be updated.
+	if (current_frame->first_invalid_line > p_line) {
+		current_frame->first_invalid_line = MAX(p_line, current_frame->first_invalid_line - 1);
+	}
+	current_frame->first_invalid_line = MIN(current_frame->first_invalid_line, current_frame->lines.size());
+	current_frame->first_resized_line = MIN(current_frame->first_resized_line, p_line);
+	if (current_frame->lines.size() == 1 && current_frame->lines[0].from == nullptr) {
+		current_frame->first_invalid_line = 0;
+	}
+	update();
 
 	return true;
 }
@@ -138,13 +138,13 @@ void TextEdit::Text::set_draw_control_chars(bool p_draw_control_chars) {
 
 int TextEdit::Text::get_line_width(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
-	return text[p_line].data_buf->get_size().x;
+	return _get_shaped_line(p_line)->get_size().x;
 }
 
 int TextEdit::Text::get_line_height(int p_line, int p_wrap_index) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
 
-	return text[p_line].data_buf->get_line_size(p_wrap_index).y;
+	return _get_shaped_line(p_line)->get_line_size(p_wrap_index).y;
 }
 
 void TextEdit::Text::set_width(float p_width) {
@@ -154,22 +154,23 @@ void TextEdit::Text::set_width(float p_width) {
 int TextEdit::Text::get_line_wrap_amount(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
 
-	return text[p_line].data_buf->get_line_count() - 1;
+	return _get_shaped_line(p_line)->get_line_count() - 1;
 }
 
 Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 	Vector<Vector2i> ret;
 	ERR_FAIL_INDEX_V(p_line, text.size(), ret);
 
-	for (int i = 0; i < text[p_line].data_buf->get_line_count(); i++) {
-		ret.push_back(text[p_line].data_buf->get_line_range(i));
+	const Ref<TextParagraph> &data_buf = _get_shaped_line(p_line);
+	for (int i = 0; i < data_buf->get_line_count(); i++) {
+		ret.push_back(data_buf->get_line_range(i));
 	}
 	return ret;
 }
 
 const Ref<TextParagraph> TextEdit::Text::get_line_data(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), Ref<TextParagraph>());
-	return text[p_line].data_buf;
+	return _get_shaped_line(p_line);
 }
 
 _FORCE_INLINE_ const String &TextEdit::Text::operator[](int p_line) const {
@@ -179,9 +180,21 @@ _FORCE_INLINE_ const String &TextEdit::Text::operator[](int p_line) const {
 void TextEdit::Text::invalidate_cache(int p_line, int p_column, const String &p_ime_text, const Vector<Vector2i> &p_bidi_override) {
 	ERR_FAIL_INDEX(p_line, text.size());
 
+	max_width = -1;
+	if (p_ime_text.length() > 0) {
+		_shape_line(p_line, p_ime_text, p_bidi_override);
+	} else {
+		// Reshaped when next drawn or measured, so repeated edits and
+		// invalidate_all() calls don't shape the same line several times.
+		text.write[p_line].dirty = true;
+	}
+}
+
+void TextEdit::Text::_shape_line(int p_line, const String &p_ime_text, const Vector<Vector2i> &p_bidi_override) const {
 	if (font.is_null() || font_size <= 0) {
 		return; // Not in tree?
 	}
+	text.write[p_line].dirty = false;
 
 	text.write[p_line].data_buf->clear();
 	text.write[p_line].data_buf->set_width(width);
@@ -208,7 +221,11 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, const String &p_
 }
 
 void TextEdit::Text::invalidate_all_lines() {
+	max_width = -1;
 	for (int i = 0; i < text.size(); i++) {
+		if (text[i].dirty) {
+			continue; // Width and tabs are applied when shaped.
+		}
 		text.write[i].data_buf->set_width(width);
 		if (indent_size > 0) {
 			Vector<float> tabs;
@@ -226,10 +243,15 @@ void TextEdit::Text::invalidate_all() {
 
 void TextEdit::Text::clear() {
 	text.clear();
+	max_width = -1;
 	insert(0, "", Vector<Vector2i>());
 }
 
 int TextEdit::Text::get_max_width(bool p_exclude_hidden) const {
+	if (p_exclude_hidden && max_width >= 0) {
+		return max_width;
+	}
+
 	// Quite some work, but should be fast enough.
 
 	int max = 0;
@@ -238,6 +260,10 @@ int TextEdit::Text::get_max_width(bool p_exclude_hidden) const {
 			max = MAX(max, get_line_width(i));
 		}
 	}
+
+	if (p_exclude_hidden) {
+		max_width = max;
+	}
 	return max;
 }
 
@@ -263,6 +289,7 @@ void TextEdit::Text::insert(int p_at, const String &p_text, const Vector<Vector2
 
 void TextEdit::Text::remove(int p_at) {
 	text.remove(p_at);
+	max_width = -1;
 }
 
 void TextEdit::Text::add_gutter(int p_at) {
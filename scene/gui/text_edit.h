@@ -94,6 +94,7 @@ private:
 
 			bool marked = false;
 			bool hidden = false;
+			bool dirty = true; // Shaped when first needed.
 
 			Line() {
 				data_buf.instance();
@@ -115,6 +116,16 @@ private:
 		int indent_size = 4;
 		int gutter_count = 0;
 
+		mutable int max_width = -1; // Widest visible line, -1 if it must be recomputed.
+
+		void _shape_line(int p_line, const String &p_ime_text = String(), const Vector<Vector2i> &p_bidi_override = Vector<Vector2i>()) const;
+		_FORCE_INLINE_ const Ref<TextParagraph> &_get_shaped_line(int p_line) const {
+			if (text[p_line].dirty) {
+				_shape_line(p_line);
+			}
+			return text[p_line].data_buf;
+		}
+
 	public:
 		void set_indent_size(int p_indent_size);
 		void set_font(const Ref<Font> &p_font);
@@ -135,7 +146,10 @@ private:
 		void set(int p_line, const String &p_text, const Vector<Vector2i> &p_bidi_override);
 		void set_marked(int p_line, bool p_marked) { text.write[p_line].marked = p_marked; }
 		bool is_marked(int p_line) const { return text[p_line].marked; }
-		void set_hidden(int p_line, bool p_hidden) { text.write[p_line].hidden = p_hidden; }
+		void set_hidden(int p_line, bool p_hidden) {
+			text.write[p_line].hidden = p_hidden;
+			max_width = -1;
+		}
 		bool is_hidden(int p_line) const { return text[p_line].hidden; }
 		void insert(int p_at, const String &p_text, const Vector<Vector2i> &p_bidi_override);
 		void remove(int p_at);
@@ -102,11 +102,29 @@ void TreeItem::Cell::draw_icon(const RID &p_where, const Point2 &p_pos, const Si
 	}
 }
 
+void TreeItem::_invalidate_height_cache() {
+	height_cache = -1;
+	subtree_height_cache = -1;
+	if (parent) {
+		parent->_invalidate_subtree_height_cache();
+	}
+}
+
+void TreeItem::_invalidate_subtree_height_cache() {
+	// Stop at the first ancestor that is already invalid, the ones above it are
+	// either invalid too or collapsed, which makes them independent from it.
+	for (TreeItem *it = this; it && it->subtree_height_cache >= 0; it = it->parent) {
+		it->subtree_height_cache = -1;
+	}
+}
+
 void TreeItem::_changed_notify(int p_cell) {
+	_invalidate_height_cache();
 	tree->item_changed(p_cell, this);
 }
 
 void TreeItem::_changed_notify() {
+	_invalidate_height_cache();
 	tree->item_changed(-1, this);
 }
 
@@ -518,6 +536,7 @@ void TreeItem::remove_child(TreeItem *p_item) {
 			*c = (*c)->next;
 
 			aux->parent = nullptr;
+			_invalidate_subtree_height_cache();
 			return;
 		}
 
@@ -714,6 +733,7 @@ Color TreeItem::get_custom_bg_color(int p_column) const {
 void TreeItem::set_custom_as_button(int p_column, bool p_button) {
 	ERR_FAIL_INDEX(p_column, cells.size());
 	cells.write[p_column].custom_button = p_button;
+	_invalidate_height_cache();
 }
 
 bool TreeItem::is_custom_set_as_button(int p_column) const {
@@ -931,6 +951,7 @@ void TreeItem::clear_children() {
 	}
 
 	children = nullptr;
+	_invalidate_subtree_height_cache();
 };
 
 TreeItem::TreeItem(Tree *p_tree) {
@@ -1044,6 +1065,10 @@ int Tree::compute_item_height(TreeItem *p_item) const {
 		return 0;
 	}
 
+	if (p_item->height_cache >= 0) {
+		return p_item->height_cache;
+	}
+
 	ERR_FAIL_COND_V(cache.font.is_null(), 0);
 	int height = 0;
 
@@ -1097,10 +1122,15 @@ int Tree::compute_item_height(TreeItem *p_item) const {
 
 	height += cache.vseparation;
 
+	p_item->height_cache = height;
 	return height;
 }
 
 int Tree::get_item_height(TreeItem *p_item) const {
+	if (p_item->subtree_height_cache >= 0) {
+		return p_item->subtree_height_cache;
+	}
+
 	int height = compute_item_height(p_item);
 	height += cache.vseparation;
 
@@ -1115,9 +1145,21 @@ int Tree::get_item_height(TreeItem *p_item) const {
 		}
 	}
 
+	p_item->subtree_height_cache = height;
 	return height;
 }
 
+void Tree::_invalidate_height_caches(TreeItem *p_item) {
+	p_item->height_cache = -1;
+	p_item->subtree_height_cache = -1;
+
+	TreeItem *c = p_item->children;
+	while (c) {
+		_invalidate_height_caches(c);
+		c = c->next;
+	}
+}
+
 void Tree::draw_item_rect(TreeItem::Cell &p_cell, const Rect2i &p_rect, const Color &p_color, const Color &p_icon_color, int p_ol_size, const Color &p_ol_color) {
 	ERR_FAIL_COND(cache.font.is_null());
 
@@ -1683,7 +1725,10 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 			}
 
 			if (htotal >= 0) {
-				int child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c);
+				int child_h = get_item_height(c);
+				if (children_pos.y + child_h - cache.offset.y > 0) {
+					child_h = draw_item(children_pos, p_draw_ofs, p_draw_size, c);
+				} // Else the whole subtree is above the visible area, skip it.
 
 				if (child_h < 0) {
 					if (cache.draw_relationship_lines == 0) {
@@ -2157,7 +2202,10 @@ int Tree::propagate_mouse_event(const Point2i &p_pos, int x_ofs, int y_ofs, bool
 			TreeItem *c = p_item->children;
 
 			while (c) {
-				int child_h = propagate_mouse_event(new_pos, x_ofs, y_ofs, p_doubleclick, c, p_button, p_mod);
+				int child_h = get_item_height(c);
+				if (new_pos.y < child_h) {
+					child_h = propagate_mouse_event(new_pos, x_ofs, y_ofs, p_doubleclick, c, p_button, p_mod);
+				} // Else the event is below this whole subtree.
 
 				if (child_h < 0) {
 					return -1; // break, stop propagating, no need to anymore
@@ -3237,6 +3285,7 @@ void Tree::_update_all() {
 	}
 	if (root) {
 		update_item_cache(root);
+		_invalidate_height_caches(root);
 	}
 }
 
@@ -3274,6 +3323,7 @@ TreeItem *Tree::create_item(TreeItem *p_parent, int p_idx) {
 			p_parent->children = ti;
 		}
 		ti->parent = p_parent;
+		p_parent->_invalidate_subtree_height_cache();
 
 	} else {
 		if (!root) {
@@ -3419,6 +3469,9 @@ void Tree::clear() {
 
 void Tree::set_hide_root(bool p_enabled) {
 	hide_root = p_enabled;
+	if (root) {
+		root->_invalidate_subtree_height_cache();
+	}
 	update();
 }
 
@@ -3552,6 +3605,7 @@ void Tree::set_columns(int p_columns) {
 
 	if (root) {
 		propagate_set_columns(root);
+		_invalidate_height_caches(root);
 	}
 	if (selected_col >= p_columns) {
 		selected_col = p_columns - 1;
@@ -3572,40 +3626,31 @@ Rect2 Tree::get_custom_popup_rect() const {
 }
 
 int Tree::get_item_offset(TreeItem *p_item) const {
-	TreeItem *it = root;
-	int ofs = _get_title_button_height();
-	if (!it) {
+	if (!root) {
 		return 0;
 	}
 
-	while (true) {
-		if (it == p_item) {
-			return ofs;
+	// Walk up to the root, adding the rows of each parent and the subtrees of its previous children.
+	int ofs = _get_title_button_height();
+	TreeItem *it = p_item;
+	while (it != root) {
+		TreeItem *parent = it->parent;
+		if (!parent || parent->collapsed) {
+			return 0; // Not in this tree, or not visible.
 		}
 
-		ofs += compute_item_height(it);
-		if (it != root || !hide_root) {
+		ofs += compute_item_height(parent);
+		if (parent != root || !hide_root) {
 			ofs += cache.vseparation;
 		}
 
-		if (it->children && !it->collapsed) {
-			it = it->children;
-
-		} else if (it->next) {
-			it = it->next;
-		} else {
-			while (!it->next) {
-				it = it->parent;
-				if (it == nullptr) {
-					return 0;
-				}
-			}
-
-			it = it->next;
+		for (TreeItem *c = parent->children; c != it; c = c->next) {
+			ofs += get_item_height(c);
 		}
+		it = parent;
 	}
 
-	return -1; //not found
+	return ofs;
 }
 
 void Tree::ensure_cursor_is_visible() {
@@ -3914,8 +3959,11 @@ TreeItem *Tree::_find_item_at_pos(TreeItem *p_item, const Point2 &p_pos, int &r_
 
 	TreeItem *n = p_item->get_children();
 	while (n) {
-		int ch;
-		TreeItem *r = _find_item_at_pos(n, pos, r_column, ch, section);
+		int ch = get_item_height(n);
+		TreeItem *r = nullptr;
+		if (pos.y < ch) {
+			r = _find_item_at_pos(n, pos, r_column, ch, section);
+		}
 		pos.y -= ch;
 		h += ch;
 		if (r) {
@@ -131,8 +131,14 @@ private:
 	TreeItem *children; //child items
 	Tree *tree; //tree (for reference)
 
+	// Cached by Tree, -1 when it must be recomputed.
+	int height_cache = -1; // This item's own row.
+	int subtree_height_cache = -1; // This item's row and its visible children.
+
 	TreeItem(Tree *p_tree);
 
+	void _invalidate_height_cache();
+	void _invalidate_subtree_height_cache();
 	void _changed_notify(int p_cell);
 	void _changed_notify();
 	void _cell_selected(int p_cell);
@@ -384,6 +390,7 @@ private:
 	void update_column(int p_col);
 	void update_item_cell(TreeItem *p_item, int p_col);
 	void update_item_cache(TreeItem *p_item);
+	void _invalidate_height_caches(TreeItem *p_item);
 	//void draw_item_text(String p_text,const Ref<Texture2D>& p_icon,int p_icon_max_w,bool p_tool,Rect2i p_rect,const Color& p_color);
 	void draw_item_rect(TreeItem::Cell &p_cell, const Rect2i &p_rect, const Color &p_color, const Color &p_icon_color, int p_ol_size, const Color &p_ol_color);
 	int draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2 &p_draw_size, TreeItem *p_item);
@@ -32,13 +32,100 @@
 #include "core/io/compression.h"
 #include "core/string/ustring.h"
 
+Mutex HTTPRequest::connection_pool_mutex;
+Map<String, List<HTTPRequest::PooledConnection>> HTTPRequest::connection_pool;
+
 void HTTPRequest::_redirect_request(const String &p_new_url) {
 }
 
 Error HTTPRequest::_request() {
+	if (_take_pooled_connection()) {
+		return OK;
+	}
 	return client->connect_to_host(url, port, use_ssl, validate_ssl);
 }
 
+String HTTPRequest::_get_connection_pool_key() const {
+	return url + ":" + itos(port) + (use_ssl ? (validate_ssl ? ":ssl_verify" : ":ssl") : "");
+}
+
+bool HTTPRequest::_take_pooled_connection() {
+	reused_connection = false;
+	String key = _get_connection_pool_key();
+	uint64_t now = OS::get_singleton()->get_ticks_msec();
+
+	MutexLock lock(connection_pool_mutex);
+	Map<String, List<PooledConnection>>::Element *E = connection_pool.find(key);
+	if (!E) {
+		return false;
+	}
+
+	// Most recently released first, they are the least likely to have been closed by the server.
+	while (!E->get().is_empty()) {
+		PooledConnection pooled = E->get().back()->get();
+		E->get().pop_back();
+		if (now - pooled.idle_since > POOL_IDLE_TIMEOUT_MSEC) {
+			pooled.client->close();
+			continue;
+		}
+		pooled.client->poll();
+		if (pooled.client->get_status() != HTTPClient::STATUS_CONNECTED) {
+			pooled.client->close();
+			continue;
+		}
+
+		pooled.client->set_blocking_mode(use_threads);
+		pooled.client->set_read_chunk_size(client->get_read_chunk_size());
+		client = pooled.client;
+		reused_connection = true;
+		break;
+	}
+
+	if (E->get().is_empty()) {
+		connection_pool.erase(E);
+	}
+	return reused_connection;
+}
+
+void HTTPRequest::_release_connection() {
+	PooledConnection pooled;
+	pooled.client = client;
+	pooled.idle_since = OS::get_singleton()->get_ticks_msec();
+
+	// This request keeps its own client, a new one.
+	client.instance();
+	client->set_read_chunk_size(pooled.client->get_read_chunk_size());
+
+	MutexLock lock(connection_pool_mutex);
+	List<PooledConnection> &connections = connection_pool[_get_connection_pool_key()];
+	if (connections.size() >= POOL_MAX_IDLE_CONNECTIONS) {
+		connections.front()->get().client->close();
+		connections.pop_front();
+	}
+	connections.push_back(pooled);
+}
+
+bool HTTPRequest::_retry_with_new_connection() {
+	// The server may have closed a pooled connection while it was idle, retry once on a new one.
+	if (!reused_connection || got_response) {
+		return false;
+	}
+	reused_connection = false;
+	request_sent = false;
+	client->close();
+	return client->connect_to_host(url, port, use_ssl, validate_ssl) == OK;
+}
+
+void HTTPRequest::clear_connection_pool() {
+	MutexLock lock(connection_pool_mutex);
+	for (Map<String, List<PooledConnection>>::Element *E = connection_pool.front(); E; E = E->next()) {
+		for (List<PooledConnection>::Element *F = E->get().front(); F; F = F->next()) {
+			F->get().client->close();
+		}
+	}
+	connection_pool.clear();
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	url = p_url;
 	use_ssl = false;
@@ -199,6 +286,10 @@ void HTTPRequest::_thread_func(void *p_userdata) {
 }
 
 void HTTPRequest::cancel_request() {
+	_finish_request(false);
+}
+
+void HTTPRequest::_finish_request(bool p_keep_connection) {
 	timer->stop();
 
 	if (!requesting) {
@@ -216,7 +307,11 @@ void HTTPRequest::cancel_request() {
 		memdelete(file);
 		file = nullptr;
 	}
-	client->close();
+	if (p_keep_connection && client->get_status() == HTTPClient::STATUS_CONNECTED) {
+		_release_connection();
+	} else {
+		client->close();
+	}
 	body.resize(0);
 	got_response = false;
 	response_code = -1;
@@ -226,6 +321,10 @@ void HTTPRequest::cancel_request() {
 
 bool HTTPRequest::_handle_response(bool *ret_value) {
 	if (!client->has_response()) {
+		if (_retry_with_new_connection()) {
+			*ret_value = false;
+			return true;
+		}
 		call_deferred("_request_done", RESULT_NO_RESPONSE, 0, PackedStringArray(), PackedByteArray());
 		*ret_value = true;
 		return true;
@@ -290,6 +389,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_with_new_connection()) {
+				return false;
+			}
 			call_deferred("_request_done", RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's doing something
 		} break;
@@ -421,6 +523,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_with_new_connection()) {
+				return false;
+			}
 			call_deferred("_request_done", RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -434,7 +539,7 @@ bool HTTPRequest::_update_connection() {
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
-	cancel_request();
+	_finish_request(p_status == RESULT_SUCCESS);
 
 	// Determine if the request body is compressed
 	bool is_compressed;
@@ -33,6 +33,7 @@
 
 #include "core/io/http_client.h"
 #include "core/os/file_access.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "node.h"
 #include "scene/main/timer.h"
@@ -72,6 +73,7 @@ private:
 	Vector<uint8_t> request_data;
 
 	bool request_sent = false;
+	bool reused_connection = false;
 	Ref<HTTPClient> client;
 	PackedByteArray body;
 	volatile bool use_threads = false;
@@ -115,6 +117,27 @@ private:
 	void _request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data);
 	static void _thread_func(void *p_userdata);
 
+	// Connections kept alive by the server are shared by all HTTPRequests, so requests to the
+	// same host skip the TCP and SSL handshakes.
+	enum {
+		POOL_MAX_IDLE_CONNECTIONS = 8, // Per host.
+		POOL_IDLE_TIMEOUT_MSEC = 5000, // Servers close idle connections on their own, don't reuse old ones.
+	};
+
+	struct PooledConnection {
+		Ref<HTTPClient> client;
+		uint64_t idle_since = 0;
+	};
+
+	static Mutex connection_pool_mutex;
+	static Map<String, List<PooledConnection>> connection_pool;
+
+	String _get_connection_pool_key() const;
+	bool _take_pooled_connection();
+	void _release_connection();
+	bool _retry_with_new_connection();
+	void _finish_request(bool p_keep_connection);
+
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
@@ -153,6 +176,8 @@ public:
 	int get_downloaded_bytes() const;
 	int get_body_size() const;
 
+	static void clear_connection_pool();
+
 	HTTPRequest();
 	~HTTPRequest();
 };
@@ -31,6 +31,7 @@
 #include "instance_placeholder.h"
 
 #include "core/io/resource_loader.h"
+#include "core/object/message_queue.h"
 #include "scene/resources/packed_scene.h"
 
 bool InstancePlaceholder::_set(const StringName &p_name, const Variant &p_value) {
@@ -70,6 +71,44 @@ String InstancePlaceholder::get_instance_path() const {
 	return path;
 }
 
+void InstancePlaceholder::set_deferred_scene(const Ref<PackedScene> &p_scene) {
+	deferred_scene = p_scene;
+}
+
+void InstancePlaceholder::_notification(int p_what) {
+	if (p_what == NOTIFICATION_ENTER_TREE && deferred_scene.is_valid()) {
+		// The parent is still adding its children, so it can't be replaced right away.
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &InstancePlaceholder::_instance_deferred));
+	}
+}
+
+void InstancePlaceholder::_instance_deferred() {
+	if (!is_inside_tree() || deferred_scene.is_null()) {
+		return;
+	}
+
+	Ref<PackedScene> scene = deferred_scene;
+	deferred_scene.unref();
+
+	Node *owner = get_owner();
+	List<GroupInfo> groups;
+	get_groups(&groups);
+
+	Node *node = create_instance(true, scene);
+	if (!node) {
+		return;
+	}
+
+	for (List<GroupInfo>::Element *E = groups.front(); E; E = E->next()) {
+		if (E->get().persistent) {
+			node->add_to_group(E->get().name, true);
+		}
+	}
+	if (owner) {
+		node->set_owner(owner);
+	}
+}
+
 Node *InstancePlaceholder::create_instance(bool p_replace, const Ref<PackedScene> &p_custom_scene) {
 	ERR_FAIL_COND_V(!is_inside_tree(), nullptr);
 
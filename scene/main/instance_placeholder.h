@@ -46,7 +46,11 @@ class InstancePlaceholder : public Node {
 
 	List<PropSet> stored_values;
 
+	Ref<PackedScene> deferred_scene;
+	void _instance_deferred();
+
 protected:
+	void _notification(int p_what);
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
 	void _get_property_list(List<PropertyInfo> *p_list) const;
@@ -57,6 +61,8 @@ public:
 	void set_instance_path(const String &p_name);
 	String get_instance_path() const;
 
+	void set_deferred_scene(const Ref<PackedScene> &p_scene);
+
 	Dictionary get_stored_values(bool p_with_order = false);
 
 	Node *create_instance(bool p_replace = false, const Ref<PackedScene> &p_custom_scene = Ref<PackedScene>());
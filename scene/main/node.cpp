@@ -47,6 +47,7 @@
 #include <stdint.h>
 
 VARIANT_ENUM_CAST(Node::PauseMode);
+VARIANT_ENUM_CAST(Node::ProcessThreadGroup);
 
 int Node::orphan_node_count = 0;
 
@@ -79,6 +80,16 @@ void Node::_notification(int p_notification) {
 				data.pause_owner = this;
 			}
 
+			if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+				if (data.parent) {
+					data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
+				} else {
+					data.process_thread_group_owner = nullptr;
+				}
+			} else {
+				data.process_thread_group_owner = this;
+			}
+
 			if (data.input) {
 				add_to_group("_vp_input" + itos(get_viewport()->get_instance_id()));
 			}
@@ -111,6 +122,7 @@ void Node::_notification(int p_notification) {
 			}
 
 			data.pause_owner = nullptr;
+			data.process_thread_group_owner = nullptr;
 			if (data.path_cache) {
 				memdelete(data.path_cache);
 				data.path_cache = nullptr;
@@ -396,39 +408,97 @@ void Node::set_pause_mode(PauseMode p_mode) {
 		return;
 	}
 
+	if (!is_inside_tree()) {
+		data.pause_mode = p_mode;
+		return; //pointless
+	}
+
+	bool prev_can_process = can_process();
 	bool prev_inherits = data.pause_mode == PAUSE_MODE_INHERIT;
 	data.pause_mode = p_mode;
+
+	if ((data.pause_mode == PAUSE_MODE_INHERIT) != prev_inherits) {
+		Node *owner = nullptr;
+
+		if (data.pause_mode == PAUSE_MODE_INHERIT) {
+			if (data.parent) {
+				owner = data.parent->data.pause_owner;
+			}
+		} else {
+			owner = this;
+		}
+
+		_propagate_pause_owner(owner);
+	}
+
+	// While the tree is paused, the new mode can pause or unpause this branch on its own.
+	if (can_process() != prev_can_process) {
+		_propagate_pause_notification(!can_process());
+	}
+}
+
+Node::PauseMode Node::get_pause_mode() const {
+	return data.pause_mode;
+}
+
+void Node::_propagate_pause_notification(bool p_paused) {
+	notification(p_paused ? NOTIFICATION_PAUSED : NOTIFICATION_UNPAUSED);
+	for (int i = 0; i < data.children.size(); i++) {
+		// Children with their own pause mode don't follow this node.
+		if (data.children[i]->data.pause_mode == PAUSE_MODE_INHERIT) {
+			data.children[i]->_propagate_pause_notification(p_paused);
+		}
+	}
+}
+
+void Node::_propagate_pause_owner(Node *p_owner) {
+	if (this != p_owner && data.pause_mode != PAUSE_MODE_INHERIT) {
+		return;
+	}
+	data.pause_owner = p_owner;
+	for (int i = 0; i < data.children.size(); i++) {
+		data.children[i]->_propagate_pause_owner(p_owner);
+	}
+}
+
+void Node::set_process_thread_group(ProcessThreadGroup p_group) {
+	if (data.process_thread_group == p_group) {
+		return;
+	}
+
+	bool prev_inherits = data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT;
+	data.process_thread_group = p_group;
 	if (!is_inside_tree()) {
 		return; //pointless
 	}
-	if ((data.pause_mode == PAUSE_MODE_INHERIT) == prev_inherits) {
+	if ((data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) == prev_inherits) {
 		return; ///nothing changed
 	}
 
 	Node *owner = nullptr;
 
-	if (data.pause_mode == PAUSE_MODE_INHERIT) {
+	if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
 		if (data.parent) {
-			owner = data.parent->data.pause_owner;
+			owner = data.parent->data.process_thread_group_owner;
 		}
 	} else {
 		owner = this;
 	}
 
-	_propagate_pause_owner(owner);
+	_propagate_process_thread_group_owner(owner);
 }
 
-Node::PauseMode Node::get_pause_mode() const {
-	return data.pause_mode;
+Node::ProcessThreadGroup Node::get_process_thread_group() const {
+	return data.process_thread_group;
 }
 
-void Node::_propagate_pause_owner(Node *p_owner) {
-	if (this != p_owner && data.pause_mode != PAUSE_MODE_INHERIT) {
+void Node::_propagate_process_thread_group_owner(Node *p_owner) {
+	if (this != p_owner && data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
 		return;
 	}
-	data.pause_owner = p_owner;
+	data.process_thread_group_owner = p_owner;
 	for (int i = 0; i < data.children.size(); i++) {
-		data.children[i]->_propagate_pause_owner(p_owner);
+		data.children[i]->_propagate_process_thread_group_owner(p_owner);
 	}
 }
 
@@ -2774,6 +2844,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_physics_processing"), &Node::is_physics_processing);
 	ClassDB::bind_method(D_METHOD("get_process_delta_time"), &Node::get_process_delta_time);
 	ClassDB::bind_method(D_METHOD("set_process", "enable"), &Node::set_process);
+	ClassDB::bind_method(D_METHOD("set_process_thread_group", "group"), &Node::set_process_thread_group);
+	ClassDB::bind_method(D_METHOD("get_process_thread_group"), &Node::get_process_thread_group);
 	ClassDB::bind_method(D_METHOD("set_process_priority", "priority"), &Node::set_process_priority);
 	ClassDB::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
 	ClassDB::bind_method(D_METHOD("is_processing"), &Node::is_processing);
@@ -2895,6 +2967,10 @@ void Node::_bind_methods() {
 	BIND_ENUM_CONSTANT(PAUSE_MODE_STOP);
 	BIND_ENUM_CONSTANT(PAUSE_MODE_PROCESS);
 
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_INHERIT);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_MAIN_THREAD);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_SUB_THREAD);
+
 	BIND_ENUM_CONSTANT(DUPLICATE_SIGNALS);
 	BIND_ENUM_CONSTANT(DUPLICATE_GROUPS);
 	BIND_ENUM_CONSTANT(DUPLICATE_SCRIPTS);
@@ -2914,6 +2990,7 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "multiplayer", PROPERTY_HINT_RESOURCE_TYPE, "MultiplayerAPI", 0), "", "get_multiplayer");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "custom_multiplayer", PROPERTY_HINT_RESOURCE_TYPE, "MultiplayerAPI", 0), "set_custom_multiplayer", "get_custom_multiplayer");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 
 	BIND_VMETHOD(MethodInfo("_process", PropertyInfo(Variant::FLOAT, "delta")));
 	BIND_VMETHOD(MethodInfo("_physics_process", PropertyInfo(Variant::FLOAT, "delta")));
@@ -52,6 +52,12 @@ public:
 		PAUSE_MODE_PROCESS
 	};
 
+	enum ProcessThreadGroup {
+		PROCESS_THREAD_GROUP_INHERIT,
+		PROCESS_THREAD_GROUP_MAIN_THREAD,
+		PROCESS_THREAD_GROUP_SUB_THREAD
+	};
+
 	enum DuplicateFlags {
 		DUPLICATE_SIGNALS = 1,
 		DUPLICATE_GROUPS = 2,
@@ -112,6 +118,9 @@ private:
 		PauseMode pause_mode = PAUSE_MODE_INHERIT;
 		Node *pause_owner = nullptr;
 
+		ProcessThreadGroup process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
+		Node *process_thread_group_owner = nullptr;
+
 		int network_master = 1; // Server by default.
 		Vector<NetData> rpc_methods;
 		Vector<NetData> rpc_properties;
@@ -167,6 +176,8 @@ private:
 	void _propagate_validate_owner();
 	void _print_stray_nodes();
 	void _propagate_pause_owner(Node *p_owner);
+	void _propagate_pause_notification(bool p_paused);
+	void _propagate_process_thread_group_owner(Node *p_owner);
 	Array _get_node_and_resource(const NodePath &p_path);
 
 	void _duplicate_signals(const Node *p_original, Node *p_copy) const;
@@ -383,6 +394,14 @@ public:
 
 	void set_pause_mode(PauseMode p_mode);
 	PauseMode get_pause_mode() const;
+
+	void set_process_thread_group(ProcessThreadGroup p_group);
+	ProcessThreadGroup get_process_thread_group() const;
+	// Node whose sub-thread group this node is processed in, or nullptr if processed on the main thread.
+	_FORCE_INLINE_ Node *get_process_sub_thread_group_owner() const {
+		Node *owner = data.process_thread_group_owner;
+		return (owner && owner->data.process_thread_group == PROCESS_THREAD_GROUP_SUB_THREAD) ? owner : nullptr;
+	}
 	bool can_process() const;
 	bool can_process_notification(int p_what) const;
 
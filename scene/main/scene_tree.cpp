@@ -31,10 +31,12 @@
 #include "scene_tree.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
 #include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
 #include "core/object/message_queue.h"
 #include "core/os/dir_access.h"
 #include "core/os/keyboard.h"
@@ -42,6 +44,7 @@
 #include "core/string/print_string.h"
 #include "node.h"
 #include "scene/debugger/scene_debugger.h"
+#include "scene/main/timer.h"
 #include "scene/resources/font.h"
 #include "scene/resources/material.h"
 #include "scene/resources/mesh.h"
@@ -66,14 +69,27 @@ void SceneTreeTimer::_bind_methods() {
 
 void SceneTreeTimer::set_time_left(float p_time) {
 	time_left = p_time;
+	if (tree) {
+		tree->_start_scene_timer(this);
+	}
 }
 
 float SceneTreeTimer::get_time_left() const {
+	if (tree) {
+		return deadline - tree->scene_timers[process_pause ? 1 : 0].time;
+	}
 	return time_left;
 }
 
 void SceneTreeTimer::set_pause_mode_process(bool p_pause_mode_process) {
+	if (process_pause == p_pause_mode_process) {
+		return;
+	}
+	time_left = get_time_left();
 	process_pause = p_pause_mode_process;
+	if (tree) {
+		tree->_start_scene_timer(this);
+	}
 }
 
 bool SceneTreeTimer::is_pause_mode_process() {
@@ -90,7 +106,9 @@ void SceneTreeTimer::release_connections() {
 	}
 }
 
-SceneTreeTimer::SceneTreeTimer() {}
+SceneTreeTimer::SceneTreeTimer() :
+		wheel_element(this) {
+}
 
 void SceneTree::tree_changed() {
 	tree_version++;
@@ -154,6 +172,7 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+	xform_flush_count++;
 }
 
 void SceneTree::_flush_ugc() {
@@ -234,23 +253,61 @@ void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_grou
 
 	_update_group_order(g);
 
-	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
+	const Vector<Node *> nodes_copy = g.nodes;
+	Node *const *nodes = nodes_copy.ptr();
 	int node_count = nodes_copy.size();
 
 	call_lock++;
 
-	if (p_call_flags & GROUP_CALL_REVERSE) {
+	if (p_call_flags & GROUP_CALL_REALTIME) {
+		VARIANT_ARGPTRS;
+
+		GroupCall call;
+		call.nodes = nodes;
+		call.function = p_function;
+		call.args = argptr;
+		for (int i = 0; i < VARIANT_ARG_MAX; i++) {
+			if (argptr[i]->get_type() == Variant::NIL) {
+				break;
+			}
+			call.argcount++;
+		}
+
+		if (p_call_flags & GROUP_CALL_THREADED) {
+			if (process_thread_pool.get_thread_count() == 0) {
+				process_thread_pool.init();
+			}
+			// Resolve the methods up front, the class cache can't be shared between threads.
+			LocalVector<MethodBind *> methods;
+			methods.resize(node_count);
+			for (int i = 0; i < node_count; i++) {
+				methods[i] = call.resolve(nodes[i]);
+			}
+			call.methods = methods.ptr();
+			process_thread_pool.do_work(node_count, this, &SceneTree::_call_group_threaded, &call);
+		} else if (p_call_flags & GROUP_CALL_REVERSE) {
+			for (int i = node_count - 1; i >= 0; i--) {
+				if (call_lock && call_skip.has(nodes[i])) {
+					continue;
+				}
+				call.call(nodes[i]);
+			}
+		} else {
+			for (int i = 0; i < node_count; i++) {
+				if (call_lock && call_skip.has(nodes[i])) {
+					continue;
+				}
+				call.call(nodes[i]);
+			}
+		}
+
+	} else if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = node_count - 1; i >= 0; i--) {
 			if (call_lock && call_skip.has(nodes[i])) {
 				continue;
 			}
 
-			if (p_call_flags & GROUP_CALL_REALTIME) {
-				nodes[i]->call(p_function, VARIANT_ARG_PASS);
-			} else {
-				MessageQueue::get_singleton()->push_call(nodes[i], p_function, VARIANT_ARG_PASS);
-			}
+			MessageQueue::get_singleton()->push_call(nodes[i], p_function, VARIANT_ARG_PASS);
 		}
 
 	} else {
@@ -259,11 +316,7 @@ void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_grou
 				continue;
 			}
 
-			if (p_call_flags & GROUP_CALL_REALTIME) {
-				nodes[i]->call(p_function, VARIANT_ARG_PASS);
-			} else {
-				MessageQueue::get_singleton()->push_call(nodes[i], p_function, VARIANT_ARG_PASS);
-			}
+			MessageQueue::get_singleton()->push_call(nodes[i], p_function, VARIANT_ARG_PASS);
 		}
 	}
 
@@ -273,6 +326,39 @@ void SceneTree::call_group_flags(uint32_t p_call_flags, const StringName &p_grou
 	}
 }
 
+MethodBind *SceneTree::GroupCall::resolve(Node *p_node) {
+	if (p_node->get_script_instance()) {
+		return nullptr; // The script may override the method.
+	}
+
+	// Groups usually hold many nodes of the same class, so resolve the method once per class.
+	const StringName &class_name = p_node->get_class_name();
+	if (class_name != last_class) {
+		last_class = class_name;
+		method = ClassDB::get_method(class_name, function);
+	}
+	return method;
+}
+
+void SceneTree::GroupCall::call(Node *p_node, MethodBind *p_method) const {
+	Callable::CallError ce;
+	if (p_method) {
+		p_method->call(p_node, args, argcount, ce);
+	} else {
+		// Scripted, or not a bound method: let Object::call() handle the rest (e.g. built-in methods like "call").
+		p_node->call(function, args, argcount, ce);
+	}
+}
+
+void SceneTree::_call_group_threaded(uint32_t p_index, GroupCall *p_call) {
+	Node *n = p_call->nodes[p_index];
+	if (call_skip.has(n)) {
+		return;
+	}
+
+	p_call->call(n, p_call->methods[p_index]);
+}
+
 void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
 	Map<StringName, Group>::Element *E = group_map.find(p_group);
 	if (!E) {
@@ -285,8 +371,8 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 
 	_update_group_order(g);
 
-	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
+	const Vector<Node *> nodes_copy = g.nodes;
+	Node *const *nodes = nodes_copy.ptr();
 	int node_count = nodes_copy.size();
 
 	call_lock++;
@@ -336,8 +422,8 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 
 	_update_group_order(g);
 
-	Vector<Node *> nodes_copy = g.nodes;
-	Node **nodes = nodes_copy.ptrw();
+	const Vector<Node *> nodes_copy = g.nodes;
+	Node *const *nodes = nodes_copy.ptr();
 	int node_count = nodes_copy.size();
 
 	call_lock++;
@@ -394,6 +480,7 @@ void SceneTree::initialize() {
 }
 
 bool SceneTree::physics_process(float p_time) {
+	CPU_PROFILE_SCOPE("SceneTree::physics_process");
 	root_lock++;
 
 	current_frame++;
@@ -405,6 +492,7 @@ bool SceneTree::physics_process(float p_time) {
 
 	emit_signal("physics_frame");
 
+	_process_node_timers(Timer::TIMER_PROCESS_PHYSICS, p_time);
 	_notify_group_pause("physics_process_internal", Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 	call_group_flags(GROUP_CALL_REALTIME, "_viewports", "_process_picking");
 	_notify_group_pause("physics_process", Node::NOTIFICATION_PHYSICS_PROCESS);
@@ -421,6 +509,7 @@ bool SceneTree::physics_process(float p_time) {
 }
 
 bool SceneTree::process(float p_time) {
+	CPU_PROFILE_SCOPE("SceneTree::process");
 	root_lock++;
 
 	MainLoop::process(p_time);
@@ -437,6 +526,7 @@ bool SceneTree::process(float p_time) {
 
 	flush_transform_notifications();
 
+	_process_node_timers(Timer::TIMER_PROCESS_IDLE, p_time);
 	_notify_group_pause("process_internal", Node::NOTIFICATION_INTERNAL_PROCESS);
 	_notify_group_pause("process", Node::NOTIFICATION_PROCESS);
 
@@ -451,30 +541,10 @@ bool SceneTree::process(float p_time) {
 
 	//go through timers
 
-	List<Ref<SceneTreeTimer>>::Element *L = timers.back(); //last element
-
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		if (pause && !E->get()->is_pause_mode_process()) {
-			if (E == L) {
-				break; //break on last, so if new timers were added during list traversal, ignore them.
-			}
-			E = N;
-			continue;
-		}
-		float time_left = E->get()->get_time_left();
-		time_left -= p_time;
-		E->get()->set_time_left(time_left);
-
-		if (time_left < 0) {
-			E->get()->emit_signal("timeout");
-			timers.erase(E);
-		}
-		if (E == L) {
-			break; //break on last, so if new timers were added during list traversal, ignore them.
-		}
-		E = N;
+	if (!pause) {
+		_process_scene_timers(0, p_time);
 	}
+	_process_scene_timers(1, p_time);
 
 	flush_transform_notifications(); //additional transforms after timers update
 
@@ -527,12 +597,56 @@ void SceneTree::finalize() {
 	}
 
 	// cleanup timers
+	_release_scene_timers();
+}
+
+void SceneTree::_start_scene_timer(SceneTreeTimer *p_timer) {
+	TimerQueue<SceneTreeTimer> &queue = scene_timers[p_timer->process_pause ? 1 : 0];
+	p_timer->deadline = queue.time + p_timer->time_left;
+	queue.insert(&p_timer->wheel_element, p_timer->deadline);
+}
+
+void SceneTree::_release_scene_timers() {
 	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E; E = E->next()) {
 		E->get()->release_connections();
+		E->get()->wheel_element.remove_from_wheel();
+		E->get()->tree = nullptr;
+		E->get()->tree_element = nullptr;
 	}
 	timers.clear();
 }
 
+void SceneTree::_process_scene_timers(int p_queue, float p_time) {
+	TimerQueue<SceneTreeTimer> &queue = scene_timers[p_queue];
+	queue.advance(p_time);
+
+	// Timers started from a timeout wait at least until the next frame, as they are placed back in the wheel.
+	while (SceneTreeTimer *timer = queue.wheel.pop_expired()) {
+		if (queue.time <= timer->deadline) {
+			// Expired with its tick, but not due yet.
+			queue.insert(&timer->wheel_element, timer->deadline);
+			continue;
+		}
+
+		Ref<SceneTreeTimer> ref = timer->tree_element->get();
+		timers.erase(timer->tree_element);
+		timer->tree = nullptr;
+		timer->tree_element = nullptr;
+		timer->time_left = timer->deadline - queue.time;
+
+		timer->emit_signal("timeout");
+	}
+}
+
+void SceneTree::_process_node_timers(int p_queue, float p_time) {
+	TimerQueue<Timer> &queue = node_timers[p_queue];
+	queue.advance(p_time);
+
+	while (Timer *timer = queue.wheel.pop_expired()) {
+		timer->_timeout();
+	}
+}
+
 void SceneTree::quit(int p_exit_code) {
 	if (p_exit_code >= 0) {
 		// Override the exit code if a positive argument is given (the default is `-1`).
@@ -789,19 +903,58 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 
 	//copy, so copy on write happens in case something is removed from process while being called
 	//performance is not lost because only if something is added/removed the vector is copied.
-	Vector<Node *> nodes_copy = g.nodes;
+	//keep the copy const, as non-const access would trigger the actual copy.
+	const Vector<Node *> nodes_copy = g.nodes;
 
 	int node_count = nodes_copy.size();
-	Node **nodes = nodes_copy.ptrw();
+	Node *const *nodes = nodes_copy.ptr();
 
 	call_lock++;
 
+	// Only the script facing callbacks can run in sub-thread groups, internal
+	// processing of engine nodes is not written to be thread-safe.
+	bool use_threads = p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS;
+	bool has_thread_groups = false;
+
+	if (use_threads) {
+		FlatHashMap<ObjectID, uint32_t> group_indices;
+		for (int i = 0; i < node_count; i++) {
+			Node *owner = nodes[i]->get_process_sub_thread_group_owner();
+			if (!owner) {
+				continue;
+			}
+			uint32_t *index = group_indices.getptr(owner->get_instance_id());
+			if (!index) {
+				group_indices.set(owner->get_instance_id(), process_thread_groups.size());
+				process_thread_groups.resize(process_thread_groups.size() + 1);
+				index = group_indices.getptr(owner->get_instance_id());
+			}
+			// Nodes are sorted by priority already, so each group keeps that order.
+			process_thread_groups[*index].push_back(nodes[i]);
+		}
+
+		has_thread_groups = process_thread_groups.size() > 0;
+		if (has_thread_groups) {
+			if (process_thread_pool.get_thread_count() == 0) {
+				process_thread_pool.init();
+			}
+			process_thread_pool.do_work(process_thread_groups.size(), this, &SceneTree::_process_thread_group, p_notification);
+			process_thread_groups.clear();
+			// Flush what the groups deferred, so the main thread nodes see it this frame.
+			MessageQueue::get_singleton()->flush();
+		}
+	}
+
 	for (int i = 0; i < node_count; i++) {
 		Node *n = nodes[i];
 		if (call_lock && call_skip.has(n)) {
 			continue;
 		}
 
+		if (has_thread_groups && n->get_process_sub_thread_group_owner()) {
+			continue;
+		}
+
 		if (!n->can_process()) {
 			continue;
 		}
@@ -819,6 +972,25 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 	}
 }
 
+void SceneTree::_process_thread_group(uint32_t p_index, int p_notification) {
+	const LocalVector<Node *> &group = process_thread_groups[p_index];
+	for (uint32_t i = 0; i < group.size(); i++) {
+		Node *n = group[i];
+		if (call_skip.has(n)) {
+			continue;
+		}
+
+		if (!n->can_process()) {
+			continue;
+		}
+		if (!n->can_process_notification(p_notification)) {
+			continue;
+		}
+
+		n->notification(p_notification);
+	}
+}
+
 /*
 void SceneMainLoop::_update_listener_2d() {
 	if (listener_2d.is_valid()) {
@@ -842,10 +1014,10 @@ void SceneTree::_call_input_pause(const StringName &p_group, const StringName &p
 
 	//copy, so copy on write happens in case something is removed from process while being called
 	//performance is not lost because only if something is added/removed the vector is copied.
-	Vector<Node *> nodes_copy = g.nodes;
+	const Vector<Node *> nodes_copy = g.nodes;
 
 	int node_count = nodes_copy.size();
-	Node **nodes = nodes_copy.ptrw();
+	Node *const *nodes = nodes_copy.ptr();
 
 	Variant arg = p_input;
 	const Variant *v[1] = { &arg };
@@ -1073,9 +1245,11 @@ void SceneTree::add_current_scene(Node *p_current) {
 Ref<SceneTreeTimer> SceneTree::create_timer(float p_delay_sec, bool p_process_pause) {
 	Ref<SceneTreeTimer> stt;
 	stt.instance();
-	stt->set_pause_mode_process(p_process_pause);
-	stt->set_time_left(p_delay_sec);
-	timers.push_back(stt);
+	stt->process_pause = p_process_pause;
+	stt->time_left = p_delay_sec;
+	stt->tree = this;
+	stt->tree_element = timers.push_back(stt);
+	_start_scene_timer(stt.ptr());
 	return stt;
 }
 
@@ -1273,6 +1447,7 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_REALTIME);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+	BIND_ENUM_CONSTANT(GROUP_CALL_THREADED);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
@@ -1364,6 +1539,15 @@ SceneTree::SceneTree() {
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/mesh_lod/threshold_pixels", PropertyInfo(Variant::FLOAT, "rendering/quality/mesh_lod/threshold_pixels", PROPERTY_HINT_RANGE, "0,1024,0.1"));
 	root->set_lod_threshold(lod_threshold);
 
+	const bool dynamic_resolution = GLOBAL_DEF("rendering/quality/dynamic_resolution/enabled", false);
+	const float dynamic_resolution_target_fps = GLOBAL_DEF("rendering/quality/dynamic_resolution/target_fps", 60.0);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/dynamic_resolution/target_fps", PropertyInfo(Variant::FLOAT, "rendering/quality/dynamic_resolution/target_fps", PROPERTY_HINT_RANGE, "1,240,1"));
+	const float dynamic_resolution_min_scale = GLOBAL_DEF("rendering/quality/dynamic_resolution/min_scale", 0.5);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/dynamic_resolution/min_scale", PropertyInfo(Variant::FLOAT, "rendering/quality/dynamic_resolution/min_scale", PROPERTY_HINT_RANGE, "0.1,1,0.05"));
+	root->set_dynamic_resolution_target_fps(dynamic_resolution_target_fps);
+	root->set_dynamic_resolution_min_scale(dynamic_resolution_min_scale);
+	root->set_dynamic_resolution_enabled(dynamic_resolution);
+
 	bool snap_2d_transforms = GLOBAL_DEF("rendering/quality/2d/snap_2d_transforms_to_pixel", false);
 	root->set_snap_2d_transforms_to_pixel(snap_2d_transforms);
 
@@ -1448,6 +1632,8 @@ SceneTree::~SceneTree() {
 		memdelete(root);
 	}
 
+	_release_scene_timers();
+
 	if (singleton == this) {
 		singleton = nullptr;
 	}
@@ -34,7 +34,10 @@
 #include "core/io/multiplayer_api.h"
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/self_list.h"
+#include "core/templates/thread_work_pool.h"
+#include "core/templates/timer_wheel.h"
 #include "scene/resources/mesh.h"
 #include "scene/resources/world_2d.h"
 #include "scene/resources/world_3d.h"
@@ -47,13 +50,23 @@ class Window;
 class Material;
 class Mesh;
 class SceneDebugger;
+class SceneTree;
+class Timer;
 
 class SceneTreeTimer : public Reference {
 	GDCLASS(SceneTreeTimer, Reference);
 
+	friend class SceneTree;
+
 	float time_left = 0.0;
 	bool process_pause = true;
 
+	// While waiting, the timer is in one of the tree's timer wheels and the time left is taken from its deadline.
+	SceneTree *tree = nullptr;
+	List<Ref<SceneTreeTimer>>::Element *tree_element = nullptr;
+	double deadline = 0.0;
+	TimerWheel<SceneTreeTimer>::Element wheel_element;
+
 protected:
 	static void _bind_methods();
 
@@ -124,6 +137,26 @@ private:
 	int call_lock = 0;
 	Set<Node *> call_skip; // Skip erased nodes.
 
+	// Nodes processed on worker threads, one list per sub-thread group, filled while notifying a process group.
+	LocalVector<LocalVector<Node *>> process_thread_groups;
+	ThreadWorkPool process_thread_pool;
+	void _process_thread_group(uint32_t p_index, int p_notification);
+
+	struct GroupCall {
+		Node *const *nodes = nullptr;
+		StringName function;
+		const Variant **args = nullptr;
+		int argcount = 0;
+		StringName last_class;
+		MethodBind *method = nullptr;
+		MethodBind *const *methods = nullptr; // Resolved per node before a threaded call.
+
+		MethodBind *resolve(Node *p_node);
+		void call(Node *p_node, MethodBind *p_method) const;
+		void call(Node *p_node) { call(p_node, resolve(p_node)); }
+	};
+	void _call_group_threaded(uint32_t p_index, GroupCall *p_call);
+
 	List<ObjectID> delete_queue;
 
 	Map<UGCall, Vector<Variant>> unique_group_calls;
@@ -150,7 +183,35 @@ private:
 	void _change_scene(Node *p_to);
 	//void _call_group(uint32_t p_call_flags,const StringName& p_group,const StringName& p_function,const Variant& p_arg1,const Variant& p_arg2);
 
-	List<Ref<SceneTreeTimer>> timers;
+	// Timer nodes and SceneTreeTimers wait in timer wheels, so a frame only touches the timers that expire in it.
+	// Queues keep their time in seconds, their wheels in ticks.
+	enum {
+		TIMER_TICKS_PER_SECOND = 1000,
+	};
+
+	template <class T>
+	struct TimerQueue {
+		double time = 0.0;
+		TimerWheel<T> wheel;
+
+		static _FORCE_INLINE_ uint64_t get_tick(double p_time) { return p_time > 0.0 ? uint64_t(p_time * TIMER_TICKS_PER_SECOND) : 0; }
+		_FORCE_INLINE_ void insert(typename TimerWheel<T>::Element *p_element, double p_deadline) { wheel.insert(p_element, get_tick(p_deadline)); }
+		_FORCE_INLINE_ void advance(double p_delta) {
+			time += p_delta;
+			wheel.advance(get_tick(time));
+		}
+	};
+
+	TimerQueue<Timer> node_timers[2]; // Indexed by Timer::TimerProcessMode.
+	TimerQueue<SceneTreeTimer> scene_timers[2]; // Stopped while paused, then processed while paused.
+	List<Ref<SceneTreeTimer>> timers; // Keeps waiting SceneTreeTimers referenced.
+
+	friend class Timer;
+	friend class SceneTreeTimer;
+	void _start_scene_timer(SceneTreeTimer *p_timer);
+	void _release_scene_timers();
+	void _process_scene_timers(int p_queue, float p_time);
+	void _process_node_timers(int p_queue, float p_time);
 
 	///network///
 
@@ -187,6 +248,7 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	uint32_t xform_flush_count = 0; // Bumped on every transform notification flush.
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -221,6 +283,7 @@ public:
 		GROUP_CALL_REVERSE = 1,
 		GROUP_CALL_REALTIME = 2,
 		GROUP_CALL_UNIQUE = 4,
+		GROUP_CALL_THREADED = 8,
 	};
 
 	_FORCE_INLINE_ Window *get_root() const { return root; }
@@ -235,6 +298,16 @@ public:
 
 	void flush_transform_notifications();
 
+	// Runs engine-side batch jobs on the process thread pool. Work issued while
+	// the pool is already busy runs serially on the calling thread.
+	template <class C, class M, class U>
+	void do_threaded_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
+		if (process_thread_pool.get_thread_count() == 0) {
+			process_thread_pool.init();
+		}
+		process_thread_pool.do_work(p_elements, p_instance, p_method, p_userdata);
+	}
+
 	virtual void initialize() override;
 
 	virtual bool physics_process(float p_time) override;
@@ -31,6 +31,7 @@
 #include "timer.h"
 
 #include "core/config/engine.h"
+#include "scene/main/scene_tree.h"
 
 void Timer::_notification(int p_what) {
 	switch (p_what) {
@@ -45,40 +46,63 @@ void Timer::_notification(int p_what) {
 				autostart = false;
 			}
 		} break;
-		case NOTIFICATION_INTERNAL_PROCESS: {
-			if (!processing || timer_process_mode == TIMER_PROCESS_PHYSICS || !is_processing_internal()) {
-				return;
-			}
-			time_left -= get_process_delta_time();
+		case NOTIFICATION_ENTER_TREE:
+		case NOTIFICATION_PAUSED:
+		case NOTIFICATION_UNPAUSED: {
+			_update_wheel();
+		} break;
+		case NOTIFICATION_EXIT_TREE: {
+			_leave_wheel();
+		} break;
+	}
+}
 
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
+void Timer::_enter_wheel() {
+	SceneTree::TimerQueue<Timer> &queue = get_tree()->node_timers[timer_process_mode];
+	deadline = queue.time + time_left;
+	queue.insert(&wheel_element, deadline);
+}
 
-				emit_signal("timeout");
-			}
+void Timer::_leave_wheel() {
+	if (!wheel_element.in_wheel()) {
+		return;
+	}
+	time_left = deadline - get_tree()->node_timers[timer_process_mode].time;
+	wheel_element.remove_from_wheel();
+}
 
-		} break;
-		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			if (!processing || timer_process_mode == TIMER_PROCESS_IDLE || !is_physics_processing_internal()) {
-				return;
-			}
-			time_left -= get_physics_process_delta_time();
+void Timer::_update_wheel() {
+	if (processing && !paused && is_inside_tree() && can_process()) {
+		if (!wheel_element.in_wheel()) {
+			_enter_wheel();
+		}
+	} else {
+		_leave_wheel();
+	}
+}
 
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
-				emit_signal("timeout");
-			}
+void Timer::_timeout() {
+	SceneTree::TimerQueue<Timer> &queue = get_tree()->node_timers[timer_process_mode];
+	time_left = deadline - queue.time;
 
-		} break;
+	if (time_left >= 0) {
+		// Expired with its tick, but not due yet.
+		queue.insert(&wheel_element, deadline);
+		return;
+	}
+	if (!can_process()) {
+		// Can't happen through pause changes (they notify), but never fire while paused.
+		return;
+	}
+
+	if (!one_shot) {
+		time_left += wait_time;
+		_enter_wheel();
+	} else {
+		stop();
 	}
+
+	emit_signal("timeout");
 }
 
 void Timer::set_wait_time(float p_time) {
@@ -112,11 +136,13 @@ void Timer::start(float p_time) {
 	if (p_time > 0) {
 		set_wait_time(p_time);
 	}
+	wheel_element.remove_from_wheel();
 	time_left = wait_time;
 	_set_process(true);
 }
 
 void Timer::stop() {
+	wheel_element.remove_from_wheel();
 	time_left = -1;
 	_set_process(false);
 	autostart = false;
@@ -128,7 +154,7 @@ void Timer::set_paused(bool p_paused) {
 	}
 
 	paused = p_paused;
-	_set_process(processing);
+	_update_wheel();
 }
 
 bool Timer::is_paused() const {
@@ -140,7 +166,8 @@ bool Timer::is_stopped() const {
 }
 
 float Timer::get_time_left() const {
-	return time_left > 0 ? time_left : 0;
+	double left = wheel_element.in_wheel() ? deadline - get_tree()->node_timers[timer_process_mode].time : time_left;
+	return left > 0 ? left : 0;
 }
 
 void Timer::set_timer_process_mode(TimerProcessMode p_mode) {
@@ -148,21 +175,9 @@ void Timer::set_timer_process_mode(TimerProcessMode p_mode) {
 		return;
 	}
 
-	switch (timer_process_mode) {
-		case TIMER_PROCESS_PHYSICS:
-			if (is_physics_processing_internal()) {
-				set_physics_process_internal(false);
-				set_process_internal(true);
-			}
-			break;
-		case TIMER_PROCESS_IDLE:
-			if (is_processing_internal()) {
-				set_process_internal(false);
-				set_physics_process_internal(true);
-			}
-			break;
-	}
+	_leave_wheel();
 	timer_process_mode = p_mode;
+	_update_wheel();
 }
 
 Timer::TimerProcessMode Timer::get_timer_process_mode() const {
@@ -170,15 +185,8 @@ Timer::TimerProcessMode Timer::get_timer_process_mode() const {
 }
 
 void Timer::_set_process(bool p_process, bool p_force) {
-	switch (timer_process_mode) {
-		case TIMER_PROCESS_PHYSICS:
-			set_physics_process_internal(p_process && !paused);
-			break;
-		case TIMER_PROCESS_IDLE:
-			set_process_internal(p_process && !paused);
-			break;
-	}
 	processing = p_process;
+	_update_wheel();
 }
 
 void Timer::_bind_methods() {
@@ -217,4 +225,6 @@ void Timer::_bind_methods() {
 	BIND_ENUM_CONSTANT(TIMER_PROCESS_IDLE);
 }
 
-Timer::Timer() {}
+Timer::Timer() :
+		wheel_element(this) {
+}
@@ -31,18 +31,30 @@
 #ifndef TIMER_H
 #define TIMER_H
 
+#include "core/templates/timer_wheel.h"
 #include "scene/main/node.h"
 
 class Timer : public Node {
 	GDCLASS(Timer, Node);
 
+	friend class SceneTree;
+
 	float wait_time = 1.0;
 	bool one_shot = false;
 	bool autostart = false;
 	bool processing = false;
 	bool paused = false;
 
+	// Running timers wait in the tree's timer wheel, which only hands them back when they expire.
+	// While waiting, the time left is taken from the deadline.
 	double time_left = -1.0;
+	double deadline = 0.0;
+	TimerWheel<Timer>::Element wheel_element;
+
+	void _enter_wheel();
+	void _leave_wheel();
+	void _update_wheel();
+	void _timeout();
 
 protected:
 	void _notification(int p_what);
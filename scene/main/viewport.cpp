@@ -1645,16 +1645,23 @@ void Viewport::_gui_call_input(Control *p_control, const Ref<InputEvent> &p_inpu
 			}
 
 			if (control->data.mouse_filter != Control::MOUSE_FILTER_IGNORE) {
-				// Call both script and native methods.
-				Callable::CallError error;
-				Variant event = ev;
-				const Variant *args[1] = { &event };
-				if (control->get_script_instance()) {
-					control->get_script_instance()->call(SceneStringNames::get_singleton()->_gui_input, args, 1, error);
+				if (!control->data.gui_input_method_cached) {
+					control->data.gui_input_method = ClassDB::get_method(control->get_class_name(), SceneStringNames::get_singleton()->_gui_input);
+					control->data.gui_input_method_cached = true;
 				}
-				MethodBind *method = ClassDB::get_method(control->get_class_name(), SceneStringNames::get_singleton()->_gui_input);
-				if (method) {
-					method->call(control, args, 1, error);
+
+				// Call both script and native methods, skipping controls that have neither.
+				ScriptInstance *script = control->get_script_instance();
+				if (script || control->data.gui_input_method) {
+					Callable::CallError error;
+					Variant event = ev;
+					const Variant *args[1] = { &event };
+					if (script) {
+						script->call(SceneStringNames::get_singleton()->_gui_input, args, 1, error);
+					}
+					if (control->data.gui_input_method) {
+						control->data.gui_input_method->call(control, args, 1, error);
+					}
 				}
 			}
 
@@ -1819,6 +1826,7 @@ bool Viewport::_gui_drop(Control *p_at_control, Point2 p_at_pos, bool p_just_che
 
 void Viewport::_gui_input_event(Ref<InputEvent> p_event) {
 	ERR_FAIL_COND(p_event.is_null());
+	MEMORY_TAG_SCOPE(TAG_GUI);
 
 	Ref<InputEventMouseButton> mb = p_event;
 	if (mb.is_valid()) {
@@ -3224,6 +3232,34 @@ float Viewport::get_lod_threshold() const {
 	return lod_threshold;
 }
 
+void Viewport::set_dynamic_resolution_enabled(bool p_enabled) {
+	dynamic_resolution_enabled = p_enabled;
+	RS::get_singleton()->viewport_set_dynamic_resolution(viewport, dynamic_resolution_enabled, dynamic_resolution_target_fps, dynamic_resolution_min_scale);
+}
+
+bool Viewport::is_dynamic_resolution_enabled() const {
+	return dynamic_resolution_enabled;
+}
+
+void Viewport::set_dynamic_resolution_target_fps(float p_fps) {
+	ERR_FAIL_COND(p_fps <= 0.0);
+	dynamic_resolution_target_fps = p_fps;
+	RS::get_singleton()->viewport_set_dynamic_resolution(viewport, dynamic_resolution_enabled, dynamic_resolution_target_fps, dynamic_resolution_min_scale);
+}
+
+float Viewport::get_dynamic_resolution_target_fps() const {
+	return dynamic_resolution_target_fps;
+}
+
+void Viewport::set_dynamic_resolution_min_scale(float p_scale) {
+	dynamic_resolution_min_scale = CLAMP(p_scale, 0.1, 1.0);
+	RS::get_singleton()->viewport_set_dynamic_resolution(viewport, dynamic_resolution_enabled, dynamic_resolution_target_fps, dynamic_resolution_min_scale);
+}
+
+float Viewport::get_dynamic_resolution_min_scale() const {
+	return dynamic_resolution_min_scale;
+}
+
 void Viewport::set_debug_draw(DebugDraw p_debug_draw) {
 	debug_draw = p_debug_draw;
 	RS::get_singleton()->viewport_set_debug_draw(viewport, RS::ViewportDebugDraw(p_debug_draw));
@@ -3543,6 +3579,13 @@ void Viewport::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_lod_threshold", "pixels"), &Viewport::set_lod_threshold);
 	ClassDB::bind_method(D_METHOD("get_lod_threshold"), &Viewport::get_lod_threshold);
 
+	ClassDB::bind_method(D_METHOD("set_dynamic_resolution_enabled", "enabled"), &Viewport::set_dynamic_resolution_enabled);
+	ClassDB::bind_method(D_METHOD("is_dynamic_resolution_enabled"), &Viewport::is_dynamic_resolution_enabled);
+	ClassDB::bind_method(D_METHOD("set_dynamic_resolution_target_fps", "fps"), &Viewport::set_dynamic_resolution_target_fps);
+	ClassDB::bind_method(D_METHOD("get_dynamic_resolution_target_fps"), &Viewport::get_dynamic_resolution_target_fps);
+	ClassDB::bind_method(D_METHOD("set_dynamic_resolution_min_scale", "scale"), &Viewport::set_dynamic_resolution_min_scale);
+	ClassDB::bind_method(D_METHOD("get_dynamic_resolution_min_scale"), &Viewport::get_dynamic_resolution_min_scale);
+
 	ClassDB::bind_method(D_METHOD("_process_picking"), &Viewport::_process_picking);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "own_world_3d"), "set_use_own_world_3d", "is_using_own_world_3d");
@@ -3558,6 +3601,10 @@ void Viewport::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_debanding"), "set_use_debanding", "is_using_debanding");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_threshold", PROPERTY_HINT_RANGE, "0,1024,0.1"), "set_lod_threshold", "get_lod_threshold");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "debug_draw", PROPERTY_HINT_ENUM, "Disabled,Unshaded,Overdraw,Wireframe"), "set_debug_draw", "get_debug_draw");
+	ADD_GROUP("Dynamic Resolution", "dynamic_resolution_");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "dynamic_resolution_enabled"), "set_dynamic_resolution_enabled", "is_dynamic_resolution_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "dynamic_resolution_target_fps", PROPERTY_HINT_RANGE, "1,240,1"), "set_dynamic_resolution_target_fps", "get_dynamic_resolution_target_fps");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "dynamic_resolution_min_scale", PROPERTY_HINT_RANGE, "0.1,1,0.05"), "set_dynamic_resolution_min_scale", "get_dynamic_resolution_min_scale");
 	ADD_GROUP("Canvas Items", "canvas_item_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "canvas_item_default_texture_filter", PROPERTY_HINT_ENUM, "Nearest,Linear,MipmapLinear,MipmapNearest"), "set_default_canvas_item_texture_filter", "get_default_canvas_item_texture_filter");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "canvas_item_default_texture_repeat", PROPERTY_HINT_ENUM, "Disabled,Enabled,Mirror"), "set_default_canvas_item_texture_repeat", "get_default_canvas_item_texture_repeat");
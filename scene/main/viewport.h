@@ -305,6 +305,10 @@ private:
 	bool use_debanding = false;
 	float lod_threshold = 1.0;
 
+	bool dynamic_resolution_enabled = false;
+	float dynamic_resolution_target_fps = 60.0;
+	float dynamic_resolution_min_scale = 0.5;
+
 	Ref<ViewportTexture> default_texture;
 	Set<ViewportTexture *> viewport_textures;
 
@@ -555,6 +559,15 @@ public:
 	void set_lod_threshold(float p_pixels);
 	float get_lod_threshold() const;
 
+	void set_dynamic_resolution_enabled(bool p_enabled);
+	bool is_dynamic_resolution_enabled() const;
+
+	void set_dynamic_resolution_target_fps(float p_fps);
+	float get_dynamic_resolution_target_fps() const;
+
+	void set_dynamic_resolution_min_scale(float p_scale);
+	float get_dynamic_resolution_min_scale() const;
+
 	Vector2 get_camera_coords(const Vector2 &p_viewport_coords) const;
 	Vector2 get_camera_rect_size() const;
 
@@ -223,6 +223,7 @@
 #include "scene/3d/spring_arm_3d.h"
 #include "scene/3d/sprite_3d.h"
 #include "scene/3d/vehicle_body_3d.h"
+#include "scene/3d/vertex_animation.h"
 #include "scene/3d/visibility_notifier_3d.h"
 #include "scene/3d/world_environment.h"
 #include "scene/3d/xr_nodes.h"
@@ -444,6 +445,7 @@ void register_scene_types() {
 	ClassDB::register_class<XRAnchor3D>();
 	ClassDB::register_class<XROrigin3D>();
 	ClassDB::register_class<MeshInstance3D>();
+	ClassDB::register_class<VertexAnimation>();
 	ClassDB::register_class<ImmediateGeometry3D>();
 	ClassDB::register_virtual_class<SpriteBase3D>();
 	ClassDB::register_class<Sprite3D>();
@@ -725,6 +727,7 @@ void register_scene_types() {
 	ClassDB::register_virtual_class<Texture2D>();
 	ClassDB::register_class<Sky>();
 	ClassDB::register_class<StreamTexture2D>();
+	StreamTexture2D::initialize_streaming();
 	ClassDB::register_class<ImageTexture>();
 	ClassDB::register_class<AtlasTexture>();
 	ClassDB::register_class<MeshTexture>();
@@ -1028,5 +1031,7 @@ void unregister_scene_types() {
 
 	ParticlesMaterial::finish_shaders();
 	CanvasItemMaterial::finish_shaders();
+	StreamTexture2D::finish_streaming();
+	HTTPRequest::clear_connection_pool();
 	SceneStringNames::free();
 }
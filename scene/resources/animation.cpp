@@ -74,6 +74,14 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 			track_set_imported(track, p_value);
 		} else if (what == "enabled") {
 			track_set_enabled(track, p_value);
+		} else if (what == "compressed") {
+			ERR_FAIL_COND_V(track_get_type(track) != TYPE_TRANSFORM, false);
+			TransformTrack *tt = static_cast<TransformTrack *>(tracks[track]);
+			if (p_value) {
+				_transform_track_compress(tt);
+			} else {
+				_transform_track_decompress(tt);
+			}
 		} else if (what == "keys" || what == "key_values") {
 			if (track_get_type(track) == TYPE_TRANSFORM) {
 				TransformTrack *tt = static_cast<TransformTrack *>(tracks[track]);
@@ -83,6 +91,8 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 
 				const float *r = values.ptr();
 
+				tt->compressed = false;
+				tt->compressed_keys = CompressedTransformKeys();
 				tt->transforms.resize(vcount / 12);
 
 				for (int i = 0; i < (vcount / 12); i++) {
@@ -350,6 +360,8 @@ bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
 			r_ret = track_is_imported(track);
 		} else if (what == "enabled") {
 			r_ret = track_is_enabled(track);
+		} else if (what == "compressed") {
+			r_ret = track_is_compressed(track);
 		} else if (what == "keys") {
 			if (track_get_type(track) == TYPE_TRANSFORM) {
 				Vector<float> keys;
@@ -577,6 +589,9 @@ void Animation::_get_property_list(List<PropertyInfo> *p_list) const {
 		p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/imported", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/enabled", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::ARRAY, "tracks/" + itos(i) + "/keys", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		if (track_is_compressed(i)) {
+			p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/compressed", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		}
 	}
 }
 
@@ -779,16 +794,24 @@ Error Animation::transform_track_get_key(int p_track, int p_key, Vector3 *r_loc,
 
 	TransformTrack *tt = static_cast<TransformTrack *>(t);
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, ERR_INVALID_PARAMETER);
-	ERR_FAIL_INDEX_V(p_key, tt->transforms.size(), ERR_INVALID_PARAMETER);
+
+	TransformKey tk;
+	if (tt->compressed) {
+		ERR_FAIL_INDEX_V(p_key, tt->compressed_keys.keys.size(), ERR_INVALID_PARAMETER);
+		tk = _get_compressed_transform_key(tt->compressed_keys, p_key);
+	} else {
+		ERR_FAIL_INDEX_V(p_key, tt->transforms.size(), ERR_INVALID_PARAMETER);
+		tk = tt->transforms[p_key].value;
+	}
 
 	if (r_loc) {
-		*r_loc = tt->transforms[p_key].value.loc;
+		*r_loc = tk.loc;
 	}
 	if (r_rot) {
-		*r_rot = tt->transforms[p_key].value.rot;
+		*r_rot = tk.rot;
 	}
 	if (r_scale) {
-		*r_scale = tt->transforms[p_key].value.scale;
+		*r_scale = tk.scale;
 	}
 
 	return OK;
@@ -800,6 +823,7 @@ int Animation::transform_track_insert_key(int p_track, float p_time, const Vecto
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, -1);
 
 	TransformTrack *tt = static_cast<TransformTrack *>(t);
+	_transform_track_decompress(tt);
 
 	TKey<TransformKey> tkey;
 	tkey.time = p_time;
@@ -825,6 +849,7 @@ void Animation::track_remove_key(int p_track, int p_idx) {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_idx, tt->transforms.size());
 			tt->transforms.remove(p_idx);
 
@@ -871,6 +896,17 @@ int Animation::track_find_key(int p_track, float p_time, bool p_exact) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				const Vector<Key> &keys = tt->compressed_keys.keys;
+				int k = _find(keys, p_time);
+				if (k < 0 || k >= keys.size()) {
+					return -1;
+				}
+				if (keys[k].time != p_time && p_exact) {
+					return -1;
+				}
+				return k;
+			}
 			int k = _find(tt->transforms, p_time);
 			if (k < 0 || k >= tt->transforms.size()) {
 				return -1;
@@ -1055,6 +1091,9 @@ int Animation::track_get_key_count(int p_track) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				return tt->compressed_keys.keys.size();
+			}
 			return tt->transforms.size();
 		} break;
 		case TYPE_VALUE: {
@@ -1090,12 +1129,19 @@ Variant Animation::track_get_key_value(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
-			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), Variant());
+			TransformKey tk;
+			if (tt->compressed) {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->compressed_keys.keys.size(), Variant());
+				tk = _get_compressed_transform_key(tt->compressed_keys, p_key_idx);
+			} else {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), Variant());
+				tk = tt->transforms[p_key_idx].value;
+			}
 
 			Dictionary d;
-			d["location"] = tt->transforms[p_key_idx].value.loc;
-			d["rotation"] = tt->transforms[p_key_idx].value.rot;
-			d["scale"] = tt->transforms[p_key_idx].value.scale;
+			d["location"] = tk.loc;
+			d["rotation"] = tk.rot;
+			d["scale"] = tk.scale;
 
 			return d;
 		} break;
@@ -1158,6 +1204,10 @@ float Animation::track_get_key_time(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->compressed_keys.keys.size(), -1);
+				return tt->compressed_keys.keys[p_key_idx].time;
+			}
 			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), -1);
 			return tt->transforms[p_key_idx].time;
 		} break;
@@ -1203,6 +1253,7 @@ void Animation::track_set_key_time(int p_track, int p_key_idx, float p_time) {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 			TKey<TransformKey> key = tt->transforms[p_key_idx];
 			key.time = p_time;
@@ -1267,6 +1318,10 @@ float Animation::track_get_key_transition(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed) {
+				ERR_FAIL_INDEX_V(p_key_idx, tt->compressed_keys.keys.size(), -1);
+				return tt->compressed_keys.keys[p_key_idx].transition;
+			}
 			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), -1);
 			return tt->transforms[p_key_idx].transition;
 		} break;
@@ -1303,6 +1358,7 @@ void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 
 			Dictionary d = p_value;
@@ -1386,6 +1442,7 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, float p_tra
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 			tt->transforms.write[p_key_idx].transition = p_transition;
 		} break;
@@ -1583,28 +1640,25 @@ float Animation::_cubic_interpolate(const float &p_pre_a, const float &p_a, cons
 	return _interpolate(p_a, p_b, p_c);
 }
 
-template <class T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
+template <class K>
+bool Animation::_find_interpolation(const Vector<K> &p_keys, float p_time, bool p_loop_wrap, int &r_idx, int &r_next, float &r_c, int &r_len) const {
 	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
 
+	r_len = len;
+
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
 		// meaning no keys, or only key time is larger than length
-		if (p_ok) {
-			*p_ok = false;
-		}
-		return T();
+		return false;
 	} else if (len == 1) { // one key found (0+1), return it
-
-		if (p_ok) {
-			*p_ok = true;
-		}
-		return p_keys[0].value;
+		r_idx = r_next = 0;
+		r_c = 0.0;
+		return true;
 	}
 
 	int idx = _find(p_keys, p_time);
 
-	ERR_FAIL_COND_V(idx == -2, T());
+	ERR_FAIL_COND_V(idx == -2, false);
 
 	bool result = true;
 	int next = 0;
@@ -1683,6 +1737,21 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 		}
 	}
 
+	r_idx = idx;
+	r_next = next;
+	r_c = c;
+	return result;
+}
+
+template <class T>
+T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
+	int idx = 0;
+	int next = 0;
+	float c = 0.0;
+	int len = 0;
+
+	bool result = _find_interpolation(p_keys, p_time, p_loop_wrap, idx, next, c, len);
+
 	if (p_ok) {
 		*p_ok = result;
 	}
@@ -1728,6 +1797,48 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 	// do a barrel roll
 }
 
+Animation::TransformKey Animation::_interpolate(const CompressedTransformKeys &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
+	int idx = 0;
+	int next = 0;
+	float c = 0.0;
+	int len = 0;
+
+	bool result = _find_interpolation(p_keys.keys, p_time, p_loop_wrap, idx, next, c, len);
+
+	if (p_ok) {
+		*p_ok = result;
+	}
+	if (!result) {
+		return TransformKey();
+	}
+
+	// Only the keys actually involved in the blend are dequantized.
+	float tr = p_keys.keys[idx].transition;
+
+	if (tr == 0 || idx == next || p_interp == INTERPOLATION_NEAREST) {
+		return _get_compressed_transform_key(p_keys, idx);
+	}
+
+	if (tr != 1.0) {
+		c = Math::ease(c, tr);
+	}
+
+	if (p_interp == INTERPOLATION_CUBIC) {
+		int pre = idx - 1;
+		if (pre < 0) {
+			pre = 0;
+		}
+		int post = next + 1;
+		if (post >= len) {
+			post = next;
+		}
+
+		return _cubic_interpolate(_get_compressed_transform_key(p_keys, pre), _get_compressed_transform_key(p_keys, idx), _get_compressed_transform_key(p_keys, next), _get_compressed_transform_key(p_keys, post), c);
+	}
+
+	return _interpolate(_get_compressed_transform_key(p_keys, idx), _get_compressed_transform_key(p_keys, next), c);
+}
+
 Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
@@ -1737,7 +1848,12 @@ Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3
 
 	bool ok = false;
 
-	TransformKey tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	TransformKey tk;
+	if (tt->compressed) {
+		tk = _interpolate(tt->compressed_keys, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	} else {
+		tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	}
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1934,8 +2050,13 @@ void Animation::track_get_key_indices_in_range(int p_track, float p_time, float
 			switch (t->type) {
 				case TYPE_TRANSFORM: {
 					const TransformTrack *tt = static_cast<const TransformTrack *>(t);
-					_track_get_key_indices_in_range(tt->transforms, from_time, length, p_indices);
-					_track_get_key_indices_in_range(tt->transforms, 0, to_time, p_indices);
+					if (tt->compressed) {
+						_track_get_key_indices_in_range(tt->compressed_keys.keys, from_time, length, p_indices);
+						_track_get_key_indices_in_range(tt->compressed_keys.keys, 0, to_time, p_indices);
+					} else {
+						_track_get_key_indices_in_range(tt->transforms, from_time, length, p_indices);
+						_track_get_key_indices_in_range(tt->transforms, 0, to_time, p_indices);
+					}
 
 				} break;
 				case TYPE_VALUE: {
@@ -1990,7 +2111,11 @@ void Animation::track_get_key_indices_in_range(int p_track, float p_time, float
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			const TransformTrack *tt = static_cast<const TransformTrack *>(t);
-			_track_get_key_indices_in_range(tt->transforms, from_time, to_time, p_indices);
+			if (tt->compressed) {
+				_track_get_key_indices_in_range(tt->compressed_keys.keys, from_time, to_time, p_indices);
+			} else {
+				_track_get_key_indices_in_range(tt->transforms, from_time, to_time, p_indices);
+			}
 
 		} break;
 		case TYPE_VALUE: {
@@ -2673,6 +2798,8 @@ void Animation::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("clear"), &Animation::clear);
 	ClassDB::bind_method(D_METHOD("copy_track", "track_idx", "to_animation"), &Animation::copy_track);
+	ClassDB::bind_method(D_METHOD("compress"), &Animation::compress);
+	ClassDB::bind_method(D_METHOD("track_is_compressed", "track_idx"), &Animation::track_is_compressed);
 
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "length", PROPERTY_HINT_RANGE, "0.001,99999,0.001"), "set_length", "get_length");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "loop"), "set_loop", "has_loop");
@@ -2879,6 +3006,7 @@ void Animation::_transform_track_optimize(int p_idx, float p_allowed_linear_err,
 	ERR_FAIL_INDEX(p_idx, tracks.size());
 	ERR_FAIL_COND(tracks[p_idx]->type != TYPE_TRANSFORM);
 	TransformTrack *tt = static_cast<TransformTrack *>(tracks[p_idx]);
+	_transform_track_decompress(tt);
 	bool prev_erased = false;
 	TKey<TransformKey> first_erased;
 
@@ -2923,6 +3051,161 @@ void Animation::optimize(float p_allowed_linear_err, float p_allowed_angular_err
 	}
 }
 
+static _FORCE_INLINE_ uint16_t _quantize_unsigned(float p_value, float p_min, float p_step) {
+	if (p_step == 0.0) {
+		return 0;
+	}
+	return (uint16_t)CLAMP(Math::fast_ftoi((p_value - p_min) / p_step), 0, 65535);
+}
+
+static _FORCE_INLINE_ int16_t _quantize_signed(float p_value) {
+	return (int16_t)CLAMP(Math::fast_ftoi(p_value * 32767.0), -32767, 32767);
+}
+
+Animation::TransformKey Animation::_get_compressed_transform_key(const CompressedTransformKeys &p_keys, int p_idx) const {
+	TransformKey tk;
+
+	if (p_keys.loc.is_empty()) {
+		tk.loc = p_keys.loc_min;
+	} else {
+		const uint16_t *l = &p_keys.loc[p_idx * 3];
+		tk.loc = p_keys.loc_min + p_keys.loc_step * Vector3(l[0], l[1], l[2]);
+	}
+
+	if (p_keys.rot.is_empty()) {
+		tk.rot = p_keys.rot_constant;
+	} else {
+		const int16_t *r = &p_keys.rot[p_idx * 4];
+		tk.rot = Quat(r[0], r[1], r[2], r[3]).normalized();
+	}
+
+	if (p_keys.scale.is_empty()) {
+		tk.scale = p_keys.scale_min;
+	} else {
+		const uint16_t *sc = &p_keys.scale[p_idx * 3];
+		tk.scale = p_keys.scale_min + p_keys.scale_step * Vector3(sc[0], sc[1], sc[2]);
+	}
+
+	return tk;
+}
+
+void Animation::_transform_track_compress(TransformTrack *p_track) {
+	int count = p_track->transforms.size();
+	if (p_track->compressed || count == 0) {
+		return;
+	}
+
+	const TKey<TransformKey> *src = p_track->transforms.ptr();
+	CompressedTransformKeys &c = p_track->compressed_keys;
+	c = CompressedTransformKeys();
+
+	c.keys.resize(count);
+	Vector3 loc_max = src[0].value.loc;
+	Vector3 scale_max = src[0].value.scale;
+	c.loc_min = loc_max;
+	c.scale_min = scale_max;
+	c.rot_constant = src[0].value.rot;
+	bool rot_constant = true;
+
+	for (int i = 0; i < count; i++) {
+		c.keys.write[i].time = src[i].time;
+		c.keys.write[i].transition = src[i].transition;
+
+		for (int j = 0; j < 3; j++) {
+			c.loc_min[j] = MIN(c.loc_min[j], src[i].value.loc[j]);
+			loc_max[j] = MAX(loc_max[j], src[i].value.loc[j]);
+			c.scale_min[j] = MIN(c.scale_min[j], src[i].value.scale[j]);
+			scale_max[j] = MAX(scale_max[j], src[i].value.scale[j]);
+		}
+		if (!src[i].value.rot.is_equal_approx(c.rot_constant)) {
+			rot_constant = false;
+		}
+	}
+
+	// Channels whose range is below epsilon are stored as a single value.
+	bool loc_constant = true;
+	bool scale_constant = true;
+	for (int j = 0; j < 3; j++) {
+		float loc_range = loc_max[j] - c.loc_min[j];
+		c.loc_step[j] = loc_range > CMP_EPSILON ? loc_range / 65535.0 : 0.0;
+		loc_constant = loc_constant && c.loc_step[j] == 0.0;
+
+		float scale_range = scale_max[j] - c.scale_min[j];
+		c.scale_step[j] = scale_range > CMP_EPSILON ? scale_range / 65535.0 : 0.0;
+		scale_constant = scale_constant && c.scale_step[j] == 0.0;
+	}
+
+	if (!loc_constant) {
+		c.loc.resize(count * 3);
+		uint16_t *w = c.loc.ptrw();
+		for (int i = 0; i < count; i++) {
+			for (int j = 0; j < 3; j++) {
+				w[i * 3 + j] = _quantize_unsigned(src[i].value.loc[j], c.loc_min[j], c.loc_step[j]);
+			}
+		}
+	}
+
+	if (!rot_constant) {
+		c.rot.resize(count * 4);
+		int16_t *w = c.rot.ptrw();
+		for (int i = 0; i < count; i++) {
+			Quat q = src[i].value.rot.normalized();
+			w[i * 4 + 0] = _quantize_signed(q.x);
+			w[i * 4 + 1] = _quantize_signed(q.y);
+			w[i * 4 + 2] = _quantize_signed(q.z);
+			w[i * 4 + 3] = _quantize_signed(q.w);
+		}
+	}
+
+	if (!scale_constant) {
+		c.scale.resize(count * 3);
+		uint16_t *w = c.scale.ptrw();
+		for (int i = 0; i < count; i++) {
+			for (int j = 0; j < 3; j++) {
+				w[i * 3 + j] = _quantize_unsigned(src[i].value.scale[j], c.scale_min[j], c.scale_step[j]);
+			}
+		}
+	}
+
+	p_track->transforms.clear();
+	p_track->compressed = true;
+}
+
+void Animation::_transform_track_decompress(TransformTrack *p_track) {
+	if (!p_track->compressed) {
+		return;
+	}
+
+	const CompressedTransformKeys &c = p_track->compressed_keys;
+	p_track->transforms.resize(c.keys.size());
+	for (int i = 0; i < c.keys.size(); i++) {
+		TKey<TransformKey> &tk = p_track->transforms.write[i];
+		tk.time = c.keys[i].time;
+		tk.transition = c.keys[i].transition;
+		tk.value = _get_compressed_transform_key(c, i);
+	}
+
+	p_track->compressed = false;
+	p_track->compressed_keys = CompressedTransformKeys();
+}
+
+void Animation::compress() {
+	for (int i = 0; i < tracks.size(); i++) {
+		if (tracks[i]->type == TYPE_TRANSFORM) {
+			_transform_track_compress(static_cast<TransformTrack *>(tracks[i]));
+		}
+	}
+	emit_changed();
+}
+
+bool Animation::track_is_compressed(int p_track) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
+	if (tracks[p_track]->type != TYPE_TRANSFORM) {
+		return false;
+	}
+	return static_cast<const TransformTrack *>(tracks[p_track])->compressed;
+}
+
 Animation::Animation() {}
 
 Animation::~Animation() {
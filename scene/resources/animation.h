@@ -94,8 +94,28 @@ private:
 
 	/* TRANSFORM TRACK */
 
+	// Quantized storage for transform tracks. Each channel is either a single
+	// constant value (its array is left empty) or a 16-bit value per component
+	// and key, which cuts a key from 48 bytes to at most 28.
+	struct CompressedTransformKeys {
+		Vector<Key> keys;
+
+		Vector3 loc_min;
+		Vector3 loc_step;
+		Vector<uint16_t> loc;
+
+		Quat rot_constant;
+		Vector<int16_t> rot;
+
+		Vector3 scale_min;
+		Vector3 scale_step;
+		Vector<uint16_t> scale;
+	};
+
 	struct TransformTrack : public Track {
 		Vector<TKey<TransformKey>> transforms;
+		bool compressed = false;
+		CompressedTransformKeys compressed_keys; // Used instead of transforms when compressed.
 
 		TransformTrack() { type = TYPE_TRANSFORM; }
 	};
@@ -196,8 +216,16 @@ private:
 	_FORCE_INLINE_ Variant _cubic_interpolate(const Variant &p_pre_a, const Variant &p_a, const Variant &p_b, const Variant &p_post_b, float p_c) const;
 	_FORCE_INLINE_ float _cubic_interpolate(const float &p_pre_a, const float &p_a, const float &p_b, const float &p_post_b, float p_c) const;
 
+	template <class K>
+	_FORCE_INLINE_ bool _find_interpolation(const Vector<K> &p_keys, float p_time, bool p_loop_wrap, int &r_idx, int &r_next, float &r_c, int &r_len) const;
+
 	template <class T>
 	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const;
+	_FORCE_INLINE_ TransformKey _interpolate(const CompressedTransformKeys &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const;
+
+	TransformKey _get_compressed_transform_key(const CompressedTransformKeys &p_keys, int p_idx) const;
+	void _transform_track_compress(TransformTrack *p_track);
+	void _transform_track_decompress(TransformTrack *p_track);
 
 	template <class T>
 	_FORCE_INLINE_ void _track_get_key_indices_in_range(const Vector<T> &p_array, float from_time, float to_time, List<int> *p_indices) const;
@@ -349,6 +377,9 @@ public:
 
 	void optimize(float p_allowed_linear_err = 0.05, float p_allowed_angular_err = 0.01, float p_max_optimizable_angle = Math_PI * 0.125);
 
+	void compress();
+	bool track_is_compressed(int p_track) const;
+
 	Animation();
 	~Animation();
 };
@@ -531,6 +531,22 @@ void Curve::_bind_methods() {
 	BIND_ENUM_CONSTANT(TANGENT_MODE_COUNT);
 }
 
+// Lower bounds of the distance to the baked segments in a chunk.
+static _FORCE_INLINE_ float _rect_distance_squared(const Rect2 &p_rect, const Vector2 &p_point) {
+	Vector2 end = p_rect.position + p_rect.size;
+	Vector2 d = Vector2(MAX(MAX(p_rect.position.x - p_point.x, p_point.x - end.x), 0.0f), MAX(MAX(p_rect.position.y - p_point.y, p_point.y - end.y), 0.0f));
+	return d.length_squared();
+}
+
+static _FORCE_INLINE_ float _aabb_distance_squared(const AABB &p_aabb, const Vector3 &p_point) {
+	Vector3 end = p_aabb.position + p_aabb.size;
+	Vector3 d;
+	for (int i = 0; i < 3; i++) {
+		d[i] = MAX(MAX(p_aabb.position[i] - p_point[i], p_point[i] - end[i]), 0.0f);
+	}
+	return d.length_squared();
+}
+
 int Curve2D::get_point_count() const {
 	return points.size();
 }
@@ -546,7 +562,7 @@ void Curve2D::add_point(const Vector2 &p_pos, const Vector2 &p_in, const Vector2
 		points.push_back(n);
 	}
 
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_atpos >= 0 && p_atpos < points.size() - 1 ? p_atpos : points.size() - 1);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -554,7 +570,7 @@ void Curve2D::set_point_position(int p_index, const Vector2 &p_pos) {
 	ERR_FAIL_INDEX(p_index, points.size());
 
 	points.write[p_index].pos = p_pos;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -567,7 +583,7 @@ void Curve2D::set_point_in(int p_index, const Vector2 &p_in) {
 	ERR_FAIL_INDEX(p_index, points.size());
 
 	points.write[p_index].in = p_in;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -580,7 +596,7 @@ void Curve2D::set_point_out(int p_index, const Vector2 &p_out) {
 	ERR_FAIL_INDEX(p_index, points.size());
 
 	points.write[p_index].out = p_out;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index + 1);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -592,14 +608,14 @@ Vector2 Curve2D::get_point_out(int p_index) const {
 void Curve2D::remove_point(int p_index) {
 	ERR_FAIL_INDEX(p_index, points.size());
 	points.remove(p_index);
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
 void Curve2D::clear_points() {
 	if (!points.is_empty()) {
 		points.clear();
-		baked_cache_dirty = true;
+		_mark_baked_dirty(0);
 		emit_signal(CoreStringNames::get_singleton()->changed);
 	}
 }
@@ -652,31 +668,50 @@ void Curve2D::_bake_segment2d(Map<float, Vector2> &r_bake, float p_begin, float
 	}
 }
 
+void Curve2D::_mark_baked_dirty(int p_point) {
+	// Moving a point changes the segments on both sides of it.
+	baked_dirty_from = MIN(baked_dirty_from, MAX(p_point - 1, 0));
+	baked_cache_dirty = true;
+}
+
 void Curve2D::_bake() const {
 	if (!baked_cache_dirty) {
 		return;
 	}
 
+	int from = baked_dirty_from;
+	baked_dirty_from = points.size();
 	baked_max_ofs = 0;
 	baked_cache_dirty = false;
 
-	if (points.size() == 0) {
-		baked_point_cache.resize(0);
+	if (points.size() < 2) {
+		baked_point_cache.resize(points.size());
+		if (points.size() == 1) {
+			baked_point_cache.set(0, points[0].pos);
+		}
+		baked_segment_starts.clear();
+		baked_chunk_bounds.clear();
 		return;
 	}
 
-	if (points.size() == 1) {
+	// Baking is sequential, every segment only depends on the last point baked before it.
+	// So the points of the segments before the first edited one can be kept.
+	if (from < 1 || from >= int(baked_segment_starts.size())) {
+		from = 0;
 		baked_point_cache.resize(1);
 		baked_point_cache.set(0, points[0].pos);
-		return;
+		baked_segment_starts.clear();
+	} else {
+		baked_point_cache.resize(baked_segment_starts[from]);
+		baked_segment_starts.resize(from);
 	}
 
-	Vector2 pos = points[0].pos;
-	List<Vector2> pointlist;
+	int first_changed = baked_point_cache.size();
+	Vector2 pos = baked_point_cache[first_changed - 1];
 
-	pointlist.push_back(pos); //start always from origin
+	for (int i = from; i < points.size() - 1; i++) {
+		baked_segment_starts.push_back(baked_point_cache.size());
 
-	for (int i = 0; i < points.size() - 1; i++) {
 		float step = 0.1; // at least 10 substeps ought to be enough?
 		float p = 0.0;
 
@@ -712,26 +747,35 @@ void Curve2D::_bake() const {
 
 				pos = npp;
 				p = mid;
-				pointlist.push_back(pos);
+				baked_point_cache.push_back(pos);
 			} else {
 				p = np;
 			}
 		}
 	}
 
+	// Points added at the end resume baking from here.
+	baked_segment_starts.push_back(baked_point_cache.size());
+
 	Vector2 lastpos = points[points.size() - 1].pos;
 
 	float rem = pos.distance_to(lastpos);
-	baked_max_ofs = (pointlist.size() - 1) * bake_interval + rem;
-	pointlist.push_back(lastpos);
-
-	baked_point_cache.resize(pointlist.size());
-	Vector2 *w = baked_point_cache.ptrw();
-	int idx = 0;
+	baked_max_ofs = (baked_point_cache.size() - 1) * bake_interval + rem;
+	baked_point_cache.push_back(lastpos);
 
-	for (List<Vector2>::Element *E = pointlist.front(); E; E = E->next()) {
-		w[idx] = E->get();
-		idx++;
+	// Update the bounds of the chunks with changed segments, the segment ending at the first changed point included.
+	int pc = baked_point_cache.size();
+	const Vector2 *r = baked_point_cache.ptr();
+	int chunk_count = (pc - 1 + BAKED_CHUNK_SIZE - 1) / BAKED_CHUNK_SIZE;
+	int first_chunk = MIN(int(baked_chunk_bounds.size()), (first_changed - 1) / BAKED_CHUNK_SIZE);
+	baked_chunk_bounds.resize(chunk_count);
+	for (int i = first_chunk; i < chunk_count; i++) {
+		int end = MIN((i + 1) * BAKED_CHUNK_SIZE, pc - 1);
+		Rect2 bounds(r[i * BAKED_CHUNK_SIZE], Vector2());
+		for (int j = i * BAKED_CHUNK_SIZE + 1; j <= end; j++) {
+			bounds.expand_to(r[j]);
+		}
+		baked_chunk_bounds[i] = bounds;
 	}
 }
 
@@ -798,7 +842,7 @@ PackedVector2Array Curve2D::get_baked_points() const {
 
 void Curve2D::set_bake_interval(float p_tolerance) {
 	bake_interval = p_tolerance;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(0);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -806,9 +850,53 @@ float Curve2D::get_bake_interval() const {
 	return bake_interval;
 }
 
-Vector2 Curve2D::get_closest_point(const Vector2 &p_to_point) const {
-	// Brute force method
+void Curve2D::_get_closest(const Vector2 &p_to_point, Vector2 &r_point, float &r_offset) const {
+	int pc = baked_point_cache.size();
+	const Vector2 *r = baked_point_cache.ptr();
+
+	float nearest_dist = -1.0f;
+	int nearest_segment = -1;
+
+	// Chunks are visited from the closest one, which gives a good bound to skip most of the others right away.
+	int chunk_count = baked_chunk_bounds.size();
+	int closest_chunk = 0;
+	float closest_chunk_dist = -1.0f;
+	for (int i = 0; i < chunk_count; i++) {
+		float dist = _rect_distance_squared(baked_chunk_bounds[i], p_to_point);
+		if (closest_chunk_dist < 0.0f || dist < closest_chunk_dist) {
+			closest_chunk = i;
+			closest_chunk_dist = dist;
+		}
+	}
+
+	for (int c = -1; c < chunk_count; c++) {
+		int chunk = c < 0 ? closest_chunk : c;
+		if (c == closest_chunk || (nearest_dist >= 0.0f && _rect_distance_squared(baked_chunk_bounds[chunk], p_to_point) > nearest_dist)) {
+			continue;
+		}
+
+		int end = MIN((chunk + 1) * BAKED_CHUNK_SIZE, pc - 1);
+		for (int i = chunk * BAKED_CHUNK_SIZE; i < end; i++) {
+			Vector2 origin = r[i];
+			Vector2 direction = (r[i + 1] - origin) / bake_interval;
+
+			float d = CLAMP((p_to_point - origin).dot(direction), 0.0f, bake_interval);
+			Vector2 proj = origin + direction * d;
 
+			float dist = proj.distance_squared_to(p_to_point);
+
+			// Ties go to the first segment, as when going through them in order.
+			if (nearest_dist < 0.0f || dist < nearest_dist || (dist == nearest_dist && i < nearest_segment)) {
+				r_point = proj;
+				r_offset = i * bake_interval + d;
+				nearest_dist = dist;
+				nearest_segment = i;
+			}
+		}
+	}
+}
+
+Vector2 Curve2D::get_closest_point(const Vector2 &p_to_point) const {
 	if (baked_cache_dirty) {
 		_bake();
 	}
@@ -821,32 +909,13 @@ Vector2 Curve2D::get_closest_point(const Vector2 &p_to_point) const {
 		return baked_point_cache.get(0);
 	}
 
-	const Vector2 *r = baked_point_cache.ptr();
-
 	Vector2 nearest;
-	float nearest_dist = -1.0f;
-
-	for (int i = 0; i < pc - 1; i++) {
-		Vector2 origin = r[i];
-		Vector2 direction = (r[i + 1] - origin) / bake_interval;
-
-		float d = CLAMP((p_to_point - origin).dot(direction), 0.0f, bake_interval);
-		Vector2 proj = origin + direction * d;
-
-		float dist = proj.distance_squared_to(p_to_point);
-
-		if (nearest_dist < 0.0f || dist < nearest_dist) {
-			nearest = proj;
-			nearest_dist = dist;
-		}
-	}
-
+	float offset = 0.0f;
+	_get_closest(p_to_point, nearest, offset);
 	return nearest;
 }
 
 float Curve2D::get_closest_offset(const Vector2 &p_to_point) const {
-	// Brute force method
-
 	if (baked_cache_dirty) {
 		_bake();
 	}
@@ -859,30 +928,10 @@ float Curve2D::get_closest_offset(const Vector2 &p_to_point) const {
 		return 0.0f;
 	}
 
-	const Vector2 *r = baked_point_cache.ptr();
-
-	float nearest = 0.0f;
-	float nearest_dist = -1.0f;
+	Vector2 nearest;
 	float offset = 0.0f;
-
-	for (int i = 0; i < pc - 1; i++) {
-		Vector2 origin = r[i];
-		Vector2 direction = (r[i + 1] - origin) / bake_interval;
-
-		float d = CLAMP((p_to_point - origin).dot(direction), 0.0f, bake_interval);
-		Vector2 proj = origin + direction * d;
-
-		float dist = proj.distance_squared_to(p_to_point);
-
-		if (nearest_dist < 0.0f || dist < nearest_dist) {
-			nearest = offset + d;
-			nearest_dist = dist;
-		}
-
-		offset += bake_interval;
-	}
-
-	return nearest;
+	_get_closest(p_to_point, nearest, offset);
+	return offset;
 }
 
 Dictionary Curve2D::_get_data() const {
@@ -918,7 +967,7 @@ void Curve2D::_set_data(const Dictionary &p_data) {
 		points.write[i].pos = r[i * 3 + 2];
 	}
 
-	baked_cache_dirty = true;
+	_mark_baked_dirty(0);
 }
 
 PackedVector2Array Curve2D::tessellate(int p_max_stages, float p_tolerance) const {
@@ -1015,7 +1064,7 @@ void Curve3D::add_point(const Vector3 &p_pos, const Vector3 &p_in, const Vector3
 		points.push_back(n);
 	}
 
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_atpos >= 0 && p_atpos < points.size() - 1 ? p_atpos : points.size() - 1);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -1023,7 +1072,7 @@ void Curve3D::set_point_position(int p_index, const Vector3 &p_pos) {
 	ERR_FAIL_INDEX(p_index, points.size());
 
 	points.write[p_index].pos = p_pos;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -1036,7 +1085,7 @@ void Curve3D::set_point_tilt(int p_index, float p_tilt) {
 	ERR_FAIL_INDEX(p_index, points.size());
 
 	points.write[p_index].tilt = p_tilt;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -1049,7 +1098,7 @@ void Curve3D::set_point_in(int p_index, const Vector3 &p_in) {
 	ERR_FAIL_INDEX(p_index, points.size());
 
 	points.write[p_index].in = p_in;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -1062,7 +1111,7 @@ void Curve3D::set_point_out(int p_index, const Vector3 &p_out) {
 	ERR_FAIL_INDEX(p_index, points.size());
 
 	points.write[p_index].out = p_out;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index + 1);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -1074,14 +1123,14 @@ Vector3 Curve3D::get_point_out(int p_index) const {
 void Curve3D::remove_point(int p_index) {
 	ERR_FAIL_INDEX(p_index, points.size());
 	points.remove(p_index);
-	baked_cache_dirty = true;
+	_mark_baked_dirty(p_index);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
 void Curve3D::clear_points() {
 	if (!points.is_empty()) {
 		points.clear();
-		baked_cache_dirty = true;
+		_mark_baked_dirty(0);
 		emit_signal(CoreStringNames::get_singleton()->changed);
 	}
 }
@@ -1133,11 +1182,19 @@ void Curve3D::_bake_segment3d(Map<float, Vector3> &r_bake, float p_begin, float
 	}
 }
 
+void Curve3D::_mark_baked_dirty(int p_point) {
+	// Moving a point changes the segments on both sides of it.
+	baked_dirty_from = MIN(baked_dirty_from, MAX(p_point - 1, 0));
+	baked_cache_dirty = true;
+}
+
 void Curve3D::_bake() const {
 	if (!baked_cache_dirty) {
 		return;
 	}
 
+	int from = baked_dirty_from;
+	baked_dirty_from = points.size();
 	baked_max_ofs = 0;
 	baked_cache_dirty = false;
 
@@ -1145,6 +1202,9 @@ void Curve3D::_bake() const {
 		baked_point_cache.resize(0);
 		baked_tilt_cache.resize(0);
 		baked_up_vector_cache.resize(0);
+		baked_sideways_cache.clear();
+		baked_segment_starts.clear();
+		baked_chunk_bounds.clear();
 		return;
 	}
 
@@ -1161,14 +1221,33 @@ void Curve3D::_bake() const {
 			baked_up_vector_cache.resize(0);
 		}
 
+		baked_sideways_cache.clear();
+		baked_segment_starts.clear();
+		baked_chunk_bounds.clear();
 		return;
 	}
 
-	Vector3 pos = points[0].pos;
-	List<Plane> pointlist;
-	pointlist.push_back(Plane(pos, points[0].tilt));
+	// Baking is sequential, every segment only depends on the last point baked before it.
+	// So the points of the segments before the first edited one can be kept.
+	if (from < 1 || from >= int(baked_segment_starts.size())) {
+		from = 0;
+		baked_point_cache.resize(1);
+		baked_point_cache.set(0, points[0].pos);
+		baked_tilt_cache.resize(1);
+		baked_tilt_cache.set(0, points[0].tilt);
+		baked_segment_starts.clear();
+	} else {
+		baked_point_cache.resize(baked_segment_starts[from]);
+		baked_tilt_cache.resize(baked_segment_starts[from]);
+		baked_segment_starts.resize(from);
+	}
+
+	int first_changed = baked_point_cache.size();
+	Vector3 pos = baked_point_cache[first_changed - 1];
+
+	for (int i = from; i < points.size() - 1; i++) {
+		baked_segment_starts.push_back(baked_point_cache.size());
 
-	for (int i = 0; i < points.size() - 1; i++) {
 		float step = 0.1; // at least 10 substeps ought to be enough?
 		float p = 0.0;
 
@@ -1204,76 +1283,95 @@ void Curve3D::_bake() const {
 
 				pos = npp;
 				p = mid;
-				Plane post;
-				post.normal = pos;
-				post.d = Math::lerp(points[i].tilt, points[i + 1].tilt, mid);
-				pointlist.push_back(post);
+				baked_point_cache.push_back(pos);
+				baked_tilt_cache.push_back(Math::lerp(points[i].tilt, points[i + 1].tilt, mid));
 			} else {
 				p = np;
 			}
 		}
 	}
 
+	// Points added at the end resume baking from here.
+	baked_segment_starts.push_back(baked_point_cache.size());
+
 	Vector3 lastpos = points[points.size() - 1].pos;
 	float lastilt = points[points.size() - 1].tilt;
 
 	float rem = pos.distance_to(lastpos);
-	baked_max_ofs = (pointlist.size() - 1) * bake_interval + rem;
-	pointlist.push_back(Plane(lastpos, lastilt));
+	baked_max_ofs = (baked_point_cache.size() - 1) * bake_interval + rem;
+	baked_point_cache.push_back(lastpos);
+	baked_tilt_cache.push_back(lastilt);
 
-	baked_point_cache.resize(pointlist.size());
-	Vector3 *w = baked_point_cache.ptrw();
-	int idx = 0;
+	int pc = baked_point_cache.size();
+	const Vector3 *w = baked_point_cache.ptr();
 
-	baked_tilt_cache.resize(pointlist.size());
-	real_t *wt = baked_tilt_cache.ptrw();
+	if (!up_vector_enabled) {
+		baked_up_vector_cache.resize(0);
+		baked_sideways_cache.clear();
+	} else {
+		// Up vectors are transported along the curve, resume from the last kept one.
+		// The first up vector is only known once the second one is, so start over when it changes.
+		int idx = first_changed;
+		Vector3 prev_sideways = Vector3(1, 0, 0);
+		Vector3 prev_up = Vector3(0, 1, 0);
+		Vector3 prev_forward = Vector3(0, 0, 1);
+
+		if (idx < 2 || baked_up_vector_cache.size() < idx || int(baked_sideways_cache.size()) < idx) {
+			idx = 0;
+		} else {
+			prev_sideways = baked_sideways_cache[idx - 1];
+			prev_up = baked_up_vector_cache[idx - 1];
+			prev_forward = (w[idx - 1] - w[idx - 2]).normalized();
+		}
 
-	baked_up_vector_cache.resize(up_vector_enabled ? pointlist.size() : 0);
-	Vector3 *up_write = baked_up_vector_cache.ptrw();
+		baked_up_vector_cache.resize(pc);
+		baked_sideways_cache.resize(pc);
+		Vector3 *up_write = baked_up_vector_cache.ptrw();
 
-	Vector3 sideways;
-	Vector3 up;
-	Vector3 forward;
+		Vector3 sideways;
+		Vector3 up;
+		Vector3 forward;
 
-	Vector3 prev_sideways = Vector3(1, 0, 0);
-	Vector3 prev_up = Vector3(0, 1, 0);
-	Vector3 prev_forward = Vector3(0, 0, 1);
+		for (; idx < pc; idx++) {
+			forward = idx > 0 ? (w[idx] - w[idx - 1]).normalized() : prev_forward;
 
-	for (List<Plane>::Element *E = pointlist.front(); E; E = E->next()) {
-		w[idx] = E->get().normal;
-		wt[idx] = E->get().d;
+			float y_dot = prev_up.dot(forward);
 
-		if (!up_vector_enabled) {
-			idx++;
-			continue;
-		}
+			if (y_dot > (1.0f - CMP_EPSILON)) {
+				sideways = prev_sideways;
+				up = -prev_forward;
+			} else if (y_dot < -(1.0f - CMP_EPSILON)) {
+				sideways = prev_sideways;
+				up = prev_forward;
+			} else {
+				sideways = prev_up.cross(forward).normalized();
+				up = forward.cross(sideways).normalized();
+			}
 
-		forward = idx > 0 ? (w[idx] - w[idx - 1]).normalized() : prev_forward;
+			if (idx == 1) {
+				up_write[0] = up;
+			}
 
-		float y_dot = prev_up.dot(forward);
+			up_write[idx] = up;
+			baked_sideways_cache[idx] = sideways;
 
-		if (y_dot > (1.0f - CMP_EPSILON)) {
-			sideways = prev_sideways;
-			up = -prev_forward;
-		} else if (y_dot < -(1.0f - CMP_EPSILON)) {
-			sideways = prev_sideways;
-			up = prev_forward;
-		} else {
-			sideways = prev_up.cross(forward).normalized();
-			up = forward.cross(sideways).normalized();
+			prev_sideways = sideways;
+			prev_up = up;
+			prev_forward = forward;
 		}
+	}
 
-		if (idx == 1) {
-			up_write[0] = up;
+	// Update the bounds of the chunks with changed segments, the segment ending at the first changed point included.
+	int chunk_count = (pc - 1 + BAKED_CHUNK_SIZE - 1) / BAKED_CHUNK_SIZE;
+	int first_chunk = MIN(int(baked_chunk_bounds.size()), (first_changed - 1) / BAKED_CHUNK_SIZE);
+	baked_chunk_bounds.resize(chunk_count);
+	for (int i = first_chunk; i < chunk_count; i++) {
+		int end = MIN((i + 1) * BAKED_CHUNK_SIZE, pc - 1);
+		AABB bounds(w[i * BAKED_CHUNK_SIZE], Vector3());
+		for (int j = i * BAKED_CHUNK_SIZE + 1; j <= end; j++) {
+			bounds.expand_to(w[j]);
 		}
-
-		up_write[idx] = up;
-
-		prev_sideways = sideways;
-		prev_up = up;
-		prev_forward = forward;
-
-		idx++;
+		baked_chunk_bounds[i] = bounds;
 	}
 }
 
@@ -1440,9 +1538,53 @@ PackedVector3Array Curve3D::get_baked_up_vectors() const {
 	return baked_up_vector_cache;
 }
 
-Vector3 Curve3D::get_closest_point(const Vector3 &p_to_point) const {
-	// Brute force method
+void Curve3D::_get_closest(const Vector3 &p_to_point, Vector3 &r_point, float &r_offset) const {
+	int pc = baked_point_cache.size();
+	const Vector3 *r = baked_point_cache.ptr();
+
+	float nearest_dist = -1.0f;
+	int nearest_segment = -1;
+
+	// Chunks are visited from the closest one, which gives a good bound to skip most of the others right away.
+	int chunk_count = baked_chunk_bounds.size();
+	int closest_chunk = 0;
+	float closest_chunk_dist = -1.0f;
+	for (int i = 0; i < chunk_count; i++) {
+		float dist = _aabb_distance_squared(baked_chunk_bounds[i], p_to_point);
+		if (closest_chunk_dist < 0.0f || dist < closest_chunk_dist) {
+			closest_chunk = i;
+			closest_chunk_dist = dist;
+		}
+	}
+
+	for (int c = -1; c < chunk_count; c++) {
+		int chunk = c < 0 ? closest_chunk : c;
+		if (c == closest_chunk || (nearest_dist >= 0.0f && _aabb_distance_squared(baked_chunk_bounds[chunk], p_to_point) > nearest_dist)) {
+			continue;
+		}
+
+		int end = MIN((chunk + 1) * BAKED_CHUNK_SIZE, pc - 1);
+		for (int i = chunk * BAKED_CHUNK_SIZE; i < end; i++) {
+			Vector3 origin = r[i];
+			Vector3 direction = (r[i + 1] - origin) / bake_interval;
+
+			float d = CLAMP((p_to_point - origin).dot(direction), 0.0f, bake_interval);
+			Vector3 proj = origin + direction * d;
+
+			float dist = proj.distance_squared_to(p_to_point);
+
+			// Ties go to the first segment, as when going through them in order.
+			if (nearest_dist < 0.0f || dist < nearest_dist || (dist == nearest_dist && i < nearest_segment)) {
+				r_point = proj;
+				r_offset = i * bake_interval + d;
+				nearest_dist = dist;
+				nearest_segment = i;
+			}
+		}
+	}
+}
 
+Vector3 Curve3D::get_closest_point(const Vector3 &p_to_point) const {
 	if (baked_cache_dirty) {
 		_bake();
 	}
@@ -1455,32 +1597,13 @@ Vector3 Curve3D::get_closest_point(const Vector3 &p_to_point) const {
 		return baked_point_cache.get(0);
 	}
 
-	const Vector3 *r = baked_point_cache.ptr();
-
 	Vector3 nearest;
-	float nearest_dist = -1.0f;
-
-	for (int i = 0; i < pc - 1; i++) {
-		Vector3 origin = r[i];
-		Vector3 direction = (r[i + 1] - origin) / bake_interval;
-
-		float d = CLAMP((p_to_point - origin).dot(direction), 0.0f, bake_interval);
-		Vector3 proj = origin + direction * d;
-
-		float dist = proj.distance_squared_to(p_to_point);
-
-		if (nearest_dist < 0.0f || dist < nearest_dist) {
-			nearest = proj;
-			nearest_dist = dist;
-		}
-	}
-
+	float offset = 0.0f;
+	_get_closest(p_to_point, nearest, offset);
 	return nearest;
 }
 
 float Curve3D::get_closest_offset(const Vector3 &p_to_point) const {
-	// Brute force method
-
 	if (baked_cache_dirty) {
 		_bake();
 	}
@@ -1493,35 +1616,15 @@ float Curve3D::get_closest_offset(const Vector3 &p_to_point) const {
 		return 0.0f;
 	}
 
-	const Vector3 *r = baked_point_cache.ptr();
-
-	float nearest = 0.0f;
-	float nearest_dist = -1.0f;
+	Vector3 nearest;
 	float offset = 0.0f;
-
-	for (int i = 0; i < pc - 1; i++) {
-		Vector3 origin = r[i];
-		Vector3 direction = (r[i + 1] - origin) / bake_interval;
-
-		float d = CLAMP((p_to_point - origin).dot(direction), 0.0f, bake_interval);
-		Vector3 proj = origin + direction * d;
-
-		float dist = proj.distance_squared_to(p_to_point);
-
-		if (nearest_dist < 0.0f || dist < nearest_dist) {
-			nearest = offset + d;
-			nearest_dist = dist;
-		}
-
-		offset += bake_interval;
-	}
-
-	return nearest;
+	_get_closest(p_to_point, nearest, offset);
+	return offset;
 }
 
 void Curve3D::set_bake_interval(float p_tolerance) {
 	bake_interval = p_tolerance;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(0);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -1531,7 +1634,7 @@ float Curve3D::get_bake_interval() const {
 
 void Curve3D::set_up_vector_enabled(bool p_enable) {
 	up_vector_enabled = p_enable;
-	baked_cache_dirty = true;
+	_mark_baked_dirty(0);
 	emit_signal(CoreStringNames::get_singleton()->changed);
 }
 
@@ -1581,7 +1684,7 @@ void Curve3D::_set_data(const Dictionary &p_data) {
 		points.write[i].tilt = rt[i];
 	}
 
-	baked_cache_dirty = true;
+	_mark_baked_dirty(0);
 }
 
 PackedVector3Array Curve3D::tessellate(int p_max_stages, float p_tolerance) const {
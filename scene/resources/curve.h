@@ -32,6 +32,7 @@
 #define CURVE_H
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 
 // y(x) curve
 class Curve : public Resource {
@@ -159,11 +160,20 @@ class Curve2D : public Resource {
 		Vector2 point;
 	};
 
+	enum {
+		BAKED_CHUNK_SIZE = 32, // Baked segments per bounding rect, for closest point queries.
+	};
+
 	mutable bool baked_cache_dirty = false;
+	mutable int baked_dirty_from = 0; // First segment between points to bake again, the ones before are kept.
 	mutable PackedVector2Array baked_point_cache;
+	mutable LocalVector<int> baked_segment_starts; // First baked point of each segment, then the last baked point.
+	mutable LocalVector<Rect2> baked_chunk_bounds;
 	mutable float baked_max_ofs = 0.0;
 
 	void _bake() const;
+	void _mark_baked_dirty(int p_point);
+	void _get_closest(const Vector2 &p_to_point, Vector2 &r_point, float &r_offset) const;
 
 	float bake_interval = 5.0;
 
@@ -220,13 +230,23 @@ class Curve3D : public Resource {
 		Vector3 point;
 	};
 
+	enum {
+		BAKED_CHUNK_SIZE = 32, // Baked segments per bounding box, for closest point queries.
+	};
+
 	mutable bool baked_cache_dirty = false;
+	mutable int baked_dirty_from = 0; // First segment between points to bake again, the ones before are kept.
 	mutable PackedVector3Array baked_point_cache;
 	mutable PackedFloat32Array baked_tilt_cache;
 	mutable PackedVector3Array baked_up_vector_cache;
+	mutable LocalVector<Vector3> baked_sideways_cache; // Needed to resume computing up vectors.
+	mutable LocalVector<int> baked_segment_starts; // First baked point of each segment, then the last baked point.
+	mutable LocalVector<AABB> baked_chunk_bounds;
 	mutable float baked_max_ofs = 0.0;
 
 	void _bake() const;
+	void _mark_baked_dirty(int p_point);
+	void _get_closest(const Vector3 &p_to_point, Vector3 &r_point, float &r_offset) const;
 
 	float bake_interval = 0.2;
 	bool up_vector_enabled = true;
@@ -30,7 +30,13 @@
 
 #include "mesh.h"
 
+#include "core/io/marshalls.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
+#include "core/templates/thread_work_pool.h"
 #include "scene/resources/concave_polygon_shape_3d.h"
 #include "scene/resources/convex_polygon_shape_3d.h"
 #include "surface_tool.h"
@@ -39,6 +45,15 @@
 
 Mesh::ConvexDecompositionFunc Mesh::convex_composition_function = nullptr;
 
+ArrayMesh::EncodeIndexBufferFunc ArrayMesh::encode_index_buffer_func = nullptr;
+ArrayMesh::EncodeIndexBufferBoundFunc ArrayMesh::encode_index_buffer_bound_func = nullptr;
+ArrayMesh::DecodeIndexBufferFunc ArrayMesh::decode_index_buffer_func = nullptr;
+ArrayMesh::DecodeIndexBufferFunc ArrayMesh::decode_index_sequence_func = nullptr;
+ArrayMesh::DecodeVertexBufferFunc ArrayMesh::decode_vertex_buffer_func = nullptr;
+ArrayMesh::DecodeFilterFunc ArrayMesh::decode_filter_oct_func = nullptr;
+ArrayMesh::DecodeFilterFunc ArrayMesh::decode_filter_quat_func = nullptr;
+ArrayMesh::DecodeFilterFunc ArrayMesh::decode_filter_exp_func = nullptr;
+
 Ref<TriangleMesh> Mesh::generate_triangle_mesh() const {
 	if (triangle_mesh.is_valid()) {
 		return triangle_mesh;
@@ -468,6 +483,17 @@ void Mesh::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2I, "lightmap_size_hint"), "set_lightmap_size_hint", "get_lightmap_size_hint");
 
+	ClassDB::bind_method(D_METHOD("convex_decompose_async", "callback"), &Mesh::convex_decompose_async);
+	ClassDB::bind_method(D_METHOD("precompute_convex_decomposition"), &Mesh::precompute_convex_decomposition);
+	ClassDB::bind_method(D_METHOD("_convex_decomposition_finished"), &Mesh::_convex_decomposition_finished);
+	ClassDB::bind_method(D_METHOD("_set_convex_decomposition", "shapes"), &Mesh::_set_convex_decomposition);
+	ClassDB::bind_method(D_METHOD("_get_convex_decomposition"), &Mesh::_get_convex_decomposition);
+	ClassDB::bind_method(D_METHOD("_set_convex_decomposition_hash", "hash"), &Mesh::_set_convex_decomposition_hash);
+	ClassDB::bind_method(D_METHOD("_get_convex_decomposition_hash"), &Mesh::_get_convex_decomposition_hash);
+
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "_convex_decomposition", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL), "_set_convex_decomposition", "_get_convex_decomposition");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "_convex_decomposition_hash", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL), "_set_convex_decomposition_hash", "_get_convex_decomposition_hash");
+
 	ClassDB::bind_method(D_METHOD("get_surface_count"), &Mesh::get_surface_count);
 	ClassDB::bind_method(D_METHOD("surface_get_arrays", "surf_idx"), &Mesh::surface_get_arrays);
 	ClassDB::bind_method(D_METHOD("surface_get_blend_shape_arrays", "surf_idx"), &Mesh::surface_get_blend_shape_arrays);
@@ -533,6 +559,7 @@ void Mesh::_bind_methods() {
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_2D_VERTICES);
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_DYNAMIC_UPDATE);
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_8_BONE_WEIGHTS);
+	BIND_ENUM_CONSTANT(ARRAY_FLAG_COMPRESS_TEX_UV);
 
 	BIND_ENUM_CONSTANT(BLEND_SHAPE_MODE_NORMALIZED);
 	BIND_ENUM_CONSTANT(BLEND_SHAPE_MODE_RELATIVE);
@@ -543,21 +570,72 @@ void Mesh::clear_cache() const {
 	debug_lines.clear();
 }
 
-Vector<Ref<Shape3D>> Mesh::convex_decompose() const {
-	ERR_FAIL_COND_V(!convex_composition_function, Vector<Ref<Shape3D>>());
+// Decomposing is slow, results are kept by faces hash so meshes with the same faces (or the same mesh again) reuse them.
+// The faces are kept too (they are shared, not copied), a hash match alone doesn't mean the faces are the same.
+struct ConvexDecompositionCacheEntry {
+	Vector<Face3> faces;
+	Vector<Vector<Face3>> hulls;
 
-	const Vector<Face3> faces = get_faces();
+	bool has_faces(const Vector<Face3> &p_faces) const {
+		return faces.size() == p_faces.size() && memcmp(faces.ptr(), p_faces.ptr(), faces.size() * sizeof(Face3)) == 0;
+	}
+};
+
+enum {
+	CONVEX_DECOMPOSITION_CACHE_MAX = 64,
+};
+
+static Mutex convex_decomposition_mutex;
+static HashMap<uint32_t, ConvexDecompositionCacheEntry> convex_decomposition_cache;
+
+struct ConvexDecompositionJob {
+	uint64_t id = 0;
+	Ref<Mesh> mesh; // Kept alive until the job is finished.
+	Vector<Face3> faces;
+	uint32_t hash = 0;
+	Vector<Vector<Face3>> hulls;
+	Callable callback;
+	Thread thread;
+};
 
-	Vector<Vector<Face3>> decomposed = convex_composition_function(faces);
+static HashMap<uint64_t, ConvexDecompositionJob *> convex_decomposition_jobs;
+static uint64_t convex_decomposition_last_job = 0;
 
+static uint32_t _hash_faces(const Vector<Face3> &p_faces) {
+	return hash_djb2_buffer((const uint8_t *)p_faces.ptr(), p_faces.size() * sizeof(Face3));
+}
+
+static Vector<Vector<Face3>> _decompose_faces(const Vector<Face3> &p_faces, uint32_t p_hash) {
+	{
+		MutexLock lock(convex_decomposition_mutex);
+		const ConvexDecompositionCacheEntry *entry = convex_decomposition_cache.getptr(p_hash);
+		if (entry && entry->has_faces(p_faces)) {
+			return entry->hulls;
+		}
+	}
+
+	ConvexDecompositionCacheEntry entry;
+	entry.faces = p_faces;
+	entry.hulls = Mesh::convex_composition_function(p_faces);
+
+	MutexLock lock(convex_decomposition_mutex);
+	if (convex_decomposition_cache.size() >= CONVEX_DECOMPOSITION_CACHE_MAX) {
+		convex_decomposition_cache.clear();
+	}
+	convex_decomposition_cache[p_hash] = entry;
+
+	return entry.hulls;
+}
+
+static Vector<Ref<Shape3D>> _make_convex_shapes(const Vector<Vector<Face3>> &p_hulls) {
 	Vector<Ref<Shape3D>> ret;
 
-	for (int i = 0; i < decomposed.size(); i++) {
+	for (int i = 0; i < p_hulls.size(); i++) {
 		Set<Vector3> points;
-		for (int j = 0; j < decomposed[i].size(); j++) {
-			points.insert(decomposed[i][j].vertex[0]);
-			points.insert(decomposed[i][j].vertex[1]);
-			points.insert(decomposed[i][j].vertex[2]);
+		for (int j = 0; j < p_hulls[i].size(); j++) {
+			points.insert(p_hulls[i][j].vertex[0]);
+			points.insert(p_hulls[i][j].vertex[1]);
+			points.insert(p_hulls[i][j].vertex[2]);
 		}
 
 		Vector<Vector3> convex_points;
@@ -579,6 +657,148 @@ Vector<Ref<Shape3D>> Mesh::convex_decompose() const {
 	return ret;
 }
 
+Vector<Ref<Shape3D>> Mesh::convex_decompose() const {
+	const Vector<Face3> faces = get_faces();
+	uint32_t hash = _hash_faces(faces);
+
+	if (!convex_decomposition.is_empty() && convex_decomposition_hash == hash) {
+		return convex_decomposition;
+	}
+
+	ERR_FAIL_COND_V(!convex_composition_function, Vector<Ref<Shape3D>>());
+
+	return _make_convex_shapes(_decompose_faces(faces, hash));
+}
+
+void Mesh::_convex_decomposition_thread_func(void *p_userdata) {
+	ConvexDecompositionJob *job = static_cast<ConvexDecompositionJob *>(p_userdata);
+	job->hulls = _decompose_faces(job->faces, job->hash);
+	job->mesh->call_deferred("_convex_decomposition_finished", job->id);
+}
+
+void Mesh::_convex_decomposition_finished(uint64_t p_job) {
+	ConvexDecompositionJob *job = nullptr;
+	{
+		MutexLock lock(convex_decomposition_mutex);
+		ERR_FAIL_COND(!convex_decomposition_jobs.has(p_job));
+		job = convex_decomposition_jobs[p_job];
+		convex_decomposition_jobs.erase(p_job);
+	}
+
+	job->thread.wait_to_finish();
+
+	Array shapes;
+	Vector<Ref<Shape3D>> convex_shapes = _make_convex_shapes(job->hulls);
+	for (int i = 0; i < convex_shapes.size(); i++) {
+		shapes.push_back(convex_shapes[i]);
+	}
+	Variant shapes_arg = shapes;
+	const Variant *args[1] = { &shapes_arg };
+	Variant ret;
+	Callable::CallError ce;
+	job->callback.call(args, 1, ret, ce);
+
+	memdelete(job); // May free this mesh, if the job held the last reference.
+}
+
+void Mesh::convex_decompose_async(const Callable &p_callback) {
+	const Vector<Face3> faces = get_faces();
+	uint32_t hash = _hash_faces(faces);
+
+	Vector<Ref<Shape3D>> ready;
+	if (!convex_decomposition.is_empty() && convex_decomposition_hash == hash) {
+		ready = convex_decomposition;
+	} else {
+		ERR_FAIL_COND(!convex_composition_function);
+
+		MutexLock lock(convex_decomposition_mutex);
+		const ConvexDecompositionCacheEntry *entry = convex_decomposition_cache.getptr(hash);
+		if (entry && entry->has_faces(faces)) {
+			ready = _make_convex_shapes(entry->hulls);
+		} else {
+			ConvexDecompositionJob *job = memnew(ConvexDecompositionJob);
+			job->id = ++convex_decomposition_last_job;
+			job->mesh = Ref<Mesh>(this);
+			job->faces = faces;
+			job->hash = hash;
+			job->callback = p_callback;
+			convex_decomposition_jobs[job->id] = job;
+
+			job->thread.start(_convex_decomposition_thread_func, job);
+			return;
+		}
+	}
+
+	// Still reported later, so callers see the same behavior either way.
+	Array shapes;
+	for (int i = 0; i < ready.size(); i++) {
+		shapes.push_back(ready[i]);
+	}
+	Variant shapes_arg = shapes;
+	const Variant *args[1] = { &shapes_arg };
+	p_callback.call_deferred(args, 1);
+}
+
+void Mesh::precompute_convex_decomposition() {
+	ERR_FAIL_COND(!convex_composition_function);
+
+	const Vector<Face3> faces = get_faces();
+	convex_decomposition_hash = _hash_faces(faces);
+	convex_decomposition = _make_convex_shapes(_decompose_faces(faces, convex_decomposition_hash));
+}
+
+struct ConvexDecompositionBatch {
+	LocalVector<Vector<Face3>> faces;
+	LocalVector<uint32_t> hashes;
+	LocalVector<Vector<Vector<Face3>>> hulls;
+
+	void decompose(uint32_t p_index, void *p_userdata) {
+		hulls[p_index] = _decompose_faces(faces[p_index], hashes[p_index]);
+	}
+};
+
+void Mesh::precompute_convex_decompositions(const Vector<Ref<Mesh>> &p_meshes) {
+	ERR_FAIL_COND(!convex_composition_function);
+
+	// Faces are read from the rendering server, only the decomposition runs on the pool.
+	ConvexDecompositionBatch batch;
+	batch.faces.resize(p_meshes.size());
+	batch.hashes.resize(p_meshes.size());
+	batch.hulls.resize(p_meshes.size());
+	for (int i = 0; i < p_meshes.size(); i++) {
+		batch.faces[i] = p_meshes[i]->get_faces();
+		batch.hashes[i] = _hash_faces(batch.faces[i]);
+	}
+
+	ThreadWorkPool work_pool;
+	work_pool.init();
+	work_pool.do_work(p_meshes.size(), &batch, &ConvexDecompositionBatch::decompose, nullptr);
+	work_pool.finish();
+
+	for (int i = 0; i < p_meshes.size(); i++) {
+		Ref<Mesh> mesh = p_meshes[i];
+		mesh->convex_decomposition = _make_convex_shapes(batch.hulls[i]);
+		mesh->convex_decomposition_hash = batch.hashes[i];
+	}
+}
+
+void Mesh::_set_convex_decomposition(const Array &p_shapes) {
+	convex_decomposition.clear();
+	for (int i = 0; i < p_shapes.size(); i++) {
+		Ref<Shape3D> shape = p_shapes[i];
+		ERR_CONTINUE(shape.is_null());
+		convex_decomposition.push_back(shape);
+	}
+}
+
+Array Mesh::_get_convex_decomposition() const {
+	Array shapes;
+	for (int i = 0; i < convex_decomposition.size(); i++) {
+		shapes.push_back(convex_decomposition[i]);
+	}
+	return shapes;
+}
+
 Mesh::Mesh() {
 }
 
@@ -882,6 +1102,49 @@ PackedStringArray ArrayMesh::_get_blend_shape_names() const {
 	return sarr;
 }
 
+Vector<uint8_t> ArrayMesh::_encode_index_data(const Vector<uint8_t> &p_index_data, uint32_t p_index_size, uint32_t p_vertex_count) {
+	uint32_t index_count = p_index_data.size() / p_index_size;
+	// The encoder asserts on anything but whole triangles.
+	ERR_FAIL_COND_V(index_count % 3 != 0, Vector<uint8_t>());
+
+	Vector<uint32_t> indices;
+	indices.resize(index_count);
+	uint32_t *iw = indices.ptrw();
+	if (p_index_size == 2) {
+		const uint16_t *r = (const uint16_t *)p_index_data.ptr();
+		for (uint32_t i = 0; i < index_count; i++) {
+			iw[i] = r[i];
+		}
+	} else {
+		copymem(iw, p_index_data.ptr(), index_count * sizeof(uint32_t));
+	}
+
+	//the index count goes first, the encoded stream does not store it
+	Vector<uint8_t> encoded;
+	encoded.resize(4 + encode_index_buffer_bound_func(index_count, p_vertex_count));
+	uint8_t *w = encoded.ptrw();
+	encode_uint32(index_count, w);
+	size_t size = encode_index_buffer_func(w + 4, encoded.size() - 4, indices.ptr(), index_count);
+	ERR_FAIL_COND_V(size == 0, Vector<uint8_t>());
+	encoded.resize(4 + size);
+	return encoded;
+}
+
+Vector<uint8_t> ArrayMesh::_decode_index_data(const Vector<uint8_t> &p_encoded, uint32_t p_index_size) {
+	ERR_FAIL_COND_V_MSG(decode_index_buffer_func == nullptr, Vector<uint8_t>(), "Mesh index data is compressed, but no index decoder is available (is the meshoptimizer module disabled?).");
+	ERR_FAIL_COND_V(p_encoded.size() < 4, Vector<uint8_t>());
+
+	const uint8_t *r = p_encoded.ptr();
+	uint32_t index_count = decode_uint32(r);
+	ERR_FAIL_COND_V_MSG(index_count % 3 != 0, Vector<uint8_t>(), "Corrupt compressed mesh index data.");
+
+	Vector<uint8_t> index_data;
+	index_data.resize(index_count * p_index_size);
+	int err = decode_index_buffer_func(index_data.ptrw(), index_count, p_index_size, r + 4, p_encoded.size() - 4);
+	ERR_FAIL_COND_V_MSG(err != 0, Vector<uint8_t>(), "Corrupt compressed mesh index data.");
+	return index_data;
+}
+
 Array ArrayMesh::_get_surfaces() const {
 	if (mesh.is_null()) {
 		return Array();
@@ -890,6 +1153,14 @@ Array ArrayMesh::_get_surfaces() const {
 	Array ret;
 	for (int i = 0; i < surfaces.size(); i++) {
 		RenderingServer::SurfaceData surface = RS::get_singleton()->mesh_get_surface(mesh, i);
+
+		//triangle index buffers (and their LODs) are stored compressed when an encoder is available
+		uint32_t index_size = surface.vertex_count <= 65536 ? 2 : 4;
+		bool encode_indices = encode_index_buffer_func && surface.primitive == RS::PRIMITIVE_TRIANGLES && surface.index_count && surface.index_count % 3 == 0 && surface.index_data.size() == int(surface.index_count * index_size);
+		for (int j = 0; j < surface.lods.size() && encode_indices; j++) {
+			encode_indices = surface.lods[j].index_data.size() % (index_size * 3) == 0;
+		}
+
 		Dictionary data;
 		data["format"] = surface.format;
 		data["primitive"] = surface.primitive;
@@ -903,14 +1174,17 @@ Array ArrayMesh::_get_surfaces() const {
 		}
 		data["aabb"] = surface.aabb;
 		if (surface.index_count) {
-			data["index_data"] = surface.index_data;
+			data["index_data"] = encode_indices ? _encode_index_data(surface.index_data, index_size, surface.vertex_count) : surface.index_data;
 			data["index_count"] = surface.index_count;
 		};
+		if (encode_indices) {
+			data["index_encoded"] = true;
+		}
 
 		Array lods;
 		for (int j = 0; j < surface.lods.size(); j++) {
 			lods.push_back(surface.lods[j].edge_length);
-			lods.push_back(surface.lods[j].index_data);
+			lods.push_back(encode_indices ? _encode_index_data(surface.lods[j].index_data, index_size, surface.vertex_count) : surface.lods[j].index_data);
 		}
 
 		if (lods.size()) {
@@ -929,6 +1203,10 @@ Array ArrayMesh::_get_surfaces() const {
 			data["blend_shapes"] = surface.blend_shape_data;
 		}
 
+		if (surface.cluster_data.size()) {
+			data["clusters"] = surface.cluster_data;
+		}
+
 		if (surfaces[i].material.is_valid()) {
 			data["material"] = surfaces[i].material;
 		}
@@ -981,10 +1259,18 @@ void ArrayMesh::_set_surfaces(const Array &p_surfaces) {
 		}
 		surface.aabb = d["aabb"];
 
+		bool index_encoded = d.has("index_encoded") && bool(d["index_encoded"]);
+		uint32_t index_size = surface.vertex_count <= 65536 ? 2 : 4;
+
 		if (d.has("index_data")) {
 			ERR_FAIL_COND(!d.has("index_count"));
-			surface.index_data = d["index_data"];
 			surface.index_count = d["index_count"];
+			if (index_encoded) {
+				surface.index_data = _decode_index_data(d["index_data"], index_size);
+				ERR_FAIL_COND(surface.index_data.size() != int(surface.index_count * index_size));
+			} else {
+				surface.index_data = d["index_data"];
+			}
 		}
 
 		if (d.has("lods")) {
@@ -993,7 +1279,8 @@ void ArrayMesh::_set_surfaces(const Array &p_surfaces) {
 			for (int j = 0; j < lods.size(); j += 2) {
 				RS::SurfaceData::LOD lod;
 				lod.edge_length = lods[j + 0];
-				lod.index_data = lods[j + 1];
+				lod.index_data = index_encoded ? _decode_index_data(lods[j + 1], index_size) : Vector<uint8_t>(lods[j + 1]);
+				ERR_FAIL_COND(lod.index_data.is_empty());
 				surface.lods.push_back(lod);
 			}
 		}
@@ -1009,6 +1296,10 @@ void ArrayMesh::_set_surfaces(const Array &p_surfaces) {
 			surface.blend_shape_data = d["blend_shapes"];
 		}
 
+		if (d.has("clusters")) {
+			surface.cluster_data = d["clusters"];
+		}
+
 		Ref<Material> material;
 		if (d.has("material")) {
 			material = d["material"];
@@ -1134,7 +1425,7 @@ void ArrayMesh::_recompute_aabb() {
 #ifndef _MSC_VER
 #warning need to add binding to add_surface using future MeshSurfaceData object
 #endif
-void ArrayMesh::add_surface(uint32_t p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data, const Vector<AABB> &p_bone_aabbs, const Vector<RS::SurfaceData::LOD> &p_lods) {
+void ArrayMesh::add_surface(uint32_t p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data, const Vector<AABB> &p_bone_aabbs, const Vector<RS::SurfaceData::LOD> &p_lods, const Vector<uint8_t> &p_cluster_data) {
 	_create_if_empty();
 
 	Surface s;
@@ -1161,6 +1452,7 @@ void ArrayMesh::add_surface(uint32_t p_format, PrimitiveType p_primitive, const
 	sd.blend_shape_data = p_blend_shape_data;
 	sd.bone_aabbs = p_bone_aabbs;
 	sd.lods = p_lods;
+	sd.cluster_data = p_cluster_data;
 
 	RenderingServer::get_singleton()->mesh_add_surface(mesh, sd);
 
@@ -45,6 +45,18 @@ class Mesh : public Resource {
 	mutable Vector<Vector3> debug_lines;
 	Size2i lightmap_size_hint;
 
+	// Precomputed (usually on import) and saved with the mesh, used while the faces hash matches.
+	Vector<Ref<Shape3D>> convex_decomposition;
+	uint32_t convex_decomposition_hash = 0;
+
+	void _set_convex_decomposition(const Array &p_shapes);
+	Array _get_convex_decomposition() const;
+	void _set_convex_decomposition_hash(uint32_t p_hash) { convex_decomposition_hash = p_hash; }
+	uint32_t _get_convex_decomposition_hash() const { return convex_decomposition_hash; }
+
+	static void _convex_decomposition_thread_func(void *p_userdata);
+	void _convex_decomposition_finished(uint64_t p_job);
+
 protected:
 	static void _bind_methods();
 
@@ -116,6 +128,7 @@ public:
 		ARRAY_FLAG_USE_2D_VERTICES = RS::ARRAY_FLAG_USE_2D_VERTICES,
 		ARRAY_FLAG_USE_DYNAMIC_UPDATE = RS::ARRAY_FLAG_USE_DYNAMIC_UPDATE,
 		ARRAY_FLAG_USE_8_BONE_WEIGHTS = RS::ARRAY_FLAG_USE_8_BONE_WEIGHTS,
+		ARRAY_FLAG_COMPRESS_TEX_UV = RS::ARRAY_FLAG_COMPRESS_TEX_UV,
 
 	};
 
@@ -163,6 +176,9 @@ public:
 	static ConvexDecompositionFunc convex_composition_function;
 
 	Vector<Ref<Shape3D>> convex_decompose() const;
+	void convex_decompose_async(const Callable &p_callback); // Decomposes on a thread, the shapes are passed to the callback on the main thread.
+	void precompute_convex_decomposition();
+	static void precompute_convex_decompositions(const Vector<Ref<Mesh>> &p_meshes); // Decomposes the meshes in parallel.
 
 	Mesh();
 };
@@ -200,6 +216,9 @@ private:
 	_FORCE_INLINE_ void _create_if_empty() const;
 	void _recompute_aabb();
 
+	static Vector<uint8_t> _encode_index_data(const Vector<uint8_t> &p_index_data, uint32_t p_index_size, uint32_t p_vertex_count);
+	static Vector<uint8_t> _decode_index_data(const Vector<uint8_t> &p_encoded, uint32_t p_index_size);
+
 protected:
 	virtual bool _is_generated() const { return false; }
 
@@ -212,9 +231,25 @@ protected:
 	static void _bind_methods();
 
 public:
+	// Index buffer compression used when saving triangle surfaces, provided by the meshoptimizer module.
+	typedef size_t (*EncodeIndexBufferFunc)(unsigned char *buffer, size_t buffer_size, const unsigned int *indices, size_t index_count);
+	static EncodeIndexBufferFunc encode_index_buffer_func;
+	typedef size_t (*EncodeIndexBufferBoundFunc)(size_t index_count, size_t vertex_count);
+	static EncodeIndexBufferBoundFunc encode_index_buffer_bound_func;
+	typedef int (*DecodeIndexBufferFunc)(void *destination, size_t index_count, size_t index_size, const unsigned char *buffer, size_t buffer_size);
+	static DecodeIndexBufferFunc decode_index_buffer_func;
+	// Decoders for meshoptimizer compressed buffers found in imported files (e.g. glTF's EXT_meshopt_compression).
+	static DecodeIndexBufferFunc decode_index_sequence_func;
+	typedef int (*DecodeVertexBufferFunc)(void *destination, size_t vertex_count, size_t vertex_size, const unsigned char *buffer, size_t buffer_size);
+	static DecodeVertexBufferFunc decode_vertex_buffer_func;
+	typedef void (*DecodeFilterFunc)(void *buffer, size_t vertex_count, size_t vertex_size);
+	static DecodeFilterFunc decode_filter_oct_func;
+	static DecodeFilterFunc decode_filter_quat_func;
+	static DecodeFilterFunc decode_filter_exp_func;
+
 	void add_surface_from_arrays(PrimitiveType p_primitive, const Array &p_arrays, const Array &p_blend_shapes = Array(), const Dictionary &p_lods = Dictionary(), uint32_t p_flags = 0);
 
-	void add_surface(uint32_t p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data = Vector<uint8_t>(), const Vector<AABB> &p_bone_aabbs = Vector<AABB>(), const Vector<RS::SurfaceData::LOD> &p_lods = Vector<RS::SurfaceData::LOD>());
+	void add_surface(uint32_t p_format, PrimitiveType p_primitive, const Vector<uint8_t> &p_array, const Vector<uint8_t> &p_attribute_array, const Vector<uint8_t> &p_skin_array, int p_vertex_count, const Vector<uint8_t> &p_index_array, int p_index_count, const AABB &p_aabb, const Vector<uint8_t> &p_blend_shape_data = Vector<uint8_t>(), const Vector<AABB> &p_bone_aabbs = Vector<AABB>(), const Vector<RS::SurfaceData::LOD> &p_lods = Vector<RS::SurfaceData::LOD>(), const Vector<uint8_t> &p_cluster_data = Vector<uint8_t>());
 
 	Array surface_get_arrays(int p_surface) const override;
 	Array surface_get_blend_shape_arrays(int p_surface) const override;
@@ -95,6 +95,7 @@ protected:
 	float verts_per_poly = 6.0f;
 	float detail_sample_distance = 6.0f;
 	float detail_sample_max_error = 1.0f;
+	int tile_size = 0;
 
 	SamplePartitionType partition_type = SAMPLE_PARTITION_WATERSHED;
 	ParsedGeometryType parsed_geometry_type = PARSED_GEOMETRY_MESH_INSTANCES;
@@ -137,7 +138,7 @@ public:
 	float get_agent_height() const;
 
 	void set_agent_radius(float p_value);
-	float get_agent_radius();
+	float get_agent_radius() const;
 
 	void set_agent_max_climb(float p_value);
 	float get_agent_max_climb() const;
@@ -166,6 +167,9 @@ public:
 	void set_detail_sample_max_error(float p_value);
 	float get_detail_sample_max_error() const;
 
+	void set_tile_size(int p_value);
+	int get_tile_size() const;
+
 	void set_filter_low_hanging_obstacles(bool p_value);
 	bool get_filter_low_hanging_obstacles() const;
 
@@ -45,7 +45,76 @@ bool SceneState::can_instance() const {
 	return nodes.size() > 0;
 }
 
-Node *SceneState::instance(GenEditState p_edit_state) const {
+void SceneState::_compile() const {
+	// Resolves what instance() would otherwise look up by name for every node it creates.
+	int nc = nodes.size();
+	const NodeData *nd = nodes.ptr();
+
+	// Sub-scenes can only be deferred if nothing else in this scene refers to the node by id.
+	Vector<bool> referenced;
+	referenced.resize(nc);
+	for (int i = 0; i < nc; i++) {
+		referenced.write[i] = false;
+	}
+	bool has_path_ids = !editable_instances.is_empty();
+	for (int i = 0; i < nc; i++) {
+		const int ids[2] = { nd[i].parent, nd[i].owner };
+		for (int k = 0; k < 2; k++) {
+			if (ids[k] < 0) {
+				continue;
+			}
+			if (ids[k] & FLAG_ID_IS_PATH) {
+				has_path_ids = true;
+			} else if ((ids[k] & FLAG_MASK) < nc) {
+				referenced.write[ids[k] & FLAG_MASK] = true;
+			}
+		}
+	}
+	for (int i = 0; i < connections.size(); i++) {
+		const int ids[2] = { connections[i].from, connections[i].to };
+		for (int k = 0; k < 2; k++) {
+			if (ids[k] & FLAG_ID_IS_PATH) {
+				has_path_ids = true;
+			} else if (ids[k] >= 0 && ids[k] < nc) {
+				referenced.write[ids[k]] = true;
+			}
+		}
+	}
+
+	int total_properties = 0;
+	for (int i = 0; i < nc; i++) {
+		total_properties += nd[i].properties.size();
+	}
+
+	compiled_nodes.resize(nc);
+	compiled_properties.resize(total_properties);
+	CompiledNode *cnodes = compiled_nodes.ptrw();
+	CompiledProperty *cprops = compiled_properties.ptrw();
+
+	int ofs = 0;
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nd[i];
+		cnodes[i].property_ofs = ofs;
+		cnodes[i].can_defer = i > 0 && n.instance >= 0 && !(n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) && !referenced[i] && !has_path_ids;
+
+		// Only nodes created from their class here have a known type. Instanced ones are whatever their scene made them.
+		bool native = !(i == 0 && base_scene_idx >= 0) && n.instance < 0 && n.type != TYPE_INSTANCED && n.type < names.size();
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			CompiledProperty &cp = cprops[ofs + j];
+			cp.setter = nullptr;
+			cp.index = -1;
+			if (native && n.properties[j].name < names.size() && names[n.properties[j].name] != CoreStringNames::get_singleton()->_script) {
+				cp.setter = ClassDB::get_property_setter_method(names[n.type], names[n.properties[j].name], &cp.index);
+			}
+		}
+		ofs += n.properties.size();
+	}
+
+	compiled = true;
+}
+
+Node *SceneState::instance(GenEditState p_edit_state, bool p_defer_sub_scenes) const {
 	// nodes where instancing failed (because something is missing)
 	List<Node *> stray_instances;
 
@@ -78,6 +147,15 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 
 	const NodeData *nd = &nodes[0];
 
+	{
+		MutexLock lock(compile_mutex);
+		if (!compiled) {
+			_compile();
+		}
+	}
+	const CompiledNode *cnodes = compiled_nodes.ptr();
+	const CompiledProperty *cprops_base = compiled_properties.ptr();
+
 	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
@@ -104,6 +182,7 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 		}
 
 		Node *node = nullptr;
+		bool created_from_type = false;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			//scene inheritance on root node
@@ -133,8 +212,16 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 			} else {
 				Ref<PackedScene> sdata = props[n.instance & FLAG_MASK];
 				ERR_FAIL_COND_V(!sdata.is_valid(), nullptr);
-				node = sdata->instance(p_edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
-				ERR_FAIL_COND_V(!node, nullptr);
+				if (p_defer_sub_scenes && p_edit_state == GEN_EDIT_STATE_DISABLED && cnodes[i].can_defer) {
+					// Instanced when it enters the tree.
+					InstancePlaceholder *ip = memnew(InstancePlaceholder);
+					ip->set_instance_path(sdata->get_path());
+					ip->set_deferred_scene(sdata);
+					node = ip;
+				} else {
+					node = sdata->instance(p_edit_state == GEN_EDIT_STATE_DISABLED ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
+					ERR_FAIL_COND_V(!node, nullptr);
+				}
 			}
 
 		} else if (n.type == TYPE_INSTANCED) {
@@ -169,6 +256,8 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 				if (!obj) {
 					obj = memnew(Node);
 				}
+			} else {
+				created_from_type = true;
 			}
 
 			node = Object::cast_to<Node>(obj);
@@ -187,6 +276,13 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
 
+				// Setters resolved by _compile() can be called directly, as long as nothing (like a script) could intercept Object::set().
+				// The editor keeps going through Object::set(), which also flags the node as edited.
+				const CompiledProperty *cprops = nullptr;
+				if (created_from_type && p_edit_state == GEN_EDIT_STATE_DISABLED && node->get_class_name() == snames[n.type]) {
+					cprops = &cprops_base[cnodes[i].property_ofs];
+				}
+
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
 					ERR_FAIL_INDEX_V(nprops[j].name, sname_count, nullptr);
@@ -243,7 +339,21 @@ Node *SceneState::instance(GenEditState p_edit_state) const {
 						} else if (p_edit_state == GEN_EDIT_STATE_INSTANCE) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor
 						}
-						node->set(snames[nprops[j].name], value, &valid);
+
+						if (cprops && cprops[j].setter && !node->get_script_instance()) {
+							Callable::CallError ce;
+							if (cprops[j].index >= 0) {
+								Variant index = cprops[j].index;
+								const Variant *args[2] = { &index, &value };
+								cprops[j].setter->call(node, args, 2, ce);
+							} else {
+								const Variant *args[1] = { &value };
+								cprops[j].setter->call(node, args, 1, ce);
+							}
+							valid = ce.error == Callable::CallError::CALL_OK;
+						} else {
+							node->set(snames[nprops[j].name], value, &valid);
+						}
 					}
 				}
 			}
@@ -908,6 +1018,7 @@ void SceneState::clear() {
 	node_paths.clear();
 	editable_instances.clear();
 	base_scene_idx = -1;
+	compiled = false;
 }
 
 Ref<SceneState> SceneState::_get_base_scene_state() const {
@@ -1094,6 +1205,7 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 		variants.clear();
 	}
 
+	compiled = false;
 	nodes.resize(node_count);
 	if (node_count) {
 		const int *r = snodes.ptr();
@@ -1501,6 +1613,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	compiled = false;
 
 	return nodes.size() - 1;
 }
@@ -1514,6 +1627,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value) {
 	prop.name = p_name;
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	compiled = false;
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -1525,6 +1639,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
+	compiled = false;
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, const Vector<int> &p_binds) {
@@ -1542,10 +1657,12 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 	c.flags = p_flags;
 	c.binds = p_binds;
 	connections.push_back(c);
+	compiled = false;
 }
 
 void SceneState::add_editable_instance(const NodePath &p_path) {
 	editable_instances.push_back(p_path);
+	compiled = false;
 }
 
 Vector<String> SceneState::_get_node_groups(int p_idx) const {
@@ -1602,10 +1719,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	_invalidate_instance_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	_invalidate_instance_pool();
 	state->clear();
 }
 
@@ -1618,7 +1737,7 @@ Node *PackedScene::instance(GenEditState p_edit_state) const {
 	ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, nullptr, "Edit state is only for editors, does not work without tools compiled.");
 #endif
 
-	Node *s = state->instance((SceneState::GenEditState)p_edit_state);
+	Node *s = state->instance((SceneState::GenEditState)p_edit_state, defer_sub_scene_instancing);
 	if (!s) {
 		return nullptr;
 	}
@@ -1636,7 +1755,147 @@ Node *PackedScene::instance(GenEditState p_edit_state) const {
 	return s;
 }
 
+void PackedScene::set_defer_sub_scene_instancing(bool p_enable) {
+	defer_sub_scene_instancing = p_enable;
+}
+
+bool PackedScene::is_defer_sub_scene_instancing_enabled() const {
+	return defer_sub_scene_instancing;
+}
+
+static void _collect_pool_nodes(Node *p_node, Vector<Node *> &r_nodes) {
+	r_nodes.push_back(p_node);
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_collect_pool_nodes(p_node->get_child(i), r_nodes);
+	}
+}
+
+void PackedScene::_capture_instance_snapshot(Node *p_root) {
+	Vector<Node *> nodes;
+	_collect_pool_nodes(p_root, nodes);
+
+	instance_pool.snapshot.resize(nodes.size());
+	InstancePool::NodeSnapshot *snapshot = instance_pool.snapshot.ptrw();
+	for (int i = 0; i < nodes.size(); i++) {
+		Node *n = nodes[i];
+		snapshot[i].path = p_root->get_path_to(n);
+
+		// Script variables that aren't exported are included too, so scripts also start from their initial state.
+		List<PropertyInfo> plist;
+		n->get_property_list(&plist);
+		for (List<PropertyInfo>::Element *E = plist.front(); E; E = E->next()) {
+			if (!(E->get().usage & (PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_SCRIPT_VARIABLE)) || E->get().name == CoreStringNames::get_singleton()->_script) {
+				continue;
+			}
+			Variant value = n->get(E->get().name);
+			Ref<Resource> res = value;
+			if (res.is_valid() && res->is_local_to_scene()) {
+				// Duplicated per instance, the pooled node keeps its own copy.
+				continue;
+			}
+			if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				// Containers are shared by reference, keep a copy the instance can't modify.
+				value = value.duplicate(true);
+			}
+			snapshot[i].properties.push_back(Pair<StringName, Variant>(E->get().name, value));
+		}
+	}
+	instance_pool.captured = true;
+}
+
+bool PackedScene::_reset_instance(Node *p_root) {
+	Vector<Node *> nodes;
+	_collect_pool_nodes(p_root, nodes);
+	if (nodes.size() != instance_pool.snapshot.size()) {
+		return false;
+	}
+
+	const InstancePool::NodeSnapshot *snapshot = instance_pool.snapshot.ptr();
+	for (int i = 0; i < instance_pool.snapshot.size(); i++) {
+		Node *n = p_root->get_node_or_null(snapshot[i].path);
+		if (!n) {
+			return false;
+		}
+		for (int j = 0; j < snapshot[i].properties.size(); j++) {
+			const Pair<StringName, Variant> &prop = snapshot[i].properties[j];
+			if (prop.second.get_type() == Variant::ARRAY || prop.second.get_type() == Variant::DICTIONARY) {
+				// Always give the instance a fresh copy, the one it had may have been modified in place.
+				n->set(prop.first, prop.second.duplicate(true));
+			} else if (n->get(prop.first) != prop.second) {
+				n->set(prop.first, prop.second);
+			}
+		}
+	}
+	return true;
+}
+
+Node *PackedScene::instance_pooled() {
+	Node *s = nullptr;
+	if (instance_pool.free_instances.size()) {
+		s = instance_pool.free_instances[instance_pool.free_instances.size() - 1];
+		instance_pool.free_instances.resize(instance_pool.free_instances.size() - 1);
+	} else {
+		s = instance();
+		ERR_FAIL_COND_V(!s, nullptr);
+		if (!instance_pool.captured) {
+			_capture_instance_snapshot(s);
+		}
+	}
+
+	Vector<Node *> nodes;
+	_collect_pool_nodes(s, nodes);
+	for (int i = 0; i < nodes.size(); i++) {
+		nodes[i]->request_ready();
+	}
+	return s;
+}
+
+void PackedScene::recycle_instance(Node *p_instance) {
+	ERR_FAIL_NULL(p_instance);
+	ERR_FAIL_COND_MSG(p_instance->is_queued_for_deletion(), "Can't recycle an instance that is queued for deletion.");
+	ERR_FAIL_COND_MSG(!instance_pool.captured, "Can't recycle a node that was not obtained from instance_pooled().");
+
+	if (p_instance->get_parent()) {
+		p_instance->get_parent()->remove_child(p_instance);
+	}
+
+	if (instance_pool.free_instances.size() >= instance_pool.limit || !_reset_instance(p_instance)) {
+		// Pool is full, or the node hierarchy no longer matches the scene.
+		memdelete(p_instance);
+		return;
+	}
+
+	instance_pool.free_instances.push_back(p_instance);
+}
+
+void PackedScene::clear_instance_pool() {
+	for (int i = 0; i < instance_pool.free_instances.size(); i++) {
+		memdelete(instance_pool.free_instances[i]);
+	}
+	instance_pool.free_instances.clear();
+}
+
+void PackedScene::set_instance_pool_limit(int p_limit) {
+	ERR_FAIL_COND(p_limit < 0);
+	instance_pool.limit = p_limit;
+	while (instance_pool.free_instances.size() > instance_pool.limit) {
+		memdelete(instance_pool.free_instances[instance_pool.free_instances.size() - 1]);
+		instance_pool.free_instances.resize(instance_pool.free_instances.size() - 1);
+	}
+}
+
+int PackedScene::get_instance_pool_limit() const {
+	return instance_pool.limit;
+}
+
+void PackedScene::_invalidate_instance_pool() {
+	clear_instance_pool();
+	instance_pool.snapshot.clear();
+	instance_pool.captured = false;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	_invalidate_instance_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1645,6 +1904,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	_invalidate_instance_pool();
 	state = Ref<SceneState>(memnew(SceneState));
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1671,6 +1931,13 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
+	ClassDB::bind_method(D_METHOD("set_defer_sub_scene_instancing", "enable"), &PackedScene::set_defer_sub_scene_instancing);
+	ClassDB::bind_method(D_METHOD("is_defer_sub_scene_instancing_enabled"), &PackedScene::is_defer_sub_scene_instancing_enabled);
+	ClassDB::bind_method(D_METHOD("instance_pooled"), &PackedScene::instance_pooled);
+	ClassDB::bind_method(D_METHOD("recycle_instance", "instance"), &PackedScene::recycle_instance);
+	ClassDB::bind_method(D_METHOD("clear_instance_pool"), &PackedScene::clear_instance_pool);
+	ClassDB::bind_method(D_METHOD("set_instance_pool_limit", "limit"), &PackedScene::set_instance_pool_limit);
+	ClassDB::bind_method(D_METHOD("get_instance_pool_limit"), &PackedScene::get_instance_pool_limit);
 
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "_bundled"), "_set_bundled_scene", "_get_bundled_scene");
 
@@ -1682,3 +1949,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	clear_instance_pool();
+}
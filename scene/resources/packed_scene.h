@@ -87,6 +87,24 @@ class SceneState : public Reference {
 
 	Vector<ConnectionData> connections;
 
+	// Built on first instance, and thrown away whenever the nodes or connections change.
+	struct CompiledProperty {
+		MethodBind *setter = nullptr; // Null if the property must be set through Object::set().
+		int index = -1;
+	};
+
+	struct CompiledNode {
+		int property_ofs = 0; // Into compiled_properties.
+		bool can_defer = false;
+	};
+
+	mutable Vector<CompiledProperty> compiled_properties;
+	mutable Vector<CompiledNode> compiled_nodes;
+	mutable bool compiled = false;
+	mutable Mutex compile_mutex;
+
+	void _compile() const;
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, Map<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, Map<Node *, int> &node_map, Map<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, Map<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, Map<Node *, int> &node_map, Map<Node *, int> &nodepath_map);
 
@@ -137,7 +155,7 @@ public:
 	void clear();
 
 	bool can_instance() const;
-	Node *instance(GenEditState p_edit_state) const;
+	Node *instance(GenEditState p_edit_state, bool p_defer_sub_scenes = false) const;
 
 	//unbuild API
 
@@ -193,6 +211,23 @@ class PackedScene : public Resource {
 	RES_BASE_EXTENSION("scn");
 
 	Ref<SceneState> state;
+	bool defer_sub_scene_instancing = false;
+
+	struct InstancePool {
+		struct NodeSnapshot {
+			NodePath path;
+			Vector<Pair<StringName, Variant>> properties;
+		};
+
+		bool captured = false;
+		Vector<NodeSnapshot> snapshot;
+		Vector<Node *> free_instances;
+		int limit = 64;
+	} instance_pool;
+
+	void _capture_instance_snapshot(Node *p_root);
+	bool _reset_instance(Node *p_root);
+	void _invalidate_instance_pool();
 
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
@@ -216,6 +251,15 @@ public:
 	bool can_instance() const;
 	Node *instance(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	void set_defer_sub_scene_instancing(bool p_enable);
+	bool is_defer_sub_scene_instancing_enabled() const;
+
+	Node *instance_pooled();
+	void recycle_instance(Node *p_instance);
+	void clear_instance_pool();
+	void set_instance_pool_limit(int p_limit);
+	int get_instance_pool_limit() const;
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -227,6 +271,7 @@ public:
 	Ref<SceneState> get_state();
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
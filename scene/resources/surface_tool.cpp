@@ -30,13 +30,17 @@
 
 #include "surface_tool.h"
 
+#include "core/math/batch_math.h"
+
 #define _VERTEX_SNAP 0.0001
 #define EQ_VERTEX_DIST 0.00001
 
 SurfaceTool::OptimizeVertexCacheFunc SurfaceTool::optimize_vertex_cache_func = nullptr;
+SurfaceTool::OptimizeOverdrawFunc SurfaceTool::optimize_overdraw_func = nullptr;
 SurfaceTool::SimplifyFunc SurfaceTool::simplify_func = nullptr;
 SurfaceTool::SimplifyScaleFunc SurfaceTool::simplify_scale_func = nullptr;
 SurfaceTool::SimplifySloppyFunc SurfaceTool::simplify_sloppy_func = nullptr;
+SurfaceTool::BuildClustersFunc SurfaceTool::build_clusters_func = nullptr;
 
 bool SurfaceTool::Vertex::operator==(const Vertex &p_vertex) const {
 	if (vertex != p_vertex.vertex) {
@@ -855,19 +859,29 @@ void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const
 		format = 0;
 	}
 
+	Array arr = p_existing->surface_get_arrays(p_surface);
+	ERR_FAIL_COND(arr.size() != RS::ARRAY_MAX);
+
+	// Positions and normals are transformed as whole arrays, before being split into vertices.
+	PackedVector3Array positions = arr[RS::ARRAY_VERTEX];
+	if (positions.size()) {
+		arr[RS::ARRAY_VERTEX] = p_xform.xform(positions);
+	}
+	PackedVector3Array normals = arr[RS::ARRAY_NORMAL];
+	if (normals.size()) {
+		BatchMath::basis_xform(p_xform.basis, normals.ptr(), normals.ptrw(), normals.size());
+		arr[RS::ARRAY_NORMAL] = normals;
+	}
+
 	uint32_t nformat;
 	LocalVector<Vertex> nvertices;
 	LocalVector<int> nindices;
-	_create_list(p_existing, p_surface, &nvertices, &nindices, nformat);
+	_create_list_from_arrays(arr, &nvertices, &nindices, nformat);
 	format |= nformat;
 	int vfrom = vertex_array.size();
 
 	for (uint32_t vi = 0; vi < nvertices.size(); vi++) {
 		Vertex v = nvertices[vi];
-		v.vertex = p_xform.xform(v.vertex);
-		if (nformat & RS::ARRAY_FORMAT_NORMAL) {
-			v.normal = p_xform.basis.xform(v.normal);
-		}
 		if (nformat & RS::ARRAY_FORMAT_TANGENT) {
 			v.tangent = p_xform.basis.xform(v.tangent);
 			v.binormal = p_xform.basis.xform(v.binormal);
@@ -58,11 +58,19 @@ void SyntaxHighlighter::_lines_edited_from(int p_from_line, int p_to_line) {
 		return;
 	}
 
-	int cache_size = highlighting_cache.back()->key();
-	for (int i = MIN(p_from_line, p_to_line) - 1; i <= cache_size; i++) {
-		if (highlighting_cache.has(i)) {
-			highlighting_cache.erase(i);
-		}
+	// Only visit the cached lines, instead of every line up to the last cached one.
+	int from = MIN(p_from_line, p_to_line) - 1;
+	Map<int, Dictionary>::Element *E = highlighting_cache.find_closest(from);
+	if (!E) {
+		E = highlighting_cache.front();
+	} else if (E->key() < from) {
+		E = E->next();
+	}
+
+	while (E) {
+		Map<int, Dictionary>::Element *N = E->next();
+		highlighting_cache.erase(E);
+		E = N;
 	}
 }
 
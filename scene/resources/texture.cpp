@@ -30,6 +30,7 @@
 
 #include "texture.h"
 
+#include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/io/image_loader.h"
 #include "core/os/os.h"
@@ -320,7 +321,11 @@ ImageTexture::~ImageTexture() {
 
 //////////////////////////////////////////
 
-Ref<Image> StreamTexture2D::load_image_from_file(FileAccess *f, int p_size_limit) {
+Ref<Image> StreamTexture2D::load_image_from_file(FileAccess *f, int p_size_limit, bool *r_partial) {
+	if (r_partial) {
+		*r_partial = false;
+	}
+
 	uint32_t data_format = f->get_32();
 	uint32_t w = f->get_16();
 	uint32_t h = f->get_16();
@@ -338,6 +343,8 @@ Ref<Image> StreamTexture2D::load_image_from_file(FileAccess *f, int p_size_limit
 		int total_size = 0;
 
 		bool first = true;
+		int first_w = w;
+		int first_h = h;
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
@@ -347,23 +354,28 @@ Ref<Image> StreamTexture2D::load_image_from_file(FileAccess *f, int p_size_limit
 				sw = MAX(sw >> 1, 1);
 				sh = MAX(sh >> 1, 1);
 				f->seek(f->get_position() + size);
+				if (r_partial) {
+					*r_partial = true;
+				}
 				continue;
 			}
 
+			// Decode straight from memory when the file is mapped (e.g. in a PCK), otherwise read it first.
 			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
+			const uint8_t *r = f->get_buffer_view(size);
+			if (!r) {
+				pv.resize(size);
+				f->get_buffer(pv.ptrw(), size);
+				r = pv.ptr();
 			}
 
 			Ref<Image> img;
 			if (data_format == DATA_FORMAT_BASIS_UNIVERSAL) {
-				img = Image::basis_universal_unpacker(pv);
+				img = Image::basis_universal_unpacker(r, size);
 			} else if (data_format == DATA_FORMAT_LOSSLESS) {
-				img = Image::lossless_unpacker(pv);
+				img = Image::lossless_unpacker(r, size);
 			} else {
-				img = Image::lossy_unpacker(pv);
+				img = Image::lossy_unpacker(r, size);
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -374,6 +386,8 @@ Ref<Image> StreamTexture2D::load_image_from_file(FileAccess *f, int p_size_limit
 				//format will actually be the format of the first image,
 				//as it may have changed on compression
 				format = img->get_format();
+				first_w = sw;
+				first_h = sh;
 				first = false;
 			} else if (img->get_format() != format) {
 				img->convert(format); //all needs to be the same format
@@ -415,7 +429,7 @@ Ref<Image> StreamTexture2D::load_image_from_file(FileAccess *f, int p_size_limit
 				}
 			}
 
-			image->create(w, h, true, mipmap_images[0]->get_format(), img_data);
+			image->create(first_w, first_h, true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
@@ -426,13 +440,17 @@ Ref<Image> StreamTexture2D::load_image_from_file(FileAccess *f, int p_size_limit
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
+				if (r_partial) {
+					*r_partial = true;
 				}
 				continue; //oops, size limit enforced, go to next
 			}
 
+			if (ofs) {
+				f->seek(f->get_position() + ofs);
+			}
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -490,7 +508,7 @@ Image::Format StreamTexture2D::get_format() const {
 	return format;
 }
 
-Error StreamTexture2D::_load_data(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
+Error StreamTexture2D::_load_data(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit, bool *r_partial) {
 	alpha_cache.unref();
 
 	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
@@ -539,7 +557,7 @@ Error StreamTexture2D::_load_data(const String &p_path, int &tw, int &th, int &t
 		p_size_limit = 0;
 	}
 
-	image = load_image_from_file(f, p_size_limit);
+	image = load_image_from_file(f, p_size_limit, r_partial);
 
 	memdelete(f);
 
@@ -550,7 +568,241 @@ Error StreamTexture2D::_load_data(const String &p_path, int &tw, int &th, int &t
 	return OK;
 }
 
+Ref<Image> StreamTexture2D::_load_stream_image(const String &p_path, int p_size_limit) {
+	FileAccess *f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(!f, Ref<Image>(), vformat("Unable to open file: %s.", p_path));
+
+	// Header was already validated by _load_data(): magic, version, custom size, data format,
+	// mipmap limit and reserved words.
+	f->seek(4 + 4 * 8);
+	Ref<Image> image = load_image_from_file(f, p_size_limit);
+	memdelete(f);
+
+	return image;
+}
+
+void StreamTexture2D::_stream_thread_func(void *p_ud) {
+	while (true) {
+		stream_semaphore->wait();
+
+		stream_mutex->lock();
+		if (stream_thread_exit) {
+			stream_mutex->unlock();
+			break;
+		}
+		if (stream_queue.is_empty()) {
+			stream_mutex->unlock();
+			continue;
+		}
+		Ref<StreamTexture2D> tex = stream_queue.front()->get();
+		stream_queue.pop_front();
+		stream_mutex->unlock();
+
+		tex->_stream_in();
+	}
+}
+
+_FORCE_INLINE_ void StreamTexture2D::_stream_touch() const {
+	// Unlocked fast path, _stream_request() checks both flags again under the lock.
+	if (stream_partial.load(std::memory_order_relaxed)) {
+		stream_last_used.store(OS::get_singleton()->get_ticks_msec(), std::memory_order_relaxed);
+		if (!stream_queued.load(std::memory_order_relaxed)) {
+			_stream_request();
+		}
+	}
+}
+
+void StreamTexture2D::_stream_request() const {
+	if (reference_get_count() == 0) {
+		return; // Not held by a Ref (yet), can't be queued safely.
+	}
+
+	MutexLock lock(*stream_mutex);
+	if (!stream_partial || stream_queued) {
+		return;
+	}
+
+	StreamTexture2D *self = const_cast<StreamTexture2D *>(this);
+	self->stream_queued = true;
+	stream_queue.push_back(Ref<StreamTexture2D>(self));
+
+	if (!stream_thread) {
+		stream_thread_exit = false;
+		stream_thread = memnew(Thread);
+		stream_thread->start(_stream_thread_func, nullptr, Thread::get_role_settings(Thread::ROLE_LOADER));
+	}
+	stream_semaphore->post();
+}
+
+void StreamTexture2D::_stream_in() {
+	// Runs on the streaming thread, RenderingServer queues the texture calls for its own thread.
+	Ref<Image> image = _load_stream_image(path_to_file, 0);
+
+	MutexLock lock(*stream_mutex);
+	stream_queued = false;
+	if (image.is_null() || image->is_empty() || !stream_partial) {
+		return;
+	}
+
+	RID new_texture = RS::get_singleton()->texture_2d_create(image);
+	RS::get_singleton()->texture_replace(texture, new_texture);
+	RS::get_singleton()->texture_set_size_override(texture, w, h);
+
+	stream_partial = false;
+	stream_size = image->get_data().size();
+	stream_resident_size += stream_size;
+	stream_resident_element = stream_resident.push_back(this);
+
+	// Over budget, send the least recently used textures back to their low mipmaps.
+	while (stream_budget > 0 && stream_resident_size > stream_budget) {
+		StreamTexture2D *lru = _stream_get_lru();
+		if (!lru) {
+			break;
+		}
+		lru->_stream_out();
+	}
+
+	// Near the video memory budget reported by the driver, also send one texture back per texture streamed in.
+	// Freed memory is only reclaimed a few frames later, so the usage can't be checked in a loop.
+	if (_stream_is_video_memory_low()) {
+		StreamTexture2D *lru = _stream_get_lru();
+		if (lru) {
+			lru->_stream_out();
+		}
+	}
+}
+
+StreamTexture2D *StreamTexture2D::_stream_get_lru() const {
+	// Called with stream_mutex locked.
+	StreamTexture2D *lru = nullptr;
+	for (List<StreamTexture2D *>::Element *E = stream_resident.front(); E; E = E->next()) {
+		if (E->get() != this && (!lru || E->get()->stream_last_used < lru->stream_last_used)) {
+			lru = E->get();
+		}
+	}
+	return lru;
+}
+
+bool StreamTexture2D::_stream_is_video_memory_low() {
+	if (stream_low_memory_threshold <= 0.0) {
+		return false;
+	}
+	uint64_t budget = RS::get_singleton()->get_render_info(RS::INFO_VIDEO_MEM_BUDGET);
+	return budget > 0 && RS::get_singleton()->get_render_info(RS::INFO_VIDEO_MEM_USED) > uint64_t(budget * double(stream_low_memory_threshold));
+}
+
+void StreamTexture2D::_stream_out() {
+	// Called with stream_mutex locked.
+	Ref<Image> image = _load_stream_image(path_to_file, stream_initial_size);
+	if (image.is_null() || image->is_empty()) {
+		return;
+	}
+
+	RID new_texture = RS::get_singleton()->texture_2d_create(image);
+	RS::get_singleton()->texture_replace(texture, new_texture);
+	RS::get_singleton()->texture_set_size_override(texture, w, h);
+
+	_stream_unregister();
+	stream_partial = true;
+}
+
+void StreamTexture2D::_stream_unregister() {
+	// Called with stream_mutex locked.
+	if (stream_resident_element) {
+		stream_resident_size -= stream_size;
+		stream_resident.erase(stream_resident_element);
+		stream_resident_element = nullptr;
+	}
+	stream_size = 0;
+}
+
+void StreamTexture2D::initialize_streaming() {
+	stream_enabled = GLOBAL_GET("rendering/textures/streaming/enabled");
+	stream_initial_size = GLOBAL_GET("rendering/textures/streaming/initial_max_size");
+	stream_budget = uint64_t(int(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb"))) * 1024 * 1024;
+	stream_low_memory_threshold = GLOBAL_GET("rendering/quality/video_memory/low_memory_threshold");
+	stream_mutex = memnew(Mutex);
+	stream_semaphore = memnew(Semaphore);
+}
+
+void StreamTexture2D::finish_streaming() {
+	if (stream_thread) {
+		stream_mutex->lock();
+		stream_thread_exit = true;
+		stream_mutex->unlock();
+		stream_semaphore->post();
+		stream_thread->wait_to_finish();
+		memdelete(stream_thread);
+		stream_thread = nullptr;
+	}
+	stream_queue.clear();
+
+	memdelete(stream_semaphore);
+	stream_semaphore = nullptr;
+	memdelete(stream_mutex);
+	stream_mutex = nullptr;
+}
+
+bool StreamTexture2D::load_image_data = true;
+bool StreamTexture2D::stream_enabled = false;
+int StreamTexture2D::stream_initial_size = 256;
+uint64_t StreamTexture2D::stream_budget = 0;
+float StreamTexture2D::stream_low_memory_threshold = 0.0;
+uint64_t StreamTexture2D::stream_resident_size = 0;
+bool StreamTexture2D::stream_thread_exit = false;
+Mutex *StreamTexture2D::stream_mutex = nullptr;
+Semaphore *StreamTexture2D::stream_semaphore = nullptr;
+Thread *StreamTexture2D::stream_thread = nullptr;
+List<Ref<StreamTexture2D>> StreamTexture2D::stream_queue;
+List<StreamTexture2D *> StreamTexture2D::stream_resident;
+
+Error StreamTexture2D::_load_placeholder(const String &p_path) {
+	FileAccess *f = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(!f, ERR_CANT_OPEN, vformat("Unable to open file: %s.", p_path));
+
+	uint8_t header[4];
+	f->get_buffer(header, 4);
+	if (header[0] != 'G' || header[1] != 'S' || header[2] != 'T' || header[3] != '2') {
+		memdelete(f);
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Stream texture file is corrupt (Bad header).");
+	}
+	if (f->get_32() > FORMAT_VERSION) {
+		memdelete(f);
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Stream texture file is too new.");
+	}
+	int w_custom = f->get_32();
+	int h_custom = f->get_32();
+
+	// Skip the data format, mipmap limit and reserved words, then read the header of the image.
+	f->seek(4 + 4 * 8);
+	f->get_32(); // Data format.
+	int w_image = f->get_16();
+	int h_image = f->get_16();
+	f->get_32(); // Mipmaps.
+	format = Image::Format(f->get_32());
+	memdelete(f);
+
+	if (texture.is_valid()) {
+		RID new_texture = RS::get_singleton()->texture_2d_placeholder_create();
+		RS::get_singleton()->texture_replace(texture, new_texture);
+	} else {
+		texture = RS::get_singleton()->texture_2d_placeholder_create();
+	}
+
+	w = w_custom ? w_custom : w_image;
+	h = h_custom ? h_custom : h_image;
+	path_to_file = p_path;
+
+	notify_property_list_changed();
+	emit_changed();
+	return OK;
+}
+
 Error StreamTexture2D::load(const String &p_path) {
+	if (!load_image_data) {
+		return _load_placeholder(p_path);
+	}
+
 	int lw, lh, lwc, lhc;
 	Ref<Image> image;
 	image.instance();
@@ -559,12 +811,19 @@ Error StreamTexture2D::load(const String &p_path) {
 	bool request_normal;
 	bool request_roughness;
 	int mipmap_limit;
+	bool partial = false;
 
-	Error err = _load_data(p_path, lw, lh, lwc, lhc, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	Error err = _load_data(p_path, lw, lh, lwc, lhc, image, request_3d, request_normal, request_roughness, mipmap_limit, stream_enabled ? stream_initial_size : 0, &partial);
 	if (err) {
 		return err;
 	}
 
+	if (stream_mutex) {
+		MutexLock lock(*stream_mutex);
+		_stream_unregister();
+		stream_partial = partial;
+	}
+
 	if (texture.is_valid()) {
 		RID new_texture = RS::get_singleton()->texture_2d_create(image);
 		RS::get_singleton()->texture_replace(texture, new_texture);
@@ -633,6 +892,7 @@ RID StreamTexture2D::get_rid() const {
 	if (!texture.is_valid()) {
 		texture = RS::get_singleton()->texture_2d_placeholder_create();
 	}
+	_stream_touch();
 	return texture;
 }
 
@@ -640,6 +900,7 @@ void StreamTexture2D::draw(RID p_canvas_item, const Point2 &p_pos, const Color &
 	if ((w | h) == 0) {
 		return;
 	}
+	_stream_touch();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, Rect2(p_pos, Size2(w, h)), texture, false, p_modulate, p_transpose);
 }
 
@@ -647,6 +908,7 @@ void StreamTexture2D::draw_rect(RID p_canvas_item, const Rect2 &p_rect, bool p_t
 	if ((w | h) == 0) {
 		return;
 	}
+	_stream_touch();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, p_rect, texture, p_tile, p_modulate, p_transpose);
 }
 
@@ -654,6 +916,7 @@ void StreamTexture2D::draw_rect_region(RID p_canvas_item, const Rect2 &p_rect, c
 	if ((w | h) == 0) {
 		return;
 	}
+	_stream_touch();
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas_item, p_rect, texture, p_src_rect, p_modulate, p_transpose, p_clip_uv);
 }
 
@@ -731,6 +994,10 @@ void StreamTexture2D::_bind_methods() {
 StreamTexture2D::StreamTexture2D() {}
 
 StreamTexture2D::~StreamTexture2D() {
+	if (stream_mutex) {
+		MutexLock lock(*stream_mutex);
+		_stream_unregister();
+	}
 	if (texture.is_valid()) {
 		RS::get_singleton()->free(texture);
 	}
@@ -37,12 +37,16 @@
 #include "core/os/file_access.h"
 #include "core/os/mutex.h"
 #include "core/os/rw_lock.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "scene/resources/curve.h"
 #include "scene/resources/gradient.h"
 #include "servers/camera_server.h"
 #include "servers/rendering_server.h"
 
+#include <atomic>
+
 class Texture : public Resource {
 	GDCLASS(Texture, Resource);
 
@@ -158,7 +162,7 @@ public:
 	};
 
 private:
-	Error _load_data(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
+	Error _load_data(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0, bool *r_partial = nullptr);
 	String path_to_file;
 	mutable RID texture;
 	Image::Format format = Image::FORMAT_MAX;
@@ -172,12 +176,53 @@ private:
 	static void _requested_roughness(void *p_ud, const String &p_normal_path, RS::TextureDetectRoughnessChannel p_roughness_channel);
 	static void _requested_normal(void *p_ud);
 
+	// Streaming, for textures imported as streamed: only the mipmaps up to stream_initial_size are
+	// loaded at first, the full chain is loaded in the background once the texture is used.
+	// Written under stream_mutex, but also read without it every time the texture is used.
+	std::atomic<bool> stream_partial = { false }; // Not all mipmaps are loaded.
+	std::atomic<bool> stream_queued = { false };
+	uint64_t stream_size = 0; // Size of the full mipmap chain, while resident.
+	mutable std::atomic<uint64_t> stream_last_used = { 0 };
+	List<StreamTexture2D *>::Element *stream_resident_element = nullptr;
+
+	_FORCE_INLINE_ void _stream_touch() const;
+	void _stream_request() const;
+	void _stream_in();
+	void _stream_out();
+	void _stream_unregister();
+	StreamTexture2D *_stream_get_lru() const;
+	static bool _stream_is_video_memory_low();
+	static Ref<Image> _load_stream_image(const String &p_path, int p_size_limit);
+	static void _stream_thread_func(void *p_ud);
+
+	static bool load_image_data;
+	Error _load_placeholder(const String &p_path);
+
+	static bool stream_enabled;
+	static int stream_initial_size;
+	static uint64_t stream_budget;
+	static float stream_low_memory_threshold;
+	static uint64_t stream_resident_size;
+	static bool stream_thread_exit;
+	static Mutex *stream_mutex;
+	static Semaphore *stream_semaphore;
+	static Thread *stream_thread;
+	static List<Ref<StreamTexture2D>> stream_queue;
+	static List<StreamTexture2D *> stream_resident;
+
 protected:
 	static void _bind_methods();
 	void _validate_property(PropertyInfo &property) const override;
 
 public:
-	static Ref<Image> load_image_from_file(FileAccess *p_file, int p_size_limit);
+	static Ref<Image> load_image_from_file(FileAccess *p_file, int p_size_limit, bool *r_partial = nullptr);
+
+	static void initialize_streaming();
+	static void finish_streaming();
+
+	// When disabled, only the size and format of textures are read and they are loaded as placeholders.
+	// For headless instances, which never draw.
+	static void set_load_image_data(bool p_enable) { load_image_data = p_enable; }
 
 	typedef void (*TextureFormatRequestCallback)(const Ref<StreamTexture2D> &);
 	typedef void (*TextureFormatRoughnessRequestCallback)(const Ref<StreamTexture2D> &, const String &p_normal_path, RS::TextureDetectRoughnessChannel p_roughness_channel);
@@ -1577,11 +1577,16 @@ void VisualShader::_update_shader() const {
 	}
 	final_code += tcode;
 
-	const_cast<VisualShader *>(this)->set_code(final_code);
+	// Graph edits that don't change the generated code (moving nodes, editing comments, etc.)
+	// don't need the rendering server to compile the shader again.
+	const bool code_changed = previous_code != final_code;
+	if (code_changed) {
+		const_cast<VisualShader *>(this)->set_code(final_code);
+	}
 	for (int i = 0; i < default_tex_params.size(); i++) {
 		const_cast<VisualShader *>(this)->set_default_texture_param(default_tex_params[i].name, default_tex_params[i].param);
 	}
-	if (previous_code != final_code) {
+	if (code_changed) {
 		const_cast<VisualShader *>(this)->emit_signal("changed");
 	}
 	previous_code = final_code;
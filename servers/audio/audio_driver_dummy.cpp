@@ -48,7 +48,9 @@ Error AudioDriverDummy::init() {
 
 	samples_in = memnew_arr(int32_t, buffer_frames * channels);
 
-	thread.start(AudioDriverDummy::thread_func, this);
+	if (use_threads) {
+		thread.start(AudioDriverDummy::thread_func, this, Thread::get_role_settings(Thread::ROLE_AUDIO));
+	}
 
 	return OK;
 };
@@ -95,7 +97,9 @@ void AudioDriverDummy::unlock() {
 
 void AudioDriverDummy::finish() {
 	exit_thread = true;
-	thread.wait_to_finish();
+	if (thread.is_started()) {
+		thread.wait_to_finish();
+	}
 
 	if (samples_in) {
 		memdelete_arr(samples_in);
@@ -54,6 +54,8 @@ class AudioDriverDummy : public AudioDriver {
 	bool thread_exited;
 	mutable bool exit_thread;
 
+	bool use_threads = true;
+
 public:
 	const char *get_name() const {
 		return "Dummy";
@@ -67,6 +69,9 @@ public:
 	virtual void unlock();
 	virtual void finish();
 
+	// Without the thread nothing is mixed, streams don't advance. Must be set before init().
+	void set_use_threads(bool p_use_threads) { use_threads = p_use_threads; }
+
 	AudioDriverDummy() {}
 	~AudioDriverDummy() {}
 };
@@ -0,0 +1,191 @@
+/*************************************************************************/
+/*  audio_mix_kernels.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "audio_mix_kernels.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AUDIO_SSE2_ENABLED
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define AUDIO_NEON_ENABLED
+#endif
+
+static_assert(sizeof(AudioFrame) == 2 * sizeof(float), "AudioFrame must be two packed floats.");
+
+void AudioMixKernels::scale_ramp(AudioFrame *p_buffer, int p_frames, float p_volume, float p_volume_inc) {
+	int i = 0;
+	float *buf = (float *)p_buffer;
+
+#if defined(AUDIO_SSE2_ENABLED)
+	__m128 vol = _mm_set_ps(p_volume + p_volume_inc, p_volume + p_volume_inc, p_volume, p_volume);
+	const __m128 inc = _mm_set1_ps(p_volume_inc * 2.0f);
+	for (; i + 2 <= p_frames; i += 2) {
+		_mm_storeu_ps(buf + i * 2, _mm_mul_ps(_mm_loadu_ps(buf + i * 2), vol));
+		vol = _mm_add_ps(vol, inc);
+	}
+#elif defined(AUDIO_NEON_ENABLED)
+	float32x4_t vol = vcombine_f32(vdup_n_f32(p_volume), vdup_n_f32(p_volume + p_volume_inc));
+	const float32x4_t inc = vdupq_n_f32(p_volume_inc * 2.0f);
+	for (; i + 2 <= p_frames; i += 2) {
+		vst1q_f32(buf + i * 2, vmulq_f32(vld1q_f32(buf + i * 2), vol));
+		vol = vaddq_f32(vol, inc);
+	}
+#endif
+
+	float vol_tail = p_volume + p_volume_inc * i;
+	for (; i < p_frames; i++) {
+		p_buffer[i] *= vol_tail;
+		vol_tail += p_volume_inc;
+	}
+}
+
+void AudioMixKernels::mix(AudioFrame *p_dst, const AudioFrame *p_src, int p_frames, const AudioFrame &p_volume) {
+	int i = 0;
+	float *dst = (float *)p_dst;
+	const float *src = (const float *)p_src;
+
+#if defined(AUDIO_SSE2_ENABLED)
+	const __m128 vol = _mm_set_ps(p_volume.r, p_volume.l, p_volume.r, p_volume.l);
+	for (; i + 2 <= p_frames; i += 2) {
+		_mm_storeu_ps(dst + i * 2, _mm_add_ps(_mm_loadu_ps(dst + i * 2), _mm_mul_ps(_mm_loadu_ps(src + i * 2), vol)));
+	}
+#elif defined(AUDIO_NEON_ENABLED)
+	const float32x2_t vol_half = { p_volume.l, p_volume.r };
+	const float32x4_t vol = vcombine_f32(vol_half, vol_half);
+	for (; i + 2 <= p_frames; i += 2) {
+		vst1q_f32(dst + i * 2, vaddq_f32(vld1q_f32(dst + i * 2), vmulq_f32(vld1q_f32(src + i * 2), vol)));
+	}
+#endif
+
+	for (; i < p_frames; i++) {
+		p_dst[i] += p_src[i] * p_volume;
+	}
+}
+
+void AudioMixKernels::mix_ramp(AudioFrame *p_dst, const AudioFrame *p_src, int p_frames, const AudioFrame &p_volume, const AudioFrame &p_volume_inc) {
+	int i = 0;
+	float *dst = (float *)p_dst;
+	const float *src = (const float *)p_src;
+
+#if defined(AUDIO_SSE2_ENABLED)
+	__m128 vol = _mm_set_ps(p_volume.r + p_volume_inc.r, p_volume.l + p_volume_inc.l, p_volume.r, p_volume.l);
+	const __m128 inc = _mm_set_ps(p_volume_inc.r * 2.0f, p_volume_inc.l * 2.0f, p_volume_inc.r * 2.0f, p_volume_inc.l * 2.0f);
+	for (; i + 2 <= p_frames; i += 2) {
+		_mm_storeu_ps(dst + i * 2, _mm_add_ps(_mm_loadu_ps(dst + i * 2), _mm_mul_ps(_mm_loadu_ps(src + i * 2), vol)));
+		vol = _mm_add_ps(vol, inc);
+	}
+#elif defined(AUDIO_NEON_ENABLED)
+	const float32x2_t vol_first = { p_volume.l, p_volume.r };
+	const float32x2_t vol_second = { p_volume.l + p_volume_inc.l, p_volume.r + p_volume_inc.r };
+	const float32x2_t inc_half = { p_volume_inc.l * 2.0f, p_volume_inc.r * 2.0f };
+	float32x4_t vol = vcombine_f32(vol_first, vol_second);
+	const float32x4_t inc = vcombine_f32(inc_half, inc_half);
+	for (; i + 2 <= p_frames; i += 2) {
+		vst1q_f32(dst + i * 2, vaddq_f32(vld1q_f32(dst + i * 2), vmulq_f32(vld1q_f32(src + i * 2), vol)));
+		vol = vaddq_f32(vol, inc);
+	}
+#endif
+
+	AudioFrame vol_tail = p_volume + p_volume_inc * float(i);
+	for (; i < p_frames; i++) {
+		p_dst[i] += p_src[i] * vol_tail;
+		vol_tail += p_volume_inc;
+	}
+}
+
+void AudioMixKernels::resample_cubic(AudioFrame *p_dst, const AudioFrame *p_src, int p_frames, uint64_t p_offset, uint64_t p_increment) {
+	int i = 0;
+
+#if defined(AUDIO_SSE2_ENABLED) || defined(AUDIO_NEON_ENABLED)
+	// Two output frames per iteration, one in each half of the registers.
+	for (; i + 2 <= p_frames; i += 2) {
+		uint64_t offset_a = p_offset;
+		uint64_t offset_b = p_offset + p_increment;
+		p_offset += p_increment * 2;
+
+		const float *a = (const float *)(p_src + (offset_a >> RESAMPLE_FRAC_BITS));
+		const float *b = (const float *)(p_src + (offset_b >> RESAMPLE_FRAC_BITS));
+		float mu_a = (offset_a & RESAMPLE_FRAC_MASK) / float(RESAMPLE_FRAC_LEN);
+		float mu_b = (offset_b & RESAMPLE_FRAC_MASK) / float(RESAMPLE_FRAC_LEN);
+
+#if defined(AUDIO_SSE2_ENABLED)
+		__m128 y0 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(a + 0)), (const __m64 *)(b + 0));
+		__m128 y1 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(a + 2)), (const __m64 *)(b + 2));
+		__m128 y2 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(a + 4)), (const __m64 *)(b + 4));
+		__m128 y3 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(a + 6)), (const __m64 *)(b + 6));
+		__m128 mu = _mm_set_ps(mu_b, mu_b, mu_a, mu_a);
+		__m128 mu2 = _mm_mul_ps(mu, mu);
+
+		// Same operation order as the scalar loop below.
+		__m128 a0 = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(y3, y2), y0), y1);
+		__m128 a1 = _mm_sub_ps(_mm_sub_ps(y0, y1), a0);
+		__m128 a2 = _mm_sub_ps(y2, y0);
+		__m128 res = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(a0, mu), mu2), _mm_mul_ps(a1, mu2)), _mm_mul_ps(a2, mu)), y1);
+		_mm_storeu_ps((float *)(p_dst + i), res);
+#else
+		float32x4_t y0 = vcombine_f32(vld1_f32(a + 0), vld1_f32(b + 0));
+		float32x4_t y1 = vcombine_f32(vld1_f32(a + 2), vld1_f32(b + 2));
+		float32x4_t y2 = vcombine_f32(vld1_f32(a + 4), vld1_f32(b + 4));
+		float32x4_t y3 = vcombine_f32(vld1_f32(a + 6), vld1_f32(b + 6));
+		float32x4_t mu = vcombine_f32(vdup_n_f32(mu_a), vdup_n_f32(mu_b));
+		float32x4_t mu2 = vmulq_f32(mu, mu);
+
+		// Same operation order as the scalar loop below.
+		float32x4_t a0 = vaddq_f32(vsubq_f32(vsubq_f32(y3, y2), y0), y1);
+		float32x4_t a1 = vsubq_f32(vsubq_f32(y0, y1), a0);
+		float32x4_t a2 = vsubq_f32(y2, y0);
+		float32x4_t res = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(vmulq_f32(a0, mu), mu2), vmulq_f32(a1, mu2)), vmulq_f32(a2, mu)), y1);
+		vst1q_f32((float *)(p_dst + i), res);
+#endif
+	}
+#endif
+
+	for (; i < p_frames; i++) {
+		const AudioFrame *y = p_src + (p_offset >> RESAMPLE_FRAC_BITS);
+		//standard cubic interpolation (great quality/performance ratio)
+		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+		float mu = (p_offset & RESAMPLE_FRAC_MASK) / float(RESAMPLE_FRAC_LEN);
+		AudioFrame y0 = y[0];
+		AudioFrame y1 = y[1];
+		AudioFrame y2 = y[2];
+		AudioFrame y3 = y[3];
+
+		float mu2 = mu * mu;
+		AudioFrame a0 = y3 - y2 - y0 + y1;
+		AudioFrame a1 = y0 - y1 - a0;
+		AudioFrame a2 = y2 - y0;
+		AudioFrame a3 = y1;
+
+		p_dst[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3);
+
+		p_offset += p_increment;
+	}
+}
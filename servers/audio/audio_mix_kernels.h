@@ -0,0 +1,60 @@
+/*************************************************************************/
+/*  audio_mix_kernels.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef AUDIO_MIX_KERNELS_H
+#define AUDIO_MIX_KERNELS_H
+
+#include "core/math/audio_frame.h"
+
+// Inner loops shared by the stream players and resamplers. They process two
+// frames per SSE2/NEON register when available, and give the same results as
+// the equivalent per-frame loops (up to float rounding of the volume ramps).
+class AudioMixKernels {
+public:
+	enum {
+		RESAMPLE_FRAC_BITS = 16,
+		RESAMPLE_FRAC_LEN = (1 << RESAMPLE_FRAC_BITS),
+		RESAMPLE_FRAC_MASK = RESAMPLE_FRAC_LEN - 1,
+	};
+
+	// p_buffer[i] *= p_volume + p_volume_inc * i
+	static void scale_ramp(AudioFrame *p_buffer, int p_frames, float p_volume, float p_volume_inc);
+	// p_dst[i] += p_src[i] * p_volume
+	static void mix(AudioFrame *p_dst, const AudioFrame *p_src, int p_frames, const AudioFrame &p_volume);
+	// p_dst[i] += p_src[i] * (p_volume + p_volume_inc * i)
+	static void mix_ramp(AudioFrame *p_dst, const AudioFrame *p_src, int p_frames, const AudioFrame &p_volume, const AudioFrame &p_volume_inc);
+
+	// Cubic interpolation of p_src at fixed point positions p_offset + p_increment * i
+	// (RESAMPLE_FRAC_BITS fraction bits). Frame i reads p_src[pos] to p_src[pos + 3],
+	// where pos is the integer part of its position.
+	static void resample_cubic(AudioFrame *p_dst, const AudioFrame *p_src, int p_frames, uint64_t p_offset, uint64_t p_increment);
+};
+
+#endif // AUDIO_MIX_KERNELS_H
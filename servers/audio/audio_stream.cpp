@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
+#include "servers/audio/audio_mix_kernels.h"
 
 //////////////////////////////
 
@@ -52,25 +53,23 @@ void AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 
 	uint64_t mix_increment = uint64_t(((get_stream_sampling_rate() * p_rate_scale) / double(target_rate * global_rate_scale)) * double(FP_LEN));
 
-	for (int i = 0; i < p_frames; i++) {
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
-		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
-
-		float mu2 = mu * mu;
-		AudioFrame a0 = y3 - y2 - y0 + y1;
-		AudioFrame a1 = y0 - y1 - a0;
-		AudioFrame a2 = y2 - y0;
-		AudioFrame a3 = y1;
-
-		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3);
+	static_assert(int(FP_BITS) == int(AudioMixKernels::RESAMPLE_FRAC_BITS), "Resampling fixed point formats must match.");
+
+	int done = 0;
+	while (done < p_frames) {
+		// Mix as many frames as possible before internal_buffer has to be refilled.
+		int todo = p_frames - done;
+		uint64_t buffer_end = uint64_t(INTERNAL_BUFFER_LEN) << FP_BITS;
+		if (mix_increment > 0 && mix_offset < buffer_end) {
+			todo = (int)MIN(uint64_t(todo), (buffer_end - mix_offset + mix_increment - 1) / mix_increment);
+		} else if (mix_offset >= buffer_end) {
+			todo = 0;
+		}
 
-		mix_offset += mix_increment;
+		// Frame i interpolates internal_buffer[pos + 1] to internal_buffer[pos + 4].
+		AudioMixKernels::resample_cubic(p_buffer + done, internal_buffer + CUBIC_INTERP_HISTORY - 3, todo, mix_offset, mix_increment);
+		mix_offset += mix_increment * todo;
+		done += todo;
 
 		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
 			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
@@ -281,6 +280,14 @@ float AudioStreamRandomPitch::get_length() const {
 	return 0;
 }
 
+bool AudioStreamRandomPitch::has_loop() const {
+	if (audio_stream.is_valid()) {
+		return audio_stream->has_loop();
+	}
+
+	return false;
+}
+
 void AudioStreamRandomPitch::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_audio_stream", "stream"), &AudioStreamRandomPitch::set_audio_stream);
 	ClassDB::bind_method(D_METHOD("get_audio_stream"), &AudioStreamRandomPitch::get_audio_stream);
@@ -0,0 +1,144 @@
+/*************************************************************************/
+/*  audio_stream_prefetch.cpp                                            */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "audio_stream_prefetch.h"
+
+#include "servers/audio_server.h"
+
+int AudioStreamPrefetch::_read(AudioFrame *p_buffer, int p_frames) {
+	buffer_lock.lock();
+	int read = buffer.read(p_buffer, p_frames);
+	buffer_lock.unlock();
+	return read;
+}
+
+void AudioStreamPrefetch::init(DecodeFunc p_decode, void *p_userdata, int p_buffer_frames) {
+	ERR_FAIL_COND(decode != nullptr);
+
+	decode = p_decode;
+	userdata = p_userdata;
+	buffer.resize(nearest_shift(MAX(p_buffer_frames, int(CHUNK_FRAMES))));
+
+	AudioServer::get_singleton()->prefetch_add(this);
+}
+
+void AudioStreamPrefetch::finish() {
+	if (decode == nullptr) {
+		return;
+	}
+
+	// Waits until the prefetch thread is done with this stream.
+	AudioServer::get_singleton()->prefetch_remove(this);
+
+	playing = false;
+	decode = nullptr;
+	userdata = nullptr;
+}
+
+void AudioStreamPrefetch::fill() {
+	if (!playing || ended || decoder_mutex.try_lock() != OK) {
+		return;
+	}
+
+	while (playing && !ended) {
+		buffer_lock.lock();
+		int todo = MIN(buffer.space_left(), int(CHUNK_FRAMES));
+		buffer_lock.unlock();
+
+		if (todo == 0) {
+			break;
+		}
+
+		int decoded = decode(userdata, chunk, todo);
+
+		buffer_lock.lock();
+		buffer.write(chunk, decoded);
+		buffer_lock.unlock();
+
+		if (decoded < todo) {
+			ended = true;
+		}
+	}
+
+	decoder_mutex.unlock();
+}
+
+bool AudioStreamPrefetch::mix(AudioFrame *p_buffer, int p_frames) {
+	int mixed = _read(p_buffer, p_frames);
+
+	if (mixed < p_frames && decoder_mutex.try_lock() == OK) {
+		// The worker is behind but not decoding right now, catch up here.
+		mixed += _read(p_buffer + mixed, p_frames - mixed);
+		if (mixed < p_frames && !ended) {
+			int todo = p_frames - mixed;
+			int decoded = decode(userdata, p_buffer + mixed, todo);
+			if (decoded < todo) {
+				ended = true;
+			}
+			mixed += decoded;
+		}
+		decoder_mutex.unlock();
+	}
+
+	for (int i = mixed; i < p_frames; i++) {
+		p_buffer[i] = AudioFrame(0, 0);
+	}
+
+	return !ended || get_buffered_frames() > 0;
+}
+
+void AudioStreamPrefetch::clear() {
+	buffer_lock.lock();
+	buffer.clear();
+	buffer_lock.unlock();
+
+	ended = false;
+	playing = true;
+}
+
+void AudioStreamPrefetch::stop() {
+	playing = false;
+}
+
+int AudioStreamPrefetch::get_buffered_frames() const {
+	buffer_lock.lock();
+	int frames = buffer.data_left();
+	buffer_lock.unlock();
+	return frames;
+}
+
+AudioStreamPrefetch::AudioStreamPrefetch() {
+	playing = false;
+	ended = false;
+}
+
+AudioStreamPrefetch::~AudioStreamPrefetch() {
+	finish();
+}
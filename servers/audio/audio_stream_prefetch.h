@@ -0,0 +1,92 @@
+/*************************************************************************/
+/*  audio_stream_prefetch.h                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef AUDIO_STREAM_PREFETCH_H
+#define AUDIO_STREAM_PREFETCH_H
+
+#include "core/math/audio_frame.h"
+#include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
+#include "core/templates/ring_buffer.h"
+
+#include <atomic>
+
+// Decodes a compressed playback ahead of the audio thread. A worker thread
+// owned by the AudioServer keeps the buffer filled, so the mix only has to
+// copy frames. When the worker falls behind and is not decoding this stream,
+// the audio thread decodes the missing frames itself.
+class AudioStreamPrefetch {
+public:
+	// Decodes up to p_frames frames from the current decoder position, and
+	// returns how many were written. Less than p_frames means end of stream.
+	typedef int (*DecodeFunc)(void *p_userdata, AudioFrame *p_buffer, int p_frames);
+
+private:
+	enum {
+		CHUNK_FRAMES = 1024
+	};
+
+	DecodeFunc decode = nullptr;
+	void *userdata = nullptr;
+
+	Mutex decoder_mutex; // Held while the decoder state is used.
+	mutable SpinLock buffer_lock; // Held while the ring buffer positions change.
+	RingBuffer<AudioFrame> buffer;
+	AudioFrame chunk[CHUNK_FRAMES];
+
+	std::atomic<bool> playing;
+	std::atomic<bool> ended;
+
+	int _read(AudioFrame *p_buffer, int p_frames);
+
+public:
+	void init(DecodeFunc p_decode, void *p_userdata, int p_buffer_frames);
+	void finish();
+
+	// Called from the prefetch thread.
+	void fill();
+
+	// Called from the audio thread, returns false once the end of the stream was played.
+	bool mix(AudioFrame *p_buffer, int p_frames);
+
+	// Moving the decoder (seeking) must be done between lock() and unlock(),
+	// followed by clear() to drop the frames decoded from the old position.
+	void lock() { decoder_mutex.lock(); }
+	void unlock() { decoder_mutex.unlock(); }
+	void clear();
+	void stop();
+
+	int get_buffered_frames() const;
+
+	AudioStreamPrefetch();
+	~AudioStreamPrefetch();
+};
+
+#endif // AUDIO_STREAM_PREFETCH_H
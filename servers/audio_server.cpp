@@ -31,12 +31,14 @@
 #include "audio_server.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/io/resource_loader.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
 #include "scene/resources/audio_stream_sample.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_stream_prefetch.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #ifdef TOOLS_ENABLED
@@ -294,8 +296,12 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 }
 
 void AudioServer::_mix_step() {
+	CPU_PROFILE_SCOPE("AudioServer::mix_step");
+	MEMORY_TAG_SCOPE(TAG_AUDIO);
 	bool solo_mode = false;
 
+	_flush_commands();
+
 	for (int i = 0; i < buses.size(); i++) {
 		Bus *bus = buses[i];
 		bus->index_cache = i; //might be moved around by editor, so..
@@ -331,136 +337,198 @@ void AudioServer::_mix_step() {
 		}
 	}
 
+	_update_voices();
+
 	//make callbacks for mixing the audio
 	for (Set<CallbackItem>::Element *E = callbacks.front(); E; E = E->next()) {
 		E->get().callback(E->get().userdata);
 	}
 
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
-		Bus *bus = buses[i];
+	// A bus only sends to buses before it, so group buses by their distance
+	// from the sources. Buses of the same level don't feed each other and
+	// can be processed in parallel, their sends are then added up in order.
+	mix_solo_mode = solo_mode;
+	mix_bus_levels.resize(buses.size());
+	int level_count = 0;
+	for (int i = 0; i < buses.size(); i++) {
+		mix_bus_levels[i] = 0;
+	}
+	for (int i = buses.size() - 1; i > 0; i--) {
+		Bus *send = _get_bus_send(i);
+		mix_bus_levels[send->index_cache] = MAX(mix_bus_levels[send->index_cache], mix_bus_levels[i] + 1);
+		level_count = MAX(level_count, mix_bus_levels[i] + 1);
+	}
+	level_count = MAX(level_count, mix_bus_levels[0] + 1);
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	for (int level = 0; level < level_count; level++) {
+		mix_level_buses.clear();
+		int effect_buses = 0;
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			if (mix_bus_levels[i] != level) {
+				continue;
+			}
+			mix_level_buses.push_back(i);
+			if (!buses[i]->bypass && buses[i]->effects.size()) {
+				effect_buses++;
+			}
+		}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
+		if (effect_buses > 1 && bus_work_pool.get_thread_count() > 0) {
+			bus_work_pool.do_work(mix_level_buses.size(), this, &AudioServer::_process_bus_level, mix_level_buses.ptr());
+		} else {
+			for (uint32_t i = 0; i < mix_level_buses.size(); i++) {
+				_process_bus(mix_level_buses[i]);
 			}
 		}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+		for (uint32_t i = 0; i < mix_level_buses.size(); i++) {
+			_send_bus(mix_level_buses[i]);
+		}
+	}
+
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+
+	// Let streamed playbacks refill what was just consumed.
+	prefetch_semaphore.post();
+}
+
+void AudioServer::_process_bus_level(uint32_t p_index, const int *p_buses) {
+	_process_bus(p_buses[p_index]);
+}
+
+void AudioServer::_process_bus(int p_bus) {
+	Bus *bus = buses[p_bus];
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
+			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				buf[j] = AudioFrame(0, 0);
+			}
+		}
+	}
+
+	//process effects
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
+			}
 
 #ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 #endif
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), bus->channels.write[k].temp_buffer.ptrw(), buffer_size);
+			}
 
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+			//swap buffers, so internal buffer always has the right data
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				SWAP(bus->channels.write[k].buffer, bus->channels.write[k].temp_buffer);
+			}
 
 #ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
 #endif
-			}
 		}
+	}
 
-		//process send
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-		Bus *send = nullptr;
+		AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
+		AudioFrame peak = AudioFrame(0, 0);
+
+		float volume = Math::db2linear(bus->volume_db);
+
+		if (mix_solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
 			}
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
-				continue;
-			}
+		//apply volume and compute peak
+		for (uint32_t j = 0; j < buffer_size; j++) {
+			buf[j] *= volume;
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+			float l = ABS(buf[j].l);
+			if (l > peak.l) {
+				peak.l = l;
+			}
+			float r = ABS(buf[j].r);
+			if (r > peak.r) {
+				peak.r = r;
+			}
+		}
 
-			AudioFrame peak = AudioFrame(0, 0);
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear2db(peak.l + AUDIO_PEAK_OFFSET), Math::linear2db(peak.r + AUDIO_PEAK_OFFSET));
 
-			float volume = Math::db2linear(bus->volume_db);
+		if (!bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+			if (MAX(peak.r, peak.l) > Math::db2linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false; //went inactive, don't mix.
 			}
+		}
+	}
+}
 
-			//apply volume and compute peak
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+AudioServer::Bus *AudioServer::_get_bus_send(int p_bus) const {
+	if (p_bus == 0) {
+		return nullptr;
+	}
 
-				float l = ABS(buf[j].l);
-				if (l > peak.l) {
-					peak.l = l;
-				}
-				float r = ABS(buf[j].r);
-				if (r > peak.r) {
-					peak.r = r;
-				}
-			}
+	//everything has a send save for master bus
+	if (!bus_map.has(buses[p_bus]->send)) {
+		return buses[0];
+	}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear2db(peak.l + AUDIO_PEAK_OFFSET), Math::linear2db(peak.r + AUDIO_PEAK_OFFSET));
+	Bus *send = bus_map[buses[p_bus]->send];
+	if (send->index_cache >= buses[p_bus]->index_cache) { //invalid, send to master
+		return buses[0];
+	}
+	return send;
+}
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+void AudioServer::_send_bus(int p_bus) {
+	Bus *send = _get_bus_send(p_bus);
+	if (!send) {
+		return;
+	}
 
-				if (MAX(peak.r, peak.l) > Math::db2linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
-			}
+	Bus *bus = buses[p_bus];
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			continue;
+		}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		const AudioFrame *buf = bus->channels[k].buffer.ptr();
+		AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
-			}
+		for (uint32_t j = 0; j < buffer_size; j++) {
+			target_buf[j] += buf[j];
 		}
 	}
-
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
 }
 
 bool AudioServer::thread_has_channel_mix_buffer(int p_bus, int p_buffer) const {
@@ -545,11 +613,13 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].temp_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
 		buses[i]->mute = false;
 		buses[i]->bypass = false;
+		buses[i]->voice_limit = 0;
 		buses[i]->volume_db = 0;
 		if (i > 0) {
 			buses[i]->send = "Master";
@@ -614,11 +684,13 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].temp_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
 	bus->mute = false;
 	bus->bypass = false;
+	bus->voice_limit = 0;
 	bus->volume_db = 0;
 
 	bus_map[attempt] = bus;
@@ -789,6 +861,58 @@ bool AudioServer::is_bus_bypassing_effects(int p_bus) const {
 	return buses[p_bus]->bypass;
 }
 
+void AudioServer::set_bus_voice_limit(int p_bus, int p_limit) {
+	ERR_FAIL_INDEX(p_bus, buses.size());
+	ERR_FAIL_COND(p_limit < 0);
+
+	MARK_EDITED
+
+	buses[p_bus]->voice_limit = p_limit;
+}
+
+int AudioServer::get_bus_voice_limit(int p_bus) const {
+	ERR_FAIL_INDEX_V(p_bus, buses.size(), 0);
+
+	return buses[p_bus]->voice_limit;
+}
+
+void AudioServer::_update_voices() {
+	if (voices.is_empty()) {
+		return;
+	}
+
+	for (Set<Voice *>::Element *E = voices.front(); E; E = E->next()) {
+		Voice *voice = E->get();
+		voice->virtualized = voice->playing && voice->audibility < voice_virtualization_threshold;
+	}
+
+	// Past the limit of its bus, only the voices with the highest priority
+	// (and the loudest ones among equal priorities) stay real.
+	for (int i = 0; i < buses.size(); i++) {
+		int limit = buses[i]->voice_limit;
+		if (limit == 0) {
+			continue;
+		}
+
+		voice_sort.clear();
+		for (Set<Voice *>::Element *E = voices.front(); E; E = E->next()) {
+			Voice *voice = E->get();
+			if (voice->playing && !voice->virtualized && voice->bus_index == i) {
+				voice_sort.push_back(voice);
+			}
+		}
+
+		if (int(voice_sort.size()) <= limit) {
+			continue;
+		}
+
+		voice_sort.sort_custom<VoiceSort>();
+		for (uint32_t j = limit; j < voice_sort.size(); j++) {
+			voice_sort[j]->virtualized = true;
+		}
+	}
+}
+
 void AudioServer::_update_bus_effects(int p_bus) {
 	for (int i = 0; i < buses[p_bus]->channels.size(); i++) {
 		buses.write[p_bus]->channels.write[i].effect_instances.resize(buses[p_bus]->effects.size());
@@ -924,28 +1048,35 @@ float AudioServer::get_global_rate_scale() const {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
-
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
-
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].temp_buffer.resize(buffer_size);
 		}
 	}
 }
 
 void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/channel_disable_threshold_db", -60.0);
+	voice_virtualization_threshold = Math::db2linear(float(GLOBAL_DEF_RST("audio/voice_virtualization_threshold_db", -60.0)));
 	channel_disable_frames = float(GLOBAL_DEF_RST("audio/channel_disable_time", 2.0)) * get_mix_rate();
 	ProjectSettings::get_singleton()->set_custom_property_info("audio/channel_disable_time", PropertyInfo(Variant::FLOAT, "audio/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"));
-	buffer_size = 1024; //hardcoded for now
+	buffer_size = CLAMP(int(GLOBAL_DEF_RST("audio/mix_buffer_size", 1024)), 64, 4096);
+	ProjectSettings::get_singleton()->set_custom_property_info("audio/mix_buffer_size", PropertyInfo(Variant::INT, "audio/mix_buffer_size", PROPERTY_HINT_RANGE, "64,4096,1"));
 
 	init_channels_and_buffers();
 
+	if (GLOBAL_DEF_RST("audio/threaded_bus_processing", true)) {
+		// The audio thread takes part in the work too.
+		int threads = OS::get_singleton()->get_processor_count() - 1;
+		if (threads > 0) {
+			bus_work_pool.init(threads, Thread::ROLE_AUDIO);
+		}
+	}
+
+	prefetch_thread.start(_prefetch_thread_func, this, Thread::get_role_settings(Thread::ROLE_AUDIO));
+
 	mix_count = 0;
 	set_bus_count(1);
 	set_bus_name(0, "Master");
@@ -1050,6 +1181,14 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	bus_work_pool.finish();
+
+	if (prefetch_thread.is_started()) {
+		prefetch_thread_exit = true;
+		prefetch_semaphore.post();
+		prefetch_thread.wait_to_finish();
+	}
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -1133,6 +1272,102 @@ void AudioServer::remove_update_callback(AudioCallback p_callback, void *p_userd
 	unlock();
 }
 
+void AudioServer::_flush_commands() {
+	uint32_t read = command_read.load(std::memory_order_relaxed);
+	uint32_t write = command_write.load(std::memory_order_acquire);
+
+	while (read != write) {
+		// The value is left in place, so it is freed by the thread pushing
+		// the next command rather than in the middle of a mix.
+		const Command &command = commands[read % COMMAND_QUEUE_SIZE];
+		if (command.func) {
+			command.func(command.target, command.value);
+		}
+		read++;
+	}
+
+	command_read.store(read, std::memory_order_release);
+}
+
+void AudioServer::push_command(AudioCommandFunc p_func, void *p_target, const Variant &p_value) {
+	command_push_lock.lock();
+
+	uint32_t write = command_write.load(std::memory_order_relaxed);
+	if (write - command_read.load(std::memory_order_acquire) == COMMAND_QUEUE_SIZE) {
+		command_push_lock.unlock();
+
+		// The audio thread is stalled or not mixing, apply everything now.
+		lock();
+		_flush_commands();
+		p_func(p_target, p_value);
+		unlock();
+		return;
+	}
+
+	Command &command = commands[write % COMMAND_QUEUE_SIZE];
+	command.func = p_func;
+	command.target = p_target;
+	command.value = p_value;
+	command_write.store(write + 1, std::memory_order_release);
+
+	command_push_lock.unlock();
+}
+
+void AudioServer::cancel_commands(void *p_target) {
+	lock();
+	command_push_lock.lock();
+
+	uint32_t write = command_write.load(std::memory_order_relaxed);
+	for (uint32_t i = command_read.load(std::memory_order_relaxed); i != write; i++) {
+		Command &command = commands[i % COMMAND_QUEUE_SIZE];
+		if (command.target == p_target) {
+			command.func = nullptr;
+		}
+	}
+
+	command_push_lock.unlock();
+	unlock();
+}
+
+void AudioServer::_prefetch_thread_func(void *p_udata) {
+	AudioServer *as = (AudioServer *)p_udata;
+
+	while (true) {
+		// Woken up after each mix step.
+		as->prefetch_semaphore.wait();
+		if (as->prefetch_thread_exit) {
+			break;
+		}
+
+		MutexLock lock(as->prefetch_mutex);
+		for (Set<AudioStreamPrefetch *>::Element *E = as->prefetches.front(); E; E = E->next()) {
+			E->get()->fill();
+		}
+	}
+}
+
+void AudioServer::prefetch_add(AudioStreamPrefetch *p_prefetch) {
+	MutexLock lock(prefetch_mutex);
+	prefetches.insert(p_prefetch);
+}
+
+void AudioServer::prefetch_remove(AudioStreamPrefetch *p_prefetch) {
+	MutexLock lock(prefetch_mutex);
+	prefetches.erase(p_prefetch);
+}
+
+void AudioServer::voice_add(Voice *p_voice) {
+	lock();
+	voices.insert(p_voice);
+	unlock();
+}
+
+void AudioServer::voice_remove(Voice *p_voice) {
+	lock();
+	voices.erase(p_voice);
+	unlock();
+}
+
 void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 	ERR_FAIL_COND(p_bus_layout.is_null() || p_bus_layout->buses.size() == 0);
 
@@ -1154,6 +1389,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		bus->solo = p_bus_layout->buses[i].solo;
 		bus->mute = p_bus_layout->buses[i].mute;
 		bus->bypass = p_bus_layout->buses[i].bypass;
+		bus->voice_limit = p_bus_layout->buses[i].voice_limit;
 		bus->volume_db = p_bus_layout->buses[i].volume_db;
 
 		for (int j = 0; j < p_bus_layout->buses[i].effects.size(); j++) {
@@ -1173,6 +1409,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].temp_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1194,6 +1431,7 @@ Ref<AudioBusLayout> AudioServer::generate_bus_layout() const {
 		state->buses.write[i].mute = buses[i]->mute;
 		state->buses.write[i].solo = buses[i]->solo;
 		state->buses.write[i].bypass = buses[i]->bypass;
+		state->buses.write[i].voice_limit = buses[i]->voice_limit;
 		state->buses.write[i].volume_db = buses[i]->volume_db;
 		for (int j = 0; j < buses[i]->effects.size(); j++) {
 			AudioBusLayout::Bus::Effect fx;
@@ -1259,6 +1497,9 @@ void AudioServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_bus_bypass_effects", "bus_idx", "enable"), &AudioServer::set_bus_bypass_effects);
 	ClassDB::bind_method(D_METHOD("is_bus_bypassing_effects", "bus_idx"), &AudioServer::is_bus_bypassing_effects);
 
+	ClassDB::bind_method(D_METHOD("set_bus_voice_limit", "bus_idx", "limit"), &AudioServer::set_bus_voice_limit);
+	ClassDB::bind_method(D_METHOD("get_bus_voice_limit", "bus_idx"), &AudioServer::get_bus_voice_limit);
+
 	ClassDB::bind_method(D_METHOD("add_bus_effect", "bus_idx", "effect", "at_position"), &AudioServer::add_bus_effect, DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("remove_bus_effect", "bus_idx", "effect_idx"), &AudioServer::remove_bus_effect);
 
@@ -1319,6 +1560,9 @@ AudioServer::AudioServer() {
 	mix_time = 0;
 	mix_size = 0;
 	global_rate_scale = 1;
+	voice_virtualization_threshold = 0;
+	command_read = 0;
+	command_write = 0;
 }
 
 AudioServer::~AudioServer() {
@@ -1347,6 +1591,8 @@ bool AudioBusLayout::_set(const StringName &p_name, const Variant &p_value) {
 			bus.mute = p_value;
 		} else if (what == "bypass_fx") {
 			bus.bypass = p_value;
+		} else if (what == "voice_limit") {
+			bus.voice_limit = p_value;
 		} else if (what == "volume_db") {
 			bus.volume_db = p_value;
 		} else if (what == "send") {
@@ -1399,6 +1645,8 @@ bool AudioBusLayout::_get(const StringName &p_name, Variant &r_ret) const {
 			r_ret = bus.mute;
 		} else if (what == "bypass_fx") {
 			r_ret = bus.bypass;
+		} else if (what == "voice_limit") {
+			r_ret = bus.voice_limit;
 		} else if (what == "volume_db") {
 			r_ret = bus.volume_db;
 		} else if (what == "send") {
@@ -1437,6 +1685,7 @@ void AudioBusLayout::_get_property_list(List<PropertyInfo> *p_list) const {
 		p_list->push_back(PropertyInfo(Variant::BOOL, "bus/" + itos(i) + "/solo", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "bus/" + itos(i) + "/mute", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "bus/" + itos(i) + "/bypass_fx", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		p_list->push_back(PropertyInfo(Variant::INT, "bus/" + itos(i) + "/voice_limit", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::FLOAT, "bus/" + itos(i) + "/volume_db", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::FLOAT, "bus/" + itos(i) + "/send", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 
@@ -34,11 +34,19 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/spin_lock.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/thread_work_pool.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
 
+#include <atomic>
+
 class AudioDriverDummy;
 class AudioStream;
+class AudioStreamPrefetch;
 class AudioStreamSample;
 
 class AudioDriver {
@@ -138,6 +146,7 @@ public:
 	static void initialize(int p_driver);
 	static int get_driver_count();
 	static AudioDriver *get_driver(int p_driver);
+	static AudioDriverDummy *get_dummy_driver() { return &dummy_driver; }
 };
 
 class AudioBusLayout;
@@ -159,6 +168,18 @@ public:
 	};
 
 	typedef void (*AudioCallback)(void *p_userdata);
+	typedef void (*AudioCommandFunc)(void *p_target, const Variant &p_value);
+
+	// A playback taking part in voice management. The owner keeps the
+	// fields up to date, the server sets `virtualized` before each mix.
+	// Virtualized voices should keep their position but skip decoding.
+	struct Voice {
+		int bus_index = 0;
+		int priority = 0;
+		float audibility = 1.0; // Loudest linear volume the voice is heard at.
+		bool playing = false;
+		bool virtualized = false;
+	};
 
 private:
 	uint64_t mix_time;
@@ -178,12 +199,14 @@ private:
 	int to_mix;
 
 	float global_rate_scale;
+	float voice_virtualization_threshold;
 
 	struct Bus {
 		StringName name;
 		bool solo;
 		bool mute;
 		bool bypass;
+		int voice_limit = 0;
 
 		bool soloed;
 
@@ -193,6 +216,7 @@ private:
 			bool active;
 			AudioFrame peak_volume;
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> temp_buffer; // Effect output, swapped with buffer after each effect.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio;
 			Channel() {
@@ -219,11 +243,21 @@ private:
 		int index_cache;
 	};
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
 	Vector<Bus *> buses;
 	Map<StringName, Bus *> bus_map;
 
+	ThreadWorkPool bus_work_pool;
+	bool mix_solo_mode = false;
+	LocalVector<int> mix_bus_levels;
+	LocalVector<int> mix_level_buses;
+
 	void _update_bus_effects(int p_bus);
+	void _update_voices();
+
+	Bus *_get_bus_send(int p_bus) const;
+	void _process_bus(int p_bus);
+	void _process_bus_level(uint32_t p_index, const int *p_buses);
+	void _send_bus(int p_bus);
 
 	static AudioServer *singleton;
 
@@ -243,6 +277,45 @@ private:
 	Set<CallbackItem> callbacks;
 	Set<CallbackItem> update_callbacks;
 
+	struct VoiceSort {
+		_FORCE_INLINE_ bool operator()(const Voice *p_a, const Voice *p_b) const {
+			if (p_a->priority != p_b->priority) {
+				return p_a->priority > p_b->priority;
+			}
+			return p_a->audibility > p_b->audibility;
+		}
+	};
+
+	Set<Voice *> voices;
+	LocalVector<Voice *> voice_sort;
+
+	// Changes pushed from other threads, applied by the audio thread before
+	// the next mix step. Pushing never waits for the mix to finish.
+	enum {
+		COMMAND_QUEUE_SIZE = 256
+	};
+
+	struct Command {
+		AudioCommandFunc func = nullptr;
+		void *target = nullptr;
+		Variant value;
+	};
+
+	Command commands[COMMAND_QUEUE_SIZE];
+	std::atomic<uint32_t> command_read;
+	std::atomic<uint32_t> command_write;
+	SpinLock command_push_lock;
+
+	void _flush_commands();
+
+	Thread prefetch_thread;
+	Semaphore prefetch_semaphore;
+	Mutex prefetch_mutex;
+	bool prefetch_thread_exit = false;
+	Set<AudioStreamPrefetch *> prefetches;
+
+	static void _prefetch_thread_func(void *p_udata);
+
 	friend class AudioDriver;
 	void _driver_process(int p_frames, int32_t *p_buffer);
 
@@ -299,6 +372,9 @@ public:
 	void set_bus_bypass_effects(int p_bus, bool p_enable);
 	bool is_bus_bypassing_effects(int p_bus) const;
 
+	void set_bus_voice_limit(int p_bus, int p_limit);
+	int get_bus_voice_limit(int p_bus) const;
+
 	void add_bus_effect(int p_bus, const Ref<AudioEffect> &p_effect, int p_at_pos = -1);
 	void remove_bus_effect(int p_bus, int p_effect);
 
@@ -346,6 +422,15 @@ public:
 	void add_update_callback(AudioCallback p_callback, void *p_userdata);
 	void remove_update_callback(AudioCallback p_callback, void *p_userdata);
 
+	void push_command(AudioCommandFunc p_func, void *p_target, const Variant &p_value = Variant());
+	void cancel_commands(void *p_target);
+
+	void voice_add(Voice *p_voice);
+	void voice_remove(Voice *p_voice);
+
+	void prefetch_add(AudioStreamPrefetch *p_prefetch);
+	void prefetch_remove(AudioStreamPrefetch *p_prefetch);
+
 	void set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout);
 	Ref<AudioBusLayout> generate_bus_layout() const;
 
@@ -373,6 +458,7 @@ class AudioBusLayout : public Resource {
 		bool solo;
 		bool mute;
 		bool bypass;
+		int voice_limit;
 
 		struct Effect {
 			Ref<AudioEffect> effect;
@@ -388,6 +474,7 @@ class AudioBusLayout : public Resource {
 			solo = false;
 			mute = false;
 			bypass = false;
+			voice_limit = 0;
 			volume_db = 0;
 		}
 	};
@@ -0,0 +1,58 @@
+/*************************************************************************/
+/*  broad_phase_bvh_common.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef BROAD_PHASE_BVH_COMMON_H
+#define BROAD_PHASE_BVH_COMMON_H
+
+#include "core/os/memory.h"
+
+// DynamicBVH query shared by the 2D and 3D BVH broad phases. Adds a pair cache entry between
+// the queried element and every element found in its volume, except for itself and for other
+// shapes of the same collision object (those never collide with each other).
+template <class TElement, class TPairData>
+struct BroadPhaseBVHPairQuery {
+	TElement *element = nullptr;
+
+	_FORCE_INLINE_ bool operator()(void *p_data) {
+		TElement *other = (TElement *)p_data;
+		if (other == element || other->owner == element->owner) {
+			return false;
+		}
+		if (!element->paired.has(other)) {
+			TPairData *pd = memnew(TPairData);
+			element->paired[other] = pd;
+			other->paired[element] = pd;
+		}
+		return false;
+	}
+};
+
+#endif // BROAD_PHASE_BVH_COMMON_H
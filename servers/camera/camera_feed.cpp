@@ -139,19 +139,20 @@ RID CameraFeed::get_texture(CameraServer::FeedImage p_which) {
 CameraFeed::CameraFeed() {
 	// initialize our feed
 	id = CameraServer::get_singleton()->get_free_id();
+	base_width = 0;
+	base_height = 0;
 	name = "???";
 	active = false;
 	datatype = CameraFeed::FEED_RGB;
 	position = CameraFeed::FEED_UNSPECIFIED;
 	transform = Transform2D(1.0, 0.0, 0.0, -1.0, 0.0, 1.0);
 
-// FIXME: Disabled during Vulkan refactoring, should be ported.
-#if 0
-	// create a texture object
-	RenderingServer *vs = RenderingServer::get_singleton();
-	texture[CameraServer::FEED_Y_IMAGE] = vs->texture_create(); // also used for RGBA
-	texture[CameraServer::FEED_CBCR_IMAGE] = vs->texture_create();
-#endif
+	// create our texture objects, they get their real size and format with the first frame
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (int i = 0; i < CameraServer::FEED_IMAGES; i++) {
+		texture[i] = rs->texture_2d_placeholder_create(); // FEED_Y_IMAGE is also used for RGBA
+		texture_format[i] = Image::FORMAT_MAX;
+	}
 }
 
 CameraFeed::CameraFeed(String p_name, FeedPosition p_position) {
@@ -165,102 +166,76 @@ CameraFeed::CameraFeed(String p_name, FeedPosition p_position) {
 	position = p_position;
 	transform = Transform2D(1.0, 0.0, 0.0, -1.0, 0.0, 1.0);
 
-// FIXME: Disabled during Vulkan refactoring, should be ported.
-#if 0
-	// create a texture object
-	RenderingServer *vs = RenderingServer::get_singleton();
-	texture[CameraServer::FEED_Y_IMAGE] = vs->texture_create(); // also used for RGBA
-	texture[CameraServer::FEED_CBCR_IMAGE] = vs->texture_create();
-#endif
+	// create our texture objects, they get their real size and format with the first frame
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (int i = 0; i < CameraServer::FEED_IMAGES; i++) {
+		texture[i] = rs->texture_2d_placeholder_create(); // FEED_Y_IMAGE is also used for RGBA
+		texture_format[i] = Image::FORMAT_MAX;
+	}
 }
 
 CameraFeed::~CameraFeed() {
-// FIXME: Disabled during Vulkan refactoring, should be ported.
-#if 0
 	// Free our textures
-	RenderingServer *vs = RenderingServer::get_singleton();
-	vs->free(texture[CameraServer::FEED_Y_IMAGE]);
-	vs->free(texture[CameraServer::FEED_CBCR_IMAGE]);
-#endif
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (int i = 0; i < CameraServer::FEED_IMAGES; i++) {
+		rs->free(texture[i]);
+	}
 }
 
-void CameraFeed::set_RGB_img(Ref<Image> p_rgb_img) {
-// FIXME: Disabled during Vulkan refactoring, should be ported.
-#if 0
-	if (active) {
-		RenderingServer *vs = RenderingServer::get_singleton();
+void CameraFeed::_update_texture(CameraServer::FeedImage p_which, const Ref<Image> &p_image) {
+	ERR_FAIL_COND(p_image.is_null() || p_image->is_empty());
 
-		int new_width = p_rgb_img->get_width();
-		int new_height = p_rgb_img->get_height();
+	RenderingServer *rs = RenderingServer::get_singleton();
 
-		if ((base_width != new_width) || (base_height != new_height)) {
-			// We're assuming here that our camera image doesn't change around formats etc, allocate the whole lot...
-			base_width = new_width;
-			base_height = new_height;
+	Size2i size = p_image->get_size();
+	Image::Format format = p_image->get_format();
 
-			vs->texture_allocate(texture[CameraServer::FEED_RGBA_IMAGE], new_width, new_height, 0, Image::FORMAT_RGB8, RS::TEXTURE_TYPE_2D, RS::TEXTURE_FLAGS_DEFAULT);
-		}
+	if (texture_size[p_which] != size || texture_format[p_which] != format) {
+		// We're assuming here that our camera image doesn't change around formats etc, so this only happens on the first frame.
+		// The new texture takes over the RID, so whatever already uses it keeps working.
+		RID new_texture = rs->texture_2d_create(p_image);
+		rs->texture_replace(texture[p_which], new_texture);
+		texture_size[p_which] = size;
+		texture_format[p_which] = format;
+	} else {
+		// Same size and format, upload the frame into the existing texture instead of allocating a new one.
+		rs->texture_2d_update(texture[p_which], p_image);
+	}
+}
+
+void CameraFeed::set_RGB_img(Ref<Image> p_rgb_img) {
+	if (active) {
+		_update_texture(CameraServer::FEED_RGBA_IMAGE, p_rgb_img);
 
-		vs->texture_set_data(texture[CameraServer::FEED_RGBA_IMAGE], p_rgb_img);
+		base_width = p_rgb_img->get_width();
+		base_height = p_rgb_img->get_height();
 		datatype = CameraFeed::FEED_RGB;
 	}
-#endif
 }
 
 void CameraFeed::set_YCbCr_img(Ref<Image> p_ycbcr_img) {
-// FIXME: Disabled during Vulkan refactoring, should be ported.
-#if 0
 	if (active) {
-		RenderingServer *vs = RenderingServer::get_singleton();
-
-		int new_width = p_ycbcr_img->get_width();
-		int new_height = p_ycbcr_img->get_height();
-
-		if ((base_width != new_width) || (base_height != new_height)) {
-			// We're assuming here that our camera image doesn't change around formats etc, allocate the whole lot...
-			base_width = new_width;
-			base_height = new_height;
+		_update_texture(CameraServer::FEED_YCBCR_IMAGE, p_ycbcr_img);
 
-			vs->texture_allocate(texture[CameraServer::FEED_RGBA_IMAGE], new_width, new_height, 0, Image::FORMAT_RGB8, RS::TEXTURE_TYPE_2D, RS::TEXTURE_FLAGS_DEFAULT);
-		}
-
-		vs->texture_set_data(texture[CameraServer::FEED_RGBA_IMAGE], p_ycbcr_img);
+		base_width = p_ycbcr_img->get_width();
+		base_height = p_ycbcr_img->get_height();
 		datatype = CameraFeed::FEED_YCBCR;
 	}
-#endif
 }
 
 void CameraFeed::set_YCbCr_imgs(Ref<Image> p_y_img, Ref<Image> p_cbcr_img) {
-// FIXME: Disabled during Vulkan refactoring, should be ported.
-#if 0
 	if (active) {
-		RenderingServer *vs = RenderingServer::get_singleton();
-
 		///@TODO investigate whether we can use thirdparty/misc/yuv2rgb.h here to convert our YUV data to RGB, our shader approach is potentially faster though..
 		// Wondering about including that into multiple projects, may cause issues.
 		// That said, if we convert to RGB, we could enable using texture resources again...
 
-		int new_y_width = p_y_img->get_width();
-		int new_y_height = p_y_img->get_height();
-		int new_cbcr_width = p_cbcr_img->get_width();
-		int new_cbcr_height = p_cbcr_img->get_height();
+		_update_texture(CameraServer::FEED_Y_IMAGE, p_y_img);
+		_update_texture(CameraServer::FEED_CBCR_IMAGE, p_cbcr_img);
 
-		if ((base_width != new_y_width) || (base_height != new_y_height)) {
-			// We're assuming here that our camera image doesn't change around formats etc, allocate the whole lot...
-			base_width = new_y_width;
-			base_height = new_y_height;
-
-			vs->texture_allocate(texture[CameraServer::FEED_Y_IMAGE], new_y_width, new_y_height, 0, Image::FORMAT_R8, RS::TEXTURE_TYPE_2D, RS::TEXTURE_FLAG_USED_FOR_STREAMING);
-
-			///@TODO GLES2 doesn't support FORMAT_RG8, need to do some form of conversion
-			vs->texture_allocate(texture[CameraServer::FEED_CBCR_IMAGE], new_cbcr_width, new_cbcr_height, 0, Image::FORMAT_RG8, RS::TEXTURE_TYPE_2D, RS::TEXTURE_FLAG_USED_FOR_STREAMING);
-		}
-
-		vs->texture_set_data(texture[CameraServer::FEED_Y_IMAGE], p_y_img);
-		vs->texture_set_data(texture[CameraServer::FEED_CBCR_IMAGE], p_cbcr_img);
+		base_width = p_y_img->get_width();
+		base_height = p_y_img->get_height();
 		datatype = CameraFeed::FEED_YCBCR_SEP;
 	}
-#endif
 }
 
 // FIXME: Disabled during Vulkan refactoring, should be ported.
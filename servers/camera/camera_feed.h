@@ -65,6 +65,12 @@ private:
 	int base_width;
 	int base_height;
 
+	// Size and format the textures were last created with, while a frame matches them it's uploaded in place.
+	Size2i texture_size[CameraServer::FEED_IMAGES];
+	Image::Format texture_format[CameraServer::FEED_IMAGES];
+
+	void _update_texture(CameraServer::FeedImage p_which, const Ref<Image> &p_image);
+
 protected:
 	String name; // name of our camera feed
 	FeedDataType datatype; // type of texture data stored
@@ -108,6 +108,7 @@ public:
 		FEATURE_ORIENTATION,
 		FEATURE_SWAP_BUFFERS,
 		FEATURE_KEEP_SCREEN_ON,
+		FEATURE_WAIT_FOR_EVENTS,
 	};
 
 	virtual bool has_feature(Feature p_feature) const = 0;
@@ -40,8 +40,14 @@ bool AreaPair2DSW::setup(real_t p_step) {
 		result = true;
 	}
 
-	if (result != colliding) {
-		if (result) {
+	_set_colliding(result);
+
+	return false; //never do any post solving
+}
+
+void AreaPair2DSW::_set_colliding(bool p_colliding) {
+	if (p_colliding != colliding) {
+		if (p_colliding) {
 			if (area->get_space_override_mode() != PhysicsServer2D::AREA_SPACE_OVERRIDE_DISABLED) {
 				body->add_area(area);
 			}
@@ -58,15 +64,34 @@ bool AreaPair2DSW::setup(real_t p_step) {
 			}
 		}
 
-		colliding = result;
+		colliding = p_colliding;
 	}
-
-	return false; //never do any post solving
 }
 
 void AreaPair2DSW::solve(real_t p_step) {
 }
 
+Constraint2DSW::Key AreaPair2DSW::get_key() const {
+	Key key;
+	key.id_a = body->get_self().get_id();
+	key.id_b = area->get_self().get_id();
+	key.sub_index = (uint32_t(body_shape) << 16) | uint32_t(area_shape);
+	return key;
+}
+
+// The overlap state decides which areas affect the body, so it's part of the simulation state.
+uint32_t AreaPair2DSW::get_snapshot_size() const {
+	return 1;
+}
+
+void AreaPair2DSW::save_snapshot(uint8_t *r_data) const {
+	r_data[0] = colliding;
+}
+
+void AreaPair2DSW::load_snapshot(const uint8_t *p_data) {
+	_set_colliding(p_data && p_data[0]);
+}
+
 AreaPair2DSW::AreaPair2DSW(Body2DSW *p_body, int p_body_shape, Area2DSW *p_area, int p_area_shape) {
 	body = p_body;
 	area = p_area;
@@ -132,6 +157,23 @@ bool Area2Pair2DSW::setup(real_t p_step) {
 void Area2Pair2DSW::solve(real_t p_step) {
 }
 
+Constraint2DSW::Key Area2Pair2DSW::get_key() const {
+	// The broadphase may report the areas in either order.
+	Key key;
+	uint64_t id_a = area_a->get_self().get_id();
+	uint64_t id_b = area_b->get_self().get_id();
+	if (id_a < id_b) {
+		key.id_a = id_a;
+		key.id_b = id_b;
+		key.sub_index = (uint32_t(shape_a) << 16) | uint32_t(shape_b);
+	} else {
+		key.id_a = id_b;
+		key.id_b = id_a;
+		key.sub_index = (uint32_t(shape_b) << 16) | uint32_t(shape_a);
+	}
+	return key;
+}
+
 Area2Pair2DSW::Area2Pair2DSW(Area2DSW *p_area_a, int p_shape_a, Area2DSW *p_area_b, int p_shape_b) {
 	area_a = p_area_a;
 	area_b = p_area_b;
@@ -42,10 +42,17 @@ class AreaPair2DSW : public Constraint2DSW {
 	int area_shape;
 	bool colliding;
 
+	void _set_colliding(bool p_colliding);
+
 public:
 	bool setup(real_t p_step);
 	void solve(real_t p_step);
 
+	virtual Key get_key() const;
+	virtual uint32_t get_snapshot_size() const;
+	virtual void save_snapshot(uint8_t *r_data) const;
+	virtual void load_snapshot(const uint8_t *p_data);
+
 	AreaPair2DSW(Body2DSW *p_body, int p_body_shape, Area2DSW *p_area, int p_area_shape);
 	~AreaPair2DSW();
 };
@@ -61,6 +68,8 @@ public:
 	bool setup(real_t p_step);
 	void solve(real_t p_step);
 
+	virtual Key get_key() const;
+
 	Area2Pair2DSW(Area2DSW *p_area_a, int p_shape_a, Area2DSW *p_area_b, int p_shape_b);
 	~Area2Pair2DSW();
 };
@@ -561,6 +561,35 @@ void Body2DSW::integrate_velocities(real_t p_step) {
 	//_update_inertia_tensor();
 }
 
+void Body2DSW::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.transform = get_transform();
+	r_snapshot.new_transform = new_transform;
+	r_snapshot.linear_velocity = linear_velocity;
+	r_snapshot.angular_velocity = angular_velocity;
+	r_snapshot.applied_force = applied_force;
+	r_snapshot.applied_torque = applied_torque;
+	r_snapshot.still_time = still_time;
+	r_snapshot.active = active;
+	r_snapshot.first_integration = first_integration;
+}
+
+void Body2DSW::restore_snapshot(const Snapshot &p_snapshot) {
+	_set_transform(p_snapshot.transform);
+	_set_inv_transform(p_snapshot.transform.affine_inverse());
+	new_transform = p_snapshot.new_transform;
+	linear_velocity = p_snapshot.linear_velocity;
+	angular_velocity = p_snapshot.angular_velocity;
+	applied_force = p_snapshot.applied_force;
+	applied_torque = p_snapshot.applied_torque;
+	first_integration = p_snapshot.first_integration;
+	set_active(p_snapshot.active);
+	still_time = p_snapshot.still_time;
+
+	if (fi_callback && get_space() && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list); // So the node gets the restored state.
+	}
+}
+
 void Body2DSW::wakeup_neighbours() {
 	for (List<Pair<Constraint2DSW *, int>>::Element *E = constraint_list.front(); E; E = E->next()) {
 		const Constraint2DSW *c = E->get().first;
@@ -289,6 +289,22 @@ public:
 
 	bool sleep_test(real_t p_step);
 
+	// State changed by the simulation, saved in space snapshots. The rest is set through the server.
+	struct Snapshot {
+		Transform2D transform;
+		Transform2D new_transform;
+		Vector2 linear_velocity;
+		real_t angular_velocity;
+		Vector2 applied_force;
+		real_t applied_torque;
+		real_t still_time;
+		bool active;
+		bool first_integration;
+	};
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
 	Body2DSW();
 	~Body2DSW();
 };
@@ -492,6 +492,46 @@ void BodyPair2DSW::solve(real_t p_step) {
 	}
 }
 
+Constraint2DSW::Key BodyPair2DSW::get_key() const {
+	Key key;
+	key.id_a = A->get_self().get_id();
+	key.id_b = B->get_self().get_id();
+	key.sub_index = (uint32_t(shape_A) << 16) | uint32_t(shape_B);
+	return key;
+}
+
+// Contacts are saved whole, reused ones keep warm starting the solver after a restore.
+uint32_t BodyPair2DSW::get_snapshot_size() const {
+	return sizeof(Vector2) + sizeof(int) + sizeof(bool) + sizeof(Contact) * MAX_CONTACTS;
+}
+
+void BodyPair2DSW::save_snapshot(uint8_t *r_data) const {
+	memcpy(r_data, &sep_axis, sizeof(Vector2));
+	r_data += sizeof(Vector2);
+	memcpy(r_data, &contact_count, sizeof(int));
+	r_data += sizeof(int);
+	memcpy(r_data, &collided, sizeof(bool));
+	r_data += sizeof(bool);
+	memcpy(r_data, contacts, sizeof(Contact) * MAX_CONTACTS);
+}
+
+void BodyPair2DSW::load_snapshot(const uint8_t *p_data) {
+	if (!p_data) {
+		sep_axis = Vector2();
+		contact_count = 0;
+		collided = false;
+		return;
+	}
+
+	memcpy(&sep_axis, p_data, sizeof(Vector2));
+	p_data += sizeof(Vector2);
+	memcpy(&contact_count, p_data, sizeof(int));
+	p_data += sizeof(int);
+	memcpy(&collided, p_data, sizeof(bool));
+	p_data += sizeof(bool);
+	memcpy(contacts, p_data, sizeof(Contact) * MAX_CONTACTS);
+}
+
 BodyPair2DSW::BodyPair2DSW(Body2DSW *p_A, int p_shape_A, Body2DSW *p_B, int p_shape_B) :
 		Constraint2DSW(_arr, 2) {
 	A = p_A;
@@ -87,6 +87,11 @@ public:
 	bool setup(real_t p_step);
 	void solve(real_t p_step);
 
+	virtual Key get_key() const;
+	virtual uint32_t get_snapshot_size() const;
+	virtual void save_snapshot(uint8_t *r_data) const;
+	virtual void load_snapshot(const uint8_t *p_data);
+
 	BodyPair2DSW(Body2DSW *p_A, int p_shape_A, Body2DSW *p_B, int p_shape_B);
 	~BodyPair2DSW();
 };
@@ -0,0 +1,315 @@
+/*************************************************************************/
+/*  broad_phase_2d_bvh.cpp                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "broad_phase_2d_bvh.h"
+#include "collision_object_2d_sw.h"
+#include "core/config/project_settings.h"
+
+void BroadPhase2DBVH::_unpair(Element *p_elem, Element *p_with, PairData *p_pd) {
+	if (p_pd->colliding && unpair_callback) {
+		unpair_callback(p_elem->owner, p_elem->subindex, p_with->owner, p_with->subindex, p_pd->ud, unpair_userdata);
+	}
+
+	p_elem->paired.erase(p_with);
+	p_with->paired.erase(p_elem);
+	memdelete(p_pd);
+}
+
+void BroadPhase2DBVH::_unpair_all(Element *p_elem) {
+	while (p_elem->paired.front()) {
+		Map<Element *, PairData *>::Element *E = p_elem->paired.front();
+		_unpair(p_elem, E->key(), E->get());
+	}
+}
+
+void BroadPhase2DBVH::_tree_insert(Element *p_elem) {
+	p_elem->fat_aabb = p_elem->aabb.grow(margin);
+	p_elem->tree_id = _get_tree(p_elem).insert(_rect_to_aabb(p_elem->fat_aabb), p_elem);
+}
+
+void BroadPhase2DBVH::_tree_remove(Element *p_elem) {
+	if (!p_elem->tree_id.is_valid()) {
+		return;
+	}
+	_get_tree(p_elem).remove(p_elem->tree_id);
+	p_elem->tree_id = DynamicBVH::ID();
+}
+
+void BroadPhase2DBVH::_mark_moved(Element *p_elem, bool p_tree_moved) {
+	p_elem->tree_moved = p_elem->tree_moved || p_tree_moved;
+	if (!p_elem->moved) {
+		p_elem->moved = true;
+		moved_elements.push_back(p_elem->self);
+	}
+}
+
+void BroadPhase2DBVH::_check_motion(Element *p_elem) {
+	Map<Element *, PairData *>::Element *E = p_elem->paired.front();
+	while (E) {
+		Map<Element *, PairData *>::Element *N = E->next();
+		Element *other = E->key();
+		PairData *pd = E->get();
+
+		if (!p_elem->fat_aabb.intersects(other->fat_aabb)) {
+			// Out of range of each other, drop the pair from the cache.
+			_unpair(p_elem, other, pd);
+			E = N;
+			continue;
+		}
+
+		bool physical_collision = p_elem->aabb.intersects(other->aabb);
+		bool logical_collision = p_elem->owner->test_collision_mask(other->owner);
+
+		if (physical_collision) {
+			if (pair_callback && (!pd->colliding || (logical_collision && !pd->ud))) {
+				pd->ud = pair_callback(p_elem->owner, p_elem->subindex, other->owner, other->subindex, pair_userdata);
+			} else if (pd->colliding && !logical_collision && pd->ud && unpair_callback) {
+				unpair_callback(p_elem->owner, p_elem->subindex, other->owner, other->subindex, pd->ud, unpair_userdata);
+				pd->ud = nullptr;
+			}
+			pd->colliding = true;
+		} else {
+			if (pd->colliding && unpair_callback) {
+				unpair_callback(p_elem->owner, p_elem->subindex, other->owner, other->subindex, pd->ud, unpair_userdata);
+			}
+			pd->ud = nullptr;
+			pd->colliding = false;
+		}
+
+		E = N;
+	}
+}
+
+BroadPhase2DBVH::ID BroadPhase2DBVH::create(CollisionObject2DSW *p_object, int p_subindex) {
+	current++;
+
+	Element e;
+	e.owner = p_object;
+	e.subindex = p_subindex;
+	e.self = current;
+
+	element_map[current] = e;
+	return current;
+}
+
+void BroadPhase2DBVH::move(ID p_id, const Rect2 &p_aabb) {
+	Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND(!E);
+
+	Element &e = E->get();
+	bool tree_moved = false;
+
+	if (p_aabb != e.aabb) {
+		e.aabb = p_aabb;
+
+		if (p_aabb == Rect2()) {
+			_tree_remove(&e);
+			_unpair_all(&e);
+		} else if (!e.tree_id.is_valid()) {
+			_tree_insert(&e);
+			tree_moved = true;
+		} else if (!e.fat_aabb.encloses(p_aabb)) {
+			// Only touch the tree once the element leaves its fat AABB.
+			e.fat_aabb = p_aabb.grow(margin);
+			_get_tree(&e).update(e.tree_id, _rect_to_aabb(e.fat_aabb));
+			tree_moved = true;
+		}
+	}
+
+	_mark_moved(&e, tree_moved);
+}
+
+void BroadPhase2DBVH::set_static(ID p_id, bool p_static) {
+	Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND(!E);
+
+	Element &e = E->get();
+
+	if (e._static == p_static) {
+		return;
+	}
+
+	bool in_tree = e.tree_id.is_valid();
+	_tree_remove(&e);
+
+	e._static = p_static;
+
+	if (p_static) {
+		// Static elements don't pair with each other.
+		Map<Element *, PairData *>::Element *F = e.paired.front();
+		while (F) {
+			Map<Element *, PairData *>::Element *N = F->next();
+			if (F->key()->_static) {
+				_unpair(&e, F->key(), F->get());
+			}
+			F = N;
+		}
+	}
+
+	if (in_tree) {
+		_tree_insert(&e);
+		_mark_moved(&e, true);
+	}
+}
+
+void BroadPhase2DBVH::remove(ID p_id) {
+	Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND(!E);
+
+	Element &e = E->get();
+
+	_tree_remove(&e);
+	_unpair_all(&e);
+
+	element_map.erase(E);
+}
+
+CollisionObject2DSW *BroadPhase2DBVH::get_object(ID p_id) const {
+	const Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND_V(!E, nullptr);
+	return E->get().owner;
+}
+
+bool BroadPhase2DBVH::is_static(ID p_id) const {
+	const Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND_V(!E, false);
+	return E->get()._static;
+}
+
+int BroadPhase2DBVH::get_subindex(ID p_id) const {
+	const Map<ID, Element>::Element *E = element_map.find(p_id);
+	ERR_FAIL_COND_V(!E, -1);
+	return E->get().subindex;
+}
+
+int BroadPhase2DBVH::cull_segment(const Vector2 &p_from, const Vector2 &p_to, CollisionObject2DSW **p_results, int p_max_results, int *p_result_indices) {
+	if (p_max_results <= 0) {
+		return 0;
+	}
+
+	CullQuery query;
+	query.from = &p_from;
+	query.to = &p_to;
+	query.results = p_results;
+	query.result_indices = p_result_indices;
+	query.max_results = p_max_results;
+
+	Vector3 from(p_from.x, p_from.y, 0);
+	Vector3 to(p_to.x, p_to.y, 0);
+
+	dynamic_tree.ray_query(from, to, query);
+	if (query.count < p_max_results) {
+		static_tree.ray_query(from, to, query);
+	}
+
+	return query.count;
+}
+
+int BroadPhase2DBVH::cull_aabb(const Rect2 &p_aabb, CollisionObject2DSW **p_results, int p_max_results, int *p_result_indices) {
+	if (p_max_results <= 0) {
+		return 0;
+	}
+
+	CullQuery query;
+	query.aabb = &p_aabb;
+	query.results = p_results;
+	query.result_indices = p_result_indices;
+	query.max_results = p_max_results;
+
+	AABB aabb = _rect_to_aabb(p_aabb);
+
+	dynamic_tree.aabb_query(aabb, query);
+	if (query.count < p_max_results) {
+		static_tree.aabb_query(aabb, query);
+	}
+
+	return query.count;
+}
+
+void BroadPhase2DBVH::set_pair_callback(PairCallback p_pair_callback, void *p_userdata) {
+	pair_callback = p_pair_callback;
+	pair_userdata = p_userdata;
+}
+
+void BroadPhase2DBVH::set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) {
+	unpair_callback = p_unpair_callback;
+	unpair_userdata = p_userdata;
+}
+
+void BroadPhase2DBVH::update() {
+	for (uint32_t i = 0; i < moved_elements.size(); i++) {
+		Map<ID, Element>::Element *E = element_map.find(moved_elements[i]);
+		if (!E) {
+			continue; // Removed after being moved.
+		}
+
+		Element *e = &E->get();
+		e->moved = false;
+
+		if (e->tree_moved && e->tree_id.is_valid()) {
+			// The fat AABB changed, look for new pairs. Existing ones are in the cache already.
+			PairQuery query;
+			query.element = e;
+
+			AABB aabb = _rect_to_aabb(e->fat_aabb);
+			dynamic_tree.aabb_query(aabb, query);
+			if (!e->_static) {
+				static_tree.aabb_query(aabb, query);
+			}
+		}
+		e->tree_moved = false;
+
+		_check_motion(e);
+	}
+
+	moved_elements.clear();
+
+	dynamic_tree.optimize_incremental(1);
+}
+
+BroadPhase2DSW *BroadPhase2DBVH::_create() {
+	return memnew(BroadPhase2DBVH);
+}
+
+BroadPhase2DBVH::BroadPhase2DBVH() {
+	margin = GLOBAL_DEF("physics/2d/bvh_collision_margin", 1.0);
+	ProjectSettings::get_singleton()->set_custom_property_info("physics/2d/bvh_collision_margin", PropertyInfo(Variant::FLOAT, "physics/2d/bvh_collision_margin", PROPERTY_HINT_RANGE, "0,20,0.1,or_greater"));
+}
+
+BroadPhase2DBVH::~BroadPhase2DBVH() {
+	// Pair data is shared by both elements, free it once.
+	for (Map<ID, Element>::Element *E = element_map.front(); E; E = E->next()) {
+		for (Map<Element *, PairData *>::Element *F = E->get().paired.front(); F; F = F->next()) {
+			if (F->key()->self > E->key()) {
+				memdelete(F->get());
+			}
+		}
+	}
+}
@@ -34,6 +34,26 @@
 #include "body_2d_sw.h"
 
 class Constraint2DSW {
+public:
+	// Identifies a constraint independently of memory addresses, deterministic spaces order constraints by it.
+	struct Key {
+		uint64_t id_a = 0;
+		uint64_t id_b = 0;
+		uint32_t sub_index = 0;
+
+		_FORCE_INLINE_ bool operator<(const Key &p_key) const {
+			if (id_a != p_key.id_a) {
+				return id_a < p_key.id_a;
+			}
+			if (id_b != p_key.id_b) {
+				return id_b < p_key.id_b;
+			}
+			return sub_index < p_key.sub_index;
+		}
+		_FORCE_INLINE_ bool operator==(const Key &p_key) const { return id_a == p_key.id_a && id_b == p_key.id_b && sub_index == p_key.sub_index; }
+	};
+
+private:
 	Body2DSW **_body_ptr;
 	int _body_count;
 	uint64_t island_step;
@@ -73,6 +93,18 @@ public:
 	virtual bool setup(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
 
+	virtual Key get_key() const {
+		Key key;
+		key.id_a = self.get_id();
+		return key;
+	}
+
+	// State carried between steps (contacts, overlaps), saved in space snapshots.
+	// Constraints without any (joints) are left to their owners. Loading null resets the state.
+	virtual uint32_t get_snapshot_size() const { return 0; }
+	virtual void save_snapshot(uint8_t *r_data) const {}
+	virtual void load_snapshot(const uint8_t *p_data) {}
+
 	virtual ~Constraint2DSW() {}
 };
 
@@ -31,6 +31,7 @@
 #include "physics_server_2d_sw.h"
 
 #include "broad_phase_2d_basic.h"
+#include "broad_phase_2d_bvh.h"
 #include "broad_phase_2d_hash_grid.h"
 #include "collision_solver_2d_sw.h"
 #include "core/config/project_settings.h"
@@ -275,6 +276,30 @@ int PhysicsServer2DSW::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+void PhysicsServer2DSW::space_set_deterministic(RID p_space, bool p_enabled) {
+	Space2DSW *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND(!space);
+	space->set_deterministic(p_enabled);
+}
+
+bool PhysicsServer2DSW::space_is_deterministic(RID p_space) const {
+	const Space2DSW *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND_V(!space, false);
+	return space->is_deterministic();
+}
+
+Vector<uint8_t> PhysicsServer2DSW::space_get_snapshot(RID p_space) const {
+	const Space2DSW *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND_V(!space, Vector<uint8_t>());
+	return space->get_snapshot();
+}
+
+void PhysicsServer2DSW::space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) {
+	Space2DSW *space = space_owner.getornull(p_space);
+	ERR_FAIL_COND(!space);
+	space->restore_snapshot(p_snapshot);
+}
+
 PhysicsDirectSpaceState2D *PhysicsServer2DSW::space_get_direct_state(RID p_space) {
 	Space2DSW *space = space_owner.getornull(p_space);
 	ERR_FAIL_COND_V(!space, nullptr);
@@ -1247,6 +1272,7 @@ void PhysicsServer2DSW::init() {
 };
 
 void PhysicsServer2DSW::step(real_t p_step) {
+	MEMORY_TAG_SCOPE(TAG_PHYSICS);
 	if (!active) {
 		return;
 	}
@@ -1271,6 +1297,7 @@ void PhysicsServer2DSW::sync() {
 };
 
 void PhysicsServer2DSW::flush_queries() {
+	MEMORY_TAG_SCOPE(TAG_PHYSICS);
 	if (!active) {
 		return;
 	}
@@ -1356,7 +1383,11 @@ PhysicsServer2DSW *PhysicsServer2DSW::singletonsw = nullptr;
 
 PhysicsServer2DSW::PhysicsServer2DSW(bool p_using_threads) {
 	singletonsw = this;
-	BroadPhase2DSW::create_func = BroadPhase2DHashGrid::_create;
+	if (GLOBAL_DEF("physics/2d/use_bvh", true)) {
+		BroadPhase2DSW::create_func = BroadPhase2DBVH::_create;
+	} else {
+		BroadPhase2DSW::create_func = BroadPhase2DHashGrid::_create;
+	}
 	//BroadPhase2DSW::create_func=BroadPhase2DBasic::_create;
 
 	active = true;
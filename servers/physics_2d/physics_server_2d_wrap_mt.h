@@ -126,6 +126,11 @@ public:
 		return physics_2d_server->space_get_contact_count(p_space);
 	}
 
+	FUNC2(space_set_deterministic, RID, bool);
+	FUNC1RC(bool, space_is_deterministic, RID);
+	FUNC1RC(Vector<uint8_t>, space_get_snapshot, RID);
+	FUNC2(space_restore_snapshot, RID, const Vector<uint8_t> &);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
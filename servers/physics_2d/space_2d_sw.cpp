@@ -1122,6 +1122,12 @@ void *Space2DSW::_broadphase_pair(CollisionObject2DSW *A, int p_subindex_A, Coll
 	Space2DSW *self = (Space2DSW *)p_self;
 	self->collision_pairs++;
 
+	if (type_A == type_B && A->get_self().get_id() > B->get_self().get_id()) {
+		// Same order whichever way the broadphase reports them, so pairs can be found again from snapshots.
+		SWAP(A, B);
+		SWAP(p_subindex_A, p_subindex_B);
+	}
+
 	if (type_A == CollisionObject2DSW::TYPE_AREA) {
 		Area2DSW *area = static_cast<Area2DSW *>(A);
 		if (type_B == CollisionObject2DSW::TYPE_AREA) {
@@ -1191,6 +1197,147 @@ const Set<CollisionObject2DSW *> &Space2DSW::get_objects() const {
 	return objects;
 }
 
+struct _BodyIDCompare2DSW {
+	_FORCE_INLINE_ bool operator()(const Body2DSW *p_a, const Body2DSW *p_b) const {
+		return p_a->get_self().get_id() < p_b->get_self().get_id();
+	}
+};
+
+void Space2DSW::_get_sorted_bodies(LocalVector<Body2DSW *> &r_bodies) const {
+	for (const Set<CollisionObject2DSW *>::Element *E = objects.front(); E; E = E->next()) {
+		if (E->get()->get_type() == CollisionObject2DSW::TYPE_BODY) {
+			r_bodies.push_back(static_cast<Body2DSW *>(E->get()));
+		}
+	}
+	r_bodies.sort_custom<_BodyIDCompare2DSW>();
+}
+
+void Space2DSW::_get_sorted_pairs(const LocalVector<Body2DSW *> &p_bodies, LocalVector<SnapshotPair> &r_pairs) const {
+	for (uint32_t i = 0; i < p_bodies.size(); i++) {
+		for (const List<Pair<Constraint2DSW *, int>>::Element *E = p_bodies[i]->get_constraint_list().front(); E; E = E->next()) {
+			// Body pairs are in the lists of both bodies, take them from the first one.
+			if (E->get().second != 0 || E->get().first->get_snapshot_size() == 0) {
+				continue;
+			}
+			SnapshotPair pair;
+			pair.key = E->get().first->get_key();
+			pair.constraint = E->get().first;
+			r_pairs.push_back(pair);
+		}
+	}
+	r_pairs.sort();
+}
+
+Vector<uint8_t> Space2DSW::get_snapshot() const {
+	LocalVector<Body2DSW *> bodies;
+	_get_sorted_bodies(bodies);
+	LocalVector<SnapshotPair> pairs;
+	_get_sorted_pairs(bodies, pairs);
+
+	uint32_t size = sizeof(SnapshotHeader) + bodies.size() * sizeof(SnapshotBody);
+	for (uint32_t i = 0; i < pairs.size(); i++) {
+		size += sizeof(Constraint2DSW::Key) + sizeof(uint32_t) + pairs[i].constraint->get_snapshot_size();
+	}
+
+	Vector<uint8_t> snapshot;
+	snapshot.resize(size);
+	uint8_t *w = snapshot.ptrw();
+
+	SnapshotHeader header;
+	header.magic = SNAPSHOT_MAGIC;
+	header.version = SNAPSHOT_VERSION;
+	header.real_size = sizeof(real_t);
+	header.body_count = bodies.size();
+	header.pair_count = pairs.size();
+	memcpy(w, &header, sizeof(SnapshotHeader));
+	w += sizeof(SnapshotHeader);
+
+	for (uint32_t i = 0; i < bodies.size(); i++) {
+		SnapshotBody record;
+		record.id = bodies[i]->get_self().get_id();
+		bodies[i]->save_snapshot(record.state);
+		memcpy(w, &record, sizeof(SnapshotBody));
+		w += sizeof(SnapshotBody);
+	}
+
+	for (uint32_t i = 0; i < pairs.size(); i++) {
+		uint32_t pair_size = pairs[i].constraint->get_snapshot_size();
+		memcpy(w, &pairs[i].key, sizeof(Constraint2DSW::Key));
+		w += sizeof(Constraint2DSW::Key);
+		memcpy(w, &pair_size, sizeof(uint32_t));
+		w += sizeof(uint32_t);
+		pairs[i].constraint->save_snapshot(w);
+		w += pair_size;
+	}
+
+	return snapshot;
+}
+
+void Space2DSW::restore_snapshot(const Vector<uint8_t> &p_snapshot) {
+	ERR_FAIL_COND_MSG(locked, "Can't restore a snapshot while the space is being stepped.");
+	ERR_FAIL_COND(p_snapshot.size() < (int)sizeof(SnapshotHeader));
+
+	const uint8_t *r = p_snapshot.ptr();
+	const uint8_t *end = r + p_snapshot.size();
+
+	SnapshotHeader header;
+	memcpy(&header, r, sizeof(SnapshotHeader));
+	r += sizeof(SnapshotHeader);
+	ERR_FAIL_COND_MSG(header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION || header.real_size != sizeof(real_t), "Invalid physics space snapshot.");
+	ERR_FAIL_COND(uint64_t(end - r) < uint64_t(header.body_count) * sizeof(SnapshotBody));
+
+	// Bodies added or removed since the snapshot was taken are left as they are.
+	LocalVector<Body2DSW *> bodies;
+	_get_sorted_bodies(bodies);
+	uint32_t body_index = 0;
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		SnapshotBody record;
+		memcpy(&record, r, sizeof(SnapshotBody));
+		r += sizeof(SnapshotBody);
+
+		while (body_index < bodies.size() && bodies[body_index]->get_self().get_id() < record.id) {
+			body_index++;
+		}
+		if (body_index < bodies.size() && bodies[body_index]->get_self().get_id() == record.id) {
+			bodies[body_index]->restore_snapshot(record.state);
+			body_index++;
+		}
+	}
+
+	// Create and remove pairs for the restored transforms, then give them back their contacts and overlaps.
+	// Pairs that weren't in the snapshot start over.
+	broadphase->update();
+
+	LocalVector<SnapshotPair> pairs;
+	_get_sorted_pairs(bodies, pairs);
+	uint32_t pair_index = 0;
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		ERR_FAIL_COND(uint64_t(end - r) < sizeof(Constraint2DSW::Key) + sizeof(uint32_t));
+		Constraint2DSW::Key key;
+		uint32_t pair_size;
+		memcpy(&key, r, sizeof(Constraint2DSW::Key));
+		r += sizeof(Constraint2DSW::Key);
+		memcpy(&pair_size, r, sizeof(uint32_t));
+		r += sizeof(uint32_t);
+		ERR_FAIL_COND(uint64_t(end - r) < pair_size);
+
+		while (pair_index < pairs.size() && pairs[pair_index].key < key) {
+			pairs[pair_index].constraint->load_snapshot(nullptr);
+			pair_index++;
+		}
+		if (pair_index < pairs.size() && pairs[pair_index].key == key) {
+			Constraint2DSW *constraint = pairs[pair_index].constraint;
+			constraint->load_snapshot(constraint->get_snapshot_size() == pair_size ? r : nullptr);
+			pair_index++;
+		}
+		r += pair_size;
+	}
+
+	for (; pair_index < pairs.size(); pair_index++) {
+		pairs[pair_index].constraint->load_snapshot(nullptr);
+	}
+}
+
 void Space2DSW::body_add_to_state_query_list(SelfList<Body2DSW> *p_body) {
 	state_query_list.add(p_body);
 }
@@ -39,6 +39,7 @@
 #include "collision_object_2d_sw.h"
 #include "core/config/project_settings.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/typedefs.h"
 
 class PhysicsDirectSpaceState2DSW : public PhysicsDirectSpaceState2D {
@@ -126,6 +127,37 @@ private:
 	Vector<Vector2> contact_debug;
 	int contact_debug_count;
 
+	bool deterministic = false;
+
+	// Snapshots hold the bodies, then the pairs with state, both sorted by ID so restoring is a merge.
+	enum {
+		SNAPSHOT_MAGIC = 0x32535047, // "GPS2"
+		SNAPSHOT_VERSION = 1,
+	};
+
+	struct SnapshotHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t real_size;
+		uint32_t body_count;
+		uint32_t pair_count;
+	};
+
+	struct SnapshotBody {
+		uint64_t id;
+		Body2DSW::Snapshot state;
+	};
+
+	struct SnapshotPair {
+		Constraint2DSW::Key key;
+		Constraint2DSW *constraint;
+
+		_FORCE_INLINE_ bool operator<(const SnapshotPair &p_pair) const { return key < p_pair.key; }
+	};
+
+	void _get_sorted_bodies(LocalVector<Body2DSW *> &r_bodies) const;
+	void _get_sorted_pairs(const LocalVector<Body2DSW *> &p_bodies, LocalVector<SnapshotPair> &r_pairs) const;
+
 	friend class PhysicsDirectSpaceState2DSW;
 
 public:
@@ -198,6 +230,13 @@ public:
 
 	PhysicsDirectSpaceState2DSW *get_direct_state();
 
+	// Deterministic spaces solve in an order that only depends on the simulation state, so restored snapshots replay the same.
+	void set_deterministic(bool p_enabled) { deterministic = p_enabled; }
+	bool is_deterministic() const { return deterministic; }
+
+	Vector<uint8_t> get_snapshot() const;
+	void restore_snapshot(const Vector<uint8_t> &p_snapshot);
+
 	void set_elapsed_time(ElapsedTime p_time, uint64_t p_msec) { elapsed_time[p_time] = p_msec; }
 	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
 
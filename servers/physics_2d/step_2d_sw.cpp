@@ -29,6 +29,7 @@
 /*************************************************************************/
 
 #include "step_2d_sw.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/os/os.h"
 
 void Step2DSW::_populate_island(Body2DSW *p_body, Body2DSW **p_island, Constraint2DSW **p_constraint_island) {
@@ -36,28 +37,68 @@ void Step2DSW::_populate_island(Body2DSW *p_body, Body2DSW **p_island, Constrain
 	p_body->set_island_next(*p_island);
 	*p_island = p_body;
 
-	for (const List<Pair<Constraint2DSW *, int>>::Element *E = p_body->get_constraint_list().front(); E; E = E->next()) {
-		Constraint2DSW *c = (Constraint2DSW *)E->get().first;
-		if (c->get_island_step() == _step) {
-			continue; //already processed
+	if (!deterministic) {
+		for (const List<Pair<Constraint2DSW *, int>>::Element *E = p_body->get_constraint_list().front(); E; E = E->next()) {
+			_populate_island_constraint(E->get().first, E->get().second, p_island, p_constraint_island);
 		}
-		c->set_island_step(_step);
-		c->set_island_next(*p_constraint_island);
-		*p_constraint_island = c;
+		return;
+	}
 
-		for (int i = 0; i < c->get_body_count(); i++) {
-			if (i == E->get().second) {
-				continue;
-			}
-			Body2DSW *b = c->get_body_ptr()[i];
-			if (b->get_island_step() == _step || b->get_mode() == PhysicsServer2D::BODY_MODE_STATIC || b->get_mode() == PhysicsServer2D::BODY_MODE_KINEMATIC) {
-				continue; //no go
-			}
-			_populate_island(c->get_body_ptr()[i], p_island, p_constraint_island);
+	// The constraint list is in pairing order, visit it by key instead so islands are always built the same way.
+	uint32_t from = sorted_constraints.size();
+	for (const List<Pair<Constraint2DSW *, int>>::Element *E = p_body->get_constraint_list().front(); E; E = E->next()) {
+		SortedConstraint sc;
+		sc.key = E->get().first->get_key();
+		sc.constraint = E->get().first;
+		sc.body_index = E->get().second;
+		sorted_constraints.push_back(sc);
+	}
+	uint32_t to = sorted_constraints.size();
+
+	SortArray<SortedConstraint> sorter;
+	sorter.sort(sorted_constraints.ptr() + from, to - from);
+
+	for (uint32_t i = from; i < to; i++) {
+		// Copied, the recursion may grow the stack.
+		SortedConstraint sc = sorted_constraints[i];
+		_populate_island_constraint(sc.constraint, sc.body_index, p_island, p_constraint_island);
+	}
+	sorted_constraints.resize(from);
+}
+
+void Step2DSW::_populate_island_constraint(Constraint2DSW *p_constraint, int p_body_index, Body2DSW **p_island, Constraint2DSW **p_constraint_island) {
+	Constraint2DSW *c = p_constraint;
+	if (c->get_island_step() == _step) {
+		return; //already processed
+	}
+	c->set_island_step(_step);
+	c->set_island_next(*p_constraint_island);
+	*p_constraint_island = c;
+
+	for (int i = 0; i < c->get_body_count(); i++) {
+		if (i == p_body_index) {
+			continue;
+		}
+		Body2DSW *b = c->get_body_ptr()[i];
+		if (b->get_island_step() == _step || b->get_mode() == PhysicsServer2D::BODY_MODE_STATIC || b->get_mode() == PhysicsServer2D::BODY_MODE_KINEMATIC) {
+			continue; //no go
 		}
+		_populate_island(c->get_body_ptr()[i], p_island, p_constraint_island);
 	}
 }
 
+struct _BodyIDCompareStep2DSW {
+	_FORCE_INLINE_ bool operator()(const Body2DSW *p_a, const Body2DSW *p_b) const {
+		return p_a->get_self().get_id() < p_b->get_self().get_id();
+	}
+};
+
+struct _ConstraintKeyCompareStep2DSW {
+	_FORCE_INLINE_ bool operator()(const Constraint2DSW *p_a, const Constraint2DSW *p_b) const {
+		return p_a->get_key() < p_b->get_key();
+	}
+};
+
 bool Step2DSW::_setup_island(Constraint2DSW *p_island, real_t p_delta) {
 	Constraint2DSW *ci = p_island;
 	Constraint2DSW *prev_ci = nullptr;
@@ -129,10 +170,13 @@ void Step2DSW::_check_suspend(Body2DSW *p_island, real_t p_delta) {
 }
 
 void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
+	CPU_PROFILE_SCOPE("Step2DSW::step");
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
 
+	deterministic = p_space->is_deterministic();
+
 	const SelfList<Body2DSW>::List *body_list = &p_space->get_active_body_list();
 
 	/* INTEGRATE FORCES */
@@ -161,12 +205,20 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 
 	Body2DSW *island_list = nullptr;
 	Constraint2DSW *constraint_island_list = nullptr;
-	b = body_list->first();
 
 	int island_count = 0;
 
-	while (b) {
-		Body2DSW *body = b->self();
+	// The active list is in activation order, which restored snapshots don't reproduce.
+	island_roots.clear();
+	for (b = body_list->first(); b; b = b->next()) {
+		island_roots.push_back(b->self());
+	}
+	if (deterministic) {
+		island_roots.sort_custom<_BodyIDCompareStep2DSW>();
+	}
+
+	for (uint32_t i = 0; i < island_roots.size(); i++) {
+		Body2DSW *body = island_roots[i];
 
 		if (body->get_island_step() != _step) {
 			Body2DSW *island = nullptr;
@@ -182,13 +234,13 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 				island_count++;
 			}
 		}
-		b = b->next();
 	}
 
 	p_space->set_island_count(island_count);
 
 	const SelfList<Area2DSW>::List &aml = p_space->get_moved_area_list();
 
+	area_constraints.clear();
 	while (aml.first()) {
 		for (const Set<Constraint2DSW *>::Element *E = aml.first()->self()->get_constraints().front(); E; E = E->next()) {
 			Constraint2DSW *c = E->get();
@@ -196,13 +248,23 @@ void Step2DSW::step(Space2DSW *p_space, real_t p_delta, int p_iterations) {
 				continue;
 			}
 			c->set_island_step(_step);
-			c->set_island_next(nullptr);
-			c->set_island_list_next(constraint_island_list);
-			constraint_island_list = c;
+			area_constraints.push_back(c);
 		}
 		p_space->area_remove_from_moved_list((SelfList<Area2DSW> *)aml.first()); //faster to remove here
 	}
 
+	if (deterministic) {
+		// Set up in this order, which decides how overlapping areas are sorted in bodies.
+		area_constraints.sort_custom<_ConstraintKeyCompareStep2DSW>();
+	}
+
+	for (int32_t i = area_constraints.size() - 1; i >= 0; i--) {
+		Constraint2DSW *c = area_constraints[i];
+		c->set_island_next(nullptr);
+		c->set_island_list_next(constraint_island_list);
+		constraint_island_list = c;
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(Space2DSW::ELAPSED_TIME_GENERATE_ISLANDS, profile_endtime - profile_begtime);
@@ -33,10 +33,27 @@
 
 #include "space_2d_sw.h"
 
+#include "core/templates/local_vector.h"
+
 class Step2DSW {
 	uint64_t _step;
 
+	bool deterministic = false;
+
+	struct SortedConstraint {
+		Constraint2DSW::Key key;
+		Constraint2DSW *constraint;
+		int body_index;
+
+		_FORCE_INLINE_ bool operator<(const SortedConstraint &p_constraint) const { return key < p_constraint.key; }
+	};
+
+	LocalVector<Body2DSW *> island_roots;
+	LocalVector<Constraint2DSW *> area_constraints;
+	LocalVector<SortedConstraint> sorted_constraints; // Stack of the constraints of the bodies being populated, in deterministic spaces.
+
 	void _populate_island(Body2DSW *p_body, Body2DSW **p_island, Constraint2DSW **p_constraint_island);
+	void _populate_island_constraint(Constraint2DSW *p_constraint, int p_body_index, Body2DSW **p_island, Constraint2DSW **p_constraint_island);
 	bool _setup_island(Constraint2DSW *p_island, real_t p_delta);
 	void _solve_island(Constraint2DSW *p_island, int p_iterations, real_t p_delta);
 	void _check_suspend(Body2DSW *p_island, real_t p_delta);
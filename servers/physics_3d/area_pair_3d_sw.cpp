@@ -40,8 +40,15 @@ bool AreaPair3DSW::setup(real_t p_step) {
 		result = true;
 	}
 
-	if (result != colliding) {
-		if (result) {
+	process_collision = result;
+
+	return false; //never do any post solving
+}
+
+void AreaPair3DSW::pre_solve(real_t p_step) {
+	// Areas can overlap bodies of many islands, so updating them isn't done in setup().
+	if (process_collision != colliding) {
+		if (process_collision) {
 			if (area->get_space_override_mode() != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED) {
 				body->add_area(area);
 			}
@@ -58,21 +65,42 @@ bool AreaPair3DSW::setup(real_t p_step) {
 			}
 		}
 
-		colliding = result;
+		colliding = process_collision;
 	}
-
-	return false; //never do any post solving
 }
 
 void AreaPair3DSW::solve(real_t p_step) {
 }
 
+Constraint3DSW::Key AreaPair3DSW::get_key() const {
+	Key key;
+	key.id_a = body->get_self().get_id();
+	key.id_b = area->get_self().get_id();
+	key.sub_index = (uint32_t(body_shape) << 16) | uint32_t(area_shape);
+	return key;
+}
+
+// The overlap state decides which areas affect the body, so it's part of the simulation state.
+uint32_t AreaPair3DSW::get_snapshot_size() const {
+	return 1;
+}
+
+void AreaPair3DSW::save_snapshot(uint8_t *r_data) const {
+	r_data[0] = colliding;
+}
+
+void AreaPair3DSW::load_snapshot(const uint8_t *p_data) {
+	process_collision = p_data && p_data[0];
+	pre_solve(0);
+}
+
 AreaPair3DSW::AreaPair3DSW(Body3DSW *p_body, int p_body_shape, Area3DSW *p_area, int p_area_shape) {
 	body = p_body;
 	area = p_area;
 	body_shape = p_body_shape;
 	area_shape = p_area_shape;
 	colliding = false;
+	process_collision = false;
 	body->add_constraint(this, 0);
 	area->add_constraint(this);
 	if (p_body->get_mode() == PhysicsServer3D::BODY_MODE_KINEMATIC) {
@@ -103,8 +131,14 @@ bool Area2Pair3DSW::setup(real_t p_step) {
 		result = true;
 	}
 
-	if (result != colliding) {
-		if (result) {
+	process_collision = result;
+
+	return false; //never do any post solving
+}
+
+void Area2Pair3DSW::pre_solve(real_t p_step) {
+	if (process_collision != colliding) {
+		if (process_collision) {
 			if (area_b->has_area_monitor_callback() && area_a->is_monitorable()) {
 				area_b->add_area_to_query(area_a, shape_a, shape_b);
 			}
@@ -123,21 +157,37 @@ bool Area2Pair3DSW::setup(real_t p_step) {
 			}
 		}
 
-		colliding = result;
+		colliding = process_collision;
 	}
-
-	return false; //never do any post solving
 }
 
 void Area2Pair3DSW::solve(real_t p_step) {
 }
 
+Constraint3DSW::Key Area2Pair3DSW::get_key() const {
+	// The broadphase may report the areas in either order.
+	Key key;
+	uint64_t id_a = area_a->get_self().get_id();
+	uint64_t id_b = area_b->get_self().get_id();
+	if (id_a < id_b) {
+		key.id_a = id_a;
+		key.id_b = id_b;
+		key.sub_index = (uint32_t(shape_a) << 16) | uint32_t(shape_b);
+	} else {
+		key.id_a = id_b;
+		key.id_b = id_a;
+		key.sub_index = (uint32_t(shape_b) << 16) | uint32_t(shape_a);
+	}
+	return key;
+}
+
 Area2Pair3DSW::Area2Pair3DSW(Area3DSW *p_area_a, int p_shape_a, Area3DSW *p_area_b, int p_shape_b) {
 	area_a = p_area_a;
 	area_b = p_area_b;
 	shape_a = p_shape_a;
 	shape_b = p_shape_b;
 	colliding = false;
+	process_collision = false;
 	area_a->add_constraint(this);
 	area_b->add_constraint(this);
 }
@@ -41,11 +41,18 @@ class AreaPair3DSW : public Constraint3DSW {
 	int body_shape;
 	int area_shape;
 	bool colliding;
+	bool process_collision;
 
 public:
 	bool setup(real_t p_step);
+	void pre_solve(real_t p_step);
 	void solve(real_t p_step);
 
+	virtual Key get_key() const;
+	virtual uint32_t get_snapshot_size() const;
+	virtual void save_snapshot(uint8_t *r_data) const;
+	virtual void load_snapshot(const uint8_t *p_data);
+
 	AreaPair3DSW(Body3DSW *p_body, int p_body_shape, Area3DSW *p_area, int p_area_shape);
 	~AreaPair3DSW();
 };
@@ -56,11 +63,15 @@ class Area2Pair3DSW : public Constraint3DSW {
 	int shape_a;
 	int shape_b;
 	bool colliding;
+	bool process_collision;
 
 public:
 	bool setup(real_t p_step);
+	void pre_solve(real_t p_step);
 	void solve(real_t p_step);
 
+	virtual Key get_key() const;
+
 	Area2Pair3DSW(Area3DSW *p_area_a, int p_shape_a, Area3DSW *p_area_b, int p_shape_b);
 	~Area2Pair3DSW();
 };
@@ -149,7 +149,8 @@ void Body3DSW::set_active(bool p_active) {
 			get_space()->body_add_to_active_list(&active_list);
 		}
 
-		//still_time=0;
+		// Restarts the timer of the island it ends up in, so a woken pile doesn't go back to sleep right away.
+		still_time = 0;
 	}
 	/*
 	if (!space)
@@ -658,6 +659,36 @@ void BodySW::simulate_motion(const Transform& p_xform,real_t p_step) {
 
 */
 
+void Body3DSW::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.transform = get_transform();
+	r_snapshot.new_transform = new_transform;
+	r_snapshot.linear_velocity = linear_velocity;
+	r_snapshot.angular_velocity = angular_velocity;
+	r_snapshot.applied_force = applied_force;
+	r_snapshot.applied_torque = applied_torque;
+	r_snapshot.still_time = still_time;
+	r_snapshot.active = active;
+	r_snapshot.first_integration = first_integration;
+}
+
+void Body3DSW::restore_snapshot(const Snapshot &p_snapshot) {
+	_set_transform(p_snapshot.transform);
+	_set_inv_transform(p_snapshot.transform.affine_inverse());
+	_update_transform_dependant();
+	new_transform = p_snapshot.new_transform;
+	linear_velocity = p_snapshot.linear_velocity;
+	angular_velocity = p_snapshot.angular_velocity;
+	applied_force = p_snapshot.applied_force;
+	applied_torque = p_snapshot.applied_torque;
+	first_integration = p_snapshot.first_integration;
+	set_active(p_snapshot.active);
+	still_time = p_snapshot.still_time; // After set_active(), which resets it.
+
+	if (fi_callback && get_space() && !direct_state_query_list.in_list()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list); // So the node gets the restored state.
+	}
+}
+
 void Body3DSW::wakeup_neighbours() {
 	for (Map<Constraint3DSW *, int>::Element *E = constraint_map.front(); E; E = E->next()) {
 		const Constraint3DSW *c = E->key();
@@ -700,23 +731,14 @@ void Body3DSW::call_queries() {
 	}
 }
 
-bool Body3DSW::sleep_test(real_t p_step) {
+bool Body3DSW::sleep_test() const {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC || mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
 		return true; //
 	} else if (mode == PhysicsServer3D::BODY_MODE_CHARACTER) {
 		return !active; // characters don't sleep unless asked to sleep
-	} else if (!can_sleep) {
-		return false;
 	}
 
-	if (Math::abs(angular_velocity.length()) < get_space()->get_body_angular_velocity_sleep_threshold() && Math::abs(linear_velocity.length_squared()) < get_space()->get_body_linear_velocity_sleep_threshold() * get_space()->get_body_linear_velocity_sleep_threshold()) {
-		still_time += p_step;
-
-		return still_time > get_space()->get_body_time_to_sleep();
-	} else {
-		still_time = 0; //maybe this should be set to 0 on set_active?
-		return false;
-	}
+	return can_sleep;
 }
 
 void Body3DSW::set_force_integration_callback(ObjectID p_id, const StringName &p_method, const Variant &p_udata) {
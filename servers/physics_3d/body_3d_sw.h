@@ -220,16 +220,27 @@ public:
 		linear_velocity += p_impulse * _inv_mass;
 	}
 
+	// Static and kinematic bodies can be shared by islands solved in parallel,
+	// impulses don't affect them anyway, so they must not be written to.
 	_FORCE_INLINE_ void apply_impulse(const Vector3 &p_impulse, const Vector3 &p_position = Vector3()) {
+		if (mode <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
+			return;
+		}
 		linear_velocity += p_impulse * _inv_mass;
 		angular_velocity += _inv_inertia_tensor.xform((p_position - center_of_mass).cross(p_impulse));
 	}
 
 	_FORCE_INLINE_ void apply_torque_impulse(const Vector3 &p_impulse) {
+		if (mode <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
+			return;
+		}
 		angular_velocity += _inv_inertia_tensor.xform(p_impulse);
 	}
 
 	_FORCE_INLINE_ void apply_bias_impulse(const Vector3 &p_impulse, const Vector3 &p_position = Vector3(), real_t p_max_delta_av = -1.0) {
+		if (mode <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
+			return;
+		}
 		biased_linear_velocity += p_impulse * _inv_mass;
 		if (p_max_delta_av != 0.0) {
 			Vector3 delta_av = _inv_inertia_tensor.xform((p_position - center_of_mass).cross(p_impulse));
@@ -324,7 +335,25 @@ public:
 	void call_queries();
 	void wakeup_neighbours();
 
-	bool sleep_test(real_t p_step);
+	bool sleep_test() const; // Whether the body lets its island sleep, velocities are tested per island in Step3DSW.
+	_FORCE_INLINE_ real_t get_still_time() const { return still_time; }
+	_FORCE_INLINE_ void set_still_time(real_t p_time) { still_time = p_time; }
+
+	// State changed by the simulation, saved in space snapshots. The rest is set through the server.
+	struct Snapshot {
+		Transform transform;
+		Transform new_transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Vector3 applied_force;
+		Vector3 applied_torque;
+		real_t still_time;
+		bool active;
+		bool first_integration;
+	};
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
 
 	Body3DSW();
 	~Body3DSW();
@@ -159,8 +159,9 @@ void BodyPair3DSW::validate_contacts() {
 	}
 }
 
-bool BodyPair3DSW::_test_ccd(real_t p_step, Body3DSW *p_A, int p_shape_A, const Transform &p_xform_A, Body3DSW *p_B, int p_shape_B, const Transform &p_xform_B) {
-	Vector3 motion = p_A->get_linear_velocity() * p_step;
+bool BodyPair3DSW::_test_ccd(real_t p_step, const Transform &p_xform_A, const Transform &p_xform_B) {
+	// Motion of A relative to B, B is considered still.
+	Vector3 motion = (A->get_linear_velocity() - B->get_linear_velocity()) * p_step;
 	real_t mlen = motion.length();
 	if (mlen < CMP_EPSILON) {
 		return false;
@@ -168,35 +169,74 @@ bool BodyPair3DSW::_test_ccd(real_t p_step, Body3DSW *p_A, int p_shape_A, const
 
 	Vector3 mnormal = motion / mlen;
 
-	real_t min, max;
-	p_A->get_shape(p_shape_A)->project_range(mnormal, p_xform_A, min, max);
-	bool fast_object = mlen > (max - min) * 0.3; //going too fast in that direction
+	const Shape3DSW *shape_A_ptr = A->get_shape(shape_A);
+	const Shape3DSW *shape_B_ptr = B->get_shape(shape_B);
 
-	if (!fast_object) { //did it move enough in this direction to even attempt raycast? let's say it should move more than 1/3 the size of the object in that axis
+	real_t min_A, max_A, min_B, max_B;
+	shape_A_ptr->project_range(mnormal, p_xform_A, min_A, max_A);
+	shape_B_ptr->project_range(mnormal, p_xform_B, min_B, max_B);
+	bool fast_object = mlen > MIN(max_A - min_A, max_B - min_B) * 0.3; //going too fast in that direction
+
+	if (!fast_object) { //did it move enough in this direction to even attempt a cast? let's say it should move more than 1/3 the size of the thinnest object in that axis
 		return false;
 	}
 
-	//cast a segment from support in motion normal, in the same direction of motion by motion length
-	//support is the worst case collision point, so real collision happened before
-	Vector3 s = p_A->get_shape(p_shape_A)->get_support(p_xform_A.basis.xform(mnormal).normalized());
-	Vector3 from = p_xform_A.xform(s);
-	Vector3 to = from + motion;
+	AABB aabb = p_xform_A.xform(shape_A_ptr->get_aabb());
+	aabb = aabb.merge(AABB(aabb.position + motion, aabb.size));
 
-	Transform from_inv = p_xform_B.affine_inverse();
+	Transform xform_inv = p_xform_A.affine_inverse();
+	MotionShape3DSW mshape;
+	mshape.shape = const_cast<Shape3DSW *>(shape_A_ptr);
+	mshape.motion = xform_inv.basis.xform(motion);
 
-	Vector3 local_from = from_inv.xform(from - mnormal * mlen * 0.1); //start from a little inside the bounding box
-	Vector3 local_to = from_inv.xform(to);
+	Vector3 point_A, point_B;
+	Vector3 sep = mnormal;
 
-	Vector3 rpos, rnorm;
-	if (!p_B->get_shape(p_shape_B)->intersect_segment(local_from, local_to, rpos, rnorm)) {
+	//does it touch B anywhere along the motion?
+	if (CollisionSolver3DSW::solve_distance(&mshape, p_xform_A, shape_B_ptr, p_xform_B, point_A, point_B, aabb, &sep)) {
 		return false;
 	}
 
-	//shorten the linear velocity so it does not hit, but gets close enough, next frame will hit softly or soft enough
-	Vector3 hitpos = p_xform_B.xform(rpos);
+	//find the time of impact, same as cast_motion()
+	real_t low = 0;
+	real_t hi = 1;
+	for (int i = 0; i < 8; i++) {
+		real_t ofs = (low + hi) * 0.5;
+
+		sep = mnormal;
+		mshape.motion = xform_inv.basis.xform(motion * ofs);
+
+		if (CollisionSolver3DSW::solve_distance(&mshape, p_xform_A, shape_B_ptr, p_xform_B, point_A, point_B, aabb, &sep)) {
+			low = ofs;
+		} else {
+			hi = ofs;
+		}
+	}
 
-	real_t newlen = hitpos.distance_to(from) - (max - min) * 0.01;
-	p_A->set_linear_velocity((mnormal * newlen) / p_step);
+	//closest points right before the impact, moved back to the start of the step
+	Transform xform_toi = p_xform_A;
+	xform_toi.origin += motion * low;
+	sep = mnormal;
+	if (!CollisionSolver3DSW::solve_distance(shape_A_ptr, xform_toi, shape_B_ptr, p_xform_B, point_A, point_B, aabb, &sep)) {
+		return false;
+	}
+
+	Vector3 normal = point_B - point_A;
+	real_t normal_len = normal.length();
+	normal = normal_len > CMP_EPSILON ? normal / normal_len : mnormal;
+	if (normal.dot(mnormal) <= 0) {
+		return false; // Not approaching along the contact normal.
+	}
+
+	Vector3 global_A = point_A - motion * low;
+	Vector3 global_B = point_B;
+
+	SpeculativeContact &c = speculative_contact;
+	c.normal = normal;
+	c.separation = MAX(normal.dot(global_B - global_A), 0);
+	c.rA = global_A - A->get_center_of_mass();
+	c.rB = global_B - B->get_center_of_mass() - offset_B;
+	c.acc_normal_impulse = 0;
 
 	return true;
 }
@@ -210,6 +250,8 @@ real_t combine_friction(Body3DSW *A, Body3DSW *B) {
 }
 
 bool BodyPair3DSW::setup(real_t p_step) {
+	has_speculative_contact = false;
+
 	//cannot collide
 	if (!A->test_collision_mask(B) || A->has_exception(B->get_self()) || B->has_exception(A->get_self()) || (A->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC && B->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC && A->get_max_contacts_reported() == 0 && B->get_max_contacts_reported() == 0)) {
 		collided = false;
@@ -239,20 +281,36 @@ bool BodyPair3DSW::setup(real_t p_step) {
 	bool collided = CollisionSolver3DSW::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
 	this->collided = collided;
 
-	if (!collided) {
-		//test ccd (currently just a raycast)
+	if (!collided && ((A->is_continuous_collision_detection_enabled() && A->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) || (B->is_continuous_collision_detection_enabled() && B->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC))) {
+		// Only reads velocities, the contact is solved like the others.
+		has_speculative_contact = _test_ccd(p_step, xform_A, xform_B);
+	}
 
-		if (A->is_continuous_collision_detection_enabled() && A->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC && B->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
-			_test_ccd(p_step, A, shape_A, xform_A, B, shape_B, xform_B);
-		}
+	return collided;
+}
 
-		if (B->is_continuous_collision_detection_enabled() && B->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC && A->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC) {
-			_test_ccd(p_step, B, shape_B, xform_B, A, shape_A, xform_A);
+void BodyPair3DSW::pre_solve(real_t p_step) {
+	if (!collided) {
+		if (has_speculative_contact) {
+			SpeculativeContact &c = speculative_contact;
+			Vector3 inertia_A = A->get_inv_inertia_tensor().xform(c.rA.cross(c.normal));
+			Vector3 inertia_B = B->get_inv_inertia_tensor().xform(c.rB.cross(c.normal));
+			real_t kNormal = A->get_inv_mass() + B->get_inv_mass();
+			kNormal += c.normal.dot(inertia_A.cross(c.rA)) + c.normal.dot(inertia_B.cross(c.rB));
+			c.mass_normal = 1.0f / kNormal;
 		}
-
-		return false;
+		return;
 	}
 
+	Vector3 offset_A = A->get_transform().get_origin();
+	Transform xform_Au = Transform(A->get_transform().basis, Vector3());
+
+	Transform xform_Bu = B->get_transform();
+	xform_Bu.origin -= offset_A;
+
+	Shape3DSW *shape_A_ptr = A->get_shape(shape_A);
+	Shape3DSW *shape_B_ptr = B->get_shape(shape_B);
+
 	real_t max_penetration = space->get_contact_max_allowed_penetration();
 
 	real_t bias = (real_t)0.3;
@@ -335,12 +393,29 @@ bool BodyPair3DSW::setup(real_t p_step) {
 			c.bounce = c.bounce * dv.dot(c.normal);
 		}
 	}
-
-	return true;
 }
 
 void BodyPair3DSW::solve(real_t p_step) {
 	if (!collided) {
+		if (has_speculative_contact) {
+			SpeculativeContact &c = speculative_contact;
+
+			Vector3 crA = A->get_angular_velocity().cross(c.rA);
+			Vector3 crB = B->get_angular_velocity().cross(c.rB);
+			Vector3 dv = B->get_linear_velocity() + crB - A->get_linear_velocity() - crA;
+
+			//approaching is fine as long as the gap is not closed within the step
+			real_t vn = dv.dot(c.normal) + c.separation / p_step;
+
+			real_t jn = -vn * c.mass_normal;
+			real_t jnOld = c.acc_normal_impulse;
+			c.acc_normal_impulse = MAX(jnOld + jn, 0.0f);
+
+			Vector3 j = c.normal * (c.acc_normal_impulse - jnOld);
+
+			A->apply_impulse(-j, c.rA + A->get_center_of_mass());
+			B->apply_impulse(j, c.rB + B->get_center_of_mass());
+		}
 		return;
 	}
 
@@ -455,6 +530,46 @@ void BodyPair3DSW::solve(real_t p_step) {
 	}
 }
 
+Constraint3DSW::Key BodyPair3DSW::get_key() const {
+	Key key;
+	key.id_a = A->get_self().get_id();
+	key.id_b = B->get_self().get_id();
+	key.sub_index = (uint32_t(shape_A) << 16) | uint32_t(shape_B);
+	return key;
+}
+
+// Contacts are saved whole, recycled ones keep warm starting the solver after a restore.
+uint32_t BodyPair3DSW::get_snapshot_size() const {
+	return sizeof(Vector3) + sizeof(int) + sizeof(bool) + sizeof(Contact) * MAX_CONTACTS;
+}
+
+void BodyPair3DSW::save_snapshot(uint8_t *r_data) const {
+	memcpy(r_data, &sep_axis, sizeof(Vector3));
+	r_data += sizeof(Vector3);
+	memcpy(r_data, &contact_count, sizeof(int));
+	r_data += sizeof(int);
+	memcpy(r_data, &collided, sizeof(bool));
+	r_data += sizeof(bool);
+	memcpy(r_data, contacts, sizeof(Contact) * MAX_CONTACTS);
+}
+
+void BodyPair3DSW::load_snapshot(const uint8_t *p_data) {
+	if (!p_data) {
+		sep_axis = Vector3();
+		contact_count = 0;
+		collided = false;
+		return;
+	}
+
+	memcpy(&sep_axis, p_data, sizeof(Vector3));
+	p_data += sizeof(Vector3);
+	memcpy(&contact_count, p_data, sizeof(int));
+	p_data += sizeof(int);
+	memcpy(&collided, p_data, sizeof(bool));
+	p_data += sizeof(bool);
+	memcpy(contacts, p_data, sizeof(Contact) * MAX_CONTACTS);
+}
+
 BodyPair3DSW::BodyPair3DSW(Body3DSW *p_A, int p_shape_A, Body3DSW *p_B, int p_shape_B) :
 		Constraint3DSW(_arr, 2) {
 	A = p_A;
@@ -466,6 +581,7 @@ BodyPair3DSW::BodyPair3DSW(Body3DSW *p_A, int p_shape_A, Body3DSW *p_B, int p_sh
 	B->add_constraint(this, 1);
 	contact_count = 0;
 	collided = false;
+	has_speculative_contact = false;
 }
 
 BodyPair3DSW::~BodyPair3DSW() {
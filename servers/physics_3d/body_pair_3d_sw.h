@@ -70,24 +70,42 @@ class BodyPair3DSW : public Constraint3DSW {
 
 	Vector3 offset_B; //use local A coordinates to avoid numerical issues on collision detection
 
+	// Found by continuous collision detection when the shapes are apart but will meet within the step.
+	// The solver lets the bodies close the gap, but not go past it.
+	struct SpeculativeContact {
+		Vector3 normal; // From A to B.
+		Vector3 rA, rB;
+		real_t separation;
+		real_t mass_normal;
+		real_t acc_normal_impulse;
+	};
+
 	Vector3 sep_axis;
 	Contact contacts[MAX_CONTACTS];
 	int contact_count;
 	bool collided;
+	SpeculativeContact speculative_contact;
+	bool has_speculative_contact;
 
 	static void _contact_added_callback(const Vector3 &p_point_A, const Vector3 &p_point_B, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, const Vector3 &p_point_B);
 
 	void validate_contacts();
-	bool _test_ccd(real_t p_step, Body3DSW *p_A, int p_shape_A, const Transform &p_xform_A, Body3DSW *p_B, int p_shape_B, const Transform &p_xform_B);
+	bool _test_ccd(real_t p_step, const Transform &p_xform_A, const Transform &p_xform_B);
 
 	Space3DSW *space;
 
 public:
 	bool setup(real_t p_step);
+	void pre_solve(real_t p_step);
 	void solve(real_t p_step);
 
+	virtual Key get_key() const;
+	virtual uint32_t get_snapshot_size() const;
+	virtual void save_snapshot(uint8_t *r_data) const;
+	virtual void load_snapshot(const uint8_t *p_data);
+
 	BodyPair3DSW(Body3DSW *p_A, int p_shape_A, Body3DSW *p_B, int p_shape_B);
 	~BodyPair3DSW();
 };
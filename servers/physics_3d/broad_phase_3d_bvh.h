@@ -0,0 +1,148 @@
+/*************************************************************************/
+/*  broad_phase_3d_bvh.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef BROAD_PHASE_3D_BVH_H
+#define BROAD_PHASE_3D_BVH_H
+
+#include "broad_phase_3d_sw.h"
+#include "core/math/dynamic_bvh.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/map.h"
+#include "servers/broad_phase_bvh_common.h"
+
+class BroadPhase3DBVH : public BroadPhase3DSW {
+	struct PairData {
+		bool colliding = false;
+		void *ud = nullptr;
+	};
+
+	struct Element {
+		ID self = 0;
+		CollisionObject3DSW *owner = nullptr;
+		bool _static = false;
+		bool moved = false;
+		bool tree_moved = false;
+		AABB aabb;
+		AABB fat_aabb; // Enlarged by the collision margin; this is what the tree stores.
+		int subindex = 0;
+		DynamicBVH::ID tree_id;
+		Map<Element *, PairData *> paired;
+	};
+
+	Map<ID, Element> element_map;
+	ID current = 0;
+
+	// Static elements never pair with each other, so they are kept apart and
+	// only queried by dynamic elements.
+	DynamicBVH dynamic_tree;
+	DynamicBVH static_tree;
+
+	// Elements that moved (or changed state) since the last update, pairs are
+	// only searched for these.
+	LocalVector<ID> moved_elements;
+
+	real_t margin = 0.1;
+
+	PairCallback pair_callback = nullptr;
+	void *pair_userdata = nullptr;
+	UnpairCallback unpair_callback = nullptr;
+	void *unpair_userdata = nullptr;
+
+	typedef BroadPhaseBVHPairQuery<Element, PairData> PairQuery;
+
+	struct CullQuery {
+		const Vector3 *point = nullptr;
+		const AABB *aabb = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		CollisionObject3DSW **results = nullptr;
+		int *result_indices = nullptr;
+		int max_results = 0;
+		int count = 0;
+
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			const Element *e = (const Element *)p_data;
+			if (point && !e->aabb.has_point(*point)) {
+				return false;
+			}
+			if (aabb && !aabb->intersects(e->aabb)) {
+				return false;
+			}
+			if (from && !e->aabb.intersects_segment(*from, *to)) {
+				return false;
+			}
+			results[count] = e->owner;
+			if (result_indices) {
+				result_indices[count] = e->subindex;
+			}
+			count++;
+			return count >= max_results;
+		}
+	};
+
+	_FORCE_INLINE_ DynamicBVH &_get_tree(const Element *p_elem) {
+		return p_elem->_static ? static_tree : dynamic_tree;
+	}
+
+	void _unpair(Element *p_elem, Element *p_with, PairData *p_pd);
+	void _unpair_all(Element *p_elem);
+	void _tree_insert(Element *p_elem);
+	void _tree_remove(Element *p_elem);
+	void _mark_moved(Element *p_elem, bool p_tree_moved);
+	void _check_motion(Element *p_elem);
+
+public:
+	virtual ID create(CollisionObject3DSW *p_object, int p_subindex = 0);
+	virtual void move(ID p_id, const AABB &p_aabb);
+	virtual void set_static(ID p_id, bool p_static);
+	virtual void remove(ID p_id);
+
+	virtual CollisionObject3DSW *get_object(ID p_id) const;
+	virtual bool is_static(ID p_id) const;
+	virtual int get_subindex(ID p_id) const;
+
+	virtual int cull_point(const Vector3 &p_point, CollisionObject3DSW **p_results, int p_max_results, int *p_result_indices = nullptr);
+	virtual int cull_segment(const Vector3 &p_from, const Vector3 &p_to, CollisionObject3DSW **p_results, int p_max_results, int *p_result_indices = nullptr);
+	virtual int cull_aabb(const AABB &p_aabb, CollisionObject3DSW **p_results, int p_max_results, int *p_result_indices = nullptr);
+
+	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata);
+	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata);
+
+	virtual void update();
+
+	virtual bool is_query_thread_safe() const { return true; } // Tree queries only read.
+
+	static BroadPhase3DSW *_create();
+
+	BroadPhase3DBVH();
+	~BroadPhase3DBVH();
+};
+
+#endif // BROAD_PHASE_3D_BVH_H
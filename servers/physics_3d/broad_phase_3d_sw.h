@@ -66,6 +66,9 @@ public:
 
 	virtual void update() = 0;
 
+	// Whether cull queries can run from several threads at once (while the broadphase is not modified).
+	virtual bool is_query_thread_safe() const { return false; }
+
 	virtual ~BroadPhase3DSW();
 };
 
@@ -1041,12 +1041,17 @@ static void _collision_box_box(const Shape3DSW *p_a, const Transform &p_transfor
 		return;
 	}
 
+	Vector3 axes_A[3];
+	Vector3 axes_B[3];
+	for (int i = 0; i < 3; i++) {
+		axes_A[i] = p_transform_a.basis.get_axis(i).normalized();
+		axes_B[i] = p_transform_b.basis.get_axis(i).normalized();
+	}
+
 	// test faces of A
 
 	for (int i = 0; i < 3; i++) {
-		Vector3 axis = p_transform_a.basis.get_axis(i).normalized();
-
-		if (!separator.test_axis(axis)) {
+		if (!separator.test_axis(axes_A[i])) {
 			return;
 		}
 	}
@@ -1054,9 +1059,7 @@ static void _collision_box_box(const Shape3DSW *p_a, const Transform &p_transfor
 	// test faces of B
 
 	for (int i = 0; i < 3; i++) {
-		Vector3 axis = p_transform_b.basis.get_axis(i).normalized();
-
-		if (!separator.test_axis(axis)) {
+		if (!separator.test_axis(axes_B[i])) {
 			return;
 		}
 	}
@@ -1064,7 +1067,7 @@ static void _collision_box_box(const Shape3DSW *p_a, const Transform &p_transfor
 	// test combined edges
 	for (int i = 0; i < 3; i++) {
 		for (int j = 0; j < 3; j++) {
-			Vector3 axis = p_transform_a.basis.get_axis(i).cross(p_transform_b.basis.get_axis(j));
+			Vector3 axis = axes_A[i].cross(axes_B[j]);
 
 			if (Math::is_zero_approx(axis.length_squared())) {
 				continue;
@@ -1378,11 +1381,11 @@ static void _collision_box_convex_polygon(const Shape3DSW *p_a, const Transform
 	}
 
 	// A<->B edges
-	for (int i = 0; i < 3; i++) {
-		Vector3 e1 = p_transform_a.basis.get_axis(i);
+	for (int j = 0; j < edge_count; j++) {
+		Vector3 e2 = p_transform_b.basis.xform(vertices[edges[j].a] - vertices[edges[j].b]);
 
-		for (int j = 0; j < edge_count; j++) {
-			Vector3 e2 = p_transform_b.basis.xform(vertices[edges[j].a]) - p_transform_b.basis.xform(vertices[edges[j].b]);
+		for (int i = 0; i < 3; i++) {
+			Vector3 e1 = p_transform_a.basis.get_axis(i);
 
 			Vector3 axis = e1.cross(e2).normalized();
 
@@ -1669,7 +1672,7 @@ static void _collision_capsule_convex_polygon(const Shape3DSW *p_a, const Transf
 
 	for (int i = 0; i < edge_count; i++) {
 		// cylinder
-		Vector3 edge_axis = p_transform_b.basis.xform(vertices[edges[i].a]) - p_transform_b.basis.xform(vertices[edges[i].b]);
+		Vector3 edge_axis = p_transform_b.basis.xform(vertices[edges[i].a] - vertices[edges[i].b]);
 		Vector3 axis = edge_axis.cross(p_transform_a.basis.get_axis(2)).normalized();
 
 		if (!separator.test_axis(axis)) {
@@ -1688,7 +1691,7 @@ static void _collision_capsule_convex_polygon(const Shape3DSW *p_a, const Transf
 
 		for (int j = 0; j < edge_count; j++) {
 			Vector3 n1 = sphere_pos - p_transform_b.xform(vertices[edges[j].a]);
-			Vector3 n2 = p_transform_b.basis.xform(vertices[edges[j].a]) - p_transform_b.basis.xform(vertices[edges[j].b]);
+			Vector3 n2 = p_transform_b.basis.xform(vertices[edges[j].a] - vertices[edges[j].b]);
 
 			Vector3 axis = n1.cross(n2).cross(n2).normalized();
 
@@ -1972,10 +1975,10 @@ static void _collision_convex_polygon_convex_polygon(const Shape3DSW *p_a, const
 
 	// A<->B edges
 	for (int i = 0; i < edge_count_A; i++) {
-		Vector3 e1 = p_transform_a.basis.xform(vertices_A[edges_A[i].a]) - p_transform_a.basis.xform(vertices_A[edges_A[i].b]);
+		Vector3 e1 = p_transform_a.basis.xform(vertices_A[edges_A[i].a] - vertices_A[edges_A[i].b]);
 
 		for (int j = 0; j < edge_count_B; j++) {
-			Vector3 e2 = p_transform_b.basis.xform(vertices_B[edges_B[j].a]) - p_transform_b.basis.xform(vertices_B[edges_B[j].b]);
+			Vector3 e2 = p_transform_b.basis.xform(vertices_B[edges_B[j].a] - vertices_B[edges_B[j].b]);
 
 			Vector3 axis = e1.cross(e2).normalized();
 
@@ -2068,7 +2071,7 @@ static void _collision_convex_polygon_face(const Shape3DSW *p_a, const Transform
 
 	// A<->B edges
 	for (int i = 0; i < edge_count; i++) {
-		Vector3 e1 = p_transform_a.xform(vertices[edges[i].a]) - p_transform_a.xform(vertices[edges[i].b]);
+		Vector3 e1 = p_transform_a.basis.xform(vertices[edges[i].a] - vertices[edges[i].b]);
 
 		for (int j = 0; j < 3; j++) {
 			Vector3 e2 = vertex[j] - vertex[(j + 1) % 3];
@@ -34,11 +34,30 @@
 #include "body_3d_sw.h"
 
 class Constraint3DSW {
+public:
+	// Identifies a constraint independently of memory addresses, deterministic spaces order constraints by it.
+	struct Key {
+		uint64_t id_a = 0;
+		uint64_t id_b = 0;
+		uint32_t sub_index = 0;
+
+		_FORCE_INLINE_ bool operator<(const Key &p_key) const {
+			if (id_a != p_key.id_a) {
+				return id_a < p_key.id_a;
+			}
+			if (id_b != p_key.id_b) {
+				return id_b < p_key.id_b;
+			}
+			return sub_index < p_key.sub_index;
+		}
+		_FORCE_INLINE_ bool operator==(const Key &p_key) const { return id_a == p_key.id_a && id_b == p_key.id_b && sub_index == p_key.sub_index; }
+	};
+
+private:
 	Body3DSW **_body_ptr;
 	int _body_count;
 	uint64_t island_step;
 	Constraint3DSW *island_next;
-	Constraint3DSW *island_list_next;
 	int priority;
 	bool disabled_collisions_between_bodies;
 
@@ -63,9 +82,6 @@ public:
 	_FORCE_INLINE_ Constraint3DSW *get_island_next() const { return island_next; }
 	_FORCE_INLINE_ void set_island_next(Constraint3DSW *p_next) { island_next = p_next; }
 
-	_FORCE_INLINE_ Constraint3DSW *get_island_list_next() const { return island_list_next; }
-	_FORCE_INLINE_ void set_island_list_next(Constraint3DSW *p_next) { island_list_next = p_next; }
-
 	_FORCE_INLINE_ Body3DSW **get_body_ptr() const { return _body_ptr; }
 	_FORCE_INLINE_ int get_body_count() const { return _body_count; }
 
@@ -75,9 +91,24 @@ public:
 	_FORCE_INLINE_ void disable_collisions_between_bodies(const bool p_disabled) { disabled_collisions_between_bodies = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
+	// setup() runs for all constraints in parallel and must only modify the constraint itself,
+	// pre_solve() then runs serially and can modify bodies, areas or the space.
 	virtual bool setup(real_t p_step) = 0;
+	virtual void pre_solve(real_t p_step) {}
 	virtual void solve(real_t p_step) = 0;
 
+	virtual Key get_key() const {
+		Key key;
+		key.id_a = self.get_id();
+		return key;
+	}
+
+	// State carried between steps (contacts, warm starting, overlaps), saved in space snapshots.
+	// Constraints without any (joints) are left to their owners. Loading null resets the state.
+	virtual uint32_t get_snapshot_size() const { return 0; }
+	virtual void save_snapshot(uint8_t *r_data) const {}
+	virtual void load_snapshot(const uint8_t *p_data) {}
+
 	virtual ~Constraint3DSW() {}
 };
 
@@ -97,7 +97,7 @@ void PhysicsServer3DWrapMT::end_sync() {
 void PhysicsServer3DWrapMT::init() {
 	if (create_thread) {
 		//OS::get_singleton()->release_rendering_thread();
-		thread.start(_thread_callback, this);
+		thread.start(_thread_callback, this, Thread::get_role_settings(Thread::ROLE_PHYSICS));
 		while (!step_thread_up) {
 			OS::get_singleton()->delay_usec(1000);
 		}
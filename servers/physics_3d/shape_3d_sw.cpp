@@ -844,8 +844,13 @@ void ConvexPolygonShape3DSW::project_range(const Vector3 &p_normal, const Transf
 
 	const Vector3 *vrts = &mesh.vertices[0];
 
+	// Project in local space, so each vertex costs a single dot product
+	// instead of a full transform.
+	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
+	real_t distance = p_normal.dot(p_transform.origin);
+
 	for (int i = 0; i < vertex_count; i++) {
-		real_t d = p_normal.dot(p_transform.xform(vrts[i]));
+		real_t d = local_normal.dot(vrts[i]) + distance;
 
 		if (i == 0 || d > r_max) {
 			r_max = d;
@@ -1271,52 +1276,20 @@ Vector3 ConcavePolygonShape3DSW::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void ConcavePolygonShape3DSW::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *bvh = &p_params->bvh[p_idx];
-
-	/*
-	if (p_params->dir.dot(bvh->aabb.get_support(-p_params->dir))>p_params->min_d)
-		return; //test against whole AABB, which isn't very costly
-	*/
-
-	//printf("addr: %p\n",bvh);
-	if (!bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
+bool ConcavePolygonShape3DSW::_quantize_aabb(const AABB &p_aabb, uint16_t r_min[3], uint16_t r_max[3]) const {
+	const AABB &aabb = get_aabb();
+	if (!aabb.intersects_inclusive(p_aabb)) {
+		return false;
 	}
 
-	if (bvh->face_index >= 0) {
-		Vector3 res;
-		Vector3 vertices[3] = {
-			p_params->vertices[p_params->faces[bvh->face_index].indices[0]],
-			p_params->vertices[p_params->faces[bvh->face_index].indices[1]],
-			p_params->vertices[p_params->faces[bvh->face_index].indices[2]]
-		};
-
-		if (Geometry3D::segment_intersects_triangle(
-					p_params->from,
-					p_params->to,
-					vertices[0],
-					vertices[1],
-					vertices[2],
-					&res)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			//TODO, seems segmen/triangle intersection is broken :(
-			if (d > 0 && d < p_params->min_d) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = Plane(vertices[0], vertices[1], vertices[2]).normal;
-				p_params->collisions++;
-			}
-		}
-
-	} else {
-		if (bvh->left >= 0) {
-			_cull_segment(bvh->left, p_params);
-		}
-		if (bvh->right >= 0) {
-			_cull_segment(bvh->right, p_params);
-		}
+	// Rounded outwards, so quantized bounds always contain the real ones.
+	Vector3 min = (p_aabb.position - aabb.position) * bvh_quantize_scale;
+	Vector3 max = (p_aabb.position + p_aabb.size - aabb.position) * bvh_quantize_scale;
+	for (int i = 0; i < 3; i++) {
+		r_min[i] = CLAMP(Math::floor(min[i]), 0, 65535);
+		r_max[i] = CLAMP(Math::ceil(max[i]), 0, 65535);
 	}
+	return true;
 }
 
 bool ConcavePolygonShape3DSW::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_result, Vector3 &r_normal) const {
@@ -1328,24 +1301,79 @@ bool ConcavePolygonShape3DSW::intersect_segment(const Vector3 &p_begin, const Ve
 	const Face *fr = faces.ptr();
 	const Vector3 *vr = vertices.ptr();
 	const BVH *br = bvh.ptr();
+	uint32_t bvh_size = bvh.size();
 
-	_SegmentCullParams params;
-	params.from = p_begin;
-	params.to = p_end;
-	params.collisions = 0;
-	params.dir = (p_end - p_begin).normalized();
+	Vector3 dir = (p_end - p_begin).normalized();
+	Vector3 segment = p_end - p_begin;
+	real_t segment_length = segment.length();
 
-	params.faces = fr;
-	params.vertices = vr;
-	params.bvh = br;
+	// Slab test in quantized space, the segment goes from begin to begin + segment * t, with t in [0, max_t].
+	Vector3 begin = (p_begin - get_aabb().position) * bvh_quantize_scale;
+	segment *= bvh_quantize_scale;
+	Vector3 inv_segment;
+	for (int i = 0; i < 3; i++) {
+		inv_segment[i] = segment[i] == real_t(0.0) ? real_t(0.0) : real_t(1.0) / segment[i];
+	}
 
-	params.min_d = 1e20;
-	// cull
-	_cull_segment(0, &params);
+	real_t max_t = 1.0;
+	real_t min_d = 1e20;
+	int collisions = 0;
+	Vector3 result;
+	Vector3 normal;
 
-	if (params.collisions > 0) {
-		r_result = params.result;
-		r_normal = params.normal;
+	uint32_t idx = 0;
+	while (idx < bvh_size) {
+		const BVH &node = br[idx];
+
+		real_t t_min = 0.0;
+		real_t t_max = max_t;
+		for (int i = 0; i < 3; i++) {
+			if (inv_segment[i] == real_t(0.0)) {
+				// Parallel to the slab (or a flat shape axis, where everything quantizes to zero).
+				if (begin[i] < real_t(node.min[i]) || begin[i] > real_t(node.max[i])) {
+					t_min = 1.0;
+					t_max = 0.0;
+				}
+				continue;
+			}
+			real_t t0 = (real_t(node.min[i]) - begin[i]) * inv_segment[i];
+			real_t t1 = (real_t(node.max[i]) - begin[i]) * inv_segment[i];
+			if (t0 > t1) {
+				SWAP(t0, t1);
+			}
+			t_min = MAX(t_min, t0);
+			t_max = MIN(t_max, t1);
+		}
+		bool hit = t_min <= t_max;
+
+		if (node.data < 0) {
+			idx = hit ? idx + 1 : uint32_t(-node.data);
+			continue;
+		}
+
+		idx++;
+		if (!hit) {
+			continue;
+		}
+
+		const Face &f = fr[node.data];
+		Vector3 res;
+		if (Geometry3D::segment_intersects_triangle(p_begin, p_end, vr[f.indices[0]], vr[f.indices[1]], vr[f.indices[2]], &res)) {
+			real_t d = dir.dot(res) - dir.dot(p_begin);
+			if (d > 0 && d < min_d) {
+				min_d = d;
+				result = res;
+				normal = Plane(vr[f.indices[0]], vr[f.indices[1]], vr[f.indices[2]]).normal;
+				collisions++;
+				// Nodes further than this hit can be skipped.
+				max_t = segment_length > 0 ? MIN(max_t, d / segment_length + CMP_EPSILON) : max_t;
+			}
+		}
+	}
+
+	if (collisions > 0) {
+		r_result = result;
+		r_normal = normal;
 		return true;
 	} else {
 		return false;
@@ -1360,59 +1388,51 @@ Vector3 ConcavePolygonShape3DSW::get_closest_point_to(const Vector3 &p_point) co
 	return Vector3();
 }
 
-void ConcavePolygonShape3DSW::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *bvh = &p_params->bvh[p_idx];
-
-	if (!p_params->aabb.intersects(bvh->aabb)) {
-		return;
-	}
-
-	if (bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[bvh->face_index];
-		FaceShape3DSW *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		p_params->callback(p_params->userdata, face);
-
-	} else {
-		if (bvh->left >= 0) {
-			_cull(bvh->left, p_params);
-		}
-
-		if (bvh->right >= 0) {
-			_cull(bvh->right, p_params);
-		}
-	}
-}
-
 void ConcavePolygonShape3DSW::cull(const AABB &p_local_aabb, Callback p_callback, void *p_userdata) const {
 	// make matrix local to concave
 	if (faces.size() == 0) {
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
+	uint16_t query_min[3];
+	uint16_t query_max[3];
+	if (!_quantize_aabb(p_local_aabb, query_min, query_max)) {
+		return;
+	}
 
 	// unlock data
 	const Face *fr = faces.ptr();
 	const Vector3 *vr = vertices.ptr();
 	const BVH *br = bvh.ptr();
+	uint32_t bvh_size = bvh.size();
 
 	FaceShape3DSW face; // use this to send in the callback
 
-	_CullParams params;
-	params.aabb = local_aabb;
-	params.face = &face;
-	params.faces = fr;
-	params.vertices = vr;
-	params.bvh = br;
-	params.callback = p_callback;
-	params.userdata = p_userdata;
+	uint32_t idx = 0;
+	while (idx < bvh_size) {
+		const BVH &node = br[idx];
+
+		bool hit = (query_min[0] <= node.max[0]) & (query_max[0] >= node.min[0]) &
+				   (query_min[1] <= node.max[1]) & (query_max[1] >= node.min[1]) &
+				   (query_min[2] <= node.max[2]) & (query_max[2] >= node.min[2]);
 
-	// cull
-	_cull(0, &params);
+		if (node.data < 0) {
+			idx = hit ? idx + 1 : uint32_t(-node.data);
+			continue;
+		}
+
+		idx++;
+		if (!hit) {
+			continue;
+		}
+
+		const Face *f = &fr[node.data];
+		face.normal = f->normal;
+		face.vertex[0] = vr[f->indices[0]];
+		face.vertex[1] = vr[f->indices[1]];
+		face.vertex[2] = vr[f->indices[2]];
+		p_callback(p_userdata, &face);
+	}
 }
 
 Vector3 ConcavePolygonShape3DSW::get_moment_of_inertia(real_t p_mass) const {
@@ -1507,26 +1527,17 @@ _VolumeSW_BVH *_volume_sw_build_bvh(_VolumeSW_BVH_Element *p_elements, int p_siz
 }
 
 void ConcavePolygonShape3DSW::_fill_bvh(_VolumeSW_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
+	int idx = p_idx++;
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+	_quantize_aabb(p_bvh_tree->aabb, p_bvh_array[idx].min, p_bvh_array[idx].max);
 
+	if (p_bvh_tree->face_index >= 0) {
+		p_bvh_array[idx].data = p_bvh_tree->face_index;
 	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
-
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
+		// Branches always have both children.
+		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
 		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
+		p_bvh_array[idx].data = -p_idx;
 	}
 
 	memdelete(p_bvh_tree);
@@ -1577,17 +1588,21 @@ void ConcavePolygonShape3DSW::_setup(Vector<Vector3> p_faces) {
 		}
 	}
 
+	configure(_aabb); // this type of shape has no margin, configured first as the BVH is quantized inside it
+
+	for (int i = 0; i < 3; i++) {
+		bvh_quantize_scale[i] = _aabb.size[i] > 0 ? 65535.0 / _aabb.size[i] : 0.0;
+	}
+
 	int count = 0;
 	_VolumeSW_BVH *bvh_tree = _volume_sw_build_bvh(bvh_arrayw, src_face_count, count);
 
-	bvh.resize(count + 1);
+	bvh.resize(count);
 
 	BVH *bvh_arrayw2 = bvh.ptrw();
 
 	int idx = 0;
 	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
-
-	configure(_aabb); // this type of shape has no margin
 }
 
 void ConcavePolygonShape3DSW::set_data(const Variant &p_data) {
@@ -1629,8 +1644,100 @@ Vector3 HeightMapShape3DSW::get_support(const Vector3 &p_normal) const {
 	return get_aabb().get_support(p_normal);
 }
 
+Vector3 HeightMapShape3DSW::_get_point(int p_x, int p_z) const {
+	return local_origin + Vector3(p_x * cell_size, heights[p_z * width + p_x], p_z * cell_size);
+}
+
+AABB HeightMapShape3DSW::_get_block_aabb(int p_level, int p_x, int p_z) const {
+	const MinMaxLevel &level = min_max_levels[p_level];
+	const MinMax &min_max = level.data[p_z * level.width + p_x];
+
+	int cells_width = width - 1;
+	int cells_depth = depth - 1;
+	int from_x = p_x << p_level;
+	int from_z = p_z << p_level;
+	int to_x = MIN((p_x + 1) << p_level, cells_width);
+	int to_z = MIN((p_z + 1) << p_level, cells_depth);
+
+	Vector3 from = local_origin + Vector3(from_x * cell_size, min_max.min, from_z * cell_size);
+	Vector3 to = local_origin + Vector3(to_x * cell_size, min_max.max, to_z * cell_size);
+	return AABB(from, to - from);
+}
+
+void HeightMapShape3DSW::_get_cell_faces(int p_x, int p_z, Vector3 r_faces[2][3]) const {
+	Vector3 p00 = _get_point(p_x, p_z);
+	Vector3 p10 = _get_point(p_x + 1, p_z);
+	Vector3 p01 = _get_point(p_x, p_z + 1);
+	Vector3 p11 = _get_point(p_x + 1, p_z + 1);
+
+	r_faces[0][0] = p00;
+	r_faces[0][1] = p10;
+	r_faces[0][2] = p11;
+
+	r_faces[1][0] = p00;
+	r_faces[1][1] = p11;
+	r_faces[1][2] = p01;
+}
+
+void HeightMapShape3DSW::_cull_segment(int p_level, int p_x, int p_z, _SegmentCullParams *p_params) const {
+	if (!_get_block_aabb(p_level, p_x, p_z).intersects_segment(p_params->from, p_params->to)) {
+		return;
+	}
+
+	if (p_level == 0) {
+		Vector3 faces[2][3];
+		_get_cell_faces(p_x, p_z, faces);
+
+		for (int i = 0; i < 2; i++) {
+			Vector3 res;
+			if (!Geometry3D::segment_intersects_triangle(p_params->from, p_params->to, faces[i][0], faces[i][1], faces[i][2], &res)) {
+				continue;
+			}
+
+			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
+			if (d > 0 && d < p_params->min_d) {
+				p_params->min_d = d;
+				p_params->result = res;
+				p_params->normal = Plane(faces[i][0], faces[i][1], faces[i][2]).normal;
+				p_params->collisions++;
+				// Only closer hits matter from now on, shorten the segment so farther blocks are skipped.
+				p_params->to = res;
+			}
+		}
+		return;
+	}
+
+	const MinMaxLevel &child_level = min_max_levels[p_level - 1];
+	for (int i = 0; i < 4; i++) {
+		int x = p_x * 2 + (i & 1);
+		int z = p_z * 2 + (i >> 1);
+		if (x < child_level.width && z < child_level.depth) {
+			_cull_segment(p_level - 1, x, z, p_params);
+		}
+	}
+}
+
 bool HeightMapShape3DSW::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
-	return false;
+	if (min_max_levels.is_empty()) {
+		return false;
+	}
+
+	_SegmentCullParams params;
+	params.from = p_begin;
+	params.to = p_end;
+	params.dir = (p_end - p_begin).normalized();
+	params.min_d = 1e20;
+	params.collisions = 0;
+
+	_cull_segment(min_max_levels.size() - 1, 0, 0, &params);
+
+	if (params.collisions > 0) {
+		r_point = params.result;
+		r_normal = params.normal;
+		return true;
+	} else {
+		return false;
+	}
 }
 
 bool HeightMapShape3DSW::intersect_point(const Vector3 &p_point) const {
@@ -1641,7 +1748,50 @@ Vector3 HeightMapShape3DSW::get_closest_point_to(const Vector3 &p_point) const {
 	return Vector3();
 }
 
+void HeightMapShape3DSW::_cull(int p_level, int p_x, int p_z, _CullParams *p_params) const {
+	if (!p_params->aabb.intersects(_get_block_aabb(p_level, p_x, p_z))) {
+		return;
+	}
+
+	if (p_level == 0) {
+		Vector3 faces[2][3];
+		_get_cell_faces(p_x, p_z, faces);
+
+		FaceShape3DSW *face = p_params->face;
+		for (int i = 0; i < 2; i++) {
+			face->vertex[0] = faces[i][0];
+			face->vertex[1] = faces[i][1];
+			face->vertex[2] = faces[i][2];
+			face->normal = Plane(faces[i][0], faces[i][1], faces[i][2]).normal;
+			p_params->callback(p_params->userdata, face);
+		}
+		return;
+	}
+
+	const MinMaxLevel &child_level = min_max_levels[p_level - 1];
+	for (int i = 0; i < 4; i++) {
+		int x = p_x * 2 + (i & 1);
+		int z = p_z * 2 + (i >> 1);
+		if (x < child_level.width && z < child_level.depth) {
+			_cull(p_level - 1, x, z, p_params);
+		}
+	}
+}
+
 void HeightMapShape3DSW::cull(const AABB &p_local_aabb, Callback p_callback, void *p_userdata) const {
+	if (min_max_levels.is_empty()) {
+		return;
+	}
+
+	FaceShape3DSW face; // use this to send in the callback
+
+	_CullParams params;
+	params.aabb = p_local_aabb;
+	params.callback = p_callback;
+	params.userdata = p_userdata;
+	params.face = &face;
+
+	_cull(min_max_levels.size() - 1, 0, 0, &params);
 }
 
 Vector3 HeightMapShape3DSW::get_moment_of_inertia(real_t p_mass) const {
@@ -1659,25 +1809,68 @@ void HeightMapShape3DSW::_setup(Vector<real_t> p_heights, int p_width, int p_dep
 	width = p_width;
 	depth = p_depth;
 	cell_size = p_cell_size;
+	local_origin = Vector3((width - 1) * cell_size * -0.5, 0, (depth - 1) * cell_size * -0.5);
 
 	const real_t *r = heights.ptr();
 
-	AABB aabb;
-
-	for (int i = 0; i < depth; i++) {
-		for (int j = 0; j < width; j++) {
-			real_t h = r[i * width + j];
-
-			Vector3 pos(j * cell_size, h, i * cell_size);
-			if (i == 0 || j == 0) {
-				aabb.position = pos;
-			} else {
-				aabb.expand_to(pos);
+	real_t min_height = r[0];
+	real_t max_height = r[0];
+	for (int i = 1; i < width * depth; i++) {
+		min_height = MIN(min_height, r[i]);
+		max_height = MAX(max_height, r[i]);
+	}
+
+	min_max_levels.clear();
+
+	if (width > 1 && depth > 1) {
+		// Level 0, the cells.
+		MinMaxLevel cells;
+		cells.width = width - 1;
+		cells.depth = depth - 1;
+		cells.data.resize(cells.width * cells.depth);
+		MinMax *cellsw = cells.data.ptrw();
+		for (int i = 0; i < cells.depth; i++) {
+			for (int j = 0; j < cells.width; j++) {
+				real_t h00 = r[i * width + j];
+				real_t h10 = r[i * width + j + 1];
+				real_t h01 = r[(i + 1) * width + j];
+				real_t h11 = r[(i + 1) * width + j + 1];
+				cellsw[i * cells.width + j].min = MIN(MIN(h00, h10), MIN(h01, h11));
+				cellsw[i * cells.width + j].max = MAX(MAX(h00, h10), MAX(h01, h11));
+			}
+		}
+		min_max_levels.push_back(cells);
+
+		// Each next level merges 2x2 blocks of the previous one, until a single block covers the map.
+		while (min_max_levels[min_max_levels.size() - 1].width > 1 || min_max_levels[min_max_levels.size() - 1].depth > 1) {
+			const MinMaxLevel &prev = min_max_levels[min_max_levels.size() - 1];
+			MinMaxLevel level;
+			level.width = (prev.width + 1) / 2;
+			level.depth = (prev.depth + 1) / 2;
+			level.data.resize(level.width * level.depth);
+			MinMax *levelw = level.data.ptrw();
+			for (int i = 0; i < level.depth; i++) {
+				for (int j = 0; j < level.width; j++) {
+					MinMax min_max = prev.data[(i * 2) * prev.width + j * 2];
+					for (int k = 1; k < 4; k++) {
+						int x = j * 2 + (k & 1);
+						int z = i * 2 + (k >> 1);
+						if (x < prev.width && z < prev.depth) {
+							const MinMax &child = prev.data[z * prev.width + x];
+							min_max.min = MIN(min_max.min, child.min);
+							min_max.max = MAX(min_max.max, child.max);
+						}
+					}
+					levelw[i * level.width + j] = min_max;
+				}
 			}
+			min_max_levels.push_back(level);
 		}
 	}
 
-	configure(aabb);
+	Vector3 aabb_from = local_origin + Vector3(0, min_height, 0);
+	Vector3 aabb_to = Vector3(-local_origin.x, max_height, -local_origin.z);
+	configure(AABB(aabb_from, aabb_to - aabb_from));
 }
 
 void HeightMapShape3DSW::set_data(const Variant &p_data) {
@@ -1685,12 +1878,11 @@ void HeightMapShape3DSW::set_data(const Variant &p_data) {
 	Dictionary d = p_data;
 	ERR_FAIL_COND(!d.has("width"));
 	ERR_FAIL_COND(!d.has("depth"));
-	ERR_FAIL_COND(!d.has("cell_size"));
 	ERR_FAIL_COND(!d.has("heights"));
 
 	int width = d["width"];
 	int depth = d["depth"];
-	real_t cell_size = d["cell_size"];
+	real_t cell_size = d.has("cell_size") ? real_t(d["cell_size"]) : real_t(1.0);
 	Vector<real_t> heights = d["heights"];
 
 	ERR_FAIL_COND(width <= 0);
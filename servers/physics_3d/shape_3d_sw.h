@@ -322,42 +322,19 @@ struct ConcavePolygonShape3DSW : public ConcaveShape3DSW {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
+	// Node bounds are quantized to 16 bits inside the shape's AABB, so a node takes 16 bytes.
+	// Nodes are stored depth first and traversed without a stack: when a node is missed,
+	// traversal jumps to its escape index (the node right after its subtree).
 	struct BVH {
-		AABB aabb;
-		int left;
-		int right;
-
-		int face_index;
+		uint16_t min[3];
+		uint16_t max[3];
+		int32_t data; // Face index for leaves, minus the escape index for the others.
 	};
 
 	Vector<BVH> bvh;
+	Vector3 bvh_quantize_scale;
 
-	struct _CullParams {
-		AABB aabb;
-		Callback callback;
-		void *userdata;
-		const Face *faces;
-		const Vector3 *vertices;
-		const BVH *bvh;
-		FaceShape3DSW *face;
-	};
-
-	struct _SegmentCullParams {
-		Vector3 from;
-		Vector3 to;
-		const Face *faces;
-		const Vector3 *vertices;
-		const BVH *bvh;
-		Vector3 dir;
-
-		Vector3 result;
-		Vector3 normal;
-		real_t min_d;
-		int collisions;
-	};
-
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	void _cull(int p_idx, _CullParams *p_params) const;
+	_FORCE_INLINE_ bool _quantize_aabb(const AABB &p_aabb, uint16_t r_min[3], uint16_t r_max[3]) const;
 
 	void _fill_bvh(_VolumeSW_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
 
@@ -390,9 +367,47 @@ struct HeightMapShape3DSW : public ConcaveShape3DSW {
 	int width;
 	int depth;
 	real_t cell_size;
+	Vector3 local_origin; // Position of the first height, the map is centered on the XZ plane.
+
+	// Minimum and maximum heights of blocks of 2^level x 2^level cells, level 0 being the cells.
+	// Queries descend from the top level, skipping the blocks they can't touch.
+	struct MinMax {
+		real_t min;
+		real_t max;
+	};
+
+	struct MinMaxLevel {
+		int width = 0;
+		int depth = 0;
+		Vector<MinMax> data;
+	};
+
+	Vector<MinMaxLevel> min_max_levels;
+
+	struct _CullParams {
+		AABB aabb;
+		Callback callback;
+		void *userdata;
+		FaceShape3DSW *face;
+	};
+
+	struct _SegmentCullParams {
+		Vector3 from;
+		Vector3 to;
+		Vector3 dir;
+
+		Vector3 result;
+		Vector3 normal;
+		real_t min_d;
+		int collisions;
+	};
+
+	_FORCE_INLINE_ Vector3 _get_point(int p_x, int p_z) const;
+	_FORCE_INLINE_ AABB _get_block_aabb(int p_level, int p_x, int p_z) const;
+	void _get_cell_faces(int p_x, int p_z, Vector3 r_faces[2][3]) const;
 
-	//void _cull_segment(int p_idx,_SegmentCullParams *p_params) const;
-	//void _cull(int p_idx,_CullParams *p_params) const;
+	void _cull_segment(int p_level, int p_x, int p_z, _SegmentCullParams *p_params) const;
+	void _cull(int p_level, int p_x, int p_z, _CullParams *p_params) const;
 
 	void _setup(Vector<real_t> p_heights, int p_width, int p_depth, real_t p_cell_size);
 
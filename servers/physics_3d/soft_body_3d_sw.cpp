@@ -0,0 +1,620 @@
+/*************************************************************************/
+/*  soft_body_3d_sw.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "soft_body_3d_sw.h"
+
+#include "body_3d_sw.h"
+#include "space_3d_sw.h"
+
+#include "core/templates/hash_map.h"
+#include "core/templates/map.h"
+#include "scene/3d/soft_body_3d.h"
+#include "scene/resources/mesh.h"
+
+#define SOFT_BODY_COLLISION_MARGIN 0.01
+
+void SoftBody3DSW::set_space(Space3DSW *p_space) {
+	if (space == p_space) {
+		return;
+	}
+
+	if (space) {
+		space->soft_body_remove_from_list(&space_list);
+	}
+
+	space = p_space;
+
+	if (space) {
+		space->soft_body_add_to_list(&space_list);
+	}
+}
+
+void SoftBody3DSW::set_mesh(const REF &p_mesh) {
+	nodes.clear();
+	rest_vertices.clear();
+	node_vertices.clear();
+	faces.clear();
+	links.clear();
+	color_offsets.clear();
+	serial_links_from = 0;
+	colliders.clear();
+
+	Ref<Mesh> mesh = p_mesh;
+	if (mesh.is_null() || mesh->get_surface_count() == 0) {
+		return;
+	}
+
+	ERR_FAIL_COND_MSG(!(mesh->surface_get_format(0) & RS::ARRAY_FORMAT_INDEX), "Soft body meshes must be indexed.");
+	Array arrays = mesh->surface_get_arrays(0);
+	Vector<Vector3> vertices = arrays[RS::ARRAY_VERTEX];
+	Vector<int> indices = arrays[RS::ARRAY_INDEX];
+
+	// Duplicated vertices (UV or normal seams) are welded into a single node.
+	Map<Vector3, int> unique_vertices;
+	LocalVector<uint32_t> vertex_nodes;
+	vertex_nodes.resize(vertices.size());
+	for (int i = 0; i < vertices.size(); i++) {
+		Map<Vector3, int>::Element *E = unique_vertices.find(vertices[i]);
+		if (!E) {
+			E = unique_vertices.insert(vertices[i], rest_vertices.size());
+			rest_vertices.push_back(vertices[i]);
+			node_vertices.push_back(LocalVector<int>());
+		}
+		vertex_nodes[i] = E->get();
+		node_vertices[E->get()].push_back(i);
+	}
+
+	// Reversed, so the face normals point out of the mesh.
+	for (int i = 0; i + 2 < indices.size(); i += 3) {
+		ERR_CONTINUE(indices[i] >= vertices.size() || indices[i + 1] >= vertices.size() || indices[i + 2] >= vertices.size());
+		uint32_t a = vertex_nodes[indices[i + 2]];
+		uint32_t b = vertex_nodes[indices[i + 1]];
+		uint32_t c = vertex_nodes[indices[i]];
+		if (a == b || b == c || c == a) {
+			continue;
+		}
+		faces.push_back(a);
+		faces.push_back(b);
+		faces.push_back(c);
+	}
+
+	nodes.resize(rest_vertices.size());
+	_build_links();
+	_update_masses();
+	_reset_nodes();
+}
+
+void SoftBody3DSW::_build_links() {
+	LocalVector<Link> unsorted_links;
+
+	// Every edge is a link, and the opposite corners of the two faces sharing an edge get a bending link.
+	HashMap<uint64_t, uint32_t> edge_opposites;
+	for (uint32_t i = 0; i < faces.size(); i += 3) {
+		for (uint32_t j = 0; j < 3; j++) {
+			uint32_t a = faces[i + j];
+			uint32_t b = faces[i + (j + 1) % 3];
+			uint32_t opposite = faces[i + (j + 2) % 3];
+			uint64_t key = (uint64_t(MIN(a, b)) << 32) | MAX(a, b);
+
+			Link link;
+			const uint32_t *other_opposite = edge_opposites.getptr(key);
+			if (!other_opposite) {
+				edge_opposites.set(key, opposite);
+				link.a = a;
+				link.b = b;
+			} else if (*other_opposite != opposite) {
+				link.a = *other_opposite;
+				link.b = opposite;
+				link.bending = true;
+			} else {
+				continue;
+			}
+			unsorted_links.push_back(link);
+		}
+	}
+
+	// Greedy coloring, no two links of a color share a node.
+	LocalVector<uint64_t> node_colors;
+	node_colors.resize(nodes.size());
+	for (uint32_t i = 0; i < node_colors.size(); i++) {
+		node_colors[i] = 0;
+	}
+
+	LocalVector<uint32_t> link_colors;
+	link_colors.resize(unsorted_links.size());
+	uint32_t color_counts[MAX_COLORS + 1] = {};
+	uint32_t color_count = 0;
+
+	for (uint32_t i = 0; i < unsorted_links.size(); i++) {
+		const Link &link = unsorted_links[i];
+		uint64_t used = node_colors[link.a] | node_colors[link.b];
+		uint32_t color = MAX_COLORS;
+		for (uint32_t j = 0; j < MAX_COLORS; j++) {
+			if (!(used & (uint64_t(1) << j))) {
+				color = j;
+				break;
+			}
+		}
+		if (color < MAX_COLORS) {
+			node_colors[link.a] |= uint64_t(1) << color;
+			node_colors[link.b] |= uint64_t(1) << color;
+			color_count = MAX(color_count, color + 1);
+		}
+		link_colors[i] = color;
+		color_counts[color]++;
+	}
+
+	uint32_t offsets[MAX_COLORS + 1];
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i <= MAX_COLORS; i++) {
+		offsets[i] = offset;
+		offset += color_counts[i];
+	}
+
+	color_offsets.resize(color_count + 1);
+	for (uint32_t i = 0; i <= color_count; i++) {
+		color_offsets[i] = offsets[i];
+	}
+	serial_links_from = offsets[MAX_COLORS];
+
+	links.resize(unsorted_links.size());
+	for (uint32_t i = 0; i < unsorted_links.size(); i++) {
+		links[offsets[link_colors[i]]++] = unsorted_links[i];
+	}
+}
+
+void SoftBody3DSW::_update_masses() {
+	uint32_t pinned_count = 0;
+	for (int i = 0; i < pinned_points.size(); i++) {
+		if (pinned_points[i] < (int)nodes.size()) {
+			pinned_count++;
+		}
+	}
+
+	uint32_t free_count = nodes.size() - pinned_count;
+	real_t inv_mass = free_count ? real_t(free_count) / total_mass : 0.0;
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		nodes[i].inv_mass = pinned_points.has(i) ? 0.0 : inv_mass;
+	}
+}
+
+void SoftBody3DSW::_reset_nodes() {
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		Node &node = nodes[i];
+		node.position = transform.xform(rest_vertices[i]);
+		node.previous_position = node.position;
+		node.velocity = Vector3();
+	}
+
+	// Rest lengths are taken in global space, so scaled soft bodies keep their shape.
+	for (uint32_t i = 0; i < links.size(); i++) {
+		links[i].rest_length = nodes[links[i].a].position.distance_to(nodes[links[i].b].position);
+	}
+
+	_update_normals();
+	_update_aabb();
+}
+
+void SoftBody3DSW::_update_normals() {
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		nodes[i].normal = Vector3();
+	}
+
+	for (uint32_t i = 0; i < faces.size(); i += 3) {
+		Node &a = nodes[faces[i]];
+		Node &b = nodes[faces[i + 1]];
+		Node &c = nodes[faces[i + 2]];
+		Vector3 normal = (b.position - a.position).cross(c.position - a.position);
+		a.normal += normal;
+		b.normal += normal;
+		c.normal += normal;
+	}
+
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		real_t length = nodes[i].normal.length();
+		if (length > CMP_EPSILON) {
+			nodes[i].normal /= length;
+		}
+	}
+}
+
+void SoftBody3DSW::_update_aabb() {
+	if (nodes.is_empty()) {
+		aabb = AABB();
+		return;
+	}
+
+	aabb = AABB(nodes[0].position, Vector3());
+	for (uint32_t i = 1; i < nodes.size(); i++) {
+		aabb.expand_to(nodes[i].position);
+	}
+}
+
+void SoftBody3DSW::_gather_colliders() {
+	colliders.clear();
+
+	if (!space || !collision_mask) {
+		return;
+	}
+
+	AABB motion_aabb = AABB(nodes[0].position, Vector3());
+	for (uint32_t i = 1; i < nodes.size(); i++) {
+		motion_aabb.expand_to(nodes[i].position);
+	}
+	motion_aabb = motion_aabb.merge(aabb).grow(SOFT_BODY_COLLISION_MARGIN);
+
+	int amount = space->get_broadphase()->cull_aabb(motion_aabb, cull_results.ptr(), MAX_COLLIDERS, cull_subindex_results.ptr());
+
+	for (int i = 0; i < amount; i++) {
+		CollisionObject3DSW *co = cull_results[i];
+		if (co->get_type() != CollisionObject3DSW::TYPE_BODY) {
+			continue;
+		}
+		if (!(collision_mask & co->get_collision_layer()) || exceptions.has(co->get_self())) {
+			continue;
+		}
+
+		int shape_idx = cull_subindex_results[i];
+		if (co->is_shape_set_as_disabled(shape_idx)) {
+			continue;
+		}
+
+		Collider collider;
+		collider.shape = co->get_shape(shape_idx);
+		if (collider.shape->get_type() == PhysicsServer3D::SHAPE_RAY) {
+			continue;
+		}
+		collider.xform = co->get_transform() * co->get_shape_transform(shape_idx);
+		collider.inv_xform = collider.xform.affine_inverse();
+		collider.local_aabb = collider.shape->get_aabb().grow(SOFT_BODY_COLLISION_MARGIN);
+		collider.friction = CLAMP(static_cast<Body3DSW *>(co)->get_friction(), 0.0, 1.0);
+		colliders.push_back(collider);
+	}
+}
+
+void SoftBody3DSW::set_state(PhysicsServer3D::BodyState p_state, const Variant &p_variant) {
+	switch (p_state) {
+		case PhysicsServer3D::BODY_STATE_TRANSFORM: {
+			set_transform(p_variant);
+		} break;
+		case PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY: {
+			Vector3 velocity = p_variant;
+			for (uint32_t i = 0; i < nodes.size(); i++) {
+				if (nodes[i].inv_mass > 0.0) {
+					nodes[i].velocity = velocity;
+				}
+			}
+		} break;
+		default: {
+		}
+	}
+}
+
+Variant SoftBody3DSW::get_state(PhysicsServer3D::BodyState p_state) const {
+	switch (p_state) {
+		case PhysicsServer3D::BODY_STATE_TRANSFORM: {
+			return transform;
+		} break;
+		case PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY: {
+			Vector3 velocity;
+			for (uint32_t i = 0; i < nodes.size(); i++) {
+				velocity += nodes[i].velocity;
+			}
+			return nodes.size() ? velocity / nodes.size() : velocity;
+		} break;
+		default: {
+		}
+	}
+
+	return Variant();
+}
+
+void SoftBody3DSW::set_transform(const Transform &p_transform) {
+	transform = p_transform;
+	_reset_nodes();
+}
+
+void SoftBody3DSW::set_simulation_precision(int p_simulation_precision) {
+	simulation_precision = MAX(1, p_simulation_precision);
+}
+
+void SoftBody3DSW::set_total_mass(real_t p_total_mass) {
+	total_mass = p_total_mass > 0.0 ? p_total_mass : 1.0;
+	_update_masses();
+}
+
+void SoftBody3DSW::move_node(int p_index, const Vector3 &p_global_position) {
+	ERR_FAIL_INDEX(p_index, (int)nodes.size());
+	nodes[p_index].position = p_global_position;
+	nodes[p_index].previous_position = p_global_position;
+}
+
+Vector3 SoftBody3DSW::get_node_position(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, (int)nodes.size(), Vector3());
+	return nodes[p_index].position;
+}
+
+Vector3 SoftBody3DSW::get_node_offset(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, (int)rest_vertices.size(), Vector3());
+	return rest_vertices[p_index];
+}
+
+void SoftBody3DSW::pin_node(int p_index, bool p_pin) {
+	// Pins may be set before the mesh, they apply once it's there.
+	ERR_FAIL_COND(p_index < 0);
+	if (p_pin) {
+		pinned_points.insert(p_index);
+	} else {
+		pinned_points.erase(p_index);
+	}
+	_update_masses();
+}
+
+bool SoftBody3DSW::is_node_pinned(int p_index) const {
+	return pinned_points.has(p_index);
+}
+
+void SoftBody3DSW::unpin_all_nodes() {
+	pinned_points = VSet<int>();
+	_update_masses();
+}
+
+void SoftBody3DSW::update_rendering_server(SoftBodyRenderingServerHandler *p_rendering_server_handler) const {
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		const Node &node = nodes[i];
+		// The handler writes float triplets straight into the vertex buffer, real_t may be double.
+		const float position[3] = { (float)node.position.x, (float)node.position.y, (float)node.position.z };
+		const float normal[3] = { (float)node.normal.x, (float)node.normal.y, (float)node.normal.z };
+
+		const LocalVector<int> &vertices = node_vertices[i];
+		for (uint32_t j = 0; j < vertices.size(); j++) {
+			p_rendering_server_handler->set_vertex(vertices[j], position);
+			p_rendering_server_handler->set_normal(vertices[j], normal);
+		}
+	}
+
+	p_rendering_server_handler->set_aabb(aabb);
+}
+
+void SoftBody3DSW::predict_motion(real_t p_delta) {
+	if (nodes.is_empty()) {
+		return;
+	}
+
+	Vector3 gravity;
+	if (space) {
+		const Area3DSW *default_area = space->get_default_area();
+		gravity = default_area->get_gravity_vector() * default_area->get_gravity();
+	}
+
+	if (pressure_coefficient != 0.0) {
+		// Pushes every face along its normal, proportionally to its area.
+		for (uint32_t i = 0; i < faces.size(); i += 3) {
+			Node &a = nodes[faces[i]];
+			Node &b = nodes[faces[i + 1]];
+			Node &c = nodes[faces[i + 2]];
+			Vector3 impulse = (b.position - a.position).cross(c.position - a.position) * (pressure_coefficient * p_delta / 6.0);
+			a.velocity += impulse * a.inv_mass;
+			b.velocity += impulse * b.inv_mass;
+			c.velocity += impulse * c.inv_mass;
+		}
+	}
+
+	real_t damping = 1.0 - damping_coefficient;
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		Node &node = nodes[i];
+		node.previous_position = node.position;
+		if (node.inv_mass == 0.0) {
+			node.velocity = Vector3();
+			continue;
+		}
+
+		node.velocity += gravity * p_delta;
+		node.velocity *= damping;
+		// Air drag only slows the motion across the surface.
+		node.velocity -= node.normal * (node.normal.dot(node.velocity) * drag_coefficient);
+		node.position += node.velocity * p_delta;
+	}
+
+	_gather_colliders();
+}
+
+void SoftBody3DSW::_solve_link(const Link &p_link, real_t p_linear_k, real_t p_angular_k) {
+	Node &a = nodes[p_link.a];
+	Node &b = nodes[p_link.b];
+
+	real_t inv_mass = a.inv_mass + b.inv_mass;
+	if (inv_mass == 0.0) {
+		return;
+	}
+
+	Vector3 delta = b.position - a.position;
+	real_t length = delta.length();
+	if (length < CMP_EPSILON) {
+		return;
+	}
+
+	real_t k = p_link.bending ? p_angular_k : p_linear_k;
+	Vector3 correction = delta * (k * (length - p_link.rest_length) / (length * inv_mass));
+	a.position += correction * a.inv_mass;
+	b.position -= correction * b.inv_mass;
+}
+
+void SoftBody3DSW::_solve_links(uint32_t p_from, uint32_t p_to, real_t p_linear_k, real_t p_angular_k) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		_solve_link(links[i], p_linear_k, p_angular_k);
+	}
+}
+
+void SoftBody3DSW::_solve_links_job(uint32_t p_job, const LinkBatch *p_batch) {
+	uint32_t from = p_batch->from + p_job * LINKS_PER_JOB;
+	_solve_links(from, MIN(from + LINKS_PER_JOB, p_batch->to), p_batch->linear_k, p_batch->angular_k);
+}
+
+struct _SoftBodyFaceCollision {
+	Vector3 point;
+	Vector3 previous_point;
+	Vector3 normal;
+	bool hit = false;
+};
+
+static void _soft_body_face_collision_callback(void *p_userdata, Shape3DSW *p_face) {
+	_SoftBodyFaceCollision *collision = (_SoftBodyFaceCollision *)p_userdata;
+	const FaceShape3DSW *face = static_cast<const FaceShape3DSW *>(p_face);
+
+	// Only pushes back nodes that were in front of the face, or barely behind it, before this step.
+	real_t distance = face->normal.dot(collision->point - face->vertex[0]);
+	if (distance >= SOFT_BODY_COLLISION_MARGIN || face->normal.dot(collision->previous_point - face->vertex[0]) < -SOFT_BODY_COLLISION_MARGIN) {
+		return;
+	}
+
+	Vector3 projected = collision->point - face->normal * distance;
+	Vector3 closest = Face3(face->vertex[0], face->vertex[1], face->vertex[2]).get_closest_point_to(projected);
+	if (closest.distance_squared_to(projected) > CMP_EPSILON2) {
+		return;
+	}
+
+	collision->point = projected + face->normal * SOFT_BODY_COLLISION_MARGIN;
+	collision->normal = face->normal;
+	collision->hit = true;
+}
+
+void SoftBody3DSW::_solve_node_collision(Node &p_node, const Collider &p_collider) {
+	Vector3 local_point = p_collider.inv_xform.xform(p_node.position);
+	if (!p_collider.local_aabb.has_point(local_point)) {
+		return;
+	}
+
+	Vector3 normal;
+	if (p_collider.shape->is_concave()) {
+		_SoftBodyFaceCollision collision;
+		collision.point = local_point;
+		collision.previous_point = p_collider.inv_xform.xform(p_node.previous_position);
+		const AABB point_aabb = AABB(local_point, Vector3()).grow(SOFT_BODY_COLLISION_MARGIN);
+		static_cast<const ConcaveShape3DSW *>(p_collider.shape)->cull(point_aabb, _soft_body_face_collision_callback, &collision);
+		if (!collision.hit) {
+			return;
+		}
+		local_point = collision.point;
+		normal = collision.normal;
+	} else {
+		Vector3 closest = p_collider.shape->get_closest_point_to(local_point);
+		bool inside = p_collider.shape->intersect_point(local_point);
+		normal = inside ? closest - local_point : local_point - closest;
+		real_t distance = normal.length();
+		if (distance < CMP_EPSILON || (!inside && distance >= SOFT_BODY_COLLISION_MARGIN)) {
+			return;
+		}
+		normal /= distance;
+		local_point = closest + normal * SOFT_BODY_COLLISION_MARGIN;
+	}
+
+	p_node.position = p_collider.xform.xform(local_point);
+
+	// Friction removes part of the motion along the surface, spread over the iterations.
+	Vector3 world_normal = p_collider.xform.basis.xform(normal).normalized();
+	Vector3 motion = p_node.position - p_node.previous_position;
+	p_node.position -= (motion - world_normal * world_normal.dot(motion)) * (p_collider.friction * friction_scale);
+}
+
+void SoftBody3DSW::_solve_collisions(uint32_t p_from, uint32_t p_to) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		Node &node = nodes[i];
+		if (node.inv_mass == 0.0) {
+			continue;
+		}
+		for (uint32_t j = 0; j < colliders.size(); j++) {
+			_solve_node_collision(node, colliders[j]);
+		}
+	}
+}
+
+void SoftBody3DSW::_solve_collisions_job(uint32_t p_job, void *p_userdata) {
+	uint32_t from = p_job * NODES_PER_JOB;
+	_solve_collisions(from, MIN(from + NODES_PER_JOB, nodes.size()));
+}
+
+void SoftBody3DSW::solve_constraints(real_t p_delta, ThreadWorkPool *p_work_pool) {
+	if (nodes.is_empty()) {
+		return;
+	}
+
+	// Stiffness is given for the whole step, spread it over the iterations so precision doesn't change it.
+	int iterations = MAX(1, simulation_precision);
+	real_t linear_k = 1.0 - Math::pow(1.0 - linear_stiffness, 1.0 / iterations);
+	real_t angular_k = 1.0 - Math::pow(1.0 - angular_stiffness, 1.0 / iterations);
+	friction_scale = 1.0 / iterations;
+
+	for (int i = 0; i < iterations; i++) {
+		for (uint32_t j = 0; j + 1 < color_offsets.size(); j++) {
+			uint32_t from = color_offsets[j];
+			uint32_t to = color_offsets[j + 1];
+			if (p_work_pool && to - from > LINKS_PER_JOB) {
+				LinkBatch batch;
+				batch.from = from;
+				batch.to = to;
+				batch.linear_k = linear_k;
+				batch.angular_k = angular_k;
+				p_work_pool->do_work((to - from + LINKS_PER_JOB - 1) / LINKS_PER_JOB, this, &SoftBody3DSW::_solve_links_job, (const LinkBatch *)&batch);
+			} else {
+				_solve_links(from, to, linear_k, angular_k);
+			}
+		}
+		_solve_links(serial_links_from, links.size(), linear_k, angular_k);
+
+		if (colliders.is_empty()) {
+			continue;
+		}
+		if (p_work_pool && nodes.size() > NODES_PER_JOB) {
+			p_work_pool->do_work((nodes.size() + NODES_PER_JOB - 1) / NODES_PER_JOB, this, &SoftBody3DSW::_solve_collisions_job, nullptr);
+		} else {
+			_solve_collisions(0, nodes.size());
+		}
+	}
+
+	real_t inv_delta = 1.0 / p_delta;
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		Node &node = nodes[i];
+		node.velocity = (node.position - node.previous_position) * inv_delta;
+	}
+
+	_update_normals();
+	_update_aabb();
+}
+
+SoftBody3DSW::SoftBody3DSW() :
+		space_list(this) {
+	cull_results.resize(MAX_COLLIDERS);
+	cull_subindex_results.resize(MAX_COLLIDERS);
+}
+
+SoftBody3DSW::~SoftBody3DSW() {
+	set_space(nullptr);
+}
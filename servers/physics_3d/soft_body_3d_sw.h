@@ -0,0 +1,208 @@
+/*************************************************************************/
+/*  soft_body_3d_sw.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef SOFT_BODY_3D_SW_H
+#define SOFT_BODY_3D_SW_H
+
+#include "shape_3d_sw.h"
+
+#include "core/templates/local_vector.h"
+#include "core/templates/self_list.h"
+#include "core/templates/thread_work_pool.h"
+#include "core/templates/vset.h"
+
+class CollisionObject3DSW;
+class Space3DSW;
+
+// Position based soft body. Nodes are the welded vertices of the mesh, kept in global space,
+// linked along the triangle edges and across neighbor triangles (bending). Links are colored so
+// no two links of a color share a node, which lets each color be projected in parallel.
+class SoftBody3DSW {
+	RID self;
+	ObjectID instance_id;
+	Space3DSW *space = nullptr;
+	SelfList<SoftBody3DSW> space_list;
+
+	uint32_t collision_layer = 1;
+	uint32_t collision_mask = 1;
+	VSet<RID> exceptions;
+	bool ray_pickable = true;
+
+	int simulation_precision = 5;
+	real_t total_mass = 1.0;
+	real_t linear_stiffness = 0.5;
+	real_t angular_stiffness = 0.5;
+	real_t volume_stiffness = 0.5;
+	real_t pressure_coefficient = 0.0;
+	real_t pose_matching_coefficient = 0.0;
+	real_t damping_coefficient = 0.01;
+	real_t drag_coefficient = 0.0;
+
+	enum {
+		LINKS_PER_JOB = 256, // Colors with more links than this are projected on the work pool.
+		NODES_PER_JOB = 256,
+		MAX_COLORS = 64, // Links that can't get a color are projected serially, after the colored ones.
+		MAX_COLLIDERS = 256,
+	};
+
+	struct Node {
+		Vector3 position;
+		Vector3 previous_position;
+		Vector3 velocity;
+		Vector3 normal;
+		real_t inv_mass = 0.0;
+	};
+
+	struct Link {
+		uint32_t a = 0;
+		uint32_t b = 0;
+		real_t rest_length = 0.0;
+		bool bending = false;
+	};
+
+	struct Collider {
+		Shape3DSW *shape = nullptr;
+		Transform xform;
+		Transform inv_xform;
+		AABB local_aabb; // Shape AABB grown by the collision margin.
+		real_t friction = 1.0;
+	};
+
+	struct LinkBatch {
+		uint32_t from = 0;
+		uint32_t to = 0;
+		real_t linear_k = 0.0;
+		real_t angular_k = 0.0;
+	};
+
+	Transform transform;
+	AABB aabb;
+
+	LocalVector<Node> nodes;
+	LocalVector<Vector3> rest_vertices; // Welded mesh vertices, per node.
+	LocalVector<LocalVector<int>> node_vertices; // Mesh vertices sharing each node.
+	LocalVector<uint32_t> faces; // Node indices, 3 per face.
+	LocalVector<Link> links; // Sorted by color.
+	LocalVector<uint32_t> color_offsets; // Start of each color in links, plus the end.
+	uint32_t serial_links_from = 0; // Links from here on didn't get a color.
+	VSet<int> pinned_points;
+
+	LocalVector<Collider> colliders;
+	LocalVector<CollisionObject3DSW *> cull_results;
+	LocalVector<int> cull_subindex_results;
+	real_t friction_scale = 1.0;
+
+	void _build_links();
+	void _update_masses();
+	void _reset_nodes();
+	void _update_normals();
+	void _update_aabb();
+	void _gather_colliders();
+
+	_FORCE_INLINE_ void _solve_link(const Link &p_link, real_t p_linear_k, real_t p_angular_k);
+	void _solve_links(uint32_t p_from, uint32_t p_to, real_t p_linear_k, real_t p_angular_k);
+	void _solve_links_job(uint32_t p_job, const LinkBatch *p_batch);
+	void _solve_collisions(uint32_t p_from, uint32_t p_to);
+	void _solve_collisions_job(uint32_t p_job, void *p_userdata);
+	_FORCE_INLINE_ void _solve_node_collision(Node &p_node, const Collider &p_collider);
+
+public:
+	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
+	_FORCE_INLINE_ RID get_self() const { return self; }
+
+	_FORCE_INLINE_ void set_instance_id(const ObjectID &p_instance_id) { instance_id = p_instance_id; }
+	_FORCE_INLINE_ ObjectID get_instance_id() const { return instance_id; }
+
+	void set_space(Space3DSW *p_space);
+	_FORCE_INLINE_ Space3DSW *get_space() const { return space; }
+
+	void set_mesh(const REF &p_mesh);
+	_FORCE_INLINE_ bool has_mesh() const { return nodes.size() > 0; }
+
+	void update_rendering_server(class SoftBodyRenderingServerHandler *p_rendering_server_handler) const;
+
+	_FORCE_INLINE_ void set_collision_layer(uint32_t p_layer) { collision_layer = p_layer; }
+	_FORCE_INLINE_ uint32_t get_collision_layer() const { return collision_layer; }
+	_FORCE_INLINE_ void set_collision_mask(uint32_t p_mask) { collision_mask = p_mask; }
+	_FORCE_INLINE_ uint32_t get_collision_mask() const { return collision_mask; }
+
+	_FORCE_INLINE_ void add_exception(const RID &p_exception) { exceptions.insert(p_exception); }
+	_FORCE_INLINE_ void remove_exception(const RID &p_exception) { exceptions.erase(p_exception); }
+	_FORCE_INLINE_ bool has_exception(const RID &p_exception) const { return exceptions.has(p_exception); }
+	_FORCE_INLINE_ const VSet<RID> &get_exceptions() const { return exceptions; }
+
+	_FORCE_INLINE_ void set_ray_pickable(bool p_enable) { ray_pickable = p_enable; }
+	_FORCE_INLINE_ bool is_ray_pickable() const { return ray_pickable; }
+
+	void set_state(PhysicsServer3D::BodyState p_state, const Variant &p_variant);
+	Variant get_state(PhysicsServer3D::BodyState p_state) const;
+
+	void set_transform(const Transform &p_transform);
+	_FORCE_INLINE_ const Transform &get_transform() const { return transform; }
+
+	void set_simulation_precision(int p_simulation_precision);
+	_FORCE_INLINE_ int get_simulation_precision() const { return simulation_precision; }
+	void set_total_mass(real_t p_total_mass);
+	_FORCE_INLINE_ real_t get_total_mass() const { return total_mass; }
+	_FORCE_INLINE_ void set_linear_stiffness(real_t p_stiffness) { linear_stiffness = CLAMP(p_stiffness, 0.0, 1.0); }
+	_FORCE_INLINE_ real_t get_linear_stiffness() const { return linear_stiffness; }
+	_FORCE_INLINE_ void set_angular_stiffness(real_t p_stiffness) { angular_stiffness = CLAMP(p_stiffness, 0.0, 1.0); }
+	_FORCE_INLINE_ real_t get_angular_stiffness() const { return angular_stiffness; }
+	_FORCE_INLINE_ void set_volume_stiffness(real_t p_stiffness) { volume_stiffness = CLAMP(p_stiffness, 0.0, 1.0); }
+	_FORCE_INLINE_ real_t get_volume_stiffness() const { return volume_stiffness; }
+	_FORCE_INLINE_ void set_pressure_coefficient(real_t p_pressure_coefficient) { pressure_coefficient = p_pressure_coefficient; }
+	_FORCE_INLINE_ real_t get_pressure_coefficient() const { return pressure_coefficient; }
+	_FORCE_INLINE_ void set_pose_matching_coefficient(real_t p_pose_matching_coefficient) { pose_matching_coefficient = p_pose_matching_coefficient; }
+	_FORCE_INLINE_ real_t get_pose_matching_coefficient() const { return pose_matching_coefficient; }
+	_FORCE_INLINE_ void set_damping_coefficient(real_t p_damping_coefficient) { damping_coefficient = CLAMP(p_damping_coefficient, 0.0, 1.0); }
+	_FORCE_INLINE_ real_t get_damping_coefficient() const { return damping_coefficient; }
+	_FORCE_INLINE_ void set_drag_coefficient(real_t p_drag_coefficient) { drag_coefficient = CLAMP(p_drag_coefficient, 0.0, 1.0); }
+	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
+
+	_FORCE_INLINE_ int get_node_count() const { return nodes.size(); }
+	void move_node(int p_index, const Vector3 &p_global_position);
+	Vector3 get_node_position(int p_index) const;
+	Vector3 get_node_offset(int p_index) const;
+
+	void pin_node(int p_index, bool p_pin);
+	bool is_node_pinned(int p_index) const;
+	void unpin_all_nodes();
+
+	// Integrates the nodes and gathers the colliders, must be called serially.
+	void predict_motion(real_t p_delta);
+	// Projects the links and collisions. Only touches this body, so bodies can be solved in parallel.
+	// With a work pool, large colors are split into jobs.
+	void solve_constraints(real_t p_delta, ThreadWorkPool *p_work_pool = nullptr);
+
+	SoftBody3DSW();
+	~SoftBody3DSW();
+};
+
+#endif // SOFT_BODY_3D_SW_H
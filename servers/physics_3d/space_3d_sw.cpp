@@ -33,6 +33,7 @@
 #include "collision_solver_3d_sw.h"
 #include "core/config/project_settings.h"
 #include "physics_server_3d_sw.h"
+#include "step_3d_sw.h"
 
 _FORCE_INLINE_ static bool _can_collide_with(CollisionObject3DSW *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
@@ -100,13 +101,17 @@ int PhysicsDirectSpaceState3DSW::intersect_point(const Vector3 &p_point, ShapeRe
 bool PhysicsDirectSpaceState3DSW::intersect_ray(const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas, bool p_pick_ray) {
 	ERR_FAIL_COND_V(space->locked, false);
 
+	// Ray queries don't use the space's shared query buffers, so they can run from several threads at once between steps.
+	static thread_local CollisionObject3DSW *intersection_query_results[Space3DSW::INTERSECTION_QUERY_MAX];
+	static thread_local int intersection_query_subindex_results[Space3DSW::INTERSECTION_QUERY_MAX];
+
 	Vector3 begin, end;
 	Vector3 normal;
 	begin = p_from;
 	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, Space3DSW::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount = space->broadphase->cull_segment(begin, end, intersection_query_results, Space3DSW::INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -117,21 +122,21 @@ bool PhysicsDirectSpaceState3DSW::intersect_ray(const Vector3 &p_from, const Vec
 	real_t min_d = 1e10;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_collision_mask, p_collide_with_bodies, p_collide_with_areas)) {
+		if (!_can_collide_with(intersection_query_results[i], p_collision_mask, p_collide_with_bodies, p_collide_with_areas)) {
 			continue;
 		}
 
-		if (p_pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_pick_ray && !(intersection_query_results[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_exclude.has(intersection_query_results[i]->get_self())) {
 			continue;
 		}
 
-		const CollisionObject3DSW *col_obj = space->intersection_query_results[i];
+		const CollisionObject3DSW *col_obj = intersection_query_results[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = intersection_query_subindex_results[i];
 		Transform inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -176,6 +181,54 @@ bool PhysicsDirectSpaceState3DSW::intersect_ray(const Vector3 &p_from, const Vec
 	return true;
 }
 
+void PhysicsDirectSpaceState3DSW::_intersect_rays_job(uint32_t p_job, RayBatch *p_batch) {
+	int from = p_job * RAYS_PER_JOB;
+	int to = MIN(from + int(RAYS_PER_JOB), p_batch->ray_count);
+	int hits = 0;
+	for (int i = from; i < to; i++) {
+		if (intersect_ray(p_batch->from[i], p_batch->to[i], p_batch->results[i], *p_batch->exclude, p_batch->collision_mask, p_batch->collide_with_bodies, p_batch->collide_with_areas)) {
+			hits++;
+		} else {
+			p_batch->results[i] = RayResult();
+		}
+	}
+	p_batch->job_hits[p_job] = hits;
+}
+
+int PhysicsDirectSpaceState3DSW::intersect_rays(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
+	ERR_FAIL_COND_V(space->locked, 0);
+
+	RayBatch batch;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.ray_count = p_ray_count;
+	batch.results = r_results;
+	batch.exclude = &p_exclude;
+	batch.collision_mask = p_collision_mask;
+	batch.collide_with_bodies = p_collide_with_bodies;
+	batch.collide_with_areas = p_collide_with_areas;
+
+	uint32_t job_count = (p_ray_count + RAYS_PER_JOB - 1) / RAYS_PER_JOB;
+	LocalVector<int> job_hits;
+	job_hits.resize(job_count);
+	batch.job_hits = job_hits.ptr();
+
+	// The step's pool is idle between steps, but only the main thread may use it (other threads can be querying at the same time).
+	if (job_count > 1 && space->broadphase->is_query_thread_safe() && Thread::get_caller_id() == Thread::get_main_id()) {
+		PhysicsServer3DSW::singletonsw->stepper->get_work_pool().do_work(job_count, this, &PhysicsDirectSpaceState3DSW::_intersect_rays_job, &batch);
+	} else {
+		for (uint32_t i = 0; i < job_count; i++) {
+			_intersect_rays_job(i, &batch);
+		}
+	}
+
+	int hits = 0;
+	for (uint32_t i = 0; i < job_count; i++) {
+		hits += job_hits[i];
+	}
+	return hits;
+}
+
 int PhysicsDirectSpaceState3DSW::intersect_shape(const RID &p_shape, const Transform &p_xform, real_t p_margin, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -1003,6 +1056,12 @@ void *Space3DSW::_broadphase_pair(CollisionObject3DSW *A, int p_subindex_A, Coll
 
 	self->collision_pairs++;
 
+	if (type_A == type_B && A->get_self().get_id() > B->get_self().get_id()) {
+		// Same order whichever way the broadphase reports them, so pairs can be found again from snapshots.
+		SWAP(A, B);
+		SWAP(p_subindex_A, p_subindex_B);
+	}
+
 	if (type_A == CollisionObject3DSW::TYPE_AREA) {
 		Area3DSW *area = static_cast<Area3DSW *>(A);
 		if (type_B == CollisionObject3DSW::TYPE_AREA) {
@@ -1071,6 +1130,147 @@ const Set<CollisionObject3DSW *> &Space3DSW::get_objects() const {
 	return objects;
 }
 
+struct _BodyIDCompare3DSW {
+	_FORCE_INLINE_ bool operator()(const Body3DSW *p_a, const Body3DSW *p_b) const {
+		return p_a->get_self().get_id() < p_b->get_self().get_id();
+	}
+};
+
+void Space3DSW::_get_sorted_bodies(LocalVector<Body3DSW *> &r_bodies) const {
+	for (const Set<CollisionObject3DSW *>::Element *E = objects.front(); E; E = E->next()) {
+		if (E->get()->get_type() == CollisionObject3DSW::TYPE_BODY) {
+			r_bodies.push_back(static_cast<Body3DSW *>(E->get()));
+		}
+	}
+	r_bodies.sort_custom<_BodyIDCompare3DSW>();
+}
+
+void Space3DSW::_get_sorted_pairs(const LocalVector<Body3DSW *> &p_bodies, LocalVector<SnapshotPair> &r_pairs) const {
+	for (uint32_t i = 0; i < p_bodies.size(); i++) {
+		for (const Map<Constraint3DSW *, int>::Element *E = p_bodies[i]->get_constraint_map().front(); E; E = E->next()) {
+			// Body pairs are in the maps of both bodies, take them from the first one.
+			if (E->get() != 0 || E->key()->get_snapshot_size() == 0) {
+				continue;
+			}
+			SnapshotPair pair;
+			pair.key = E->key()->get_key();
+			pair.constraint = E->key();
+			r_pairs.push_back(pair);
+		}
+	}
+	r_pairs.sort();
+}
+
+Vector<uint8_t> Space3DSW::get_snapshot() const {
+	LocalVector<Body3DSW *> bodies;
+	_get_sorted_bodies(bodies);
+	LocalVector<SnapshotPair> pairs;
+	_get_sorted_pairs(bodies, pairs);
+
+	uint32_t size = sizeof(SnapshotHeader) + bodies.size() * sizeof(SnapshotBody);
+	for (uint32_t i = 0; i < pairs.size(); i++) {
+		size += sizeof(Constraint3DSW::Key) + sizeof(uint32_t) + pairs[i].constraint->get_snapshot_size();
+	}
+
+	Vector<uint8_t> snapshot;
+	snapshot.resize(size);
+	uint8_t *w = snapshot.ptrw();
+
+	SnapshotHeader header;
+	header.magic = SNAPSHOT_MAGIC;
+	header.version = SNAPSHOT_VERSION;
+	header.real_size = sizeof(real_t);
+	header.body_count = bodies.size();
+	header.pair_count = pairs.size();
+	memcpy(w, &header, sizeof(SnapshotHeader));
+	w += sizeof(SnapshotHeader);
+
+	for (uint32_t i = 0; i < bodies.size(); i++) {
+		SnapshotBody record;
+		record.id = bodies[i]->get_self().get_id();
+		bodies[i]->save_snapshot(record.state);
+		memcpy(w, &record, sizeof(SnapshotBody));
+		w += sizeof(SnapshotBody);
+	}
+
+	for (uint32_t i = 0; i < pairs.size(); i++) {
+		uint32_t pair_size = pairs[i].constraint->get_snapshot_size();
+		memcpy(w, &pairs[i].key, sizeof(Constraint3DSW::Key));
+		w += sizeof(Constraint3DSW::Key);
+		memcpy(w, &pair_size, sizeof(uint32_t));
+		w += sizeof(uint32_t);
+		pairs[i].constraint->save_snapshot(w);
+		w += pair_size;
+	}
+
+	return snapshot;
+}
+
+void Space3DSW::restore_snapshot(const Vector<uint8_t> &p_snapshot) {
+	ERR_FAIL_COND_MSG(locked, "Can't restore a snapshot while the space is being stepped.");
+	ERR_FAIL_COND(p_snapshot.size() < (int)sizeof(SnapshotHeader));
+
+	const uint8_t *r = p_snapshot.ptr();
+	const uint8_t *end = r + p_snapshot.size();
+
+	SnapshotHeader header;
+	memcpy(&header, r, sizeof(SnapshotHeader));
+	r += sizeof(SnapshotHeader);
+	ERR_FAIL_COND_MSG(header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION || header.real_size != sizeof(real_t), "Invalid physics space snapshot.");
+	ERR_FAIL_COND(uint64_t(end - r) < uint64_t(header.body_count) * sizeof(SnapshotBody));
+
+	// Bodies added or removed since the snapshot was taken are left as they are.
+	LocalVector<Body3DSW *> bodies;
+	_get_sorted_bodies(bodies);
+	uint32_t body_index = 0;
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		SnapshotBody record;
+		memcpy(&record, r, sizeof(SnapshotBody));
+		r += sizeof(SnapshotBody);
+
+		while (body_index < bodies.size() && bodies[body_index]->get_self().get_id() < record.id) {
+			body_index++;
+		}
+		if (body_index < bodies.size() && bodies[body_index]->get_self().get_id() == record.id) {
+			bodies[body_index]->restore_snapshot(record.state);
+			body_index++;
+		}
+	}
+
+	// Create and remove pairs for the restored transforms, then give them back their contacts and overlaps.
+	// Pairs that weren't in the snapshot start over.
+	broadphase->update();
+
+	LocalVector<SnapshotPair> pairs;
+	_get_sorted_pairs(bodies, pairs);
+	uint32_t pair_index = 0;
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		ERR_FAIL_COND(uint64_t(end - r) < sizeof(Constraint3DSW::Key) + sizeof(uint32_t));
+		Constraint3DSW::Key key;
+		uint32_t pair_size;
+		memcpy(&key, r, sizeof(Constraint3DSW::Key));
+		r += sizeof(Constraint3DSW::Key);
+		memcpy(&pair_size, r, sizeof(uint32_t));
+		r += sizeof(uint32_t);
+		ERR_FAIL_COND(uint64_t(end - r) < pair_size);
+
+		while (pair_index < pairs.size() && pairs[pair_index].key < key) {
+			pairs[pair_index].constraint->load_snapshot(nullptr);
+			pair_index++;
+		}
+		if (pair_index < pairs.size() && pairs[pair_index].key == key) {
+			Constraint3DSW *constraint = pairs[pair_index].constraint;
+			constraint->load_snapshot(constraint->get_snapshot_size() == pair_size ? r : nullptr);
+			pair_index++;
+		}
+		r += pair_size;
+	}
+
+	for (; pair_index < pairs.size(); pair_index++) {
+		pairs[pair_index].constraint->load_snapshot(nullptr);
+	}
+}
+
 void Space3DSW::body_add_to_state_query_list(SelfList<Body3DSW> *p_body) {
 	state_query_list.add(p_body);
 }
@@ -1099,6 +1299,18 @@ const SelfList<Area3DSW>::List &Space3DSW::get_moved_area_list() const {
 	return area_moved_list;
 }
 
+void Space3DSW::soft_body_add_to_list(SelfList<SoftBody3DSW> *p_soft_body) {
+	soft_body_list.add(p_soft_body);
+}
+
+void Space3DSW::soft_body_remove_from_list(SelfList<SoftBody3DSW> *p_soft_body) {
+	soft_body_list.remove(p_soft_body);
+}
+
+const SelfList<SoftBody3DSW>::List &Space3DSW::get_soft_body_list() const {
+	return soft_body_list;
+}
+
 void Space3DSW::call_queries() {
 	while (state_query_list.first()) {
 		Body3DSW *b = state_query_list.first()->self();
@@ -39,16 +39,37 @@
 #include "collision_object_3d_sw.h"
 #include "core/config/project_settings.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/typedefs.h"
+#include "soft_body_3d_sw.h"
 
 class PhysicsDirectSpaceState3DSW : public PhysicsDirectSpaceState3D {
 	GDCLASS(PhysicsDirectSpaceState3DSW, PhysicsDirectSpaceState3D);
 
+	enum {
+		RAYS_PER_JOB = 64, // Batched ray queries larger than this are split in jobs for the physics thread pool.
+	};
+
+	struct RayBatch {
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		int ray_count = 0;
+		RayResult *results = nullptr;
+		const Set<RID> *exclude = nullptr;
+		uint32_t collision_mask = 0;
+		bool collide_with_bodies = true;
+		bool collide_with_areas = false;
+		int *job_hits = nullptr; // One count per job, summed once all jobs are done.
+	};
+
+	void _intersect_rays_job(uint32_t p_job, RayBatch *p_batch);
+
 public:
 	Space3DSW *space;
 
 	virtual int intersect_point(const Vector3 &p_point, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) override;
 	virtual bool intersect_ray(const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, bool p_pick_ray = false) override;
+	virtual int intersect_rays(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) override;
 	virtual int intersect_shape(const RID &p_shape, const Transform &p_xform, real_t p_margin, ShapeResult *r_results, int p_result_max, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) override;
 	virtual bool cast_motion(const RID &p_shape, const Transform &p_xform, const Vector3 &p_motion, real_t p_margin, real_t &p_closest_safe, real_t &p_closest_unsafe, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false, ShapeRestInfo *r_info = nullptr) override;
 	virtual bool collide_shape(RID p_shape, const Transform &p_shape_xform, real_t p_margin, Vector3 *r_results, int p_result_max, int &r_result_count, const Set<RID> &p_exclude = Set<RID>(), uint32_t p_collision_mask = 0xFFFFFFFF, bool p_collide_with_bodies = true, bool p_collide_with_areas = false) override;
@@ -66,6 +87,7 @@ public:
 		ELAPSED_TIME_SETUP_CONSTRAINTS,
 		ELAPSED_TIME_SOLVE_CONSTRAINTS,
 		ELAPSED_TIME_INTEGRATE_VELOCITIES,
+		ELAPSED_TIME_SOLVE_SOFT_BODIES,
 		ELAPSED_TIME_MAX
 
 	};
@@ -82,6 +104,7 @@ private:
 	SelfList<Body3DSW>::List state_query_list;
 	SelfList<Area3DSW>::List monitor_query_list;
 	SelfList<Area3DSW>::List area_moved_list;
+	SelfList<SoftBody3DSW>::List soft_body_list;
 
 	static void *_broadphase_pair(CollisionObject3DSW *A, int p_subindex_A, CollisionObject3DSW *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(CollisionObject3DSW *A, int p_subindex_A, CollisionObject3DSW *B, int p_subindex_B, void *p_data, void *p_self);
@@ -119,6 +142,37 @@ private:
 	Vector<Vector3> contact_debug;
 	int contact_debug_count;
 
+	bool deterministic = false;
+
+	// Snapshots hold the bodies, then the pairs with state, both sorted by ID so restoring is a merge.
+	enum {
+		SNAPSHOT_MAGIC = 0x33535047, // "GPS3"
+		SNAPSHOT_VERSION = 1,
+	};
+
+	struct SnapshotHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t real_size;
+		uint32_t body_count;
+		uint32_t pair_count;
+	};
+
+	struct SnapshotBody {
+		uint64_t id;
+		Body3DSW::Snapshot state;
+	};
+
+	struct SnapshotPair {
+		Constraint3DSW::Key key;
+		Constraint3DSW *constraint;
+
+		_FORCE_INLINE_ bool operator<(const SnapshotPair &p_pair) const { return key < p_pair.key; }
+	};
+
+	void _get_sorted_bodies(LocalVector<Body3DSW *> &r_bodies) const;
+	void _get_sorted_pairs(const LocalVector<Body3DSW *> &p_bodies, LocalVector<SnapshotPair> &r_pairs) const;
+
 	friend class PhysicsDirectSpaceState3DSW;
 
 	int _cull_aabb_for_body(Body3DSW *p_body, const AABB &p_aabb);
@@ -145,6 +199,10 @@ public:
 	void area_remove_from_moved_list(SelfList<Area3DSW> *p_area);
 	const SelfList<Area3DSW>::List &get_moved_area_list() const;
 
+	void soft_body_add_to_list(SelfList<SoftBody3DSW> *p_soft_body);
+	void soft_body_remove_from_list(SelfList<SoftBody3DSW> *p_soft_body);
+	const SelfList<SoftBody3DSW>::List &get_soft_body_list() const;
+
 	BroadPhase3DSW *get_broadphase();
 
 	void add_object(CollisionObject3DSW *p_object);
@@ -194,6 +252,13 @@ public:
 	void set_static_global_body(RID p_body) { static_global_body = p_body; }
 	RID get_static_global_body() { return static_global_body; }
 
+	// Deterministic spaces solve in an order that only depends on the simulation state, so restored snapshots replay the same.
+	void set_deterministic(bool p_enabled) { deterministic = p_enabled; }
+	bool is_deterministic() const { return deterministic; }
+
+	Vector<uint8_t> get_snapshot() const;
+	void restore_snapshot(const Vector<uint8_t> &p_snapshot);
+
 	void set_elapsed_time(ElapsedTime p_time, uint64_t p_msec) { elapsed_time[p_time] = p_msec; }
 	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
 
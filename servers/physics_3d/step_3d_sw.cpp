@@ -31,6 +31,7 @@
 #include "step_3d_sw.h"
 #include "joints_3d_sw.h"
 
+#include "core/debugger/cpu_profiler.h"
 #include "core/os/os.h"
 
 void Step3DSW::_populate_island(Body3DSW *p_body, Body3DSW **p_island, Constraint3DSW **p_constraint_island) {
@@ -38,45 +39,91 @@ void Step3DSW::_populate_island(Body3DSW *p_body, Body3DSW **p_island, Constrain
 	p_body->set_island_next(*p_island);
 	*p_island = p_body;
 
-	for (Map<Constraint3DSW *, int>::Element *E = p_body->get_constraint_map().front(); E; E = E->next()) {
-		Constraint3DSW *c = (Constraint3DSW *)E->key();
-		if (c->get_island_step() == _step) {
-			continue; //already processed
+	if (!deterministic) {
+		for (Map<Constraint3DSW *, int>::Element *E = p_body->get_constraint_map().front(); E; E = E->next()) {
+			_populate_island_constraint(E->key(), E->get(), p_island, p_constraint_island);
 		}
-		c->set_island_step(_step);
-		c->set_island_next(*p_constraint_island);
-		*p_constraint_island = c;
+		return;
+	}
 
-		for (int i = 0; i < c->get_body_count(); i++) {
-			if (i == E->get()) {
-				continue;
-			}
-			Body3DSW *b = c->get_body_ptr()[i];
-			if (b->get_island_step() == _step || b->get_mode() == PhysicsServer3D::BODY_MODE_STATIC || b->get_mode() == PhysicsServer3D::BODY_MODE_KINEMATIC) {
-				continue; //no go
-			}
-			_populate_island(c->get_body_ptr()[i], p_island, p_constraint_island);
+	// The constraint map is sorted by address, visit it by key instead so islands are always built the same way.
+	uint32_t from = sorted_constraints.size();
+	for (Map<Constraint3DSW *, int>::Element *E = p_body->get_constraint_map().front(); E; E = E->next()) {
+		SortedConstraint sc;
+		sc.key = E->key()->get_key();
+		sc.constraint = E->key();
+		sc.body_index = E->get();
+		sorted_constraints.push_back(sc);
+	}
+	uint32_t to = sorted_constraints.size();
+
+	SortArray<SortedConstraint> sorter;
+	sorter.sort(sorted_constraints.ptr() + from, to - from);
+
+	for (uint32_t i = from; i < to; i++) {
+		// Copied, the recursion may grow the stack.
+		SortedConstraint sc = sorted_constraints[i];
+		_populate_island_constraint(sc.constraint, sc.body_index, p_island, p_constraint_island);
+	}
+	sorted_constraints.resize(from);
+}
+
+void Step3DSW::_populate_island_constraint(Constraint3DSW *p_constraint, int p_body_index, Body3DSW **p_island, Constraint3DSW **p_constraint_island) {
+	Constraint3DSW *c = p_constraint;
+	if (c->get_island_step() == _step) {
+		return; //already processed
+	}
+	c->set_island_step(_step);
+	c->set_island_next(*p_constraint_island);
+	*p_constraint_island = c;
+	all_constraints.push_back(c);
+
+	for (int i = 0; i < c->get_body_count(); i++) {
+		if (i == p_body_index) {
+			continue;
+		}
+		Body3DSW *b = c->get_body_ptr()[i];
+		if (b->get_island_step() == _step || b->get_mode() == PhysicsServer3D::BODY_MODE_STATIC || b->get_mode() == PhysicsServer3D::BODY_MODE_KINEMATIC) {
+			continue; //no go
 		}
+		_populate_island(c->get_body_ptr()[i], p_island, p_constraint_island);
+	}
+}
+
+struct _BodyIDCompareStep3DSW {
+	_FORCE_INLINE_ bool operator()(const Body3DSW *p_a, const Body3DSW *p_b) const {
+		return p_a->get_self().get_id() < p_b->get_self().get_id();
+	}
+};
+
+struct _ConstraintKeyCompareStep3DSW {
+	_FORCE_INLINE_ bool operator()(const Constraint3DSW *p_a, const Constraint3DSW *p_b) const {
+		return p_a->get_key() < p_b->get_key();
 	}
+};
+
+void Step3DSW::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
+	all_constraints[p_constraint_index]->setup(delta);
 }
 
-void Step3DSW::_setup_island(Constraint3DSW *p_island, real_t p_delta) {
+void Step3DSW::_pre_solve_island(Constraint3DSW *p_island) {
 	Constraint3DSW *ci = p_island;
 	while (ci) {
-		ci->setup(p_delta);
-		//todo remove from island if process fails
+		ci->pre_solve(delta);
 		ci = ci->get_island_next();
 	}
 }
 
-void Step3DSW::_solve_island(Constraint3DSW *p_island, int p_iterations, real_t p_delta) {
+void Step3DSW::_solve_island(uint32_t p_island_index, void *p_userdata) {
+	Constraint3DSW *island = constraint_islands[p_island_index];
+
 	int at_priority = 1;
 
-	while (p_island) {
-		for (int i = 0; i < p_iterations; i++) {
-			Constraint3DSW *ci = p_island;
+	while (island) {
+		for (int i = 0; i < iterations; i++) {
+			Constraint3DSW *ci = island;
 			while (ci) {
-				ci->solve(p_delta);
+				ci->solve(delta);
 				ci = ci->get_island_next();
 			}
 		}
@@ -84,14 +131,14 @@ void Step3DSW::_solve_island(Constraint3DSW *p_island, int p_iterations, real_t
 		at_priority++;
 
 		{
-			Constraint3DSW *ci = p_island;
+			Constraint3DSW *ci = island;
 			Constraint3DSW *prev = nullptr;
 			while (ci) {
 				if (ci->get_priority() < at_priority) {
 					if (prev) {
 						prev->set_island_next(ci->get_island_next()); //remove
 					} else {
-						p_island = ci->get_island_next();
+						island = ci->get_island_next();
 					}
 				} else {
 					prev = ci;
@@ -104,7 +151,21 @@ void Step3DSW::_solve_island(Constraint3DSW *p_island, int p_iterations, real_t
 }
 
 void Step3DSW::_check_suspend(Body3DSW *p_island, real_t p_delta) {
+	// The island sleeps as a whole once it has been still for long enough, with a timer shared by its bodies.
+	// Stillness is tested on the island's average velocities, so bodies jittering a bit above the thresholds
+	// (as happens in stacks) don't keep it awake forever. Bodies clearly moving still keep it awake.
+	const Space3DSW *space = p_island->get_space();
+	real_t linear_threshold = space->get_body_linear_velocity_sleep_threshold();
+	real_t angular_threshold = space->get_body_angular_velocity_sleep_threshold();
+	real_t linear_threshold_sq = linear_threshold * linear_threshold;
+	real_t angular_threshold_sq = angular_threshold * angular_threshold;
+	real_t jitter_sq = ISLAND_SLEEP_JITTER_TOLERANCE * ISLAND_SLEEP_JITTER_TOLERANCE;
+
 	bool can_sleep = true;
+	int body_count = 0;
+	real_t linear_sum = 0;
+	real_t angular_sum = 0;
+	real_t still_time = 0;
 
 	Body3DSW *b = p_island;
 	while (b) {
@@ -113,14 +174,36 @@ void Step3DSW::_check_suspend(Body3DSW *p_island, real_t p_delta) {
 			continue; //ignore for static
 		}
 
-		if (!b->sleep_test(p_delta)) {
+		if (!b->sleep_test()) {
+			can_sleep = false;
+		}
+
+		real_t linear_sq = b->get_linear_velocity().length_squared();
+		real_t angular_sq = b->get_angular_velocity().length_squared();
+		if (linear_sq > linear_threshold_sq * jitter_sq || angular_sq > angular_threshold_sq * jitter_sq) {
 			can_sleep = false;
 		}
 
+		linear_sum += linear_sq;
+		angular_sum += angular_sq;
+		still_time = body_count == 0 ? b->get_still_time() : MIN(still_time, b->get_still_time());
+		body_count++;
+
 		b = b->get_island_next();
 	}
 
-	//put all to sleep or wake up everyoen
+	if (body_count == 0) {
+		return;
+	}
+
+	if (linear_sum > linear_threshold_sq * body_count || angular_sum > angular_threshold_sq * body_count) {
+		can_sleep = false;
+	}
+
+	still_time = can_sleep ? still_time + p_delta : 0;
+	can_sleep = can_sleep && still_time > space->get_body_time_to_sleep();
+
+	//put all to sleep or wake up everyone
 
 	b = p_island;
 	while (b) {
@@ -134,16 +217,25 @@ void Step3DSW::_check_suspend(Body3DSW *p_island, real_t p_delta) {
 		if (active == can_sleep) {
 			b->set_active(!can_sleep);
 		}
+		b->set_still_time(still_time);
 
 		b = b->get_island_next();
 	}
 }
 
 void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
+	CPU_PROFILE_SCOPE("Step3DSW::step");
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
 
+	iterations = p_iterations;
+	delta = p_delta;
+	deterministic = p_space->is_deterministic();
+
+	all_constraints.clear();
+	constraint_islands.clear();
+
 	const SelfList<Body3DSW>::List *body_list = &p_space->get_active_body_list();
 
 	/* INTEGRATE FORCES */
@@ -171,13 +263,20 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 	/* GENERATE CONSTRAINT ISLANDS */
 
 	Body3DSW *island_list = nullptr;
-	Constraint3DSW *constraint_island_list = nullptr;
-	b = body_list->first();
 
 	int island_count = 0;
 
-	while (b) {
-		Body3DSW *body = b->self();
+	// The active list is in activation order, which restored snapshots don't reproduce.
+	island_roots.clear();
+	for (b = body_list->first(); b; b = b->next()) {
+		island_roots.push_back(b->self());
+	}
+	if (deterministic) {
+		island_roots.sort_custom<_BodyIDCompareStep3DSW>();
+	}
+
+	for (uint32_t i = 0; i < island_roots.size(); i++) {
+		Body3DSW *body = island_roots[i];
 
 		if (body->get_island_step() != _step) {
 			Body3DSW *island = nullptr;
@@ -188,16 +287,15 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 			island_list = island;
 
 			if (constraint_island) {
-				constraint_island->set_island_list_next(constraint_island_list);
-				constraint_island_list = constraint_island;
+				constraint_islands.push_back(constraint_island);
 				island_count++;
 			}
 		}
-		b = b->next();
 	}
 
 	p_space->set_island_count(island_count);
 
+	uint32_t area_constraints_from = constraint_islands.size();
 	const SelfList<Area3DSW>::List &aml = p_space->get_moved_area_list();
 
 	while (aml.first()) {
@@ -208,26 +306,33 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 			}
 			c->set_island_step(_step);
 			c->set_island_next(nullptr);
-			c->set_island_list_next(constraint_island_list);
-			constraint_island_list = c;
+			constraint_islands.push_back(c);
+			all_constraints.push_back(c);
 		}
 		p_space->area_remove_from_moved_list((SelfList<Area3DSW> *)aml.first()); //faster to remove here
 	}
 
+	if (deterministic) {
+		// Pre-solved in this order, which decides how overlapping areas are sorted in bodies.
+		SortArray<Constraint3DSW *, _ConstraintKeyCompareStep3DSW> sorter;
+		sorter.sort(constraint_islands.ptr() + area_constraints_from, constraint_islands.size() - area_constraints_from);
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(Space3DSW::ELAPSED_TIME_GENERATE_ISLANDS, profile_endtime - profile_begtime);
 		profile_begtime = profile_endtime;
 	}
 
-	/* SETUP CONSTRAINT ISLANDS */
+	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
-	{
-		Constraint3DSW *ci = constraint_island_list;
-		while (ci) {
-			_setup_island(ci, p_delta);
-			ci = ci->get_island_list_next();
-		}
+	work_pool.do_work(all_constraints.size(), this, &Step3DSW::_setup_constraint, nullptr);
+
+	/* PRE-SOLVE CONSTRAINT ISLANDS */
+
+	// Not threaded, this is where constraints update state shared between islands.
+	for (uint32_t i = 0; i < constraint_islands.size(); i++) {
+		_pre_solve_island(constraint_islands[i]);
 	}
 
 	{ //profile
@@ -238,14 +343,9 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
-	{
-		Constraint3DSW *ci = constraint_island_list;
-		while (ci) {
-			//iterating each island separatedly improves cache efficiency
-			_solve_island(ci, p_iterations, p_delta);
-			ci = ci->get_island_list_next();
-		}
-	}
+	// Islands don't share dynamic bodies, so they can be solved in parallel.
+	// Iterating each island separately also improves cache efficiency.
+	work_pool.do_work(constraint_islands.size(), this, &Step3DSW::_solve_island, nullptr);
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -278,11 +378,46 @@ void Step3DSW::step(Space3DSW *p_space, real_t p_delta, int p_iterations) {
 		profile_begtime = profile_endtime;
 	}
 
+	/* SOFT BODIES */
+
+	// Collect the colliders serially (the broadphase isn't thread safe), then solve each soft body
+	// on its own thread. A lone soft body splits its link colors across the pool instead.
+	soft_bodies.clear();
+	const SelfList<SoftBody3DSW>::List &soft_body_list = p_space->get_soft_body_list();
+	for (const SelfList<SoftBody3DSW> *sb = soft_body_list.first(); sb; sb = sb->next()) {
+		if (sb->self()->has_mesh()) {
+			sb->self()->predict_motion(p_delta);
+			soft_bodies.push_back(sb->self());
+		}
+	}
+
+	if (soft_bodies.size() == 1) {
+		soft_bodies[0]->solve_constraints(p_delta, &work_pool);
+	} else if (soft_bodies.size() > 1) {
+		work_pool.do_work(soft_bodies.size(), this, &Step3DSW::_solve_soft_body, nullptr);
+	}
+
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(Space3DSW::ELAPSED_TIME_SOLVE_SOFT_BODIES, profile_endtime - profile_begtime);
+		profile_begtime = profile_endtime;
+	}
+
 	p_space->update();
 	p_space->unlock();
 	_step++;
 }
 
+void Step3DSW::_solve_soft_body(uint32_t p_soft_body_index, void *p_userdata) {
+	soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 Step3DSW::Step3DSW() {
 	_step = 1;
+
+	work_pool.init();
+}
+
+Step3DSW::~Step3DSW() {
+	work_pool.finish();
 }
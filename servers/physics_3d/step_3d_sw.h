@@ -33,17 +33,49 @@
 
 #include "space_3d_sw.h"
 
+#include "core/templates/local_vector.h"
+#include "core/templates/thread_work_pool.h"
+
 class Step3DSW {
 	uint64_t _step;
 
+	enum {
+		ISLAND_SLEEP_JITTER_TOLERANCE = 2 // Bodies of a sleeping island may move up to this many times the sleep thresholds, as long as the island's average doesn't.
+	};
+
+	int iterations = 0;
+	real_t delta = 0.0;
+	bool deterministic = false;
+
+	struct SortedConstraint {
+		Constraint3DSW::Key key;
+		Constraint3DSW *constraint;
+		int body_index;
+
+		_FORCE_INLINE_ bool operator<(const SortedConstraint &p_constraint) const { return key < p_constraint.key; }
+	};
+
+	ThreadWorkPool work_pool;
+
+	LocalVector<Constraint3DSW *> all_constraints;
+	LocalVector<Constraint3DSW *> constraint_islands;
+	LocalVector<Body3DSW *> island_roots;
+	LocalVector<SortedConstraint> sorted_constraints; // Stack of the constraints of the bodies being populated, in deterministic spaces.
+	LocalVector<SoftBody3DSW *> soft_bodies;
+
 	void _populate_island(Body3DSW *p_body, Body3DSW **p_island, Constraint3DSW **p_constraint_island);
-	void _setup_island(Constraint3DSW *p_island, real_t p_delta);
-	void _solve_island(Constraint3DSW *p_island, int p_iterations, real_t p_delta);
+	void _populate_island_constraint(Constraint3DSW *p_constraint, int p_body_index, Body3DSW **p_island, Constraint3DSW **p_constraint_island);
+	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _pre_solve_island(Constraint3DSW *p_island);
+	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
 	void _check_suspend(Body3DSW *p_island, real_t p_delta);
+	void _solve_soft_body(uint32_t p_soft_body_index, void *p_userdata = nullptr);
 
 public:
 	void step(Space3DSW *p_space, real_t p_delta, int p_iterations);
+	ThreadWorkPool &get_work_pool() { return work_pool; } // Idle between steps, used by batched queries.
 	Step3DSW();
+	~Step3DSW();
 };
 
 #endif // STEP__SW_H
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/string/print_string.h"
+#include "core/templates/small_vector.h"
 
 PhysicsServer2D *PhysicsServer2D::singleton = nullptr;
 
@@ -290,9 +291,9 @@ Dictionary PhysicsDirectSpaceState2D::_intersect_ray(const Vector2 &p_from, cons
 Array PhysicsDirectSpaceState2D::_intersect_shape(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, int p_max_results) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Array());
 
-	Vector<ShapeResult> sr;
-	sr.resize(p_max_results);
-	int rc = intersect_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->motion, p_shape_query->margin, sr.ptrw(), sr.size(), p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
+	SmallVector<ShapeResult, 32> sr;
+	sr.resize(MAX(p_max_results, 0));
+	int rc = intersect_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->motion, p_shape_query->margin, sr.ptr(), sr.size(), p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
 	Array ret;
 	ret.resize(rc);
 	for (int i = 0; i < rc; i++) {
@@ -329,14 +330,14 @@ Array PhysicsDirectSpaceState2D::_intersect_point_impl(const Vector2 &p_point, i
 		exclude.insert(p_exclude[i]);
 	}
 
-	Vector<ShapeResult> ret;
-	ret.resize(p_max_results);
+	SmallVector<ShapeResult, 32> ret;
+	ret.resize(MAX(p_max_results, 0));
 
 	int rc;
 	if (p_filter_by_canvas) {
-		rc = intersect_point(p_point, ret.ptrw(), ret.size(), exclude, p_layers, p_collide_with_bodies, p_collide_with_areas);
+		rc = intersect_point(p_point, ret.ptr(), ret.size(), exclude, p_layers, p_collide_with_bodies, p_collide_with_areas);
 	} else {
-		rc = intersect_point_on_canvas(p_point, p_canvas_instance_id, ret.ptrw(), ret.size(), exclude, p_layers, p_collide_with_bodies, p_collide_with_areas);
+		rc = intersect_point_on_canvas(p_point, p_canvas_instance_id, ret.ptr(), ret.size(), exclude, p_layers, p_collide_with_bodies, p_collide_with_areas);
 	}
 
 	if (rc == 0) {
@@ -368,10 +369,10 @@ Array PhysicsDirectSpaceState2D::_intersect_point_on_canvas(const Vector2 &p_poi
 Array PhysicsDirectSpaceState2D::_collide_shape(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, int p_max_results) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Array());
 
-	Vector<Vector2> ret;
-	ret.resize(p_max_results * 2);
+	SmallVector<Vector2, 64> ret;
+	ret.resize(MAX(p_max_results, 0) * 2);
 	int rc = 0;
-	bool res = collide_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->motion, p_shape_query->margin, ret.ptrw(), p_max_results, rc, p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
+	bool res = collide_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->motion, p_shape_query->margin, ret.ptr(), p_max_results, rc, p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
 	if (!res) {
 		return Array();
 	}
@@ -546,6 +547,10 @@ void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer2D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer2D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer2D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_set_deterministic", "space", "enabled"), &PhysicsServer2D::space_set_deterministic);
+	ClassDB::bind_method(D_METHOD("space_is_deterministic", "space"), &PhysicsServer2D::space_is_deterministic);
+	ClassDB::bind_method(D_METHOD("space_get_snapshot", "space"), &PhysicsServer2D::space_get_snapshot);
+	ClassDB::bind_method(D_METHOD("space_restore_snapshot", "space", "snapshot"), &PhysicsServer2D::space_restore_snapshot);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer2D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer2D::area_set_space);
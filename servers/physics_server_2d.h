@@ -296,6 +296,12 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Snapshots of the simulation state, for rollback. Deterministic spaces replay restored snapshots exactly.
+	virtual void space_set_deterministic(RID p_space, bool p_enabled) = 0;
+	virtual bool space_is_deterministic(RID p_space) const = 0;
+	virtual Vector<uint8_t> space_get_snapshot(RID p_space) const = 0;
+	virtual void space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
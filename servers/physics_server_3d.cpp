@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/string/print_string.h"
+#include "core/templates/small_vector.h"
 
 PhysicsServer3D *PhysicsServer3D::singleton = nullptr;
 
@@ -280,12 +281,67 @@ Dictionary PhysicsDirectSpaceState3D::_intersect_ray(const Vector3 &p_from, cons
 	return d;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(const PackedVector3Array &p_origins, const PackedVector3Array &p_directions, const Vector<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
+	ERR_FAIL_COND_V(p_origins.size() != p_directions.size(), Dictionary());
+
+	int ray_count = p_origins.size();
+
+	Set<RID> exclude;
+	for (int i = 0; i < p_exclude.size(); i++) {
+		exclude.insert(p_exclude[i]);
+	}
+
+	Vector<Vector3> to;
+	to.resize(ray_count);
+	{
+		const Vector3 *origins = p_origins.ptr();
+		const Vector3 *directions = p_directions.ptr();
+		Vector3 *tow = to.ptrw();
+		for (int i = 0; i < ray_count; i++) {
+			tow[i] = origins[i] + directions[i];
+		}
+	}
+
+	Vector<RayResult> results;
+	results.resize(ray_count);
+	intersect_rays(p_origins.ptr(), to.ptr(), ray_count, results.ptrw(), exclude, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
+
+	PackedVector3Array positions;
+	PackedVector3Array normals;
+	PackedInt64Array collider_ids;
+	PackedInt32Array shapes;
+	positions.resize(ray_count);
+	normals.resize(ray_count);
+	collider_ids.resize(ray_count);
+	shapes.resize(ray_count);
+	{
+		Vector3 *positionsw = positions.ptrw();
+		Vector3 *normalsw = normals.ptrw();
+		int64_t *collider_idsw = collider_ids.ptrw();
+		int32_t *shapesw = shapes.ptrw();
+		for (int i = 0; i < ray_count; i++) {
+			positionsw[i] = results[i].position;
+			normalsw[i] = results[i].normal;
+			collider_idsw[i] = int64_t(results[i].collider_id);
+			shapesw[i] = results[i].shape;
+		}
+	}
+
+	Dictionary d;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+
+	return d;
+}
+
 Array PhysicsDirectSpaceState3D::_intersect_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Array());
 
-	Vector<ShapeResult> sr;
-	sr.resize(p_max_results);
-	int rc = intersect_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->margin, sr.ptrw(), sr.size(), p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
+	SmallVector<ShapeResult, 32> sr;
+	sr.resize(MAX(p_max_results, 0));
+	int rc = intersect_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->margin, sr.ptr(), sr.size(), p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
 	Array ret;
 	ret.resize(rc);
 	for (int i = 0; i < rc; i++) {
@@ -318,10 +374,10 @@ Array PhysicsDirectSpaceState3D::_cast_motion(const Ref<PhysicsShapeQueryParamet
 Array PhysicsDirectSpaceState3D::_collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Array());
 
-	Vector<Vector3> ret;
-	ret.resize(p_max_results * 2);
+	SmallVector<Vector3, 64> ret;
+	ret.resize(MAX(p_max_results, 0) * 2);
 	int rc = 0;
-	bool res = collide_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->margin, ret.ptrw(), p_max_results, rc, p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
+	bool res = collide_shape(p_shape_query->shape, p_shape_query->transform, p_shape_query->margin, ret.ptr(), p_max_results, rc, p_shape_query->exclude, p_shape_query->collision_mask, p_shape_query->collide_with_bodies, p_shape_query->collide_with_areas);
 	if (!res) {
 		return Array();
 	}
@@ -354,11 +410,24 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+int PhysicsDirectSpaceState3D::intersect_rays(const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, const Set<RID> &p_exclude, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
+	int hits = 0;
+	for (int i = 0; i < p_ray_count; i++) {
+		if (intersect_ray(p_from[i], p_to[i], r_results[i], p_exclude, p_collision_mask, p_collide_with_bodies, p_collide_with_areas)) {
+			hits++;
+		} else {
+			r_results[i] = RayResult();
+		}
+	}
+	return hits;
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
 void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_ray", "from", "to", "exclude", "collision_mask", "collide_with_bodies", "collide_with_areas"), &PhysicsDirectSpaceState3D::_intersect_ray, DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("intersect_rays", "origins", "directions", "exclude", "collision_mask", "collide_with_bodies", "collide_with_areas"), &PhysicsDirectSpaceState3D::_intersect_rays, DEFVAL(Array()), DEFVAL(0x7FFFFFFF), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("intersect_shape", "shape", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "shape", "motion"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "shape", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
@@ -450,6 +519,10 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_set_deterministic", "space", "enabled"), &PhysicsServer3D::space_set_deterministic);
+	ClassDB::bind_method(D_METHOD("space_is_deterministic", "space"), &PhysicsServer3D::space_is_deterministic);
+	ClassDB::bind_method(D_METHOD("space_get_snapshot", "space"), &PhysicsServer3D::space_get_snapshot);
+	ClassDB::bind_method(D_METHOD("space_restore_snapshot", "space", "snapshot"), &PhysicsServer3D::space_restore_snapshot);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -104,6 +104,61 @@ void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner, RID_PtrOwner<Rende
 	} while (ysort_owner && ysort_owner->sort_y);
 }
 
+void _mark_subtree_rect_dirty(RendererCanvasCull::Item *p_canvas_item, RID_PtrOwner<RendererCanvasCull::Item, true> &canvas_item_owner) {
+	p_canvas_item->subtree_rect_dirty = true;
+	RendererCanvasCull::Item *parent = canvas_item_owner.owns(p_canvas_item->parent) ? canvas_item_owner.getornull(p_canvas_item->parent) : nullptr;
+	// Stop at the first ancestor already marked, everything above it is dirty too.
+	while (parent && !parent->subtree_rect_dirty) {
+		parent->subtree_rect_dirty = true;
+		parent = canvas_item_owner.owns(parent->parent) ? canvas_item_owner.getornull(parent->parent) : nullptr;
+	}
+}
+
+void _update_subtree_rect(RendererCanvasCull::Item *p_canvas_item) {
+	if (!p_canvas_item->subtree_rect_dirty) {
+		return;
+	}
+
+	RendererCanvasCull::Item *ci = p_canvas_item;
+	ci->subtree_rect = ci->get_rect();
+	ci->subtree_has_content = ci->commands != nullptr;
+	// Items whose bounds can change without going through the server API (meshes, particles, skeletons)
+	// or that must run even while off screen can't be skipped.
+	ci->subtree_cullable = !ci->update_when_visible && !ci->vp_render && !ci->copy_back_buffer && !ci->canvas_group && !ci->skeleton.is_valid();
+
+	for (const RendererCanvasRender::Item::Command *c = ci->commands; c && ci->subtree_cullable; c = c->next) {
+		if (c->type == RendererCanvasRender::Item::Command::TYPE_MESH || c->type == RendererCanvasRender::Item::Command::TYPE_MULTIMESH || c->type == RendererCanvasRender::Item::Command::TYPE_PARTICLES) {
+			ci->subtree_cullable = false;
+		}
+	}
+
+	int child_item_count = ci->child_items.size();
+	RendererCanvasCull::Item **child_items = ci->child_items.ptrw();
+	for (int i = 0; i < child_item_count; i++) {
+		RendererCanvasCull::Item *child = child_items[i];
+		if (!child->visible) {
+			continue;
+		}
+		_update_subtree_rect(child);
+		if (!child->subtree_cullable) {
+			ci->subtree_cullable = false;
+		}
+		if (!child->subtree_has_content) {
+			continue;
+		}
+		// Grow by one pixel per level to account for transform snapping.
+		Rect2 child_rect = child->xform.xform(child->subtree_rect).grow(1);
+		if (ci->subtree_has_content) {
+			ci->subtree_rect = ci->subtree_rect.merge(child_rect);
+		} else {
+			ci->subtree_rect = child_rect;
+			ci->subtree_has_content = true;
+		}
+	}
+
+	ci->subtree_rect_dirty = false;
+}
+
 void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **z_list, RendererCanvasRender::Item **z_last_list, Item *p_canvas_clip, Item *p_material_owner) {
 	Item *ci = p_canvas_item;
 
@@ -123,6 +178,18 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	}
 	xform = p_transform * xform;
 
+	_update_subtree_rect(ci);
+	if (ci->subtree_cullable) {
+		if (!ci->subtree_has_content) {
+			return;
+		}
+		Rect2 subtree_global_rect = xform.xform(ci->subtree_rect);
+		subtree_global_rect.position += p_clip_rect.position;
+		if (!subtree_global_rect.intersects(p_clip_rect, true)) {
+			return;
+		}
+	}
+
 	Rect2 global_rect = xform.xform(rect);
 	global_rect.position += p_clip_rect.position;
 
@@ -416,6 +483,7 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner, canvas_item_owner);
 			}
+			_mark_subtree_rect_dirty(item_owner, canvas_item_owner);
 		}
 
 		canvas_item->parent = RID();
@@ -436,6 +504,7 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner, canvas_item_owner);
 			}
+			_mark_subtree_rect_dirty(item_owner, canvas_item_owner);
 
 		} else {
 			ERR_FAIL_MSG("Invalid parent.");
@@ -449,6 +518,8 @@ void RendererCanvasCull::canvas_item_set_visible(RID p_item, bool p_visible) {
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	canvas_item->visible = p_visible;
 
 	_mark_ysort_dirty(canvas_item, canvas_item_owner);
@@ -465,6 +536,8 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	canvas_item->xform = p_transform;
 }
 
@@ -486,6 +559,8 @@ void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_r
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
 }
@@ -515,6 +590,8 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	canvas_item->update_when_visible = p_update;
 }
 
@@ -522,6 +599,8 @@ void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from,
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandPrimitive *line = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_COND(!line);
 	if (p_width > 1.001) {
@@ -546,6 +625,8 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Color color = Color(1, 1, 1, 1);
 
 	Vector<int> indices;
@@ -685,6 +766,8 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandPolygon *pline = canvas_item->alloc_command<Item::CommandPolygon>();
 	ERR_FAIL_COND(!pline);
 
@@ -701,6 +784,8 @@ void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_COND(!rect);
 	rect->modulate = p_color;
@@ -711,6 +796,8 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandPolygon *circle = canvas_item->alloc_command<Item::CommandPolygon>();
 	ERR_FAIL_COND(!circle);
 
@@ -747,6 +834,8 @@ void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_COND(!rect);
 	rect->modulate = p_modulate;
@@ -778,6 +867,8 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_COND(!rect);
 	rect->modulate = p_modulate;
@@ -819,6 +910,8 @@ void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_r
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>();
 	ERR_FAIL_COND(!style);
 
@@ -843,6 +936,8 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_COND(!prim);
 
@@ -868,6 +963,8 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
 #ifdef DEBUG_ENABLED
 	int pointcount = p_points.size();
 	ERR_FAIL_COND(pointcount < 3);
@@ -890,6 +987,8 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	int vertex_count = p_points.size();
 	ERR_FAIL_COND(vertex_count == 0);
 	ERR_FAIL_COND(!p_colors.is_empty() && p_colors.size() != vertex_count && p_colors.size() != 1);
@@ -913,6 +1012,8 @@ void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transfo
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>();
 	ERR_FAIL_COND(!tr);
 	tr->xform = p_transform;
@@ -922,6 +1023,8 @@ void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>();
 	ERR_FAIL_COND(!m);
 	m->mesh = p_mesh;
@@ -936,6 +1039,8 @@ void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles,
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>();
 	ERR_FAIL_COND(!part);
 	part->particles = p_particles;
@@ -950,6 +1055,8 @@ void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>();
 	ERR_FAIL_COND(!mm);
 	mm->multimesh = p_mesh;
@@ -961,6 +1068,8 @@ void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore)
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	Item::CommandClipIgnore *ci = canvas_item->alloc_command<Item::CommandClipIgnore>();
 	ERR_FAIL_COND(!ci);
 	ci->ignore = p_ignore;
@@ -995,12 +1104,17 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	canvas_item->skeleton = p_skeleton;
 }
 
 void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_enable, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
+
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	if (p_enable && (canvas_item->copy_back_buffer == nullptr)) {
 		canvas_item->copy_back_buffer = memnew(RendererCanvasRender::Item::CopyBackBuffer);
 	}
@@ -1019,6 +1133,8 @@ void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	canvas_item->clear();
 }
 
@@ -1059,6 +1175,8 @@ void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::Canva
 	Item *canvas_item = canvas_item_owner.getornull(p_item);
 	ERR_FAIL_COND(!canvas_item);
 
+	_mark_subtree_rect_dirty(canvas_item, canvas_item_owner);
+
 	if (p_mode == RS::CANVAS_GROUP_MODE_DISABLED) {
 		if (canvas_item->canvas_group != nullptr) {
 			memdelete(canvas_item->canvas_group);
@@ -1484,6 +1602,7 @@ bool RendererCanvasCull::free(RID p_rid) {
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner, canvas_item_owner);
 				}
+				_mark_subtree_rect_dirty(item_owner, canvas_item_owner);
 			}
 		}
 
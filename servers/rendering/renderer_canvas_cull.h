@@ -53,6 +53,12 @@ public:
 		Vector2 ysort_pos;
 		int ysort_index;
 
+		// Local space bounds of this item and all its visible descendants, used to skip whole subtrees when culling.
+		Rect2 subtree_rect;
+		bool subtree_rect_dirty;
+		bool subtree_has_content;
+		bool subtree_cullable; // False when something in the subtree must be visited even if off screen.
+
 		Vector<Item *> child_items;
 
 		Item() {
@@ -69,6 +75,9 @@ public:
 			ysort_xform = Transform2D();
 			ysort_pos = Vector2();
 			ysort_index = 0;
+			subtree_rect_dirty = true;
+			subtree_has_content = false;
+			subtree_cullable = false;
 		}
 	};
 
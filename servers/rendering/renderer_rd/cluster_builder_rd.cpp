@@ -269,7 +269,7 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 	cluster_render_buffer = RD::get_singleton()->storage_buffer_create(cluster_render_buffer_size);
 	cluster_buffer = RD::get_singleton()->storage_buffer_create(cluster_buffer_size);
 
-	render_elements = (RenderElementData *)memalloc(sizeof(RenderElementData *) * render_element_max);
+	render_elements = (RenderElementData *)memalloc(sizeof(RenderElementData) * render_element_max);
 	render_element_count = 0;
 
 	element_buffer = RD::get_singleton()->storage_buffer_create(sizeof(RenderElementData) * render_element_max);
@@ -406,8 +406,12 @@ void ClusterBuilderRD::bake_cluster() {
 	RD::get_singleton()->buffer_clear(cluster_buffer, 0, cluster_buffer_size, RD::BARRIER_MASK_RASTER | RD::BARRIER_MASK_COMPUTE);
 
 	if (render_element_count > 0) {
+		//the render buffer is laid out for the elements used this frame, not the maximum, so clearing and packing it scales with the element count
+		uint32_t element_count_aligned = ((render_element_count - 1) / 32 + 1) * 32;
+		uint32_t cluster_render_data_size = element_count_aligned / 32 + element_count_aligned;
+
 		//clear render buffer
-		RD::get_singleton()->buffer_clear(cluster_render_buffer, 0, cluster_render_buffer_size, RD::BARRIER_MASK_RASTER);
+		RD::get_singleton()->buffer_clear(cluster_render_buffer, 0, cluster_screen_size.x * cluster_screen_size.y * cluster_render_data_size * 4, RD::BARRIER_MASK_RASTER);
 
 		{ //fill state uniform
 
@@ -419,8 +423,8 @@ void ClusterBuilderRD::bake_cluster() {
 			state.screen_to_clusters_shift -= divisor; //screen is smaller, shift one less
 
 			state.cluster_screen_width = cluster_screen_size.x;
-			state.cluster_depth_offset = (render_element_max / 32);
-			state.cluster_data_size = state.cluster_depth_offset + render_element_max;
+			state.cluster_depth_offset = element_count_aligned / 32;
+			state.cluster_data_size = cluster_render_data_size;
 
 			RD::get_singleton()->buffer_update(state_uniform, 0, sizeof(StateUniform), &state, RD::BARRIER_MASK_RASTER | RD::BARRIER_MASK_COMPUTE);
 		}
@@ -459,15 +463,15 @@ void ClusterBuilderRD::bake_cluster() {
 
 				RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(ClusterBuilderSharedDataRD::ClusterRender::PushConstant));
 
+				//elements are added grouped by type, so each group is drawn as a single instanced draw
 				uint32_t instances = 1;
-#if 0
-				for (uint32_t j = i+1; j < element_count; j++) {
-					if (elements[i].type!=elements[j].type) {
+				for (uint32_t j = i + 1; j < render_element_count; j++) {
+					if (render_elements[i].type != render_elements[j].type) {
 						break;
 					}
 					instances++;
 				}
-#endif
+
 				RD::get_singleton()->draw_list_draw(draw_list, true, instances);
 				i += instances;
 			}
@@ -482,8 +486,8 @@ void ClusterBuilderRD::bake_cluster() {
 			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, cluster_store_uniform_set, 0);
 
 			ClusterBuilderSharedDataRD::ClusterStore::PushConstant push_constant;
-			push_constant.cluster_render_data_size = render_element_max / 32 + render_element_max;
-			push_constant.max_render_element_count_div_32 = render_element_max / 32;
+			push_constant.cluster_render_data_size = cluster_render_data_size;
+			push_constant.max_render_element_count_div_32 = element_count_aligned / 32;
 			push_constant.cluster_screen_size[0] = cluster_screen_size.x;
 			push_constant.cluster_screen_size[1] = cluster_screen_size.y;
 			push_constant.render_element_count_div_32 = render_element_count > 0 ? (render_element_count - 1) / 32 + 1 : 0;
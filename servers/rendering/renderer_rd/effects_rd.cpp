@@ -463,7 +463,7 @@ void EffectsRD::gaussian_glow(RID p_source_rd_texture, RID p_back_texture, const
 	RD::get_singleton()->compute_list_end();
 }
 
-void EffectsRD::screen_space_reflection(RID p_diffuse, RID p_normal_roughness, RenderingServer::EnvironmentSSRRoughnessQuality p_roughness_quality, RID p_blur_radius, RID p_blur_radius2, RID p_metallic, const Color &p_metallic_mask, RID p_depth, RID p_scale_depth, RID p_scale_normal, RID p_output, RID p_output_blur, const Size2i &p_screen_size, int p_max_steps, float p_fade_in, float p_fade_out, float p_tolerance, const CameraMatrix &p_camera) {
+void EffectsRD::screen_space_reflection(RID p_diffuse, RID p_normal_roughness, RenderingServer::EnvironmentSSRRoughnessQuality p_roughness_quality, RID p_blur_radius, RID p_blur_radius2, RID p_metallic, const Color &p_metallic_mask, RID p_depth, RID p_scale_depth, RID p_scale_normal, RID p_output, RID p_output_blur, const Size2i &p_screen_size, int p_max_steps, float p_fade_in, float p_fade_out, float p_tolerance, const CameraMatrix &p_camera, uint32_t p_barrier) {
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
 	{ //scale color and depth to half
@@ -580,7 +580,7 @@ void EffectsRD::screen_space_reflection(RID p_diffuse, RID p_normal_roughness, R
 		RD::get_singleton()->compute_list_dispatch_threads(compute_list, p_screen_size.width, p_screen_size.height, 1);
 	}
 
-	RD::get_singleton()->compute_list_end();
+	RD::get_singleton()->compute_list_end(p_barrier);
 }
 
 void EffectsRD::sub_surface_scattering(RID p_diffuse, RID p_diffuse2, RID p_depth, const CameraMatrix &p_camera, const Size2i &p_screen_size, float p_scale, float p_depth_scale, RenderingServer::SubSurfaceScatteringQuality p_quality) {
@@ -626,7 +626,7 @@ void EffectsRD::sub_surface_scattering(RID p_diffuse, RID p_diffuse2, RID p_dept
 	}
 }
 
-void EffectsRD::merge_specular(RID p_dest_framebuffer, RID p_specular, RID p_base, RID p_reflection) {
+void EffectsRD::merge_specular(RID p_dest_framebuffer, RID p_specular, RID p_base, RID p_reflection, uint32_t p_barrier) {
 	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(p_dest_framebuffer, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD, Vector<Color>());
 
 	if (p_reflection.is_valid()) {
@@ -653,7 +653,7 @@ void EffectsRD::merge_specular(RID p_dest_framebuffer, RID p_specular, RID p_bas
 
 	RD::get_singleton()->draw_list_bind_index_array(draw_list, index_array);
 	RD::get_singleton()->draw_list_draw(draw_list, true);
-	RD::get_singleton()->draw_list_end();
+	RD::get_singleton()->draw_list_end(p_barrier);
 }
 
 void EffectsRD::make_mipmap(RID p_source_rd_texture, RID p_dest_texture, const Size2i &p_size) {
@@ -1423,9 +1423,10 @@ void EffectsRD::resolve_gi(RID p_source_depth, RID p_source_normal_roughness, RI
 	RD::get_singleton()->compute_list_end(p_barrier);
 }
 
-void EffectsRD::sort_buffer(RID p_uniform_set, int p_size) {
-	Sort::PushConstant push_constant;
-	push_constant.total_elements = p_size;
+void EffectsRD::_add_sort_steps(int p_size, LocalVector<Sort::Step> &r_steps) {
+	//bitonic sort, each step must wait for the previous one to finish
+	Sort::Step step;
+	step.push_constant.total_elements = p_size;
 
 	bool done = true;
 
@@ -1435,20 +1436,14 @@ void EffectsRD::sort_buffer(RID p_uniform_set, int p_size) {
 		done = false;
 	}
 
-	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
-
-	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, sort.pipelines[SORT_MODE_BLOCK]);
-	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, p_uniform_set, 1);
-	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(Sort::PushConstant));
-	RD::get_singleton()->compute_list_dispatch(compute_list, numThreadGroups, 1, 1);
+	step.mode = SORT_MODE_BLOCK;
+	step.groups = numThreadGroups;
+	r_steps.push_back(step);
 
 	int presorted = 512;
 
 	while (!done) {
-		RD::get_singleton()->compute_list_add_barrier(compute_list);
-
 		done = true;
-		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, sort.pipelines[SORT_MODE_STEP]);
 
 		numThreadGroups = 0;
 
@@ -1467,27 +1462,66 @@ void EffectsRD::sort_buffer(RID p_uniform_set, int p_size) {
 		unsigned int nMergeSize = presorted * 2;
 
 		for (unsigned int nMergeSubSize = nMergeSize >> 1; nMergeSubSize > 256; nMergeSubSize = nMergeSubSize >> 1) {
-			push_constant.job_params[0] = nMergeSubSize;
+			step.push_constant.job_params[0] = nMergeSubSize;
 			if (nMergeSubSize == nMergeSize >> 1) {
-				push_constant.job_params[1] = (2 * nMergeSubSize - 1);
-				push_constant.job_params[2] = -1;
+				step.push_constant.job_params[1] = (2 * nMergeSubSize - 1);
+				step.push_constant.job_params[2] = -1;
 			} else {
-				push_constant.job_params[1] = nMergeSubSize;
-				push_constant.job_params[2] = 1;
+				step.push_constant.job_params[1] = nMergeSubSize;
+				step.push_constant.job_params[2] = 1;
 			}
-			push_constant.job_params[3] = 0;
+			step.push_constant.job_params[3] = 0;
 
-			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(Sort::PushConstant));
-			RD::get_singleton()->compute_list_dispatch(compute_list, numThreadGroups, 1, 1);
-			RD::get_singleton()->compute_list_add_barrier(compute_list);
+			step.mode = SORT_MODE_STEP;
+			step.groups = numThreadGroups;
+			r_steps.push_back(step);
 		}
 
-		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, sort.pipelines[SORT_MODE_INNER]);
-		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(Sort::PushConstant));
-		RD::get_singleton()->compute_list_dispatch(compute_list, numThreadGroups, 1, 1);
+		step.mode = SORT_MODE_INNER;
+		step.groups = numThreadGroups;
+		r_steps.push_back(step);
 
 		presorted *= 2;
 	}
+}
+
+void EffectsRD::sort_buffer(RID p_uniform_set, int p_size) {
+	sort_buffers(&p_uniform_set, &p_size, 1);
+}
+
+void EffectsRD::sort_buffers(const RID *p_uniform_sets, const int *p_sizes, int p_count) {
+	//buffers are independent, so step N of all of them can run between the same pair of barriers
+	sort.steps.clear();
+	sort.step_offsets.resize(p_count + 1);
+
+	uint32_t max_steps = 0;
+	for (int i = 0; i < p_count; i++) {
+		sort.step_offsets[i] = sort.steps.size();
+		_add_sort_steps(p_sizes[i], sort.steps);
+		max_steps = MAX(max_steps, sort.steps.size() - sort.step_offsets[i]);
+	}
+	sort.step_offsets[p_count] = sort.steps.size();
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+
+	for (uint32_t i = 0; i < max_steps; i++) {
+		if (i > 0) {
+			RD::get_singleton()->compute_list_add_barrier(compute_list);
+		}
+
+		for (int j = 0; j < p_count; j++) {
+			uint32_t index = sort.step_offsets[j] + i;
+			if (index >= sort.step_offsets[j + 1]) {
+				continue; //this buffer is already sorted
+			}
+
+			const Sort::Step &step = sort.steps[index];
+			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, sort.pipelines[step.mode]);
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, p_uniform_sets[j], 1);
+			RD::get_singleton()->compute_list_set_push_constant(compute_list, &step.push_constant, sizeof(Sort::PushConstant));
+			RD::get_singleton()->compute_list_dispatch(compute_list, step.groups, 1, 1);
+		}
+	}
 
 	RD::get_singleton()->compute_list_end();
 }
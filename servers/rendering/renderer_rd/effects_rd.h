@@ -32,6 +32,7 @@
 #define EFFECTS_RD_H
 
 #include "core/math/camera_matrix.h"
+#include "core/templates/local_vector.h"
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/shaders/bokeh_dof.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/copy.glsl.gen.h"
@@ -613,8 +614,20 @@ class EffectsRD {
 		SortShaderRD shader;
 		RID shader_version;
 		RID pipelines[SORT_MODE_MAX];
+
+		struct Step {
+			SortMode mode;
+			PushConstant push_constant;
+			uint32_t groups;
+		};
+
+		// Scratch for sort_buffers(), steps of all buffers one after another.
+		LocalVector<Step> steps;
+		LocalVector<uint32_t> step_offsets;
 	} sort;
 
+	void _add_sort_steps(int p_size, LocalVector<Sort::Step> &r_steps);
+
 	RID default_sampler;
 	RID default_mipmap_sampler;
 	RID index_buffer;
@@ -746,13 +759,14 @@ public:
 	void cubemap_filter(RID p_source_cubemap, Vector<RID> p_dest_cubemap, bool p_use_array);
 	void render_sky(RD::DrawListID p_list, float p_time, RID p_fb, RID p_samplers, RID p_fog, PipelineCacheRD *p_pipeline, RID p_uniform_set, RID p_texture_set, const CameraMatrix &p_camera, const Basis &p_orientation, float p_multiplier, const Vector3 &p_position);
 
-	void screen_space_reflection(RID p_diffuse, RID p_normal_roughness, RS::EnvironmentSSRRoughnessQuality p_roughness_quality, RID p_blur_radius, RID p_blur_radius2, RID p_metallic, const Color &p_metallic_mask, RID p_depth, RID p_scale_depth, RID p_scale_normal, RID p_output, RID p_output_blur, const Size2i &p_screen_size, int p_max_steps, float p_fade_in, float p_fade_out, float p_tolerance, const CameraMatrix &p_camera);
-	void merge_specular(RID p_dest_framebuffer, RID p_specular, RID p_base, RID p_reflection);
+	void screen_space_reflection(RID p_diffuse, RID p_normal_roughness, RS::EnvironmentSSRRoughnessQuality p_roughness_quality, RID p_blur_radius, RID p_blur_radius2, RID p_metallic, const Color &p_metallic_mask, RID p_depth, RID p_scale_depth, RID p_scale_normal, RID p_output, RID p_output_blur, const Size2i &p_screen_size, int p_max_steps, float p_fade_in, float p_fade_out, float p_tolerance, const CameraMatrix &p_camera, uint32_t p_barrier = RD::BARRIER_MASK_ALL);
+	void merge_specular(RID p_dest_framebuffer, RID p_specular, RID p_base, RID p_reflection, uint32_t p_barrier = RD::BARRIER_MASK_ALL);
 	void sub_surface_scattering(RID p_diffuse, RID p_diffuse2, RID p_depth, const CameraMatrix &p_camera, const Size2i &p_screen_size, float p_scale, float p_depth_scale, RS::SubSurfaceScatteringQuality p_quality);
 
 	void resolve_gi(RID p_source_depth, RID p_source_normal_roughness, RID p_source_giprobe, RID p_dest_depth, RID p_dest_normal_roughness, RID p_dest_giprobe, Vector2i p_screen_size, int p_samples, uint32_t p_barrier = RD::BARRIER_MASK_ALL);
 
 	void sort_buffer(RID p_uniform_set, int p_size);
+	void sort_buffers(const RID *p_uniform_sets, const int *p_sizes, int p_count);
 
 	EffectsRD();
 	~EffectsRD();
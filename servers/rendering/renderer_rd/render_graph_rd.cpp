@@ -0,0 +1,313 @@
+/*************************************************************************/
+/*  render_graph_rd.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "render_graph_rd.h"
+
+#include "core/config/engine.h"
+
+bool RenderGraphRD::_format_matches(const RD::TextureFormat &p_a, const RD::TextureFormat &p_b) {
+	if (p_a.format != p_b.format || p_a.width != p_b.width || p_a.height != p_b.height || p_a.depth != p_b.depth) {
+		return false;
+	}
+	if (p_a.array_layers != p_b.array_layers || p_a.mipmaps != p_b.mipmaps || p_a.texture_type != p_b.texture_type || p_a.samples != p_b.samples || p_a.usage_bits != p_b.usage_bits) {
+		return false;
+	}
+	if (p_a.shareable_formats.size() != p_b.shareable_formats.size()) {
+		return false;
+	}
+	for (int i = 0; i < p_a.shareable_formats.size(); i++) {
+		if (p_a.shareable_formats[i] != p_b.shareable_formats[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32_t RenderGraphRD::_get_pass_barrier_mask(PassType p_type) {
+	switch (p_type) {
+		case PASS_TYPE_RASTER:
+			return RD::BARRIER_MASK_RASTER;
+		case PASS_TYPE_COMPUTE:
+			return RD::BARRIER_MASK_COMPUTE;
+		case PASS_TYPE_TRANSFER:
+			return RD::BARRIER_MASK_TRANSFER;
+	}
+	return RD::BARRIER_MASK_ALL;
+}
+
+RenderGraphRD::ResourceID RenderGraphRD::import_texture(RID p_texture, bool p_read_after_graph) {
+	Resource resource;
+	resource.texture = p_texture;
+	resource.read_after_graph = p_read_after_graph;
+	resources.push_back(resource);
+	return resources.size() - 1;
+}
+
+RenderGraphRD::ResourceID RenderGraphRD::create_transient_texture(const RD::TextureFormat &p_format) {
+	Resource resource;
+	resource.transient = true;
+	resource.format = p_format;
+	resources.push_back(resource);
+	return resources.size() - 1;
+}
+
+RenderGraphRD::PassID RenderGraphRD::add_pass(const String &p_name, PassType p_type, PassFunction p_function, void *p_userdata, bool p_side_effects) {
+	ERR_FAIL_COND_V(!p_function, -1);
+
+	Pass pass;
+	pass.name = p_name;
+	pass.type = p_type;
+	pass.function = p_function;
+	pass.userdata = p_userdata;
+	pass.side_effects = p_side_effects;
+	passes.push_back(pass);
+	return passes.size() - 1;
+}
+
+void RenderGraphRD::pass_read(PassID p_pass, ResourceID p_resource) {
+	ERR_FAIL_UNSIGNED_INDEX((uint32_t)p_pass, passes.size());
+	ERR_FAIL_UNSIGNED_INDEX((uint32_t)p_resource, resources.size());
+	passes[p_pass].reads.push_back(p_resource);
+}
+
+void RenderGraphRD::pass_write(PassID p_pass, ResourceID p_resource) {
+	ERR_FAIL_UNSIGNED_INDEX((uint32_t)p_pass, passes.size());
+	ERR_FAIL_UNSIGNED_INDEX((uint32_t)p_resource, resources.size());
+	passes[p_pass].writes.push_back(p_resource);
+}
+
+RID RenderGraphRD::get_texture(ResourceID p_resource) const {
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_resource, resources.size(), RID());
+	return resources[p_resource].texture;
+}
+
+void RenderGraphRD::_cull_passes() {
+	//walk backwards, a pass is kept if something after it (or after the graph) needs what it writes
+	LocalVector<bool> needed;
+	needed.resize(resources.size());
+	for (uint32_t i = 0; i < resources.size(); i++) {
+		needed[i] = resources[i].read_after_graph;
+	}
+
+	for (int32_t i = passes.size() - 1; i >= 0; i--) {
+		Pass &pass = passes[i];
+		pass.culled = !pass.side_effects;
+		for (uint32_t j = 0; j < pass.writes.size() && pass.culled; j++) {
+			if (needed[pass.writes[j]]) {
+				pass.culled = false;
+			}
+		}
+
+		if (pass.culled) {
+			continue;
+		}
+
+		for (uint32_t j = 0; j < pass.writes.size(); j++) {
+			if (resources[pass.writes[j]].transient) {
+				needed[pass.writes[j]] = false; //fully written here, earlier contents are not needed
+			}
+		}
+		for (uint32_t j = 0; j < pass.reads.size(); j++) {
+			needed[pass.reads[j]] = true;
+		}
+	}
+}
+
+void RenderGraphRD::_compute_barriers() {
+	for (uint32_t i = 0; i < passes.size(); i++) {
+		Pass &pass = passes[i];
+		if (pass.culled) {
+			continue;
+		}
+
+		uint32_t barrier = 0;
+
+		//later passes reading what this one writes (until it's written again), or writing over it
+		for (uint32_t j = 0; j < pass.writes.size(); j++) {
+			ResourceID resource = pass.writes[j];
+			bool overwritten = false;
+			for (uint32_t k = i + 1; k < passes.size() && !overwritten; k++) {
+				const Pass &next = passes[k];
+				if (next.culled) {
+					continue;
+				}
+				if (next.reads.find(resource) != -1) {
+					barrier |= _get_pass_barrier_mask(next.type);
+				}
+				if (next.writes.find(resource) != -1) {
+					barrier |= _get_pass_barrier_mask(next.type);
+					overwritten = true;
+				}
+			}
+			if (!overwritten && resources[resource].read_after_graph) {
+				barrier = RD::BARRIER_MASK_ALL; //unknown users after the graph
+			}
+		}
+
+		//later passes writing over what this one reads
+		for (uint32_t j = 0; j < pass.reads.size(); j++) {
+			ResourceID resource = pass.reads[j];
+			for (uint32_t k = i + 1; k < passes.size(); k++) {
+				const Pass &next = passes[k];
+				if (!next.culled && next.writes.find(resource) != -1) {
+					barrier |= _get_pass_barrier_mask(next.type);
+					break;
+				}
+			}
+		}
+
+		pass.post_barrier = barrier;
+		pass.pre_barrier = 0;
+	}
+}
+
+void RenderGraphRD::_assign_transient_textures() {
+	uint64_t frame = Engine::get_singleton()->get_frames_drawn();
+
+	for (uint32_t i = 0; i < passes.size(); i++) {
+		const Pass &pass = passes[i];
+		if (pass.culled) {
+			continue;
+		}
+		for (uint32_t j = 0; j < pass.reads.size() + pass.writes.size(); j++) {
+			Resource &resource = resources[j < pass.reads.size() ? pass.reads[j] : pass.writes[j - pass.reads.size()]];
+			if (resource.first_pass == -1) {
+				resource.first_pass = i;
+			}
+			resource.last_pass = i;
+		}
+	}
+
+	for (uint32_t i = 0; i < passes.size(); i++) {
+		Pass &pass = passes[i];
+		if (pass.culled) {
+			continue;
+		}
+
+		//acquire the transients first used by this pass, reusing pooled textures of the same format
+		for (uint32_t j = 0; j < pass.reads.size() + pass.writes.size(); j++) {
+			Resource &resource = resources[j < pass.reads.size() ? pass.reads[j] : pass.writes[j - pass.reads.size()]];
+			if (!resource.transient || resource.pooled != -1) {
+				continue;
+			}
+
+			int32_t pooled = -1;
+			for (uint32_t k = 0; k < pool.size(); k++) {
+				if (!pool[k].in_use && _format_matches(pool[k].format, resource.format)) {
+					pooled = k;
+					break;
+				}
+			}
+
+			if (pooled == -1) {
+				PooledTexture texture;
+				texture.format = resource.format;
+				texture.texture = RD::get_singleton()->texture_create(resource.format, RD::TextureView());
+				pool.push_back(texture);
+				pooled = pool.size() - 1;
+			} else if (pool[pooled].last_pass != -1) {
+				//aliased with a transient that died earlier in this graph, its last user must finish first
+				passes[pool[pooled].last_pass].post_barrier |= _get_pass_barrier_mask(pass.type);
+			} else if (pool[pooled].used_in_frame == frame) {
+				//used by another graph this frame, there is no pass of ours to put the barrier on
+				pass.pre_barrier |= _get_pass_barrier_mask(pass.type);
+			}
+
+			pool[pooled].in_use = true;
+			pool[pooled].used_in_frame = frame;
+			resource.pooled = pooled;
+			resource.texture = pool[pooled].texture;
+		}
+
+		//release the transients last used by this pass, later passes can take their textures
+		for (uint32_t j = 0; j < pass.reads.size() + pass.writes.size(); j++) {
+			const Resource &resource = resources[j < pass.reads.size() ? pass.reads[j] : pass.writes[j - pass.reads.size()]];
+			if (resource.transient && resource.last_pass == (PassID)i) {
+				pool[resource.pooled].in_use = false;
+				pool[resource.pooled].last_pass = i;
+			}
+		}
+	}
+}
+
+void RenderGraphRD::execute() {
+	_cull_passes();
+	_compute_barriers();
+	_assign_transient_textures();
+
+	PassContext context;
+	context.graph = this;
+
+	for (uint32_t i = 0; i < passes.size(); i++) {
+		const Pass &pass = passes[i];
+		if (pass.culled) {
+			continue;
+		}
+
+		if (pass.pre_barrier) {
+			RD::get_singleton()->barrier(RD::BARRIER_MASK_ALL, pass.pre_barrier);
+		}
+
+		context.post_barrier = pass.post_barrier ? pass.post_barrier : uint32_t(RD::BARRIER_MASK_NO_BARRIER);
+		RD::get_singleton()->draw_command_begin_label(pass.name);
+		pass.function(context, pass.userdata);
+		RD::get_singleton()->draw_command_end_label();
+	}
+
+	for (uint32_t i = 0; i < pool.size(); i++) {
+		pool[i].in_use = false;
+		pool[i].last_pass = -1;
+	}
+
+	clear();
+}
+
+void RenderGraphRD::clear() {
+	resources.clear();
+	passes.clear();
+}
+
+void RenderGraphRD::free_unused_textures() {
+	uint64_t frame = Engine::get_singleton()->get_frames_drawn();
+
+	for (uint32_t i = 0; i < pool.size(); i++) {
+		if (pool[i].used_in_frame + UNUSED_TEXTURE_FRAMES < frame) {
+			RD::get_singleton()->free(pool[i].texture);
+			pool.remove_unordered(i);
+			i--;
+		}
+	}
+}
+
+RenderGraphRD::~RenderGraphRD() {
+	for (uint32_t i = 0; i < pool.size(); i++) {
+		RD::get_singleton()->free(pool[i].texture);
+	}
+}
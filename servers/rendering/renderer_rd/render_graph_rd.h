@@ -0,0 +1,130 @@
+/*************************************************************************/
+/*  render_graph_rd.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef RENDER_GRAPH_RD_H
+#define RENDER_GRAPH_RD_H
+
+#include "core/templates/local_vector.h"
+#include "servers/rendering/rendering_device.h"
+
+// Small frame graph for chains of passes. Passes declare the textures they
+// read and write, then on execute() the graph:
+// - culls passes whose results are never used,
+// - gives each pass the minimal post barrier needed by the passes after it,
+// - assigns transient textures from a pool, so transients with the same format
+//   and non overlapping lifetimes share a texture (also across render buffers).
+// The pool is kept between executions, textures unused for a few frames are freed.
+
+class RenderGraphRD {
+public:
+	typedef int32_t ResourceID;
+	typedef int32_t PassID;
+
+	enum {
+		INVALID_RESOURCE = -1,
+		UNUSED_TEXTURE_FRAMES = 2 // Frames a pooled texture can go unused before it's freed.
+	};
+
+	enum PassType {
+		PASS_TYPE_RASTER,
+		PASS_TYPE_COMPUTE,
+		PASS_TYPE_TRANSFER,
+	};
+
+	struct PassContext {
+		const RenderGraphRD *graph = nullptr;
+		uint32_t post_barrier = RD::BARRIER_MASK_ALL; // Barrier to pass when ending the pass' draw or compute list.
+
+		RID get_texture(ResourceID p_resource) const { return graph->get_texture(p_resource); }
+	};
+
+	typedef void (*PassFunction)(const PassContext &p_context, void *p_userdata);
+
+private:
+	struct Resource {
+		RID texture; // Imported, or assigned from the pool when executing.
+		bool transient = false;
+		bool read_after_graph = false; // Imported textures whose contents are used after the graph.
+		RD::TextureFormat format;
+		PassID first_pass = -1;
+		PassID last_pass = -1;
+		int32_t pooled = -1;
+	};
+
+	struct Pass {
+		String name;
+		PassType type = PASS_TYPE_RASTER;
+		LocalVector<ResourceID> reads;
+		LocalVector<ResourceID> writes;
+		PassFunction function = nullptr;
+		void *userdata = nullptr;
+		bool side_effects = false;
+		bool culled = false;
+		uint32_t pre_barrier = 0; // Set when a pooled texture was used earlier in the frame outside this graph.
+		uint32_t post_barrier = 0;
+	};
+
+	struct PooledTexture {
+		RD::TextureFormat format;
+		RID texture;
+		uint64_t used_in_frame = 0;
+		PassID last_pass = -1; // Last pass of the current execution using it.
+		bool in_use = false;
+	};
+
+	LocalVector<Resource> resources;
+	LocalVector<Pass> passes;
+	LocalVector<PooledTexture> pool;
+
+	static bool _format_matches(const RD::TextureFormat &p_a, const RD::TextureFormat &p_b);
+	static uint32_t _get_pass_barrier_mask(PassType p_type);
+
+	void _cull_passes();
+	void _assign_transient_textures();
+	void _compute_barriers();
+
+public:
+	ResourceID import_texture(RID p_texture, bool p_read_after_graph = true);
+	ResourceID create_transient_texture(const RD::TextureFormat &p_format);
+
+	PassID add_pass(const String &p_name, PassType p_type, PassFunction p_function, void *p_userdata, bool p_side_effects = false);
+	void pass_read(PassID p_pass, ResourceID p_resource);
+	void pass_write(PassID p_pass, ResourceID p_resource);
+
+	RID get_texture(ResourceID p_resource) const;
+
+	void execute(); // Runs the passes and clears the graph, keeping the texture pool.
+	void clear();
+	void free_unused_textures();
+
+	~RenderGraphRD();
+};
+
+#endif // RENDER_GRAPH_RD_H
@@ -340,15 +340,7 @@ void RendererCanvasRenderRD::free_polygon(PolygonID p_polygon) {
 
 ////////////////////
 
-void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size) {
-	if (p_texture == RID()) {
-		p_texture = default_canvas_texture;
-	}
-
-	if (r_last_texture == p_texture) {
-		return; //nothing to do, its the same
-	}
-
+RID RendererCanvasRenderRD::_get_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, PushConstant &push_constant, Size2 &r_texpixel_size) {
 	RID uniform_set;
 	Color specular_shininess;
 	Size2i size;
@@ -358,12 +350,9 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	bool success = storage->canvas_texture_get_uniform_set(p_texture, p_base_filter, p_base_repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, uniform_set, size, specular_shininess, use_normal, use_specular);
 	//something odd happened
 	if (!success) {
-		_bind_canvas_texture(p_draw_list, default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
-		return;
+		return _get_canvas_texture(default_canvas_texture, p_base_filter, p_base_repeat, push_constant, r_texpixel_size);
 	}
 
-	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
-
 	if (specular_shininess.a < 0.999) {
 		push_constant.flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
 	} else {
@@ -387,9 +376,209 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	push_constant.color_texture_pixel_size[0] = r_texpixel_size.x;
 	push_constant.color_texture_pixel_size[1] = r_texpixel_size.y;
 
+	return uniform_set;
+}
+
+void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size) {
+	if (p_texture == RID()) {
+		p_texture = default_canvas_texture;
+	}
+
+	if (r_last_texture == p_texture) {
+		return; //nothing to do, its the same
+	}
+
+	RID uniform_set = _get_canvas_texture(p_texture, p_base_filter, p_base_repeat, push_constant, r_texpixel_size);
+	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
+
 	r_last_texture = p_texture;
 }
 
+uint32_t RendererCanvasRenderRD::_setup_item_push_constant(const Item *p_item, const Transform2D &p_canvas_transform_inverse, Light *p_lights, PushConstant &r_push_constant, uint16_t &r_light_count) {
+	Transform2D base_transform = p_canvas_transform_inverse * p_item->final_transform;
+	_update_transform_2d_to_mat2x3(base_transform, r_push_constant.world);
+
+	for (int i = 0; i < 4; i++) {
+		r_push_constant.modulation[i] = 0;
+		r_push_constant.ninepatch_margins[i] = 0;
+		r_push_constant.src_rect[i] = 0;
+		r_push_constant.dst_rect[i] = 0;
+	}
+	r_push_constant.flags = 0;
+	r_push_constant.specular_shininess = 0;
+	r_push_constant.color_texture_pixel_size[0] = 0;
+	r_push_constant.color_texture_pixel_size[1] = 0;
+
+	r_push_constant.rect_batch_offset = 0;
+	r_push_constant.pad = 0;
+
+	r_push_constant.lights[0] = 0;
+	r_push_constant.lights[1] = 0;
+	r_push_constant.lights[2] = 0;
+	r_push_constant.lights[3] = 0;
+
+	uint16_t light_count = 0;
+
+	Light *light = p_lights;
+
+	while (light) {
+		if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
+			uint32_t light_index = light->render_index_cache;
+			r_push_constant.lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
+
+			light_count++;
+
+			if (light_count == MAX_LIGHTS_PER_ITEM) {
+				break;
+			}
+		}
+		light = light->next_ptr;
+	}
+
+	r_light_count = light_count;
+	return light_count << FLAGS_LIGHT_COUNT_SHIFT;
+}
+
+void RendererCanvasRenderRD::_fill_rect_push_constant(const Item::CommandRect *p_rect, const Color &p_base_color, const Size2 &p_texpixel_size, PushConstant &push_constant) {
+	Rect2 src_rect;
+	Rect2 dst_rect;
+
+	if (p_rect->texture != RID()) {
+		src_rect = (p_rect->flags & CANVAS_RECT_REGION) ? Rect2(p_rect->source.position * p_texpixel_size, p_rect->source.size * p_texpixel_size) : Rect2(0, 0, 1, 1);
+		dst_rect = Rect2(p_rect->rect.position, p_rect->rect.size);
+
+		if (dst_rect.size.width < 0) {
+			dst_rect.position.x += dst_rect.size.width;
+			dst_rect.size.width *= -1;
+		}
+		if (dst_rect.size.height < 0) {
+			dst_rect.position.y += dst_rect.size.height;
+			dst_rect.size.height *= -1;
+		}
+
+		if (p_rect->flags & CANVAS_RECT_FLIP_H) {
+			src_rect.size.x *= -1;
+		}
+
+		if (p_rect->flags & CANVAS_RECT_FLIP_V) {
+			src_rect.size.y *= -1;
+		}
+
+		if (p_rect->flags & CANVAS_RECT_TRANSPOSE) {
+			dst_rect.size.x *= -1; // Encoding in the dst_rect.z uniform
+		}
+
+		if (p_rect->flags & CANVAS_RECT_CLIP_UV) {
+			push_constant.flags |= FLAGS_CLIP_RECT_UV;
+		}
+
+	} else {
+		dst_rect = Rect2(p_rect->rect.position, p_rect->rect.size);
+
+		if (dst_rect.size.width < 0) {
+			dst_rect.position.x += dst_rect.size.width;
+			dst_rect.size.width *= -1;
+		}
+		if (dst_rect.size.height < 0) {
+			dst_rect.position.y += dst_rect.size.height;
+			dst_rect.size.height *= -1;
+		}
+
+		src_rect = Rect2(0, 0, 1, 1);
+	}
+
+	push_constant.modulation[0] = p_rect->modulate.r * p_base_color.r;
+	push_constant.modulation[1] = p_rect->modulate.g * p_base_color.g;
+	push_constant.modulation[2] = p_rect->modulate.b * p_base_color.b;
+	push_constant.modulation[3] = p_rect->modulate.a * p_base_color.a;
+
+	push_constant.src_rect[0] = src_rect.position.x;
+	push_constant.src_rect[1] = src_rect.position.y;
+	push_constant.src_rect[2] = src_rect.size.width;
+	push_constant.src_rect[3] = src_rect.size.height;
+
+	push_constant.dst_rect[0] = dst_rect.position.x;
+	push_constant.dst_rect[1] = dst_rect.position.y;
+	push_constant.dst_rect[2] = dst_rect.size.width;
+	push_constant.dst_rect[3] = dst_rect.size.height;
+}
+
+void RendererCanvasRenderRD::_prepare_rect_batch(int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights) {
+	rect_batch.instances.clear();
+	rect_batch.next = 0;
+	rect_batch.count = 0;
+
+	// Walk the commands in the same order _render_item() will, so rect N of the frame maps to instance N.
+	for (int i = 0; i < p_item_count; i++) {
+		const Item *ci = items[i];
+		if (!ci->commands) {
+			continue;
+		}
+
+		RS::CanvasItemTextureFilter current_filter = ci->texture_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT ? ci->texture_filter : default_filter;
+		RS::CanvasItemTextureRepeat current_repeat = ci->texture_repeat != RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT ? ci->texture_repeat : default_repeat;
+
+		PushConstant push_constant;
+		uint16_t light_count;
+		uint32_t base_flags = _setup_item_push_constant(ci, p_canvas_transform_inverse, p_lights, push_constant, light_count);
+		Transform2D base_transform = p_canvas_transform_inverse * ci->final_transform;
+
+		RID last_texture;
+		Size2 texpixel_size;
+
+		for (const Item::Command *c = ci->commands; c; c = c->next) {
+			if (c->type == Item::Command::TYPE_TRANSFORM) {
+				const Item::CommandTransform *transform = static_cast<const Item::CommandTransform *>(c);
+				_update_transform_2d_to_mat2x3(base_transform * transform->xform, push_constant.world);
+				continue;
+			}
+
+			if (c->type != Item::Command::TYPE_RECT) {
+				continue;
+			}
+
+			const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
+
+			push_constant.flags = base_flags | (push_constant.flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED));
+
+			RID texture = rect->texture.is_valid() ? rect->texture : default_canvas_texture;
+			if (texture != last_texture) {
+				_get_canvas_texture(texture, current_filter, current_repeat, push_constant, texpixel_size);
+				last_texture = texture;
+			}
+
+			_fill_rect_push_constant(rect, ci->final_modulate, texpixel_size, push_constant);
+			rect_batch.instances.push_back(push_constant);
+		}
+	}
+
+	uint32_t count = MIN(rect_batch.instances.size(), rect_batch.max_instances);
+	if (count) {
+		RD::get_singleton()->buffer_update(rect_batch.buffer, 0, sizeof(PushConstant) * count, rect_batch.instances.ptr());
+	}
+}
+
+void RendererCanvasRenderRD::_flush_rect_batch(RD::DrawListID p_draw_list) {
+	if (rect_batch.count == 0) {
+		return;
+	}
+
+	PushConstant push_constant;
+	memset(&push_constant, 0, sizeof(PushConstant));
+	push_constant.flags = FLAGS_RECT_BATCH;
+	push_constant.rect_batch_offset = rect_batch.from;
+
+	RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
+	RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
+	RD::get_singleton()->draw_list_draw(p_draw_list, true, rect_batch.count);
+
+	frame_info.draw_calls++;
+	if (rect_batch.count > 1) {
+		frame_info.batched_rects += rect_batch.count;
+	}
+	rect_batch.count = 0;
+}
+
 void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants) {
 	//create an empty push constant
 
@@ -406,52 +595,13 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, const Item
 
 	PushConstant push_constant;
 	Transform2D base_transform = p_canvas_transform_inverse * p_item->final_transform;
-	_update_transform_2d_to_mat2x3(base_transform, push_constant.world);
 
 	Color base_color = p_item->final_modulate;
 
-	for (int i = 0; i < 4; i++) {
-		push_constant.modulation[i] = 0;
-		push_constant.ninepatch_margins[i] = 0;
-		push_constant.src_rect[i] = 0;
-		push_constant.dst_rect[i] = 0;
-	}
-	push_constant.flags = 0;
-	push_constant.color_texture_pixel_size[0] = 0;
-	push_constant.color_texture_pixel_size[1] = 0;
-
-	push_constant.pad[0] = 0;
-	push_constant.pad[1] = 0;
-
-	push_constant.lights[0] = 0;
-	push_constant.lights[1] = 0;
-	push_constant.lights[2] = 0;
-	push_constant.lights[3] = 0;
-
-	uint32_t base_flags = 0;
-
 	uint16_t light_count = 0;
 	PipelineLightMode light_mode;
 
-	{
-		Light *light = p_lights;
-
-		while (light) {
-			if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects_transformed(light->xform_cache, light->rect_cache)) {
-				uint32_t light_index = light->render_index_cache;
-				push_constant.lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
-
-				light_count++;
-
-				if (light_count == MAX_LIGHTS_PER_ITEM) {
-					break;
-				}
-			}
-			light = light->next_ptr;
-		}
-
-		base_flags |= light_count << FLAGS_LIGHT_COUNT_SHIFT;
-	}
+	uint32_t base_flags = _setup_item_push_constant(p_item, p_canvas_transform_inverse, p_lights, push_constant, light_count);
 
 	light_mode = (light_count > 0 || using_directional_lights) ? PIPELINE_LIGHT_MODE_ENABLED : PIPELINE_LIGHT_MODE_DISABLED;
 
@@ -466,86 +616,50 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, const Item
 	while (c) {
 		push_constant.flags = base_flags | (push_constant.flags & (FLAGS_DEFAULT_NORMAL_MAP_USED | FLAGS_DEFAULT_SPECULAR_MAP_USED)); //reset on each command for sanity, keep canvastexture binding config
 
+		if (c->type != Item::Command::TYPE_RECT && c->type != Item::Command::TYPE_TRANSFORM) {
+			_flush_rect_batch(p_draw_list);
+		}
+
 		switch (c->type) {
 			case Item::Command::TYPE_RECT: {
 				const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
 
-				//bind pipeline
-				{
-					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-				}
-
-				//bind textures
-
-				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
-
-				Rect2 src_rect;
-				Rect2 dst_rect;
+				RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
+				RID texture = rect->texture.is_valid() ? rect->texture : default_canvas_texture;
 
-				if (rect->texture != RID()) {
-					src_rect = (rect->flags & CANVAS_RECT_REGION) ? Rect2(rect->source.position * texpixel_size, rect->source.size * texpixel_size) : Rect2(0, 0, 1, 1);
-					dst_rect = Rect2(rect->rect.position, rect->rect.size);
+				// The instance data was already computed by _prepare_rect_batch().
+				uint32_t index = rect_batch.next++;
+				bool batched = index < rect_batch.max_instances;
 
-					if (dst_rect.size.width < 0) {
-						dst_rect.position.x += dst_rect.size.width;
-						dst_rect.size.width *= -1;
-					}
-					if (dst_rect.size.height < 0) {
-						dst_rect.position.y += dst_rect.size.height;
-						dst_rect.size.height *= -1;
-					}
+				if (batched && rect_batch.count > 0 && rect_batch.pipeline == pipeline && rect_batch.texture == texture && rect_batch.filter == current_filter && rect_batch.repeat == current_repeat) {
+					rect_batch.count++;
+					break;
+				}
 
-					if (rect->flags & CANVAS_RECT_FLIP_H) {
-						src_rect.size.x *= -1;
-					}
+				_flush_rect_batch(p_draw_list);
 
-					if (rect->flags & CANVAS_RECT_FLIP_V) {
-						src_rect.size.y *= -1;
-					}
+				//bind pipeline
+				RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
 
-					if (rect->flags & CANVAS_RECT_TRANSPOSE) {
-						dst_rect.size.x *= -1; // Encoding in the dst_rect.z uniform
-					}
+				//bind textures
 
-					if (rect->flags & CANVAS_RECT_CLIP_UV) {
-						push_constant.flags |= FLAGS_CLIP_RECT_UV;
-					}
+				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
+				if (batched) {
+					rect_batch.from = index;
+					rect_batch.count = 1;
+					rect_batch.pipeline = pipeline;
+					rect_batch.texture = texture;
+					rect_batch.filter = current_filter;
+					rect_batch.repeat = current_repeat;
 				} else {
-					dst_rect = Rect2(rect->rect.position, rect->rect.size);
-
-					if (dst_rect.size.width < 0) {
-						dst_rect.position.x += dst_rect.size.width;
-						dst_rect.size.width *= -1;
-					}
-					if (dst_rect.size.height < 0) {
-						dst_rect.position.y += dst_rect.size.height;
-						dst_rect.size.height *= -1;
-					}
-
-					src_rect = Rect2(0, 0, 1, 1);
+					// Out of batch space, draw it on its own.
+					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &rect_batch.instances[index], sizeof(PushConstant));
+					RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
+					RD::get_singleton()->draw_list_draw(p_draw_list, true);
+					frame_info.draw_calls++;
 				}
 
-				push_constant.modulation[0] = rect->modulate.r * base_color.r;
-				push_constant.modulation[1] = rect->modulate.g * base_color.g;
-				push_constant.modulation[2] = rect->modulate.b * base_color.b;
-				push_constant.modulation[3] = rect->modulate.a * base_color.a;
-
-				push_constant.src_rect[0] = src_rect.position.x;
-				push_constant.src_rect[1] = src_rect.position.y;
-				push_constant.src_rect[2] = src_rect.size.width;
-				push_constant.src_rect[3] = src_rect.size.height;
-
-				push_constant.dst_rect[0] = dst_rect.position.x;
-				push_constant.dst_rect[1] = dst_rect.position.y;
-				push_constant.dst_rect[2] = dst_rect.size.width;
-				push_constant.dst_rect[3] = dst_rect.size.height;
-
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
-
 			} break;
 
 			case Item::Command::TYPE_NINEPATCH: {
@@ -609,6 +723,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, const Item
 				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
 				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
 				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				frame_info.draw_calls++;
 
 				//restore if overrided
 				push_constant.color_texture_pixel_size[0] = texpixel_size.x;
@@ -654,6 +769,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, const Item
 					RD::get_singleton()->draw_list_bind_index_array(p_draw_list, pb->indices);
 				}
 				RD::get_singleton()->draw_list_draw(p_draw_list, pb->indices.is_valid());
+				frame_info.draw_calls++;
 
 			} break;
 			case Item::Command::TYPE_PRIMITIVE: {
@@ -684,6 +800,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, const Item
 				}
 				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
 				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				frame_info.draw_calls++;
 
 				if (primitive->point_count == 4) {
 					for (uint32_t j = 1; j < 3; j++) {
@@ -699,6 +816,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, const Item
 
 					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
 					RD::get_singleton()->draw_list_draw(p_draw_list, true);
+					frame_info.draw_calls++;
 				}
 
 			} break;
@@ -1116,6 +1234,14 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 		uniforms.push_back(u);
 	}
 
+	{
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.binding = 10;
+		u.ids.push_back(rect_batch.buffer);
+		uniforms.push_back(u);
+	}
+
 	RID uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shader.default_version_rd_shader, BASE_UNIFORM_SET);
 	if (p_backbuffer) {
 		storage->render_target_set_backbuffer_uniform_set(p_to_render_target, uniform_set);
@@ -1160,6 +1286,9 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(framebuffer);
 
+	// Buffers can't be updated once the draw list begins.
+	_prepare_rect_batch(p_item_count, canvas_transform_inverse, p_lights);
+
 	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD, clear_colors);
 
 	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
@@ -1173,6 +1302,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		Item *ci = items[i];
 
 		if (current_clip != ci->final_clip_owner) {
+			_flush_rect_batch(draw_list);
 			current_clip = ci->final_clip_owner;
 
 			//setup clip
@@ -1191,6 +1321,8 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		}
 
 		if (material != prev_material) {
+			_flush_rect_batch(draw_list);
+
 			MaterialData *material_data = nullptr;
 			if (material.is_valid()) {
 				material_data = (MaterialData *)storage->material_get_data(material, RendererStorageRD::SHADER_TYPE_2D);
@@ -1215,6 +1347,8 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		prev_material = material;
 	}
 
+	_flush_rect_batch(draw_list);
+
 	RD::get_singleton()->draw_list_end();
 }
 
@@ -1586,16 +1720,68 @@ void RendererCanvasRenderRD::_update_shadow_atlas() {
 		}
 
 		state.shadow_fb = RD::get_singleton()->framebuffer_create(fb_textures);
+
+		state.shadow_hashes.resize(state.max_lights_per_render);
+		for (uint32_t i = 0; i < state.max_lights_per_render; i++) {
+			state.shadow_hashes[i] = 0;
+		}
+	}
+}
+
+uint32_t RendererCanvasRenderRD::_hash_transform_2d(const Transform2D &p_transform, uint32_t p_hash) {
+	for (int i = 0; i < 3; i++) {
+		p_hash = hash_djb2_one_float(p_transform.elements[i].x, p_hash);
+		p_hash = hash_djb2_one_float(p_transform.elements[i].y, p_hash);
 	}
+	return p_hash;
 }
+
+uint32_t RendererCanvasRenderRD::_hash_occluders(const LocalVector<LightOccluderInstance *> &p_occluders, uint32_t p_hash) {
+	for (uint32_t i = 0; i < p_occluders.size(); i++) {
+		const OccluderPolygon *co = occluder_polygon_owner.getornull(p_occluders[i]->occluder);
+		p_hash = hash_djb2_one_32(HashMapHasherDefault::hash(p_occluders[i]->occluder), p_hash);
+		p_hash = hash_djb2_one_32(co->version, p_hash);
+		p_hash = _hash_transform_2d(p_occluders[i]->xform_cache, p_hash);
+	}
+	return p_hash;
+}
+
 void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index, const Transform2D &p_light_xform, int p_light_mask, float p_near, float p_far, LightOccluderInstance *p_occluders) {
 	CanvasLight *cl = canvas_light_owner.getornull(p_rid);
 	ERR_FAIL_COND(!cl->shadow.enabled);
 
 	_update_shadow_atlas();
+	ERR_FAIL_INDEX(p_shadow_index, int(state.max_lights_per_render));
 
 	cl->shadow.z_far = p_far;
 	cl->shadow.y_offset = float(p_shadow_index * 2 + 1) / float(state.max_lights_per_render * 2);
+
+	// Only occluders overlapping the light's range can cast into its shadow map.
+	Rect2 light_rect(-p_far, -p_far, p_far * 2.0, p_far * 2.0);
+	state.shadow_occluders.clear();
+	for (LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+		OccluderPolygon *co = occluder_polygon_owner.getornull(instance->occluder);
+		if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
+			continue;
+		}
+		if (!light_rect.intersects_transformed(p_light_xform * instance->xform_cache, instance->aabb_cache)) {
+			continue;
+		}
+		state.shadow_occluders.push_back(instance);
+	}
+
+	// Static lights with static occluders keep the shadow rendered on a previous frame.
+	uint32_t shadow_hash = hash_djb2_one_32(HashMapHasherDefault::hash(p_rid));
+	shadow_hash = hash_djb2_one_32(p_light_mask, shadow_hash);
+	shadow_hash = hash_djb2_one_float(p_near, shadow_hash);
+	shadow_hash = hash_djb2_one_float(p_far, shadow_hash);
+	shadow_hash = _hash_transform_2d(p_light_xform, shadow_hash);
+	shadow_hash = _hash_occluders(state.shadow_occluders, shadow_hash);
+	if (state.shadow_hashes[p_shadow_index] == shadow_hash) {
+		return;
+	}
+	state.shadow_hashes[p_shadow_index] = shadow_hash;
+
 	Vector<Color> cc;
 	cc.push_back(Color(p_far, p_far, p_far, 1.0));
 
@@ -1640,16 +1826,10 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 		/*if (i == 0)
 			*p_xform_cache = projection;*/
 
-		LightOccluderInstance *instance = p_occluders;
-
-		while (instance) {
+		for (uint32_t j = 0; j < state.shadow_occluders.size(); j++) {
+			LightOccluderInstance *instance = state.shadow_occluders[j];
 			OccluderPolygon *co = occluder_polygon_owner.getornull(instance->occluder);
 
-			if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
-				instance = instance->next;
-				continue;
-			}
-
 			_update_transform_2d_to_mat2x4(p_light_xform * instance->xform_cache, push_constant.modelview);
 
 			RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, shadow_render.render_pipelines[co->cull_mode]);
@@ -1658,8 +1838,6 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 			RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(ShadowRenderPushConstant));
 
 			RD::get_singleton()->draw_list_draw(draw_list, true);
-
-			instance = instance->next;
 		}
 
 		RD::get_singleton()->draw_list_end();
@@ -1671,6 +1849,7 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 	ERR_FAIL_COND(!cl->shadow.enabled);
 
 	_update_shadow_atlas();
+	ERR_FAIL_INDEX(p_shadow_index, int(state.max_lights_per_render));
 
 	Vector2 light_dir = p_light_xform.elements[1].normalized();
 
@@ -1693,6 +1872,32 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 
 	to_light_xform.invert();
 
+	Transform2D to_shadow;
+	to_shadow.elements[0].x = 1.0 / -(half_size * 2.0);
+	to_shadow.elements[2].x = 0.5;
+
+	cl->shadow.directional_xform = to_shadow * to_light_xform;
+
+	state.shadow_occluders.clear();
+	for (LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+		OccluderPolygon *co = occluder_polygon_owner.getornull(instance->occluder);
+		if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
+			continue;
+		}
+		state.shadow_occluders.push_back(instance);
+	}
+
+	uint32_t shadow_hash = hash_djb2_one_32(HashMapHasherDefault::hash(p_rid));
+	shadow_hash = hash_djb2_one_32(p_light_mask, shadow_hash);
+	shadow_hash = hash_djb2_one_float(distance, shadow_hash);
+	shadow_hash = hash_djb2_one_float(half_size, shadow_hash);
+	shadow_hash = _hash_transform_2d(to_light_xform, shadow_hash);
+	shadow_hash = _hash_occluders(state.shadow_occluders, shadow_hash);
+	if (state.shadow_hashes[p_shadow_index] == shadow_hash) {
+		return;
+	}
+	state.shadow_hashes[p_shadow_index] = shadow_hash;
+
 	Vector<Color> cc;
 	cc.push_back(Color(1, 1, 1, 1));
 
@@ -1715,16 +1920,10 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 	push_constant.z_far = distance;
 	push_constant.pad = 0;
 
-	LightOccluderInstance *instance = p_occluders;
-
-	while (instance) {
+	for (uint32_t i = 0; i < state.shadow_occluders.size(); i++) {
+		LightOccluderInstance *instance = state.shadow_occluders[i];
 		OccluderPolygon *co = occluder_polygon_owner.getornull(instance->occluder);
 
-		if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
-			instance = instance->next;
-			continue;
-		}
-
 		_update_transform_2d_to_mat2x4(to_light_xform * instance->xform_cache, push_constant.modelview);
 
 		RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, shadow_render.render_pipelines[co->cull_mode]);
@@ -1733,23 +1932,35 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 		RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(ShadowRenderPushConstant));
 
 		RD::get_singleton()->draw_list_draw(draw_list, true);
-
-		instance = instance->next;
 	}
 
 	RD::get_singleton()->draw_list_end();
-
-	Transform2D to_shadow;
-	to_shadow.elements[0].x = 1.0 / -(half_size * 2.0);
-	to_shadow.elements[2].x = 0.5;
-
-	cl->shadow.directional_xform = to_shadow * to_light_xform;
 }
 
 void RendererCanvasRenderRD::render_sdf(RID p_render_target, LightOccluderInstance *p_occluders) {
 	RID fb = storage->render_target_get_sdf_framebuffer(p_render_target);
 	Rect2i rect = storage->render_target_get_sdf_rect(p_render_target);
 
+	state.shadow_occluders.clear();
+	for (LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+		OccluderPolygon *co = occluder_polygon_owner.getornull(instance->occluder);
+		if (!co || co->sdf_index_array.is_null()) {
+			continue;
+		}
+		state.shadow_occluders.push_back(instance);
+	}
+
+	// The SDF is kept from the previous frame unless an occluder moved, changed shape, appeared or went away.
+	uint32_t sdf_hash = hash_djb2_one_32(rect.position.x);
+	sdf_hash = hash_djb2_one_32(rect.position.y, sdf_hash);
+	sdf_hash = hash_djb2_one_32(rect.size.width, sdf_hash);
+	sdf_hash = hash_djb2_one_32(rect.size.height, sdf_hash);
+	sdf_hash = _hash_occluders(state.shadow_occluders, sdf_hash);
+	if (storage->render_target_get_sdf_occluder_hash(p_render_target) == sdf_hash) {
+		return;
+	}
+	storage->render_target_set_sdf_occluder_hash(p_render_target, sdf_hash);
+
 	Transform2D to_sdf;
 	to_sdf.elements[0] *= rect.size.width;
 	to_sdf.elements[1] *= rect.size.height;
@@ -1781,16 +1992,10 @@ void RendererCanvasRenderRD::render_sdf(RID p_render_target, LightOccluderInstan
 	push_constant.z_far = 0;
 	push_constant.pad = 0;
 
-	LightOccluderInstance *instance = p_occluders;
-
-	while (instance) {
+	for (uint32_t i = 0; i < state.shadow_occluders.size(); i++) {
+		LightOccluderInstance *instance = state.shadow_occluders[i];
 		OccluderPolygon *co = occluder_polygon_owner.getornull(instance->occluder);
 
-		if (!co || co->sdf_index_array.is_null()) {
-			instance = instance->next;
-			continue;
-		}
-
 		_update_transform_2d_to_mat2x4(to_clip * instance->xform_cache, push_constant.modelview);
 
 		RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, shadow_render.sdf_render_pipelines[co->sdf_is_lines ? SHADOW_RENDER_SDF_LINES : SHADOW_RENDER_SDF_TRIANGLES]);
@@ -1799,8 +2004,6 @@ void RendererCanvasRenderRD::render_sdf(RID p_render_target, LightOccluderInstan
 		RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(ShadowRenderPushConstant));
 
 		RD::get_singleton()->draw_list_draw(draw_list, true);
-
-		instance = instance->next;
 	}
 
 	RD::get_singleton()->draw_list_end();
@@ -1814,12 +2017,14 @@ RID RendererCanvasRenderRD::occluder_polygon_create() {
 	occluder.sdf_point_count = 0;
 	occluder.sdf_index_count = 0;
 	occluder.cull_mode = RS::CANVAS_OCCLUDER_POLYGON_CULL_DISABLED;
+	occluder.version = 0;
 	return occluder_polygon_owner.make_rid(occluder);
 }
 
 void RendererCanvasRenderRD::occluder_polygon_set_shape(RID p_occluder, const Vector<Vector2> &p_points, bool p_closed) {
 	OccluderPolygon *oc = occluder_polygon_owner.getornull(p_occluder);
 	ERR_FAIL_COND(!oc);
+	oc->version++;
 
 	Vector<Vector2> lines;
 
@@ -1990,6 +2195,7 @@ void RendererCanvasRenderRD::occluder_polygon_set_cull_mode(RID p_occluder, RS::
 	OccluderPolygon *oc = occluder_polygon_owner.getornull(p_occluder);
 	ERR_FAIL_COND(!oc);
 	oc->cull_mode = p_mode;
+	oc->version++;
 }
 
 void RendererCanvasRenderRD::ShaderData::set_code(const String &p_code) {
@@ -2366,7 +2572,20 @@ void RendererCanvasRenderRD::set_time(double p_time) {
 	state.time = p_time;
 }
 
+int RendererCanvasRenderRD::get_render_info(RS::RenderInfo p_info) const {
+	switch (p_info) {
+		case RS::INFO_2D_DRAW_CALLS_IN_FRAME:
+			return last_frame_info.draw_calls;
+		case RS::INFO_2D_BATCHED_RECTS_IN_FRAME:
+			return last_frame_info.batched_rects;
+		default:
+			return 0;
+	}
+}
+
 void RendererCanvasRenderRD::update() {
+	last_frame_info = frame_info;
+	frame_info = FrameInfo();
 }
 
 RendererCanvasRenderRD::RendererCanvasRenderRD(RendererStorageRD *p_storage) {
@@ -2539,7 +2758,7 @@ RendererCanvasRenderRD::RendererCanvasRenderRD(RendererStorageRD *p_storage) {
 		actions.base_uniform_string = "material.";
 		actions.default_filter = ShaderLanguage::FILTER_LINEAR;
 		actions.default_repeat = ShaderLanguage::REPEAT_DISABLE;
-		actions.base_varying_index = 4;
+		actions.base_varying_index = 5;
 
 		actions.global_buffer_array_variable = "global_variables.data";
 
@@ -2618,6 +2837,10 @@ RendererCanvasRenderRD::RendererCanvasRenderRD(RendererStorageRD *p_storage) {
 	{ //bindings
 
 		state.canvas_state_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(State::Buffer));
+
+		rect_batch.max_instances = GLOBAL_GET("rendering/quality/2d/max_batched_rects");
+		rect_batch.max_instances = MAX(rect_batch.max_instances, 1u);
+		rect_batch.buffer = RD::get_singleton()->storage_buffer_create(sizeof(PushConstant) * rect_batch.max_instances);
 		state.lights_uniform_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(LightUniform) * state.max_lights_per_render);
 
 		RD::SamplerState shadow_sampler_state;
@@ -2773,6 +2996,8 @@ RendererCanvasRenderRD::~RendererCanvasRenderRD() {
 			RD::get_singleton()->free(state.canvas_state_buffer);
 		}
 
+		RD::get_singleton()->free(rect_batch.buffer);
+
 		memdelete_arr(state.light_uniforms);
 		RD::get_singleton()->free(state.lights_uniform_buffer);
 		RD::get_singleton()->free(shader.default_skeleton_uniform_buffer);
@@ -31,6 +31,7 @@
 #ifndef RENDERING_SERVER_CANVAS_RENDER_RD_H
 #define RENDERING_SERVER_CANVAS_RENDER_RD_H
 
+#include "core/templates/local_vector.h"
 #include "servers/rendering/renderer_canvas_render.h"
 #include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
@@ -79,6 +80,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 		FLAGS_NINEPACH_DRAW_CENTER = (1 << 12),
 		FLAGS_USING_PARTICLES = (1 << 13),
+		FLAGS_RECT_BATCH = (1 << 14),
 
 		FLAGS_USE_SKELETON = (1 << 15),
 		FLAGS_NINEPATCH_H_MODE_SHIFT = 16,
@@ -295,6 +297,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		RID sdf_index_buffer;
 		RID sdf_index_array;
 		bool sdf_is_lines;
+
+		uint32_t version; // Bumped on shape or cull mode changes, invalidates cached shadows and SDFs.
 	};
 
 	struct LightUniform {
@@ -374,6 +378,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		RID shadow_depth_texture;
 		RID shadow_fb;
 		int shadow_texture_size = 2048;
+		LocalVector<uint32_t> shadow_hashes; // What was last rendered to each light's rows of the shadow atlas, shadows are only re-rendered when it changes.
+		LocalVector<LightOccluderInstance *> shadow_occluders;
 
 		RID default_transforms_uniform_set;
 
@@ -395,7 +401,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 				float ninepatch_margins[4];
 				float dst_rect[4];
 				float src_rect[4];
-				float pad[2];
+				uint32_t rect_batch_offset;
+				uint32_t pad;
 			};
 			//primitive
 			struct {
@@ -415,6 +422,30 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	Item *items[MAX_RENDER_ITEMS];
 
+	// Rects are drawn as instances of a shared storage buffer, filled before the draw list begins.
+	// Consecutive rects using the same pipeline and texture are merged into a single draw.
+	struct RectBatch {
+		RID buffer;
+		uint32_t max_instances = 0;
+		LocalVector<PushConstant> instances;
+
+		uint32_t next = 0;
+		uint32_t from = 0;
+		uint32_t count = 0;
+		RID pipeline;
+		RID texture;
+		RS::CanvasItemTextureFilter filter = RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT;
+		RS::CanvasItemTextureRepeat repeat = RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT;
+	} rect_batch;
+
+	struct FrameInfo {
+		uint32_t draw_calls = 0;
+		uint32_t batched_rects = 0;
+	};
+
+	FrameInfo frame_info;
+	FrameInfo last_frame_info;
+
 	bool using_directional_lights = false;
 	RID default_canvas_texture;
 
@@ -426,7 +457,12 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	RID _create_base_uniform_set(RID p_to_render_target, bool p_backbuffer);
 
-	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size); //recursive, so regular inline used instead.
+	RID _get_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, PushConstant &push_constant, Size2 &r_texpixel_size); //recursive, so not inlined.
+	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size);
+	uint32_t _setup_item_push_constant(const Item *p_item, const Transform2D &p_canvas_transform_inverse, Light *p_lights, PushConstant &r_push_constant, uint16_t &r_light_count);
+	void _fill_rect_push_constant(const Item::CommandRect *p_rect, const Color &p_base_color, const Size2 &p_texpixel_size, PushConstant &push_constant);
+	void _prepare_rect_batch(int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights);
+	void _flush_rect_batch(RenderingDevice::DrawListID p_draw_list);
 	void _render_item(RenderingDevice::DrawListID p_draw_list, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants);
 	void _render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool p_to_backbuffer = false);
 
@@ -437,6 +473,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	_FORCE_INLINE_ void _update_transform_to_mat4(const Transform &p_transform, float *p_mat4);
 
 	void _update_shadow_atlas();
+	uint32_t _hash_occluders(const LocalVector<LightOccluderInstance *> &p_occluders, uint32_t p_hash);
+	_FORCE_INLINE_ uint32_t _hash_transform_2d(const Transform2D &p_transform, uint32_t p_hash);
 
 public:
 	PolygonID request_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs = Vector<Point2>(), const Vector<int> &p_bones = Vector<int>(), const Vector<float> &p_weights = Vector<float>());
@@ -463,6 +501,7 @@ public:
 	virtual void set_shadow_texture_size(int p_size);
 
 	void set_time(double p_time);
+	int get_render_info(RS::RenderInfo p_info) const;
 	void update();
 	bool free(RID p_rid);
 	RendererCanvasRenderRD(RendererStorageRD *p_storage);
@@ -39,6 +39,14 @@ void RendererCompositorRD::prepare_for_blitting_render_targets() {
 void RendererCompositorRD::blit_render_targets_to_screen(DisplayServer::WindowID p_screen, const BlitToScreen *p_render_targets, int p_amount) {
 	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin_for_screen(p_screen);
 
+	Size2 screen_size(RD::get_singleton()->screen_get_width(p_screen), RD::get_singleton()->screen_get_height(p_screen));
+	int pre_rotation = RD::get_singleton()->screen_get_pre_rotation(p_screen);
+	if (pre_rotation == 90 || pre_rotation == 270) {
+		// Rects are in the rotated orientation.
+		SWAP(screen_size.width, screen_size.height);
+	}
+	float rotation = Math::deg2rad(float(pre_rotation));
+
 	for (int i = 0; i < p_amount; i++) {
 		RID texture = storage->render_target_get_texture(p_render_targets[i].render_target);
 		ERR_CONTINUE(texture.is_null());
@@ -57,19 +65,21 @@ void RendererCompositorRD::blit_render_targets_to_screen(DisplayServer::WindowID
 			render_target_descriptors[rd_texture] = uniform_set;
 		}
 
-		Size2 screen_size(RD::get_singleton()->screen_get_width(p_screen), RD::get_singleton()->screen_get_height(p_screen));
-
 		RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, copy_viewports_rd_pipeline);
 		RD::get_singleton()->draw_list_bind_index_array(draw_list, copy_viewports_rd_array);
 		RD::get_singleton()->draw_list_bind_uniform_set(draw_list, render_target_descriptors[rd_texture], 0);
 
-		float push_constant[4] = {
+		float push_constant[8] = {
 			p_render_targets[i].rect.position.x / screen_size.width,
 			p_render_targets[i].rect.position.y / screen_size.height,
 			p_render_targets[i].rect.size.width / screen_size.width,
 			p_render_targets[i].rect.size.height / screen_size.height,
+			Math::cos(rotation),
+			Math::sin(rotation),
+			0.0,
+			0.0,
 		};
-		RD::get_singleton()->draw_list_set_push_constant(draw_list, push_constant, 4 * sizeof(float));
+		RD::get_singleton()->draw_list_set_push_constant(draw_list, push_constant, 8 * sizeof(float));
 		RD::get_singleton()->draw_list_draw(draw_list, true);
 	}
 
@@ -101,13 +111,14 @@ void RendererCompositorRD::initialize() {
 		vert.shader_stage = RenderingDevice::SHADER_STAGE_VERTEX;
 		vert.spir_v = RenderingDevice::get_singleton()->shader_compile_from_source(RenderingDevice::SHADER_STAGE_VERTEX,
 				"#version 450\n"
-				"layout(push_constant, binding = 0, std140) uniform Pos { vec4 dst_rect; } pos;\n"
+				"layout(push_constant, binding = 0, std140) uniform Pos { vec4 dst_rect; vec4 rotation; } pos;\n"
 				"layout(location =0) out vec2 uv;\n"
 				"void main() { \n"
 				" vec2 base_arr[4] = vec2[](vec2(0.0,0.0),vec2(0.0,1.0),vec2(1.0,1.0),vec2(1.0,0.0));\n"
 				" uv = base_arr[gl_VertexIndex];\n"
 				" vec2 vtx = pos.dst_rect.xy+uv*pos.dst_rect.zw;\n"
-				" gl_Position = vec4(vtx * 2.0 - 1.0,0.0,1.0);\n"
+				" vtx = mat2(pos.rotation.x, pos.rotation.y, -pos.rotation.y, pos.rotation.x) * (vtx * 2.0 - 1.0);\n"
+				" gl_Position = vec4(vtx,0.0,1.0);\n"
 				"}\n");
 
 		RenderingDevice::ShaderStageData frag;
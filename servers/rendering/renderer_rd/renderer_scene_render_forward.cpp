@@ -135,6 +135,7 @@ void RendererSceneRenderForward::ShaderData::set_code(const String &p_code) {
 
 	depth_draw = DepthDraw(depth_drawi);
 	depth_test = DepthTest(depth_testi);
+	cull_mode = Cull(cull);
 
 #if 0
 	print_line("**compiling shader:");
@@ -277,7 +278,7 @@ void RendererSceneRenderForward::ShaderData::set_code(const String &p_code) {
 						multisample_state.enable_alpha_to_one = true;
 					}
 
-					if (k == SHADER_VERSION_COLOR_PASS || k == SHADER_VERSION_COLOR_PASS_WITH_FORWARD_GI || k == SHADER_VERSION_LIGHTMAP_COLOR_PASS) {
+					if (k == SHADER_VERSION_COLOR_PASS || k == SHADER_VERSION_LIGHTMAP_COLOR_PASS) {
 						blend_state = blend_state_blend;
 						if (depth_draw == DEPTH_DRAW_OPAQUE) {
 							depth_stencil.enable_depth_write = false; //alpha does not draw depth
@@ -295,7 +296,7 @@ void RendererSceneRenderForward::ShaderData::set_code(const String &p_code) {
 						continue; // do not use this version (will error if using it is attempted)
 					}
 				} else {
-					if (k == SHADER_VERSION_COLOR_PASS || k == SHADER_VERSION_COLOR_PASS_WITH_FORWARD_GI || k == SHADER_VERSION_LIGHTMAP_COLOR_PASS) {
+					if (k == SHADER_VERSION_COLOR_PASS || k == SHADER_VERSION_LIGHTMAP_COLOR_PASS) {
 						blend_state = blend_state_opaque;
 					} else if (k == SHADER_VERSION_DEPTH_PASS || k == SHADER_VERSION_DEPTH_PASS_DP) {
 						//none, leave empty
@@ -405,9 +406,141 @@ RendererSceneRenderForward::ShaderData::ShaderData() {
 	uses_screen_texture = false;
 }
 
+bool RendererSceneRenderForward::ShaderData::MaterialUniformSetKey::operator<(const MaterialUniformSetKey &p_key) const {
+	if (ids.size() != p_key.ids.size()) {
+		return ids.size() < p_key.ids.size();
+	}
+	for (int i = 0; i < ids.size(); i++) {
+		if (ids[i] != p_key.ids[i]) {
+			return ids[i] < p_key.ids[i];
+		}
+	}
+	return false;
+}
+
+uint32_t RendererSceneRenderForward::ShaderData::material_slot_alloc() {
+	uint32_t page_index = material_pages.size();
+	for (uint32_t i = 0; i < material_pages.size(); i++) {
+		const MaterialPage &page = material_pages[i];
+		if (page.buffer.is_valid() && page.slot_size == ubo_size && page.used < MATERIAL_PAGE_SLOTS) {
+			page_index = i;
+			break;
+		} else if (page.buffer.is_null() && page_index == material_pages.size()) {
+			page_index = i; //empty page, keep looking for one with free slots
+		}
+	}
+
+	if (page_index == material_pages.size()) {
+		material_pages.push_back(MaterialPage());
+	}
+
+	MaterialPage &page = material_pages[page_index];
+	if (page.buffer.is_null()) {
+		page.buffer = RD::get_singleton()->storage_buffer_create(MATERIAL_PAGE_SLOTS * ubo_size);
+		page.slot_size = ubo_size;
+	}
+
+	uint32_t slot;
+	if (page.free_slots.size()) {
+		slot = page.free_slots[page.free_slots.size() - 1];
+		page.free_slots.resize(page.free_slots.size() - 1);
+	} else {
+		slot = page.next_slot++;
+	}
+	page.used++;
+
+	return page_index * MATERIAL_PAGE_SLOTS + slot;
+}
+
+void RendererSceneRenderForward::ShaderData::material_slot_free(uint32_t p_slot) {
+	ERR_FAIL_UNSIGNED_INDEX(p_slot / MATERIAL_PAGE_SLOTS, material_pages.size());
+	MaterialPage &page = material_pages[p_slot / MATERIAL_PAGE_SLOTS];
+	page.used--;
+	if (page.used == 0) {
+		//uniform sets using the page go away with the buffer, none of their materials remain
+		RD::get_singleton()->free(page.buffer);
+		page.buffer = RID();
+		page.next_slot = 0;
+		page.free_slots.clear();
+	} else {
+		page.free_slots.push_back(p_slot % MATERIAL_PAGE_SLOTS);
+	}
+}
+
+void RendererSceneRenderForward::ShaderData::material_slot_update(uint32_t p_slot, const uint8_t *p_data) {
+	ERR_FAIL_UNSIGNED_INDEX(p_slot / MATERIAL_PAGE_SLOTS, material_pages.size());
+	const MaterialPage &page = material_pages[p_slot / MATERIAL_PAGE_SLOTS];
+	RD::get_singleton()->buffer_update(page.buffer, (p_slot % MATERIAL_PAGE_SLOTS) * page.slot_size, page.slot_size, p_data, RD::BARRIER_MASK_RASTER);
+}
+
+RID RendererSceneRenderForward::ShaderData::material_uniform_set_acquire(const Vector<RID> &p_ids, bool p_has_buffer) {
+	RendererSceneRenderForward *scene_singleton = (RendererSceneRenderForward *)RendererSceneRenderForward::singleton;
+
+	MaterialUniformSetKey key;
+	key.ids = p_ids;
+
+	Map<MaterialUniformSetKey, MaterialUniformSet>::Element *E = material_uniform_sets.find(key);
+	if (!E) {
+		E = material_uniform_sets.insert(key, MaterialUniformSet());
+	}
+
+	MaterialUniformSet &mus = E->get();
+	mus.users++;
+
+	if (mus.uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(mus.uniform_set)) {
+		//new, or a texture it used was freed
+		Vector<RD::Uniform> uniforms;
+
+		for (int i = 0; i < p_ids.size(); i++) {
+			RD::Uniform u;
+			if (p_has_buffer && i == 0) {
+				u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+				u.binding = 0;
+			} else {
+				u.uniform_type = RD::UNIFORM_TYPE_TEXTURE;
+				u.binding = p_has_buffer ? i : 1 + i;
+			}
+			u.ids.push_back(p_ids[i]);
+			uniforms.push_back(u);
+		}
+
+		mus.uniform_set = RD::get_singleton()->uniform_set_create(uniforms, scene_singleton->shader.scene_shader.version_get_shader(version, 0), MATERIAL_UNIFORM_SET);
+	}
+
+	return mus.uniform_set;
+}
+
+void RendererSceneRenderForward::ShaderData::material_uniform_set_release(const Vector<RID> &p_ids) {
+	MaterialUniformSetKey key;
+	key.ids = p_ids;
+
+	Map<MaterialUniformSetKey, MaterialUniformSet>::Element *E = material_uniform_sets.find(key);
+	ERR_FAIL_COND(!E);
+
+	E->get().users--;
+	if (E->get().users == 0) {
+		if (E->get().uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(E->get().uniform_set)) {
+			RD::get_singleton()->free(E->get().uniform_set);
+		}
+		material_uniform_sets.erase(E);
+	}
+}
+
 RendererSceneRenderForward::ShaderData::~ShaderData() {
 	RendererSceneRenderForward *scene_singleton = (RendererSceneRenderForward *)RendererSceneRenderForward::singleton;
 	ERR_FAIL_COND(!scene_singleton);
+
+	for (Map<MaterialUniformSetKey, MaterialUniformSet>::Element *E = material_uniform_sets.front(); E; E = E->next()) {
+		if (E->get().uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(E->get().uniform_set)) {
+			RD::get_singleton()->free(E->get().uniform_set);
+		}
+	}
+	for (uint32_t i = 0; i < material_pages.size(); i++) {
+		if (material_pages[i].buffer.is_valid()) {
+			RD::get_singleton()->free(material_pages[i].buffer);
+		}
+	}
+
 	//pipeline variants will clear themselves if shader is gone
 	if (version.is_valid()) {
 		scene_singleton->shader.scene_shader.version_free(version);
@@ -428,32 +561,25 @@ void RendererSceneRenderForward::MaterialData::set_next_pass(RID p_pass) {
 }
 
 void RendererSceneRenderForward::MaterialData::update_parameters(const Map<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty) {
-	RendererSceneRenderForward *scene_singleton = (RendererSceneRenderForward *)RendererSceneRenderForward::singleton;
-
 	if ((uint32_t)ubo_data.size() != shader_data->ubo_size) {
 		p_uniform_dirty = true;
-		if (uniform_buffer.is_valid()) {
-			RD::get_singleton()->free(uniform_buffer);
-			uniform_buffer = RID();
+		p_textures_dirty = true; //must move to a page of the new size, so the uniform set changes too
+		if (ubo_slot != INVALID_UBO_SLOT) {
+			shader_data->material_slot_free(ubo_slot);
+			ubo_slot = INVALID_UBO_SLOT;
 		}
 
 		ubo_data.resize(shader_data->ubo_size);
 		if (ubo_data.size()) {
-			uniform_buffer = RD::get_singleton()->uniform_buffer_create(ubo_data.size());
+			ubo_slot = shader_data->material_slot_alloc();
 			memset(ubo_data.ptrw(), 0, ubo_data.size()); //clear
 		}
-
-		//clear previous uniform set
-		if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
-			RD::get_singleton()->free(uniform_set);
-			uniform_set = RID();
-		}
 	}
 
 	//check whether buffer changed
 	if (p_uniform_dirty && ubo_data.size()) {
 		update_uniform_buffer(shader_data->uniforms, shader_data->ubo_offsets.ptr(), p_parameters, ubo_data.ptrw(), ubo_data.size(), false);
-		RD::get_singleton()->buffer_update(uniform_buffer, 0, ubo_data.size(), ubo_data.ptrw(), RD::BARRIER_MASK_RASTER);
+		shader_data->material_slot_update(ubo_slot, ubo_data.ptr());
 	}
 
 	uint32_t tex_uniform_count = shader_data->texture_uniforms.size();
@@ -461,59 +587,50 @@ void RendererSceneRenderForward::MaterialData::update_parameters(const Map<Strin
 	if ((uint32_t)texture_cache.size() != tex_uniform_count) {
 		texture_cache.resize(tex_uniform_count);
 		p_textures_dirty = true;
-
-		//clear previous uniform set
-		if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
-			RD::get_singleton()->free(uniform_set);
-			uniform_set = RID();
-		}
 	}
 
 	if (p_textures_dirty && tex_uniform_count) {
 		update_textures(p_parameters, shader_data->default_texture_params, shader_data->texture_uniforms, texture_cache.ptrw(), true);
 	}
 
-	if (shader_data->ubo_size == 0 && shader_data->texture_uniforms.size() == 0) {
-		// This material does not require an uniform set, so don't create it.
+	if (!p_textures_dirty && (uniform_set.is_null() || RD::get_singleton()->uniform_set_is_valid(uniform_set))) {
+		//no reason to update uniform set, only the parameters (or nothing) were needed to update
 		return;
 	}
 
-	if (!p_textures_dirty && uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
-		//no reason to update uniform set, only UBO (or nothing) was needed to update
-		return;
+	Vector<RID> ids;
+	if (ubo_data.size()) {
+		ids.push_back(shader_data->material_pages[ubo_slot / ShaderData::MATERIAL_PAGE_SLOTS].buffer);
+	}
+	const RID *textures = texture_cache.ptr();
+	for (uint32_t i = 0; i < tex_uniform_count; i++) {
+		ids.push_back(textures[i]);
 	}
 
-	Vector<RD::Uniform> uniforms;
-
-	{
-		if (shader_data->ubo_size) {
-			RD::Uniform u;
-			u.uniform_type = RD::UNIFORM_TYPE_UNIFORM_BUFFER;
-			u.binding = 0;
-			u.ids.push_back(uniform_buffer);
-			uniforms.push_back(u);
-		}
-
-		const RID *textures = texture_cache.ptrw();
-		for (uint32_t i = 0; i < tex_uniform_count; i++) {
-			RD::Uniform u;
-			u.uniform_type = RD::UNIFORM_TYPE_TEXTURE;
-			u.binding = 1 + i;
-			u.ids.push_back(textures[i]);
-			uniforms.push_back(u);
-		}
+	//acquire before releasing, so a set shared with the same key is not recreated
+	RID new_uniform_set;
+	if (ids.size()) {
+		new_uniform_set = shader_data->material_uniform_set_acquire(ids, ubo_data.size() != 0);
+	}
+	if (uniform_set_ids.size()) {
+		shader_data->material_uniform_set_release(uniform_set_ids);
 	}
 
-	uniform_set = RD::get_singleton()->uniform_set_create(uniforms, scene_singleton->shader.scene_shader.version_get_shader(shader_data->version, 0), MATERIAL_UNIFORM_SET);
+	uniform_set = new_uniform_set;
+	uniform_set_ids = ids;
+}
+
+uint32_t RendererSceneRenderForward::MaterialData::get_material_index() const {
+	return ubo_slot == INVALID_UBO_SLOT ? 0 : ubo_slot % ShaderData::MATERIAL_PAGE_SLOTS;
 }
 
 RendererSceneRenderForward::MaterialData::~MaterialData() {
-	if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) {
-		RD::get_singleton()->free(uniform_set);
+	if (uniform_set_ids.size()) {
+		shader_data->material_uniform_set_release(uniform_set_ids);
 	}
 
-	if (uniform_buffer.is_valid()) {
-		RD::get_singleton()->free(uniform_buffer);
+	if (ubo_slot != INVALID_UBO_SLOT) {
+		shader_data->material_slot_free(ubo_slot);
 	}
 }
 
@@ -828,14 +945,17 @@ void RendererSceneRenderForward::_render_list_template(RenderingDevice::DrawList
 		RID material_uniform_set;
 		ShaderData *shader;
 		void *mesh_surface;
+		bool use_shadow_surface = shadow_pass || p_params->pass_mode == PASS_MODE_DEPTH; //regular depth pass can use these too
 
-		if (shadow_pass || p_params->pass_mode == PASS_MODE_DEPTH) { //regular depth pass can use these too
+		if (use_shadow_surface) {
 			material_uniform_set = surf->material_uniform_set_shadow;
+			push_constant.material_index = surf->material_index_shadow;
 			shader = surf->shader_shadow;
 			mesh_surface = surf->surface_shadow;
 
 		} else {
 			material_uniform_set = surf->material_uniform_set;
+			push_constant.material_index = surf->material_index;
 			shader = surf->shader;
 			mesh_surface = surf->surface;
 		}
@@ -861,16 +981,18 @@ void RendererSceneRenderForward::_render_list_template(RenderingDevice::DrawList
 		RID xforms_uniform_set = surf->owner->transforms_uniform_set;
 
 		ShaderVersion shader_version = SHADER_VERSION_MAX; // Assigned to silence wrong -Wmaybe-initialized.
+		uint32_t shader_specializations = 0;
 
 		switch (p_params->pass_mode) {
 			case PASS_MODE_COLOR:
 			case PASS_MODE_COLOR_TRANSPARENT: {
 				if (element_info.uses_lightmap) {
 					shader_version = SHADER_VERSION_LIGHTMAP_COLOR_PASS;
-				} else if (element_info.uses_forward_gi) {
-					shader_version = SHADER_VERSION_COLOR_PASS_WITH_FORWARD_GI;
 				} else {
 					shader_version = SHADER_VERSION_COLOR_PASS;
+					if (element_info.uses_forward_gi) {
+						shader_specializations |= SHADER_SPECIALIZATION_FORWARD_GI;
+					}
 				}
 			} break;
 			case PASS_MODE_COLOR_SPECULAR: {
@@ -930,7 +1052,7 @@ void RendererSceneRenderForward::_render_list_template(RenderingDevice::DrawList
 			prev_index_array_rd = index_array_rd;
 		}
 
-		RID pipeline_rd = pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe);
+		RID pipeline_rd = pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe, shader_specializations);
 
 		if (pipeline_rd != prev_pipeline_rd) {
 			// checking with prev shader does not make so much sense, as
@@ -953,10 +1075,28 @@ void RendererSceneRenderForward::_render_list_template(RenderingDevice::DrawList
 			prev_material_uniform_set = material_uniform_set;
 		}
 
-		RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(SceneState::PushConstant));
+		if (p_params->use_mesh_clusters && (use_shadow_surface ? surf->cluster_draw_offset_shadow : surf->cluster_draw_offset) != GeometryInstanceSurfaceDataCache::NO_CLUSTER_DRAW) {
+			//each repeated element has its own cluster draws, written by _cull_mesh_clusters()
+			for (uint32_t j = 0; j < element_info.repeat; j++) {
+				const GeometryInstanceSurfaceDataCache *repeat_surf = p_params->elements[i + j];
+				uint32_t draw_offset = use_shadow_surface ? repeat_surf->cluster_draw_offset_shadow : repeat_surf->cluster_draw_offset;
+
+				push_constant.base_index = i + j + p_params->element_offset;
+				RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(SceneState::PushConstant));
 
-		uint32_t instance_count = surf->owner->instance_count > 1 ? surf->owner->instance_count : element_info.repeat;
-		RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+				if (draw_offset == GeometryInstanceSurfaceDataCache::NO_CLUSTER_DRAW) {
+					RD::get_singleton()->draw_list_draw(draw_list, true, 1);
+				} else {
+					uint32_t draw_count = use_shadow_surface ? repeat_surf->cluster_count_shadow : repeat_surf->cluster_count;
+					RD::get_singleton()->draw_list_draw_indirect(draw_list, true, mesh_cluster_cull.draw_buffer, draw_offset * MeshClusterCull::DRAW_COMMAND_SIZE, draw_count, MeshClusterCull::DRAW_COMMAND_SIZE);
+				}
+			}
+		} else {
+			RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(SceneState::PushConstant));
+
+			uint32_t instance_count = surf->owner->instance_count > 1 ? surf->owner->instance_count : element_info.repeat;
+			RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+		}
 		i += element_info.repeat - 1; //skip equal elements
 	}
 }
@@ -1000,7 +1140,7 @@ void RendererSceneRenderForward::_render_list(RenderingDevice::DrawListID p_draw
 
 void RendererSceneRenderForward::_render_list_thread_function(uint32_t p_thread, RenderListParameters *p_params) {
 	uint32_t render_total = p_params->element_count;
-	uint32_t total_threads = RendererThreadPool::singleton->thread_work_pool.get_thread_count();
+	uint32_t total_threads = thread_draw_lists.size();
 	uint32_t render_from = p_thread * render_total / total_threads;
 	uint32_t render_to = (p_thread + 1 == total_threads) ? render_total : ((p_thread + 1) * render_total / total_threads);
 	_render_list(thread_draw_lists[p_thread], p_params->framebuffer_format, p_params, render_from, render_to);
@@ -1010,9 +1150,9 @@ void RendererSceneRenderForward::_render_list_with_threads(RenderListParameters
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(p_framebuffer);
 	p_params->framebuffer_format = fb_format;
 
-	if ((uint32_t)p_params->element_count > render_list_thread_threshold && false) { // secondary command buffers need more testing at this time
-		//multi threaded
-		thread_draw_lists.resize(RendererThreadPool::singleton->thread_work_pool.get_thread_count());
+	if ((uint32_t)p_params->element_count > render_list_thread_threshold && RendererThreadPool::singleton->thread_work_pool.get_thread_count() > 0) {
+		//multi threaded, the calling thread records one of the lists too
+		thread_draw_lists.resize(RendererThreadPool::singleton->thread_work_pool.get_thread_count() + 1);
 		RD::get_singleton()->draw_list_begin_split(p_framebuffer, thread_draw_lists.size(), thread_draw_lists.ptr(), p_initial_color_action, p_final_color_action, p_initial_depth_action, p_final_depth_action, p_clear_color_values, p_clear_depth, p_clear_stencil, p_region, p_storage_textures);
 		RendererThreadPool::singleton->thread_work_pool.do_work(thread_draw_lists.size(), this, &RendererSceneRenderForward::_render_list_thread_function, p_params);
 		RD::get_singleton()->draw_list_end(p_params->barrier);
@@ -1281,26 +1421,24 @@ void RendererSceneRenderForward::_update_instance_data_buffer(RenderListType p_r
 				RD::get_singleton()->free(scene_state.instance_buffer[p_render_list]);
 			}
 			uint32_t new_size = nearest_power_of_2_templated(MAX(uint64_t(INSTANCE_DATA_BUFFER_MIN_SIZE), scene_state.instance_data[p_render_list].size()));
-			scene_state.instance_buffer[p_render_list] = RD::get_singleton()->storage_buffer_create(new_size * sizeof(SceneState::InstanceData));
+			//rewritten every pass, so write it directly instead of going through the staging buffer
+			scene_state.instance_buffer[p_render_list] = RD::get_singleton()->storage_buffer_create(new_size * sizeof(SceneState::InstanceData), Vector<uint8_t>(), RD::STORAGE_BUFFER_USAGE_PERSISTENT_MAPPED);
 			scene_state.instance_buffer_size[p_render_list] = new_size;
 		}
 		RD::get_singleton()->buffer_update(scene_state.instance_buffer[p_render_list], 0, sizeof(SceneState::InstanceData) * scene_state.instance_data[p_render_list].size(), scene_state.instance_data[p_render_list].ptr(), RD::BARRIER_MASK_RASTER);
 	}
 }
-void RendererSceneRenderForward::_fill_instance_data(RenderListType p_render_list, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer) {
-	RenderList *rl = &render_list[p_render_list];
-	uint32_t element_total = p_max_elements >= 0 ? uint32_t(p_max_elements) : rl->elements.size();
-
-	scene_state.instance_data[p_render_list].resize(p_offset + element_total);
-	rl->element_info.resize(p_offset + element_total);
-
-	uint32_t repeats = 0;
-	GeometryInstanceSurfaceDataCache *prev_surface = nullptr;
-	for (uint32_t i = 0; i < element_total; i++) {
-		GeometryInstanceSurfaceDataCache *surface = rl->elements[i + p_offset];
+void RendererSceneRenderForward::_fill_instance_data_chunk(uint32_t p_chunk, FillInstanceDataParameters *p_params) {
+	RenderList *rl = &render_list[p_params->render_list];
+	uint32_t element_total = p_params->element_total;
+	uint32_t from = p_params->offset + p_chunk * element_total / p_params->chunk_count;
+	uint32_t to = p_params->offset + ((p_chunk + 1 == p_params->chunk_count) ? element_total : ((p_chunk + 1) * element_total / p_params->chunk_count));
+
+	for (uint32_t i = from; i < to; i++) {
+		GeometryInstanceSurfaceDataCache *surface = rl->elements[i];
 		GeometryInstanceForward *inst = surface->owner;
 
-		SceneState::InstanceData &instance_data = scene_state.instance_data[p_render_list][i + p_offset];
+		SceneState::InstanceData &instance_data = scene_state.instance_data[p_params->render_list][i];
 
 		if (inst->store_transform_cache) {
 			RendererStorageRD::store_transform(inst->transform, instance_data.transform);
@@ -1317,36 +1455,55 @@ void RendererSceneRenderForward::_fill_instance_data(RenderListType p_render_lis
 		instance_data.lightmap_uv_scale[2] = inst->lightmap_uv_scale.size.x;
 		instance_data.lightmap_uv_scale[3] = inst->lightmap_uv_scale.size.y;
 
-		bool cant_repeat = instance_data.flags & INSTANCE_DATA_FLAG_MULTIMESH || inst->mesh_instance.is_valid();
+		RenderElementInfo &element_info = rl->element_info[i];
+
+		element_info.lod_index = surface->sort.lod_index;
+		element_info.uses_forward_gi = surface->sort.uses_forward_gi;
+		element_info.uses_lightmap = surface->sort.uses_lightmap;
+	}
+}
+
+void RendererSceneRenderForward::_fill_instance_data(RenderListType p_render_list, uint32_t p_offset, int32_t p_max_elements, bool p_update_buffer) {
+	RenderList *rl = &render_list[p_render_list];
+	uint32_t element_total = p_max_elements >= 0 ? uint32_t(p_max_elements) : rl->elements.size();
 
-		if (prev_surface != nullptr && !cant_repeat && prev_surface->sort.sort_key1 == surface->sort.sort_key1 && prev_surface->sort.sort_key2 == surface->sort.sort_key2) {
-			//this element is the same as the previous one, count repeats to draw it using instancing
+	scene_state.instance_data[p_render_list].resize(p_offset + element_total);
+	rl->element_info.resize(p_offset + element_total);
+
+	FillInstanceDataParameters params;
+	params.render_list = p_render_list;
+	params.offset = p_offset;
+	params.element_total = element_total;
+
+	if (element_total > render_list_thread_threshold && RendererThreadPool::singleton->thread_work_pool.get_thread_count() > 0) {
+		params.chunk_count = RendererThreadPool::singleton->thread_work_pool.get_thread_count() + 1;
+		RendererThreadPool::singleton->thread_work_pool.do_work(params.chunk_count, this, &RendererSceneRenderForward::_fill_instance_data_chunk, &params);
+	} else {
+		_fill_instance_data_chunk(0, &params);
+	}
+
+	//count repeats backwards, each element stores how many elements (itself included) can be drawn with it using instancing
+	uint32_t repeats = 0;
+	GeometryInstanceSurfaceDataCache *next_surface = nullptr;
+	for (uint32_t i = element_total; i > 0; i--) {
+		uint32_t index = p_offset + i - 1;
+		GeometryInstanceSurfaceDataCache *surface = rl->elements[index];
+		GeometryInstanceForward *inst = surface->owner;
+
+		bool cant_repeat = inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH || inst->mesh_instance.is_valid();
+
+		if (next_surface != nullptr && !cant_repeat && next_surface->sort.sort_key1 == surface->sort.sort_key1 && next_surface->sort.sort_key2 == surface->sort.sort_key2) {
 			repeats++;
 		} else {
-			if (repeats > 0) {
-				for (uint32_t j = 1; j <= repeats; j++) {
-					rl->element_info[p_offset + i - j].repeat = j;
-				}
-			}
 			repeats = 1;
 		}
 
-		RenderElementInfo &element_info = rl->element_info[p_offset + i];
-
-		element_info.lod_index = surface->sort.lod_index;
-		element_info.uses_forward_gi = surface->sort.uses_forward_gi;
-		element_info.uses_lightmap = surface->sort.uses_lightmap;
+		rl->element_info[index].repeat = repeats;
 
 		if (cant_repeat) {
-			prev_surface = nullptr;
+			next_surface = nullptr;
 		} else {
-			prev_surface = surface;
-		}
-	}
-
-	if (repeats > 0) {
-		for (uint32_t j = 1; j <= repeats; j++) {
-			rl->element_info[p_offset + element_total - j].repeat = j;
+			next_surface = surface;
 		}
 	}
 
@@ -1355,44 +1512,29 @@ void RendererSceneRenderForward::_fill_instance_data(RenderListType p_render_lis
 	}
 }
 
-void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list, const PagedArray<GeometryInstance *> &p_instances, PassMode p_pass_mode, const CameraMatrix &p_cam_projection, const Transform &p_cam_transform, bool p_using_sdfgi, bool p_using_opaque_gi, const Plane &p_lod_plane, float p_lod_distance_multiplier, float p_screen_lod_threshold, bool p_append) {
-	if (p_render_list == RENDER_LIST_OPAQUE) {
-		scene_state.used_sss = false;
-		scene_state.used_screen_texture = false;
-		scene_state.used_normal_texture = false;
-		scene_state.used_depth_texture = false;
-	}
-	uint32_t lightmap_captures_used = 0;
-
-	Plane near_plane(p_cam_transform.origin, -p_cam_transform.basis.get_axis(Vector3::AXIS_Z));
-	near_plane.d += p_cam_projection.get_z_near();
-	float z_max = p_cam_projection.get_z_far() - p_cam_projection.get_z_near();
-
-	RenderList *rl = &render_list[p_render_list];
-	_update_dirty_geometry_instances();
-
-	if (!p_append) {
-		rl->clear();
-		if (p_render_list == RENDER_LIST_OPAQUE) {
-			render_list[RENDER_LIST_ALPHA].clear(); //opaque fills alpha too
-		}
-	}
+void RendererSceneRenderForward::_fill_render_list_chunk(uint32_t p_chunk, FillRenderListParameters *p_params) {
+	FillRenderListChunk &chunk = fill_render_list_chunks[p_chunk];
+	const PagedArray<GeometryInstance *> &instances = *p_params->instances;
+	uint32_t instance_total = instances.size();
+	uint32_t from = p_chunk * instance_total / p_params->chunk_count;
+	uint32_t to = (p_chunk + 1 == p_params->chunk_count) ? instance_total : ((p_chunk + 1) * instance_total / p_params->chunk_count);
 
-	//fill list
+	const Plane &near_plane = p_params->near_plane;
+	const Plane &lod_plane = p_params->lod_plane;
 
-	for (int i = 0; i < (int)p_instances.size(); i++) {
-		GeometryInstanceForward *inst = static_cast<GeometryInstanceForward *>(p_instances[i]);
+	for (uint32_t i = from; i < to; i++) {
+		GeometryInstanceForward *inst = static_cast<GeometryInstanceForward *>(instances[i]);
 
 		Vector3 support_min = inst->transformed_aabb.get_support(-near_plane.normal);
 		inst->depth = near_plane.distance_to(support_min);
-		uint32_t depth_layer = CLAMP(int(inst->depth * 16 / z_max), 0, 15);
+		uint32_t depth_layer = CLAMP(int(inst->depth * 16 / p_params->z_max), 0, 15);
 
 		uint32_t flags = inst->base_flags; //fill flags if appropriate
 
 		bool uses_lightmap = false;
 		bool uses_gi = false;
 
-		if (p_render_list == RENDER_LIST_OPAQUE) {
+		if (p_params->render_list == RENDER_LIST_OPAQUE) {
 			//setup GI
 
 			if (inst->lightmap_instance.is_valid()) {
@@ -1416,9 +1558,11 @@ void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list,
 				}
 
 			} else if (inst->lightmap_sh) {
-				if (lightmap_captures_used < scene_state.max_lightmap_captures) {
+				//captures are claimed atomically, so their order depends on thread timing but indices are always unique
+				uint32_t capture_index = atomic_increment(&p_params->lightmap_captures_used) - 1;
+				if (capture_index < scene_state.max_lightmap_captures) {
 					const Color *src_capture = inst->lightmap_sh->sh;
-					LightmapCaptureData &lcd = scene_state.lightmap_captures[lightmap_captures_used];
+					LightmapCaptureData &lcd = scene_state.lightmap_captures[capture_index];
 					for (int j = 0; j < 9; j++) {
 						lcd.sh[j * 4 + 0] = src_capture[j].r;
 						lcd.sh[j * 4 + 1] = src_capture[j].g;
@@ -1426,13 +1570,12 @@ void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list,
 						lcd.sh[j * 4 + 3] = src_capture[j].a;
 					}
 					flags |= INSTANCE_DATA_FLAG_USE_LIGHTMAP_CAPTURE;
-					inst->gi_offset_cache = lightmap_captures_used;
-					lightmap_captures_used++;
+					inst->gi_offset_cache = capture_index;
 					uses_lightmap = true;
 				}
 
 			} else if (!low_end) {
-				if (p_using_opaque_gi) {
+				if (p_params->using_opaque_gi) {
 					flags |= INSTANCE_DATA_FLAG_USE_GI_BUFFERS;
 				}
 
@@ -1457,7 +1600,7 @@ void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list,
 					flags |= INSTANCE_DATA_FLAG_USE_GIPROBE;
 					uses_gi = true;
 				} else {
-					if (p_using_sdfgi && inst->can_sdfgi) {
+					if (p_params->using_sdfgi && inst->can_sdfgi) {
 						flags |= INSTANCE_DATA_FLAG_USE_SDFGI;
 						uses_gi = true;
 					}
@@ -1475,13 +1618,13 @@ void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list,
 
 			// LOD
 
-			if (p_screen_lod_threshold > 0.0 && storage->mesh_surface_has_lod(surf->surface)) {
+			if (p_params->screen_lod_threshold > 0.0 && storage->mesh_surface_has_lod(surf->surface)) {
 				//lod
-				Vector3 lod_support_min = inst->transformed_aabb.get_support(-p_lod_plane.normal);
-				Vector3 lod_support_max = inst->transformed_aabb.get_support(p_lod_plane.normal);
+				Vector3 lod_support_min = inst->transformed_aabb.get_support(-lod_plane.normal);
+				Vector3 lod_support_max = inst->transformed_aabb.get_support(lod_plane.normal);
 
-				float distance_min = p_lod_plane.distance_to(lod_support_min);
-				float distance_max = p_lod_plane.distance_to(lod_support_max);
+				float distance_min = lod_plane.distance_to(lod_support_min);
+				float distance_max = lod_plane.distance_to(lod_support_max);
 
 				float distance = 0.0;
 
@@ -1494,18 +1637,18 @@ void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list,
 					distance = -distance_max;
 				}
 
-				surf->sort.lod_index = storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, distance * p_lod_distance_multiplier, p_screen_lod_threshold);
+				surf->sort.lod_index = storage->mesh_surface_get_lod(surf->surface, inst->lod_model_scale * inst->lod_bias, distance * p_params->lod_distance_multiplier, p_params->screen_lod_threshold);
 			} else {
 				surf->sort.lod_index = 0;
 			}
 
 			// ADD Element
-			if (p_pass_mode == PASS_MODE_COLOR) {
+			if (p_params->pass_mode == PASS_MODE_COLOR) {
 				if (surf->flags & (GeometryInstanceSurfaceDataCache::FLAG_PASS_DEPTH | GeometryInstanceSurfaceDataCache::FLAG_PASS_OPAQUE)) {
-					rl->add_element(surf);
+					chunk.elements.push_back(surf);
 				}
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_ALPHA) {
-					render_list[RENDER_LIST_ALPHA].add_element(surf);
+					chunk.alpha_elements.push_back(surf);
 					if (uses_gi) {
 						surf->sort.uses_forward_gi = 1;
 					}
@@ -1516,25 +1659,25 @@ void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list,
 				}
 
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_SUBSURFACE_SCATTERING) {
-					scene_state.used_sss = true;
+					chunk.used_sss = true;
 				}
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_SCREEN_TEXTURE) {
-					scene_state.used_screen_texture = true;
+					chunk.used_screen_texture = true;
 				}
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_NORMAL_TEXTURE) {
-					scene_state.used_normal_texture = true;
+					chunk.used_normal_texture = true;
 				}
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_DEPTH_TEXTURE) {
-					scene_state.used_depth_texture = true;
+					chunk.used_depth_texture = true;
 				}
 
-			} else if (p_pass_mode == PASS_MODE_SHADOW || p_pass_mode == PASS_MODE_SHADOW_DP) {
+			} else if (p_params->pass_mode == PASS_MODE_SHADOW || p_params->pass_mode == PASS_MODE_SHADOW_DP) {
 				if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_SHADOW) {
-					rl->add_element(surf);
+					chunk.elements.push_back(surf);
 				}
 			} else {
 				if (surf->flags & (GeometryInstanceSurfaceDataCache::FLAG_PASS_DEPTH | GeometryInstanceSurfaceDataCache::FLAG_PASS_OPAQUE)) {
-					rl->add_element(surf);
+					chunk.elements.push_back(surf);
 				}
 			}
 
@@ -1543,12 +1686,213 @@ void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list,
 			surf = surf->next;
 		}
 	}
+}
+
+void RendererSceneRenderForward::_fill_render_list(RenderListType p_render_list, const PagedArray<GeometryInstance *> &p_instances, PassMode p_pass_mode, const CameraMatrix &p_cam_projection, const Transform &p_cam_transform, bool p_using_sdfgi, bool p_using_opaque_gi, const Plane &p_lod_plane, float p_lod_distance_multiplier, float p_screen_lod_threshold, bool p_append) {
+	if (p_render_list == RENDER_LIST_OPAQUE) {
+		scene_state.used_sss = false;
+		scene_state.used_screen_texture = false;
+		scene_state.used_normal_texture = false;
+		scene_state.used_depth_texture = false;
+	}
+
+	FillRenderListParameters params;
+	params.instances = &p_instances;
+	params.render_list = p_render_list;
+	params.pass_mode = p_pass_mode;
+	params.near_plane = Plane(p_cam_transform.origin, -p_cam_transform.basis.get_axis(Vector3::AXIS_Z));
+	params.near_plane.d += p_cam_projection.get_z_near();
+	params.z_max = p_cam_projection.get_z_far() - p_cam_projection.get_z_near();
+	params.using_sdfgi = p_using_sdfgi;
+	params.using_opaque_gi = p_using_opaque_gi;
+	params.lod_plane = p_lod_plane;
+	params.lod_distance_multiplier = p_lod_distance_multiplier;
+	params.screen_lod_threshold = p_screen_lod_threshold;
+
+	RenderList *rl = &render_list[p_render_list];
+	_update_dirty_geometry_instances();
+
+	if (!p_append) {
+		rl->clear();
+		if (p_render_list == RENDER_LIST_OPAQUE) {
+			render_list[RENDER_LIST_ALPHA].clear(); //opaque fills alpha too
+		}
+	}
+
+	//fill list, each chunk collects its own elements so no locking is needed
+
+	if (p_instances.size() > render_list_thread_threshold && RendererThreadPool::singleton->thread_work_pool.get_thread_count() > 0) {
+		params.chunk_count = RendererThreadPool::singleton->thread_work_pool.get_thread_count() + 1;
+	}
+
+	if (fill_render_list_chunks.size() < params.chunk_count) {
+		fill_render_list_chunks.resize(params.chunk_count);
+	}
+
+	for (uint32_t i = 0; i < params.chunk_count; i++) {
+		FillRenderListChunk &chunk = fill_render_list_chunks[i];
+		chunk.elements.clear();
+		chunk.alpha_elements.clear();
+		chunk.used_sss = false;
+		chunk.used_screen_texture = false;
+		chunk.used_normal_texture = false;
+		chunk.used_depth_texture = false;
+	}
+
+	if (params.chunk_count > 1) {
+		RendererThreadPool::singleton->thread_work_pool.do_work(params.chunk_count, this, &RendererSceneRenderForward::_fill_render_list_chunk, &params);
+	} else {
+		_fill_render_list_chunk(0, &params);
+	}
+
+	//merge chunks in instance order, so the result matches a serial fill
+
+	for (uint32_t i = 0; i < params.chunk_count; i++) {
+		FillRenderListChunk &chunk = fill_render_list_chunks[i];
+		for (uint32_t j = 0; j < chunk.elements.size(); j++) {
+			rl->add_element(chunk.elements[j]);
+		}
+		for (uint32_t j = 0; j < chunk.alpha_elements.size(); j++) {
+			render_list[RENDER_LIST_ALPHA].add_element(chunk.alpha_elements[j]);
+		}
+		scene_state.used_sss = scene_state.used_sss || chunk.used_sss;
+		scene_state.used_screen_texture = scene_state.used_screen_texture || chunk.used_screen_texture;
+		scene_state.used_normal_texture = scene_state.used_normal_texture || chunk.used_normal_texture;
+		scene_state.used_depth_texture = scene_state.used_depth_texture || chunk.used_depth_texture;
+	}
+
+	uint32_t lightmap_captures_used = MIN(uint32_t(params.lightmap_captures_used), scene_state.max_lightmap_captures);
 
 	if (p_render_list == RENDER_LIST_OPAQUE && lightmap_captures_used) {
 		RD::get_singleton()->buffer_update(scene_state.lightmap_capture_buffer, 0, sizeof(LightmapCaptureData) * lightmap_captures_used, scene_state.lightmap_captures, RD::BARRIER_MASK_RASTER);
 	}
 }
 
+void RendererSceneRenderForward::_radix_sort_fill_chunk(uint32_t p_chunk, RenderListRadixSort *p_sort) {
+	uint32_t from = p_chunk * p_sort->element_count / p_sort->chunk_count;
+	uint32_t to = (p_chunk + 1 == p_sort->chunk_count) ? p_sort->element_count : ((p_chunk + 1) * p_sort->element_count / p_sort->chunk_count);
+
+	//histograms for every key byte are gathered at once, the first pass and the skipped byte check use them directly
+	uint32_t *histogram = p_sort->histograms.ptr() + p_chunk * RENDER_LIST_RADIX_HISTOGRAM_SIZE;
+	memset(histogram, 0, sizeof(uint32_t) * RENDER_LIST_RADIX_HISTOGRAM_SIZE);
+
+	RenderListRadixSort::Element *elements = p_sort->elements[0].ptr();
+
+	for (uint32_t i = from; i < to; i++) {
+		GeometryInstanceSurfaceDataCache *surface = p_sort->source[i];
+		RenderListRadixSort::Element &e = elements[i];
+		e.key1 = surface->sort.sort_key1;
+		e.key2 = surface->sort.sort_key2;
+		e.surface = surface;
+
+		for (uint32_t j = 0; j < 8; j++) {
+			histogram[j * RENDER_LIST_RADIX_BUCKETS + ((e.key1 >> (j * 8)) & 0xFF)]++;
+			histogram[(j + 8) * RENDER_LIST_RADIX_BUCKETS + ((e.key2 >> (j * 8)) & 0xFF)]++;
+		}
+	}
+}
+
+void RendererSceneRenderForward::_radix_sort_histogram_chunk(uint32_t p_chunk, RenderListRadixSort *p_sort) {
+	uint32_t from = p_chunk * p_sort->element_count / p_sort->chunk_count;
+	uint32_t to = (p_chunk + 1 == p_sort->chunk_count) ? p_sort->element_count : ((p_chunk + 1) * p_sort->element_count / p_sort->chunk_count);
+
+	uint32_t *histogram = p_sort->histograms.ptr() + p_chunk * RENDER_LIST_RADIX_HISTOGRAM_SIZE + p_sort->pass_byte * RENDER_LIST_RADIX_BUCKETS;
+	memset(histogram, 0, sizeof(uint32_t) * RENDER_LIST_RADIX_BUCKETS);
+
+	const RenderListRadixSort::Element *elements = p_sort->elements[p_sort->pass_source].ptr();
+
+	for (uint32_t i = from; i < to; i++) {
+		histogram[elements[i].get_digit(p_sort->pass_byte)]++;
+	}
+}
+
+void RendererSceneRenderForward::_radix_sort_scatter_chunk(uint32_t p_chunk, RenderListRadixSort *p_sort) {
+	uint32_t from = p_chunk * p_sort->element_count / p_sort->chunk_count;
+	uint32_t to = (p_chunk + 1 == p_sort->chunk_count) ? p_sort->element_count : ((p_chunk + 1) * p_sort->element_count / p_sort->chunk_count);
+
+	uint32_t *offsets = p_sort->histograms.ptr() + p_chunk * RENDER_LIST_RADIX_HISTOGRAM_SIZE + p_sort->pass_byte * RENDER_LIST_RADIX_BUCKETS;
+
+	const RenderListRadixSort::Element *src = p_sort->elements[p_sort->pass_source].ptr();
+	RenderListRadixSort::Element *dst = p_sort->elements[p_sort->pass_source ^ 1].ptr();
+
+	for (uint32_t i = from; i < to; i++) {
+		dst[offsets[src[i].get_digit(p_sort->pass_byte)]++] = src[i];
+	}
+}
+
+void RendererSceneRenderForward::_sort_render_list_by_key(RenderListType p_render_list, uint32_t p_from, int32_t p_size) {
+	RenderList *rl = &render_list[p_render_list];
+	uint32_t size = p_size >= 0 ? uint32_t(p_size) : rl->elements.size() - p_from;
+
+	if (size <= render_list_thread_threshold || RendererThreadPool::singleton->thread_work_pool.get_thread_count() == 0) {
+		//small lists are faster to sort in place
+		rl->sort_by_key_range(p_from, size);
+		return;
+	}
+
+	//least significant digit radix sort, each pass is split in chunks that scatter stably into their own ranges of every bucket
+
+	RenderListRadixSort *sort = &render_list_radix_sort;
+	sort->source = rl->elements.ptr() + p_from;
+	sort->element_count = size;
+	sort->chunk_count = RendererThreadPool::singleton->thread_work_pool.get_thread_count() + 1;
+	sort->elements[0].resize(size);
+	sort->elements[1].resize(size);
+	sort->histograms.resize(sort->chunk_count * RENDER_LIST_RADIX_HISTOGRAM_SIZE);
+
+	RendererThreadPool::singleton->thread_work_pool.do_work(sort->chunk_count, this, &RendererSceneRenderForward::_radix_sort_fill_chunk, sort);
+
+	sort->pass_source = 0;
+	bool histograms_valid = true;
+
+	for (uint32_t i = 0; i < RENDER_LIST_RADIX_KEY_BYTES; i++) {
+		//most key bytes are the same for every element (ids use few bits), sorting by them would not change the order
+		bool skip = false;
+		for (uint32_t j = 0; j < RENDER_LIST_RADIX_BUCKETS; j++) {
+			uint32_t count = 0;
+			for (uint32_t k = 0; k < sort->chunk_count; k++) {
+				count += sort->histograms[k * RENDER_LIST_RADIX_HISTOGRAM_SIZE + i * RENDER_LIST_RADIX_BUCKETS + j];
+			}
+			if (count == size) {
+				skip = true;
+				break;
+			} else if (count > 0) {
+				break;
+			}
+		}
+
+		if (skip) {
+			continue;
+		}
+
+		sort->pass_byte = i;
+
+		if (!histograms_valid) {
+			//a previous pass reordered the elements, so per chunk counts must be gathered again
+			RendererThreadPool::singleton->thread_work_pool.do_work(sort->chunk_count, this, &RendererSceneRenderForward::_radix_sort_histogram_chunk, sort);
+		}
+		histograms_valid = false;
+
+		uint32_t offset = 0;
+		for (uint32_t j = 0; j < RENDER_LIST_RADIX_BUCKETS; j++) {
+			for (uint32_t k = 0; k < sort->chunk_count; k++) {
+				uint32_t &h = sort->histograms[k * RENDER_LIST_RADIX_HISTOGRAM_SIZE + i * RENDER_LIST_RADIX_BUCKETS + j];
+				uint32_t count = h;
+				h = offset;
+				offset += count;
+			}
+		}
+
+		RendererThreadPool::singleton->thread_work_pool.do_work(sort->chunk_count, this, &RendererSceneRenderForward::_radix_sort_scatter_chunk, sort);
+		sort->pass_source ^= 1;
+	}
+
+	const RenderListRadixSort::Element *sorted = sort->elements[sort->pass_source].ptr();
+	for (uint32_t i = 0; i < size; i++) {
+		sort->source[i] = sorted[i].surface;
+	}
+}
+
 void RendererSceneRenderForward::_setup_giprobes(const PagedArray<RID> &p_giprobes) {
 	scene_state.giprobes_used = MIN(p_giprobes.size(), uint32_t(MAX_GI_PROBES));
 	for (uint32_t i = 0; i < scene_state.giprobes_used; i++) {
@@ -1578,6 +1922,154 @@ void RendererSceneRenderForward::_setup_lightmaps(const PagedArray<RID> &p_light
 	}
 }
 
+void RendererSceneRenderForward::_cull_mesh_clusters(const CameraMatrix &p_cam_projection, const Transform &p_cam_transform) {
+	RenderList &rl = render_list[RENDER_LIST_OPAQUE];
+	uint32_t element_total = rl.elements.size();
+
+	//assign draw ranges first, so the buffer can be sized before dispatching
+	uint32_t draw_total = 0;
+	uint32_t dispatch_count = 0;
+
+	for (uint32_t i = 0; i < element_total; i++) {
+		GeometryInstanceSurfaceDataCache *surf = rl.elements[i];
+		surf->cluster_draw_offset = GeometryInstanceSurfaceDataCache::NO_CLUSTER_DRAW;
+		surf->cluster_draw_offset_shadow = GeometryInstanceSurfaceDataCache::NO_CLUSTER_DRAW;
+		surf->cluster_count = 0;
+		surf->cluster_count_shadow = 0;
+
+		if (!mesh_cluster_cull.enabled || surf->owner->data->base_type != RS::INSTANCE_MESH || surf->owner->mesh_instance.is_valid() || rl.element_info[i].lod_index != 0) {
+			continue;
+		}
+
+		uint32_t cluster_count = storage->mesh_surface_get_cluster_count(surf->surface);
+		if (cluster_count > 0 && cluster_count <= mesh_cluster_cull.max_draw_count && !surf->shader->uses_vertex && !surf->shader->writes_modelview_or_projection) {
+			surf->cluster_draw_offset = draw_total;
+			surf->cluster_count = cluster_count;
+			draw_total += cluster_count;
+			dispatch_count++;
+		}
+
+		if (surf->surface_shadow == surf->surface && surf->shader_shadow == surf->shader) {
+			surf->cluster_draw_offset_shadow = surf->cluster_draw_offset;
+			surf->cluster_count_shadow = surf->cluster_count;
+			continue;
+		}
+
+		cluster_count = surf->surface_shadow ? storage->mesh_surface_get_cluster_count(surf->surface_shadow) : 0;
+		if (cluster_count > 0 && cluster_count <= mesh_cluster_cull.max_draw_count && !surf->shader_shadow->uses_vertex && !surf->shader_shadow->writes_modelview_or_projection) {
+			surf->cluster_draw_offset_shadow = draw_total;
+			surf->cluster_count_shadow = cluster_count;
+			draw_total += cluster_count;
+			dispatch_count++;
+		}
+	}
+
+	if (dispatch_count == 0) {
+		return;
+	}
+
+	if (draw_total > mesh_cluster_cull.draw_buffer_size) {
+		if (mesh_cluster_cull.draw_buffer.is_valid()) {
+			RD::get_singleton()->free(mesh_cluster_cull.draw_buffer);
+		}
+		mesh_cluster_cull.draw_buffer_size = next_power_of_2(draw_total);
+		mesh_cluster_cull.draw_buffer = RD::get_singleton()->storage_buffer_create(mesh_cluster_cull.draw_buffer_size * MeshClusterCull::DRAW_COMMAND_SIZE, Vector<uint8_t>(), RD::STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT);
+
+		Vector<RD::Uniform> uniforms;
+		{
+			RD::Uniform u;
+			u.binding = 0;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.ids.push_back(mesh_cluster_cull.draw_buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.binding = 1;
+			u.uniform_type = RD::UNIFORM_TYPE_UNIFORM_BUFFER;
+			u.ids.push_back(mesh_cluster_cull.params_buffer);
+			uniforms.push_back(u);
+		}
+		mesh_cluster_cull.draw_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, mesh_cluster_cull.shader_rd, 1);
+	}
+
+	MeshClusterCull::Params params;
+	Vector<Plane> planes = p_cam_projection.get_projection_planes(p_cam_transform);
+	ERR_FAIL_COND(planes.size() != 6);
+	for (int i = 0; i < 6; i++) {
+		params.planes[i][0] = planes[i].normal.x;
+		params.planes[i][1] = planes[i].normal.y;
+		params.planes[i][2] = planes[i].normal.z;
+		params.planes[i][3] = planes[i].d;
+	}
+	Vector3 camera_position = p_cam_transform.origin;
+	Vector3 camera_direction = -p_cam_transform.basis.get_axis(Vector3::AXIS_Z).normalized();
+	params.camera_position[0] = camera_position.x;
+	params.camera_position[1] = camera_position.y;
+	params.camera_position[2] = camera_position.z;
+	params.orthogonal = p_cam_projection.is_orthogonal();
+	params.camera_direction[0] = camera_direction.x;
+	params.camera_direction[1] = camera_direction.y;
+	params.camera_direction[2] = camera_direction.z;
+	params.pad = 0;
+	RD::get_singleton()->buffer_update(mesh_cluster_cull.params_buffer, 0, sizeof(MeshClusterCull::Params), &params, RD::BARRIER_MASK_COMPUTE);
+
+	RD::get_singleton()->draw_command_begin_label("Cull Mesh Clusters");
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, mesh_cluster_cull.pipeline);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, mesh_cluster_cull.draw_uniform_set, 1);
+
+	for (uint32_t i = 0; i < element_total; i++) {
+		const GeometryInstanceSurfaceDataCache *surf = rl.elements[i];
+		if (surf->cluster_draw_offset == GeometryInstanceSurfaceDataCache::NO_CLUSTER_DRAW && surf->cluster_draw_offset_shadow == GeometryInstanceSurfaceDataCache::NO_CLUSTER_DRAW) {
+			continue;
+		}
+
+		const Transform &xform = surf->owner->transform;
+
+		MeshClusterCull::PushConstant push_constant;
+		for (int j = 0; j < 3; j++) {
+			push_constant.transform[j * 4 + 0] = xform.basis.elements[j][0];
+			push_constant.transform[j * 4 + 1] = xform.basis.elements[j][1];
+			push_constant.transform[j * 4 + 2] = xform.basis.elements[j][2];
+			push_constant.transform[j * 4 + 3] = xform.origin[j];
+		}
+		Vector3 scale = xform.basis.get_scale_abs();
+		push_constant.max_scale = MAX(scale.x, MAX(scale.y, scale.z));
+
+		//facing is only known for back face culled materials, and mirroring or non uniform scale break the normal cones
+		bool can_cone_cull = !surf->owner->mirror && !surf->owner->non_uniform_scale;
+
+		for (int j = 0; j < 2; j++) {
+			uint32_t draw_offset = j == 0 ? surf->cluster_draw_offset : surf->cluster_draw_offset_shadow;
+			if (draw_offset == GeometryInstanceSurfaceDataCache::NO_CLUSTER_DRAW || (j == 1 && draw_offset == surf->cluster_draw_offset)) {
+				continue;
+			}
+
+			const ShaderData *shader = j == 0 ? surf->shader : surf->shader_shadow;
+			void *mesh_surface = j == 0 ? surf->surface : surf->surface_shadow;
+
+			bool cone_cull = can_cone_cull && shader->cull_mode == ShaderData::CULL_BACK;
+			if (j == 0 && surf->cluster_draw_offset_shadow == draw_offset) {
+				cone_cull = cone_cull && surf->shader_shadow->cull_mode == ShaderData::CULL_BACK; //draws shared with the depth pass
+			}
+
+			push_constant.cluster_count = j == 0 ? surf->cluster_count : surf->cluster_count_shadow;
+			push_constant.draw_offset = draw_offset;
+			push_constant.flags = cone_cull ? MeshClusterCull::FLAG_CONE_CULL : 0;
+
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, storage->mesh_surface_get_cluster_uniform_set(mesh_surface, mesh_cluster_cull.shader_rd, 0), 0);
+			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(MeshClusterCull::PushConstant));
+			RD::get_singleton()->compute_list_dispatch_threads(compute_list, push_constant.cluster_count, 1, 1);
+		}
+	}
+
+	RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_RASTER);
+
+	RD::get_singleton()->draw_command_end_label();
+}
+
 void RendererSceneRenderForward::_render_scene(RID p_render_buffer, const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_ortogonal, const PagedArray<GeometryInstance *> &p_instances, const PagedArray<RID> &p_gi_probes, const PagedArray<RID> &p_lightmaps, RID p_environment, RID p_cluster_buffer, uint32_t p_cluster_size, uint32_t p_max_cluster_elements, RID p_camera_effects, RID p_shadow_atlas, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass, const Color &p_default_bg_color, float p_screen_lod_threshold) {
 	RenderBufferDataForward *render_buffer = nullptr;
 	if (p_render_buffer.is_valid()) {
@@ -1694,13 +2186,15 @@ void RendererSceneRenderForward::_render_scene(RID p_render_buffer, const Transf
 	_update_render_base_uniform_set(); //may have changed due to the above (light buffer enlarged, as an example)
 
 	_fill_render_list(RENDER_LIST_OPAQUE, p_instances, PASS_MODE_COLOR, p_cam_projection, p_cam_transform, using_sdfgi, using_sdfgi || using_giprobe, lod_camera_plane, lod_distance_multiplier, p_screen_lod_threshold);
-	render_list[RENDER_LIST_OPAQUE].sort_by_key();
+	_sort_render_list_by_key(RENDER_LIST_OPAQUE);
 	render_list[RENDER_LIST_ALPHA].sort_by_depth();
 	_fill_instance_data(RENDER_LIST_OPAQUE);
 	_fill_instance_data(RENDER_LIST_ALPHA);
 
 	RD::get_singleton()->draw_command_end_label();
 
+	_cull_mesh_clusters(p_cam_projection, p_cam_transform);
+
 	bool using_sss = !low_end && render_buffer && scene_state.used_sss && sub_surface_scattering_get_quality() != RS::SUB_SURFACE_SCATTERING_QUALITY_DISABLED;
 
 	if (using_sss) {
@@ -1811,6 +2305,7 @@ void RendererSceneRenderForward::_render_scene(RID p_render_buffer, const Transf
 
 		bool finish_depth = using_ssao || using_sdfgi || using_giprobe;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), false, depth_pass_mode, render_buffer == nullptr, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), lod_camera_plane, lod_distance_multiplier, p_screen_lod_threshold);
+		render_list_params.use_mesh_clusters = true;
 		_render_list_with_threads(&render_list_params, depth_framebuffer, needs_pre_resolve ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_READ, needs_pre_resolve ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_CLEAR, finish_depth ? RD::FINAL_ACTION_READ : RD::FINAL_ACTION_CONTINUE, needs_pre_resolve ? Vector<Color>() : depth_pass_clear);
 
 		RD::get_singleton()->draw_command_end_label();
@@ -1869,6 +2364,7 @@ void RendererSceneRenderForward::_render_scene(RID p_render_buffer, const Transf
 
 		RID framebuffer = using_separate_specular ? opaque_specular_framebuffer : opaque_framebuffer;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), false, using_separate_specular ? PASS_MODE_COLOR_SPECULAR : PASS_MODE_COLOR, render_buffer == nullptr, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), lod_camera_plane, lod_distance_multiplier, p_screen_lod_threshold);
+		render_list_params.use_mesh_clusters = true;
 		_render_list_with_threads(&render_list_params, framebuffer, keep_color ? RD::INITIAL_ACTION_KEEP : RD::INITIAL_ACTION_CLEAR, will_continue_color ? RD::FINAL_ACTION_CONTINUE : RD::FINAL_ACTION_READ, depth_pre_pass ? (continue_depth ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_KEEP) : RD::INITIAL_ACTION_CLEAR, will_continue_depth ? RD::FINAL_ACTION_CONTINUE : RD::FINAL_ACTION_READ, c, 1.0, 0);
 		if (will_continue_color && using_separate_specular) {
 			// close the specular framebuffer, as it's no longer used
@@ -2006,7 +2502,7 @@ void RendererSceneRenderForward::_render_shadow_append(RID p_framebuffer, const
 	uint32_t render_list_from = render_list[RENDER_LIST_SECONDARY].elements.size();
 	_fill_render_list(RENDER_LIST_SECONDARY, p_instances, pass_mode, p_projection, p_transform, false, false, p_camera_plane, p_lod_distance_multiplier, p_screen_lod_threshold, true);
 	uint32_t render_list_size = render_list[RENDER_LIST_SECONDARY].elements.size() - render_list_from;
-	render_list[RENDER_LIST_SECONDARY].sort_by_key_range(render_list_from, render_list_size);
+	_sort_render_list_by_key(RENDER_LIST_SECONDARY, render_list_from, render_list_size);
 	_fill_instance_data(RENDER_LIST_SECONDARY, render_list_from, render_list_size, false);
 
 	{
@@ -2027,7 +2523,8 @@ void RendererSceneRenderForward::_render_shadow_append(RID p_framebuffer, const
 		shadow_pass.lod_distance_multiplier = p_lod_distance_multiplier;
 
 		shadow_pass.framebuffer = p_framebuffer;
-		shadow_pass.initial_depth_action = p_begin ? (p_clear_region ? RD::INITIAL_ACTION_CLEAR_REGION : RD::INITIAL_ACTION_CLEAR) : (p_clear_region ? RD::INITIAL_ACTION_CLEAR_REGION_CONTINUE : RD::INITIAL_ACTION_CONTINUE);
+		// Without a region clear, keep the contents, as cached static shadows are copied in before.
+		shadow_pass.initial_depth_action = p_begin ? (p_clear_region ? RD::INITIAL_ACTION_CLEAR_REGION : RD::INITIAL_ACTION_KEEP) : (p_clear_region ? RD::INITIAL_ACTION_CLEAR_REGION_CONTINUE : RD::INITIAL_ACTION_CONTINUE);
 		shadow_pass.final_depth_action = p_end ? RD::FINAL_ACTION_READ : RD::FINAL_ACTION_CONTINUE;
 		shadow_pass.rect = p_rect;
 
@@ -2075,7 +2572,7 @@ void RendererSceneRenderForward::_render_particle_collider_heightfield(RID p_fb,
 	PassMode pass_mode = PASS_MODE_SHADOW;
 
 	_fill_render_list(RENDER_LIST_SECONDARY, p_instances, pass_mode, p_cam_projection, p_cam_transform);
-	render_list[RENDER_LIST_SECONDARY].sort_by_key();
+	_sort_render_list_by_key(RENDER_LIST_SECONDARY);
 	_fill_instance_data(RENDER_LIST_SECONDARY);
 
 	RID rp_uniform_set = _setup_render_pass_uniform_set(RENDER_LIST_SECONDARY, RID(), RID(), RID(), RID(), RID(), PagedArray<RID>(), PagedArray<RID>());
@@ -2104,7 +2601,7 @@ void RendererSceneRenderForward::_render_material(const Transform &p_cam_transfo
 
 	PassMode pass_mode = PASS_MODE_DEPTH_MATERIAL;
 	_fill_render_list(RENDER_LIST_SECONDARY, p_instances, pass_mode, p_cam_projection, p_cam_transform);
-	render_list[RENDER_LIST_SECONDARY].sort_by_key();
+	_sort_render_list_by_key(RENDER_LIST_SECONDARY);
 	_fill_instance_data(RENDER_LIST_SECONDARY);
 
 	RID rp_uniform_set = _setup_render_pass_uniform_set(RENDER_LIST_SECONDARY, RID(), RID(), RID(), RID(), RID(), PagedArray<RID>(), PagedArray<RID>());
@@ -2142,7 +2639,7 @@ void RendererSceneRenderForward::_render_uv2(const PagedArray<GeometryInstance *
 
 	PassMode pass_mode = PASS_MODE_DEPTH_MATERIAL;
 	_fill_render_list(RENDER_LIST_SECONDARY, p_instances, pass_mode, CameraMatrix(), Transform());
-	render_list[RENDER_LIST_SECONDARY].sort_by_key();
+	_sort_render_list_by_key(RENDER_LIST_SECONDARY);
 	_fill_instance_data(RENDER_LIST_SECONDARY);
 
 	RID rp_uniform_set = _setup_render_pass_uniform_set(RENDER_LIST_SECONDARY, RID(), RID(), RID(), RID(), RID(), PagedArray<RID>(), PagedArray<RID>());
@@ -2202,7 +2699,7 @@ void RendererSceneRenderForward::_render_sdfgi(RID p_render_buffers, const Vecto
 
 	PassMode pass_mode = PASS_MODE_SDF;
 	_fill_render_list(RENDER_LIST_SECONDARY, p_instances, pass_mode, CameraMatrix(), Transform());
-	render_list[RENDER_LIST_SECONDARY].sort_by_key();
+	_sort_render_list_by_key(RENDER_LIST_SECONDARY);
 	_fill_instance_data(RENDER_LIST_SECONDARY);
 
 	Vector3 half_extents = p_bounds.size * 0.5;
@@ -2892,6 +3389,7 @@ void RendererSceneRenderForward::_geometry_instance_add_surface_with_material(Ge
 
 	sdcache->shader = p_material->shader_data;
 	sdcache->material_uniform_set = p_material->uniform_set;
+	sdcache->material_index = p_material->get_material_index();
 	sdcache->surface = storage->mesh_get_surface(p_mesh, p_surface);
 	sdcache->primitive = storage->mesh_surface_get_primitive(sdcache->surface);
 	sdcache->surface_index = p_surface;
@@ -2903,6 +3401,7 @@ void RendererSceneRenderForward::_geometry_instance_add_surface_with_material(Ge
 	//shadow
 	sdcache->shader_shadow = material_shadow->shader_data;
 	sdcache->material_uniform_set_shadow = material_shadow->uniform_set;
+	sdcache->material_index_shadow = material_shadow->get_material_index();
 
 	sdcache->surface_shadow = surface_shadow ? surface_shadow : sdcache->surface;
 
@@ -3375,7 +3874,6 @@ RendererSceneRenderForward::RendererSceneRenderForward(RendererStorageRD *p_stor
 		shader_versions.push_back("\n#define MODE_RENDER_DEPTH\n#define MODE_RENDER_MATERIAL\n");
 		shader_versions.push_back("\n#define MODE_RENDER_DEPTH\n#define MODE_RENDER_SDF\n");
 		shader_versions.push_back("");
-		shader_versions.push_back("\n#define USE_FORWARD_GI\n");
 		shader_versions.push_back("\n#define MODE_MULTIPLE_RENDER_TARGETS\n");
 		shader_versions.push_back("\n#define USE_LIGHTMAP\n");
 		shader_versions.push_back("\n#define MODE_MULTIPLE_RENDER_TARGETS\n#define USE_LIGHTMAP\n");
@@ -3386,7 +3884,6 @@ RendererSceneRenderForward::RendererSceneRenderForward(RendererStorageRD *p_stor
 			shader.scene_shader.set_variant_enabled(SHADER_VERSION_DEPTH_PASS_WITH_NORMAL_AND_ROUGHNESS, false);
 			shader.scene_shader.set_variant_enabled(SHADER_VERSION_DEPTH_PASS_WITH_NORMAL_AND_ROUGHNESS_AND_GIPROBE, false);
 			shader.scene_shader.set_variant_enabled(SHADER_VERSION_DEPTH_PASS_WITH_SDF, false);
-			shader.scene_shader.set_variant_enabled(SHADER_VERSION_COLOR_PASS_WITH_FORWARD_GI, false);
 			shader.scene_shader.set_variant_enabled(SHADER_VERSION_COLOR_PASS_WITH_SEPARATE_SPECULAR, false);
 			shader.scene_shader.set_variant_enabled(SHADER_VERSION_LIGHTMAP_COLOR_PASS_WITH_SEPARATE_SPECULAR, false);
 		}
@@ -3625,6 +4122,20 @@ RendererSceneRenderForward::RendererSceneRenderForward(RendererStorageRD *p_stor
 	}
 
 	render_list_thread_threshold = GLOBAL_GET("rendering/forward_renderer/threaded_render_minimum_instances");
+
+	{
+		Vector<String> cull_modes;
+		cull_modes.push_back("");
+		mesh_cluster_cull.shader.initialize(cull_modes);
+		mesh_cluster_cull.shader_version = mesh_cluster_cull.shader.version_create();
+		mesh_cluster_cull.shader_rd = mesh_cluster_cull.shader.version_get_shader(mesh_cluster_cull.shader_version, 0);
+		mesh_cluster_cull.pipeline = RD::get_singleton()->compute_pipeline_create(mesh_cluster_cull.shader_rd);
+		mesh_cluster_cull.params_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(MeshClusterCull::Params));
+
+		//every cluster of a surface is a separate draw, so the device must allow that many in one indirect call
+		mesh_cluster_cull.max_draw_count = RD::get_singleton()->limit_get(RD::LIMIT_MAX_DRAW_INDIRECT_COUNT);
+		mesh_cluster_cull.enabled = GLOBAL_GET("rendering/forward_renderer/mesh_cluster_culling") && mesh_cluster_cull.max_draw_count > 1;
+	}
 }
 
 RendererSceneRenderForward::~RendererSceneRenderForward() {
@@ -3670,4 +4181,10 @@ RendererSceneRenderForward::~RendererSceneRenderForward() {
 		RD::get_singleton()->free(sdfgi_framebuffer_size_cache.front()->get());
 		sdfgi_framebuffer_size_cache.erase(sdfgi_framebuffer_size_cache.front());
 	}
+
+	if (mesh_cluster_cull.draw_buffer.is_valid()) {
+		RD::get_singleton()->free(mesh_cluster_cull.draw_buffer);
+	}
+	RD::get_singleton()->free(mesh_cluster_cull.params_buffer);
+	mesh_cluster_cull.shader.version_free(mesh_cluster_cull.shader_version);
 }
@@ -35,6 +35,7 @@
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 #include "servers/rendering/renderer_rd/renderer_storage_rd.h"
+#include "servers/rendering/renderer_rd/shaders/mesh_cluster_cull.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/scene_forward.glsl.gen.h"
 
 class RendererSceneRenderForward : public RendererSceneRenderRD {
@@ -71,13 +72,18 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 		SHADER_VERSION_DEPTH_PASS_WITH_MATERIAL,
 		SHADER_VERSION_DEPTH_PASS_WITH_SDF,
 		SHADER_VERSION_COLOR_PASS,
-		SHADER_VERSION_COLOR_PASS_WITH_FORWARD_GI,
 		SHADER_VERSION_COLOR_PASS_WITH_SEPARATE_SPECULAR,
 		SHADER_VERSION_LIGHTMAP_COLOR_PASS,
 		SHADER_VERSION_LIGHTMAP_COLOR_PASS_WITH_SEPARATE_SPECULAR,
 		SHADER_VERSION_MAX
 	};
 
+	// Bool specialization constants of the scene shader (constant_id is the bit index), selected
+	// per pipeline so they don't need their own shader version.
+	enum ShaderSpecialization {
+		SHADER_SPECIALIZATION_FORWARD_GI = 1 << 0,
+	};
+
 	struct {
 		SceneForwardShaderRD scene_shader;
 		ShaderCompilerRD compiler;
@@ -145,6 +151,7 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 
 		DepthDraw depth_draw;
 		DepthTest depth_test;
+		Cull cull_mode;
 
 		bool uses_point_size;
 		bool uses_alpha;
@@ -169,6 +176,42 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 		uint64_t last_pass = 0;
 		uint32_t index = 0;
 
+		// Parameters of all materials using this shader are packed in pages,
+		// each one a storage buffer indexed by the material_index push constant.
+		// Materials in the same page with the same textures share a uniform set,
+		// so switching between them does not rebind anything.
+
+		enum {
+			MATERIAL_PAGE_SLOTS = 64,
+		};
+
+		struct MaterialPage {
+			RID buffer;
+			uint32_t slot_size = 0;
+			uint32_t used = 0;
+			uint32_t next_slot = 0;
+			LocalVector<uint32_t> free_slots;
+		};
+
+		struct MaterialUniformSetKey {
+			Vector<RID> ids; //page buffer (if any) followed by textures
+			bool operator<(const MaterialUniformSetKey &p_key) const;
+		};
+
+		struct MaterialUniformSet {
+			RID uniform_set;
+			uint32_t users = 0;
+		};
+
+		LocalVector<MaterialPage> material_pages;
+		Map<MaterialUniformSetKey, MaterialUniformSet> material_uniform_sets;
+
+		uint32_t material_slot_alloc();
+		void material_slot_free(uint32_t p_slot);
+		void material_slot_update(uint32_t p_slot, const uint8_t *p_data);
+		RID material_uniform_set_acquire(const Vector<RID> &p_ids, bool p_has_buffer);
+		void material_uniform_set_release(const Vector<RID> &p_ids);
+
 		virtual void set_code(const String &p_Code);
 		virtual void set_default_texture_param(const StringName &p_name, RID p_texture);
 		virtual void get_param_list(List<PropertyInfo> *p_param_list) const;
@@ -190,10 +233,15 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 	}
 
 	struct MaterialData : public RendererStorageRD::MaterialData {
+		enum {
+			INVALID_UBO_SLOT = 0xFFFFFFFF
+		};
+
 		uint64_t last_frame;
 		ShaderData *shader_data;
-		RID uniform_buffer;
+		uint32_t ubo_slot = INVALID_UBO_SLOT;
 		RID uniform_set;
+		Vector<RID> uniform_set_ids;
 		Vector<RID> texture_cache;
 		Vector<uint8_t> ubo_data;
 		uint64_t last_pass = 0;
@@ -203,6 +251,7 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 		virtual void set_render_priority(int p_priority);
 		virtual void set_next_pass(RID p_pass);
 		virtual void update_parameters(const Map<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty);
+		uint32_t get_material_index() const;
 		virtual ~MaterialData();
 	};
 
@@ -300,6 +349,7 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 		RD::FramebufferFormatID framebuffer_format = 0;
 		uint32_t element_offset = 0;
 		uint32_t barrier = RD::BARRIER_MASK_ALL;
+		bool use_mesh_clusters = false; // Draw the surfaces culled by _cull_mesh_clusters() with indirect draws.
 
 		RenderListParameters(GeometryInstanceSurfaceDataCache **p_elements, RenderElementInfo *p_element_info, int p_element_count, bool p_reverse_cull, PassMode p_pass_mode, bool p_no_gi, RID p_render_pass_uniform_set, bool p_force_wireframe = false, const Vector2 &p_uv_offset = Vector2(), const Plane &p_lod_plane = Plane(), float p_lod_distance_multiplier = 0.0, float p_screen_lod_threshold = 0.0, uint32_t p_element_offset = 0, uint32_t p_barrier = RD::BARRIER_MASK_ALL) {
 			elements = p_elements;
@@ -430,7 +480,8 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 		struct PushConstant {
 			uint32_t base_index; //
 			uint32_t uv_offset; //packed
-			uint32_t pad[2];
+			uint32_t material_index; //slot in the material page
+			uint32_t pad;
 		};
 
 		struct InstanceData {
@@ -555,6 +606,10 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 			FLAG_USES_DOUBLE_SIDED_SHADOWS = 32768,
 		};
 
+		enum {
+			NO_CLUSTER_DRAW = 0xFFFFFFFF
+		};
+
 		union {
 			struct {
 				uint64_t lod_index : 8;
@@ -581,12 +636,20 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 
 		void *surface = nullptr;
 		RID material_uniform_set;
+		uint32_t material_index = 0;
 		ShaderData *shader = nullptr;
 
 		void *surface_shadow = nullptr;
 		RID material_uniform_set_shadow;
+		uint32_t material_index_shadow = 0;
 		ShaderData *shader_shadow = nullptr;
 
+		//set every frame by _cull_mesh_clusters(), for the opaque render list
+		uint32_t cluster_draw_offset = NO_CLUSTER_DRAW;
+		uint32_t cluster_draw_offset_shadow = NO_CLUSTER_DRAW;
+		uint32_t cluster_count = 0;
+		uint32_t cluster_count_shadow = 0;
+
 		GeometryInstanceSurfaceDataCache *next = nullptr;
 		GeometryInstanceForward *owner = nullptr;
 	};
@@ -672,19 +735,12 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 			element_info.clear();
 		}
 
-		//should eventually be replaced by radix
-
 		struct SortByKey {
 			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
 				return (A->sort.sort_key2 == B->sort.sort_key2) ? (A->sort.sort_key1 < B->sort.sort_key1) : (A->sort.sort_key2 < B->sort.sort_key2);
 			}
 		};
 
-		void sort_by_key() {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr(), elements.size());
-		}
-
 		void sort_by_key_range(uint32_t p_from, uint32_t p_size) {
 			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
 			sorter.sort(elements.ptr() + p_from, p_size);
@@ -721,6 +777,123 @@ class RendererSceneRenderForward : public RendererSceneRenderRD {
 
 	RenderList render_list[RENDER_LIST_MAX];
 
+	/* Threaded Render List Fill */
+
+	struct FillRenderListChunk {
+		LocalVector<GeometryInstanceSurfaceDataCache *> elements;
+		LocalVector<GeometryInstanceSurfaceDataCache *> alpha_elements;
+		bool used_sss = false;
+		bool used_screen_texture = false;
+		bool used_normal_texture = false;
+		bool used_depth_texture = false;
+	};
+
+	struct FillRenderListParameters {
+		const PagedArray<GeometryInstance *> *instances = nullptr;
+		RenderListType render_list = RENDER_LIST_OPAQUE;
+		PassMode pass_mode = PASS_MODE_COLOR;
+		Plane near_plane;
+		float z_max = 0.0;
+		bool using_sdfgi = false;
+		bool using_opaque_gi = false;
+		Plane lod_plane;
+		float lod_distance_multiplier = 0.0;
+		float screen_lod_threshold = 0.0;
+		uint32_t chunk_count = 1;
+		volatile uint32_t lightmap_captures_used = 0;
+	};
+
+	LocalVector<FillRenderListChunk> fill_render_list_chunks;
+	void _fill_render_list_chunk(uint32_t p_chunk, FillRenderListParameters *p_params);
+
+	/* Threaded Render List Radix Sort */
+
+	enum {
+		RENDER_LIST_RADIX_KEY_BYTES = 16, // sort_key2 (high) and sort_key1 (low)
+		RENDER_LIST_RADIX_BUCKETS = 256,
+		RENDER_LIST_RADIX_HISTOGRAM_SIZE = RENDER_LIST_RADIX_KEY_BYTES * RENDER_LIST_RADIX_BUCKETS,
+	};
+
+	struct RenderListRadixSort {
+		struct Element {
+			uint64_t key1;
+			uint64_t key2;
+			GeometryInstanceSurfaceDataCache *surface;
+
+			_FORCE_INLINE_ uint32_t get_digit(uint32_t p_byte) const {
+				return ((p_byte < 8 ? key1 : key2) >> ((p_byte & 7) * 8)) & 0xFF;
+			}
+		};
+
+		LocalVector<Element> elements[2];
+		LocalVector<uint32_t> histograms; // chunk_count * RENDER_LIST_RADIX_HISTOGRAM_SIZE, turned into scatter offsets per pass
+		GeometryInstanceSurfaceDataCache **source = nullptr;
+		uint32_t element_count = 0;
+		uint32_t chunk_count = 0;
+		uint32_t pass_source = 0;
+		uint32_t pass_byte = 0;
+	};
+
+	RenderListRadixSort render_list_radix_sort;
+	void _radix_sort_fill_chunk(uint32_t p_chunk, RenderListRadixSort *p_sort);
+	void _radix_sort_histogram_chunk(uint32_t p_chunk, RenderListRadixSort *p_sort);
+	void _radix_sort_scatter_chunk(uint32_t p_chunk, RenderListRadixSort *p_sort);
+	void _sort_render_list_by_key(RenderListType p_render_list, uint32_t p_from = 0, int32_t p_size = -1);
+
+	/* Threaded Instance Data Fill */
+
+	struct FillInstanceDataParameters {
+		RenderListType render_list = RENDER_LIST_OPAQUE;
+		uint32_t offset = 0;
+		uint32_t element_total = 0;
+		uint32_t chunk_count = 1;
+	};
+
+	void _fill_instance_data_chunk(uint32_t p_chunk, FillInstanceDataParameters *p_params);
+
+	/* Mesh Cluster Culling */
+
+	// Surfaces imported with clusters are drawn as one indirect draw per cluster in the
+	// depth pre-pass and the opaque pass. A compute pass writes the draw commands, culling
+	// clusters outside the frustum or (for back face culled materials) facing away from the camera.
+	struct MeshClusterCull {
+		struct PushConstant {
+			float transform[12]; // Rows of the instance transform.
+			uint32_t cluster_count;
+			uint32_t draw_offset;
+			uint32_t flags;
+			float max_scale;
+		};
+
+		struct Params {
+			float planes[6][4];
+			float camera_position[3];
+			uint32_t orthogonal;
+			float camera_direction[3];
+			uint32_t pad;
+		};
+
+		enum {
+			FLAG_CONE_CULL = 1,
+			DRAW_COMMAND_SIZE = 20, // Indexed indirect draw command, five uint32.
+		};
+
+		MeshClusterCullShaderRD shader;
+		RID shader_version;
+		RID shader_rd;
+		RID pipeline;
+
+		RID params_buffer;
+		RID draw_buffer;
+		uint32_t draw_buffer_size = 0;
+		RID draw_uniform_set;
+
+		uint32_t max_draw_count = 0;
+		bool enabled = false;
+	} mesh_cluster_cull;
+
+	void _cull_mesh_clusters(const CameraMatrix &p_cam_projection, const Transform &p_cam_transform);
+
 protected:
 	virtual void _render_scene(RID p_render_buffer, const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_ortogonal, const PagedArray<GeometryInstance *> &p_instances, const PagedArray<RID> &p_gi_probes, const PagedArray<RID> &p_lightmaps, RID p_environment, RID p_cluster_buffer, uint32_t p_cluster_size, uint32_t p_max_cluster_elements, RID p_camera_effects, RID p_shadow_atlas, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass, const Color &p_default_bg_color, float p_lod_threshold);
 
@@ -976,11 +976,19 @@ void RendererSceneRenderRD::sdfgi_update(RID p_render_buffers, RID p_environment
 	sdfgi->reads_sky = env->sdfgi_read_sky_light;
 
 	int32_t drag_margin = (sdfgi->cascade_size / SDFGI::PROBE_DIVISOR) / 2;
+	uint32_t total_volume = sdfgi->cascade_size * sdfgi->cascade_size * sdfgi->cascade_size;
+
+	Vector3i new_positions[SDFGI::MAX_CASCADES];
+	Vector3i new_dirty_regions[SDFGI::MAX_CASCADES];
+	uint32_t update_costs[SDFGI::MAX_CASCADES];
 
 	for (uint32_t i = 0; i < sdfgi->cascades.size(); i++) {
 		SDFGI::Cascade &cascade = sdfgi->cascades[i];
 		cascade.dirty_regions = Vector3i();
 
+		Vector3i position = cascade.position;
+		Vector3i dirty_regions;
+
 		Vector3 probe_half_size = Vector3(1, 1, 1) * cascade.cell_size * float(sdfgi->cascade_size / SDFGI::PROBE_DIVISOR) * 0.5;
 		probe_half_size = Vector3(0, 0, 0);
 
@@ -989,41 +997,94 @@ void RendererSceneRenderRD::sdfgi_update(RID p_render_buffers, RID p_environment
 		Vector3i pos_in_cascade = Vector3i((world_position + probe_half_size) / cascade.cell_size);
 
 		for (int j = 0; j < 3; j++) {
-			if (pos_in_cascade[j] < cascade.position[j]) {
-				while (pos_in_cascade[j] < (cascade.position[j] - drag_margin)) {
-					cascade.position[j] -= drag_margin * 2;
-					cascade.dirty_regions[j] += drag_margin * 2;
+			if (pos_in_cascade[j] < position[j]) {
+				while (pos_in_cascade[j] < (position[j] - drag_margin)) {
+					position[j] -= drag_margin * 2;
+					dirty_regions[j] += drag_margin * 2;
 				}
-			} else if (pos_in_cascade[j] > cascade.position[j]) {
-				while (pos_in_cascade[j] > (cascade.position[j] + drag_margin)) {
-					cascade.position[j] += drag_margin * 2;
-					cascade.dirty_regions[j] -= drag_margin * 2;
+			} else if (pos_in_cascade[j] > position[j]) {
+				while (pos_in_cascade[j] > (position[j] + drag_margin)) {
+					position[j] += drag_margin * 2;
+					dirty_regions[j] -= drag_margin * 2;
 				}
 			}
 
-			if (cascade.dirty_regions[j] == 0) {
+			if (dirty_regions[j] == 0) {
 				continue; // not dirty
-			} else if (uint32_t(ABS(cascade.dirty_regions[j])) >= sdfgi->cascade_size) {
+			} else if (uint32_t(ABS(dirty_regions[j])) >= sdfgi->cascade_size) {
 				//moved too much, just redraw everything (make all dirty)
-				cascade.dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+				dirty_regions = SDFGI::Cascade::DIRTY_ALL;
 				break;
 			}
 		}
 
-		if (cascade.dirty_regions != Vector3i() && cascade.dirty_regions != SDFGI::Cascade::DIRTY_ALL) {
+		uint32_t cost = 0;
+
+		if (dirty_regions == SDFGI::Cascade::DIRTY_ALL) {
+			cost = total_volume;
+		} else if (dirty_regions != Vector3i()) {
 			//see how much the total dirty volume represents from the total volume
-			uint32_t total_volume = sdfgi->cascade_size * sdfgi->cascade_size * sdfgi->cascade_size;
 			uint32_t safe_volume = 1;
 			for (int j = 0; j < 3; j++) {
-				safe_volume *= sdfgi->cascade_size - ABS(cascade.dirty_regions[j]);
+				safe_volume *= sdfgi->cascade_size - ABS(dirty_regions[j]);
 			}
 			uint32_t dirty_volume = total_volume - safe_volume;
 			if (dirty_volume > (safe_volume / 2)) {
 				//more than half the volume is dirty, make all dirty so its only rendered once
-				cascade.dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+				dirty_regions = SDFGI::Cascade::DIRTY_ALL;
+				cost = total_volume;
+			} else {
+				cost = dirty_volume;
+			}
+		}
+
+		new_positions[i] = position;
+		new_dirty_regions[i] = dirty_regions;
+		update_costs[i] = cost;
+	}
+
+	//scroll within the budget, nearest cascades first. Deferred cascades gain priority
+	//every frame they wait, so far ones are not starved while the camera keeps moving.
+
+	uint32_t order[SDFGI::MAX_CASCADES];
+	for (uint32_t i = 0; i < sdfgi->cascades.size(); i++) {
+		order[i] = i;
+	}
+	for (uint32_t i = 1; i < sdfgi->cascades.size(); i++) {
+		for (uint32_t j = i; j > 0; j--) {
+			int64_t prio_a = int64_t(order[j - 1]) - int64_t(sdfgi->cascades[order[j - 1]].frames_waiting);
+			int64_t prio_b = int64_t(order[j]) - int64_t(sdfgi->cascades[order[j]].frames_waiting);
+			if (prio_b >= prio_a) {
+				break;
 			}
+			SWAP(order[j - 1], order[j]);
 		}
 	}
+
+	uint64_t budget = sdfgi_frame_update_budget > 0.0 ? uint64_t(double(total_volume) * sdfgi_frame_update_budget) : UINT64_MAX;
+	uint64_t spent = 0;
+
+	for (uint32_t i = 0; i < sdfgi->cascades.size(); i++) {
+		SDFGI::Cascade &cascade = sdfgi->cascades[order[i]];
+		uint32_t cost = update_costs[order[i]];
+
+		if (cost == 0) {
+			cascade.frames_waiting = 0;
+			continue;
+		}
+
+		if (spent > 0 && spent + cost > budget) {
+			//keep the old position, it will be scrolled in a later frame
+			cascade.frames_waiting++;
+			continue;
+		}
+
+		//the first scroll always goes through, so the highest priority cascade can't stall
+		spent += cost;
+		cascade.position = new_positions[order[i]];
+		cascade.dirty_regions = new_dirty_regions[order[i]];
+		cascade.frames_waiting = 0;
+	}
 }
 
 int RendererSceneRenderRD::sdfgi_get_pending_region_count(RID p_render_buffers) const {
@@ -1866,7 +1927,7 @@ void RendererSceneRenderRD::_process_gi(RID p_render_buffers, RID p_normal_rough
 	} else {
 		mode = (use_sdfgi && use_giprobes) ? GI::MODE_COMBINED : (use_sdfgi ? GI::MODE_SDFGI : GI::MODE_GIPROBE);
 	}
-	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin(true);
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin(true, true);
 	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, gi.pipelines[mode]);
 	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, rb->gi_uniform_set, 0);
 	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(GI::PushConstant));
@@ -3614,21 +3675,84 @@ RID RendererSceneRenderRD::shadow_atlas_create() {
 	return shadow_atlas_owner.make_rid(ShadowAtlas());
 }
 
+static uint64_t _get_depth_texture_memory(int p_width, int p_height, bool p_16_bits) {
+	return uint64_t(p_width) * p_height * (p_16_bits ? 2 : 4);
+}
+
+uint64_t RendererSceneRenderRD::_get_shadow_atlas_memory(const ShadowAtlas *shadow_atlas) const {
+	uint64_t memory = 0;
+	if (shadow_atlas->depth.is_valid()) {
+		memory += _get_depth_texture_memory(shadow_atlas->size, shadow_atlas->size, shadow_atlas->use_16_bits);
+	}
+	if (shadow_atlas->static_depth.is_valid()) {
+		memory += _get_depth_texture_memory(shadow_atlas->size, shadow_atlas->size, shadow_atlas->use_16_bits);
+	}
+	return memory;
+}
+
 void RendererSceneRenderRD::_update_shadow_atlas(ShadowAtlas *shadow_atlas) {
 	if (shadow_atlas->size > 0 && shadow_atlas->depth.is_null()) {
+		if (shadow_atlas->size > SHADOW_ATLAS_FALLBACK_MIN_SIZE && storage->is_video_memory_low()) {
+			// Light rects are derived from the atlas size, so lights already in the atlas just get smaller shadows.
+			WARN_PRINT_ONCE("Video memory is near its budget, shadow atlases are allocated at half their size.");
+			shadow_atlas->size >>= 1;
+		}
+
 		RD::TextureFormat tf;
 		tf.format = shadow_atlas->use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
 		tf.width = shadow_atlas->size;
 		tf.height = shadow_atlas->size;
-		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
 
 		shadow_atlas->depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
 		Vector<RID> fb_tex;
 		fb_tex.push_back(shadow_atlas->depth);
 		shadow_atlas->fb = RD::get_singleton()->framebuffer_create(fb_tex);
+		shadow_memory += _get_depth_texture_memory(shadow_atlas->size, shadow_atlas->size, shadow_atlas->use_16_bits);
+	}
+}
+
+void RendererSceneRenderRD::_update_shadow_atlas_static_cache(ShadowAtlas *shadow_atlas) {
+	// Only allocated once a light actually uses it, as it doubles the atlas memory.
+	if (shadow_atlas->size > 0 && shadow_atlas->static_depth.is_null()) {
+		RD::TextureFormat tf;
+		tf.format = shadow_atlas->use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
+		tf.width = shadow_atlas->size;
+		tf.height = shadow_atlas->size;
+		tf.usage_bits = RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT;
+
+		shadow_atlas->static_depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
+		Vector<RID> fb_tex;
+		fb_tex.push_back(shadow_atlas->static_depth);
+		shadow_atlas->static_fb = RD::get_singleton()->framebuffer_create(fb_tex);
+		shadow_memory += _get_depth_texture_memory(shadow_atlas->size, shadow_atlas->size, shadow_atlas->use_16_bits);
 	}
 }
 
+Rect2i RendererSceneRenderRD::_get_shadow_atlas_rect(ShadowAtlas *shadow_atlas, RID p_light) {
+	uint32_t key = shadow_atlas->shadow_owners[p_light];
+
+	uint32_t quadrant = (key >> ShadowAtlas::QUADRANT_SHIFT) & 0x3;
+	uint32_t shadow = key & ShadowAtlas::SHADOW_INDEX_MASK;
+
+	ERR_FAIL_INDEX_V((int)shadow, shadow_atlas->quadrants[quadrant].shadows.size(), Rect2i());
+
+	uint32_t quadrant_size = shadow_atlas->size >> 1;
+
+	Rect2i atlas_rect;
+	atlas_rect.position.x = (quadrant & 1) * quadrant_size;
+	atlas_rect.position.y = (quadrant >> 1) * quadrant_size;
+
+	uint32_t shadow_size = (quadrant_size / shadow_atlas->quadrants[quadrant].subdivision);
+	atlas_rect.position.x += (shadow % shadow_atlas->quadrants[quadrant].subdivision) * shadow_size;
+	atlas_rect.position.y += (shadow / shadow_atlas->quadrants[quadrant].subdivision) * shadow_size;
+
+	atlas_rect.size.width = shadow_size;
+	atlas_rect.size.height = shadow_size;
+
+	return atlas_rect;
+}
+
 void RendererSceneRenderRD::shadow_atlas_set_size(RID p_atlas, int p_size, bool p_16_bits) {
 	ShadowAtlas *shadow_atlas = shadow_atlas_owner.getornull(p_atlas);
 	ERR_FAIL_COND(!shadow_atlas);
@@ -3640,10 +3764,15 @@ void RendererSceneRenderRD::shadow_atlas_set_size(RID p_atlas, int p_size, bool
 	}
 
 	// erasing atlas
+	shadow_memory -= _get_shadow_atlas_memory(shadow_atlas);
 	if (shadow_atlas->depth.is_valid()) {
 		RD::get_singleton()->free(shadow_atlas->depth);
 		shadow_atlas->depth = RID();
 	}
+	if (shadow_atlas->static_depth.is_valid()) {
+		RD::get_singleton()->free(shadow_atlas->static_depth);
+		shadow_atlas->static_depth = RID();
+	}
 	for (int i = 0; i < 4; i++) {
 		//clear subdivisions
 		shadow_atlas->quadrants[i].shadows.resize(0);
@@ -3916,18 +4045,36 @@ bool RendererSceneRenderRD::shadow_atlas_update_light(RID p_atlas, RID p_light_i
 	return false;
 }
 
+uint64_t RendererSceneRenderRD::_get_directional_shadow_memory() const {
+	uint64_t memory = 0;
+	if (directional_shadow.depth.is_valid()) {
+		memory += _get_depth_texture_memory(directional_shadow.size, directional_shadow.size, directional_shadow.use_16_bits);
+	}
+	if (directional_shadow.clipmap_scroll_depth.is_valid()) {
+		memory += _get_depth_texture_memory(directional_shadow.clipmap_scroll_size.width, directional_shadow.clipmap_scroll_size.height, directional_shadow.use_16_bits);
+	}
+	return memory;
+}
+
 void RendererSceneRenderRD::_update_directional_shadow_atlas() {
 	if (directional_shadow.depth.is_null() && directional_shadow.size > 0) {
+		if (directional_shadow.size > SHADOW_ATLAS_FALLBACK_MIN_SIZE && storage->is_video_memory_low()) {
+			WARN_PRINT_ONCE("Video memory is near its budget, the directional shadow atlas is allocated at half its size.");
+			directional_shadow.size >>= 1;
+			directional_shadow.version++;
+		}
+
 		RD::TextureFormat tf;
 		tf.format = directional_shadow.use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
 		tf.width = directional_shadow.size;
 		tf.height = directional_shadow.size;
-		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
 
 		directional_shadow.depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
 		Vector<RID> fb_tex;
 		fb_tex.push_back(directional_shadow.depth);
 		directional_shadow.fb = RD::get_singleton()->framebuffer_create(fb_tex);
+		shadow_memory += _get_depth_texture_memory(directional_shadow.size, directional_shadow.size, directional_shadow.use_16_bits);
 	}
 }
 void RendererSceneRenderRD::directional_shadow_atlas_set_size(int p_size, bool p_16_bits) {
@@ -3937,13 +4084,21 @@ void RendererSceneRenderRD::directional_shadow_atlas_set_size(int p_size, bool p
 		return;
 	}
 
+	shadow_memory -= _get_directional_shadow_memory();
+
 	directional_shadow.size = p_size;
+	directional_shadow.version++;
 
 	if (directional_shadow.depth.is_valid()) {
 		RD::get_singleton()->free(directional_shadow.depth);
 		directional_shadow.depth = RID();
 		_base_uniforms_changed();
 	}
+
+	if (directional_shadow.clipmap_scroll_depth.is_valid()) {
+		RD::get_singleton()->free(directional_shadow.clipmap_scroll_depth);
+		directional_shadow.clipmap_scroll_depth = RID();
+	}
 }
 
 void RendererSceneRenderRD::set_directional_shadow_count(int p_count) {
@@ -3951,6 +4106,14 @@ void RendererSceneRenderRD::set_directional_shadow_count(int p_count) {
 	directional_shadow.current_light = 0;
 }
 
+uint64_t RendererSceneRenderRD::get_directional_shadow_version() const {
+	return directional_shadow.version;
+}
+
+uint64_t RendererSceneRenderRD::get_shadow_memory_usage() const {
+	return shadow_memory;
+}
+
 static Rect2i _get_directional_shadow_rect(int p_size, int p_shadow_count, int p_shadow_index) {
 	int split_h = 1;
 	int split_v = 1;
@@ -3988,6 +4151,7 @@ int RendererSceneRenderRD::get_directional_light_shadow_size(RID p_light_intance
 			r.size.height /= 2;
 			break;
 		case RS::LIGHT_DIRECTIONAL_SHADOW_PARALLEL_4_SPLITS:
+		case RS::LIGHT_DIRECTIONAL_SHADOW_CLIPMAP:
 			r.size /= 2;
 			break;
 	}
@@ -3995,6 +4159,38 @@ int RendererSceneRenderRD::get_directional_light_shadow_size(RID p_light_intance
 	return MAX(r.size.width, r.size.height);
 }
 
+Rect2i RendererSceneRenderRD::_get_directional_shadow_atlas_rect(LightInstance *p_light_instance, int p_pass) {
+	Rect2i atlas_rect = p_light_instance->directional_rect;
+
+	switch (storage->light_directional_get_shadow_mode(p_light_instance->light)) {
+		case RS::LIGHT_DIRECTIONAL_SHADOW_ORTHOGONAL:
+			break;
+		case RS::LIGHT_DIRECTIONAL_SHADOW_PARALLEL_2_SPLITS: {
+			atlas_rect.size.height /= 2;
+
+			if (p_pass == 1) {
+				atlas_rect.position.y += atlas_rect.size.height;
+			}
+		} break;
+		case RS::LIGHT_DIRECTIONAL_SHADOW_PARALLEL_4_SPLITS:
+		case RS::LIGHT_DIRECTIONAL_SHADOW_CLIPMAP: {
+			atlas_rect.size.width /= 2;
+			atlas_rect.size.height /= 2;
+
+			if (p_pass == 1) {
+				atlas_rect.position.x += atlas_rect.size.width;
+			} else if (p_pass == 2) {
+				atlas_rect.position.y += atlas_rect.size.height;
+			} else if (p_pass == 3) {
+				atlas_rect.position.x += atlas_rect.size.width;
+				atlas_rect.position.y += atlas_rect.size.height;
+			}
+		} break;
+	}
+
+	return atlas_rect;
+}
+
 //////////////////////////////////////////////////
 
 RID RendererSceneRenderRD::camera_effects_allocate() {
@@ -4076,6 +4272,24 @@ void RendererSceneRenderRD::light_instance_set_shadow_transform(RID p_light_inst
 	light_instance->shadow_transform[p_pass].range_begin = p_range_begin;
 	light_instance->shadow_transform[p_pass].shadow_texel_size = p_shadow_texel_size;
 	light_instance->shadow_transform[p_pass].uv_scale = p_uv_scale;
+
+	if (light_instance->light_type == RS::LIGHT_DIRECTIONAL) {
+		// Assign the atlas rect when the light is set up rather than when it's drawn,
+		// so lights whose clipmap pages are all cached keep a stable rect.
+		if (light_instance->last_scene_shadow_pass != scene_pass) {
+			Rect2i directional_rect = _get_directional_shadow_rect(directional_shadow.size, directional_shadow.light_count, directional_shadow.current_light);
+			directional_shadow.current_light++;
+			light_instance->last_scene_shadow_pass = scene_pass;
+
+			if (Rect2i(light_instance->directional_rect) != directional_rect) {
+				light_instance->directional_rect = directional_rect;
+				directional_shadow.version++;
+			}
+		}
+
+		Rect2 atlas_rect = _get_directional_shadow_atlas_rect(light_instance, p_pass);
+		light_instance->shadow_transform[p_pass].atlas_rect = Rect2(atlas_rect.position / directional_shadow.size, atlas_rect.size / directional_shadow.size);
+	}
 }
 
 void RendererSceneRenderRD::light_instance_mark_visible(RID p_light_instance) {
@@ -4097,6 +4311,7 @@ RendererSceneRenderRD::ShadowCubemap *RendererSceneRenderRD::_get_shadow_cubemap
 			tf.array_layers = 6;
 			tf.usage_bits = RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_SAMPLING_BIT;
 			sc.cubemap = RD::get_singleton()->texture_create(tf, RD::TextureView());
+			shadow_memory += _get_depth_texture_memory(p_size, p_size, false) * 6;
 		}
 
 		for (int i = 0; i < 6; i++) {
@@ -5224,20 +5439,6 @@ void RendererSceneRenderRD::_free_render_buffer_data(RenderBuffers *rb) {
 		rb->ssao.ao_pong_slices.clear();
 	}
 
-	if (rb->ssr.blur_radius[0].is_valid()) {
-		RD::get_singleton()->free(rb->ssr.blur_radius[0]);
-		RD::get_singleton()->free(rb->ssr.blur_radius[1]);
-		rb->ssr.blur_radius[0] = RID();
-		rb->ssr.blur_radius[1] = RID();
-	}
-
-	if (rb->ssr.depth_scaled.is_valid()) {
-		RD::get_singleton()->free(rb->ssr.depth_scaled);
-		rb->ssr.depth_scaled = RID();
-		RD::get_singleton()->free(rb->ssr.normal_scaled);
-		rb->ssr.normal_scaled = RID();
-	}
-
 	if (rb->ambient_buffer.is_valid()) {
 		RD::get_singleton()->free(rb->ambient_buffer);
 		RD::get_singleton()->free(rb->reflection_buffer);
@@ -5282,40 +5483,92 @@ void RendererSceneRenderRD::_process_ssr(RID p_render_buffers, RID p_dest_frameb
 
 	ERR_FAIL_COND(!env->ssr_enabled);
 
-	if (rb->ssr.depth_scaled.is_null()) {
-		RD::TextureFormat tf;
-		tf.format = RD::DATA_FORMAT_R32_SFLOAT;
-		tf.width = rb->width / 2;
-		tf.height = rb->height / 2;
-		tf.texture_type = RD::TEXTURE_TYPE_2D;
-		tf.usage_bits = RD::TEXTURE_USAGE_STORAGE_BIT;
+	if (rb->blur[0].texture.is_null()) {
+		_allocate_blur_textures(rb);
+		_render_buffers_uniform_set_changed(p_render_buffers);
+	}
 
-		rb->ssr.depth_scaled = RD::get_singleton()->texture_create(tf, RD::TextureView());
+	SSRGraphData data;
+	data.scene_render = this;
+	data.rb = rb;
+	data.env = env;
+	data.dest_framebuffer = p_dest_framebuffer;
+	data.normal_buffer = p_normal_buffer;
+	data.specular_buffer = p_specular_buffer;
+	data.metallic = p_metallic;
+	data.metallic_mask = p_metallic_mask;
+	data.projection = p_projection;
+	data.use_additive = p_use_additive;
 
-		tf.format = RD::DATA_FORMAT_R8G8B8A8_UNORM;
+	RD::TextureFormat tf;
+	tf.format = RD::DATA_FORMAT_R32_SFLOAT;
+	tf.width = rb->width / 2;
+	tf.height = rb->height / 2;
+	tf.texture_type = RD::TEXTURE_TYPE_2D;
+	tf.usage_bits = RD::TEXTURE_USAGE_STORAGE_BIT;
+	data.depth_scaled = render_graph.create_transient_texture(tf);
 
-		rb->ssr.normal_scaled = RD::get_singleton()->texture_create(tf, RD::TextureView());
-	}
+	tf.format = RD::DATA_FORMAT_R8G8B8A8_UNORM;
+	data.normal_scaled = render_graph.create_transient_texture(tf);
 
-	if (ssr_roughness_quality != RS::ENV_SSR_ROUGNESS_QUALITY_DISABLED && !rb->ssr.blur_radius[0].is_valid()) {
-		RD::TextureFormat tf;
+	if (ssr_roughness_quality != RS::ENV_SSR_ROUGNESS_QUALITY_DISABLED) {
 		tf.format = RD::DATA_FORMAT_R8_UNORM;
-		tf.width = rb->width / 2;
-		tf.height = rb->height / 2;
-		tf.texture_type = RD::TEXTURE_TYPE_2D;
 		tf.usage_bits = RD::TEXTURE_USAGE_STORAGE_BIT | RD::TEXTURE_USAGE_SAMPLING_BIT;
+		data.blur_radius[0] = render_graph.create_transient_texture(tf);
+		data.blur_radius[1] = render_graph.create_transient_texture(tf);
+	}
+
+	RenderGraphRD::ResourceID color = render_graph.import_texture(rb->texture);
+	RenderGraphRD::ResourceID depth = render_graph.import_texture(rb->depth_texture);
+	RenderGraphRD::ResourceID normal = render_graph.import_texture(p_normal_buffer);
+	RenderGraphRD::ResourceID specular = render_graph.import_texture(p_specular_buffer);
+	RenderGraphRD::ResourceID reflection = render_graph.import_texture(rb->blur[0].mipmaps[1].texture, false);
+	RenderGraphRD::ResourceID scaled_color = render_graph.import_texture(rb->blur[1].mipmaps[0].texture, false);
+	RenderGraphRD::ResourceID dest = render_graph.import_texture(p_dest_framebuffer);
 
-		rb->ssr.blur_radius[0] = RD::get_singleton()->texture_create(tf, RD::TextureView());
-		rb->ssr.blur_radius[1] = RD::get_singleton()->texture_create(tf, RD::TextureView());
+	RenderGraphRD::PassID trace = render_graph.add_pass("SSR", RenderGraphRD::PASS_TYPE_COMPUTE, _ssr_graph_trace, &data);
+	render_graph.pass_read(trace, color);
+	render_graph.pass_read(trace, depth);
+	render_graph.pass_read(trace, normal);
+	render_graph.pass_write(trace, data.depth_scaled);
+	render_graph.pass_write(trace, data.normal_scaled);
+	if (data.blur_radius[0] != RenderGraphRD::INVALID_RESOURCE) {
+		render_graph.pass_write(trace, data.blur_radius[0]);
+		render_graph.pass_write(trace, data.blur_radius[1]);
 	}
+	render_graph.pass_write(trace, scaled_color);
+	render_graph.pass_write(trace, reflection);
 
-	if (rb->blur[0].texture.is_null()) {
-		_allocate_blur_textures(rb);
-		_render_buffers_uniform_set_changed(p_render_buffers);
+	RenderGraphRD::PassID merge = render_graph.add_pass("SSR Merge", RenderGraphRD::PASS_TYPE_RASTER, _ssr_graph_merge, &data);
+	render_graph.pass_read(merge, specular);
+	render_graph.pass_read(merge, reflection);
+	if (!p_use_additive) {
+		render_graph.pass_read(merge, color);
 	}
+	render_graph.pass_write(merge, dest);
 
-	storage->get_effects()->screen_space_reflection(rb->texture, p_normal_buffer, ssr_roughness_quality, rb->ssr.blur_radius[0], rb->ssr.blur_radius[1], p_metallic, p_metallic_mask, rb->depth_texture, rb->ssr.depth_scaled, rb->ssr.normal_scaled, rb->blur[0].mipmaps[1].texture, rb->blur[1].mipmaps[0].texture, Size2i(rb->width / 2, rb->height / 2), env->ssr_max_steps, env->ssr_fade_in, env->ssr_fade_out, env->ssr_depth_tolerance, p_projection);
-	storage->get_effects()->merge_specular(p_dest_framebuffer, p_specular_buffer, p_use_additive ? RID() : rb->texture, rb->blur[0].mipmaps[1].texture);
+	render_graph.execute();
+}
+
+void RendererSceneRenderRD::_ssr_graph_trace(const RenderGraphRD::PassContext &p_context, void *p_userdata) {
+	SSRGraphData *data = (SSRGraphData *)p_userdata;
+	RenderBuffers *rb = data->rb;
+	Environment *env = data->env;
+
+	RID blur_radius[2];
+	if (data->blur_radius[0] != RenderGraphRD::INVALID_RESOURCE) {
+		blur_radius[0] = p_context.get_texture(data->blur_radius[0]);
+		blur_radius[1] = p_context.get_texture(data->blur_radius[1]);
+	}
+
+	data->scene_render->storage->get_effects()->screen_space_reflection(rb->texture, data->normal_buffer, data->scene_render->ssr_roughness_quality, blur_radius[0], blur_radius[1], data->metallic, data->metallic_mask, rb->depth_texture, p_context.get_texture(data->depth_scaled), p_context.get_texture(data->normal_scaled), rb->blur[0].mipmaps[1].texture, rb->blur[1].mipmaps[0].texture, Size2i(rb->width / 2, rb->height / 2), env->ssr_max_steps, env->ssr_fade_in, env->ssr_fade_out, env->ssr_depth_tolerance, data->projection, p_context.post_barrier);
+}
+
+void RendererSceneRenderRD::_ssr_graph_merge(const RenderGraphRD::PassContext &p_context, void *p_userdata) {
+	SSRGraphData *data = (SSRGraphData *)p_userdata;
+	RenderBuffers *rb = data->rb;
+
+	data->scene_render->storage->get_effects()->merge_specular(data->dest_framebuffer, data->specular_buffer, data->use_additive ? RID() : rb->texture, rb->blur[0].mipmaps[1].texture, p_context.post_barrier);
 }
 
 void RendererSceneRenderRD::_process_ssao(RID p_render_buffers, RID p_environment, RID p_normal_buffer, const CameraMatrix &p_projection) {
@@ -7237,6 +7490,52 @@ void RendererSceneRenderRD::_pre_resolve_render(bool p_use_gi) {
 	}
 }
 
+void RendererSceneRenderRD::_scroll_directional_shadow_clipmaps() {
+	const int pages = DIRECTIONAL_SHADOW_CLIPMAP_PAGES;
+
+	for (uint32_t i = 0; i < render_state.directional_shadows.size(); i++) {
+		const RenderShadowData &shadow = render_state.render_shadows[render_state.directional_shadows[i]];
+		if (shadow.clipmap_scroll == Vector2i()) {
+			continue;
+		}
+
+		LightInstance *light_instance = light_instance_owner.getornull(shadow.light);
+		ERR_CONTINUE(!light_instance);
+
+		Rect2i atlas_rect = _get_directional_shadow_atlas_rect(light_instance, shadow.pass);
+		Vector2i page_size = atlas_rect.size / pages;
+
+		if (directional_shadow.clipmap_scroll_depth.is_null() || directional_shadow.clipmap_scroll_size.width < atlas_rect.size.width || directional_shadow.clipmap_scroll_size.height < atlas_rect.size.height) {
+			if (directional_shadow.clipmap_scroll_depth.is_valid()) {
+				shadow_memory -= _get_depth_texture_memory(directional_shadow.clipmap_scroll_size.width, directional_shadow.clipmap_scroll_size.height, directional_shadow.use_16_bits);
+				RD::get_singleton()->free(directional_shadow.clipmap_scroll_depth);
+			}
+
+			RD::TextureFormat tf;
+			tf.format = directional_shadow.use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
+			tf.width = atlas_rect.size.width;
+			tf.height = atlas_rect.size.height;
+			tf.usage_bits = RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
+
+			directional_shadow.clipmap_scroll_depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
+			directional_shadow.clipmap_scroll_size = atlas_rect.size;
+			shadow_memory += _get_depth_texture_memory(atlas_rect.size.width, atlas_rect.size.height, directional_shadow.use_16_bits);
+		}
+
+		// Page p of the level now shows what page p + scroll showed before, the pages it uncovers are redrawn afterwards.
+		Vector2i scroll = shadow.clipmap_scroll;
+		Vector2i from(MAX(0, -scroll.x), MAX(0, -scroll.y));
+		Vector2i to(MIN(pages, pages - scroll.x), MIN(pages, pages - scroll.y));
+
+		Vector3 src_pos(atlas_rect.position.x + (from.x + scroll.x) * page_size.x, atlas_rect.position.y + (from.y + scroll.y) * page_size.y, 0);
+		Vector3 dst_pos(atlas_rect.position.x + from.x * page_size.x, atlas_rect.position.y + from.y * page_size.y, 0);
+		Vector3 size((to.x - from.x) * page_size.x, (to.y - from.y) * page_size.y, 1);
+
+		RD::get_singleton()->texture_copy(directional_shadow.depth, directional_shadow.clipmap_scroll_depth, src_pos, Vector3(), size, 0, 0, 0, 0);
+		RD::get_singleton()->texture_copy(directional_shadow.clipmap_scroll_depth, directional_shadow.depth, Vector3(), dst_pos, size, 0, 0, 0, 0);
+	}
+}
+
 void RendererSceneRenderRD::_pre_opaque_render(bool p_use_ssao, bool p_use_gi, RID p_normal_roughness_buffer, RID p_gi_probe_buffer) {
 	// Render shadows while GI is rendering, due to how barriers are handled, this should happen at the same time
 
@@ -7270,9 +7569,10 @@ void RendererSceneRenderRD::_pre_opaque_render(bool p_use_ssao, bool p_use_gi, R
 		}
 
 		if (render_state.directional_shadows.size()) {
-			//open the pass for directional shadows
+			//open the pass for directional shadows, keeping the cached clipmap pages (each pass clears its own region)
 			_update_directional_shadow_atlas();
-			RD::get_singleton()->draw_list_begin(directional_shadow.fb, RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_CONTINUE);
+			_scroll_directional_shadow_clipmaps();
+			RD::get_singleton()->draw_list_begin(directional_shadow.fb, RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_CONTINUE);
 			RD::get_singleton()->draw_list_end();
 		}
 	}
@@ -7282,6 +7582,9 @@ void RendererSceneRenderRD::_pre_opaque_render(bool p_use_ssao, bool p_use_gi, R
 	bool render_shadows = render_state.directional_shadows.size() || render_state.shadows.size();
 	bool render_gi = render_state.render_buffers.is_valid() && p_use_gi;
 
+	//GI only depends on the depth pre-pass, so on devices with a compute queue it runs there while shadows render
+	bool async_gi = render_gi && render_shadows && RD::get_singleton()->async_compute_fork();
+
 	if (render_shadows && render_gi) {
 		RENDER_TIMESTAMP("Render GI + Render Shadows (parallel)");
 	} else if (render_shadows) {
@@ -7290,17 +7593,23 @@ void RendererSceneRenderRD::_pre_opaque_render(bool p_use_ssao, bool p_use_gi, R
 		RENDER_TIMESTAMP("Render GI");
 	}
 
+	if (render_state.shadows.size()) {
+		_render_shadow_static_caches(camera_plane, lod_distance_multiplier);
+	}
+
 	//prepare shadow rendering
 	if (render_shadows) {
 		_render_shadow_begin();
 
 		//render directional shadows
 		for (uint32_t i = 0; i < render_state.directional_shadows.size(); i++) {
-			_render_shadow_pass(render_state.render_shadows[render_state.directional_shadows[i]].light, render_state.shadow_atlas, render_state.render_shadows[render_state.directional_shadows[i]].pass, render_state.render_shadows[render_state.directional_shadows[i]].instances, camera_plane, lod_distance_multiplier, render_state.screen_lod_threshold, false, i == render_state.directional_shadows.size() - 1, false);
+			const RenderShadowData &shadow = render_state.render_shadows[render_state.directional_shadows[i]];
+			_render_shadow_pass(shadow.light, render_state.shadow_atlas, shadow.pass, shadow.instances, camera_plane, lod_distance_multiplier, render_state.screen_lod_threshold, false, i == render_state.directional_shadows.size() - 1, true, false, shadow.clipmap_pages);
 		}
-		//render positional shadows
+		//render positional shadows, lights with a static cache only draw their dynamic casters over the copied cache
 		for (uint32_t i = 0; i < render_state.shadows.size(); i++) {
-			_render_shadow_pass(render_state.render_shadows[render_state.shadows[i]].light, render_state.shadow_atlas, render_state.render_shadows[render_state.shadows[i]].pass, render_state.render_shadows[render_state.shadows[i]].instances, camera_plane, lod_distance_multiplier, render_state.screen_lod_threshold, i == 0, i == render_state.shadows.size() - 1, true);
+			const RenderShadowData &shadow = render_state.render_shadows[render_state.shadows[i]];
+			_render_shadow_pass(shadow.light, render_state.shadow_atlas, shadow.pass, shadow.instances, camera_plane, lod_distance_multiplier, render_state.screen_lod_threshold, i == 0, i == render_state.shadows.size() - 1, !shadow.use_static_cache);
 		}
 
 		_render_shadow_process();
@@ -7326,6 +7635,10 @@ void RendererSceneRenderRD::_pre_opaque_render(bool p_use_ssao, bool p_use_gi, R
 		}
 	}
 
+	if (async_gi) {
+		RD::get_singleton()->async_compute_join();
+	}
+
 	//full barrier here, we need raster, transfer and compute and it depends from the previous work
 	RD::get_singleton()->barrier(RD::BARRIER_MASK_ALL, RD::BARRIER_MASK_ALL);
 
@@ -7493,7 +7806,57 @@ void RendererSceneRenderRD::render_scene(RID p_render_buffers, const Transform &
 	}
 }
 
-void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<GeometryInstance *> &p_instances, const Plane &p_camera_plane, float p_lod_distance_multiplier, float p_screen_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region) {
+void RendererSceneRenderRD::_render_shadow_static_caches(const Plane &p_camera_plane, float p_lod_distance_multiplier) {
+	ShadowAtlas *shadow_atlas = shadow_atlas_owner.getornull(render_state.shadow_atlas);
+	ERR_FAIL_COND(!shadow_atlas);
+
+	LocalVector<uint32_t> cached;
+	LocalVector<uint32_t> updated;
+	for (uint32_t i = 0; i < render_state.shadows.size(); i++) {
+		const RenderShadowData &shadow = render_state.render_shadows[render_state.shadows[i]];
+		if (shadow.use_static_cache) {
+			cached.push_back(render_state.shadows[i]);
+			if (shadow.update_static_cache) {
+				updated.push_back(render_state.shadows[i]);
+			}
+		}
+	}
+
+	if (cached.is_empty()) {
+		return;
+	}
+
+	if (updated.size()) {
+		RENDER_TIMESTAMP("Render Static Shadows");
+		_render_shadow_begin();
+		for (uint32_t i = 0; i < updated.size(); i++) {
+			const RenderShadowData &shadow = render_state.render_shadows[updated[i]];
+			_render_shadow_pass(shadow.light, render_state.shadow_atlas, shadow.pass, shadow.static_instances, p_camera_plane, p_lod_distance_multiplier, render_state.screen_lod_threshold, i == 0, i == updated.size() - 1, true, true);
+		}
+		_render_shadow_process();
+		_render_shadow_end(RD::BARRIER_MASK_TRANSFER);
+	}
+
+	_update_shadow_atlas(shadow_atlas);
+	_update_shadow_atlas_static_cache(shadow_atlas);
+	for (uint32_t i = 0; i < cached.size(); i++) {
+		const RenderShadowData &shadow = render_state.render_shadows[cached[i]];
+		LightInstance *light_instance = light_instance_owner.getornull(shadow.light);
+		ERR_CONTINUE(!light_instance || !shadow_atlas->shadow_owners.has(shadow.light));
+
+		Rect2i rect = _get_shadow_atlas_rect(shadow_atlas, shadow.light);
+		if (storage->light_get_type(light_instance->light) == RS::LIGHT_OMNI) {
+			rect.size.height /= 2;
+			rect.position.y += shadow.pass * rect.size.height;
+		}
+
+		Vector3 pos(rect.position.x, rect.position.y, 0);
+		Vector3 size(rect.size.width, rect.size.height, 1);
+		RD::get_singleton()->texture_copy(shadow_atlas->static_depth, shadow_atlas->depth, pos, pos, size, 0, 0, 0, 0, i == cached.size() - 1 ? RD::BARRIER_MASK_RASTER : RD::BARRIER_MASK_NO_BARRIER);
+	}
+}
+
+void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<GeometryInstance *> &p_instances, const Plane &p_camera_plane, float p_lod_distance_multiplier, float p_screen_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, bool p_static_cache, const Rect2i &p_clipmap_pages) {
 	LightInstance *light_instance = light_instance_owner.getornull(p_light);
 	ERR_FAIL_COND(!light_instance);
 
@@ -7517,48 +7880,29 @@ void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas,
 	Transform light_transform;
 
 	if (storage->light_get_type(light_instance->light) == RS::LIGHT_DIRECTIONAL) {
-		//set pssm stuff
-		if (light_instance->last_scene_shadow_pass != scene_pass) {
-			light_instance->directional_rect = _get_directional_shadow_rect(directional_shadow.size, directional_shadow.light_count, directional_shadow.current_light);
-			directional_shadow.current_light++;
-			light_instance->last_scene_shadow_pass = scene_pass;
-		}
-
+		//set pssm stuff, the atlas rect was assigned in light_instance_set_shadow_transform()
 		use_pancake = storage->light_get_param(light_instance->light, RS::LIGHT_PARAM_SHADOW_PANCAKE_SIZE) > 0;
 		light_projection = light_instance->shadow_transform[p_pass].camera;
 		light_transform = light_instance->shadow_transform[p_pass].transform;
 
-		atlas_rect.position.x = light_instance->directional_rect.position.x;
-		atlas_rect.position.y = light_instance->directional_rect.position.y;
-		atlas_rect.size.width = light_instance->directional_rect.size.x;
-		atlas_rect.size.height = light_instance->directional_rect.size.y;
+		atlas_rect = _get_directional_shadow_atlas_rect(light_instance, p_pass);
 
-		if (storage->light_directional_get_shadow_mode(light_instance->light) == RS::LIGHT_DIRECTIONAL_SHADOW_PARALLEL_4_SPLITS) {
-			atlas_rect.size.width /= 2;
-			atlas_rect.size.height /= 2;
+		if (!p_clipmap_pages.has_no_area()) {
+			// Only draw the dirty pages, with the part of the orthogonal projection that covers them.
+			const int pages = DIRECTIONAL_SHADOW_CLIPMAP_PAGES;
+			Vector2i page_size = atlas_rect.size / pages;
+			atlas_rect.position += p_clipmap_pages.position * page_size;
+			atlas_rect.size = p_clipmap_pages.size * page_size;
 
-			if (p_pass == 1) {
-				atlas_rect.position.x += atlas_rect.size.width;
-			} else if (p_pass == 2) {
-				atlas_rect.position.y += atlas_rect.size.height;
-			} else if (p_pass == 3) {
-				atlas_rect.position.x += atlas_rect.size.width;
-				atlas_rect.position.y += atlas_rect.size.height;
-			}
-		} else if (storage->light_directional_get_shadow_mode(light_instance->light) == RS::LIGHT_DIRECTIONAL_SHADOW_PARALLEL_2_SPLITS) {
-			atlas_rect.size.height /= 2;
-
-			if (p_pass == 0) {
-			} else {
-				atlas_rect.position.y += atlas_rect.size.height;
-			}
+			real_t half_x = 1.0 / light_projection.matrix[0][0];
+			real_t half_y = 1.0 / light_projection.matrix[1][1];
+			real_t left = -half_x + half_x * 2.0 * p_clipmap_pages.position.x / pages;
+			real_t right = -half_x + half_x * 2.0 * (p_clipmap_pages.position.x + p_clipmap_pages.size.x) / pages;
+			real_t bottom = -half_y + half_y * 2.0 * p_clipmap_pages.position.y / pages;
+			real_t top = -half_y + half_y * 2.0 * (p_clipmap_pages.position.y + p_clipmap_pages.size.y) / pages;
+			light_projection.set_orthogonal(left, right, bottom, top, 0, light_instance->shadow_transform[p_pass].farplane);
 		}
 
-		light_instance->shadow_transform[p_pass].atlas_rect = atlas_rect;
-
-		light_instance->shadow_transform[p_pass].atlas_rect.position /= directional_shadow.size;
-		light_instance->shadow_transform[p_pass].atlas_rect.size /= directional_shadow.size;
-
 		zfar = storage->light_get_param(light_instance->light, RS::LIGHT_PARAM_RANGE);
 
 		render_fb = directional_shadow.fb;
@@ -7573,25 +7917,15 @@ void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas,
 		ERR_FAIL_COND(!shadow_atlas->shadow_owners.has(p_light));
 
 		_update_shadow_atlas(shadow_atlas);
+		if (p_static_cache) {
+			_update_shadow_atlas_static_cache(shadow_atlas);
+		}
 
-		uint32_t key = shadow_atlas->shadow_owners[p_light];
-
-		uint32_t quadrant = (key >> ShadowAtlas::QUADRANT_SHIFT) & 0x3;
-		uint32_t shadow = key & ShadowAtlas::SHADOW_INDEX_MASK;
-
-		ERR_FAIL_INDEX((int)shadow, shadow_atlas->quadrants[quadrant].shadows.size());
-
-		uint32_t quadrant_size = shadow_atlas->size >> 1;
-
-		atlas_rect.position.x = (quadrant & 1) * quadrant_size;
-		atlas_rect.position.y = (quadrant >> 1) * quadrant_size;
-
-		uint32_t shadow_size = (quadrant_size / shadow_atlas->quadrants[quadrant].subdivision);
-		atlas_rect.position.x += (shadow % shadow_atlas->quadrants[quadrant].subdivision) * shadow_size;
-		atlas_rect.position.y += (shadow / shadow_atlas->quadrants[quadrant].subdivision) * shadow_size;
-
-		atlas_rect.size.width = shadow_size;
-		atlas_rect.size.height = shadow_size;
+		atlas_rect = _get_shadow_atlas_rect(shadow_atlas, p_light);
+		if (atlas_rect.size.width == 0) {
+			return;
+		}
+		uint32_t shadow_size = atlas_rect.size.width;
 
 		zfar = storage->light_get_param(light_instance->light, RS::LIGHT_PARAM_RANGE);
 
@@ -7623,7 +7957,7 @@ void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas,
 
 				using_dual_paraboloid = true;
 				using_dual_paraboloid_flip = p_pass == 1;
-				render_fb = shadow_atlas->fb;
+				render_fb = p_static_cache ? shadow_atlas->static_fb : shadow_atlas->fb;
 				flip_y = true;
 			}
 
@@ -7631,7 +7965,7 @@ void RendererSceneRenderRD::_render_shadow_pass(RID p_light, RID p_shadow_atlas,
 			light_projection = light_instance->shadow_transform[0].camera;
 			light_transform = light_instance->shadow_transform[0].transform;
 
-			render_fb = shadow_atlas->fb;
+			render_fb = p_static_cache ? shadow_atlas->static_fb : shadow_atlas->fb;
 
 			flip_y = true;
 		}
@@ -8279,6 +8613,7 @@ void RendererSceneRenderRD::set_debug_draw_mode(RS::ViewportDebugDraw p_debug_dr
 
 void RendererSceneRenderRD::update() {
 	_update_dirty_skys();
+	render_graph.free_unused_textures();
 }
 
 void RendererSceneRenderRD::set_time(double p_time, double p_step) {
@@ -8448,6 +8783,7 @@ RendererSceneRenderRD::RendererSceneRenderRD(RendererStorageRD *p_storage) {
 	sdfgi_ray_count = RS::EnvironmentSDFGIRayCount(CLAMP(int32_t(GLOBAL_GET("rendering/sdfgi/probe_ray_count")), 0, int32_t(RS::ENV_SDFGI_RAY_COUNT_MAX - 1)));
 	sdfgi_frames_to_converge = RS::EnvironmentSDFGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/sdfgi/frames_to_converge")), 0, int32_t(RS::ENV_SDFGI_CONVERGE_MAX - 1)));
 	sdfgi_frames_to_update_light = RS::EnvironmentSDFGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/sdfgi/frames_to_update_lights")), 0, int32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1)));
+	sdfgi_frame_update_budget = MAX(0.0, float(GLOBAL_GET("rendering/sdfgi/frame_update_budget")));
 
 	directional_shadow.size = GLOBAL_GET("rendering/quality/directional_shadow/size");
 	directional_shadow.use_16_bits = GLOBAL_GET("rendering/quality/directional_shadow/16_bits");
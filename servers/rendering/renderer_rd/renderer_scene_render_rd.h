@@ -35,6 +35,7 @@
 #include "core/templates/rid_owner.h"
 #include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/renderer_rd/cluster_builder_rd.h"
+#include "servers/rendering/renderer_rd/render_graph_rd.h"
 #include "servers/rendering/renderer_rd/renderer_storage_rd.h"
 #include "servers/rendering/renderer_rd/shaders/gi.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/giprobe.glsl.gen.h"
@@ -590,12 +591,26 @@ private:
 		RID depth;
 		RID fb; //for copying
 
+		// Same layout as depth, holds the static casters of lights using a static shadow cache.
+		RID static_depth;
+		RID static_fb;
+
 		Map<RID, uint32_t> shadow_owners;
 	};
 
 	RID_Owner<ShadowAtlas> shadow_atlas_owner;
 
+	enum {
+		SHADOW_ATLAS_FALLBACK_MIN_SIZE = 1024, // Atlases are halved down to this size when video memory is near its budget.
+	};
+
+	uint64_t shadow_memory = 0;
+
+	uint64_t _get_shadow_atlas_memory(const ShadowAtlas *shadow_atlas) const;
+
 	void _update_shadow_atlas(ShadowAtlas *shadow_atlas);
+	void _update_shadow_atlas_static_cache(ShadowAtlas *shadow_atlas);
+	Rect2i _get_shadow_atlas_rect(ShadowAtlas *shadow_atlas, RID p_light);
 
 	bool _shadow_atlas_find_shadow(ShadowAtlas *shadow_atlas, int *p_in_quadrants, int p_quadrant_count, int p_current_subdiv, uint64_t p_tick, int &r_quadrant, int &r_shadow);
 
@@ -623,9 +638,14 @@ private:
 		int size = 0;
 		bool use_16_bits = false;
 		int current_light = 0;
+		uint64_t version = 1; // Bumped when the atlas or the light rects change, so clipmaps stop reusing their pages.
+
+		RID clipmap_scroll_depth; // Scratch for moving clipmap pages, as a texture can't be copied onto itself.
+		Size2i clipmap_scroll_size;
 
 	} directional_shadow;
 
+	uint64_t _get_directional_shadow_memory() const;
 	void _update_directional_shadow_atlas();
 
 	/* SHADOW CUBEMAPS */
@@ -900,12 +920,6 @@ private:
 			RID importance_map[2];
 		} ssao;
 
-		struct SSR {
-			RID normal_scaled;
-			RID depth_scaled;
-			RID blur_radius[2];
-		} ssr;
-
 		RID giprobe_textures[MAX_GIPROBES];
 		RID giprobe_buffer;
 
@@ -920,6 +934,29 @@ private:
 		} gi;
 	};
 
+	//intermediate textures of effects are transient, taken from the render graph pool only while used
+	RenderGraphRD render_graph;
+
+	struct SSRGraphData {
+		RendererSceneRenderRD *scene_render = nullptr;
+		RenderBuffers *rb = nullptr;
+		Environment *env = nullptr;
+		RID dest_framebuffer;
+		RID normal_buffer;
+		RID specular_buffer;
+		RID metallic;
+		Color metallic_mask;
+		CameraMatrix projection;
+		bool use_additive = false;
+
+		RenderGraphRD::ResourceID depth_scaled = RenderGraphRD::INVALID_RESOURCE;
+		RenderGraphRD::ResourceID normal_scaled = RenderGraphRD::INVALID_RESOURCE;
+		RenderGraphRD::ResourceID blur_radius[2] = { RenderGraphRD::INVALID_RESOURCE, RenderGraphRD::INVALID_RESOURCE };
+	};
+
+	static void _ssr_graph_trace(const RenderGraphRD::PassContext &p_context, void *p_userdata);
+	static void _ssr_graph_merge(const RenderGraphRD::PassContext &p_context, void *p_userdata);
+
 	RID default_giprobe_buffer;
 
 	/* SDFGI */
@@ -981,6 +1018,7 @@ private:
 			RID lights_buffer;
 
 			bool all_dynamic_lights_dirty = true;
+			uint32_t frames_waiting = 0; //frames a scroll was deferred because the update budget was spent
 		};
 
 		//used for rendering (voxelization)
@@ -1051,6 +1089,7 @@ private:
 	RS::EnvironmentSDFGIFramesToUpdateLight sdfgi_frames_to_update_light = RS::ENV_SDFGI_UPDATE_LIGHT_IN_4_FRAMES;
 
 	float sdfgi_solid_cell_ratio = 0.25;
+	float sdfgi_frame_update_budget = 0.5; //in full cascade volumes, 0 is unlimited
 	Vector3 sdfgi_debug_probe_pos;
 	Vector3 sdfgi_debug_probe_dir;
 	bool sdfgi_debug_probe_enabled = false;
@@ -1600,7 +1639,10 @@ private:
 	uint32_t max_cluster_elements = 512;
 	bool low_end = false;
 
-	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<GeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true);
+	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<GeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, bool p_static_cache = false, const Rect2i &p_clipmap_pages = Rect2i());
+	void _render_shadow_static_caches(const Plane &p_camera_plane, float p_lod_distance_multiplier);
+	Rect2i _get_directional_shadow_atlas_rect(LightInstance *p_light_instance, int p_pass);
+	void _scroll_directional_shadow_clipmaps();
 	void _render_sdfgi_region(RID p_render_buffers, int p_region, const PagedArray<GeometryInstance *> &p_instances);
 	void _render_sdfgi_static_lights(RID p_render_buffers, uint32_t p_cascade_count, const uint32_t *p_cascade_indices, const PagedArray<RID> *p_positional_light_cull_result);
 
@@ -1635,6 +1677,8 @@ public:
 	void directional_shadow_atlas_set_size(int p_size, bool p_16_bits = false);
 	int get_directional_light_shadow_size(RID p_light_intance);
 	void set_directional_shadow_count(int p_count);
+	uint64_t get_directional_shadow_version() const;
+	uint64_t get_shadow_memory_usage() const;
 
 	_FORCE_INLINE_ RID directional_shadow_get_texture() {
 		return directional_shadow.depth;
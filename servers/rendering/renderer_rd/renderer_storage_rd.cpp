@@ -547,17 +547,25 @@ void RendererStorageRD::texture_2d_initialize(RID p_texture, const Ref<Image> &p
 	ERR_FAIL_COND(p_image.is_null());
 	ERR_FAIL_COND(p_image->is_empty());
 
-	TextureToRDFormat ret_format;
-	Ref<Image> image = _validate_texture_format(p_image, ret_format);
-
 	Texture texture;
 
+	Ref<Image> source = p_image;
+	if (source->get_mipmap_count() > 0 && MAX(source->get_width(), source->get_height()) > LOW_MEMORY_MIN_TEXTURE_SIZE && is_video_memory_low()) {
+		// Dropping the top mipmap saves three quarters of the memory, sampling only changes up close.
+		source = p_image->duplicate();
+		source->shrink_x2();
+		texture.mipmap_dropped = true;
+	}
+
+	TextureToRDFormat ret_format;
+	Ref<Image> image = _validate_texture_format(source, ret_format);
+
 	texture.type = Texture::TYPE_2D;
 
-	texture.width = p_image->get_width();
-	texture.height = p_image->get_height();
+	texture.width = source->get_width();
+	texture.height = source->get_height();
 	texture.layers = 1;
-	texture.mipmaps = p_image->get_mipmap_count() + 1;
+	texture.mipmaps = source->get_mipmap_count() + 1;
 	texture.depth = 1;
 	texture.format = p_image->get_format();
 	texture.validated_format = image->get_format();
@@ -592,7 +600,7 @@ void RendererStorageRD::texture_2d_initialize(RID p_texture, const Ref<Image> &p
 	Vector<uint8_t> data = image->get_data(); //use image data
 	Vector<Vector<uint8_t>> data_slices;
 	data_slices.push_back(data);
-	texture.rd_texture = RD::get_singleton()->texture_create(rd_format, rd_view, data_slices);
+	texture.rd_texture = RD::get_singleton()->texture_create_async(rd_format, rd_view, data_slices);
 	ERR_FAIL_COND(texture.rd_texture.is_null());
 	if (texture.rd_format_srgb != RD::DATA_FORMAT_MAX) {
 		rd_view.format_override = texture.rd_format_srgb;
@@ -604,8 +612,8 @@ void RendererStorageRD::texture_2d_initialize(RID p_texture, const Ref<Image> &p
 	}
 
 	//used for 2D, overridable
-	texture.width_2d = texture.width;
-	texture.height_2d = texture.height;
+	texture.width_2d = p_image->get_width();
+	texture.height_2d = p_image->get_height();
 	texture.is_render_target = false;
 	texture.rd_view = rd_view;
 	texture.is_proxy = false;
@@ -702,7 +710,7 @@ void RendererStorageRD::texture_2d_layered_initialize(RID p_texture, const Vecto
 		Vector<uint8_t> data = images[i]->get_data(); //use image data
 		data_slices.push_back(data);
 	}
-	texture.rd_texture = RD::get_singleton()->texture_create(rd_format, rd_view, data_slices);
+	texture.rd_texture = RD::get_singleton()->texture_create_async(rd_format, rd_view, data_slices);
 	ERR_FAIL_COND(texture.rd_texture.is_null());
 	if (texture.rd_format_srgb != RD::DATA_FORMAT_MAX) {
 		rd_view.format_override = texture.rd_format_srgb;
@@ -818,7 +826,7 @@ void RendererStorageRD::texture_3d_initialize(RID p_texture, Image::Format p_for
 	Vector<Vector<uint8_t>> data_slices;
 	data_slices.push_back(all_data); //one slice
 
-	texture.rd_texture = RD::get_singleton()->texture_create(rd_format, rd_view, data_slices);
+	texture.rd_texture = RD::get_singleton()->texture_create_async(rd_format, rd_view, data_slices);
 	ERR_FAIL_COND(texture.rd_texture.is_null());
 	if (texture.rd_format_srgb != RD::DATA_FORMAT_MAX) {
 		rd_view.format_override = texture.rd_format_srgb;
@@ -866,8 +874,15 @@ void RendererStorageRD::_texture_2d_update(RID p_texture, const Ref<Image> &p_im
 	Texture *tex = texture_owner.getornull(p_texture);
 	ERR_FAIL_COND(!tex);
 	ERR_FAIL_COND(tex->is_render_target);
-	ERR_FAIL_COND(p_image->get_width() != tex->width || p_image->get_height() != tex->height);
-	ERR_FAIL_COND(p_image->get_format() != tex->format);
+
+	Ref<Image> image = p_image;
+	if (tex->mipmap_dropped && image->get_mipmap_count() > 0) {
+		image = p_image->duplicate();
+		image->shrink_x2();
+	}
+
+	ERR_FAIL_COND(image->get_width() != tex->width || image->get_height() != tex->height);
+	ERR_FAIL_COND(image->get_format() != tex->format);
 
 	if (tex->type == Texture::TYPE_LAYERED) {
 		ERR_FAIL_INDEX(p_layer, tex->layers);
@@ -877,7 +892,7 @@ void RendererStorageRD::_texture_2d_update(RID p_texture, const Ref<Image> &p_im
 	tex->image_cache_2d.unref();
 #endif
 	TextureToRDFormat f;
-	Ref<Image> validated = _validate_texture_format(p_image, f);
+	Ref<Image> validated = _validate_texture_format(image, f);
 
 	RD::get_singleton()->texture_update(tex->rd_texture, p_layer, validated->get_data());
 }
@@ -2398,6 +2413,10 @@ void RendererStorageRD::_update_queued_materials() {
 
 		if (material->data) {
 			material->data->update_parameters(material->params, material->uniform_dirty, material->texture_dirty);
+			if (material->texture_dirty) {
+				//uniform sets may be shared between materials, so changing textures can change the set used
+				material->dependency.changed_notify(DEPENDENCY_CHANGED_MATERIAL);
+			}
 		}
 		material->update_requested = false;
 		material->texture_dirty = false;
@@ -2463,7 +2482,7 @@ void RendererStorageRD::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_su
 						attrib_stride += sizeof(int16_t) * 4;
 					} break;
 					case RS::ARRAY_TEX_UV: {
-						attrib_stride += sizeof(float) * 2;
+						attrib_stride += (p_surface.format & RS::ARRAY_FLAG_COMPRESS_TEX_UV) ? sizeof(uint16_t) * 2 : sizeof(float) * 2;
 
 					} break;
 					case RS::ARRAY_TEX_UV2: {
@@ -2516,18 +2535,23 @@ void RendererStorageRD::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_su
 
 	bool use_as_storage = (p_surface.skin_data.size() || mesh->blend_shape_count > 0);
 
-	s->vertex_buffer = RD::get_singleton()->vertex_buffer_create(p_surface.vertex_data.size(), p_surface.vertex_data, use_as_storage);
+	//vertex data is the bulk of a mesh, upload it on the transfer queue when available
+	s->vertex_buffer = RD::get_singleton()->vertex_buffer_create(p_surface.vertex_data.size(), Vector<uint8_t>(), use_as_storage);
+	RD::get_singleton()->buffer_update_async(s->vertex_buffer, 0, p_surface.vertex_data.size(), p_surface.vertex_data.ptr());
 	s->vertex_buffer_size = p_surface.vertex_data.size();
 
 	if (p_surface.attribute_data.size()) {
-		s->attribute_buffer = RD::get_singleton()->vertex_buffer_create(p_surface.attribute_data.size(), p_surface.attribute_data);
+		s->attribute_buffer = RD::get_singleton()->vertex_buffer_create(p_surface.attribute_data.size(), Vector<uint8_t>());
+		RD::get_singleton()->buffer_update_async(s->attribute_buffer, 0, p_surface.attribute_data.size(), p_surface.attribute_data.ptr());
 	}
 	if (p_surface.skin_data.size()) {
-		s->skin_buffer = RD::get_singleton()->vertex_buffer_create(p_surface.skin_data.size(), p_surface.skin_data, use_as_storage);
+		s->skin_buffer = RD::get_singleton()->vertex_buffer_create(p_surface.skin_data.size(), Vector<uint8_t>(), use_as_storage);
+		RD::get_singleton()->buffer_update_async(s->skin_buffer, 0, p_surface.skin_data.size(), p_surface.skin_data.ptr());
 		s->skin_buffer_size = p_surface.skin_data.size();
 	}
 
 	s->vertex_count = p_surface.vertex_count;
+	s->memory_size = p_surface.vertex_data.size() + p_surface.attribute_data.size() + p_surface.skin_data.size() + p_surface.index_data.size() + p_surface.blend_shape_data.size();
 
 	if (p_surface.format & RS::ARRAY_FORMAT_BONES) {
 		mesh->has_bone_weights = true;
@@ -2546,12 +2570,25 @@ void RendererStorageRD::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_su
 			for (int i = 0; i < p_surface.lods.size(); i++) {
 				uint32_t indices = p_surface.lods[i].index_data.size() / (is_index_16 ? 2 : 4);
 				s->lods[i].index_buffer = RD::get_singleton()->index_buffer_create(indices, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, p_surface.lods[i].index_data);
+				s->memory_size += p_surface.lods[i].index_data.size();
 				s->lods[i].index_array = RD::get_singleton()->index_array_create(s->lods[i].index_buffer, 0, indices);
 				s->lods[i].edge_length = p_surface.lods[i].edge_length;
 			}
 		}
+
+		if (p_surface.cluster_data.size()) {
+			if (p_surface.cluster_data.size() % sizeof(RS::SurfaceData::Cluster) == 0) {
+				s->cluster_count = p_surface.cluster_data.size() / sizeof(RS::SurfaceData::Cluster);
+				s->cluster_buffer = RD::get_singleton()->storage_buffer_create(p_surface.cluster_data.size(), p_surface.cluster_data);
+				s->memory_size += p_surface.cluster_data.size();
+			} else {
+				ERR_PRINT("Invalid mesh cluster data size, clusters will not be used.");
+			}
+		}
 	}
 
+	atomic_add(&mesh_memory, uint64_t(s->memory_size));
+
 	s->aabb = p_surface.aabb;
 	s->bone_aabbs = p_surface.bone_aabbs; //only really useful for returning them.
 
@@ -2718,6 +2755,10 @@ RS::SurfaceData RendererStorageRD::mesh_get_surface(RID p_mesh, int p_surface) c
 		sd.blend_shape_data = RD::get_singleton()->buffer_get_data(s.blend_shape_buffer);
 	}
 
+	if (s.cluster_buffer.is_valid()) {
+		sd.cluster_data = RD::get_singleton()->buffer_get_data(s.cluster_buffer);
+	}
+
 	return sd;
 }
 
@@ -2894,6 +2935,12 @@ void RendererStorageRD::mesh_clear(RID p_mesh) {
 			RD::get_singleton()->free(s.blend_shape_buffer);
 		}
 
+		if (s.cluster_buffer.is_valid()) {
+			RD::get_singleton()->free(s.cluster_buffer); //clears the uniform set as dependency
+		}
+
+		atomic_sub(&mesh_memory, uint64_t(s.memory_size));
+
 		memdelete(mesh->surfaces[i]);
 	}
 	if (mesh->surfaces) {
@@ -2950,6 +2997,7 @@ void RendererStorageRD::mesh_instance_set_skeleton(RID p_mesh_instance, RID p_sk
 	if (mi->skeleton == p_skeleton) {
 		return;
 	}
+	_mesh_instance_unshare_skin(mi);
 	mi->skeleton = p_skeleton;
 	mi->skeleton_version = 0;
 	mi->dirty = true;
@@ -2964,7 +3012,24 @@ void RendererStorageRD::mesh_instance_set_blend_shape_weight(RID p_mesh_instance
 	//will be eventually updated
 }
 
+void RendererStorageRD::_mesh_instance_unshare_skin(MeshInstance *mi) {
+	if (mi->skin_source) {
+		mi->skin_source->skin_shares.remove(&mi->skin_share_item);
+		mi->skin_source = nullptr;
+	}
+
+	//instances reading our vertices have to skin their own from now on
+	while (mi->skin_shares.first()) {
+		MeshInstance *shared = mi->skin_shares.first()->self();
+		mi->skin_shares.remove(&shared->skin_share_item);
+		shared->skin_source = nullptr;
+		shared->dirty = true;
+	}
+}
+
 void RendererStorageRD::_mesh_instance_clear(MeshInstance *mi) {
+	_mesh_instance_unshare_skin(mi);
+
 	for (uint32_t i = 0; i < mi->surfaces.size(); i++) {
 		if (mi->surfaces[i].vertex_buffer.is_valid()) {
 			RD::get_singleton()->free(mi->surfaces[i].vertex_buffer);
@@ -3070,11 +3135,40 @@ void RendererStorageRD::update_mesh_instances() {
 	//process skeletons and blend shapes
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 
+	mesh_instance_update_pass++;
+
 	while (dirty_mesh_instance_arrays.first()) {
 		MeshInstance *mi = dirty_mesh_instance_arrays.first()->self();
 
 		Skeleton *sk = skeleton_owner.getornull(mi->skeleton);
 
+		_mesh_instance_unshare_skin(mi);
+
+		if (sk && sk->size && mi->mesh->has_bone_weights && mi->mesh->blend_shape_count == 0) {
+			//without blend shapes the result depends only on mesh and pose, so reuse an instance already skinned in this pass
+			if (sk->skin_share_pass != mesh_instance_update_pass) {
+				sk->skin_share_pass = mesh_instance_update_pass;
+				sk->skin_share_sources.clear();
+			}
+
+			for (uint32_t i = 0; i < sk->skin_share_sources.size(); i++) {
+				if (sk->skin_share_sources[i]->mesh == mi->mesh) {
+					mi->skin_source = sk->skin_share_sources[i];
+					mi->skin_source->skin_shares.add(&mi->skin_share_item);
+					break;
+				}
+			}
+
+			if (mi->skin_source) {
+				mi->dirty = false;
+				mi->skeleton_version = sk->version;
+				dirty_mesh_instance_arrays.remove(&mi->array_update_list);
+				continue;
+			}
+
+			sk->skin_share_sources.push_back(mi);
+		}
+
 		for (uint32_t i = 0; i < mi->surfaces.size(); i++) {
 			if (mi->surfaces[i].uniform_set == RID() || mi->mesh->surfaces[i]->uniform_set == RID()) {
 				continue;
@@ -3237,8 +3331,13 @@ void RendererStorageRD::_mesh_surface_generate_version_for_input_mask(Mesh::Surf
 				case RS::ARRAY_TEX_UV: {
 					vd.offset = attribute_stride;
 
-					vd.format = RD::DATA_FORMAT_R32G32_SFLOAT;
-					attribute_stride += sizeof(float) * 2;
+					if (s->format & RS::ARRAY_FLAG_COMPRESS_TEX_UV) {
+						vd.format = RD::DATA_FORMAT_R16G16_SFLOAT;
+						attribute_stride += sizeof(uint16_t) * 2;
+					} else {
+						vd.format = RD::DATA_FORMAT_R32G32_SFLOAT;
+						attribute_stride += sizeof(float) * 2;
+					}
 					buffer = s->attribute_buffer;
 
 				} break;
@@ -3925,6 +4024,7 @@ void RendererStorageRD::particles_set_amount(RID p_particles, int p_amount) {
 	_particles_free_data(particles);
 
 	particles->amount = p_amount;
+	particles->sort_dirty = true;
 
 	if (particles->amount > 0) {
 		particles->particle_buffer = RD::get_singleton()->storage_buffer_create(sizeof(ParticleData) * p_amount);
@@ -4041,6 +4141,7 @@ void RendererStorageRD::particles_set_draw_order(RID p_particles, RS::ParticlesD
 	ERR_FAIL_COND(!particles);
 
 	particles->draw_order = p_order;
+	particles->sort_dirty = true;
 }
 
 void RendererStorageRD::particles_set_draw_passes(RID p_particles, int p_passes) {
@@ -4552,6 +4653,7 @@ void RendererStorageRD::_particles_process(Particles *p_particles, float p_delta
 	}
 
 	p_particles->clear = false;
+	p_particles->sort_dirty = true;
 
 	RD::get_singleton()->buffer_update(p_particles->frame_params_buffer, 0, sizeof(ParticlesFrameParams), &frame_params);
 
@@ -4584,10 +4686,20 @@ void RendererStorageRD::particles_set_view_axis(RID p_particles, const Vector3 &
 	Particles *particles = particles_owner.getornull(p_particles);
 	ERR_FAIL_COND(!particles);
 
-	if (particles->draw_order != RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH) {
+	if (particles->draw_order != RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH || particles->amount == 0) {
 		return; //uninteresting for other modes
 	}
 
+	Vector3 axis = -p_axis; // cameras look to z negative
+
+	if (particles->use_local_coords) {
+		axis = particles->emission_transform.basis.xform_inv(axis).normalized();
+	}
+
+	if (!particles->sort_dirty && axis.is_equal_approx(particles->sort_axis)) {
+		return; //neither the particles nor the view moved since the last sort
+	}
+
 	//copy to sort buffer
 	if (particles->particles_sort_buffer == RID()) {
 		uint32_t size = particles->amount;
@@ -4611,39 +4723,84 @@ void RendererStorageRD::particles_set_view_axis(RID p_particles, const Vector3 &
 		}
 	}
 
-	Vector3 axis = -p_axis; // cameras look to z negative
+	particles->sort_axis = axis;
 
-	if (particles->use_local_coords) {
-		axis = particles->emission_transform.basis.xform_inv(axis).normalized();
+	//sorted later in update_particles_sort(), together with the other visible systems
+	if (!particles->sort_queued) {
+		particles->sort_queued = true;
+		particle_sort_list.push_back(particles);
 	}
+}
 
-	ParticlesShader::CopyPushConstant copy_push_constant;
-	copy_push_constant.total_particles = particles->amount;
-	copy_push_constant.sort_direction[0] = axis.x;
-	copy_push_constant.sort_direction[1] = axis.y;
-	copy_push_constant.sort_direction[2] = axis.z;
+void RendererStorageRD::particles_set_view_screen_size(RID p_particles, float p_size) {
+	Particles *particles = particles_owner.getornull(p_particles);
+	ERR_FAIL_COND(!particles);
+
+	particles->view_screen_size = MAX(particles->view_screen_size, p_size);
+}
+
+void RendererStorageRD::update_particles_sort() {
+	if (particle_sort_list.size() == 0) {
+		return;
+	}
+
+	//the systems are independent, so they share compute lists and barriers instead of waiting on each other
 
 	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
 	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[ParticlesShader::COPY_MODE_FILL_SORT_BUFFER]);
-	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
-	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
-	RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
 
-	RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
+	for (uint32_t i = 0; i < particle_sort_list.size(); i++) {
+		const Particles *particles = particle_sort_list[i];
+
+		ParticlesShader::CopyPushConstant copy_push_constant;
+		copy_push_constant.total_particles = particles->amount;
+		copy_push_constant.sort_direction[0] = particles->sort_axis.x;
+		copy_push_constant.sort_direction[1] = particles->sort_axis.y;
+		copy_push_constant.sort_direction[2] = particles->sort_axis.z;
+
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
+
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
+	}
 
 	RD::get_singleton()->compute_list_end();
 
-	effects.sort_buffer(particles->particles_sort_uniform_set, particles->amount);
+	particle_sort_uniform_sets.resize(particle_sort_list.size());
+	particle_sort_sizes.resize(particle_sort_list.size());
+	for (uint32_t i = 0; i < particle_sort_list.size(); i++) {
+		particle_sort_uniform_sets[i] = particle_sort_list[i]->particles_sort_uniform_set;
+		particle_sort_sizes[i] = particle_sort_list[i]->amount;
+	}
+
+	effects.sort_buffers(particle_sort_uniform_sets.ptr(), particle_sort_sizes.ptr(), particle_sort_list.size());
 
 	compute_list = RD::get_singleton()->compute_list_begin();
 	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, particles_shader.copy_pipelines[ParticlesShader::COPY_MODE_FILL_INSTANCES_WITH_SORT_BUFFER]);
-	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
-	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
-	RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
 
-	RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
+	for (uint32_t i = 0; i < particle_sort_list.size(); i++) {
+		Particles *particles = particle_sort_list[i];
+
+		ParticlesShader::CopyPushConstant copy_push_constant;
+		copy_push_constant.total_particles = particles->amount;
+		copy_push_constant.sort_direction[0] = particles->sort_axis.x;
+		copy_push_constant.sort_direction[1] = particles->sort_axis.y;
+		copy_push_constant.sort_direction[2] = particles->sort_axis.z;
+
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_copy_uniform_set, 0);
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, particles->particles_sort_uniform_set, 1);
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &copy_push_constant, sizeof(ParticlesShader::CopyPushConstant));
+
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, particles->amount, 1, 1);
+
+		particles->sort_queued = false;
+		particles->sort_dirty = false;
+	}
 
 	RD::get_singleton()->compute_list_end();
+
+	particle_sort_list.clear();
 }
 
 void RendererStorageRD::update_particles() {
@@ -4657,6 +4814,9 @@ void RendererStorageRD::update_particles() {
 		particles->update_list = nullptr;
 		particles->dirty = false;
 
+		float view_screen_size = particles->view_screen_size;
+		particles->view_screen_size = -1.0;
+
 		if (particles->restart_request) {
 			particles->prev_ticks = 0;
 			particles->phase = 0;
@@ -4688,6 +4848,20 @@ void RendererStorageRD::update_particles() {
 			}
 		}
 
+		float lod_delta = 0.0;
+		if (particles->fixed_fps == 0 && !particles->clear && particles_lod_screen_size > 0.0 && view_screen_size >= 0.0 && view_screen_size < particles_lod_screen_size) {
+			//small on screen, simulate less often with a longer step
+			uint32_t lod_interval = view_screen_size > 0.0 ? MIN(uint32_t(particles_lod_screen_size / view_screen_size), (uint32_t)PARTICLES_LOD_MAX_INTERVAL) : (uint32_t)PARTICLES_LOD_MAX_INTERVAL;
+			if (particles->lod_skipped_frames + 1 < lod_interval) {
+				particles->lod_skipped_frames++;
+				particles->lod_skipped_time += RendererCompositorRD::singleton->get_frame_delta_time();
+				continue; //keep drawing the last simulated frame
+			}
+			lod_delta = particles->lod_skipped_time;
+		}
+		particles->lod_skipped_frames = 0;
+		particles->lod_skipped_time = 0.0;
+
 		bool zero_time_scale = Engine::get_singleton()->get_time_scale() <= 0.0;
 
 		if (particles->clear && particles->pre_process_time > 0.0) {
@@ -4734,7 +4908,7 @@ void RendererStorageRD::update_particles() {
 			if (zero_time_scale)
 				_particles_process(particles, 0.0);
 			else
-				_particles_process(particles, RendererCompositorRD::singleton->get_frame_delta_time());
+				_particles_process(particles, RendererCompositorRD::singleton->get_frame_delta_time() + lod_delta);
 		}
 
 		//copy particles to instance buffer
@@ -5195,6 +5369,9 @@ void RendererStorageRD::skeleton_initialize(RID p_rid) {
 }
 
 void RendererStorageRD::_skeleton_make_dirty(Skeleton *skeleton) {
+	skeleton->dirty_bone_from = 0;
+	skeleton->dirty_bone_to = skeleton->size - 1;
+
 	if (!skeleton->dirty) {
 		skeleton->dirty = true;
 		skeleton->dirty_list = skeleton_dirty_list;
@@ -5202,6 +5379,19 @@ void RendererStorageRD::_skeleton_make_dirty(Skeleton *skeleton) {
 	}
 }
 
+void RendererStorageRD::_skeleton_make_bone_dirty(Skeleton *skeleton, int p_bone) {
+	if (!skeleton->dirty) {
+		skeleton->dirty = true;
+		skeleton->dirty_list = skeleton_dirty_list;
+		skeleton_dirty_list = skeleton;
+		skeleton->dirty_bone_from = p_bone;
+		skeleton->dirty_bone_to = p_bone;
+	} else {
+		skeleton->dirty_bone_from = MIN(skeleton->dirty_bone_from, p_bone);
+		skeleton->dirty_bone_to = MAX(skeleton->dirty_bone_to, p_bone);
+	}
+}
+
 void RendererStorageRD::skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_skeleton) {
 	Skeleton *skeleton = skeleton_owner.getornull(p_skeleton);
 	ERR_FAIL_COND(!skeleton);
@@ -5259,22 +5449,30 @@ void RendererStorageRD::skeleton_bone_set_transform(RID p_skeleton, int p_bone,
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(skeleton->use_2d);
 
+	float bone[12] = {
+		p_transform.basis.elements[0][0],
+		p_transform.basis.elements[0][1],
+		p_transform.basis.elements[0][2],
+		p_transform.origin.x,
+		p_transform.basis.elements[1][0],
+		p_transform.basis.elements[1][1],
+		p_transform.basis.elements[1][2],
+		p_transform.origin.y,
+		p_transform.basis.elements[2][0],
+		p_transform.basis.elements[2][1],
+		p_transform.basis.elements[2][2],
+		p_transform.origin.z
+	};
+
 	float *dataptr = skeleton->data.ptrw() + p_bone * 12;
 
-	dataptr[0] = p_transform.basis.elements[0][0];
-	dataptr[1] = p_transform.basis.elements[0][1];
-	dataptr[2] = p_transform.basis.elements[0][2];
-	dataptr[3] = p_transform.origin.x;
-	dataptr[4] = p_transform.basis.elements[1][0];
-	dataptr[5] = p_transform.basis.elements[1][1];
-	dataptr[6] = p_transform.basis.elements[1][2];
-	dataptr[7] = p_transform.origin.y;
-	dataptr[8] = p_transform.basis.elements[2][0];
-	dataptr[9] = p_transform.basis.elements[2][1];
-	dataptr[10] = p_transform.basis.elements[2][2];
-	dataptr[11] = p_transform.origin.z;
+	if (memcmp(dataptr, bone, sizeof(bone)) == 0) {
+		return; //unchanged, avoid uploading and re-skinning
+	}
+
+	memcpy(dataptr, bone, sizeof(bone));
 
-	_skeleton_make_dirty(skeleton);
+	_skeleton_make_bone_dirty(skeleton, p_bone);
 }
 
 Transform RendererStorageRD::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
@@ -5311,18 +5509,26 @@ void RendererStorageRD::skeleton_bone_set_transform_2d(RID p_skeleton, int p_bon
 	ERR_FAIL_INDEX(p_bone, skeleton->size);
 	ERR_FAIL_COND(!skeleton->use_2d);
 
+	float bone[8] = {
+		p_transform.elements[0][0],
+		p_transform.elements[1][0],
+		0,
+		p_transform.elements[2][0],
+		p_transform.elements[0][1],
+		p_transform.elements[1][1],
+		0,
+		p_transform.elements[2][1]
+	};
+
 	float *dataptr = skeleton->data.ptrw() + p_bone * 8;
 
-	dataptr[0] = p_transform.elements[0][0];
-	dataptr[1] = p_transform.elements[1][0];
-	dataptr[2] = 0;
-	dataptr[3] = p_transform.elements[2][0];
-	dataptr[4] = p_transform.elements[0][1];
-	dataptr[5] = p_transform.elements[1][1];
-	dataptr[6] = 0;
-	dataptr[7] = p_transform.elements[2][1];
+	if (memcmp(dataptr, bone, sizeof(bone)) == 0) {
+		return; //unchanged, avoid uploading and re-skinning
+	}
+
+	memcpy(dataptr, bone, sizeof(bone));
 
-	_skeleton_make_dirty(skeleton);
+	_skeleton_make_bone_dirty(skeleton, p_bone);
 }
 
 Transform2D RendererStorageRD::skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const {
@@ -5357,8 +5563,12 @@ void RendererStorageRD::_update_dirty_skeletons() {
 	while (skeleton_dirty_list) {
 		Skeleton *skeleton = skeleton_dirty_list;
 
-		if (skeleton->size) {
-			RD::get_singleton()->buffer_update(skeleton->buffer, 0, skeleton->data.size() * sizeof(float), skeleton->data.ptr());
+		if (skeleton->size && skeleton->dirty_bone_to >= skeleton->dirty_bone_from) {
+			//only upload the range of bones that changed
+			uint32_t bone_size = (skeleton->use_2d ? 8 : 12) * sizeof(float);
+			uint32_t from = skeleton->dirty_bone_from * bone_size;
+			uint32_t size = (skeleton->dirty_bone_to - skeleton->dirty_bone_from + 1) * bone_size;
+			RD::get_singleton()->buffer_update(skeleton->buffer, from, size, (const uint8_t *)skeleton->data.ptr() + from);
 		}
 
 		skeleton_dirty_list = skeleton->dirty_list;
@@ -6878,6 +7088,7 @@ RID RendererStorageRD::render_target_get_sdf_texture(RID p_render_target) {
 
 void RendererStorageRD::_render_target_allocate_sdf(RenderTarget *rt) {
 	ERR_FAIL_COND(rt->sdf_buffer_write_fb.is_valid());
+	rt->sdf_occluder_hash = 0;
 	if (rt->sdf_buffer_read.is_valid()) {
 		RD::get_singleton()->free(rt->sdf_buffer_read);
 		rt->sdf_buffer_read = RID();
@@ -6971,6 +7182,7 @@ void RendererStorageRD::_render_target_allocate_sdf(RenderTarget *rt) {
 }
 
 void RendererStorageRD::_render_target_clear_sdf(RenderTarget *rt) {
+	rt->sdf_occluder_hash = 0;
 	if (rt->sdf_buffer_read.is_valid()) {
 		RD::get_singleton()->free(rt->sdf_buffer_read);
 		rt->sdf_buffer_read = RID();
@@ -6998,6 +7210,20 @@ RID RendererStorageRD::render_target_get_sdf_framebuffer(RID p_render_target) {
 
 	return rt->sdf_buffer_write_fb;
 }
+uint32_t RendererStorageRD::render_target_get_sdf_occluder_hash(RID p_render_target) const {
+	const RenderTarget *rt = render_target_owner.getornull(p_render_target);
+	ERR_FAIL_COND_V(!rt, 0);
+
+	return rt->sdf_occluder_hash;
+}
+
+void RendererStorageRD::render_target_set_sdf_occluder_hash(RID p_render_target, uint32_t p_hash) {
+	RenderTarget *rt = render_target_owner.getornull(p_render_target);
+	ERR_FAIL_COND(!rt);
+
+	rt->sdf_occluder_hash = p_hash;
+}
+
 void RendererStorageRD::render_target_sdf_process(RID p_render_target) {
 	RenderTarget *rt = render_target_owner.getornull(p_render_target);
 	ERR_FAIL_COND(!rt);
@@ -8187,6 +8413,34 @@ bool RendererStorageRD::has_os_feature(const String &p_feature) const {
 	return false;
 }
 
+uint64_t RendererStorageRD::get_render_info(RS::RenderInfo p_info) {
+	switch (p_info) {
+		case RS::INFO_VIDEO_MEM_USED:
+			return RD::get_singleton()->get_memory_usage(RD::MEMORY_TOTAL);
+		case RS::INFO_TEXTURE_MEM_USED:
+			return RD::get_singleton()->get_memory_usage(RD::MEMORY_TEXTURES);
+		case RS::INFO_VERTEX_MEM_USED:
+			return mesh_memory;
+		case RS::INFO_RENDER_TARGET_MEM_USED:
+			return RD::get_singleton()->get_memory_usage(RD::MEMORY_RENDER_TEXTURES);
+		case RS::INFO_VIDEO_MEM_BUDGET:
+			return RD::get_singleton()->get_memory_budget();
+		default:
+			return 0;
+	}
+}
+
+bool RendererStorageRD::is_video_memory_low() const {
+	if (low_video_memory_threshold <= 0.0) {
+		return false;
+	}
+	uint64_t budget = RD::get_singleton()->get_memory_budget();
+	if (budget == 0) {
+		return false; //not reported by the driver
+	}
+	return RD::get_singleton()->get_memory_usage(RD::MEMORY_TOTAL) > uint64_t(budget * double(low_video_memory_threshold));
+}
+
 bool RendererStorageRD::free(RID p_rid) {
 	if (texture_owner.owns(p_rid)) {
 		Texture *t = texture_owner.getornull(p_rid);
@@ -8843,6 +9097,10 @@ RendererStorageRD::RendererStorageRD() {
 
 	lightmap_probe_capture_update_speed = GLOBAL_GET("rendering/lightmapper/probe_capture_update_speed");
 
+	particles_lod_screen_size = GLOBAL_GET("rendering/quality/particles/simulation_lod_screen_size");
+
+	low_video_memory_threshold = GLOBAL_GET("rendering/quality/video_memory/low_memory_threshold");
+
 	/* Particles */
 
 	{
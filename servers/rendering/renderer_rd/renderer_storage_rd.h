@@ -224,6 +224,11 @@ private:
 	RID_PtrOwner<CanvasTexture, true> canvas_texture_owner;
 
 	/* TEXTURE API */
+
+	enum {
+		LOW_MEMORY_MIN_TEXTURE_SIZE = 256, // Smaller textures keep all their mipmaps when video memory is low.
+	};
+
 	struct Texture {
 		enum Type {
 			TYPE_2D,
@@ -254,6 +259,8 @@ private:
 		int height_2d;
 		int width_2d;
 
+		bool mipmap_dropped = false; // Created without its top mipmap as video memory was low, width_2d and height_2d keep the full size.
+
 		struct BufferSlice3D {
 			Size2i size;
 			uint32_t offset = 0;
@@ -410,6 +417,7 @@ private:
 			uint32_t vertex_count = 0;
 			uint32_t vertex_buffer_size = 0;
 			uint32_t skin_buffer_size = 0;
+			uint32_t memory_size = 0; // All the buffers of the surface, for the vertex memory stats.
 
 			// A different pipeline needs to be allocated
 			// depending on the inputs available in the
@@ -441,6 +449,10 @@ private:
 			LOD *lods = nullptr;
 			uint32_t lod_count = 0;
 
+			RID cluster_buffer; // RS::SurfaceData::Cluster array, ranges of the LOD 0 index array.
+			uint32_t cluster_count = 0;
+			RID cluster_uniform_set;
+
 			AABB aabb;
 
 			Vector<AABB> bone_aabbs;
@@ -486,6 +498,8 @@ private:
 
 	mutable RID_Owner<Mesh, true> mesh_owner;
 
+	volatile uint64_t mesh_memory = 0; // Surfaces can be added from loader threads.
+
 	struct MeshInstance {
 		Mesh *mesh;
 		RID skeleton;
@@ -506,12 +520,21 @@ private:
 		bool weights_dirty = false;
 		SelfList<MeshInstance> weight_update_list;
 		SelfList<MeshInstance> array_update_list;
+
+		//instances of the same mesh driven by the same skeleton reuse the vertices skinned by the first one
+		MeshInstance *skin_source = nullptr;
+		SelfList<MeshInstance>::List skin_shares;
+		SelfList<MeshInstance> skin_share_item;
+
 		MeshInstance() :
-				weight_update_list(this), array_update_list(this) {}
+				weight_update_list(this), array_update_list(this), skin_share_item(this) {}
 	};
 
 	void _mesh_instance_clear(MeshInstance *mi);
 	void _mesh_instance_add_surface(MeshInstance *mi, Mesh *mesh, uint32_t p_surface);
+	void _mesh_instance_unshare_skin(MeshInstance *mi);
+
+	uint64_t mesh_instance_update_pass = 0;
 
 	mutable RID_PtrOwner<MeshInstance> mesh_instance_owner;
 
@@ -724,10 +747,17 @@ private:
 
 		RID particles_sort_buffer;
 		RID particles_sort_uniform_set;
+		Vector3 sort_axis;
+		bool sort_dirty = true; // Simulated since the last sort.
+		bool sort_queued = false;
 
 		bool dirty = false;
 		Particles *update_list = nullptr;
 
+		float view_screen_size = -1.0; // Largest size on screen since the last update, negative if unknown.
+		uint32_t lod_skipped_frames = 0;
+		float lod_skipped_time = 0.0;
+
 		RID sub_emitter;
 
 		float phase;
@@ -833,6 +863,18 @@ private:
 
 	Particles *particle_update_list = nullptr;
 
+	enum {
+		PARTICLES_LOD_MAX_INTERVAL = 4, // Far away systems are simulated at least every this many frames.
+	};
+
+	float particles_lod_screen_size = 0.1;
+
+	float low_video_memory_threshold = 0.9;
+
+	LocalVector<Particles *> particle_sort_list;
+	LocalVector<RID> particle_sort_uniform_sets;
+	LocalVector<int> particle_sort_sizes;
+
 	struct ParticlesShaderData : public ShaderData {
 		bool valid;
 		RID version;
@@ -892,6 +934,7 @@ private:
 	}
 
 	void update_particles();
+	void update_particles_sort();
 
 	mutable RID_Owner<Particles, true> particles_owner;
 
@@ -942,12 +985,21 @@ private:
 
 		uint64_t version = 1;
 
+		//range of bones changed since the last upload
+		int dirty_bone_from = 0;
+		int dirty_bone_to = -1;
+
+		//mesh instances skinned with this skeleton during the current update pass
+		uint64_t skin_share_pass = 0;
+		LocalVector<MeshInstance *> skin_share_sources;
+
 		Dependency dependency;
 	};
 
 	mutable RID_Owner<Skeleton, true> skeleton_owner;
 
 	_FORCE_INLINE_ void _skeleton_make_dirty(Skeleton *skeleton);
+	_FORCE_INLINE_ void _skeleton_make_bone_dirty(Skeleton *skeleton, int p_bone);
 
 	Skeleton *skeleton_dirty_list = nullptr;
 
@@ -1132,6 +1184,7 @@ private:
 		RID sdf_buffer_process[2];
 		RID sdf_buffer_read;
 		RID sdf_buffer_process_uniform_sets[2];
+		uint32_t sdf_occluder_hash = 0; // Occluders the SDF was last generated from.
 		RS::ViewportSDFOversize sdf_oversize = RS::VIEWPORT_SDF_OVERSIZE_120_PERCENT;
 		RS::ViewportSDFScale sdf_scale = RS::VIEWPORT_SDF_SCALE_50_PERCENT;
 		Size2i process_size;
@@ -1518,6 +1571,27 @@ public:
 		}
 	}
 
+	_FORCE_INLINE_ uint32_t mesh_surface_get_cluster_count(void *p_surface) const {
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+		return s->cluster_count;
+	}
+
+	_FORCE_INLINE_ RID mesh_surface_get_cluster_uniform_set(void *p_surface, RID p_shader, uint32_t p_set) {
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+
+		if (s->cluster_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(s->cluster_uniform_set)) {
+			Vector<RD::Uniform> uniforms;
+			RD::Uniform u;
+			u.binding = 0;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.ids.push_back(s->cluster_buffer);
+			uniforms.push_back(u);
+			s->cluster_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, p_shader, p_set);
+		}
+
+		return s->cluster_uniform_set;
+	}
+
 	_FORCE_INLINE_ void mesh_surface_get_vertex_arrays_and_format(void *p_surface, uint32_t p_input_mask, RID &r_vertex_array_rd, RD::VertexFormatID &r_vertex_format) {
 		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
 
@@ -1551,6 +1625,9 @@ public:
 	_FORCE_INLINE_ void mesh_instance_surface_get_vertex_arrays_and_format(RID p_mesh_instance, uint32_t p_surface_index, uint32_t p_input_mask, RID &r_vertex_array_rd, RD::VertexFormatID &r_vertex_format) {
 		MeshInstance *mi = mesh_instance_owner.getornull(p_mesh_instance);
 		ERR_FAIL_COND(!mi);
+		if (mi->skin_source) {
+			mi = mi->skin_source;
+		}
 		Mesh *mesh = mi->mesh;
 		ERR_FAIL_UNSIGNED_INDEX(p_surface_index, mesh->surface_count);
 
@@ -2123,6 +2200,7 @@ public:
 	RID particles_get_draw_pass_mesh(RID p_particles, int p_pass) const;
 
 	void particles_set_view_axis(RID p_particles, const Vector3 &p_axis);
+	void particles_set_view_screen_size(RID p_particles, float p_size);
 
 	virtual bool particles_is_inactive(RID p_particles) const;
 
@@ -2235,6 +2313,8 @@ public:
 	RID render_target_get_sdf_texture(RID p_render_target);
 	RID render_target_get_sdf_framebuffer(RID p_render_target);
 	void render_target_sdf_process(RID p_render_target);
+	uint32_t render_target_get_sdf_occluder_hash(RID p_render_target) const;
+	void render_target_set_sdf_occluder_hash(RID p_render_target, uint32_t p_hash);
 	virtual Rect2i render_target_get_sdf_rect(RID p_render_target) const;
 
 	Size2 render_target_get_size(RID p_render_target);
@@ -2263,7 +2343,8 @@ public:
 	void render_info_end_capture() {}
 	int get_captured_render_info(RS::RenderInfo p_info) { return 0; }
 
-	int get_render_info(RS::RenderInfo p_info) { return 0; }
+	uint64_t get_render_info(RS::RenderInfo p_info);
+	bool is_video_memory_low() const;
 	String get_video_adapter_name() const { return String(); }
 	String get_video_adapter_vendor() const { return String(); }
 
@@ -1308,7 +1308,45 @@ ShaderLanguage::DataType ShaderCompilerRD::_get_variable_type(const StringName &
 	return RS::global_variable_type_get_shader_datatype(gvt);
 }
 
+void ShaderCompilerRD::_apply_cached_shader(const CachedShader &p_cached, IdentifierActions *p_actions, GeneratedCode &r_gen_code) {
+	r_gen_code = p_cached.gen_code;
+
+	for (int i = 0; i < p_cached.render_modes.size(); i++) {
+		if (p_actions->render_mode_flags.has(p_cached.render_modes[i])) {
+			*p_actions->render_mode_flags[p_cached.render_modes[i]] = true;
+		}
+
+		if (p_actions->render_mode_values.has(p_cached.render_modes[i])) {
+			Pair<int *, int> &p = p_actions->render_mode_values[p_cached.render_modes[i]];
+			*p.first = p.second;
+		}
+	}
+
+	for (int i = 0; i < p_cached.usage_flags.size(); i++) {
+		if (p_actions->usage_flag_pointers.has(p_cached.usage_flags[i])) {
+			*p_actions->usage_flag_pointers[p_cached.usage_flags[i]] = true;
+		}
+	}
+
+	for (int i = 0; i < p_cached.write_flags.size(); i++) {
+		if (p_actions->write_flag_pointers.has(p_cached.write_flags[i])) {
+			*p_actions->write_flag_pointers[p_cached.write_flags[i]] = true;
+		}
+	}
+
+	for (const Map<StringName, SL::ShaderNode::Uniform>::Element *E = p_cached.uniforms.front(); E; E = E->next()) {
+		p_actions->uniforms->insert(E->key(), E->get());
+	}
+}
+
 Error ShaderCompilerRD::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	String cache_key = itos(p_mode) + ":" + p_code;
+	const CachedShader *cached = compile_cache.getptr(cache_key);
+	if (cached) {
+		_apply_cached_shader(*cached, p_actions, r_gen_code);
+		return OK;
+	}
+
 	Error err = parser.compile(p_code, ShaderTypes::get_singleton()->get_functions(p_mode), ShaderTypes::get_singleton()->get_modes(p_mode), ShaderTypes::get_singleton()->get_types(), _get_variable_type);
 
 	if (err != OK) {
@@ -1321,18 +1359,6 @@ Error ShaderCompilerRD::compile(RS::ShaderMode p_mode, const String &p_code, Ide
 		return err;
 	}
 
-	r_gen_code.defines.clear();
-	r_gen_code.vertex = String();
-	r_gen_code.vertex_global = String();
-	r_gen_code.fragment = String();
-	r_gen_code.fragment_global = String();
-	r_gen_code.compute = String();
-	r_gen_code.compute_global = String();
-	r_gen_code.light = String();
-	r_gen_code.uses_fragment_time = false;
-	r_gen_code.uses_vertex_time = false;
-	r_gen_code.uses_global_textures = false;
-
 	used_name_defines.clear();
 	used_rmode_defines.clear();
 	used_flag_pointers.clear();
@@ -1340,7 +1366,51 @@ Error ShaderCompilerRD::compile(RS::ShaderMode p_mode, const String &p_code, Ide
 
 	shader = parser.get_shader();
 	function = nullptr;
-	_dump_node_code(shader, 1, r_gen_code, *p_actions, actions, false);
+
+	// Generate against flags owned here, to record which ones the code sets, then apply them like a cache hit.
+	Map<StringName, bool> usage_flags;
+	Map<StringName, bool> write_flags;
+	IdentifierActions recording;
+	for (const Map<StringName, bool *>::Element *E = p_actions->usage_flag_pointers.front(); E; E = E->next()) {
+		recording.usage_flag_pointers[E->key()] = &(usage_flags[E->key()] = false);
+	}
+	for (const Map<StringName, bool *>::Element *E = p_actions->write_flag_pointers.front(); E; E = E->next()) {
+		recording.write_flag_pointers[E->key()] = &(write_flags[E->key()] = false);
+	}
+
+	CachedShader compiled;
+	recording.uniforms = &compiled.uniforms;
+	_dump_node_code(shader, 1, compiled.gen_code, recording, actions, false);
+
+	compiled.render_modes = shader->render_modes;
+	for (const Map<StringName, bool>::Element *E = usage_flags.front(); E; E = E->next()) {
+		if (E->get()) {
+			compiled.usage_flags.push_back(E->key());
+		}
+	}
+	for (const Map<StringName, bool>::Element *E = write_flags.front(); E; E = E->next()) {
+		if (E->get()) {
+			compiled.write_flags.push_back(E->key());
+		}
+	}
+
+	_apply_cached_shader(compiled, p_actions, r_gen_code);
+
+	// Global uniform types come from the project settings and can change, so those shaders are always compiled again.
+	bool uses_global_uniforms = false;
+	for (const Map<StringName, SL::ShaderNode::Uniform>::Element *E = compiled.uniforms.front(); E; E = E->next()) {
+		if (E->get().scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL) {
+			uses_global_uniforms = true;
+			break;
+		}
+	}
+
+	if (!uses_global_uniforms) {
+		if (compile_cache.size() >= MAX_CACHED_SHADERS) {
+			compile_cache.clear();
+		}
+		compile_cache.set(cache_key, compiled);
+	}
 
 	return OK;
 }
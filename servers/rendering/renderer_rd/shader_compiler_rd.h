@@ -31,6 +31,7 @@
 #ifndef SHADER_COMPILER_RD_H
 #define SHADER_COMPILER_RD_H
 
+#include "core/templates/hash_map.h"
 #include "core/templates/pair.h"
 #include "servers/rendering/shader_language.h"
 #include "servers/rendering/shader_types.h"
@@ -61,7 +62,7 @@ public:
 		Vector<Texture> texture_uniforms;
 
 		Vector<uint32_t> uniform_offsets;
-		uint32_t uniform_total_size;
+		uint32_t uniform_total_size = 0;
 		String uniforms;
 		String vertex_global;
 		String vertex;
@@ -71,9 +72,9 @@ public:
 		String compute_global;
 		String compute;
 
-		bool uses_global_textures;
-		bool uses_fragment_time;
-		bool uses_vertex_time;
+		bool uses_global_textures = false;
+		bool uses_fragment_time = false;
+		bool uses_vertex_time = false;
 	};
 
 	struct DefaultIdentifierActions {
@@ -95,6 +96,25 @@ public:
 private:
 	ShaderLanguage parser;
 
+	// What a successful compile produced, including what it wrote through the identifier actions,
+	// so shaders with the same mode and code (duplicated resources, code set again) skip parsing
+	// and code generation.
+	struct CachedShader {
+		GeneratedCode gen_code;
+		Vector<StringName> render_modes;
+		Vector<StringName> usage_flags;
+		Vector<StringName> write_flags;
+		Map<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+	};
+
+	enum {
+		MAX_CACHED_SHADERS = 256, // The cache is cleared when it grows past this.
+	};
+
+	HashMap<String, CachedShader> compile_cache;
+
+	static void _apply_cached_shader(const CachedShader &p_cached, IdentifierActions *p_actions, GeneratedCode &r_gen_code);
+
 	String _get_sampler_name(ShaderLanguage::TextureFilter p_filter, ShaderLanguage::TextureRepeat p_repeat);
 
 	void _dump_function_deps(const ShaderLanguage::ShaderNode *p_node, const StringName &p_for_func, const Map<StringName, String> &p_func_code, String &r_to_add, Set<StringName> &added);
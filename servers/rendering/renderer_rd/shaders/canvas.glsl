@@ -26,6 +26,12 @@ layout(location = 3) out vec2 pixel_size_interp;
 
 #endif
 
+#ifdef USE_RECT_BATCH
+
+layout(location = 4) flat out uint rect_batch_index;
+
+#endif
+
 #ifdef USE_MATERIAL_UNIFORMS
 layout(set = 1, binding = 0, std140) uniform MaterialUniforms{
 	/* clang-format off */
@@ -39,6 +45,18 @@ VERTEX_SHADER_GLOBALS
 /* clang-format on */
 
 void main() {
+#ifdef USE_RECT_BATCH
+	if (bool(draw_data_push.data.flags & FLAGS_RECT_BATCH)) {
+		rect_batch_index = draw_data_push.data.rect_batch_offset + uint(gl_InstanceIndex);
+		draw_data = rect_batch.data[rect_batch_index];
+	} else {
+		rect_batch_index = 0xFFFFFFFF;
+		draw_data = draw_data_push.data;
+	}
+#else
+	draw_data = draw_data_push.data;
+#endif
+
 	vec4 instance_custom = vec4(0.0);
 #ifdef USE_PRIMITIVE
 
@@ -226,6 +244,12 @@ layout(location = 3) in vec2 pixel_size_interp;
 
 #endif
 
+#ifdef USE_RECT_BATCH
+
+layout(location = 4) flat in uint rect_batch_index;
+
+#endif
+
 layout(location = 0) out vec4 frag_color;
 
 #ifdef USE_MATERIAL_UNIFORMS
@@ -423,6 +447,16 @@ void light_blend_compute(uint light_base, vec4 light_color, inout vec3 color) {
 #endif
 
 void main() {
+#ifdef USE_RECT_BATCH
+	if (rect_batch_index != 0xFFFFFFFF) {
+		draw_data = rect_batch.data[rect_batch_index];
+	} else {
+		draw_data = draw_data_push.data;
+	}
+#else
+	draw_data = draw_data_push.data;
+#endif
+
 	vec4 color = color_interp;
 	vec2 uv = uv_interp;
 	vec2 vertex = vertex_interp;
@@ -17,6 +17,7 @@
 #define FLAGS_USING_LIGHT_MASK (1 << 11)
 #define FLAGS_NINEPACH_DRAW_CENTER (1 << 12)
 #define FLAGS_USING_PARTICLES (1 << 13)
+#define FLAGS_RECT_BATCH (1 << 14)
 
 #define FLAGS_NINEPATCH_H_MODE_SHIFT 16
 #define FLAGS_NINEPATCH_V_MODE_SHIFT 18
@@ -41,7 +42,7 @@
 
 // Push Constant
 
-layout(push_constant, binding = 0, std430) uniform DrawData {
+struct DrawData {
 	vec2 world_x;
 	vec2 world_y;
 	vec2 world_ofs;
@@ -56,13 +57,25 @@ layout(push_constant, binding = 0, std430) uniform DrawData {
 	vec4 ninepatch_margins;
 	vec4 dst_rect; //for built-in rect and UV
 	vec4 src_rect;
-	vec2 pad;
+	uint rect_batch_offset;
+	uint pad;
 
 #endif
 	vec2 color_texture_pixel_size;
 	uint lights[4];
+};
+
+layout(push_constant, binding = 0, std430) uniform DrawDataPush {
+	DrawData data;
 }
-draw_data;
+draw_data_push;
+
+#if !defined(USE_PRIMITIVE) && !defined(USE_ATTRIBUTES) && !defined(USE_NINEPATCH)
+#define USE_RECT_BATCH
+#endif
+
+// Loaded at the beginning of each stage, either from the push constant or from the rect batch.
+DrawData draw_data;
 
 // In vulkan, sets should always be ordered using the following logic:
 // Lower Sets: Sets that change format and layout less often
@@ -143,6 +156,12 @@ layout(set = 0, binding = 9, std430) restrict readonly buffer GlobalVariableData
 }
 global_variables;
 
+// Consecutive rects sharing pipeline and texture are drawn as instances, one entry each.
+layout(set = 0, binding = 10, std430) restrict readonly buffer RectBatchData {
+	DrawData data[];
+}
+rect_batch;
+
 /* SET1: Is reserved for the material */
 
 //
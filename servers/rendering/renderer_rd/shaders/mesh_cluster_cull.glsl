@@ -0,0 +1,96 @@
+#[compute]
+
+#version 450
+
+VERSION_DEFINES
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct Cluster {
+	vec4 sphere; // center, radius
+	vec4 cone; // axis, cutoff
+	uint index_offset;
+	uint index_count;
+	uint pad0;
+	uint pad1;
+};
+
+layout(set = 0, binding = 0, std430) buffer restrict readonly Clusters {
+	Cluster data[];
+}
+clusters;
+
+struct DrawCommand {
+	uint index_count;
+	uint instance_count;
+	uint first_index;
+	int vertex_offset;
+	uint first_instance;
+};
+
+layout(set = 1, binding = 0, std430) buffer restrict writeonly DrawCommands {
+	DrawCommand data[];
+}
+draw_commands;
+
+layout(set = 1, binding = 1, std140) uniform CullParams {
+	vec4 planes[6];
+	vec3 camera_position;
+	bool orthogonal;
+	vec3 camera_direction;
+	uint pad;
+}
+cull_params;
+
+#define FLAG_CONE_CULL 1
+
+layout(push_constant, binding = 0, std430) uniform Params {
+	vec4 transform[3]; // rows
+	uint cluster_count;
+	uint draw_offset;
+	uint flags;
+	float max_scale;
+}
+params;
+
+void main() {
+	uint cluster_index = gl_GlobalInvocationID.x;
+	if (cluster_index >= params.cluster_count) {
+		return;
+	}
+
+	Cluster cluster = clusters.data[cluster_index];
+
+	vec4 local_center = vec4(cluster.sphere.xyz, 1.0);
+	vec3 center = vec3(dot(params.transform[0], local_center), dot(params.transform[1], local_center), dot(params.transform[2], local_center));
+	float radius = cluster.sphere.w * params.max_scale;
+
+	bool visible = true;
+
+	for (int i = 0; i < 6; i++) {
+		if (dot(cull_params.planes[i].xyz, center) - cull_params.planes[i].w > radius) {
+			visible = false;
+			break;
+		}
+	}
+
+	if (visible && bool(params.flags & FLAG_CONE_CULL)) {
+		// All triangles face away when the view direction is inside the normal cone.
+		vec3 axis = normalize(vec3(dot(params.transform[0].xyz, cluster.cone.xyz), dot(params.transform[1].xyz, cluster.cone.xyz), dot(params.transform[2].xyz, cluster.cone.xyz)));
+		if (cull_params.orthogonal) {
+			visible = dot(cull_params.camera_direction, axis) < cluster.cone.w;
+		} else {
+			vec3 view = center - cull_params.camera_position;
+			visible = dot(view, axis) < cluster.cone.w * length(view) + radius;
+		}
+	}
+
+	DrawCommand command;
+	command.index_count = cluster.index_count;
+	command.instance_count = visible ? 1 : 0;
+	command.first_index = cluster.index_offset;
+	command.vertex_offset = 0;
+	command.first_instance = 0;
+
+	draw_commands.data[params.draw_offset + cluster_index] = command;
+}
@@ -82,11 +82,18 @@ layout(location = 6) out vec3 binormal_interp;
 #endif
 
 #ifdef USE_MATERIAL_UNIFORMS
-layout(set = MATERIAL_UNIFORM_SET, binding = 0, std140) uniform MaterialUniforms{
+struct MaterialUniforms {
 	/* clang-format off */
 MATERIAL_UNIFORMS
 	/* clang-format on */
-} material;
+};
+
+layout(set = MATERIAL_UNIFORM_SET, binding = 0, std140) restrict readonly buffer MaterialPage {
+	MaterialUniforms data[];
+}
+material_page;
+
+#define material material_page.data[draw_call.material_index]
 #endif
 
 invariant gl_Position;
@@ -362,6 +369,11 @@ layout(location = 8) in float dp_clip;
 
 layout(location = 9) in flat uint instance_index;
 
+/* Specialization Constants */
+
+// Set per pipeline, see RendererSceneRenderForward::ShaderSpecialization.
+layout(constant_id = 0) const bool sc_use_forward_gi = false;
+
 //defines to keep compatibility with vertex
 
 #define world_matrix instances.data[instance_index].transform
@@ -373,11 +385,18 @@ layout(location = 9) in flat uint instance_index;
 #endif
 
 #ifdef USE_MATERIAL_UNIFORMS
-layout(set = MATERIAL_UNIFORM_SET, binding = 0, std140) uniform MaterialUniforms{
+struct MaterialUniforms {
 	/* clang-format off */
 MATERIAL_UNIFORMS
 	/* clang-format on */
-} material;
+};
+
+layout(set = MATERIAL_UNIFORM_SET, binding = 0, std140) restrict readonly buffer MaterialPage {
+	MaterialUniforms data[];
+}
+material_page;
+
+#define material material_page.data[draw_call.material_index]
 #endif
 
 /* clang-format off */
@@ -1488,7 +1507,7 @@ void reflection_process(uint ref_index, vec3 vertex, vec3 normal, float roughnes
 	}
 }
 
-#ifdef USE_FORWARD_GI
+#ifndef LOW_END_MODE
 
 //standard voxel cone trace
 vec4 voxel_cone_trace(texture3D probe, vec3 cell_size, vec3 pos, vec3 direction, float tan_half_angle, float max_distance, float p_bias) {
@@ -1731,7 +1750,7 @@ void sdfgi_process(uint cascade, vec3 cascade_pos, vec3 cam_pos, vec3 cam_normal
 	}
 }
 
-#endif //USE_FORWARD_GI
+#endif //LOW_END_MODE
 
 #endif //!defined(MODE_RENDER_DEPTH) && !defined(MODE_UNSHADED)
 
@@ -2274,114 +2293,113 @@ FRAGMENT_SHADER_CODE
 			ambient_light += textureLod(sampler2DArray(lightmap_textures[ofs], material_samplers[SAMPLER_LINEAR_CLAMP]), uvw, 0.0).rgb;
 		}
 	}
-#elif defined(USE_FORWARD_GI)
+#elif !defined(LOW_END_MODE)
 
-	if (bool(instances.data[instance_index].flags & INSTANCE_FLAGS_USE_SDFGI)) { //has lightmap capture
+	if (sc_use_forward_gi) {
+		if (bool(instances.data[instance_index].flags & INSTANCE_FLAGS_USE_SDFGI)) { //has lightmap capture
 
-		//make vertex orientation the world one, but still align to camera
-		vec3 cam_pos = mat3(scene_data.camera_matrix) * vertex;
-		vec3 cam_normal = mat3(scene_data.camera_matrix) * normal;
-		vec3 cam_reflection = mat3(scene_data.camera_matrix) * reflect(-view, normal);
+			//make vertex orientation the world one, but still align to camera
+			vec3 cam_pos = mat3(scene_data.camera_matrix) * vertex;
+			vec3 cam_normal = mat3(scene_data.camera_matrix) * normal;
+			vec3 cam_reflection = mat3(scene_data.camera_matrix) * reflect(-view, normal);
 
-		//apply y-mult
-		cam_pos.y *= sdfgi.y_mult;
-		cam_normal.y *= sdfgi.y_mult;
-		cam_normal = normalize(cam_normal);
-		cam_reflection.y *= sdfgi.y_mult;
-		cam_normal = normalize(cam_normal);
-		cam_reflection = normalize(cam_reflection);
+			//apply y-mult
+			cam_pos.y *= sdfgi.y_mult;
+			cam_normal.y *= sdfgi.y_mult;
+			cam_normal = normalize(cam_normal);
+			cam_reflection.y *= sdfgi.y_mult;
+			cam_normal = normalize(cam_normal);
+			cam_reflection = normalize(cam_reflection);
 
-		vec4 light_accum = vec4(0.0);
-		float weight_accum = 0.0;
+			vec4 light_accum = vec4(0.0);
+			float weight_accum = 0.0;
 
-		vec4 light_blend_accum = vec4(0.0);
-		float weight_blend_accum = 0.0;
+			vec4 light_blend_accum = vec4(0.0);
+			float weight_blend_accum = 0.0;
 
-		float blend = -1.0;
+			float blend = -1.0;
 
-		// helper constants, compute once
+			// helper constants, compute once
 
-		uint cascade = 0xFFFFFFFF;
-		vec3 cascade_pos;
-		vec3 cascade_normal;
+			uint cascade = 0xFFFFFFFF;
+			vec3 cascade_pos;
+			vec3 cascade_normal;
 
-		for (uint i = 0; i < sdfgi.max_cascades; i++) {
-			cascade_pos = (cam_pos - sdfgi.cascades[i].position) * sdfgi.cascades[i].to_probe;
+			for (uint i = 0; i < sdfgi.max_cascades; i++) {
+				cascade_pos = (cam_pos - sdfgi.cascades[i].position) * sdfgi.cascades[i].to_probe;
 
-			if (any(lessThan(cascade_pos, vec3(0.0))) || any(greaterThanEqual(cascade_pos, sdfgi.cascade_probe_size))) {
-				continue; //skip cascade
-			}
+				if (any(lessThan(cascade_pos, vec3(0.0))) || any(greaterThanEqual(cascade_pos, sdfgi.cascade_probe_size))) {
+					continue; //skip cascade
+				}
 
-			cascade = i;
-			break;
-		}
+				cascade = i;
+				break;
+			}
 
-		if (cascade < SDFGI_MAX_CASCADES) {
-			bool use_specular = true;
-			float blend;
-			vec3 diffuse, specular;
-			sdfgi_process(cascade, cascade_pos, cam_pos, cam_normal, cam_reflection, use_specular, roughness, diffuse, specular, blend);
-
-			if (blend > 0.0) {
-				//blend
-				if (cascade == sdfgi.max_cascades - 1) {
-					diffuse = mix(diffuse, ambient_light, blend);
-					if (use_specular) {
-						specular = mix(specular, specular_light, blend);
-					}
-				} else {
-					vec3 diffuse2, specular2;
-					float blend2;
-					cascade_pos = (cam_pos - sdfgi.cascades[cascade + 1].position) * sdfgi.cascades[cascade + 1].to_probe;
-					sdfgi_process(cascade + 1, cascade_pos, cam_pos, cam_normal, cam_reflection, use_specular, roughness, diffuse2, specular2, blend2);
-					diffuse = mix(diffuse, diffuse2, blend);
-					if (use_specular) {
-						specular = mix(specular, specular2, blend);
+			if (cascade < SDFGI_MAX_CASCADES) {
+				bool use_specular = true;
+				float blend;
+				vec3 diffuse, specular;
+				sdfgi_process(cascade, cascade_pos, cam_pos, cam_normal, cam_reflection, use_specular, roughness, diffuse, specular, blend);
+
+				if (blend > 0.0) {
+					//blend
+					if (cascade == sdfgi.max_cascades - 1) {
+						diffuse = mix(diffuse, ambient_light, blend);
+						if (use_specular) {
+							specular = mix(specular, specular_light, blend);
+						}
+					} else {
+						vec3 diffuse2, specular2;
+						float blend2;
+						cascade_pos = (cam_pos - sdfgi.cascades[cascade + 1].position) * sdfgi.cascades[cascade + 1].to_probe;
+						sdfgi_process(cascade + 1, cascade_pos, cam_pos, cam_normal, cam_reflection, use_specular, roughness, diffuse2, specular2, blend2);
+						diffuse = mix(diffuse, diffuse2, blend);
+						if (use_specular) {
+							specular = mix(specular, specular2, blend);
+						}
 					}
 				}
-			}
 
-			ambient_light = diffuse;
-			if (use_specular) {
-				specular_light = specular;
+				ambient_light = diffuse;
+				if (use_specular) {
+					specular_light = specular;
+				}
 			}
 		}
-	}
-
-	if (bool(instances.data[instance_index].flags & INSTANCE_FLAGS_USE_GIPROBE)) { // process giprobes
 
-		uint index1 = instances.data[instance_index].gi_offset & 0xFFFF;
-		vec3 ref_vec = normalize(reflect(normalize(vertex), normal));
-		//find arbitrary tangent and bitangent, then build a matrix
-		vec3 v0 = abs(normal.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(0.0, 1.0, 0.0);
-		vec3 tangent = normalize(cross(v0, normal));
-		vec3 bitangent = normalize(cross(tangent, normal));
-		mat3 normal_mat = mat3(tangent, bitangent, normal);
+		if (bool(instances.data[instance_index].flags & INSTANCE_FLAGS_USE_GIPROBE)) { // process giprobes
 
-		vec4 amb_accum = vec4(0.0);
-		vec4 spec_accum = vec4(0.0);
-		gi_probe_compute(index1, vertex, normal, ref_vec, normal_mat, roughness * roughness, ambient_light, specular_light, spec_accum, amb_accum);
+			uint index1 = instances.data[instance_index].gi_offset & 0xFFFF;
+			vec3 ref_vec = normalize(reflect(normalize(vertex), normal));
+			//find arbitrary tangent and bitangent, then build a matrix
+			vec3 v0 = abs(normal.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(0.0, 1.0, 0.0);
+			vec3 tangent = normalize(cross(v0, normal));
+			vec3 bitangent = normalize(cross(tangent, normal));
+			mat3 normal_mat = mat3(tangent, bitangent, normal);
 
-		uint index2 = instances.data[instance_index].gi_offset >> 16;
+			vec4 amb_accum = vec4(0.0);
+			vec4 spec_accum = vec4(0.0);
+			gi_probe_compute(index1, vertex, normal, ref_vec, normal_mat, roughness * roughness, ambient_light, specular_light, spec_accum, amb_accum);
 
-		if (index2 != 0xFFFF) {
-			gi_probe_compute(index2, vertex, normal, ref_vec, normal_mat, roughness * roughness, ambient_light, specular_light, spec_accum, amb_accum);
-		}
+			uint index2 = instances.data[instance_index].gi_offset >> 16;
 
-		if (amb_accum.a > 0.0) {
-			amb_accum.rgb /= amb_accum.a;
-		}
+			if (index2 != 0xFFFF) {
+				gi_probe_compute(index2, vertex, normal, ref_vec, normal_mat, roughness * roughness, ambient_light, specular_light, spec_accum, amb_accum);
+			}
 
-		if (spec_accum.a > 0.0) {
-			spec_accum.rgb /= spec_accum.a;
-		}
+			if (amb_accum.a > 0.0) {
+				amb_accum.rgb /= amb_accum.a;
+			}
 
-		specular_light = spec_accum.rgb;
-		ambient_light = amb_accum.rgb;
-	}
-#elif !defined(LOW_END_MODE)
+			if (spec_accum.a > 0.0) {
+				spec_accum.rgb /= spec_accum.a;
+			}
 
-	if (bool(instances.data[instance_index].flags & INSTANCE_FLAGS_USE_GI_BUFFERS)) { //use GI buffers
+			specular_light = spec_accum.rgb;
+			ambient_light = amb_accum.rgb;
+		}
+	} else if (bool(instances.data[instance_index].flags & INSTANCE_FLAGS_USE_GI_BUFFERS)) { //use GI buffers
 
 		vec2 coord;
 
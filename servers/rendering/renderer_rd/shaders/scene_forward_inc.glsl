@@ -23,8 +23,8 @@
 layout(push_constant, binding = 0, std430) uniform DrawCall {
 	uint instance_index;
 	uint uv_offset;
-	uint pad0;
-	uint pad1;
+	uint material_index;
+	uint pad;
 }
 draw_call;
 
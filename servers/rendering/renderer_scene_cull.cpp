@@ -31,7 +31,9 @@
 #include "renderer_scene_cull.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/os/os.h"
+#include "core/templates/frame_arena.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
 
@@ -77,7 +79,26 @@ void RendererSceneCull::camera_set_frustum(RID p_camera, float p_size, Vector2 p
 void RendererSceneCull::camera_set_transform(RID p_camera, const Transform &p_transform) {
 	Camera *camera = camera_owner.getornull(p_camera);
 	ERR_FAIL_COND(!camera);
-	camera->transform = p_transform.orthonormalized();
+
+	Transform xform = p_transform.orthonormalized();
+
+	if (physics_interpolation_enabled && camera->interpolated) {
+		camera->transform_curr = xform;
+		if (camera->interpolation_teleport) {
+			camera->transform_prev = xform;
+			camera->transform = xform;
+			camera->interpolation_teleport = false;
+		}
+		if (!camera->on_interpolation_list) {
+			camera->on_interpolation_list = true;
+			interpolation_cameras.push_back(p_camera);
+		}
+		return;
+	}
+
+	camera->transform = xform;
+	camera->transform_prev = xform;
+	camera->transform_curr = xform;
 }
 
 void RendererSceneCull::camera_set_cull_mask(RID p_camera, uint32_t p_layers) {
@@ -105,10 +126,79 @@ void RendererSceneCull::camera_set_use_vertical_aspect(RID p_camera, bool p_enab
 	camera->vaspect = p_enable;
 }
 
+void RendererSceneCull::camera_set_interpolated(RID p_camera, bool p_interpolated) {
+	Camera *camera = camera_owner.getornull(p_camera);
+	ERR_FAIL_COND(!camera);
+
+	if (camera->interpolated == p_interpolated) {
+		return;
+	}
+	camera->interpolated = p_interpolated;
+	camera->interpolation_teleport = true;
+	camera->transform = camera->transform_curr;
+	camera->transform_prev = camera->transform_curr;
+}
+
+void RendererSceneCull::camera_reset_physics_interpolation(RID p_camera) {
+	Camera *camera = camera_owner.getornull(p_camera);
+	ERR_FAIL_COND(!camera);
+
+	camera->transform_prev = camera->transform_curr;
+	camera->transform = camera->transform_curr;
+}
+
 bool RendererSceneCull::is_camera(RID p_camera) const {
 	return camera_owner.owns(p_camera);
 }
 
+/* OCCLUDER API */
+
+RID RendererSceneCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RendererSceneCull::occluder_initialize(RID p_rid) {
+	occluder_owner.initialize_rid(p_rid, memnew(Occluder));
+}
+
+void RendererSceneCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.getornull(p_occluder);
+	ERR_FAIL_COND(!occluder);
+	ERR_FAIL_COND(p_indices.size() % 3 != 0);
+
+	const Vector3 *vertices = p_vertices.ptr();
+	const int *indices = p_indices.ptr();
+
+	for (int i = 0; i < p_indices.size(); i++) {
+		ERR_FAIL_INDEX(indices[i], p_vertices.size());
+	}
+
+	occluder->vertices.resize(p_vertices.size());
+	occluder->indices.resize(p_indices.size());
+	occluder->aabb = AABB();
+
+	for (int i = 0; i < p_vertices.size(); i++) {
+		occluder->vertices[i] = vertices[i];
+		if (i == 0) {
+			occluder->aabb.position = vertices[i];
+		} else {
+			occluder->aabb.expand_to(vertices[i]);
+		}
+	}
+
+	for (int i = 0; i < p_indices.size(); i++) {
+		occluder->indices[i] = indices[i];
+	}
+
+	for (Set<Instance *>::Element *E = occluder->users.front(); E; E = E->next()) {
+		_instance_queue_update(E->get(), true, false);
+	}
+}
+
+bool RendererSceneCull::is_occluder(RID p_occluder) const {
+	return occluder_owner.owns(p_occluder);
+}
+
 /* SCENARIO API */
 
 void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
@@ -129,7 +219,11 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 		light->geometries.insert(A);
 
 		if (geom->can_cast_shadows) {
-			light->shadow_dirty = true;
+			if (A->shadow_caster_dynamic && self->_instance_is_dynamic_shadow_caster(A)) {
+				light->dynamic_shadow_dirty = true;
+			} else {
+				light->shadow_dirty = true;
+			}
 		}
 
 		if (A->scenario && A->array_index >= 0) {
@@ -220,7 +314,11 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 		light->geometries.erase(A);
 
 		if (geom->can_cast_shadows) {
-			light->shadow_dirty = true;
+			if (A->shadow_caster_dynamic && self->_instance_is_dynamic_shadow_caster(A)) {
+				light->dynamic_shadow_dirty = true;
+			} else {
+				light->shadow_dirty = true;
+			}
 		}
 
 		if (A->scenario && A->array_index >= 0) {
@@ -458,6 +556,14 @@ void RendererSceneCull::instance_set_base(RID p_instance, RID p_base) {
 				InstanceParticlesCollisionData *collision = static_cast<InstanceParticlesCollisionData *>(instance->base_data);
 				RSG::storage->free(collision->instance);
 			} break;
+			case RS::INSTANCE_OCCLUDER: {
+				InstanceOccluderData *occluder = static_cast<InstanceOccluderData *>(instance->base_data);
+				if (scenario && occluder->O) {
+					scenario->occluders.erase(occluder->O);
+					occluder->O = nullptr;
+				}
+				occluder->occluder->users.erase(instance);
+			} break;
 			case RS::INSTANCE_REFLECTION_PROBE: {
 				InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(instance->base_data);
 				scene_render->free(reflection_probe->instance);
@@ -513,7 +619,11 @@ void RendererSceneCull::instance_set_base(RID p_instance, RID p_base) {
 	instance->base = RID();
 
 	if (p_base.is_valid()) {
-		instance->base_type = RSG::storage->get_base_type(p_base);
+		if (occluder_owner.owns(p_base)) {
+			instance->base_type = RS::INSTANCE_OCCLUDER;
+		} else {
+			instance->base_type = RSG::storage->get_base_type(p_base);
+		}
 		ERR_FAIL_COND(instance->base_type == RS::INSTANCE_NONE);
 
 		switch (instance->base_type) {
@@ -557,6 +667,15 @@ void RendererSceneCull::instance_set_base(RID p_instance, RID p_base) {
 				RSG::storage->particles_collision_instance_set_active(collision->instance, instance->visible);
 				instance->base_data = collision;
 			} break;
+			case RS::INSTANCE_OCCLUDER: {
+				InstanceOccluderData *occluder = memnew(InstanceOccluderData);
+				occluder->occluder = occluder_owner.getornull(p_base);
+				occluder->occluder->users.insert(instance);
+				if (scenario) {
+					occluder->O = scenario->occluders.push_back(instance);
+				}
+				instance->base_data = occluder;
+			} break;
 			case RS::INSTANCE_REFLECTION_PROBE: {
 				InstanceReflectionProbeData *reflection_probe = memnew(InstanceReflectionProbeData);
 				reflection_probe->owner = instance;
@@ -637,6 +756,13 @@ void RendererSceneCull::instance_set_scenario(RID p_instance, RID p_scenario) {
 			case RS::INSTANCE_PARTICLES_COLLISION: {
 				heightfield_particle_colliders_update_list.erase(instance);
 			} break;
+			case RS::INSTANCE_OCCLUDER: {
+				InstanceOccluderData *occluder = static_cast<InstanceOccluderData *>(instance->base_data);
+				if (occluder->O) {
+					instance->scenario->occluders.erase(occluder->O);
+					occluder->O = nullptr;
+				}
+			} break;
 			case RS::INSTANCE_GI_PROBE: {
 				InstanceGIProbeData *gi_probe = static_cast<InstanceGIProbeData *>(instance->base_data);
 
@@ -667,6 +793,7 @@ void RendererSceneCull::instance_set_scenario(RID p_instance, RID p_scenario) {
 		ERR_FAIL_COND(!scenario);
 
 		instance->scenario = scenario;
+		instance->placed_frame = RSG::rasterizer->get_frame_number();
 
 		scenario->instances.add(&instance->scenario_item);
 
@@ -684,6 +811,10 @@ void RendererSceneCull::instance_set_scenario(RID p_instance, RID p_scenario) {
 					gi_probe_update_list.add(&gi_probe->update_element);
 				}
 			} break;
+			case RS::INSTANCE_OCCLUDER: {
+				InstanceOccluderData *occluder = static_cast<InstanceOccluderData *>(instance->base_data);
+				occluder->O = scenario->occluders.push_back(instance);
+			} break;
 			default: {
 			}
 		}
@@ -711,10 +842,6 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform &
 	Instance *instance = instance_owner.getornull(p_instance);
 	ERR_FAIL_COND(!instance);
 
-	if (instance->transform == p_transform) {
-		return; //must be checked to avoid worst evil
-	}
-
 #ifdef DEBUG_ENABLED
 
 	for (int i = 0; i < 4; i++) {
@@ -728,8 +855,58 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform &
 	}
 
 #endif
-	instance->transform = p_transform;
-	_instance_queue_update(instance, true);
+
+	if (physics_interpolation_enabled && instance->interpolated) {
+		instance->transform_curr = p_transform;
+		if (instance->interpolation_teleport) {
+			instance->transform_prev = p_transform;
+			_instance_set_rendered_transform(instance, p_transform);
+			instance->interpolation_teleport = false;
+		}
+		if (!instance->on_interpolation_list) {
+			instance->on_interpolation_list = true;
+			interpolation_instances.push_back(p_instance);
+		}
+		return;
+	}
+
+	instance->transform_prev = p_transform;
+	instance->transform_curr = p_transform;
+	_instance_set_rendered_transform(instance, p_transform);
+}
+
+void RendererSceneCull::_instance_set_rendered_transform(Instance *p_instance, const Transform &p_transform) {
+	if (p_instance->transform == p_transform) {
+		return; //must be checked to avoid worst evil
+	}
+
+	p_instance->transform = p_transform;
+	if (p_instance->scenario && !p_instance->moved && RSG::rasterizer->get_frame_number() > p_instance->placed_frame + 1) {
+		// Transforms set while the instance is being placed don't count as movement.
+		p_instance->moved = true;
+	}
+	_instance_queue_update(p_instance, true);
+}
+
+void RendererSceneCull::instance_set_interpolated(RID p_instance, bool p_interpolated) {
+	Instance *instance = instance_owner.getornull(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	if (instance->interpolated == p_interpolated) {
+		return;
+	}
+	instance->interpolated = p_interpolated;
+	instance->interpolation_teleport = true;
+	instance->transform_prev = instance->transform_curr;
+	_instance_set_rendered_transform(instance, instance->transform_curr);
+}
+
+void RendererSceneCull::instance_reset_physics_interpolation(RID p_instance) {
+	Instance *instance = instance_owner.getornull(p_instance);
+	ERR_FAIL_COND(!instance);
+
+	instance->transform_prev = instance->transform_curr;
+	_instance_set_rendered_transform(instance, instance->transform_curr);
 }
 
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
@@ -1236,9 +1413,22 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		//make sure lights are updated if it casts shadow
 
 		if (geom->can_cast_shadows) {
+			// A caster switching layers must be added to or removed from the cached static shadows.
+			bool dynamic = _instance_is_dynamic_shadow_caster(p_instance);
+			bool static_changed = !dynamic || !p_instance->shadow_caster_dynamic;
+			p_instance->shadow_caster_dynamic = dynamic;
+
+			if (static_changed && p_instance->scenario) {
+				p_instance->scenario->static_shadow_version++;
+			}
+
 			for (Set<Instance *>::Element *E = geom->lights.front(); E; E = E->next()) {
 				InstanceLightData *light = static_cast<InstanceLightData *>(E->get()->base_data);
-				light->shadow_dirty = true;
+				if (static_changed) {
+					light->shadow_dirty = true;
+				} else {
+					light->dynamic_shadow_dirty = true;
+				}
 			}
 		}
 
@@ -1401,6 +1591,10 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 		return; //nothing to do
 	}
 
+	if (((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) && !p_instance->shadow_caster_dynamic && static_cast<InstanceGeometryData *>(p_instance->base_data)->can_cast_shadows) {
+		p_instance->scenario->static_shadow_version++;
+	}
+
 	while (p_instance->pairs.first()) {
 		InstancePair *pair = p_instance->pairs.first()->self();
 		Instance *other_instance = p_instance == pair->a ? pair->b : pair->a;
@@ -1506,6 +1700,10 @@ void RendererSceneCull::_update_instance_aabb(Instance *p_instance) {
 		case RenderingServer::INSTANCE_LIGHTMAP: {
 			new_aabb = RSG::storage->lightmap_get_aabb(p_instance->base);
 
+		} break;
+		case RenderingServer::INSTANCE_OCCLUDER: {
+			new_aabb = static_cast<InstanceOccluderData *>(p_instance->base_data)->occluder->aabb;
+
 		} break;
 		default: {
 		}
@@ -1600,6 +1798,11 @@ void RendererSceneCull::_update_instance_lightmap_captures(Instance *p_instance)
 }
 
 void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect) {
+	if (RSG::storage->light_directional_get_shadow_mode(p_instance->base) == RS::LIGHT_DIRECTIONAL_SHADOW_CLIPMAP) {
+		_light_instance_setup_directional_clipmap(p_shadow_index, p_instance, p_cam_transform, p_cam_projection, p_cam_orthogonal);
+		return;
+	}
+
 	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
 	Transform light_transform = p_instance->transform;
@@ -1628,6 +1831,7 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 			splits = 2;
 			break;
 		case RS::LIGHT_DIRECTIONAL_SHADOW_PARALLEL_4_SPLITS:
+		case RS::LIGHT_DIRECTIONAL_SHADOW_CLIPMAP:
 			splits = 4;
 			break;
 	}
@@ -1652,6 +1856,7 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	cull.shadow_count = p_shadow_index + 1;
 	cull.shadows[p_shadow_index].cascade_count = splits;
 	cull.shadows[p_shadow_index].light_instance = light->instance;
+	cull.shadows[p_shadow_index].clipmap_light = nullptr;
 
 	for (int i = 0; i < splits; i++) {
 		RENDER_TIMESTAMP("Culling Directional Light split" + itos(i));
@@ -1894,7 +2099,327 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	}
 }
 
-bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_lod_threshold) {
+void RendererSceneCull::_light_instance_setup_directional_clipmap(int p_shadow_index, Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal) {
+	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
+
+	Transform light_transform = p_instance->transform;
+	light_transform.orthonormalize(); //scale does not count on lights
+
+	real_t max_distance = p_cam_projection.get_z_far();
+	real_t shadow_max = RSG::storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_SHADOW_MAX_DISTANCE);
+	if (shadow_max > 0 && !p_cam_orthogonal) { //its impractical (and leads to unwanted behaviors) to set max distance in orthogonal camera
+		max_distance = MIN(shadow_max, max_distance);
+	}
+	max_distance = MAX(max_distance, p_cam_projection.get_z_near() + 0.001);
+	real_t min_distance = MIN(p_cam_projection.get_z_near(), max_distance);
+
+	real_t range = max_distance - min_distance;
+	real_t pancake_size = RSG::storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_SHADOW_PANCAKE_SIZE);
+	real_t texture_size = scene_render->get_directional_light_shadow_size(light->instance);
+
+	real_t soft_shadow_tan = 0.0;
+	float soft_shadow_angle = RSG::storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_SIZE);
+	if (soft_shadow_angle > 0.0) {
+		soft_shadow_tan = Math::tan(Math::deg2rad(soft_shadow_angle));
+	}
+
+	// Levels are centered on the camera rather than fitted to the frustum, so each one must
+	// reach the corners of the frustum slice its split ends at.
+	Vector2 vp_he = p_cam_projection.get_viewport_half_extents();
+	real_t near_corner_scale = Math::sqrt(1.0 + vp_he.length_squared() / (p_cam_projection.get_z_near() * p_cam_projection.get_z_near()));
+
+	Vector3 x_vec = light_transform.basis.get_axis(Vector3::AXIS_X).normalized();
+	Vector3 y_vec = light_transform.basis.get_axis(Vector3::AXIS_Y).normalized();
+	Vector3 z_vec = light_transform.basis.get_axis(Vector3::AXIS_Z).normalized();
+	Vector3 cam_pos = p_cam_transform.origin;
+
+	const int pages = RendererSceneRender::DIRECTIONAL_SHADOW_CLIPMAP_PAGES;
+
+	cull.shadow_count = p_shadow_index + 1;
+	cull.shadows[p_shadow_index].cascade_count = RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES;
+	cull.shadows[p_shadow_index].light_instance = light->instance;
+	cull.shadows[p_shadow_index].clipmap_light = light;
+
+	real_t first_extent = 0.0;
+	real_t first_split = 0.0;
+
+	for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; i++) {
+		real_t split = max_distance;
+		if (i < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES - 1) {
+			split = min_distance + RSG::storage->light_get_param(p_instance->base, RS::LightParam(RS::LIGHT_PARAM_SHADOW_SPLIT_1_OFFSET + i)) * range;
+		}
+
+		real_t radius = p_cam_orthogonal ? Math::sqrt(split * split + vp_he.length_squared()) : split * near_corner_scale;
+		radius += soft_shadow_tan * (radius * 2.0 + pancake_size);
+
+		// Keep a page of margin, as the camera moves freely within its page, and round up to a power
+		// of two so small changes to the camera projection don't throw the cached pages away.
+		real_t extent = radius * pages / (pages - 2);
+		extent = Math::pow(2.0, Math::ceil(Math::log(extent) / Math::log(2.0)));
+		real_t page_size = extent * 2.0 / pages;
+
+		Vector2i origin((int)Math::floor(x_vec.dot(cam_pos) / page_size), (int)Math::floor(y_vec.dot(cam_pos) / page_size));
+		real_t x_min = (origin.x - pages / 2) * page_size;
+		real_t y_min = (origin.y - pages / 2) * page_size;
+
+		// The depth range only moves in steps of a whole extent, so cached pages keep valid depths.
+		real_t z_max = Math::ceil((z_vec.dot(cam_pos) + extent + pancake_size) / extent) * extent;
+		real_t z_range = extent * 3.0 + pancake_size;
+
+		Vector<Plane> light_frustum_planes;
+		light_frustum_planes.resize(6);
+
+		//right/left
+		light_frustum_planes.write[0] = Plane(x_vec, x_min + extent * 2.0);
+		light_frustum_planes.write[1] = Plane(-x_vec, -x_min);
+		//top/bottom
+		light_frustum_planes.write[2] = Plane(y_vec, y_min + extent * 2.0);
+		light_frustum_planes.write[3] = Plane(-y_vec, -y_min);
+		//near/far
+		light_frustum_planes.write[4] = Plane(z_vec, z_max + 1e6);
+		light_frustum_planes.write[5] = Plane(-z_vec, -(z_max - z_range));
+
+		CameraMatrix ortho_camera;
+		ortho_camera.set_orthogonal(-extent, extent, -extent, extent, 0, z_range);
+
+		Transform ortho_transform;
+		ortho_transform.basis = light_transform.basis;
+		ortho_transform.origin = x_vec * (x_min + extent) + y_vec * (y_min + extent) + z_vec * z_max;
+
+		if (i == 0) {
+			first_extent = extent;
+			first_split = split;
+		}
+
+		Cull::Shadow::Cascade &cascade = cull.shadows[p_shadow_index].cascades[i];
+		cascade.frustum = Frustum(light_frustum_planes);
+		cascade.projection = ortho_camera;
+		cascade.transform = ortho_transform;
+		cascade.zfar = z_range;
+		cascade.split = split;
+		cascade.shadow_texel_size = extent * 2.0 / texture_size;
+		cascade.bias_scale = extent / first_extent * first_split;
+		cascade.range_begin = z_max;
+		cascade.uv_scale = Vector2(1.0 / (extent * 2.0), 1.0 / (extent * 2.0));
+		cascade.clipmap_origin = origin;
+		cascade.clipmap_page_size = page_size;
+	}
+}
+
+// Clipmap pages are stored one bit each, row after row.
+
+static uint64_t _clipmap_rect_pages(const Rect2i &p_rect) {
+	const int pages = RendererSceneRender::DIRECTIONAL_SHADOW_CLIPMAP_PAGES;
+	uint64_t row = ((uint64_t(1) << p_rect.size.x) - 1) << p_rect.position.x;
+	uint64_t mask = 0;
+	for (int y = p_rect.position.y; y < p_rect.position.y + p_rect.size.y; y++) {
+		mask |= row << (y * pages);
+	}
+	return mask;
+}
+
+static uint64_t _clipmap_aabb_pages(const AABB &p_aabb, const Vector3 &p_x_vec, const Vector3 &p_y_vec, const Vector2 &p_min, real_t p_page_size) {
+	const int pages = RendererSceneRender::DIRECTIONAL_SHADOW_CLIPMAP_PAGES;
+	Vector3 half = p_aabb.size * 0.5;
+	Vector3 center = p_aabb.position + half;
+
+	real_t x = p_x_vec.dot(center) - p_min.x;
+	real_t y = p_y_vec.dot(center) - p_min.y;
+	real_t half_x = Math::abs(p_x_vec.x) * half.x + Math::abs(p_x_vec.y) * half.y + Math::abs(p_x_vec.z) * half.z;
+	real_t half_y = Math::abs(p_y_vec.x) * half.x + Math::abs(p_y_vec.y) * half.y + Math::abs(p_y_vec.z) * half.z;
+
+	int from_x = MAX(0, (int)Math::floor((x - half_x) / p_page_size));
+	int from_y = MAX(0, (int)Math::floor((y - half_y) / p_page_size));
+	int to_x = MIN(pages - 1, (int)Math::floor((x + half_x) / p_page_size));
+	int to_y = MIN(pages - 1, (int)Math::floor((y + half_y) / p_page_size));
+
+	if (from_x > to_x || from_y > to_y) {
+		return 0;
+	}
+
+	return _clipmap_rect_pages(Rect2i(from_x, from_y, to_x - from_x + 1, to_y - from_y + 1));
+}
+
+static uint64_t _clipmap_scroll_pages(uint64_t p_pages, const Vector2i &p_scroll) {
+	// Page p of the level now shows what page p + scroll showed.
+	const int pages = RendererSceneRender::DIRECTIONAL_SHADOW_CLIPMAP_PAGES;
+	uint64_t scrolled = 0;
+	for (int y = 0; y < pages; y++) {
+		for (int x = 0; x < pages; x++) {
+			if (!(p_pages & (uint64_t(1) << (y * pages + x)))) {
+				continue;
+			}
+			int to_x = x - p_scroll.x;
+			int to_y = y - p_scroll.y;
+			if (to_x >= 0 && to_x < pages && to_y >= 0 && to_y < pages) {
+				scrolled |= uint64_t(1) << (to_y * pages + to_x);
+			}
+		}
+	}
+	return scrolled;
+}
+
+static int _clipmap_pages_to_rects(uint64_t p_pages, Rect2i *r_rects, int p_max_rects) {
+	// Greedily grow rows of pages downwards, falling back to the bounds if that takes too many passes.
+	const int pages = RendererSceneRender::DIRECTIONAL_SHADOW_CLIPMAP_PAGES;
+	int count = 0;
+	Rect2i bounds;
+
+	while (p_pages) {
+		int first = 0;
+		while (!(p_pages & (uint64_t(1) << first))) {
+			first++;
+		}
+
+		int x = first % pages;
+		int y = first / pages;
+		int width = 1;
+		while (x + width < pages && (p_pages & (uint64_t(1) << (first + width)))) {
+			width++;
+		}
+
+		uint64_t row = ((uint64_t(1) << width) - 1) << first;
+		int height = 1;
+		while (y + height < pages && (p_pages & (row << (height * pages))) == (row << (height * pages))) {
+			height++;
+		}
+
+		for (int i = 0; i < height; i++) {
+			p_pages &= ~(row << (i * pages));
+		}
+
+		Rect2i rect(x, y, width, height);
+		bounds = count == 0 ? rect : bounds.merge(rect);
+		if (count < p_max_rects) {
+			r_rects[count] = rect;
+		}
+		count++;
+	}
+
+	if (count > p_max_rects) {
+		r_rects[0] = bounds;
+		return 1;
+	}
+
+	return count;
+}
+
+void RendererSceneCull::_light_instance_update_directional_clipmap(int p_shadow_index, Scenario *p_scenario) {
+	const Cull::Shadow &shadow = cull.shadows[p_shadow_index];
+	InstanceLightData *light = shadow.clipmap_light;
+	InstanceLightData::DirectionalClipmap &clipmap = light->clipmap;
+
+	const int pages = RendererSceneRender::DIRECTIONAL_SHADOW_CLIPMAP_PAGES;
+	const uint64_t all_pages = ~uint64_t(0);
+	const int max_rects = 4;
+
+	for (uint32_t i = 0; i < shadow.cascade_count; i++) {
+		const Cull::Shadow::Cascade &c = shadow.cascades[i];
+		scene_render->light_instance_set_shadow_transform(shadow.light_instance, c.projection, c.transform, c.zfar, c.split, i, c.shadow_texel_size, c.bias_scale, c.range_begin, c.uv_scale);
+	}
+
+	// Anything that changes the pages behind the clipmap's back makes it redraw all of them.
+	uint64_t atlas_version = scene_render->get_directional_shadow_version();
+	const Basis &basis = shadow.cascades[0].transform.basis;
+	bool reset = light->shadow_dirty || clipmap.atlas_version != atlas_version || clipmap.static_version != p_scenario->static_shadow_version || clipmap.basis != basis;
+
+	light->shadow_dirty = false;
+	clipmap.atlas_version = atlas_version;
+	clipmap.static_version = p_scenario->static_shadow_version;
+	clipmap.basis = basis;
+
+	Vector3 x_vec = basis.get_axis(Vector3::AXIS_X);
+	Vector3 y_vec = basis.get_axis(Vector3::AXIS_Y);
+
+	for (uint32_t i = 0; i < shadow.cascade_count; i++) {
+		const Cull::Shadow::Cascade &c = shadow.cascades[i];
+		const PagedArray<Instance *> &casters = frustum_cull_result.directional_shadows[p_shadow_index].cascade_casters[i];
+
+		Vector2i scroll = c.clipmap_origin - clipmap.origin[i];
+		bool redraw_all = reset || !clipmap.valid[i] || clipmap.page_size[i] != c.clipmap_page_size || clipmap.texel_size[i] != c.shadow_texel_size || clipmap.range_begin[i] != c.range_begin || ABS(scroll.x) >= pages || ABS(scroll.y) >= pages;
+
+		// Redraw the pages the camera uncovered, and those that held dynamic casters last frame,
+		// as the casters may have left them since.
+		uint64_t dirty_pages = all_pages;
+		if (redraw_all) {
+			scroll = Vector2i();
+		} else {
+			dirty_pages = ~_clipmap_scroll_pages(all_pages, scroll) | _clipmap_scroll_pages(clipmap.dynamic_pages[i], scroll);
+		}
+
+		Vector2 level_min = Vector2(c.clipmap_origin.x - pages / 2, c.clipmap_origin.y - pages / 2) * c.clipmap_page_size;
+
+		uint64_t dynamic_pages = 0;
+		clipmap_caster_pages.resize(casters.size());
+		for (uint32_t j = 0; j < casters.size(); j++) {
+			clipmap_caster_pages[j] = _clipmap_aabb_pages(casters[j]->transformed_aabb, x_vec, y_vec, level_min, c.clipmap_page_size);
+			if (_instance_is_dynamic_shadow_caster(casters[j])) {
+				dynamic_pages |= clipmap_caster_pages[j];
+			}
+		}
+		dirty_pages |= dynamic_pages;
+
+		clipmap.valid[i] = true;
+		clipmap.origin[i] = c.clipmap_origin;
+		clipmap.page_size[i] = c.clipmap_page_size;
+		clipmap.texel_size[i] = c.shadow_texel_size;
+		clipmap.range_begin[i] = c.range_begin;
+		clipmap.dynamic_pages[i] = dynamic_pages;
+
+		Rect2i rects[max_rects];
+		int rect_count = _clipmap_pages_to_rects(dirty_pages, rects, max_rects);
+
+		for (int j = 0; j < rect_count; j++) {
+			if (max_shadows_used == MAX_UPDATE_SHADOWS) {
+				clipmap.valid[i] = false; // Pages were skipped, start over next frame.
+				break;
+			}
+
+			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+			shadow_data.light = shadow.light_instance;
+			shadow_data.pass = i;
+			shadow_data.use_static_cache = false;
+			shadow_data.update_static_cache = false;
+			shadow_data.clipmap_pages = rects[j];
+			shadow_data.clipmap_scroll = j == 0 ? scroll : Vector2i();
+
+			uint64_t rect_pages = _clipmap_rect_pages(rects[j]);
+			for (uint32_t k = 0; k < casters.size(); k++) {
+				if (clipmap_caster_pages[k] & rect_pages) {
+					shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(casters[k]->base_data)->geometry_instance);
+				}
+			}
+		}
+	}
+}
+
+bool RendererSceneCull::_instance_is_dynamic_shadow_caster(Instance *p_instance) const {
+	// Anything that can change shape without its transform changing is kept out of cached shadows.
+	return p_instance->moved || p_instance->base_type != RS::INSTANCE_MESH || p_instance->mesh_instance.is_valid() || static_cast<InstanceGeometryData *>(p_instance->base_data)->material_is_animated;
+}
+
+void RendererSceneCull::_light_add_shadow_caster(RendererSceneRender::RenderShadowData &r_shadow_data, Instance *p_instance, bool p_use_static_cache, bool &r_animated) {
+	RendererSceneRender::GeometryInstance *geometry_instance = static_cast<InstanceGeometryData *>(p_instance->base_data)->geometry_instance;
+
+	if (p_use_static_cache && !p_instance->shadow_caster_dynamic) {
+		if (r_shadow_data.update_static_cache) {
+			r_shadow_data.static_instances.push_back(geometry_instance);
+		}
+		return;
+	}
+
+	if (static_cast<InstanceGeometryData *>(p_instance->base_data)->material_is_animated) {
+		r_animated = true;
+	}
+
+	if (p_instance->mesh_instance.is_valid()) {
+		RSG::storage->mesh_instance_check_for_update(p_instance->mesh_instance);
+	}
+
+	r_shadow_data.instances.push_back(geometry_instance);
+}
+
+bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_lod_threshold, bool p_update_static) {
 	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
 	Transform light_transform = p_instance->transform;
@@ -1912,6 +2437,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 				if (max_shadows_used + 2 > MAX_UPDATE_SHADOWS) {
 					return true;
 				}
+				bool use_static_cache = shadow_cache_static_casters;
 				for (int i = 0; i < 2; i++) {
 					//using this one ensures that raster deferred will have it
 					RENDER_TIMESTAMP("Culling Shadow Paraboloid" + itos(i));
@@ -1919,18 +2445,18 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					real_t radius = RSG::storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 
 					real_t z = i == 0 ? -1 : 1;
-					Vector<Plane> planes;
-					planes.resize(6);
-					planes.write[0] = light_transform.xform(Plane(Vector3(0, 0, z), radius));
-					planes.write[1] = light_transform.xform(Plane(Vector3(1, 0, z).normalized(), radius));
-					planes.write[2] = light_transform.xform(Plane(Vector3(-1, 0, z).normalized(), radius));
-					planes.write[3] = light_transform.xform(Plane(Vector3(0, 1, z).normalized(), radius));
-					planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
-					planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
+					Plane planes[6] = {
+						light_transform.xform(Plane(Vector3(0, 0, z), radius)),
+						light_transform.xform(Plane(Vector3(1, 0, z).normalized(), radius)),
+						light_transform.xform(Plane(Vector3(-1, 0, z).normalized(), radius)),
+						light_transform.xform(Plane(Vector3(0, 1, z).normalized(), radius)),
+						light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius)),
+						light_transform.xform(Plane(Vector3(0, 0, -z), 0)),
+					};
 
 					instance_shadow_cull_result.clear();
 
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
+					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(planes, 6);
 
 					struct CullConvex {
 						PagedArray<Instance *> *result;
@@ -1944,27 +2470,20 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					CullConvex cull_convex;
 					cull_convex.result = &instance_shadow_cull_result;
 
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes, 6, points.ptr(), points.size(), cull_convex);
 
 					Plane near_plane(light_transform.origin, light_transform.basis.get_axis(2) * z);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+					shadow_data.use_static_cache = use_static_cache;
+					shadow_data.update_static_cache = use_static_cache && p_update_static;
 
 					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
 						Instance *instance = instance_shadow_cull_result[j];
 						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows) {
 							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-
-							if (instance->mesh_instance.is_valid()) {
-								RSG::storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
 						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						_light_add_shadow_caster(shadow_data, instance, use_static_cache, animated_material_found);
 					}
 
 					RSG::storage->update_mesh_instances();
@@ -1978,6 +2497,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 				if (max_shadows_used + 6 > MAX_UPDATE_SHADOWS) {
 					return true;
 				}
+				bool use_static_cache = false; // Faces are resampled into the atlas, they can't be drawn over a cached copy.
 
 				real_t radius = RSG::storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 				CameraMatrix cm;
@@ -2027,21 +2547,15 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+					shadow_data.use_static_cache = use_static_cache;
+					shadow_data.update_static_cache = use_static_cache && p_update_static;
 
 					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
 						Instance *instance = instance_shadow_cull_result[j];
 						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows) {
 							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-							if (instance->mesh_instance.is_valid()) {
-								RSG::storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
 						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						_light_add_shadow_caster(shadow_data, instance, use_static_cache, animated_material_found);
 					}
 
 					RSG::storage->update_mesh_instances();
@@ -2062,6 +2576,7 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			if (max_shadows_used + 1 > MAX_UPDATE_SHADOWS) {
 				return true;
 			}
+			bool use_static_cache = shadow_cache_static_casters;
 
 			real_t radius = RSG::storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 			real_t angle = RSG::storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_SPOT_ANGLE);
@@ -2090,21 +2605,15 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+			shadow_data.use_static_cache = use_static_cache;
+			shadow_data.update_static_cache = use_static_cache && p_update_static;
 
 			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
 				Instance *instance = instance_shadow_cull_result[j];
 				if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows) {
 					continue;
-				} else {
-					if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-						animated_material_found = true;
-					}
-
-					if (instance->mesh_instance.is_valid()) {
-						RSG::storage->mesh_instance_check_for_update(instance->mesh_instance);
-					}
 				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				_light_add_shadow_caster(shadow_data, instance, use_static_cache, animated_material_found);
 			}
 
 			RSG::storage->update_mesh_instances();
@@ -2119,6 +2628,27 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 	return animated_material_found;
 }
 
+void RendererSceneCull::_light_instance_redraw_shadow(Instance *p_instance, bool p_update_static, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_lod_threshold) {
+	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
+
+	uint32_t shadows_used = max_shadows_used;
+	bool animated = _light_instance_update_shadow(p_instance, p_cam_transform, p_cam_projection, p_cam_orthogonal, p_cam_vaspect, p_shadow_atlas, p_scenario, p_screen_lod_threshold, p_update_static);
+
+	if (max_shadows_used == shadows_used) {
+		// Out of shadow passes for this frame, try again next one.
+		if (p_update_static) {
+			light->shadow_dirty = true;
+		} else {
+			light->dynamic_shadow_dirty = true;
+		}
+		return;
+	}
+
+	// Animated materials keep the dynamic casters dirty.
+	light->dynamic_shadow_dirty = animated;
+	light->shadow_update_frame = RSG::rasterizer->get_frame_number();
+}
+
 void RendererSceneCull::render_camera(RID p_render_buffers, RID p_camera, RID p_scenario, Size2 p_viewport_size, float p_screen_lod_threshold, RID p_shadow_atlas) {
 // render to mono camera
 #ifndef _3D_DISABLED
@@ -2170,7 +2700,7 @@ void RendererSceneCull::render_camera(RID p_render_buffers, RID p_camera, RID p_
 
 void RendererSceneCull::render_camera(RID p_render_buffers, Ref<XRInterface> &p_interface, XRInterface::Eyes p_eye, RID p_camera, RID p_scenario, Size2 p_viewport_size, float p_screen_lod_threshold, RID p_shadow_atlas) {
 	// render for AR/VR interface
-#if 0
+#ifndef _3D_DISABLED
 	Camera *camera = camera_owner.getornull(p_camera);
 	ERR_FAIL_COND(!camera);
 
@@ -2185,73 +2715,112 @@ void RendererSceneCull::render_camera(RID p_render_buffers, Ref<XRInterface> &p_
 
 	RID environment = _render_get_environment(p_camera, p_scenario);
 
-	// For stereo render we only prepare for our left eye and then reuse the outcome for our right eye
-	if (p_eye == XRInterface::EYE_LEFT) {
-		// Center our transform, we assume basis is equal.
-		Transform mono_transform = cam_transform;
-		Transform right_transform = p_interface->get_transform_for_eye(XRInterface::EYE_RIGHT, world_origin);
-		mono_transform.origin += right_transform.origin;
-		mono_transform.origin *= 0.5;
-
-		// We need to combine our projection frustums for culling.
-		// Ideally we should use our clipping planes for this and combine them,
-		// however our shadow map logic uses our projection matrix.
-		// Note: as our left and right frustums should be mirrored, we don't need our right projection matrix.
-
-		// - get some base values we need
-		float eye_dist = (mono_transform.origin - cam_transform.origin).length();
-		float z_near = camera_matrix.get_z_near(); // get our near plane
-		float z_far = camera_matrix.get_z_far(); // get our far plane
-		float width = (2.0 * z_near) / camera_matrix.matrix[0][0];
-		float x_shift = width * camera_matrix.matrix[2][0];
-		float height = (2.0 * z_near) / camera_matrix.matrix[1][1];
-		float y_shift = height * camera_matrix.matrix[2][1];
-
-		// printf("Eye_dist = %f, Near = %f, Far = %f, Width = %f, Shift = %f\n", eye_dist, z_near, z_far, width, x_shift);
-
-		// - calculate our near plane size (horizontal only, right_near is mirrored)
-		float left_near = -eye_dist - ((width - x_shift) * 0.5);
-
-		// - calculate our far plane size (horizontal only, right_far is mirrored)
-		float left_far = -eye_dist - (z_far * (width - x_shift) * 0.5 / z_near);
-		float left_far_right_eye = eye_dist - (z_far * (width + x_shift) * 0.5 / z_near);
-		if (left_far > left_far_right_eye) {
-			// on displays smaller then double our iod, the right eye far frustrum can overtake the left eyes.
-			left_far = left_far_right_eye;
-		}
-
-		// - figure out required z-shift
-		float slope = (left_far - left_near) / (z_far - z_near);
-		float z_shift = (left_near / slope) - z_near;
-
-		// - figure out new vertical near plane size (this will be slightly oversized thanks to our z-shift)
-		float top_near = (height - y_shift) * 0.5;
-		top_near += (top_near / z_near) * z_shift;
-		float bottom_near = -(height + y_shift) * 0.5;
-		bottom_near += (bottom_near / z_near) * z_shift;
-
-		// printf("Left_near = %f, Left_far = %f, Top_near = %f, Bottom_near = %f, Z_shift = %f\n", left_near, left_far, top_near, bottom_near, z_shift);
-
-		// - generate our frustum
-		CameraMatrix combined_matrix;
-		combined_matrix.set_frustum(left_near, -left_near, bottom_near, top_near, z_near + z_shift, z_far + z_shift);
-
-		// and finally move our camera back
-		Transform apply_z_shift;
-		apply_z_shift.origin = Vector3(0.0, 0.0, z_shift); // z negative is forward so this moves it backwards
-		mono_transform *= apply_z_shift;
-
-		// now prepare our scene with our adjusted transform projection matrix
-		_prepare_scene(mono_transform, combined_matrix, false, false, p_render_buffers, environment, camera->visible_layers, p_scenario, p_shadow_atlas, RID(), p_screen_lod_threshold);
-	} else if (p_eye == XRInterface::EYE_MONO) {
-		// For mono render, prepare as per usual
-		_prepare_scene(cam_transform, camera_matrix, false, false, p_render_buffers, environment, camera->visible_layers, p_scenario, p_shadow_atlas, RID(), p_screen_lod_threshold);
-	}
-
-	// And render our scene...
-	_render_scene(p_render_buffers, cam_transform, camera_matrix, false, environment, camera->effects, p_scenario, p_shadow_atlas, RID(), -1, p_screen_lod_threshold);
+	if (p_eye == XRInterface::EYE_RIGHT && xr_cull.frame == RSG::rasterizer->get_frame_number() && xr_cull.render_buffers == p_render_buffers && xr_cull.scenario == p_scenario) {
+		// The left eye was culled with a frustum covering both eyes, and its shadows were already drawn,
+		// so only render the scene again from the right eye.
+		Scenario *scenario = scenario_owner.getornull(p_scenario);
+		RID camera_effects = camera->effects.is_valid() ? camera->effects : scenario->camera_effects;
+		xr_cull.frame = 0;
+
+		RENDER_TIMESTAMP("Render Scene (Right Eye)");
+		scene_render->render_scene(p_render_buffers, cam_transform, camera_matrix, false, frustum_cull_result.geometry_instances, frustum_cull_result.light_instances, frustum_cull_result.reflections, frustum_cull_result.gi_probes, frustum_cull_result.decals, frustum_cull_result.lightmaps, environment, camera_effects, p_shadow_atlas, scenario->reflection_atlas, RID(), -1, p_screen_lod_threshold, render_shadow_data, 0, render_sdfgi_data, 0);
+		return;
+	}
+
+	if (p_eye != XRInterface::EYE_LEFT) {
+		// Mono, or a right eye that can't reuse the left eye culling: render as per usual.
+		_render_scene(cam_transform, camera_matrix, false, false, p_render_buffers, environment, camera->effects, camera->visible_layers, p_scenario, p_shadow_atlas, RID(), -1, p_screen_lod_threshold);
+		return;
+	}
+
+	// For stereo render we only cull for our left eye and then reuse the outcome for our right eye.
+	// Center our transform, we assume basis is equal.
+	Transform mono_transform = cam_transform;
+	Transform right_transform = p_interface->get_transform_for_eye(XRInterface::EYE_RIGHT, world_origin);
+	mono_transform.origin += right_transform.origin;
+	mono_transform.origin *= 0.5;
+
+	// We need to combine our projection frustums for culling.
+	// Ideally we should use our clipping planes for this and combine them,
+	// however our shadow map logic uses our projection matrix.
+	// Note: as our left and right frustums should be mirrored, we don't need our right projection matrix.
+
+	// - get some base values we need
+	float eye_dist = (mono_transform.origin - cam_transform.origin).length();
+	float z_near = camera_matrix.get_z_near(); // get our near plane
+	float z_far = camera_matrix.get_z_far(); // get our far plane
+	float width = (2.0 * z_near) / camera_matrix.matrix[0][0];
+	float x_shift = width * camera_matrix.matrix[2][0];
+	float height = (2.0 * z_near) / camera_matrix.matrix[1][1];
+	float y_shift = height * camera_matrix.matrix[2][1];
+
+	// printf("Eye_dist = %f, Near = %f, Far = %f, Width = %f, Shift = %f\n", eye_dist, z_near, z_far, width, x_shift);
+
+	// - calculate our near plane size (horizontal only, right_near is mirrored)
+	float left_near = -eye_dist - ((width - x_shift) * 0.5);
+
+	// - calculate our far plane size (horizontal only, right_far is mirrored)
+	float left_far = -eye_dist - (z_far * (width - x_shift) * 0.5 / z_near);
+	float left_far_right_eye = eye_dist - (z_far * (width + x_shift) * 0.5 / z_near);
+	if (left_far > left_far_right_eye) {
+		// on displays smaller then double our iod, the right eye far frustrum can overtake the left eyes.
+		left_far = left_far_right_eye;
+	}
+
+	// - figure out required z-shift
+	float slope = (left_far - left_near) / (z_far - z_near);
+	float z_shift = (left_near / slope) - z_near;
+
+	// - figure out new vertical near plane size (this will be slightly oversized thanks to our z-shift)
+	float top_near = (height - y_shift) * 0.5;
+	top_near += (top_near / z_near) * z_shift;
+	float bottom_near = -(height + y_shift) * 0.5;
+	bottom_near += (bottom_near / z_near) * z_shift;
+
+	// printf("Left_near = %f, Left_far = %f, Top_near = %f, Bottom_near = %f, Z_shift = %f\n", left_near, left_far, top_near, bottom_near, z_shift);
+
+	// - generate our frustum
+	CameraMatrix combined_matrix;
+	combined_matrix.set_frustum(left_near, -left_near, bottom_near, top_near, z_near + z_shift, z_far + z_shift);
+
+	// and finally move our camera back
+	Transform apply_z_shift;
+	apply_z_shift.origin = Vector3(0.0, 0.0, z_shift); // z negative is forward so this moves it backwards
+	mono_transform *= apply_z_shift;
+
+	// Cull with the combined frustum, but render from the left eye.
+	_render_scene(mono_transform, combined_matrix, false, false, p_render_buffers, environment, camera->effects, camera->visible_layers, p_scenario, p_shadow_atlas, RID(), -1, p_screen_lod_threshold, true, &cam_transform, &camera_matrix);
+
+	xr_cull.frame = RSG::rasterizer->get_frame_number();
+	xr_cull.render_buffers = p_render_buffers;
+	xr_cull.scenario = p_scenario;
 #endif
-};
+}
+
+void RendererSceneCull::_occlusion_cull_setup(Scenario *p_scenario, const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, uint32_t p_visible_layers, bool p_enabled) {
+	if (!p_enabled || p_scenario->occluders.is_empty()) {
+		occlusion_cull.begin(p_cam_projection, p_cam_transform, 0); // Disables it for this pass.
+		return;
+	}
+
+	occlusion_cull.begin(p_cam_projection, p_cam_transform, occlusion_buffer_width);
+
+	for (List<Instance *>::Element *E = p_scenario->occluders.front(); E; E = E->next()) {
+		Instance *instance = E->get();
+		if (!instance->visible || !instance->indexer_id.is_valid() || (p_visible_layers & instance->layer_mask) == 0) {
+			continue;
+		}
+
+		if (!InstanceBounds(instance->transformed_aabb).in_frustum(cull.frustum)) {
+			continue;
+		}
+
+		Occluder *occluder = static_cast<InstanceOccluderData *>(instance->base_data)->occluder;
+		occlusion_cull.add_occluder(instance->transform, occluder->vertices.ptr(), occluder->indices.ptr(), occluder->indices.size());
+	}
+
+	occlusion_cull.end();
+}
 
 void RendererSceneCull::_frustum_cull_threaded(uint32_t p_thread, FrustumCullData *cull_data) {
 	uint32_t cull_total = cull_data->scenario->instance_data.size();
@@ -2321,6 +2890,9 @@ void RendererSceneCull::_frustum_cull(FrustumCullData &cull_data, FrustumCullRes
 
 			} else if (base_type == RS::INSTANCE_LIGHTMAP) {
 				cull_result.gi_probes.push_back(RID::from_uint64(idata.instance_data_rid));
+			} else if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && !(idata.flags & InstanceData::FLAG_CAST_SHADOWS_ONLY) && occlusion_cull.is_active() && occlusion_cull.is_occluded(idata.instance->transformed_aabb)) {
+				//hidden behind occluders, still considered below for shadows
+				cull_result.occluded_count++;
 			} else if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && !(idata.flags & InstanceData::FLAG_CAST_SHADOWS_ONLY)) {
 				bool keep = true;
 
@@ -2339,7 +2911,7 @@ void RendererSceneCull::_frustum_cull(FrustumCullData &cull_data, FrustumCullRes
 						cull_data.cull->lock.lock();
 						RSG::storage->particles_request_process(idata.base_rid);
 						cull_data.cull->lock.unlock();
-						RSG::storage->particles_set_view_axis(idata.base_rid, -cull_data.cam_transform.basis.get_axis(2).normalized());
+						cull_result.particles.push_back(idata.instance);
 						//particles visible? request redraw
 						RenderingServerDefault::redraw_request();
 					}
@@ -2433,7 +3005,11 @@ void RendererSceneCull::_frustum_cull(FrustumCullData &cull_data, FrustumCullRes
 					uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
 					if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS) {
-						cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
+						if (cull_data.cull->shadows[j].clipmap_light) {
+							cull_result.directional_shadows[j].cascade_casters[k].push_back(idata.instance);
+						} else {
+							cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
+						}
 						mesh_visible = true;
 					}
 				}
@@ -2469,7 +3045,8 @@ void RendererSceneCull::_frustum_cull(FrustumCullData &cull_data, FrustumCullRes
 	}
 }
 
-void RendererSceneCull::_render_scene(const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_render_buffers, RID p_environment, RID p_force_camera_effects, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_lod_threshold, bool p_using_shadows) {
+void RendererSceneCull::_render_scene(const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_render_buffers, RID p_environment, RID p_force_camera_effects, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_lod_threshold, bool p_using_shadows, const Transform *p_render_transform, const CameraMatrix *p_render_projection) {
+	CPU_PROFILE_SCOPE("RendererSceneCull::render_scene");
 	// Note, in stereo rendering:
 	// - p_cam_transform will be a transform in the middle of our two eyes
 	// - p_cam_projection is a wider frustrum that encompasses both eyes
@@ -2479,6 +3056,7 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 	Scenario *scenario = scenario_owner.getornull(p_scenario);
 
 	render_pass++;
+	xr_cull.frame = 0; // The cull results are about to change.
 
 	scene_render->set_scene_pass(render_pass);
 
@@ -2504,7 +3082,7 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 	{
 		cull.shadow_count = 0;
 
-		Vector<Instance *> lights_with_shadow;
+		LocalVector<Instance *, uint32_t, false, FrameArenaAllocator> lights_with_shadow;
 
 		for (List<Instance *>::Element *E = scenario->directional_lights.front(); E; E = E->next()) {
 			if (!E->get()->visible) {
@@ -2530,7 +3108,7 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 
 		scene_render->set_directional_shadow_count(lights_with_shadow.size());
 
-		for (int i = 0; i < lights_with_shadow.size(); i++) {
+		for (uint32_t i = 0; i < lights_with_shadow.size(); i++) {
 			_light_instance_setup_directional_shadow(i, lights_with_shadow[i], p_cam_transform, p_cam_projection, p_cam_orthogonal, p_cam_vaspect);
 		}
 	}
@@ -2560,6 +3138,12 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 		}
 	}
 
+	RENDER_TIMESTAMP("Occlusion Culling");
+
+	_occlusion_cull_setup(scenario, p_cam_transform, p_cam_projection, p_visible_layers, use_occlusion_culling && render_reflection_probe == nullptr);
+
+	RENDER_TIMESTAMP("Instance Culling");
+
 	frustum_cull_result.clear();
 
 	{
@@ -2604,12 +3188,27 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 		print_line("time taken: " + rtos(time_avg / time_count));
 #endif
 
+		occlusion_culled_instances_in_frame += frustum_cull_result.occluded_count;
+
 		if (frustum_cull_result.mesh_instances.size()) {
 			for (uint64_t i = 0; i < frustum_cull_result.mesh_instances.size(); i++) {
 				RSG::storage->mesh_instance_check_for_update(frustum_cull_result.mesh_instances[i]);
 			}
 			RSG::storage->update_mesh_instances();
 		}
+
+		if (frustum_cull_result.particles.size()) {
+			Vector3 view_axis = -p_cam_transform.basis.get_axis(2).normalized();
+			float lod_multiplier = p_cam_projection.get_lod_multiplier();
+			for (uint64_t i = 0; i < frustum_cull_result.particles.size(); i++) {
+				Instance *instance = frustum_cull_result.particles[i];
+				//rough fraction of the screen width it covers, drives simulation LOD
+				float distance = p_cam_orthogonal ? 1.0 : MAX(p_cam_transform.origin.distance_to(instance->transformed_aabb.position + instance->transformed_aabb.size * 0.5), 0.001);
+				RSG::storage->particles_set_view_screen_size(instance->base, instance->transformed_aabb.get_longest_axis_size() / (distance * lod_multiplier));
+				RSG::storage->particles_set_view_axis(instance->base, view_axis);
+			}
+			RSG::storage->update_particles_sort();
+		}
 	}
 
 	//render shadows
@@ -2621,6 +3220,11 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 		// Directional Shadows
 
 		for (uint32_t i = 0; i < cull.shadow_count; i++) {
+			if (cull.shadows[i].clipmap_light) {
+				_light_instance_update_directional_clipmap(i, scenario);
+				continue;
+			}
+
 			for (uint32_t j = 0; j < cull.shadows[i].cascade_count; j++) {
 				const Cull::Shadow::Cascade &c = cull.shadows[i].cascades[j];
 				//			print_line("shadow " + itos(i) + " cascade " + itos(j) + " elements: " + itos(c.cull_result.size()));
@@ -2631,6 +3235,10 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 				render_shadow_data[max_shadows_used].light = cull.shadows[i].light_instance;
 				render_shadow_data[max_shadows_used].pass = j;
 				render_shadow_data[max_shadows_used].instances.merge_unordered(frustum_cull_result.directional_shadows[i].cascade_geometry_instances[j]);
+				render_shadow_data[max_shadows_used].use_static_cache = false;
+				render_shadow_data[max_shadows_used].update_static_cache = false;
+				render_shadow_data[max_shadows_used].clipmap_pages = Rect2i();
+				render_shadow_data[max_shadows_used].clipmap_scroll = Vector2i();
 				max_shadows_used++;
 			}
 		}
@@ -2720,17 +3328,44 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 				light->shadow_dirty = false;
 			}
 
-			bool redraw = scene_render->shadow_atlas_update_light(p_shadow_atlas, light->instance, coverage, light->last_version);
+			// The atlas only tracks the static version, dynamic casters are redrawn over the cached static shadow.
+			bool redraw_static = scene_render->shadow_atlas_update_light(p_shadow_atlas, light->instance, coverage, light->last_version);
 
-			if (redraw && max_shadows_used < MAX_UPDATE_SHADOWS) {
-				//must redraw!
-				RENDER_TIMESTAMP(">Rendering Light " + itos(i));
-				light->shadow_dirty = _light_instance_update_shadow(ins, p_cam_transform, p_cam_projection, p_cam_orthogonal, p_cam_vaspect, p_shadow_atlas, scenario, p_screen_lod_threshold);
-				RENDER_TIMESTAMP("<Rendering Light " + itos(i));
-			} else {
-				light->shadow_dirty = redraw;
+			// Other viewports drawn this frame need the dynamic casters too.
+			bool redraw_dynamic = light->dynamic_shadow_dirty || light->shadow_update_frame == RSG::rasterizer->get_frame_number();
+
+			if (!redraw_static && !redraw_dynamic) {
+				continue;
 			}
+
+			if (shadow_distant_updates_per_frame > 0 && coverage < shadow_distant_coverage) {
+				DistantShadowUpdate update;
+				update.instance = ins;
+				update.last_update = light->shadow_update_frame;
+				update.update_static = redraw_static;
+				distant_shadow_updates.push_back(update);
+				continue;
+			}
+
+			RENDER_TIMESTAMP(">Rendering Light " + itos(i));
+			_light_instance_redraw_shadow(ins, redraw_static, p_cam_transform, p_cam_projection, p_cam_orthogonal, p_cam_vaspect, p_shadow_atlas, scenario, p_screen_lod_threshold);
+			RENDER_TIMESTAMP("<Rendering Light " + itos(i));
 		}
+
+		// Distant lights share a budget, the ones that waited the longest go first.
+		distant_shadow_updates.sort();
+		for (uint32_t i = 0; i < distant_shadow_updates.size(); i++) {
+			const DistantShadowUpdate &update = distant_shadow_updates[i];
+			if (i < shadow_distant_updates_per_frame) {
+				RENDER_TIMESTAMP(">Rendering Distant Light " + itos(i));
+				_light_instance_redraw_shadow(update.instance, update.update_static, p_cam_transform, p_cam_projection, p_cam_orthogonal, p_cam_vaspect, p_shadow_atlas, scenario, p_screen_lod_threshold);
+				RENDER_TIMESTAMP("<Rendering Distant Light " + itos(i));
+			} else if (update.update_static) {
+				// The atlas already took the new version, bump it again next frame.
+				static_cast<InstanceLightData *>(update.instance->base_data)->shadow_dirty = true;
+			}
+		}
+		distant_shadow_updates.clear();
 	}
 
 	//render SDFGI
@@ -2782,10 +3417,13 @@ void RendererSceneCull::_render_scene(const Transform p_cam_transform, const Cam
 	/* PROCESS GEOMETRY AND DRAW SCENE */
 
 	RENDER_TIMESTAMP("Render Scene ");
-	scene_render->render_scene(p_render_buffers, p_cam_transform, p_cam_projection, p_cam_orthogonal, frustum_cull_result.geometry_instances, frustum_cull_result.light_instances, frustum_cull_result.reflections, frustum_cull_result.gi_probes, frustum_cull_result.decals, frustum_cull_result.lightmaps, p_environment, camera_effects, p_shadow_atlas, p_reflection_probe.is_valid() ? RID() : scenario->reflection_atlas, p_reflection_probe, p_reflection_probe_pass, p_screen_lod_threshold, render_shadow_data, max_shadows_used, render_sdfgi_data, cull.sdfgi.region_count, &sdfgi_update_data);
+	const Transform &render_transform = p_render_transform ? *p_render_transform : p_cam_transform;
+	const CameraMatrix &render_projection = p_render_projection ? *p_render_projection : p_cam_projection;
+	scene_render->render_scene(p_render_buffers, render_transform, render_projection, p_cam_orthogonal, frustum_cull_result.geometry_instances, frustum_cull_result.light_instances, frustum_cull_result.reflections, frustum_cull_result.gi_probes, frustum_cull_result.decals, frustum_cull_result.lightmaps, p_environment, camera_effects, p_shadow_atlas, p_reflection_probe.is_valid() ? RID() : scenario->reflection_atlas, p_reflection_probe, p_reflection_probe_pass, p_screen_lod_threshold, render_shadow_data, max_shadows_used, render_sdfgi_data, cull.sdfgi.region_count, &sdfgi_update_data);
 
 	for (uint32_t i = 0; i < max_shadows_used; i++) {
 		render_shadow_data[i].instances.clear();
+		render_shadow_data[i].static_instances.clear();
 	}
 	max_shadows_used = 0;
 
@@ -2930,14 +3568,20 @@ void RendererSceneCull::render_probes() {
 				busy = true; //do not render another one of this kind
 			} break;
 			case RS::REFLECTION_PROBE_UPDATE_ALWAYS: {
-				int step = 0;
+				//render up to reflection_probe_faces_per_frame faces, continuing next frame, then filter once all six are in
+				uint32_t faces = 0;
 				bool done = false;
-				while (!done) {
-					done = _render_reflection_probe_step(ref_probe->self()->owner, step);
-					step++;
+				while (!done && (faces < reflection_probe_faces_per_frame || ref_probe->self()->render_step >= 6)) {
+					done = _render_reflection_probe_step(ref_probe->self()->owner, ref_probe->self()->render_step);
+					if (ref_probe->self()->render_step < 6) {
+						faces++;
+					}
+					ref_probe->self()->render_step++;
 				}
 
-				reflection_probe_render_list.remove(ref_probe);
+				if (done) {
+					reflection_probe_render_list.remove(ref_probe);
+				}
 			} break;
 		}
 
@@ -3378,6 +4022,10 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 					light->shadow_dirty = true;
 				}
 
+				if (p_instance->scenario) {
+					p_instance->scenario->static_shadow_version++;
+				}
+
 				geom->can_cast_shadows = can_cast_shadows;
 			}
 
@@ -3431,7 +4079,71 @@ void RendererSceneCull::update_dirty_instances() {
 	}
 }
 
+int RendererSceneCull::get_occlusion_culled_instance_count() const {
+	return occlusion_culled_instance_count;
+}
+
+uint64_t RendererSceneCull::get_shadow_memory_usage() const {
+	return scene_render->get_shadow_memory_usage();
+}
+
+void RendererSceneCull::set_physics_interpolation_enabled(bool p_enabled) {
+	physics_interpolation_enabled = p_enabled;
+	if (!p_enabled) {
+		tick(); // Leave everything that was being interpolated at its latest transform.
+	}
+}
+
+void RendererSceneCull::tick() {
+	for (uint32_t i = 0; i < interpolation_instances.size(); i++) {
+		Instance *instance = instance_owner.getornull(interpolation_instances[i]);
+		if (!instance) {
+			continue; // Freed during the tick.
+		}
+		instance->on_interpolation_list = false;
+		instance->transform_prev = instance->transform_curr;
+		_instance_set_rendered_transform(instance, instance->transform_curr);
+	}
+	interpolation_instances.clear();
+
+	for (uint32_t i = 0; i < interpolation_cameras.size(); i++) {
+		Camera *camera = camera_owner.getornull(interpolation_cameras[i]);
+		if (!camera) {
+			continue;
+		}
+		camera->on_interpolation_list = false;
+		camera->transform_prev = camera->transform_curr;
+		camera->transform = camera->transform_curr;
+	}
+	interpolation_cameras.clear();
+}
+
+void RendererSceneCull::update_interpolation_frame(float p_fraction) {
+	if (!physics_interpolation_enabled) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < interpolation_instances.size(); i++) {
+		Instance *instance = instance_owner.getornull(interpolation_instances[i]);
+		if (!instance || !instance->interpolated) {
+			continue;
+		}
+		_instance_set_rendered_transform(instance, instance->transform_prev.interpolate_with(instance->transform_curr, p_fraction));
+	}
+
+	for (uint32_t i = 0; i < interpolation_cameras.size(); i++) {
+		Camera *camera = camera_owner.getornull(interpolation_cameras[i]);
+		if (!camera || !camera->interpolated) {
+			continue;
+		}
+		camera->transform = camera->transform_prev.interpolate_with(camera->transform_curr, p_fraction).orthonormalized();
+	}
+}
+
 void RendererSceneCull::update() {
+	occlusion_culled_instance_count = occlusion_culled_instances_in_frame;
+	occlusion_culled_instances_in_frame = 0;
+
 	//optimize bvhs
 	for (uint32_t i = 0; i < scenario_owner.get_rid_count(); i++) {
 		Scenario *s = scenario_owner.get_ptr_by_index(i);
@@ -3454,6 +4166,16 @@ bool RendererSceneCull::free(RID p_rid) {
 		camera_owner.free(p_rid);
 		memdelete(camera);
 
+	} else if (occluder_owner.owns(p_rid)) {
+		Occluder *occluder = occluder_owner.getornull(p_rid);
+
+		while (occluder->users.front()) {
+			instance_set_base(occluder->users.front()->get()->self, RID());
+		}
+
+		occluder_owner.free(p_rid);
+		memdelete(occluder);
+
 	} else if (scenario_owner.owns(p_rid)) {
 		Scenario *scenario = scenario_owner.getornull(p_rid);
 
@@ -3522,6 +4244,7 @@ RendererSceneCull::RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		render_shadow_data[i].static_instances.set_page_pool(&geometry_instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -3536,6 +4259,15 @@ RendererSceneCull::RendererSceneCull() {
 	indexer_update_iterations = GLOBAL_GET("rendering/spatial_indexer/update_iterations_per_frame");
 	thread_cull_threshold = GLOBAL_GET("rendering/spatial_indexer/threaded_cull_minimum_instances");
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)RendererThreadPool::singleton->thread_work_pool.get_thread_count()); //make sure there is at least one thread per CPU
+
+	shadow_cache_static_casters = GLOBAL_GET("rendering/quality/shadows/cache_static_casters");
+	shadow_distant_updates_per_frame = GLOBAL_GET("rendering/quality/shadows/distant_light_updates_per_frame");
+	shadow_distant_coverage = GLOBAL_GET("rendering/quality/shadows/distant_light_coverage");
+
+	reflection_probe_faces_per_frame = CLAMP(int(GLOBAL_GET("rendering/quality/reflections/update_always_faces_per_frame")), 1, 6);
+
+	use_occlusion_culling = GLOBAL_GET("rendering/occlusion_culling/use_occlusion_culling");
+	occlusion_buffer_width = GLOBAL_GET("rendering/occlusion_culling/occlusion_buffer_width");
 }
 
 RendererSceneCull::~RendererSceneCull() {
@@ -3544,6 +4276,7 @@ RendererSceneCull::~RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		render_shadow_data[i].static_instances.reset();
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.reset();
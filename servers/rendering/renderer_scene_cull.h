@@ -45,6 +45,7 @@
 #include "core/templates/rid_owner.h"
 #include "core/templates/self_list.h"
 #include "servers/rendering/renderer_scene.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
 #include "servers/rendering/renderer_scene_render.h"
 #include "servers/xr/xr_interface.h"
 class RendererSceneCull : public RendererScene {
@@ -82,6 +83,13 @@ public:
 
 		Transform transform;
 
+		// Physics interpolation, the rendered transform is blended between the last two physics ticks.
+		Transform transform_prev;
+		Transform transform_curr;
+		bool interpolated = true;
+		bool on_interpolation_list = false;
+		bool interpolation_teleport = true; // Next transform is a jump, don't interpolate from the previous one.
+
 		Camera() {
 			visible_layers = 0xFFFFFFFF;
 			fov = 75;
@@ -107,12 +115,32 @@ public:
 	virtual void camera_set_environment(RID p_camera, RID p_env);
 	virtual void camera_set_camera_effects(RID p_camera, RID p_fx);
 	virtual void camera_set_use_vertical_aspect(RID p_camera, bool p_enable);
+	virtual void camera_set_interpolated(RID p_camera, bool p_interpolated);
+	virtual void camera_reset_physics_interpolation(RID p_camera);
 	virtual bool is_camera(RID p_camera) const;
 
-	/* SCENARIO API */
+	/* OCCLUDER API */
 
 	struct Instance;
 
+	struct Occluder {
+		LocalVector<Vector3> vertices;
+		LocalVector<int> indices;
+		AABB aabb;
+
+		Set<Instance *> users;
+	};
+
+	mutable RID_PtrOwner<Occluder, true> occluder_owner;
+
+	virtual RID occluder_allocate();
+	virtual void occluder_initialize(RID p_rid);
+
+	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices);
+	virtual bool is_occluder(RID p_occluder) const;
+
+	/* SCENARIO API */
+
 	struct PlaneSign {
 		_ALWAYS_INLINE_ PlaneSign() {}
 		_ALWAYS_INLINE_ PlaneSign(const Plane &p_plane) {
@@ -276,6 +304,7 @@ public:
 		RID self;
 
 		List<Instance *> directional_lights;
+		List<Instance *> occluders;
 		RID environment;
 		RID fallback_environment;
 		RID camera_effects;
@@ -286,6 +315,8 @@ public:
 
 		LocalVector<RID> dynamic_lights;
 
+		uint64_t static_shadow_version = 1; // Bumped when static shadow casters change, clipmap shadows redraw all their pages then.
+
 		PagedArray<InstanceBounds> instance_aabbs;
 		PagedArray<InstanceData> instance_data;
 
@@ -344,6 +375,13 @@ public:
 
 		Transform transform;
 
+		// Physics interpolation, see Camera.
+		Transform transform_prev;
+		Transform transform_curr;
+		bool interpolated = true;
+		bool on_interpolation_list = false;
+		bool interpolation_teleport = true;
+
 		float lod_bias;
 
 		Vector<RID> materials;
@@ -409,6 +447,10 @@ public:
 
 		uint64_t last_frame_pass;
 
+		uint64_t placed_frame; // Frame the instance entered its scenario.
+		bool moved; // Transform changed after placement, so it casts dynamic shadows from now on.
+		bool shadow_caster_dynamic; // Shadow layer the lights were last told this caster belongs to.
+
 		uint64_t version; // changes to this, and changes to base increase version
 
 		InstanceBaseData *base_data;
@@ -486,6 +528,9 @@ public:
 			lod_end_hysteresis = 0;
 
 			last_frame_pass = 0;
+			placed_frame = 0;
+			moved = false;
+			shadow_caster_dynamic = false;
 			version = 1;
 			base_data = nullptr;
 
@@ -511,6 +556,12 @@ public:
 
 	SelfList<Instance>::List _instance_update_list;
 	void _instance_queue_update(Instance *p_instance, bool p_update_aabb, bool p_update_dependencies = false);
+	void _instance_set_rendered_transform(Instance *p_instance, const Transform &p_transform);
+
+	// Instances and cameras moved during the current physics tick, interpolated every frame until the next tick.
+	bool physics_interpolation_enabled = false;
+	LocalVector<RID> interpolation_instances;
+	LocalVector<RID> interpolation_cameras;
 
 	struct InstanceGeometryData : public InstanceBaseData {
 		RendererSceneRender::GeometryInstance *geometry_instance = nullptr;
@@ -556,17 +607,38 @@ public:
 	};
 
 	SelfList<InstanceReflectionProbeData>::List reflection_probe_render_list;
+	uint32_t reflection_probe_faces_per_frame = 6;
 
 	struct InstanceParticlesCollisionData : public InstanceBaseData {
 		RID instance;
 	};
 
+	struct InstanceOccluderData : public InstanceBaseData {
+		Occluder *occluder = nullptr;
+		List<Instance *>::Element *O = nullptr; // occluder in scenario
+	};
+
 	struct InstanceLightData : public InstanceBaseData {
 		RID instance;
 		uint64_t last_version;
 		List<Instance *>::Element *D; // directional light in scenario
 
-		bool shadow_dirty;
+		bool shadow_dirty; // Static casters changed, the whole shadow must be redrawn.
+		bool dynamic_shadow_dirty = false; // Only dynamic casters changed.
+		uint64_t shadow_update_frame = 0;
+
+		// What the pages of a clipmap directional shadow were last drawn with, to only redraw what changed.
+		struct DirectionalClipmap {
+			uint64_t atlas_version = 0;
+			uint64_t static_version = 0;
+			Basis basis;
+			bool valid[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES] = {};
+			Vector2i origin[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+			real_t page_size[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES] = {};
+			real_t texel_size[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES] = {};
+			real_t range_begin[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES] = {};
+			uint64_t dynamic_pages[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES] = {}; // Pages holding dynamic casters, one bit each.
+		} clipmap;
 
 		Set<Instance *> geometries;
 
@@ -710,15 +782,20 @@ public:
 		PagedArray<RID> decals;
 		PagedArray<RID> gi_probes;
 		PagedArray<RID> mesh_instances;
+		PagedArray<Instance *> particles;
 
 		struct DirectionalShadow {
 			PagedArray<RendererSceneRender::GeometryInstance *> cascade_geometry_instances[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+			PagedArray<Instance *> cascade_casters[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES]; // Clipmaps need the bounds of their casters.
 		} directional_shadows[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS];
 
 		PagedArray<RendererSceneRender::GeometryInstance *> sdfgi_region_geometry_instances[SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE];
 		PagedArray<RID> sdfgi_cascade_lights[SDFGI_MAX_CASCADES];
 
+		uint32_t occluded_count = 0;
+
 		void clear() {
+			occluded_count = 0;
 			geometry_instances.clear();
 			lights.clear();
 			light_instances.clear();
@@ -727,9 +804,11 @@ public:
 			decals.clear();
 			gi_probes.clear();
 			mesh_instances.clear();
+			particles.clear();
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].clear();
+					directional_shadows[i].cascade_casters[j].clear();
 				}
 			}
 
@@ -751,9 +830,11 @@ public:
 			decals.reset();
 			gi_probes.reset();
 			mesh_instances.reset();
+			particles.reset();
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].reset();
+					directional_shadows[i].cascade_casters[j].reset();
 				}
 			}
 
@@ -767,6 +848,7 @@ public:
 		}
 
 		void append_from(FrustumCullResult &p_cull_result) {
+			occluded_count += p_cull_result.occluded_count;
 			geometry_instances.merge_unordered(p_cull_result.geometry_instances);
 			lights.merge_unordered(p_cull_result.lights);
 			light_instances.merge_unordered(p_cull_result.light_instances);
@@ -775,10 +857,12 @@ public:
 			decals.merge_unordered(p_cull_result.decals);
 			gi_probes.merge_unordered(p_cull_result.gi_probes);
 			mesh_instances.merge_unordered(p_cull_result.mesh_instances);
+			particles.merge_unordered(p_cull_result.particles);
 
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].merge_unordered(p_cull_result.directional_shadows[i].cascade_geometry_instances[j]);
+					directional_shadows[i].cascade_casters[j].merge_unordered(p_cull_result.directional_shadows[i].cascade_casters[j]);
 				}
 			}
 
@@ -800,9 +884,11 @@ public:
 			decals.set_page_pool(p_rid_pool);
 			gi_probes.set_page_pool(p_rid_pool);
 			mesh_instances.set_page_pool(p_rid_pool);
+			particles.set_page_pool(p_instance_pool);
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].set_page_pool(p_geometry_instance_pool);
+					directional_shadows[i].cascade_casters[j].set_page_pool(p_instance_pool);
 				}
 			}
 
@@ -819,6 +905,14 @@ public:
 	FrustumCullResult frustum_cull_result;
 	LocalVector<FrustumCullResult> frustum_cull_result_threads;
 
+	// Set when the left eye of a stereo camera was culled for both eyes, the right eye reuses
+	// frustum_cull_result if it's rendered next, in the same frame and to the same buffers.
+	struct XRCull {
+		uint64_t frame = 0;
+		RID render_buffers;
+		RID scenario;
+	} xr_cull;
+
 	RendererSceneRender::RenderShadowData render_shadow_data[MAX_UPDATE_SHADOWS];
 	uint32_t max_shadows_used = 0;
 
@@ -838,6 +932,8 @@ public:
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario);
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_transform(RID p_instance, const Transform &p_transform);
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated);
+	virtual void instance_reset_physics_interpolation(RID p_instance);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_material(RID p_instance, int p_surface, RID p_material);
@@ -878,8 +974,29 @@ public:
 	void _unpair_instance(Instance *p_instance);
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
+	void _light_instance_setup_directional_clipmap(int p_shadow_index, Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal);
+	void _light_instance_update_directional_clipmap(int p_shadow_index, Scenario *p_scenario);
 
-	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_scren_lod_threshold);
+	_FORCE_INLINE_ bool _instance_is_dynamic_shadow_caster(Instance *p_instance) const;
+	_FORCE_INLINE_ void _light_add_shadow_caster(RendererSceneRender::RenderShadowData &r_shadow_data, Instance *p_instance, bool p_use_static_cache, bool &r_animated);
+	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_scren_lod_threshold, bool p_update_static);
+	void _light_instance_redraw_shadow(Instance *p_instance, bool p_update_static, const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_lod_threshold);
+
+	bool shadow_cache_static_casters = true;
+	uint32_t shadow_distant_updates_per_frame = 4;
+	float shadow_distant_coverage = 0.1;
+
+	struct DistantShadowUpdate {
+		Instance *instance = nullptr;
+		uint64_t last_update = 0;
+		bool update_static = false;
+
+		bool operator<(const DistantShadowUpdate &p_other) const {
+			return last_update < p_other.last_update;
+		}
+	};
+	LocalVector<DistantShadowUpdate> distant_shadow_updates;
+	LocalVector<uint64_t> clipmap_caster_pages;
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
 
@@ -898,8 +1015,12 @@ public:
 				real_t range_begin;
 				Vector2 uv_scale;
 
+				Vector2i clipmap_origin; // Page the camera is in, in light space.
+				real_t clipmap_page_size;
+
 			} cascades[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES]; //max 4 cascades
 			uint32_t cascade_count;
+			InstanceLightData *clipmap_light; // Only set for clipmaps.
 
 		} shadows[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS];
 
@@ -930,11 +1051,19 @@ public:
 		Instance *render_reflection_probe;
 	};
 
+	RendererSceneOcclusionCull occlusion_cull;
+	bool use_occlusion_culling = false;
+	uint32_t occlusion_buffer_width = 256;
+	uint32_t occlusion_culled_instances_in_frame = 0;
+	uint32_t occlusion_culled_instance_count = 0; // from last frame
+
+	void _occlusion_cull_setup(Scenario *p_scenario, const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, uint32_t p_visible_layers, bool p_enabled);
+
 	void _frustum_cull_threaded(uint32_t p_thread, FrustumCullData *cull_data);
 	void _frustum_cull(FrustumCullData &cull_data, FrustumCullResult &cull_result, uint64_t p_from, uint64_t p_to);
 
 	bool _render_reflection_probe_step(Instance *p_instance, int p_step);
-	void _render_scene(const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_render_buffers, RID p_environment, RID p_force_camera_effects, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_lod_threshold, bool p_using_shadows = true);
+	void _render_scene(const Transform p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_render_buffers, RID p_environment, RID p_force_camera_effects, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_lod_threshold, bool p_using_shadows = true, const Transform *p_render_transform = nullptr, const CameraMatrix *p_render_projection = nullptr);
 	void render_empty_scene(RID p_render_buffers, RID p_scenario, RID p_shadow_atlas);
 
 	void render_camera(RID p_render_buffers, RID p_camera, RID p_scenario, Size2 p_viewport_size, float p_screen_lod_threshold, RID p_shadow_atlas);
@@ -944,6 +1073,9 @@ public:
 	void render_particle_colliders();
 	virtual void render_probes();
 
+	virtual int get_occlusion_culled_instance_count() const;
+	virtual uint64_t get_shadow_memory_usage() const;
+
 	TypedArray<Image> bake_render_uv2(RID p_base, const Vector<RID> &p_material_overrides, const Size2i &p_image_size);
 
 	//pass to scene render
@@ -1046,6 +1178,10 @@ public:
 
 	PASS1(set_debug_draw_mode, RS::ViewportDebugDraw)
 
+	virtual void set_physics_interpolation_enabled(bool p_enabled);
+	virtual void tick();
+	virtual void update_interpolation_frame(float p_fraction);
+
 	virtual void update();
 
 	bool free(RID p_rid);
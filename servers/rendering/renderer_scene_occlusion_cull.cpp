@@ -0,0 +1,275 @@
+/*************************************************************************/
+/*  renderer_scene_occlusion_cull.cpp                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "renderer_scene_occlusion_cull.h"
+
+void RendererSceneOcclusionCull::begin(const CameraMatrix &p_projection, const Transform &p_cam_transform, uint32_t p_width) {
+	active = false;
+	triangles_drawn = 0;
+	mip_count = 0;
+
+	real_t aspect = p_projection.get_aspect();
+	if (p_width == 0 || !(aspect > CMP_EPSILON)) {
+		return;
+	}
+
+	uint32_t height = MAX(1u, uint32_t(p_width / aspect));
+
+	view_projection = p_projection * CameraMatrix(p_cam_transform.affine_inverse());
+
+	Mip &base = mips[0];
+	base.width = p_width;
+	base.height = height;
+	base.depth.resize(p_width * height);
+	float *depth = base.depth.ptr();
+	for (uint32_t i = 0; i < base.depth.size(); i++) {
+		depth[i] = 1.0;
+	}
+
+	mip_count = 1;
+	active = true;
+}
+
+void RendererSceneOcclusionCull::_rasterize_clipped_triangle(const ClipVertex &p_a, const ClipVertex &p_b, const ClipVertex &p_c) {
+	const ClipVertex *verts[3] = { &p_a, &p_b, &p_c };
+	Mip &base = mips[0];
+
+	real_t sx[3], sy[3], sz[3];
+	for (int i = 0; i < 3; i++) {
+		if (verts[i]->w < CMP_EPSILON) {
+			return;
+		}
+		real_t inv_w = 1.0 / verts[i]->w;
+		sx[i] = (verts[i]->x * inv_w * 0.5 + 0.5) * base.width;
+		sy[i] = (0.5 - verts[i]->y * inv_w * 0.5) * base.height;
+		sz[i] = CLAMP(verts[i]->z * inv_w * 0.5 + 0.5, 0.0, 1.0);
+	}
+
+	real_t area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sy[1] - sy[0]) * (sx[2] - sx[0]);
+	if (Math::abs(area) < CMP_EPSILON) {
+		return;
+	}
+	real_t inv_area = 1.0 / area;
+
+	int from_x = MAX(0, int(Math::floor(MIN(sx[0], MIN(sx[1], sx[2])))));
+	int to_x = MIN(int(base.width) - 1, int(Math::ceil(MAX(sx[0], MAX(sx[1], sx[2])))));
+	int from_y = MAX(0, int(Math::floor(MIN(sy[0], MIN(sy[1], sy[2])))));
+	int to_y = MIN(int(base.height) - 1, int(Math::ceil(MAX(sy[0], MAX(sy[1], sy[2])))));
+
+	if (from_x > to_x || from_y > to_y) {
+		return;
+	}
+
+	// Barycentric coordinates are affine in screen space, so they are stepped incrementally.
+	// Dividing by the signed area makes the inside test independent of the triangle winding.
+	real_t l0_dx = (sy[1] - sy[2]) * inv_area;
+	real_t l0_dy = (sx[2] - sx[1]) * inv_area;
+	real_t l1_dx = (sy[2] - sy[0]) * inv_area;
+	real_t l1_dy = (sx[0] - sx[2]) * inv_area;
+
+	real_t start_x = from_x + 0.5;
+	real_t start_y = from_y + 0.5;
+	real_t l0_row = ((sx[2] - sx[1]) * (start_y - sy[1]) - (sy[2] - sy[1]) * (start_x - sx[1])) * inv_area;
+	real_t l1_row = ((sx[0] - sx[2]) * (start_y - sy[2]) - (sy[0] - sy[2]) * (start_x - sx[2])) * inv_area;
+
+	float *depth = base.depth.ptr();
+
+	for (int y = from_y; y <= to_y; y++) {
+		real_t l0 = l0_row;
+		real_t l1 = l1_row;
+		float *row = &depth[y * base.width];
+
+		for (int x = from_x; x <= to_x; x++) {
+			real_t l2 = 1.0 - l0 - l1;
+			if (l0 >= 0.0 && l1 >= 0.0 && l2 >= 0.0) {
+				float z = l0 * sz[0] + l1 * sz[1] + l2 * sz[2];
+				if (z < row[x]) {
+					row[x] = z;
+				}
+			}
+			l0 += l0_dx;
+			l1 += l1_dx;
+		}
+
+		l0_row += l0_dy;
+		l1_row += l1_dy;
+	}
+
+	triangles_drawn++;
+}
+
+void RendererSceneOcclusionCull::_rasterize_triangle(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c) {
+	ClipVertex in[3] = { _to_clip(p_a), _to_clip(p_b), _to_clip(p_c) };
+
+	// Clip against the near plane (z >= -w), which can turn the triangle into a quad.
+	ClipVertex out[4];
+	uint32_t out_count = 0;
+
+	for (int i = 0; i < 3; i++) {
+		const ClipVertex &cur = in[i];
+		const ClipVertex &next = in[(i + 1) % 3];
+		real_t d_cur = cur.z + cur.w;
+		real_t d_next = next.z + next.w;
+
+		if (d_cur >= 0.0) {
+			out[out_count++] = cur;
+		}
+		if ((d_cur >= 0.0) != (d_next >= 0.0)) {
+			real_t t = d_cur / (d_cur - d_next);
+			ClipVertex v;
+			v.x = cur.x + (next.x - cur.x) * t;
+			v.y = cur.y + (next.y - cur.y) * t;
+			v.z = cur.z + (next.z - cur.z) * t;
+			v.w = cur.w + (next.w - cur.w) * t;
+			out[out_count++] = v;
+		}
+	}
+
+	for (uint32_t i = 2; i < out_count; i++) {
+		_rasterize_clipped_triangle(out[0], out[i - 1], out[i]);
+	}
+}
+
+void RendererSceneOcclusionCull::add_occluder(const Transform &p_transform, const Vector3 *p_vertices, const int *p_indices, uint32_t p_index_count) {
+	ERR_FAIL_COND(!active);
+
+	for (uint32_t i = 0; i + 2 < p_index_count; i += 3) {
+		_rasterize_triangle(p_transform.xform(p_vertices[p_indices[i + 0]]), p_transform.xform(p_vertices[p_indices[i + 1]]), p_transform.xform(p_vertices[p_indices[i + 2]]));
+	}
+}
+
+void RendererSceneOcclusionCull::end() {
+	if (!active) {
+		return;
+	}
+
+	if (triangles_drawn == 0) {
+		// Nothing can be occluded.
+		active = false;
+		return;
+	}
+
+	// Each texel of a mip holds the farthest depth of the texels it covers in the previous one.
+	while (mip_count < MAX_MIPS) {
+		const Mip &src = mips[mip_count - 1];
+		if (src.width == 1 && src.height == 1) {
+			break;
+		}
+
+		Mip &dst = mips[mip_count];
+		dst.width = (src.width + 1) / 2;
+		dst.height = (src.height + 1) / 2;
+		dst.depth.resize(dst.width * dst.height);
+
+		const float *src_depth = src.depth.ptr();
+		float *dst_depth = dst.depth.ptr();
+
+		for (uint32_t y = 0; y < dst.height; y++) {
+			uint32_t y0 = y * 2;
+			uint32_t y1 = MIN(y0 + 1, src.height - 1);
+			for (uint32_t x = 0; x < dst.width; x++) {
+				uint32_t x0 = x * 2;
+				uint32_t x1 = MIN(x0 + 1, src.width - 1);
+				float d = MAX(MAX(src_depth[y0 * src.width + x0], src_depth[y0 * src.width + x1]), MAX(src_depth[y1 * src.width + x0], src_depth[y1 * src.width + x1]));
+				dst_depth[y * dst.width + x] = d;
+			}
+		}
+
+		mip_count++;
+	}
+}
+
+bool RendererSceneOcclusionCull::is_occluded(const AABB &p_aabb) const {
+	if (!active) {
+		return false;
+	}
+
+	real_t min_x = 1e20, min_y = 1e20, min_z = 1e20;
+	real_t max_x = -1e20, max_y = -1e20;
+
+	for (int i = 0; i < 8; i++) {
+		ClipVertex v = _to_clip(p_aabb.get_endpoint(i));
+		if (v.w < CMP_EPSILON || v.z < -v.w) {
+			// Crosses the near plane, consider it visible.
+			return false;
+		}
+		real_t inv_w = 1.0 / v.w;
+		real_t x = v.x * inv_w;
+		real_t y = v.y * inv_w;
+		real_t z = v.z * inv_w;
+		min_x = MIN(min_x, x);
+		max_x = MAX(max_x, x);
+		min_y = MIN(min_y, y);
+		max_y = MAX(max_y, y);
+		min_z = MIN(min_z, z);
+	}
+
+	const Mip &base = mips[0];
+
+	int from_x = MAX(0, int(Math::floor((min_x * 0.5 + 0.5) * base.width)));
+	int to_x = MIN(int(base.width) - 1, int(Math::floor((max_x * 0.5 + 0.5) * base.width)));
+	int from_y = MAX(0, int(Math::floor((0.5 - max_y * 0.5) * base.height)));
+	int to_y = MIN(int(base.height) - 1, int(Math::floor((0.5 - min_y * 0.5) * base.height)));
+
+	if (from_x > to_x || from_y > to_y) {
+		return false;
+	}
+
+	float depth = min_z * 0.5 + 0.5;
+
+	// Pick the first mip where the bounds cover only a few texels.
+	uint32_t level = 0;
+	while (level + 1 < mip_count && (((to_x >> level) - (from_x >> level)) > 3 || ((to_y >> level) - (from_y >> level)) > 3)) {
+		level++;
+	}
+
+	const Mip &mip = mips[level];
+	const float *mip_depth = mip.depth.ptr();
+
+	for (int y = from_y >> level; y <= (to_y >> level); y++) {
+		for (int x = from_x >> level; x <= (to_x >> level); x++) {
+			if (mip_depth[y * mip.width + x] >= depth) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void RendererSceneOcclusionCull::clear() {
+	for (uint32_t i = 0; i < MAX_MIPS; i++) {
+		mips[i].depth.reset();
+		mips[i].width = 0;
+		mips[i].height = 0;
+	}
+	mip_count = 0;
+	active = false;
+}
@@ -0,0 +1,92 @@
+/*************************************************************************/
+/*  renderer_scene_occlusion_cull.h                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef RENDERER_SCENE_OCCLUSION_CULL_H
+#define RENDERER_SCENE_OCCLUSION_CULL_H
+
+#include "core/math/camera_matrix.h"
+#include "core/math/transform.h"
+#include "core/templates/local_vector.h"
+
+// Small software rasterized depth buffer used to reject instances hidden behind occluders.
+// Occluders are rasterized at low resolution, then a pyramid holding the farthest depth of
+// each region is built so instance bounds can be tested against a handful of texels.
+class RendererSceneOcclusionCull {
+public:
+	enum {
+		MAX_MIPS = 12,
+	};
+
+private:
+	struct Mip {
+		uint32_t width = 0;
+		uint32_t height = 0;
+		LocalVector<float> depth;
+	};
+
+	Mip mips[MAX_MIPS];
+	uint32_t mip_count = 0;
+
+	CameraMatrix view_projection;
+	bool active = false;
+	uint32_t triangles_drawn = 0;
+
+	struct ClipVertex {
+		real_t x, y, z, w;
+	};
+
+	_FORCE_INLINE_ ClipVertex _to_clip(const Vector3 &p_point) const {
+		const real_t(&m)[4][4] = view_projection.matrix;
+		ClipVertex v;
+		v.x = m[0][0] * p_point.x + m[1][0] * p_point.y + m[2][0] * p_point.z + m[3][0];
+		v.y = m[0][1] * p_point.x + m[1][1] * p_point.y + m[2][1] * p_point.z + m[3][1];
+		v.z = m[0][2] * p_point.x + m[1][2] * p_point.y + m[2][2] * p_point.z + m[3][2];
+		v.w = m[0][3] * p_point.x + m[1][3] * p_point.y + m[2][3] * p_point.z + m[3][3];
+		return v;
+	}
+
+	void _rasterize_clipped_triangle(const ClipVertex &p_a, const ClipVertex &p_b, const ClipVertex &p_c);
+	void _rasterize_triangle(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c);
+
+public:
+	void begin(const CameraMatrix &p_projection, const Transform &p_cam_transform, uint32_t p_width);
+	void add_occluder(const Transform &p_transform, const Vector3 *p_vertices, const int *p_indices, uint32_t p_index_count);
+	void end();
+
+	_FORCE_INLINE_ bool is_active() const { return active; }
+	_FORCE_INLINE_ uint32_t get_triangles_drawn() const { return triangles_drawn; }
+
+	// Returns true only if the whole AABB lies behind occluders. Safe to call from multiple threads.
+	bool is_occluded(const AABB &p_aabb) const;
+
+	void clear();
+};
+
+#endif // RENDERER_SCENE_OCCLUSION_CULL_H
@@ -39,7 +39,8 @@ class RendererSceneRender {
 public:
 	enum {
 		MAX_DIRECTIONAL_LIGHTS = 8,
-		MAX_DIRECTIONAL_LIGHT_CASCADES = 4
+		MAX_DIRECTIONAL_LIGHT_CASCADES = 4,
+		DIRECTIONAL_SHADOW_CLIPMAP_PAGES = 8 // Pages per side of each clipmap level, so a level's pages fit in 64 bits.
 	};
 
 	struct GeometryInstance {
@@ -79,6 +80,8 @@ public:
 	virtual void directional_shadow_atlas_set_size(int p_size, bool p_16_bits = false) = 0;
 	virtual int get_directional_light_shadow_size(RID p_light_intance) = 0;
 	virtual void set_directional_shadow_count(int p_count) = 0;
+	virtual uint64_t get_directional_shadow_version() const = 0; // Changes when cached directional shadows are lost.
+	virtual uint64_t get_shadow_memory_usage() const = 0;
 
 	/* SDFGI UPDATE */
 
@@ -198,6 +201,14 @@ public:
 		RID light;
 		int pass = 0;
 		PagedArray<GeometryInstance *> instances;
+		// With a static cache, instances only holds the dynamic casters, drawn over a copy of the cache.
+		PagedArray<GeometryInstance *> static_instances;
+		bool use_static_cache = false;
+		bool update_static_cache = false; // Redraw the cache from static_instances first.
+		// Clipmap directional shadows only redraw these pages of the cascade (all of it if empty),
+		// after moving the cached pages by clipmap_scroll.
+		Rect2i clipmap_pages;
+		Vector2i clipmap_scroll;
 	};
 
 	struct RenderSDFGIData {
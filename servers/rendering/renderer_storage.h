@@ -521,11 +521,13 @@ public:
 	virtual RID particles_get_draw_pass_mesh(RID p_particles, int p_pass) const = 0;
 
 	virtual void particles_set_view_axis(RID p_particles, const Vector3 &p_axis) = 0;
+	virtual void particles_set_view_screen_size(RID p_particles, float p_size) = 0;
 
 	virtual void particles_add_collision(RID p_particles, RID p_particles_collision_instance) = 0;
 	virtual void particles_remove_collision(RID p_particles, RID p_particles_collision_instance) = 0;
 
 	virtual void update_particles() = 0;
+	virtual void update_particles_sort() = 0;
 
 	/* PARTICLES COLLISION */
 
@@ -608,7 +610,7 @@ public:
 	virtual void render_info_end_capture() = 0;
 	virtual int get_captured_render_info(RS::RenderInfo p_info) = 0;
 
-	virtual int get_render_info(RS::RenderInfo p_info) = 0;
+	virtual uint64_t get_render_info(RS::RenderInfo p_info) = 0;
 	virtual String get_video_adapter_name() const = 0;
 	virtual String get_video_adapter_vendor() const = 0;
 
@@ -31,6 +31,7 @@
 #include "renderer_viewport.h"
 
 #include "core/config/project_settings.h"
+#include "core/templates/frame_arena.h"
 #include "renderer_canvas_cull.h"
 #include "renderer_scene_cull.h"
 #include "rendering_server_globals.h"
@@ -71,6 +72,64 @@ static Transform2D _canvas_get_transform(RendererViewport::Viewport *p_viewport,
 	return xf;
 }
 
+const float RendererViewport::DYNAMIC_RESOLUTION_SCALE_STEP = 0.05;
+const float RendererViewport::DYNAMIC_RESOLUTION_MAX_SCALE_CHANGE = 0.15;
+
+Size2i RendererViewport::_get_render_buffers_size(const Viewport *p_viewport) const {
+	if (!p_viewport->dynamic_resolution.enabled) {
+		return p_viewport->size;
+	}
+	float scale = p_viewport->dynamic_resolution.scale;
+	return Size2i(MAX(1, int(p_viewport->size.width * scale)), MAX(1, int(p_viewport->size.height * scale)));
+}
+
+void RendererViewport::_configure_render_buffers(Viewport *p_viewport) {
+	Size2i size = _get_render_buffers_size(p_viewport);
+	RSG::scene->render_buffers_configure(p_viewport->render_buffers, p_viewport->render_target, size.width, size.height, p_viewport->msaa, p_viewport->screen_space_aa, p_viewport->use_debanding);
+}
+
+void RendererViewport::_update_dynamic_resolution(Viewport *p_viewport) {
+	Viewport::DynamicResolution &dr = p_viewport->dynamic_resolution;
+	if (!dr.enabled) {
+		return;
+	}
+
+	bool new_sample = p_viewport->time_gpu_begin != dr.last_gpu_begin && p_viewport->time_gpu_end > p_viewport->time_gpu_begin;
+	dr.last_gpu_begin = p_viewport->time_gpu_begin;
+
+	if (dr.cooldown > 0) {
+		//samples may still come from before the last resize
+		dr.cooldown--;
+		return;
+	}
+
+	if (!new_sample) {
+		return;
+	}
+
+	float time = double((p_viewport->time_gpu_end - p_viewport->time_gpu_begin) / 1000) / 1000.0;
+	dr.gpu_time = dr.gpu_time > 0.0 ? Math::lerp(dr.gpu_time, time, 0.2f) : time;
+
+	//hysteresis, only resize when over budget or clearly under it
+	if (dr.gpu_time < dr.target_frame_time && (dr.gpu_time > dr.target_frame_time * 0.75 || dr.scale >= 1.0)) {
+		return;
+	}
+
+	//cost is roughly proportional to the pixel count, aim slightly under the target
+	float scale = dr.scale * Math::sqrt(dr.target_frame_time * 0.9 / dr.gpu_time);
+	scale = CLAMP(scale, dr.scale - DYNAMIC_RESOLUTION_MAX_SCALE_CHANGE, dr.scale + DYNAMIC_RESOLUTION_MAX_SCALE_CHANGE);
+	scale = CLAMP(Math::snapped(scale, DYNAMIC_RESOLUTION_SCALE_STEP), dr.min_scale, 1.0);
+
+	if (Math::is_equal_approx(scale, dr.scale)) {
+		return;
+	}
+
+	dr.scale = scale;
+	dr.gpu_time = 0.0;
+	dr.cooldown = DYNAMIC_RESOLUTION_COOLDOWN_FRAMES;
+	_configure_render_buffers(p_viewport);
+}
+
 void RendererViewport::_draw_3d(Viewport *p_viewport, XRInterface::Eyes p_eye) {
 	RENDER_TIMESTAMP(">Begin Rendering 3D Scene");
 
@@ -89,7 +148,7 @@ void RendererViewport::_draw_3d(Viewport *p_viewport, XRInterface::Eyes p_eye) {
 }
 
 void RendererViewport::_draw_viewport(Viewport *p_viewport, XRInterface::Eyes p_eye) {
-	if (p_viewport->measure_render_time) {
+	if (p_viewport->measure_render_time || p_viewport->dynamic_resolution.enabled) {
 		String rt_id = "vp_begin_" + itos(p_viewport->self.get_id());
 		RSG::storage->capture_timestamp(rt_id);
 		timestamp_vp_map[rt_id] = p_viewport->self;
@@ -124,7 +183,9 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport, XRInterface::Eyes p_
 	if ((scenario_draw_canvas_bg || can_draw_3d) && !p_viewport->render_buffers.is_valid()) {
 		//wants to draw 3D but there is no render buffer, create
 		p_viewport->render_buffers = RSG::scene->render_buffers_create();
-		RSG::scene->render_buffers_configure(p_viewport->render_buffers, p_viewport->render_target, p_viewport->size.width, p_viewport->size.height, p_viewport->msaa, p_viewport->screen_space_aa, p_viewport->use_debanding);
+		_configure_render_buffers(p_viewport);
+	} else if (p_viewport->render_buffers.is_valid()) {
+		_update_dynamic_resolution(p_viewport);
 	}
 
 	RSG::storage->render_target_request_clear(p_viewport->render_target, bgcolor);
@@ -136,7 +197,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport, XRInterface::Eyes p_
 	if (!p_viewport->hide_canvas) {
 		int i = 0;
 
-		Map<Viewport::CanvasKey, Viewport::CanvasData *> canvas_map;
+		Map<Viewport::CanvasKey, Viewport::CanvasData *, Comparator<Viewport::CanvasKey>, FrameArenaAllocator> canvas_map;
 
 		Rect2 clip_rect(0, 0, p_viewport->size.x, p_viewport->size.y);
 		RendererCanvasRender::Light *lights = nullptr;
@@ -379,7 +440,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport, XRInterface::Eyes p_
 			scenario_draw_canvas_bg = false;
 		}
 
-		for (Map<Viewport::CanvasKey, Viewport::CanvasData *>::Element *E = canvas_map.front(); E; E = E->next()) {
+		for (Map<Viewport::CanvasKey, Viewport::CanvasData *, Comparator<Viewport::CanvasKey>, FrameArenaAllocator>::Element *E = canvas_map.front(); E; E = E->next()) {
 			RendererCanvasCull::Canvas *canvas = static_cast<RendererCanvasCull::Canvas *>(E->get()->canvas);
 
 			Transform2D xform = _canvas_get_transform(p_viewport, canvas, E->get(), clip_rect.size);
@@ -436,7 +497,7 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport, XRInterface::Eyes p_
 		RSG::storage->render_target_do_clear_request(p_viewport->render_target);
 	}
 
-	if (p_viewport->measure_render_time) {
+	if (p_viewport->measure_render_time || p_viewport->dynamic_resolution.enabled) {
 		String rt_id = "vp_end_" + itos(p_viewport->self.get_id());
 		RSG::storage->capture_timestamp(rt_id);
 		timestamp_vp_map[rt_id] = p_viewport->self;
@@ -463,7 +524,7 @@ void RendererViewport::draw_viewports() {
 	//sort viewports
 	active_viewports.sort_custom<ViewportSort>();
 
-	Map<DisplayServer::WindowID, Vector<RendererCompositor::BlitToScreen>> blit_to_screen_list;
+	Map<DisplayServer::WindowID, Vector<RendererCompositor::BlitToScreen>, Comparator<DisplayServer::WindowID>, FrameArenaAllocator> blit_to_screen_list;
 	//draw viewports
 	RENDER_TIMESTAMP(">Render Viewports");
 
@@ -603,7 +664,7 @@ void RendererViewport::draw_viewports() {
 	//this needs to be called to make screen swapping more efficient
 	RSG::rasterizer->prepare_for_blitting_render_targets();
 
-	for (Map<int, Vector<RendererCompositor::BlitToScreen>>::Element *E = blit_to_screen_list.front(); E; E = E->next()) {
+	for (Map<DisplayServer::WindowID, Vector<RendererCompositor::BlitToScreen>, Comparator<DisplayServer::WindowID>, FrameArenaAllocator>::Element *E = blit_to_screen_list.front(); E; E = E->next()) {
 		RSG::rasterizer->blit_render_targets_to_screen(E->key(), E->get().ptr(), E->get().size());
 	}
 }
@@ -644,7 +705,7 @@ void RendererViewport::viewport_set_size(RID p_viewport, int p_width, int p_heig
 			RSG::scene->free(viewport->render_buffers);
 			viewport->render_buffers = RID();
 		} else {
-			RSG::scene->render_buffers_configure(viewport->render_buffers, viewport->render_target, viewport->size.width, viewport->size.height, viewport->msaa, viewport->screen_space_aa, viewport->use_debanding);
+			_configure_render_buffers(viewport);
 		}
 	}
 }
@@ -858,7 +919,7 @@ void RendererViewport::viewport_set_msaa(RID p_viewport, RS::ViewportMSAA p_msaa
 	}
 	viewport->msaa = p_msaa;
 	if (viewport->render_buffers.is_valid()) {
-		RSG::scene->render_buffers_configure(viewport->render_buffers, viewport->render_target, viewport->size.width, viewport->size.height, p_msaa, viewport->screen_space_aa, viewport->use_debanding);
+		_configure_render_buffers(viewport);
 	}
 }
 
@@ -871,7 +932,7 @@ void RendererViewport::viewport_set_screen_space_aa(RID p_viewport, RS::Viewport
 	}
 	viewport->screen_space_aa = p_mode;
 	if (viewport->render_buffers.is_valid()) {
-		RSG::scene->render_buffers_configure(viewport->render_buffers, viewport->render_target, viewport->size.width, viewport->size.height, viewport->msaa, p_mode, viewport->use_debanding);
+		_configure_render_buffers(viewport);
 	}
 }
 
@@ -884,7 +945,7 @@ void RendererViewport::viewport_set_use_debanding(RID p_viewport, bool p_use_deb
 	}
 	viewport->use_debanding = p_use_debanding;
 	if (viewport->render_buffers.is_valid()) {
-		RSG::scene->render_buffers_configure(viewport->render_buffers, viewport->render_target, viewport->size.width, viewport->size.height, viewport->msaa, viewport->screen_space_aa, p_use_debanding);
+		_configure_render_buffers(viewport);
 	}
 }
 
@@ -895,6 +956,28 @@ void RendererViewport::viewport_set_lod_threshold(RID p_viewport, float p_pixels
 	viewport->lod_threshold = p_pixels;
 }
 
+void RendererViewport::viewport_set_dynamic_resolution(RID p_viewport, bool p_enable, float p_target_fps, float p_min_scale) {
+	ERR_FAIL_COND(p_target_fps <= 0.0);
+	Viewport *viewport = viewport_owner.getornull(p_viewport);
+	ERR_FAIL_COND(!viewport);
+
+	Viewport::DynamicResolution &dr = viewport->dynamic_resolution;
+	dr.target_frame_time = 1000.0 / p_target_fps;
+	dr.min_scale = CLAMP(p_min_scale, 0.1, 1.0);
+
+	if (dr.enabled == p_enable && dr.scale >= dr.min_scale) {
+		return;
+	}
+
+	dr.enabled = p_enable;
+	dr.scale = p_enable ? MAX(dr.scale, dr.min_scale) : 1.0;
+	dr.gpu_time = 0.0;
+	dr.cooldown = 0;
+	if (viewport->render_buffers.is_valid()) {
+		_configure_render_buffers(viewport);
+	}
+}
+
 int RendererViewport::viewport_get_render_info(RID p_viewport, RS::ViewportRenderInfo p_info) {
 	ERR_FAIL_INDEX_V(p_info, RS::VIEWPORT_RENDER_INFO_MAX, -1);
 
@@ -87,6 +87,16 @@ public:
 
 		float lod_threshold = 1.0;
 
+		struct DynamicResolution {
+			bool enabled = false;
+			float target_frame_time = 1000.0 / 60.0; // In milliseconds.
+			float min_scale = 0.5;
+			float scale = 1.0;
+			float gpu_time = 0.0; // Smoothed measured GPU time, in milliseconds.
+			uint64_t last_gpu_begin = 0;
+			int cooldown = 0;
+		} dynamic_resolution;
+
 		uint64_t last_pass = 0;
 
 		int render_info[RS::VIEWPORT_RENDER_INFO_MAX];
@@ -182,6 +192,17 @@ public:
 	Vector<Viewport *> active_viewports;
 
 private:
+	enum {
+		DYNAMIC_RESOLUTION_COOLDOWN_FRAMES = 8, // Timestamps arrive a few frames late, ignore them for a while after resizing.
+	};
+
+	static const float DYNAMIC_RESOLUTION_SCALE_STEP;
+	static const float DYNAMIC_RESOLUTION_MAX_SCALE_CHANGE;
+
+	Size2i _get_render_buffers_size(const Viewport *p_viewport) const;
+	void _configure_render_buffers(Viewport *p_viewport);
+	void _update_dynamic_resolution(Viewport *p_viewport);
+
 	void _draw_3d(Viewport *p_viewport, XRInterface::Eyes p_eye);
 	void _draw_viewport(Viewport *p_viewport, XRInterface::Eyes p_eye = XRInterface::EYE_MONO);
 
@@ -227,6 +248,7 @@ public:
 	void viewport_set_use_debanding(RID p_viewport, bool p_use_debanding);
 
 	void viewport_set_lod_threshold(RID p_viewport, float p_pixels);
+	void viewport_set_dynamic_resolution(RID p_viewport, bool p_enable, float p_target_fps, float p_min_scale);
 
 	virtual int viewport_get_render_info(RID p_viewport, RS::ViewportRenderInfo p_info);
 	virtual void viewport_set_debug_draw(RID p_viewport, RS::ViewportDebugDraw p_draw);
@@ -72,10 +72,12 @@ public:
 
 	typedef Vector<uint8_t> (*ShaderCompileFunction)(ShaderStage p_stage, const String &p_source_code, ShaderLanguage p_language, String *r_error);
 	typedef Vector<uint8_t> (*ShaderCacheFunction)(ShaderStage p_stage, const String &p_source_code, ShaderLanguage p_language);
+	typedef void (*ShaderCacheStoreFunction)(ShaderStage p_stage, const String &p_source_code, ShaderLanguage p_language, const Vector<uint8_t> &p_spirv);
 
 private:
 	static ShaderCompileFunction compile_function;
 	static ShaderCacheFunction cache_function;
+	static ShaderCacheStoreFunction cache_store_function;
 
 	static RenderingDevice *singleton;
 
@@ -439,6 +441,7 @@ public:
 	};
 
 	virtual RID texture_create(const TextureFormat &p_format, const TextureView &p_view, const Vector<Vector<uint8_t>> &p_data = Vector<Vector<uint8_t>>()) = 0;
+	virtual RID texture_create_async(const TextureFormat &p_format, const TextureView &p_view, const Vector<Vector<uint8_t>> &p_data) = 0; // Data is uploaded on the transfer queue, see ASYNC UPLOAD.
 	virtual RID texture_create_shared(const TextureView &p_view, RID p_with_texture) = 0;
 
 	enum TextureSliceType {
@@ -601,6 +604,7 @@ public:
 
 	static void shader_set_compile_function(ShaderCompileFunction p_function);
 	static void shader_set_cache_function(ShaderCacheFunction p_function);
+	static void shader_set_cache_store_function(ShaderCacheStoreFunction p_function);
 
 	struct ShaderStageData {
 		ShaderStage shader_stage;
@@ -634,7 +638,8 @@ public:
 	};
 
 	enum StorageBufferUsage {
-		STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT = 1
+		STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT = 1, // Also allows using the buffer for indirect draws.
+		STORAGE_BUFFER_USAGE_PERSISTENT_MAPPED = 2, // Host visible and written directly, updates at offset 0 discard the contents. Uniform sets must be created after updating.
 	};
 
 	virtual RID uniform_buffer_create(uint32_t p_size_bytes, const Vector<uint8_t> &p_data = Vector<uint8_t>()) = 0;
@@ -662,6 +667,7 @@ public:
 	virtual bool uniform_set_is_valid(RID p_uniform_set) = 0;
 
 	virtual Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, uint32_t p_post_barrier = BARRIER_MASK_ALL) = 0;
+	virtual Error buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data) = 0; // Meant to fill new buffers, see ASYNC UPLOAD.
 	virtual Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, uint32_t p_post_barrier = BARRIER_MASK_ALL) = 0;
 	virtual Vector<uint8_t> buffer_get_data(RID p_buffer) = 0; //this causes stall, only use to retrieve large buffers for saving
 
@@ -920,14 +926,33 @@ public:
 		DYNAMIC_STATE_STENCIL_REFERENCE = (1 << 6),
 	};
 
+	enum PipelineSpecializationConstantType {
+		PIPELINE_SPECIALIZATION_CONSTANT_TYPE_BOOL,
+		PIPELINE_SPECIALIZATION_CONSTANT_TYPE_INT,
+		PIPELINE_SPECIALIZATION_CONSTANT_TYPE_FLOAT,
+	};
+
+	// Value for a `layout(constant_id = N) const` in the shader. A shader can be compiled once and
+	// specialized per pipeline, instead of compiling a variant for every combination of features.
+	// Constants the shader doesn't declare are ignored.
+	struct PipelineSpecializationConstant {
+		PipelineSpecializationConstantType type = PIPELINE_SPECIALIZATION_CONSTANT_TYPE_BOOL;
+		uint32_t constant_id = 0;
+		union {
+			uint32_t int_value = 0;
+			float float_value;
+			bool bool_value;
+		};
+	};
+
 	virtual bool render_pipeline_is_valid(RID p_pipeline) = 0;
-	virtual RID render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, int p_dynamic_state_flags = 0) = 0;
+	virtual RID render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, int p_dynamic_state_flags = 0, const Vector<PipelineSpecializationConstant> &p_specialization_constants = Vector<PipelineSpecializationConstant>()) = 0;
 
 	/**************************/
 	/**** COMPUTE PIPELINE ****/
 	/**************************/
 
-	virtual RID compute_pipeline_create(RID p_shader) = 0;
+	virtual RID compute_pipeline_create(RID p_shader, const Vector<PipelineSpecializationConstant> &p_specialization_constants = Vector<PipelineSpecializationConstant>()) = 0;
 	virtual bool compute_pipeline_is_valid(RID p_pipeline) = 0;
 
 	/****************/
@@ -936,6 +961,8 @@ public:
 
 	virtual int screen_get_width(DisplayServer::WindowID p_screen = 0) const = 0;
 	virtual int screen_get_height(DisplayServer::WindowID p_screen = 0) const = 0;
+	// Degrees the screen contents must be rotated by. The screen width and height are in the display's native orientation.
+	virtual int screen_get_pre_rotation(DisplayServer::WindowID p_screen = 0) const = 0;
 	virtual FramebufferFormatID screen_get_framebuffer_format() const = 0;
 
 	/********************/
@@ -973,6 +1000,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size) = 0;
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0) = 0;
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0) = 0;
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) = 0;
 	virtual void draw_list_disable_scissor(DrawListID p_list) = 0;
@@ -985,7 +1013,7 @@ public:
 
 	typedef int64_t ComputeListID;
 
-	virtual ComputeListID compute_list_begin(bool p_allow_draw_overlap = false) = 0;
+	virtual ComputeListID compute_list_begin(bool p_allow_draw_overlap = false, bool p_async = false) = 0;
 	virtual void compute_list_bind_compute_pipeline(ComputeListID p_list, RID p_compute_pipeline) = 0;
 	virtual void compute_list_bind_uniform_set(ComputeListID p_list, RID p_uniform_set, uint32_t p_index) = 0;
 	virtual void compute_list_set_push_constant(ComputeListID p_list, const void *p_data, uint32_t p_data_size) = 0;
@@ -999,6 +1027,30 @@ public:
 	virtual void barrier(uint32_t p_from = BARRIER_MASK_ALL, uint32_t p_to = BARRIER_MASK_ALL) = 0;
 	virtual void full_barrier() = 0;
 
+	/***********************/
+	/**** ASYNC COMPUTE ****/
+	/***********************/
+
+	// Async compute lists (compute_list_begin with p_async) begun between a fork and a join run on a
+	// separate compute queue, at the same time as the draw work recorded between them. Work recorded
+	// before the fork is visible to them, and work recorded after the join waits for them.
+	// Only one fork per frame is supported, async_compute_fork() returns false if it can't be used.
+	virtual bool has_async_compute() const = 0;
+	virtual bool async_compute_fork() = 0;
+	virtual void async_compute_join() = 0;
+
+	/**********************/
+	/**** ASYNC UPLOAD ****/
+	/**********************/
+
+	// texture_create_async() and buffer_update_async() copy their data on a transfer only queue when the
+	// device has one, instead of the setup command buffer of the frame. They return right away, frames
+	// submitted afterwards wait for the copy on the GPU. Any thread can check or wait for the uploads of
+	// a resource. Without a transfer queue they behave like texture_create() and creation time data.
+	virtual bool has_async_upload() const = 0;
+	virtual bool upload_is_finished(RID p_resource) = 0;
+	virtual void upload_wait(RID p_resource) = 0;
+
 	/***************/
 	/**** FREE! ****/
 	/***************/
@@ -1056,6 +1108,7 @@ public:
 		LIMIT_MAX_COMPUTE_WORKGROUP_SIZE_X,
 		LIMIT_MAX_COMPUTE_WORKGROUP_SIZE_Y,
 		LIMIT_MAX_COMPUTE_WORKGROUP_SIZE_Z,
+		LIMIT_MAX_DRAW_INDIRECT_COUNT,
 	};
 
 	virtual int limit_get(Limit p_limit) = 0;
@@ -1070,7 +1123,15 @@ public:
 	virtual void submit() = 0;
 	virtual void sync() = 0;
 
-	virtual uint64_t get_memory_usage() const = 0;
+	enum MemoryType {
+		MEMORY_TEXTURES, // Sampled only textures, i.e. assets.
+		MEMORY_RENDER_TEXTURES, // Textures usable as attachments or storage.
+		MEMORY_BUFFERS,
+		MEMORY_TOTAL, // Everything allocated, staging memory included.
+	};
+
+	virtual uint64_t get_memory_usage(MemoryType p_type) const = 0;
+	virtual uint64_t get_memory_budget() const = 0; // Device local memory available to the process, zero if unknown.
 
 	virtual RenderingDevice *create_local_device() = 0;
 
@@ -1090,6 +1151,7 @@ public:
 protected:
 	//binders to script API
 	RID _texture_create(const Ref<RDTextureFormat> &p_format, const Ref<RDTextureView> &p_view, const TypedArray<PackedByteArray> &p_data = Array());
+	RID _texture_create_async(const Ref<RDTextureFormat> &p_format, const Ref<RDTextureView> &p_view, const TypedArray<PackedByteArray> &p_data);
 	RID _texture_create_shared(const Ref<RDTextureView> &p_view, RID p_with_texture);
 	RID _texture_create_shared_from_slice(const Ref<RDTextureView> &p_view, RID p_with_texture, uint32_t p_layer, uint32_t p_mipmap, TextureSliceType p_slice_type = TEXTURE_SLICE_2D);
 
@@ -1104,8 +1166,10 @@ protected:
 	RID _uniform_set_create(const Array &p_uniforms, RID p_shader, uint32_t p_shader_set);
 
 	Error _buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const Vector<uint8_t> &p_data, uint32_t p_post_barrier = BARRIER_MASK_ALL);
+	Error _buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const Vector<uint8_t> &p_data);
 
 	RID _render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const Ref<RDPipelineRasterizationState> &p_rasterization_state, const Ref<RDPipelineMultisampleState> &p_multisample_state, const Ref<RDPipelineDepthStencilState> &p_depth_stencil_state, const Ref<RDPipelineColorBlendState> &p_blend_state, int p_dynamic_state_flags = 0);
+	RID _compute_pipeline_create(RID p_shader);
 
 	Vector<int64_t> _draw_list_begin_split(RID p_framebuffer, uint32_t p_splits, InitialAction p_initial_color_action, FinalAction p_final_color_action, InitialAction p_initial_depth_action, FinalAction p_final_depth_action, const Vector<Color> &p_clear_color_values = Vector<Color>(), float p_clear_depth = 1.0, uint32_t p_clear_stencil = 0, const Rect2 &p_region = Rect2(), const TypedArray<RID> &p_storage_textures = TypedArray<RID>());
 	void _draw_list_set_push_constant(DrawListID p_list, const Vector<uint8_t> &p_data, uint32_t p_data_size);
@@ -30,9 +30,12 @@
 
 #include "rendering_server_default.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/debugger/cpu_profiler.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/sort_array.h"
 #include "renderer_canvas_cull.h"
 #include "renderer_scene_cull.h"
@@ -91,7 +94,9 @@ void RenderingServerDefault::request_frame_drawn_callback(Object *p_where, const
 	frame_drawn_callbacks.push_back(fdc);
 }
 
-void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step, float p_interpolation_fraction) {
+	CPU_PROFILE_SCOPE("RenderingServer::draw");
+	MEMORY_TAG_SCOPE(TAG_RENDERING);
 	//needs to be done before changes is reset to 0, to not force the editor to redraw
 	RS::get_singleton()->emit_signal("frame_pre_draw");
 
@@ -103,6 +108,7 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	uint64_t time_usec = OS::get_singleton()->get_ticks_usec();
 
+	RSG::scene->update_interpolation_frame(p_interpolation_fraction); //moves interpolated instances, so must happen before updating them
 	RSG::scene->update(); //update scenes stuff before updating instances
 
 	frame_setup_time = double(OS::get_singleton()->get_ticks_usec() - time_usec) / 1000.0;
@@ -141,6 +147,14 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 		uint64_t base_cpu = RSG::storage->get_captured_timestamp_cpu_time(0);
 		uint64_t base_gpu = RSG::storage->get_captured_timestamp_gpu_time(0);
+
+		// Each timestamp opens a segment that lasts until the next one. Segments are attributed to the pass
+		// named by their timestamp, or else to the innermost ">Group" that maps to a pass.
+		float pass_time[FRAME_PASS_MAX] = {};
+		LocalVector<FramePass> pass_groups;
+		FramePass segment_pass = FRAME_PASS_MAX;
+		uint64_t segment_gpu = base_gpu;
+
 		for (uint32_t i = 0; i < RSG::storage->get_captured_timestamps_count(); i++) {
 			uint64_t time_cpu = RSG::storage->get_captured_timestamp_cpu_time(i);
 			uint64_t time_gpu = RSG::storage->get_captured_timestamp_gpu_time(i);
@@ -151,6 +165,27 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 				RSG::viewport->handle_timestamp(name, time_cpu, time_gpu);
 			}
 
+			if (segment_pass != FRAME_PASS_MAX && time_gpu > segment_gpu) {
+				pass_time[segment_pass] += float((time_gpu - segment_gpu) / 1000) / 1000.0;
+			}
+			segment_gpu = time_gpu;
+
+			FramePass group_pass = pass_groups.size() ? pass_groups[pass_groups.size() - 1] : FRAME_PASS_MAX;
+			if (name.begins_with(">")) {
+				const FramePass *pass = frame_pass_groups.getptr(name);
+				group_pass = pass ? *pass : group_pass;
+				pass_groups.push_back(group_pass);
+				segment_pass = group_pass;
+			} else if (name.begins_with("<")) {
+				if (pass_groups.size()) {
+					pass_groups.resize(pass_groups.size() - 1);
+				}
+				segment_pass = pass_groups.size() ? pass_groups[pass_groups.size() - 1] : FRAME_PASS_MAX;
+			} else {
+				const FramePass *pass = frame_pass_timestamps.getptr(name);
+				segment_pass = pass ? *pass : group_pass;
+			}
+
 			if (RSG::storage->capturing_timestamps) {
 				new_profile.write[i].gpu_msec = float((time_gpu - base_gpu) / 1000) / 1000.0;
 				new_profile.write[i].cpu_msec = float(time_cpu - base_cpu) / 1000.0;
@@ -159,6 +194,16 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 		}
 
 		frame_profile = new_profile;
+
+		uint64_t last_gpu = RSG::storage->get_captured_timestamp_gpu_time(RSG::storage->get_captured_timestamps_count() - 1);
+		pass_time[FRAME_PASS_TOTAL] = last_gpu > base_gpu ? float((last_gpu - base_gpu) / 1000) / 1000.0 : 0.0;
+		for (int i = 0; i < FRAME_PASS_MAX; i++) {
+			frame_pass_gpu_time[i] = pass_time[i];
+		}
+	} else {
+		for (int i = 0; i < FRAME_PASS_MAX; i++) {
+			frame_pass_gpu_time[i] = 0.0;
+		}
 	}
 
 	frame_profile_frame = RSG::storage->get_captured_timestamps_frame();
@@ -234,7 +279,7 @@ void RenderingServerDefault::init() {
 		print_verbose("RenderingServerWrapMT: Creating render thread");
 		DisplayServer::get_singleton()->release_rendering_thread();
 		if (create_thread) {
-			thread.start(_thread_callback, this);
+			thread.start(_thread_callback, this, Thread::get_role_settings(Thread::ROLE_RENDER));
 			print_verbose("RenderingServerWrapMT: Starting render thread");
 		}
 		while (!draw_thread_up) {
@@ -257,7 +302,22 @@ void RenderingServerDefault::finish() {
 
 /* STATUS INFORMATION */
 
-int RenderingServerDefault::get_render_info(RenderInfo p_info) {
+uint64_t RenderingServerDefault::get_render_info(RenderInfo p_info) {
+	if (p_info == INFO_OCCLUDED_OBJECTS_IN_FRAME) {
+		return RSG::scene->get_occlusion_culled_instance_count();
+	}
+	if (p_info == INFO_SHADOW_MEM_USED) {
+		return RSG::scene->get_shadow_memory_usage();
+	}
+	if (p_info == INFO_RENDER_TARGET_MEM_USED) {
+		//shadow atlases are render textures too, but they are reported on their own
+		uint64_t render_textures = RSG::storage->get_render_info(p_info);
+		uint64_t shadows = RSG::scene->get_shadow_memory_usage();
+		return render_textures > shadows ? render_textures - shadows : 0;
+	}
+	if (p_info == INFO_2D_DRAW_CALLS_IN_FRAME || p_info == INFO_2D_BATCHED_RECTS_IN_FRAME) {
+		return RSG::canvas_render->get_render_info(p_info);
+	}
 	return RSG::storage->get_render_info(p_info);
 }
 
@@ -269,8 +329,34 @@ String RenderingServerDefault::get_video_adapter_vendor() const {
 	return RSG::storage->get_video_adapter_vendor();
 }
 
+void RenderingServerDefault::_update_timestamp_capture() {
+	RSG::storage->capturing_timestamps = frame_profiling || frame_pass_timing || print_gpu_profile;
+}
+
+void RenderingServerDefault::_register_frame_pass_timestamps() {
+	frame_pass_timestamps["Render Shadows"] = FRAME_PASS_SHADOWS;
+	frame_pass_timestamps["Render GI + Render Shadows (parallel)"] = FRAME_PASS_SHADOWS;
+	frame_pass_timestamps["Render Depth Pre-Pass"] = FRAME_PASS_DEPTH_PREPASS;
+	frame_pass_timestamps["GI + Render Depth Pre-Pass (parallel)"] = FRAME_PASS_DEPTH_PREPASS;
+	frame_pass_timestamps["Resolve Depth Pre-Pass"] = FRAME_PASS_DEPTH_PREPASS;
+	frame_pass_timestamps["Render GI"] = FRAME_PASS_GI;
+	frame_pass_timestamps["Render GI Probes"] = FRAME_PASS_GI;
+	frame_pass_timestamps["Process SSAO"] = FRAME_PASS_SSAO;
+	frame_pass_timestamps["Render Opaque Pass"] = FRAME_PASS_OPAQUE;
+	frame_pass_timestamps["Setup Sky"] = FRAME_PASS_SKY;
+	frame_pass_timestamps["Render Sky"] = FRAME_PASS_SKY;
+	frame_pass_timestamps["Screen Space Reflection"] = FRAME_PASS_SSR;
+	frame_pass_timestamps["Render Transparent Pass"] = FRAME_PASS_TRANSPARENT;
+	frame_pass_timestamps["Render SDFGI"] = FRAME_PASS_SDFGI;
+	frame_pass_timestamps["Tonemap"] = FRAME_PASS_TONEMAP;
+
+	frame_pass_groups[">SDFGI Update SDF"] = FRAME_PASS_SDFGI;
+	frame_pass_groups[">Volumetric Fog"] = FRAME_PASS_VOLUMETRIC_FOG;
+}
+
 void RenderingServerDefault::set_frame_profiling_enabled(bool p_enable) {
-	RSG::storage->capturing_timestamps = p_enable;
+	frame_profiling = p_enable;
+	_update_timestamp_capture();
 }
 
 uint64_t RenderingServerDefault::get_frame_profile_frame() {
@@ -281,6 +367,20 @@ Vector<RenderingServer::FrameProfileArea> RenderingServerDefault::get_frame_prof
 	return frame_profile;
 }
 
+void RenderingServerDefault::set_frame_pass_timing_enabled(bool p_enable) {
+	frame_pass_timing = p_enable;
+	_update_timestamp_capture();
+}
+
+bool RenderingServerDefault::is_frame_pass_timing_enabled() const {
+	return frame_pass_timing;
+}
+
+float RenderingServerDefault::get_frame_pass_gpu_time(FramePass p_pass) const {
+	ERR_FAIL_INDEX_V(p_pass, FRAME_PASS_MAX, 0.0);
+	return frame_pass_gpu_time[p_pass];
+}
+
 /* TESTING */
 
 void RenderingServerDefault::set_boot_image(const Ref<Image> &p_image, const Color &p_color, bool p_scale, bool p_use_filter) {
@@ -301,8 +401,8 @@ void RenderingServerDefault::sdfgi_set_debug_probe_select(const Vector3 &p_posit
 }
 
 void RenderingServerDefault::set_print_gpu_profile(bool p_enable) {
-	RSG::storage->capturing_timestamps = p_enable;
 	print_gpu_profile = p_enable;
+	_update_timestamp_capture();
 }
 
 RID RenderingServerDefault::get_test_cube() {
@@ -332,9 +432,9 @@ void RenderingServerDefault::_thread_exit() {
 	exit = true;
 }
 
-void RenderingServerDefault::_thread_draw(bool p_swap_buffers, double frame_step) {
+void RenderingServerDefault::_thread_draw(bool p_swap_buffers, double frame_step, float p_interpolation_fraction) {
 	if (!atomic_decrement(&draw_pending)) {
-		_draw(p_swap_buffers, frame_step);
+		_draw(p_swap_buffers, frame_step, p_interpolation_fraction);
 	}
 }
 
@@ -349,6 +449,7 @@ void RenderingServerDefault::_thread_callback(void *_instance) {
 }
 
 void RenderingServerDefault::_thread_loop() {
+	MEMORY_TAG_SCOPE(TAG_RENDERING);
 	server_thread = Thread::get_caller_id();
 
 	DisplayServer::get_singleton()->make_rendering_thread();
@@ -379,11 +480,14 @@ void RenderingServerDefault::sync() {
 }
 
 void RenderingServerDefault::draw(bool p_swap_buffers, double frame_step) {
+	// Read on the calling thread, the render thread may draw while the next physics step runs.
+	float interpolation_fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
+
 	if (create_thread) {
 		atomic_increment(&draw_pending);
-		command_queue.push(this, &RenderingServerDefault::_thread_draw, p_swap_buffers, frame_step);
+		command_queue.push(this, &RenderingServerDefault::_thread_draw, p_swap_buffers, frame_step, interpolation_fraction);
 	} else {
-		_draw(p_swap_buffers, frame_step);
+		_draw(p_swap_buffers, frame_step, interpolation_fraction);
 	}
 }
 
@@ -409,6 +513,7 @@ RenderingServerDefault::RenderingServerDefault(bool p_create_thread) :
 	sr->set_scene_render(RSG::rasterizer->get_scene());
 
 	frame_profile_frame = 0;
+	_register_frame_pass_timestamps();
 
 	for (int i = 0; i < 4; i++) {
 		black_margin[i] = 0;
@@ -77,6 +77,16 @@ class RenderingServerDefault : public RenderingServer {
 
 	float frame_setup_time = 0;
 
+	// Per-pass GPU time of the last captured frame, aggregated from the render timestamps.
+	bool frame_profiling = false;
+	bool frame_pass_timing = false;
+	float frame_pass_gpu_time[FRAME_PASS_MAX] = {};
+	HashMap<String, FramePass> frame_pass_timestamps;
+	HashMap<String, FramePass> frame_pass_groups;
+
+	void _update_timestamp_capture();
+	void _register_frame_pass_timestamps();
+
 	//for printing
 	bool print_gpu_profile = false;
 	OrderedHashMap<String, float> print_gpu_profile_task_time;
@@ -95,14 +105,14 @@ class RenderingServerDefault : public RenderingServer {
 	bool create_thread;
 
 	uint64_t draw_pending;
-	void _thread_draw(bool p_swap_buffers, double frame_step);
+	void _thread_draw(bool p_swap_buffers, double frame_step, float p_interpolation_fraction);
 	void _thread_flush();
 
 	void _thread_exit();
 
 	Mutex alloc_mutex;
 
-	void _draw(bool p_swap_buffers, double frame_step);
+	void _draw(bool p_swap_buffers, double frame_step, float p_interpolation_fraction);
 	void _init();
 	void _finish();
 
@@ -186,6 +196,19 @@ public:
 		return ret;                                                                                                \
 	}
 
+	//resources whose initialization only fills their owner slot, done in place when the storage allows it
+	//so loader threads don't need queue space (or wait for it to be flushed) to create them
+#define FUNCRIDSPLITASYNC(m_type)                                                                     \
+	virtual RID m_type##_create() override {                                                          \
+		RID ret = RSG::storage->m_type##_allocate();                                                  \
+		if (Thread::get_caller_id() == server_thread || RSG::storage->can_create_resources_async()) { \
+			RSG::storage->m_type##_initialize(ret);                                                   \
+		} else {                                                                                      \
+			command_queue.push(RSG::storage, &RendererStorage::m_type##_initialize, ret);             \
+		}                                                                                             \
+		return ret;                                                                                   \
+	}
+
 	//these go pass-through, as they can be called from any thread
 	FUNCRIDTEX1(texture_2d, const Ref<Image> &)
 	FUNCRIDTEX2(texture_2d_layered, const Vector<Ref<Image>> &, TextureLayeredType)
@@ -228,7 +251,7 @@ public:
 
 	/* SHADER API */
 
-	FUNCRIDSPLIT(shader)
+	FUNCRIDSPLITASYNC(shader)
 
 	FUNC2(shader_set_code, RID, const String &)
 	FUNC1RC(String, shader_get_code, RID)
@@ -243,7 +266,7 @@ public:
 
 	/* COMMON MATERIAL API */
 
-	FUNCRIDSPLIT(material)
+	FUNCRIDSPLITASYNC(material)
 
 	FUNC2(material_set_shader, RID, RID)
 
@@ -271,7 +294,6 @@ public:
 			command_queue.push(RSG::storage, &RendererStorage::mesh_initialize, mesh);
 			command_queue.push(RSG::storage, &RendererStorage::mesh_set_blend_shape_count, mesh, p_blend_shape_count);
 			for (int i = 0; i < p_surfaces.size(); i++) {
-				RSG::storage->mesh_add_surface(mesh, p_surfaces[i]);
 				command_queue.push(RSG::storage, &RendererStorage::mesh_add_surface, mesh, p_surfaces[i]);
 			}
 		}
@@ -281,7 +303,7 @@ public:
 
 	FUNC2(mesh_set_blend_shape_count, RID, int)
 
-	FUNCRIDSPLIT(mesh)
+	FUNCRIDSPLITASYNC(mesh)
 
 	FUNC2(mesh_add_surface, RID, const SurfaceData &)
 
@@ -308,7 +330,7 @@ public:
 
 	/* MULTIMESH API */
 
-	FUNCRIDSPLIT(multimesh)
+	FUNCRIDSPLITASYNC(multimesh)
 
 	FUNC5(multimesh_allocate_data, RID, int, MultimeshTransformFormat, bool, bool)
 	FUNC1RC(int, multimesh_get_instance_count, RID)
@@ -350,7 +372,7 @@ public:
 
 	/* SKELETON API */
 
-	FUNCRIDSPLIT(skeleton)
+	FUNCRIDSPLITASYNC(skeleton)
 	FUNC3(skeleton_allocate_data, RID, int, bool)
 	FUNC1RC(int, skeleton_get_bone_count, RID)
 	FUNC3(skeleton_bone_set_transform, RID, int, const Transform &)
@@ -539,6 +561,13 @@ public:
 	FUNC2(camera_set_environment, RID, RID)
 	FUNC2(camera_set_camera_effects, RID, RID)
 	FUNC2(camera_set_use_vertical_aspect, RID, bool)
+	FUNC2(camera_set_interpolated, RID, bool)
+	FUNC1(camera_reset_physics_interpolation, RID)
+
+	/* OCCLUDER API */
+
+	FUNCRIDSPLIT(occluder)
+	FUNC3(occluder_set_mesh, RID, const PackedVector3Array &, const PackedInt32Array &)
 
 #undef server_name
 #undef ServerName
@@ -591,6 +620,7 @@ public:
 	FUNC2(viewport_set_screen_space_aa, RID, ViewportScreenSpaceAA)
 	FUNC2(viewport_set_use_debanding, RID, bool)
 	FUNC2(viewport_set_lod_threshold, RID, float)
+	FUNC4(viewport_set_dynamic_resolution, RID, bool, float, float)
 
 	FUNC2R(int, viewport_get_render_info, RID, ViewportRenderInfo)
 	FUNC2(viewport_set_debug_draw, RID, ViewportDebugDraw)
@@ -701,6 +731,8 @@ public:
 	FUNC2(instance_set_scenario, RID, RID)
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
 	FUNC2(instance_set_transform, RID, const Transform &)
+	FUNC2(instance_set_interpolated, RID, bool)
+	FUNC1(instance_reset_physics_interpolation, RID)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_material, RID, int, RID)
@@ -736,6 +768,11 @@ public:
 
 	FUNC1(gi_set_use_half_resolution, bool)
 
+	/* PHYSICS INTERPOLATION */
+
+	FUNC1(set_physics_interpolation_enabled, bool)
+	FUNC0(tick)
+
 #undef server_name
 #undef ServerName
 //from now on, calls forwarded to this singleton
@@ -901,7 +938,7 @@ public:
 
 	/* STATUS INFORMATION */
 
-	virtual int get_render_info(RenderInfo p_info) override;
+	virtual uint64_t get_render_info(RenderInfo p_info) override;
 	virtual String get_video_adapter_name() const override;
 	virtual String get_video_adapter_vendor() const override;
 
@@ -909,6 +946,10 @@ public:
 	virtual Vector<FrameProfileArea> get_frame_profile() override;
 	virtual uint64_t get_frame_profile_frame() override;
 
+	virtual void set_frame_pass_timing_enabled(bool p_enable) override;
+	virtual bool is_frame_pass_timing_enabled() const override;
+	virtual float get_frame_pass_gpu_time(FramePass p_pass) const override;
+
 	virtual RID get_test_cube() override;
 
 	/* TESTING */
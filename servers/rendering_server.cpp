@@ -31,6 +31,7 @@
 #include "rendering_server.h"
 
 #include "core/config/project_settings.h"
+#include "core/math/batch_math.h"
 
 RenderingServer *RenderingServer::singleton = nullptr;
 RenderingServer *(*RenderingServer::create_func)() = nullptr;
@@ -367,21 +368,16 @@ Error RenderingServer::_surface_set_data(Array p_arrays, uint32_t p_format, uint
 
 					const Vector3 *src = array.ptr();
 
-					// setting vertices means regenerating the AABB
-					AABB aabb;
-
-					{
-						for (int i = 0; i < p_vertex_array_len; i++) {
-							float vector[3] = { src[i].x, src[i].y, src[i].z };
+					for (int i = 0; i < p_vertex_array_len; i++) {
+						float vector[3] = { src[i].x, src[i].y, src[i].z };
 
-							copymem(&vw[p_offsets[ai] + i * p_vertex_stride], vector, sizeof(float) * 3);
+						copymem(&vw[p_offsets[ai] + i * p_vertex_stride], vector, sizeof(float) * 3);
+					}
 
-							if (i == 0) {
-								aabb = AABB(src[i], SMALL_VEC3);
-							} else {
-								aabb.expand_to(src[i]);
-							}
-						}
+					// setting vertices means regenerating the AABB
+					AABB aabb = BatchMath::get_aabb(src, p_vertex_array_len);
+					if (p_vertex_array_len > 0) {
+						aabb.expand_to(src[0] + SMALL_VEC3); // must have a bit of size
 					}
 
 					r_aabb = aabb;
@@ -454,10 +450,17 @@ Error RenderingServer::_surface_set_data(Array p_arrays, uint32_t p_format, uint
 
 				const Vector2 *src = array.ptr();
 
-				for (int i = 0; i < p_vertex_array_len; i++) {
-					float uv[2] = { src[i].x, src[i].y };
+				if (p_format & ARRAY_FLAG_COMPRESS_TEX_UV) {
+					for (int i = 0; i < p_vertex_array_len; i++) {
+						uint16_t uv[2] = { Math::make_half_float(src[i].x), Math::make_half_float(src[i].y) };
+						copymem(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 2);
+					}
+				} else {
+					for (int i = 0; i < p_vertex_array_len; i++) {
+						float uv[2] = { src[i].x, src[i].y };
 
-					copymem(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 4);
+						copymem(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 4);
+					}
 				}
 
 			} break;
@@ -472,8 +475,8 @@ Error RenderingServer::_surface_set_data(Array p_arrays, uint32_t p_format, uint
 				const Vector2 *src = array.ptr();
 
 				for (int i = 0; i < p_vertex_array_len; i++) {
-					uint16_t uv[2] = { Math::make_half_float(src[i].x), Math::make_half_float(src[i].y) };
-					copymem(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 2);
+					float uv[2] = { src[i].x, src[i].y };
+					copymem(&aw[p_offsets[ai] + i * p_attrib_stride], uv, 2 * 4);
 				}
 			} break;
 			case RS::ARRAY_CUSTOM0:
@@ -762,7 +765,7 @@ void RenderingServer::mesh_surface_make_offsets_from_format(uint32_t p_format, i
 				elem_size = 8;
 			} break;
 			case RS::ARRAY_TEX_UV: {
-				elem_size = 8;
+				elem_size = (p_format & ARRAY_FLAG_COMPRESS_TEX_UV) ? 4 : 8;
 
 			} break;
 
@@ -1131,9 +1134,16 @@ Array RenderingServer::_get_array_from_surface(uint32_t p_format, Vector<uint8_t
 
 				Vector2 *w = arr.ptrw();
 
-				for (int j = 0; j < p_vertex_len; j++) {
-					const float *v = (const float *)&ar[j * attrib_elem_size + offsets[i]];
-					w[j] = Vector2(v[0], v[1]);
+				if (p_format & ARRAY_FLAG_COMPRESS_TEX_UV) {
+					for (int j = 0; j < p_vertex_len; j++) {
+						const uint16_t *v = (const uint16_t *)&ar[j * attrib_elem_size + offsets[i]];
+						w[j] = Vector2(Math::half_to_float(v[0]), Math::half_to_float(v[1]));
+					}
+				} else {
+					for (int j = 0; j < p_vertex_len; j++) {
+						const float *v = (const float *)&ar[j * attrib_elem_size + offsets[i]];
+						w[j] = Vector2(v[0], v[1]);
+					}
 				}
 
 				ret[i] = arr;
@@ -1640,6 +1650,11 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("camera_set_cull_mask", "camera", "layers"), &RenderingServer::camera_set_cull_mask);
 	ClassDB::bind_method(D_METHOD("camera_set_environment", "camera", "env"), &RenderingServer::camera_set_environment);
 	ClassDB::bind_method(D_METHOD("camera_set_use_vertical_aspect", "camera", "enable"), &RenderingServer::camera_set_use_vertical_aspect);
+	ClassDB::bind_method(D_METHOD("camera_set_interpolated", "camera", "interpolated"), &RenderingServer::camera_set_interpolated);
+	ClassDB::bind_method(D_METHOD("camera_reset_physics_interpolation", "camera"), &RenderingServer::camera_reset_physics_interpolation);
+
+	ClassDB::bind_method(D_METHOD("occluder_create"), &RenderingServer::occluder_create);
+	ClassDB::bind_method(D_METHOD("occluder_set_mesh", "occluder", "vertices", "indices"), &RenderingServer::occluder_set_mesh);
 
 	ClassDB::bind_method(D_METHOD("viewport_create"), &RenderingServer::viewport_create);
 	ClassDB::bind_method(D_METHOD("viewport_set_use_xr", "viewport", "use_xr"), &RenderingServer::viewport_set_use_xr);
@@ -1667,6 +1682,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("viewport_set_shadow_atlas_quadrant_subdivision", "viewport", "quadrant", "subdivision"), &RenderingServer::viewport_set_shadow_atlas_quadrant_subdivision);
 	ClassDB::bind_method(D_METHOD("viewport_set_msaa", "viewport", "msaa"), &RenderingServer::viewport_set_msaa);
 	ClassDB::bind_method(D_METHOD("viewport_set_use_debanding", "viewport", "enable"), &RenderingServer::viewport_set_use_debanding);
+	ClassDB::bind_method(D_METHOD("viewport_set_dynamic_resolution", "viewport", "enable", "target_fps", "min_scale"), &RenderingServer::viewport_set_dynamic_resolution);
 
 	ClassDB::bind_method(D_METHOD("viewport_get_render_info", "viewport", "info"), &RenderingServer::viewport_get_render_info);
 	ClassDB::bind_method(D_METHOD("viewport_set_debug_draw", "viewport", "draw"), &RenderingServer::viewport_set_debug_draw);
@@ -1704,6 +1720,8 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_scenario", "instance", "scenario"), &RenderingServer::instance_set_scenario);
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_interpolated", "instance", "interpolated"), &RenderingServer::instance_set_interpolated);
+	ClassDB::bind_method(D_METHOD("instance_reset_physics_interpolation", "instance"), &RenderingServer::instance_reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &RenderingServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_material", "instance", "surface", "material"), &RenderingServer::instance_set_surface_material);
@@ -1811,6 +1829,7 @@ void RenderingServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("request_frame_drawn_callback", "where", "method", "userdata"), &RenderingServer::request_frame_drawn_callback);
 	ClassDB::bind_method(D_METHOD("has_changed"), &RenderingServer::has_changed);
+	ClassDB::bind_method(D_METHOD("set_physics_interpolation_enabled", "enabled"), &RenderingServer::set_physics_interpolation_enabled);
 	ClassDB::bind_method(D_METHOD("init"), &RenderingServer::init);
 	ClassDB::bind_method(D_METHOD("finish"), &RenderingServer::finish);
 	ClassDB::bind_method(D_METHOD("get_render_info", "info"), &RenderingServer::get_render_info);
@@ -1836,6 +1855,10 @@ void RenderingServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_frame_setup_time_cpu"), &RenderingServer::get_frame_setup_time_cpu);
 
+	ClassDB::bind_method(D_METHOD("set_frame_pass_timing_enabled", "enable"), &RenderingServer::set_frame_pass_timing_enabled);
+	ClassDB::bind_method(D_METHOD("is_frame_pass_timing_enabled"), &RenderingServer::is_frame_pass_timing_enabled);
+	ClassDB::bind_method(D_METHOD("get_frame_pass_gpu_time", "pass"), &RenderingServer::get_frame_pass_gpu_time);
+
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "render_loop_enabled"), "set_render_loop_enabled", "is_render_loop_enabled");
 
 	BIND_CONSTANT(NO_INDEX_ARRAY);
@@ -1908,6 +1931,7 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_2D_VERTICES);
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_DYNAMIC_UPDATE);
 	BIND_ENUM_CONSTANT(ARRAY_FLAG_USE_8_BONE_WEIGHTS);
+	BIND_ENUM_CONSTANT(ARRAY_FLAG_COMPRESS_TEX_UV);
 
 	BIND_ENUM_CONSTANT(PRIMITIVE_POINTS);
 	BIND_ENUM_CONSTANT(PRIMITIVE_LINES);
@@ -1956,6 +1980,7 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(LIGHT_DIRECTIONAL_SHADOW_ORTHOGONAL);
 	BIND_ENUM_CONSTANT(LIGHT_DIRECTIONAL_SHADOW_PARALLEL_2_SPLITS);
 	BIND_ENUM_CONSTANT(LIGHT_DIRECTIONAL_SHADOW_PARALLEL_4_SPLITS);
+	BIND_ENUM_CONSTANT(LIGHT_DIRECTIONAL_SHADOW_CLIPMAP);
 
 	BIND_ENUM_CONSTANT(LIGHT_DIRECTIONAL_SHADOW_DEPTH_RANGE_STABLE);
 	BIND_ENUM_CONSTANT(LIGHT_DIRECTIONAL_SHADOW_DEPTH_RANGE_OPTIMIZED);
@@ -2104,6 +2129,7 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(INSTANCE_DECAL);
 	BIND_ENUM_CONSTANT(INSTANCE_GI_PROBE);
 	BIND_ENUM_CONSTANT(INSTANCE_LIGHTMAP);
+	BIND_ENUM_CONSTANT(INSTANCE_OCCLUDER);
 	BIND_ENUM_CONSTANT(INSTANCE_MAX);
 	BIND_ENUM_CONSTANT(INSTANCE_GEOMETRY_MASK);
 
@@ -2196,6 +2222,26 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_VIDEO_MEM_USED);
 	BIND_ENUM_CONSTANT(INFO_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(INFO_VERTEX_MEM_USED);
+	BIND_ENUM_CONSTANT(INFO_OCCLUDED_OBJECTS_IN_FRAME);
+	BIND_ENUM_CONSTANT(INFO_2D_DRAW_CALLS_IN_FRAME);
+	BIND_ENUM_CONSTANT(INFO_2D_BATCHED_RECTS_IN_FRAME);
+	BIND_ENUM_CONSTANT(INFO_RENDER_TARGET_MEM_USED);
+	BIND_ENUM_CONSTANT(INFO_SHADOW_MEM_USED);
+	BIND_ENUM_CONSTANT(INFO_VIDEO_MEM_BUDGET);
+
+	BIND_ENUM_CONSTANT(FRAME_PASS_TOTAL);
+	BIND_ENUM_CONSTANT(FRAME_PASS_SHADOWS);
+	BIND_ENUM_CONSTANT(FRAME_PASS_DEPTH_PREPASS);
+	BIND_ENUM_CONSTANT(FRAME_PASS_GI);
+	BIND_ENUM_CONSTANT(FRAME_PASS_SSAO);
+	BIND_ENUM_CONSTANT(FRAME_PASS_OPAQUE);
+	BIND_ENUM_CONSTANT(FRAME_PASS_SKY);
+	BIND_ENUM_CONSTANT(FRAME_PASS_SSR);
+	BIND_ENUM_CONSTANT(FRAME_PASS_TRANSPARENT);
+	BIND_ENUM_CONSTANT(FRAME_PASS_SDFGI);
+	BIND_ENUM_CONSTANT(FRAME_PASS_VOLUMETRIC_FOG);
+	BIND_ENUM_CONSTANT(FRAME_PASS_TONEMAP);
+	BIND_ENUM_CONSTANT(FRAME_PASS_MAX);
 
 	BIND_ENUM_CONSTANT(FEATURE_SHADERS);
 	BIND_ENUM_CONSTANT(FEATURE_MULTITHREADED);
@@ -2279,8 +2325,15 @@ RenderingServer::RenderingServer() {
 	GLOBAL_DEF("rendering/quality/shadows/soft_shadow_quality", 2);
 	GLOBAL_DEF("rendering/quality/shadows/soft_shadow_quality.mobile", 0);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/shadows/soft_shadow_quality", PropertyInfo(Variant::INT, "rendering/quality/shadows/soft_shadow_quality", PROPERTY_HINT_ENUM, "Hard (Fastest),Soft Low (Fast),Soft Medium (Average),Soft High (Slow),Soft Ultra (Slowest)"));
+	GLOBAL_DEF("rendering/quality/shadows/cache_static_casters", true);
+	GLOBAL_DEF("rendering/quality/shadows/distant_light_updates_per_frame", 4);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/shadows/distant_light_updates_per_frame", PropertyInfo(Variant::INT, "rendering/quality/shadows/distant_light_updates_per_frame", PROPERTY_HINT_RANGE, "0,64,1"));
+	GLOBAL_DEF("rendering/quality/shadows/distant_light_coverage", 0.1);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/shadows/distant_light_coverage", PropertyInfo(Variant::FLOAT, "rendering/quality/shadows/distant_light_coverage", PROPERTY_HINT_RANGE, "0,1,0.01"));
 
 	GLOBAL_DEF("rendering/quality/2d_shadow_atlas/size", 2048);
+	GLOBAL_DEF_RST("rendering/quality/2d/max_batched_rects", 4096);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/2d/max_batched_rects", PropertyInfo(Variant::INT, "rendering/quality/2d/max_batched_rects", PROPERTY_HINT_RANGE, "1,65536,1"));
 
 	GLOBAL_DEF("rendering/quality/rd_renderer/use_low_end_renderer", false);
 	GLOBAL_DEF("rendering/quality/rd_renderer/use_low_end_renderer.mobile", true);
@@ -2291,6 +2344,8 @@ RenderingServer::RenderingServer() {
 	GLOBAL_DEF("rendering/quality/reflections/ggx_samples", 1024);
 	GLOBAL_DEF("rendering/quality/reflections/ggx_samples.mobile", 128);
 	GLOBAL_DEF("rendering/quality/reflections/fast_filter_high_quality", false);
+	GLOBAL_DEF("rendering/quality/reflections/update_always_faces_per_frame", 6);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/reflections/update_always_faces_per_frame", PropertyInfo(Variant::INT, "rendering/quality/reflections/update_always_faces_per_frame", PROPERTY_HINT_RANGE, "1,6,1"));
 	GLOBAL_DEF("rendering/quality/reflection_atlas/reflection_size", 256);
 	GLOBAL_DEF("rendering/quality/reflection_atlas/reflection_size.mobile", 128);
 	GLOBAL_DEF("rendering/quality/reflection_atlas/reflection_count", 64);
@@ -2360,12 +2415,17 @@ RenderingServer::RenderingServer() {
 	GLOBAL_DEF("rendering/lightmapper/probe_capture_update_speed", 15);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/lightmapper/probe_capture_update_speed", PropertyInfo(Variant::FLOAT, "rendering/lightmapper/probe_capture_update_speed", PROPERTY_HINT_RANGE, "0.001,256,0.001"));
 
+	GLOBAL_DEF("rendering/quality/particles/simulation_lod_screen_size", 0.1);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/particles/simulation_lod_screen_size", PropertyInfo(Variant::FLOAT, "rendering/quality/particles/simulation_lod_screen_size", PROPERTY_HINT_RANGE, "0,1,0.01"));
+
 	GLOBAL_DEF("rendering/sdfgi/probe_ray_count", 1);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/sdfgi/probe_ray_count", PropertyInfo(Variant::INT, "rendering/sdfgi/probe_ray_count", PROPERTY_HINT_ENUM, "8 (Fastest),16,32,64,96,128 (Slowest)"));
 	GLOBAL_DEF("rendering/sdfgi/frames_to_converge", 4);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/sdfgi/frames_to_converge", PropertyInfo(Variant::INT, "rendering/sdfgi/frames_to_converge", PROPERTY_HINT_ENUM, "5 (Less Latency but Lower Quality),10,15,20,25,30 (More Latency but Higher Quality)"));
 	GLOBAL_DEF("rendering/sdfgi/frames_to_update_lights", 2);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/sdfgi/frames_to_update_lights", PropertyInfo(Variant::INT, "rendering/sdfgi/frames_to_update_lights", PROPERTY_HINT_ENUM, "1 (Slower),2,4,8,16 (Faster)"));
+	GLOBAL_DEF("rendering/sdfgi/frame_update_budget", 0.5);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/sdfgi/frame_update_budget", PropertyInfo(Variant::FLOAT, "rendering/sdfgi/frame_update_budget", PROPERTY_HINT_RANGE, "0,8,0.01"));
 
 	GLOBAL_DEF("rendering/volumetric_fog/volume_size", 64);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/volumetric_fog/volume_size", PropertyInfo(Variant::INT, "rendering/volumetric_fog/volume_size", PROPERTY_HINT_RANGE, "16,512,1"));
@@ -2378,8 +2438,22 @@ RenderingServer::RenderingServer() {
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/spatial_indexer/update_iterations_per_frame", PropertyInfo(Variant::INT, "rendering/spatial_indexer/update_iterations_per_frame", PROPERTY_HINT_RANGE, "0,1024,1"));
 	GLOBAL_DEF("rendering/spatial_indexer/threaded_cull_minimum_instances", 1000);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/spatial_indexer/threaded_cull_minimum_instances", PropertyInfo(Variant::INT, "rendering/spatial_indexer/threaded_cull_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"));
+
+	GLOBAL_DEF_RST("rendering/textures/streaming/enabled", false);
+	GLOBAL_DEF_RST("rendering/textures/streaming/initial_max_size", 256);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/streaming/initial_max_size", PropertyInfo(Variant::INT, "rendering/textures/streaming/initial_max_size", PROPERTY_HINT_RANGE, "16,16384,1"));
+	GLOBAL_DEF_RST("rendering/textures/streaming/memory_budget_mb", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/textures/streaming/memory_budget_mb", PropertyInfo(Variant::INT, "rendering/textures/streaming/memory_budget_mb", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"));
+
+	GLOBAL_DEF("rendering/quality/video_memory/low_memory_threshold", 0.9);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/quality/video_memory/low_memory_threshold", PropertyInfo(Variant::FLOAT, "rendering/quality/video_memory/low_memory_threshold", PROPERTY_HINT_RANGE, "0,1,0.01"));
+
+	GLOBAL_DEF("rendering/occlusion_culling/use_occlusion_culling", false);
+	GLOBAL_DEF("rendering/occlusion_culling/occlusion_buffer_width", 256);
+	ProjectSettings::get_singleton()->set_custom_property_info("rendering/occlusion_culling/occlusion_buffer_width", PropertyInfo(Variant::INT, "rendering/occlusion_culling/occlusion_buffer_width", PROPERTY_HINT_RANGE, "32,1024,1"));
 	GLOBAL_DEF("rendering/forward_renderer/threaded_render_minimum_instances", 500);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/forward_renderer/threaded_render_minimum_instances", PropertyInfo(Variant::INT, "rendering/forward_renderer/threaded_render_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"));
+	GLOBAL_DEF("rendering/forward_renderer/mesh_cluster_culling", true);
 
 	GLOBAL_DEF("rendering/cluster_builder/max_clustered_elements", 512);
 	ProjectSettings::get_singleton()->set_custom_property_info("rendering/cluster_builder/max_clustered_elements", PropertyInfo(Variant::FLOAT, "rendering/cluster_builder/max_clustered_elements", PROPERTY_HINT_RANGE, "32,8192,1"));
@@ -276,6 +276,7 @@ public:
 		ARRAY_FLAG_USE_2D_VERTICES = 1 << (ARRAY_COMPRESS_FLAGS_BASE + 0),
 		ARRAY_FLAG_USE_DYNAMIC_UPDATE = 1 << (ARRAY_COMPRESS_FLAGS_BASE + 1),
 		ARRAY_FLAG_USE_8_BONE_WEIGHTS = 1 << (ARRAY_COMPRESS_FLAGS_BASE + 2),
+		ARRAY_FLAG_COMPRESS_TEX_UV = 1 << (ARRAY_COMPRESS_FLAGS_BASE + 3), // UV stored as half floats.
 	};
 
 	enum PrimitiveType {
@@ -308,6 +309,17 @@ public:
 
 		Vector<uint8_t> blend_shape_data;
 
+		// Optional clusters of up to a few hundred triangles, each a contiguous range of
+		// the index array, used to cull parts of large static meshes on the GPU.
+		struct Cluster {
+			float sphere[4]; // Bounding sphere center and radius.
+			float cone[4]; // Normal cone axis and cutoff (cos of half the angle), cutoff >= 1 when no triangle can be culled.
+			uint32_t index_offset;
+			uint32_t index_count;
+			uint32_t pad[2];
+		};
+		Vector<uint8_t> cluster_data; // Array of Cluster.
+
 		RID material;
 	};
 
@@ -483,6 +495,7 @@ public:
 		LIGHT_DIRECTIONAL_SHADOW_ORTHOGONAL,
 		LIGHT_DIRECTIONAL_SHADOW_PARALLEL_2_SPLITS,
 		LIGHT_DIRECTIONAL_SHADOW_PARALLEL_4_SPLITS,
+		LIGHT_DIRECTIONAL_SHADOW_CLIPMAP,
 	};
 
 	virtual void light_directional_set_shadow_mode(RID p_light, LightDirectionalShadowMode p_mode) = 0;
@@ -712,6 +725,13 @@ public:
 	virtual void camera_set_environment(RID p_camera, RID p_env) = 0;
 	virtual void camera_set_camera_effects(RID p_camera, RID p_camera_effects) = 0;
 	virtual void camera_set_use_vertical_aspect(RID p_camera, bool p_enable) = 0;
+	virtual void camera_set_interpolated(RID p_camera, bool p_interpolated) = 0;
+	virtual void camera_reset_physics_interpolation(RID p_camera) = 0;
+
+	/* OCCLUDER API */
+
+	virtual RID occluder_create() = 0;
+	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) = 0;
 
 	/* VIEWPORT TARGET API */
 
@@ -826,6 +846,8 @@ public:
 
 	virtual void viewport_set_lod_threshold(RID p_viewport, float p_pixels) = 0;
 
+	virtual void viewport_set_dynamic_resolution(RID p_viewport, bool p_enable, float p_target_fps, float p_min_scale) = 0;
+
 	enum ViewportRenderInfo {
 		VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME,
 		VIEWPORT_RENDER_INFO_VERTICES_IN_FRAME,
@@ -1109,6 +1131,7 @@ public:
 		INSTANCE_DECAL,
 		INSTANCE_GI_PROBE,
 		INSTANCE_LIGHTMAP,
+		INSTANCE_OCCLUDER,
 		INSTANCE_MAX,
 
 		INSTANCE_GEOMETRY_MASK = (1 << INSTANCE_MESH) | (1 << INSTANCE_MULTIMESH) | (1 << INSTANCE_IMMEDIATE) | (1 << INSTANCE_PARTICLES)
@@ -1122,6 +1145,8 @@ public:
 	virtual void instance_set_scenario(RID p_instance, RID p_scenario) = 0;
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform &p_transform) = 0;
+	virtual void instance_set_interpolated(RID p_instance, bool p_interpolated) = 0;
+	virtual void instance_reset_physics_interpolation(RID p_instance) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -1400,6 +1425,8 @@ public:
 
 	virtual void draw(bool p_swap_buffers = true, double frame_step = 0.0) = 0;
 	virtual void sync() = 0;
+	virtual void tick() = 0; // Called at the start of each physics step, ends the previous one for interpolation.
+	virtual void set_physics_interpolation_enabled(bool p_enabled) = 0;
 	virtual bool has_changed() const = 0;
 	virtual void init() = 0;
 	virtual void finish() = 0;
@@ -1417,9 +1444,15 @@ public:
 		INFO_VIDEO_MEM_USED,
 		INFO_TEXTURE_MEM_USED,
 		INFO_VERTEX_MEM_USED,
+		INFO_OCCLUDED_OBJECTS_IN_FRAME,
+		INFO_2D_DRAW_CALLS_IN_FRAME,
+		INFO_2D_BATCHED_RECTS_IN_FRAME,
+		INFO_RENDER_TARGET_MEM_USED,
+		INFO_SHADOW_MEM_USED,
+		INFO_VIDEO_MEM_BUDGET,
 	};
 
-	virtual int get_render_info(RenderInfo p_info) = 0;
+	virtual uint64_t get_render_info(RenderInfo p_info) = 0;
 	virtual String get_video_adapter_name() const = 0;
 	virtual String get_video_adapter_vendor() const = 0;
 
@@ -1433,6 +1466,26 @@ public:
 	virtual Vector<FrameProfileArea> get_frame_profile() = 0;
 	virtual uint64_t get_frame_profile_frame() = 0;
 
+	enum FramePass {
+		FRAME_PASS_TOTAL,
+		FRAME_PASS_SHADOWS,
+		FRAME_PASS_DEPTH_PREPASS,
+		FRAME_PASS_GI,
+		FRAME_PASS_SSAO,
+		FRAME_PASS_OPAQUE,
+		FRAME_PASS_SKY,
+		FRAME_PASS_SSR,
+		FRAME_PASS_TRANSPARENT,
+		FRAME_PASS_SDFGI,
+		FRAME_PASS_VOLUMETRIC_FOG,
+		FRAME_PASS_TONEMAP,
+		FRAME_PASS_MAX
+	};
+
+	virtual void set_frame_pass_timing_enabled(bool p_enable) = 0;
+	virtual bool is_frame_pass_timing_enabled() const = 0;
+	virtual float get_frame_pass_gpu_time(FramePass p_pass) const = 0;
+
 	virtual float get_frame_setup_time_cpu() const = 0;
 
 	virtual void gi_set_use_half_resolution(bool p_enable) = 0;
@@ -1532,6 +1585,7 @@ VARIANT_ENUM_CAST(RenderingServer::CanvasOccluderPolygonCullMode);
 VARIANT_ENUM_CAST(RenderingServer::GlobalVariableType);
 VARIANT_ENUM_CAST(RenderingServer::RenderInfo);
 VARIANT_ENUM_CAST(RenderingServer::Features);
+VARIANT_ENUM_CAST(RenderingServer::FramePass);
 
 // Alias to make it easier to use.
 #define RS RenderingServer
@@ -0,0 +1,91 @@
+/*************************************************************************/
+/*  test_animation.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef TEST_ANIMATION_H
+#define TEST_ANIMATION_H
+
+#include "scene/resources/animation.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestAnimation {
+
+TEST_CASE("[Animation] Compressed transform track") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	const int track = animation->add_track(Animation::TYPE_TRANSFORM);
+	const Quat rot_b = Quat(Vector3(0, 1, 0), Math_PI * 0.5);
+	animation->transform_track_insert_key(track, 0.0, Vector3(0, 0, 0), Quat(), Vector3(1, 1, 1));
+	animation->transform_track_insert_key(track, 1.0, Vector3(2, -4, 8), rot_b, Vector3(1, 1, 1));
+
+	animation->compress();
+
+	CHECK_MESSAGE(
+			animation->track_is_compressed(track),
+			"Transform track should be compressed.");
+	CHECK_MESSAGE(
+			animation->track_get_key_count(track) == 2,
+			"Compression should keep all keys.");
+	CHECK_MESSAGE(
+			Math::is_equal_approx(animation->track_get_key_time(track, 1), 1.0f),
+			"Key times should be stored exactly.");
+
+	Vector3 loc;
+	Quat rot;
+	Vector3 scale;
+	animation->transform_track_get_key(track, 1, &loc, &rot, &scale);
+	CHECK_MESSAGE(
+			loc.distance_to(Vector3(2, -4, 8)) < 0.001,
+			"Quantized location should stay close to the original.");
+	CHECK_MESSAGE(
+			rot.dot(rot_b) > 0.9999,
+			"Quantized rotation should stay close to the original.");
+	CHECK_MESSAGE(
+			scale.is_equal_approx(Vector3(1, 1, 1)),
+			"Constant scale should be stored exactly.");
+
+	animation->transform_track_interpolate(track, 0.5, &loc, &rot, &scale);
+	CHECK_MESSAGE(
+			loc.distance_to(Vector3(1, -2, 4)) < 0.001,
+			"Interpolation on compressed keys should match the uncompressed result.");
+
+	animation->transform_track_insert_key(track, 1.5, Vector3(), Quat(), Vector3(1, 1, 1));
+	CHECK_MESSAGE(
+			!animation->track_is_compressed(track),
+			"Inserting a key should decompress the track.");
+	CHECK_MESSAGE(
+			animation->track_get_key_count(track) == 3,
+			"Decompressed track should contain the new key.");
+}
+
+} // namespace TestAnimation
+
+#endif // TEST_ANIMATION_H
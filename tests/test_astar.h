@@ -218,6 +218,78 @@ TEST_CASE("[AStar] Add/Remove") {
 	// It's been great work, cheers. \(^ ^)/
 }
 
+static void build_grid(AStar &a, int p_size) {
+	for (int y = 0; y < p_size; y++) {
+		for (int x = 0; x < p_size; x++) {
+			int id = y * p_size + x;
+			a.add_point(id, Vector3(x, y, 0));
+			if (x > 0) {
+				a.connect_points(id, id - 1);
+			}
+			if (y > 0) {
+				a.connect_points(id, id - p_size);
+			}
+		}
+	}
+}
+
+TEST_CASE("[AStar] Hierarchical path") {
+	const int size = 20;
+	AStar flat;
+	AStar hierarchical;
+	build_grid(flat, size);
+	build_grid(hierarchical, size);
+	hierarchical.set_cluster_size(5);
+	hierarchical.set_hierarchical(true);
+
+	// Wall with a single gap, spanning several clusters.
+	for (int y = 0; y < size - 1; y++) {
+		flat.set_point_disabled(y * size + 10);
+		hierarchical.set_point_disabled(y * size + 10);
+	}
+
+	Vector<int> flat_path = flat.get_id_path(0, size - 1);
+	Vector<int> path = hierarchical.get_id_path(0, size - 1);
+	REQUIRE(flat_path.size() > 0);
+	REQUIRE(path.size() == flat_path.size());
+	CHECK(path[0] == 0);
+	CHECK(path[path.size() - 1] == size - 1);
+	for (int i = 1; i < path.size(); i++) {
+		CHECK(hierarchical.are_points_connected(path[i - 1], path[i]));
+		CHECK_FALSE(hierarchical.is_point_disabled(path[i]));
+	}
+
+	// Closing the gap only rebuilds the affected clusters.
+	hierarchical.set_point_disabled((size - 1) * size + 10);
+	CHECK(hierarchical.get_id_path(0, size - 1).size() == 0);
+
+	hierarchical.set_point_disabled((size - 1) * size + 10, false);
+	hierarchical.set_point_disabled(5 * size + 10, false);
+	flat.set_point_disabled(5 * size + 10, false);
+	CHECK(hierarchical.get_id_path(0, size - 1).size() == flat.get_id_path(0, size - 1).size());
+
+	hierarchical.set_hierarchical(false);
+	CHECK(hierarchical.get_id_path(0, size - 1).size() == flat.get_id_path(0, size - 1).size());
+}
+
+TEST_CASE("[AStar] Concurrent path") {
+	const int size = 10;
+	AStar a;
+	build_grid(a, size);
+	a.set_point_disabled(55);
+
+	Vector<int> path = a.get_id_path(0, size * size - 1);
+	Vector<int> concurrent_path = a.get_id_path_concurrent(0, size * size - 1);
+	REQUIRE(concurrent_path.size() == path.size());
+	CHECK(concurrent_path[0] == 0);
+	CHECK(concurrent_path[concurrent_path.size() - 1] == size * size - 1);
+	CHECK(a.get_id_path_concurrent(3, 3).size() == 1);
+
+	a.disconnect_points(1, 0);
+	a.disconnect_points(size, 0);
+	CHECK(a.get_id_path_concurrent(0, size * size - 1).size() == 0);
+}
+
 TEST_CASE("[Stress][AStar] Find paths") {
 	// Random stress tests with Floyd-Warshall.
 	const int N = 30;
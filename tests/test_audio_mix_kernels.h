@@ -0,0 +1,128 @@
+/*************************************************************************/
+/*  test_audio_mix_kernels.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_AUDIO_MIX_KERNELS_H
+#define TEST_AUDIO_MIX_KERNELS_H
+
+#include "core/math/math_funcs.h"
+#include "core/templates/local_vector.h"
+#include "servers/audio/audio_mix_kernels.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioMixKernels {
+
+// Odd frame counts also cover the scalar tail after the two-frame loops.
+static const int FRAMES = 37;
+
+static AudioFrame test_frame(int p_index) {
+	return AudioFrame(Math::sin(p_index * 0.37f), Math::cos(p_index * 0.21f) * 0.5f);
+}
+
+static bool frames_approx(const AudioFrame &p_a, const AudioFrame &p_b) {
+	return Math::is_equal_approx(p_a.l, p_b.l, 1e-5f) && Math::is_equal_approx(p_a.r, p_b.r, 1e-5f);
+}
+
+TEST_CASE("[AudioMixKernels] Volume ramps") {
+	LocalVector<AudioFrame> src;
+	LocalVector<AudioFrame> scaled;
+	LocalVector<AudioFrame> mixed;
+	for (int i = 0; i < FRAMES; i++) {
+		src.push_back(test_frame(i));
+		scaled.push_back(test_frame(i));
+		mixed.push_back(test_frame(i + 100));
+	}
+
+	AudioMixKernels::scale_ramp(scaled.ptr(), FRAMES, 1.0f, -0.02f);
+	AudioMixKernels::mix_ramp(mixed.ptr(), src.ptr(), FRAMES, AudioFrame(0.5f, 0.25f), AudioFrame(0.01f, -0.005f));
+
+	bool scale_ok = true;
+	bool mix_ok = true;
+	for (int i = 0; i < FRAMES; i++) {
+		scale_ok = scale_ok && frames_approx(scaled[i], src[i] * (1.0f - 0.02f * i));
+		AudioFrame vol(0.5f + 0.01f * i, 0.25f - 0.005f * i);
+		mix_ok = mix_ok && frames_approx(mixed[i], test_frame(i + 100) + src[i] * vol);
+	}
+	CHECK_MESSAGE(scale_ok, "scale_ramp() should multiply each frame by the ramped volume.");
+	CHECK_MESSAGE(mix_ok, "mix_ramp() should add each frame scaled by the ramped volume.");
+}
+
+TEST_CASE("[AudioMixKernels] Constant volume mixing is exact") {
+	LocalVector<AudioFrame> src;
+	LocalVector<AudioFrame> mixed;
+	for (int i = 0; i < FRAMES; i++) {
+		src.push_back(test_frame(i));
+		mixed.push_back(test_frame(i + 100));
+	}
+
+	AudioMixKernels::mix(mixed.ptr(), src.ptr(), FRAMES, AudioFrame(0.5f, 2.0f));
+
+	bool ok = true;
+	for (int i = 0; i < FRAMES; i++) {
+		AudioFrame expected = test_frame(i + 100) + src[i] * AudioFrame(0.5f, 2.0f);
+		ok = ok && mixed[i].l == expected.l && mixed[i].r == expected.r;
+	}
+	CHECK(ok);
+}
+
+TEST_CASE("[AudioMixKernels] Cubic resampling") {
+	LocalVector<AudioFrame> src;
+	for (int i = 0; i < FRAMES * 2 + 4; i++) {
+		src.push_back(test_frame(i));
+	}
+
+	LocalVector<AudioFrame> dst;
+	dst.resize(FRAMES);
+	const uint64_t increment = uint64_t(1.7 * AudioMixKernels::RESAMPLE_FRAC_LEN);
+	AudioMixKernels::resample_cubic(dst.ptr(), src.ptr(), FRAMES, 0, increment);
+
+	bool ok = true;
+	uint64_t offset = 0;
+	for (int i = 0; i < FRAMES; i++) {
+		const AudioFrame *y = &src[offset >> AudioMixKernels::RESAMPLE_FRAC_BITS];
+		float mu = (offset & AudioMixKernels::RESAMPLE_FRAC_MASK) / float(AudioMixKernels::RESAMPLE_FRAC_LEN);
+		float mu2 = mu * mu;
+		AudioFrame a0 = y[3] - y[2] - y[0] + y[1];
+		AudioFrame a1 = y[0] - y[1] - a0;
+		AudioFrame a2 = y[2] - y[0];
+		ok = ok && frames_approx(dst[i], a0 * mu * mu2 + a1 * mu2 + a2 * mu + y[1]);
+		offset += increment;
+	}
+	CHECK_MESSAGE(ok, "Vectorized cubic interpolation should match the scalar formula.");
+
+	// Whole sample positions return the second input frame unchanged.
+	AudioMixKernels::resample_cubic(dst.ptr(), src.ptr(), 4, 0, AudioMixKernels::RESAMPLE_FRAC_LEN);
+	CHECK(frames_approx(dst[0], src[1]));
+	CHECK(frames_approx(dst[3], src[4]));
+}
+
+} // namespace TestAudioMixKernels
+
+#endif // TEST_AUDIO_MIX_KERNELS_H
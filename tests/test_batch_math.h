@@ -0,0 +1,140 @@
+/*************************************************************************/
+/*  test_batch_math.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_BATCH_MATH_H
+#define TEST_BATCH_MATH_H
+
+#include "core/math/batch_math.h"
+#include "core/math/random_number_generator.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBatchMath {
+
+static Transform random_transform(Ref<RandomNumberGenerator> &p_rng) {
+	Basis basis;
+	for (int i = 0; i < 3; i++) {
+		basis[i] = Vector3(p_rng->randf_range(-2, 2), p_rng->randf_range(-2, 2), p_rng->randf_range(-2, 2));
+	}
+	return Transform(basis, Vector3(p_rng->randf_range(-10, 10), p_rng->randf_range(-10, 10), p_rng->randf_range(-10, 10)));
+}
+
+static Vector<Vector3> random_points(Ref<RandomNumberGenerator> &p_rng, int p_count) {
+	Vector<Vector3> points;
+	for (int i = 0; i < p_count; i++) {
+		points.push_back(Vector3(p_rng->randf_range(-100, 100), p_rng->randf_range(-100, 100), p_rng->randf_range(-100, 100)));
+	}
+	return points;
+}
+
+TEST_CASE("[BatchMath] Transforming points matches the scalar transforms") {
+	Ref<RandomNumberGenerator> rng = memnew(RandomNumberGenerator);
+	rng->set_seed(42);
+	const Transform xform = random_transform(rng);
+
+	// Sizes around the vector width exercise the scalar tail.
+	for (int count = 0; count < 11; count++) {
+		Vector<Vector3> points = random_points(rng, count);
+		Vector<Vector3> transformed = xform.xform(points);
+		Vector<Vector3> rotated;
+		rotated.resize(count);
+		BatchMath::basis_xform(xform.basis, points.ptr(), rotated.ptrw(), count);
+
+		for (int i = 0; i < count; i++) {
+			CHECK(transformed[i] == xform.xform(points[i]));
+			CHECK(rotated[i] == xform.basis.xform(points[i]));
+		}
+
+		BatchMath::xform(xform, points.ptr(), points.ptrw(), count);
+		CHECK_MESSAGE(points == transformed, "Transforming in place gives the same result.");
+	}
+}
+
+TEST_CASE("[BatchMath] Multiplying transforms matches the scalar products") {
+	Ref<RandomNumberGenerator> rng = memnew(RandomNumberGenerator);
+	rng->set_seed(7);
+	const Transform parent = random_transform(rng);
+
+	Vector<Transform> a;
+	Vector<Transform> b;
+	for (int i = 0; i < 9; i++) {
+		a.push_back(random_transform(rng));
+		b.push_back(random_transform(rng));
+	}
+
+	// One more element than computed, which must be left untouched.
+	Vector<Transform> result;
+	result.resize(a.size() + 1);
+	const Transform guard = random_transform(rng);
+	result.write[a.size()] = guard;
+
+	BatchMath::multiply(parent, b.ptr(), result.ptrw(), b.size());
+	for (int i = 0; i < b.size(); i++) {
+		CHECK(result[i] == parent * b[i]);
+	}
+	CHECK(result[a.size()] == guard);
+
+	BatchMath::multiply(a.ptr(), b.ptr(), result.ptrw(), a.size());
+	for (int i = 0; i < a.size(); i++) {
+		CHECK(result[i] == a[i] * b[i]);
+	}
+	CHECK(result[a.size()] == guard);
+
+	Vector<Transform> in_place = b;
+	BatchMath::multiply(parent, in_place.ptr(), in_place.ptrw(), in_place.size());
+	for (int i = 0; i < b.size(); i++) {
+		CHECK(in_place[i] == parent * b[i]);
+	}
+}
+
+TEST_CASE("[BatchMath] AABB of points") {
+	Ref<RandomNumberGenerator> rng = memnew(RandomNumberGenerator);
+	rng->set_seed(1234);
+
+	CHECK(BatchMath::get_aabb(nullptr, 0) == AABB());
+
+	for (int count = 1; count < 19; count++) {
+		Vector<Vector3> points = random_points(rng, count);
+		AABB expected(points[0], Vector3());
+		for (int i = 1; i < count; i++) {
+			expected.expand_to(points[i]);
+		}
+
+		const AABB aabb = BatchMath::get_aabb(points.ptr(), count);
+		CHECK(aabb.is_equal_approx(expected));
+		for (int i = 0; i < count; i++) {
+			CHECK(aabb.grow(0.001).has_point(points[i]));
+		}
+	}
+}
+
+} // namespace TestBatchMath
+
+#endif // TEST_BATCH_MATH_H
@@ -0,0 +1,451 @@
+/*************************************************************************/
+/*  test_benchmark.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_benchmark.h"
+
+#include "core/io/json.h"
+#include "core/io/resource_loader.h"
+#include "core/io/resource_saver.h"
+#include "core/object/class_db.h"
+#include "core/object/script_language.h"
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "core/string/print_string.h"
+#include "core/string/string_name.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
+#include "core/variant/variant.h"
+#include "core/version.h"
+#include "scene/resources/curve.h"
+#include "servers/physics_3d/physics_server_3d_sw.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBenchmark {
+
+struct Benchmark {
+	const char *name = nullptr;
+	BenchmarkFunc function = nullptr;
+};
+
+static LocalVector<Benchmark> *benchmarks = nullptr;
+
+static volatile uint64_t sink = 0;
+
+void State::start() {
+	started_usec = OS::get_singleton()->get_ticks_usec();
+}
+
+void State::stop() {
+	// Accumulated, so a benchmark can pause the clock around work it doesn't want measured.
+	elapsed_usec += OS::get_singleton()->get_ticks_usec() - started_usec;
+}
+
+int register_benchmark(const char *p_name, BenchmarkFunc p_function) {
+	if (!benchmarks) {
+		benchmarks = new LocalVector<Benchmark>;
+	}
+	Benchmark benchmark;
+	benchmark.name = p_name;
+	benchmark.function = p_function;
+	benchmarks->push_back(benchmark);
+	return 0;
+}
+
+void consume(uint64_t p_value) {
+	sink = sink + p_value;
+}
+
+enum {
+	MIN_RUN_USEC = 100000, // Iterations are scaled until a run takes at least this long.
+	SAMPLES = 5,
+};
+
+static const uint64_t MAX_ITERATIONS = uint64_t(1) << 32;
+
+// Returns the nanoseconds per iteration of each sample, or an empty vector if the benchmark was skipped.
+static Vector<double> _run_benchmark(const Benchmark &p_benchmark, uint64_t &r_iterations) {
+	Vector<double> samples;
+
+	uint64_t iterations = 1;
+	while (true) {
+		State state(iterations);
+		p_benchmark.function(state);
+		if (state.is_skipped()) {
+			return samples;
+		}
+		uint64_t elapsed = state.get_elapsed_usec();
+		if (elapsed >= MIN_RUN_USEC || iterations >= MAX_ITERATIONS) {
+			break;
+		}
+		if (elapsed < 1000) {
+			iterations *= 10;
+		} else {
+			// Aim slightly past the minimum, so the samples don't need another round.
+			iterations = MAX(iterations + 1, uint64_t(double(iterations) * MIN_RUN_USEC * 1.2 / elapsed));
+		}
+	}
+
+	for (int i = 0; i < SAMPLES; i++) {
+		State state(iterations);
+		p_benchmark.function(state);
+		samples.push_back(double(state.get_elapsed_usec()) * 1000.0 / double(iterations));
+	}
+	samples.sort();
+
+	r_iterations = iterations;
+	return samples;
+}
+
+static void run_benchmarks() {
+	String filter;
+	String output_path;
+
+	List<String> args = OS::get_singleton()->get_cmdline_args();
+	for (List<String>::Element *E = args.front(); E; E = E->next()) {
+		if (E->get() == "--benchmark-filter" && E->next()) {
+			filter = E->next()->get();
+		} else if (E->get() == "--benchmark-output" && E->next()) {
+			output_path = E->next()->get();
+		}
+	}
+
+	// Languages are only set up by `Main::setup2()`, which tests don't go through.
+	ScriptServer::init_languages();
+
+	Array results;
+	for (uint32_t i = 0; benchmarks && i < benchmarks->size(); i++) {
+		const Benchmark &benchmark = (*benchmarks)[i];
+		String name = String::utf8(benchmark.name);
+		if (!filter.is_empty() && name.find(filter) == -1) {
+			continue;
+		}
+
+		uint64_t iterations = 0;
+		Vector<double> samples = _run_benchmark(benchmark, iterations);
+		if (samples.is_empty()) {
+			print_verbose("Benchmark skipped: " + name);
+			continue;
+		}
+
+		Dictionary result;
+		result["name"] = name;
+		result["iterations"] = iterations;
+		result["samples"] = SAMPLES;
+		result["ns_per_iteration"] = samples[samples.size() / 2];
+		result["min_ns_per_iteration"] = samples[0];
+		results.push_back(result);
+
+		print_verbose(vformat("%s: %.1f ns", name, samples[samples.size() / 2]));
+	}
+
+	ScriptServer::finish_languages();
+
+	Dictionary report;
+	report["engine"] = VERSION_FULL_BUILD;
+	report["benchmarks"] = results;
+	String json = JSON::print(report, "\t");
+
+	if (output_path.is_empty()) {
+		print_line(json);
+	} else {
+		FileAccessRef f = FileAccess::open(output_path, FileAccess::WRITE);
+		ERR_FAIL_COND_MSG(!f, "Can't open benchmark output file: " + output_path + ".");
+		f->store_string(json + "\n");
+	}
+
+	delete benchmarks;
+	benchmarks = nullptr;
+}
+
+REGISTER_TEST_COMMAND("--benchmark", &run_benchmarks);
+
+/* Core containers */
+
+enum {
+	CONTAINER_SIZE = 1024,
+};
+
+static void benchmark_hash_map_insert(State &p_state) {
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		HashMap<int, int> map;
+		for (int j = 0; j < CONTAINER_SIZE; j++) {
+			map.set(j * 31, j);
+		}
+		consume(map.size());
+	}
+	p_state.stop();
+}
+
+static void benchmark_hash_map_lookup(State &p_state) {
+	HashMap<int, int> map;
+	for (int j = 0; j < CONTAINER_SIZE; j++) {
+		map.set(j * 31, j);
+	}
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		uint64_t sum = 0;
+		for (int j = 0; j < CONTAINER_SIZE; j++) {
+			const int *value = map.getptr(j * 31);
+			sum += value ? *value : 0;
+		}
+		consume(sum);
+	}
+	p_state.stop();
+}
+
+static void benchmark_string_name_from_string(State &p_state) {
+	// Names are kept alive, so this measures the lookup in the global table and not the insertion.
+	Vector<String> strings;
+	Vector<StringName> names;
+	for (int j = 0; j < 256; j++) {
+		strings.push_back("benchmark_name_" + itos(j));
+		names.push_back(strings[j]);
+	}
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		StringName name = strings[i & 255];
+		consume(name.hash());
+	}
+	p_state.stop();
+}
+
+static void benchmark_string_name_hash_map_lookup(State &p_state) {
+	Vector<StringName> names;
+	HashMap<StringName, int> map;
+	for (int j = 0; j < 256; j++) {
+		names.push_back(StringName("benchmark_name_" + itos(j)));
+		map.set(names[j], j);
+	}
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		consume(*map.getptr(names[i & 255]));
+	}
+	p_state.stop();
+}
+
+static void benchmark_cow_data_copy_on_write(State &p_state) {
+	Vector<int> source;
+	source.resize(CONTAINER_SIZE);
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		Vector<int> copy = source;
+		copy.write[0] = i; // Detaches the copy.
+		consume(copy[0]);
+	}
+	p_state.stop();
+}
+
+static void benchmark_cow_data_push_back(State &p_state) {
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		Vector<int> vector;
+		for (int j = 0; j < CONTAINER_SIZE; j++) {
+			vector.push_back(j);
+		}
+		consume(vector.size());
+	}
+	p_state.stop();
+}
+
+REGISTER_BENCHMARK("HashMap/insert_1k", &benchmark_hash_map_insert);
+REGISTER_BENCHMARK("HashMap/lookup_1k", &benchmark_hash_map_lookup);
+REGISTER_BENCHMARK("StringName/from_string", &benchmark_string_name_from_string);
+REGISTER_BENCHMARK("StringName/hash_map_lookup", &benchmark_string_name_hash_map_lookup);
+REGISTER_BENCHMARK("CowData/copy_on_write_1k", &benchmark_cow_data_copy_on_write);
+REGISTER_BENCHMARK("CowData/push_back_1k", &benchmark_cow_data_push_back);
+
+/* Variant */
+
+static void benchmark_variant_call(State &p_state) {
+	Variant vector = Vector3(1, 2, 3);
+	StringName method = "length";
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		Variant ret;
+		Callable::CallError ce;
+		vector.call(method, nullptr, 0, ret, ce);
+		consume(ret.get_type());
+	}
+	p_state.stop();
+}
+
+static void benchmark_variant_evaluate(State &p_state) {
+	Variant a = 3;
+	Variant b = 2.5;
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		Variant ret;
+		bool valid;
+		Variant::evaluate(Variant::OP_MULTIPLY, a, b, ret, valid);
+		consume(valid);
+	}
+	p_state.stop();
+}
+
+REGISTER_BENCHMARK("Variant/call_builtin_method", &benchmark_variant_call);
+REGISTER_BENCHMARK("Variant/evaluate_mixed_types", &benchmark_variant_evaluate);
+
+/* GDScript */
+
+static void benchmark_gdscript_calls(State &p_state) {
+	if (!ClassDB::class_exists("GDScript")) {
+		p_state.skip();
+		return;
+	}
+
+	Ref<Script> script = Object::cast_to<Script>(ClassDB::instance("GDScript"));
+	script->set_source_code(
+			"extends Reference\n"
+			"\n"
+			"func fibonacci(n):\n"
+			"\tif n < 2:\n"
+			"\t\treturn n\n"
+			"\treturn fibonacci(n - 1) + fibonacci(n - 2)\n");
+	Error err = script->reload();
+	ERR_FAIL_COND_MSG(err != OK, "Benchmark script failed to compile.");
+
+	Ref<Reference> object = memnew(Reference);
+	object->set_script(script);
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		consume(object->call("fibonacci", 15));
+	}
+	p_state.stop();
+}
+
+REGISTER_BENCHMARK("GDScript/fibonacci_15", &benchmark_gdscript_calls);
+
+/* Resources */
+
+static void _benchmark_resource_round_trip(State &p_state, const String &p_extension) {
+	Ref<Curve> curve;
+	curve.instance();
+	curve->set_bake_resolution(256);
+	for (int j = 0; j < 256; j++) {
+		curve->add_point(Vector2(j / 256.0, Math::sin(j * 0.1) * 0.5 + 0.5));
+	}
+
+	const String path = OS::get_singleton()->get_cache_path().plus_file("benchmark_resource." + p_extension);
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		ResourceSaver::save(path, curve);
+		RES loaded = ResourceLoader::load(path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+		consume(loaded.is_valid());
+	}
+	p_state.stop();
+
+	DirAccess::remove_file_or_error(path);
+}
+
+static void benchmark_resource_text(State &p_state) {
+	_benchmark_resource_round_trip(p_state, "tres");
+}
+
+static void benchmark_resource_binary(State &p_state) {
+	_benchmark_resource_round_trip(p_state, "res");
+}
+
+REGISTER_BENCHMARK("Resource/save_load_text", &benchmark_resource_text);
+REGISTER_BENCHMARK("Resource/save_load_binary", &benchmark_resource_binary);
+
+/* Physics */
+
+// A pile of boxes settling on a plane. Sleeping is disabled so every step simulates the whole pile.
+static void benchmark_physics_3d_step(State &p_state) {
+#ifndef _3D_DISABLED
+	PhysicsServer3DSW *ps = memnew(PhysicsServer3DSW);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	ps->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+
+	RID plane = ps->plane_shape_create();
+	ps->shape_set_data(plane, Plane(Vector3(0, 1, 0), 0));
+	RID ground = ps->body_create();
+	ps->body_set_mode(ground, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_add_shape(ground, plane);
+	ps->body_set_space(ground, space);
+
+	RID box = ps->box_shape_create();
+	ps->shape_set_data(box, Vector3(0.5, 0.5, 0.5));
+
+	LocalVector<RID> bodies;
+	for (int x = 0; x < 8; x++) {
+		for (int y = 0; y < 4; y++) {
+			for (int z = 0; z < 8; z++) {
+				RID body = ps->body_create();
+				ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+				ps->body_add_shape(body, box);
+				ps->body_set_space(body, space);
+				ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform(Basis(), Vector3(x * 1.05, 0.5 + y * 1.05, z * 1.05)));
+				ps->body_set_state(body, PhysicsServer3D::BODY_STATE_CAN_SLEEP, false);
+				bodies.push_back(body);
+			}
+		}
+	}
+
+	p_state.start();
+	for (uint64_t i = 0; i < p_state.get_iterations(); i++) {
+		ps->step(1.0 / 60.0);
+		ps->flush_queries();
+	}
+	p_state.stop();
+
+	for (uint32_t i = 0; i < bodies.size(); i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(ground);
+	ps->free(box);
+	ps->free(plane);
+	ps->free(space);
+	ps->finish();
+	memdelete(ps);
+#else
+	p_state.skip();
+#endif
+}
+
+REGISTER_BENCHMARK("Physics3D/step_256_boxes", &benchmark_physics_3d_step);
+
+} // namespace TestBenchmark
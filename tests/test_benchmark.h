@@ -0,0 +1,81 @@
+/*************************************************************************/
+/*  test_benchmark.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_BENCHMARK_H
+#define TEST_BENCHMARK_H
+
+#include "core/typedefs.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+// Microbenchmarks for the engine hot paths, run with `godot --test --benchmark`.
+// Results are printed as JSON, or written to the file given with `--benchmark-output <path>`.
+// `--benchmark-filter <text>` only runs the benchmarks whose name contains the text.
+
+namespace TestBenchmark {
+
+// Passed to each benchmark, which must run its measured code `get_iterations()` times
+// between `start()` and `stop()`. Setup and teardown done outside of them isn't measured.
+// Benchmarks that depend on something disabled in this build call `skip()` instead.
+class State {
+	uint64_t iterations = 0;
+	uint64_t started_usec = 0;
+	uint64_t elapsed_usec = 0;
+	bool skipped = false;
+
+public:
+	_FORCE_INLINE_ uint64_t get_iterations() const { return iterations; }
+	_FORCE_INLINE_ uint64_t get_elapsed_usec() const { return elapsed_usec; }
+	_FORCE_INLINE_ bool is_skipped() const { return skipped; }
+
+	void start();
+	void stop();
+	void skip() { skipped = true; }
+
+	State(uint64_t p_iterations) { iterations = p_iterations; }
+};
+
+typedef void (*BenchmarkFunc)(State &p_state);
+
+int register_benchmark(const char *p_name, BenchmarkFunc p_function);
+
+// Keeps the compiler from optimizing away results that are otherwise unused.
+void consume(uint64_t p_value);
+
+} // namespace TestBenchmark
+
+// Register benchmarks to be run by `--benchmark`, usually named "Area/what_is_measured".
+// For instance: REGISTER_BENCHMARK("HashMap/insert", &benchmark_hash_map_insert).
+#define REGISTER_BENCHMARK(m_name, m_function)                          \
+	DOCTEST_GLOBAL_NO_WARNINGS(DOCTEST_ANONYMOUS(_BENCHMARK_ANON_VAR_)) = \
+			TestBenchmark::register_benchmark(m_name, m_function);        \
+	DOCTEST_GLOBAL_NO_WARNINGS_END()
+
+#endif // TEST_BENCHMARK_H
@@ -0,0 +1,127 @@
+/*************************************************************************/
+/*  test_broad_phase.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef TEST_BROAD_PHASE_H
+#define TEST_BROAD_PHASE_H
+
+#include "servers/physics_2d/body_2d_sw.h"
+#include "servers/physics_2d/broad_phase_2d_bvh.h"
+#include "servers/physics_3d/body_3d_sw.h"
+#include "servers/physics_3d/broad_phase_3d_bvh.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestBroadPhase {
+
+struct PairLog {
+	int pairs = 0;
+	int self_pairs = 0;
+};
+
+static void *pair_2d(CollisionObject2DSW *p_a, int p_subindex_a, CollisionObject2DSW *p_b, int p_subindex_b, void *p_userdata) {
+	PairLog *log = (PairLog *)p_userdata;
+	log->pairs++;
+	if (p_a == p_b) {
+		log->self_pairs++;
+	}
+	return nullptr;
+}
+
+TEST_CASE("[BroadPhase2DBVH] Shapes of the same body don't pair") {
+	BroadPhase2DBVH broad_phase;
+	PairLog log;
+	broad_phase.set_pair_callback(pair_2d, &log);
+
+	Body2DSW body;
+	Body2DSW other_body;
+
+	BroadPhase2DSW::ID shape_a = broad_phase.create(&body, 0);
+	BroadPhase2DSW::ID shape_b = broad_phase.create(&body, 1);
+	broad_phase.move(shape_a, Rect2(0, 0, 10, 10));
+	broad_phase.move(shape_b, Rect2(5, 5, 10, 10));
+	broad_phase.update();
+	broad_phase.update();
+
+	CHECK_MESSAGE(log.pairs == 0, "Overlapping shapes of one body are never paired.");
+
+	BroadPhase2DSW::ID other_shape = broad_phase.create(&other_body, 0);
+	broad_phase.move(other_shape, Rect2(2, 2, 4, 4));
+	broad_phase.update();
+
+	CHECK_MESSAGE(log.pairs == 2, "Both shapes of the first body pair with the other body.");
+	CHECK(log.self_pairs == 0);
+
+	broad_phase.remove(other_shape);
+	broad_phase.remove(shape_b);
+	broad_phase.remove(shape_a);
+}
+
+static void *pair_3d(CollisionObject3DSW *p_a, int p_subindex_a, CollisionObject3DSW *p_b, int p_subindex_b, void *p_userdata) {
+	PairLog *log = (PairLog *)p_userdata;
+	log->pairs++;
+	if (p_a == p_b) {
+		log->self_pairs++;
+	}
+	return nullptr;
+}
+
+TEST_CASE("[BroadPhase3DBVH] Shapes of the same body don't pair") {
+	BroadPhase3DBVH broad_phase;
+	PairLog log;
+	broad_phase.set_pair_callback(pair_3d, &log);
+
+	Body3DSW body;
+	Body3DSW other_body;
+
+	BroadPhase3DSW::ID shape_a = broad_phase.create(&body, 0);
+	BroadPhase3DSW::ID shape_b = broad_phase.create(&body, 1);
+	broad_phase.move(shape_a, AABB(Vector3(0, 0, 0), Vector3(1, 1, 1)));
+	broad_phase.move(shape_b, AABB(Vector3(0.5, 0.5, 0.5), Vector3(1, 1, 1)));
+	broad_phase.update();
+	broad_phase.update();
+
+	CHECK_MESSAGE(log.pairs == 0, "Overlapping shapes of one body are never paired.");
+
+	BroadPhase3DSW::ID other_shape = broad_phase.create(&other_body, 0);
+	broad_phase.move(other_shape, AABB(Vector3(0.6, 0.6, 0.6), Vector3(0.2, 0.2, 0.2)));
+	broad_phase.update();
+
+	CHECK_MESSAGE(log.pairs == 2, "Both shapes of the first body pair with the other body.");
+	CHECK(log.self_pairs == 0);
+
+	broad_phase.remove(other_shape);
+	broad_phase.remove(shape_b);
+	broad_phase.remove(shape_a);
+}
+
+} // namespace TestBroadPhase
+
+#endif // TEST_BROAD_PHASE_H
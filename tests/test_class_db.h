@@ -649,7 +649,7 @@ void add_exposed_classes(Context &r_context) {
 
 		// Add signals
 
-		const HashMap<StringName, MethodInfo> &signal_map = class_info->signal_map;
+		const FlatHashMap<StringName, MethodInfo> &signal_map = class_info->signal_map;
 		const StringName *k = nullptr;
 
 		while ((k = signal_map.next(k))) {
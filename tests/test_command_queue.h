@@ -470,6 +470,39 @@ TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING,
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
+
+class PushFromOtherThread {
+public:
+	CommandQueueMT command_queue = CommandQueueMT(false);
+	int func_count = 0;
+
+	void func() {
+		func_count++;
+	}
+	static void static_push_func(void *p_ud) {
+		PushFromOtherThread *self = static_cast<PushFromOtherThread *>(p_ud);
+		self->command_queue.push(self, &PushFromOtherThread::func);
+	}
+	void push_from_thread_and_wait() {
+		Thread thread;
+		thread.start(&PushFromOtherThread::static_push_func, this);
+		thread.wait_to_finish();
+	}
+};
+
+TEST_CASE("[CommandQueue] Test Pushing While Flushing") {
+	PushFromOtherThread pt;
+
+	// Would deadlock if the queue stayed locked while commands run.
+	pt.command_queue.push(&pt, &PushFromOtherThread::push_from_thread_and_wait);
+	pt.command_queue.flush_all();
+	CHECK_MESSAGE(pt.func_count == 0,
+			"Messages pushed during flush_all should be left for the next flush.");
+
+	pt.command_queue.flush_all();
+	CHECK_MESSAGE(pt.func_count == 1,
+			"Message pushed from another thread during the previous flush should be read.");
+}
 } // namespace TestCommandQueue
 
 #endif // !defined(NO_THREADS)
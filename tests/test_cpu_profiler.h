@@ -0,0 +1,113 @@
+/*************************************************************************/
+/*  test_cpu_profiler.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_CPU_PROFILER_H
+#define TEST_CPU_PROFILER_H
+
+#include "core/debugger/cpu_profiler.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCPUProfiler {
+
+TEST_CASE("[CPUProfiler] Nested scopes") {
+	CPUProfiler::set_enabled(true);
+	{
+		CPUProfiler::Scope outer("outer");
+		CPUProfiler::Scope inner("inner");
+	}
+	CPUProfiler::set_enabled(false);
+
+	{
+		CPUProfiler::Scope ignored("ignored");
+	}
+
+	Array events;
+	CPUProfiler::collect(events);
+	REQUIRE_MESSAGE(
+			events.size() == 10,
+			"Two events should be recorded while enabled, and none after.");
+
+	// Scopes are recorded when they end, so the inner one comes first.
+	CHECK(String(events[1]) == "inner");
+	CHECK(int(events[4]) == 1);
+	CHECK(String(events[6]) == "outer");
+	CHECK(int(events[9]) == 0);
+	CHECK(uint64_t(events[7]) <= uint64_t(events[2]));
+	CHECK(uint64_t(events[3]) <= uint64_t(events[8]));
+
+	Array collected_again;
+	CPUProfiler::collect(collected_again);
+	CHECK_MESSAGE(
+			collected_again.is_empty(),
+			"Events should only be collected once.");
+
+	String trace = CPUProfiler::to_chrome_trace(events);
+	CHECK(trace.begins_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[{\"name\":\"inner\",\"ph\":\"X\""));
+	CHECK(trace.ends_with("}]}"));
+}
+
+static void _profiled_thread(void *p_userdata) {
+	CPUProfiler::Scope scope("thread");
+}
+
+TEST_CASE("[CPUProfiler] Threads and finish") {
+	CPUProfiler::set_enabled(true);
+	Thread thread;
+	thread.start(_profiled_thread, nullptr);
+	thread.wait_to_finish();
+
+	Array events;
+	CPUProfiler::collect(events);
+	REQUIRE_MESSAGE(
+			events.size() == 5,
+			"The events of a thread which exited should still be collected.");
+	CHECK(String(events[1]) == "thread");
+
+	CPUProfiler::finish();
+	CPUProfiler::set_enabled(true);
+	{
+		CPUProfiler::Scope scope("after_finish");
+	}
+	CPUProfiler::set_enabled(false);
+
+	Array events_after_finish;
+	CPUProfiler::collect(events_after_finish);
+	REQUIRE_MESSAGE(
+			events_after_finish.size() == 5,
+			"Recording should work again after finish() freed the buffers.");
+	CHECK(String(events_after_finish[1]) == "after_finish");
+	CPUProfiler::finish();
+}
+
+} // namespace TestCPUProfiler
+
+#endif // TEST_CPU_PROFILER_H
@@ -216,6 +216,47 @@ TEST_CASE("[Curve] Custom curve with linear tangents") {
 			Math::is_equal_approx(curve->interpolate_baked(0.7), 0.8),
 			"Custom free curve should return the expected baked value at offset 0.7 after removing point at invalid index 10.");
 }
+
+TEST_CASE("[Curve3D] Editing points bakes the same as a new curve") {
+	Ref<Curve3D> curve = memnew(Curve3D);
+	for (int i = 0; i < 50; i++) {
+		curve->add_point(Vector3(i * 2.0, Math::sin(i * 0.5) * 3.0, Math::cos(i * 0.3) * 2.0), Vector3(-0.5, 0, 0), Vector3(0.5, 0, 0));
+	}
+	curve->set_point_tilt(10, 0.5);
+	curve->get_baked_length();
+
+	curve->set_point_position(40, Vector3(80, 5, -3));
+	curve->set_point_tilt(45, 1.0);
+	curve->add_point(Vector3(110, 0, 0));
+	curve->remove_point(30);
+
+	Ref<Curve3D> expected = memnew(Curve3D);
+	for (int i = 0; i < curve->get_point_count(); i++) {
+		expected->add_point(curve->get_point_position(i), curve->get_point_in(i), curve->get_point_out(i));
+		expected->set_point_tilt(i, curve->get_point_tilt(i));
+	}
+
+	CHECK(curve->get_baked_length() == expected->get_baked_length());
+	CHECK_MESSAGE(
+			curve->get_baked_points() == expected->get_baked_points(),
+			"Only baking the edited segments again should give the same points as baking everything.");
+	CHECK(curve->get_baked_tilts() == expected->get_baked_tilts());
+	CHECK(curve->get_baked_up_vectors() == expected->get_baked_up_vectors());
+}
+
+TEST_CASE("[Curve3D] Closest point queries") {
+	Ref<Curve3D> curve = memnew(Curve3D);
+	for (int i = 0; i < 100; i++) {
+		curve->add_point(Vector3(i, Math::sin(i * 0.2) * 10.0, 0));
+	}
+
+	const PackedVector3Array points = curve->get_baked_points();
+	for (int i = 0; i < points.size(); i += 37) {
+		Vector3 above = points[i] + Vector3(0, 0, 0.01);
+		CHECK(curve->get_closest_point(above).distance_to(points[i]) < 0.01);
+		CHECK(curve->get_closest_offset(above) == doctest::Approx(i * curve->get_bake_interval()).epsilon(0.01));
+	}
+}
 } // namespace TestCurve
 
 #endif // TEST_CURVE_H
@@ -32,6 +32,7 @@
 #define TEST_EXPRESSION_H
 
 #include "core/math/expression.h"
+#include "core/templates/thread_work_pool.h"
 
 #include "tests/test_macros.h"
 
@@ -439,6 +440,102 @@ TEST_CASE("[Expression] Unusual expressions") {
 	//		int64_t(expression.execute()) == 0,
 	//		"`(-9223372036854775807 - 1) / -1` should return the expected result.");
 }
+
+TEST_CASE("[Expression] Reusing a parsed expression") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("price");
+	parameter_names.push_back("stock");
+	CHECK_MESSAGE(
+			expression.parse("price * (1.0 + 0.25 * 2) + max(stock, 10) - Vector2(3, 4).length()", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	for (int i = 0; i < 100; i++) {
+		Array values;
+		values.push_back(float(i));
+		values.push_back(i);
+		CHECK_MESSAGE(
+				double(expression.execute(values)) == doctest::Approx(i * 1.5 + MAX(i, 10) - 5.0),
+				"The expression should return the expected result on every execution.");
+	}
+
+	Array values_invalid;
+	values_invalid.push_back("cheap");
+	values_invalid.push_back(1);
+	ERR_PRINT_OFF;
+	expression.execute(values_invalid);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Invalid operands should make the execution fail.");
+
+	Array values_valid;
+	values_valid.push_back(2.0);
+	values_valid.push_back(20);
+	CHECK_MESSAGE(
+			double(expression.execute(values_valid)) == doctest::Approx(18.0),
+			"A failed execution shouldn't affect the next ones.");
+	CHECK_MESSAGE(
+			!expression.has_execute_failed(),
+			"The execution should succeed.");
+
+	// Methods called on inputs must not modify them.
+	PackedStringArray array_names;
+	array_names.push_back("items");
+	CHECK_MESSAGE(
+			expression.parse("items.size() + items.count(1)", array_names) == OK,
+			"The expression should parse successfully.");
+	Array items;
+	items.push_back(1);
+	items.push_back(2);
+	Array values_items;
+	values_items.push_back(items);
+	CHECK(int(expression.execute(values_items)) == 3);
+	CHECK(int(expression.execute(values_items)) == 3);
+	CHECK(items.size() == 2);
+}
+
+struct _ConcurrentExpression {
+	Expression *expression = nullptr;
+	LocalVector<double> results;
+
+	void evaluate(uint32_t p_index, void *p_userdata) {
+		Array values;
+		values.push_back(double(p_index));
+		results[p_index] = expression->execute(values, nullptr, false);
+	}
+};
+
+TEST_CASE("[Expression] Concurrent execution") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("x");
+	CHECK_MESSAGE(
+			expression.parse("x * x + sqrt(16.0) - x", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	_ConcurrentExpression concurrent;
+	concurrent.expression = &expression;
+	concurrent.results.resize(10000);
+
+	ThreadWorkPool work_pool;
+	work_pool.init();
+	work_pool.do_work(concurrent.results.size(), &concurrent, &_ConcurrentExpression::evaluate, nullptr);
+	work_pool.finish();
+
+	bool all_valid = true;
+	for (uint32_t i = 0; i < concurrent.results.size(); i++) {
+		if (concurrent.results[i] != double(i) * i + 4.0 - i) {
+			all_valid = false;
+			break;
+		}
+	}
+	CHECK_MESSAGE(
+			all_valid,
+			"Executing the same expression from several threads should return the expected results.");
+}
 } // namespace TestExpression
 
 #endif // TEST_EXPRESSION_H
@@ -31,7 +31,9 @@
 #ifndef TEST_FILE_ACCESS_H
 #define TEST_FILE_ACCESS_H
 
+#include "core/io/file_access_encrypted.h"
 #include "core/os/file_access.h"
+#include "core/os/os.h"
 #include "test_utils.h"
 
 namespace TestFileAccess {
@@ -60,6 +62,76 @@ TEST_CASE("[FileAccess] CSV read") {
 	f->close();
 	memdelete(f);
 }
+
+TEST_CASE("[FileAccess] Multi-byte reads") {
+	const String path = OS::get_singleton()->get_cache_path().plus_file("file_access_multi_byte.bin");
+	const uint8_t bytes[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E };
+	{
+		FileAccessRef f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f);
+		f->store_buffer(bytes, sizeof(bytes));
+	}
+
+	FileAccessRef f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f);
+	f->set_access_pattern(FileAccess::ACCESS_PATTERN_SEQUENTIAL);
+	f->prefetch(0, 0);
+
+	CHECK(f->get_16() == 0x0201);
+	CHECK(f->get_32() == 0x06050403);
+	CHECK(f->get_64() == 0x0E0D0C0B0A090807);
+	CHECK(!f->eof_reached());
+
+	f->seek(0);
+	f->set_endian_swap(true);
+	CHECK(f->get_16() == 0x0102);
+	CHECK(f->get_32() == 0x03040506);
+	CHECK(f->get_64() == 0x0708090A0B0C0D0E);
+
+	// Past the end, only the bytes that were there are read.
+	f->seek(12);
+	f->set_endian_swap(false);
+	CHECK(f->get_32() == 0x0E0D);
+	CHECK(f->eof_reached());
+}
+
+TEST_CASE("[FileAccess] Encrypted round trip") {
+	const String path = OS::get_singleton()->get_cache_path().plus_file("file_access_encrypted.bin");
+
+	Vector<uint8_t> key;
+	key.resize(32);
+	for (int i = 0; i < key.size(); i++) {
+		key.write[i] = i * 7;
+	}
+
+	// Large and unaligned enough to be decrypted in several chunks, the last one partial.
+	Vector<uint8_t> data;
+	data.resize(1024 * 1024 + 1000);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 31) ^ (i >> 8);
+	}
+
+	{
+		FileAccess *f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f);
+		FileAccessEncrypted *fae = memnew(FileAccessEncrypted);
+		REQUIRE(fae->open_and_parse(f, key, FileAccessEncrypted::MODE_WRITE_AES256) == OK);
+		fae->store_buffer(data.ptr(), data.size());
+		fae->close();
+		memdelete(fae);
+	}
+
+	FileAccess *f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f);
+	FileAccessEncrypted *fae = memnew(FileAccessEncrypted);
+	CHECK_MESSAGE(fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ) == OK, "The MD5 sum of the decrypted data matches.");
+	Vector<uint8_t> read;
+	read.resize(fae->get_len());
+	fae->get_buffer(read.ptrw(), read.size());
+	CHECK(read == data);
+	fae->close();
+	memdelete(fae);
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
@@ -0,0 +1,122 @@
+/*************************************************************************/
+/*  flat_hash_map.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_FLAT_HASH_MAP_H
+#define TEST_FLAT_HASH_MAP_H
+
+#include "core/string/ustring.h"
+#include "core/templates/flat_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFlatHashMap {
+
+TEST_CASE("[FlatHashMap] Insert, lookup and erase") {
+	FlatHashMap<int, int> map;
+	CHECK(map.is_empty());
+	CHECK(map.getptr(1) == nullptr);
+
+	for (int i = 0; i < 1000; i++) {
+		map.set(i, i * 2);
+	}
+	CHECK(map.size() == 1000);
+	for (int i = 0; i < 1000; i++) {
+		CHECK(map.has(i));
+		CHECK(map.get(i) == i * 2);
+	}
+	CHECK(!map.has(1000));
+
+	map.set(10, -1);
+	CHECK_MESSAGE(map.size() == 1000, "Setting an existing key should not add a new element.");
+	CHECK(map[10] == -1);
+
+	for (int i = 0; i < 1000; i += 2) {
+		CHECK(map.erase(i));
+	}
+	CHECK(!map.erase(0));
+	CHECK(map.size() == 500);
+	for (int i = 0; i < 1000; i++) {
+		CHECK(map.has(i) == (i % 2 == 1));
+	}
+}
+
+TEST_CASE("[FlatHashMap] Erased slots are reused") {
+	FlatHashMap<int, int> map;
+	// Churning through many keys while keeping the size small must not grow the table forever.
+	for (int i = 0; i < 100000; i++) {
+		map.set(i, i);
+		if (i >= 8) {
+			CHECK(map.erase(i - 8));
+		}
+	}
+	CHECK(map.size() == 8);
+	for (int i = 100000 - 8; i < 100000; i++) {
+		CHECK(map.get(i) == i);
+	}
+}
+
+TEST_CASE("[FlatHashMap] Iteration and copies") {
+	FlatHashMap<String, int> map;
+	map["a"] = 1;
+	map["b"] = 2;
+	map["c"] = 3;
+
+	int sum = 0;
+	int count = 0;
+	const String *k = nullptr;
+	while ((k = map.next(k))) {
+		sum += map[*k];
+		count++;
+	}
+	CHECK(count == 3);
+	CHECK(sum == 6);
+
+	FlatHashMap<String, int> copy = map;
+	map["a"] = 10;
+	CHECK_MESSAGE(copy["a"] == 1, "Copies should not share storage.");
+
+	// Erasing through a key stored in the map itself, as Object does on destruction.
+	while ((k = copy.next(nullptr))) {
+		copy.erase(*k);
+	}
+	CHECK(copy.is_empty());
+
+	List<String> keys;
+	map.get_key_list(&keys);
+	CHECK(keys.size() == 3);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.has("a"));
+}
+
+} // namespace TestFlatHashMap
+
+#endif // TEST_FLAT_HASH_MAP_H
@@ -0,0 +1,107 @@
+/*************************************************************************/
+/*  test_frame_arena.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_FRAME_ARENA_H
+#define TEST_FRAME_ARENA_H
+
+#include "core/templates/frame_arena.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Rewinds once every block is freed") {
+	FrameArena arena;
+
+	uint8_t *a = (uint8_t *)arena.alloc(100);
+	uint8_t *b = (uint8_t *)arena.alloc(100);
+	CHECK(arena.get_live_blocks() == 2);
+	CHECK_MESSAGE(((uintptr_t)a & 15) == 0, "Blocks should be 16-byte aligned.");
+	CHECK(b > a);
+
+	arena.free(a);
+	arena.free(b);
+	CHECK(arena.get_live_blocks() == 0);
+
+	CHECK_MESSAGE(
+			arena.alloc(100) == a,
+			"The arena should reuse its memory from the start after rewinding.");
+}
+
+TEST_CASE("[FrameArena] Growing past a chunk") {
+	FrameArena arena;
+
+	uint8_t *small = (uint8_t *)arena.alloc(16);
+	small[0] = 42;
+	CHECK_MESSAGE(
+			arena.realloc(small, 1024) == small,
+			"The most recent block should be grown in place when it fits.");
+
+	uint8_t *large = (uint8_t *)arena.alloc(1024 * 1024);
+	large[1024 * 1024 - 1] = 7;
+	const size_t capacity = arena.get_capacity();
+	CHECK(capacity >= 1024 * 1024);
+
+	// Older blocks are moved and keep their contents.
+	uint8_t *small_grown = (uint8_t *)arena.realloc(small, 64 * 1024);
+	CHECK(small_grown != small);
+	CHECK(small_grown[0] == 42);
+
+	arena.free(large);
+	arena.free(small_grown);
+	CHECK_MESSAGE(
+			arena.get_capacity() >= capacity,
+			"Overflow chunks should be merged into one chunk large enough for the next round.");
+}
+
+TEST_CASE("[FrameArena] Containers") {
+	FrameArena &arena = FrameArena::get_thread_arena();
+	const uint32_t live_blocks = arena.get_live_blocks();
+	{
+		LocalVector<int, uint32_t, false, FrameArenaAllocator> vector;
+		Map<int, int, Comparator<int>, FrameArenaAllocator> map;
+		for (int i = 0; i < 1000; i++) {
+			vector.push_back(i);
+			map[i] = i * 2;
+		}
+		CHECK(vector[999] == 999);
+		CHECK(map[500] == 1000);
+		CHECK(arena.get_live_blocks() > live_blocks);
+	}
+	CHECK_MESSAGE(
+			arena.get_live_blocks() == live_blocks,
+			"Containers should return all of their blocks when destroyed.");
+}
+
+} // namespace TestFrameArena
+
+#endif // TEST_FRAME_ARENA_H
@@ -33,6 +33,7 @@
 
 #include "core/io/file_access_pack.h"
 #include "core/io/image.h"
+#include "core/io/image_loader.h"
 #include "test_utils.h"
 
 #include "thirdparty/doctest/doctest.h"
@@ -148,6 +149,43 @@ TEST_CASE("[Image] Saving and loading") {
 			"The TGA image should load successfully.");
 }
 
+TEST_CASE("[Image] Loading several images at once") {
+	Vector<String> paths;
+	Vector<Ref<Image>> saved;
+	for (int i = 0; i < 4; i++) {
+		Ref<Image> image = memnew(Image(4 + i, 4, false, Image::FORMAT_RGBA8));
+		image->fill(Color(0.25 * i, 0.5, 1.0, 1.0));
+		const String path = OS::get_singleton()->get_cache_path().plus_file("image_batch_" + itos(i) + ".png");
+		REQUIRE(image->save_png(path) == OK);
+		paths.push_back(path);
+		saved.push_back(image);
+	}
+	paths.push_back(OS::get_singleton()->get_cache_path().plus_file("image_batch_missing.png"));
+
+	Vector<Error> errors;
+	ERR_PRINT_OFF;
+	Vector<Ref<Image>> images = ImageLoader::load_images(paths, &errors);
+	ERR_PRINT_ON;
+
+	REQUIRE(images.size() == paths.size());
+	REQUIRE(errors.size() == paths.size());
+	for (int i = 0; i < saved.size(); i++) {
+		CHECK_MESSAGE(
+				errors[i] == OK,
+				"Each existing image should load successfully.");
+		REQUIRE(images[i].is_valid());
+		CHECK_MESSAGE(
+				images[i]->get_data() == saved[i]->get_data(),
+				"The images should be returned in the order of the paths.");
+	}
+	CHECK_MESSAGE(
+			errors[saved.size()] != OK,
+			"A missing file should report an error.");
+	CHECK_MESSAGE(
+			images[saved.size()].is_null(),
+			"A missing file should get a null image.");
+}
+
 TEST_CASE("[Image] Basic getters") {
 	Ref<Image> image = memnew(Image(8, 4, false, Image::FORMAT_LA8));
 	CHECK(image->get_width() == 8);
@@ -255,5 +293,66 @@ TEST_CASE("[Image] Modifying pixels of an image") {
 			image3->get_pixel(1, 0).is_equal_approx(Color(0, 0, 0, 0)),
 			"flip_y() should not leave old pixels behind.");
 }
+
+TEST_CASE("[Image] Mipmap generation and format conversion") {
+	// Large enough to be processed in parallel bands, with odd sizes for the scalar tails.
+	const int sizes[2][2] = { { 7, 5 }, { 1030, 600 } };
+
+	for (int s = 0; s < 2; s++) {
+		int width = sizes[s][0];
+		int height = sizes[s][1];
+
+		Vector<uint8_t> data;
+		data.resize(width * height * 4);
+		for (int i = 0; i < data.size(); i++) {
+			data.write[i] = (i * 37 + i / 7) & 0xFF;
+		}
+
+		Ref<Image> image = memnew(Image(width, height, false, Image::FORMAT_RGBA8, data));
+		image->generate_mipmaps();
+
+		const uint8_t *r = image->get_data().ptr();
+		const uint8_t *mip = r + image->get_mipmap_offset(1);
+		int mip_width = width / 2;
+		bool matches = true;
+		for (int y = 0; y < height / 2; y++) {
+			for (int x = 0; x < mip_width; x++) {
+				for (int c = 0; c < 4; c++) {
+					int a = r[((y * 2) * width + x * 2) * 4 + c];
+					int b = r[((y * 2) * width + x * 2 + 1) * 4 + c];
+					int d = r[((y * 2 + 1) * width + x * 2) * 4 + c];
+					int e = r[((y * 2 + 1) * width + x * 2 + 1) * 4 + c];
+					matches = matches && mip[(y * mip_width + x) * 4 + c] == ((a + b + d + e + 2) >> 2);
+				}
+			}
+		}
+		CHECK_MESSAGE(
+				matches,
+				"generate_mipmaps() should round the average of each 2x2 block of RGBA8 pixels.");
+
+		Ref<Image> image_float = memnew(Image(width, height, false, Image::FORMAT_RGBA8, data));
+		image_float->convert(Image::FORMAT_RGBAF);
+		CHECK_MESSAGE(
+				image_float->get_pixel(3, 2).is_equal_approx(Color(data[(2 * width + 3) * 4] / 255.0, data[(2 * width + 3) * 4 + 1] / 255.0, data[(2 * width + 3) * 4 + 2] / 255.0, data[(2 * width + 3) * 4 + 3] / 255.0)),
+				"Converting RGBA8 to RGBAF should keep the colors.");
+		image_float->convert(Image::FORMAT_RGBA8);
+		const uint8_t *back = image_float->get_data().ptr();
+		int max_difference = 0;
+		for (int i = 0; i < data.size(); i++) {
+			max_difference = MAX(max_difference, ABS(int(back[i]) - int(data[i])));
+		}
+		// set_pixel() truncates, so a value can come back one step lower.
+		CHECK_MESSAGE(
+				max_difference <= 1,
+				"Converting RGBAF back to RGBA8 should give the original data.");
+
+		Ref<Image> image_rgb = memnew(Image(width, height, false, Image::FORMAT_RGBA8, data));
+		image_rgb->convert(Image::FORMAT_RGB8);
+		image_rgb->convert(Image::FORMAT_RGBAF);
+		CHECK_MESSAGE(
+				image_rgb->get_pixel(1, 1).a == 1.0,
+				"Converting RGB8 to RGBAF should make the image opaque.");
+	}
+}
 } // namespace TestImage
 #endif // TEST_IMAGE_H
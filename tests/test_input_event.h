@@ -0,0 +1,115 @@
+/*************************************************************************/
+/*  test_input_event.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_INPUT_EVENT_H
+#define TEST_INPUT_EVENT_H
+
+#include "core/input/input_event.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestInputEvent {
+
+static Ref<InputEventMouseMotion> make_motion(const Vector2 &p_position, const Vector2 &p_relative, float p_pressure) {
+	Ref<InputEventMouseMotion> motion;
+	motion.instance();
+	motion->set_position(p_position);
+	motion->set_global_position(p_position);
+	motion->set_relative(p_relative);
+	motion->set_pressure(p_pressure);
+	return motion;
+}
+
+TEST_CASE("[InputEvent] Accumulated mouse motion keeps the merged events") {
+	Ref<InputEventMouseMotion> motion = make_motion(Vector2(10, 10), Vector2(1, 0), 0.1);
+	CHECK(motion->get_coalesced_events().size() == 0);
+
+	CHECK(motion->accumulate(make_motion(Vector2(12, 10), Vector2(2, 0), 0.2)));
+	CHECK(motion->accumulate(make_motion(Vector2(15, 11), Vector2(3, 1), 0.3)));
+	CHECK(motion->get_position() == Vector2(15, 11));
+	CHECK(motion->get_relative() == Vector2(6, 1));
+	CHECK(motion->get_pressure() == doctest::Approx(0.3));
+
+	Array events = motion->get_coalesced_events();
+	REQUIRE(events.size() == 3);
+	Ref<InputEventMouseMotion> first = events[0];
+	Ref<InputEventMouseMotion> last = events[2];
+	CHECK(first->get_position() == Vector2(10, 10));
+	CHECK(first->get_pressure() == doctest::Approx(0.1));
+	CHECK(last->get_position() == motion->get_position());
+
+	Ref<InputEventMouseButton> button;
+	button.instance();
+	CHECK_FALSE(motion->accumulate(button));
+}
+
+TEST_CASE("[InputEvent] Coalesced mouse motion follows the event transforms") {
+	Ref<InputEventMouseMotion> motion = make_motion(Vector2(10, 10), Vector2(1, 0), 0.0);
+	motion->accumulate(make_motion(Vector2(20, 10), Vector2(10, 0), 0.0));
+
+	const Transform2D xform = Transform2D(0.0, Vector2(-5, 0)).scaled(Vector2(2, 2));
+	Ref<InputEventMouseMotion> local = motion->xformed_by(xform, Vector2(1, 1));
+	local = local->xformed_by(Transform2D(0.0, Vector2(0, 3)));
+
+	Array events = local->get_coalesced_events();
+	REQUIRE(events.size() == 2);
+	Ref<InputEventMouseMotion> first = events[0];
+	Ref<InputEventMouseMotion> last = events[1];
+	CHECK(last->get_position().is_equal_approx(local->get_position()));
+	CHECK(first->get_position().is_equal_approx(xform.xform(Vector2(11, 11)) + Vector2(0, 3)));
+	CHECK(first->get_relative().is_equal_approx(xform.basis_xform(Vector2(1, 0))));
+	CHECK(first->get_global_position() == Vector2(10, 10));
+}
+
+TEST_CASE("[InputEvent] Screen drags are accumulated per finger") {
+	Ref<InputEventScreenDrag> drag;
+	drag.instance();
+	drag->set_index(0);
+	drag->set_relative(Vector2(1, 1));
+
+	Ref<InputEventScreenDrag> same;
+	same.instance();
+	same->set_index(0);
+	same->set_position(Vector2(5, 5));
+	same->set_relative(Vector2(2, 2));
+
+	Ref<InputEventScreenDrag> other;
+	other.instance();
+	other->set_index(1);
+
+	CHECK(drag->accumulate(same));
+	CHECK(drag->get_position() == Vector2(5, 5));
+	CHECK(drag->get_relative() == Vector2(3, 3));
+	CHECK_FALSE(drag->accumulate(other));
+}
+
+} // namespace TestInputEvent
+
+#endif // TEST_INPUT_EVENT_H
@@ -161,6 +161,116 @@ TEST_CASE("[JSON] Parsing objects (dictionaries)") {
 			dictionary["empty_object"].hash() == Dictionary().hash(),
 			"The parsed JSON should contain the expected values.");
 }
+
+TEST_CASE("[JSON] Parsing UTF-8 buffers") {
+	Variant result;
+	String err_str;
+	int err_line;
+
+	const CharString utf8 = String::utf8(R"({"text": "Gödot \"engine\"\n\u00e9\ud83d\ude00", "numbers": [-20, 0.5, 1e3, 12345678901234567]})").utf8();
+	Error err = JSON::parse_utf8((const uint8_t *)utf8.get_data(), utf8.length(), result, err_str, err_line);
+	CHECK_MESSAGE(
+			err == OK,
+			"Parsing a UTF-8 buffer as JSON should parse successfully.");
+
+	const Dictionary dictionary = result;
+	CHECK_MESSAGE(
+			dictionary["text"] == String::utf8("Gödot \"engine\"\né😀"),
+			"Escaped and non-ASCII characters should be decoded.");
+	const Array numbers = dictionary["numbers"];
+	CHECK_MESSAGE(
+			Math::is_equal_approx(numbers[0], -20),
+			"The parsed JSON should contain the expected values.");
+	CHECK_MESSAGE(
+			Math::is_equal_approx(numbers[1], 0.5),
+			"The parsed JSON should contain the expected values.");
+	CHECK_MESSAGE(
+			Math::is_equal_approx(numbers[2], 1000),
+			"The parsed JSON should contain the expected values.");
+	CHECK_MESSAGE(
+			Math::is_equal_approx(numbers[3], 12345678901234567.0),
+			"The parsed JSON should contain the expected values.");
+
+	err = JSON::parse("[\"a\",\n\"b\",\n\"c\"", result, err_str, err_line);
+	CHECK_MESSAGE(
+			err == ERR_PARSE_ERROR,
+			"Parsing an unterminated array should fail.");
+	CHECK_MESSAGE(
+			err_line == 2,
+			"The error should be reported on the last line.");
+}
+
+TEST_CASE("[JSON] Streaming parser") {
+	class Counter : public JSON::StreamHandler {
+	public:
+		int objects = 0;
+		int arrays = 0;
+		int keys = 0;
+		int values = 0;
+
+		virtual bool begin_object() override {
+			objects++;
+			return true;
+		}
+		virtual bool object_key(const String &p_key) override {
+			keys++;
+			return true;
+		}
+		virtual bool end_object() override { return true; }
+		virtual bool begin_array() override {
+			arrays++;
+			return true;
+		}
+		virtual bool end_array() override { return true; }
+		virtual bool value(const Variant &p_value) override {
+			values++;
+			return values < 5;
+		}
+	};
+
+	String err_str;
+	int err_line;
+
+	Counter counter;
+	const CharString utf8 = String(R"({"a": [1, 2, {"b": null}], "c": true})").utf8();
+	Error err = JSON::parse_stream((const uint8_t *)utf8.get_data(), utf8.length(), &counter, err_str, err_line);
+	CHECK_MESSAGE(
+			err == OK,
+			"Streaming a JSON document should parse successfully.");
+	CHECK_MESSAGE(
+			(counter.objects == 2 && counter.arrays == 1 && counter.keys == 3 && counter.values == 4),
+			"Every value of the document should be reported.");
+
+	Counter stopping;
+	const CharString long_utf8 = String("[1, 2, 3, 4, 5, 6]").utf8();
+	err = JSON::parse_stream((const uint8_t *)long_utf8.get_data(), long_utf8.length(), &stopping, err_str, err_line);
+	CHECK_MESSAGE(
+			err == ERR_SKIP,
+			"A handler returning false should stop the parse.");
+	CHECK_MESSAGE(
+			stopping.values == 5,
+			"No value should be reported after the parse is stopped.");
+}
+
+TEST_CASE("[JSON] Printing") {
+	Dictionary dictionary;
+	dictionary["b"] = 1;
+	Array array;
+	array.push_back(true);
+	array.push_back(Variant());
+	array.push_back("a \"quoted\"\tstring");
+	dictionary["a"] = array;
+
+	CHECK_MESSAGE(
+			JSON::print(dictionary) == R"({"a":[true,null,"a \"quoted\"\tstring"],"b":1})",
+			"Printing should escape strings and sort the keys.");
+	CHECK_MESSAGE(
+			JSON::print(dictionary, "\t") == "{\n\t\"a\": [\n\t\ttrue,\n\t\tnull,\n\t\t\"a \\\"quoted\\\"\\tstring\"\n\t],\n\t\"b\": 1\n}",
+			"Printing with an indent should put each value on its own line.");
+	CHECK_MESSAGE(
+			JSON::print(Array(), "\t") == "[\n\n]",
+			"Printing an empty array with an indent should match the previous output.");
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -324,6 +324,120 @@ TEST_CASE("[Marshalls] FLOAT double precision Variant decoding") {
 	CHECK(r_len == 12);
 	CHECK(variant == Variant(0.33333333333333333));
 }
+
+TEST_CASE("[Marshalls] Varint encoding") {
+	uint8_t buffer[10];
+	uint64_t value;
+
+	CHECK(encode_varint(0, buffer) == 1);
+	CHECK(buffer[0] == 0x00);
+
+	CHECK(encode_varint(300, buffer) == 2);
+	CHECK(buffer[0] == 0xac);
+	CHECK(buffer[1] == 0x02);
+	CHECK(decode_varint(buffer, 2, value) == 2);
+	CHECK(value == 300);
+	CHECK_MESSAGE(decode_varint(buffer, 1, value) == 0, "A truncated varint should fail to decode");
+
+	CHECK(encode_varint(UINT64_MAX, buffer) == 10);
+	CHECK(decode_varint(buffer, 10, value) == 10);
+	CHECK(value == UINT64_MAX);
+
+	CHECK(encode_zigzag(-1) == 1);
+	CHECK(encode_zigzag(1) == 2);
+	CHECK(decode_zigzag(encode_zigzag(INT64_MIN)) == INT64_MIN);
+	CHECK(decode_zigzag(encode_zigzag(-123456)) == -123456);
+}
+
+TEST_CASE("[Marshalls] Packed array Variant round trip") {
+	PackedInt64Array ints;
+	ints.push_back(0x0123456789abcdef);
+	ints.push_back(-2);
+	PackedVector3Array vectors;
+	vectors.push_back(Vector3(1, 2, 3));
+	vectors.push_back(Vector3(-4, 5.5, 6));
+
+	Variant values[] = { ints, vectors };
+	for (const Variant &value : values) {
+		int len;
+		CHECK(encode_variant(value, nullptr, len) == OK);
+		Vector<uint8_t> buffer;
+		buffer.resize(len);
+		CHECK(encode_variant(value, buffer.ptrw(), len) == OK);
+
+		Variant decoded;
+		int r_len;
+		CHECK(decode_variant(decoded, buffer.ptr(), len, &r_len) == OK);
+		CHECK(r_len == len);
+		CHECK(decoded == value);
+	}
+}
+
+TEST_CASE("[Marshalls] Decoding into reused containers") {
+	PackedFloat32Array floats;
+	floats.push_back(1.5);
+	floats.push_back(-2.5);
+	Array array;
+	array.push_back(floats);
+
+	int len;
+	encode_variant(array, nullptr, len);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	encode_variant(array, buffer.ptrw(), len);
+
+	Array target;
+	target.push_back(PackedFloat32Array());
+	Variant variant = target;
+	CHECK(decode_variant(variant, buffer.ptr(), len, nullptr, false, true) == OK);
+	CHECK_MESSAGE(target.size() == 1, "The Array held by the Variant should be decoded into");
+	CHECK(PackedFloat32Array(target[0]) == floats);
+}
+
+TEST_CASE("[Marshalls] Schema encoding") {
+	MarshallSchema schema;
+	schema.add_field("id", Variant::INT);
+	schema.add_field("name", Variant::STRING);
+	schema.add_field("position", Variant::VECTOR2);
+	schema.add_field("alive", Variant::BOOL);
+	schema.add_field("extra", Variant::NIL);
+
+	Dictionary values;
+	values["id"] = -3;
+	values["name"] = "Godot";
+	values["position"] = Vector2(1.5, -2);
+	values["alive"] = true;
+	values["extra"] = Variant();
+
+	int len;
+	CHECK(schema.encode(values, nullptr, len) == OK);
+	CHECK_MESSAGE(len == 1 + 6 + 8 + 1 + 4, "Fields should be encoded without headers, except for untyped ones");
+
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	CHECK(schema.encode(values, buffer.ptrw(), len) == OK);
+
+	Variant decoded[5];
+	int r_len;
+	CHECK(schema.decode(buffer.ptr(), len, decoded, 5, &r_len) == OK);
+	CHECK(r_len == len);
+	CHECK(decoded[0] == Variant(-3));
+	CHECK(decoded[1] == Variant("Godot"));
+	CHECK(decoded[2] == Variant(Vector2(1.5, -2)));
+	CHECK(decoded[3] == Variant(true));
+	CHECK(decoded[4] == Variant());
+
+	Dictionary decoded_values;
+	CHECK(schema.decode(buffer.ptr(), len, decoded_values) == OK);
+	CHECK(decoded_values.hash() == values.hash());
+
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(schema.decode(buffer.ptr(), len - 1, decoded, 5) != OK, "Truncated data should fail to decode");
+
+	values["id"] = "not a number";
+	CHECK_MESSAGE(schema.encode(values, nullptr, len) == ERR_INVALID_PARAMETER, "Values of the wrong type should fail to encode");
+	ERR_PRINT_ON;
+}
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
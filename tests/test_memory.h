@@ -0,0 +1,68 @@
+/*************************************************************************/
+/*  test_memory.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Memory] Tagged allocations") {
+	const uint64_t audio_before = Memory::get_tag_usage(Memory::TAG_AUDIO);
+	const uint64_t alloc_total_before = Memory::get_alloc_total();
+
+	void *mem = nullptr;
+	{
+		MEMORY_TAG_SCOPE(TAG_AUDIO);
+		CHECK(Memory::get_current_tag() == Memory::TAG_AUDIO);
+		mem = memalloc(1000);
+	}
+	CHECK_MESSAGE(
+			Memory::get_current_tag() == Memory::TAG_OTHER,
+			"The previous tag should be restored when the scope ends.");
+	CHECK(Memory::get_tag_usage(Memory::TAG_AUDIO) == audio_before + 1000);
+	CHECK(Memory::get_alloc_total() > alloc_total_before);
+
+	// Reallocating and freeing outside of the scope still accounts to the original tag.
+	mem = memrealloc(mem, 1500);
+	CHECK(Memory::get_tag_usage(Memory::TAG_AUDIO) == audio_before + 1500);
+
+	memfree(mem);
+	CHECK(Memory::get_tag_usage(Memory::TAG_AUDIO) == audio_before);
+}
+#endif
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
@@ -0,0 +1,119 @@
+/*************************************************************************/
+/*  test_message_queue.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class DeferredTarget : public Object {
+public:
+	int counter = 0;
+	MessageQueue *queue = nullptr;
+
+	void increment() {
+		counter++;
+	}
+
+	void increment_and_requeue() {
+		counter++;
+		if (counter < 3) {
+			queue->push_unique_callp(this, &DeferredTarget::increment_and_requeue);
+		}
+	}
+};
+
+TEST_CASE("[MessageQueue] Native calls") {
+	bool own_queue = MessageQueue::get_singleton() == nullptr;
+	MessageQueue *queue = own_queue ? memnew(MessageQueue) : MessageQueue::get_singleton();
+
+	DeferredTarget *target = memnew(DeferredTarget);
+	target->queue = queue;
+
+	SUBCASE("Calls are deferred until flush") {
+		queue->push_callp(target, &DeferredTarget::increment);
+		queue->push_callp(target, &DeferredTarget::increment);
+		CHECK(target->counter == 0);
+		queue->flush();
+		CHECK(target->counter == 2);
+	}
+
+	SUBCASE("Unique calls are coalesced") {
+		for (int i = 0; i < 10; i++) {
+			queue->push_unique_callp(target, &DeferredTarget::increment);
+		}
+		queue->flush();
+		CHECK_MESSAGE(target->counter == 1, "Identical pending calls should run once.");
+
+		queue->push_unique_callp(target, &DeferredTarget::increment);
+		queue->flush();
+		CHECK_MESSAGE(target->counter == 2, "A flushed unique call can be queued again.");
+	}
+
+	SUBCASE("Unique calls can requeue themselves while flushing") {
+		queue->push_unique_callp(target, &DeferredTarget::increment_and_requeue);
+		queue->flush();
+		CHECK(target->counter == 3);
+	}
+
+	SUBCASE("Queue grows past its initial buffer") {
+		const int count = 200000;
+		int failed = 0;
+		for (int i = 0; i < count; i++) {
+			if (queue->push_callp(target, &DeferredTarget::increment) != OK) {
+				failed++;
+			}
+		}
+		CHECK(failed == 0);
+		queue->flush();
+		CHECK_MESSAGE(target->counter == count, "No calls should be dropped when the buffer overflows.");
+	}
+
+	SUBCASE("Calls on freed objects are skipped") {
+		DeferredTarget *freed = memnew(DeferredTarget);
+		queue->push_callp(freed, &DeferredTarget::increment);
+		memdelete(freed);
+		queue->flush();
+		CHECK(target->counter == 0);
+	}
+
+	memdelete(target);
+	if (own_queue) {
+		memdelete(queue);
+	}
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
@@ -33,6 +33,7 @@
 
 #include "core/core_string_names.h"
 #include "core/object/object.h"
+#include "core/os/thread.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -201,6 +202,85 @@ TEST_CASE("[Object] Construction") {
 			"The database pointer returned by the object id should reference same object.");
 }
 
+TEST_CASE("[Object] Instance IDs are invalidated on free") {
+	Object *object = memnew(Object);
+	ObjectID id = object->get_instance_id();
+	CHECK(ObjectDB::get_instance(id) == object);
+	memdelete(object);
+	CHECK_MESSAGE(
+			ObjectDB::get_instance(id) == nullptr,
+			"The ID of a freed object should no longer resolve, even if its slot gets reused.");
+
+	Object *reused = memnew(Object);
+	CHECK(ObjectDB::get_instance(id) == nullptr);
+	CHECK(ObjectDB::get_instance(reused->get_instance_id()) == reused);
+	memdelete(reused);
+}
+
+#ifndef NO_THREADS
+static void _create_and_free_objects(void *p_userdata) {
+	bool *ok = (bool *)p_userdata;
+	Vector<Object *> objects;
+	for (int i = 0; i < 2000; i++) {
+		objects.push_back(memnew(Object));
+	}
+	for (int i = 0; i < objects.size(); i++) {
+		if (ObjectDB::get_instance(objects[i]->get_instance_id()) != objects[i]) {
+			*ok = false;
+		}
+		memdelete(objects[i]);
+	}
+}
+
+TEST_CASE("[Object] Instances created and freed from several threads") {
+	const int thread_count = 4;
+	int initial_count = ObjectDB::get_object_count();
+	Thread threads[thread_count];
+	bool ok[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		ok[i] = true;
+		threads[i].start(_create_and_free_objects, &ok[i]);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+		CHECK(ok[i]);
+	}
+	CHECK(ObjectDB::get_object_count() == initial_count);
+}
+#endif
+
+TEST_CASE("[Object] Signals connected to native methods") {
+	Object emitter;
+	Object target;
+	Vector<Variant> binds;
+	binds.push_back(true);
+	emitter.connect("script_changed", callable_mp(&target, &Object::set_block_signals), binds);
+	emitter.connect("script_changed", Callable(&target, "set_message_translation"), varray(false));
+
+	emitter.emit_signal("script_changed");
+	CHECK_MESSAGE(target.is_blocking_signals(), "Callable method pointers should still be called.");
+	CHECK_MESSAGE(!target.can_translate_messages(), "Native methods with matching argument types should be called directly.");
+
+	emitter.disconnect("script_changed", Callable(&target, "set_message_translation"));
+	// An int argument for a bool parameter takes the regular, converting call path.
+	emitter.connect("script_changed", Callable(&target, "set_message_translation"), varray(1));
+	emitter.emit_signal("script_changed");
+	CHECK(target.can_translate_messages());
+}
+
+TEST_CASE("[Object] Signal connection check") {
+	Object emitter;
+	Object target;
+	CHECK(!emitter.has_connections("script_changed"));
+
+	emitter.connect("script_changed", Callable(&target, "set_message_translation"), varray(false));
+	CHECK(emitter.has_connections("script_changed"));
+	CHECK(!emitter.has_connections("property_list_changed"));
+
+	emitter.disconnect("script_changed", Callable(&target, "set_message_translation"));
+	CHECK(!emitter.has_connections("script_changed"));
+}
+
 TEST_CASE("[Object] Script instance property setter") {
 	Object object;
 	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
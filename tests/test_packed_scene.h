@@ -0,0 +1,163 @@
+/*************************************************************************/
+/*  test_packed_scene.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef TEST_PACKED_SCENE_H
+#define TEST_PACKED_SCENE_H
+
+#include "core/object/script_language.h"
+#include "scene/main/node.h"
+#include "scene/resources/packed_scene.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+// Declared in global namespace because of GDCLASS macro warning (Windows).
+class _TestPooledNode : public Node {
+	GDCLASS(_TestPooledNode, Node);
+
+	int value = 0;
+	Array items;
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_value", "value"), &_TestPooledNode::set_value);
+		ClassDB::bind_method(D_METHOD("get_value"), &_TestPooledNode::get_value);
+		ClassDB::bind_method(D_METHOD("set_items", "items"), &_TestPooledNode::set_items);
+		ClassDB::bind_method(D_METHOD("get_items"), &_TestPooledNode::get_items);
+		ADD_PROPERTY(PropertyInfo(Variant::INT, "value"), "set_value", "get_value");
+		ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "items"), "set_items", "get_items");
+	}
+
+public:
+	void set_value(int p_value) { value = p_value; }
+	int get_value() const { return value; }
+	void set_items(const Array &p_items) { items = p_items; }
+	Array get_items() const { return items; }
+};
+
+namespace TestPackedScene {
+
+static Ref<PackedScene> pack_pooled_node() {
+	ClassDB::register_class<_TestPooledNode>();
+
+	_TestPooledNode *node = memnew(_TestPooledNode);
+	node->set_value(1);
+	Array items;
+	items.push_back(1);
+	items.push_back(2);
+	node->set_items(items);
+
+	Ref<PackedScene> scene;
+	scene.instance();
+	scene->pack(node);
+	memdelete(node);
+	return scene;
+}
+
+TEST_CASE("[PackedScene] Recycled instances get their initial property values back") {
+	Ref<PackedScene> scene = pack_pooled_node();
+
+	_TestPooledNode *node = Object::cast_to<_TestPooledNode>(scene->instance_pooled());
+	REQUIRE(node);
+	node->set_value(10);
+	node->set_items(Array());
+	scene->recycle_instance(node);
+
+	_TestPooledNode *recycled = Object::cast_to<_TestPooledNode>(scene->instance_pooled());
+	CHECK_MESSAGE(recycled == node, "The recycled instance is reused.");
+	CHECK(recycled->get_value() == 1);
+	CHECK(recycled->get_items().size() == 2);
+
+	scene->recycle_instance(recycled);
+	scene->clear_instance_pool();
+}
+
+TEST_CASE("[PackedScene] Containers modified in place don't leak into the snapshot") {
+	Ref<PackedScene> scene = pack_pooled_node();
+
+	_TestPooledNode *node = Object::cast_to<_TestPooledNode>(scene->instance_pooled());
+	REQUIRE(node);
+	for (int i = 0; i < 2; i++) {
+		// The array is shared with the node, so this modifies its property in place.
+		Array items = node->get_items();
+		items.push_back(3);
+		items[0] = 100;
+		scene->recycle_instance(node);
+
+		node = Object::cast_to<_TestPooledNode>(scene->instance_pooled());
+		REQUIRE(node);
+		Array restored = node->get_items();
+		CHECK(restored.size() == 2);
+		CHECK(int(restored[0]) == 1);
+		CHECK_MESSAGE(restored != items, "The restored array is not the one that was modified.");
+	}
+
+	scene->recycle_instance(node);
+	scene->clear_instance_pool();
+}
+
+TEST_CASE("[PackedScene] Recycled instances get their initial script variables back") {
+	if (!ClassDB::class_exists("GDScript")) {
+		return;
+	}
+
+	Ref<Script> script = Object::cast_to<Script>(ClassDB::instance("GDScript"));
+	script->set_source_code(
+			"extends Node\n"
+			"\n"
+			"var counter = 1\n"
+			"var seen = {}\n");
+	REQUIRE(script->reload() == OK);
+
+	Node *node = memnew(Node);
+	node->set_script(script);
+	Ref<PackedScene> scene;
+	scene.instance();
+	scene->pack(node);
+	memdelete(node);
+
+	node = scene->instance_pooled();
+	REQUIRE(node);
+	node->set("counter", 5);
+	Dictionary seen = node->get("seen");
+	seen["key"] = true;
+	scene->recycle_instance(node);
+
+	node = scene->instance_pooled();
+	CHECK(int(node->get("counter")) == 1);
+	CHECK(Dictionary(node->get("seen")).is_empty());
+
+	scene->recycle_instance(node);
+	scene->clear_instance_pool();
+}
+
+} // namespace TestPackedScene
+
+#endif // TEST_PACKED_SCENE_H
@@ -0,0 +1,89 @@
+/*************************************************************************/
+/*  test_ring_buffer.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_RING_BUFFER_H
+#define TEST_RING_BUFFER_H
+
+#include "core/templates/ring_buffer.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRingBuffer {
+
+TEST_CASE("[RingBuffer] Write and read") {
+	RingBuffer<int> rb(3); // 8 slots, 7 usable.
+
+	const int in[5] = { 1, 2, 3, 4, 5 };
+	CHECK(rb.write(in, 5) == 5);
+	CHECK(rb.data_left() == 5);
+	CHECK(rb.space_left() == 2);
+
+	int out[5] = {};
+	CHECK(rb.read(out, 5) == 5);
+	for (int i = 0; i < 5; i++) {
+		CHECK(out[i] == in[i]);
+	}
+	CHECK(rb.data_left() == 0);
+
+	// Wraps around the end of the buffer.
+	CHECK(rb.write(in, 5) == 5);
+	CHECK(rb.read(out, 5) == 5);
+	for (int i = 0; i < 5; i++) {
+		CHECK(out[i] == in[i]);
+	}
+}
+
+TEST_CASE("[RingBuffer] Peek contiguous") {
+	RingBuffer<int> rb(3);
+
+	const int in[6] = { 1, 2, 3, 4, 5, 6 };
+	rb.write(in, 6);
+
+	const int *view = rb.peek_contiguous(6);
+	REQUIRE(view != nullptr);
+	CHECK(view[0] == 1);
+	CHECK(view[5] == 6);
+	CHECK_MESSAGE(rb.peek_contiguous(7) == nullptr, "Can't peek more than what's available.");
+	CHECK(rb.advance_read(6) == 6);
+
+	// Data now wraps around the end of the buffer.
+	rb.write(in, 4);
+	CHECK(rb.peek_contiguous(2) != nullptr);
+	CHECK_MESSAGE(rb.peek_contiguous(4) == nullptr, "Wrapping data can't be peeked in place.");
+
+	int out[4] = {};
+	CHECK(rb.read(out, 4) == 4);
+	CHECK(out[0] == 1);
+	CHECK(out[3] == 4);
+}
+
+} // namespace TestRingBuffer
+
+#endif // TEST_RING_BUFFER_H
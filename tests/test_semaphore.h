@@ -0,0 +1,71 @@
+/*************************************************************************/
+/*  test_semaphore.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef TEST_SEMAPHORE_H
+#define TEST_SEMAPHORE_H
+
+#include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSemaphore {
+
+#ifndef NO_THREADS
+
+static void post_after_delay(void *p_semaphore) {
+	OS::get_singleton()->delay_usec(10000);
+	((Semaphore *)p_semaphore)->post();
+}
+
+TEST_CASE("[Semaphore] Timed wait") {
+	Semaphore semaphore;
+
+	CHECK_MESSAGE(!semaphore.wait_usec(1000), "Times out when nothing is posted.");
+
+	semaphore.post();
+	CHECK(semaphore.wait_usec(1000));
+	CHECK_MESSAGE(!semaphore.try_wait(), "The post was consumed by the wait.");
+
+	Thread thread;
+	thread.start(post_after_delay, &semaphore);
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	CHECK(semaphore.wait_usec(10000000));
+	CHECK_MESSAGE(OS::get_singleton()->get_ticks_usec() - begin < 5000000, "Returns when posted, before the timeout.");
+	thread.wait_to_finish();
+}
+
+#endif // NO_THREADS
+
+} // namespace TestSemaphore
+
+#endif // TEST_SEMAPHORE_H
@@ -0,0 +1,83 @@
+/*************************************************************************/
+/*  test_small_vector.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_SMALL_VECTOR_H
+#define TEST_SMALL_VECTOR_H
+
+#include "core/string/ustring.h"
+#include "core/templates/small_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSmallVector {
+
+TEST_CASE("[SmallVector] Inline storage and heap fallback") {
+	SmallVector<int, 4> vector;
+	for (int i = 0; i < 4; i++) {
+		vector.push_back(i);
+	}
+	CHECK_MESSAGE(!vector.is_on_heap(), "Up to N elements should be stored inline.");
+
+	vector.push_back(4);
+	CHECK(vector.is_on_heap());
+	CHECK(vector.size() == 5);
+	for (int i = 0; i < 5; i++) {
+		CHECK(vector[i] == i);
+	}
+
+	vector.remove_unordered(0);
+	CHECK(vector.size() == 4);
+	CHECK(vector[0] == 4);
+
+	vector.reset();
+	CHECK(vector.is_empty());
+	CHECK_MESSAGE(!vector.is_on_heap(), "Resetting should go back to the inline storage.");
+}
+
+TEST_CASE("[SmallVector] Non-trivial elements") {
+	SmallVector<String, 2> vector;
+	vector.push_back("a");
+	vector.push_back("b");
+	vector.push_back("c");
+
+	SmallVector<String, 2> copy = vector;
+	vector[0] = "changed";
+	CHECK_MESSAGE(copy[0] == "a", "Copies should not share storage.");
+	CHECK(copy[2] == "c");
+
+	copy.resize(8);
+	CHECK(copy[7].is_empty());
+	copy.resize(1);
+	CHECK(copy.size() == 1);
+}
+
+} // namespace TestSmallVector
+
+#endif // TEST_SMALL_VECTOR_H
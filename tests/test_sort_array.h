@@ -0,0 +1,148 @@
+/*************************************************************************/
+/*  test_sort_array.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_SORT_ARRAY_H
+#define TEST_SORT_ARRAY_H
+
+#include "core/math/random_pcg.h"
+#include "core/templates/parallel_sort_array.h"
+#include "core/templates/sort_array.h"
+#include "core/variant/array.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestSortArray {
+
+struct KeyValue {
+	int key = 0;
+	int value = 0;
+};
+
+struct KeyComparator {
+	_FORCE_INLINE_ bool operator()(const KeyValue &p_a, const KeyValue &p_b) const {
+		return p_a.key < p_b.key;
+	}
+};
+
+// Few distinct keys, so stability is actually tested. Values hold the original position.
+static Vector<KeyValue> make_pairs(int p_size, int p_keys) {
+	RandomPCG rng(42);
+	Vector<KeyValue> pairs;
+	pairs.resize(p_size);
+	for (int i = 0; i < p_size; i++) {
+		pairs.write[i].key = rng.rand() % p_keys;
+		pairs.write[i].value = i;
+	}
+	return pairs;
+}
+
+static bool is_stable_sorted(const Vector<KeyValue> &p_pairs) {
+	for (int i = 1; i < p_pairs.size(); i++) {
+		const KeyValue &a = p_pairs[i - 1];
+		const KeyValue &b = p_pairs[i];
+		if (a.key > b.key || (a.key == b.key && a.value > b.value)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[SortArray] Stable sort keeps the order of equal elements") {
+	for (int size : { 0, 1, 15, 16, 17, 100, 1000, 4099 }) {
+		Vector<KeyValue> pairs = make_pairs(size, 8);
+		SortArray<KeyValue, KeyComparator> sorter;
+		sorter.stable_sort(pairs.ptrw(), pairs.size());
+		CHECK_MESSAGE(is_stable_sorted(pairs), "Stable sort of ", size, " elements.");
+	}
+}
+
+TEST_CASE("[SortArray] Parallel sort of large arrays") {
+	const int size = ParallelSortArray<int>::MIN_ELEMENTS_PER_THREAD * 4 + 123;
+
+	Vector<KeyValue> pairs = make_pairs(size, 100);
+	ParallelSortArray<KeyValue, KeyComparator> sorter;
+	sorter.sort(pairs.ptrw(), pairs.size(), true);
+	CHECK_MESSAGE(is_stable_sorted(pairs), "Stable parallel sort keeps the order of equal elements.");
+
+	RandomPCG rng(7);
+	Vector<int> values;
+	values.resize(size);
+	int64_t sum = 0;
+	for (int i = 0; i < size; i++) {
+		values.write[i] = rng.rand() % 1000000;
+		sum += values[i];
+	}
+	ParallelSortArray<int> int_sorter;
+	int_sorter.sort(values.ptrw(), values.size());
+
+	bool sorted = true;
+	int64_t sorted_sum = values[0];
+	for (int i = 1; i < size; i++) {
+		sorted = sorted && values[i - 1] <= values[i];
+		sorted_sum += values[i];
+	}
+	CHECK(sorted);
+	CHECK_MESSAGE(sorted_sum == sum, "No element is lost or duplicated while merging.");
+}
+
+TEST_CASE("[SortArray] Large Array and packed array sorts") {
+	const int size = ParallelSortArray<int>::MIN_ELEMENTS_PER_THREAD * 3;
+
+	RandomPCG rng(13);
+	Array array;
+	PackedFloat64Array packed;
+	array.resize(size);
+	packed.resize(size);
+	for (int i = 0; i < size; i++) {
+		double value = rng.randf();
+		array[i] = value;
+		packed.write[i] = value;
+	}
+
+	array.sort();
+	Variant packed_variant = packed;
+	Callable::CallError ce;
+	Variant ret;
+	packed_variant.call("sort", nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	packed = packed_variant;
+
+	bool sorted = true;
+	for (int i = 1; i < size; i++) {
+		sorted = sorted && double(array[i - 1]) <= double(array[i]) && packed[i - 1] <= packed[i];
+	}
+	CHECK(sorted);
+	CHECK(double(array[0]) == packed[0]);
+	CHECK(double(array[size - 1]) == packed[size - 1]);
+}
+
+} // namespace TestSortArray
+
+#endif // TEST_SORT_ARRAY_H
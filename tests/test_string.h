@@ -1272,6 +1272,25 @@ TEST_CASE("[String] humanize_size") {
 	CHECK(String::humanize_size(100523550) == "95.86 MiB");
 	CHECK(String::humanize_size(5345555000) == "4.97 GiB");
 }
+
+TEST_CASE("[StringName] Interning") {
+	// Enough names to make the intern table grow its buckets.
+	Vector<StringName> names;
+	for (int i = 0; i < 20000; i++) {
+		names.push_back(StringName("interned_" + itos(i)));
+	}
+	for (int i = 0; i < 20000; i += 997) {
+		StringName again = StringName("interned_" + itos(i));
+		CHECK_MESSAGE(again == names[i], "Equal strings should intern to the same StringName.");
+		CHECK(StringName::search("interned_" + itos(i)) == names[i]);
+	}
+	names.clear();
+	CHECK_MESSAGE(StringName::search("interned_0") == StringName(), "Unreferenced names should be removed from the table.");
+
+	const StringName &cached = SNAME("cached_literal");
+	CHECK(cached == StringName("cached_literal"));
+	CHECK(SNAME("cached_literal") == cached);
+}
 } // namespace TestString
 
 #endif // TEST_STRING_H
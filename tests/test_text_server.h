@@ -101,6 +101,41 @@ TEST_SUITE("[[TextServer]") {
 			}
 		}
 
+		SUBCASE("[TextServer] Text layout: Repeated runs") {
+			for (int i = 0; i < TextServerManager::get_interface_count(); i++) {
+				TextServer *ts = TextServerManager::initialize(i, err);
+
+				Vector<RID> font;
+				font.push_back(ts->create_font_memory(_font_NotoSansUI_Regular, _font_NotoSansUI_Regular_size, "ttf"));
+
+				// The second buffer shapes the same runs at a different offset, it must get the same glyphs.
+				String test = U"Godot khon uan";
+				RID ctx1 = ts->create_shaped_text();
+				RID ctx2 = ts->create_shaped_text();
+				TEST_FAIL_COND(!ts->shaped_text_add_string(ctx1, test, font, 16), "Adding text to the buffer failed.");
+				TEST_FAIL_COND(!ts->shaped_text_add_string(ctx2, test, font, 16), "Adding text to the buffer failed.");
+				TEST_FAIL_COND(!ts->shaped_text_add_string(ctx2, test, font, 16), "Adding text to the buffer failed.");
+
+				Vector<TextServer::Glyph> glyphs1 = ts->shaped_text_get_glyphs(ctx1);
+				Vector<TextServer::Glyph> glyphs2 = ts->shaped_text_get_glyphs(ctx2);
+				TEST_FAIL_COND(glyphs1.size() == 0, "Shaping failed");
+				TEST_FAIL_COND(glyphs2.size() < glyphs1.size(), "Shaping failed");
+				for (int j = 0; j < glyphs1.size(); j++) {
+					TEST_FAIL_COND(glyphs1[j].index != glyphs2[j].index, "Incorrect glyph index.");
+					TEST_FAIL_COND(glyphs1[j].start != glyphs2[j].start, "Incorrect glyph range.");
+					TEST_FAIL_COND(glyphs1[j].end != glyphs2[j].end, "Incorrect glyph range.");
+					TEST_FAIL_COND(glyphs1[j].advance != glyphs2[j].advance, "Incorrect glyph advance.");
+				}
+
+				ts->free(ctx1);
+				ts->free(ctx2);
+				for (int j = 0; j < font.size(); j++) {
+					ts->free(font[j]);
+				}
+				font.clear();
+			}
+		}
+
 		SUBCASE("[TextServer] Text layout: BiDi") {
 			for (int i = 0; i < TextServerManager::get_interface_count(); i++) {
 				TextServer *ts = TextServerManager::initialize(i, err);
@@ -0,0 +1,151 @@
+/*************************************************************************/
+/*  test_timer_wheel.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_TIMER_WHEEL_H
+#define TEST_TIMER_WHEEL_H
+
+#include "core/templates/local_vector.h"
+#include "core/templates/timer_wheel.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTimerWheel {
+
+struct Timer {
+	int id = 0;
+	TimerWheel<Timer>::Element element;
+
+	Timer() :
+			element(this) {}
+};
+
+static LocalVector<int> pop_all(TimerWheel<Timer> &p_wheel) {
+	LocalVector<int> ids;
+	while (Timer *timer = p_wheel.pop_expired()) {
+		ids.push_back(timer->id);
+	}
+	return ids;
+}
+
+TEST_CASE("[TimerWheel] Expiration order") {
+	TimerWheel<Timer> wheel;
+	Timer timers[4];
+	const uint64_t deadlines[4] = { 70, 5, 200000, 63 };
+	for (int i = 0; i < 4; i++) {
+		timers[i].id = i;
+		wheel.insert(&timers[i].element, deadlines[i]);
+	}
+	CHECK(wheel.size() == 4);
+
+	wheel.advance(4);
+	CHECK(!wheel.has_expired());
+
+	wheel.advance(64);
+	LocalVector<int> ids = pop_all(wheel);
+	REQUIRE(ids.size() == 2);
+	CHECK_MESSAGE(ids[0] == 1, "Earlier deadlines expire first.");
+	CHECK(ids[1] == 3);
+
+	wheel.advance(199999);
+	ids = pop_all(wheel);
+	REQUIRE(ids.size() == 1);
+	CHECK(ids[0] == 0);
+
+	wheel.advance(1000000);
+	ids = pop_all(wheel);
+	REQUIRE(ids.size() == 1);
+	CHECK_MESSAGE(ids[0] == 2, "Deadlines in upper levels are cascaded down.");
+	CHECK(wheel.size() == 0);
+}
+
+TEST_CASE("[TimerWheel] Remove and restart") {
+	TimerWheel<Timer> wheel;
+	Timer a;
+	Timer b;
+	a.id = 1;
+	b.id = 2;
+
+	wheel.insert(&a.element, 10);
+	wheel.insert(&b.element, 10);
+	a.element.remove_from_wheel();
+	CHECK(!a.element.in_wheel());
+
+	wheel.insert(&b.element, 5000);
+	CHECK_MESSAGE(wheel.size() == 1, "Inserting again moves the element.");
+
+	wheel.advance(100);
+	CHECK(!wheel.has_expired());
+
+	wheel.insert(&a.element, 50);
+	CHECK_MESSAGE(pop_all(wheel).size() == 0, "Past deadlines wait for the next advance.");
+	wheel.advance(100);
+	LocalVector<int> ids = pop_all(wheel);
+	REQUIRE(ids.size() == 1);
+	CHECK(ids[0] == 1);
+
+	{
+		Timer c;
+		wheel.insert(&c.element, 200);
+	}
+	CHECK_MESSAGE(wheel.size() == 1, "Destroyed elements leave the wheel.");
+
+	wheel.advance(5000);
+	ids = pop_all(wheel);
+	REQUIRE(ids.size() == 1);
+	CHECK(ids[0] == 2);
+}
+
+TEST_CASE("[TimerWheel] Many timers") {
+	TimerWheel<Timer> wheel;
+	const int count = 50000;
+	LocalVector<Timer> timers;
+	timers.resize(count);
+	for (int i = 0; i < count; i++) {
+		timers[i].id = i;
+		wheel.insert(&timers[i].element, uint64_t(i) * 37 % 100000);
+	}
+
+	uint64_t expired = 0;
+	bool in_time = true;
+	for (uint64_t time = 0; time < 100016; time += 16) {
+		wheel.advance(time);
+		while (Timer *timer = wheel.pop_expired()) {
+			in_time = in_time && timer->element.get_deadline() <= time && timer->element.get_deadline() + 16 > time;
+			expired++;
+		}
+	}
+	CHECK(expired == count);
+	CHECK_MESSAGE(in_time, "Timers expire on the first advance past their deadline.");
+	CHECK(wheel.size() == 0);
+}
+
+} // namespace TestTimerWheel
+
+#endif // TEST_TIMER_WHEEL_H
@@ -0,0 +1,115 @@
+/*************************************************************************/
+/*  test_translation.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef TEST_TRANSLATION_H
+#define TEST_TRANSLATION_H
+
+#include "core/string/compressed_translation.h"
+#include "core/string/translation.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestTranslation {
+
+TEST_CASE("[TranslationServer] Cached lookups follow catalog changes") {
+	TranslationServer *ts = TranslationServer::get_singleton();
+	bool own_server = !ts;
+	if (own_server) {
+		ts = memnew(TranslationServer);
+	}
+	String previous_locale = ts->get_locale();
+	ts->set_locale("fr");
+
+	Ref<Translation> fr;
+	fr.instance();
+	fr->set_locale("fr");
+	fr->add_message("Hello", "Bonjour");
+	ts->add_translation(fr);
+
+	CHECK(ts->translate("Hello") == "Bonjour");
+	CHECK(ts->translate("Goodbye") == "Goodbye");
+
+	fr->add_message("Goodbye", "Au revoir");
+	CHECK_MESSAGE(ts->translate("Goodbye") == "Au revoir", "Untranslated messages aren't cached past a catalog change.");
+	fr->add_message("Hello", "Salut");
+	CHECK(ts->translate("Hello") == "Salut");
+	fr->erase_message("Hello");
+	CHECK(ts->translate("Hello") == "Hello");
+
+	Ref<Translation> fr_ca;
+	fr_ca.instance();
+	fr_ca->set_locale("fr_CA");
+	fr_ca->add_message("Goodbye", "Bonsoir");
+	ts->add_translation(fr_ca);
+	CHECK_MESSAGE(ts->translate("Goodbye") == "Au revoir", "Exact locale matches win over near ones.");
+
+	ts->set_locale("fr_CA");
+	CHECK(ts->translate("Goodbye") == "Bonsoir");
+
+	ts->set_locale("de");
+	CHECK(ts->translate("Goodbye") == "Goodbye");
+
+	ts->remove_translation(fr_ca);
+	ts->remove_translation(fr);
+	ts->set_locale(previous_locale);
+	if (own_server) {
+		memdelete(ts);
+	}
+}
+
+#ifdef TOOLS_ENABLED
+TEST_CASE("[PHashTranslation] Compressed messages") {
+	Ref<Translation> source;
+	source.instance();
+	source->set_locale("fr");
+	source->add_message("Hello", "Bonjour");
+	source->add_message("A longer message that compresses", "Un message plus long qui se compresse bien, bien, bien");
+
+	Ref<PHashTranslation> compressed;
+	compressed.instance();
+	compressed->generate(source);
+
+	for (int i = 0; i < 2; i++) {
+		// The second pass is answered from the decompressed message cache.
+		CHECK(compressed->get_message("Hello") == "Bonjour");
+		CHECK(compressed->get_message("A longer message that compresses") == "Un message plus long qui se compresse bien, bien, bien");
+		CHECK(compressed->get_message("Missing") == StringName());
+	}
+
+	source->add_message("Hello", "Salut");
+	compressed->generate(source);
+	CHECK_MESSAGE(compressed->get_message("Hello") == "Salut", "Generating again drops the cached messages.");
+}
+#endif
+
+} // namespace TestTranslation
+
+#endif // TEST_TRANSLATION_H
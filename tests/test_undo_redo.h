@@ -0,0 +1,152 @@
+/*************************************************************************/
+/*  test_undo_redo.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2021 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2021 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_UNDO_REDO_H
+#define TEST_UNDO_REDO_H
+
+#include "core/object/undo_redo.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+// Declared in global namespace because of GDCLASS macro warning (Windows).
+class _TestUndoRedoObject : public Object {
+	GDCLASS(_TestUndoRedoObject, Object);
+
+	int value = 0;
+	PackedByteArray data;
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_value", "value"), &_TestUndoRedoObject::set_value);
+		ClassDB::bind_method(D_METHOD("get_value"), &_TestUndoRedoObject::get_value);
+		ClassDB::bind_method(D_METHOD("set_data", "data"), &_TestUndoRedoObject::set_data);
+		ClassDB::bind_method(D_METHOD("get_data"), &_TestUndoRedoObject::get_data);
+		ADD_PROPERTY(PropertyInfo(Variant::INT, "value"), "set_value", "get_value");
+		ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "data"), "set_data", "get_data");
+	}
+
+public:
+	void set_value(int p_value) { value = p_value; }
+	int get_value() const { return value; }
+	void set_data(const PackedByteArray &p_data) { data = p_data; }
+	PackedByteArray get_data() const { return data; }
+};
+
+namespace TestUndoRedo {
+
+static void set_value(UndoRedo &p_undo_redo, _TestUndoRedoObject &p_object, int p_value, UndoRedo::MergeMode p_mode) {
+	p_undo_redo.create_action("Set Value", p_mode);
+	p_undo_redo.add_do_property(&p_object, "value", p_value);
+	p_undo_redo.add_undo_property(&p_object, "value", p_object.get_value());
+	p_undo_redo.commit_action();
+}
+
+TEST_CASE("[UndoRedo] Merged property changes are coalesced") {
+	ClassDB::register_class<_TestUndoRedoObject>();
+	_TestUndoRedoObject object;
+	UndoRedo undo_redo;
+
+	for (int i = 1; i <= 10; i++) {
+		set_value(undo_redo, object, i, UndoRedo::MERGE_ALL);
+	}
+	CHECK(object.get_value() == 10);
+	CHECK(undo_redo.get_history_count() == 1);
+
+	CHECK(undo_redo.undo());
+	CHECK_MESSAGE(object.get_value() == 0, "Undoing restores the value from before the first merged action.");
+	CHECK(undo_redo.redo());
+	CHECK(object.get_value() == 10);
+}
+
+TEST_CASE("[UndoRedo] Large packed array changes are undone from a delta") {
+	ClassDB::register_class<_TestUndoRedoObject>();
+	_TestUndoRedoObject object;
+	UndoRedo undo_redo;
+
+	PackedByteArray before;
+	before.resize(1 << 20);
+	for (int i = 0; i < before.size(); i++) {
+		before.write[i] = i & 0xFF;
+	}
+	object.set_data(before);
+
+	PackedByteArray after = before;
+	for (int i = 1000; i < 1100; i++) {
+		after.write[i] = 0;
+	}
+	after.write[500000] = 0xFF;
+
+	undo_redo.create_action("Paint");
+	undo_redo.add_do_property(&object, "data", after);
+	undo_redo.add_undo_property(&object, "data", object.get_data());
+	undo_redo.commit_action();
+
+	CHECK_MESSAGE(undo_redo.get_history_memory() < uint64_t(before.size()) + 4096, "Only one full copy of the array is kept.");
+
+	CHECK(undo_redo.undo());
+	CHECK(object.get_data() == before);
+	CHECK(undo_redo.redo());
+	CHECK(object.get_data() == after);
+}
+
+TEST_CASE("[UndoRedo] Oldest actions are dropped past the memory limit") {
+	ClassDB::register_class<_TestUndoRedoObject>();
+	_TestUndoRedoObject object;
+	UndoRedo undo_redo;
+
+	PackedByteArray data;
+	data.resize(1024);
+	object.set_data(data);
+
+	undo_redo.set_max_memory(8 * 1024);
+	for (int i = 0; i < 20; i++) {
+		data.write[0] = i + 1;
+		undo_redo.create_action("Set Data");
+		undo_redo.add_do_property(&object, "data", data);
+		undo_redo.add_undo_property(&object, "data", object.get_data());
+		undo_redo.commit_action();
+	}
+
+	CHECK(undo_redo.get_history_count() < 20);
+	CHECK(undo_redo.get_history_count() > 0);
+	CHECK(undo_redo.get_history_memory() <= undo_redo.get_max_memory());
+
+	while (undo_redo.undo()) {
+	}
+	CHECK_MESSAGE(object.get_data()[0] > 0, "The first actions can't be undone anymore.");
+
+	undo_redo.set_max_memory(0);
+	undo_redo.clear_history();
+	CHECK(undo_redo.get_history_memory() == 0);
+}
+
+} // namespace TestUndoRedo
+
+#endif // TEST_UNDO_REDO_H
@@ -106,6 +106,39 @@ TEST_CASE("[Variant] Writer and parser float") {
 	CHECK_MESSAGE(b64_float_parsed == 340282001837565597733306976381245063168.0, "Should not overflow.");
 }
 
+TEST_CASE("[Variant] Writer and parser packed arrays") {
+	// Long enough to span several readahead blocks of the stream.
+	PackedInt64Array ints;
+	for (int i = 0; i < 2000; i++) {
+		ints.push_back(int64_t(i) * (i % 2 ? -12345678901 : 1));
+	}
+	String ints_str;
+	VariantWriter::write_to_string(ints, ints_str);
+
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 0;
+	Variant parsed;
+
+	ss.s = ints_str;
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	CHECK_MESSAGE(PackedInt64Array(parsed) == ints, "Should parse back.");
+
+	VariantParser::StreamString float_ss;
+	float_ss.s = "PackedFloat32Array( 1, -2.5,\n3e2 )";
+	CHECK(VariantParser::parse(&float_ss, parsed, errs, line) == OK);
+	PackedFloat32Array floats = parsed;
+	CHECK(floats.size() == 3);
+	CHECK(floats[0] == 1);
+	CHECK(floats[1] == -2.5);
+	CHECK(floats[2] == 300);
+	CHECK_MESSAGE(line == 1, "Lines inside the array should be counted.");
+
+	VariantParser::StreamString bad_ss;
+	bad_ss.s = "PackedInt32Array( 1, 2 3 )";
+	CHECK_MESSAGE(VariantParser::parse(&bad_ss, parsed, errs, line) == ERR_PARSE_ERROR, "Missing commas should fail to parse.");
+}
+
 TEST_CASE("[Variant] Assignment To Bool from Int,Float,String,Vec2,Vec2i,Vec3,Vec3i and Color") {
 	Variant int_v = 0;
 	Variant bool_v = true;
@@ -699,6 +732,46 @@ TEST_CASE("[Variant] Assignment To Color from Bool,Int,Float,String,Vec2,Vec2i,V
 	vec3i_v = col_v;
 	CHECK(vec3i_v.get_type() == Variant::COLOR);
 }
+TEST_CASE("[Variant] Typed arrays resize and convert to packed arrays") {
+	Array ints;
+	ints.set_typed(Variant::INT, StringName(), Variant());
+	CHECK(ints.is_typed());
+	CHECK(ints.get_typed_builtin() == Variant::INT);
+
+	ints.resize(3);
+	CHECK_MESSAGE(ints[2].get_type() == Variant::INT, "New elements of typed arrays have the default value of their type.");
+	ints[0] = 1;
+	ints[1] = -2;
+	ints[2] = 300;
+
+	PackedInt32Array packed_ints = Variant(ints);
+	REQUIRE(packed_ints.size() == 3);
+	CHECK(packed_ints[0] == 1);
+	CHECK(packed_ints[1] == -2);
+	CHECK(packed_ints[2] == 300);
+
+	PackedFloat64Array packed_floats = Variant(ints);
+	CHECK_MESSAGE(packed_floats[1] == -2.0, "Types that don't match the packed array are still converted.");
+
+	Array vectors;
+	vectors.set_typed(Variant::VECTOR3, StringName(), Variant());
+	vectors.push_back(Vector3(1, 2, 3));
+	vectors.push_back(Vector3(4, 5, 6));
+	PackedVector3Array packed_vectors = Variant(vectors);
+	REQUIRE(packed_vectors.size() == 2);
+	CHECK(packed_vectors[1] == Vector3(4, 5, 6));
+
+	// Elements written by reference aren't validated, they must still convert.
+	vectors[0] = Vector2(7, 8);
+	packed_vectors = Variant(vectors);
+	CHECK(packed_vectors[0] == Vector3(7, 8, 0));
+
+	Array untyped;
+	untyped.resize(1);
+	CHECK_FALSE(untyped.is_typed());
+	CHECK(untyped[0].get_type() == Variant::NIL);
+}
+
 } // namespace TestVariant
 
 #endif // TEST_VARIANT_H
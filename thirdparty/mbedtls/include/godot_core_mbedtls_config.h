@@ -6,6 +6,9 @@
 #define MBEDTLS_CIPHER_MODE_XTS
 
 #define MBEDTLS_AES_C
+// AES-NI is used when the CPU supports it (x86-64 only, detected at runtime).
+#define MBEDTLS_HAVE_ASM
+#define MBEDTLS_AESNI_C
 #define MBEDTLS_BASE64_C
 #define MBEDTLS_MD5_C
 #define MBEDTLS_SHA1_C